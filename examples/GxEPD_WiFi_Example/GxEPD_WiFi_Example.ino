@@ -37,6 +37,7 @@
 
 // include library, include base class, make path known
 #include <GxEPD.h>
+#include <GxBMP.h>
 
 // select the display class to use, only one
 //#include <GxGDEP015OC1/GxGDEP015OC1.h>    // 1.54" b/w
@@ -226,20 +227,12 @@ void drawBitmaps_test()
   delay(2000);
 }
 
-static const uint16_t input_buffer_pixels = 640; // may affect performance
-
-static const uint16_t max_palette_pixels = 256; // for depth <= 8
-
-uint8_t input_buffer[3 * input_buffer_pixels]; // up to depth 24
-uint8_t mono_palette_buffer[max_palette_pixels / 8]; // palette buffer for depth <= 8 b/w
-uint8_t color_palette_buffer[max_palette_pixels / 8]; // palette buffer for depth <= 8 c/w
+GxBMP bmp(display);
 
 void drawBitmapFrom_HTTP_ToBuffer(const char* host, const char* path, const char* filename, int16_t x, int16_t y, bool with_color)
 {
   WiFiClient client;
   bool connection_ok = false;
-  bool valid = false; // valid format to be handled
-  bool flip = true; // bitmap is stored bottom-to-top
   uint32_t startTime = millis();
   if ((x >= display.width()) || (y >= display.height())) return;
   display.fillScreen(GxEPD_WHITE);
@@ -274,177 +267,20 @@ void drawBitmapFrom_HTTP_ToBuffer(const char* host, const char* path, const char
     }
   }
   if (!connection_ok) return;
-  // Parse BMP header
-  if (read16(client) == 0x4D42) // BMP signature
+  // the BMP from the response body, in file order
+  GxBMP_StreamInput input(client);
+  if (bmp.begin(input))
   {
-    uint32_t fileSize = read32(client);
-    uint32_t creatorBytes = read32(client);
-    uint32_t imageOffset = read32(client); // Start of image data
-    uint32_t headerSize = read32(client);
-    uint32_t width  = read32(client);
-    uint32_t height = read32(client);
-    uint16_t planes = read16(client);
-    uint16_t depth = read16(client); // bits per pixel
-    uint32_t format = read32(client);
-    uint32_t bytes_read = 7 * 4 + 3 * 2; // read so far
-    if ((planes == 1) && ((format == 0) || (format == 3))) // uncompressed is handled, 565 also
-    {
-      Serial.print("File size: "); Serial.println(fileSize);
-      Serial.print("Image Offset: "); Serial.println(imageOffset);
-      Serial.print("Header size: "); Serial.println(headerSize);
-      Serial.print("Bit Depth: "); Serial.println(depth);
-      Serial.print("Image size: ");
-      Serial.print(width);
-      Serial.print('x');
-      Serial.println(height);
-      // BMP rows are padded (if needed) to 4-byte boundary
-      uint32_t rowSize = (width * depth / 8 + 3) & ~3;
-      if (depth < 8) rowSize = ((width * depth + 8 - depth) / 8 + 3) & ~3;
-      if (height < 0)
-      {
-        height = -height;
-        flip = false;
-      }
-      uint16_t w = width;
-      uint16_t h = height;
-      if ((x + w - 1) >= display.width())  w = display.width()  - x;
-      if ((y + h - 1) >= display.height()) h = display.height() - y;
-      valid = true;
-      uint8_t bitmask = 0xFF;
-      uint8_t bitshift = 8 - depth;
-      uint16_t red, green, blue;
-      bool whitish, colored;
-      if (depth == 1) with_color = false;
-      if (depth <= 8)
-      {
-        if (depth < 8) bitmask >>= depth;
-        bytes_read += skip(client, 54 - bytes_read); //palette is always @ 54
-        for (uint16_t pn = 0; pn < (1 << depth); pn++)
-        {
-          blue  = client.read();
-          green = client.read();
-          red   = client.read();
-          client.read();
-          bytes_read += 4;
-          whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-          colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-          if (0 == pn % 8) mono_palette_buffer[pn / 8] = 0;
-          mono_palette_buffer[pn / 8] |= whitish << pn % 8;
-          if (0 == pn % 8) color_palette_buffer[pn / 8] = 0;
-          color_palette_buffer[pn / 8] |= colored << pn % 8;
-          //Serial.print("0x00"); Serial.print(red, HEX); Serial.print(green, HEX); Serial.print(blue, HEX);
-          //Serial.print(" : "); Serial.print(whitish); Serial.print(", "); Serial.println(colored);
-        }
-      }
-      display.fillScreen(GxEPD_WHITE);
-      uint32_t rowPosition = flip ? imageOffset + (height - h) * rowSize : imageOffset;
-      //Serial.print("skip "); Serial.println(rowPosition - bytes_read);
-      bytes_read += skip(client, rowPosition - bytes_read);
-      for (uint16_t row = 0; row < h; row++, rowPosition += rowSize) // for each line
-      {
-        if (!connection_ok || !client.connected()) break;
-        delay(1); // yield() to avoid WDT
-        uint32_t in_remain = rowSize;
-        uint32_t in_idx = 0;
-        uint32_t in_bytes = 0;
-        uint8_t in_byte = 0; // for depth <= 8
-        uint8_t in_bits = 0; // for depth <= 8
-        uint16_t color = GxEPD_WHITE;
-        for (uint16_t col = 0; col < w; col++) // for each pixel
-        {
-          yield();
-          if (!connection_ok || !client.connected()) break;
-          // Time to read more pixel data?
-          if (in_idx >= in_bytes) // ok, exact match for 24bit also (size IS multiple of 3)
-          {
-            uint32_t get = in_remain > sizeof(input_buffer) ? sizeof(input_buffer) : in_remain;
-            uint32_t got = read(client, input_buffer, get);
-            while ((got < get) && connection_ok)
-            {
-              //Serial.print("got "); Serial.print(got); Serial.print(" < "); Serial.print(get); Serial.print(" @ "); Serial.println(bytes_read);
-              uint32_t gotmore = read(client, input_buffer + got, get - got);
-              got += gotmore;
-              connection_ok = gotmore > 0;
-            }
-            in_bytes = got;
-            in_remain -= got;
-            bytes_read += got;
-          }
-          if (!connection_ok)
-          {
-            Serial.print("Error: got no more after "); Serial.print(bytes_read); Serial.println(" bytes read!");
-            break;
-          }
-          switch (depth)
-          {
-            case 24:
-              blue = input_buffer[in_idx++];
-              green = input_buffer[in_idx++];
-              red = input_buffer[in_idx++];
-              whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-              colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-              break;
-            case 16:
-              {
-                uint8_t lsb = input_buffer[in_idx++];
-                uint8_t msb = input_buffer[in_idx++];
-                if (format == 0) // 555
-                {
-                  blue  = (lsb & 0x1F) << 3;
-                  green = ((msb & 0x03) << 6) | ((lsb & 0xE0) >> 2);
-                  red   = (msb & 0x7C) << 1;
-                }
-                else // 565
-                {
-                  blue  = (lsb & 0x1F) << 3;
-                  green = ((msb & 0x07) << 5) | ((lsb & 0xE0) >> 3);
-                  red   = (msb & 0xF8);
-                }
-                whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-                colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-              }
-              break;
-            case 1:
-            case 4:
-            case 8:
-              {
-                if (0 == in_bits)
-                {
-                  in_byte = input_buffer[in_idx++];
-                  in_bits = 8;
-                }
-                uint16_t pn = (in_byte >> bitshift) & bitmask;
-                whitish = mono_palette_buffer[pn / 8] & (0x1 << pn % 8);
-                colored = color_palette_buffer[pn / 8] & (0x1 << pn % 8);
-                in_byte <<= depth;
-                in_bits -= depth;
-              }
-              break;
-          }
-          if (whitish)
-          {
-            color = GxEPD_WHITE;
-          }
-          else if (colored && with_color)
-          {
-            color = GxEPD_RED;
-          }
-          else
-          {
-            color = GxEPD_BLACK;
-          }
-          uint16_t yrow = y + (flip ? h - row - 1 : row);
-          display.drawPixel(x + col, yrow, color);
-        } // end pixel
-      } // end line
-    }
-    Serial.print("bytes read "); Serial.println(bytes_read);
+    Serial.print("Bit Depth: "); Serial.println(bmp.depth());
+    Serial.print("Image size: ");
+    Serial.print(bmp.width());
+    Serial.print('x');
+    Serial.println(bmp.height());
+    if (!bmp.draw(x, y, with_color ? GxDither::bwr : GxDither::bw)) Serial.println("Error: got no more data");
+    bmp.end();
   }
+  else Serial.println("bitmap format not handled.");
   Serial.print("loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
-  if (!valid)
-  {
-    Serial.println("bitmap format not handled.");
-  }
 }
 
 void showBitmapFrom_HTTP(const char* host, const char* path, const char* filename, int16_t x, int16_t y, bool with_color)
@@ -463,8 +299,6 @@ void drawBitmapFrom_HTTPS_ToBuffer(const char* host, const char* path, const cha
   WiFiClientSecure client;
 #endif
   bool connection_ok = false;
-  bool valid = false; // valid format to be handled
-  bool flip = true; // bitmap is stored bottom-to-top
   uint32_t startTime = millis();
   if ((x >= display.width()) || (y >= display.height())) return;
   display.fillScreen(GxEPD_WHITE);
@@ -516,177 +350,20 @@ void drawBitmapFrom_HTTPS_ToBuffer(const char* host, const char* path, const cha
     }
   }
   if (!connection_ok) return;
-  // Parse BMP header
-  if (read16(client) == 0x4D42) // BMP signature
+  // the BMP from the response body, in file order
+  GxBMP_StreamInput input(client);
+  if (bmp.begin(input))
   {
-    uint32_t fileSize = read32(client);
-    uint32_t creatorBytes = read32(client);
-    uint32_t imageOffset = read32(client); // Start of image data
-    uint32_t headerSize = read32(client);
-    uint32_t width  = read32(client);
-    uint32_t height = read32(client);
-    uint16_t planes = read16(client);
-    uint16_t depth = read16(client); // bits per pixel
-    uint32_t format = read32(client);
-    uint32_t bytes_read = 7 * 4 + 3 * 2; // read so far
-    if ((planes == 1) && ((format == 0) || (format == 3))) // uncompressed is handled, 565 also
-    {
-      Serial.print("File size: "); Serial.println(fileSize);
-      Serial.print("Image Offset: "); Serial.println(imageOffset);
-      Serial.print("Header size: "); Serial.println(headerSize);
-      Serial.print("Bit Depth: "); Serial.println(depth);
-      Serial.print("Image size: ");
-      Serial.print(width);
-      Serial.print('x');
-      Serial.println(height);
-      // BMP rows are padded (if needed) to 4-byte boundary
-      uint32_t rowSize = (width * depth / 8 + 3) & ~3;
-      if (depth < 8) rowSize = ((width * depth + 8 - depth) / 8 + 3) & ~3;
-      if (height < 0)
-      {
-        height = -height;
-        flip = false;
-      }
-      uint16_t w = width;
-      uint16_t h = height;
-      if ((x + w - 1) >= display.width())  w = display.width()  - x;
-      if ((y + h - 1) >= display.height()) h = display.height() - y;
-      valid = true;
-      uint8_t bitmask = 0xFF;
-      uint8_t bitshift = 8 - depth;
-      uint16_t red, green, blue;
-      bool whitish, colored;
-      if (depth == 1) with_color = false;
-      if (depth <= 8)
-      {
-        if (depth < 8) bitmask >>= depth;
-        bytes_read += skip(client, 54 - bytes_read); //palette is always @ 54
-        for (uint16_t pn = 0; pn < (1 << depth); pn++)
-        {
-          blue  = client.read();
-          green = client.read();
-          red   = client.read();
-          client.read();
-          bytes_read += 4;
-          whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-          colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-          if (0 == pn % 8) mono_palette_buffer[pn / 8] = 0;
-          mono_palette_buffer[pn / 8] |= whitish << pn % 8;
-          if (0 == pn % 8) color_palette_buffer[pn / 8] = 0;
-          color_palette_buffer[pn / 8] |= colored << pn % 8;
-          //Serial.print("0x00"); Serial.print(red, HEX); Serial.print(green, HEX); Serial.print(blue, HEX);
-          //Serial.print(" : "); Serial.print(whitish); Serial.print(", "); Serial.println(colored);
-        }
-      }
-      display.fillScreen(GxEPD_WHITE);
-      uint32_t rowPosition = flip ? imageOffset + (height - h) * rowSize : imageOffset;
-      //Serial.print("skip "); Serial.println(rowPosition - bytes_read);
-      bytes_read += skip(client, rowPosition - bytes_read);
-      for (uint16_t row = 0; row < h; row++, rowPosition += rowSize) // for each line
-      {
-        if (!connection_ok || !client.connected()) break;
-        delay(1); // yield() to avoid WDT
-        uint32_t in_remain = rowSize;
-        uint32_t in_idx = 0;
-        uint32_t in_bytes = 0;
-        uint8_t in_byte = 0; // for depth <= 8
-        uint8_t in_bits = 0; // for depth <= 8
-        uint16_t color = GxEPD_WHITE;
-        for (uint16_t col = 0; col < w; col++) // for each pixel
-        {
-          yield();
-          if (!connection_ok || !client.connected()) break;
-          // Time to read more pixel data?
-          if (in_idx >= in_bytes) // ok, exact match for 24bit also (size IS multiple of 3)
-          {
-            uint32_t get = in_remain > sizeof(input_buffer) ? sizeof(input_buffer) : in_remain;
-            uint32_t got = read(client, input_buffer, get);
-            while ((got < get) && connection_ok)
-            {
-              //Serial.print("got "); Serial.print(got); Serial.print(" < "); Serial.print(get); Serial.print(" @ "); Serial.println(bytes_read);
-              uint32_t gotmore = read(client, input_buffer + got, get - got);
-              got += gotmore;
-              connection_ok = gotmore > 0;
-            }
-            in_bytes = got;
-            in_remain -= got;
-            bytes_read += got;
-          }
-          if (!connection_ok)
-          {
-            Serial.print("Error: got no more after "); Serial.print(bytes_read); Serial.println(" bytes read!");
-            break;
-          }
-          switch (depth)
-          {
-            case 24:
-              blue = input_buffer[in_idx++];
-              green = input_buffer[in_idx++];
-              red = input_buffer[in_idx++];
-              whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-              colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-              break;
-            case 16:
-              {
-                uint8_t lsb = input_buffer[in_idx++];
-                uint8_t msb = input_buffer[in_idx++];
-                if (format == 0) // 555
-                {
-                  blue  = (lsb & 0x1F) << 3;
-                  green = ((msb & 0x03) << 6) | ((lsb & 0xE0) >> 2);
-                  red   = (msb & 0x7C) << 1;
-                }
-                else // 565
-                {
-                  blue  = (lsb & 0x1F) << 3;
-                  green = ((msb & 0x07) << 5) | ((lsb & 0xE0) >> 3);
-                  red   = (msb & 0xF8);
-                }
-                whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-                colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-              }
-              break;
-            case 1:
-            case 4:
-            case 8:
-              {
-                if (0 == in_bits)
-                {
-                  in_byte = input_buffer[in_idx++];
-                  in_bits = 8;
-                }
-                uint16_t pn = (in_byte >> bitshift) & bitmask;
-                whitish = mono_palette_buffer[pn / 8] & (0x1 << pn % 8);
-                colored = color_palette_buffer[pn / 8] & (0x1 << pn % 8);
-                in_byte <<= depth;
-                in_bits -= depth;
-              }
-              break;
-          }
-          if (whitish)
-          {
-            color = GxEPD_WHITE;
-          }
-          else if (colored && with_color)
-          {
-            color = GxEPD_RED;
-          }
-          else
-          {
-            color = GxEPD_BLACK;
-          }
-          uint16_t yrow = y + (flip ? h - row - 1 : row);
-          display.drawPixel(x + col, yrow, color);
-        } // end pixel
-      } // end line
-    }
-    Serial.print("bytes read "); Serial.println(bytes_read);
+    Serial.print("Bit Depth: "); Serial.println(bmp.depth());
+    Serial.print("Image size: ");
+    Serial.print(bmp.width());
+    Serial.print('x');
+    Serial.println(bmp.height());
+    if (!bmp.draw(x, y, with_color ? GxDither::bwr : GxDither::bw)) Serial.println("Error: got no more data");
+    bmp.end();
   }
+  else Serial.println("bitmap format not handled.");
   Serial.print("loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
-  if (!valid)
-  {
-    Serial.println("bitmap format not handled.");
-  }
   client.stop();
 }
 
@@ -696,97 +373,3 @@ void showBitmapFrom_HTTPS(const char* host, const char* path, const char* filena
   drawBitmapFrom_HTTPS_ToBuffer(host, path, filename, fingerprint, x, y, with_color);
   display.update();
 }
-
-uint16_t read16(WiFiClient& client)
-{
-  // BMP data is stored little-endian, same as Arduino.
-  uint16_t result;
-  ((uint8_t *)&result)[0] = client.read(); // LSB
-  ((uint8_t *)&result)[1] = client.read(); // MSB
-  return result;
-}
-
-uint32_t read32(WiFiClient& client)
-{
-  // BMP data is stored little-endian, same as Arduino.
-  uint32_t result;
-  ((uint8_t *)&result)[0] = client.read(); // LSB
-  ((uint8_t *)&result)[1] = client.read();
-  ((uint8_t *)&result)[2] = client.read();
-  ((uint8_t *)&result)[3] = client.read(); // MSB
-  return result;
-}
-
-#if USE_BearSSL
-
-uint32_t skip(BearSSL::WiFiClientSecure& client, int32_t bytes)
-{
-  int32_t remain = bytes;
-  uint32_t start = millis();
-  while (client.connected() && (remain > 0))
-  {
-    if (client.available())
-    {
-      int16_t v = client.read();
-      remain--;
-    }
-    else delay(1);
-    if (millis() - start > 2000) break; // don't hang forever
-  }
-  return bytes - remain;
-}
-
-uint32_t read(BearSSL::WiFiClientSecure& client, uint8_t* buffer, int32_t bytes)
-{
-  int32_t remain = bytes;
-  uint32_t start = millis();
-  while (client.connected() && (remain > 0))
-  {
-    if (client.available())
-    {
-      int16_t v = client.read();
-      *buffer++ = uint8_t(v);
-      remain--;
-    }
-    else delay(1);
-    if (millis() - start > 2000) break; // don't hang forever
-  }
-  return bytes - remain;
-}
-
-#endif
-
-uint32_t skip(WiFiClient& client, int32_t bytes)
-{
-  int32_t remain = bytes;
-  uint32_t start = millis();
-  while (client.connected() && (remain > 0))
-  {
-    if (client.available())
-    {
-      int16_t v = client.read();
-      remain--;
-    }
-    else delay(1);
-    if (millis() - start > 2000) break; // don't hang forever
-  }
-  return bytes - remain;
-}
-
-uint32_t read(WiFiClient& client, uint8_t* buffer, int32_t bytes)
-{
-  int32_t remain = bytes;
-  uint32_t start = millis();
-  while (client.connected() && (remain > 0))
-  {
-    if (client.available())
-    {
-      int16_t v = client.read();
-      *buffer++ = uint8_t(v);
-      remain--;
-    }
-    else delay(1);
-    if (millis() - start > 2000) break; // don't hang forever
-  }
-  return bytes - remain;
-}
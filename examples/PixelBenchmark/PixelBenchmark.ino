@@ -0,0 +1,104 @@
+// PixelBenchmark : measures drawPixel() and fillRect() rates to the buffer for all four rotations
+//
+// drawPixel() is measured with the writer selected by setRotation() and, as the reference, switching on the rotation
+// for each pixel as it did before (setPixelSwitch()), in the same build
+// nothing is sent to the display, the results are printed on Serial
+// any display class can be selected, the results depend on the class through buffer layout and paging
+
+// include library, include base class, make path known
+#include <GxEPD.h>
+
+// select the display class to use, only one
+#include <GxGDEW042T2/GxGDEW042T2.h>
+//#include <GxGDEP015OC1/GxGDEP015OC1.h>
+//#include <GxGDE0213B1/GxGDE0213B1.h>
+//#include <GxGDEH029A1/GxGDEH029A1.h>
+//#include <GxGDEW029Z10/GxGDEW029Z10.h>
+//#include <GxGDEW075T8/GxGDEW075T8.h>
+
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+
+#if defined(ESP8266)
+GxIO_Class io(SPI, /*CS=D8*/ SS, /*DC=D3*/ 0, /*RST=D4*/ 2);
+GxEPD_Class display(io /*RST=D4*/ /*BUSY=D2*/);
+#elif defined(ESP32)
+GxIO_Class io(SPI, /*CS=5*/ SS, /*DC=*/ 17, /*RST=*/ 16);
+GxEPD_Class display(io, /*RST=*/ 16, /*BUSY=*/ 4);
+#else
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+#endif
+
+// through the base class, as Adafruit_GFX calls drawPixel()
+GxEPD& gfx = display;
+
+void benchmarkPixels(const char* what, uint8_t r);
+void benchmarkRects(uint8_t r);
+void report(const char* what, uint8_t r, uint32_t pixels, uint32_t us);
+
+void setup(void)
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("PixelBenchmark");
+  display.init();
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    gfx.setRotation(r);
+    benchmarkPixels("drawPixel", r);
+    gfx.setPixelSwitch(true);
+    benchmarkPixels("drawPixel switched", r);
+    gfx.setPixelSwitch(false);
+    benchmarkRects(r);
+  }
+  gfx.setRotation(0);
+  Serial.println("PixelBenchmark done");
+}
+
+void loop()
+{
+}
+
+void benchmarkPixels(const char* what, uint8_t r)
+{
+  uint32_t pixels = 0;
+  uint32_t start = micros();
+  for (uint8_t n = 0; n < 4; n++)
+  {
+    for (int16_t y = 0; y < gfx.height(); y++)
+    {
+      for (int16_t x = 0; x < gfx.width(); x++)
+      {
+        gfx.drawPixel(x, y, ((x ^ y) & 1) ? GxEPD_BLACK : GxEPD_WHITE);
+      }
+    }
+    pixels += uint32_t(gfx.width()) * uint32_t(gfx.height());
+  }
+  report(what, r, pixels, micros() - start);
+}
+
+void benchmarkRects(uint8_t r)
+{
+  uint32_t pixels = 0;
+  uint32_t start = micros();
+  for (int16_t i = 0; i < 256; i++)
+  {
+    int16_t x = (i * 37) % (gfx.width() / 2);
+    int16_t y = (i * 53) % (gfx.height() / 2);
+    gfx.fillRect(x, y, gfx.width() / 2, gfx.height() / 2, (i & 1) ? GxEPD_BLACK : GxEPD_WHITE);
+    pixels += uint32_t(gfx.width() / 2) * uint32_t(gfx.height() / 2);
+  }
+  report("fillRect", r, pixels, micros() - start);
+}
+
+void report(const char* what, uint8_t r, uint32_t pixels, uint32_t us)
+{
+  if (us == 0) us = 1;
+  Serial.print(what);
+  Serial.print(" rotation ");
+  Serial.print(r);
+  Serial.print(" : ");
+  Serial.print(uint32_t(uint64_t(pixels) * 1000000 / us));
+  Serial.println(" pixels/s");
+}
@@ -0,0 +1,520 @@
+// class GxEPD_Host : Host Build Support for the GxEPD library
+//
+// connects the SPI and GPIO of the Arduino core shim to an emulated controller, keeps the virtual clock
+//
+// the Arduino core functions of the shim are implemented here
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include <stdarg.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <SPI.h>
+#include "GxEPD_Host.h"
+
+static GxEmulatedPanel* _panel = 0;
+static int8_t _cs = -1, _dc = -1, _rst = -1, _busy = -1;
+static uint8_t _levels[256];
+static void (*_isr)(void) = 0;
+static int _isr_mode = 0;
+static uint8_t _isr_level = 0;
+static std::atomic<uint64_t> _virtual_us(0); // advanced by the sketch and by a transferring thread
+static uint32_t _spi_clock_override = 0;
+static uint64_t _spi_bytes = 0, _spi_bus_ns = 0, _spi_ns_rest = 0;
+static bool _spi_real_time = false;
+static uint64_t _spi_real_due_ns = 0; // real time the bus is busy until
+static GxIO* _trace = 0;
+static uint32_t _bus_digest = 2166136261UL;
+static uint32_t _failures = 0;
+
+// FNV-1a, of a byte and its kind
+static void _digest(uint32_t& digest, uint8_t kind, uint8_t value)
+{
+  digest = (digest ^ kind) * 16777619UL;
+  digest = (digest ^ value) * 16777619UL;
+}
+
+static uint64_t _realNanos()
+{
+  static std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static uint64_t _realMicros()
+{
+  return _realNanos() / 1000;
+}
+
+// real time mode: the bus time of each byte is due after the previous one, sleeps when more than 100us ahead
+static void _spendBusTime(uint64_t ns)
+{
+  uint64_t t = _realNanos();
+  if (_spi_real_due_ns < t) _spi_real_due_ns = t;
+  _spi_real_due_ns += ns;
+  if (_spi_real_due_ns - t > 100000) std::this_thread::sleep_for(std::chrono::nanoseconds(_spi_real_due_ns - t));
+}
+
+static uint8_t _busyLevel()
+{
+  return _panel ? _panel->busyPinLevel(GxEPD_Host::now()) : LOW;
+}
+
+static void _serviceInterrupts()
+{
+  if (!_isr || !_panel) return;
+  uint8_t level = _busyLevel();
+  if (level == _isr_level) return;
+  _isr_level = level;
+  if ((_isr_mode == CHANGE) || ((_isr_mode == RISING) && level) || ((_isr_mode == FALLING) && !level)) _isr();
+}
+
+void GxEPD_Host::attach(GxEmulatedPanel& panel, int8_t cs, int8_t dc, int8_t rst, int8_t busy)
+{
+  _panel = &panel;
+  _cs = cs;
+  _dc = dc;
+  _rst = rst;
+  _busy = busy;
+  memset(_levels, HIGH, sizeof(_levels));
+  const char* hz = getenv("GXEPD_HOST_SPI_HZ");
+  if (hz) _spi_clock_override = strtoul(hz, 0, 0);
+}
+
+GxEmulatedPanel* GxEPD_Host::panel()
+{
+  return _panel;
+}
+
+uint64_t GxEPD_Host::now()
+{
+  return _realMicros() + _virtual_us;
+}
+
+void GxEPD_Host::advance(uint64_t us)
+{
+  // step to the next BUSY edge, so edge interrupts see it when it happens
+  while (us > 0)
+  {
+    uint64_t t = now(), step = us;
+    if (_isr && _panel && (_panel->busyUntil() > t) && (_panel->busyUntil() - t < step)) step = _panel->busyUntil() - t;
+    _virtual_us += step;
+    us -= step;
+    _serviceInterrupts();
+  }
+}
+
+void GxEPD_Host::setSpiClock(uint32_t hz)
+{
+  _spi_clock_override = hz;
+}
+
+void GxEPD_Host::setSpiRealTime(bool real_time)
+{
+  _spi_real_time = real_time;
+}
+
+uint64_t GxEPD_Host::spiBytes()
+{
+  return _spi_bytes;
+}
+
+uint64_t GxEPD_Host::spiBusTime()
+{
+  return _spi_bus_ns / 1000;
+}
+
+void GxEPD_Host::trace(GxIO* trace)
+{
+  _trace = trace;
+}
+
+uint32_t GxEPD_Host::busDigest()
+{
+  return _bus_digest;
+}
+
+void GxEPD_Host::resetBusDigest()
+{
+  _bus_digest = 2166136261UL;
+}
+
+uint32_t GxEPD_Host::imageDigest()
+{
+  uint32_t digest = 2166136261UL;
+  if (!_panel) return digest;
+  for (uint16_t y = 0; y < _panel->height(); y++)
+  {
+    for (uint16_t x = 0; x < _panel->width(); x++) _digest(digest, 0, _panel->pixel(x, y));
+  }
+  return digest;
+}
+
+bool GxEPD_Host::check(bool condition, const char* format, ...)
+{
+  if (condition) return true;
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "check failed: ");
+  vfprintf(stderr, format, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+  _failures++;
+  return false;
+}
+
+uint32_t GxEPD_Host::failures()
+{
+  return _failures;
+}
+
+void GxEPD_Host::runBandThreads(void (*band)(void*, uint8_t), void* arg, uint8_t bands)
+{
+  std::vector<std::thread> threads;
+  for (uint8_t i = 1; i < bands; i++) threads.push_back(std::thread(band, arg, i));
+  band(arg, 0);
+  for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+}
+
+bool GxHostFile::open(const char* path, const char* mode)
+{
+  close();
+  _f = fopen(path, mode);
+  return _f != 0;
+}
+
+void GxHostFile::close()
+{
+  if (_f) fclose(_f);
+  _f = 0;
+}
+
+int GxHostFile::available()
+{
+  if (!_f) return 0;
+  int c = fgetc(_f);
+  if (c == EOF) return 0;
+  ungetc(c, _f);
+  return 1;
+}
+
+int GxHostFile::read()
+{
+  return _f ? fgetc(_f) : -1;
+}
+
+int GxHostFile::read(uint8_t* buffer, size_t size)
+{
+  return _f ? fread(buffer, 1, size, _f) : -1;
+}
+
+bool GxHostFile::seek(uint32_t position)
+{
+  return _f && (fseek(_f, position, SEEK_SET) == 0);
+}
+
+int GxHostFile::peek()
+{
+  if (!_f) return -1;
+  int c = fgetc(_f);
+  if (c != EOF) ungetc(c, _f);
+  return c;
+}
+
+size_t GxHostFile::write(uint8_t b)
+{
+  return _f ? (fputc(b, _f) == EOF ? 0 : 1) : 0;
+}
+
+size_t GxHostFile::write(const uint8_t* buffer, size_t size)
+{
+  return _f ? fwrite(buffer, 1, size, _f) : 0;
+}
+
+// Arduino core
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  uint8_t previous = _levels[pin];
+  _levels[pin] = val ? HIGH : LOW;
+  if (_panel && (pin == _rst) && previous && !val)
+  {
+    if (_trace) _trace->reset();
+    _digest(_bus_digest, 2, 0);
+    _panel->reset();
+  }
+  if (_trace && (pin == _cs) && (previous != _levels[pin]))
+  {
+    if (val) _trace->endTransaction();
+    else _trace->startTransaction();
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  GxEPD_Host::check(pin != uint8_t(-1), "digitalRead() of pin -1");
+  if (_panel && (pin == _busy)) return _busyLevel();
+  return _levels[pin];
+}
+
+void attachInterrupt(uint8_t interrupt, void (*isr)(void), int mode)
+{
+  if (interrupt != _busy) return;
+  _isr = isr;
+  _isr_mode = mode;
+  _isr_level = _busyLevel();
+}
+
+void detachInterrupt(uint8_t interrupt)
+{
+  if (interrupt == _busy) _isr = 0;
+}
+
+void interrupts()
+{
+}
+
+void noInterrupts()
+{
+}
+
+unsigned long millis()
+{
+  return GxEPD_Host::now() / 1000;
+}
+
+unsigned long micros()
+{
+  return GxEPD_Host::now();
+}
+
+void delay(unsigned long ms)
+{
+  GxEPD_Host::advance(uint64_t(ms) * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  GxEPD_Host::advance(us);
+}
+
+void yield()
+{
+  // polling loops call yield, let them see the BUSY edge without stepping far past it
+  uint64_t t = GxEPD_Host::now(), step = 1000;
+  if (_panel && (_panel->busyUntil() > t) && (_panel->busyUntil() - t < step)) step = _panel->busyUntil() - t;
+  GxEPD_Host::advance(step);
+}
+
+long random(long howbig)
+{
+  return howbig > 0 ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig)
+{
+  return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+void randomSeed(unsigned long seed)
+{
+  srand(seed);
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// SPI, bytes go to the panel while its CS is low, DC low selects command
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+  _clock = settings._clock;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  _spi_bytes++;
+  uint32_t clock = _spi_clock_override ? _spi_clock_override : _clock;
+  if (clock > 0)
+  {
+    _spi_bus_ns += 8000000000ULL / clock;
+    if (_spi_real_time) _spendBusTime(8000000000ULL / clock);
+    else
+    {
+      _spi_ns_rest += 8000000000ULL / clock;
+      _virtual_us += _spi_ns_rest / 1000;
+      _spi_ns_rest %= 1000;
+    }
+  }
+  if (_panel && ((_cs < 0) || !_levels[_cs]))
+  {
+    bool command = (_dc >= 0) && !_levels[_dc];
+    if (_trace)
+    {
+      if (command) _trace->writeCommand(data);
+      else _trace->writeData(data);
+    }
+    _digest(_bus_digest, command, data);
+    if (command) _panel->command(data, GxEPD_Host::now());
+    else _panel->data(data, GxEPD_Host::now());
+  }
+  return 0x00;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+  transfer(data >> 8);
+  transfer(data & 0xFF);
+  return 0x0000;
+}
+
+void SPIClass::transfer(void* buf, size_t count)
+{
+  uint8_t* p = (uint8_t*)buf;
+  for (size_t i = 0; i < count; i++) p[i] = transfer(p[i]);
+}
+
+void SPIClass::writeBytes(const uint8_t* data, uint32_t size)
+{
+  for (uint32_t i = 0; i < size; i++) transfer(data[i]);
+}
+
+void SPIClass::writePattern(const uint8_t* data, uint8_t size, uint32_t repeat)
+{
+  for (uint32_t r = 0; r < repeat; r++) writeBytes(data, size);
+}
+
+// Print, Stream, HardwareSerial and String
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+  size_t n = 0;
+  while (n < length)
+  {
+    int c = read();
+    if (c < 0) break;
+    buffer[n++] = c;
+  }
+  return n;
+}
+
+static size_t _printNumber(Print& p, unsigned long n, int base, bool negative)
+{
+  char buf[8 * sizeof(long) + 2];
+  char* s = &buf[sizeof(buf) - 1];
+  *s = '\0';
+  if (base < 2) base = 10;
+  do
+  {
+    char c = n % base;
+    n /= base;
+    *--s = c < 10 ? c + '0' : c + 'A' - 10;
+  }
+  while (n);
+  if (negative) *--s = '-';
+  return p.write(s);
+}
+
+size_t Print::print(long n, int base)
+{
+  if ((base == 10) && (n < 0)) return _printNumber(*this, -(unsigned long)n, base, true);
+  return _printNumber(*this, n, base, false);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  return _printNumber(*this, n, base, false);
+}
+
+size_t Print::print(double n, int digits)
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+
+size_t Print::printf(const char* format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (n < 0) return 0;
+  return write((const uint8_t*)buf, n < int(sizeof(buf)) ? n : sizeof(buf) - 1);
+}
+
+void HardwareSerial::begin(unsigned long baud)
+{
+}
+
+void HardwareSerial::flush()
+{
+  fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  if (c != '\r') fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+  for (size_t i = 0; i < size; i++) write(buffer[i]);
+  return size;
+}
+
+static std::string _toString(unsigned long n, unsigned char base, bool negative)
+{
+  char buf[8 * sizeof(long) + 2];
+  char* s = &buf[sizeof(buf) - 1];
+  *s = '\0';
+  if (base < 2) base = 10;
+  do
+  {
+    char c = n % base;
+    n /= base;
+    *--s = c < 10 ? c + '0' : c + 'a' - 10;
+  }
+  while (n);
+  if (negative) *--s = '-';
+  return s;
+}
+
+static std::string _toString(double value, unsigned char decimals)
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+  return buf;
+}
+
+String::String(unsigned char value, unsigned char base) : _s(_toString(value, base, false)) {}
+String::String(int value, unsigned char base) : String(long(value), base) {}
+String::String(unsigned int value, unsigned char base) : _s(_toString(value, base, false)) {}
+String::String(long value, unsigned char base) :
+  _s((base == 10) && (value < 0) ? _toString(-(unsigned long)value, base, true) : _toString(value, base, false)) {}
+String::String(unsigned long value, unsigned char base) : _s(_toString(value, base, false)) {}
+String::String(float value, unsigned char decimals) : _s(_toString(double(value), decimals)) {}
+String::String(double value, unsigned char decimals) : _s(_toString(value, decimals)) {}
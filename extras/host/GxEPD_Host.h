@@ -0,0 +1,69 @@
+// class GxEPD_Host : Host Build Support for the GxEPD library
+//
+// connects the SPI and GPIO of the Arduino core shim to an emulated controller, keeps the virtual clock
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPD_Host_H_
+#define _GxEPD_Host_H_
+
+#include <Arduino.h>
+#include <GxIO/GxIO.h>
+#include "GxEmulatedPanel.h"
+
+class GxEPD_Host
+{
+  public:
+    // the pins as used by the sketch for its GxIO_SPI and display instances, -1 : not connected
+    static void attach(GxEmulatedPanel& panel, int8_t cs, int8_t dc, int8_t rst, int8_t busy);
+    static GxEmulatedPanel* panel();
+    // virtual time in microseconds, real time spent on the host plus all time advanced
+    static uint64_t now();
+    // advances the virtual clock and services BUSY edge interrupts
+    static void advance(uint64_t us);
+    // SPI clock used for the bus time of each byte, overrides the clock of SPISettings, 0 : as set by the sketch
+    static void setSpiClock(uint32_t hz);
+    // bus time spent in real time by the thread transferring instead of advancing the virtual clock,
+    // so that transfers of a background thread overlap with the sketch, see GxHostThreadSPI
+    static void setSpiRealTime(bool real_time);
+    static uint64_t spiBytes();
+    static uint64_t spiBusTime(); // microseconds
+    // records the traffic on the bus of the panel to trace, e.g. a GxIO_File, 0 : off
+    static void trace(GxIO* trace);
+    // band runner for GxEPD::setBandRendering(), a std::thread for each band but the first, done by the caller
+    static void runBandThreads(void (*band)(void*, uint8_t), void* arg, uint8_t bands);
+    // for the checks of make check: digest of the commands, data and resets received by the panel since resetBusDigest(),
+    // digest of the panel image, and the count of failed checks, main() exits with 1 if any failed
+    static uint32_t busDigest();
+    static void resetBusDigest();
+    static uint32_t imageDigest();
+    static bool check(bool condition, const char* format, ...) __attribute__((format(printf, 2, 3)));
+    static uint32_t failures();
+};
+
+// a host file as Stream, for GxIO_File traces; read(buffer, size) and seek() as File of SD, e.g. for GxBMP_FileInput
+class GxHostFile : public Stream
+{
+  public:
+    GxHostFile() : _f(0) {};
+    ~GxHostFile() {close();};
+    bool open(const char* path, const char* mode);
+    void close();
+    int available();
+    int read();
+    int read(uint8_t* buffer, size_t size);
+    bool seek(uint32_t position);
+    int peek();
+    size_t write(uint8_t b);
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+    operator bool() {return _f != 0;};
+  private:
+    FILE* _f;
+};
+
+#endif
@@ -0,0 +1,365 @@
+// class GxEmulatedPanel : Software Models of e-Paper Controllers for the Host Build of the GxEPD library
+//
+// the models decode the command and data stream, keep controller RAM, reconstruct the panel image on refresh
+// and drive the BUSY pin from configurable power and refresh durations
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxEmulatedPanel.h"
+
+GxEmulatedPanel::GxEmulatedPanel(const char* name, uint16_t width, uint16_t height, uint8_t busy_level, const timing& t) :
+  _name(name), _width(width), _height(height), _busy_level(busy_level), _timing(t),
+  _sleeping(false), _cmd(0), _arg(0), _now(0), _busy_until(0), _image(uint32_t(width) * height, white)
+{
+  resetStats();
+}
+
+void GxEmulatedPanel::resetStats()
+{
+  memset(&_stats, 0, sizeof(_stats));
+}
+
+void GxEmulatedPanel::reset()
+{
+  _stats.resets++;
+  _sleeping = false;
+  _cmd = 0;
+  _arg = 0;
+  _reset();
+}
+
+void GxEmulatedPanel::command(uint8_t c, uint64_t now_us)
+{
+  _now = now_us;
+  _stats.commands++;
+  if (_sleeping)
+  {
+    _stats.sleep_violations++;
+    return;
+  }
+  if (isBusy(now_us)) _stats.busy_violations++;
+  _cmd = c;
+  _arg = 0;
+  _command(c);
+}
+
+void GxEmulatedPanel::data(uint8_t d, uint64_t now_us)
+{
+  _now = now_us;
+  _stats.data_bytes++;
+  if (_sleeping)
+  {
+    _stats.sleep_violations++;
+    return;
+  }
+  if (isBusy(now_us)) _stats.busy_violations++;
+  _data(_cmd, _arg++, d);
+}
+
+void GxEmulatedPanel::_startBusy(uint32_t ms)
+{
+  // a command issued while busy restarts busy from its arrival, as the controller would after finishing
+  _busy_until = (_busy_until > _now ? _busy_until : _now) + uint64_t(ms) * 1000;
+  _stats.busy_us += uint64_t(ms) * 1000;
+}
+
+uint32_t GxEmulatedPanel::countPixels(uint8_t value) const
+{
+  uint32_t n = 0;
+  for (uint32_t i = 0; i < _image.size(); i++)
+  {
+    if (_image[i] == value) n++;
+  }
+  return n;
+}
+
+bool GxEmulatedPanel::savePPM(const char* path) const
+{
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+  for (uint32_t i = 0; i < _image.size(); i++)
+  {
+    uint8_t rgb[3] = {0xFF, 0xFF, 0xFF};
+    if (_image[i] == black) rgb[0] = rgb[1] = rgb[2] = 0x00;
+    else if (_image[i] == red) rgb[1] = rgb[2] = 0x00;
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+void GxEmulatedPanel::report(FILE* f) const
+{
+  fprintf(f, "%s %dx%d\n", _name, _width, _height);
+  fprintf(f, "  commands %u, data bytes %u\n", _stats.commands, _stats.data_bytes);
+  fprintf(f, "  full refreshes %u, partial refreshes %u, power cycles %u, resets %u\n",
+          _stats.full_refreshes, _stats.partial_refreshes, _stats.power_cycles, _stats.resets);
+  fprintf(f, "  busy %llu ms, busy violations %u, sleep violations %u\n",
+          (unsigned long long)(_stats.busy_us / 1000), _stats.busy_violations, _stats.sleep_violations);
+  fprintf(f, "  pixels black %u, red %u, white %u\n", countPixels(black), countPixels(red), countPixels(white));
+}
+
+GxEmulatedUC81xx::GxEmulatedUC81xx(const char* name, uint16_t width, uint16_t height, data_format format, uint8_t window_bytes, const timing& t) :
+  GxEmulatedPanel(name, width, height, LOW, t), _format(format), _window_bytes(window_bytes),
+  _row_bytes(format == pixel4 ? width / 2 : width / 8)
+{
+  _ram1.assign(uint32_t(_row_bytes) * height, format == pixel4 ? 0x33 : 0xFF);
+  _ram2.assign(uint32_t(_row_bytes) * height, 0xFF);
+  _reset();
+}
+
+void GxEmulatedUC81xx::_reset()
+{
+  _partial = false;
+  _wx = 0;
+  _wxe = _width - 1;
+  _wy = 0;
+  _wye = _height - 1;
+  _pos = 0;
+}
+
+void GxEmulatedUC81xx::_command(uint8_t c)
+{
+  switch (c)
+  {
+    case 0x02: // power off
+      _startBusy(_timing.power_off_ms);
+      break;
+    case 0x04: // power on
+      _stats.power_cycles++;
+      _startBusy(_timing.power_on_ms);
+      break;
+    case 0x10: // data start transmission 1
+    case 0x13: // data start transmission 2
+      _pos = 0;
+      break;
+    case 0x12: // display refresh
+      _refresh();
+      if (_partial) _stats.partial_refreshes++;
+      else _stats.full_refreshes++;
+      _startBusy(_partial ? _timing.partial_refresh_ms : _timing.full_refresh_ms);
+      break;
+    case 0x91: // partial in
+      _partial = true;
+      break;
+    case 0x92: // partial out
+      _partial = false;
+      break;
+  }
+}
+
+void GxEmulatedUC81xx::_data(uint8_t c, uint32_t i, uint8_t d)
+{
+  switch (c)
+  {
+    case 0x07: // deep sleep, check code
+      if (d == 0xA5) _sleeping = true;
+      break;
+    case 0x10:
+    case 0x13:
+      {
+        // window relative addressing, the whole RAM unless in partial mode
+        uint16_t ppb = (_format == pixel4) ? 2 : 8;
+        uint16_t wx = _partial ? _wx : 0, wxe = _partial ? _wxe : _width - 1;
+        uint16_t wy = _partial ? _wy : 0, wye = _partial ? _wye : _height - 1;
+        uint16_t wbytes = (wxe - wx + 1) / ppb;
+        uint32_t y = wy + _pos / wbytes;
+        uint32_t x = wx / ppb + _pos % wbytes;
+        _pos++;
+        if (y > wye) break;
+        std::vector<uint8_t>& ram = (c == 0x10) ? _ram1 : _ram2;
+        ram[y * _row_bytes + x] = d;
+      }
+      break;
+    case 0x90: // partial window
+      if (i < sizeof(_wbuf)) _wbuf[i] = d;
+      if (i == uint32_t(_window_bytes - 2)) // the last byte is the scan mode
+      {
+        uint16_t x, xe, y, ye;
+        if (_window_bytes == 7)
+        {
+          x = _wbuf[0];
+          xe = _wbuf[1];
+          y = _wbuf[2] << 8 | _wbuf[3];
+          ye = _wbuf[4] << 8 | _wbuf[5];
+        }
+        else
+        {
+          x = _wbuf[0] << 8 | _wbuf[1];
+          xe = _wbuf[2] << 8 | _wbuf[3];
+          y = _wbuf[4] << 8 | _wbuf[5];
+          ye = _wbuf[6] << 8 | _wbuf[7];
+        }
+        _wx = x & 0xFFF8;
+        _wxe = min(uint16_t(xe | 0x0007), uint16_t(_width - 1));
+        _wy = min(y, uint16_t(_height - 1));
+        _wye = min(ye, uint16_t(_height - 1));
+        if (_wxe < _wx) _wxe = _wx + 7;
+        if (_wye < _wy) _wye = _wy;
+        _pos = 0;
+      }
+      break;
+  }
+}
+
+uint8_t GxEmulatedUC81xx::_ramPixel(uint16_t x, uint16_t y) const
+{
+  uint32_t i = uint32_t(y) * _row_bytes;
+  if (_format == pixel4)
+  {
+    uint8_t v = _ram1[i + x / 2];
+    v = (x & 1) ? v & 0x0F : v >> 4;
+    return (v == 0x4) ? red : (v < 0x3) ? black : white;
+  }
+  i += x / 8;
+  uint8_t m = 0x80 >> (x & 7);
+  if (_format == kw) return (_ram2[i] & m) ? white : black;
+  if (!(_ram2[i] & m)) return red; // red has priority on the tri-colour panels
+  return (_ram1[i] & m) ? white : black;
+}
+
+void GxEmulatedUC81xx::_refresh()
+{
+  uint16_t x0 = _partial ? _wx : 0, x1 = _partial ? _wxe : _width - 1;
+  uint16_t y0 = _partial ? _wy : 0, y1 = _partial ? _wye : _height - 1;
+  for (uint16_t y = y0; y <= y1; y++)
+  {
+    for (uint16_t x = x0; x <= x1; x++)
+    {
+      _setPixel(x, y, _ramPixel(x, y));
+    }
+  }
+}
+
+// typical durations from the panel specifications, adjust with setTiming() for the panel at hand
+
+static const GxEmulatedPanel::timing IL0398_kw = {100, 50, 4000, 1600};
+static const GxEmulatedPanel::timing IL0398_kwr = {100, 50, 16000, 16000};
+static const GxEmulatedPanel::timing IL0373_kw = {80, 40, 3000, 1000};
+static const GxEmulatedPanel::timing IL0373_kwr = {80, 40, 15000, 15000};
+static const GxEmulatedPanel::timing IL0371_kw = {150, 50, 4500, 4500};
+static const GxEmulatedPanel::timing IL0371_kwr = {150, 50, 28000, 28000};
+static const GxEmulatedPanel::timing SSD1608_kw = {80, 80, 1200, 300};
+
+GxEmulator_IL0398::GxEmulator_IL0398(uint16_t width, uint16_t height, bool with_red) :
+  GxEmulatedUC81xx(with_red ? "IL0398 b/w/r" : "IL0398 b/w", width, height, with_red ? kwr : kw, 9, with_red ? IL0398_kwr : IL0398_kw)
+{
+}
+
+GxEmulator_IL0373::GxEmulator_IL0373(uint16_t width, uint16_t height, bool with_red) :
+  GxEmulatedUC81xx(with_red ? "IL0373 b/w/r" : "IL0373 b/w", width, height, with_red ? kwr : kw, 7, with_red ? IL0373_kwr : IL0373_kw)
+{
+}
+
+GxEmulator_IL0371::GxEmulator_IL0371(uint16_t width, uint16_t height, bool with_red) :
+  GxEmulatedUC81xx(with_red ? "IL0371 b/w/r" : "IL0371 b/w", width, height, pixel4, 9, with_red ? IL0371_kwr : IL0371_kw)
+{
+}
+
+GxEmulator_SSD1608::GxEmulator_SSD1608(uint16_t width, uint16_t height) :
+  GxEmulatedPanel("SSD1608 b/w", width, height, HIGH, SSD1608_kw), _row_bytes(width / 8)
+{
+  _ram.assign(uint32_t(_row_bytes) * height, 0xFF);
+  _reset();
+}
+
+void GxEmulator_SSD1608::_reset()
+{
+  _entry_mode = 0x03;
+  _update_option = 0xFF;
+  _xs = _x = 0;
+  _xe = _row_bytes - 1;
+  _ys = _y = 0;
+  _ye = _height - 1;
+}
+
+void GxEmulator_SSD1608::_command(uint8_t c)
+{
+  switch (c)
+  {
+    case 0x12: // software reset
+      _reset();
+      _startBusy(_timing.power_on_ms);
+      break;
+    case 0x20: // master activation, runs the sequence selected by 0x22
+      if ((_update_option & 0x04) != 0)
+      {
+        // display, from RAM as is
+        for (uint16_t y = 0; y < _height; y++)
+        {
+          for (uint16_t x = 0; x < _width; x++)
+          {
+            _setPixel(x, y, (_ram[uint32_t(y) * _row_bytes + x / 8] & (0x80 >> (x & 7))) ? white : black);
+          }
+        }
+        bool full = (_update_option & 0xC0) == 0xC0; // with clock and analog enable and disable
+        if (full) _stats.full_refreshes++;
+        else _stats.partial_refreshes++;
+        _startBusy(full ? _timing.full_refresh_ms : _timing.partial_refresh_ms);
+      }
+      else if (_update_option == 0xC0)
+      {
+        _stats.power_cycles++;
+        _startBusy(_timing.power_on_ms);
+      }
+      else if (_update_option == 0xC3)
+      {
+        _startBusy(_timing.power_off_ms);
+      }
+      break;
+  }
+}
+
+void GxEmulator_SSD1608::_data(uint8_t c, uint32_t i, uint8_t d)
+{
+  switch (c)
+  {
+    case 0x10: // deep sleep mode
+      if (d & 0x01) _sleeping = true;
+      break;
+    case 0x11: // data entry mode
+      _entry_mode = d & 0x07;
+      break;
+    case 0x22: // display update option
+      _update_option = d;
+      break;
+    case 0x44: // RAM x start and end, in bytes
+      if (i == 0) _xs = d;
+      else if (i == 1) _xe = d;
+      break;
+    case 0x45: // RAM y start and end
+      if (i == 0) _ys = d;
+      else if (i == 1) _ys |= d << 8;
+      else if (i == 2) _ye = d;
+      else if (i == 3) _ye |= d << 8;
+      break;
+    case 0x4E: // RAM x counter
+      _x = d;
+      break;
+    case 0x4F: // RAM y counter
+      if (i == 0) _y = d;
+      else if (i == 1) _y |= d << 8;
+      break;
+    case 0x24: // write RAM
+      {
+        if ((_x < _row_bytes) && (_y < _height)) _ram[uint32_t(_y) * _row_bytes + _x] = d;
+        // the counters step in the entry mode direction from start to end address and wrap inside the window
+        bool x_inc = _entry_mode & 0x01, y_inc = _entry_mode & 0x02, y_first = _entry_mode & 0x04;
+        uint16_t& a = y_first ? _y : _x;
+        uint16_t& b = y_first ? _x : _y;
+        bool a_inc = y_first ? y_inc : x_inc, b_inc = y_first ? x_inc : y_inc;
+        if (a == (y_first ? _ye : _xe)) // end of line
+        {
+          a = y_first ? _ys : _xs;
+          if (b == (y_first ? _xe : _ye)) b = y_first ? _xs : _ys;
+          else b = b_inc ? b + 1 : b - 1;
+        }
+        else a = a_inc ? a + 1 : a - 1;
+      }
+      break;
+  }
+}
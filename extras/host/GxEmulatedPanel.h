@@ -0,0 +1,142 @@
+// class GxEmulatedPanel : Software Models of e-Paper Controllers for the Host Build of the GxEPD library
+//
+// the models decode the command and data stream, keep controller RAM, reconstruct the panel image on refresh
+// and drive the BUSY pin from configurable power and refresh durations
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEmulatedPanel_H_
+#define _GxEmulatedPanel_H_
+
+#include <Arduino.h>
+#include <vector>
+
+class GxEmulatedPanel
+{
+  public:
+    enum pixel_value {white = 0, black = 1, red = 2};
+    struct timing
+    {
+      uint32_t power_on_ms;
+      uint32_t power_off_ms;
+      uint32_t full_refresh_ms;
+      uint32_t partial_refresh_ms;
+    };
+    struct stats
+    {
+      uint32_t commands;
+      uint32_t data_bytes;
+      uint32_t full_refreshes;
+      uint32_t partial_refreshes;
+      uint32_t power_cycles;
+      uint32_t resets;
+      uint32_t busy_violations; // commands or data received while BUSY
+      uint32_t sleep_violations; // commands or data received in deep sleep
+      uint64_t busy_us;
+    };
+    GxEmulatedPanel(const char* name, uint16_t width, uint16_t height, uint8_t busy_level, const timing& t);
+    virtual ~GxEmulatedPanel() {};
+    const char* name() const {return _name;};
+    uint16_t width() const {return _width;};
+    uint16_t height() const {return _height;};
+    void setTiming(const timing& t) {_timing = t;};
+    const timing& getTiming() const {return _timing;};
+    const stats& getStats() const {return _stats;};
+    void resetStats();
+    // bus side, called by the host shim
+    void reset();
+    void command(uint8_t c, uint64_t now_us);
+    void data(uint8_t d, uint64_t now_us);
+    uint8_t busyLevel() const {return _busy_level;};
+    bool isBusy(uint64_t now_us) const {return now_us < _busy_until;};
+    uint8_t busyPinLevel(uint64_t now_us) const {return isBusy(now_us) ? _busy_level : !_busy_level;};
+    uint64_t busyUntil() const {return _busy_until;};
+    // panel side, the image shown after the last refresh
+    uint8_t pixel(uint16_t x, uint16_t y) const {return _image[uint32_t(y) * _width + x];};
+    uint32_t countPixels(uint8_t value) const;
+    bool savePPM(const char* path) const;
+    void report(FILE* f) const;
+  protected:
+    virtual void _reset() = 0;
+    virtual void _command(uint8_t c) = 0;
+    virtual void _data(uint8_t c, uint32_t i, uint8_t d) = 0;
+    void _startBusy(uint32_t ms);
+    void _setPixel(uint16_t x, uint16_t y, uint8_t v) {_image[uint32_t(y) * _width + x] = v;};
+    const char* _name;
+    uint16_t _width, _height;
+    uint8_t _busy_level;
+    timing _timing;
+    stats _stats;
+    bool _sleeping;
+    uint8_t _cmd;
+    uint32_t _arg;
+    uint64_t _now, _busy_until;
+    std::vector<uint8_t> _image;
+};
+
+// UltraChip command set as used by IL0371, IL0373 and IL0398 : 0x10/0x13 data, 0x90 partial window, 0x12 refresh
+class GxEmulatedUC81xx : public GxEmulatedPanel
+{
+  public:
+    enum data_format
+    {
+      kw, // b/w, image from 0x13, 0 is black
+      kwr, // black plane 0x10, red plane 0x13, 0 is black or red
+      pixel4 // 4 bit per pixel in 0x10, 0x0 black, 0x3 white, 0x4 red
+    };
+    // window_bytes : 9 with 16 bit x (IL0371, IL0398), 7 with 8 bit x (IL0373)
+    GxEmulatedUC81xx(const char* name, uint16_t width, uint16_t height, data_format format, uint8_t window_bytes, const timing& t);
+  protected:
+    void _reset();
+    void _command(uint8_t c);
+    void _data(uint8_t c, uint32_t i, uint8_t d);
+    void _refresh();
+    uint8_t _ramPixel(uint16_t x, uint16_t y) const;
+    data_format _format;
+    uint8_t _window_bytes;
+    uint16_t _row_bytes;
+    bool _partial;
+    uint16_t _wx, _wxe, _wy, _wye; // window, x in pixels
+    uint8_t _wbuf[9];
+    uint32_t _pos; // byte index into the window
+    std::vector<uint8_t> _ram1, _ram2;
+};
+
+class GxEmulator_IL0398 : public GxEmulatedUC81xx
+{
+  public:
+    GxEmulator_IL0398(uint16_t width, uint16_t height, bool with_red);
+};
+
+class GxEmulator_IL0373 : public GxEmulatedUC81xx
+{
+  public:
+    GxEmulator_IL0373(uint16_t width, uint16_t height, bool with_red);
+};
+
+class GxEmulator_IL0371 : public GxEmulatedUC81xx
+{
+  public:
+    GxEmulator_IL0371(uint16_t width, uint16_t height, bool with_red);
+};
+
+// Solomon Systech command set as used by SSD1608 (IL3820) and its relatives : 0x44/0x45 RAM window, 0x4E/0x4F counters, 0x24 data
+class GxEmulator_SSD1608 : public GxEmulatedPanel
+{
+  public:
+    GxEmulator_SSD1608(uint16_t width, uint16_t height);
+  protected:
+    void _reset();
+    void _command(uint8_t c);
+    void _data(uint8_t c, uint32_t i, uint8_t d);
+    uint16_t _row_bytes;
+    uint8_t _entry_mode, _update_option;
+    uint16_t _xs, _xe, _ys, _ye, _x, _y; // x in bytes
+    std::vector<uint8_t> _ram;
+};
+
+#endif
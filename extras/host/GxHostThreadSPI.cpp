@@ -0,0 +1,65 @@
+// class GxHostThreadSPI : Host Build Support for the GxEPD library
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxHostThreadSPI.h"
+
+GxHostThreadSPI::GxHostThreadSPI(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst, int8_t bl) :
+  GxIO_SPI(spi, cs, dc, rst, bl), _sending(false), _stop(false)
+{
+}
+
+GxHostThreadSPI::~GxHostThreadSPI()
+{
+  if (!_thread.joinable()) return;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  _thread.join();
+}
+
+void GxHostThreadSPI::startQueue(void (*callback)(void*), void* arg)
+{
+  GxIO_SPI::startQueue(callback, arg); // an empty queue completes here
+  if (!GxIO_SPI::isQueueBusy()) return;
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_thread.joinable()) _thread = std::thread(&GxHostThreadSPI::_run, this); // on first use, not at static init
+  _sending = true;
+  _cv.notify_all();
+}
+
+bool GxHostThreadSPI::processQueue()
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] {return !_sending;});
+  }
+  return GxIO_SPI::processQueue();
+}
+
+bool GxHostThreadSPI::isQueueBusy()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _sending || GxIO_SPI::isQueueBusy();
+}
+
+void GxHostThreadSPI::_run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true)
+  {
+    _cv.wait(lock, [this] {return _sending || _stop;});
+    if (_stop) return;
+    lock.unlock();
+    while (GxIO_SPI::processQueue());
+    lock.lock();
+    _sending = false;
+    _cv.notify_all();
+  }
+}
@@ -0,0 +1,39 @@
+// class GxHostThreadSPI : Host Build Support for the GxEPD library
+//
+// GxIO_SPI with its transfer queue sent by a host thread, as DMA or a task on the other core would on a board
+// with GxEPD_Host::setSpiRealTime() the bus time passes while the sketch goes on, see examples/PipelinedPaging
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxHostThreadSPI_H_
+#define _GxHostThreadSPI_H_
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+
+class GxHostThreadSPI : public GxIO_SPI
+{
+  public:
+    GxHostThreadSPI(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst = -1, int8_t bl = -1);
+    ~GxHostThreadSPI();
+    const char* name = "GxHostThreadSPI";
+    // hands the queue to the thread, callback is called by the thread
+    void startQueue(void (*callback)(void*) = 0, void* arg = 0);
+    // waits for the thread, then sends what is left in the caller, returns false
+    bool processQueue();
+    bool isQueueBusy();
+  private:
+    void _run();
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _sending, _stop;
+};
+
+#endif
@@ -0,0 +1 @@
+// Adafruit_I2CDevice.h : empty, included by Adafruit_GFX.h for the display classes of Adafruit, not used by GxEPD
@@ -0,0 +1,134 @@
+// Arduino.h : minimal Arduino core shim for the host build of the GxEPD library
+//
+// time is virtual: delay() and BUSY waits advance the clock without sleeping, SPI transfers add bus time
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPD_Host_Arduino_H_
+#define _GxEPD_Host_Arduino_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+// default SPI pins of the AVR boards, the examples use these on the host
+#define SS 10
+#define MOSI 11
+#define MISO 12
+#define SCK 13
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void * const *)(addr))
+#define pgm_read_pointer(addr) (*(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+#define digitalPinToInterrupt(p) (p)
+#define NOT_AN_INTERRUPT -1
+
+#define _BV(bit) (1 << (bit))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+template <class T, class L> auto min(const T& a, const L& b) -> decltype((b < a) ? b : a)
+{
+  return (b < a) ? b : a;
+}
+
+template <class T, class L> auto max(const T& a, const L& b) -> decltype((b < a) ? b : a)
+{
+  return (a < b) ? b : a;
+}
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t interrupt, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t interrupt);
+void interrupts();
+void noInterrupts();
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+void setup();
+void loop();
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+
+class HardwareSerial : public Stream
+{
+  public:
+    void begin(unsigned long baud);
+    void end() {};
+    void flush();
+    int available() {return 0;};
+    int read() {return -1;};
+    int peek() {return -1;};
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+    operator bool() {return true;};
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,47 @@
+// Print.h : Print class of the Arduino core shim for the host build of the GxEPD library
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPD_Host_Print_H_
+#define _GxEPD_Host_Print_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "WString.h"
+
+#ifndef DEC
+#define DEC 10
+#endif
+
+class Print
+{
+  public:
+    virtual ~Print() {};
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) {return str ? write((const uint8_t*)str, strlen(str)) : 0;};
+    size_t write(const char* buffer, size_t size) {return write((const uint8_t*)buffer, size);};
+    virtual int availableForWrite() {return 0;};
+    virtual void flush() {};
+    size_t print(const __FlashStringHelper* s) {return write(reinterpret_cast<const char*>(s));};
+    size_t print(const String& s) {return write(s.c_str());};
+    size_t print(const char* s) {return write(s);};
+    size_t print(char c) {return write(uint8_t(c));};
+    size_t print(unsigned char n, int base = DEC) {return print((unsigned long)n, base);};
+    size_t print(int n, int base = DEC) {return print((long)n, base);};
+    size_t print(unsigned int n, int base = DEC) {return print((unsigned long)n, base);};
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+    size_t println() {return write("\r\n");};
+    template <class T> size_t println(const T& v) {size_t n = print(v); return n + println();};
+    template <class T> size_t println(const T& v, int f) {size_t n = print(v, f); return n + println();};
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+#endif
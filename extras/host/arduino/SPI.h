@@ -0,0 +1,53 @@
+// SPI.h : SPI class of the Arduino core shim for the host build of the GxEPD library
+//
+// transfers go to the emulated controller attached by GxEPD_Host::attach(), each byte adds bus time to the virtual clock
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPD_Host_SPI_H_
+#define _GxEPD_Host_SPI_H_
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+#define SPI_CLOCK_DIV2 0x04
+#define SPI_CLOCK_DIV4 0x00
+
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) : _clock(clock) {};
+    uint32_t _clock;
+};
+
+class SPIClass
+{
+  public:
+    void begin() {};
+    void end() {};
+    void beginTransaction(SPISettings settings);
+    void endTransaction() {};
+    uint8_t transfer(uint8_t data);
+    uint16_t transfer16(uint16_t data);
+    void transfer(void* buf, size_t count);
+    void writeBytes(const uint8_t* data, uint32_t size);
+    void writePattern(const uint8_t* data, uint8_t size, uint32_t repeat);
+    void setBitOrder(uint8_t) {};
+    void setDataMode(uint8_t) {};
+    void setClockDivider(uint8_t) {};
+    void setFrequency(uint32_t freq) {_clock = freq;};
+  private:
+    uint32_t _clock = 4000000;
+};
+
+extern SPIClass SPI;
+
+#endif
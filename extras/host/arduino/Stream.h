@@ -0,0 +1,26 @@
+// Stream.h : Stream class of the Arduino core shim for the host build of the GxEPD library
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPD_Host_Stream_H_
+#define _GxEPD_Host_Stream_H_
+
+#include "Print.h"
+
+// reads don't wait, the host streams are files
+class Stream : public Print
+{
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    void setTimeout(unsigned long timeout) {};
+    size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length) {return readBytes((char*)buffer, length);};
+};
+
+#endif
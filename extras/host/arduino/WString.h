@@ -0,0 +1,55 @@
+// WString.h : String class of the Arduino core shim for the host build of the GxEPD library
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPD_Host_WString_H_
+#define _GxEPD_Host_WString_H_
+
+#include <stdlib.h>
+#include <string>
+
+class __FlashStringHelper;
+
+class String
+{
+  public:
+    String(const char* s = "") : _s(s ? s : "") {};
+    String(const __FlashStringHelper* s) : _s(reinterpret_cast<const char*>(s)) {};
+    String(const std::string& s) : _s(s) {};
+    explicit String(char c) : _s(1, c) {};
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimals = 2);
+    explicit String(double value, unsigned char decimals = 2);
+    const char* c_str() const {return _s.c_str();};
+    unsigned int length() const {return _s.length();};
+    char charAt(unsigned int i) const {return i < _s.length() ? _s[i] : 0;};
+    char operator[](unsigned int i) const {return charAt(i);};
+    String& operator+=(const String& rhs) {_s += rhs._s; return *this;};
+    String& operator+=(const char* rhs) {_s += rhs; return *this;};
+    String& operator+=(char c) {_s += c; return *this;};
+    bool concat(const String& rhs) {_s += rhs._s; return true;};
+    bool operator==(const String& rhs) const {return _s == rhs._s;};
+    bool operator!=(const String& rhs) const {return _s != rhs._s;};
+    bool operator==(const char* rhs) const {return _s == rhs;};
+    bool operator!=(const char* rhs) const {return _s != rhs;};
+    int indexOf(char c) const {size_t i = _s.find(c); return i == std::string::npos ? -1 : int(i);};
+    String substring(unsigned int from) const {return from < _s.length() ? String(_s.substr(from)) : String();};
+    String substring(unsigned int from, unsigned int to) const {return from < _s.length() ? String(_s.substr(from, to - from)) : String();};
+    long toInt() const {return atol(_s.c_str());};
+    float toFloat() const {return atof(_s.c_str());};
+    friend String operator+(const String& lhs, const String& rhs) {return String(lhs._s + rhs._s);};
+    friend String operator+(const String& lhs, const char* rhs) {return String(lhs._s + rhs);};
+    friend String operator+(const char* lhs, const String& rhs) {return String(lhs + rhs._s);};
+  private:
+    std::string _s;
+};
+
+#endif
@@ -0,0 +1,3 @@
+// avr/pgmspace.h : program memory is data memory on the host, see Arduino.h
+
+#include <Arduino.h>
@@ -0,0 +1,152 @@
+// Async : the asynchronous update state machine, see GxEPD::updateAsync() and GxEPD::poll()
+//
+// host only: make check, or make SKETCH=checks/Async/Async.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// updateAsync() polled to completion must send what update() sends, call the callback once, and refuse a second start;
+// update(), updateWindow() and drawPaged() called while in progress must complete it first; a refresh longer than
+// GxEPD_ASYNC_BUSY_TIMEOUT must be reported by asyncTimedOut(); isBusy() without BUSY pin must not read a pin;
+// isAsync() must report a blocking update() for the classes without support and for the first update after init()
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxEPD_Class no_busy(io, /*RST=*/ 9, /*BUSY=*/ -1);
+
+#if defined(_GxGDEW042T2_H_) || defined(_GxGDEW042Z15_H_) || defined(_GxGDEW0583T7_H_) || defined(_GxGDEW075T8_H_) || defined(_GxGDEW075Z09_H_)
+const bool async_class = true;
+#else
+const bool async_class = false;
+#endif
+
+enum then {nothing, then_update, then_update_window, then_draw_paged};
+
+uint16_t calls;
+
+void callback(void* arg)
+{
+  (*(uint16_t*) arg)++;
+}
+
+void drawScene()
+{
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(10, 10, display.width() / 3, display.height() / 4, GxEPD_BLACK);
+  display.fillCircle(display.width() / 2, display.height() / 2, 20, GxEPD_RED);
+  display.drawLine(0, display.height() - 1, display.width() - 1, 0, GxEPD_BLACK);
+}
+
+void drawBox()
+{
+  display.fillRect(display.width() - 30, 5, 20, 20, GxEPD_BLACK);
+}
+
+void blocking(then t)
+{
+  switch (t)
+  {
+    case nothing:
+      break;
+    case then_update:
+      display.update();
+      break;
+    case then_update_window:
+      display.updateWindow(5, 5, 64, 32);
+      break;
+    case then_draw_paged:
+      display.drawPaged(drawBox);
+      break;
+  }
+}
+
+// update() or updateAsync() after init() and drawScene(), then t, returns true if asynchronous
+bool run(bool async, then t, uint32_t& bus, uint32_t& image)
+{
+  bool in_progress = false;
+  display.init();
+  display.update(); // the first update() after init() may differ, and is blocking on GxGDEW042T2
+  drawScene();
+  GxEPD_Host::resetBusDigest();
+  calls = 0;
+  if (!async)
+  {
+    display.update();
+    blocking(t);
+  }
+  else
+  {
+    GxEPD_Host::check(display.updateAsync(callback, &calls), "updateAsync() started");
+    in_progress = display.isUpdating();
+    GxEPD_Host::check(display.isAsync() == in_progress, "isAsync() %u, in progress %u", display.isAsync(), in_progress);
+    GxEPD_Host::check(in_progress == async_class, "asynchronous %u", in_progress);
+    if (in_progress)
+    {
+      GxEPD_Host::check(!display.updateAsync(callback, &calls), "updateAsync() refused while in progress");
+      display.poll();
+      display.poll();
+      GxEPD_Host::check(!no_busy.isBusy(), "isBusy() without BUSY pin");
+    }
+    if (t == nothing)
+    {
+      uint32_t polls = 0;
+      while (display.poll())
+      {
+        polls++;
+        if (display.isBusy()) delay(1);
+      }
+      GxEPD_Host::check(!in_progress || (polls > 0), "poll() until done");
+    }
+    else blocking(t);
+    GxEPD_Host::check(!display.isUpdating() && !display.poll(), "asynchronous update completed");
+    GxEPD_Host::check(calls == 1, "callback called %u times", calls);
+    GxEPD_Host::check(!display.asyncTimedOut(), "no timeout");
+  }
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+  return in_progress;
+}
+
+void setup()
+{
+  bool supported = false;
+  display.init();
+  drawScene();
+  calls = 0;
+  GxEPD_Host::check(display.updateAsync(callback, &calls), "updateAsync() after init()");
+  while (display.poll()) delay(1);
+#if defined(_GxGDEW042T2_H_)
+  GxEPD_Host::check(!display.isAsync() && (calls == 1), "first updateAsync() after init() blocking");
+#else
+  GxEPD_Host::check((display.isAsync() == async_class) && (calls == 1), "first updateAsync() after init()");
+#endif
+  for (uint8_t t = nothing; t <= then_draw_paged; t++)
+  {
+    uint32_t bus, image, async_bus, async_image;
+    run(false, then(t), bus, image);
+    supported = run(true, then(t), async_bus, async_image);
+    GxEPD_Host::check((async_bus == bus) && (async_image == image), "asynchronous update then %u", t);
+  }
+  if (supported)
+  {
+    GxEmulatedPanel::timing timing = GxEPD_Host::panel()->getTiming();
+    GxEmulatedPanel::timing slow = timing;
+    slow.full_refresh_ms = GxEPD_ASYNC_BUSY_TIMEOUT + 5000;
+    GxEPD_Host::panel()->setTiming(slow);
+    display.init();
+    display.update();
+    drawScene();
+    uint32_t timeouts = display.busyWaitStats().timeouts;
+    display.updateAsync();
+    while (display.poll()) delay(1);
+    GxEPD_Host::check(display.asyncTimedOut(), "timeout reported by asyncTimedOut()");
+    GxEPD_Host::check(display.busyWaitStats().timeouts == timeouts + 1, "timeout counted");
+    GxEPD_Host::panel()->setTiming(timing);
+  }
+}
+
+void loop()
+{
+}
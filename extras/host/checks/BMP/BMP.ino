@@ -0,0 +1,269 @@
+// BMP : GxBMP against drawPixel() of the decoded colors
+//
+// host only: make check, or make SKETCH=checks/BMP/BMP.ino DISPLAY_CLASS=GxGDEW029Z10
+//
+// BMP files generated in memory, depths 1, 4, 8, 16 (565 bitfields and 555) and 24, bottom up and top down, both palettes;
+// threshold output in 4 rotations must be drawPixel() of the nearest color, read from memory, from a seekable input
+// that returns short reads and from a stream; ordered and error diffusion drawn paged must be as drawn to a full buffer, with GxEPD_HEAP_BUFFER
+
+#include <GxEPD.h>
+#include <GxBMP.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+GxBMP bmp(display);
+
+const int16_t X = -3, Y = 5;
+const int32_t W = 77, H = 150;
+uint8_t file[60000];
+uint32_t file_size;
+uint16_t depth;
+bool rgb555;
+
+// seekable, returns fewer bytes than asked for
+class ShortReadInput : public GxBMP_Input
+{
+  public:
+    ShortReadInput() : _position(0) {};
+    uint16_t read(uint8_t* buffer, uint16_t size)
+    {
+      if (size > 5) size -= 3;
+      if (_position + size > file_size) size = file_size - _position;
+      memcpy(buffer, file + _position, size);
+      _position += size;
+      return size;
+    };
+    bool seek(uint32_t position)
+    {
+      _position = position;
+      return true;
+    };
+  private:
+    uint32_t _position;
+};
+
+// not seekable
+class FileStream : public Stream
+{
+  public:
+    FileStream() : _position(0) {};
+    int available() {return file_size - _position;};
+    int read() {return (_position < file_size) ? file[_position++] : -1;};
+    int peek() {return (_position < file_size) ? file[_position] : -1;};
+    size_t write(uint8_t) {return 0;};
+  private:
+    uint32_t _position;
+};
+
+void rgbAt(int32_t i, int32_t j, uint8_t& r, uint8_t& g, uint8_t& b)
+{
+  r = i * 7 + j;
+  g = i * j + 3 * j;
+  b = j * 3 - i;
+}
+
+void paletteAt(int32_t k, uint8_t& r, uint8_t& g, uint8_t& b)
+{
+  r = k * 37;
+  g = k * 91 + 17;
+  b = k * 53;
+}
+
+uint8_t indexAt(int32_t i, int32_t j)
+{
+  return (i * 3 + j * 5 + (i * j) / 7) & ((1 << depth) - 1);
+}
+
+uint16_t value16(int32_t i, int32_t j)
+{
+  uint8_t r, g, b;
+  rgbAt(i, j, r, g, b);
+  return rgb555 ? ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3) : ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+// the color as decoded, 16 bit expanded to 8 bit per channel
+void decodedAt(int32_t i, int32_t j, uint8_t& r, uint8_t& g, uint8_t& b)
+{
+  if (depth <= 8) paletteAt(indexAt(i, j), r, g, b);
+  else if (depth == 24) rgbAt(i, j, r, g, b);
+  else
+  {
+    uint16_t v = value16(i, j);
+    if (rgb555) v = ((v & 0x7FE0) << 1) | ((v >> 4) & 0x20) | (v & 0x1F);
+    r = (v >> 8) & 0xF8;
+    g = (v >> 3) & 0xFC;
+    b = (v << 3) & 0xF8;
+    r |= r >> 5;
+    g |= g >> 6;
+    b |= b >> 5;
+  }
+}
+
+void put16(uint8_t* p, uint16_t v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+void put32(uint8_t* p, uint32_t v)
+{
+  put16(p, v);
+  put16(p + 2, v >> 16);
+}
+
+void makeFile(bool bottom_up)
+{
+  uint32_t row_size = ((W * depth + 31) / 32) * 4;
+  uint16_t colors = (depth <= 8) ? (1 << depth) : 0;
+  bool bitfields = (depth == 16) && !rgb555;
+  uint32_t offset = 14 + 40 + (bitfields ? 12 : 0) + 4 * colors;
+  memset(file, 0, sizeof(file));
+  file[0] = 'B';
+  file[1] = 'M';
+  put32(file + 2, offset + row_size * H);
+  put32(file + 10, offset);
+  put32(file + 14, 40);
+  put32(file + 18, W);
+  put32(file + 22, bottom_up ? H : -H);
+  put16(file + 26, 1);
+  put16(file + 28, depth);
+  put32(file + 30, bitfields ? 3 : 0);
+  if (bitfields)
+  {
+    put32(file + 54, 0xF800);
+    put32(file + 58, 0x07E0);
+    put32(file + 62, 0x001F);
+  }
+  for (uint16_t k = 0; k < colors; k++)
+  {
+    uint8_t* p = file + 54 + 4 * k;
+    paletteAt(k, p[2], p[1], p[0]);
+  }
+  for (int32_t j = 0; j < H; j++)
+  {
+    uint8_t* row = file + offset + (bottom_up ? H - 1 - j : j) * row_size;
+    for (int32_t i = 0; i < W; i++)
+    {
+      if (depth <= 8)
+      {
+        uint32_t bit = i * depth;
+        row[bit / 8] |= indexAt(i, j) << (8 - depth - bit % 8);
+      }
+      else if (depth == 24) rgbAt(i, j, row[3 * i + 2], row[3 * i + 1], row[3 * i]);
+      else put16(row + 2 * i, value16(i, j));
+    }
+  }
+  file_size = offset + row_size * H;
+}
+
+void drawPixels(GxDither::palette p)
+{
+  const uint16_t colors[] = {GxEPD_WHITE, GxEPD_BLACK, GxEPD_RED};
+  for (int32_t j = 0; j < H; j++)
+  {
+    for (int32_t i = 0; i < W; i++)
+    {
+      uint8_t r, g, b;
+      decodedAt(i, j, r, g, b);
+      display.drawPixel(X + i, Y + j, colors[GxDither::classify(p, r, g, b)]);
+    }
+  }
+}
+
+GxDither::palette draw_palette;
+GxDither::method draw_method;
+
+void drawBMP()
+{
+  GxEPD_Host::check(bmp.draw(X, Y, draw_palette, draw_method), "draw(), depth %u", depth);
+}
+
+// paged : drawPaged() of the current frame buffer, else to the buffer and update()
+void drawFile(GxBMP_Input& input, GxDither::palette p, GxDither::method m, bool paged, uint32_t& bus, uint32_t& image)
+{
+  draw_palette = p;
+  draw_method = m;
+  GxEPD_Host::resetBusDigest();
+  if (GxEPD_Host::check(bmp.begin(input), "begin(), depth %u", depth))
+  {
+    if (paged) display.drawPaged(drawBMP);
+    else
+    {
+      display.fillScreen(GxEPD_WHITE);
+      drawBMP();
+      display.update();
+    }
+    bmp.end();
+  }
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+}
+
+void setup()
+{
+  const uint16_t depths[] = {1, 4, 8, 16, 16, 24};
+  display.init();
+  display.update(); // the first update after init() differs
+  for (uint8_t d = 0; d < 6; d++)
+  {
+    depth = depths[d];
+    rgb555 = (d == 4);
+    for (uint8_t bottom_up = 0; bottom_up < 2; bottom_up++)
+    {
+      makeFile(bottom_up);
+      for (uint8_t p = GxDither::bw; p <= GxDither::bwr; p++)
+      {
+        for (uint8_t r = 0; r < 4; r++)
+        {
+          uint32_t bus, image;
+          display.setRotation(r);
+          GxEPD_Host::resetBusDigest();
+          display.fillScreen(GxEPD_WHITE);
+          drawPixels(GxDither::palette(p));
+          display.update();
+          bus = GxEPD_Host::busDigest();
+          image = GxEPD_Host::imageDigest();
+          for (uint8_t i = 0; i < ((r == 0) ? 3 : 1); i++)
+          {
+            uint32_t bmp_bus, bmp_image;
+            GxBMP_MemoryInput memory_input(file, file_size);
+            ShortReadInput short_read_input;
+            FileStream stream;
+            GxBMP_StreamInput stream_input(stream);
+            GxBMP_Input* inputs[] = {&memory_input, &short_read_input, &stream_input};
+            drawFile(*inputs[i], GxDither::palette(p), GxDither::threshold, false, bmp_bus, bmp_image);
+            GxEPD_Host::check((bmp_bus == bus) && (bmp_image == image), "depth %u%s, bottom up %u, palette %u, rotation %u, input %u",
+                              depth, rgb555 ? " 555" : "", bottom_up, p, r, i);
+          }
+        }
+      }
+    }
+  }
+#if GxEPD_HEAP_BUFFER
+  // paged against a full buffer
+  depth = 24;
+  rgb555 = false;
+  makeFile(true);
+  for (uint8_t m = GxDither::ordered; m <= GxDither::threshold; m++)
+  {
+    uint32_t bus, image, paged_bus, paged_image;
+    display.setFrameBufferBudget(0);
+    display.init();
+    GxBMP_MemoryInput input(file, file_size);
+    drawFile(input, GxDither::bwr, GxDither::method(m), false, bus, image);
+    display.setFrameBufferBudget(uint32_t(GxEPD_WIDTH) * GxEPD_HEIGHT / 8 / 15);
+    display.init();
+    GxBMP_MemoryInput paged_input(file, file_size);
+    drawFile(paged_input, GxDither::bwr, GxDither::method(m), true, paged_bus, paged_image);
+    GxEPD_Host::check(paged_image == image, "method %u paged in %u pages", m, display.pages());
+  }
+#endif
+}
+
+void loop()
+{
+}
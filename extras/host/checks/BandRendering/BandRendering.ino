@@ -0,0 +1,74 @@
+// BandRendering : band rendering on host threads against drawing directly, see GxEPD::setBandRendering()
+//
+// host only: make check, or make SKETCH=checks/BandRendering/BandRendering.ino DISPLAY_CLASS=GxGDEW075Z09
+//
+// a scene of shapes, bitmaps and text in many RGB565 colors, in 4 rotations, drawn directly and by 1, 2 and 4 bands;
+// the bus traffic and the panel image of update() must be the same
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+uint8_t display_list[65536];
+
+const uint8_t bitmap[] = {0xFF, 0x81, 0xBD, 0xA5, 0xA5, 0xBD, 0x81, 0xFF, 0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x3C, 0x18};
+
+void drawScene()
+{
+  srand(7);
+  display.fillScreen(GxEPD_WHITE);
+  for (int i = 0; i < 200; i++)
+  {
+    int16_t x = rand() % display.width(), y = rand() % display.height();
+    uint16_t color = rand() & 0xFFFF;
+    switch (rand() % 5)
+    {
+      case 0: display.drawPixel(x, y, color); break;
+      case 1: display.fillRect(x, y, rand() % 60, rand() % 40, color); break;
+      case 2: display.drawLine(x, y, rand() % display.width(), rand() % display.height(), color); break;
+      case 3: display.drawBitmap(bitmap, x, y, 16, 8, color, GxEPD::bm_transparent); break;
+      case 4: display.setTextColor(color); display.setCursor(x, y); display.print("band"); break;
+    }
+  }
+}
+
+void run(uint8_t r, uint8_t bands, uint32_t& bus, uint32_t& image)
+{
+  display.init();
+  display.setRotation(r);
+  display.setDisplayList(display_list, sizeof(display_list));
+  GxEPD_Host::resetBusDigest();
+  if (bands > 0)
+  {
+    display.setBandRendering(GxEPD_Host::runBandThreads, bands);
+    display.drawBands(drawScene);
+  }
+  else drawScene();
+  display.update();
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+}
+
+void setup()
+{
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    uint32_t bus, image;
+    run(r, 0, bus, image);
+    for (uint8_t bands = 1; bands <= 4; bands *= 2)
+    {
+      uint32_t band_bus, band_image;
+      run(r, bands, band_bus, band_image);
+      GxEPD_Host::check(display.displayListUsed() > 0, "rotation %u, %u bands, drawn directly", r, bands);
+      GxEPD_Host::check((band_bus == bus) && (band_image == image), "rotation %u, %u bands", r, bands);
+    }
+  }
+}
+
+void loop()
+{
+}
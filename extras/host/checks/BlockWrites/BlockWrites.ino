@@ -0,0 +1,89 @@
+// BlockWrites : the block writes of GxIO_SPI against the same bytes written one by one
+//
+// host only: make check, or make SKETCH=checks/BlockWrites/BlockWrites.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// writeData() of a block, inverted and not, writeDataPattern() and their transactions, of 0 to several hundred bytes;
+// the panel must receive the bytes of writeData() of a byte, and the io counters must be the same
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+
+// commands without busy time or sleep on the emulated controllers
+const uint8_t commands[] = {0x13, 0x24, 0x26};
+
+uint8_t data[300];
+
+// entry i, as block or byte by byte, in one transaction
+void transfer(uint16_t i, uint32_t n, bool block)
+{
+  uint8_t c = commands[i % sizeof(commands)];
+  const uint8_t* d = data + (i * 7) % 32;
+  bool invert = i & 1;
+  io.writeCommandTransaction(c);
+  switch (i % 4)
+  {
+    case 0:
+    case 1:
+      if (block) io.writeDataTransaction(d, n, invert);
+      else
+      {
+        io.startTransaction();
+        for (uint32_t j = 0; j < n; j++) io.writeData(uint8_t(invert ? ~d[j] : d[j]));
+        io.endTransaction();
+      }
+      break;
+    case 2:
+      if (block) io.writeDataPatternTransaction(c, n);
+      else
+      {
+        io.startTransaction();
+        for (uint32_t j = 0; j < n; j++) io.writeData(c);
+        io.endTransaction();
+      }
+      break;
+    case 3:
+      io.startTransaction();
+      if (block) io.writeData(d, n, invert);
+      else for (uint32_t j = 0; j < n; j++) io.writeData(uint8_t(invert ? ~d[j] : d[j]));
+      if (block) io.writeDataPattern(~c, n);
+      else for (uint32_t j = 0; j < n; j++) io.writeData(uint8_t(~c));
+      io.endTransaction();
+      break;
+  }
+}
+
+void run(uint32_t n, bool block, uint32_t& bus, GxIO::io_stats& stats)
+{
+  io.init();
+  io.reset();
+  io.resetIOStats();
+  GxEPD_Host::resetBusDigest();
+  for (uint16_t i = 0; i < 8; i++) transfer(i, n, block);
+  bus = GxEPD_Host::busDigest();
+  stats = io.ioStats();
+}
+
+void setup()
+{
+  for (uint16_t i = 0; i < sizeof(data); i++) data[i] = i * 131 + (i >> 7);
+  const uint32_t sizes[] = {0, 1, 63, 64, 65, 257};
+  for (uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    uint32_t bus, block_bus;
+    GxIO::io_stats stats, block_stats;
+    run(sizes[s], false, bus, stats);
+    run(sizes[s], true, block_bus, block_stats);
+    GxEPD_Host::check(block_bus == bus, "%u bytes per block", sizes[s]);
+    GxEPD_Host::check((block_stats.commands == stats.commands) && (block_stats.data_bytes == stats.data_bytes) &&
+                      (block_stats.transactions == stats.transactions), "%u bytes per block, %u data bytes counted, %u by bytes",
+                      sizes[s], block_stats.data_bytes, stats.data_bytes);
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,80 @@
+// BusyWait : the BUSY wait strategies compared, see GxEPD::setBusyWait()
+//
+// host only: make check, or make SKETCH=checks/BusyWait/BusyWait.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// the same updates waited for by polling, by pin change interrupt and by hook must send the same and show the same;
+// the interrupt wait must measure its latency from the edge, also after many waits (its interrupt slot is released),
+// and the hook must be called while BUSY; the statistics of each strategy are printed; on the host the interrupt wait
+// blocks by delay(1), as on boards without __WFI(), task notification or idle sleep, so its latency is below 1 ms
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+uint32_t hook_calls;
+uint8_t late; // last waits of the updates that returned a full poll of 1 ms after the edge
+
+// as a light sleep until the pin changes would, without the wake up
+void hook(int8_t pin, uint8_t busy_level)
+{
+  hook_calls++;
+  delay(1);
+}
+
+void run(GxEPD::busy_wait_mode mode, uint32_t& bus, uint32_t& image)
+{
+  display.init();
+  display.setBusyWait(mode, hook);
+  display.resetBusyWaitStats();
+  hook_calls = 0;
+  late = 0;
+  GxEPD_Host::resetBusDigest();
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    display.fillScreen(GxEPD_WHITE);
+    display.fillRect(10 + 20 * i, 10, 40, 30, GxEPD_BLACK);
+    display.update();
+    late += display.busyWaitStats().last_latency >= 1000;
+    display.fillRect(100, 40 + 10 * i, 20, 20, GxEPD_BLACK);
+    display.updateWindow(100, 40, 20, 60);
+    late += display.busyWaitStats().last_latency >= 1000;
+  }
+  display.eraseDisplay();
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+  const GxEPD::busy_wait_stats& s = display.busyWaitStats();
+  Serial.printf("mode %u: %u waits, %u polls, %u timeouts, busy %u us, %u of 6 late, max %u us, %u hook calls\n",
+                mode, s.waits, s.polls, s.timeouts, s.busy_time, late, s.max_latency, hook_calls);
+}
+
+void setup()
+{
+  uint32_t bus, image;
+  run(GxEPD::busy_wait_polling, bus, image);
+  GxEPD::busy_wait_stats polling = display.busyWaitStats();
+  uint8_t polling_late = late;
+  GxEPD_Host::check(polling_late > 1, "polling, %u of 6 late", polling_late);
+  GxEPD_Host::check(polling.waits > 6, "%u waits", polling.waits);
+  const GxEPD::busy_wait_mode modes[] = {GxEPD::busy_wait_interrupt, GxEPD::busy_wait_hook};
+  for (uint8_t m = 0; m < 2; m++)
+  {
+    uint32_t mode_bus, mode_image;
+    run(modes[m], mode_bus, mode_image);
+    const GxEPD::busy_wait_stats& s = display.busyWaitStats();
+    GxEPD_Host::check((mode_bus == bus) && (mode_image == image), "mode %u sends and shows as polling", modes[m]);
+    GxEPD_Host::check((s.waits == polling.waits) && (s.timeouts == 0), "mode %u, %u waits, %u timeouts", modes[m], s.waits, s.timeouts);
+  }
+  // again, the interrupt wait last
+  run(GxEPD::busy_wait_interrupt, bus, image);
+  GxEPD_Host::check(late < polling_late, "interrupt latency from the edge, %u of 6 late, polling %u", late, polling_late);
+  run(GxEPD::busy_wait_hook, bus, image);
+  GxEPD_Host::check(hook_calls > 0, "hook called while BUSY");
+}
+
+void loop()
+{
+}
@@ -0,0 +1,43 @@
+// ColorThresholds : color thresholds per display instance, see GxEPD::setColorThresholds()
+//
+// host only: make check, or make SKETCH=checks/ColorThresholds/ColorThresholds.ino DISPLAY_CLASS=GxGDEW042Z15
+//
+// two display instances on the same panel; yellow is red by default on the 3-color classes and white with a white level
+// below its luminance; the thresholds of one instance must not change the mapping of the other, reset restores the default
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxEPD_Class other(io /*RST=9*/ /*BUSY=7*/);
+
+const uint16_t yellow = 0xFFE0;
+
+uint32_t show(GxEPD& d, uint16_t color)
+{
+  d.init();
+  d.fillScreen(color);
+  d.update();
+  return GxEPD_Host::imageDigest();
+}
+
+void setup()
+{
+  uint32_t white = show(display, GxEPD_WHITE);
+  uint32_t yellow_default = show(display, yellow);
+  display.setColorThresholds(200, 40);
+  GxEPD_Host::check(show(display, yellow) == white, "yellow white by the thresholds");
+  GxEPD_Host::check(show(other, yellow) == yellow_default, "other instance, default mapping");
+  other.setColorThresholds(255, 40);
+  GxEPD_Host::check(show(display, yellow) == white, "thresholds kept by the first instance");
+  other.resetColorThresholds();
+  display.resetColorThresholds();
+  GxEPD_Host::check(show(display, yellow) == yellow_default, "default mapping after reset");
+}
+
+void loop()
+{
+}
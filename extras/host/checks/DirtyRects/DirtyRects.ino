@@ -0,0 +1,83 @@
+// DirtyRects : dirty rectangle tracking and updateDirty(), see GxEPD::setDirtyTracking()
+//
+// host only: make check, or make SKETCH=checks/DirtyRects/DirtyRects.ino DISPLAY_CLASS=GxGDEH029A1
+//
+// spots far apart, fewer and more than GxEPD_DIRTY_RECTS, in 4 rotations, with and without shadow buffer;
+// updateDirty() must show what update() shows of the same buffer; the classes that refresh once for all rectangles
+// must keep the spots apart and refresh once, the others, which refresh per rectangle, must merge them
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+#if defined(_GxGDEW042T2_H_) || defined(_GxGDEH029A1_H_) || defined(_GxGDEP015OC1_H_) || defined(_GxGDE0213B1_H_)
+const bool one_refresh = true;
+#else
+const bool one_refresh = false;
+#endif
+
+uint8_t shadow[uint32_t(GxEPD_WIDTH) * GxEPD_HEIGHT / 8];
+
+uint32_t refreshes()
+{
+  const GxEmulatedPanel::stats& s = GxEPD_Host::panel()->getStats();
+  return s.full_refreshes + s.partial_refreshes;
+}
+
+void drawSpots(uint8_t spots, uint8_t round)
+{
+  const int16_t w = display.width(), h = display.height();
+  const int16_t x[] = {3, int16_t(w - 30), 3, int16_t(w - 30), int16_t(w / 2), int16_t(w / 2 - 20)};
+  const int16_t y[] = {5, 5, int16_t(h - 25), int16_t(h - 25), int16_t(h / 2), 40};
+  for (uint8_t i = 0; i < spots; i++)
+  {
+    display.fillRect(x[i], y[i], 24, 18, GxEPD_WHITE);
+    display.fillRect(x[i] + 2, y[i] + 4, 4 + round * 5 + i, 10, GxEPD_BLACK); // differs by round, with any font
+  }
+}
+
+void setup()
+{
+  for (uint8_t s = 0; s < 2; s++)
+  {
+    for (uint8_t r = 0; r < 4; r++)
+    {
+      display.init();
+      display.setRotation(r);
+      display.setShadowBuffer(s ? shadow : 0, s ? sizeof(shadow) : 0);
+      display.fillScreen(GxEPD_WHITE);
+      display.update();
+      display.setDirtyTracking(true);
+      for (uint8_t round = 1; round < 4; round++)
+      {
+        uint8_t spots = (round == 2) ? 6 : 3;
+        drawSpots(spots, round);
+        uint8_t rects = display.dirtyCount();
+        if (one_refresh && (spots <= GxEPD_DIRTY_RECTS)) GxEPD_Host::check(rects == spots, "%u spots kept apart, %u rectangles", spots, rects);
+        if (!one_refresh) GxEPD_Host::check(rects == 1, "%u spots merged, %u rectangles", spots, rects);
+        uint32_t before = refreshes();
+        display.updateDirty();
+        if (one_refresh) GxEPD_Host::check(refreshes() - before == 1, "shadow %u, rotation %u, round %u: %u refreshes", s, r, round, refreshes() - before);
+        GxEPD_Host::check(display.dirtyCount() == 0, "dirty rectangles cleared");
+        uint32_t image = GxEPD_Host::imageDigest();
+        display.update();
+        GxEPD_Host::check(GxEPD_Host::imageDigest() == image, "shadow %u, rotation %u, round %u: updateDirty() shows the buffer", s, r, round);
+        display.clearDirty();
+      }
+      // drawn the same again, unchanged against the shadow
+      drawSpots(3, 3);
+      uint32_t before = refreshes();
+      display.updateDirty();
+      if (one_refresh && s) GxEPD_Host::check(refreshes() == before, "rotation %u: unchanged, no refresh", r);
+      display.setDirtyTracking(false);
+    }
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,78 @@
+// DisplayList : paged drawing with a display list against paged drawing without, see GxEPD::setDisplayList()
+//
+// host only: make check, or make SKETCH=checks/DisplayList/DisplayList.ino DISPLAY_CLASS=GxGDEW042Z15
+//
+// drawPaged() and drawPagedToWindow() in 4 rotations, on a full and, with GxEPD_HEAP_BUFFER, a paged frame buffer,
+// with a list that fits and one that overflows; the bus traffic and the panel image must be the same as without display list
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+uint8_t display_list[20000];
+uint16_t calls;
+
+const uint8_t bitmap[] = {0xFF, 0x81, 0xBD, 0xA5, 0xA5, 0xBD, 0x81, 0xFF, 0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x3C, 0x18};
+
+void drawScene(uint32_t v)
+{
+  calls++;
+  display.setTextColor(GxEPD_BLACK);
+  display.setCursor(5, 5);
+  display.print("value ");
+  display.print(v);
+  display.drawCircle(display.width() / 2, display.height() / 2, display.height() / 3, GxEPD_BLACK);
+  display.fillCircle(display.width() / 3, display.height() / 3, 15, GxEPD_RED);
+  display.drawLine(0, 0, display.width() - 1, display.height() - 1, GxEPD_BLACK);
+  display.drawLine(display.width() - 1, 0, 0, display.height() - 1, GxEPD_BLACK);
+  display.fillRect(display.width() - 40, display.height() - 30, 30, 20, GxEPD_BLACK);
+  display.drawBitmap(bitmap, 20, display.height() - 20, 8, 2, GxEPD_BLACK, GxEPD::bm_normal);
+  display.drawBitmap(bitmap, 40, display.height() - 40, 16, 8, GxEPD_RED, GxEPD::bm_transparent);
+  display.drawPixel(3, display.height() - 3, GxEPD_BLACK);
+}
+
+void run(uint32_t budget, uint8_t r, uint32_t list_size, uint32_t& bus, uint32_t& image)
+{
+#if GxEPD_HEAP_BUFFER
+  display.setFrameBufferBudget(budget);
+#endif
+  display.init();
+  display.setRotation(r);
+  display.setDisplayList(list_size ? display_list : 0, list_size);
+  GxEPD_Host::resetBusDigest();
+  calls = 0;
+  display.drawPaged(drawScene, 42);
+  if (list_size > 1000) GxEPD_Host::check(calls == 1, "drawPaged() with display list, %u calls", calls);
+  display.drawPagedToWindow(drawScene, 10, 10, 100, 60, 43);
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+}
+
+void setup()
+{
+  const uint32_t budgets[] = {0, uint32_t(GxEPD_WIDTH) * GxEPD_HEIGHT / 8 / 5};
+  const uint32_t list_sizes[] = {sizeof(display_list), 64};
+  for (uint8_t b = 0; b < (GxEPD_HEAP_BUFFER ? 2 : 1); b++)
+  {
+    for (uint8_t r = 0; r < 4; r++)
+    {
+      uint32_t bus, image;
+      run(budgets[b], r, 0, bus, image);
+      if (b > 0) GxEPD_Host::check(display.pages() > 1, "budget %u, %u pages", budgets[b], display.pages());
+      for (uint8_t l = 0; l < 2; l++)
+      {
+        uint32_t list_bus, list_image;
+        run(budgets[b], r, list_sizes[l], list_bus, list_image);
+        GxEPD_Host::check((list_bus == bus) && (list_image == image), "budget %u, rotation %u, list %u bytes", budgets[b], r, list_sizes[l]);
+      }
+    }
+  }
+}
+
+void loop()
+{
+}
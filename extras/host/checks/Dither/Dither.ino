@@ -0,0 +1,128 @@
+// Dither : GxDither against drawPixel() of the same colors
+//
+// host only: make check, or make SKETCH=checks/Dither/Dither.ino DISPLAY_CLASS=GxGDEW029Z10
+//
+// threshold output, rows top down and bottom up, in both palettes and 4 rotations, must be drawPixel() of the nearest color;
+// ordered and error diffusion fed a few pixels at a time by writePixels() must be the same as fed by rows
+
+#include <GxEPD.h>
+#include <GxDither.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+GxDither dither(display);
+
+const int16_t X = -5, Y = 3;
+const uint16_t W = 213;
+uint8_t row[3 * W];
+
+void makeRow(uint16_t j, GxDither::pixel_format format)
+{
+  for (uint16_t i = 0; i < W; i++)
+  {
+    uint8_t r = i * 7 + j * 3, g = i * j, b = j * 5;
+    if (format == GxDither::gray8) row[i] = r;
+    else if (format == GxDither::bgr888)
+    {
+      row[3 * i] = b;
+      row[3 * i + 1] = g;
+      row[3 * i + 2] = r;
+    }
+    else
+    {
+      row[3 * i] = r;
+      row[3 * i + 1] = g;
+      row[3 * i + 2] = b;
+    }
+  }
+}
+
+void drawPixels(GxDither::palette p, GxDither::pixel_format format, uint16_t h)
+{
+  const uint16_t colors[] = {GxEPD_WHITE, GxEPD_BLACK, GxEPD_RED};
+  for (uint16_t j = 0; j < h; j++)
+  {
+    makeRow(j, format);
+    for (uint16_t i = 0; i < W; i++)
+    {
+      uint8_t c = (format == GxDither::gray8) ? GxDither::classify(p, row[i], row[i], row[i]) :
+                  (format == GxDither::bgr888) ? GxDither::classify(p, row[3 * i + 2], row[3 * i + 1], row[3 * i]) :
+                  GxDither::classify(p, row[3 * i], row[3 * i + 1], row[3 * i + 2]);
+      display.drawPixel(X + i, Y + j, colors[c]);
+    }
+  }
+}
+
+// chunk 0 : rows by writeRow()
+void drawDither(GxDither::palette p, GxDither::method m, GxDither::pixel_format format, uint16_t h, bool bottom_up, uint8_t chunk)
+{
+  uint8_t pixel_bytes = (format == GxDither::gray8) ? 1 : 3;
+  dither.begin(X, Y, W, h, p, m, bottom_up);
+  for (uint16_t n = 0; n < h; n++)
+  {
+    makeRow(bottom_up ? h - 1 - n : n, format);
+    if (chunk == 0) dither.writeRow(row, format);
+    else
+    {
+      for (uint16_t i = 0; i < W; i += chunk) dither.writePixels(row + i * pixel_bytes, (W - i < chunk) ? W - i : chunk, format);
+    }
+  }
+  dither.end();
+}
+
+void digests(uint32_t& bus, uint32_t& image)
+{
+  GxEPD_Host::resetBusDigest();
+  display.update();
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+}
+
+void setup()
+{
+  const GxDither::pixel_format formats[] = {GxDither::rgb888, GxDither::bgr888, GxDither::gray8};
+  display.init();
+  display.update(); // the first update after init() differs
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    display.setRotation(r);
+    uint16_t h = display.height() + 4;
+    for (uint8_t p = GxDither::bw; p <= GxDither::bwr; p++)
+    {
+      for (uint8_t f = 0; f < 3; f++)
+      {
+        uint32_t bus, image;
+        display.fillScreen(GxEPD_WHITE);
+        drawPixels(GxDither::palette(p), formats[f], h);
+        digests(bus, image);
+        for (uint8_t bottom_up = 0; bottom_up < 2; bottom_up++)
+        {
+          uint32_t dither_bus, dither_image;
+          display.fillScreen(GxEPD_WHITE);
+          drawDither(GxDither::palette(p), GxDither::threshold, formats[f], h, bottom_up, 0);
+          digests(dither_bus, dither_image);
+          GxEPD_Host::check((dither_bus == bus) && (dither_image == image), "threshold, rotation %u, palette %u, format %u, bottom up %u", r, p, f, bottom_up);
+        }
+      }
+      for (uint8_t m = GxDither::ordered; m <= GxDither::error_diffusion; m++)
+      {
+        uint32_t bus, image, chunk_bus, chunk_image;
+        display.fillScreen(GxEPD_WHITE);
+        drawDither(GxDither::palette(p), GxDither::method(m), GxDither::rgb888, h, false, 0);
+        digests(bus, image);
+        display.fillScreen(GxEPD_WHITE);
+        drawDither(GxDither::palette(p), GxDither::method(m), GxDither::rgb888, h, false, 5);
+        digests(chunk_bus, chunk_image);
+        GxEPD_Host::check((chunk_bus == bus) && (chunk_image == image), "method %u by writePixels(), rotation %u, palette %u", m, r, p);
+      }
+    }
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,121 @@
+// IOQueue : the transfer queue of GxIO_SPI against the same transfers written directly
+//
+// host only: make check, or make SKETCH=checks/IOQueue/IOQueue.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// commands, data, inverted data, patterns and empty entries, some longer than GxIO_SPI_QUEUE_CHUNK, several times
+// GxIO_SPI_QUEUE_SIZE entries so the ring wraps and fills up; sent by processQueue() and by the thread of GxHostThreadSPI,
+// the panel must receive the bytes of the direct writes, and the callback be called once, after the last byte
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxHostThreadSPI.h"
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxHostThreadSPI thread_io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+
+// commands without busy time or sleep on the emulated controllers
+const uint8_t commands[] = {0x13, 0x24, 0x26};
+
+uint8_t data[3 * GxIO_SPI_QUEUE_CHUNK];
+
+struct callback_state
+{
+  uint32_t calls;
+  uint32_t data_bytes; // received by the panel when called
+} state;
+
+void callback(void* arg)
+{
+  callback_state* s = (callback_state*) arg;
+  s->calls++;
+  s->data_bytes = GxEPD_Host::panel()->getStats().data_bytes;
+}
+
+// entry i of the sequence, queued or written directly
+void transfer(GxIO_SPI& spi, uint16_t i, bool queued)
+{
+  uint8_t c = commands[i % sizeof(commands)];
+  uint32_t n = (i * 389UL) % sizeof(data);
+  const uint8_t* d = data + (i * 7) % 64;
+  if (n > sizeof(data) - 64) n = sizeof(data) - 64;
+  switch (i % 5)
+  {
+    case 0:
+      if (queued) spi.queueCommand(c);
+      else spi.writeCommandTransaction(c);
+      break;
+    case 1:
+      if (queued) spi.queueData(d, n);
+      else spi.writeDataTransaction(d, n);
+      break;
+    case 2:
+      if (queued) spi.queueData(d, n, true);
+      else spi.writeDataTransaction(d, n, true);
+      break;
+    case 3:
+      if (queued) spi.queueDataPattern(c, (i % 2) ? 1 : GxIO_SPI_QUEUE_CHUNK + 5);
+      else spi.writeDataPatternTransaction(c, (i % 2) ? 1 : GxIO_SPI_QUEUE_CHUNK + 5);
+      break;
+    case 4:
+      if (queued) spi.queueData(d, 0);
+      break;
+  }
+}
+
+void run(GxIO_SPI& spi, bool queued, bool threaded, uint16_t entries, uint32_t& bus, GxEmulatedPanel::stats& sent)
+{
+  spi.init();
+  spi.reset();
+  GxEmulatedPanel::stats before = GxEPD_Host::panel()->getStats();
+  GxEPD_Host::resetBusDigest();
+  state.calls = 0;
+  for (uint16_t i = 0; i < entries; i++) transfer(spi, i, queued);
+  if (queued)
+  {
+    spi.startQueue(callback, &state);
+    uint16_t calls = 1;
+    while (spi.processQueue()) calls++;
+    if (!threaded && (entries > GxIO_SPI_QUEUE_SIZE)) GxEPD_Host::check(calls > 1, "%u entries sent by %u processQueue() calls", entries, calls);
+    GxEPD_Host::check(!spi.isQueueBusy(), "queue empty");
+  }
+  GxEmulatedPanel::stats after = GxEPD_Host::panel()->getStats();
+  bus = GxEPD_Host::busDigest();
+  sent.commands = after.commands - before.commands;
+  sent.data_bytes = after.data_bytes - before.data_bytes;
+  sent.busy_violations = after.busy_violations - before.busy_violations;
+  sent.sleep_violations = after.sleep_violations - before.sleep_violations;
+  if (queued)
+  {
+    GxEPD_Host::check(state.calls == 1, "callback called %u times", state.calls);
+    GxEPD_Host::check(state.data_bytes == after.data_bytes, "callback called with %u of %u data bytes received",
+                      state.data_bytes - before.data_bytes, sent.data_bytes);
+  }
+}
+
+void setup()
+{
+  for (uint16_t i = 0; i < sizeof(data); i++) data[i] = i * 131 + (i >> 7);
+  const uint16_t entries[] = {0, 1, GxIO_SPI_QUEUE_SIZE - 1, GxIO_SPI_QUEUE_SIZE, 3 * GxIO_SPI_QUEUE_SIZE + 3};
+  for (uint8_t e = 0; e < sizeof(entries) / sizeof(entries[0]); e++)
+  {
+    uint32_t bus, queued_bus, thread_bus;
+    GxEmulatedPanel::stats sent, queued_sent, thread_sent;
+    run(io, false, false, entries[e], bus, sent);
+    run(io, true, false, entries[e], queued_bus, queued_sent);
+    run(thread_io, true, true, entries[e], thread_bus, thread_sent);
+    GxEPD_Host::check((queued_bus == bus) && (queued_sent.commands == sent.commands) && (queued_sent.data_bytes == sent.data_bytes),
+                      "%u entries by processQueue(), %u commands and %u data bytes, %u and %u written directly",
+                      entries[e], queued_sent.commands, queued_sent.data_bytes, sent.commands, sent.data_bytes);
+    GxEPD_Host::check((thread_bus == bus) && (thread_sent.commands == sent.commands) && (thread_sent.data_bytes == sent.data_bytes),
+                      "%u entries by GxHostThreadSPI, %u commands and %u data bytes, %u and %u written directly",
+                      entries[e], thread_sent.commands, thread_sent.data_bytes, sent.commands, sent.data_bytes);
+    GxEPD_Host::check(queued_sent.busy_violations + queued_sent.sleep_violations + thread_sent.busy_violations + thread_sent.sleep_violations == 0,
+                      "%u entries, busy or sleep violations", entries[e]);
+  }
+}
+
+void loop()
+{
+}
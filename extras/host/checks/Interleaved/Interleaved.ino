@@ -0,0 +1,73 @@
+// Interleaved : draws with the frame buffer layout selected by GxEPD_INTERLEAVED_3C, for a 3-color display class
+//
+// host only: make check builds it with and without GxEPD_INTERLEAVED_3C and compares the bus digests it prints
+// and the panel images, they must be the same; the digest is of commands and data, the asynchronous transfer
+// of the interleaved layout sends a chunk per transaction
+//
+// random pixels, rectangles, lines, bitmaps, circles and text in 4 rotations, updateWindow(), update(), updateAsync(),
+// and drawPaged() and drawPagedToWindow() on a paged frame buffer, with and without display list
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+uint8_t display_list[20000];
+
+const uint8_t bitmap[] = {0xFF, 0x81, 0xBD, 0xA5, 0xA5, 0xBD, 0x81, 0xFF, 0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x3C, 0x18,
+                          0x55, 0xAA, 0x0F, 0xF0, 0x01, 0x02, 0x03, 0x04
+                         };
+
+void drawScene(uint32_t seed)
+{
+  srand(seed);
+  for (int i = 0; i < 300; i++)
+  {
+    int16_t x = rand() % (display.width() + 20) - 10, y = rand() % (display.height() + 20) - 10;
+    uint16_t color = (rand() % 3 == 0) ? GxEPD_RED : (rand() % 2 ? GxEPD_BLACK : GxEPD_WHITE);
+    switch (rand() % 6)
+    {
+      case 0: display.drawPixel(x, y, color); break;
+      case 1: display.fillRect(x, y, rand() % 40, rand() % 30, color); break;
+      case 2: display.drawLine(x, y, rand() % display.width(), rand() % display.height(), color); break;
+      case 3: display.drawBitmap(bitmap, x < 0 ? 0 : x, y < 0 ? 0 : y, 13, 12, color, (rand() % 2) ? GxEPD::bm_transparent : GxEPD::bm_normal); break;
+      case 4: display.fillCircle(x, y, rand() % 20, color); break;
+      case 5: display.setTextColor(color); display.setCursor(x, y); display.print("Hello 3C"); break;
+    }
+  }
+  display.fillRect(3, 3, 7, 5, GxEPD_RED);
+}
+
+void setup()
+{
+  display.init();
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    display.setRotation(r);
+    display.fillScreen(GxEPD_WHITE);
+    drawScene(r + 1);
+    display.updateWindow(5, 7, 60, 40, true);
+  }
+  display.update();
+  display.setRotation(1);
+  drawScene(9);
+  display.updateAsync();
+  while (display.poll());
+  display.setFrameBufferBudget(uint32_t(GxEPD_WIDTH) * GxEPD_HEIGHT / 8 / 3);
+  display.init();
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    display.setRotation(r);
+    display.setDisplayList((r & 1) ? display_list : 0, sizeof(display_list));
+    display.drawPaged(drawScene, 42 + r);
+    display.drawPagedToWindow(drawScene, 10, 10, 100, 60, 43 + r);
+  }
+  Serial.printf("bus digest %08x\n", GxEPD_Host::busDigest());
+}
+
+void loop()
+{
+}
@@ -0,0 +1,110 @@
+// NativeImages : native images (.epd) by GxEPDImage against the same data sent by drawBitmap() or drawPicture()
+//
+// host only: make check, or make SKETCH=checks/NativeImages/NativeImages.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// an image made for the panel of the display class, unpacked, must send what drawBitmap(bitmap, size) or
+// drawPicture() of its planes sends, by a bitmap reader for the 4 bit pixels of the IL0371 classes;
+// the same image made for another panel must be refused and send nothing
+
+#include <GxEPD.h>
+#include <GxEPDImage.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxEPDImage epd(display);
+
+// planes and bytes per plane as sent, see the formats in extras/tools/README.md
+#if defined(_GxGDEW075T8_H_) || defined(_GxGDEW0583T7_H_) || defined(_GxGDEW075Z09_H_)
+const uint8_t planes = 1;
+const uint8_t pixels_per_byte = 2;
+#elif defined(_GxGDEW042Z15_H_) || defined(_GxGDEW0213Z16_H_) || defined(_GxGDEW029Z10_H_) || defined(_GxGDEW0154Z17_H_)
+const uint8_t planes = 2;
+const uint8_t pixels_per_byte = 8;
+#else
+const uint8_t planes = 1;
+const uint8_t pixels_per_byte = 8;
+#endif
+
+uint8_t image[GxEPDImage_HEADER_SIZE + 600UL * 448 / 2]; // the largest, of GxGDEW0583T7
+
+// the bitmap from memory, as sent
+uint16_t reader(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n)
+{
+  memcpy(buffer, bitmap + idx, n);
+  return n;
+}
+
+void put16(uint8_t* p, uint16_t v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+void put32(uint8_t* p, uint32_t v)
+{
+  put16(p, v);
+  put16(p + 2, v >> 16);
+}
+
+// header for panel, data of the planes after it; returns the bytes per plane
+uint32_t makeImage(const char* panel)
+{
+  uint16_t w = display.width(), h = display.height();
+  uint32_t size = uint32_t((w + pixels_per_byte - 1) / pixels_per_byte) * h;
+  memset(image, 0, GxEPDImage_HEADER_SIZE);
+  memcpy(image, "GxEP", 4);
+  image[4] = GxEPDImage_VERSION;
+  image[6] = planes;
+  put16(image + 8, w);
+  put16(image + 10, h);
+  for (uint8_t i = 0; i < planes; i++)
+  {
+    put32(image + 12 + 4 * i, size);
+    put32(image + 20 + 4 * i, size);
+  }
+  strncpy((char*) image + 32, panel, 16);
+  for (uint32_t i = 0; i < planes * size; i++) image[GxEPDImage_HEADER_SIZE + i] = (i * 131 + (i >> 9)) | ((i / 64) & 1 ? 0x0F : 0x00);
+  return size;
+}
+
+void setup()
+{
+  display.init();
+  GxEPD_Host::resetBusDigest();
+  const uint32_t nothing = GxEPD_Host::busDigest();
+  uint32_t size = makeImage(display.panelName());
+  const uint8_t* data = image + GxEPDImage_HEADER_SIZE;
+  // twice, the first after init() differs on GxGDEW042T2
+  for (uint8_t n = 0; n < 2; n++)
+  {
+    display.init();
+    GxEPD_Host::resetBusDigest();
+    if (pixels_per_byte != 8) display.setBitmapReader(reader);
+    if (planes == 1) display.drawBitmap(data, size, GxEPD::bm_normal);
+    else display.drawPicture(data, data + size, size, size, GxEPD::bm_normal);
+    display.setBitmapReader(0);
+    uint32_t bus = GxEPD_Host::busDigest(), picture = GxEPD_Host::imageDigest();
+    display.init();
+    GxEPD_Host::resetBusDigest();
+    GxBMP_MemoryInput input(image, GxEPDImage_HEADER_SIZE + planes * size);
+    GxEPD_Host::check(epd.begin(input) && !strcmp(epd.panel(), display.panelName()), "image for %s", display.panelName());
+    GxEPD_Host::check(epd.draw(), "image for %s drawn", display.panelName());
+    epd.end();
+    GxEPD_Host::check((GxEPD_Host::busDigest() == bus) && (GxEPD_Host::imageDigest() == picture), "image against drawing its planes");
+  }
+  // same size, planes and format as GxGDEW075Z09 for GxGDEW075T8
+  const char* other = strcmp(display.panelName(), "GDEW075Z09") ? "GDEW075Z09" : "GDEW075T8";
+  makeImage(other);
+  GxEPD_Host::resetBusDigest();
+  GxBMP_MemoryInput input(image, GxEPDImage_HEADER_SIZE + planes * size);
+  GxEPD_Host::check(epd.begin(input) && !epd.draw(), "image for %s refused by %s", other, display.panelName());
+  epd.end();
+  GxEPD_Host::check(GxEPD_Host::busDigest() == nothing, "nothing sent for %s", other);
+}
+
+void loop()
+{
+}
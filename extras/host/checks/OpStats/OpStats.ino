@@ -0,0 +1,69 @@
+// OpStats : the cost of display operations, see GxEPD::opStats() and GxEPD::setOpStatsSink()
+//
+// host only: make check, or make SKETCH=checks/OpStats/OpStats.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// the operations must be counted once each, nested ones to the outer, the costs given to the sink must add up
+// to the totals, and the commands and data bytes of the operations must be those received by the panel
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+GxEPD::op_stats sums[GxEPD::op_types];
+
+void sink(GxEPD::op_type op, const GxEPD::op_stats& cost, void*)
+{
+  GxEPD_Host::check(cost.count == 1, "op %u given with count %u", op, cost.count);
+  sums[op].count += cost.count;
+  sums[op].commands += cost.commands;
+  sums[op].data_bytes += cost.data_bytes;
+  sums[op].transactions += cost.transactions;
+  sums[op].busy_waits += cost.busy_waits;
+  sums[op].busy_time += cost.busy_time;
+  sums[op].time += cost.time;
+}
+
+void drawBox()
+{
+  display.fillRect(0, 0, 50, 50, GxEPD_BLACK);
+}
+
+void setup()
+{
+  display.init();
+  display.setOpStatsSink(sink);
+  display.resetOpStats();
+  GxEmulatedPanel::stats before = GxEPD_Host::panel()->getStats();
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(0, 0, display.width() / 2, display.height() / 2, GxEPD_BLACK);
+  display.update();
+  display.fillRect(display.width() / 2, 0, 16, 16, GxEPD_BLACK);
+  display.updateWindow(display.width() / 2, 0, 16, 16); // the first, with its erase
+  display.updateWindow(display.width() / 2, 0, 16, 16);
+  display.drawPaged(drawBox);
+  display.eraseDisplay();
+  display.update();
+  GxEmulatedPanel::stats after = GxEPD_Host::panel()->getStats();
+  const uint32_t counts[GxEPD::op_types] = {2, 2, 1, 1};
+  GxEPD::op_stats totals[GxEPD::op_types];
+  display.getOpStats(totals);
+  uint32_t commands = 0, data_bytes = 0;
+  for (uint8_t op = 0; op < GxEPD::op_types; op++)
+  {
+    GxEPD_Host::check(totals[op].count == counts[op], "op %u counted %u times, %u expected", op, totals[op].count, counts[op]);
+    GxEPD_Host::check(memcmp(&totals[op], &sums[op], sizeof(sums[op])) == 0, "op %u sink costs add up to the total", op);
+    GxEPD_Host::check(totals[op].busy_waits > 0, "op %u busy waits", op);
+    commands += totals[op].commands;
+    data_bytes += totals[op].data_bytes;
+  }
+  GxEPD_Host::check(commands == after.commands - before.commands, "%u commands counted, %u received", commands, after.commands - before.commands);
+  GxEPD_Host::check(data_bytes == after.data_bytes - before.data_bytes, "%u data bytes counted, %u received", data_bytes, after.data_bytes - before.data_bytes);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,95 @@
+// PackedBitmaps : the packed example bitmaps drawn by GxPackedBitmap against the bitmaps in program memory
+//
+// host only: make check, or make SKETCH=checks/PackedBitmaps/PackedBitmaps.ino DISPLAY_CLASS=GxGDEW075Z09
+//
+// full screen bitmaps, example bitmaps and pictures to the controller, and bitmaps to the buffer at an offset and
+// full height in 4 rotations; each mode must give the bus traffic and the panel image of the unpacked bitmap
+
+#include <GxEPD.h>
+#include <GxPackedBitmap.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+#include GxEPD_BitmapExamples
+#include GxEPD_BitmapExamplesPacked
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+GxPackedBitmap packed(display);
+
+enum test {full, example, picture, buffer};
+
+void draw(test t, bool p, int16_t mode, bool offset, uint16_t color)
+{
+  switch (t)
+  {
+    case full:
+      if (p) packed.drawBitmap(BitmapExample1_packed, sizeof(BitmapExample1_packed), mode);
+      else display.drawBitmap(BitmapExample1, sizeof(BitmapExample1), mode);
+      break;
+    case example:
+      if (p) packed.drawExampleBitmap(BitmapExample1_packed, sizeof(BitmapExample1_packed));
+      else display.drawExampleBitmap(BitmapExample1, sizeof(BitmapExample1));
+      break;
+    case picture:
+      if (p) packed.drawPicture(BitmapExample1_packed, BitmapExample1_packed, sizeof(BitmapExample1_packed), sizeof(BitmapExample1_packed), mode);
+      else display.drawPicture(BitmapExample1, BitmapExample1, sizeof(BitmapExample1), sizeof(BitmapExample1), mode);
+      break;
+    case buffer:
+      {
+        uint16_t x = offset ? 13 : 0, y = offset ? 7 : 0, h = offset ? 40 : GxEPD_HEIGHT, w = offset ? 64 : sizeof(BitmapExample1) * 8 / h;
+        display.fillScreen(GxEPD_WHITE);
+        if (p) packed.drawBitmap(BitmapExample1_packed, sizeof(BitmapExample1_packed), x, y, w, h, color, mode);
+        else display.drawBitmap(BitmapExample1, x, y, w, h, color, mode);
+        display.update();
+      }
+      break;
+  }
+}
+
+void check(test t, int16_t mode, uint8_t r = 0, bool offset = false, uint16_t color = GxEPD_BLACK)
+{
+  uint32_t bus[2], image[2];
+  for (uint8_t p = 0; p < 2; p++)
+  {
+    display.init();
+    display.setRotation(r);
+    display.update();
+    GxEPD_Host::resetBusDigest();
+    draw(t, p, mode, offset, color);
+    bus[p] = GxEPD_Host::busDigest();
+    image[p] = GxEPD_Host::imageDigest();
+  }
+  GxEPD_Host::check((bus[0] == bus[1]) && (image[0] == image[1]), "test %u, mode 0x%x, rotation %u, offset %u, color 0x%04x", t, mode, r, offset, color);
+}
+
+void setup()
+{
+  const int16_t full_modes[] = {GxEPD::bm_normal, GxEPD::bm_default, GxEPD::bm_invert, GxEPD::bm_flip_x, GxEPD::bm_flip_y,
+                                GxEPD::bm_invert | GxEPD::bm_flip_x, GxEPD::bm_partial_update
+                               };
+  const int16_t picture_modes[] = {GxEPD::bm_normal, GxEPD::bm_invert, GxEPD::bm_invert_red, GxEPD::bm_partial_update};
+  const int16_t buffer_modes[] = {GxEPD::bm_normal, GxEPD::bm_invert, GxEPD::bm_flip_x, GxEPD::bm_flip_y, GxEPD::bm_r90,
+                                  GxEPD::bm_r180, GxEPD::bm_r270, GxEPD::bm_transparent, GxEPD::bm_invert | GxEPD::bm_transparent
+                                 };
+  for (uint8_t i = 0; i < sizeof(full_modes) / sizeof(full_modes[0]); i++) check(full, full_modes[i]);
+  check(example, GxEPD::bm_default);
+  for (uint8_t i = 0; i < sizeof(picture_modes) / sizeof(picture_modes[0]); i++) check(picture, picture_modes[i]);
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    for (uint8_t i = 0; i < sizeof(buffer_modes) / sizeof(buffer_modes[0]); i++)
+    {
+      for (uint8_t offset = 0; offset < 2; offset++)
+      {
+        check(buffer, buffer_modes[i], r, offset, GxEPD_BLACK);
+        check(buffer, buffer_modes[i], r, offset, GxEPD_RED);
+      }
+    }
+  }
+}
+
+void loop()
+{
+}
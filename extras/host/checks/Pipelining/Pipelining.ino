@@ -0,0 +1,89 @@
+// Pipelining : pipelined paged drawing against paged drawing, see GxEPD::setPipelinedPaging()
+//
+// host only: make check, or make SKETCH=checks/Pipelining/Pipelining.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// drawPaged() in 4 rotations, on a paged frame buffer with GxEPD_HEAP_BUFFER, else on the full one, pipelined with the
+// queue sent by the caller (GxIO_SPI) and by the thread of GxHostThreadSPI; the bus traffic and the panel image must be
+// the same as not pipelined, drawCallback() called for more pages, of half the height; the classes that convert pixels while sending
+// are not pipelined, drawCallback() is called for the same pages
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxHostThreadSPI.h"
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxHostThreadSPI thread_io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxEPD_Class threaded(thread_io /*RST=9*/ /*BUSY=7*/);
+
+#if defined(_GxGDEW075T8_H_) || defined(_GxGDEW0583T7_H_) || defined(_GxGDEW075Z09_H_)
+const bool pipelined_class = false; // IL0371 family
+#else
+const bool pipelined_class = true;
+#endif
+
+uint16_t calls;
+
+void drawScene(GxEPD& d, uint32_t v)
+{
+  calls++;
+  d.setTextColor(GxEPD_BLACK);
+  d.setCursor(5, 5);
+  d.print("value ");
+  d.print(v);
+  d.drawCircle(d.width() / 2, d.height() / 2, d.height() / 3, GxEPD_BLACK);
+  d.fillCircle(d.width() / 3, d.height() / 3, 15, GxEPD_RED);
+  d.drawLine(0, 0, d.width() - 1, d.height() - 1, GxEPD_BLACK);
+  d.fillRect(d.width() - 40, d.height() - 30, 30, 20, GxEPD_BLACK);
+  d.drawPixel(3, d.height() - 3, GxEPD_BLACK);
+}
+
+void drawDisplay(uint32_t v)
+{
+  drawScene(display, v);
+}
+
+void drawThreaded(uint32_t v)
+{
+  drawScene(threaded, v);
+}
+
+void run(GxEPD_Class& d, uint8_t r, bool pipelined, uint32_t& bus, uint32_t& image)
+{
+#if GxEPD_HEAP_BUFFER
+  d.setFrameBufferBudget(uint32_t(GxEPD_WIDTH) * GxEPD_HEIGHT / 8 / 5);
+#endif
+  d.init();
+  d.setRotation(r);
+  d.setPipelinedPaging(pipelined);
+  GxEPD_Host::resetBusDigest();
+  calls = 0;
+  d.drawPaged((&d == &display) ? drawDisplay : drawThreaded, 42 + r);
+  bus = GxEPD_Host::busDigest();
+  image = GxEPD_Host::imageDigest();
+}
+
+void setup()
+{
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    uint32_t bus, image;
+    run(display, r, false, bus, image);
+    uint16_t sequential_calls = calls;
+    GxEPD_Class* displays[] = {&display, &threaded};
+    for (uint8_t i = 0; i < 2; i++)
+    {
+      uint32_t pipelined_bus, pipelined_image;
+      run(*displays[i], r, true, pipelined_bus, pipelined_image);
+      GxEPD_Host::check((pipelined_bus == bus) && (pipelined_image == image), "rotation %u, %s, pipelined", r, i ? "thread" : "caller");
+      bool pages = pipelined_class ? (calls > sequential_calls) : (calls == sequential_calls); // half pages, the last shorter
+      GxEPD_Host::check(pages, "rotation %u, %s, %u calls pipelined, %u not", r, i ? "thread" : "caller", calls, sequential_calls);
+    }
+  }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,89 @@
+// Trace : a trace recorded by GxIO_Recorder and GxIO_File, replayed by GxIO_File::replay()
+//
+// host only: make check, or make SKETCH=checks/Trace/Trace.ino DISPLAY_CLASS=GxGDEW042T2
+//
+// the drawing is recorded to memory while sent to the panel, the panel is drawn over, then the trace is replayed;
+// the panel must get the same commands and data again and show the recorded image; one update(), as a wake up
+// from deep sleep by the reset pulse of the display class is not in the trace
+
+#include <GxEPD.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO_File/GxIO_File.h>
+#include <GxIO/GxIO_Recorder/GxIO_Recorder.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+// a trace in memory, writes are ignored after close()
+class MemoryStream : public Stream
+{
+  public:
+    MemoryStream() : _size(0), _position(0), _closed(false) {};
+    int available() {return _size - _position;};
+    int read() {return (_position < _size) ? _buffer[_position++] : -1;};
+    int peek() {return (_position < _size) ? _buffer[_position] : -1;};
+    size_t write(uint8_t b)
+    {
+      if (_closed || (_size == sizeof(_buffer))) return 0;
+      _buffer[_size++] = b;
+      return 1;
+    };
+    using Print::write;
+    void close() {_closed = true;};
+    uint32_t size() {return _size;};
+  private:
+    uint8_t _buffer[1 << 20];
+    uint32_t _size, _position;
+    bool _closed;
+};
+
+GxIO_Class spi_io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+MemoryStream trace;
+GxIO_File trace_io(trace);
+GxIO_Recorder io(spi_io, trace_io);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+void drawScene(uint8_t n)
+{
+  display.fillScreen(GxEPD_WHITE);
+  for (int16_t i = 0; i < 12; i++)
+  {
+    display.fillRect((i * 37 + n * 11) % display.width(), (i * 23) % display.height(), 30, 20, (i % 3) ? GxEPD_BLACK : GxEPD_RED);
+  }
+  display.drawLine(0, 0, display.width() - 1, display.height() - 1, GxEPD_BLACK);
+  display.setTextColor(GxEPD_BLACK);
+  display.setCursor(10, 10);
+  display.print("trace ");
+  display.print(n);
+}
+
+void setup()
+{
+  display.init();
+  drawScene(1);
+  display.update();
+  trace_io.flush();
+  trace.close();
+  GxEmulatedPanel::stats recorded = GxEPD_Host::panel()->getStats();
+  uint32_t image = GxEPD_Host::imageDigest();
+  // other content, then the trace from a reset panel
+  drawScene(2);
+  display.update();
+  GxEPD_Host::check(GxEPD_Host::imageDigest() != image, "drawn over");
+  GxEmulatedPanel::stats before = GxEPD_Host::panel()->getStats();
+  spi_io.reset();
+  // the full refresh of the 3-color panels takes longer than GxIO_File_BUSY_TIMEOUT
+  GxEPD_Host::check(GxIO_File::replay(trace, spi_io, 7, GxEPD_Host::panel()->busyLevel(), 60000), "replay of %u bytes", trace.size());
+  GxEmulatedPanel::stats replayed = GxEPD_Host::panel()->getStats();
+  GxEPD_Host::check(replayed.commands - before.commands == recorded.commands, "%u commands replayed, %u recorded",
+                    replayed.commands - before.commands, recorded.commands);
+  GxEPD_Host::check(replayed.data_bytes - before.data_bytes == recorded.data_bytes, "%u data bytes replayed, %u recorded",
+                    replayed.data_bytes - before.data_bytes, recorded.data_bytes);
+  GxEPD_Host::check(replayed.busy_violations + replayed.sleep_violations == before.busy_violations + before.sleep_violations,
+                    "%u busy and %u sleep violations", replayed.busy_violations - before.busy_violations,
+                    replayed.sleep_violations - before.sleep_violations);
+  GxEPD_Host::check(GxEPD_Host::imageDigest() == image, "image replayed");
+}
+
+void loop()
+{
+}
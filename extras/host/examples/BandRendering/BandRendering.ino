@@ -0,0 +1,77 @@
+// BandRendering : a dashboard drawn to the full frame buffer directly and by band rendering on host threads
+//
+// host only: make SKETCH=examples/BandRendering/BandRendering.ino
+//
+// the drawing is recorded to the display list once, then rasterised into the bands concurrently;
+// pays for filled areas, the recording of single pixels costs about as much as drawing them
+
+#include <GxEPD.h>
+#include <GxGDEW075Z09/GxGDEW075Z09.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+uint8_t display_list[16384];
+
+void drawDashboard()
+{
+  display.fillScreen(GxEPD_WHITE);
+  for (int16_t i = 0; i < 6; i++)
+  {
+    int16_t x = 10 + (i % 3) * 210, y = 10 + (i / 3) * 190;
+    display.fillRoundRect(x, y, 200, 180, 12, (i == 4) ? GxEPD_RED : GxEPD_BLACK);
+    display.fillRoundRect(x + 4, y + 4, 192, 172, 10, GxEPD_WHITE);
+    display.fillRect(x + 10, y + 10, 180, 24, GxEPD_BLACK);
+    display.setTextColor(GxEPD_WHITE);
+    display.setCursor(x + 16, y + 16);
+    display.print("sensor ");
+    display.print(i);
+    for (int16_t b = 0; b < 12; b++)
+    {
+      int16_t h = 10 + (b * 37 + i * 11) % 110;
+      display.fillRect(x + 12 + b * 15, y + 166 - h, 11, h, (b & 3) ? GxEPD_BLACK : GxEPD_RED);
+    }
+  }
+}
+
+uint32_t run(const char* what)
+{
+  uint32_t start = micros();
+  for (uint8_t n = 0; n < 10; n++)
+  {
+    if (what) display.drawBands(drawDashboard);
+    else drawDashboard();
+  }
+  uint32_t elapsed = (micros() - start) / 10;
+  Serial.print(what ? what : "direct");
+  Serial.print(" : ");
+  Serial.print(elapsed);
+  Serial.println(" us");
+  return elapsed;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("BandRendering");
+  display.init();
+  display.setDisplayList(display_list, sizeof(display_list));
+  run(0);
+  display.setBandRendering(0, 1);
+  run("1 band");
+  display.setBandRendering(GxEPD_Host::runBandThreads, 2);
+  run("2 bands");
+  display.setBandRendering(GxEPD_Host::runBandThreads, 4);
+  run("4 bands");
+  Serial.print(display.displayListUsed());
+  Serial.println(" bytes display list");
+  display.update();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,94 @@
+// Dithering : an RGB image drawn by drawPixel() with a threshold, and by GxDither with threshold, ordered and error diffusion
+//
+// host only: make SKETCH=examples/Dithering/Dithering.ino
+//
+// the image is generated row by row, as a decoder would deliver it; the panel image shows the four side by side
+
+#include <GxEPD.h>
+#include <GxDither.h>
+#include <GxGDEW075Z09/GxGDEW075Z09.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxDither dither(display);
+
+#define IMAGE_WIDTH 160
+#define IMAGE_HEIGHT 384
+
+uint8_t row[3 * IMAGE_WIDTH];
+
+// a gray ramp left, a red ramp right, a dark to light gradient top down
+void makeRow(uint16_t j)
+{
+  for (uint16_t i = 0; i < IMAGE_WIDTH; i++)
+  {
+    uint8_t v = uint32_t(j) * 255 / (IMAGE_HEIGHT - 1);
+    uint8_t s = (i < IMAGE_WIDTH / 2) ? 0 : uint32_t(i - IMAGE_WIDTH / 2) * 255 / (IMAGE_WIDTH / 2 - 1);
+    row[3 * i] = v + uint32_t(255 - v) * s / 255;
+    row[3 * i + 1] = uint32_t(v) * (255 - s) / 255;
+    row[3 * i + 2] = uint32_t(v) * (255 - s) / 255;
+  }
+}
+
+void drawThresholdPixels(int16_t x)
+{
+  for (uint16_t j = 0; j < IMAGE_HEIGHT; j++)
+  {
+    makeRow(j);
+    for (uint16_t i = 0; i < IMAGE_WIDTH; i++)
+    {
+      uint8_t r = row[3 * i], g = row[3 * i + 1], b = row[3 * i + 2];
+      uint16_t color = GxEPD_BLACK;
+      if ((r > 0x80) && (g > 0x80) && (b > 0x80)) color = GxEPD_WHITE;
+      else if (r > 0xF0) color = GxEPD_RED;
+      display.drawPixel(x + i, j, color);
+    }
+  }
+}
+
+void drawDithered(int16_t x, GxDither::method m)
+{
+  dither.begin(x, 0, IMAGE_WIDTH, IMAGE_HEIGHT, GxDither::bwr, m);
+  for (uint16_t j = 0; j < IMAGE_HEIGHT; j++)
+  {
+    makeRow(j);
+    dither.writeRow(row, GxDither::rgb888);
+  }
+  dither.end();
+}
+
+void report(const char* what, uint32_t start)
+{
+  Serial.print(what);
+  Serial.print(" : ");
+  Serial.print(micros() - start);
+  Serial.println(" us");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("Dithering");
+  display.init();
+  display.fillScreen(GxEPD_WHITE);
+  uint32_t start = micros();
+  drawThresholdPixels(0);
+  report("drawPixel threshold", start);
+  start = micros();
+  drawDithered(IMAGE_WIDTH, GxDither::threshold);
+  report("GxDither threshold ", start);
+  start = micros();
+  drawDithered(2 * IMAGE_WIDTH, GxDither::ordered);
+  report("GxDither ordered   ", start);
+  start = micros();
+  drawDithered(3 * IMAGE_WIDTH, GxDither::error_diffusion);
+  report("GxDither error diff", start);
+  display.update();
+}
+
+void loop()
+{
+}
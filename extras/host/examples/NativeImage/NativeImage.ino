@@ -0,0 +1,79 @@
+// NativeImage : a BMP file drawn to the frame buffer by GxBMP and sent by update(), and the same image converted to a
+//               native image (.epd) sent from the file to the controller by GxEPDImage
+//
+// host only: make SKETCH=examples/NativeImage/NativeImage.ino
+//
+// files from IMAGE_BMP and IMAGE_EPD of the environment, default image.bmp and image.epd, a missing file is skipped;
+// convert with the method used here for the same panel image: ../tools/epdconv -p GDEW042Z15 -m threshold image.bmp image.epd
+
+#include <GxEPD.h>
+#include <GxBMP.h>
+#include <GxEPDImage.h>
+#include <GxGDEW042Z15/GxGDEW042Z15.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+#include <time.h>
+
+// GxDither::bw for the b/w classes
+#ifndef PALETTE
+#define PALETTE GxDither::bwr
+#endif
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxBMP bmp(display);
+GxEPDImage epd(display);
+
+const char* path(const char* name, const char* fallback)
+{
+  const char* p = getenv(name);
+  return p ? p : fallback;
+}
+
+void report(const char* what, clock_t cpu, uint64_t time, uint64_t bytes)
+{
+  Serial.print(what);
+  Serial.print(" : cpu ");
+  Serial.print(uint32_t((clock() - cpu) * 1000000 / CLOCKS_PER_SEC));
+  Serial.print(" us, time ");
+  Serial.print(uint32_t((GxEPD_Host::now() - time) / 1000));
+  Serial.print(" ms, SPI ");
+  Serial.print(uint32_t(GxEPD_Host::spiBytes() - bytes));
+  Serial.println(" bytes");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("NativeImage");
+  display.init();
+  GxHostFile file;
+  if (file.open(path("IMAGE_BMP", "image.bmp"), "rb"))
+  {
+    GxBMP_FileInput<GxHostFile> input(file);
+    clock_t cpu = clock();
+    uint64_t time = GxEPD_Host::now(), bytes = GxEPD_Host::spiBytes();
+    display.fillScreen(GxEPD_WHITE);
+    if (bmp.begin(input) && bmp.draw(0, 0, PALETTE, GxDither::threshold)) display.update();
+    else Serial.println("BMP not drawn");
+    bmp.end();
+    report("BMP, GxBMP and update()", cpu, time, bytes);
+    file.close();
+  }
+  if (file.open(path("IMAGE_EPD", "image.epd"), "rb"))
+  {
+    GxBMP_FileInput<GxHostFile> input(file);
+    clock_t cpu = clock();
+    uint64_t time = GxEPD_Host::now(), bytes = GxEPD_Host::spiBytes();
+    if (!epd.begin(input) || !epd.draw()) Serial.println(".epd not drawn");
+    epd.end();
+    report(".epd, GxEPDImage      ", cpu, time, bytes);
+    file.close();
+  }
+}
+
+void loop()
+{
+}
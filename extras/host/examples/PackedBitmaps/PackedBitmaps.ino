@@ -0,0 +1,130 @@
+// PackedBitmaps : the example bitmaps of GxGDEW075Z09 drawn from program memory and packed by GxPackedBitmap,
+//                 to the controller and to the buffer, with the unpacking throughput of the packed bitmaps
+//
+// host only: make SKETCH=examples/PackedBitmaps/PackedBitmaps.ino
+//
+// the packed bitmaps are made by extras/tools/gxpack, see BitmapExamples_packed.h of the display class
+
+#include <GxEPD.h>
+#include <GxPackedBitmap.h>
+#include <GxGDEW075Z09/GxGDEW075Z09.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO.h>
+#include "GxEPD_Host.h"
+#include <time.h>
+
+#include GxEPD_BitmapExamples
+#include GxEPD_BitmapExamplesPacked
+
+GxIO_Class io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+GxPackedBitmap packed(display);
+
+const uint8_t repeat = 20;
+volatile uint8_t sink; // keeps the reads
+
+uint32_t cpu(clock_t start)
+{
+  return uint32_t((clock() - start) * 1000000 / CLOCKS_PER_SEC);
+}
+
+void report(const char* what, clock_t start, uint64_t time, uint64_t bytes)
+{
+  Serial.print(what);
+  Serial.print(" : cpu ");
+  Serial.print(cpu(start));
+  Serial.print(" us, time ");
+  Serial.print(uint32_t((GxEPD_Host::now() - time) / 1000));
+  Serial.print(" ms, SPI ");
+  Serial.print(uint32_t(GxEPD_Host::spiBytes() - bytes));
+  Serial.println(" bytes");
+}
+
+// bitmap bytes per second read in chunks as sent, from program memory and unpacked
+void throughput(const char* name, const uint8_t* bitmap, uint32_t size, const uint8_t* packed_bitmap, uint32_t packed_size)
+{
+  uint8_t chunk[GxEPD_READER_CHUNK];
+  clock_t start = clock();
+  for (uint8_t n = 0; n < repeat; n++)
+  {
+    for (uint32_t idx = 0; idx < size; idx += sizeof(chunk))
+    {
+      uint16_t k = (size - idx < sizeof(chunk)) ? size - idx : sizeof(chunk);
+      memcpy_P(chunk, bitmap + idx, k);
+      sink = chunk[0];
+    }
+  }
+  uint32_t raw_us = cpu(start);
+  packed.attach(packed_bitmap, packed_size);
+  start = clock();
+  for (uint8_t n = 0; n < repeat; n++)
+  {
+    for (uint32_t idx = 0; idx < size; idx += sizeof(chunk))
+    {
+      uint16_t k = (size - idx < sizeof(chunk)) ? size - idx : sizeof(chunk);
+      packed.read(0, idx, chunk, k);
+      sink = chunk[0];
+    }
+  }
+  uint32_t packed_us = cpu(start);
+  packed.detach();
+  Serial.print(name);
+  Serial.print(" : ");
+  Serial.print(size);
+  Serial.print(" bytes, packed ");
+  Serial.print(packed_size);
+  Serial.print(", raw ");
+  Serial.print(uint32_t(uint64_t(size) * repeat / (raw_us ? raw_us : 1)));
+  Serial.print(" MB/s, unpacked ");
+  Serial.print(uint32_t(uint64_t(size) * repeat / (packed_us ? packed_us : 1)));
+  Serial.println(" MB/s");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("PackedBitmaps");
+  display.init();
+
+  throughput("BitmapExample1  ", BitmapExample1, sizeof(BitmapExample1), BitmapExample1_packed, sizeof(BitmapExample1_packed));
+  throughput("BitmapExample2  ", BitmapExample2, sizeof(BitmapExample2), BitmapExample2_packed, sizeof(BitmapExample2_packed));
+  throughput("BitmapPicture_3C", BitmapPicture_3C, sizeof(BitmapPicture_3C), BitmapPicture_3C_packed, sizeof(BitmapPicture_3C_packed));
+
+  // to the controller
+  clock_t start = clock();
+  uint64_t time = GxEPD_Host::now(), bytes = GxEPD_Host::spiBytes();
+  display.drawExampleBitmap(BitmapExample1, sizeof(BitmapExample1));
+  report("drawExampleBitmap, raw           ", start, time, bytes);
+  start = clock();
+  time = GxEPD_Host::now(), bytes = GxEPD_Host::spiBytes();
+  packed.drawExampleBitmap(BitmapExample1_packed, sizeof(BitmapExample1_packed));
+  report("drawExampleBitmap, packed        ", start, time, bytes);
+  start = clock();
+  time = GxEPD_Host::now(), bytes = GxEPD_Host::spiBytes();
+  display.drawExamplePicture_3C(BitmapPicture_3C, sizeof(BitmapPicture_3C));
+  report("drawExamplePicture_3C, raw       ", start, time, bytes);
+  start = clock();
+  time = GxEPD_Host::now(), bytes = GxEPD_Host::spiBytes();
+  packed.attach(BitmapPicture_3C_packed, sizeof(BitmapPicture_3C_packed));
+  display.drawExamplePicture_3C(packed.bitmap(0), packed.size(0));
+  packed.detach();
+  report("drawExamplePicture_3C, packed    ", start, time, bytes);
+
+  // to the buffer, no update
+  start = clock();
+  for (uint8_t n = 0; n < repeat; n++) display.drawExampleBitmap(BitmapExample2, 0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, GxEPD_BLACK);
+  Serial.print("drawExampleBitmap to buffer, raw    : cpu ");
+  Serial.print(cpu(start) / repeat);
+  Serial.println(" us");
+  start = clock();
+  for (uint8_t n = 0; n < repeat; n++) packed.drawExampleBitmap(BitmapExample2_packed, sizeof(BitmapExample2_packed), 0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, GxEPD_BLACK);
+  Serial.print("drawExampleBitmap to buffer, packed : cpu ");
+  Serial.print(cpu(start) / repeat);
+  Serial.println(" us");
+  display.update();
+}
+
+void loop()
+{
+}
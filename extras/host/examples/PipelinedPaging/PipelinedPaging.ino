@@ -0,0 +1,69 @@
+// PipelinedPaging : paged drawing with and without pipelining, on the host with the queue sent by a thread
+//
+// host only, build with the frame buffer on the heap for a small budget, see README.md:
+// make SKETCH=examples/PipelinedPaging/PipelinedPaging.ino
+//
+// the bus time is spent in real time by the thread of GxHostThreadSPI, while the sketch draws the next page
+// drawScene() is called for each page; pipelining pays if drawing twice the pages costs less than their transfer
+
+#include <GxEPD.h>
+#include <GxGDEW042T2/GxGDEW042T2.h>
+#include "GxHostThreadSPI.h"
+#include "GxEPD_Host.h"
+
+#if !GxEPD_HEAP_BUFFER
+#error "needs GxEPD_HEAP_BUFFER, the default off AVR"
+#endif
+
+// rows of the frame buffer, 8 pages of 38 rows, 16 of 19 if pipelined
+#define BUDGET_ROWS 38
+
+GxHostThreadSPI io(SPI, /*CS=*/ SS, /*DC=*/ 8, /*RST=*/ 9);
+GxEPD_Class display(io /*RST=9*/ /*BUSY=7*/);
+
+void drawScene()
+{
+  randomSeed(1);
+  for (uint16_t i = 0; i < 360; i++)
+  {
+    int16_t x = random(display.width()), y = random(display.height());
+    display.fillCircle(x, y, 2 + random(30), (i & 1) ? GxEPD_WHITE : GxEPD_BLACK);
+    display.fillRect(random(display.width()), random(display.height()), 10 + random(60), 2 + random(8), GxEPD_BLACK);
+  }
+}
+
+uint32_t run(bool pipelined)
+{
+  display.setPipelinedPaging(pipelined);
+  uint32_t busy_time = display.busyWaitStats().busy_time;
+  uint32_t start = micros();
+  display.drawPaged(drawScene);
+  uint32_t elapsed = micros() - start - (display.busyWaitStats().busy_time - busy_time);
+  Serial.print(pipelined ? "pipelined " : "sequential");
+  Serial.print(" : ");
+  Serial.print(elapsed);
+  Serial.println(" us without BUSY waits");
+  return elapsed;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("PipelinedPaging");
+  display.setFrameBufferBudget(uint32_t(GxGDEW042T2_WIDTH / 8) * BUDGET_ROWS);
+  display.init();
+  Serial.print(display.pages());
+  Serial.println(" pages, twice as many pipelined");
+  GxEPD_Host::setSpiRealTime(true);
+  uint32_t sequential = run(false);
+  uint32_t pipelined = run(true);
+  GxEPD_Host::setSpiRealTime(false);
+  Serial.print("saved ");
+  Serial.print(int32_t(sequential - pipelined));
+  Serial.println(" us");
+}
+
+void loop()
+{
+}
@@ -0,0 +1,127 @@
+// main.cpp : runs a GxEPD example sketch on the host against the emulated controller of its display class
+//
+// the sketch, with the prototypes generated by prototypes.awk, is included as GxEPD_HOST_SKETCH, see Makefile;
+// main() exits with 1 if a check failed, see GxEPD_Host::check(); options from the environment:
+//
+// GXEPD_HOST_LOOPS : number of calls to loop(), default 1
+// GXEPD_HOST_IMAGE : file to save the final panel image to, as PPM
+// GXEPD_HOST_TIMING : power on, power off, full and partial refresh in ms, e.g. "100,50,4000,1600"
+// GXEPD_HOST_SPI_HZ : SPI clock for the bus time, overrides the clock set by the sketch
+// GXEPD_HOST_TRACE : file to record the bus traffic of the panel to, as GxIO_File trace
+// GXEPD_HOST_REPLAY : GxIO_File trace to send to the panel instead of running the sketch
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include <Arduino.h>
+
+#include GxEPD_HOST_SKETCH
+
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO_File/GxIO_File.h>
+#include "GxEPD_Host.h"
+#include "GxEmulatedPanel.h"
+
+// the pins of the #else branch of the examples, as used by the AVR boards
+#ifndef GxEPD_HOST_CS
+#define GxEPD_HOST_CS SS
+#endif
+#ifndef GxEPD_HOST_DC
+#define GxEPD_HOST_DC 8
+#endif
+#ifndef GxEPD_HOST_RST
+#define GxEPD_HOST_RST 9
+#endif
+#ifndef GxEPD_HOST_BUSY
+#define GxEPD_HOST_BUSY 7
+#endif
+
+#if defined(_GxGDEW042T2_H_)
+GxEmulator_IL0398 panel(GxGDEW042T2_WIDTH, GxGDEW042T2_HEIGHT, false);
+#elif defined(_GxGDEW042Z15_H_)
+GxEmulator_IL0398 panel(GxGDEW042Z15_WIDTH, GxGDEW042Z15_HEIGHT, true);
+#elif defined(_GxGDEW0213I5F_H_)
+GxEmulator_IL0373 panel(GxGDEW0213I5F_WIDTH, GxGDEW0213I5F_HEIGHT, false);
+#elif defined(_GxGDEW0213Z16_H_)
+GxEmulator_IL0373 panel(GxGDEW0213Z16_WIDTH, GxGDEW0213Z16_HEIGHT, true);
+#elif defined(_GxGDEW029Z10_H_)
+GxEmulator_IL0373 panel(GxGDEW029Z10_WIDTH, GxGDEW029Z10_HEIGHT, true);
+#elif defined(_GxGDEW0154Z17_H_)
+GxEmulator_IL0373 panel(GxGDEW0154Z17_WIDTH, GxGDEW0154Z17_HEIGHT, true);
+#elif defined(_GxGDEW075T8_H_)
+GxEmulator_IL0371 panel(GxGDEW075T8_WIDTH, GxGDEW075T8_HEIGHT, false);
+#elif defined(_GxGDEW0583T7_H_)
+GxEmulator_IL0371 panel(GxGDEW0583T7_WIDTH, GxGDEW0583T7_HEIGHT, false);
+#elif defined(_GxGDEW075Z09_H_)
+GxEmulator_IL0371 panel(GxGDEW075Z09_WIDTH, GxGDEW075Z09_HEIGHT, true);
+#elif defined(_GxGDEH029A1_H_)
+GxEmulator_SSD1608 panel(GxGDEH029A1_WIDTH, GxGDEH029A1_HEIGHT);
+#elif defined(_GxGDEP015OC1_H_)
+GxEmulator_SSD1608 panel(GxGDEP015OC1_WIDTH, GxGDEP015OC1_HEIGHT);
+#elif defined(_GxGDE0213B1_H_)
+GxEmulator_SSD1608 panel(GxGDE0213B1_WIDTH, GxGDE0213B1_HEIGHT);
+#else
+#error "no emulated controller for the display class selected by this sketch"
+#endif
+
+int main(int argc, char* argv[])
+{
+  const char* loops = getenv("GXEPD_HOST_LOOPS");
+  const char* image = getenv("GXEPD_HOST_IMAGE");
+  const char* timing = getenv("GXEPD_HOST_TIMING");
+  const char* trace = getenv("GXEPD_HOST_TRACE");
+  const char* replay = getenv("GXEPD_HOST_REPLAY");
+  if (timing && *timing)
+  {
+    GxEmulatedPanel::timing t = panel.getTiming();
+    sscanf(timing, "%u,%u,%u,%u", &t.power_on_ms, &t.power_off_ms, &t.full_refresh_ms, &t.partial_refresh_ms);
+    panel.setTiming(t);
+  }
+  GxEPD_Host::attach(panel, GxEPD_HOST_CS, GxEPD_HOST_DC, GxEPD_HOST_RST, GxEPD_HOST_BUSY);
+  GxHostFile trace_file;
+  GxIO_File trace_io(trace_file);
+  if (trace && *trace)
+  {
+    if (!trace_file.open(trace, "wb"))
+    {
+      fprintf(stderr, "can't write %s\n", trace);
+      return 1;
+    }
+    trace_io.init();
+    GxEPD_Host::trace(&trace_io);
+  }
+  if (replay && *replay)
+  {
+    GxHostFile replay_file;
+    if (!replay_file.open(replay, "rb"))
+    {
+      fprintf(stderr, "can't read %s\n", replay);
+      return 1;
+    }
+    GxIO_SPI replay_io(SPI, GxEPD_HOST_CS, GxEPD_HOST_DC, GxEPD_HOST_RST);
+    replay_io.init();
+    if (!GxIO_File::replay(replay_file, replay_io, GxEPD_HOST_BUSY, panel.busyLevel())) fprintf(stderr, "invalid trace %s\n", replay);
+  }
+  else
+  {
+    setup();
+    for (long n = (loops && *loops) ? atol(loops) : 1; n > 0; n--) loop();
+  }
+  GxEPD_Host::trace(0);
+  trace_io.flush();
+  trace_file.close();
+  Serial.flush();
+  fprintf(stderr, "virtual time %lu ms, SPI %llu bytes in %llu ms\n", millis(),
+          (unsigned long long)GxEPD_Host::spiBytes(), (unsigned long long)(GxEPD_Host::spiBusTime() / 1000));
+  panel.report(stderr);
+  if (image && *image && !panel.savePPM(image))
+  {
+    fprintf(stderr, "can't write %s\n", image);
+    return 1;
+  }
+  if (GxEPD_Host::failures()) fprintf(stderr, "%u checks failed\n", GxEPD_Host::failures());
+  return GxEPD_Host::failures() ? 1 : 0;
+}
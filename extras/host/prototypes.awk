@@ -0,0 +1,115 @@
+# prototypes.awk : Arduino prototype generation for the host build, see Makefile
+#
+# awk -v sketch=path/Sketch.ino -f prototypes.awk path/Sketch.ino > Sketch.ino.cpp
+#
+# copies the sketch with a prototype for each function defined at file level, inserted before the first function,
+# or before the outermost #if around it, as the Arduino IDE does; #line keeps the messages on the lines of the sketch
+# a prototype is the head of the definition up to its parameter list, without default arguments
+#
+# Version : see library.properties
+#
+# License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+#
+# Library: https://github.com/ZinggJM/GxEPD
+
+# the line without comments, string and character literals; in_comment carries /* */ across lines
+function code(s,    out, c, n, i, q)
+{
+  out = ""
+  n = length(s)
+  for (i = 1; i <= n; i++)
+  {
+    c = substr(s, i, 1)
+    if (in_comment)
+    {
+      if ((c == "*") && (substr(s, i + 1, 1) == "/")) {in_comment = 0; i++}
+      continue
+    }
+    if ((c == "/") && (substr(s, i + 1, 1) == "/")) break
+    if ((c == "/") && (substr(s, i + 1, 1) == "*")) {in_comment = 1; i++; continue}
+    if ((c == "\"") || (c == "'"))
+    {
+      q = c
+      for (i++; (i <= n) && (substr(s, i, 1) != q); i++) if (substr(s, i, 1) == "\\") i++
+      out = out " "
+      continue
+    }
+    out = out c
+  }
+  return out
+}
+
+function count(s, c)
+{
+  return gsub("\\" c, "", s)
+}
+
+function trim(s)
+{
+  gsub(/^[ \t]+|[ \t]+$/, "", s)
+  return s
+}
+
+{
+  line[NR] = $0
+  continued[NR] = in_comment
+  stripped[NR] = code($0)
+}
+
+END {
+  depth = 0
+  pp = 0
+  first = 0
+  n = 0
+  for (i = 1; i <= NR; i++)
+  {
+    c = stripped[i]
+    if (!continued[i] && (c ~ /^[ \t]*#/))
+    {
+      if (c ~ /^[ \t]*#[ \t]*if/) {if (pp++ == 0) pp_start = i}
+      else if (c ~ /^[ \t]*#[ \t]*endif/) pp--
+      continue
+    }
+    if ((depth == 0) && !continued[i] && (c ~ /^[A-Za-z_]/) && (c !~ /^(typedef|struct|class|enum|union|using|namespace|template|extern)[^A-Za-z0-9_]/))
+    {
+      # the head up to the balanced parameter list, over a few lines
+      head = c
+      for (j = i; (j < NR) && (j - i < 8) && !index(head, ";") && !index(head, "{") && (!index(head, "(") || (count(head, "(") > count(head, ")"))); )
+      {
+        head = head " " stripped[++j]
+      }
+      p = index(head, "(")
+      if ((p > 0) && (substr(head, 1, p) !~ /=/))
+      {
+        # the end of the parameter list
+        k = 0
+        for (m = p; m <= length(head); m++)
+        {
+          ch = substr(head, m, 1)
+          if (ch == "(") k++
+          else if ((ch == ")") && (--k == 0)) break
+        }
+        tail = trim(substr(head, m + 1))
+        if ((k == 0) && (tail == ""))
+        {
+          for (e = j + 1; (e <= NR) && (tail == ""); e++) tail = trim(stripped[e])
+        }
+        if ((k == 0) && (substr(tail, 1, 1) == "{"))
+        {
+          proto = substr(head, 1, m)
+          gsub(/[ \t]*=[^,()]*/, "", proto)
+          gsub(/[ \t]+/, " ", proto)
+          prototype[++n] = trim(proto) ";"
+          if (!first) first = (pp > 0) ? pp_start : i
+        }
+      }
+    }
+    depth += count(c, "{") - count(c, "}")
+  }
+  if (!first) first = NR + 1
+  printf "#line 1 \"%s\"\n", sketch
+  for (i = 1; i < first; i++) print line[i]
+  for (i = 1; i <= n; i++) print prototype[i]
+  if (first <= NR) printf "#line %d \"%s\"\n", first, sketch
+  for (i = first; i <= NR; i++) print line[i]
+}
@@ -0,0 +1,414 @@
+// epdconv : converts BMP, PNG or PPM images to native GxEPD images (.epd) for a panel, see GxEPDImage.h
+//
+// epdconv [-p panel] [-r rotation] [-m threshold|ordered|diffusion] [-u] image.bmp|.png|.ppm image.epd
+// epdconv -l : lists the panels
+//
+// the image is placed at the top left of the screen with the rotation, cropped, on white; colors are mapped to black and
+// white, or black, white and red, as GxDither does; the planes are packed with PackBits unless -u
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include "GxPackBits.h"
+#if defined(GxEPD_PNG)
+#include <png.h>
+#endif
+
+// header of GxEPDImage.h
+#define GxEPDImage_HEADER_SIZE 48
+#define GxEPDImage_VERSION 1
+#define GxEPDImage_PACKBITS 0x01
+
+// format of the data sent by drawBitmap(bitmap, size) or drawPicture() of the display classes
+enum panel_format
+{
+  mono, // 1 bit per pixel, 1 is white
+  bwr, // black and red planes of 1 bit per pixel, 1 is white (no red)
+  bwr_set, // same, 1 is black or red
+  bwr_grey, // black of 2 bit per pixel, 11 is white, red of 1 bit per pixel, 1 is no red
+  il0371 // 4 bit per pixel, 0x0 black, 0x3 white, 0x4 red, leftmost pixel in the high nibble
+};
+
+struct panel
+{
+  const char* name;
+  uint16_t width; // bits of a controller row
+  uint16_t visible_width;
+  uint16_t height;
+  panel_format format;
+  bool red;
+  bool flip_y; // rows sent bottom up
+};
+
+static const panel panels[] =
+{
+  {"GDEP015OC1", 200, 200, 200, mono, false, false},
+  {"GDE0213B1", 128, 122, 250, mono, false, true},
+  {"GDEH029A1", 128, 128, 296, mono, false, false},
+  {"GDEW0154Z04", 200, 200, 200, bwr_grey, true, false},
+  {"GDEW0154Z17", 152, 152, 152, bwr, true, false},
+  {"GDEW0213I5F", 104, 104, 212, mono, false, false},
+  {"GDEW0213Z16", 104, 104, 212, bwr, true, false},
+  {"GDEW027C44", 176, 176, 264, bwr_set, true, false},
+  {"GDEW027W3", 176, 176, 264, mono, false, false},
+  {"GDEW029Z10", 128, 128, 296, bwr, true, false},
+  {"GDEW042T2", 400, 400, 300, mono, false, false},
+  {"GDEW042Z15", 400, 400, 300, bwr, true, false},
+  {"GDEW0583T7", 600, 600, 448, il0371, false, false},
+  {"GDEW075T8", 640, 640, 384, il0371, false, false},
+  {"GDEW075Z09", 640, 640, 384, il0371, true, false},
+};
+
+struct image
+{
+  int w, h;
+  std::vector<uint8_t> rgb; // RGB888, rows top down
+};
+
+static uint16_t le16(const uint8_t* p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t le32(const uint8_t* p)
+{
+  return le16(p) | (uint32_t(le16(p + 2)) << 16);
+}
+
+static bool loadBMP(const char* path, image& img)
+{
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  std::vector<uint8_t> data;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+  fclose(f);
+  if ((data.size() < 54) || (data[0] != 'B') || (data[1] != 'M')) return false;
+  uint32_t offset = le32(&data[10]);
+  uint32_t header_size = le32(&data[14]);
+  int32_t w = int32_t(le32(&data[18])), h = int32_t(le32(&data[22]));
+  uint16_t depth = le16(&data[28]);
+  uint32_t format = le32(&data[30]);
+  uint32_t colors = le32(&data[46]);
+  bool bottom_up = h > 0;
+  if (h < 0) h = -h;
+  bool rgb555 = (depth == 16);
+  if ((depth == 16) && (format == 3)) rgb555 = (le32(&data[54]) == 0x7C00);
+  else if (format != 0) return false;
+  if ((w <= 0) || ((depth != 1) && (depth != 4) && (depth != 8) && (depth != 16) && (depth != 24) && (depth != 32))) return false;
+  uint32_t row_size = ((uint32_t(w) * depth + 31) / 32) * 4;
+  if (offset + row_size * h > data.size()) return false;
+  const uint8_t* palette = &data[14 + header_size];
+  if ((colors == 0) || (colors > (1u << depth))) colors = 1 << depth;
+  img.w = w;
+  img.h = h;
+  img.rgb.resize(3 * w * h);
+  for (int32_t j = 0; j < h; j++)
+  {
+    const uint8_t* row = &data[offset + row_size * (bottom_up ? h - 1 - j : j)];
+    uint8_t* out = &img.rgb[3 * w * j];
+    for (int32_t i = 0; i < w; i++, out += 3)
+    {
+      if (depth <= 8)
+      {
+        uint32_t c = (row[i * depth / 8] >> (8 - depth - (i * depth) % 8)) & ((1 << depth) - 1);
+        if (c >= colors) c = 0;
+        out[0] = palette[4 * c + 2];
+        out[1] = palette[4 * c + 1];
+        out[2] = palette[4 * c];
+      }
+      else if (depth == 16)
+      {
+        uint16_t v = le16(row + 2 * i);
+        if (rgb555) v = ((v & 0x7FE0) << 1) | ((v >> 4) & 0x20) | (v & 0x1F);
+        out[0] = ((v >> 8) & 0xF8) | (v >> 13);
+        out[1] = ((v >> 3) & 0xFC) | ((v >> 9) & 0x03);
+        out[2] = ((v << 3) & 0xF8) | ((v >> 2) & 0x07);
+      }
+      else
+      {
+        const uint8_t* p = row + (depth / 8) * i;
+        out[0] = p[2];
+        out[1] = p[1];
+        out[2] = p[0];
+      }
+    }
+  }
+  return true;
+}
+
+static bool loadPPM(const char* path, image& img)
+{
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  int w, h, max;
+  bool ok = (fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3) && (max == 255) && (w > 0) && (h > 0) && (fgetc(f) != EOF);
+  if (ok)
+  {
+    img.w = w;
+    img.h = h;
+    img.rgb.resize(3 * w * h);
+    ok = fread(&img.rgb[0], 1, img.rgb.size(), f) == img.rgb.size();
+  }
+  fclose(f);
+  return ok;
+}
+
+#if defined(GxEPD_PNG)
+static bool loadPNG(const char* path, image& img)
+{
+  png_image png;
+  memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&png, path)) return false;
+  png.format = PNG_FORMAT_RGB;
+  img.w = png.width;
+  img.h = png.height;
+  img.rgb.resize(PNG_IMAGE_SIZE(png));
+  png_color white = {255, 255, 255}; // background of transparent pixels
+  return png_image_finish_read(&png, &white, &img.rgb[0], 0, 0);
+}
+#endif
+
+// as GxDither, for the same result as GxBMP with the same method on the device
+class dither
+{
+  public:
+    enum method {threshold, ordered, diffusion};
+    dither(bool red, method m, int w) : _red(red), _method(m), _w(w), _errors(3 * (w + 2), 0) {};
+    // 0 : white, 1 : black, 2 : red, for the row y of w pixels at x
+    void row(const uint8_t* rgb, int x, int y, uint8_t* out)
+    {
+      int channels = _red ? 3 : 1;
+      int carry[3] = {0, 0, 0}, pending[3] = {0, 0, 0};
+      for (int i = 0; i < _w; i++, rgb += 3)
+      {
+        int c[3] = {rgb[0], rgb[1], rgb[2]};
+        if (!_red) c[0] = (c[0] * 77 + c[1] * 150 + c[2] * 29) >> 8;
+        uint8_t q;
+        if (_method == ordered)
+        {
+          int o = 126 - 4 * bayer(x + i, y);
+          q = nearest(c[0] + o, c[1] + o, c[2] + o);
+        }
+        else if (_method == threshold) q = nearest(c[0], c[1], c[2]);
+        else
+        {
+          for (int ch = 0; ch < channels; ch++) c[ch] = clamp(c[ch] + _errors[ch * (_w + 2) + i + 1] + carry[ch]);
+          q = nearest(c[0], c[1], c[2]);
+          for (int ch = 0; ch < channels; ch++)
+          {
+            int16_t* errors = &_errors[ch * (_w + 2)];
+            int16_t e = c[ch] - (((q == 0) || ((q == 2) && (ch == 0))) ? 255 : 0);
+            int16_t e7 = e * 7 / 16, e3 = e * 3 / 16, e5 = e * 5 / 16;
+            carry[ch] = e7;
+            errors[i] += e3;
+            errors[i + 1] = e5 + pending[ch];
+            pending[ch] = e - e7 - e3 - e5;
+          }
+        }
+        out[i] = q;
+      }
+      for (int ch = 0; ch < channels; ch++) _errors[ch * (_w + 2)] = 0;
+    };
+  private:
+    uint8_t nearest(int r, int g, int b)
+    {
+      if (!_red) return (r >= 128) ? 0 : 1;
+      if (r >= 128) return (g + b >= 255) ? 0 : 2;
+      return (r + g + b >= 383) ? 0 : 1;
+    };
+    static int clamp(int v) {return (v < 0) ? 0 : (v > 255) ? 255 : v;};
+    static uint8_t bayer(uint16_t x, uint16_t y)
+    {
+      uint8_t a = x ^ y, b = y;
+      return ((a & 1) << 5) | ((b & 1) << 4) | ((a & 2) << 2) | ((b & 2) << 1) | ((a & 4) >> 1) | ((b & 4) >> 2);
+    };
+    bool _red;
+    method _method;
+    int _w;
+    std::vector<int16_t> _errors;
+};
+
+// screen to controller coordinates, as GxEPD
+static void toController(const panel& p, int rotation, int& x, int& y)
+{
+  int t = x;
+  switch (rotation)
+  {
+    case 1:
+      x = p.visible_width - y - 1;
+      y = t;
+      break;
+    case 2:
+      x = p.visible_width - x - 1;
+      y = p.height - y - 1;
+      break;
+    case 3:
+      x = y;
+      y = p.height - t - 1;
+      break;
+  }
+}
+
+static void put32(uint8_t* p, uint32_t v)
+{
+  for (int i = 0; i < 4; i++) p[i] = v >> (8 * i);
+}
+
+static int usage()
+{
+  fprintf(stderr, "usage: epdconv [-p panel] [-r rotation] [-m threshold|ordered|diffusion] [-u] image.bmp|.png|.ppm image.epd\n");
+  fprintf(stderr, "       epdconv -l : lists the panels\n");
+  return 2;
+}
+
+int main(int argc, char** argv)
+{
+  const char* panel_name = "GDEW042T2";
+  int rotation = 0;
+  dither::method method = dither::diffusion;
+  bool pack = true;
+  int i = 1;
+  for (; (i < argc) && (argv[i][0] == '-'); i++)
+  {
+    const char* opt = argv[i];
+    if (!strcmp(opt, "-l"))
+    {
+      for (const panel& p : panels) printf("%-12s %4d x %3d %s\n", p.name, p.visible_width, p.height, p.red ? "black, white, red" : "black, white");
+      return 0;
+    }
+    else if (!strcmp(opt, "-u")) pack = false;
+    else if (i + 1 >= argc) return usage();
+    else if (!strcmp(opt, "-p")) panel_name = argv[++i];
+    else if (!strcmp(opt, "-r")) rotation = atoi(argv[++i]) & 3;
+    else if (!strcmp(opt, "-m"))
+    {
+      const char* m = argv[++i];
+      if (!strcmp(m, "threshold")) method = dither::threshold;
+      else if (!strcmp(m, "ordered")) method = dither::ordered;
+      else if (!strcmp(m, "diffusion")) method = dither::diffusion;
+      else return usage();
+    }
+    else return usage();
+  }
+  if (argc - i != 2) return usage();
+  const char* in_path = argv[i];
+  const char* out_path = argv[i + 1];
+  const panel* p = 0;
+  for (const panel& q : panels) if (!strcasecmp(q.name, panel_name)) p = &q;
+  if (!p)
+  {
+    fprintf(stderr, "epdconv: unknown panel %s, see epdconv -l\n", panel_name);
+    return 1;
+  }
+  image img;
+  const char* ext = strrchr(in_path, '.');
+  bool loaded = false;
+  if (ext && !strcasecmp(ext, ".ppm")) loaded = loadPPM(in_path, img);
+#if defined(GxEPD_PNG)
+  else if (ext && !strcasecmp(ext, ".png")) loaded = loadPNG(in_path, img);
+#endif
+  else loaded = loadBMP(in_path, img);
+  if (!loaded)
+  {
+    fprintf(stderr, "epdconv: can't read %s\n", in_path);
+    return 1;
+  }
+
+  // the colors of the screen pixels, white beyond the image
+  int sw = (rotation & 1) ? p->height : p->visible_width;
+  int sh = (rotation & 1) ? p->visible_width : p->height;
+  int w = (img.w < sw) ? img.w : sw;
+  int h = (img.h < sh) ? img.h : sh;
+  std::vector<uint8_t> colors(uint32_t(p->width) * p->height, 0); // controller pixels
+  std::vector<uint8_t> row(w);
+  dither d(p->red, method, w);
+  for (int y = 0; y < h; y++)
+  {
+    d.row(&img.rgb[3 * img.w * y], 0, y, &row[0]);
+    for (int x = 0; x < w; x++)
+    {
+      int cx = x, cy = y;
+      toController(*p, rotation, cx, cy);
+      colors[uint32_t(cy) * p->width + cx] = row[x];
+    }
+  }
+
+  // the planes, as sent by the display class
+  std::vector<uint8_t> planes[2];
+  uint8_t plane_count = (p->red && (p->format != il0371)) ? 2 : 1;
+  uint32_t plane_size = uint32_t(p->width / 8) * p->height;
+  if (p->format == il0371) planes[0].resize(4 * plane_size);
+  else if (p->format == bwr_grey) planes[0].resize(2 * plane_size);
+  else planes[0].resize(plane_size);
+  if (plane_count == 2) planes[1].resize(plane_size);
+  for (int y = 0; y < p->height; y++)
+  {
+    const uint8_t* c = &colors[uint32_t(p->flip_y ? p->height - 1 - y : y) * p->width];
+    for (int x = 0; x < p->width; x++)
+    {
+      bool black = (c[x] == 1) || (!p->red && c[x] == 2);
+      bool red = p->red && (c[x] == 2);
+      uint32_t i = uint32_t(y) * (p->width / 8) + x / 8;
+      uint8_t bit = 0x80 >> (x % 8);
+      switch (p->format)
+      {
+        case il0371:
+          planes[0][4 * i + (x % 8) / 2] |= (red ? 0x4 : black ? 0x0 : 0x3) << ((x & 1) ? 0 : 4);
+          break;
+        case bwr_grey:
+          if (!black) planes[0][2 * i + (x % 8) / 4] |= 0xC0 >> (2 * (x % 4));
+          if (!red) planes[1][i] |= bit;
+          break;
+        case bwr_set:
+          if (black) planes[0][i] |= bit;
+          if (red) planes[1][i] |= bit;
+          break;
+        default:
+          if (!black) planes[0][i] |= bit;
+          if ((plane_count == 2) && !red) planes[1][i] |= bit;
+          break;
+      }
+    }
+  }
+
+  uint8_t header[GxEPDImage_HEADER_SIZE];
+  memset(header, 0, sizeof(header));
+  memcpy(header, "GxEP", 4);
+  header[4] = GxEPDImage_VERSION;
+  header[5] = pack ? GxEPDImage_PACKBITS : 0;
+  header[6] = plane_count;
+  header[8] = p->visible_width;
+  header[9] = p->visible_width >> 8;
+  header[10] = p->height;
+  header[11] = p->height >> 8;
+  std::vector<uint8_t> data[2];
+  for (int k = 0; k < plane_count; k++)
+  {
+    if (pack)
+    {
+      data[k].resize(planes[k].size() + (planes[k].size() + 127) / 128);
+      data[k].resize(GxPackBits::encode(&planes[k][0], planes[k].size(), &data[k][0]));
+    }
+    else data[k] = planes[k];
+    put32(header + 12 + 4 * k, planes[k].size());
+    put32(header + 20 + 4 * k, data[k].size());
+  }
+  memcpy(header + 32, p->name, strlen(p->name)); // names are shorter than 16
+  FILE* f = fopen(out_path, "wb");
+  bool ok = f && (fwrite(header, 1, sizeof(header), f) == sizeof(header));
+  for (int k = 0; ok && (k < plane_count); k++) ok = fwrite(&data[k][0], 1, data[k].size(), f) == data[k].size();
+  if (f) ok = (fclose(f) == 0) && ok;
+  if (!ok)
+  {
+    fprintf(stderr, "epdconv: can't write %s\n", out_path);
+    return 1;
+  }
+  uint32_t total = GxEPDImage_HEADER_SIZE + data[0].size() + data[1].size();
+  printf("%s : %s %d x %d, %d plane%s, %u bytes\n", out_path, p->name, p->visible_width, p->height, plane_count, (plane_count > 1) ? "s" : "", total);
+  return 0;
+}
@@ -0,0 +1,270 @@
+// gxpack : packs the bitmaps of bitmap headers, e.g. BitmapExamples.h or imglib, to packed bitmaps for GxPackedBitmap
+//
+// gxpack [-s suffix] bitmaps.h [bitmaps.h ...] packed.h
+//
+// each byte array in program memory (const unsigned char or uint8_t name[] PROGMEM = {...}) is packed to name_packed[]:
+// the size of the bitmap, 32 bit little endian, followed by the bitmap packed by GxPackBits; parts of arrays within
+// #if defined(__AVR) or #if !defined(__AVR) are kept, the array is packed for both if they differ;
+// #define alias name, e.g. #define BitmapExample1 logo, is kept as #define alias_packed name_packed
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "GxPackBits.h"
+
+// header of GxPackedBitmap.h
+#define GxPackedBitmap_HEADER_SIZE 4
+
+struct bitmap
+{
+  std::string name;
+  std::string source; // file
+  std::vector<uint8_t> data[2]; // for AVR, for the others
+  bool avr, other; // declared for
+};
+
+struct alias
+{
+  std::string name, bitmap;
+};
+
+// conditions of #if, for AVR and for the others; conditions not on __AVR are taken as true
+struct condition
+{
+  bool avr, other, evaluated;
+};
+
+static std::string identifierBefore(const std::string& line, size_t pos)
+{
+  size_t end = pos;
+  while ((end > 0) && isspace((unsigned char)line[end - 1])) end--;
+  size_t start = end;
+  while ((start > 0) && (isalnum((unsigned char)line[start - 1]) || (line[start - 1] == '_'))) start--;
+  return line.substr(start, end - start);
+}
+
+static bool isByteArray(const std::string& line)
+{
+  size_t comment = line.find("//");
+  size_t progmem = line.find("PROGMEM");
+  return (progmem != std::string::npos) && (progmem < comment) && (line.find('[') < progmem) &&
+         ((line.find("unsigned char") != std::string::npos) || (line.find("uint8_t") != std::string::npos));
+}
+
+static bool isBitmap(const std::vector<bitmap>& bitmaps, const std::string& name)
+{
+  for (const bitmap& b : bitmaps) if (b.name == name) return true;
+  return false;
+}
+
+static bool load(const char* path, std::vector<bitmap>& bitmaps, std::vector<alias>& aliases)
+{
+  FILE* f = fopen(path, "r");
+  if (!f) return false;
+  const char* base = strrchr(path, '/');
+  std::vector<condition> conditions;
+  bool in_array = false, skip = false, in_comment = false;
+  int depth = 0; // of braces
+  size_t declared = 0; // size in brackets, 0 if none
+  char buf[4096];
+  int line_number = 0;
+  while (fgets(buf, sizeof(buf), f))
+  {
+    line_number++;
+    std::string line(buf);
+    size_t first = line.find_first_not_of(" \t");
+    if (!in_comment && (first != std::string::npos) && (line[first] == '#'))
+    {
+      std::string directive = line.substr(first);
+      if (!directive.compare(0, 3, "#if"))
+      {
+        bool avr = !directive.compare(0, 4, "#if ") && (directive.find("__AVR") != std::string::npos);
+        bool negated = directive.find('!') != std::string::npos;
+        if (!avr && in_array) fprintf(stderr, "gxpack: %s:%d: condition not evaluated, kept: %s", path, line_number, directive.c_str());
+        condition c = {!avr || !negated, !avr || negated, avr};
+        conditions.push_back(c);
+      }
+      else if (!directive.compare(0, 5, "#else") && !conditions.empty() && conditions.back().evaluated)
+      {
+        conditions.back().avr = !conditions.back().avr;
+        conditions.back().other = !conditions.back().other;
+      }
+      else if (!directive.compare(0, 6, "#endif") && !conditions.empty()) conditions.pop_back();
+      else if (!directive.compare(0, 7, "#define"))
+      {
+        char name[256], value[256];
+        if ((sscanf(directive.c_str(), "#define %255s %255s", name, value) == 2) && isBitmap(bitmaps, value))
+        {
+          alias a = {name, value};
+          aliases.push_back(a);
+        }
+      }
+      continue;
+    }
+    bool avr = true, other = true;
+    for (const condition& c : conditions)
+    {
+      avr = avr && c.avr;
+      other = other && c.other;
+    }
+    if (!in_array)
+    {
+      if (!isByteArray(line)) continue;
+      size_t open = line.find('['), close = line.find(']');
+      skip = line.find('[', close) < line.find("PROGMEM");
+      if (skip) fprintf(stderr, "gxpack: %s:%d: %s is not a bitmap, skipped\n", path, line_number, identifierBefore(line, open).c_str());
+      else
+      {
+        bitmap b;
+        b.name = identifierBefore(line, open);
+        b.source = base ? base + 1 : path;
+        b.avr = avr;
+        b.other = other;
+        bitmaps.push_back(b);
+      }
+      declared = strtoul(line.c_str() + open + 1, 0, 0);
+      in_array = true;
+      depth = 0;
+      line = line.substr(line.find("PROGMEM"));
+    }
+    for (size_t i = 0; i < line.size() && in_array; )
+    {
+      if (in_comment)
+      {
+        size_t end = line.find("*/", i);
+        if (end == std::string::npos) break;
+        in_comment = false;
+        i = end + 2;
+      }
+      else if (!line.compare(i, 2, "/*")) in_comment = true, i += 2;
+      else if (!line.compare(i, 2, "//")) break;
+      else if (line[i] == '{') depth++, i++;
+      else if (line[i] == '}')
+      {
+        in_array = (--depth > 0);
+        i++;
+      }
+      else if ((depth > 0) && isdigit((unsigned char)line[i]))
+      {
+        char* end;
+        unsigned long v = strtoul(line.c_str() + i, &end, 0);
+        if (!skip && avr) bitmaps.back().data[0].push_back(uint8_t(v));
+        if (!skip && other) bitmaps.back().data[1].push_back(uint8_t(v));
+        i = end - line.c_str();
+      }
+      else i++;
+    }
+    if (!in_array && !skip)
+    {
+      // the rest of a declared size is 0
+      for (int k = 0; k < 2; k++) if (bitmaps.back().data[k].size() < declared) bitmaps.back().data[k].resize(declared, 0);
+    }
+  }
+  fclose(f);
+  if (in_array) fprintf(stderr, "gxpack: %s: array not terminated\n", path);
+  return true;
+}
+
+static std::vector<uint8_t> pack(const std::vector<uint8_t>& data)
+{
+  std::vector<uint8_t> packed(GxPackedBitmap_HEADER_SIZE + data.size() + (data.size() + 127) / 128);
+  for (int i = 0; i < 4; i++) packed[i] = uint32_t(data.size()) >> (8 * i);
+  packed.resize(GxPackedBitmap_HEADER_SIZE + GxPackBits::encode(data.data(), data.size(), &packed[GxPackedBitmap_HEADER_SIZE]));
+  return packed;
+}
+
+static void writeArray(FILE* f, const std::string& name, const std::vector<uint8_t>& packed)
+{
+  fprintf(f, "const unsigned char %s[] PROGMEM =\n{\n", name.c_str());
+  for (size_t i = 0; i < packed.size(); i++) fprintf(f, "0x%02X,%s", packed[i], ((i % 16 == 15) || (i + 1 == packed.size())) ? "\n" : "");
+  fprintf(f, "};\n");
+}
+
+static int usage()
+{
+  fprintf(stderr, "usage: gxpack [-s suffix] bitmaps.h [bitmaps.h ...] packed.h\n");
+  fprintf(stderr, "       suffix of the packed names, default _packed\n");
+  return 2;
+}
+
+int main(int argc, char** argv)
+{
+  std::string suffix = "_packed";
+  int i = 1;
+  for (; (i < argc) && (argv[i][0] == '-'); i++)
+  {
+    if (!strcmp(argv[i], "-s") && (i + 1 < argc)) suffix = argv[++i];
+    else return usage();
+  }
+  if (argc - i < 2) return usage();
+  const char* out_path = argv[argc - 1];
+  std::vector<bitmap> bitmaps;
+  std::vector<alias> aliases;
+  for (; i < argc - 1; i++)
+  {
+    if (!load(argv[i], bitmaps, aliases))
+    {
+      fprintf(stderr, "gxpack: can't read %s\n", argv[i]);
+      return 1;
+    }
+  }
+  const char* base = strrchr(out_path, '/');
+  base = base ? base + 1 : out_path;
+  std::string guard = "_" + std::string(base, strcspn(base, "."));
+  for (char& c : guard) c = isalnum((unsigned char)c) ? c : '_';
+  guard += "_H_";
+  FILE* f = fopen(out_path, "w");
+  if (!f)
+  {
+    fprintf(stderr, "gxpack: can't write %s\n", out_path);
+    return 1;
+  }
+  fprintf(f, "// %s : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from", base);
+  std::string last;
+  for (const bitmap& b : bitmaps) if (b.source != last) fprintf(f, " %s", (last = b.source).c_str());
+  fprintf(f, "\n//\n// e.g. GxPackedBitmap(display).drawExampleBitmap(name%s, sizeof(name%s))\n\n", suffix.c_str(), suffix.c_str());
+  fprintf(f, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+  fprintf(f, "#if defined(ESP8266) || defined(ESP32)\n#include <pgmspace.h>\n#else\n#include <avr/pgmspace.h>\n#endif\n");
+  uint32_t total[2] = {0, 0};
+  for (const bitmap& b : bitmaps)
+  {
+    std::string name = b.name + suffix;
+    std::vector<uint8_t> packed = pack(b.data[1]);
+    fprintf(f, "\n// %s : %u bytes, packed %u\n", b.name.c_str(), unsigned(b.data[1].size()), unsigned(packed.size()));
+    if (!b.avr || !b.other)
+    {
+      fprintf(f, "#if %sdefined(__AVR)\n", b.avr ? "" : "!");
+      writeArray(f, name, b.avr ? pack(b.data[0]) : packed);
+      fprintf(f, "#endif\n");
+    }
+    else if (b.data[0] != b.data[1])
+    {
+      std::vector<uint8_t> packed_avr = pack(b.data[0]);
+      fprintf(f, "#if defined(__AVR)\n");
+      writeArray(f, name, packed_avr);
+      fprintf(f, "#else\n");
+      writeArray(f, name, packed);
+      fprintf(f, "#endif\n");
+    }
+    else writeArray(f, name, packed);
+    printf("%-32s %7u %7u %5.1f%%\n", b.name.c_str(), unsigned(b.data[1].size()), unsigned(packed.size()),
+           b.data[1].empty() ? 0.0 : 100.0 * packed.size() / b.data[1].size());
+    total[0] += b.data[1].size();
+    total[1] += packed.size();
+  }
+  if (!aliases.empty()) fprintf(f, "\n");
+  for (const alias& a : aliases) fprintf(f, "#define %s%s %s%s\n", a.name.c_str(), suffix.c_str(), a.bitmap.c_str(), suffix.c_str());
+  fprintf(f, "\n#endif\n");
+  bool ok = (fclose(f) == 0);
+  if (!ok)
+  {
+    fprintf(stderr, "gxpack: can't write %s\n", out_path);
+    return 1;
+  }
+  printf("%s : %u bitmaps, %u bytes, packed %u\n", out_path, unsigned(bitmaps.size()), total[0], total[1]);
+  return 0;
+}
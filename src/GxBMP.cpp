@@ -0,0 +1,243 @@
+// class GxBMP : Streaming BMP Decoder to the Frame Buffer of GxEPD Display Classes
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxBMP.h"
+
+// BMP data is stored little-endian
+static inline uint16_t gx_le16(const uint8_t* p)
+{
+  return p[0] | (uint16_t(p[1]) << 8);
+}
+
+static inline uint32_t gx_le32(const uint8_t* p)
+{
+  return gx_le16(p) | (uint32_t(gx_le16(p + 2)) << 16);
+}
+
+uint16_t GxBMP_MemoryInput::read(uint8_t* buffer, uint16_t size)
+{
+  uint16_t n = (_size - _position < size) ? _size - _position : size;
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  if (_progmem) memcpy_P(buffer, _data + _position, n);
+  else
+#endif
+    memcpy(buffer, _data + _position, n);
+  _position += n;
+  return n;
+}
+
+bool GxBMP_MemoryInput::seek(uint32_t position)
+{
+  if (position > _size) return false;
+  _position = position;
+  return true;
+}
+
+bool GxBMP::begin(GxBMP_Input& input)
+{
+  end();
+  _input = &input;
+  _position = 0;
+  if ((_read(_chunk, 54) < 54) || (_chunk[0] != 'B') || (_chunk[1] != 'M'))
+  {
+    end();
+    return false;
+  }
+  _offset = gx_le32(_chunk + 10);
+  uint32_t header_size = gx_le32(_chunk + 14);
+  _width = int32_t(gx_le32(_chunk + 18));
+  _height = int32_t(gx_le32(_chunk + 22));
+  uint16_t planes = gx_le16(_chunk + 26);
+  _depth = gx_le16(_chunk + 28);
+  uint32_t format = gx_le32(_chunk + 30);
+  uint32_t colors = gx_le32(_chunk + 46);
+  _bottom_up = _height > 0; // rows are stored bottom-to-top, unless the height is negative
+  if (_height < 0) _height = -_height;
+  bool valid = (planes == 1) && (_width > 0) && (_height > 0);
+  valid = valid && ((_depth == 1) || (_depth == 4) || (_depth == 8) || (_depth == 16) || (_depth == 24));
+  _rgb555 = (_depth == 16) && (format == 0);
+  if (valid && (_depth == 16) && (format == 3))
+  {
+    // bitfields, following the info header of 40 bytes, or in the larger ones
+    uint32_t red_mask = (_read(_chunk, 4) == 4) ? gx_le32(_chunk) : 0;
+    _rgb555 = (red_mask == 0x7C00);
+    valid = _rgb555 || (red_mask == 0xF800);
+  }
+  else valid = valid && (format == 0);
+  if (valid && (_depth <= 8))
+  {
+    _colors = ((colors == 0) || (colors > (1u << _depth))) ? (1 << _depth) : colors;
+    _palette = (uint8_t*) malloc(3 * _colors);
+    valid = _palette && _skipTo(14 + header_size);
+    for (uint16_t i = 0; valid && (i < _colors); i++)
+    {
+      valid = (_read(_chunk, 4) == 4);
+      _palette[3 * i] = _chunk[2];
+      _palette[3 * i + 1] = _chunk[1];
+      _palette[3 * i + 2] = _chunk[0];
+    }
+  }
+  if (!valid)
+  {
+    end();
+    return false;
+  }
+  _row_size = ((uint32_t(_width) * _depth + 31) / 32) * 4; // padded to 4 bytes
+  return true;
+}
+
+void GxBMP::end()
+{
+  _dither.end();
+  free(_palette);
+  _palette = 0;
+  _input = 0;
+}
+
+bool GxBMP::draw(int16_t x, int16_t y, GxDither::palette p, GxDither::method m)
+{
+  if (!_input) return false;
+  int32_t w = _width, h = _height;
+  if (x + w > _display.width()) w = _display.width() - x; // columns beyond the screen are not converted
+  int16_t ys, ye;
+  _display.getPageRows(ys, ye);
+  int32_t y0 = (y > ys) ? y : ys;
+  int32_t y1 = (y + h - 1 < ye) ? y + h - 1 : ye;
+  if ((w <= 0) || (y0 > y1)) return true;
+  // file rows of screen rows y0 .. y1, read in file order
+  int32_t r0 = _bottom_up ? y + h - 1 - y1 : y0 - y;
+  int32_t r1 = _bottom_up ? y + h - 1 - y0 : y1 - y;
+  if (m == GxDither::error_diffusion) r0 = 0; // the error of the rows before diffuses into these
+  bool indexed = (_depth <= 8) && (m == GxDither::threshold);
+  if (indexed)
+  {
+    memset(_black_bits, 0, sizeof(_black_bits));
+    memset(_red_bits, 0, sizeof(_red_bits));
+    for (uint16_t i = 0; i < _colors; i++)
+    {
+      uint8_t c = GxDither::classify(p, _palette[3 * i], _palette[3 * i + 1], _palette[3 * i + 2]);
+      if (c == 1) _black_bits[i / 8] |= 1 << (i % 8);
+      if (c == 2) _red_bits[i / 8] |= 1 << (i % 8);
+    }
+  }
+  else _dither.begin(x, _bottom_up ? y + h - 1 - r1 : y + r0, w, r1 - r0 + 1, p, m, _bottom_up);
+  bool ok = _skipTo(_offset + r0 * _row_size);
+  for (int32_t r = r0; ok && (r <= r1); r++)
+  {
+    int16_t yr = _bottom_up ? y + h - 1 - r : y + r;
+    uint32_t remain = _row_size;
+    uint16_t col = 0;
+    while (ok && (remain > 0))
+    {
+      uint16_t n = (remain < GxBMP_CHUNK) ? remain : GxBMP_CHUNK;
+      ok = (_read(_chunk, n) == n);
+      remain -= n;
+      if (!ok || (col >= w)) continue; // padding and columns beyond the screen
+      uint16_t pixels = (_depth <= 8) ? n * (8 / _depth) : n / (_depth / 8);
+      if (pixels > w - col) pixels = w - col;
+      if (indexed) _drawIndexed(x, yr, _chunk, col, pixels);
+      else if (_depth <= 8)
+      {
+        // palette colors to the dither, a few pixels at a time
+        uint8_t rgb[3 * 16];
+        uint8_t mask = (1 << _depth) - 1;
+        for (uint16_t i = 0; i < pixels; i += 16)
+        {
+          uint16_t k = (pixels - i < 16) ? pixels - i : 16;
+          for (uint16_t j = 0; j < k; j++)
+          {
+            uint16_t pn = i + j;
+            uint8_t c = (_chunk[pn * _depth / 8] >> (8 - _depth - (pn * _depth) % 8)) & mask;
+            if (c >= _colors) c = 0;
+            memcpy(rgb + 3 * j, _palette + 3 * c, 3);
+          }
+          _dither.writePixels(rgb, k, GxDither::rgb888);
+        }
+      }
+      else
+      {
+        if (_rgb555)
+        {
+          for (uint16_t i = 0; i < pixels; i++)
+          {
+            uint16_t v = gx_le16(_chunk + 2 * i);
+            v = ((v & 0x7FE0) << 1) | ((v >> 4) & 0x20) | (v & 0x1F); // green to 6 bits
+            _chunk[2 * i] = v;
+            _chunk[2 * i + 1] = v >> 8;
+          }
+        }
+        _dither.writePixels(_chunk, pixels, (_depth == 24) ? GxDither::bgr888 : GxDither::rgb565);
+      }
+      col += pixels;
+    }
+    yield(); // e.g. for the watchdog of ESP8266 on slow input
+  }
+  _dither.end();
+  return ok;
+}
+
+void GxBMP::_drawIndexed(int16_t x, int16_t y, const uint8_t* bytes, uint16_t col, uint16_t n)
+{
+  if (_depth == 1)
+  {
+    // a byte is 8 pixels, colors 0 and 1 from their bits
+    uint8_t b0 = (_black_bits[0] & 1) ? 0xFF : 0x00, b1 = (_black_bits[0] & 2) ? 0xFF : 0x00;
+    uint8_t r0 = (_red_bits[0] & 1) ? 0xFF : 0x00, r1 = (_red_bits[0] & 2) ? 0xFF : 0x00;
+    for (uint16_t i = 0; i < n; i += 8)
+    {
+      uint8_t v = *bytes++;
+      uint8_t mask = (n - i < 8) ? 0xFF << (8 - (n - i)) : 0xFF;
+      _display.drawPlaneBits(x + col + i, y, (v & b1) | (~v & b0), (v & r1) | (~v & r0), mask);
+    }
+    return;
+  }
+  uint8_t black = 0, red = 0, mask = 0;
+  uint8_t index_mask = (1 << _depth) - 1;
+  for (uint16_t i = 0; i < n; i++, col++)
+  {
+    uint8_t c = (bytes[i * _depth / 8] >> (8 - _depth - (i * _depth) % 8)) & index_mask;
+    uint8_t bit = 0x80 >> (col & 7);
+    if (_black_bits[c / 8] & (1 << (c % 8))) black |= bit;
+    if (_red_bits[c / 8] & (1 << (c % 8))) red |= bit;
+    mask |= bit;
+    if (((col & 7) == 7) || (i == n - 1))
+    {
+      _display.drawPlaneBits(x + (col & ~7), y, black, red, mask);
+      black = red = mask = 0;
+    }
+  }
+}
+
+uint16_t GxBMP::_read(uint8_t* buffer, uint16_t size)
+{
+  uint16_t got = 0;
+  while (got < size)
+  {
+    uint16_t n = _input->read(buffer + got, size - got);
+    if (n == 0) break;
+    got += n;
+  }
+  _position += got;
+  return got;
+}
+
+bool GxBMP::_skipTo(uint32_t position)
+{
+  if (position == _position) return true;
+  if (_input->seek(position))
+  {
+    _position = position;
+    return true;
+  }
+  while (_position < position)
+  {
+    uint16_t n = (position - _position < GxBMP_CHUNK) ? position - _position : GxBMP_CHUNK;
+    if (_read(_chunk, n) < n) return false;
+  }
+  return _position == position;
+}
@@ -0,0 +1,109 @@
+// class GxBMP : Streaming BMP Decoder to the Frame Buffer of GxEPD Display Classes
+//
+// reads uncompressed BMP files of depth 1, 4, 8, 16 and 24 from a pull input (file, network client, memory),
+// in file order, a chunk at a time; pixels are written packed, 8 at a time, by GxEPD::drawPlaneBits()
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxBMP_H_
+#define _GxBMP_H_
+
+#include <Arduino.h>
+#include "GxEPD.h"
+#include "GxDither.h"
+
+// bytes read per chunk, a multiple of 24 for whole pixels of any depth and groups of 8, at least 54 for the header
+#if defined(__AVR)
+#define GxBMP_CHUNK 72
+#else
+#define GxBMP_CHUNK 384
+#endif
+
+// pull input of GxBMP and GxEPDImage
+class GxBMP_Input
+{
+  public:
+    virtual ~GxBMP_Input() {};
+    // up to size bytes, less at the end or on error
+    virtual uint16_t read(uint8_t* buffer, uint16_t size) = 0;
+    // to position from the start, false if not possible; forward skips are read if not
+    virtual bool seek(uint32_t position) {return false;};
+};
+
+// a Stream that can't seek, e.g. a WiFiClient after the HTTP headers; reads wait up to the timeout of the stream
+class GxBMP_StreamInput : public GxBMP_Input
+{
+  public:
+    GxBMP_StreamInput(Stream& stream) : _stream(stream) {};
+    uint16_t read(uint8_t* buffer, uint16_t size) {return _stream.readBytes((char*) buffer, size);};
+  private:
+    Stream& _stream;
+};
+
+// a file class with read(buffer, size) and seek(position), e.g. File of SD, SdFat, SPIFFS
+template <class F> class GxBMP_FileInput : public GxBMP_Input
+{
+  public:
+    GxBMP_FileInput(F& file) : _file(file) {};
+    uint16_t read(uint8_t* buffer, uint16_t size)
+    {
+      int n = _file.read(buffer, size);
+      return (n > 0) ? n : 0;
+    };
+    bool seek(uint32_t position) {return _file.seek(position);};
+  private:
+    F& _file;
+};
+
+// a BMP file in RAM, or in program memory if progmem
+class GxBMP_MemoryInput : public GxBMP_Input
+{
+  public:
+    GxBMP_MemoryInput(const uint8_t* data, uint32_t size, bool progmem = false) : _data(data), _size(size), _position(0), _progmem(progmem) {};
+    uint16_t read(uint8_t* buffer, uint16_t size);
+    bool seek(uint32_t position);
+  private:
+    const uint8_t* _data;
+    uint32_t _size, _position;
+    bool _progmem;
+};
+
+class GxBMP
+{
+  public:
+    GxBMP(GxEPD& display) : _display(display), _dither(display), _input(0), _palette(0) {};
+    ~GxBMP() {end();};
+    // reads the headers and the palette from the start of input; false if not a BMP of depth 1, 4, 8, 16 (555, or 565
+    // as bitfields) or 24, uncompressed; the input must stay valid until end()
+    bool begin(GxBMP_Input& input);
+    // the image to buffer at (x, y), update needed; threshold : palette colors looked up, depth 1 a byte at a time
+    // paged: the rows of the current page only, see GxEPD::getPageRows(), the headers are not read again;
+    // the input must seek back to draw more than once, e.g. for each page without display list; false on read error
+    bool draw(int16_t x, int16_t y, GxDither::palette p = GxDither::bwr, GxDither::method m = GxDither::threshold);
+    void end(); // frees the palette
+    int32_t width() {return _width;};
+    int32_t height() {return _height;};
+    uint16_t depth() {return _depth;};
+    bool bottomUp() {return _bottom_up;};
+  private:
+    uint16_t _read(uint8_t* buffer, uint16_t size); // all of size bytes unless at the end or on error
+    bool _skipTo(uint32_t position);
+    void _drawIndexed(int16_t x, int16_t y, const uint8_t* bytes, uint16_t col, uint16_t n); // n bytes of depth <= 8 from column col
+    GxEPD& _display;
+    GxDither _dither;
+    GxBMP_Input* _input;
+    uint32_t _position; // of _input
+    uint32_t _offset, _row_size;
+    int32_t _width, _height;
+    uint16_t _depth, _colors;
+    bool _bottom_up, _rgb555;
+    uint8_t* _palette; // RGB of the colors, for depth <= 8
+    uint8_t _black_bits[32], _red_bits[32]; // threshold palette lookup, bit i of color i
+    uint8_t _chunk[GxBMP_CHUNK];
+};
+
+#endif
@@ -0,0 +1,145 @@
+// class GxDither : Streaming Dither of RGB Image Rows to the Frame Buffer of GxEPD Display Classes
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxDither.h"
+
+bool GxDither::begin(int16_t x, int16_t y, uint16_t w, uint16_t h, palette p, method m, bool bottom_up)
+{
+  end();
+  _x = x;
+  _y = bottom_up ? y + h - 1 : y;
+  _dy = bottom_up ? -1 : 1;
+  _w = w;
+  _rows_left = h;
+  _i = 0;
+  _palette = p;
+  _method = m;
+  if (m != error_diffusion) return true;
+  uint8_t channels = (p == bwr) ? 3 : 1;
+  _errors = (int16_t*) calloc(uint32_t(channels) * (w + 2), sizeof(int16_t));
+  if (_errors) return true;
+  _method = ordered;
+  return false;
+}
+
+void GxDither::end()
+{
+  free(_errors);
+  _errors = 0;
+  _rows_left = 0;
+}
+
+void GxDither::writeRow(const uint8_t* pixels, pixel_format format)
+{
+  writePixels(pixels, _w - _i, format);
+}
+
+void GxDither::writePixels(const uint8_t* pixels, uint16_t n, pixel_format format)
+{
+  uint8_t channels = (_palette == bwr) ? 3 : 1;
+  for (uint16_t k = 0; k < n; k++)
+  {
+    if (!_rows_left) return;
+    if (_i == 0)
+    {
+      for (uint8_t ch = 0; ch < 3; ch++) _carry[ch] = _pending[ch] = 0;
+      _black = _red = _mask = 0;
+    }
+    uint16_t i = _i;
+    int16_t c[3];
+    _readPixel(pixels, format, k, c[0], c[1], c[2]);
+    if (_palette == bw) c[0] = _luminance(c[0], c[1], c[2]);
+    uint8_t q;
+    if (_method == ordered)
+    {
+      int16_t o = 126 - 4 * _bayer(_x + i, _y); // 128 - threshold, thresholds 2..254
+      q = _nearest(_palette, c[0] + o, c[1] + o, c[2] + o);
+    }
+    else if (_method == threshold) q = _nearest(_palette, c[0], c[1], c[2]);
+    else
+    {
+      for (uint8_t ch = 0; ch < channels; ch++) c[ch] = _clamp(c[ch] + _errors[ch * (_w + 2) + i + 1] + _carry[ch]);
+      q = _nearest(_palette, c[0], c[1], c[2]);
+      for (uint8_t ch = 0; ch < channels; ch++)
+      {
+        int16_t* errors = _errors + ch * (_w + 2);
+        int16_t e = c[ch] - (((q == 0) || ((q == 2) && (ch == 0))) ? 255 : 0);
+        int16_t e7 = e * 7 / 16, e3 = e * 3 / 16, e5 = e * 5 / 16;
+        _carry[ch] = e7;
+        errors[i] += e3; // column i - 1, its error of this row was used
+        errors[i + 1] = e5 + _pending[ch];
+        _pending[ch] = e - e7 - e3 - e5;
+      }
+    }
+    uint8_t bit = 0x80 >> (i & 7);
+    if (q == 1) _black |= bit;
+    else if (q == 2) _red |= bit;
+    _mask |= bit;
+    if (((i & 7) == 7) || (i == _w - 1))
+    {
+      _display.drawPlaneBits(_x + (i & ~7), _y, _black, _red, _mask);
+      _black = _red = _mask = 0;
+    }
+    if (++_i < _w) continue;
+    // end of row
+    if (_errors)
+    {
+      for (uint8_t ch = 0; ch < channels; ch++) _errors[ch * (_w + 2)] = 0; // column -1
+    }
+    _i = 0;
+    _y += _dy;
+    _rows_left--;
+  }
+}
+
+uint8_t GxDither::classify(palette p, uint8_t r, uint8_t g, uint8_t b)
+{
+  return (p == bw) ? _nearest(p, _luminance(r, g, b), 0, 0) : _nearest(p, r, g, b);
+}
+
+void GxDither::_readPixel(const uint8_t* pixels, pixel_format format, uint16_t i, int16_t& r, int16_t& g, int16_t& b)
+{
+  switch (format)
+  {
+    case rgb888:
+      pixels += 3 * i;
+      r = pixels[0];
+      g = pixels[1];
+      b = pixels[2];
+      break;
+    case bgr888:
+      pixels += 3 * i;
+      b = pixels[0];
+      g = pixels[1];
+      r = pixels[2];
+      break;
+    case rgb565:
+      {
+        uint16_t v = pixels[2 * i] | (uint16_t(pixels[2 * i + 1]) << 8);
+        r = (v >> 8) & 0xF8;
+        g = (v >> 3) & 0xFC;
+        b = (v << 3) & 0xF8;
+        r |= r >> 5;
+        g |= g >> 6;
+        b |= b >> 5;
+      }
+      break;
+    default:
+      r = g = b = pixels[i];
+      break;
+  }
+}
+
+uint8_t GxDither::_nearest(palette p, int16_t r, int16_t g, int16_t b)
+{
+  // r is the luminance for bw; for bwr nearest by squared distance, decided by sums:
+  // red is nearer than black if r >= 128, than white if g + b < 255; white is nearer than black if r + g + b >= 383
+  if (p == bw) return (r >= 128) ? 0 : 1;
+  if (r >= 128) return (g + b >= 255) ? 0 : 2;
+  return (r + g + b >= 383) ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+// class GxDither : Streaming Dither of RGB Image Rows to the Frame Buffer of GxEPD Display Classes
+//
+// ordered dither (Bayer 8x8) needs no memory, error diffusion (Floyd-Steinberg) one row of errors;
+// pixels are written packed, 8 at a time, by GxEPD::drawPlaneBits(), to buffer, update needed
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxDither_H_
+#define _GxDither_H_
+
+#include <Arduino.h>
+#include "GxEPD.h"
+
+class GxDither
+{
+  public:
+    enum method {ordered, error_diffusion, threshold};
+    // black and white, or black, white and red for the 3-color classes
+    enum palette {bw, bwr};
+    // rgb565 as uint16_t little endian, bgr888 as rows of 24 bit BMP
+    enum pixel_format {rgb888, bgr888, rgb565, gray8};
+    GxDither(GxEPD& display) : _display(display), _errors(0), _rows_left(0) {};
+    ~GxDither() {end();};
+    // image of w x h pixels at (x, y), rows from the top, or from the bottom if bottom_up (as BMP), clipped to the screen
+    // error_diffusion allocates (w + 2) error values of 2 bytes, 3 per pixel for bwr; falls back to ordered if that fails
+    bool begin(int16_t x, int16_t y, uint16_t w, uint16_t h, palette p = bw, method m = error_diffusion, bool bottom_up = false);
+    // the rest of the current row, w pixels if none written yet; ignored after h rows
+    void writeRow(const uint8_t* pixels, pixel_format format = rgb888);
+    // n pixels of the current row, continued on the next row after w pixels, for decoders reading in chunks
+    void writePixels(const uint8_t* pixels, uint16_t n, pixel_format format = rgb888);
+    void end(); // frees the error buffer
+    method getMethod() {return _method;}; // as used, after begin()
+    // nearest color of the palette, 0 : white, 1 : black, 2 : red, as threshold
+    static uint8_t classify(palette p, uint8_t r, uint8_t g, uint8_t b);
+  private:
+    static void _readPixel(const uint8_t* pixels, pixel_format format, uint16_t i, int16_t& r, int16_t& g, int16_t& b);
+    // as classify(), r is the luminance for bw
+    static uint8_t _nearest(palette p, int16_t r, int16_t g, int16_t b);
+    static inline int16_t _luminance(int16_t r, int16_t g, int16_t b) {return (int32_t(r) * 77 + int32_t(g) * 150 + int32_t(b) * 29) >> 8;};
+    static inline int16_t _clamp(int16_t v) {return (v < 0) ? 0 : (v > 255) ? 255 : v;};
+    // Bayer 8x8 matrix 0..63, from the bits of x ^ y and y interleaved and reversed
+    static inline uint8_t _bayer(uint16_t x, uint16_t y)
+    {
+      uint8_t a = x ^ y, b = y;
+      return ((a & 1) << 5) | ((b & 1) << 4) | ((a & 2) << 2) | ((b & 2) << 1) | ((a & 4) >> 1) | ((b & 4) >> 2);
+    };
+    GxEPD& _display;
+    int16_t* _errors; // error of the next row at column i + 1, per channel
+    int16_t _x, _y;
+    uint16_t _w;
+    uint16_t _rows_left;
+    uint16_t _i; // column of the current row
+    int16_t _carry[3]; // error to the right
+    int16_t _pending[3]; // error to the right in the next row, added when its column is stored
+    uint8_t _black, _red, _mask; // pixels from column _i & ~7
+    int8_t _dy;
+    palette _palette;
+    method _method;
+};
+
+#endif
@@ -18,67 +18,1322 @@
 #include <avr/pgmspace.h>
 #endif
 
-void  GxEPD::drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
+#if defined(__AVR)
+#include <avr/sleep.h>
+#endif
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#endif
+
+static inline uint8_t _readBitmapByte(const uint8_t* p)
 {
-  uint16_t inverse_color = (color != GxEPD_WHITE) ? GxEPD_WHITE : GxEPD_BLACK;
-  uint16_t fg_color = (mode & bm_invert) ? inverse_color : color;
-  uint16_t bg_color = (mode & bm_invert) ? color : inverse_color;
-  // taken from Adafruit_GFX.cpp, modified
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  return pgm_read_byte(p);
+#else
+  return *p;
+#endif
+}
+
+// 8x8 bit matrix transpose, bit 7 - c of a[r] to bit 7 - r of b[c] (Hacker's Delight)
+static void _transpose8(const uint8_t* a, uint8_t* b)
+{
+  uint32_t x = (uint32_t(a[0]) << 24) | (uint32_t(a[1]) << 16) | (uint32_t(a[2]) << 8) | a[3];
+  uint32_t y = (uint32_t(a[4]) << 24) | (uint32_t(a[5]) << 16) | (uint32_t(a[6]) << 8) | a[7];
+  uint32_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+  b[0] = x >> 24;
+  b[1] = x >> 16;
+  b[2] = x >> 8;
+  b[3] = x;
+  b[4] = y >> 24;
+  b[5] = y >> 16;
+  b[6] = y >> 8;
+  b[7] = y;
+}
+
+void GxEPD::_bitmapToScreen(int16_t mode, int16_t w, int16_t h, int16_t i, int16_t j, int16_t& u, int16_t& v)
+{
+  if (mode & bm_flip_x) i = w - 1 - i;
+  if (mode & bm_flip_y) j = h - 1 - j;
+  switch (mode & bm_r270)
+  {
+    case bm_r90:
+      u = h - 1 - j;
+      v = i;
+      break;
+    case bm_r180:
+      u = w - 1 - i;
+      v = h - 1 - j;
+      break;
+    case bm_r270:
+      u = j;
+      v = w - 1 - i;
+      break;
+    default:
+      u = i;
+      v = j;
+  }
+}
+
+void GxEPD::_screenToController(int16_t& x, int16_t& y)
+{
+  int16_t t = x;
+  switch (getRotation())
+  {
+    case 1:
+      x = WIDTH - y - 1;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - x - 1;
+      y = HEIGHT - y - 1;
+      break;
+    case 3:
+      x = y;
+      y = HEIGHT - t - 1;
+      break;
+  }
+}
+
+uint8_t GxEPD::_colorToPlaneBits(uint16_t color)
+{
+  if (_fb_planes < 2) return !color;
+  return _colorClass(color);
+}
+
+void GxEPD::drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
+{
+  bool invert = mode & bm_invert;
+  bool transparent = mode & bm_transparent;
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-  uint8_t byte = 0;
-  if (mode & bm_transparent)
+  int16_t u, v;
+  if (!_bits_writer)
   {
-    for (int16_t j = 0; j < h; j++)
+    _drawBitmapPixels(bitmap, x, y, w, h, color, mode);
+    return;
+  }
+  if (_current_page < 0)
+  {
+    int16_t dx = x, dy = y;
+    int16_t dw = (mode & bm_r90) ? h : w;
+    int16_t dh = (mode & bm_r90) ? w : h;
+    if (_rotateRect(dx, dy, dw, dh)) _markDirty(dx, dy, dx + dw - 1, dy + dh - 1);
+  }
+  // controller position of bitmap pixel (i, j) is (x0 + ax * i + bx * j, y0 + ay * i + by * j)
+  int16_t x0, y0, x1, y1, x2, y2;
+  _bitmapToScreen(mode, w, h, 0, 0, u, v);
+  x0 = x + u;
+  y0 = y + v;
+  _screenToController(x0, y0);
+  _bitmapToScreen(mode, w, h, 1, 0, u, v);
+  x1 = x + u;
+  y1 = y + v;
+  _screenToController(x1, y1);
+  _bitmapToScreen(mode, w, h, 0, 1, u, v);
+  x2 = x + u;
+  y2 = y + v;
+  _screenToController(x2, y2);
+  int16_t ax = x1 - x0, ay = y1 - y0, bx = x2 - x0, by = y2 - y0;
+  uint8_t fg = _colorToPlaneBits(color);
+  uint8_t bg = transparent ? fg : _colorToPlaneBits((color != GxEPD_WHITE) ? GxEPD_WHITE : GxEPD_BLACK);
+  uint8_t last_mask = 0xFF << ((8 - w % 8) % 8);
+  if (ay == 0)
+  {
+    // bitmap rows are controller rows, forward or reverse
+    for (int16_t j = 0; j < int16_t(h); j++)
+    {
+      uint32_t p = uint32_t(j) * byteWidth;
+      int16_t yc = y0 + by * j;
+      for (int16_t k = 0; k < byteWidth; k++)
+      {
+        uint8_t bits = _readBitmap(bitmap, p + k);
+        if (invert) bits = ~bits;
+        uint8_t mask = (k == byteWidth - 1) ? last_mask : 0xFF;
+        if (transparent) mask &= bits;
+        if (!mask) continue;
+        if (ax > 0) _bits_writer(this, x0 + 8 * k, yc, bits, mask, fg, bg);
+        else _bits_writer(this, x0 - 8 * k - 7, yc, gx_reverse_bits(bits), gx_reverse_bits(mask), fg, bg);
+      }
+    }
+  }
+  else if (_bitmap_reader)
+  {
+    // bitmap columns are controller rows, pixel by pixel to read the bitmap in order
+    _drawBitmapPixels(bitmap, x, y, w, h, color, mode);
+  }
+  else
+  {
+    // bitmap columns are controller rows, 8x8 blocks transposed
+    uint8_t block[8], columns[8];
+    for (int16_t j = 0; j < int16_t(h); j += 8)
     {
-      for (int16_t i = 0; i < w; i++ )
+      uint8_t rows = (h - j < 8) ? h - j : 8;
+      uint8_t row_mask = 0xFF << (8 - rows);
+      for (int16_t k = 0; k < byteWidth; k++)
       {
-        if (i & 7) byte <<= 1;
-        else
+        for (uint8_t r = 0; r < 8; r++)
         {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          byte = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+          block[r] = (r < rows) ? _readBitmapByte(bitmap + (j + r) * byteWidth + k) : 0x00;
+          if (invert) block[r] = ~block[r];
+        }
+        _transpose8(block, columns);
+        for (uint8_t c = 0; (c < 8) && (8 * k + c < int16_t(w)); c++)
+        {
+          uint8_t bits = columns[c];
+          uint8_t mask = transparent ? row_mask & bits : row_mask;
+          if (!mask) continue;
+          int16_t yc = y0 + ay * (8 * k + c);
+          if (bx > 0) _bits_writer(this, x0 + j, yc, bits, mask, fg, bg);
+          else _bits_writer(this, x0 - j - 7, yc, gx_reverse_bits(bits), gx_reverse_bits(mask), fg, bg);
+        }
+      }
+    }
+  }
+}
+
+void GxEPD::_drawBitmapPixels(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
+{
+  uint16_t inverse_color = (color != GxEPD_WHITE) ? GxEPD_WHITE : GxEPD_BLACK;
+  bool invert = mode & bm_invert;
+  bool transparent = mode & bm_transparent;
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  int16_t u, v;
+  for (int16_t j = 0; j < int16_t(h); j++)
+  {
+    for (int16_t i = 0; i < int16_t(w); i++)
+    {
+      bool set = bool(_readBitmap(bitmap, uint32_t(j) * byteWidth + i / 8) & (0x80 >> (i & 7))) != invert;
+      if (transparent && !set) continue;
+      _bitmapToScreen(mode, w, h, i, j, u, v);
+      drawPixel(x + u, y + v, set ? color : inverse_color);
+    }
+  }
+}
+
+void GxEPD::drawPlaneBits(int16_t x, int16_t y, uint8_t black, uint8_t red, uint8_t mask)
+{
+  red &= mask;
+  black &= mask & ~red;
+  if (!_bits_writer || (getRotation() & 1))
+  {
+    // screen rows are controller columns
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      uint8_t m = 0x80 >> i;
+      if (!(mask & m)) continue;
+      uint16_t color = (red & m) ? GxEPD_RED : (black & m) ? GxEPD_BLACK : GxEPD_WHITE;
+      if (_pixel_writer) _pixel_writer(this, x + i, y, color);
+      else drawPixel(x + i, y, color);
+    }
+    return;
+  }
+  if (_current_page < 0)
+  {
+    int16_t dx = x, dy = y, dw = 8, dh = 1;
+    if (_rotateRect(dx, dy, dw, dh)) _markDirty(dx, dy, dx + dw - 1, dy + dh - 1);
+  }
+  uint8_t fg = _colorToPlaneBits(GxEPD_BLACK);
+  uint8_t bg = _colorToPlaneBits(GxEPD_WHITE);
+  uint8_t fg_red = _colorToPlaneBits(GxEPD_RED);
+  int16_t xc = x, yc = y;
+  _screenToController(xc, yc);
+  if (getRotation() == 2)
+  {
+    // reverse controller row
+    xc -= 7;
+    black = gx_reverse_bits(black);
+    red = gx_reverse_bits(red);
+    mask = gx_reverse_bits(mask);
+  }
+  _bits_writer(this, xc, yc, black, mask, fg, bg);
+  if (red) _bits_writer(this, xc, yc, red, red, fg_red, fg_red);
+}
+
+void GxEPD::setRotation(uint8_t r)
+{
+  GxFont_GFX::setRotation(r);
+  if (_pixel_writer && (_pixel_writer != _pixel_writers[4])) _pixel_writer = _pixel_writers[getRotation()];
+}
+
+void GxEPD::setPixelSwitch(bool enable)
+{
+  if (_pixel_writers) _pixel_writer = _pixel_writers[enable ? 4 : getRotation()];
+}
+
+#if GxEPD_HEAP_BUFFER
+#if defined(__AVR)
+extern char* __brkval;
+extern char __heap_start;
+#endif
+
+uint32_t GxEPD::_freeHeap()
+{
+#if defined(ESP8266) || defined(ESP32)
+  uint32_t free_heap = ESP.getFreeHeap();
+#elif defined(__AVR)
+  char top;
+  uint32_t free_heap = &top - (__brkval ? __brkval : &__heap_start);
 #else
-          byte = bitmap[j * byteWidth + i / 8];
+  uint32_t free_heap = 0xFFFFFFFF; // unknown, a full frame
 #endif
+  return (free_heap > GxEPD_HEAP_RESERVE) ? free_heap - GxEPD_HEAP_RESERVE : 0;
+}
+#endif
+
+#if GxEPD_DISPLAY_LIST
+static inline void _dlPut16(uint8_t* p, int16_t v)
+{
+  p[0] = uint16_t(v) & 0xFF;
+  p[1] = uint16_t(v) >> 8;
+}
+
+static inline int16_t _dlGet16(const uint8_t* p)
+{
+  return int16_t(p[0] | (uint16_t(p[1]) << 8));
+}
+
+void GxEPD::setDisplayList(uint8_t* buffer, uint32_t size)
+{
+  _dl_buffer = buffer;
+  _dl_size = size;
+  _dl_used = 0;
+  _dl_state = (buffer && size) ? dl_idle : dl_off;
+}
+
+bool GxEPD::_replayPage()
+{
+  if (_dl_state == dl_idle)
+  {
+    _dl_used = 0;
+    _dl_last = 0;
+    _dl_color = GxEPD_WHITE;
+    _dl_state = dl_recording;
+    return false;
+  }
+  if (_dl_state != dl_ready) return false;
+  // records outside the current page are skipped
+  int16_t ys, ye;
+  _pageRows(ys, ye);
+  _replayRows(ys, ye);
+  return true;
+}
+#endif
+
+void GxEPD::_pageRows(int16_t& ys, int16_t& ye)
+{
+  ys = _current_page * _page_height;
+  ye = ys + _page_height - 1;
+  if (_fb_flip_y)
+  {
+    int16_t t = ys;
+    ys = _fb_height - 1 - ye;
+    ye = _fb_height - 1 - t;
+  }
+}
+
+void GxEPD::getPageRows(int16_t& ys, int16_t& ye)
+{
+  ys = 0;
+  ye = height() - 1;
+  if ((_current_page < 0) || (_current_page >= int16_t(_pages)) || _dlRecording() || (getRotation() & 1)) return;
+  int16_t cs, ce;
+  _pageRows(cs, ce);
+  if (getRotation() == 2)
+  {
+    ys = HEIGHT - 1 - ce;
+    ye = HEIGHT - 1 - cs;
+  }
+  else
+  {
+    ys = cs;
+    ye = ce;
+  }
+  ys = gx_int16_max(ys, 0);
+  ye = gx_int16_min(ye, height() - 1);
+}
+
+#if GxEPD_DISPLAY_LIST
+void GxEPD::_replayRows(int16_t ys, int16_t ye)
+{
+  ys = gx_int16_max(ys, 0);
+  ye = gx_int16_min(ye, _fb_height - 1);
+  uint16_t color = GxEPD_WHITE;
+  const uint8_t* p = _dl_buffer;
+  const uint8_t* end = _dl_buffer + _dl_used;
+  while (p < end)
+  {
+    switch (*p++)
+    {
+      case dl_color:
+        color = uint16_t(_dlGet16(p));
+        p += 2;
+        // mapped here, per band, the writers get white, black or red and leave the color cache alone
+        if ((_fb_planes > 1) && (color != GxEPD_WHITE) && (color != GxEPD_BLACK) && (color != GxEPD_RED))
+        {
+          static const uint16_t primaries[] = {GxEPD_WHITE, GxEPD_BLACK, GxEPD_RED};
+          color = primaries[_quantizeColor(color)];
+        }
+        break;
+      case dl_pixel:
+        {
+          int16_t y = _dlGet16(p + 2);
+          if ((y >= ys) && (y <= ye)) _pixel_writers[0](this, _dlGet16(p), y, color);
+          p += 4;
         }
-        // transparent mode
-        if (bool(mode & bm_invert) != bool(byte & 0x80))
-        //if (!(byte & 0x80))
+        break;
+      case dl_rect:
         {
-          uint16_t xd = x + i;
-          uint16_t yd = y + j;
-          if (mode & bm_flip_x) xd = x + w - i;
-          if (mode & bm_flip_y) yd = y + h - j;
-          drawPixel(xd, yd, color);
+          int16_t y = _dlGet16(p + 2);
+          int16_t h = _dlGet16(p + 6);
+          int16_t y0 = gx_int16_max(y, ys), y1 = gx_int16_min(y + h - 1, ye);
+          if (y0 <= y1) _rect_writer(this, _dlGet16(p), y0, _dlGet16(p + 4), y1 - y0 + 1, color);
+          p += 8;
         }
+        break;
+      case dl_screen:
+        // the rows only, whole bytes as fillScreen()
+        _rect_writer(this, 0, ys, _fb_row_bytes * 8, ye - ys + 1, color);
+        break;
+      case dl_bits:
+        {
+          int16_t y = _dlGet16(p + 2);
+          if ((y >= ys) && (y <= ye)) _bits_writer(this, _dlGet16(p), y, p[4], p[5], p[6], p[7]);
+          p += 8;
+        }
+        break;
+    }
+  }
+}
+
+void GxEPD::setBandRendering(band_runner runner, uint8_t bands)
+{
+  _band_runner = runner;
+  _bands = bands < 1 ? 1 : (bands > GxEPD_BANDS_MAX ? GxEPD_BANDS_MAX : bands);
+}
+#endif
+
+void GxEPD::drawBands(void (*drawCallback)(void))
+{
+  if (_beginBands())
+  {
+    drawCallback();
+    if (_endBands()) return;
+  }
+  drawCallback();
+}
+
+void GxEPD::drawBands(void (*drawCallback)(const void*), const void* p)
+{
+  if (_beginBands())
+  {
+    drawCallback(p);
+    if (_endBands()) return;
+  }
+  drawCallback(p);
+}
+
+#if GxEPD_DISPLAY_LIST
+bool GxEPD::_beginBands()
+{
+  if ((_dl_state != dl_idle) || (_current_page != -1) || (_page_height < _fb_height)) return false;
+  // past the last page: the drawing is recorded, not written to the buffer
+  _current_page = _pages;
+  _replayPage();
+  return true;
+}
+
+bool GxEPD::_endBands()
+{
+  _endRecording();
+  _current_page = -1;
+  bool ready = (_dl_state == dl_ready);
+  _dl_state = dl_idle;
+  if (!ready) return false;
+  // the workers read the display list and write the buffer rows of their bands; _replayRows() maps the colors for each
+  // band, so they don't use the color cache; dirty tracking would be shared, it is done here
+#if GxEPD_DIRTY_TRACKING
+  bool dirty_tracking = _dirty_tracking;
+  _dirty_tracking = false;
+#endif
+  if (_band_runner) _band_runner(_renderBand, this, _bands);
+  else for (uint8_t i = 0; i < _bands; i++) _renderBand(this, i);
+#if GxEPD_DIRTY_TRACKING
+  _dirty_tracking = dirty_tracking;
+#endif
+  _markDirty(0, 0, WIDTH - 1, HEIGHT - 1);
+  return true;
+}
+
+void GxEPD::_renderBand(void* epd, uint8_t band)
+{
+  GxEPD* self = (GxEPD*) epd;
+  int16_t height = (self->_fb_height + self->_bands - 1) / self->_bands;
+  self->_replayRows(band * height, band * height + height - 1);
+}
+#endif
+
+#if defined(ESP32)
+struct gx_band_job
+{
+  void (*band)(void*, uint8_t);
+  void* arg;
+  uint8_t index;
+  SemaphoreHandle_t done;
+};
+
+static void gx_band_task(void* p)
+{
+  gx_band_job* job = (gx_band_job*) p;
+  job->band(job->arg, job->index);
+  xSemaphoreGive(job->done);
+  vTaskDelete(NULL);
+}
+
+void GxEPD::runBandTasks(void (*band)(void*, uint8_t), void* arg, uint8_t bands)
+{
+  gx_band_job jobs[GxEPD_BANDS_MAX];
+  SemaphoreHandle_t done = xSemaphoreCreateCounting(GxEPD_BANDS_MAX, 0);
+  uint8_t started = 0;
+  for (uint8_t i = 1; i < bands; i++)
+  {
+    jobs[i].band = band;
+    jobs[i].arg = arg;
+    jobs[i].index = i;
+    jobs[i].done = done;
+    if (done && (xTaskCreate(gx_band_task, "GxEPD band", GxEPD_BAND_TASK_STACK, &jobs[i], uxTaskPriorityGet(NULL), NULL) == pdPASS)) started++;
+    else band(arg, i); // no memory for a task, by the caller
+  }
+  band(arg, 0);
+  while (started-- > 0) xSemaphoreTake(done, portMAX_DELAY);
+  if (done) vSemaphoreDelete(done);
+}
+#endif
+
+#if GxEPD_DISPLAY_LIST
+void GxEPD::_endRecording()
+{
+  if (_dl_state == dl_recording) _dl_state = dl_ready;
+}
+#endif
+
+void GxEPD::_endPaged()
+{
+  _current_page = -1;
+#if GxEPD_DISPLAY_LIST
+  if (_dl_state != dl_off) _dl_state = dl_idle;
+#endif
+}
+
+void GxEPD::_setPageHeight(uint16_t rows)
+{
+  _page_height = rows;
+  _pages = rows ? (_fb_height + rows - 1) / rows : 0;
+}
+
+#if GxEPD_PIPELINED_PAGING
+void GxEPD::_beginPipeline()
+{
+  if (!_pipelined || _fb_interleaved || (_page_height < 2)) return;
+  _pipe_size = _fb_size;
+  _pipe_half = 0;
+  _setPageHeight(_page_height / 2);
+  _fb_size = uint32_t(_page_height) * _fb_row_bytes;
+}
+
+#endif
+
+void GxEPD::_sendPage(GxIO& io, uint8_t plane, bool invert, uint8_t fill)
+{
+#if GxEPD_PIPELINED_PAGING
+  if (!_pipe_size)
+#endif
+  {
+    io.startTransaction();
+    _writePlaneData(io, plane, 0, _pageSize(), invert, fill);
+    io.endTransaction();
+    return;
+  }
+#if GxEPD_PIPELINED_PAGING
+  // the previous page is in the other half, it must be sent before the next page is drawn there
+  io.waitQueue();
+  _queueBufferData(io, plane ? _fb_red : _fb_black, _fb_size, _pageSize(), invert, fill);
+  io.startQueue();
+  int32_t offset = _pipe_half ? -int32_t(_fb_size) : int32_t(_fb_size);
+  _fb_black += offset;
+  if (_fb_red) _fb_red += offset;
+  _pipe_half ^= 1;
+#endif
+}
+
+#if GxEPD_PIPELINED_PAGING
+void GxEPD::_endPipeline(GxIO& io)
+{
+  io.waitQueue();
+  if (!_pipe_size) return;
+  if (_pipe_half)
+  {
+    _fb_black -= _fb_size;
+    if (_fb_red) _fb_red -= _fb_size;
+  }
+  _fb_size = _pipe_size;
+  _pipe_size = 0;
+  uint32_t rows = _fb_size / _fb_row_bytes;
+  _setPageHeight(rows < _fb_height ? rows : _fb_height);
+}
+#endif
+
+#if GxEPD_DISPLAY_LIST
+uint8_t* GxEPD::_dlRecord(uint8_t tag, uint16_t color, uint8_t size)
+{
+  uint8_t n = 1 + size + ((color != _dl_color) ? 3 : 0);
+  if (_dl_used + n > _dl_size)
+  {
+    _dl_state = dl_overflow;
+    _dl_used = 0;
+    return 0;
+  }
+  if (color != _dl_color)
+  {
+    _dl_buffer[_dl_used] = dl_color;
+    _dlPut16(_dl_buffer + _dl_used + 1, color);
+    _dl_used += 3;
+    _dl_color = color;
+  }
+  _dl_last = _dl_used;
+  _dl_buffer[_dl_used] = tag;
+  _dl_used += 1 + size;
+  return _dl_buffer + _dl_last + 1;
+}
+
+void GxEPD::_dlPixel(int16_t x, int16_t y, uint16_t color)
+{
+  // a pixel next to the last pixel or line of pixels of the same color extends it, e.g. the pixels of a glyph row
+  uint8_t* r = _dl_buffer + _dl_last;
+  if ((_dl_used > 0) && (color == _dl_color) && ((r[0] == dl_pixel) || (r[0] == dl_rect)))
+  {
+    int16_t rx = _dlGet16(r + 1);
+    int16_t ry = _dlGet16(r + 3);
+    int16_t rw = (r[0] == dl_rect) ? _dlGet16(r + 5) : 1;
+    int16_t rh = (r[0] == dl_rect) ? _dlGet16(r + 7) : 1;
+    bool merged = true;
+    if ((rh == 1) && (y == ry) && ((x == rx - 1) || (x == rx + rw))) rw++;
+    else if ((rw == 1) && (x == rx) && ((y == ry - 1) || (y == ry + rh))) rh++;
+    else merged = false;
+    if (merged && (r[0] == dl_pixel))
+    {
+      if (_dl_used + 4 > _dl_size)
+      {
+        _dl_state = dl_overflow;
+        _dl_used = 0;
+        return;
       }
+      r[0] = dl_rect;
+      _dl_used += 4;
+    }
+    if (merged)
+    {
+      _dlPut16(r + 1, gx_int16_min(rx, x));
+      _dlPut16(r + 3, gx_int16_min(ry, y));
+      _dlPut16(r + 5, rw);
+      _dlPut16(r + 7, rh);
+      return;
+    }
+  }
+  uint8_t* p = _dlRecord(dl_pixel, color, 4);
+  if (!p) return;
+  _dlPut16(p, x);
+  _dlPut16(p + 2, y);
+}
+
+void GxEPD::_dlRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  uint8_t* p = _dlRecord(dl_rect, color, 8);
+  if (!p) return;
+  _dlPut16(p, x);
+  _dlPut16(p + 2, y);
+  _dlPut16(p + 4, w);
+  _dlPut16(p + 6, h);
+}
+
+void GxEPD::_dlScreen(uint16_t color)
+{
+  _dlRecord(dl_screen, color, 0);
+}
+
+void GxEPD::_dlBits(int16_t x, int16_t y, uint8_t bits, uint8_t mask, uint8_t fg, uint8_t bg)
+{
+  uint8_t* p = _dlRecord(dl_bits, _dl_color, 8); // planes bits, no color
+  if (!p) return;
+  _dlPut16(p, x);
+  _dlPut16(p + 2, y);
+  p[4] = bits;
+  p[5] = mask;
+  p[6] = fg;
+  p[7] = bg;
+}
+#endif
+
+void GxEPD::_writeBufferData(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, uint32_t num, bool invert, uint8_t fill)
+{
+  uint32_t n = 0;
+  if (idx < buffer_size) n = (num < buffer_size - idx) ? num : buffer_size - idx;
+  if (n > 0) io.writeData(buffer + idx, n, invert);
+  if (num > n) io.writeDataPattern(fill, num - n);
+  _countFrameBytes(num);
+}
+
+void GxEPD::_writePlaneData(GxIO& io, uint8_t plane, uint32_t idx, uint32_t num, bool invert, uint8_t fill)
+{
+  if (!_fb_interleaved)
+  {
+    _writeBufferData(io, plane ? _fb_red : _fb_black, _fb_size, idx, num, invert, fill);
+    return;
+  }
+  // de-interleaved through a bounce buffer
+  uint32_t n = 0;
+  if (idx < _fb_size) n = (num < _fb_size - idx) ? num : _fb_size - idx;
+  uint8_t mask = invert ? 0xFF : 0x00;
+  uint8_t chunk[GxEPD_PLANE_CHUNK];
+  for (uint32_t end = idx + n; idx < end; )
+  {
+    uint8_t k = (end - idx < sizeof(chunk)) ? end - idx : sizeof(chunk);
+    for (uint8_t j = 0; j < k; j++) chunk[j] = _planeByte(plane, idx + j) ^ mask;
+    io.writeData(chunk, k, false);
+    idx += k;
+  }
+  if (num > n) io.writeDataPattern(fill, num - n);
+  _countFrameBytes(num);
+}
+
+void GxEPD::_queueBufferData(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t num, bool invert, uint8_t fill)
+{
+  uint32_t n = (num < buffer_size) ? num : buffer_size;
+  io.queueData(buffer, n, invert);
+  if (num > n) io.queueDataPattern(fill, num - n);
+  _countFrameBytes(num);
+}
+
+uint8_t GxEPD::_readBitmap(const uint8_t* bitmap, uint32_t idx)
+{
+  if (!_bitmap_reader) return _readBitmapByte(bitmap + idx);
+  uint8_t data = 0x00;
+  _bitmap_reader(_bitmap_reader_arg, bitmap, idx, &data, 1);
+  return data;
+}
+
+void GxEPD::_writeBitmapData(GxIO& io, const uint8_t* bitmap, uint32_t size, uint32_t num, bool invert, uint8_t fill)
+{
+  uint32_t n = (num < size) ? num : size;
+  if (_bitmap_reader)
+  {
+    // e.g. an image file, pulled a chunk at a time
+    uint8_t chunk[GxEPD_READER_CHUNK];
+    for (uint32_t idx = 0; idx < n; )
+    {
+      uint16_t k = gx_uint32_min(n - idx, sizeof(chunk));
+      uint16_t got = _bitmap_reader(_bitmap_reader_arg, bitmap, idx, chunk, k);
+      if (got < k) memset(chunk + got, invert ? ~fill : fill, k - got);
+      io.writeData(chunk, k, invert);
+      idx += k;
+    }
+    if (num > size) io.writeDataPattern(fill, num - size);
+    _countFrameBytes(num);
+    return;
+  }
+#if defined(__AVR) || defined(ESP8266)
+  // program memory is not directly readable (AVR) or only by aligned 32 bit access (ESP8266): copy through a bounce buffer
+  uint8_t mask = invert ? 0xFF : 0x00;
+  uint8_t chunk[GxEPD_BITMAP_CHUNK];
+  while (n > 0)
+  {
+    uint8_t k = (n < sizeof(chunk)) ? n : sizeof(chunk);
+#if defined(ESP8266)
+    memcpy_P(chunk, bitmap, k);
+    for (uint8_t j = 0; j < k; j++) chunk[j] ^= mask;
+#else
+    for (uint8_t j = 0; j < k; j++) chunk[j] = pgm_read_byte(&bitmap[j]) ^ mask;
+#endif
+    io.writeData(chunk, k, false);
+    bitmap += k;
+    n -= k;
+  }
+#else
+  // program memory is mapped (ESP32, ARM): stream the bitmap directly
+  if (n > 0) io.writeData(bitmap, n, invert);
+#endif
+  if (num > size) io.writeDataPattern(fill, num - size);
+  _countFrameBytes(num);
+}
+
+#if GxEPD_ASYNC_UPDATE
+bool GxEPD::updateAsync(void (*callback)(void*), void* arg)
+{
+  if (_async_state != async_idle) return false;
+  _async_started = _asyncPowerOn();
+  if (!_async_started)
+  {
+    update();
+    if (callback) callback(arg);
+    return true;
+  }
+  _async_callback = callback;
+  _async_callback_arg = arg;
+  _async_state = async_power_on;
+  _async_timed_out = false;
+  _async_start = millis();
+  return true;
+}
+
+bool GxEPD::poll()
+{
+  if (_async_state == async_idle) return false;
+  if ((_async_state != async_transfer) && isBusy())
+  {
+    if (millis() - _async_start < GxEPD_ASYNC_BUSY_TIMEOUT) return true;
+    _async_timed_out = true;
+#if GxEPD_OP_STATS
+    _busy_wait_stats.timeouts++;
+#endif
+  }
+  switch (_async_state)
+  {
+    case async_power_on:
+      _async_index = 0;
+      _async_state = async_transfer;
+      // fall through
+    case async_transfer:
+      if (_asyncTransfer()) return true;
+      _asyncRefresh();
+      _async_state = async_refresh;
+      break;
+    case async_refresh:
+      _asyncPowerOff();
+      _async_state = async_power_off;
+      break;
+    case async_power_off:
+      _asyncSleep();
+      _async_state = async_idle;
+      if (_async_callback) _async_callback(_async_callback_arg);
+      return false;
+  }
+  _async_start = millis();
+  return true;
+}
+
+void GxEPD::_finishAsync()
+{
+  while (poll())
+  {
+    if (isBusy()) delay(1);
+  }
+}
+
+#else
+
+bool GxEPD::updateAsync(void (*callback)(void*), void* arg)
+{
+  update();
+  if (callback) callback(arg);
+  return true;
+}
+
+#endif
+
+#if !defined(ESP8266) && !defined(ESP32)
+GxEPD* volatile GxEPD::_busy_waiters[GxEPD_BUSY_WAITERS] = {0, 0};
+#endif
+
+void GxEPD::setBusyWait(busy_wait_mode mode, void (*hook)(int8_t, uint8_t))
+{
+  _busy_wait_mode = ((mode == busy_wait_hook) && !hook) ? busy_wait_polling : mode;
+  _busy_wait_hook = hook;
+}
+
+#if GxEPD_OP_STATS
+
+void GxEPD::resetBusyWaitStats()
+{
+  memset(&_busy_wait_stats, 0, sizeof(_busy_wait_stats));
+}
+
+void GxEPD::_countBusyWait(bool ok, uint32_t polls, uint32_t busy_time, uint32_t latency)
+{
+  _busy_wait_stats.waits++;
+  _busy_wait_stats.polls += polls;
+  if (!ok) _busy_wait_stats.timeouts++;
+  _busy_wait_stats.busy_time += busy_time;
+  _busy_wait_stats.last_latency = latency;
+  if (latency > _busy_wait_stats.max_latency) _busy_wait_stats.max_latency = latency;
+}
+
+#endif
+
+#if GxEPD_OP_STATS
+
+const GxEPD::op_stats& GxEPD::opStats(op_type op)
+{
+  return _op_stats[op];
+}
+
+void GxEPD::getOpStats(op_stats snapshot[op_types])
+{
+  memcpy(snapshot, _op_stats, sizeof(_op_stats));
+}
+
+void GxEPD::resetOpStats()
+{
+  memset(_op_stats, 0, sizeof(_op_stats));
+}
+
+void GxEPD::setOpStatsSink(void (*sink)(op_type, const op_stats&, void*), void* arg)
+{
+  _op_sink = sink;
+  _op_sink_arg = arg;
+}
+
+void GxEPD::_beginOp(GxIO& io, op_type op)
+{
+  if (_op_depth++ > 0) return; // nested, counts to the outer operation
+  _op_current = op;
+  _op_io_start = io.ioStats();
+  _op_busy_waits_start = _busy_wait_stats.waits;
+  _op_busy_time_start = _busy_wait_stats.busy_time;
+  _op_start = millis();
+}
+
+void GxEPD::_endOp(GxIO& io)
+{
+  if ((_op_depth == 0) || (--_op_depth > 0)) return;
+  const GxIO::io_stats& io_stats = io.ioStats();
+  op_stats cost;
+  cost.count = 1;
+  cost.commands = io_stats.commands - _op_io_start.commands;
+  cost.data_bytes = io_stats.data_bytes - _op_io_start.data_bytes;
+  cost.transactions = io_stats.transactions - _op_io_start.transactions;
+  cost.busy_waits = _busy_wait_stats.waits - _op_busy_waits_start;
+  cost.busy_time = _busy_wait_stats.busy_time - _op_busy_time_start;
+  cost.time = millis() - _op_start;
+  op_stats& total = _op_stats[_op_current];
+  total.count++;
+  total.commands += cost.commands;
+  total.data_bytes += cost.data_bytes;
+  total.transactions += cost.transactions;
+  total.busy_waits += cost.busy_waits;
+  total.busy_time += cost.busy_time;
+  total.time += cost.time;
+  if (_op_sink) _op_sink(op_type(_op_current), cost, _op_sink_arg);
+}
+
+#endif
+
+GxEPD_ISR_ATTR void GxEPD::_busyEdgeISR(void* epd)
+{
+  GxEPD* self = (GxEPD*) epd;
+  self->_busy_edge_time = micros();
+  self->_busy_edge = true;
+#if defined(ESP32)
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR((TaskHandle_t) self->_busy_task, &woken);
+  if (woken) portYIELD_FROM_ISR();
+#endif
+}
+
+#if !defined(ESP8266) && !defined(ESP32)
+
+GxEPD_ISR_ATTR void GxEPD::_busyEdgeISR0()
+{
+  if (_busy_waiters[0]) _busyEdgeISR(_busy_waiters[0]);
+}
+
+GxEPD_ISR_ATTR void GxEPD::_busyEdgeISR1()
+{
+  if (_busy_waiters[1]) _busyEdgeISR(_busy_waiters[1]);
+}
+
+#endif
+
+bool GxEPD::_attachBusyEdge(int irq, int mode)
+{
+  _busy_edge = false;
+#if defined(ESP8266) || defined(ESP32)
+#if defined(ESP32)
+  _busy_task = xTaskGetCurrentTaskHandle();
+  ulTaskNotifyTake(pdTRUE, 0); // drop a notification left from before
+#endif
+  attachInterruptArg(irq, _busyEdgeISR, this, mode);
+  return true;
+#else
+  void (*const isrs[GxEPD_BUSY_WAITERS])() = {_busyEdgeISR0, _busyEdgeISR1};
+  for (uint8_t i = 0; i < GxEPD_BUSY_WAITERS; i++)
+  {
+    if (_busy_waiters[i]) continue;
+    _busy_waiters[i] = this;
+    attachInterrupt(irq, isrs[i], mode);
+    return true;
+  }
+  return false;
+#endif
+}
+
+void GxEPD::_detachBusyEdge(int irq)
+{
+  detachInterrupt(irq);
+#if !defined(ESP8266) && !defined(ESP32)
+  for (uint8_t i = 0; i < GxEPD_BUSY_WAITERS; i++)
+  {
+    if (_busy_waiters[i] == this) _busy_waiters[i] = 0;
+  }
+#endif
+}
+
+bool GxEPD::_waitBusy(int8_t pin, uint8_t busy_level, uint32_t timeout)
+{
+  if (pin < 0) return true;
+  uint32_t start = micros();
+  uint32_t last_busy = start;
+  uint32_t polls = 0;
+  bool ok = true;
+  bool edge_used = false;
+  if (_busy_wait_mode == busy_wait_interrupt)
+  {
+    int irq = digitalPinToInterrupt(pin);
+    if (irq >= 0) edge_used = _attachBusyEdge(irq, busy_level ? FALLING : RISING);
+  }
+  while (1)
+  {
+    if (edge_used && _busy_edge) break;
+    polls++;
+    if (digitalRead(pin) != busy_level) break;
+    last_busy = micros();
+    if (last_busy - start > timeout)
+    {
+      ok = false;
+      break;
     }
+    if (_busy_wait_mode == busy_wait_hook) _busy_wait_hook(pin, busy_level);
+    else if (edge_used)
+    {
+#if defined(__arm__)
+      __WFI(); // any interrupt wakes, systick at latest
+#elif defined(ESP32)
+      ulTaskNotifyTake(pdTRUE, 1); // blocks until notified by the edge, a tick at latest
+#elif defined(__AVR)
+      set_sleep_mode(SLEEP_MODE_IDLE);
+      sleep_mode(); // any interrupt wakes, timer 0 within about 1 ms
+#else
+      delay(1);
+#endif
+    }
+    else delay(1);
+  }
+  uint32_t end = micros();
+  if (edge_used)
+  {
+    _detachBusyEdge(digitalPinToInterrupt(pin));
+    if (_busy_edge) last_busy = _busy_edge_time;
   }
+  _countBusyWait(ok, polls, end - start, end - last_busy);
+  return ok;
+}
+
+#if GxEPD_DIRTY_TRACKING
+bool GxEPD::getDirtyRect(uint8_t i, uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
+{
+  if (i >= _dirty_count) return false;
+  x = _dirty_rects[i].x0;
+  y = _dirty_rects[i].y0;
+  w = _dirty_rects[i].x1 - _dirty_rects[i].x0 + 1;
+  h = _dirty_rects[i].y1 - _dirty_rects[i].y0 + 1;
+  return true;
+}
+
+void GxEPD::updateDirty()
+{
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    dirty_rect& r = _dirty_rects[i];
+    updateWindow(r.x0, r.y0, r.x1 - r.x0 + 1, r.y1 - r.y0 + 1, false);
+  }
+  _dirty_count = 0;
+}
+
+uint8_t GxEPD::_dirtyWindows(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes)
+{
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    const dirty_rect& r = _dirty_rects[i];
+    uint16_t xs = r.x0 / 8, xe = r.x1 / 8;
+    uint16_t ys = _fb_flip_y ? HEIGHT - 1 - r.y1 : r.y0;
+    uint16_t ye = _fb_flip_y ? HEIGHT - 1 - r.y0 : r.y1;
+    if (!_diffWindow(buffer, buffer_size, row_bytes, xs, xe, ys, ye)) continue; // unchanged
+    dirty_rect& w = _dirty_rects[n++];
+    w.x0 = xs;
+    w.y0 = ys;
+    w.x1 = xe;
+    w.y1 = ye;
+  }
+  _dirty_count = n;
+  return n;
+}
+
+void GxEPD::_dirtyWindowsSent(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes)
+{
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    const dirty_rect& w = _dirty_rects[i];
+    _updateShadow(buffer, buffer_size, row_bytes, w.x0, w.x1, w.y0, w.y1);
+  }
+  _dirty_count = 0;
+}
+
+static inline int32_t _dirtyArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  return int32_t(x1 - x0 + 1) * int32_t(y1 - y0 + 1);
+}
+
+void GxEPD::_addDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  x0 &= ~7; // byte boundary
+  x1 |= 7;
+  if (x1 >= WIDTH) x1 = WIDTH - 1;
+  if (y1 >= HEIGHT) y1 = HEIGHT - 1;
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    dirty_rect& r = _dirty_rects[i];
+    if ((x0 >= r.x0) && (x1 <= r.x1) && (y0 >= r.y0) && (y1 <= r.y1)) return; // already dirty
+  }
+  if (_dirty_count < GxEPD_DIRTY_RECTS) _dirty_count++;
   else
   {
-    for (int16_t j = 0; j < h; j++)
+    // full, merge into last, may be merged further below
+    dirty_rect& r = _dirty_rects[GxEPD_DIRTY_RECTS - 1];
+    x0 = gx_int16_min(x0, r.x0);
+    y0 = gx_int16_min(y0, r.y0);
+    x1 = gx_int16_max(x1, r.x1);
+    y1 = gx_int16_max(y1, r.y1);
+  }
+  dirty_rect& n = _dirty_rects[_dirty_count - 1];
+  n.x0 = x0;
+  n.y0 = y0;
+  n.x1 = x1;
+  n.y1 = y1;
+  // merge pairs while the union adds less unchanged pixels than the cost of a rectangle, or overlaps
+  int32_t rect_cost = _dirtyCost();
+  bool merged = true;
+  while (merged && (_dirty_count > 1))
+  {
+    merged = false;
+    int32_t best_cost = rect_cost;
+    uint8_t bi = 0, bj = 0;
+    for (uint8_t i = 0; i < _dirty_count; i++)
     {
-      for (int16_t i = 0; i < w; i++ )
+      for (uint8_t j = i + 1; j < _dirty_count; j++)
       {
-        if (i & 7) byte <<= 1;
-        else
+        dirty_rect& a = _dirty_rects[i];
+        dirty_rect& b = _dirty_rects[j];
+        int32_t cost = _dirtyArea(gx_int16_min(a.x0, b.x0), gx_int16_min(a.y0, b.y0), gx_int16_max(a.x1, b.x1), gx_int16_max(a.y1, b.y1))
+                       - _dirtyArea(a.x0, a.y0, a.x1, a.y1) - _dirtyArea(b.x0, b.y0, b.x1, b.y1);
+        if ((a.x0 <= b.x1) && (b.x0 <= a.x1) && (a.y0 <= b.y1) && (b.y0 <= a.y1)) cost = -1; // overlap
+        if (cost < best_cost)
         {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          byte = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
-#else
-          byte = bitmap[j * byteWidth + i / 8];
-#endif
+          best_cost = cost;
+          bi = i;
+          bj = j;
+          merged = true;
         }
-        // keep using overwrite mode
-        uint16_t pixelcolor = (byte & 0x80) ? fg_color  : bg_color;
-        uint16_t xd = x + i;
-        uint16_t yd = y + j;
-        if (mode & bm_flip_x) xd = x + w - i;
-        if (mode & bm_flip_y) yd = y + h - j;
-        drawPixel(xd, yd, pixelcolor);
       }
     }
+    if (merged)
+    {
+      dirty_rect& a = _dirty_rects[bi];
+      dirty_rect& b = _dirty_rects[bj];
+      a.x0 = gx_int16_min(a.x0, b.x0);
+      a.y0 = gx_int16_min(a.y0, b.y0);
+      a.x1 = gx_int16_max(a.x1, b.x1);
+      a.y1 = gx_int16_max(a.y1, b.y1);
+      b = _dirty_rects[_dirty_count - 1];
+      _dirty_count--;
+    }
   }
 }
+#endif
 
+#if GxEPD_SHADOW_BUFFER
+void GxEPD::_setShadow(const uint8_t* buffer, uint32_t buffer_size, uint32_t frame_size)
+{
+  _shadow_valid = false;
+  if (!_shadow || (_shadow_size < frame_size)) return;
+  uint32_t n = (buffer_size < frame_size) ? buffer_size : frame_size;
+  memcpy(_shadow, buffer, n);
+  memset(_shadow + n, 0x00, frame_size - n); // white is 0x00 in buffer
+  _shadow_valid = true;
+}
 
+bool GxEPD::_diffWindow(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes, uint16_t& xs, uint16_t& xe, uint16_t& ys, uint16_t& ye)
+{
+  if (!_shadow_valid) return true;
+  uint16_t dxs = xe, dxe = xs, dys = ye, dye = ys;
+  bool changed = false;
+  for (uint16_t y1 = ys; y1 <= ye; y1++)
+  {
+    uint32_t row = uint32_t(y1) * row_bytes;
+    for (uint16_t x1 = xs; x1 <= xe; x1++)
+    {
+      uint8_t data = (row + x1 < buffer_size) ? buffer[row + x1] : 0x00;
+      if (data == _shadow[row + x1]) continue;
+      changed = true;
+      if (x1 < dxs) dxs = x1;
+      if (x1 > dxe) dxe = x1;
+      if (y1 < dys) dys = y1;
+      dye = y1;
+    }
+  }
+  if (!changed) return false;
+  xs = dxs;
+  xe = dxe;
+  ys = dys;
+  ye = dye;
+  return true;
+}
+
+void GxEPD::_updateShadow(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  if (!_shadow_valid) return;
+  for (uint16_t y1 = ys; y1 <= ye; y1++)
+  {
+    uint32_t row = uint32_t(y1) * row_bytes;
+    for (uint16_t x1 = xs; x1 <= xe; x1++)
+    {
+      _shadow[row + x1] = (row + x1 < buffer_size) ? buffer[row + x1] : 0x00;
+    }
+  }
+}
+#endif
+
+bool GxEPD::_rotateRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h)
+{
+  if (w < 0)
+  {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0)
+  {
+    y += h + 1;
+    h = -h;
+  }
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if (x + w > width()) w = width() - x;
+  if (y + h > height()) h = height() - y;
+  if ((w <= 0) || (h <= 0)) return false;
+  int16_t t;
+  switch (getRotation())
+  {
+    case 1:
+      t = x;
+      x = WIDTH - y - h;
+      y = t;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    case 2:
+      x = WIDTH - x - w;
+      y = HEIGHT - y - h;
+      break;
+    case 3:
+      t = y;
+      y = HEIGHT - x - w;
+      x = t;
+      t = w;
+      w = h;
+      h = t;
+      break;
+  }
+  return true;
+}
+
+void GxEPD::setColorThresholds(uint8_t white_level, uint8_t red_level)
+{
+  _white_level = white_level;
+  _red_level = red_level;
+  _color_thresholds = true;
+  _color_cache = uint32_t(GxEPD_WHITE) << 16;
+#if GxEPD_COLOR_TABLE_BITS
+  const uint8_t bits = GxEPD_COLOR_TABLE_BITS;
+  const uint8_t mask = (1 << bits) - 1;
+  const uint16_t colors = 1 << (3 * bits);
+  if (!_color_table) _color_table = (uint8_t*) malloc(colors / 4);
+  if (!_color_table) return; // thresholds per color
+  memset(_color_table, 0, colors / 4);
+  for (uint16_t i = 0; i < colors; i++)
+  {
+    // the color in the middle of the cell of index i
+    uint16_t r = ((i >> (2 * bits)) << (5 - bits)) | ((1 << (5 - bits)) >> 1);
+    uint16_t g = (((i >> bits) & mask) << (6 - bits)) | ((1 << (6 - bits)) >> 1);
+    uint16_t b = ((i & mask) << (5 - bits)) | ((1 << (5 - bits)) >> 1);
+    _color_table[i / 4] |= _classifyColor((r << 11) | (g << 5) | b) << (2 * (i % 4));
+  }
+#endif
+}
+
+void GxEPD::resetColorThresholds()
+{
+  _color_thresholds = false;
+  _color_cache = uint32_t(GxEPD_WHITE) << 16;
+  free(_color_table);
+  _color_table = 0;
+}
+
+uint8_t GxEPD::_quantizeColor(uint16_t color)
+{
+#if GxEPD_COLOR_TABLE_BITS
+  if (_color_table)
+  {
+    const uint8_t bits = GxEPD_COLOR_TABLE_BITS;
+    const uint8_t mask = (1 << bits) - 1;
+    uint16_t i = ((color >> (16 - bits)) << (2 * bits)) | (((color >> (11 - bits)) & mask) << bits) | ((color >> (5 - bits)) & mask);
+    return (_color_table[i / 4] >> (2 * (i % 4))) & 0x03;
+  }
+#endif
+  return _classifyColor(color);
+}
+
+uint8_t GxEPD::_classifyColor(uint16_t color)
+{
+  if (!_color_thresholds) return (color & 0x8000) ? 0x02 : 0x01;
+  // RGB565 to RGB888, low bits repeated
+  uint8_t r = (color >> 8) & 0xF8;
+  uint8_t g = (color >> 3) & 0xFC;
+  uint8_t b = color << 3;
+  r |= r >> 5;
+  g |= g >> 6;
+  b |= b >> 5;
+  if (((uint16_t(r) * 77 + uint16_t(g) * 150 + uint16_t(b) * 29) >> 8) >= _white_level) return 0x00;
+  uint8_t m = (g > b) ? g : b;
+  if ((r > m) && (r - m >= _red_level)) return 0x02;
+  return 0x01;
+}
@@ -18,6 +18,7 @@
 #include "GxIO/GxIO.h"
 #include <Adafruit_GFX.h>
 #include "GxFont_GFX.h"
+#include "GxFrameBuffer.h"
 
 // the only colors supported by any of these displays; mapping of other colors is class specific
 #define GxEPD_BLACK     0x0000
@@ -26,6 +27,129 @@
 #define GxEPD_WHITE     0xFFFF
 #define GxEPD_RED       0xF800      /* 255,   0,   0 */
 
+#if defined(ESP8266) || defined(ESP32)
+#define GxEPD_ISR_ATTR ICACHE_RAM_ATTR
+#else
+#define GxEPD_ISR_ATTR
+#endif
+
+// number of dirty rectangles kept for updateDirty()
+#define GxEPD_DIRTY_RECTS 4
+// instances in a busy_wait_interrupt wait at a time, further ones wait by polling (not ESP8266, ESP32)
+#define GxEPD_BUSY_WAITERS 2
+// cost of one more dirty rectangle in pixels sent, rectangles are merged if this adds less unchanged pixels:
+// its controller RAM area setup for classes that refresh once for all (GxGDEW042T2, SSD1608 classes),
+// a partial refresh of about 300 ms at 4 MHz SPI for classes that refresh per rectangle
+#define GxEPD_DIRTY_WINDOW_COST 256
+#define GxEPD_DIRTY_REFRESH_COST 1200000L
+
+// most bands of band rendering, see GxEPD::setBandRendering()
+#define GxEPD_BANDS_MAX 4
+#if defined(ESP32)
+// stack of the band tasks of GxEPD::runBandTasks(), bytes
+#define GxEPD_BAND_TASK_STACK 2048
+#endif
+
+// BUSY timeout for the asynchronous update state machine, ms, as the longest of the blocking waits (GxGDEW075Z09)
+#define GxEPD_ASYNC_BUSY_TIMEOUT 40000
+// buffer bytes sent per poll() by classes that convert pixels while sending
+#define GxEPD_ASYNC_CHUNK 1024
+
+// bounce buffer of bitmap bytes copied from program memory per SPI block write, AVR and ESP8266
+#define GxEPD_BITMAP_CHUNK 32
+// bitmap bytes pulled per SPI block write from a bitmap reader, see GxEPD::setBitmapReader()
+#if defined(__AVR)
+#define GxEPD_READER_CHUNK 32
+#else
+#define GxEPD_READER_CHUNK 256
+#endif
+
+// frame buffer on the heap, allocated by init() from a budget or the free heap, see GxEPD::setFrameBufferBudget()
+// 0 : the buffers are members of the display classes, sized by their _PAGES divisor on AVR; the default on AVR
+#ifndef GxEPD_HEAP_BUFFER
+#if defined(__AVR)
+#define GxEPD_HEAP_BUFFER 0
+#else
+#define GxEPD_HEAP_BUFFER 1
+#endif
+#endif
+// black and red planes of the 3-color classes interleaved in one buffer, 2 bits per pixel, see GxFB_INTERLEAVED
+// a pixel is written by one masked byte write, the planes are de-interleaved while sent; same memory
+// 0 : separate planes, as sent to the controllers
+#ifndef GxEPD_INTERLEAVED_3C
+#define GxEPD_INTERLEAVED_3C 0
+#endif
+// plane bytes de-interleaved per block write, see GxEPD_INTERLEAVED_3C
+#define GxEPD_PLANE_CHUNK 32
+
+// bits per RGB565 component of the color table of the 3-color classes, allocated per display by GxEPD::setColorThresholds(), at most 4;
+// opt-in, the default mapping uses no table
+// the table holds the plane bits of 2^(3 * bits) colors, 2 bits each, 1024 bytes for 4; 0 : no table, thresholds per color
+#ifndef GxEPD_COLOR_TABLE_BITS
+#if defined(__AVR)
+#define GxEPD_COLOR_TABLE_BITS 0
+#else
+#define GxEPD_COLOR_TABLE_BITS 4
+#endif
+#endif
+
+// free heap left by the frame buffer if no budget is set, bytes
+#if defined(__AVR)
+#define GxEPD_HEAP_RESERVE 256
+#else
+#define GxEPD_HEAP_RESERVE 8192
+#endif
+
+// operation and BUSY wait statistics, frame bytes sent, see GxEPD::opStats(); off on AVR to save RAM
+#if defined(__AVR)
+#define GxEPD_OP_STATS 0
+#else
+#define GxEPD_OP_STATS 1
+#endif
+
+// the optional features below and GxEPD_OP_STATS are off on AVR to save RAM; when off, their methods are deleted,
+// a sketch calling them doesn't compile, except updateAsync() as noted
+// dirty rectangle tracking, see GxEPD::setDirtyTracking()
+#ifndef GxEPD_DIRTY_TRACKING
+#if defined(__AVR)
+#define GxEPD_DIRTY_TRACKING 0
+#else
+#define GxEPD_DIRTY_TRACKING 1
+#endif
+#endif
+// shadow frame, see GxEPD::setShadowBuffer(); off : partial updates send their whole window
+#ifndef GxEPD_SHADOW_BUFFER
+#if defined(__AVR)
+#define GxEPD_SHADOW_BUFFER 0
+#else
+#define GxEPD_SHADOW_BUFFER 1
+#endif
+#endif
+// asynchronous update, see GxEPD::updateAsync(); off : updateAsync() is a blocking update()
+#ifndef GxEPD_ASYNC_UPDATE
+#if defined(__AVR)
+#define GxEPD_ASYNC_UPDATE 0
+#else
+#define GxEPD_ASYNC_UPDATE 1
+#endif
+#endif
+// display list and band rendering, see GxEPD::setDisplayList(); off : drawBands() draws directly
+#ifndef GxEPD_DISPLAY_LIST
+#if defined(__AVR)
+#define GxEPD_DISPLAY_LIST 0
+#else
+#define GxEPD_DISPLAY_LIST 1
+#endif
+#endif
+// pipelined paged drawing, see GxEPD::setPipelinedPaging()
+#ifndef GxEPD_PIPELINED_PAGING
+#if defined(__AVR)
+#define GxEPD_PIPELINED_PAGING 0
+#else
+#define GxEPD_PIPELINED_PAGING 1
+#endif
+#endif
+
 //class GxEPD : public Adafruit_GFX
 class GxEPD : public GxFont_GFX
 {
@@ -46,14 +170,94 @@ class GxEPD : public GxFont_GFX
       bm_invert_red = (1 << 7),
       bm_transparent = (1 << 8)
     };
+    // how the blocking methods wait while the controller is BUSY
+    enum busy_wait_mode
+    {
+      busy_wait_polling = 0, // digitalRead() and delay(1), default
+      busy_wait_interrupt = 1, // pin change interrupt, blocks in between: __WFI() on ARM, task notification on ESP32, idle sleep on AVR, else delay(1)
+      busy_wait_hook = 2 // hook called while BUSY, e.g. to enter light sleep until the pin changes
+    };
+    // statistics of BUSY waits, times in us, latency is time from BUSY release (or last busy poll) to return
+    struct busy_wait_stats
+    {
+      uint32_t waits;
+      uint32_t polls;
+      uint32_t timeouts;
+      uint32_t busy_time;
+      uint32_t last_latency;
+      uint32_t max_latency;
+    };
+    // operations of the display classes, counted by opStats()
+    enum op_type
+    {
+      op_full_update = 0, // update(), full screen drawBitmap() and drawPicture()
+      op_partial_update = 1, // updateWindow(), updateToWindow(), drawBitmap() with bm_partial_update
+      op_erase = 2, // eraseDisplay()
+      op_paged_draw = 3, // drawPaged(), drawPagedToWindow()
+      op_types = 4
+    };
+    // cost of the operations of one type, transfers as counted by GxIO, busy_time in us as busy_wait_stats, time in ms
+    struct op_stats
+    {
+      uint32_t count;
+      uint32_t commands;
+      uint32_t data_bytes;
+      uint32_t transactions;
+      uint32_t busy_waits;
+      uint32_t busy_time;
+      uint32_t time;
+    };
   public:
     //GxEPD(int16_t w, int16_t h) : Adafruit_GFX(w, h) {};
-    GxEPD(int16_t w, int16_t h) : GxFont_GFX(w, h) {};
+    GxEPD(int16_t w, int16_t h) : GxFont_GFX(w, h), _color_cache(uint32_t(GxEPD_WHITE) << 16), _color_thresholds(false), _white_level(0), _red_level(0), _color_table(0), _current_page(-1), _fb_black(0), _fb_red(0), _fb_size(0), _fb_planes(0), _fb_interleaved(false), _pixel_writer(0), _bits_writer(0), _rect_writer(0), _pixel_writers(0), _page_height(0), _pages(0), _busy_edge(false), _busy_edge_time(0), _busy_wait_mode(busy_wait_polling), _busy_wait_hook(0), _bitmap_reader(0), _bitmap_reader_arg(0), _bitmap_reader_as_sent(true)
+    {
+#if GxEPD_OP_STATS
+      resetBusyWaitStats();
+      resetOpStats();
+      setOpStatsSink(0);
+      _op_depth = 0;
+      _frame_bytes_sent = 0;
+#endif
+#if GxEPD_DIRTY_TRACKING
+      _dirty_tracking = false;
+      _dirty_count = 0;
+#endif
+#if GxEPD_HEAP_BUFFER
+      _fb_budget = 0;
+#endif
+#if GxEPD_PIPELINED_PAGING
+      _pipelined = false;
+      _pipe_size = 0;
+      _pipe_half = 0;
+#endif
+#if GxEPD_DISPLAY_LIST
+      setDisplayList(0, 0);
+      _band_runner = 0;
+      _bands = 1;
+#endif
+#if GxEPD_SHADOW_BUFFER
+      setShadowBuffer(0, 0);
+#endif
+#if GxEPD_ASYNC_UPDATE
+      _async_state = async_idle;
+      _async_timed_out = false;
+      _async_started = false;
+      _async_index = 0;
+      _async_start = 0;
+      _async_callback = 0;
+      _async_callback_arg = 0;
+#endif
+    };
     virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    // selects the pixel writer for the rotation
+    void setRotation(uint8_t r);
+    // drawPixel() switching on the rotation for each pixel, as before setRotation() selected a writer, until disabled;
+    // the reference of examples/PixelBenchmark
+    void setPixelSwitch(bool enable);
     virtual void init(uint32_t serial_diag_bitrate = 0) = 0; // = 0 : disabled
     virtual void fillScreen(uint16_t color) = 0; // to buffer
     virtual void update(void) = 0;
-    // to buffer, may be cropped, drawPixel() used, update needed, subclass may support some modes
+    // to buffer, may be cropped, update needed, subclass may support some modes, see drawBitmapBM()
     virtual void drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t m = bm_normal) = 0;
     // to buffer, may be cropped, drawPixel() used, update needed, subclass may support some modes, default for example bitmaps
     virtual void drawExampleBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t m = bm_default)
@@ -75,13 +279,594 @@ class GxEPD : public GxFont_GFX
     {
       drawBitmap(bitmap, size, m);
     };
+    // source of the bitmap bytes of the full screen drawBitmap() and drawPicture() while set, instead of program memory,
+    // for images streamed to the controller, see GxEPDImage; reader(arg, bitmap, idx, buffer, n) reads n bytes from index
+    // idx of bitmap to buffer, returns the bytes read, the rest is sent as fill; the bitmap pointers are only passed on
+    // while set; as_sent : the bytes are in the format sent to the controller: 4 bit per pixel for the IL0371 classes,
+    // 2 bit per pixel black for GxGDEW0154Z04; else they are bitmaps as in program memory, converted as those, and
+    // also read by drawBitmap() to buffer, e.g. packed bitmaps, see GxPackedBitmap; 0 : program memory
+    typedef uint16_t (*bitmap_reader)(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n);
+    void setBitmapReader(bitmap_reader reader, void* arg = 0, bool as_sent = true)
+    {
+      _bitmap_reader = reader;
+      _bitmap_reader_arg = arg;
+      _bitmap_reader_as_sent = as_sent;
+    };
     virtual void eraseDisplay(bool using_partial_update = false) {};
+    // 8 pixels of row y from x to buffer, leftmost in bit 7, red over black over white, pixels not in mask unchanged
+    // written packed where the rotation maps rows to controller rows, for image decoders, see GxDither
+    void drawPlaneBits(int16_t x, int16_t y, uint8_t black, uint8_t red, uint8_t mask = 0xFF);
     // partial update of rectangle from buffer to screen, does not power off
     virtual void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) {};
+    // mapping of colors other than GxEPD_WHITE, GxEPD_BLACK and GxEPD_RED by the 3-color classes, levels of RGB888 0..255:
+    // white if the luminance is at least white_level, else red if red exceeds green and blue by at least red_level, else black
+    // per display instance; default, and after resetColorThresholds(): red if red is 16 or more of 31, else black
+    // the default is a bit test; the color table and the cache of the last color serve set thresholds only
+    void setColorThresholds(uint8_t white_level, uint8_t red_level);
+    void resetColorThresholds();
+    // dirty rectangle tracking, off by default; drawing to buffer marks byte aligned regions (controller coordinates)
+    // partial update of the regions drawn since last updateDirty() or clearDirty(), does not power off
+    // one refresh for all regions on GxGDEW042T2 and the SSD1608 classes, else a partial update per region
+#if GxEPD_DIRTY_TRACKING
+    void setDirtyTracking(bool enable) {_dirty_tracking = enable; _dirty_count = 0;};
+    void clearDirty() {_dirty_count = 0;};
+    uint8_t dirtyCount() {return _dirty_count;};
+    bool getDirtyRect(uint8_t i, uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
+    virtual void updateDirty();
+#else
+    void setDirtyTracking(bool enable) = delete;
+    void clearDirty() = delete;
+    uint8_t dirtyCount() = delete;
+    bool getDirtyRect(uint8_t i, uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h) = delete;
+    void updateDirty() = delete;
+#endif
+    // optional copy of the frame last sent to the controller, for partial update of changed bytes only
+    // size: buffer size of the display class (full frame), 0 or too small disables; supported by partial update b/w classes
+    // the window is shrunk to the one rectangle bounding the changed bytes, unchanged bytes inside it are still sent;
+    // for several changed areas use updateDirty()
+#if GxEPD_SHADOW_BUFFER
+    void setShadowBuffer(uint8_t* shadow, uint32_t size) {_shadow = shadow; _shadow_size = size; _shadow_valid = false;};
+#else
+    void setShadowBuffer(uint8_t* shadow, uint32_t size) = delete;
+#endif
+    // buffer bytes sent to the controller, to compare the cost of update methods
+    // with a shadow buffer: the bytes of the rectangle bounding the changes, not only the changed bytes
+#if GxEPD_OP_STATS
+    uint32_t frameBytesSent() {return _frame_bytes_sent;};
+    void resetFrameBytesSent() {_frame_bytes_sent = 0;};
+#else
+    uint32_t frameBytesSent() = delete;
+    void resetFrameBytesSent() = delete;
+#endif
+    // non-blocking full update from buffer: power on, transfer, refresh, power off, advanced by poll()
+    // callback is called on completion; the buffer must not be changed before completion
+    // classes without support do a blocking update() and call callback before returning
+    // returns false while an asynchronous update is in progress; the blocking methods complete it first
+    // only full updates of GxGDEW042T2, GxGDEW042Z15, GxGDEW0583T7, GxGDEW075T8 and GxGDEW075Z09 are asynchronous,
+    // not the first update after init() of GxGDEW042T2, nor during paged drawing; see isAsync()
+    bool updateAsync(void (*callback)(void*) = 0, void* arg = 0);
+#if GxEPD_ASYNC_UPDATE
+    // the last updateAsync() started an asynchronous update, false if it did a blocking update()
+    bool isAsync() {return _async_started;};
+    bool poll(); // returns true while an asynchronous update is in progress
+    bool isUpdating() {return _async_state != async_idle;};
+    // the last asynchronous update went on after BUSY for GxEPD_ASYNC_BUSY_TIMEOUT, also counted in busyWaitStats()
+    bool asyncTimedOut() {return _async_timed_out;};
+#else
+    bool isAsync() {return false;};
+    bool poll() = delete;
+    bool isUpdating() = delete;
+    bool asyncTimedOut() = delete;
+#endif
+    virtual bool isBusy() {return false;}; // controller BUSY active
+    virtual const char* panelName() {return "";}; // the panel of the display class, as epdconv -p, e.g. "GDEW042T2"
+    // hook(busy_pin, busy_level) is called repeatedly while BUSY for busy_wait_hook, should return on pin change or soon
+    void setBusyWait(busy_wait_mode mode, void (*hook)(int8_t, uint8_t) = 0);
+#if GxEPD_OP_STATS
+    const busy_wait_stats& busyWaitStats() {return _busy_wait_stats;};
+    void resetBusyWaitStats();
+    // accumulated cost per operation type, nested operations (e.g. erase by updateWindow) count to the outer one
+    const op_stats& opStats(op_type op);
+    void getOpStats(op_stats snapshot[op_types]);
+    void resetOpStats();
+    // sink(op, cost, arg) is called at the end of each operation with its own cost, count 1
+    void setOpStatsSink(void (*sink)(op_type, const op_stats&, void*), void* arg = 0);
+#else
+    const busy_wait_stats& busyWaitStats() = delete;
+    void resetBusyWaitStats() = delete;
+    const op_stats& opStats(op_type op) = delete;
+    void getOpStats(op_stats snapshot[op_types]) = delete;
+    void resetOpStats() = delete;
+    void setOpStatsSink(void (*sink)(op_type, const op_stats&, void*), void* arg = 0) = delete;
+#endif
+    // display list for paged drawing: the drawing of the first page drawn is recorded to buffer and replayed for the
+    // other pages, drawCallback() is called once; if it doesn't fit, drawCallback() is called for each page as without
+    // records are 3 to 9 bytes, runs of pixels are merged; bitmaps drawn must stay valid, they are recorded as drawn
+#if GxEPD_DISPLAY_LIST
+    void setDisplayList(uint8_t* buffer, uint32_t size);
+    uint32_t displayListUsed() {return _dl_used;}; // bytes recorded by the last paged drawing, 0 if it didn't fit
+#else
+    void setDisplayList(uint8_t* buffer, uint32_t size) = delete;
+    uint32_t displayListUsed() = delete;
+#endif
+    // GxEPD_HEAP_BUFFER : bytes for the frame buffer (all planes) allocated by the next init(), 0 : the free heap less GxEPD_HEAP_RESERVE
+    // the page height of paged drawing is the rows that fit, any height; a full frame if possible
+#if GxEPD_HEAP_BUFFER
+    void setFrameBufferBudget(uint32_t budget) {_fb_budget = budget;};
+#else
+    void setFrameBufferBudget(uint32_t budget) = delete;
+#endif
+    // pages of paged drawing, drawCallback() calls without display list: the _PAGES of the display class with the static
+    // frame buffer, else those of the rows the budget holds; while pipelined paging draws, those of half the rows
+    uint16_t pages() {return _pages;};
+    // screen rows drawn to by drawCallback() of paged drawing for the current page, for image decoders to skip others;
+    // all rows if not paged, while recording the display list, or if the rotation maps rows to columns
+    void getPageRows(int16_t& ys, int16_t& ye);
+    // pipelined paged drawing: the buffer holds two pages of half the height, a page is sent by the transfer queue of the io
+    // while the next one is drawn; for drawPaged() of the classes that send their buffer unconverted;
+    // pays only with an io class that sends its queue in the background, e.g. GxIO_SPI_Task on ESP32: with GxIO_SPI the
+    // caller sends, nothing overlaps, and drawCallback() is called for twice the pages, slower than without;
+    // no effect on classes that convert pixels while sending (IL0371 family as GxGDEW075Z09, GxGDEW027C44), on the black
+    // plane of GxGDEW0154Z04, and with GxEPD_INTERLEAVED_3C
+#if GxEPD_PIPELINED_PAGING
+    void setPipelinedPaging(bool enable) {_pipelined = enable;};
+#else
+    void setPipelinedPaging(bool enable) = delete;
+#endif
+    // band rendering of a full frame buffer: the drawing of drawCallback() is recorded to the display list, then rasterised
+    // into horizontal bands concurrently, each band by one worker; to buffer, update needed; draws directly if the frame
+    // or the drawing doesn't fit, see setDisplayList(); runner(band, arg, bands) calls band(arg, i) for each i < bands
+    // and returns when all are done, e.g. runBandTasks(); runner 0 : the bands in turn by the caller
+    typedef void (*band_runner)(void (*band)(void*, uint8_t), void* arg, uint8_t bands);
+#if GxEPD_DISPLAY_LIST
+    void setBandRendering(band_runner runner, uint8_t bands);
+#else
+    void setBandRendering(band_runner runner, uint8_t bands) = delete;
+#endif
+    void drawBands(void (*drawCallback)(void));
+    void drawBands(void (*drawCallback)(const void*), const void* p);
+#if defined(ESP32)
+    // band runner on FreeRTOS tasks, band 0 by the caller, the others by tasks free to run on the other core
+    static void runBandTasks(void (*band)(void*, uint8_t), void* arg, uint8_t bands);
+#endif
   protected:
+#if GxEPD_DIRTY_TRACKING
+    struct dirty_rect
+    {
+      int16_t x0, y0, x1, y1; // inclusive
+    };
+    inline void _markDirty(int16_t x, int16_t y)
+    {
+      if (_dirty_tracking) _addDirty(x, y, x, y);
+    };
+    inline void _markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+    {
+      if (_dirty_tracking) _addDirty(x0, y0, x1, y1);
+    };
+    void _addDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    // cost of one more rectangle, GxEPD_DIRTY_WINDOW_COST for classes with updateDirty() of one refresh
+    virtual uint32_t _dirtyCost() {return GxEPD_DIRTY_REFRESH_COST;};
+    // for updateDirty() of one refresh: the rectangles as windows of byte columns x0..x1 and buffer rows y0..y1,
+    // shrunk to the bytes changed against the shadow, unchanged ones dropped; returns their count
+    uint8_t _dirtyWindows(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes);
+    // the windows are sent, updates the shadow and clears them
+    void _dirtyWindowsSent(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes);
+    bool _dirty_tracking;
+    uint8_t _dirty_count;
+    dirty_rect _dirty_rects[GxEPD_DIRTY_RECTS];
+#else
+    inline void _markDirty(int16_t x, int16_t y) {};
+    inline void _markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {};
+#endif
+    // rectangle from rotated to controller coordinates, clipped to the screen; false if empty
+    bool _rotateRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    // plane bits for color, bit 0 black, bit 1 red, as drawPixel() of 3-color classes, see setColorThresholds()
+    inline uint8_t _colorClass(uint16_t color)
+    {
+      if (color == GxEPD_WHITE) return 0x00;
+      if (color == GxEPD_BLACK) return 0x01;
+      if (color == GxEPD_RED) return 0x02;
+      if (!_color_thresholds) return (color & 0x8000) ? 0x02 : 0x01; // default mapping, a bit test
+      uint32_t cached = _color_cache; // not used by band workers, see _replayRows()
+      if (uint16_t(cached >> 16) == color) return cached & 0x03;
+      uint8_t bits = _quantizeColor(color);
+      _color_cache = (uint32_t(color) << 16) | bits;
+      return bits;
+    };
+    // black and red plane bits for color, as drawPixel() of 3-color classes
+    inline void _colorToPlanes(uint16_t color, bool& black, bool& red)
+    {
+      uint8_t bits = _colorClass(color);
+      black = bits & 0x01;
+      red = bits & 0x02;
+    };
+    uint8_t _quantizeColor(uint16_t color); // from the color table if allocated, else _classifyColor()
+    uint8_t _classifyColor(uint16_t color); // by the thresholds
+    uint32_t _color_cache; // last color mapped, bits 31..16, and its plane bits
+    bool _color_thresholds; // false : default mapping
+    uint8_t _white_level, _red_level;
+    uint8_t* _color_table;
+    // frame buffer engine for the display classes, FB is their GxFrameBuffer type
+    // pixel writer of a rotation, resolved at compile time and selected by setRotation()
+    typedef void (*pixel_writer)(GxEPD* epd, int16_t x, int16_t y, uint16_t color);
+    // writes the pixels of mask from 8 pixels at controller (x, y), leftmost in bit 7; clipped
+    // pixels set in bits get plane bits fg, the others bg (bit 0 : black or b/w plane, bit 1 : red plane)
+    typedef void (*bits_writer)(GxEPD* epd, int16_t x, int16_t y, uint8_t bits, uint8_t mask, uint8_t fg, uint8_t bg);
+    // fills the rectangle at controller (x, y), clipped to the buffer or page
+    typedef void (*rect_writer)(GxEPD* epd, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    // to be called by the constructor of the display class; red : second plane, 0 for 1 plane; buffer_size : size of one plane
+    // GxFB_INTERLEAVED : black is the buffer of both planes, twice buffer_size, red 0
+    // with GxEPD_HEAP_BUFFER by the constructor with no buffer, and by init() through _allocFrameBuffer()
+    template <class FB> void _initFrameBuffer(uint8_t* black, uint8_t* red, uint32_t buffer_size)
+    {
+      _fb_black = black;
+      _fb_red = red;
+      _fb_size = buffer_size;
+      _fb_row_bytes = FB::ROW_BYTES;
+      _fb_planes = FB::PLANES;
+      _fb_interleaved = FB::FLAGS & GxFB_INTERLEAVED;
+      _bits_writer = &_writeBitsFB<FB>;
+      _rect_writer = &_writeRectFB<FB>;
+      _fb_height = FB::HEIGHT;
+      _setPageHeight(FB::rows(buffer_size));
+      _fb_flip_y = FB::FLAGS & GxFB_FLIP_Y;
+      static const pixel_writer writers[5] = {&_writePixelFB<FB, 0>, &_writePixelFB<FB, 1>, &_writePixelFB<FB, 2>, &_writePixelFB<FB, 3>, &_writePixelSwitchFB<FB>};
+      _pixel_writers = writers;
+      _pixel_writer = _pixel_writers[getRotation()];
+    };
+#if GxEPD_HEAP_BUFFER
+    // to be called by init() of the display class, allocates the planes of the frame buffer for the budget
+    template <class FB> void _allocFrameBuffer()
+    {
+      uint32_t budget = _fb_budget ? _fb_budget : _freeHeap();
+      uint32_t rows = budget / (uint32_t(FB::ROW_BYTES) * FB::PLANES);
+      if (rows > FB::HEIGHT) rows = FB::HEIGHT;
+      if (_fb_size == rows * FB::ROW_BYTES) return; // kept from last init()
+      free(_fb_black);
+      free(_fb_red);
+      _initFrameBuffer<FB>(0, 0, 0);
+      for (; rows > 0; rows -= (rows + 7) / 8) // fragmented heap : fewer rows
+      {
+        bool interleaved = FB::FLAGS & GxFB_INTERLEAVED;
+        uint8_t* black = (uint8_t*) malloc((interleaved ? 2 : 1) * rows * FB::ROW_BYTES);
+        uint8_t* red = ((FB::PLANES > 1) && !interleaved) ? (uint8_t*) malloc(rows * FB::ROW_BYTES) : 0;
+        if (black && ((FB::PLANES == 1) || interleaved || red))
+        {
+          _initFrameBuffer<FB>(black, red, rows * FB::ROW_BYTES);
+          return;
+        }
+        free(black);
+        free(red);
+      }
+    };
+    static uint32_t _freeHeap(); // bytes available less GxEPD_HEAP_RESERVE
+#else
+    template <class FB> void _allocFrameBuffer() {};
+#endif
+    inline void _drawPixelFB(int16_t x, int16_t y, uint16_t color)
+    {
+      _pixel_writer(this, x, y, color);
+    };
+    template <class FB, uint8_t R> static void _writePixelFB(GxEPD* epd, int16_t x, int16_t y, uint16_t color)
+    {
+      if (!FB::template contains<R>(x, y)) return;
+      FB::template rotate<R>(x, y);
+      if (epd->_dlRecording()) epd->_dlPixel(x, y, color);
+      int16_t page = epd->_current_page;
+      uint16_t rows = FB::rows(epd->_fb_size);
+      int16_t row = FB::row(y, page, rows);
+      if ((row < 0) || (uint16_t(row) >= rows)) return;
+      if (page < 0) epd->_markDirty(x, y);
+      uint32_t i = FB::index(x, row);
+      uint8_t m = FB::mask(x);
+      if (FB::PLANES == 1) FB::write(epd->_fb_black, i, m, !color);
+      else
+      {
+        bool b, r;
+        epd->_colorToPlanes(color, b, r);
+        if (FB::FLAGS & GxFB_INTERLEAVED) FB::writePair(epd->_fb_black, i, x, b, r);
+        else
+        {
+          FB::write(epd->_fb_black, i, m, b);
+          FB::write(epd->_fb_red, i, m, r);
+        }
+      }
+    };
+    template <class FB> static void _writePixelSwitchFB(GxEPD* epd, int16_t x, int16_t y, uint16_t color)
+    {
+      switch (epd->getRotation())
+      {
+        case 0: _writePixelFB<FB, 0>(epd, x, y, color); break;
+        case 1: _writePixelFB<FB, 1>(epd, x, y, color); break;
+        case 2: _writePixelFB<FB, 2>(epd, x, y, color); break;
+        case 3: _writePixelFB<FB, 3>(epd, x, y, color); break;
+      }
+    };
+    template <class FB> static void _writeBitsFB(GxEPD* epd, int16_t x, int16_t y, uint8_t bits, uint8_t mask, uint8_t fg, uint8_t bg)
+    {
+      if (uint16_t(y) >= FB::HEIGHT) return;
+      if (epd->_dlRecording()) epd->_dlBits(x, y, bits, mask, fg, bg);
+      int16_t page = epd->_current_page;
+      uint16_t rows = FB::rows(epd->_fb_size);
+      int16_t row = FB::row(y, page, rows);
+      if ((row < 0) || (uint16_t(row) >= rows)) return;
+      if (x < 0)
+      {
+        if (x <= -8) return;
+        mask &= 0xFF >> -x;
+      }
+      if (x > FB::VISIBLE_WIDTH - 8)
+      {
+        if (x >= FB::VISIBLE_WIDTH) return;
+        mask &= 0xFF << (x + 8 - FB::VISIBLE_WIDTH);
+      }
+      uint8_t shift = x & 7;
+      uint32_t i = FB::index(x + 8, row) - 1; // byte of x, x may be negative
+      if (FB::FLAGS & GxFB_INTERLEAVED)
+      {
+        uint8_t b = ((fg & 1) ? bits : 0) | ((bg & 1) ? ~bits : 0);
+        uint8_t r = ((fg & 2) ? bits : 0) | ((bg & 2) ? ~bits : 0);
+        if (mask >> shift) FB::writePairByte(epd->_fb_black, i, b >> shift, r >> shift, mask >> shift);
+        if (shift && uint8_t(mask << (8 - shift))) FB::writePairByte(epd->_fb_black, i + 1, b << (8 - shift), r << (8 - shift), mask << (8 - shift));
+        return;
+      }
+      for (uint8_t p = 0; p < FB::PLANES; p++)
+      {
+        uint8_t* plane = p ? epd->_fb_red : epd->_fb_black;
+        uint8_t v = (((fg >> p) & 1) ? bits : 0) | (((bg >> p) & 1) ? ~bits : 0);
+        if (mask >> shift) FB::writeByte(plane, i, v >> shift, mask >> shift);
+        if (shift && uint8_t(mask << (8 - shift))) FB::writeByte(plane, i + 1, v << (8 - shift), mask << (8 - shift));
+      }
+    };
+    template <class FB> static void _writeRectFB(GxEPD* epd, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+      if (epd->_dlRecording()) epd->_dlRect(x, y, w, h, color);
+      int16_t page = epd->_current_page;
+      if (page < 0) epd->_markDirty(x, y, x + w - 1, y + h - 1);
+      uint16_t rows = FB::rows(epd->_fb_size);
+      y = FB::row(y, h, page, rows);
+      if (FB::PLANES == 1) FB::fillRect(epd->_fb_black, rows, x, y, w, h, !color);
+      else
+      {
+        bool b, r;
+        epd->_colorToPlanes(color, b, r);
+        if (FB::FLAGS & GxFB_INTERLEAVED) FB::fillRectPair(epd->_fb_black, rows, x, y, w, h, b, r);
+        else
+        {
+          FB::fillRect(epd->_fb_black, rows, x, y, w, h, b);
+          FB::fillRect(epd->_fb_red, rows, x, y, w, h, r);
+        }
+      }
+    };
+    template <class FB> void _fillRectFB(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+      if (!_rotateRect(x, y, w, h)) return;
+      _writeRectFB<FB>(this, x, y, w, h, color);
+    };
+    template <class FB> void _fillScreenFB(uint16_t color)
+    {
+      if (_dlRecording()) _dlScreen(color);
+      _markDirty(0, 0, WIDTH - 1, HEIGHT - 1);
+      if (FB::PLANES == 1) memset(_fb_black, FB::fill(color == GxEPD_BLACK), _fb_size);
+      else
+      {
+        bool b, r;
+        _colorToPlanes(color, b, r);
+        if (FB::FLAGS & GxFB_INTERLEAVED) memset(_fb_black, FB::pairFill(b, r), 2 * _fb_size);
+        else
+        {
+          memset(_fb_black, FB::fill(b), _fb_size);
+          memset(_fb_red, FB::fill(r), _fb_size);
+        }
+      }
+    };
+    int16_t _current_page; // page of paged drawing, -1 if not paged
+    uint8_t* _fb_black;
+    uint8_t* _fb_red;
+    uint32_t _fb_size;
+    uint8_t _fb_planes;
+    bool _fb_interleaved; // both planes in _fb_black, see GxFB_INTERLEAVED
+    // byte i of plane 0 (black or b/w) or 1 (red) of the buffer, i < _fb_size
+    inline uint8_t _planeByte(uint8_t plane, uint32_t i)
+    {
+      if (!_fb_interleaved) return plane ? _fb_red[i] : _fb_black[i];
+      uint16_t v = uint16_t(_fb_black[2 * i]) << 8 | _fb_black[2 * i + 1];
+      return gx_gather_bits(plane ? v : v >> 1);
+    };
+    pixel_writer _pixel_writer;
+    bits_writer _bits_writer;
+    rect_writer _rect_writer;
+    const pixel_writer* _pixel_writers; // of the rotations, then the rotation switch, a table per FB type
+    uint16_t _fb_height, _fb_row_bytes;
+    bool _fb_flip_y;
+#if GxEPD_HEAP_BUFFER
+    uint32_t _fb_budget;
+#endif
+    // paged drawing: page height is the rows of the buffer, the last page may have less
+    uint16_t _page_height, _pages;
+    uint32_t _pageSize() // bytes of one plane of the current page
+    {
+      uint16_t rows = _fb_height - _current_page * _page_height;
+      return uint32_t(rows < _page_height ? rows : _page_height) * _fb_row_bytes;
+    };
+    void _setPageHeight(uint16_t rows); // and the pages for the height of the frame
+    void _pageRows(int16_t& ys, int16_t& ye); // controller rows of the current page
+    // pipelined paged drawing, used by the page loops of the display classes:
+    // _beginPipeline(); for (...) {... _sendPage(IO, 0, true, 0xFF);} _endPipeline(IO);
+    // not pipelined with GxFB_INTERLEAVED, the queue sends buffer bytes as they are
+    void _sendPage(GxIO& io, uint8_t plane, bool invert, uint8_t fill); // sends or queues the current page of plane 0 or 1
+#if GxEPD_PIPELINED_PAGING
+    void _beginPipeline(); // halves the page height if pipelined, _fb_black and _fb_red point to the half drawn to
+    void _endPipeline(GxIO& io); // waits for the queue, restores the buffer
+    bool _pipelined;
+    uint32_t _pipe_size; // plane size while split, 0 if not
+    uint8_t _pipe_half;
+#else
+    void _beginPipeline() {};
+    void _endPipeline(GxIO& io) {};
+#endif
+    // display list of paged drawing, used by the page loops of the display classes:
+    // fillScreen(GxEPD_WHITE); if (!_replayPage()) {drawCallback(); _endRecording();} ... _endPaged();
+    void _endPaged(); // ends paged drawing, _current_page -1
+#if GxEPD_DISPLAY_LIST
+    enum dl_record {dl_color = 1, dl_pixel, dl_rect, dl_screen, dl_bits}; // records in controller coordinates
+    enum dl_state_type {dl_off, dl_idle, dl_recording, dl_ready, dl_overflow};
+    bool _replayPage(); // true if the current page is drawn from the display list, else starts recording if idle
+    void _endRecording();
+    inline bool _dlRecording() {return _dl_state == dl_recording;};
+    void _dlPixel(int16_t x, int16_t y, uint16_t color);
+    void _dlRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void _dlScreen(uint16_t color);
+    void _dlBits(int16_t x, int16_t y, uint8_t bits, uint8_t mask, uint8_t fg, uint8_t bg);
+    uint8_t* _dlRecord(uint8_t tag, uint16_t color, uint8_t size); // space for a record of size bytes after tag, 0 on overflow
+    uint8_t* _dl_buffer;
+    uint32_t _dl_size, _dl_used, _dl_last; // _dl_last : offset of a pixel or rect record to merge a pixel into, or _dl_used
+    uint8_t _dl_state;
+    uint16_t _dl_color;
+    void _replayRows(int16_t ys, int16_t ye); // the display list to controller rows ys..ye, records clipped
+    // band rendering: _beginBands() starts recording if possible, _endBands() rasterises, false : to be drawn directly
+    bool _beginBands();
+    bool _endBands();
+    static void _renderBand(void* epd, uint8_t band); // band of the controller rows, writes no other rows
+    band_runner _band_runner;
+    uint8_t _bands;
+#else
+    bool _replayPage() {return false;};
+    void _endRecording() {};
+    inline bool _dlRecording() {return false;};
+    inline void _dlPixel(int16_t x, int16_t y, uint16_t color) {};
+    inline void _dlRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {};
+    inline void _dlScreen(uint16_t color) {};
+    inline void _dlBits(int16_t x, int16_t y, uint8_t bits, uint8_t mask, uint8_t fg, uint8_t bg) {};
+    bool _beginBands() {return false;};
+    bool _endBands() {return false;};
+#endif
+    // shadow frame: set from buffer after a full update, invalid after other controller writes
+    // shrinks window (bytes xs..xe, rows ys..ye, row_bytes per row) to one window bounding the bytes changed against the shadow
+    // returns false if unchanged; without valid shadow the window is kept
+#if GxEPD_SHADOW_BUFFER
+    void _setShadow(const uint8_t* buffer, uint32_t buffer_size, uint32_t frame_size);
+    void _invalidateShadow() {_shadow_valid = false;};
+    bool _shadowValid() {return _shadow_valid;};
+    bool _diffWindow(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes, uint16_t& xs, uint16_t& xe, uint16_t& ys, uint16_t& ye);
+    void _updateShadow(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye);
+    uint8_t* _shadow;
+    uint32_t _shadow_size;
+    bool _shadow_valid;
+#else
+    void _setShadow(const uint8_t* buffer, uint32_t buffer_size, uint32_t frame_size) {};
+    void _invalidateShadow() {};
+    bool _shadowValid() {return false;};
+    bool _diffWindow(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes, uint16_t& xs, uint16_t& xe, uint16_t& ys, uint16_t& ye) {return true;};
+    void _updateShadow(const uint8_t* buffer, uint32_t buffer_size, uint16_t row_bytes, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye) {};
+#endif
+#if GxEPD_OP_STATS
+    void _countFrameBytes(uint32_t n) {_frame_bytes_sent += n;};
+    uint32_t _frame_bytes_sent;
+#else
+    void _countFrameBytes(uint32_t n) {};
+#endif
+    // waits while pin is at busy_level using the selected busy_wait_mode, returns false on timeout (us)
+    bool _waitBusy(int8_t pin, uint8_t busy_level, uint32_t timeout);
+    // busy_wait_interrupt: the edge seen by the pin change interrupt of this instance
+    bool _attachBusyEdge(int irq, int mode); // false : no interrupt slot free, wait by polling
+    void _detachBusyEdge(int irq);
+    static void _busyEdgeISR(void* epd);
+    volatile bool _busy_edge;
+    volatile uint32_t _busy_edge_time;
+#if defined(ESP32)
+    void* _busy_task; // TaskHandle_t of the waiting task, notified by the edge
+#elif !defined(ESP8266)
+    // attachInterrupt() passes no argument: a slot per instance waiting at a time
+    static GxEPD* volatile _busy_waiters[GxEPD_BUSY_WAITERS];
+    static void _busyEdgeISR0();
+    static void _busyEdgeISR1();
+#endif
+    uint8_t _busy_wait_mode;
+    void (*_busy_wait_hook)(int8_t, uint8_t);
+#if GxEPD_OP_STATS
+    void _countBusyWait(bool ok, uint32_t polls, uint32_t busy_time, uint32_t latency);
+    busy_wait_stats _busy_wait_stats;
+#else
+    void _countBusyWait(bool ok, uint32_t polls, uint32_t busy_time, uint32_t latency) {};
+#endif
+    // accounts an operation of a display class from construction to destruction, for early returns
+    class op_scope
+    {
+      public:
+        op_scope(GxEPD* epd, GxIO& io, op_type op) : _epd(epd), _io(io)
+        {
+          _epd->_finishAsync();
+          _epd->_beginOp(io, op);
+        };
+        ~op_scope()
+        {
+          _epd->_endOp(_io);
+        };
+      private:
+        GxEPD* _epd;
+        GxIO& _io;
+    };
+#if GxEPD_OP_STATS
+    void _beginOp(GxIO& io, op_type op);
+    void _endOp(GxIO& io);
+    op_stats _op_stats[op_types];
+    uint8_t _op_depth, _op_current;
+    GxIO::io_stats _op_io_start;
+    uint32_t _op_busy_waits_start, _op_busy_time_start;
+    unsigned long _op_start;
+    void (*_op_sink)(op_type, const op_stats&, void*);
+    void* _op_sink_arg;
+#else
+    void _beginOp(GxIO& io, op_type op) {};
+    void _endOp(GxIO& io) {};
+#endif
+#if GxEPD_ASYNC_UPDATE
+    enum AsyncState {async_idle, async_power_on, async_transfer, async_refresh, async_power_off};
+    // asynchronous update steps, none of these waits for BUSY
+    virtual bool _asyncPowerOn() {return false;}; // false : not supported
+    virtual bool _asyncTransfer() {return false;}; // called until false, _async_index is 0 on first call
+    virtual void _asyncRefresh() {};
+    virtual void _asyncPowerOff() {};
+    virtual void _asyncSleep() {}; // after power off, e.g. deep sleep
+    void _finishAsync(); // polls a pending asynchronous update to completion
+    uint8_t _async_state;
+    bool _async_timed_out;
+    bool _async_started;
+    uint32_t _async_index;
+    unsigned long _async_start;
+    void (*_async_callback)(void*);
+    void* _async_callback_arg;
+#else
+    void _finishAsync() {};
+#endif
+    // bitmap to buffer, byte wise for display classes with frame buffer, modes bm_invert, bm_transparent, bm_flip_x, bm_flip_y, bm_r90, bm_r180, bm_r270
+    // flips are applied before clockwise rotation, a rotated bitmap covers h x w pixels
     void drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t m);
+    // drawBitmapBM() by drawPixel(), bitmap read in order
+    void _drawBitmapPixels(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode);
+    static void _bitmapToScreen(int16_t mode, int16_t w, int16_t h, int16_t i, int16_t j, int16_t& u, int16_t& v);
+    void _screenToController(int16_t& x, int16_t& y);
+    uint8_t _colorToPlaneBits(uint16_t color);
+    // block write of num buffer bytes from index idx, within a transaction; bytes beyond buffer_size (paged buffer) are sent as fill
+    void _writeBufferData(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, uint32_t num, bool invert, uint8_t fill);
+    // same for plane 0 (black or b/w) or 1 (red) of the frame buffer, buffer_size _fb_size, de-interleaved while sent if interleaved
+    void _writePlaneData(GxIO& io, uint8_t plane, uint32_t idx, uint32_t num, bool invert, uint8_t fill);
+    // same as _writeBufferData() for the transfer queue of io, from index 0
+    void _queueBufferData(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t num, bool invert, uint8_t fill);
+    // block write of num bitmap bytes from program memory, or the bitmap reader if set, within a transaction;
+    // bytes beyond size are sent as fill
+    void _writeBitmapData(GxIO& io, const uint8_t* bitmap, uint32_t size, uint32_t num, bool invert, uint8_t fill);
+    // byte idx of bitmap, from program memory, or the bitmap reader if set, 0x00 if not read; for the converting classes
+    uint8_t _readBitmap(const uint8_t* bitmap, uint32_t idx);
+    bitmap_reader _bitmap_reader;
+    void* _bitmap_reader_arg;
+    bool _bitmap_reader_as_sent;
     static inline uint16_t gx_uint16_min(uint16_t a, uint16_t b) {return (a < b ? a : b);};
     static inline uint16_t gx_uint16_max(uint16_t a, uint16_t b) {return (a > b ? a : b);};
+    static inline uint32_t gx_uint32_min(uint32_t a, uint32_t b) {return (a < b ? a : b);};
+    static inline int16_t gx_int16_min(int16_t a, int16_t b) {return (a < b ? a : b);};
+    static inline int16_t gx_int16_max(int16_t a, int16_t b) {return (a > b ? a : b);};
 };
 
 #endif
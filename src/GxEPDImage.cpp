@@ -0,0 +1,176 @@
+// class GxEPDImage : Native Images (.epd) streamed to the Controller RAM of GxEPD Display Classes
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxEPDImage.h"
+
+const uint8_t GxEPDImage::_tokens[2] = {0, 1};
+
+static inline uint16_t gx_le16(const uint8_t* p)
+{
+  return p[0] | (uint16_t(p[1]) << 8);
+}
+
+static inline uint32_t gx_le32(const uint8_t* p)
+{
+  return gx_le16(p) | (uint32_t(gx_le16(p + 2)) << 16);
+}
+
+bool GxEPDImage::begin(GxBMP_Input& input)
+{
+  end();
+  _input = &input;
+  _position = 0;
+  uint8_t header[GxEPDImage_HEADER_SIZE];
+  if ((_read(header, sizeof(header)) < sizeof(header)) || memcmp(header, "GxEP", 4) || (header[4] != GxEPDImage_VERSION))
+  {
+    end();
+    return false;
+  }
+  _packed = header[5] & GxEPDImage_PACKBITS;
+  _planes = header[6];
+  _width = gx_le16(header + 8);
+  _height = gx_le16(header + 10);
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    _plane_size[i] = gx_le32(header + 12 + 4 * i);
+    _data_size[i] = gx_le32(header + 20 + 4 * i);
+  }
+  memcpy(_panel, header + 32, 16);
+  _panel[16] = 0;
+  if ((_planes < 1) || (_planes > 2))
+  {
+    end();
+    return false;
+  }
+  _plane = 0;
+  _idx = 0;
+  _rle.reset();
+  _chunk_pos = _chunk_len = 0;
+  return true;
+}
+
+bool GxEPDImage::draw()
+{
+  if (!_input) return false;
+  // images of panels of the same size and planes differ in format, e.g. GDEW075T8 and GDEW075Z09
+  if (strncmp(_panel, _display.panelName(), sizeof(_panel))) return false;
+  bool swap = _display.getRotation() & 1;
+  if ((_width != (swap ? _display.height() : _display.width())) || (_height != (swap ? _display.width() : _display.height()))) return false;
+  _sent[0] = _sent[1] = 0;
+  _error = false;
+  _display.setBitmapReader(_reader, this);
+  if (_planes == 1) _display.drawBitmap(&_tokens[0], _plane_size[0], GxEPD::bm_normal);
+  else _display.drawPicture(&_tokens[0], &_tokens[1], _plane_size[0], _plane_size[1], GxEPD::bm_normal);
+  _display.setBitmapReader(0);
+  // all of the image sent, else the class expects another format
+  return !_error && (_sent[0] == _plane_size[0]) && ((_planes == 1) || (_sent[1] == _plane_size[1]));
+}
+
+uint16_t GxEPDImage::_reader(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n)
+{
+  GxEPDImage* image = static_cast<GxEPDImage*>(arg);
+  if (bitmap == &_tokens[0]) return image->_readPlane(0, idx, buffer, n);
+  if (bitmap == &_tokens[1]) return image->_readPlane(1, idx, buffer, n);
+  return 0;
+}
+
+uint16_t GxEPDImage::_readPlane(uint8_t plane, uint32_t idx, uint8_t* buffer, uint16_t n)
+{
+  if ((plane >= _planes) || (idx >= _plane_size[plane])) return 0;
+  if (((plane != _plane) || (idx != _idx)) && !_seekPlane(plane, idx))
+  {
+    _error = true;
+    return 0;
+  }
+  if (n > _plane_size[plane] - idx) n = _plane_size[plane] - idx;
+  uint16_t got = _packed ? _unpack(buffer, n) : _read(buffer, n);
+  _idx += got;
+  if (_idx > _sent[plane]) _sent[plane] = _idx;
+  if (got < n) _error = true;
+  return got;
+}
+
+bool GxEPDImage::_seekPlane(uint8_t plane, uint32_t idx)
+{
+  uint32_t start = GxEPDImage_HEADER_SIZE + (plane ? _data_size[0] : 0);
+  if (!_packed)
+  {
+    if (!_skipTo(start + idx)) return false;
+    _plane = plane;
+    _idx = idx;
+    return true;
+  }
+  if ((plane != _plane) || (idx < _idx))
+  {
+    // from the start of the plane, the packed bytes read ahead are dropped
+    _chunk_pos = _chunk_len = 0;
+    if (!_skipTo(start)) return false;
+    _rle.reset();
+    _plane = plane;
+    _idx = 0;
+  }
+  uint8_t skip[32];
+  while (_idx < idx)
+  {
+    uint16_t n = (idx - _idx < sizeof(skip)) ? idx - _idx : sizeof(skip);
+    uint16_t got = _unpack(skip, n);
+    _idx += got;
+    if (got < n) return false;
+  }
+  return true;
+}
+
+uint16_t GxEPDImage::_unpack(uint8_t* buffer, uint16_t n)
+{
+  uint32_t end = GxEPDImage_HEADER_SIZE + _data_size[0] + (_plane ? _data_size[1] : 0); // of the packed plane
+  uint16_t got = 0;
+  while (got < n)
+  {
+    uint16_t used;
+    uint16_t k = _rle.decode(_chunk + _chunk_pos, _chunk_len - _chunk_pos, used, buffer + got, n - got);
+    got += k;
+    _chunk_pos += used;
+    if (k || used) continue;
+    // the decoder needs input
+    if (_position >= end) break;
+    _chunk_len = _read(_chunk, (end - _position < sizeof(_chunk)) ? end - _position : sizeof(_chunk));
+    _chunk_pos = 0;
+    if (_chunk_len == 0) break;
+  }
+  return got;
+}
+
+uint16_t GxEPDImage::_read(uint8_t* buffer, uint16_t size)
+{
+  uint16_t got = 0;
+  while (got < size)
+  {
+    uint16_t n = _input->read(buffer + got, size - got);
+    if (n == 0) break;
+    got += n;
+  }
+  _position += got;
+  return got;
+}
+
+bool GxEPDImage::_skipTo(uint32_t position)
+{
+  if (position == _position) return true;
+  if (_input->seek(position))
+  {
+    _position = position;
+    return true;
+  }
+  // forward on input that can't seek
+  while (_position < position)
+  {
+    uint16_t n = (position - _position < sizeof(_chunk)) ? position - _position : sizeof(_chunk);
+    if (_read(_chunk, n) < n) return false;
+  }
+  return _position == position;
+}
@@ -0,0 +1,78 @@
+// class GxEPDImage : Native Images (.epd) streamed to the Controller RAM of GxEPD Display Classes
+//
+// the image data is in the format the display class sends to its controller: byte order and polarity of the controller,
+// one or two planes (black, red); it is pulled from the input and sent by block writes, the frame buffer is not used;
+// images are made on the host from BMP or PNG by extras/tools/epdconv, for a panel, see extras/tools/README.md
+//
+// file format, little endian:
+//  0 "GxEP", 4 version 1, 5 flags (bit 0 : PackBits), 6 planes 1 or 2, 7 0,
+//  8 width, 10 height : of the controller (rotation 0), 16 bit
+// 12 plane sizes, as sent, 20 data sizes, in the file (packed), 2 x 32 bit each, 28 0 (32 bit)
+// 32 panel name, 16 characters, padded with 0, e.g. "GDEW042Z15"
+// 48 data of plane 0, followed by data of plane 1; each plane packed by itself
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxEPDImage_H_
+#define _GxEPDImage_H_
+
+#include <Arduino.h>
+#include "GxEPD.h"
+#include "GxBMP.h"
+#include "GxPackBits.h"
+
+#define GxEPDImage_HEADER_SIZE 48
+#define GxEPDImage_VERSION 1
+#define GxEPDImage_PACKBITS 0x01
+
+// packed bytes read per chunk
+#if defined(__AVR)
+#define GxEPDImage_CHUNK 32
+#else
+#define GxEPDImage_CHUNK 256
+#endif
+
+class GxEPDImage
+{
+  public:
+    GxEPDImage(GxEPD& display) : _display(display), _input(0) {};
+    // reads the header from the start of input; false if not a GxEPD image of this version; the input must stay valid until end()
+    bool begin(GxBMP_Input& input);
+    // the image to the controller and full refresh, by drawBitmap(bitmap, size) or drawPicture() of the display class, no
+    // update needed, the buffer is unchanged; false if the panel, size or planes don't match the class, or on read error
+    // the data is read once, in order; classes that send it twice (GxGDEW042T2 after init()) need an input that can seek
+    bool draw();
+    void end() {_input = 0;};
+    uint16_t width() {return _width;};
+    uint16_t height() {return _height;};
+    uint8_t planes() {return _planes;};
+    bool packed() {return _packed;};
+    const char* panel() {return _panel;}; // as converted for, must be GxEPD::panelName() of the display
+  private:
+    static uint16_t _reader(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n);
+    uint16_t _readPlane(uint8_t plane, uint32_t idx, uint8_t* buffer, uint16_t n);
+    bool _seekPlane(uint8_t plane, uint32_t idx); // to byte idx of plane, as sent
+    uint16_t _unpack(uint8_t* buffer, uint16_t n);
+    uint16_t _read(uint8_t* buffer, uint16_t size); // all of size bytes unless at the end or on error
+    bool _skipTo(uint32_t position);
+    GxEPD& _display;
+    GxBMP_Input* _input;
+    uint32_t _position; // of _input
+    uint32_t _plane_size[2], _data_size[2];
+    uint32_t _sent[2]; // bytes of the planes read by the display class
+    uint32_t _idx; // next byte of _plane
+    uint16_t _width, _height;
+    uint8_t _planes, _plane;
+    bool _packed, _error;
+    char _panel[17];
+    GxPackBits _rle;
+    uint8_t _chunk[GxEPDImage_CHUNK]; // packed input
+    uint16_t _chunk_pos, _chunk_len;
+    static const uint8_t _tokens[2]; // bitmaps passed to the display class, for the planes
+};
+
+#endif
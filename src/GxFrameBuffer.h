@@ -0,0 +1,216 @@
+// class GxFrameBuffer : Frame Buffer Layout for the Display Classes of the GxEPD library
+//
+// compile time geometry, rotation, paging and bit addressing of the frame buffers of the display classes
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxFrameBuffer_H_
+#define _GxFrameBuffer_H_
+
+#include <Arduino.h>
+
+// layout flags for GxFrameBuffer
+#define GxFB_LSB_FIRST 0x01 // leftmost pixel of a byte in bit 0, default bit 7
+#define GxFB_WHITE_SET 0x02 // a set bit is white (no colour), default a set bit is black (or red)
+#define GxFB_FLIP_Y 0x04 // rows stored bottom up, for controllers used in y-decrement mode
+// 2 planes in one buffer of twice the plane size, a byte holds 4 pixels as bit pairs, black in the upper bit of a pair;
+// plane byte i is buffer bytes 2 * i and 2 * i + 1, leftmost pixel in bits 7 and 6; not with GxFB_LSB_FIRST or GxFB_WHITE_SET
+#define GxFB_INTERLEAVED 0x08
+
+static inline uint8_t gx_reverse_bits(uint8_t b)
+{
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  return (b & 0xAA) >> 1 | (b & 0x55) << 1;
+}
+
+// bits 7..0 of b to the even bits 14..0, for the bit pairs of GxFB_INTERLEAVED
+static inline uint16_t gx_spread_bits(uint8_t b)
+{
+  uint16_t v = b;
+  v = (v | v << 4) & 0x0F0F;
+  v = (v | v << 2) & 0x3333;
+  return (v | v << 1) & 0x5555;
+}
+
+// the even bits 14..0 of v to bits 7..0, inverse of gx_spread_bits()
+static inline uint8_t gx_gather_bits(uint16_t v)
+{
+  v &= 0x5555;
+  v = (v | v >> 1) & 0x3333;
+  v = (v | v >> 2) & 0x0F0F;
+  return v | v >> 4;
+}
+
+// W, H : controller pixels, W multiple of 8; Planes : 1 b/w, 2 black and red
+// VW : visible width, the width of Adafruit_GFX used for rotation, if less than the RAM width W
+// used as type only, the buffers stay with the display classes; the page height of paged drawing is the rows a buffer holds
+template <uint16_t W, uint16_t H, uint8_t Planes, uint8_t Flags = 0, uint16_t VW = W>
+class GxFrameBuffer
+{
+  public:
+    enum
+    {
+      WIDTH = W,
+      HEIGHT = H,
+      VISIBLE_WIDTH = VW,
+      PLANES = Planes,
+      FLAGS = Flags,
+      ROW_BYTES = W / 8
+    };
+    static const uint32_t FRAME_SIZE = uint32_t(W / 8) * uint32_t(H);
+    // true if (x, y) is on screen for rotation R
+    template <uint8_t R> static inline bool contains(int16_t x, int16_t y)
+    {
+      return (uint16_t(x) < ((R & 1) ? H : VW)) && (uint16_t(y) < ((R & 1) ? VW : H));
+    };
+    // rotated coordinates to controller coordinates for rotation R, resolved at compile time
+    template <uint8_t R> static inline void rotate(int16_t& x, int16_t& y)
+    {
+      int16_t t = x;
+      switch (R)
+      {
+        case 1:
+          x = VW - y - 1;
+          y = t;
+          break;
+        case 2:
+          x = VW - x - 1;
+          y = H - y - 1;
+          break;
+        case 3:
+          x = y;
+          y = H - t - 1;
+          break;
+      }
+    };
+    // rows held by a buffer of buffer_size bytes, at most H; the page height if paged
+    static inline uint16_t rows(uint32_t buffer_size)
+    {
+      return (buffer_size / ROW_BYTES < H) ? buffer_size / ROW_BYTES : H;
+    };
+    // buffer row of controller row y, page -1 : not paged, rows : rows(buffer_size)
+    static inline int16_t row(int16_t y, int16_t page, uint16_t rows)
+    {
+      if (Flags & GxFB_FLIP_Y) y = H - y - 1;
+      if (page > 0) y -= page * rows;
+      return y;
+    };
+    // buffer row of the first of h controller rows from y
+    static inline int16_t row(int16_t y, int16_t h, int16_t page, uint16_t rows)
+    {
+      return row((Flags & GxFB_FLIP_Y) ? y + h - 1 : y, page, rows);
+    };
+    static inline uint32_t index(int16_t x, int16_t row)
+    {
+      return uint32_t(row) * ROW_BYTES + uint16_t(x) / 8;
+    };
+    static inline uint8_t mask(int16_t x)
+    {
+      return (Flags & GxFB_LSB_FIRST) ? (0x01 << (x & 7)) : (0x80 >> (x & 7));
+    };
+    // byte value of 8 pixels black (or red) if on, else white
+    static inline uint8_t fill(bool on)
+    {
+      return (on != bool(Flags & GxFB_WHITE_SET)) ? 0xFF : 0x00;
+    };
+    static inline void write(uint8_t* plane, uint32_t i, uint8_t m, bool on)
+    {
+      if (on != bool(Flags & GxFB_WHITE_SET)) plane[i] |= m;
+      else plane[i] &= ~m;
+    };
+    // sets the pixels of byte i where m is set to the values in v, leftmost pixel in bit 7 of v and m, 1 is black (or red)
+    static inline void writeByte(uint8_t* plane, uint32_t i, uint8_t v, uint8_t m)
+    {
+      if (Flags & GxFB_LSB_FIRST)
+      {
+        v = gx_reverse_bits(v);
+        m = gx_reverse_bits(m);
+      }
+      if (Flags & GxFB_WHITE_SET) v = ~v;
+      plane[i] = (plane[i] & ~m) | (v & m);
+    };
+    // rectangle in controller coordinates x and buffer rows y, clipped to rows
+    static void fillRect(uint8_t* plane, uint16_t rows, int16_t x, int16_t y, int16_t w, int16_t h, bool on)
+    {
+      if (y < 0)
+      {
+        h += y;
+        y = 0;
+      }
+      if (y + h > int16_t(rows)) h = rows - y;
+      if ((w <= 0) || (h <= 0)) return;
+      int16_t xe = x + w - 1;
+      uint16_t xs_b = x / 8;
+      uint16_t xe_b = xe / 8;
+      uint8_t first_mask = (Flags & GxFB_LSB_FIRST) ? uint8_t(0xFF << (x % 8)) : uint8_t(0xFF >> (x % 8));
+      uint8_t last_mask = (Flags & GxFB_LSB_FIRST) ? uint8_t(0xFF >> (7 - xe % 8)) : uint8_t(0xFF << (7 - xe % 8));
+      if (xs_b == xe_b) first_mask &= last_mask;
+      bool set = (on != bool(Flags & GxFB_WHITE_SET));
+      for (int16_t y1 = y; y1 < y + h; y1++)
+      {
+        uint8_t* p = plane + index(0, y1) + xs_b;
+        if (set) *p |= first_mask;
+        else *p &= ~first_mask;
+        if (xs_b == xe_b) continue;
+        if (xe_b - xs_b > 1) memset(p + 1, set ? 0xFF : 0x00, xe_b - xs_b - 1);
+        p += xe_b - xs_b;
+        if (set) *p |= last_mask;
+        else *p &= ~last_mask;
+      }
+    };
+    // GxFB_INTERLEAVED : buffer byte value of 4 pixels of black and red
+    static inline uint8_t pairFill(bool black, bool red)
+    {
+      return (black ? 0xAA : 0x00) | (red ? 0x55 : 0x00);
+    };
+    // GxFB_INTERLEAVED : pixel x of plane byte i, both planes by one masked write
+    static inline void writePair(uint8_t* buffer, uint32_t i, int16_t x, bool black, bool red)
+    {
+      uint8_t* p = buffer + 2 * i + ((x >> 2) & 1);
+      uint8_t m = 0xC0 >> (2 * (x & 3));
+      *p = (*p & ~m) | (pairFill(black, red) & m);
+    };
+    // GxFB_INTERLEAVED : sets the pixels of plane byte i where m is set to the values in black and red, as writeByte()
+    static inline void writePairByte(uint8_t* buffer, uint32_t i, uint8_t black, uint8_t red, uint8_t m)
+    {
+      uint16_t v = gx_spread_bits(black) << 1 | gx_spread_bits(red);
+      uint16_t m2 = gx_spread_bits(m) * 3;
+      uint8_t* p = buffer + 2 * i;
+      p[0] = (p[0] & ~(m2 >> 8)) | ((v & m2) >> 8);
+      p[1] = (p[1] & ~m2) | (v & m2);
+    };
+    // GxFB_INTERLEAVED : fillRect() of both planes
+    static void fillRectPair(uint8_t* buffer, uint16_t rows, int16_t x, int16_t y, int16_t w, int16_t h, bool black, bool red)
+    {
+      if (y < 0)
+      {
+        h += y;
+        y = 0;
+      }
+      if (y + h > int16_t(rows)) h = rows - y;
+      if ((w <= 0) || (h <= 0)) return;
+      int16_t xe = x + w - 1;
+      uint16_t xs_b = x / 4;
+      uint16_t xe_b = xe / 4;
+      uint8_t first_mask = 0xFF >> (2 * (x % 4));
+      uint8_t last_mask = 0xFF << (2 * (3 - xe % 4));
+      if (xs_b == xe_b) first_mask &= last_mask;
+      uint8_t v = pairFill(black, red);
+      for (int16_t y1 = y; y1 < y + h; y1++)
+      {
+        uint8_t* p = buffer + 2 * index(0, y1) + xs_b;
+        *p = (*p & ~first_mask) | (v & first_mask);
+        if (xs_b == xe_b) continue;
+        if (xe_b - xs_b > 1) memset(p + 1, v, xe_b - xs_b - 1);
+        p += xe_b - xs_b;
+        *p = (*p & ~last_mask) | (v & last_mask);
+      }
+    };
+};
+
+#endif
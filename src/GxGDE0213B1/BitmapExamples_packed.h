@@ -0,0 +1,964 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 4000 bytes, packed 2487
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xA0,0x0F,0x00,0x00,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xFC,0xFF,0x00,0xE3,0xF8,0xFF,0x00,0xC0,0xFC,0xFF,0x01,0xE0,
+0x7F,0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x01,0xE0,0x07,0xF9,0xFF,0x00,0xC0,0xFC,0xFF,
+0x02,0xE0,0x00,0x7F,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE0,0x00,0x0F,0xFA,0xFF,
+0x00,0xC0,0xFC,0xFF,0x02,0xE0,0x00,0x03,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0x00,
+0x03,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0xFC,0x03,0xFA,0xFF,0x00,0xC0,0xFA,0xFF,
+0x00,0x03,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0xF0,0x03,0xFA,0xFF,0x00,0xC0,0xFB,
+0xFF,0x01,0x80,0x03,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xF8,0x00,0x3F,0xFA,0xFF,
+0x00,0xC0,0xFC,0xFF,0x01,0xE0,0x01,0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x01,0xE0,0x1F,
+0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x01,0xE0,0x1F,0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x01,
+0xE0,0x03,0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE0,0x00,0x7F,0xFA,0xFF,0x00,0xC0,
+0xFC,0xFF,0x02,0xE0,0x00,0x0F,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xFE,0x00,0x03,
+0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0xE0,0x03,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,
+0xFE,0x03,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0xFE,0x03,0xFA,0xFF,0x00,0xC0,0xFB,
+0xFF,0x04,0xE0,0x03,0xFF,0xEF,0xFB,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xFC,0x00,
+0x03,0xFF,0xC7,0xF0,0x7F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE0,0x00,0x0F,0xFF,
+0x81,0xC0,0x7F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xE0,0x00,0xFF,0xFF,0x03,0x80,
+0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x0A,0xE0,0x07,0xFF,0xFC,0x07,0x00,0x00,0x07,0xFF,
+0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x7F,0xFF,0xF8,0x0C,0x00,0x00,0x07,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xE3,0xFF,0xFF,0xF0,0x18,0x00,0x00,0x07,0xFF,0xFF,0xC0,0xF9,0xFF,
+0x07,0xF0,0x30,0x00,0x00,0x07,0xFF,0xFF,0xC0,0xFB,0xFF,0x09,0xFC,0x1F,0xF0,0xF8,
+0x3F,0xFF,0xDF,0xFF,0xFF,0xC0,0xFB,0xFF,0x09,0xF8,0x0F,0xF9,0xFC,0xFF,0xFF,0x0F,
+0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF0,0x70,0x07,0xFE,0x01,0xC7,0xF8,0x07,0xFF,0xFF,
+0xC0,0xFC,0xFF,0x0A,0xF0,0xF0,0x03,0xFE,0x01,0xC6,0x00,0x0F,0xFF,0xFF,0xC0,0xFC,
+0xFF,0x0A,0xF0,0xE0,0x03,0xFE,0x01,0xC6,0x00,0x1F,0xFF,0xFF,0xC0,0xFC,0xFF,0x06,
+0xE1,0xE1,0x83,0xFF,0xF1,0xC6,0x00,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE1,0xE3,
+0xC3,0xE0,0x01,0xC6,0x3F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE1,0xE3,0xC3,0xE0,
+0x01,0xC6,0x3F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE1,0xE3,0xC3,0xE0,0x01,0xC6,
+0x3F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x0A,0xE1,0xE3,0xC7,0xE0,0x01,0xC6,0x00,0x1F,
+0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xE3,0x87,0xFF,0xF1,0xC6,0x00,0x0F,0xFF,0xFF,
+0xC0,0xFC,0xFF,0x0A,0xE0,0xC3,0x8F,0xFE,0x01,0xC6,0x00,0x1F,0xFF,0xFF,0xC0,0xFC,
+0xFF,0x0A,0xE0,0x00,0x03,0xFE,0x01,0xC6,0x00,0x1F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,
+0xF0,0x00,0x03,0xFE,0x01,0xC7,0xFC,0x3F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF0,0x00,
+0x03,0xFF,0xFC,0x3F,0xF8,0x3F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF8,0x00,0x03,0xFF,
+0xE0,0x1F,0xFC,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xFE,0x00,0x03,0xFF,0x00,0x03,
+0xFC,0x0F,0xFF,0xFF,0xC0,0xF9,0xFF,0x07,0xF8,0x00,0x00,0x30,0x1F,0xFF,0xFF,0xC0,
+0xF9,0xFF,0x00,0xE0,0xFE,0x00,0x03,0x3F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xEF,0xFF,
+0xFF,0xE0,0x07,0xF0,0x00,0x7F,0xFF,0xFF,0xC0,0xFC,0xFF,0x06,0xE1,0xFF,0xFF,0xF0,
+0x07,0xF8,0x00,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x0A,0xE0,0x3F,0xFF,0xF7,0x86,0x00,
+0x00,0x3F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x07,0xFF,0xFF,0x80,0x00,0x10,0x1F,
+0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x01,0xFF,0xFF,0x80,0x00,0xF8,0x0F,0xFF,0xFF,
+0xC0,0xFC,0xFF,0x0A,0xE0,0x00,0x3F,0xFF,0x80,0x0F,0xFC,0x07,0xFF,0xFF,0xC0,0xFC,
+0xFF,0x0A,0xF8,0x00,0x07,0xFF,0x87,0xFF,0xFE,0x1F,0xFF,0xFF,0xC0,0xFB,0xFF,0x01,
+0x00,0x03,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0xF0,0x03,0xFA,0xFF,0x00,0xC0,0xFB,
+0xFF,0x01,0xFE,0x03,0xFA,0xFF,0x00,0xC0,0xFA,0xFF,0x03,0x03,0xFF,0x80,0x7F,0xFD,
+0xFF,0x00,0xC0,0xFB,0xFF,0x04,0xF0,0x03,0xF1,0x80,0x7F,0xFD,0xFF,0x00,0xC0,0xFB,
+0xFF,0x09,0x80,0x03,0xF1,0x80,0x7C,0x7F,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xFC,
+0x00,0x07,0xF1,0x80,0x4C,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x00,0x3F,
+0xF1,0x8F,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x01,0xFF,0xF1,0x8C,
+0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x07,0xFF,0xF1,0x8C,0xCC,0x63,
+0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x3F,0xFF,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,
+0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xFF,0xFF,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xEF,0xFF,0xFF,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xF9,0xFF,
+0x07,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFB,0xFF,0x09,0x80,0xFF,0xF1,0x8C,
+0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xFE,0x00,0x3F,0xF1,0x8F,0xFC,0x63,
+0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xFC,0x00,0x0F,0xF0,0x00,0x04,0x63,0x8F,0xFF,
+0xFF,0xC0,0xFC,0xFF,0x0A,0xF8,0x00,0x0F,0xF0,0x00,0x04,0x63,0x8F,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xF0,0x00,0x07,0xF0,0x00,0x04,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,
+0x0A,0xF0,0x00,0x07,0xF0,0x00,0x04,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,
+0x43,0x03,0xF0,0x00,0x04,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0xC3,0x83,
+0xF1,0x8F,0xFC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xC3,0xC3,0xF1,0x8C,
+0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xC3,0xC3,0xF1,0x8C,0xCC,0x63,
+0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xC3,0xC3,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,
+0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xC3,0xC3,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xE0,0xC3,0xC3,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,
+0x0A,0xF0,0x03,0xC7,0xF1,0x8C,0xCC,0x63,0x8F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF0,
+0x03,0x87,0xF1,0x8C,0xCC,0x00,0x07,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF8,0x03,0x07,
+0xF1,0x8F,0xCC,0x00,0x07,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xFC,0x03,0xFF,0xF1,0x80,
+0x4C,0x00,0x07,0xFF,0xFF,0xC0,0xFB,0xFF,0x09,0x03,0xFF,0xF1,0x80,0x7C,0x00,0x07,
+0xFF,0xFF,0xC0,0xF9,0xFF,0x07,0xF1,0x80,0x7C,0x00,0x07,0xFF,0xFF,0xC0,0xF8,0xFF,
+0x01,0x80,0x7F,0xFD,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xFC,0x1F,
+0x07,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xF8,0x0F,0x87,0xFA,0xFF,0x00,0xC0,0xFC,
+0xFF,0x02,0xF0,0x07,0x83,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xF0,0x03,0xC3,0xFE,
+0x00,0x00,0x03,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE0,0x03,0xC3,0xFE,0x00,0x00,
+0x03,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE0,0x83,0xC3,0xFE,0x00,0x00,0x03,0xFE,
+0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE1,0xC1,0xC3,0xFE,0x00,0x00,0x03,0xFE,0xFF,0x00,
+0xC0,0xFC,0xFF,0x06,0xE1,0xC1,0xC3,0xFE,0x00,0x00,0x03,0xFE,0xFF,0x00,0xC0,0xFC,
+0xFF,0x06,0xE1,0xC0,0x83,0xFE,0x1E,0x1E,0x1F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,
+0xE1,0xE0,0x07,0xFE,0x1E,0x1E,0x1F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE1,0xE0,
+0x07,0xFE,0x1E,0x1E,0x1F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xE1,0xF0,0x07,0xFE,
+0x1E,0x1E,0x1F,0xFE,0xFF,0x00,0xC0,0xFC,0xFF,0x06,0xF0,0xF0,0x0F,0xFE,0x1E,0x1E,
+0x1F,0xFE,0xFF,0x00,0xC0,0xFB,0xFF,0x05,0xFC,0x3F,0xFE,0x1E,0x1E,0x1F,0xFE,0xFF,
+0x00,0xC0,0xF9,0xFF,0x03,0xFE,0x1E,0x1E,0x1F,0xFE,0xFF,0x00,0xC0,0xF9,0xFF,0x00,
+0xE0,0xFE,0x00,0x03,0x3F,0xFF,0xFF,0xC0,0xF9,0xFF,0x00,0xE0,0xFE,0x00,0x03,0x1F,
+0xFF,0xFF,0xC0,0xF9,0xFF,0x00,0xE0,0xFE,0x00,0x03,0x0F,0xFF,0xFF,0xC0,0xFD,0xFF,
+0x04,0xC0,0x00,0x00,0x03,0xE0,0xFE,0x00,0x03,0x0F,0xFF,0xFF,0xC0,0xFD,0xFF,0x04,
+0xC0,0x00,0x00,0x03,0xE0,0xFE,0x00,0x03,0x0F,0xFF,0xFF,0xC0,0xFD,0xFF,0x0B,0xC0,
+0x00,0x00,0x03,0xFE,0x1E,0x1E,0x1F,0x0F,0xFF,0xFF,0xC0,0xFD,0xFF,0x0B,0xC0,0x00,
+0x00,0x03,0xFE,0x1E,0x1E,0x1F,0x0F,0xFF,0xFF,0xC0,0xFD,0xFF,0x0B,0xC0,0x00,0x00,
+0x03,0xFE,0x1E,0x1E,0x1F,0x0F,0xFF,0xFF,0xC0,0xFD,0xFF,0x0B,0xC0,0x00,0x00,0x03,
+0xFE,0x1E,0x1E,0x1F,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF8,0x7F,0xFF,0xFE,0x1E,
+0x1E,0x1F,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF0,0xFF,0xFF,0xFE,0x1E,0x1E,0x1F,
+0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF1,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x0F,0xFF,
+0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x0F,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xE1,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,
+0x0A,0xE0,0xFF,0xFF,0xFE,0x00,0x00,0x1E,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x03,0xE0,
+0x00,0x03,0xFE,0xFE,0x00,0x03,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x02,0xE0,0x00,0x03,
+0xFE,0xFF,0x04,0xC0,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x02,0xF0,0x00,0x03,0xFE,0xFF,
+0x04,0xC0,0x1F,0xFF,0xFF,0xC0,0xFC,0xFF,0x02,0xF0,0x00,0x03,0xFE,0xFF,0x04,0xE0,
+0x3F,0xFF,0xFF,0xC0,0xFC,0xFF,0x02,0xF8,0x00,0x03,0xFE,0xFF,0x00,0xE0,0xFE,0xFF,
+0x00,0xC0,0xFC,0xFF,0x02,0xFE,0x00,0x03,0xFA,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF7,0xFF,0x00,0x83,0xFD,0xFF,0x00,0xC0,0xF7,0xFF,0x00,0x83,0xFD,0xFF,0x00,0xC0,
+0xFB,0xFF,0x04,0xFC,0x1F,0xF0,0x7F,0x83,0xFD,0xFF,0x00,0xC0,0xFB,0xFF,0x04,0xF8,
+0x0F,0xF0,0x7F,0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xF0,0x70,0x07,0xF0,0x7F,
+0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xF0,0xF0,0x03,0xF0,0x7F,0x83,0xFD,0xFF,
+0x00,0xC0,0xFC,0xFF,0x0A,0xF0,0xE0,0x03,0xF0,0x7F,0x83,0xFE,0x3F,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xE1,0xE1,0x83,0xF0,0x7F,0x83,0xFE,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,
+0x0A,0xE1,0xE3,0xC3,0xF0,0x7F,0x83,0xFE,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,
+0xE3,0xC3,0xF0,0x7F,0x83,0xFE,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xE3,0xC3,
+0xF0,0x7F,0x83,0xFE,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xE3,0xC7,0xF0,0x7F,
+0x83,0xFE,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE1,0xE3,0x87,0xF0,0x7F,0x83,0xFE,
+0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0xC3,0x8F,0xF0,0x7F,0x83,0xFC,0x0F,0xFF,
+0xFF,0xC0,0xFC,0xFF,0x0A,0xE0,0x00,0x03,0xF0,0x78,0x00,0x00,0x0F,0xFF,0xFF,0xC0,
+0xFC,0xFF,0x0A,0xF0,0x00,0x03,0xF0,0x70,0x00,0x00,0x0F,0xFF,0xFF,0xC0,0xFC,0xFF,
+0x0A,0xF0,0x00,0x03,0xF0,0x70,0x00,0x00,0x1F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xF8,
+0x00,0x03,0xF0,0x70,0x00,0x00,0x1F,0xFF,0xFF,0xC0,0xFC,0xFF,0x0A,0xFE,0x00,0x03,
+0xF0,0x60,0x00,0x00,0x3F,0xFF,0xFF,0xC0,0xF9,0xFF,0x03,0xF0,0x60,0x00,0x01,0xFE,
+0xFF,0x00,0xC0,0xF9,0xFF,0x02,0xF0,0x41,0x83,0xFD,0xFF,0x00,0xC0,0xF9,0xFF,0x02,
+0xF0,0x43,0x83,0xFD,0xFF,0x00,0xC0,0xF9,0xFF,0x02,0xF0,0x07,0x83,0xFD,0xFF,0x00,
+0xC0,0xF9,0xFF,0x02,0xF0,0x07,0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xE0,0x00,
+0x03,0xF0,0x0F,0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xE0,0x00,0x03,0xF0,0x0F,
+0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xE0,0x00,0x03,0xF0,0x1F,0x83,0xFD,0xFF,
+0x00,0xC0,0xFC,0xFF,0x05,0xE0,0x00,0x03,0xF0,0x1F,0x83,0xFD,0xFF,0x00,0xC0,0xFC,
+0xFF,0x05,0xE0,0x00,0x03,0xF0,0x3F,0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xE0,
+0x00,0x03,0xF0,0x3F,0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0xFC,0x3F,0xFF,0xF0,
+0x7F,0x83,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x01,0xF0,0x7F,0xFE,0xFF,0x00,0x83,0xFD,
+0xFF,0x00,0xC0,0xFC,0xFF,0x00,0xF0,0xFD,0xFF,0x00,0x83,0xFD,0xFF,0x00,0xC0,0xFC,
+0xFF,0x00,0xE0,0xF8,0xFF,0x00,0xC0,0xFC,0xFF,0x00,0xE0,0xF8,0xFF,0x00,0xC0,0xFC,
+0xFF,0x01,0xE0,0x7F,0xF9,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xFB,0xFF,0x00,0x80,
+0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xFE,0x00,0x3F,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,
+0x02,0xFC,0x00,0x0F,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xF8,0x00,0x0F,0xFA,0xFF,
+0x00,0xC0,0xFC,0xFF,0x02,0xF0,0x00,0x07,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xF0,
+0x00,0x07,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE0,0x43,0x03,0xFA,0xFF,0x00,0xC0,
+0xFC,0xFF,0x02,0xE0,0xC3,0x83,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE1,0xC3,0xC3,
+0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE1,0xC3,0xC3,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,
+0x02,0xE1,0xC3,0xC3,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE1,0xC3,0xC3,0xFA,0xFF,
+0x00,0xC0,0xFC,0xFF,0x02,0xE0,0xC3,0xC3,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xF0,
+0x03,0xC7,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xF0,0x03,0x87,0xFA,0xFF,0x00,0xC0,
+0xFC,0xFF,0x02,0xF8,0x03,0x07,0xFA,0xFF,0x00,0xC0,0xFC,0xFF,0x01,0xFC,0x03,0xF9,
+0xFF,0x00,0xC0,0xFB,0xFF,0x00,0x03,0xF9,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+};
+
+// logo : 4000 bytes, packed 2970
+const unsigned char logo_packed[] PROGMEM =
+{
+0xA0,0x0F,0x00,0x00,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF5,0xFF,0x03,0xFE,0x7F,0xFF,0xC0,0xF2,
+0xFF,0x00,0xC0,0xFD,0xFF,0x02,0xFE,0x00,0x0F,0xF9,0xFF,0x00,0xC0,0xFE,0xFF,0x05,
+0xF0,0x00,0x80,0x00,0x00,0x03,0xFD,0xFF,0x14,0xFD,0xFF,0xC0,0xFF,0xC0,0x00,0x07,
+0xFF,0xFF,0xCF,0xFF,0xF8,0x0F,0xFC,0x3F,0xC0,0x0F,0xFF,0xC0,0xFF,0x9C,0xFB,0x00,
+0x09,0x7F,0xE0,0x01,0x00,0x60,0x01,0xFF,0xC0,0xFF,0x81,0xFB,0xFF,0x09,0x80,0x00,
+0x78,0x7D,0x00,0x00,0x3F,0xC0,0xFF,0x9F,0xFA,0xFF,0x08,0xF8,0x02,0x3E,0x00,0xC0,
+0x0F,0xC0,0xFF,0x1F,0xF8,0xFF,0x06,0xFE,0x30,0x1D,0x97,0xC0,0xFF,0x5F,0xF7,0xFF,
+0x05,0x1C,0x01,0xFF,0xC0,0xFF,0x1F,0xF8,0xFF,0x06,0xFE,0x38,0xE0,0x23,0xC0,0xF0,
+0x3F,0xF7,0xFF,0x05,0x3F,0xC3,0x01,0xC0,0xF0,0x3F,0xF7,0xFF,0x05,0x3F,0xFF,0xC1,
+0xC0,0xE0,0x3F,0xF7,0xFF,0x05,0x3F,0xFF,0xE3,0xC0,0xE7,0x1F,0xF7,0xFF,0x05,0x3F,
+0xFF,0xE3,0xC0,0xE7,0x9F,0xF7,0xFF,0x05,0x3F,0xFF,0xF3,0xC0,0xE7,0x8F,0xF7,0xFF,
+0x05,0x1F,0xFF,0xF3,0xC0,0xF0,0xE1,0xF7,0xFF,0x05,0x3F,0xFF,0xF1,0xC0,0xF1,0x31,
+0xF7,0xFF,0x05,0x3F,0xFF,0xE1,0xC0,0xE3,0xF9,0xF7,0xFF,0x05,0x3F,0xFF,0xE1,0xC0,
+0xE1,0xF3,0xF7,0xFF,0x05,0x3F,0xFF,0xE1,0xC0,0xEC,0xF7,0xFD,0xFF,0x02,0xF0,0x00,
+0x00,0xFE,0xFF,0x05,0x3F,0xFF,0xF1,0xC0,0xEB,0xD3,0xFD,0xFF,0x02,0xF7,0xFF,0xFE,
+0xFE,0xFF,0x05,0x3F,0xFF,0xE3,0xC0,0xC3,0xE3,0xFD,0xFF,0x02,0xF7,0xFF,0xFE,0xFE,
+0xFF,0x05,0x3F,0xFF,0xE3,0xC0,0x9C,0x63,0xFD,0xFF,0x02,0xF7,0xFF,0xFE,0xFE,0xFF,
+0x05,0x3F,0xFF,0xE3,0xC0,0x9F,0xE7,0xFD,0xFF,0x02,0xF7,0xFF,0xFE,0xFE,0xFF,0x05,
+0x3F,0xFF,0xE3,0xC0,0x9F,0xCF,0xFD,0xFF,0x02,0xF0,0x00,0x0E,0xFE,0xFF,0x05,0x3F,
+0xFF,0xE3,0xC0,0x8F,0x1F,0xFB,0xFF,0x00,0xEE,0xFE,0xFF,0x05,0x3F,0xFF,0xE3,0xC0,
+0x83,0x1F,0xFB,0xFF,0x09,0xEE,0xFF,0xFF,0xFD,0x3F,0xFF,0xE3,0xC0,0xC0,0x3F,0xFB,
+0xFF,0x09,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xE3,0xC0,0xE0,0x3F,0xFE,0xFF,0x0C,0xF8,
+0x00,0x00,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xE3,0xC0,0xF8,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xFF,0xFE,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xE3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xFF,0xFE,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xC3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xFF,0xFE,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xC3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xFF,0xFE,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xE3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xC0,0x1E,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xC3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xDF,0xDE,0xEE,0xFF,0xFF,0xFE,0xBF,0xFF,0xC3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xDF,0xDE,0xEE,0xFF,0xFF,0xFE,0x3F,0xFF,0xC3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xDF,0xDE,0xEE,0xFF,0xFF,0xFE,0x7F,0xFF,0xC3,0xC0,0xFE,0x7F,0xFE,0xFF,0x0C,0xFB,
+0xDF,0xDE,0xE0,0xFF,0xFF,0xFE,0x7F,0xFF,0x83,0xC0,0xFE,0x7F,0xFE,0xFF,0x02,0xFB,
+0xDF,0xDE,0xFE,0xFF,0x06,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFE,0xFF,0x02,0xFB,
+0xDF,0xDE,0xFE,0xFF,0x06,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFE,0xFF,0x02,0xFB,
+0xDF,0xDE,0xFE,0xFF,0x06,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFE,0xFF,0x02,0xF8,
+0x10,0xC0,0xFE,0xFF,0x06,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF6,
+0x7F,0xE0,0xFF,0xFF,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,
+0xEE,0xFF,0xFF,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,
+0xFF,0xFF,0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,0xFF,
+0xFF,0xFE,0x7F,0xFF,0x87,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,0xFF,0xFF,
+0xFE,0x7F,0xFF,0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,0xFF,0xFF,0xFE,
+0x7F,0xFF,0x87,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,0xFF,0xFF,0xFE,0x7F,
+0xFF,0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,0xFF,0xFF,0xFE,0x7F,0xFF,
+0xC7,0xC0,0xFE,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xEE,0xFF,0xFF,0xF8,0x7F,0xFF,0x87,
+0xC0,0xFC,0x7F,0xFD,0xFF,0x0B,0xF7,0x7F,0xCE,0xFF,0xFF,0xED,0x7F,0xFF,0x87,0xC0,
+0x80,0x7F,0xFD,0xFF,0x0B,0xF7,0x00,0x1E,0xFF,0xFF,0xFD,0x7F,0xFF,0x87,0xC0,0x8C,
+0x7F,0xFD,0xFF,0x0B,0xF7,0xFF,0xFE,0xFF,0xFF,0xFD,0x7F,0xFF,0x87,0xC0,0x9D,0x9F,
+0xFD,0xFF,0x0B,0xF7,0xFF,0xFE,0xFF,0xFF,0xFC,0x7F,0xFF,0x87,0xC0,0x93,0xDF,0xFD,
+0xFF,0x0B,0xF7,0xFF,0xFE,0xFF,0xFF,0xFC,0xFF,0xFF,0xC7,0xC0,0x9F,0xDF,0xFD,0xFF,
+0x0B,0xF0,0x00,0x00,0xFF,0xFF,0xFC,0xFF,0xFF,0x87,0xC0,0x90,0x5F,0xF8,0xFF,0x06,
+0xFC,0xFF,0xFF,0x87,0xC0,0x9D,0x9F,0xF8,0xFF,0x05,0xFC,0xFF,0xFF,0x87,0xC0,0xDF,
+0xF7,0xFF,0x06,0xFC,0xFF,0xFF,0x87,0xC0,0xCB,0xDF,0xF8,0xFF,0x06,0xF4,0xFF,0xFF,
+0xC7,0xC0,0xE0,0x1F,0xF8,0xFF,0x06,0xFC,0xFF,0xFF,0xC7,0xC0,0xCE,0xDF,0xF8,0xFF,
+0x06,0xFC,0xFF,0xFF,0x87,0xC0,0x8F,0xDF,0xF8,0xFF,0x06,0xFC,0xFF,0xFF,0x87,0xC0,
+0x8F,0x3F,0xF8,0xFF,0x06,0xFC,0xFF,0xFF,0x87,0xC0,0x02,0x7F,0xF8,0xFF,0x05,0xFC,
+0xFF,0xFF,0x87,0xC0,0x3E,0xF7,0xFF,0x05,0xFC,0xFF,0xFF,0x87,0xC0,0x3D,0xF7,0xFF,
+0x05,0xF8,0xFF,0xFF,0x87,0xC0,0x18,0xFD,0xFF,0x0B,0xE0,0x1F,0xFF,0x00,0x7F,0xFF,
+0xFA,0xFF,0xFF,0x07,0xC0,0x00,0xFD,0xFF,0x10,0x8F,0x00,0x00,0x03,0x1F,0xFF,0xFA,
+0xFF,0xFF,0x07,0xC0,0x84,0xFF,0xFF,0xF0,0x00,0x3F,0xFE,0xFF,0x0A,0xE3,0xFF,0xFA,
+0xFF,0xFF,0x87,0xC0,0xFC,0xFF,0xFE,0x07,0xFC,0xFF,0x09,0xF8,0x00,0x3A,0xFF,0xFF,
+0x07,0xC0,0xFC,0xFF,0x80,0xF9,0xFF,0x07,0x82,0xFF,0xFF,0x07,0xC0,0xFC,0xE0,0x3F,
+0xF9,0xFF,0x06,0xF0,0xFF,0xFF,0x1F,0xC0,0xFC,0x0F,0xF8,0xFF,0x05,0xF1,0x7F,0xFF,
+0x0F,0xC0,0xFC,0xF7,0xFF,0x05,0xF9,0xFF,0xFF,0x0F,0xC0,0xFC,0xF7,0xFF,0x08,0xF9,
+0xFF,0xFE,0x3F,0xC0,0xFF,0xFF,0xFE,0x01,0xFA,0xFF,0x08,0xF8,0xFF,0xFE,0x7F,0xC0,
+0xFF,0xFF,0xFE,0xFD,0xFA,0xFF,0x08,0xFE,0x0F,0xF0,0xFF,0xC0,0xFF,0xFF,0xFE,0xFD,
+0xFA,0xFF,0x08,0xFE,0x00,0x01,0xFF,0xC0,0xFF,0xFF,0xFE,0xFD,0xF9,0xFF,0x07,0xC0,
+0x63,0xFF,0xC0,0xFF,0xFF,0xFE,0x7D,0xF9,0xFF,0x03,0xA7,0xFF,0xFF,0xC0,0xFE,0xFF,
+0x00,0x31,0xF9,0xFF,0x03,0xE7,0xFF,0xFF,0xC0,0xFE,0xFF,0x00,0x83,0xF9,0xFF,0x03,
+0xF7,0xFF,0xFF,0xC0,0xF2,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xFB,0xFE,0xFF,0x03,0xDF,
+0xFF,0xFF,0xDF,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x0C,0xD1,0xFF,0xFF,0xF3,0x9F,0xFF,
+0xF3,0x9F,0xFF,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xB5,0xFF,0xFF,0xE7,0x1F,0xFF,
+0xE7,0x1F,0xFF,0xE2,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0xB5,0xFF,0xFF,0xEE,0x5F,0xFF,
+0xEE,0x5F,0xFF,0xE9,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0x81,0xFF,0xFF,0xE4,0xDF,0xFF,
+0xE4,0xDF,0xFF,0xED,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0xC1,0xFF,0xFF,0xF1,0xDF,0xFF,
+0xF1,0xDF,0xFF,0xF4,0x7F,0xFF,0xC0,0xF5,0xFF,0x03,0xFE,0xFF,0xFF,0xC0,0xF2,0xFF,
+0x04,0xC0,0xFF,0xFF,0xFE,0x01,0xFE,0xFF,0x08,0xDF,0xFF,0xE0,0x9F,0xFF,0xE0,0x7F,
+0xFF,0xC0,0xF8,0xFF,0x06,0xE5,0xDF,0xFF,0xFE,0x7F,0xFF,0xC0,0xF8,0xFF,0x0A,0xED,
+0xDF,0xFF,0xFF,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,0x01,0xFC,0xFF,0x06,0xEC,0x9F,0xFF,
+0xFF,0x7F,0xFF,0xC0,0xFB,0xFF,0x09,0xFB,0xFF,0xFF,0xEE,0x3F,0xFF,0xE0,0x7F,0xFF,
+0xC0,0xFE,0xFF,0x03,0xFB,0xFF,0xFF,0xF3,0xF9,0xFF,0x00,0xC0,0xFE,0xFF,0x07,0xD1,
+0xFF,0xFF,0xE0,0x1F,0xFF,0xFC,0x7F,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xB5,0xFC,
+0xFF,0x06,0xF0,0x1F,0xFF,0xE0,0x1F,0xFF,0xC0,0xFE,0xFF,0x00,0xB5,0xFC,0xFF,0x06,
+0xE7,0xDF,0xFF,0xE6,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0x81,0xFC,0xFF,0x06,0xEF,0xDF,
+0xFF,0xEF,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0xC1,0xFF,0xFF,0xF7,0xBF,0xFF,0xE7,0x9F,
+0xFF,0xE7,0x7F,0xFF,0xC0,0xFB,0xFF,0x09,0xE7,0x9F,0xFF,0xF0,0x3F,0xFF,0xF0,0x7F,
+0xFF,0xC0,0xFB,0xFF,0x01,0xED,0xDF,0xFD,0xFF,0x03,0xF9,0xFF,0xFF,0xC0,0xFE,0xFF,
+0x04,0x81,0xFF,0xFF,0xEC,0xDF,0xFA,0xFF,0x00,0xC0,0xFE,0xFF,0x0C,0xDF,0xFF,0xFF,
+0xF0,0x1F,0xFF,0xFB,0x3F,0xFF,0xE0,0x1F,0xFF,0xC0,0xFE,0xFF,0x0C,0xBF,0xFF,0xFF,
+0xFE,0x3F,0xFF,0xF8,0x7F,0xFF,0xE6,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0x9F,0xFC,0xFF,
+0x06,0xFC,0xFF,0xFF,0xEF,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0xC1,0xFF,0xFF,0xE8,0x1F,
+0xFF,0xF8,0x7F,0xFF,0xE7,0x7F,0xFF,0xC0,0xFB,0xFF,0x09,0xE8,0x1F,0xFF,0xFB,0x3F,
+0xFF,0xF0,0x7F,0xFF,0xC0,0xF5,0xFF,0x03,0xF9,0xFF,0xFF,0xC0,0xFB,0xFF,0x01,0xF8,
+0x1F,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x09,0xF8,0x1F,0xFF,0xFB,0xFF,0xFF,0xF0,0xFF,
+0xFF,0xC0,0xFB,0xFF,0x09,0xF9,0xFF,0xFF,0xF3,0xFF,0xFF,0xE6,0x7F,0xFF,0xC0,0xFE,
+0xFF,0x0C,0xC7,0xFF,0xFF,0xFB,0xFF,0xFF,0xF3,0xFF,0xFF,0xEF,0x7F,0xFF,0xC0,0xFE,
+0xFF,0x14,0x03,0xFF,0xFF,0xF8,0x1F,0xFF,0xE0,0x1F,0xFF,0xE7,0x7F,0xFF,0xC0,0xFF,
+0xFF,0xFE,0x79,0xFF,0xFF,0xFC,0x1F,0xFD,0xFF,0x07,0xF0,0x7F,0xFF,0xC0,0xFF,0xFF,
+0xFE,0xFD,0xF9,0xFF,0x0B,0xFD,0xFF,0xFF,0xC0,0xFF,0xFF,0xFE,0xED,0xFF,0xFF,0xFC,
+0x3F,0xFA,0xFF,0x20,0xC0,0xFF,0xFF,0xFE,0xED,0xFF,0xFF,0xF8,0x9F,0xFF,0xF3,0x9F,
+0xFF,0xE0,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,0x69,0xFF,0xFF,0xFB,0xDF,0xFF,0xE7,0x1F,
+0xFF,0xE7,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x23,0xFF,0xFF,0xFB,0xDF,0xFF,0xEE,0x5F,
+0xFF,0xE7,0xFF,0xFF,0xC0,0xFB,0xFF,0x09,0xFD,0x9F,0xFF,0xE4,0xDF,0xFF,0xEF,0xFF,
+0xFF,0xC0,0xF8,0xFF,0x06,0xF1,0xDF,0xFF,0xC0,0xFF,0xFF,0xC0,0xFE,0xFF,0x00,0xC3,
+0xFB,0xFF,0x05,0xDF,0xFF,0x80,0x7F,0xFF,0xC0,0xFE,0xFF,0x04,0x99,0xFF,0xFF,0xE0,
+0x1F,0xFD,0xFF,0x03,0xEF,0x7F,0xFF,0xC0,0xFE,0xFF,0x07,0xBD,0xFF,0xFF,0xFD,0xFF,
+0xFF,0xF3,0x9F,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x0C,0x9D,0xFF,0xFF,0xFB,0xFF,0xFF,
+0xE7,0x1F,0xFF,0x80,0x7F,0xFF,0xC0,0xFE,0xFF,0x07,0xC1,0xFF,0xFF,0xF9,0xFF,0xFF,
+0xEE,0x5F,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x07,0xF7,0xFF,0xFF,0xFC,0x1F,0xFF,0xE4,
+0xDF,0xFD,0xFF,0x00,0xC0,0xF8,0xFF,0x06,0xF1,0xDF,0xFF,0xE0,0x7F,0xFF,0xC0,0xFE,
+0xFF,0x00,0xC3,0xFB,0xFF,0x05,0xDF,0xFF,0xE7,0xFF,0xFF,0xC0,0xFE,0xFF,0x00,0x99,
+0xF9,0xFF,0x03,0xEF,0xFF,0xFF,0xC0,0xFE,0xFF,0x00,0xBD,0xF9,0xFF,0x03,0xE7,0xFF,
+0xFF,0xC0,0xFE,0xFF,0x00,0x9D,0xF9,0xFF,0x03,0xF0,0x7F,0xFF,0xC0,0xFE,0xFF,0x04,
+0xC1,0xFF,0xFF,0xE0,0x1F,0xFA,0xFF,0x00,0xC0,0xFE,0xFF,0x04,0xF7,0xFF,0xFF,0xE0,
+0x1F,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x09,0xEC,0xDF,0xFF,0xF8,0x07,0xFF,0xF0,0x9F,
+0xFF,0xC0,0xFE,0xFF,0x0C,0xC3,0xFF,0xFF,0xEC,0xDF,0xFF,0xF9,0xDF,0xFF,0xE6,0x5F,
+0xFF,0xC0,0xFE,0xFF,0x0C,0x9D,0xFF,0xFF,0xEC,0xDF,0xFF,0xFB,0xDF,0xFF,0xEF,0x5F,
+0xFF,0xC0,0xFE,0xFF,0x0C,0xBD,0xFF,0xFF,0xEC,0xDF,0xFF,0xF9,0x9F,0xFF,0xF6,0x5F,
+0xFF,0xC0,0xFE,0xFF,0x10,0x99,0xFF,0xFF,0xEF,0xDF,0xFF,0xFC,0x3F,0xFF,0xE0,0x1F,
+0xFF,0xC0,0xFF,0xFF,0xFE,0x01,0xF6,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF8,0xFF,
+0x01,0xE0,0x1F,0xFD,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF8,0xFF,0x01,0xFB,0xDF,
+0xFD,0xFF,0x00,0xC0,0xFB,0xFF,0x04,0xF8,0x07,0xFF,0xF9,0x9F,0xFD,0xFF,0x00,0xC0,
+0xFB,0xFF,0x41,0xF8,0x07,0xFF,0xFC,0x3F,0xFF,0xE0,0x1F,0xFF,0xC0,0xFF,0xFF,0xFE,
+0x01,0xFF,0xFF,0xFB,0xDF,0xFF,0xFC,0x3F,0xFF,0xE7,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,
+0xFD,0xFF,0xFF,0xFB,0xDF,0xFF,0xF9,0x9F,0xFF,0xEF,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,
+0xFD,0xFF,0xFF,0xF8,0x1F,0xFF,0xFB,0xDF,0xFF,0xE6,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,
+0xFD,0xFF,0xFF,0xFC,0x3F,0xFD,0xFF,0x07,0xF0,0xFF,0xFF,0xC0,0xFF,0xFF,0xFE,0x79,
+0xFC,0xFF,0x01,0xFC,0x3F,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x0C,0x31,0xFF,0xFF,0xFD,
+0x1F,0xFF,0xFC,0x1F,0xFF,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x87,0xFF,0xFF,0xF8,
+0x5F,0xFF,0xFB,0x5F,0xFF,0xF4,0x7F,0xFF,0xC0,0xFB,0xFF,0x09,0xFB,0x5F,0xFF,0xF9,
+0x5F,0xFF,0xED,0x7F,0xFF,0xC0,0xFB,0xFF,0x11,0xFA,0x5F,0xFF,0xFC,0x1F,0xFF,0xED,
+0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,0x01,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0x03,0xE0,0x7F,
+0xFF,0xC0,0xFB,0xFF,0x01,0xFC,0x1F,0xFD,0xFF,0x03,0xF0,0x7F,0xFF,0xC0,0xFE,0xFF,
+0x00,0xDB,0xFC,0xFF,0x01,0xE0,0x1F,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x04,0x89,0xFF,
+0xFF,0xF8,0x07,0xFA,0xFF,0x00,0xC0,0xFE,0xFF,0x04,0xA5,0xFF,0xFF,0xF8,0x07,0xFD,
+0xFF,0x03,0xE0,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0x95,0xFF,0xFF,0xFB,0xDF,0xFF,0xFC,
+0x9F,0xFF,0xE7,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xD1,0xFF,0xFF,0xFB,0xDF,0xFF,0xFA,
+0x5F,0xFF,0xE7,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xFB,0xFF,0xFF,0xF8,0x1F,0xFF,0xFA,
+0x5F,0xFF,0xEF,0xFF,0xFF,0xC0,0xFB,0xFF,0x09,0xFC,0x3F,0xFF,0xF9,0x1F,0xFF,0xC0,
+0x7F,0xFF,0xC0,0xFE,0xFF,0x01,0x80,0x7F,0xFD,0xFF,0x06,0xFD,0x3F,0xFF,0xE7,0x7F,
+0xFF,0xC0,0xFE,0xFF,0x04,0x99,0xFF,0xFF,0xFE,0x3F,0xFD,0xFF,0x03,0xEF,0x7F,0xFF,
+0xC0,0xFE,0xFF,0x04,0xBD,0xFF,0xFF,0xFC,0x1F,0xFA,0xFF,0x00,0xC0,0xFE,0xFF,0x04,
+0x9D,0xFF,0xFF,0xFB,0x5F,0xFD,0xFF,0x03,0x80,0x7F,0xFF,0xC0,0xFE,0xFF,0x04,0xC1,
+0xFF,0xFF,0xFB,0x5F,0xFA,0xFF,0x00,0xC0,0xFE,0xFF,0x04,0xF7,0xFF,0xFF,0xFC,0x1F,
+0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xC0,0xFB,0xFF,0x0D,0xFE,0x3F,0xFF,0xFC,0x3F,0xFF,
+0xF0,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,0x01,0xFC,0xFF,0x06,0xF9,0xDF,0xFF,0xED,0x7F,
+0xFF,0xC0,0xFB,0xFF,0x09,0xF8,0x1F,0xFF,0xFB,0xDF,0xFF,0xE9,0x7F,0xFF,0xC0,0xFB,
+0xFF,0x09,0xF8,0x1F,0xFF,0xF9,0x9F,0xFF,0xE0,0x7F,0xFF,0xC0,0xFE,0xFF,0x0C,0xD1,
+0xFF,0xFF,0xF9,0xFF,0xFF,0xE0,0x1F,0xFF,0xF0,0x7F,0xFF,0xC0,0xFE,0xFF,0x03,0x95,
+0xFF,0xFF,0xFB,0xF9,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xB5,0xF6,0xFF,0x00,0xC0,0xFE,
+0xFF,0x00,0x81,0xFC,0xFF,0x06,0xE0,0x1F,0xFF,0x80,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,
+0xC1,0xF6,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xBF,0xFC,0xFF,0x01,
+0xFC,0x9F,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0x8F,0x7F,0xFD,0xFF,0x01,0xFA,0x5F,
+0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0xE0,0x7F,0xFD,0xFF,0x01,0xFB,0x5F,0xFD,0xFF,
+0x00,0xC0,0xFE,0xFF,0x00,0xF0,0xFC,0xFF,0x06,0xF9,0x1F,0xFF,0xE0,0xFF,0xFF,0xC0,
+0xFE,0xFF,0x00,0xC3,0xFC,0xFF,0x06,0xFD,0x3F,0xFF,0xE0,0x7F,0xFF,0xC0,0xFE,0xFF,
+0x00,0x9F,0xF8,0xFF,0x02,0x7F,0xFF,0xC0,0xF8,0xFF,0x06,0xF8,0x07,0xFF,0xFF,0x7F,
+0xFF,0xC0,0xF8,0xFF,0x06,0xF8,0x07,0xFF,0xE0,0x7F,0xFF,0xC0,0xF8,0xFF,0x06,0xFB,
+0xDF,0xFF,0xE0,0x7F,0xFF,0xC0,0xF8,0xFF,0x01,0xFB,0xDF,0xFD,0xFF,0x00,0xC0,0xF8,
+0xFF,0x06,0xF8,0x1F,0xFF,0xE0,0x1F,0xFF,0xC0,0xFE,0xFF,0x00,0xC3,0xFC,0xFF,0x06,
+0xFE,0x3F,0xFF,0xE0,0x1F,0xFF,0xC0,0xFE,0xFF,0x00,0x9D,0xF9,0xFF,0x03,0xEF,0x7F,
+0xFF,0xC0,0xFE,0xFF,0x00,0xBD,0xFC,0xFF,0x06,0xE0,0x1F,0xFF,0xEF,0x7F,0xFF,0xC0,
+0xFE,0xFF,0x00,0x9D,0xFC,0xFF,0x06,0xE0,0x1F,0xFF,0xE0,0x7F,0xFF,0xC0,0xFE,0xFF,
+0x00,0xDB,0xF9,0xFF,0x03,0xF8,0xFF,0xFF,0xC0,0xF8,0xFF,0x01,0xFD,0x1F,0xFD,0xFF,
+0x00,0xC0,0xFE,0xFF,0x00,0xC3,0xFC,0xFF,0x06,0xF9,0x5F,0xFF,0xF0,0xFF,0xFF,0xC0,
+0xFE,0xFF,0x00,0xD9,0xFC,0xFF,0x06,0xFB,0x5F,0xFF,0xE6,0x7F,0xFF,0xC0,0xFE,0xFF,
+0x00,0xBD,0xFC,0xFF,0x06,0xFA,0x5F,0xFF,0xEF,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0xBD,
+0xFC,0xFF,0x06,0xF8,0x1F,0xFF,0xE7,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0xC1,0xFC,0xFF,
+0x06,0xFC,0x1F,0xFF,0x80,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0xE3,0xF9,0xFF,0x03,0x80,
+0x7F,0xFF,0xC0,0xF8,0xFF,0x01,0xF8,0xF7,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xFD,
+0xFC,0xFF,0x06,0xFC,0x37,0xFF,0xF4,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0xFD,0xFB,0xFF,
+0x05,0x87,0xFF,0xE5,0x7F,0xFF,0xC0,0xF8,0xFF,0x06,0xFE,0x1F,0xFF,0xED,0x7F,0xFF,
+0xC0,0xF8,0xFF,0x06,0xF8,0xFF,0xFF,0xE9,0x7F,0xFF,0xC0,0xFE,0xFF,0x01,0xFC,0x7F,
+0xFA,0xFF,0x03,0xE0,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0xFD,0xF9,0xFF,0x03,0xF8,0x7F,
+0xFF,0xC0,0xF2,0xFF,0x00,0xC0,0xF5,0xFF,0x03,0xC0,0xFF,0xFF,0xC0,0xF5,0xFF,0x03,
+0xC0,0x7F,0xFF,0xC0,0xF5,0xFF,0x03,0xEF,0x7F,0xFF,0xC0,0xF2,0xFF,0x04,0xC0,0xFF,
+0xFF,0xFE,0x01,0xF9,0xFF,0x03,0xF0,0xFF,0xFF,0xC0,0xF5,0xFF,0x03,0xF5,0x7F,0xFF,
+0xC0,0xF5,0xFF,0x03,0xED,0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0x01,0xF9,0xFF,0x03,0xE5,
+0x7F,0xFF,0xC0,0xFE,0xFF,0x00,0x01,0xF9,0xFF,0x03,0xF0,0x7F,0xFF,0xC0,0xFE,0xFF,
+0x00,0xBD,0xF6,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xF7,0xF6,0xFF,0x00,0xC0,0xFE,0xFF,
+0x00,0xC1,0xF6,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0x9D,0xF6,0xFF,0x00,0xC0,0xFE,0xFF,
+0x00,0xBD,0xF6,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0x99,0xF6,0xFF,0x04,0xC0,0xFF,0xFF,
+0xFE,0x01,0xF6,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xFE,0xFF,
+0x00,0xFD,0xF6,0xFF,0x00,0xC0,0xFE,0xFF,0x00,0xFD,0xF6,0xFF,0x00,0xC0,0xF2,0xFF,
+0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+};
+
+// first : 4000 bytes, packed 3097
+const unsigned char first_packed[] PROGMEM =
+{
+0xA0,0x0F,0x00,0x00,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF4,0xFF,0x02,0xFE,0x33,0xC0,0xF4,0xFF,
+0x02,0xFC,0x13,0xC0,0xF4,0xFF,0x02,0xFC,0x93,0xC0,0xF4,0xFF,0x02,0xFC,0x93,0xC0,
+0xF4,0xFF,0x02,0xFC,0x83,0xC0,0xF4,0xFF,0x02,0xFC,0xC7,0xC0,0xF2,0xFF,0x03,0xC0,
+0xFF,0xFF,0x3F,0xF6,0xFF,0x04,0x0F,0xC0,0xFF,0x3E,0x3F,0xF7,0xFF,0x05,0xFE,0x07,
+0xC0,0xFE,0x7C,0x3F,0xF7,0xFF,0x05,0xFC,0x63,0xC0,0xFE,0x79,0x3F,0xF7,0xFF,0x05,
+0xFC,0xF3,0xC0,0xFE,0x71,0x3F,0xF7,0xFF,0x05,0xFC,0xF3,0xC0,0xFE,0x07,0x3F,0xF7,
+0xFF,0x12,0xFC,0xE3,0xC0,0xFF,0x0F,0x3F,0xF8,0x00,0x03,0xFF,0xE7,0xE1,0xCE,0x70,
+0x00,0x07,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xF8,0x00,0x03,0xFF,0xE7,0xE1,0xCE,0x70,
+0x00,0x07,0xFF,0xC7,0xC0,0xFE,0xFF,0x3C,0xF9,0xFF,0xF3,0xFF,0x81,0xF8,0x0E,0x73,
+0xFF,0xE7,0xFC,0x83,0xC0,0xFF,0xFE,0x3F,0xF9,0xFF,0xF3,0xFF,0x80,0xF8,0x0E,0x73,
+0xFF,0xE7,0xFC,0xB3,0xC0,0xFF,0xFE,0x3F,0xF9,0xFF,0xF3,0xFF,0x80,0xF8,0x0E,0x73,
+0xFF,0xE7,0xFC,0xB3,0xC0,0xFF,0xFE,0x3F,0xF9,0xC0,0x73,0x80,0x1F,0x01,0xCF,0xF3,
+0x80,0xE7,0xFC,0x27,0xC0,0xFE,0xFF,0x0C,0xF9,0xC0,0x73,0x80,0x1F,0x01,0xCF,0xF3,
+0x80,0xE7,0xFC,0x03,0xC0,0xFE,0xFF,0x0C,0xF9,0xC0,0x73,0x80,0x1F,0x01,0xCF,0xF3,
+0x80,0xE7,0xFE,0x03,0xC0,0xFE,0xFF,0x6C,0xF9,0xC0,0x73,0xFF,0xFC,0x01,0xFE,0x73,
+0x80,0xE7,0xFF,0xFF,0xC0,0xFF,0x7F,0x3F,0xF9,0xC0,0x73,0xFF,0xFC,0x01,0xFE,0x73,
+0x80,0xE7,0xFF,0xFF,0xC0,0xFE,0x7F,0x3F,0xF9,0xC0,0x73,0xFF,0xFC,0x01,0xFE,0x73,
+0x80,0xE7,0xFF,0xFF,0xC0,0xFE,0x00,0x3F,0xF9,0xC0,0x73,0xF0,0xFF,0x00,0x3E,0x73,
+0x80,0xE7,0xFF,0xFF,0xC0,0xFE,0x00,0x3F,0xF9,0xC0,0x73,0xF0,0xFF,0x00,0x3E,0x73,
+0x80,0xE7,0xFC,0x03,0xC0,0xFF,0xFF,0x3F,0xF9,0xC0,0x73,0xF0,0xFF,0x00,0x3E,0x73,
+0xC0,0xE7,0xFC,0x03,0xC0,0xFF,0xFF,0x3F,0xF9,0xFF,0xF3,0x9C,0xE0,0xF8,0x0E,0x73,
+0xFF,0xE7,0xFE,0x7F,0xC0,0xFE,0xFF,0x0C,0xF9,0xFF,0xF3,0x9C,0xE0,0xF8,0x0E,0x73,
+0xFF,0xE7,0xFC,0xFF,0xC0,0xFE,0xFF,0x2F,0xF9,0xFF,0xF3,0x9C,0xE3,0xF8,0xCE,0x73,
+0xFF,0xE7,0xFC,0xFF,0xC0,0xFE,0x3E,0x3F,0xF8,0x00,0x03,0x9C,0xE7,0x39,0xCE,0x70,
+0x00,0x07,0xFC,0xFF,0xC0,0xFE,0x67,0x3F,0xF8,0x00,0x03,0x9C,0xE7,0x39,0xCE,0x70,
+0x00,0x07,0xFC,0x03,0xC0,0xFE,0x67,0x3F,0xFE,0xFF,0x03,0x9F,0xE7,0x39,0xCF,0xFE,
+0xFF,0x05,0xFE,0x03,0xC0,0xFE,0x67,0x3F,0xFE,0xFF,0x03,0x83,0xE7,0x38,0x01,0xFC,
+0xFF,0x03,0xC0,0xFE,0x03,0x3F,0xFE,0xFF,0x03,0x83,0xE7,0x38,0x01,0xFC,0xFF,0x03,
+0xC0,0xFF,0x10,0x7F,0xFE,0xFF,0x03,0x83,0xE7,0x3F,0xF1,0xFC,0xFF,0x0C,0xC0,0xFF,
+0xF8,0xFF,0xFE,0x00,0x03,0x83,0x87,0x07,0xF8,0x00,0x7C,0xFE,0xFF,0x00,0xC0,0xFE,
+0xFF,0x08,0xFE,0x00,0x03,0x83,0x87,0x07,0xF8,0x00,0x7C,0xFE,0xFF,0x00,0xC0,0xFB,
+0xFF,0x09,0xE3,0x87,0x07,0xF0,0x73,0xFC,0xFF,0xFF,0xC7,0xC0,0xFE,0xFF,0x0C,0xF9,
+0xFF,0xFF,0xF3,0x87,0x00,0x00,0x73,0xFC,0xFF,0xFC,0x83,0xC0,0xFE,0xFF,0x0C,0xF9,
+0xFF,0xFF,0xF3,0x87,0x00,0x00,0x73,0xFC,0xFF,0xFC,0xB3,0xC0,0xFE,0xFF,0x0C,0xF9,
+0xFB,0xFE,0xF3,0x87,0xF9,0xF8,0x7E,0xF7,0xF7,0xFC,0xB3,0xC0,0xFE,0xFF,0x0C,0xF9,
+0xF0,0x00,0x73,0x87,0xF9,0xF8,0x7E,0x73,0xE7,0xFC,0x27,0xC0,0xFE,0xFF,0x28,0xF9,
+0xF0,0x00,0x73,0x87,0xF9,0xF8,0x7E,0x73,0xE7,0xFC,0x03,0xC0,0xFC,0xC0,0x3F,0xFF,
+0xCF,0xFC,0x1F,0x80,0x38,0x7E,0x7E,0x70,0xFF,0xFE,0x03,0xC0,0xFC,0xC0,0x3F,0xFF,
+0xCF,0xFE,0x1F,0x80,0x38,0x3E,0x7E,0x70,0xFE,0xFF,0x01,0xC0,0xFC,0xFE,0xFF,0x07,
+0xCF,0xFE,0x1F,0x80,0x38,0x3E,0x7E,0x70,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x07,0x03,
+0xF0,0x70,0x00,0xF9,0xFF,0xC0,0x70,0xFE,0xFF,0x0C,0xC0,0xFF,0xC0,0x3F,0xFE,0x03,
+0xF0,0x70,0x00,0xF9,0xFF,0xC0,0x70,0xFE,0xFF,0x0C,0xC0,0xFF,0xC0,0x3F,0xFF,0x03,
+0xF0,0xF0,0x00,0xF9,0xFF,0xC0,0x70,0xFE,0xFF,0x60,0xC0,0xFF,0xE7,0xFF,0xF9,0xFE,
+0x1F,0xFF,0x9C,0x39,0xC0,0x0F,0x83,0x9F,0xFF,0xFF,0xC0,0xFF,0xCF,0xFF,0xF9,0xFE,
+0x0F,0xFF,0x9C,0x39,0xC0,0x0F,0x83,0x9F,0xFF,0xFF,0xC0,0xFF,0xCF,0xFF,0xF9,0xFE,
+0x0F,0xFF,0x9C,0x39,0xC0,0x1F,0x83,0x9F,0xFF,0xFF,0xC0,0xFF,0xCF,0xFF,0xF8,0x03,
+0xC0,0x70,0x1C,0xE7,0xF8,0x73,0xF3,0x9F,0xFE,0x33,0xC0,0xFF,0xC0,0x3F,0xF8,0x03,
+0xC0,0x70,0x1C,0xE7,0xF8,0x73,0xF3,0x9F,0xFC,0x13,0xC0,0xFF,0xE0,0x3F,0xF8,0xF3,
+0xFF,0xFF,0xFD,0xE7,0xFF,0xF3,0xF3,0x9F,0xFC,0x93,0xC0,0xFE,0xFF,0x0C,0xF9,0xF3,
+0xFF,0xFF,0xE7,0xE7,0xCF,0xC3,0xF0,0x1F,0xFC,0x93,0xC0,0xFE,0xFF,0x0E,0xF9,0xF3,
+0xFF,0xFF,0xE7,0xE7,0xCF,0xC3,0xF0,0x1F,0xFC,0x83,0xC0,0xFF,0xF0,0xFC,0xFF,0x58,
+0xE7,0xFF,0xCF,0xC3,0xF0,0x1F,0xFC,0xC7,0xC0,0xFF,0xE0,0x7F,0xFF,0xFE,0x73,0x83,
+0xE7,0xF8,0x01,0xC0,0x70,0x07,0xFF,0xFF,0xC0,0xFF,0xC6,0x3F,0xFF,0xFE,0x73,0x83,
+0xE7,0xF8,0x01,0xC0,0x70,0x07,0xFC,0x07,0xC0,0xFF,0xCF,0x3F,0xFF,0xFE,0x7F,0x9F,
+0xE7,0xFE,0x01,0x8C,0x63,0x87,0xFC,0x03,0xC0,0xFF,0xCF,0x3F,0xFE,0x00,0x7F,0x9C,
+0x00,0x07,0x00,0x0E,0x03,0x87,0xFF,0xF3,0xC0,0xFF,0xCE,0x3F,0xFE,0x00,0x7F,0x9C,
+0x00,0x07,0x00,0x0E,0x03,0x87,0xFF,0xF3,0xC0,0xFE,0xFF,0x0C,0xFE,0x00,0x7F,0x9F,
+0xE0,0xFF,0xF8,0x7F,0xF3,0xFF,0xFF,0xF7,0xC0,0xFE,0xFF,0x0C,0xF8,0x00,0x70,0x03,
+0xE0,0xFF,0xF8,0x73,0xF3,0xFF,0xFC,0x03,0xC0,0xFE,0xFF,0x45,0xF8,0x00,0x70,0x03,
+0xE0,0xFF,0xF8,0x73,0xF3,0xFF,0xFC,0x03,0xC0,0xFC,0x00,0x3F,0xF8,0x31,0xFC,0x7E,
+0xE0,0xBD,0xF9,0xFF,0xE2,0xF7,0xFF,0xFF,0xC0,0xFC,0x00,0x3F,0xF8,0x73,0xFE,0x7C,
+0xE0,0x39,0xF9,0xCE,0x00,0xE7,0xFF,0xFF,0xC0,0xFF,0xF7,0xFF,0xF8,0x73,0xFE,0x7C,
+0xE0,0x39,0xF9,0xCE,0x00,0xE7,0xFF,0xFF,0xC0,0xFF,0xCF,0xFF,0xFF,0xFE,0x00,0x7F,
+0xE0,0xE0,0xFE,0x00,0x0C,0xE7,0xFF,0xFF,0xC0,0xFF,0xCF,0xFF,0xFF,0xFE,0x00,0x7F,
+0xE0,0xE0,0xFE,0x00,0x0C,0xE7,0xFC,0x03,0xC0,0xFF,0xCF,0xFF,0xFF,0xFE,0x00,0x7F,
+0xE0,0xE0,0xFE,0x00,0x06,0xE7,0xFC,0x03,0xC0,0xFF,0xC0,0x3F,0xFE,0xFF,0x0C,0x87,
+0x87,0x00,0x38,0x7F,0x83,0xE7,0xFE,0x7F,0xC0,0xFF,0xE0,0x3F,0xFE,0xFF,0x09,0x83,
+0x87,0x00,0x38,0x7F,0x83,0xE7,0xFC,0xFF,0xC0,0xFB,0xFF,0x09,0x87,0x87,0x00,0x38,
+0x7F,0x83,0xE7,0xFC,0xFF,0xC0,0xFE,0xFF,0x0C,0xF8,0x00,0x03,0xFF,0x80,0xF9,0xF8,
+0x73,0x9F,0xE7,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xF8,0x00,0x03,0xFF,0x80,0xF9,0xF8,
+0x73,0x9F,0xE7,0xFC,0x00,0x00,0xFE,0xFF,0x0C,0xF8,0x00,0x03,0xFF,0x81,0xF9,0xF8,
+0x73,0x9F,0xE7,0xFC,0x00,0x00,0xFE,0xFF,0x0C,0xF9,0xFF,0xF3,0x83,0x87,0x3F,0x00,
+0x7F,0x80,0xE7,0xFE,0x77,0xC0,0xFE,0xFF,0x0C,0xF9,0xFF,0xF3,0x83,0x87,0x3F,0x00,
+0x7F,0x80,0xE7,0xFC,0xF3,0xC0,0xFE,0xFF,0x67,0xF9,0xFF,0xF3,0x87,0xB7,0xBF,0x04,
+0x7F,0x80,0xE7,0xFC,0xF3,0xC0,0xFE,0x00,0x3F,0xF9,0xC0,0x73,0x9F,0xFF,0xE7,0x0E,
+0x00,0x00,0xE7,0xFC,0xE3,0xC0,0xFE,0x00,0x3F,0xF9,0xC0,0x73,0x9F,0xFF,0xE7,0x0E,
+0x00,0x00,0xE7,0xFC,0x07,0xC0,0xFE,0x00,0x3F,0xF9,0xC0,0x73,0x9F,0xFF,0xC7,0x3F,
+0x80,0x7C,0xE7,0xFF,0x0F,0xC0,0xFE,0x67,0x3F,0xF9,0xC0,0x73,0x9C,0xFC,0x07,0x3F,
+0xC0,0x7C,0xE7,0xFF,0xFF,0xC0,0xFE,0x67,0x3F,0xF9,0xC0,0x73,0x9C,0xFC,0x07,0x3F,
+0xC0,0x7C,0xE7,0xFF,0xFF,0xC0,0xFE,0x67,0x3F,0xF9,0xC0,0x73,0x9C,0xFF,0x3F,0x3F,
+0xF1,0xFD,0xFF,0x10,0xC0,0xFE,0x7F,0x3F,0xF9,0xC0,0x73,0x9C,0xFF,0x3F,0x38,0x73,
+0xFF,0x9F,0xFC,0x03,0xC0,0xFE,0xFF,0x0C,0xF9,0xC0,0x73,0x9C,0xFF,0x3F,0x38,0x73,
+0xFF,0x9F,0xFC,0x03,0xC0,0xFE,0xFF,0x06,0xF9,0xFF,0xF3,0x9F,0xFF,0x3F,0xF9,0xFE,
+0xFF,0x2E,0xFE,0x7F,0xC0,0xFF,0xF9,0xFF,0xF9,0xFF,0xF3,0x83,0xE7,0x07,0xF9,0xFE,
+0x1C,0xFF,0xFC,0xFF,0xC0,0xFF,0xF9,0xFF,0xF9,0xFF,0xF3,0x83,0xE7,0x07,0xF9,0xFE,
+0x1C,0xFF,0xFC,0xFF,0xC0,0xFF,0xF9,0xFF,0xF9,0xFF,0xE3,0xE3,0xFF,0x3F,0xFF,0xFF,
+0xFC,0xFE,0xFF,0x20,0xC0,0xFF,0xF9,0xFF,0xF8,0x00,0x03,0xF0,0xFC,0x3F,0x0F,0xC3,
+0xFC,0xE7,0xCC,0x03,0xC0,0xFF,0xF9,0xFF,0xF8,0x00,0x03,0xF0,0xFC,0x3F,0x0F,0xC3,
+0xFC,0xE7,0xCC,0x03,0xC0,0xF4,0xFF,0x02,0xCF,0xFF,0xC0,0xF2,0xFF,0x03,0xC0,0xFE,
+0x00,0x3F,0xF7,0xFF,0x05,0xFE,0x33,0xC0,0xFE,0x00,0x3F,0xF7,0xFF,0x05,0xFC,0x13,
+0xC0,0xFE,0x00,0x3F,0xF7,0xFF,0x04,0xFC,0x93,0xC0,0xFE,0x73,0xF6,0xFF,0x04,0xFC,
+0x93,0xC0,0xFE,0x73,0xF6,0xFF,0x04,0xFC,0x83,0xC0,0xFE,0x73,0xF6,0xFF,0x04,0xFC,
+0xC7,0xC0,0xFE,0x03,0xF4,0xFF,0x02,0xC0,0xFF,0x07,0xF4,0xFF,0x02,0xC0,0xFF,0x8F,
+0xF5,0xFF,0x01,0x0F,0xC0,0xFE,0xFF,0x01,0xFD,0xE7,0xF9,0xFF,0x07,0xFE,0x07,0xC0,
+0xFF,0xFC,0x7F,0xFB,0xC7,0xF9,0xFF,0x07,0xFC,0x93,0xC0,0xFF,0xC8,0x3F,0xFB,0x97,
+0xF9,0xFF,0x07,0xFC,0x93,0xC0,0xFF,0xCB,0x3F,0xFC,0x77,0xF9,0xFF,0x05,0xFC,0x93,
+0xC0,0xFF,0xCB,0x3F,0xF7,0xFF,0x05,0xFE,0x13,0xC0,0xFF,0xC2,0x7F,0xF6,0xFF,0x04,
+0x1F,0xC0,0xFF,0xC0,0x3F,0xF5,0xFF,0x05,0xC0,0xFF,0xE0,0x3F,0xF8,0x67,0xF7,0xFF,
+0x00,0xC0,0xFE,0xFF,0x01,0xFB,0x77,0xF7,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0xFB,0x77,
+0xF7,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0xFB,0x8F,0xF7,0xFF,0x03,0xC0,0xFF,0xC0,0x03,
+0xF5,0xFF,0x05,0xC0,0xFF,0xC0,0x03,0xFC,0x0F,0xF7,0xFF,0x05,0xC0,0xFF,0xE7,0x7F,
+0xF9,0xE7,0xF7,0xFF,0x05,0xC0,0xFF,0xCF,0x3F,0xFB,0xF7,0xF7,0xFF,0x05,0xC0,0xFF,
+0xCF,0x3F,0xF9,0xE7,0xF7,0xFF,0x05,0xC0,0xFF,0xCE,0x3F,0xFC,0x0F,0xF7,0xFF,0x03,
+0xC0,0xFF,0xC0,0x7F,0xF5,0xFF,0x05,0xC0,0xFF,0xF0,0xFF,0xFE,0xF7,0xF7,0xFF,0x00,
+0xC0,0xFD,0xFF,0x00,0x6F,0xFD,0xFF,0x02,0xFE,0x1F,0x0F,0xFE,0xFF,0x00,0xC0,0xFD,
+0xFF,0x00,0x9F,0xFD,0xFF,0x02,0xF8,0x0F,0x8F,0xFE,0xFF,0x05,0xC0,0xFF,0xF0,0xFF,
+0xFF,0x9F,0xFD,0xFF,0x02,0xF0,0x07,0x87,0xFE,0xFF,0x05,0xC0,0xFF,0xE0,0x7F,0xFF,
+0x6F,0xFD,0xFF,0x02,0xF1,0xC7,0xC7,0xFE,0xFF,0x05,0xC0,0xFF,0xC9,0x3F,0xFE,0xF7,
+0xFD,0xFF,0x02,0xF1,0xE3,0xC7,0xFE,0xFF,0x03,0xC0,0xFF,0xC9,0x3F,0xFB,0xFF,0x02,
+0xC0,0x00,0x00,0xFE,0xFF,0x05,0xC0,0xFF,0xC9,0x3F,0xFD,0xF7,0xFD,0xFF,0x02,0xC0,
+0x00,0x00,0xFE,0xFF,0x05,0xC0,0xFF,0xE1,0x3F,0xFB,0xF7,0xFD,0xFF,0x02,0xF1,0xF1,
+0xC7,0xFE,0xFF,0x05,0xC0,0xFF,0xF1,0xFF,0xF8,0x07,0xFD,0xFF,0x02,0xF1,0xF1,0x87,
+0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x00,0xF7,0xFD,0xFF,0x02,0xF1,0xF8,0x0F,0xFE,0xFF,
+0x00,0xC0,0xFD,0xFF,0x00,0xF7,0xFD,0xFF,0x02,0xF8,0xF8,0x0F,0xFE,0xFF,0x00,0xC0,
+0xF7,0xFF,0x01,0xFE,0x1F,0xFE,0xFF,0x03,0xC0,0xFF,0xC0,0x3F,0xF5,0xFF,0x05,0xC0,
+0xFF,0xC0,0x3F,0xFD,0xE7,0xF7,0xFF,0x05,0xC0,0xFF,0xE7,0xFF,0xFB,0xC7,0xFD,0xFF,
+0x00,0xF1,0xFC,0xFF,0x05,0xC0,0xFF,0xCF,0xFF,0xFB,0x97,0xFD,0xFF,0x00,0xF1,0xFC,
+0xFF,0x05,0xC0,0xFF,0xCF,0xFF,0xFC,0x77,0xFD,0xFF,0x02,0xF1,0xFF,0xE7,0xFE,0xFF,
+0x00,0xC0,0xF8,0xFF,0x02,0xF1,0xFF,0x87,0xFE,0xFF,0x00,0xC0,0xF8,0xFF,0x02,0xF1,
+0xFE,0x07,0xFE,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0xFD,0xE7,0xFD,0xFF,0x02,0xF1,0xF8,
+0x07,0xFE,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0xFB,0xC7,0xFD,0xFF,0x02,0xF1,0xC0,0x1F,
+0xFE,0xFF,0x00,0xC0,0xFE,0xFF,0x01,0xFB,0x97,0xFD,0xFF,0x02,0xF1,0x00,0x7F,0xFE,
+0xFF,0x05,0xC0,0xFE,0x00,0x3F,0xFC,0x77,0xFD,0xFF,0x01,0xF0,0x03,0xFD,0xFF,0x03,
+0xC0,0xFE,0x00,0x3F,0xFB,0xFF,0x01,0xF0,0x0F,0xFD,0xFF,0x03,0xC0,0xFE,0x7F,0x3F,
+0xFB,0xFF,0x01,0xF0,0x7F,0xFD,0xFF,0x03,0xC0,0xFE,0x7F,0x3F,0xFD,0xFF,0x02,0xFD,
+0xFF,0xF1,0xFC,0xFF,0x03,0xC0,0xFE,0x7F,0x3F,0xFD,0xFF,0x00,0xFC,0xFA,0xFF,0x03,
+0xC0,0xFE,0x3E,0x3F,0xFD,0xFF,0x00,0xFC,0xFA,0xFF,0x03,0xC0,0xFE,0x3C,0x3F,0xFD,
+0xFF,0x00,0xFC,0xFA,0xFF,0x08,0xC0,0xFF,0x00,0x7F,0xFE,0x00,0xFF,0xFE,0x38,0xFE,
+0xFF,0x00,0xC7,0xFE,0xFF,0x0C,0xC0,0xFF,0x00,0xFF,0xFF,0x77,0xFF,0xFC,0x18,0x7F,
+0xFF,0xFF,0xC7,0xFE,0xFF,0x0C,0xC0,0xFF,0xC1,0xFF,0xFE,0xF7,0xFF,0xFC,0xC8,0x7F,
+0xFF,0xFF,0xC7,0xFE,0xFF,0x00,0xC0,0xFE,0xFF,0x05,0xFE,0xF7,0xFF,0xF8,0x00,0x1F,
+0xFB,0xFF,0x00,0xC0,0xFD,0xFF,0x07,0x0F,0xFF,0xFC,0xE0,0x7F,0xFF,0xFE,0x3F,0xFE,
+0xFF,0x00,0xC0,0xFB,0xFF,0x05,0xFC,0x60,0x7F,0xFF,0xFC,0x3F,0xFE,0xFF,0x03,0xC0,
+0xFC,0xC0,0x3F,0xFD,0xFF,0x04,0xF0,0xFF,0xFF,0xF0,0x3F,0xFE,0xFF,0x0C,0xC0,0xFC,
+0xC0,0x3F,0xF6,0x07,0xFF,0xFF,0xF3,0xFF,0xFF,0xE3,0x3F,0xFE,0xFF,0x01,0xC0,0xFC,
+0xFB,0xFF,0x04,0xF3,0xFF,0xFF,0x87,0x3F,0xFE,0xFF,0x00,0xC0,0xFE,0xFF,0x08,0xFE,
+0xF7,0xFF,0xFF,0xF3,0xFF,0xFE,0x1F,0x3F,0xFE,0xFF,0x0C,0xC0,0xFF,0xE3,0x3F,0xFF,
+0x6F,0xFF,0xFE,0xF2,0x7F,0xFE,0x00,0x07,0xFE,0xFF,0x0C,0xC0,0xFF,0xC1,0x3F,0xFF,
+0x9F,0xFF,0xFC,0xF2,0x7F,0xFE,0x00,0x07,0xFE,0xFF,0x0C,0xC0,0xFF,0xC9,0x3F,0xFF,
+0x9F,0xFF,0xFC,0x00,0x7F,0xFE,0x00,0x07,0xFE,0xFF,0x0C,0xC0,0xFF,0xC9,0x3F,0xFF,
+0x6F,0xFF,0xFC,0x00,0x7F,0xFF,0xFF,0x3F,0xFE,0xFF,0x0C,0xC0,0xFF,0xC8,0x3F,0xFE,
+0xF7,0xFF,0xFF,0xE6,0x7F,0xFF,0xFF,0x3F,0xFE,0xFF,0x03,0xC0,0xFF,0xCC,0x7F,0xFD,
+0xFF,0x01,0xE6,0x7F,0xFB,0xFF,0x00,0xC0,0xFD,0xFF,0x03,0x0F,0xFF,0xFF,0xE7,0xFA,
+0xFF,0x00,0xC0,0xFE,0xFF,0x07,0xFE,0xA7,0xFF,0xFF,0xE7,0xFF,0xFF,0x83,0xFD,0xFF,
+0x0C,0xC0,0xFF,0xC0,0x03,0xFE,0xB7,0xFF,0xFF,0xC7,0xFF,0xFF,0x01,0x87,0xFE,0xFF,
+0x0C,0xC0,0xFF,0xC0,0x03,0xFE,0xB7,0xFF,0xFF,0xCF,0xFF,0xFE,0x00,0xC7,0xFE,0xFF,
+0x0C,0xC0,0xFF,0xE7,0x7F,0xFF,0x2F,0xFF,0xFE,0xCE,0x7F,0xFE,0x38,0xC7,0xFE,0xFF,
+0x03,0xC0,0xFF,0xCF,0x3F,0xFE,0xFF,0x05,0xFC,0xCE,0x7F,0xFE,0x38,0xC7,0xFE,0xFF,
+0x03,0xC0,0xFF,0xCF,0x3F,0xFE,0xFF,0x05,0xFC,0x00,0x7F,0xFE,0x39,0x87,0xFE,0xFF,
+0x0C,0xC0,0xFF,0xCE,0x3F,0xF0,0x07,0xFF,0xFC,0x00,0x7F,0xFE,0x00,0x0F,0xFE,0xFF,
+0x03,0xC0,0xFF,0xC0,0x7F,0xFD,0xFF,0x04,0x8E,0x7F,0xFF,0x00,0x1F,0xFE,0xFF,0x02,
+0xC0,0xFF,0xF0,0xFC,0xFF,0x04,0x9E,0x7F,0xFF,0xC0,0x7F,0xFE,0xFF,0x00,0xC0,0xFD,
+0xFF,0x03,0x37,0xFF,0xFF,0x9F,0xFA,0xFF,0x00,0xC0,0xFE,0xFF,0x04,0xFE,0xB7,0xFF,
+0xFF,0x9F,0xFA,0xFF,0x09,0xC0,0xFC,0x00,0x3F,0xFE,0xD7,0xFF,0xFF,0x9C,0x7F,0xFB,
+0xFF,0x09,0xC0,0xFC,0x00,0x3F,0xFE,0xCF,0xFF,0xFF,0x9C,0x7F,0xFB,0xFF,0x00,0xC0,
+0xFA,0xFF,0x01,0x1C,0x7F,0xFB,0xFF,0x03,0xC0,0xFF,0xFC,0x7F,0xFD,0xFF,0x00,0x3F,
+0xFA,0xFF,0x03,0xC0,0xFF,0xC8,0x3F,0xFD,0xFF,0x00,0x3F,0xFA,0xFF,0x03,0xC0,0xFF,
+0xCB,0x3F,0xFE,0xFF,0x02,0xFC,0x3C,0x7F,0xFB,0xFF,0x03,0xC0,0xFF,0xCB,0x3F,0xFE,
+0xFF,0x02,0xFC,0x0E,0x7F,0xFB,0xFF,0x03,0xC0,0xFF,0xC2,0x7F,0xFE,0xFF,0x02,0xFC,
+0x0E,0x7F,0xFB,0xFF,0x03,0xC0,0xFF,0xC0,0x3F,0xFE,0xFF,0x02,0xFC,0x0E,0x7F,0xFB,
+0xFF,0x03,0xC0,0xFF,0xE0,0x3F,0xFE,0xFF,0x02,0xFC,0x06,0x7F,0xFB,0xFF,0x00,0xC0,
+0xFB,0xFF,0x01,0xFE,0x20,0xFA,0xFF,0x00,0xC0,0xFB,0xFF,0x01,0xFE,0x71,0xFA,0xFF,
+0x00,0xC0,0xFB,0xFF,0x01,0xFE,0x7F,0xFA,0xFF,0x03,0xC0,0xFF,0xDF,0xF3,0xFE,0xFF,
+0x01,0xFE,0x7F,0xFA,0xFF,0x03,0xC0,0xFF,0xC3,0xF3,0xFE,0xFF,0x01,0xFC,0x30,0xFA,
+0xFF,0x03,0xC0,0xFF,0xC0,0x63,0xFE,0xFF,0x02,0xFC,0x00,0x7F,0xFB,0xFF,0x03,0xC0,
+0xFF,0xFC,0x07,0xFE,0xFF,0x02,0xFC,0xC6,0x7F,0xFB,0xFF,0x03,0xC0,0xFF,0xFE,0x0F,
+0xFE,0xFF,0x02,0xFC,0xCE,0x7F,0xFB,0xFF,0x03,0xC0,0xFF,0xF8,0x3F,0xFE,0xFF,0x02,
+0xFC,0xC6,0x7F,0xFB,0xFF,0x02,0xC0,0xFF,0xE0,0xFD,0xFF,0x02,0xFC,0x00,0x7F,0xFB,
+0xFF,0x02,0xC0,0xFF,0xC3,0xFD,0xFF,0x00,0xFC,0xF9,0xFF,0x02,0xC0,0xFF,0xCF,0xFD,
+0xFF,0x00,0xF9,0xF9,0xFF,0x00,0xC0,0xFB,0xFF,0x00,0xF9,0xF9,0xFF,0x00,0xC0,0xFB,
+0xFF,0x00,0xFD,0xF9,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,
+0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xAF,0x00,0x09,0x07,0xFF,
+0xE0,0x00,0x7C,0x00,0x0F,0xC0,0x01,0xFF,0xFB,0x00,0x0A,0x07,0xFF,0xE0,0x00,0x7C,
+0x00,0x1F,0xE0,0x03,0xFF,0xE0,0xFC,0x00,0x0A,0x07,0xFF,0xE0,0x00,0x7C,0x00,0x1F,
+0xE0,0x03,0xFF,0xF0,0xFC,0x00,0x0A,0x07,0xFF,0xE0,0x00,0x7C,0x00,0x1F,0xE0,0x03,
+0xFF,0xF8,0xFB,0x00,0x09,0x03,0xE0,0x00,0x7C,0x00,0x3F,0xF0,0x03,0x81,0xFC,0xFB,
+0x00,0x09,0x03,0xE0,0x00,0x7C,0x00,0x3F,0xF0,0x02,0x00,0xFC,0xFB,0x00,0x09,0x03,
+0xE0,0x00,0x7C,0x00,0x3E,0xF0,0x00,0x00,0xFC,0xFB,0x00,0x09,0x03,0xE0,0x00,0x7C,
+0x00,0x7C,0xF8,0x00,0x00,0xFC,0xFB,0x00,0x09,0x03,0xE0,0x00,0x7C,0x00,0x7C,0xF8,
+0x00,0x01,0xFC,0xFB,0x00,0x09,0x03,0xE0,0x00,0x7C,0x00,0x7C,0x78,0x00,0x07,0xFC,
+0xFC,0x00,0x0A,0x07,0xFF,0xE0,0x00,0x7C,0x00,0xF8,0x7C,0x00,0x3F,0xF8,0xFC,0x00,
+0x0A,0x07,0xFF,0xE0,0x00,0x7C,0x00,0xF8,0x7C,0x00,0xFF,0xF0,0xFC,0x00,0x0A,0x07,
+0xFF,0xE0,0x00,0x7C,0x01,0xF8,0x3E,0x01,0xFF,0xE0,0xFC,0x00,0x0A,0x07,0xFF,0xE0,
+0x00,0x7C,0x01,0xF0,0x3E,0x03,0xFF,0x80,0xFB,0x00,0x08,0x03,0xE0,0x00,0x7C,0x01,
+0xF0,0x3E,0x03,0xFE,0xFA,0x00,0x08,0x03,0xE0,0x00,0x7C,0x03,0xFF,0xFF,0x07,0xF8,
+0xFA,0x00,0x08,0x03,0xE0,0x00,0x7C,0x03,0xFF,0xFF,0x07,0xF0,0xFA,0x00,0x08,0x03,
+0xE0,0x00,0x7C,0x03,0xFF,0xFF,0x07,0xE0,0xFA,0x00,0x09,0x03,0xE0,0x00,0x7C,0x07,
+0xFF,0xFF,0x87,0xE0,0x04,0xFB,0x00,0x09,0x03,0xE0,0x00,0x7C,0x07,0xC0,0x0F,0x87,
+0xE0,0x0C,0xFB,0x00,0x09,0x03,0xE0,0x00,0x7C,0x07,0xC0,0x0F,0x83,0xF8,0x3C,0xFC,
+0x00,0x0A,0x0F,0xFF,0xE0,0xFF,0xFC,0x0F,0xC0,0x0F,0xC3,0xFF,0xFC,0xFC,0x00,0x0A,
+0x0F,0xFF,0xE0,0xFF,0xFC,0x0F,0x80,0x07,0xC1,0xFF,0xFC,0xFC,0x00,0x0A,0x0F,0xFF,
+0xE0,0xFF,0xFC,0x0F,0x80,0x07,0xC0,0xFF,0xFC,0xFC,0x00,0x0A,0x0F,0xFF,0xE0,0xFF,
+0xFC,0x1F,0x80,0x07,0xE0,0x1F,0xE0,0xCE,0x00,
+};
+
+// second : 4000 bytes, packed 3634
+const unsigned char second_packed[] PROGMEM =
+{
+0xA0,0x0F,0x00,0x00,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,
+0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xFD,0xFF,0x00,0xF7,0xF7,0xFF,0x00,0xC0,
+0xFD,0xFF,0x00,0xF3,0xFB,0xFF,0x00,0xBF,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x00,0xF9,
+0xFB,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFE,
+0x7F,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x01,0xFC,0x7F,0xFD,0xFF,0x00,0xF8,0xFD,0xFF,
+0x00,0xC0,0xFD,0xFF,0x01,0xFE,0x1F,0xFD,0xFF,0x00,0xF1,0xFD,0xFF,0x00,0xC0,0xFC,
+0xFF,0x00,0x07,0xFD,0xFF,0x00,0xC3,0xFD,0xFF,0x06,0xC0,0xFF,0xFF,0xFC,0xFF,0xFF,
+0x81,0xFE,0xFF,0x7F,0xFE,0x07,0xFF,0xFC,0x7F,0xFF,0xC0,0xFF,0xFF,0xF8,0x3F,0xFF,
+0xE0,0x7F,0xFF,0xFF,0xFC,0x0F,0xFF,0xF0,0x7F,0xFF,0xC0,0xFF,0xFF,0xF8,0x1F,0xFF,
+0xF8,0x3F,0xFF,0xFF,0xF0,0x3F,0xFF,0xE0,0x3F,0xFF,0xC0,0xFF,0xFF,0xF0,0x07,0xFF,
+0xFE,0x1F,0xFF,0xFF,0xE0,0xFF,0xFF,0xC0,0x1F,0xFF,0xC0,0xFF,0xFF,0xE0,0x03,0xFF,
+0xFF,0x0F,0xFF,0xFF,0xC3,0xFF,0xFF,0x80,0x1F,0xFF,0xC0,0xFF,0xFF,0xE0,0x01,0xFF,
+0xFF,0x87,0xFF,0xFF,0x87,0xFF,0xFF,0x00,0x0F,0xFF,0xC0,0xFF,0xFF,0xE0,0x01,0xFF,
+0xFF,0xC3,0xFF,0xFF,0x8F,0xFF,0xFE,0x00,0x0F,0xFF,0xC0,0xFF,0xFF,0xC0,0x00,0xFF,
+0xFF,0xE3,0xFF,0xFF,0x1F,0xFF,0xFC,0x00,0x0F,0xFF,0xC0,0xFF,0xFF,0xC0,0x00,0x7F,
+0xFF,0xF1,0xFF,0xFE,0x66,0x3F,0xFF,0xFC,0x00,0x07,0xFF,0xC0,0xFF,0xFF,0x80,0x00,
+0x7F,0xFF,0xF9,0xFF,0xFE,0x3F,0xFF,0xF8,0x00,0x07,0xFF,0xC0,0xFF,0xFF,0x80,0x00,
+0x3F,0xFF,0xFC,0xFF,0xFE,0x7F,0xFF,0xF8,0x00,0x07,0xFF,0xC0,0xFF,0xFF,0x80,0x00,
+0x3F,0xFB,0xFC,0xFF,0xFC,0xFF,0x7F,0xF0,0x00,0x03,0xFF,0xC0,0xFF,0xFF,0x80,0x00,
+0x3F,0xF9,0xFE,0xFF,0xFC,0xFF,0x7F,0xF0,0x00,0x07,0xFF,0xC0,0xFF,0xFF,0xF8,0x00,
+0x1F,0xFD,0xFE,0x7F,0xFD,0xFE,0x7F,0xF0,0x00,0x7F,0xFF,0xC0,0xFF,0xFF,0xFE,0x00,
+0x1F,0xFC,0xFE,0x7F,0xF9,0xFE,0xFF,0xE0,0x00,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x00,
+0x1F,0xFE,0xFF,0x7F,0xF9,0xFC,0xFF,0xE0,0x03,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xC0,
+0x0F,0xFE,0xFF,0x3F,0xFB,0xFC,0xFF,0xE0,0x07,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xE0,
+0x0F,0xFE,0x7F,0x3F,0xFB,0xFD,0xFF,0xC0,0x0F,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xF0,
+0x0F,0xFE,0x7F,0xBF,0xF3,0xF9,0xFF,0xC0,0x1F,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xF8,
+0x0F,0xFE,0x3F,0xBF,0xF3,0xF9,0xFF,0xC0,0x3F,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0xFC,
+0x0F,0xFF,0x3F,0xBF,0xF7,0xF1,0xFF,0xC0,0x7F,0xFF,0xFF,0xC0,0xFE,0xFF,0x08,0xFC,
+0x0F,0xFF,0x3F,0x9F,0xF7,0xF1,0xFF,0xC0,0xFE,0xFF,0x00,0xC0,0xFE,0xFF,0x08,0xFE,
+0x0F,0xFF,0x3F,0x9F,0xF7,0xF1,0xFF,0xC0,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x07,0x07,
+0xFF,0x1F,0x9F,0xF7,0xF1,0xFF,0xC1,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x07,0x07,0xFF,
+0x5F,0x9F,0xE7,0xED,0xFF,0x83,0xFE,0xFF,0x00,0xC0,0xFD,0xFF,0x07,0x87,0xFF,0x5F,
+0x9F,0xE7,0xE9,0xFF,0x87,0xFE,0xFF,0x7F,0xC0,0xFF,0xFE,0x7F,0xFF,0xC3,0xFE,0x4F,
+0xDF,0xE7,0xED,0xFF,0x87,0xFF,0xF9,0xFF,0xC0,0xFF,0xFF,0x0F,0xFF,0xC3,0xFE,0xCF,
+0x9F,0xE7,0xEC,0xFF,0x0F,0xFF,0xE3,0xFF,0xC0,0xFF,0xFF,0x83,0xFF,0xE1,0xFE,0xEF,
+0xDF,0xE7,0xCC,0xFF,0x0F,0xFF,0x87,0xFF,0xC0,0xFF,0xFF,0xC1,0xFF,0xE1,0xFC,0xEF,
+0x9F,0xE7,0xCC,0x7E,0x1F,0xFE,0x0F,0xFF,0xC0,0xFF,0xFF,0xC0,0x7F,0xF0,0xF0,0xEF,
+0x8F,0xE7,0xCE,0x3C,0x3F,0xF8,0x0F,0xFF,0xC0,0xFF,0xFF,0xE0,0x3F,0xF8,0x01,0xE7,
+0x9F,0xE7,0xCE,0x00,0x3F,0xF0,0x1F,0xFF,0xC0,0xFF,0xFF,0xE0,0x1F,0xFC,0x03,0xE7,
+0x9F,0xE7,0xCF,0x00,0x7F,0xE0,0x1F,0xFF,0xC0,0xFF,0xFF,0xF0,0x0F,0xFE,0x03,0xE7,
+0x9F,0xE7,0xCF,0x80,0xFF,0xC0,0x3F,0xFF,0x7F,0xC0,0xFF,0xFF,0xF0,0x07,0xFF,0x0F,
+0xE7,0x9E,0xE3,0x8F,0xC3,0xFF,0x80,0x3F,0xFF,0xC0,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,
+0xC7,0x9E,0xE3,0x8F,0xFF,0xFF,0x00,0x3F,0xFF,0xC0,0xFF,0xFB,0xF8,0x01,0xFF,0xFF,
+0xC7,0x9E,0xE3,0xC7,0xFF,0xFE,0x00,0x3F,0x3F,0xC0,0xFF,0xF5,0xF8,0x00,0xFF,0xFF,
+0x87,0x9C,0xE3,0x87,0xFF,0xFC,0x00,0x3E,0x1F,0xC0,0xFF,0xE6,0xF8,0x00,0x7F,0xFF,
+0x87,0x9C,0xE3,0x83,0xFF,0xF8,0x00,0x7C,0xDF,0xC0,0xFF,0xEF,0xF8,0x00,0x3F,0xFF,
+0x07,0x1C,0xE3,0x83,0xFF,0xF0,0x00,0x7F,0xCF,0xC0,0xFF,0xEB,0xF8,0x00,0x0F,0xFE,
+0x07,0x1C,0x73,0x80,0xFF,0xE0,0x00,0x7F,0x2F,0xC0,0xFF,0xE1,0xF8,0x00,0x03,0xF8,
+0x07,0x1D,0x73,0x80,0x7F,0x80,0x00,0x7E,0x0F,0x03,0xC0,0xFF,0xE4,0xFC,0xFE,0x00,
+0x03,0x07,0x19,0x73,0x80,0xFE,0x00,0x05,0x7E,0x4F,0xC0,0xFF,0xC2,0x7C,0xFE,0x00,
+0x03,0x07,0x19,0x23,0x80,0xFE,0x00,0x5C,0x7C,0x8F,0xC0,0xFF,0xE1,0x7C,0x00,0x1F,
+0xF0,0x07,0x83,0x03,0x80,0x1F,0xE0,0x00,0x78,0x8F,0xC0,0xFF,0xE1,0x7C,0x00,0x1F,
+0xE0,0x07,0x83,0x03,0x81,0x0F,0xE0,0x00,0x79,0x0F,0xC0,0xFF,0xD1,0x3C,0x00,0x07,
+0xB0,0x87,0x83,0x87,0xC7,0x0F,0xC0,0x00,0x79,0x0F,0xC0,0xFF,0xD2,0xFC,0x00,0x03,
+0xC0,0xC7,0xC7,0x87,0xCE,0x0F,0x00,0x00,0xFE,0x0F,0xC0,0xFF,0xD4,0xFC,0x00,0x00,
+0xC0,0xC7,0xEF,0xFF,0xCC,0x0E,0x00,0x00,0xFE,0x8F,0xC0,0xFF,0xE4,0xFC,0x00,0x00,
+0x13,0x8F,0xFF,0xFF,0xC6,0xFE,0x00,0x05,0xFE,0xCF,0xC0,0xFF,0xE7,0xFC,0xFE,0x00,
+0x03,0x0F,0xFF,0xFF,0xC0,0xFE,0x00,0x05,0xFF,0x8F,0xC0,0xFF,0xEF,0xFE,0xFE,0x00,
+0x03,0x0F,0xFF,0xFF,0xE0,0xFE,0x00,0x05,0xFF,0xEF,0xC0,0xFF,0xEF,0x1E,0xFE,0x00,
+0x0C,0x1F,0xFF,0xFF,0xE0,0x00,0x00,0x01,0xF1,0xEF,0xC0,0xFF,0xEE,0xDE,0xFE,0x00,
+0x0C,0x1F,0xFF,0xFF,0xF0,0x00,0x00,0x01,0xF6,0xDF,0xC0,0xFF,0xF6,0x9F,0xFE,0x00,
+0x0C,0x3F,0xFF,0xFD,0xF0,0x00,0x00,0x01,0xF2,0xDF,0xC0,0xFF,0xF5,0xBF,0xFE,0x00,
+0x0C,0x3E,0xFF,0xFF,0xF8,0x00,0x00,0x03,0xFA,0xDF,0xC0,0xFF,0xF5,0xBF,0xFE,0x00,
+0x7B,0x7D,0xFF,0xFE,0xF8,0x00,0x00,0x03,0xFA,0xBF,0xC0,0xFF,0xFA,0xBF,0x80,0x00,
+0x00,0xFD,0xFF,0xFE,0x7C,0x00,0x00,0x07,0xFA,0xBF,0xC0,0xFF,0xFA,0xBF,0xC0,0x00,
+0x00,0xF9,0xFF,0xFF,0x7E,0x00,0x00,0x07,0xF5,0x7F,0xC0,0xFF,0xFD,0x5F,0xC0,0x00,
+0x03,0xFB,0xFF,0xFF,0x3F,0x00,0x00,0x0F,0xF5,0x7F,0xC0,0xFF,0xFD,0x5F,0xE0,0x00,
+0x07,0xF3,0xFF,0xFF,0xBF,0x80,0x00,0x1F,0xFA,0xFF,0xC0,0xFF,0xFE,0x9F,0xF8,0x00,
+0x1F,0xE7,0x7F,0xFB,0x9F,0xE0,0x00,0x3F,0xE2,0xFF,0xC0,0xFF,0xFE,0xDF,0xFC,0x00,
+0x7F,0xE6,0xFF,0xFD,0xCF,0xF8,0x00,0xFF,0xE6,0xFF,0xC0,0xFF,0xFE,0xDF,0xFF,0x83,
+0xFF,0xC4,0xFF,0xFE,0xCF,0xFF,0x87,0xFF,0xE6,0xFF,0xC0,0xFF,0xFE,0xFD,0xFF,0x03,
+0xCD,0xFF,0xFE,0x47,0xFE,0xFF,0x04,0xFE,0xFF,0xC0,0xFF,0xFE,0xFD,0xFF,0x03,0x89,
+0xFF,0xFF,0x67,0xFE,0xFF,0x04,0xFE,0xFF,0xC0,0xFF,0xFE,0xFD,0xFF,0x03,0x1B,0xFF,
+0xFF,0x63,0xFE,0xFF,0x04,0xFE,0xFF,0xC0,0xFF,0xFE,0xFD,0xFF,0x03,0x1B,0xFF,0xFF,
+0x31,0xFC,0xFF,0x02,0xC0,0xFF,0xFE,0xFE,0xFF,0x04,0xFE,0x33,0xFF,0xFF,0xB1,0xFC,
+0xFF,0x02,0xC0,0xFF,0xFE,0xFE,0xFF,0x04,0xFC,0x33,0x8F,0xC3,0x30,0xFE,0xFF,0x42,
+0xFD,0xFF,0xC0,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x78,0x07,0x81,0x38,0x7F,0xFF,0xFF,
+0xFD,0xFF,0xC0,0xFF,0xFF,0x7B,0xFF,0xFF,0xF8,0x78,0x03,0x80,0x78,0x7F,0xFF,0xFF,
+0xBB,0xFF,0xC0,0xFF,0xFF,0xB7,0xFF,0xFF,0xF8,0x7F,0xF8,0x7F,0xFC,0x3F,0xFF,0xFF,
+0xD3,0xFF,0xC0,0xFF,0xFF,0xCF,0xFF,0xFF,0xF0,0xFF,0xF8,0x3F,0xFC,0x1F,0xFF,0xFF,
+0xC7,0xFF,0xC0,0xFC,0xFF,0x05,0xE0,0xFF,0xF0,0x3F,0xFC,0x1F,0xFD,0xFF,0x00,0xC0,
+0xFC,0xFF,0x05,0xE0,0xFF,0xF0,0x1F,0xFE,0x0F,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,
+0xC0,0xFF,0xE0,0x0F,0xFE,0x07,0xFD,0xFF,0x00,0xC0,0xFC,0xFF,0x05,0x81,0xFF,0xC0,
+0x0F,0xFE,0x07,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x07,0x7F,0xFF,0x01,0xFF,0x80,0x07,
+0xFE,0x03,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x07,0x3F,0xFF,0x00,0xFF,0x00,0x03,0xFE,
+0x01,0xFD,0xFF,0x00,0xC0,0xFE,0xFF,0x0C,0x3F,0xFE,0x00,0xFE,0x00,0x00,0xFC,0x01,
+0xFF,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x3F,0xFE,0x00,0x30,0x00,0x00,0x10,0x00,
+0xFF,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x3F,0xFC,0xFB,0x00,0x04,0xFF,0xFE,0xFF,
+0xFF,0xC0,0xFE,0xFF,0x01,0x3F,0xFC,0xFB,0x00,0x04,0x7F,0xFE,0xFF,0xFF,0xC0,0xFE,
+0xFF,0x01,0x3F,0xF8,0xFB,0x00,0x04,0x7F,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1F,
+0xF8,0xFB,0x00,0x04,0x3F,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1F,0xF0,0xFB,0x00,
+0x04,0x3F,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1F,0xE0,0xFB,0x00,0x04,0x3F,0xFE,
+0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1F,0xE0,0xFB,0x00,0x04,0x1F,0xFE,0xFF,0xFF,0xC0,
+0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,0x1F,0xFE,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,
+0x1B,0x60,0xFB,0x00,0x04,0x1D,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,
+0x00,0x04,0x1C,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,0x1C,
+0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,0x1C,0xF6,0xFF,0xFF,
+0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,0x1C,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,
+0x01,0x1B,0x60,0xFB,0x00,0x04,0x1C,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,
+0xFB,0x00,0x04,0x3C,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,
+0x3C,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,0x3C,0xF6,0xFF,
+0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x60,0xFB,0x00,0x04,0x3C,0xF6,0xFF,0xFF,0xC0,0xFE,
+0xFF,0x01,0x1B,0x64,0xFB,0x00,0x04,0x3C,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,
+0x64,0xFB,0x00,0x04,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x64,0xFB,0x00,
+0x04,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x64,0xFC,0x00,0x05,0x01,0xBC,
+0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x64,0xFC,0x00,0x05,0x01,0xBC,0xF6,0xFF,
+0xFF,0xC0,0xFE,0xFF,0x01,0x1B,0x64,0xFC,0x00,0x05,0x03,0xBC,0xF6,0xFF,0xFF,0xC0,
+0xFE,0xFF,0x01,0x1B,0x64,0xFC,0x00,0x05,0x07,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,
+0x02,0x1B,0x64,0x40,0xFD,0x00,0x05,0x0F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x02,
+0x1B,0x64,0x60,0xFD,0x00,0x05,0x0F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x02,0x1B,
+0x64,0x70,0xFD,0x00,0x05,0x2F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x02,0x1B,0x64,
+0x78,0xFD,0x00,0x05,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x02,0x1B,0x64,0x7C,
+0xFD,0x00,0x05,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x02,0x1B,0x64,0x7D,0xFD,
+0x00,0x05,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xC0,0x00,
+0x00,0x0C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE0,0x00,
+0x00,0x3C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE6,0x00,
+0x01,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0x63,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x0C,0x1B,0x64,0x7D,0xE7,0xB8,
+0xE3,0x7C,0x6F,0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0xFB,0x7F,0xFB,0xFF,0x04,
+0xBC,0xF6,0xFF,0xFF,0xC0,0xFE,0xFF,0x01,0xFB,0x7F,0xFB,0xFF,0x04,0xBC,0xF6,0xFF,
+0xFF,0xC0,0xFE,0xFF,0x01,0xFB,0x7F,0xFB,0xFF,0x39,0xBC,0xF6,0xC7,0xFF,0xC0,0xFF,
+0xFF,0xCF,0xBB,0x79,0xFB,0xC7,0xBC,0x7C,0x71,0xEF,0xBC,0xF6,0xF7,0xFF,0xC0,0xFF,
+0xFF,0xF7,0x9B,0x7E,0xF9,0xD7,0x99,0xBD,0xB6,0xE7,0xBC,0xF6,0xFB,0xFF,0xC0,0xFF,
+0xFF,0xFB,0xBB,0x7F,0x7B,0xBB,0xBB,0xFB,0xAE,0xEF,0xBC,0xF6,0xF3,0xFF,0xC0,0xFF,
+0xFF,0xE5,0xBB,0x7C,0xFE,0xBB,0x62,0xFB,0xAE,0xEF,0xBC,0xF6,0xEF,0xFF,0xC0,0xFF,
+0xFF,0xC9,0xBB,0x79,0x3B,0xBB,0xBB,0xFB,0xAE,0xEF,0xBC,0xF6,0xDF,0xFF,0xC0,0xFF,
+0xFF,0xDD,0xBB,0x7B,0xBB,0xBB,0xBD,0xFB,0x2C,0xEF,0xBC,0xF6,0xDF,0xFF,0xC0,0xFF,
+0xFF,0xDD,0xBF,0xFB,0xBB,0xBB,0xBE,0xF8,0x61,0xEF,0xFF,0xFF,0xDF,0xFF,0xC0,0xFF,
+0xFF,0xDD,0xBF,0xFB,0xBB,0xBB,0xBE,0xFD,0xF7,0xEF,0xFF,0xFF,0xEF,0xFF,0xC0,0xFF,
+0xFF,0xEB,0xBF,0xFD,0x7B,0xD7,0xBB,0x7E,0xFB,0xEF,0xFF,0xFF,0xF1,0xFF,0xC0,0xFF,
+0xFF,0xE3,0x1F,0xFC,0x71,0xC7,0x18,0x3F,0x3C,0xC7,0xFD,0xFF,0x00,0xC0,0xF2,0xFF,
+0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,
+0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xFD,0xFF,0x04,0xDF,0xFF,0xDB,0xFF,0x7F,0xFB,0xFF,
+0x00,0xC0,0xFD,0xFF,0x04,0xEF,0xFF,0xDD,0xFF,0xBF,0xFB,0xFF,0x00,0xC0,0xFD,0xFF,
+0x04,0xEF,0xFF,0xFD,0xFF,0xBF,0xFB,0xFF,0x60,0xC0,0xFF,0x92,0x7D,0x98,0xEE,0x49,
+0xE4,0x7F,0x8F,0x39,0xC7,0xF6,0x9D,0xA6,0xD3,0xC0,0xFF,0xA7,0xBD,0xBD,0x6E,0x9A,
+0xED,0xBF,0xB7,0x5A,0xEB,0xF6,0xAD,0xAA,0xD5,0xC0,0xFF,0xB7,0xDD,0x3D,0xAE,0xDE,
+0xEE,0xBF,0xD7,0x6B,0x6D,0xF6,0xCD,0xB2,0xD9,0xC0,0xFF,0xDB,0xDD,0x7D,0xB6,0xED,
+0xF6,0xD8,0xDB,0x6B,0x6D,0xFA,0xDE,0xB7,0x5B,0xC0,0xFF,0xDA,0xDE,0x78,0x97,0x6D,
+0x76,0x5F,0xCB,0x6B,0x65,0xFA,0x5E,0x97,0x4B,0xC0,0xFF,0x9B,0x1B,0x7D,0x27,0x8C,
+0x64,0x9F,0x93,0x8C,0x69,0xDC,0x9F,0x27,0x93,0xC0,0xFE,0xFF,0x02,0x7F,0xFF,0xEF,
+0xFD,0xFF,0x05,0xED,0xFE,0xDF,0xB7,0xDB,0xC0,0xFE,0xFF,0x02,0xBF,0xFF,0xEF,0xFD,
+0xFF,0x00,0xEE,0xFD,0xFF,0x01,0xC0,0xFE,0xF3,0x00,0x00,0xC0,0xFE,0xFF,0x02,0xC7,
+0xFF,0xC7,0xFD,0xFF,0x00,0xF8,0xFD,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,
+0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,0x00,0xC0,0xF2,0xFF,
+0x00,0xC0,
+};
+
+// third : 4000 bytes, packed 2544
+const unsigned char third_packed[] PROGMEM =
+{
+0xA0,0x0F,0x00,0x00,0x81,0x00,0x81,0x00,0xB8,0x00,0x01,0x07,0xE0,0xF4,0x00,0x02,
+0x3F,0xFF,0xF0,0xF6,0x00,0x04,0x07,0xE0,0x7F,0xFF,0xF4,0xF7,0x00,0x05,0x1F,0xFF,
+0xF0,0xFF,0xFF,0xEC,0xF7,0x00,0x05,0xFF,0xFF,0xF9,0xFF,0xFF,0xDE,0xF7,0x00,0x05,
+0xFF,0xFF,0xF8,0xFF,0xFF,0xBE,0xF8,0x00,0x06,0x03,0x7F,0xFF,0xF6,0x7F,0xE0,0x7E,
+0xF8,0x00,0x06,0x03,0xBF,0xFF,0xEF,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0xFE,0xC7,
+0x9E,0x03,0xDF,0xE0,0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0xFF,0xC7,0xC6,0x07,
+0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0xFF,0xCC,0xE6,0x07,0xE0,0x00,
+0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0x8C,0x4C,0x66,0x07,0xE0,0x00,0x1F,0x80,
+0x00,0x7E,0xFC,0x00,0x0A,0x01,0xD8,0x0F,0x7E,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,
+0xFB,0x00,0x09,0xF8,0x01,0x3C,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFB,0x00,0x09,
+0x60,0x00,0x00,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0x80,0x0E,
+0x00,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0xF0,0x0F,0xC0,0x07,
+0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,0xFF,0x0D,0xFE,0x07,0xE0,0x00,
+0x1F,0x80,0x00,0x7E,0xFB,0x00,0x09,0x1F,0xC0,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,
+0x3E,0xFC,0x00,0x0A,0x01,0x3F,0x0F,0xE0,0x07,0xE0,0x00,0x1F,0x81,0xFF,0x9E,0xFC,
+0x00,0x0A,0x01,0xF0,0x0E,0x00,0x07,0xE0,0x00,0x0F,0x7F,0xFF,0xCE,0xFC,0x00,0x0A,
+0x01,0x80,0x08,0x00,0x07,0xE0,0xFF,0xF6,0xFF,0xFF,0xF4,0xF8,0x00,0x06,0x07,0xDF,
+0xFF,0xF9,0xFF,0xFF,0xF8,0xF8,0x00,0x06,0x03,0x9F,0xFF,0xF9,0xFF,0xFF,0xF0,0xF8,
+0x00,0x06,0x03,0x3F,0xFF,0xF0,0xFF,0xFF,0x80,0xF7,0x00,0x03,0x7F,0xFF,0xE0,0x38,
+0xF5,0x00,0x02,0xFF,0xFF,0x80,0xF4,0x00,0x00,0x3E,0xED,0x00,0x00,0x3C,0xF2,0x00,
+0x00,0x7E,0xF2,0x00,0x00,0x7E,0xF2,0x00,0x00,0x7E,0xF2,0x00,0x02,0x3C,0x0F,0xC0,
+0xF3,0x00,0x01,0x3F,0xF0,0xF3,0x00,0x01,0x20,0x30,0xF3,0x00,0x03,0x30,0x37,0xFF,
+0xE0,0xF7,0x00,0x05,0x01,0xE0,0x3F,0xEF,0xFF,0xF0,0xF8,0x00,0x06,0x1F,0xFF,0xF0,
+0x0F,0xCC,0x00,0x30,0xFA,0x00,0x08,0x01,0xE0,0x7F,0xFF,0xF4,0x00,0x0D,0xFF,0xB0,
+0xFB,0x00,0x09,0x0F,0xFF,0xF0,0xFF,0xFF,0xEC,0x00,0x0D,0xFF,0xB0,0xFB,0x00,0x09,
+0xFF,0xFF,0xF9,0xFF,0xFF,0xDE,0x00,0x0D,0xFF,0xB0,0xFB,0x00,0x09,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xBE,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x02,0x7F,0xFF,0xF6,0x7F,0xF8,
+0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x3F,0xFF,0xEF,0x00,0x00,0x7E,0x00,
+0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xDF,0xF8,0x0F,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0xFE,0x00,0x0C,0x0C,0x06,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0xFE,0x00,0x0C,0x0F,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0xFE,0x00,0x0C,0x0E,0xE6,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0xFE,0x00,0x0C,0x0D,0xF6,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,0x00,
+0x30,0xFE,0x00,0x0C,0x0F,0xF6,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,0x00,
+0x30,0xFE,0x00,0x0C,0x0F,0x0E,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,0x00,
+0x30,0xFD,0x00,0x0B,0x0C,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,
+0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFD,0x00,
+0x0B,0xC2,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFD,0x00,0x0B,
+0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x3E,0x00,0x0D,0xFF,0xB0,0xFE,0x00,0x0C,0x01,
+0xFE,0x07,0xE0,0x00,0x1F,0x80,0xFF,0x9E,0x00,0x0D,0xFF,0xB0,0xFE,0x00,0x0C,0x01,
+0xC2,0x07,0xE0,0x00,0x0F,0x3F,0xFF,0xCE,0x00,0x0D,0xFF,0xB0,0xFE,0x00,0x0C,0x01,
+0xC0,0x07,0xE0,0x7F,0xE6,0x7F,0xFF,0xE4,0x00,0x0D,0xFF,0xB0,0xFD,0x00,0x0B,0x80,
+0x07,0xCF,0xFF,0xF8,0xFF,0xFF,0xF0,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x9F,
+0xFF,0xF9,0xFF,0xFF,0xF8,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x3F,0xFF,0xF0,
+0xFF,0xFF,0xC0,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x04,0x02,0x7F,0xFF,0xF0,0x7E,0xFE,
+0x00,0x02,0x0D,0xFF,0xB0,0xFB,0x00,0x02,0xFF,0xFF,0xC0,0xFD,0x00,0x02,0x0C,0x00,
+0x30,0xFB,0x00,0x00,0x7F,0xFB,0x00,0x02,0x0C,0x00,0x30,0xF6,0x00,0x04,0x3C,0x00,
+0x0C,0x00,0x30,0xF6,0x00,0x04,0x7E,0x00,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x00,
+0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x00,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x3C,0x00,
+0x0D,0xFF,0xB0,0xF4,0x00,0x02,0x0D,0xFF,0xB0,0xF4,0x00,0x02,0x0D,0xFF,0xB0,0xF4,
+0x00,0x02,0x0D,0xFF,0xB0,0xF7,0x00,0x05,0x01,0xC0,0x00,0x0D,0xFF,0xB0,0xF8,0x00,
+0x06,0x07,0xFF,0xF0,0x00,0x0D,0xFF,0xB0,0xF9,0x00,0x07,0x60,0x7F,0xFF,0xF0,0x00,
+0x0D,0xFF,0xB0,0xFB,0x00,0x09,0x07,0xFF,0xF0,0xFF,0xFF,0xEC,0x00,0x0D,0xFF,0xB0,
+0xFB,0x00,0x09,0xFF,0xFF,0xF9,0xFF,0xFF,0xDE,0x00,0x0C,0x00,0x30,0xFB,0x00,0x09,
+0xFF,0xFF,0xF8,0xFF,0xFF,0x9E,0x00,0x0C,0x00,0x30,0xFC,0x00,0x0A,0x02,0x7F,0xFF,
+0xF6,0x7F,0xFC,0x3E,0x00,0x0C,0x00,0x30,0xFC,0x00,0x0A,0x03,0x3F,0xFF,0xE7,0x20,
+0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x9F,0xFE,0x0F,0x80,0x00,0x7E,
+0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xC0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,
+0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,
+0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,
+0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,
+0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,
+0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,
+0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,
+0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,
+0x00,0x30,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x3E,0x00,0x0C,0x00,0x30,
+0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x3F,0x9E,0x00,0x0C,0x00,0x30,0xFC,0x00,
+0x0A,0x07,0xE0,0x00,0x0F,0x3F,0xFF,0xCE,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,
+0xE0,0x1F,0xE6,0x7F,0xFF,0xE4,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xCF,0xFF,
+0xF0,0xFF,0xFF,0xF0,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x9F,0xFF,0xF9,0xFF,
+0xFF,0xF8,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x3F,0xFF,0xF8,0xFF,0xFF,0xE0,
+0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x7F,0xFF,0xF0,0x7F,0x80,0x00,0x00,0x0D,
+0xFF,0xB0,0xFB,0x00,0x02,0xFF,0xFF,0xE0,0xFE,0x00,0x03,0x04,0x2D,0xFF,0xB0,0xFB,
+0x00,0x01,0x7F,0x80,0xFD,0x00,0x03,0x1C,0x3D,0xFF,0xB0,0xF6,0x00,0x04,0x3C,0x3E,
+0x3D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x36,0x3D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x33,
+0xED,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x20,0x0C,0x00,0x30,0xF6,0x00,0x04,0x3C,0x00,
+0x0C,0x00,0x30,0xF5,0x00,0x03,0x03,0x0C,0x00,0x30,0xFD,0x00,0x00,0x10,0xFA,0x00,
+0x03,0x1F,0xED,0xFF,0xB0,0xFD,0x00,0x00,0x30,0xFA,0x00,0x03,0x38,0x7D,0xFF,0xB0,
+0xFD,0x00,0x00,0x38,0xFA,0x00,0x08,0x20,0x3D,0xFF,0xB0,0x00,0x00,0x1F,0xC0,0x1E,
+0xFD,0x00,0x0B,0x03,0xFF,0xF0,0x3F,0xFD,0xFF,0xB0,0x00,0x00,0x3F,0xC0,0x3E,0xFD,
+0x00,0x56,0x7F,0xFF,0xF0,0x1F,0xED,0xFF,0xB0,0x00,0x00,0x38,0xC1,0xF0,0x00,0x01,
+0xFF,0xF0,0xFF,0xFF,0xEC,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x3F,0xCF,0x80,0x00,0x7F,
+0xFF,0xF9,0xFF,0xFF,0xCE,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x18,0xCC,0x00,0x00,0xFF,
+0xFF,0xF9,0xFF,0xFF,0x9E,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x3F,0xCC,0x00,0x02,0x7F,
+0xFF,0xF2,0xFF,0xFF,0x3E,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x1F,0xCC,0x00,0x03,0x3F,
+0xFF,0xE7,0x38,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFE,0x00,0x0C,0x4C,0x00,0x03,0x9F,
+0xFF,0x8F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFE,0x00,0x5C,0xCC,0x00,0x07,0xC0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,0x00,0x30,0x00,0x00,0x0F,0xCC,0x00,0x07,0xE0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,0x00,0x30,0x00,0x00,0xFE,0x0C,0x00,0x07,0xE0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,0x00,0x30,0x00,0x01,0xFE,0x0C,0x00,0x07,0xE0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x3F,0xC0,0x00,0x07,0xE0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x03,0xC0,0x00,0x07,0xE0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFE,0x00,0x0C,0xC0,0x00,0x07,0xE0,
+0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,
+0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,
+0x7E,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,
+0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x1F,0x80,0x0F,0xBE,0x00,0x0D,0xFF,
+0xB0,0xFC,0x00,0x0A,0x07,0xE0,0x00,0x0F,0x3F,0xFF,0xCE,0x00,0x0D,0xFF,0xB0,0xFC,
+0x00,0x0A,0x07,0xE0,0x07,0xE6,0x7F,0xFF,0xE4,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,
+0x03,0xCF,0xFF,0xF2,0xFF,0xFF,0xF0,0x00,0x0C,0x00,0x30,0xFC,0x00,0x0A,0x03,0x9F,
+0xFF,0xF9,0xFF,0xFF,0xF8,0x00,0x0C,0x00,0x30,0xFC,0x00,0x0A,0x03,0xBF,0xFF,0xF8,
+0xFF,0xFF,0xE0,0x00,0x0C,0x00,0x30,0xFC,0x00,0x0A,0x03,0x7F,0xFF,0xF0,0x7F,0xE0,
+0x00,0x00,0x0D,0xFF,0xB0,0xFB,0x00,0x02,0xFF,0xFF,0xE0,0xFD,0x00,0x02,0x0D,0xFF,
+0xB0,0xFB,0x00,0x01,0xFF,0xE0,0xFC,0x00,0x02,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x3C,
+0x00,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x00,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,
+0x00,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x7E,0x00,0x0D,0xFF,0xB0,0xF6,0x00,0x04,0x3C,
+0x00,0x0D,0xFF,0xB0,0xF4,0x00,0x05,0x0D,0xFF,0xB0,0x00,0x00,0xF8,0xF7,0x00,0x05,
+0x0D,0xFF,0xB0,0x00,0x01,0xFC,0xF7,0x00,0x05,0x0D,0xFF,0xB0,0x00,0x01,0xFC,0xF7,
+0x00,0x06,0x0C,0x00,0x30,0x00,0x00,0xF8,0x20,0xFB,0x00,0x0A,0xFF,0xF0,0x00,0x0C,
+0x00,0x30,0x00,0x00,0x01,0xEF,0xFE,0xFD,0x00,0x7F,0x7F,0xFF,0xF0,0x00,0x0C,0x00,
+0x30,0x00,0x00,0x07,0x8F,0xFE,0x00,0x00,0x7F,0xF0,0xFF,0xFF,0xE4,0x00,0x0D,0xFF,
+0xB0,0x00,0x00,0x3C,0x0D,0xFA,0x00,0x7F,0xFF,0xF8,0xFF,0xFF,0xCE,0x00,0x0D,0xFF,
+0xB0,0x00,0x01,0xF0,0x0F,0xBE,0x00,0xFF,0xFF,0xF9,0xFF,0xFF,0x9E,0x00,0x0D,0xFF,
+0xB0,0x00,0x01,0x80,0x0E,0x0E,0x00,0xFF,0xFF,0xF2,0xFF,0xFF,0x3E,0x00,0x0D,0xFF,
+0xB0,0x00,0x00,0x07,0xCC,0x06,0x03,0x3F,0xFF,0xE7,0x7E,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0x00,0x00,0x0E,0xE0,0x02,0x03,0x9F,0xFF,0xCF,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0x00,0x00,0x0F,0xC0,0x00,0x07,0xCE,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0x00,0x00,0x03,0x8C,0x06,0x07,0xE0,0x00,0x1F,0x06,0x80,0x00,0x7E,0x00,0x0D,
+0xFF,0xB0,0xFE,0x00,0x0C,0x0F,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,
+0xFF,0xB0,0xFE,0x00,0x0C,0x0E,0x66,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,
+0xFF,0xB0,0xFE,0x00,0x0C,0x0C,0x62,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,
+0x00,0x30,0xFE,0x00,0x0C,0x0E,0xE0,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,
+0x00,0x30,0xFE,0x00,0x0C,0x07,0xC0,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0C,
+0x00,0x30,0xFE,0x00,0x0C,0x03,0x80,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,
+0xFF,0xB0,0xFD,0x00,0x0B,0x0C,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,
+0xB0,0xFD,0x00,0x0B,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x00,0x0D,0xFF,0xB0,
+0xFE,0x00,0x0C,0x01,0xF2,0x07,0xE0,0x00,0x1F,0x80,0x00,0x3E,0x00,0x0D,0xFF,0xB0,
+0xFE,0x00,0x0C,0x01,0xB6,0x07,0xE0,0x00,0x1F,0x3F,0xFF,0xDE,0x00,0x0D,0xFF,0xB0,
+0xFD,0x00,0x0B,0xFE,0x07,0xE0,0x03,0xEF,0x7F,0xFF,0xEE,0x00,0x0D,0xFF,0xB0,0xFD,
+0x00,0x0B,0x7E,0x07,0xEF,0xFF,0xF2,0xFF,0xFF,0xF0,0x00,0x0D,0xFF,0xB0,0xFD,0x00,
+0x0B,0x06,0x07,0xDF,0xFF,0xF9,0xFF,0xFF,0xF8,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,
+0x03,0xBF,0xFF,0xF8,0xFF,0xFF,0xF0,0x00,0x0D,0xFF,0xB0,0xFC,0x00,0x0A,0x03,0x7F,
+0xFF,0xF0,0x7F,0xE0,0x00,0x00,0x0D,0xFF,0xB0,0xFB,0x00,0x02,0xFF,0xFF,0xE0,0xFE,
+0x00,0x03,0x10,0x1D,0xFF,0xB0,0xFB,0x00,0x01,0xFF,0xF8,0xFD,0x00,0x03,0x3F,0xFC,
+0x00,0x30,0xF6,0x00,0x04,0x3C,0x3F,0xFF,0xFF,0xF0,0xF6,0x00,0x02,0x7E,0x00,0x30,
+0xF4,0x00,0x02,0x7E,0x00,0x10,0xF4,0x00,0x02,0x7E,0x0F,0xC0,0xF4,0x00,0x02,0x3C,
+0x3F,0xF0,0xF3,0x00,0x01,0x20,0x30,0xF3,0x00,0x01,0x30,0x30,0xF3,0x00,0x01,0x3F,
+0xE0,0xF3,0x00,0x01,0x07,0x80,0xF5,0x00,0x03,0x7F,0xF0,0x0F,0x80,0xF6,0x00,0x04,
+0x3F,0xFF,0xF0,0x3F,0xF0,0xF8,0x00,0x06,0x3F,0xE0,0x7F,0xFF,0xE4,0x20,0x30,0xFD,
+0x00,0x0B,0x40,0x00,0x02,0x00,0x7F,0xFF,0xF0,0xFF,0xFF,0xCE,0x30,0x30,0xFD,0x00,
+0x0B,0xF0,0x0F,0xFE,0x00,0xFF,0xFF,0xF9,0xFF,0xFF,0x9E,0x3F,0xE0,0xFE,0x00,0x0C,
+0x01,0xB0,0x0F,0xFE,0x00,0xFF,0xFF,0xFA,0xFF,0xFF,0xBE,0x0F,0x80,0xFE,0x00,0x0A,
+0x01,0xB0,0x03,0xFE,0x03,0x7F,0xFF,0xF7,0x7F,0x00,0x7E,0xFB,0x00,0x0A,0xF0,0x00,
+0x7E,0x03,0xBF,0xFF,0xEF,0x80,0x00,0x7E,0x1F,0xFB,0x00,0x09,0x01,0xF2,0x03,0xCF,
+0x80,0x1F,0x80,0x00,0x7E,0x1F,0xFB,0x00,0x0A,0x0F,0xFE,0x07,0xE0,0x00,0x1F,0x80,
+0x00,0x7E,0x1F,0x30,0xFC,0x00,0x0A,0x0F,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,
+0x01,0xF0,0xFD,0x00,0x0B,0x1E,0x04,0x02,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x07,
+0x80,0xFD,0x00,0x0A,0x7F,0x80,0x00,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x1E,0xFC,
+0x00,0x0B,0xE3,0xCC,0x06,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x11,0xF0,0xFE,0x00,
+0x0C,0x01,0x80,0xCF,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x01,0xF0,0xFE,0x00,
+0x0C,0x01,0x00,0x4F,0xFE,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0x01,0xF0,0xFE,0x00,
+0x0A,0x01,0xC0,0xCC,0x62,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFC,0x00,0x0A,0x01,
+0xE1,0x8E,0xE0,0x07,0xE0,0x00,0x1F,0x80,0x00,0x7E,0xFA,0x00,0x08,0x07,0xC0,0x07,
+0xE0,0x00,0x1F,0x80,0x00,0x3E,0xFA,0x00,0x08,0x03,0x80,0x07,0xE0,0x00,0x1F,0x8F,
+0xFF,0xDE,0xF9,0x00,0x07,0x0C,0x07,0xE0,0x00,0xEF,0x7F,0xFF,0xEE,0xF9,0x00,0x07,
+0xFE,0x07,0xE7,0xFF,0xF6,0xFF,0xFF,0xF4,0xFA,0x00,0x08,0x01,0xF2,0x03,0xDF,0xFF,
+0xF9,0xFF,0xFF,0xF8,0xFA,0x00,0x08,0x01,0xB6,0x03,0xBF,0xFF,0xF8,0xFF,0xFF,0xF0,
+0xF9,0x00,0x06,0xFE,0x03,0x7F,0xFF,0xF0,0x7F,0xF8,0xF8,0x00,0x05,0x7E,0x00,0xFF,
+0xFF,0xE0,0x20,0xF7,0x00,0x03,0x06,0x00,0xFF,0xFC,0x81,0x00,0x81,0x00,0x98,0x00,
+};
+
+#define BitmapExample2_packed logo_packed
+
+#endif
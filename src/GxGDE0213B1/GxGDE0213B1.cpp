@@ -46,49 +46,34 @@ const uint8_t GxGDE0213B1::Gatetime[] = {0x3b, 0x08};  // 2us per line
 
 GxGDE0213B1::GxGDE0213B1(GxIO& io, int8_t rst, int8_t busy) :
   GxEPD(GxGDE0213B1_VISIBLE_WIDTH, GxGDE0213B1_HEIGHT), IO(io),
-  _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+  _using_partial_mode(false), _diag_enabled(false),
   _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDE0213B1::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDE0213B1_VISIBLE_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDE0213B1_VISIBLE_WIDTH - x - 1;
-      y = GxGDE0213B1_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDE0213B1_HEIGHT - y - 1;
-      break;
-  }
-  // flip y for y-decrement mode
-  y = GxGDE0213B1_HEIGHT - y - 1;
-  uint16_t i = x / 8 + y * GxGDE0213B1_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDE0213B1_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDE0213B1_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDE0213B1_WIDTH / 8;
-  }
+void GxGDE0213B1::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDE0213B1::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDE0213B1::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDE0213B1::init(uint32_t serial_diag_bitrate)
@@ -106,6 +91,7 @@ void GxGDE0213B1::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -113,30 +99,22 @@ void GxGDE0213B1::init(uint32_t serial_diag_bitrate)
 
 void GxGDE0213B1::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDE0213B1::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _Init_Full(0x01);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxGDE0213B1_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDE0213B1_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDE0213B1_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDE0213B1_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _Update_Full();
   _PowerOff();
+  _setShadow(_fb_black, _fb_size, GxGDE0213B1_BUFFER_SIZE);
 }
 
 void  GxGDE0213B1::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
@@ -148,6 +126,8 @@ void  GxGDE0213B1::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 void GxGDE0213B1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
+  _invalidateShadow();
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_x for normal display (bm_flip_y would be rotated)
   // y-increment is not available with this controller
@@ -161,37 +141,15 @@ void GxGDE0213B1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = true; // remember
     _Init_Part(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDE0213B1_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDE0213B1_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _Update_Part();
     delay(GxGDE0213B1_PU_DELAY);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDE0213B1_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDE0213B1_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     delay(GxGDE0213B1_PU_DELAY);
     _PowerOff();
   }
@@ -200,20 +158,9 @@ void GxGDE0213B1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = false; // remember
     _Init_Full(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDE0213B1_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDE0213B1_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _Update_Full();
     _PowerOff();
   }
@@ -222,23 +169,19 @@ void GxGDE0213B1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 void GxGDE0213B1::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
+  _invalidateShadow();
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDE0213B1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDE0213B1_BUFFER_SIZE);
     _Update_Part();
     delay(GxGDE0213B1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDE0213B1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDE0213B1_BUFFER_SIZE);
     delay(GxGDE0213B1_PU_DELAY);
     _PowerOff();
   }
@@ -247,10 +190,7 @@ void GxGDE0213B1::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDE0213B1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDE0213B1_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -259,6 +199,7 @@ void GxGDE0213B1::eraseDisplay(bool using_partial_update)
 void GxGDE0213B1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDE0213B1_WIDTH) return;
   if (y >= GxGDE0213B1_HEIGHT) return;
@@ -268,20 +209,21 @@ void GxGDE0213B1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   uint16_t xe_d8 = xe / 8;
   uint16_t ys_bx = GxGDE0213B1_HEIGHT - ye - 1;
   uint16_t ye_bx = GxGDE0213B1_HEIGHT - y - 1;
+  if (!_diffWindow(_fb_black, _fb_size, GxGDE0213B1_WIDTH / 8, xs_d8, xe_d8, ys_bx, ye_bx)) return; // unchanged
+  y = GxGDE0213B1_HEIGHT - ye_bx - 1;
+  ye = GxGDE0213B1_HEIGHT - ys_bx - 1;
   _Init_Part(0x01);
   _SetRamArea(xs_d8, xe_d8, ye % 256, ye / 256, y % 256, y / 256); // X-source area,Y-gate area
   _SetRamPointer(xs_d8, ye % 256, ye / 256); // set ram
   _waitWhileBusy();
   _writeCommand(0x24);
+  IO.startTransaction();
   for (int16_t y1 = ys_bx; y1 <= ye_bx; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDE0213B1_WIDTH / 8) + xs_d8;
+    _writePlaneData(IO, 0, idx, xe_d8 - xs_d8 + 1, true, 0xFF);
   }
+  IO.endTransaction();
   _Update_Part();
   delay(GxGDE0213B1_PU_DELAY);
   // update erase buffer
@@ -289,17 +231,54 @@ void GxGDE0213B1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   _SetRamPointer(xs_d8, ye % 256, ye / 256); // set ram
   _waitWhileBusy();
   _writeCommand(0x24);
+  IO.startTransaction();
   for (int16_t y1 = ys_bx; y1 <= ye_bx; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
+    uint32_t idx = uint32_t(y1) * (GxGDE0213B1_WIDTH / 8) + xs_d8;
+    _writePlaneData(IO, 0, idx, xe_d8 - xs_d8 + 1, true, 0xFF);
+  }
+  IO.endTransaction();
+  _updateShadow(_fb_black, _fb_size, GxGDE0213B1_WIDTH / 8, xs_d8, xe_d8, ys_bx, ye_bx);
+  delay(GxGDE0213B1_PU_DELAY);
+}
+
+#if GxEPD_DIRTY_TRACKING
+void GxGDE0213B1::updateDirty()
+{
+  if ((_current_page != -1) || (_dirty_count == 0)) return;
+  op_scope op(this, IO, op_partial_update);
+  if (_dirtyWindows(_fb_black, _fb_size, GxGDE0213B1_WIDTH / 8) == 0) return; // unchanged
+  _Init_Part(0x01);
+  _writeDirtyWindows();
+  _Update_Part();
+  delay(GxGDE0213B1_PU_DELAY);
+  // update erase buffer
+  _writeDirtyWindows();
+  _dirtyWindowsSent(_fb_black, _fb_size, GxGDE0213B1_WIDTH / 8);
+  delay(GxGDE0213B1_PU_DELAY);
+}
+
+void GxGDE0213B1::_writeDirtyWindows()
+{
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    const dirty_rect& r = _dirty_rects[i];
+    uint16_t y = GxGDE0213B1_HEIGHT - r.y1 - 1; // buffer rows are flipped
+    uint16_t ye = GxGDE0213B1_HEIGHT - r.y0 - 1;
+    _SetRamArea(r.x0, r.x1, ye % 256, ye / 256, y % 256, y / 256); // X-source area,Y-gate area
+    _SetRamPointer(r.x0, ye % 256, ye / 256); // set ram
+    _waitWhileBusy();
+    _writeCommand(0x24);
+    IO.startTransaction();
+    for (int16_t y1 = r.y0; y1 <= r.y1; y1++)
     {
-      uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
+      uint32_t idx = uint32_t(y1) * (GxGDE0213B1_WIDTH / 8) + r.x0;
+      _writePlaneData(IO, 0, idx, r.x1 - r.x0 + 1, true, 0xFF);
     }
+    IO.endTransaction();
   }
-  delay(GxGDE0213B1_PU_DELAY);
 }
+#endif
 
 void GxGDE0213B1::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h)
 {
@@ -325,19 +304,19 @@ void GxGDE0213B1::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   _SetRamPointer(xds_d8, yde % 256, yde / 256); // set ram
   _waitWhileBusy();
   _writeCommand(0x24);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDE0213B1_WIDTH / 8) + xs / 8;
+    _writePlaneData(IO, 0, idx, xse_d8 - xs / 8 + 1, true, 0xFF);
   }
+  IO.endTransaction();
 }
 
 void GxGDE0213B1::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
+  _invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -414,15 +393,9 @@ void GxGDE0213B1::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen
 void GxGDE0213B1::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
+  if (!_waitBusy(_busy, HIGH, 10000000))
   {
-    if (!digitalRead(_busy)) break;
-    delay(1);
-    if (micros() - start > 10000000)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -549,24 +522,24 @@ void GxGDE0213B1::_Update_Part(void)
 void GxGDE0213B1::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x01);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDE0213B1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDE0213B1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDE0213B1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -574,24 +547,24 @@ void GxGDE0213B1::drawPaged(void (*drawCallback)(void))
 void GxGDE0213B1::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x01);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDE0213B1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDE0213B1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDE0213B1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -599,24 +572,24 @@ void GxGDE0213B1::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDE0213B1::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x01);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDE0213B1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDE0213B1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDE0213B1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -624,24 +597,24 @@ void GxGDE0213B1::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDE0213B1::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x01);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDE0213B1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDE0213B1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDE0213B1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDE0213B1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -670,6 +643,8 @@ void GxGDE0213B1::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -678,46 +653,56 @@ void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
   }
   _using_partial_mode = true;
   _Init_Part(0x01);
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDE0213B1_PU_DELAY);
   // update erase buffer
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -726,46 +711,56 @@ void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
   }
   _using_partial_mode = true;
   _Init_Part(0x01);
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDE0213B1_PU_DELAY);
   // update erase buffer
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -774,46 +769,56 @@ void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
   }
   _using_partial_mode = true;
   _Init_Part(0x01);
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDE0213B1_PU_DELAY);
   // update erase buffer
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -822,49 +827,59 @@ void GxGDE0213B1::drawPagedToWindow(void (*drawCallback)(const void*, const void
   }
   _using_partial_mode = true;
   _Init_Part(0x01);
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDE0213B1_PU_DELAY);
   // update erase buffer
-  for (_current_page = GxGDE0213B1_PAGES - 1; _current_page >= 0; _current_page--)
+  for (_current_page = _pages - 1; _current_page >= 0; _current_page--)
   {
     // flip y for y-decrement mode
-    uint16_t yds = (GxGDE0213B1_PAGES - _current_page - 1) * GxGDE0213B1_PAGE_HEIGHT;
-    uint16_t yde = yds + GxGDE0213B1_PAGE_HEIGHT;
+    uint16_t yde = GxGDE0213B1_HEIGHT - _current_page * _page_height;
+    uint16_t yds = gx_uint16_max(yde, _page_height) - _page_height;
     yds = gx_uint16_max(y, yds);
     yde = gx_uint16_min(y + h, yde);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = (GxGDE0213B1_PAGES - 1) * GxGDE0213B1_PAGE_HEIGHT + (yds % GxGDE0213B1_PAGE_HEIGHT);
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds + _current_page * _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDE0213B1::drawCornerTest(uint8_t em)
 {
   if (_current_page != -1) return;
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(em);
   _writeCommand(0x24);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDE0213B1_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDE0213B1_WIDTH / 8; x++)
@@ -874,9 +889,10 @@ void GxGDE0213B1::drawCornerTest(uint8_t em)
       if ((x > GxGDE0213B1_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDE0213B1_WIDTH / 8 - 4) && (y > GxGDE0213B1_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDE0213B1_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   _Update_Full();
   _PowerOff();
 }
@@ -29,7 +29,7 @@
 
 #define GxGDE0213B1_BUFFER_SIZE (uint32_t(GxGDE0213B1_WIDTH) * uint32_t(GxGDE0213B1_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDE0213B1_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDE0213B1_HEIGHT
 #define GxGDE0213B1_PAGES 5
 
 #define GxGDE0213B1_PAGE_HEIGHT (GxGDE0213B1_HEIGHT / GxGDE0213B1_PAGES)
@@ -46,6 +46,10 @@ class GxGDE0213B1 : public GxEPD
     GxGDE0213B1(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -56,11 +60,16 @@ class GxGDE0213B1 : public GxEPD
     void eraseDisplay(bool using_partial_update = false);
     // partial update of rectangle from buffer to screen, does not power off
     void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true);
+#if GxEPD_DIRTY_TRACKING
+    // partial update of the regions drawn since last updateDirty(), one refresh for all, does not power off
+    void updateDirty();
+#endif
     // partial update of rectangle at (xs,ys) from buffer to screen at (xd,yd), does not power off
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDE0213B1_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDE0213B1_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -72,6 +81,7 @@ class GxGDE0213B1 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDE0213B1";};
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -85,6 +95,10 @@ class GxGDE0213B1 : public GxEPD
     void _writeCommand(uint8_t command);
     void _writeCommandData(const uint8_t* pCommandData, uint8_t datalen);
     void _SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1);
+#if GxEPD_DIRTY_TRACKING
+    void _writeDirtyWindows();
+    uint32_t _dirtyCost() {return GxEPD_DIRTY_WINDOW_COST;};
+#endif
     void _SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1);
     void _PowerOn(void);
     void _PowerOff(void);
@@ -97,14 +111,16 @@ class GxGDE0213B1 : public GxEPD
     void _Update_Part(void);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   protected:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDE0213B1_WIDTH, GxGDE0213B1_HEIGHT, 1, GxFB_FLIP_Y, GxGDE0213B1_VISIBLE_WIDTH> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif defined(__AVR)
     uint8_t _buffer[GxGDE0213B1_PAGE_SIZE];
 #else
     uint8_t _buffer[GxGDE0213B1_BUFFER_SIZE];
 #endif
   private:
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -132,6 +148,7 @@ class GxGDE0213B1 : public GxEPD
 #define GxEPD_HEIGHT GxGDE0213B1_HEIGHT
 #define GxEPD_BitmapExamples <GxGDE0213B1/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDE0213B1/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDE0213B1/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,863 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 4736 bytes, packed 1373
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0xAC,0xFF,0x00,0xF1,0xF2,0xFF,0x01,0xF0,0x3F,0xF3,0xFF,0x01,0xF0,0x07,
+0xF3,0xFF,0x02,0xF0,0x00,0x7F,0xF4,0xFF,0x02,0xF0,0x00,0x0F,0xF4,0xFF,0x02,0xFE,
+0x00,0x03,0xF3,0xFF,0x01,0xE0,0x03,0xF3,0xFF,0x01,0xFE,0x03,0xF2,0xFF,0x00,0x03,
+0xF3,0xFF,0x01,0xF0,0x03,0xF3,0xFF,0x01,0x00,0x07,0xF4,0xFF,0x02,0xF8,0x00,0x7F,
+0xF4,0xFF,0x01,0xF0,0x03,0xF3,0xFF,0x01,0xF0,0x7F,0xF3,0xFF,0x01,0xF0,0x07,0xF3,
+0xFF,0x02,0xF0,0x00,0x7F,0xF4,0xFF,0x02,0xF0,0x00,0x0F,0xF4,0xFF,0x02,0xFE,0x00,
+0x03,0xF3,0xFF,0x04,0xE0,0x03,0xFF,0x7F,0xDF,0xF6,0xFF,0x04,0xFE,0x03,0xFE,0x3F,
+0x03,0xF6,0xFF,0x04,0xFC,0x03,0xFC,0x1E,0x07,0xF6,0xFF,0x05,0x00,0x03,0xF8,0x38,
+0x00,0x00,0xF8,0xFF,0x06,0xF0,0x00,0x07,0xF0,0x70,0x00,0x00,0xF8,0xFF,0x06,0xF0,
+0x00,0x3F,0xC0,0xC0,0x00,0x00,0xF8,0xFF,0x03,0xF0,0x03,0xFF,0x81,0xFE,0x00,0xF8,
+0xFF,0x06,0xF0,0x3F,0xFF,0xC3,0x83,0xFF,0xFB,0xF8,0xFF,0x06,0xF1,0xFF,0xFF,0xEF,
+0xC7,0xFF,0xF3,0xF5,0xFF,0x03,0xF0,0x1C,0x7F,0x80,0xF7,0xFF,0x05,0xFC,0x1F,0xF0,
+0x1C,0x60,0x01,0xF7,0xFF,0x05,0xF8,0x07,0xF0,0x1C,0x60,0x03,0xF8,0xFF,0x06,0xF8,
+0x70,0x07,0xFF,0x1C,0x60,0x1F,0xF8,0xFF,0x05,0xF8,0xE0,0x03,0x80,0x1C,0x63,0xF7,
+0xFF,0x05,0xF1,0xE0,0x03,0x80,0x1C,0x63,0xF7,0xFF,0x06,0xF1,0xE1,0xC3,0x80,0x1C,
+0x63,0xFB,0xF8,0xFF,0x06,0xF1,0xE3,0xE3,0xFF,0x1C,0x60,0x01,0xF8,0xFF,0x06,0xF1,
+0xE3,0xE7,0xF0,0x1C,0x60,0x01,0xF8,0xFF,0x06,0xF0,0xC3,0xC7,0xF0,0x1C,0x60,0x03,
+0xF8,0xFF,0x06,0xF0,0x00,0x0F,0xF0,0x1C,0x7F,0x87,0xF8,0xFF,0x06,0xF0,0x00,0x03,
+0xFF,0xC1,0xFF,0x87,0xF8,0xFF,0x06,0xF8,0x00,0x03,0xFF,0x01,0xFF,0xC1,0xF8,0xFF,
+0x06,0xF8,0x00,0x03,0xF8,0x00,0x3F,0x81,0xF8,0xFF,0x06,0xFC,0x00,0x03,0xC0,0x00,
+0x03,0x03,0xF7,0xFF,0x05,0x00,0x03,0x80,0x00,0x00,0x07,0xF5,0xFF,0x03,0x80,0x3F,
+0xC0,0x0F,0xF5,0xFF,0x03,0xC4,0x3F,0x00,0x0F,0xF8,0xFF,0x06,0xF3,0xFF,0xFF,0xFC,
+0x00,0x00,0x03,0xF8,0xFF,0x06,0xF0,0x7F,0xFF,0xFC,0x00,0x07,0x01,0xF8,0xFF,0x06,
+0xF0,0x0F,0xFF,0xFC,0x00,0x3F,0xC0,0xF8,0xFF,0x06,0xF0,0x01,0xFF,0xFC,0x3F,0xFF,
+0xE3,0xF8,0xFF,0x04,0xF0,0x00,0x3F,0xFC,0x3F,0xF6,0xFF,0x02,0xF8,0x00,0x07,0xF3,
+0xFF,0x01,0x00,0x03,0xF3,0xFF,0x03,0xF0,0x03,0xFE,0x07,0xF4,0xFF,0x04,0x03,0xC6,
+0x07,0xC7,0xF1,0xF6,0xFF,0x04,0x83,0xC6,0x07,0xC6,0x31,0xF7,0xFF,0x05,0xF8,0x03,
+0xC6,0x3C,0xC6,0x31,0xF7,0xFF,0x05,0x80,0x03,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,
+0xF8,0x00,0x1F,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF0,0x00,0x7F,0xC6,0x24,0xC6,
+0x31,0xF8,0xFF,0x06,0xF0,0x03,0xFF,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF0,0x1F,
+0xFF,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF0,0xFF,0xFF,0xC6,0x24,0xC6,0x31,0xF8,
+0xFF,0x06,0xF7,0xFF,0xFF,0xC6,0x24,0xC6,0x31,0xF5,0xFF,0x03,0xC6,0x3F,0xC6,0x31,
+0xF7,0xFF,0x05,0xC0,0x7F,0xC0,0x00,0x46,0x31,0xF7,0xFF,0x05,0x00,0x1F,0xC0,0x00,
+0x46,0x31,0xF8,0xFF,0x06,0xFE,0x00,0x0F,0xC0,0x00,0x46,0x31,0xF8,0xFF,0x06,0xFC,
+0x00,0x07,0xC0,0x00,0x46,0x31,0xF8,0xFF,0x06,0xF8,0x00,0x07,0xC6,0x3F,0xC6,0x31,
+0xF8,0xFF,0x06,0xF8,0x63,0x07,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF0,0xE3,0xC3,
+0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF1,0xE3,0xC3,0xC6,0x24,0xC6,0x31,0xF8,0xFF,
+0x06,0xF1,0xE3,0xE3,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF1,0xE3,0xE3,0xC6,0x24,
+0xC6,0x31,0xF8,0xFF,0x06,0xF1,0xE3,0xE3,0xC6,0x24,0xC6,0x31,0xF8,0xFF,0x06,0xF0,
+0xE3,0xE3,0xC6,0x24,0xC0,0x00,0xF8,0xFF,0x06,0xF8,0x03,0xE3,0xC6,0x3C,0xC0,0x00,
+0xF8,0xFF,0x06,0xF8,0x03,0xE3,0xC6,0x07,0xC0,0x00,0xF8,0xFF,0x06,0xFC,0x03,0xE7,
+0xC6,0x07,0xC0,0x00,0xF8,0xFF,0x04,0xFE,0x03,0xC7,0xFE,0x07,0xF5,0xFF,0x00,0x83,
+0xC3,0xFF,0x06,0xFE,0x0F,0x87,0xF8,0x00,0x00,0x3F,0xF8,0xFF,0x06,0xFC,0x07,0xC3,
+0xF8,0x00,0x00,0x3F,0xF8,0xFF,0x06,0xF8,0x07,0xC3,0xF8,0x00,0x00,0x3F,0xF8,0xFF,
+0x06,0xF8,0x03,0xE3,0xF8,0x00,0x00,0x3F,0xF8,0xFF,0x05,0xF0,0x03,0xE3,0xF8,0x70,
+0xE1,0xF7,0xFF,0x05,0xF0,0xC1,0xE3,0xF8,0x70,0xE1,0xF7,0xFF,0x05,0xF1,0xE1,0xE3,
+0xF8,0x70,0xE1,0xF7,0xFF,0x05,0xF1,0xE0,0xC3,0xF8,0x70,0xE1,0xF7,0xFF,0x05,0xF1,
+0xE0,0x03,0xF8,0x70,0xE1,0xF7,0xFF,0x05,0xF1,0xF0,0x07,0xF8,0x70,0xE1,0xF7,0xFF,
+0x05,0xF1,0xF0,0x07,0xF8,0x70,0xE1,0xF7,0xFF,0x06,0xF0,0xF8,0x0F,0x80,0x00,0x00,
+0x07,0xF7,0xFF,0x05,0xFC,0x1F,0x80,0x00,0x00,0x03,0xF5,0xFF,0x03,0x80,0x00,0x00,
+0x01,0xF5,0xFF,0x03,0x80,0x00,0x00,0x01,0xF5,0xFF,0x03,0xF8,0x70,0xE1,0xE1,0xF9,
+0xFF,0x07,0xF0,0x00,0x00,0x03,0xF8,0x70,0xE1,0xE1,0xF9,0xFF,0x07,0xF0,0x00,0x00,
+0x03,0xF8,0x70,0xE1,0xE1,0xF9,0xFF,0x07,0xF0,0x00,0x00,0x03,0xF8,0x70,0xE1,0xE1,
+0xF9,0xFF,0x07,0xF0,0x00,0x00,0x03,0xF8,0x70,0xE1,0xE1,0xF9,0xFF,0x07,0xF0,0x00,
+0x00,0x03,0xF8,0x70,0xE1,0xE1,0xF8,0xFF,0x06,0xFE,0x3F,0xFF,0xF8,0x00,0x01,0xE1,
+0xF8,0xFF,0x06,0xFC,0x7F,0xFF,0xF8,0x00,0x01,0xE1,0xF8,0xFF,0x06,0xF8,0xFF,0xFF,
+0xF8,0x00,0x01,0xE1,0xF8,0xFF,0x06,0xF0,0xFF,0xFF,0xF8,0x00,0x01,0x81,0xF8,0xFF,
+0x06,0xF0,0xFF,0xFF,0xF8,0x00,0x00,0x01,0xF8,0xFF,0x00,0xF0,0xFD,0xFF,0x01,0xFC,
+0x03,0xF8,0xFF,0x01,0xF0,0x7F,0xFE,0xFF,0x01,0xFE,0x03,0xF8,0xFF,0x06,0xF0,0x00,
+0x03,0xFF,0xFF,0xFE,0x0F,0xF8,0xFF,0x02,0xF0,0x00,0x03,0xF4,0xFF,0x02,0xF8,0x00,
+0x03,0xF4,0xFF,0x05,0xFC,0x00,0x03,0xFF,0xFC,0x3F,0xF6,0xFF,0x04,0x00,0x03,0xFF,
+0xFC,0x3F,0xF4,0xFF,0x02,0xC3,0xFC,0x3F,0xF4,0xFF,0x02,0xC3,0xFC,0x3F,0xF4,0xFF,
+0x02,0xC3,0xFC,0x3F,0xF6,0xFF,0x05,0xFC,0x1F,0xC3,0xFC,0x3F,0xEF,0xF7,0xFF,0x05,
+0xF8,0x07,0xC3,0xFC,0x3F,0xE1,0xF8,0xFF,0x06,0xF8,0x70,0x07,0xC3,0xFC,0x3F,0xE1,
+0xF8,0xFF,0x06,0xF8,0xE0,0x03,0xC3,0xFC,0x3F,0xE1,0xF8,0xFF,0x06,0xF1,0xE0,0x03,
+0xC3,0xFC,0x3F,0xE1,0xF8,0xFF,0x06,0xF1,0xE1,0xC3,0xC3,0xFC,0x3F,0xE1,0xF8,0xFF,
+0x06,0xF1,0xE3,0xE3,0xC3,0xFC,0x3F,0xE1,0xF8,0xFF,0x06,0xF1,0xE3,0xE7,0xC3,0xFC,
+0x3F,0xC1,0xF8,0xFF,0x06,0xF0,0xC3,0xC7,0xC3,0xE0,0x00,0x01,0xF8,0xFF,0x06,0xF0,
+0x00,0x0F,0xC3,0xC0,0x00,0x01,0xF8,0xFF,0x06,0xF0,0x00,0x03,0xC3,0x80,0x00,0x03,
+0xF8,0xFF,0x06,0xF8,0x00,0x03,0xC3,0x80,0x00,0x07,0xF8,0xFF,0x06,0xF8,0x00,0x03,
+0xC3,0x00,0x00,0x1F,0xF8,0xFF,0x05,0xFC,0x00,0x03,0xC2,0x04,0x3F,0xF6,0xFF,0x04,
+0x00,0x03,0xC2,0x0C,0x3F,0xF4,0xFF,0x02,0xC0,0x1C,0x3F,0xF4,0xFF,0x02,0xC0,0x1C,
+0x3F,0xF4,0xFF,0x02,0xC0,0x3C,0x3F,0xF4,0xFF,0x02,0xC0,0x7C,0x3F,0xF7,0xFF,0x05,
+0xF0,0x00,0x03,0xC0,0xFC,0x3F,0xF7,0xFF,0x05,0xF0,0x00,0x03,0xC0,0xFC,0x3F,0xF7,
+0xFF,0x05,0xF0,0x00,0x03,0xC1,0xFC,0x3F,0xF7,0xFF,0x05,0xF0,0x00,0x03,0xC3,0xFC,
+0x3F,0xF7,0xFF,0x05,0xF0,0x00,0x03,0xFF,0xFC,0x3F,0xF7,0xFF,0x05,0xFC,0x3F,0xFF,
+0xFF,0xFC,0x3F,0xF7,0xFF,0x01,0xF8,0x7F,0xF3,0xFF,0x00,0xF0,0xF2,0xFF,0x00,0xF0,
+0xF2,0xFF,0x00,0xF0,0xF2,0xFF,0x01,0xF0,0x7F,0xD2,0xFF,0x01,0xC0,0x7F,0xF3,0xFF,
+0x01,0x00,0x1F,0xF4,0xFF,0x02,0xFE,0x00,0x0F,0xF4,0xFF,0x02,0xFC,0x00,0x07,0xF4,
+0xFF,0x02,0xF8,0x00,0x07,0xF4,0xFF,0x02,0xF8,0x63,0x07,0xF4,0xFF,0x02,0xF0,0xE3,
+0xC3,0xF4,0xFF,0x02,0xF1,0xE3,0xC3,0xF4,0xFF,0x02,0xF1,0xE3,0xE3,0xF4,0xFF,0x02,
+0xF1,0xE3,0xE3,0xF4,0xFF,0x02,0xF1,0xE3,0xE3,0xF4,0xFF,0x02,0xF0,0xE3,0xE3,0xF4,
+0xFF,0x02,0xF8,0x03,0xE3,0xF4,0xFF,0x02,0xF8,0x03,0xE3,0xF4,0xFF,0x02,0xFC,0x03,
+0xE7,0xF4,0xFF,0x02,0xFE,0x03,0xC7,0xF3,0xFF,0x00,0x83,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xD8,0xFF,
+};
+
+// logo : 4736 bytes, packed 2460
+const unsigned char logo_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0x81,0xFF,0xBD,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,
+0xF7,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x05,0x80,0x7F,0xFF,0xFF,0xF8,
+0x03,0xF7,0xFF,0x00,0x83,0xFD,0xFF,0x00,0x03,0xF7,0xFF,0x00,0x8F,0xFD,0xFF,0x00,
+0x83,0xF7,0xFF,0x00,0x8F,0xFD,0xFF,0x02,0xC3,0xFF,0x83,0xF9,0xFF,0x00,0x9F,0xFD,
+0xFF,0x03,0xE3,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0x80,
+0x1F,0xFA,0xFF,0x00,0xBF,0xFE,0x00,0x04,0x07,0xE3,0xFF,0x80,0x1F,0xFA,0xFF,0x08,
+0xBF,0x00,0x03,0xC0,0x03,0xE3,0xFF,0xF8,0x3F,0xFA,0xFF,0x07,0xBF,0x00,0x07,0xE0,
+0x03,0xE3,0xFF,0xE0,0xF9,0xFF,0x07,0x9F,0xFE,0x07,0xFF,0xFF,0xE3,0xFF,0x83,0xF9,
+0xFF,0x08,0x9F,0xFE,0x07,0xFF,0xFF,0xE3,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0x9F,0xFE,
+0x07,0xFF,0xFF,0xC3,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0x8F,0xFE,0x07,0xFF,0xFF,0xC3,
+0xFF,0xE0,0x1F,0xFA,0xFF,0x08,0x87,0xFE,0x07,0xFF,0xFF,0x83,0xFF,0xF8,0x1F,0xFA,
+0xFF,0x07,0x81,0xFE,0x07,0xFF,0xFE,0x03,0xFF,0xC0,0xF9,0xFF,0x00,0x80,0xFD,0x00,
+0x02,0x03,0xFF,0x83,0xF9,0xFF,0x00,0x80,0xFD,0x00,0x02,0x03,0xFF,0x8F,0xF9,0xFF,
+0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0x81,0xFE,0xFF,0x01,0xFE,0x03,0xF7,
+0xFF,0x00,0x87,0xFD,0xFF,0x02,0x83,0xFF,0x80,0xF9,0xFF,0x00,0x8F,0xFD,0xFF,0x03,
+0xC3,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xC3,0xFF,0x80,0x1F,0xFA,
+0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0xE0,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,
+0x03,0xE3,0xFF,0xF0,0x3F,0xFA,0xFF,0x00,0xBF,0xFE,0x00,0x03,0x03,0xE3,0xFF,0xC1,
+0xF9,0xFF,0x00,0xBF,0xFE,0x00,0x03,0x03,0xE3,0xFF,0x83,0xF9,0xFF,0x00,0xBF,0xFE,
+0x00,0x04,0x07,0xE3,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,
+0x80,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0xF8,0x1F,0xFA,0xFF,0x00,
+0x8F,0xFD,0xFF,0x03,0xC3,0xFF,0xF0,0x3F,0xFA,0xFF,0x00,0x8F,0xFD,0xFF,0x02,0x83,
+0xFF,0xC0,0xF9,0xFF,0x00,0x83,0xFD,0xFF,0x02,0x03,0xFF,0x87,0xF9,0xFF,0x07,0x80,
+0x7F,0xFF,0xFF,0xF0,0x03,0xFF,0x9F,0xF9,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,
+0xFF,0x00,0x80,0xFD,0x00,0x02,0x03,0xFF,0x8F,0xF9,0xFF,0x00,0x80,0xFD,0x00,0x03,
+0x03,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0x83,0xFE,0xFF,0x04,0xFE,0x03,0xFF,0x80,0x1F,
+0xFA,0xFF,0x00,0x87,0xFD,0xFF,0x03,0x83,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0x8F,0xFD,
+0xFF,0x03,0xC3,0xFF,0xF8,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x02,0xE3,0xFF,0xE0,
+0xF9,0xFF,0x00,0x9F,0xFD,0xFF,0x02,0xE3,0xFF,0x83,0xF9,0xFF,0x01,0xBF,0xD5,0xFE,
+0xFF,0x03,0xE3,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0xBF,0xFE,0x00,0x04,0x03,0xE3,0xFF,
+0x80,0x1F,0xFA,0xFF,0x00,0xBF,0xFE,0x00,0x04,0x03,0xE3,0xFF,0x80,0x1F,0xFA,0xFF,
+0x00,0xBF,0xFD,0xFF,0x03,0xE3,0xFF,0xF8,0x1F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,
+0xE3,0xFF,0xE0,0x7F,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x02,0xE3,0xFF,0x81,0xF9,0xFF,
+0x00,0x8F,0xFD,0xFF,0x02,0xC3,0xFF,0x8F,0xF9,0xFF,0x00,0x87,0xFD,0xFF,0x02,0x83,
+0xFF,0xBF,0xF9,0xFF,0x00,0x83,0xFD,0xFF,0x03,0x03,0xFF,0xFF,0x1F,0xFA,0xFF,0x00,
+0x80,0xFD,0x00,0x03,0x03,0xFF,0xFE,0x1F,0xFA,0xFF,0x00,0x80,0xFD,0x00,0x03,0x03,
+0xFF,0xFE,0x1F,0xFA,0xFF,0x00,0x80,0xFD,0x00,0x03,0x03,0xFF,0xFE,0x1F,0xFA,0xFF,
+0x00,0x9F,0xFD,0xFF,0x00,0xE3,0xF7,0xFF,0x00,0x9F,0xFD,0xFF,0x00,0xE3,0xF7,0xFF,
+0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0xFF,0x63,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,
+0xE3,0xFF,0xE6,0x03,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0x80,0x03,0xFA,
+0xFF,0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0x80,0x13,0xFA,0xFF,0x08,0x9F,0xA0,0x00,
+0x00,0x07,0xE3,0xFF,0x81,0x1B,0xFA,0xFF,0x00,0x9F,0xFE,0x00,0x04,0x03,0xE3,0xFF,
+0x99,0x1B,0xFA,0xFF,0x08,0x9F,0x80,0x00,0x00,0x07,0xE3,0xFF,0x99,0x13,0xFA,0xFF,
+0x00,0x9F,0xFD,0xFF,0x03,0xE3,0xFF,0x01,0x03,0xFA,0xFF,0x00,0x9F,0xFD,0xFF,0x03,
+0xE3,0xFE,0x01,0x03,0xFA,0xFF,0x00,0x8F,0xFD,0xFF,0x03,0xC3,0xFC,0x03,0x87,0xFA,
+0xFF,0x00,0x8F,0xFD,0xFF,0x03,0xC3,0xFC,0xC7,0xCF,0xFA,0xFF,0x00,0x87,0xFD,0xFF,
+0x01,0x83,0xFC,0xF8,0xFF,0x00,0x83,0xFE,0xFF,0x01,0xFE,0x03,0xF7,0xFF,0x00,0x80,
+0xFD,0x00,0x03,0x03,0xFF,0xF0,0x7F,0xFA,0xFF,0x00,0x80,0xFD,0x00,0x03,0x03,0xFF,
+0xC0,0x3F,0xFA,0xFF,0x00,0x80,0xFD,0x00,0x03,0x03,0xFF,0x80,0x1F,0xFA,0xFF,0x00,
+0x80,0xFD,0x00,0x03,0x03,0xFF,0x80,0x1F,0xF3,0xFF,0x01,0x8F,0x9F,0xF3,0xFF,0x01,
+0x9F,0x9F,0xF3,0xFF,0x01,0x9E,0x1F,0xF3,0xFF,0x01,0x80,0x1F,0xF3,0xFF,0x01,0x80,
+0x3F,0xF3,0xFF,0x01,0xC0,0x7F,0xF3,0xFF,0x00,0xF1,0xF9,0xFF,0x00,0xE0,0xFD,0x00,
+0x00,0x3F,0xF7,0xFF,0x00,0xE0,0xFD,0x00,0x02,0x1F,0xFF,0xF8,0xF9,0xFF,0x00,0xE0,
+0xFD,0x00,0x03,0x1F,0xFF,0xE0,0x3F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,
+0xC0,0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x80,0x1F,0xFA,0xFF,0x00,
+0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x87,0x1F,0xFA,0xFF,0x00,0xE0,0xFE,0xFF,0x04,0xFC,
+0x1F,0xFF,0x9F,0x9F,0xFA,0xFF,0x00,0xE0,0xFE,0xFF,0x04,0xFC,0x1F,0xFF,0x9F,0x1F,
+0xFA,0xFF,0x08,0xE0,0x7F,0xFF,0xFF,0xF8,0x1F,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0xE0,
+0xFD,0x00,0x03,0x1F,0xFF,0x80,0x3F,0xFA,0xFF,0x00,0xF0,0xFD,0x00,0x03,0x3F,0xFF,
+0xC0,0x3F,0xFA,0xFF,0x00,0xF0,0xFD,0x00,0x02,0x3F,0xFF,0xE0,0xF9,0xFF,0x00,0xF0,
+0xFD,0x00,0x00,0x7F,0xF7,0xFF,0x00,0xF8,0xFD,0x00,0xF5,0xFF,0xFE,0x00,0x04,0x03,
+0xFF,0xFF,0xF0,0x7F,0xF3,0xFF,0x01,0xC0,0x3F,0xF3,0xFF,0x01,0xC0,0x1F,0xF3,0xFF,
+0x01,0x80,0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x8F,0x9F,0xFA,0xFF,
+0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x9F,0x9F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,
+0x1F,0xFF,0x9F,0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x80,0x1F,0xFA,
+0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x80,0x3F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,
+0x03,0x1F,0xFF,0xC0,0x7F,0xF3,0xFF,0x00,0xE0,0xD9,0xFF,0x08,0xFE,0x00,0x7F,0xFC,
+0x00,0xFF,0xFF,0xF0,0x3F,0xFA,0xFF,0x08,0xF8,0x00,0x1F,0xFC,0x00,0x7F,0xFF,0xC0,
+0x1F,0xFA,0xFF,0x08,0xF0,0x00,0x07,0xFC,0x00,0x3F,0xFF,0x80,0x1F,0xFA,0xFF,0x08,
+0xF0,0x00,0x03,0xFC,0x00,0x3F,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0xE0,0x00,0x00,0xFC,
+0x00,0x1F,0xFF,0x8F,0x9F,0xFA,0xFF,0x08,0xE0,0x00,0x00,0x7F,0xF0,0x1F,0xFF,0x9F,
+0xBF,0xFA,0xFF,0x08,0xE0,0xFF,0x00,0x3F,0xFC,0x1F,0xFF,0x9E,0x1F,0xFA,0xFF,0x08,
+0xE1,0xFF,0x80,0x1F,0xFC,0x1F,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0xE0,0xFF,0xE0,0x07,
+0xFC,0x1F,0xF8,0x00,0x1F,0xFA,0xFF,0x08,0xE0,0x01,0xF0,0x00,0x00,0x1F,0xF8,0x00,
+0x1F,0xFA,0xFF,0x07,0xE0,0x00,0xF8,0x00,0x00,0x1F,0xF8,0x03,0xF9,0xFF,0x06,0xE0,
+0x00,0xFE,0x00,0x00,0x3F,0xF8,0xF8,0xFF,0x07,0xF0,0x00,0xFF,0x00,0x00,0x7F,0xFF,
+0xF9,0xF9,0xFF,0x07,0xF8,0x00,0xFF,0x80,0x00,0xFF,0xFF,0xF1,0xF9,0xFF,0x07,0xFE,
+0x00,0xFF,0xF0,0x01,0xFF,0xFF,0xF1,0xF2,0xFF,0x00,0xF1,0xF2,0xFF,0x00,0xF1,0xF2,
+0xFF,0x00,0xF7,0xF9,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x1F,0xF7,0xFF,0x00,0xE0,0xFD,
+0x00,0x03,0x1F,0xFF,0xF0,0x3F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0xC0,
+0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0xE0,
+0xFD,0x00,0x03,0x1F,0xFF,0x80,0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,
+0x8F,0x9F,0xFA,0xFF,0x02,0xE0,0xFF,0xE0,0xFD,0xFF,0x01,0x9F,0xBF,0xFA,0xFF,0x02,
+0xE0,0xFF,0xE0,0xFD,0xFF,0x01,0x9E,0x1F,0xFA,0xFF,0x02,0xE0,0x7F,0xC0,0xFD,0xFF,
+0x01,0x80,0x1F,0xFA,0xFF,0x02,0xE0,0x00,0x01,0xFE,0xFF,0x02,0xF8,0x00,0x1F,0xFA,
+0xFF,0x02,0xE0,0x00,0x01,0xFE,0xFF,0x02,0xF8,0x00,0x1F,0xFA,0xFF,0x02,0xF0,0x00,
+0x01,0xFE,0xFF,0x01,0xF8,0x03,0xF9,0xFF,0x02,0xF0,0x00,0x03,0xFE,0xFF,0x00,0xF8,
+0xF8,0xFF,0x02,0xF8,0x00,0x07,0xFC,0xFF,0x00,0xDF,0xFA,0xFF,0x02,0xFC,0x00,0x0F,
+0xFD,0xFF,0x01,0xF0,0x1F,0xF4,0xFF,0x02,0xF8,0x80,0x1F,0xF4,0xFF,0x02,0xF8,0x80,
+0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x02,0x1F,0xF8,0x80,0xF9,0xFF,0x00,0xE0,0xFD,
+0x00,0x02,0x1F,0xF8,0xBF,0xF9,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x1F,0xF7,0xFF,0x00,
+0xE0,0xFD,0x00,0x03,0x1F,0xFF,0xE7,0x3F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,
+0xFF,0xC3,0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x81,0x1F,0xF6,0xFF,
+0x04,0xFC,0x1F,0xFF,0x81,0x9F,0xF6,0xFF,0x04,0xFC,0x1F,0xFF,0x91,0x9F,0xF6,0xFF,
+0x04,0xFC,0x1F,0xFF,0x90,0x1F,0xF6,0xFF,0x04,0xFC,0x1F,0xFF,0x98,0x1F,0xF6,0xFF,
+0x04,0xFC,0x1F,0xFF,0x88,0x1F,0xF6,0xFF,0x04,0xFC,0x1F,0xFF,0xDC,0x3F,0xF6,0xFF,
+0x01,0xFC,0x3F,0xDF,0xFF,0x00,0xC3,0xF6,0xFF,0x04,0x00,0x1F,0xFF,0xF0,0x03,0xF7,
+0xFF,0x05,0x00,0x00,0x1F,0xFF,0x80,0x03,0xF9,0xFF,0x00,0xFE,0xFE,0x00,0x03,0x1F,
+0xFF,0x80,0x03,0xFA,0xFF,0x00,0xFC,0xFD,0x00,0x03,0x1F,0xFF,0x80,0x3F,0xFA,0xFF,
+0x00,0xE0,0xFD,0x00,0x03,0x1F,0xFF,0x8F,0x9F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,
+0x3F,0xFF,0x9F,0x9F,0xFA,0xFF,0x08,0xE0,0x00,0x00,0x0F,0x83,0xFF,0xFF,0x9E,0x1F,
+0xFA,0xFF,0x08,0xE0,0x0F,0xFF,0xFF,0x83,0xFF,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0xE0,
+0x03,0xFF,0xFF,0x83,0xFF,0xFF,0x80,0x3F,0xFA,0xFF,0x08,0xE0,0x00,0x00,0x01,0x83,
+0xFF,0xFF,0x80,0x7F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x02,0x1F,0xFF,0xE1,0xF9,0xFF,
+0x00,0xE0,0xFD,0x00,0x00,0x1F,0xF6,0xFF,0x00,0x80,0xFE,0x00,0x03,0x1F,0xFF,0xFF,
+0x1F,0xF8,0xFF,0x06,0x80,0x00,0x00,0x1F,0xFF,0xC0,0x1F,0xF7,0xFF,0x05,0xC0,0x00,
+0x1F,0xF8,0x00,0x1F,0xF6,0xFF,0x04,0xF8,0x1F,0xF8,0x00,0x1F,0xFA,0xFF,0x00,0xE1,
+0xFC,0xFF,0x01,0xF8,0x03,0xF9,0xFF,0x01,0xE0,0x1F,0xFD,0xFF,0x00,0xF8,0xF8,0xFF,
+0x01,0xE0,0x01,0xFC,0xFF,0x01,0xFE,0x7F,0xFA,0xFF,0x02,0xE0,0x00,0x1F,0xFD,0xFF,
+0x01,0xFC,0x1F,0xFA,0xFF,0x02,0xE0,0x00,0x00,0xFD,0xFF,0x01,0xD8,0x1F,0xFA,0xFF,
+0x00,0xF0,0xFD,0x00,0x03,0x1F,0xFF,0x88,0x1F,0xF9,0xFF,0x00,0xC0,0xFE,0x00,0x03,
+0x1F,0xFF,0x89,0x1F,0xF8,0xFF,0x06,0xC0,0x00,0x00,0x1F,0xFF,0x9B,0x9F,0xF8,0xFF,
+0x06,0x80,0x00,0x00,0x1F,0xFF,0x93,0x3F,0xF9,0xFF,0x00,0xC0,0xFE,0x00,0x03,0x1F,
+0xFF,0x90,0x1F,0xFA,0xFF,0x00,0xE0,0xFD,0x00,0x03,0x3F,0xFF,0x80,0x1F,0xFA,0xFF,
+0x02,0xE0,0x00,0x03,0xFD,0xFF,0x01,0x80,0x1F,0xFA,0xFF,0x02,0xE0,0x00,0x1F,0xFD,
+0xFF,0x01,0x80,0x1F,0xFA,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x00,0xC7,0xF9,0xFF,0x01,
+0xE0,0x1F,0xF3,0xFF,0x00,0xE3,0xFA,0xFF,0x00,0xF1,0xF3,0xFF,0x01,0x9F,0xF1,0xF3,
+0xFF,0x01,0x81,0xF1,0xF3,0xFF,0x01,0x80,0x03,0xF3,0xFF,0x01,0x80,0x03,0xF3,0xFF,
+0x01,0xF8,0x0F,0xF3,0xFF,0x01,0xF8,0x3F,0xF3,0xFF,0x00,0xE0,0xF2,0xFF,0x00,0x83,
+0xF2,0xFF,0x00,0x8F,0xF2,0xFF,0x00,0xBF,0xF8,0xFF,0x00,0xF8,0xFE,0x00,0x03,0x0F,
+0xFF,0xFE,0x1F,0xF9,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x0F,0xFF,0xFE,0x1F,0xF9,0xFF,
+0x00,0xF0,0xFE,0x00,0x03,0x0F,0xFF,0xFE,0x1F,0xF9,0xFF,0x00,0xF0,0xFE,0x00,0x03,
+0x0F,0xFF,0xFE,0x1F,0xF9,0xFF,0x00,0xF0,0xFE,0x00,0x00,0x0F,0xF6,0xFF,0x00,0xF8,
+0xFE,0x00,0x00,0x0F,0xF3,0xFF,0x01,0xF8,0x0F,0xF3,0xFF,0x04,0xF8,0x0F,0xFF,0xE0,
+0x3F,0xF6,0xFF,0x04,0xF8,0x0F,0xFF,0xC0,0x3F,0xF6,0xFF,0x04,0xF8,0x0F,0xFF,0x80,
+0x1F,0xF6,0xFF,0x04,0xF8,0x0F,0xFF,0x83,0x1F,0xF6,0xFF,0x04,0xF8,0x0F,0xFF,0x9F,
+0x9F,0xF6,0xFF,0x04,0xF8,0x0F,0xFF,0x9F,0x1F,0xF6,0xFF,0x04,0xF8,0x0F,0xFF,0x86,
+0x1F,0xFA,0xFF,0x08,0xC0,0x00,0x00,0x01,0xF8,0x0F,0xFF,0x86,0x3F,0xFA,0xFF,0x08,
+0xC0,0x00,0x00,0x01,0xF8,0x0F,0xFF,0xC7,0x7F,0xFA,0xFF,0x05,0xC0,0x00,0x00,0x01,
+0xF8,0x0F,0xF7,0xFF,0x05,0xC0,0x00,0x00,0x01,0xF8,0x0F,0xF7,0xFF,0x08,0xC0,0x00,
+0x00,0x01,0xF8,0x0F,0xFF,0xF0,0x7F,0xFA,0xFF,0x08,0xC0,0x00,0x00,0x01,0xF8,0x0F,
+0xFF,0xC0,0x3F,0xFA,0xFF,0x08,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,0xFF,0xC0,0x1F,0xFA,
+0xFF,0x08,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0xC0,0x7F,
+0xFF,0x01,0xF8,0x0F,0xFF,0x8F,0x9F,0xFA,0xFF,0x08,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,
+0xFF,0x9F,0x9F,0xFA,0xFF,0x08,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,0xFF,0x9F,0x1F,0xFA,
+0xFF,0x08,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,0xFF,0x80,0x1F,0xFA,0xFF,0x08,0xC0,0x7F,
+0xFF,0x01,0xF8,0x0F,0xFF,0x80,0x3F,0xFA,0xFF,0x08,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,
+0xFF,0xC0,0x7F,0xFA,0xFF,0x07,0xC0,0x7F,0xFF,0x01,0xF8,0x0F,0xFF,0xE0,0xF9,0xFF,
+0x03,0xC0,0x7F,0xFF,0x01,0xF5,0xFF,0x03,0xC0,0x7F,0xFF,0x01,0xFD,0xFF,0x00,0xDF,
+0xFA,0xFF,0x03,0xC0,0x7F,0xFF,0x01,0xFE,0xFF,0x01,0xF0,0x1F,0xFA,0xFF,0x03,0xC0,
+0x7F,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x1F,0xFA,0xFF,0x03,0xE0,0x7F,0xFF,0x01,0xFE,
+0xFF,0x01,0x80,0x1F,0xF9,0xFF,0x06,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0x81,0xF8,0xFF,
+0x06,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0x8F,0xF8,0xFF,0x07,0xF8,0x0F,0xFF,0xF8,0x0F,
+0xFF,0x9F,0x1F,0xF9,0xFF,0x07,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0x80,0x1F,0xF9,0xFF,
+0x07,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0x80,0x1F,0xF9,0xFF,0x07,0xF8,0x0F,0xFF,0xF8,
+0x0F,0xFF,0x80,0x1F,0xF9,0xFF,0x06,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0xC3,0xF8,0xFF,
+0x06,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0xDF,0xF8,0xFF,0x07,0xF8,0x0F,0xFF,0xF8,0x0F,
+0xFF,0x9E,0x1F,0xF9,0xFF,0x07,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0x80,0x1F,0xF9,0xFF,
+0x07,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0x80,0x1F,0xF9,0xFF,0x07,0xF8,0x0F,0xFF,0xF8,
+0x0F,0xFF,0x80,0x1F,0xF9,0xFF,0x06,0xF8,0x0F,0xFF,0xF8,0x0F,0xFF,0xC7,0xF8,0xFF,
+0x04,0xF8,0x0F,0xFF,0xF8,0x0F,0xF6,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x0F,0xF6,0xFF,
+0x00,0xF8,0xFE,0x00,0x00,0x0F,0xF6,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x0F,0xF6,0xFF,
+0x00,0xF8,0xFE,0x00,0x00,0x0F,0xF6,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x0F,0xF6,0xFF,
+0x00,0xF8,0xFE,0x00,0x00,0x0F,0x81,0xFF,0x81,0xFF,0x9B,0xFF,
+};
+
+// first : 4736 bytes, packed 3481
+const unsigned char first_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x94,0xFF,0x02,0xC0,0x00,0x03,0xF4,0xFF,0x02,0xC0,0x00,0x03,
+0xF4,0xFF,0x02,0xC0,0x00,0x03,0xF4,0xFF,0x02,0xC0,0x00,0x03,0xF4,0xFF,0x7F,0xC0,
+0x00,0x03,0xFF,0xF8,0x00,0x01,0xFF,0xFF,0xF3,0xE0,0xF8,0xE7,0x00,0x00,0x7F,0xC0,
+0x00,0x03,0xFF,0xF8,0x00,0x01,0xFF,0xFF,0xF3,0xE0,0xF8,0xE7,0x00,0x00,0x7F,0xC0,
+0x01,0x03,0xFF,0xF8,0x7F,0xF1,0xFF,0xDE,0xF3,0xE0,0xF8,0xE7,0x1F,0xFC,0x7F,0xC0,
+0x71,0x03,0xFF,0xF8,0xFF,0xF9,0xFF,0x8C,0x63,0xE0,0xF8,0xE7,0x3F,0xFE,0x7F,0xC0,
+0x63,0x03,0xFF,0xF8,0xFF,0xF9,0xFF,0x8C,0x73,0xE0,0xF8,0xE7,0x3F,0xFE,0x7F,0xC0,
+0x62,0x03,0xFF,0xF8,0xE0,0x39,0xCE,0x03,0xFC,0x7F,0x07,0xFF,0x38,0x0E,0x7F,0xC0,
+0x6C,0x03,0xFF,0xF8,0xC0,0x39,0xCE,0x03,0xFC,0x7F,0x07,0xFF,0x38,0x0E,0x7F,0xC1,
+0xF0,0x03,0xFF,0xF8,0xC0,0x39,0xE0,0x23,0xDF,0xBF,0x1F,0x8F,0x38,0x0E,0x7F,0x7F,
+0xC0,0x68,0x03,0xFF,0xF8,0xC0,0x39,0xF0,0x73,0x8F,0x9F,0x1F,0x07,0x38,0x0E,0x7F,
+0xC0,0x66,0x03,0xFF,0xF8,0xC0,0x39,0xF0,0x73,0x8F,0x9F,0x1F,0x07,0x38,0x0E,0x7F,
+0xC0,0x63,0x03,0xFF,0xF8,0xC0,0x39,0xFF,0xFC,0x70,0x63,0xE7,0xC7,0x38,0x0E,0x7F,
+0xC0,0x63,0x83,0xFF,0xF8,0xC0,0x39,0xFF,0xFC,0x70,0x63,0xE7,0xE7,0x38,0x0E,0x7F,
+0xC0,0x01,0x03,0xFF,0xF8,0xE0,0x39,0xFF,0xFC,0x60,0x77,0xC7,0xE7,0x38,0x0E,0x7F,
+0xC0,0x00,0x03,0xFF,0xF8,0xFF,0xF9,0xCE,0x00,0x00,0x7F,0x07,0x1F,0x3F,0xFE,0x7F,
+0xC0,0x00,0x03,0xFF,0xF8,0xFF,0xF9,0xCE,0x00,0x00,0x7F,0x07,0x1F,0x3F,0xFE,0x7F,
+0xC0,0x00,0x03,0xFF,0xF8,0x00,0x01,0xCE,0x31,0x8C,0x63,0x18,0xE7,0x00,0x00,0x7F,
+0x22,0xC0,0x00,0x03,0xFF,0xF8,0x00,0x01,0xCE,0x73,0x9C,0x63,0x18,0xE6,0x00,0x00,
+0x7F,0xC1,0xA2,0x03,0xFF,0xFC,0x00,0x01,0xCE,0x73,0x8C,0x63,0x18,0xE7,0x00,0x00,
+0x7F,0xC1,0xF6,0x03,0xFD,0xFF,0x04,0xC1,0xF3,0x8F,0x9C,0x18,0xFD,0xFF,0x02,0xC1,
+0x42,0x03,0xFD,0xFF,0x04,0xC1,0xF3,0x8F,0x9C,0x18,0xFD,0xFF,0x62,0xC0,0x02,0x03,
+0xFF,0xFF,0x00,0x01,0xC1,0xFF,0xF0,0x63,0x1F,0xE0,0x0F,0xCF,0xFF,0xC1,0xAA,0x03,
+0xFF,0xFF,0x00,0x01,0xC1,0xFF,0xE0,0x63,0x1F,0xE0,0x07,0xCF,0xFF,0xC1,0xEA,0x03,
+0xFF,0xFF,0x00,0x01,0xC1,0xFF,0xF0,0xE3,0x1F,0xE0,0x07,0xC7,0xFF,0xC1,0x3F,0x03,
+0xFF,0xF8,0xC0,0x3E,0x3E,0x70,0x73,0xFC,0x18,0xF8,0xF8,0x00,0x7F,0xC1,0xE9,0x03,
+0xFF,0xF8,0xC0,0x3E,0x3E,0x70,0x73,0xFC,0x18,0xF8,0xF8,0x00,0x7F,0xC1,0x29,0x83,
+0xFF,0xFF,0xFE,0x39,0xCE,0x70,0x00,0x1C,0x67,0xFF,0xF8,0xFF,0xFF,0xC1,0x29,0x83,
+0xFE,0xFF,0x0C,0x39,0xCE,0x70,0x00,0x1C,0xE7,0xFF,0xF9,0xFF,0xFF,0xC0,0x01,0x83,
+0xFE,0xFF,0x5C,0x39,0xCE,0x70,0x00,0x1C,0xE7,0xFF,0xF9,0xFF,0xFF,0xC0,0x00,0x03,
+0xFF,0xF8,0xC7,0x06,0x31,0x80,0x03,0x83,0x07,0x07,0xC1,0xCE,0x7F,0xC0,0x00,0x03,
+0xFF,0xF8,0xC7,0x06,0x31,0x80,0x03,0x83,0x07,0x07,0xC1,0xCE,0x7F,0xC0,0x00,0x03,
+0xFF,0xFD,0xC3,0x06,0x71,0xC0,0x07,0x83,0x07,0x16,0xC3,0xCE,0x7F,0xC0,0x80,0x03,
+0xFF,0xFF,0xC0,0xC1,0xF1,0xF0,0x1F,0x83,0x1F,0x18,0x3F,0xF1,0xFF,0xC1,0xC0,0x03,
+0xFF,0xFF,0xE0,0xC1,0xF1,0xF0,0x0F,0x83,0x1F,0x18,0x3F,0xF1,0xFF,0xC1,0xFF,0x83,
+0xFE,0xFF,0x0C,0x06,0x0E,0x0F,0x80,0x7C,0x18,0x18,0xC1,0xFF,0xFF,0xC1,0x01,0x03,
+0xFE,0xFF,0x7F,0x06,0x0E,0x0F,0x80,0x7C,0x18,0x19,0xC1,0xFF,0xFF,0xC0,0xB5,0x03,
+0xFF,0xFD,0xBF,0x14,0x8E,0x0B,0xE0,0xF5,0x08,0x10,0xE1,0xFF,0x7F,0xC1,0xA5,0x03,
+0xFF,0xF8,0x3F,0x39,0xCF,0xF1,0xF3,0xE3,0x07,0xE0,0xF9,0xFE,0x7F,0xC1,0xFE,0x03,
+0xFF,0xF8,0x3F,0x39,0xCF,0xF3,0xF3,0xE3,0x07,0xE1,0xF9,0xFE,0x7F,0xC1,0x53,0x03,
+0xFF,0xFF,0x3F,0x07,0xC1,0xFF,0xFC,0x7C,0xE7,0xE7,0xF9,0xCE,0x7F,0xC1,0x53,0x03,
+0xFF,0xFF,0x3F,0x07,0xC1,0xFF,0xFC,0x7C,0xE7,0xE7,0xF9,0xCE,0x7F,0xC1,0x53,0x03,
+0xFF,0xFF,0x3F,0x07,0xC1,0xFF,0xFC,0x7C,0xE7,0xC7,0xF1,0xCE,0x7F,0xC0,0x02,0x03,
+0xFF,0xFF,0x38,0xC1,0xC1,0x80,0x7C,0x7F,0xF8,0x07,0xC1,0xCF,0xFF,0xC0,0x00,0x03,
+0xFF,0xFF,0x38,0x7F,0xC1,0xC1,0x80,0x7C,0x7F,0xF8,0x07,0xC1,0xCF,0xFF,0xC0,0x00,
+0x03,0xFF,0xFF,0x07,0xC7,0xFE,0x70,0x1C,0x1C,0x00,0x07,0x3E,0x01,0xFF,0xC0,0x00,
+0x03,0xFF,0xFF,0x07,0xC7,0xFE,0x70,0x0C,0x1C,0x00,0x07,0x3E,0x01,0xFF,0xC0,0x00,
+0x03,0xFF,0xFF,0x07,0xC7,0xFE,0x70,0x1C,0x1C,0x00,0x06,0x3E,0x01,0xFF,0xC0,0x01,
+0x03,0xFF,0xF8,0xFF,0xC1,0xFE,0x7E,0x7F,0x9C,0xFF,0xF8,0x38,0x31,0xFF,0xC1,0x05,
+0x03,0xFF,0xF8,0xFF,0xC1,0xFE,0x7C,0x7F,0x9C,0xFF,0xF8,0x38,0x31,0xFF,0xC1,0xF6,
+0x03,0xFF,0xFF,0x01,0xFE,0x01,0x80,0x1C,0x60,0x07,0x07,0xC0,0x0F,0xFF,0xC1,0xF2,
+0x03,0xFF,0xFF,0x00,0xFE,0x01,0x80,0x0C,0x60,0x07,0x07,0xC0,0x0F,0xFF,0xC1,0x7E,
+0x03,0xFF,0xFF,0x00,0x33,0xFE,0x01,0xC0,0x0C,0xE0,0x03,0x07,0xC0,0x07,0xFF,0xC1,
+0x62,0x03,0xFF,0xFF,0xC7,0x38,0x0F,0xFF,0x8F,0xE3,0xE0,0xFF,0xC6,0x00,0x7F,0xC1,
+0x7E,0x03,0xFF,0xFF,0xC7,0x38,0x0F,0xFF,0x8F,0xE3,0xE0,0xFF,0xC6,0x00,0x7F,0xC1,
+0x66,0x03,0xFF,0xFF,0xC0,0xC7,0xF1,0xC0,0x7F,0xFE,0xFF,0x0C,0x39,0x84,0x7F,0xC1,
+0x6F,0x03,0xFF,0xFF,0xC0,0xC7,0xF1,0x80,0x7F,0xFE,0xFF,0x0C,0x39,0xCE,0x7F,0xC1,
+0x83,0x03,0xFF,0xFF,0xE0,0xC7,0xF1,0x80,0x7F,0xFE,0xFF,0x7F,0x39,0xCE,0x7F,0xC0,
+0x03,0x03,0xFF,0xF8,0xF8,0xC0,0x3F,0xFF,0xF0,0x60,0xE0,0xFF,0x00,0x30,0x7F,0xC0,
+0x00,0x03,0xFF,0xF8,0xF8,0xC0,0x3F,0xFF,0xF0,0x60,0xE0,0xFF,0x00,0x30,0x7F,0xC0,
+0x00,0x03,0xFF,0xFD,0xF8,0xBC,0x38,0x78,0x1C,0x40,0x40,0xFF,0x80,0xFB,0x7F,0xC0,
+0x00,0x03,0xFF,0xFF,0xF8,0x3E,0x30,0x70,0x1C,0x00,0x00,0xFF,0xC1,0xFF,0xFF,0xC0,
+0x80,0x03,0xFF,0xFF,0xF8,0x3E,0x30,0x70,0x0C,0x00,0x00,0xFF,0xC1,0xFF,0xFF,0xC1,
+0xFC,0x03,0xFF,0xF8,0xE6,0x00,0x01,0xF0,0x03,0xFF,0x1F,0x00,0x01,0xC0,0x7F,0xC1,
+0xF4,0x03,0xFF,0xF8,0xC7,0x00,0x01,0xF0,0x03,0xFF,0x1F,0x00,0x01,0xC0,0x7F,0xC1,
+0xB4,0x03,0xFF,0xFD,0xE7,0x00,0x01,0xF0,0x03,0xFF,0x3F,0x00,0x05,0x00,0xC0,0x7F,
+0xC3,0xFF,0x03,0xFD,0xFF,0x0B,0xC1,0xF3,0xFF,0x9C,0xF8,0xE7,0xF8,0x31,0xFF,0xC3,
+0xB9,0x03,0xFD,0xFF,0x7F,0xC1,0xF1,0xFF,0x9C,0xF8,0xE7,0xF8,0x31,0xFF,0xC1,0xA9,
+0x03,0xFF,0xFC,0x00,0x01,0xF0,0x70,0x70,0x1C,0x00,0xE7,0x39,0xF0,0x7F,0xC1,0xA9,
+0x03,0xFF,0xF8,0x00,0x01,0xF0,0x70,0x60,0x1C,0x00,0xE6,0x39,0xF0,0x7F,0xC1,0xF1,
+0x83,0xFF,0xF8,0x00,0x01,0xF0,0x20,0x70,0x1C,0x00,0xC7,0x38,0xF8,0x7F,0xC1,0x81,
+0x83,0xFF,0xF8,0xFF,0xF9,0xC0,0x00,0x7C,0x7F,0x07,0x07,0xF8,0x3F,0xFF,0xC0,0x03,
+0x83,0xFF,0xF8,0xFF,0xF9,0xC0,0x00,0x7C,0x7F,0x07,0x07,0xF8,0x3F,0xFF,0xC0,0x00,
+0x03,0xFF,0xF8,0xE0,0x39,0xCE,0x3F,0xFF,0xE0,0xFF,0x00,0x00,0x0E,0x7F,0xC0,0x00,
+0x03,0xFF,0xF8,0xC0,0x39,0xCE,0x7F,0xFF,0xE0,0xFF,0x00,0x00,0x0E,0x7F,0xC0,0x00,
+0x03,0xFF,0xF8,0xC0,0x39,0x7F,0xCE,0x3F,0xFF,0xE0,0xFF,0x00,0x00,0x06,0x7F,0xC0,
+0x00,0x03,0xFF,0xF8,0xC0,0x39,0xC0,0x00,0x7C,0x60,0xE7,0x07,0xC6,0x00,0x7F,0xC0,
+0x18,0x03,0xFF,0xF8,0xC0,0x39,0xC0,0x00,0x7C,0x60,0xE7,0x07,0xC6,0x00,0x7F,0xC0,
+0x98,0x03,0xFF,0xF8,0xC0,0x39,0xC0,0x3C,0x7F,0x83,0xE7,0xFF,0x3E,0x3F,0xFF,0xC0,
+0x90,0x03,0xFF,0xF8,0xC0,0x39,0xC0,0x7C,0x7F,0x83,0xE7,0xFE,0x3E,0x3F,0xFF,0xC1,
+0xB0,0x83,0xFF,0xF8,0xE0,0x39,0xC0,0x7E,0x7F,0x83,0xE7,0xFF,0x3E,0x3F,0xFF,0xC1,
+0x70,0x83,0xFF,0xF8,0xFF,0xF9,0xCF,0x8F,0xFC,0x7C,0x1F,0xE7,0xC7,0xCF,0xFF,0xC1,
+0x73,0x03,0xFF,0xF8,0xFF,0xF9,0xCF,0x8F,0xFC,0x7C,0x1F,0xE7,0xC7,0xCF,0xFF,0xC1,
+0x7C,0x03,0xFF,0xF8,0x00,0x01,0x2B,0xF0,0x00,0x1C,0x03,0x00,0xE0,0x07,0x0E,0x7F,
+0xC1,0xA0,0x03,0xFF,0xF8,0x00,0x01,0xF0,0x00,0x0C,0x03,0x00,0xE0,0x06,0x0E,0x7F,
+0xC1,0x30,0x03,0xFF,0xFC,0x00,0x01,0xF0,0x00,0x1C,0x03,0x00,0xE0,0x06,0x0E,0x7F,
+0xC0,0x30,0x03,0xF4,0xFF,0x02,0xC0,0x30,0x03,0xF4,0xFF,0x02,0xC0,0x00,0x03,0xF4,
+0xFF,0x02,0xC0,0x00,0x03,0xF4,0xFF,0x02,0xC0,0x00,0x03,0xF4,0xFF,0x02,0xC0,0x00,
+0x03,0xF4,0xFF,0x02,0xC0,0x00,0x03,0xF5,0xFF,0x03,0xFD,0xC0,0x00,0x03,0xF5,0xFF,
+0x00,0xF9,0xF2,0xFF,0x00,0xF1,0xF2,0xFF,0x00,0xF1,0xF2,0xFF,0x00,0xF1,0xF2,0xFF,
+0x00,0xF1,0xF2,0xFF,0x00,0xF3,0xF2,0xFF,0x00,0xF7,0xD2,0xFF,0x00,0xFC,0xF2,0xFF,
+0x00,0xF8,0xF2,0xFF,0x00,0xF0,0xF2,0xFF,0x00,0xF0,0xF2,0xFF,0x00,0xF0,0xF2,0xFF,
+0x00,0xF7,0xE2,0xFF,0x00,0xF0,0xF2,0xFF,0x00,0xF0,0xF2,0xFF,0x00,0xF0,0xF2,0xFF,
+0x00,0xF6,0x92,0xFF,0x01,0xFE,0x7F,0xF3,0xFF,0x01,0xF0,0x3F,0xF3,0xFF,0x01,0xF8,
+0x3F,0xF3,0xFF,0x01,0xDC,0x3F,0xF3,0xFF,0x01,0xCC,0x3F,0xF3,0xFF,0x01,0xEC,0x3F,
+0xF3,0xFF,0x02,0xAC,0x3F,0x9F,0xF4,0xFF,0x02,0xBC,0x78,0x1F,0xFC,0xFF,0x00,0xDF,
+0xFA,0xFF,0x02,0x9D,0x7C,0x1F,0xFC,0xFF,0x00,0xC7,0xFA,0xFF,0x02,0x9F,0xEE,0x1F,
+0xFC,0xFF,0x00,0x47,0xF8,0xFF,0x00,0x9F,0xFC,0xFF,0x00,0x0F,0xF2,0xFF,0x00,0x9B,
+0xF2,0xFF,0x00,0x3B,0xFA,0xFF,0x02,0xF7,0xFF,0x3F,0xFC,0xFF,0x00,0xC3,0xFA,0xFF,
+0x02,0xF3,0xFF,0x3F,0xFD,0xFF,0x02,0xFD,0xD9,0xDF,0xFB,0xFF,0x02,0xF9,0xFF,0x3F,
+0xFD,0xFF,0x02,0xFB,0x59,0x1F,0xFB,0xFF,0x02,0xF9,0xF8,0x3F,0xFD,0xFF,0x02,0xFB,
+0x11,0x72,0xFB,0xFF,0x02,0xF9,0xF4,0x3F,0xFD,0xFF,0x02,0xFB,0xF1,0x19,0xFB,0xFF,
+0x02,0xFD,0xFE,0x3F,0xFC,0xFF,0x01,0xB2,0x0F,0xF9,0xFF,0x00,0x3F,0xFC,0xFF,0x03,
+0xA2,0x07,0xFF,0xE1,0xFB,0xFF,0x00,0xBF,0xFC,0xFF,0x03,0xFE,0x07,0xFF,0xE0,0xFD,
+0xFF,0x00,0xCF,0xFA,0xFF,0x08,0xFC,0x07,0xFF,0xF0,0x7F,0xFF,0xFF,0xFE,0xCF,0xFA,
+0xFF,0x0A,0xB0,0x07,0xFE,0x88,0x7F,0xFF,0xFF,0xFE,0xE7,0xFF,0x1F,0xFD,0xFF,0x05,
+0x88,0x70,0x33,0xFC,0x80,0x3F,0xFC,0xFF,0x00,0x1F,0xFD,0xFF,0x0B,0x8F,0x78,0x00,
+0xFF,0x00,0x3F,0xFF,0xFF,0xFB,0xFF,0xFF,0x1F,0xFE,0xFF,0x0C,0xCF,0x8F,0x1C,0x07,
+0x80,0x00,0x1F,0xFF,0xFF,0xFD,0xFF,0xFF,0x9F,0xFE,0xFF,0x06,0xF3,0x9F,0xC0,0x03,
+0x00,0x00,0x1F,0xFE,0xFF,0x02,0x7E,0xFF,0xCF,0xFE,0xFF,0x02,0xD7,0x8E,0x70,0xFE,
+0x00,0x00,0x1F,0xFE,0xFF,0x02,0xFC,0x3F,0x9F,0xFE,0xFF,0x02,0xCF,0x0C,0x61,0xFE,
+0x00,0x00,0x3F,0xFD,0xFF,0x01,0xDF,0x9F,0xFE,0xFF,0x0C,0xF9,0x0C,0xC3,0x80,0x00,
+0x00,0x3F,0xFF,0xFF,0xF3,0xFB,0xF9,0x1F,0xFE,0xFF,0x05,0x73,0x19,0xC7,0xC0,0x00,
+0x00,0xFE,0xFF,0x0C,0xF0,0xF8,0xFF,0x3F,0xFF,0xFF,0xFE,0x5F,0xB3,0xCF,0xC0,0x00,
+0x01,0xFE,0xFF,0x02,0xFC,0x7C,0x07,0xFE,0xFF,0x06,0xFE,0x6C,0xB3,0xE6,0xE3,0x00,
+0x07,0xFE,0xFF,0x02,0xC7,0xFF,0x0D,0xFE,0xFF,0x06,0xFE,0x24,0xBF,0xE6,0x7F,0xC0,
+0x1F,0xFE,0xFF,0x00,0xC1,0xFC,0xFF,0x06,0xFD,0xA4,0xB7,0x73,0xFC,0xC0,0x7F,0xFE,
+0xFF,0x03,0xF0,0xFF,0xFF,0x87,0xFE,0xFF,0x03,0xE2,0x83,0xF0,0x3D,0xFC,0xFF,0x03,
+0xF9,0xFF,0xFF,0xC7,0xFE,0xFF,0x16,0xFE,0x07,0xF0,0x3B,0xFF,0xFC,0x7F,0xFF,0xFF,
+0xF9,0xFF,0xFE,0x37,0xFF,0xFF,0xF8,0x1F,0x0E,0x00,0xF3,0x03,0xF0,0x7F,0xFE,0xFF,
+0x01,0xEF,0xFC,0xFE,0xFF,0x07,0xF8,0x0F,0x7C,0x00,0x03,0x00,0xF0,0x7F,0xFE,0xFF,
+0x00,0xEC,0xFD,0xFF,0x0C,0xF8,0x07,0x3C,0x00,0x0C,0x00,0xF0,0x7F,0xFF,0xFF,0x9F,
+0xE6,0x7F,0xFE,0xFF,0x0C,0xF8,0x0F,0x1C,0x06,0x18,0x00,0xF8,0x1F,0xFF,0xFF,0x0F,
+0xFE,0x7F,0xFE,0xFF,0x0B,0xFE,0x7F,0x18,0x1F,0xF8,0x03,0xFC,0x3F,0xFF,0xFF,0x0F,
+0xF9,0xFC,0xFF,0x0A,0xEF,0x08,0x1F,0xF0,0x0F,0xFE,0x7F,0xFF,0xFF,0x0F,0xFD,0xFD,
+0xFF,0x14,0xFE,0x0F,0x88,0x3D,0xE3,0xFF,0xFE,0x7F,0xFF,0xFE,0x1F,0xC3,0xFF,0xE7,
+0xFF,0xFF,0xFC,0x1E,0x88,0x38,0x07,0xFD,0xFF,0x0D,0xFE,0x3F,0xFB,0xFF,0x07,0xFF,
+0xFF,0xF8,0x0E,0x00,0x30,0x0F,0xFF,0xC1,0xFE,0xFF,0x0C,0x3F,0xFF,0xFE,0x6F,0xFF,
+0xFF,0xF8,0x1F,0x58,0x40,0x19,0xEF,0xFD,0xFD,0xFF,0x0C,0x1F,0xDF,0x8F,0xFF,0xFF,
+0xF8,0x38,0x3F,0x80,0x73,0xC0,0x7F,0xDF,0xFE,0xFF,0x00,0x01,0xFC,0xFF,0x0B,0xFE,
+0x7F,0x00,0x67,0x84,0xF8,0x18,0x7F,0xFF,0x7F,0xE1,0x7F,0xFE,0xFF,0x0C,0xF8,0x3F,
+0x3F,0x00,0xFD,0x8F,0xE1,0xFC,0x0F,0xDF,0xBF,0xF3,0x77,0xFE,0xFF,0x0C,0xF8,0x03,
+0x8F,0x8F,0xFB,0x1F,0x07,0xFE,0x0F,0xE3,0xBF,0xF3,0xBF,0xFE,0xFF,0x0A,0xFB,0x00,
+0x7F,0xFF,0xFE,0xE0,0x8F,0xFF,0x87,0xF1,0xDF,0xFB,0xFF,0x08,0xF7,0x7F,0xFF,0xFF,
+0xE0,0x7F,0xE7,0xC3,0xF8,0xFB,0xFF,0x0A,0xFE,0xFF,0xBF,0xFF,0xFF,0x83,0xFF,0xCF,
+0xC1,0xFC,0x7D,0xFC,0xFF,0x01,0xFC,0x0F,0xFD,0xFF,0x27,0x1F,0xCF,0xE0,0xFC,0x3C,
+0xFF,0xFF,0xEF,0xFF,0xFF,0xFC,0x07,0xEF,0xFF,0xFF,0xFC,0x7F,0xF0,0x3C,0x7E,0x3C,
+0x3F,0xFF,0x87,0xFF,0xFF,0xFC,0x39,0xC3,0xFF,0xFF,0xE0,0xFF,0xFF,0xFC,0x1F,0x0E,
+0x1F,0xFF,0x87,0xFE,0xFF,0x0C,0xF9,0xE2,0xFF,0xFF,0x03,0xFF,0xC2,0xFE,0x07,0x86,
+0x1F,0xFF,0xC7,0xFE,0xFF,0x1B,0xF1,0xE0,0xFF,0xFF,0xFE,0x7F,0x81,0xFE,0x03,0xC7,
+0x0C,0x7F,0xEF,0xFF,0xFF,0xF9,0xFC,0xE0,0x9F,0xFF,0xFC,0xFF,0x07,0xFF,0x03,0xE3,
+0x9C,0x3F,0xFE,0xFF,0x0C,0xF1,0xFF,0xE1,0xCF,0xFF,0xFF,0x9F,0xF8,0xFF,0xE1,0xF1,
+0xDF,0xDF,0xFE,0xFF,0x0A,0xE1,0xFF,0xF1,0xC7,0xFF,0xF8,0x3F,0xE1,0xFF,0xF0,0xF8,
+0xFC,0xFF,0x0B,0xE1,0xFB,0xF1,0xF8,0x0F,0xA0,0x7F,0x80,0xFF,0xF8,0xFC,0x3F,0xFD,
+0xFF,0x0B,0xE0,0x01,0xF8,0xBC,0xF8,0x03,0xFF,0x00,0x7F,0xF8,0x7E,0x3F,0xFD,0xFF,
+0x3A,0xF0,0x01,0xFB,0x0F,0xF8,0xC7,0xFC,0x00,0x3F,0xF8,0x3E,0x3F,0xFF,0x8F,0xFF,
+0xFF,0xF0,0x03,0xFE,0x00,0x2F,0x1F,0xF8,0x00,0x3F,0xF0,0x1F,0x7F,0xFF,0xE7,0xFF,
+0xFF,0xFC,0x03,0xFE,0x0C,0x03,0xFF,0xF0,0x00,0x1F,0xF0,0x07,0xFF,0xFF,0xF7,0xFF,
+0xFF,0xFC,0x67,0xFC,0x01,0xFF,0x9E,0x00,0x80,0x3F,0xF0,0x03,0xFC,0xFF,0x06,0xFC,
+0xEF,0xE0,0x03,0xFF,0x38,0x07,0xFE,0xFF,0x00,0x01,0xFB,0xFF,0x04,0xCF,0xE0,0x2F,
+0xFE,0xC1,0xFD,0xFF,0x03,0xC0,0xFF,0xFF,0x0F,0xFE,0xFF,0x0C,0xDF,0xC4,0xFF,0xFF,
+0xCF,0xF8,0x1F,0xFE,0x3F,0xF1,0xFF,0xFF,0x9F,0xFE,0xFF,0x0C,0x9F,0xBC,0x7F,0xFF,
+0xFF,0xC0,0x30,0x00,0x00,0x79,0xFF,0xFF,0x9F,0xFE,0xFF,0x0C,0xBF,0x2E,0x03,0xFF,
+0xFF,0x02,0x40,0x00,0x00,0x0F,0xFF,0xFF,0x9F,0xFE,0xFF,0x0C,0x9F,0x0E,0x7F,0xFF,
+0xFC,0x3E,0x80,0x00,0xFC,0x03,0xFF,0xFF,0x9F,0xFD,0xFF,0x06,0x86,0x7F,0x1F,0xF0,
+0x7F,0x00,0x0F,0xFD,0xFF,0x00,0x1F,0xFD,0xFF,0x06,0xE4,0x3F,0x0F,0xC0,0xFE,0x00,
+0x3F,0xFD,0xFF,0x00,0x3F,0xFD,0xFF,0x0B,0xE4,0x1F,0xEF,0x81,0xF8,0x00,0xFF,0xFF,
+0xF3,0xFF,0xFF,0x3F,0xFD,0xFF,0x0B,0xFC,0x7F,0xFF,0x03,0xF0,0x03,0xFF,0xCF,0xE3,
+0xFF,0xFF,0xBF,0xFD,0xFF,0x08,0xFE,0x3F,0xFF,0x07,0xE0,0x07,0xFF,0x31,0xC3,0xFB,
+0xFF,0x3C,0x3F,0xFF,0x3F,0xFE,0x1F,0xC0,0x1F,0xFC,0x47,0x87,0xFF,0xFF,0xDF,0xFF,
+0xFF,0xFC,0x27,0xFF,0xB3,0xFC,0x3F,0x00,0x3F,0xF0,0x9F,0x0F,0xFF,0xFF,0xDF,0xFF,
+0xFF,0xF8,0x0F,0xFF,0xF9,0xF8,0xFE,0x00,0x7F,0xE0,0x3E,0x3F,0xFF,0xFF,0x9F,0xFF,
+0xFF,0xFC,0x1F,0xFF,0xFD,0xFB,0xF0,0x00,0xFF,0xC0,0xFC,0xCF,0xFF,0xFF,0x1F,0xFE,
+0xFF,0x0C,0x37,0xFB,0xBF,0xFF,0xF0,0x07,0xFF,0x03,0xF9,0x8F,0xFF,0xFF,0x1F,0xFE,
+0xFF,0x0C,0x65,0xFD,0x9F,0xFF,0xE0,0x3F,0xFE,0x3F,0xF3,0x0F,0xFF,0xFF,0x1F,0xFE,
+0xFF,0x0C,0xE6,0xFC,0x9F,0xFF,0xC1,0xFF,0xFC,0x7F,0xE0,0x3F,0xFF,0xFF,0x1F,0xFE,
+0xFF,0x0C,0xFE,0x3C,0x0B,0xFF,0x87,0xFF,0xF8,0xFF,0xE0,0x7F,0xFF,0xFF,0x1F,0xFD,
+0xFF,0x0B,0x1E,0x03,0xFF,0x9F,0xFF,0xF9,0xFF,0xC0,0xFF,0xFF,0xFE,0x1F,0xFD,0xFF,
+0x0B,0x0E,0x00,0xFF,0x3F,0xFF,0xF3,0xFF,0x81,0xFF,0xFF,0xFE,0x1F,0xFD,0xFF,0x01,
+0xE7,0x00,0xFE,0xFF,0x06,0xE3,0xFF,0x83,0xEF,0xFF,0xFE,0x3F,0xFD,0xFF,0x0A,0xE7,
+0x80,0x7F,0xFF,0xFF,0xC7,0xFF,0x0F,0xEF,0xFF,0xFE,0xFC,0xFF,0x0A,0xF3,0x80,0x7F,
+0xFF,0xFF,0x0F,0xFE,0x1F,0xCF,0xFF,0xFE,0xFC,0xFF,0x08,0xF9,0xC0,0x7F,0xFF,0xFC,
+0x3F,0xFC,0x7F,0xCF,0xFA,0xFF,0x08,0xF8,0xE0,0x7F,0xFF,0xF1,0xFF,0xF8,0xFF,0xCF,
+0xFA,0xFF,0x08,0xFC,0x70,0x3F,0xFF,0xE7,0xFF,0xF3,0xFF,0xCF,0xF9,0xFF,0x07,0x1E,
+0x3F,0xFF,0xEF,0xFF,0xC7,0xFF,0x9F,0xF9,0xFF,0x01,0x87,0x9F,0xFE,0xFF,0x02,0x9F,
+0xFF,0x1F,0xF9,0xFF,0x01,0x81,0xCF,0xFE,0xFF,0x04,0x3F,0xFC,0x3F,0x7F,0x9F,0xFB,
+0xFF,0x09,0xC0,0xFF,0xFF,0xFC,0x7C,0x7F,0xF8,0x7F,0x7F,0x8F,0xFB,0xFF,0x09,0xE0,
+0x7F,0xFE,0x78,0xF8,0xFF,0xF0,0xFF,0x7F,0x3F,0xFB,0xFF,0x08,0xF0,0x1F,0xF8,0xE1,
+0xF9,0xFF,0xE1,0xFF,0x7F,0xFB,0xFF,0x09,0xFE,0x3E,0x1F,0xE3,0xC3,0xFF,0xFF,0xC3,
+0xFF,0x3F,0xFA,0xFF,0x08,0x1F,0x8F,0x83,0x0F,0xFF,0xFF,0x8F,0xEE,0x7F,0xFA,0xFF,
+0x08,0x03,0xEC,0x00,0x3F,0xFF,0xFE,0x1F,0x80,0x7E,0xFA,0xFF,0x09,0x80,0x3E,0x00,
+0xFF,0xFE,0x18,0x7F,0x00,0xFE,0xF9,0xFB,0xFF,0x09,0x80,0x0F,0xF9,0xFF,0xDE,0x0B,
+0xE0,0x03,0xFD,0xF9,0xFB,0xFF,0x09,0xC0,0x01,0xFF,0xFF,0x38,0x7F,0xC0,0x07,0xF9,
+0xF9,0xFB,0xFF,0x09,0xE0,0x00,0x0F,0xFC,0x70,0xFF,0x80,0x1F,0xF1,0xF3,0xFB,0xFF,
+0x09,0xFE,0x20,0x00,0xE0,0xE3,0xFF,0x00,0x7F,0xE1,0xE3,0xFA,0xFF,0x08,0xFC,0xFF,
+0x83,0xCF,0xFC,0x01,0xFF,0xC1,0xC7,0xF8,0xFF,0x06,0x07,0xBF,0x80,0x07,0xFF,0x81,
+0xC7,0xFB,0xFF,0x09,0xDF,0xFF,0xFC,0x0F,0xFE,0x00,0x1F,0xFF,0x03,0x8F,0xFB,0xFF,
+0x09,0xC3,0xFF,0xE0,0x3F,0xF0,0x00,0x3F,0xFF,0x87,0x9F,0xFB,0xFF,0x08,0xE0,0x00,
+0x00,0xFF,0xE0,0x30,0x7F,0x00,0xBF,0xFA,0xFF,0x09,0xF0,0x00,0x03,0xFF,0x81,0xE0,
+0xFF,0x00,0x1E,0x7F,0xFB,0xFF,0x09,0xF8,0x00,0x0F,0xF8,0x07,0x80,0xFF,0x00,0x00,
+0x7F,0xFB,0xFF,0x08,0xFE,0x0F,0xFF,0xC0,0x0F,0x03,0xFE,0x00,0x00,0xF9,0xFF,0x07,
+0xBF,0xFF,0x80,0x3C,0x07,0xFC,0x00,0x07,0xF8,0xFF,0x06,0x00,0x00,0x78,0x0F,0xF0,
+0x00,0x1F,0xF9,0xFF,0x08,0xC0,0x00,0x03,0xC0,0x1F,0xE0,0x00,0x7F,0xF7,0xFA,0xFF,
+0x08,0xE0,0x00,0x0F,0x00,0x3F,0xC0,0x00,0xFF,0xF7,0xFA,0xFF,0x08,0xE0,0x03,0xF0,
+0x00,0xFF,0x80,0x03,0xFF,0xE7,0xFA,0xFF,0x08,0xF7,0xFF,0xC0,0x01,0xFF,0x00,0x07,
+0xFF,0xE7,0xFA,0xFF,0x08,0xFC,0x00,0x00,0x1F,0xFE,0x03,0xBF,0xFF,0xEF,0xFA,0xFF,
+0x08,0xF8,0x00,0x00,0x7F,0xFC,0x07,0xFF,0xFF,0xEF,0xFA,0xFF,0x08,0xFE,0x00,0xC3,
+0xFF,0xF8,0x3F,0xFF,0xFF,0xEF,0xF9,0xFF,0x07,0xBF,0xFF,0xFF,0xE1,0xFF,0xFF,0x07,
+0xEF,0xF6,0xFF,0x04,0x03,0xFF,0xF8,0x0F,0xCF,0xF7,0xFF,0x05,0xF8,0x07,0xFF,0x1C,
+0x7C,0xCF,0xF7,0xFF,0x05,0xF8,0x07,0xF0,0x31,0xF1,0xEF,0xF9,0xFF,0x07,0xF7,0xFF,
+0xF0,0x07,0x80,0xE3,0xE1,0xEF,0xF9,0xFF,0x07,0xF7,0xFF,0xC0,0x7F,0x03,0x87,0xC3,
+0xEF,0xF9,0xFF,0x07,0xF3,0xFF,0x00,0xFC,0x07,0x0F,0x83,0xEF,0xF9,0xFF,0x07,0xF3,
+0xFE,0x00,0xF8,0x1E,0x1F,0x07,0xEF,0xF9,0xFF,0x06,0xF3,0xFF,0xFF,0xE0,0x3C,0x1E,
+0x07,0xF8,0xFF,0x06,0xF9,0xFF,0xFF,0x00,0x78,0xFC,0x0F,0xF8,0xFF,0x06,0xF9,0xFF,
+0xFC,0x00,0xE1,0xF0,0x1F,0xF8,0xFF,0x06,0xF8,0xFC,0x00,0x01,0xC3,0xE0,0x3F,0xF8,
+0xFF,0x06,0xF8,0x7E,0x00,0x07,0x87,0x80,0x7F,0xF8,0xFF,0x05,0xFC,0x1F,0x00,0x1F,
+0x0F,0x00,0xF7,0xFF,0x06,0xFC,0x0F,0xFF,0xFC,0x3C,0x01,0xFB,0xF7,0xFF,0x05,0x03,
+0xFF,0xF8,0xF0,0x03,0xCF,0xF7,0xFF,0x05,0x81,0xFF,0xFF,0xE0,0x0F,0x9F,0xF7,0xFF,
+0x05,0xC0,0xFF,0xFC,0x00,0x1F,0x3F,0xF7,0xFF,0x05,0xE0,0x3E,0xE0,0x00,0x3C,0x7F,
+0xF7,0xFF,0x04,0xFB,0xFC,0x00,0x01,0xF8,0xF5,0xFF,0x03,0xFC,0x00,0x03,0xF1,0xF5,
+0xFF,0x03,0xFC,0x00,0x07,0xE7,0xF5,0xFF,0x03,0xFC,0x00,0x0F,0x8F,0xF5,0xFF,0x03,
+0xFC,0x00,0x3E,0x3F,0xF5,0xFF,0x03,0xFE,0x00,0xF8,0x7F,0xF5,0xFF,0x04,0xFE,0x07,
+0xF1,0xFF,0xC3,0xF5,0xFF,0x04,0x0F,0xE7,0xFF,0x07,0xDF,0xF6,0xFF,0x04,0x3F,0xCF,
+0xFC,0x1F,0x9F,0xF4,0xFF,0x02,0xF8,0x3F,0x9F,0xF4,0xFF,0x02,0xF0,0x7F,0x3F,0xF6,
+0xFF,0x04,0xFE,0xFF,0xE0,0xFE,0x3F,0xF6,0xFF,0x04,0xFC,0xFF,0x81,0xFE,0x3F,0xF6,
+0xFF,0x04,0xFC,0xFF,0x03,0xFE,0x7F,0xF6,0xFF,0x04,0xFC,0x2E,0x07,0xFE,0x7F,0xF6,
+0xFF,0x04,0xFE,0x00,0x6F,0xFE,0x7F,0xF5,0xFF,0x02,0xC0,0xFF,0xFC,0xF4,0xFF,0x02,
+0xF3,0xFF,0xFC,0xF2,0xFF,0x00,0xF9,0xCE,0xFF,
+};
+
+// second : 4736 bytes, packed 2726
+const unsigned char second_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0x81,0xFF,0xE5,0xFF,0x00,0x87,0xF2,0xFF,0x00,0x03,
+0xF3,0xFF,0x01,0xFE,0x03,0xF3,0xFF,0x01,0xFC,0x03,0xF3,0xFF,0x01,0xF8,0x07,0xF3,
+0xFF,0x02,0xF8,0x07,0x80,0xF4,0xFF,0x03,0xF8,0x0E,0x00,0x7F,0xF5,0xFF,0x03,0xF8,
+0x1C,0x00,0x7F,0xF6,0xFF,0x04,0xF0,0xF8,0x1C,0x00,0x7F,0xF6,0xFF,0x03,0xE0,0x78,
+0x3C,0x03,0xF5,0xFF,0x03,0xE0,0x7C,0x18,0x3F,0xF5,0xFF,0x04,0xE0,0x3C,0x18,0x7F,
+0x1F,0xF6,0xFF,0x04,0xE0,0x3E,0x0C,0x78,0x07,0xF6,0xFF,0x04,0xE0,0x3F,0x0C,0xF0,
+0x07,0xF6,0xFF,0x04,0xF0,0x1F,0x80,0xE0,0x07,0xF6,0xFF,0x04,0xF0,0x0F,0xC0,0x40,
+0x07,0xF6,0xFF,0x04,0xF8,0x03,0xE0,0x01,0xDF,0xF6,0xFF,0x03,0xFC,0x01,0xE0,0x07,
+0xF5,0xFF,0x03,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x02,0x80,0x00,0x1F,0xF4,0xFF,0x02,
+0xE0,0x00,0x0F,0xF3,0xFF,0x01,0xF0,0x03,0xF3,0xFF,0x01,0xF0,0x00,0xF3,0xFF,0x02,
+0xF1,0x00,0x3F,0xF4,0xFF,0x02,0xE1,0x80,0x1F,0xF5,0xFF,0x03,0xC7,0x81,0xC0,0x0F,
+0xF5,0xFF,0x03,0x80,0x03,0xC0,0x03,0xF5,0xFF,0x03,0x80,0x03,0xE0,0x01,0xF5,0xFF,
+0x03,0x80,0x07,0xF0,0x00,0xF5,0xFF,0x04,0xC0,0x0F,0xF8,0x00,0x7F,0xF6,0xFF,0x04,
+0xF0,0x3F,0xF8,0x00,0x3F,0xF4,0xFF,0x02,0xFC,0x00,0x1F,0xF4,0xFF,0x02,0xFC,0x00,
+0x0F,0xF4,0xFF,0x02,0xFE,0x00,0x0F,0xF4,0xFF,0x02,0xFE,0x00,0x0F,0xF3,0xFF,0x01,
+0x00,0x0F,0xF3,0xFF,0x01,0x00,0x0F,0xF3,0xFF,0x01,0x80,0x0F,0xF8,0xFF,0x06,0xF0,
+0xFF,0xFF,0xF0,0xFF,0x80,0x0F,0xF8,0xFF,0x06,0x80,0x3F,0xFF,0x80,0x1F,0x80,0x0F,
+0xFB,0xFF,0x09,0xF8,0x07,0xFE,0x00,0x0F,0xFF,0x00,0x07,0xC0,0x0F,0xFB,0xFF,0x09,
+0xE0,0x03,0xFC,0x00,0x07,0xFC,0x00,0x03,0xC0,0x0F,0xFB,0xFF,0x09,0x80,0x00,0xF8,
+0x00,0x03,0xF8,0x00,0x01,0xC0,0x0F,0xFB,0xFF,0x09,0x00,0x00,0x70,0x00,0x01,0xF0,
+0x00,0x00,0x40,0x0F,0xFC,0xFF,0x0A,0xFE,0x00,0x00,0x20,0x00,0x00,0xE0,0x00,0x00,
+0x60,0x0F,0xFD,0xFF,0x04,0xC7,0xFC,0x00,0x00,0x3F,0xFC,0xFF,0x01,0xE0,0x0F,0xFD,
+0xFF,0x02,0x00,0x7C,0x0F,0xFC,0xFF,0x03,0xC7,0xFF,0xC0,0x0F,0xFE,0xFF,0x04,0xFE,
+0x00,0x19,0xFF,0xE0,0xFA,0x00,0x00,0x0F,0xFE,0xFF,0x03,0xFC,0x00,0x3F,0x80,0xF9,
+0x00,0x00,0x0F,0xFE,0xFF,0x02,0xF8,0x01,0xF8,0xF8,0x00,0x00,0x0F,0xFE,0xFF,0x02,
+0xF8,0x07,0x80,0xF8,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF0,0x3C,0xF7,0x00,0x00,0x0F,
+0xFE,0xFF,0x01,0xF0,0xF0,0xF7,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF1,0xC0,0xFB,0x00,
+0x00,0x07,0xFE,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF7,0xFE,0x00,0x04,0x01,0xFF,0xF0,
+0x00,0x07,0xFE,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xFF,
+0x00,0x0F,0xFE,0x00,0x00,0x0F,0xFE,0xFF,0x03,0xF8,0x00,0x00,0x01,0xFE,0xFF,0x01,
+0x80,0x06,0xFE,0x00,0x00,0x0F,0xFE,0xFF,0x03,0xE0,0x00,0x00,0x07,0xFE,0xFF,0x00,
+0x80,0xFD,0x00,0x00,0x0F,0xFE,0xFF,0x03,0xC0,0x00,0x00,0x1F,0xFE,0xFF,0x00,0x98,
+0xFD,0x00,0x00,0x0F,0xFE,0xFF,0x03,0x80,0x00,0x00,0x7F,0xFE,0xFF,0x00,0xFC,0xFD,
+0x00,0x00,0x0F,0xFE,0xFF,0x02,0x00,0x00,0x01,0xFD,0xFF,0x00,0xFE,0xFD,0x00,0x06,
+0x0F,0xFF,0xFF,0xFE,0x00,0x00,0x07,0xFC,0xFF,0x0A,0x00,0x01,0xF8,0x00,0x0F,0xFF,
+0xFF,0xF8,0x00,0x00,0x0F,0xFC,0xFF,0x0A,0x80,0x01,0xFF,0xC0,0x0F,0xFF,0xFF,0xE0,
+0x00,0x00,0x3F,0xFC,0xFF,0x0A,0x80,0x00,0xFF,0xFE,0x0F,0xFF,0xFF,0xC7,0xF0,0x00,
+0x7F,0xFC,0xFF,0x0A,0x80,0x1C,0x7F,0xFF,0xCF,0xFF,0xC1,0x87,0xF8,0x00,0x7F,0xFC,
+0xFF,0x0A,0x00,0x3C,0x7F,0xFF,0xCF,0xFF,0xE1,0x0F,0xFC,0x00,0x1F,0xFD,0xFF,0x0B,
+0xFC,0x00,0x3C,0x3F,0xFF,0x0F,0xFF,0xE1,0x0E,0x7C,0x00,0x1F,0xFC,0xFF,0x0A,0xC0,
+0x18,0x3F,0xFE,0x0F,0xFF,0xF0,0x08,0x0E,0x00,0x7F,0xFC,0xFF,0x0A,0xE0,0x00,0x1F,
+0xFC,0x0F,0xFF,0xF0,0x0B,0xFE,0x00,0x7F,0xFC,0xFF,0x0A,0xE0,0x00,0x1F,0xF8,0x0F,
+0xFF,0xF0,0x1B,0xFE,0x00,0x3F,0xFC,0xFF,0x0A,0xE0,0x00,0x0F,0xF0,0x0F,0xFF,0xF0,
+0x19,0xFE,0x00,0x30,0xFC,0x00,0x0A,0x30,0x00,0x0F,0xE0,0x0F,0xFF,0xF8,0x1C,0xFE,
+0x00,0x30,0xFC,0x00,0x0A,0x30,0x00,0x07,0xC0,0x0F,0xFF,0xF8,0x1E,0x1E,0x00,0x1F,
+0xFC,0xFF,0x0A,0xF0,0x00,0x07,0x80,0x1F,0xFF,0xF8,0x3F,0x9C,0x00,0x18,0xFC,0x00,
+0x0A,0x30,0x00,0x03,0x00,0x3F,0xFF,0xF8,0x9F,0xF8,0x00,0x1F,0xFC,0xFF,0x00,0xF0,
+0xFE,0x00,0x06,0x7F,0xFF,0xFB,0xCF,0xF0,0x00,0x18,0xFC,0x00,0x0A,0x10,0x00,0x02,
+0x00,0x7F,0xFF,0xFF,0xE1,0xC0,0x00,0x08,0xFC,0x00,0x0A,0x10,0x00,0x07,0x00,0x7F,
+0xFF,0xFF,0xE0,0x00,0x00,0x08,0xFC,0x00,0x06,0x10,0x00,0x0F,0x00,0x7F,0xFF,0x7F,
+0xFE,0x00,0x00,0x0C,0xFC,0x00,0x0A,0x10,0x00,0x3F,0x80,0x7F,0xFC,0x7C,0x70,0x00,
+0x00,0x0F,0xFC,0xFF,0x0A,0xF0,0x00,0x7F,0x80,0x7F,0xF8,0xFC,0xF8,0x00,0x60,0x0C,
+0xFC,0x00,0x0A,0x10,0x00,0xFF,0xC0,0x7F,0xF8,0xF9,0xFC,0x00,0xF0,0x07,0xFC,0xFF,
+0x0A,0xF0,0x01,0xFF,0xC0,0x7F,0xF1,0xF3,0xFE,0x01,0xF0,0x04,0xFC,0x00,0x0A,0x10,
+0x03,0xFF,0xE0,0x3F,0xE1,0xF3,0xFE,0x01,0xF0,0x07,0xFC,0xFF,0x0A,0xF0,0x07,0xFF,
+0xF0,0x3F,0xE3,0xF3,0x0F,0x01,0xF0,0x07,0xFC,0xFF,0x0A,0xF0,0x0F,0xFF,0xF0,0x1F,
+0xE3,0xF6,0x07,0x00,0xF0,0x06,0xFC,0x00,0x0A,0x10,0x1F,0xFF,0xF8,0x0F,0xC3,0xE6,
+0xFF,0x00,0x60,0x07,0xFC,0xFF,0x0A,0xF0,0x03,0xFF,0xF8,0x0F,0xE3,0xE6,0xFF,0x00,
+0x00,0x07,0xFC,0xFF,0x0A,0xF0,0x00,0x3F,0xFC,0x0F,0xFF,0xE6,0x3F,0x00,0x00,0x03,
+0xFC,0xFF,0x0A,0xF0,0x00,0x03,0xFC,0x0F,0xFF,0xE7,0x8F,0x00,0x00,0x02,0xFC,0x00,
+0x0A,0x10,0x00,0x00,0x3E,0x0F,0xFF,0xF7,0xFF,0x00,0x00,0x03,0xFC,0xFF,0x0A,0xF0,
+0x00,0x00,0x02,0x0F,0xFF,0xF3,0xFF,0x40,0x00,0x03,0xFC,0x00,0x00,0x10,0xFE,0x00,
+0x06,0x0F,0xFF,0xF3,0xFE,0x60,0x00,0x03,0xFC,0xFF,0x00,0xF0,0xFE,0x00,0x06,0x0F,
+0xFF,0xF9,0xFE,0x70,0x00,0x03,0xFC,0xFF,0x0A,0xF0,0x10,0x00,0x00,0x0F,0xFF,0xF9,
+0xFC,0xF0,0x00,0x03,0xFC,0xFF,0x0A,0xF0,0x1C,0x00,0x00,0x0F,0xFF,0xFC,0xF9,0xF8,
+0x02,0x03,0xFC,0x00,0x0A,0x10,0x1F,0x00,0x00,0x0F,0xFF,0xFE,0x03,0xF8,0x07,0x03,
+0xFC,0x00,0x0A,0x10,0x1F,0xC0,0x00,0x0F,0xFF,0xFF,0x07,0xF8,0x0F,0x03,0xFC,0xFF,
+0x04,0xF0,0x1F,0xE0,0x00,0x0F,0xFE,0xFF,0x03,0xFC,0x0F,0x03,0x80,0xFD,0x00,0x04,
+0x10,0x1F,0xF8,0x00,0x0F,0xFE,0xFF,0x02,0xFC,0x06,0x01,0xFC,0x00,0x04,0x10,0x1F,
+0xFF,0x00,0x0F,0xFE,0xFF,0x02,0xFC,0x00,0x01,0xFC,0xFF,0x04,0xF0,0x1F,0xFF,0xC0,
+0x0F,0xFE,0xFF,0x02,0xFE,0x00,0x01,0xFC,0x00,0x04,0x10,0x1F,0xFF,0xF0,0x0F,0xFE,
+0xFF,0x02,0xFE,0x00,0x01,0xFC,0xFF,0x04,0xF0,0x1F,0xFF,0xFC,0x0F,0xFE,0xFF,0x02,
+0xFE,0x00,0x01,0xFC,0xFF,0x04,0xF0,0x1F,0xFF,0xFF,0x8F,0xFE,0xFF,0x02,0xFE,0x00,
+0x01,0xFC,0xFF,0x04,0xF0,0x1F,0xFF,0xFF,0xEF,0xFD,0xFF,0x01,0x00,0x01,0xFC,0xFF,
+0x01,0xF0,0x1F,0xFA,0xFF,0x02,0x00,0x01,0x80,0xFD,0x00,0x02,0x10,0x1E,0xFD,0xFB,
+0xFF,0x01,0x00,0x01,0xFC,0xFF,0x02,0xF0,0x1E,0x01,0xFB,0xFF,0x02,0x00,0x01,0x80,
+0xFD,0x00,0x02,0x10,0x1F,0xFD,0xFB,0xFF,0x01,0x00,0x01,0xFC,0xFF,0x01,0xF0,0x1F,
+0xFA,0xFF,0x01,0x80,0x01,0xFC,0xFF,0x01,0xF0,0x1F,0xFA,0xFF,0x02,0x80,0x01,0x80,
+0xFD,0x00,0x01,0x10,0x1F,0xFA,0xFF,0x01,0x80,0x01,0xFC,0xFF,0x03,0xF0,0x1F,0xFF,
+0xFD,0xFC,0xFF,0x02,0x80,0x01,0x80,0xFD,0x00,0x04,0x10,0x3F,0xFF,0xF8,0x0F,0xFD,
+0xFF,0x01,0x80,0x01,0xFC,0xFF,0x04,0xF0,0x3F,0x7D,0xF8,0x1F,0xFD,0xFF,0x01,0xC0,
+0x01,0xFC,0xFF,0x04,0xF0,0x3E,0xF9,0xFE,0x7F,0xFD,0xFF,0x01,0xC0,0x01,0xFC,0xFF,
+0x04,0xF0,0x3E,0xF5,0xFC,0x0F,0xFD,0xFF,0x02,0xC0,0x01,0x80,0xFD,0x00,0x04,0x10,
+0x3E,0xED,0xF8,0x1F,0xFD,0xFF,0x01,0xC0,0x01,0xFC,0xFF,0x04,0xF0,0x3F,0x19,0xFF,
+0x3F,0xFD,0xFF,0x01,0xC0,0x01,0xFC,0xFF,0x03,0xF0,0x3F,0xFF,0xF8,0xFC,0xFF,0x02,
+0xC0,0x01,0x80,0xFD,0x00,0x01,0x10,0x3F,0xFA,0xFF,0x02,0xE0,0x01,0x80,0xFD,0x00,
+0x01,0x10,0x3F,0xFA,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x03,0xF0,0x3F,0xFF,0xFD,0xFC,
+0xFF,0x02,0xE0,0x01,0x80,0xFD,0x00,0x04,0x10,0x3F,0x7D,0xF8,0x0F,0xFD,0xFF,0x02,
+0xE0,0x01,0x80,0xFD,0x00,0x04,0x10,0x3E,0xFD,0xF8,0x1F,0xFD,0xFF,0x01,0xE0,0x01,
+0xFC,0xFF,0x04,0xF0,0x3E,0xDD,0xFE,0x7F,0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x04,
+0xF0,0x3E,0xDD,0xFC,0x0F,0xFD,0xFF,0x02,0xE0,0x01,0x80,0xFD,0x00,0x04,0x10,0x3F,
+0x23,0xF8,0x1F,0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x04,0xF0,0x3F,0xFF,0xFF,0x3F,
+0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x03,0xF0,0x3F,0xFF,0xF8,0xFC,0xFF,0x02,0xF0,
+0x01,0x80,0xFD,0x00,0x01,0x18,0x3F,0xFA,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x01,0xF8,
+0x3F,0xFA,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x02,0xF8,0x3F,0xE7,0xFB,0xFF,0x01,0xF0,
+0x01,0xFC,0xFF,0x03,0xF8,0x3F,0x97,0xFD,0xFC,0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,
+0x04,0x18,0x3F,0x77,0xF8,0x0F,0xFD,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x04,0xF8,0x3E,
+0x01,0xF8,0x1F,0xFD,0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,0x04,0x18,0x3F,0xF7,0xFE,
+0x7F,0xFD,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFC,0x0F,0xFD,0xFF,
+0x02,0xF0,0x01,0x80,0xFD,0x00,0x04,0x18,0x3F,0xFF,0xF8,0x1F,0xFD,0xFF,0x01,0xF0,
+0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFF,0x3F,0xFD,0xFF,0x02,0xF0,0x01,0x80,0xFD,
+0x00,0x03,0x18,0x3F,0xFF,0xF8,0xFC,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x02,0xF8,0x3F,
+0xFD,0xFB,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x02,0xF8,0x3F,0x3D,0xFB,0xFF,0x01,0xF0,
+0x01,0xFC,0xFF,0x04,0xF8,0x3E,0xBD,0xFF,0xCF,0xFD,0xFF,0x01,0xF0,0x01,0xFC,0xFF,
+0x04,0xF8,0x3E,0xDD,0xFF,0xCF,0xFD,0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,0x02,0x18,
+0x3E,0xE3,0xFB,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x01,0xF8,0x3F,0xFA,0xFF,0x01,0xF0,
+0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFF,0xF3,0xFD,0xFF,0x01,0xF0,0x01,0xFC,0xFF,
+0x04,0xF8,0x3F,0xFF,0xFC,0x4D,0xFD,0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,0x04,0x18,
+0x3F,0xFF,0xF8,0x2D,0xFD,0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,0x04,0x18,0x3F,0xC3,
+0xF9,0xA5,0xFD,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0x2D,0xFB,0x21,0xFD,
+0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,0x04,0x18,0x3F,0x5D,0xF8,0x33,0xFD,0xFF,0x02,
+0xF0,0x01,0x80,0xFD,0x00,0x04,0x18,0x3E,0xDD,0xF8,0x7F,0xFD,0xFF,0x01,0xF0,0x01,
+0xFC,0xFF,0x03,0xF8,0x3E,0xE3,0xFB,0xFC,0xFF,0x02,0xF0,0x01,0x80,0xFD,0x00,0x01,
+0x18,0x3F,0xFA,0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFF,0x1F,0xFD,
+0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFC,0x0F,0xFD,0xFF,0x01,0xF0,
+0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xF8,0xEF,0xFD,0xFF,0x01,0xF0,0x01,0xFC,0xFF,
+0x04,0xF8,0x3F,0x7F,0xFB,0xCF,0xFD,0xFF,0x02,0xE0,0x01,0x80,0xFD,0x00,0x04,0x18,
+0x3E,0xFF,0xF8,0x1F,0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x04,0xF8,0x3E,0xF9,0xF8,
+0x7F,0xFD,0xFF,0x02,0xE0,0x01,0x80,0xFD,0x00,0x02,0x18,0x3E,0xC7,0xFB,0xFF,0x01,
+0xE0,0x01,0xFC,0xFF,0x02,0xF8,0x3E,0x3F,0xFB,0xFF,0x02,0xE0,0x01,0x80,0xFD,0x00,
+0x01,0x18,0x3F,0xFA,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFF,0x1F,
+0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xFC,0x0F,0xFD,0xFF,0x01,
+0xE0,0x01,0xFC,0xFF,0x04,0xF8,0x3F,0xFF,0xF8,0xEF,0xFD,0xFF,0x01,0xE0,0x01,0xFC,
+0x00,0x04,0x18,0x3F,0x33,0xFB,0xCF,0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x04,0xF8,
+0x3E,0xCD,0xF8,0x1F,0xFD,0xFF,0x01,0xE0,0x01,0xFC,0x00,0x04,0x18,0x3E,0xDD,0xF8,
+0x7F,0xFD,0xFF,0x01,0xE0,0x01,0xFC,0xFF,0x02,0xF8,0x3E,0xCD,0xFB,0xFF,0x01,0xE0,
+0x01,0xFC,0xFF,0x02,0xF8,0x1F,0x33,0xFB,0xFF,0x01,0xE0,0x01,0xFC,0x00,0x01,0x18,
+0x1F,0xFA,0xFF,0x01,0xC0,0x01,0xFC,0xFF,0x04,0xF8,0x1F,0xFF,0xFF,0x0F,0xFD,0xFF,
+0x01,0xC0,0x01,0xFC,0x00,0x04,0x18,0x1F,0xFF,0xFC,0x0F,0xFD,0xFF,0x01,0xC0,0x03,
+0xFC,0x00,0x04,0x18,0x1F,0xFF,0xF8,0xEF,0xFD,0xFF,0x01,0xC0,0x03,0xFC,0xFF,0x04,
+0xF8,0x1F,0x1D,0xDB,0x0F,0xFD,0xFF,0x01,0xC0,0x03,0xFC,0xFF,0x04,0xF8,0x1E,0xED,
+0xC0,0x0F,0xFD,0xFF,0x01,0xC0,0x03,0xFC,0x00,0x04,0x18,0x1E,0xEB,0xC0,0xEF,0xFD,
+0xFF,0x01,0xC0,0x03,0xFC,0x00,0x04,0x18,0x1E,0xE3,0xDF,0xDF,0xFD,0xFF,0x01,0xC0,
+0x03,0xFC,0xFF,0x02,0xF8,0x1F,0x0F,0xFB,0xFF,0x01,0xC0,0x03,0xFC,0xFF,0x04,0xF8,
+0x1F,0xFF,0xFE,0x7F,0xFD,0xFF,0x01,0xC0,0x03,0xFC,0x00,0x04,0x18,0x1F,0xFF,0xFE,
+0x7F,0xFD,0xFF,0x01,0xC0,0x03,0xFC,0x00,0x04,0x18,0x1F,0xFF,0xFE,0x7F,0xFD,0xFF,
+0x01,0xC0,0x03,0xFC,0xFF,0x04,0xF8,0x1F,0xFF,0xFE,0x7F,0xFD,0xFF,0x01,0x80,0x03,
+0xFC,0x00,0x02,0x18,0x1F,0x03,0xFB,0xFF,0x01,0x80,0x03,0xFC,0xFF,0x02,0xF8,0x1E,
+0xFD,0xFB,0xFF,0x01,0x80,0x03,0xFC,0x00,0x04,0x18,0x1E,0xFD,0xFF,0x0F,0xFD,0xFF,
+0x01,0x80,0x03,0xFC,0x00,0x04,0x18,0x1E,0xFD,0xFC,0x0F,0xFE,0xFF,0x02,0xF0,0x00,
+0x03,0xFC,0x00,0x04,0x18,0x1F,0x03,0xF8,0xEF,0xFE,0xFF,0x02,0x80,0x00,0x03,0xFC,
+0xFF,0x0A,0xF8,0x1F,0xFF,0xDB,0x0F,0xFF,0xFF,0xFE,0x00,0x00,0x03,0xFC,0x00,0x0A,
+0x18,0x1F,0xFF,0xC0,0x0F,0xFF,0xFF,0xF8,0x00,0x00,0x03,0xFC,0xFF,0x0A,0xF8,0x1F,
+0xFF,0xC0,0xEF,0xFF,0xFF,0xF0,0x03,0xF8,0x03,0xFC,0x00,0x0A,0x18,0x1F,0xFF,0xDF,
+0xDF,0xFF,0xFF,0xE0,0x07,0xFC,0x03,0xFC,0xFF,0x01,0xF8,0x1F,0xFC,0xFF,0x03,0xE0,
+0x03,0xFC,0x03,0xFC,0x00,0x0A,0xF0,0x1F,0xFF,0xFB,0x8F,0xFF,0xFF,0xF0,0x01,0xFC,
+0x02,0xFD,0x00,0x0B,0x01,0xC0,0x1F,0xFF,0xF8,0x0F,0xFF,0xFF,0xF8,0x00,0x00,0x02,
+0xFD,0x00,0x05,0x03,0x80,0x0F,0xFF,0x98,0x6F,0xFE,0xFF,0x02,0x00,0x00,0x02,0xFD,
+0x00,0x05,0x06,0x00,0x07,0xFF,0x9F,0xDF,0xFE,0xFF,0x02,0xFC,0x00,0x03,0xFD,0xFF,
+0x02,0xFC,0x00,0x03,0xFA,0xFF,0x01,0x80,0x02,0xFD,0x00,0x05,0x38,0x00,0x00,0xF1,
+0xFF,0xCF,0xFE,0xFF,0x02,0xFC,0x00,0x02,0xFD,0x00,0x05,0x60,0x00,0x00,0x03,0xFC,
+0xEF,0xFE,0xFF,0x02,0xF0,0x00,0x07,0xFD,0xFF,0x05,0xC0,0x00,0x00,0x07,0xF8,0x6F,
+0xFE,0xFF,0x02,0x80,0x00,0x07,0xFD,0xFF,0x05,0xC0,0x00,0x00,0x0F,0xFA,0x0F,0xFE,
+0xFF,0x02,0x00,0x3C,0x07,0xFD,0xFF,0x0B,0x80,0x00,0x40,0x1F,0xFB,0x9F,0xFF,0xFF,
+0xFE,0x00,0xFE,0x07,0xFD,0xFF,0x04,0x80,0x01,0xE0,0x3F,0xF9,0xFE,0xFF,0x03,0xFE,
+0x00,0xFC,0x07,0xFD,0xFF,0x02,0xC0,0x0F,0xF8,0xFB,0xFF,0x02,0x00,0x00,0x07,0xF8,
+0xFF,0x00,0xFD,0xFE,0xFF,0x02,0xF0,0x00,0x07,0xF9,0xFF,0x01,0xFB,0x81,0xFC,0xFF,
+0x00,0x07,0xF9,0xFF,0x01,0xF8,0x05,0xF3,0xFF,0x01,0xF8,0x2D,0xF3,0xFF,0x01,0xFD,
+0xCF,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,0x01,0xF8,0x3F,0xD2,0xFF,0x00,0x8F,0xF3,
+0xFF,0x01,0xD8,0x0F,0xF3,0xFF,0x01,0xC0,0x1F,0xF3,0xFF,0x00,0xC7,0xD1,0xFF,0x00,
+0x0F,0xF3,0xFF,0x01,0xFC,0x0F,0xF3,0xFF,0x01,0xF9,0xEF,0xF3,0xFF,0x01,0xFB,0x0F,
+0xF3,0xFF,0x01,0xF8,0x0F,0xF3,0xFF,0x01,0xF8,0x5F,0xE2,0xFF,0x00,0xF9,0xF3,0xFF,
+0x01,0xFD,0xFD,0xF3,0xFF,0x01,0xF8,0x03,0xF3,0xFF,0x01,0xFC,0x0F,0xF2,0xFF,0x00,
+0xDF,0xF3,0xFF,0x01,0xF8,0x3F,0xC2,0xFF,0x00,0xCF,0xF2,0xFF,0x00,0xCF,0xD2,0xFF,
+0x00,0x1F,0xF3,0xFF,0x01,0xFC,0x0F,0xF3,0xFF,0x01,0xF9,0xEF,0xF3,0xFF,0x01,0xFB,
+0xEF,0xF3,0xFF,0x01,0xF9,0xDF,0xC2,0xFF,0x00,0x1F,0xF3,0xFF,0x01,0xFC,0x0F,0xF3,
+0xFF,0x01,0xF8,0xEF,0xF3,0xFF,0x01,0xFB,0xCF,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,
+0x01,0xF8,0x7F,0xC3,0xFF,0x01,0xFB,0x8F,0xF3,0xFF,0x01,0xF8,0x0F,0xF3,0xFF,0x01,
+0xF8,0x7F,0xF3,0xFF,0x01,0xFE,0x8F,0xF3,0xFF,0x01,0xF8,0x0F,0xF3,0xFF,0x01,0xF8,
+0x7F,0xF3,0xFF,0x01,0xFE,0x8F,0xF3,0xFF,0x01,0xF8,0x0F,0xF3,0xFF,0x01,0xF8,0x6F,
+0xF2,0xFF,0x00,0xDF,0x81,0xFF,
+};
+
+// third : 4736 bytes, packed 3075
+const unsigned char third_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0xC9,0xFF,0x02,0xFE,0x00,0x00,0xF4,0xFF,0xFE,0x00,
+0xF5,0xFF,0x03,0xE0,0x00,0x00,0x0F,0xF6,0xFF,0x00,0xFE,0xFE,0x00,0x00,0x3F,0xF6,
+0xFF,0x03,0xF0,0x00,0x00,0x01,0xF5,0xFF,0x00,0x80,0xFD,0x00,0x03,0x3F,0xFF,0xFF,
+0xFE,0xFB,0xFF,0x00,0xFC,0xFB,0x00,0x03,0xFF,0xFF,0xFD,0xBF,0xFC,0xFF,0x02,0xF0,
+0x00,0x0F,0xFD,0xFF,0x03,0x03,0xFF,0xF8,0x7F,0xFC,0xFF,0x01,0xC0,0x07,0xFC,0xFF,
+0x02,0xFC,0x3F,0xE0,0xFB,0xFF,0x01,0x00,0x7F,0xFB,0xFF,0x02,0xC3,0xE0,0x3F,0xFD,
+0xFF,0x01,0xFC,0x07,0xFA,0xFF,0x01,0xFC,0x00,0xFC,0xFF,0x01,0xF8,0x3F,0xF9,0xFF,
+0x01,0x00,0x1F,0xFD,0xFF,0x00,0xE0,0xF8,0xFF,0x01,0x80,0x7F,0xFD,0xFF,0x00,0xC3,
+0xF8,0xFF,0x00,0x80,0xFC,0xFF,0x00,0x87,0xF8,0xFF,0x01,0xC0,0xBF,0xFD,0xFF,0x00,
+0x0F,0xF8,0xFF,0x01,0xC0,0x7F,0xFE,0xFF,0x01,0xFE,0x1F,0xF8,0xFF,0x00,0xC1,0xFD,
+0xFF,0x01,0xFC,0x3F,0xF9,0xFF,0x01,0xE0,0x03,0xFD,0xFF,0x01,0xF8,0x7F,0xF9,0xFF,
+0x00,0x1F,0xFC,0xFF,0x00,0xF0,0xF9,0xFF,0x00,0xFE,0xFB,0xFF,0x00,0xE0,0xF9,0xFF,
+0x00,0xFD,0xFB,0xFF,0x00,0xC1,0xF9,0xFF,0x00,0xFD,0xFB,0xFF,0x00,0x83,0xF9,0xFF,
+0x00,0xFB,0xFB,0xFF,0x00,0x03,0xF9,0xFF,0x00,0xFB,0xFC,0xFF,0x01,0xFE,0x07,0xF9,
+0xFF,0x00,0xFB,0xFC,0xFF,0x01,0xFC,0x0F,0xF9,0xFF,0x00,0xFB,0xFC,0xFF,0x01,0xF8,
+0x0F,0xF9,0xFF,0x00,0xFB,0xFC,0xFF,0x01,0xE0,0x1F,0xF9,0xFF,0x00,0xFB,0xFC,0xFF,
+0x01,0x80,0x3F,0xF9,0xFF,0x07,0xFD,0xFF,0xFC,0xFF,0xFF,0xFE,0x7C,0x7F,0xF9,0xFF,
+0x07,0xFD,0xFF,0xF9,0xFF,0xFF,0xF9,0x80,0x1F,0xF9,0xFF,0x07,0xFD,0xFF,0xF2,0x3F,
+0xFF,0xF6,0x00,0x1F,0xF9,0xFF,0x07,0xFE,0xFF,0xE4,0x7F,0xFF,0xE0,0x00,0x0F,0xF9,
+0xFF,0x07,0xFE,0xFF,0xC0,0x7F,0xFF,0xC0,0x00,0x0F,0xF8,0xFF,0x06,0x7F,0x80,0x1F,
+0xFF,0x80,0x00,0x0F,0xF8,0xFF,0x07,0xBF,0x00,0x1F,0xFF,0x00,0x00,0x18,0x3F,0xF9,
+0xFF,0x07,0xCE,0x00,0x1F,0xFE,0x00,0x00,0x10,0x1F,0xF9,0xFF,0x03,0xF0,0x00,0x3F,
+0xFE,0xFE,0x00,0x00,0x0F,0xF9,0xFF,0x03,0xFE,0x00,0x1F,0xFC,0xFE,0x00,0x00,0x07,
+0xF9,0xFF,0x03,0xFE,0x00,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFF,0x02,0x00,0x7F,
+0xFC,0xFE,0x00,0x00,0x03,0xF8,0xFF,0x06,0x00,0xFF,0xF8,0x00,0x03,0xFF,0x01,0xF8,
+0xFF,0x06,0xC1,0xFF,0xF8,0x00,0x0F,0xFF,0xC1,0xF8,0xFF,0x06,0xE7,0xFF,0xF8,0x00,
+0x1F,0xFF,0xE0,0xF8,0xFF,0x06,0xCF,0xFF,0xF8,0x00,0x3F,0xFF,0xF0,0xF9,0xFF,0x08,
+0xFE,0x1F,0xFF,0xF8,0x00,0x7F,0xFF,0xF8,0x7F,0xFA,0xFF,0x08,0xF1,0xFF,0xFF,0xFC,
+0x60,0x7F,0xFF,0xFC,0x07,0xFA,0xFF,0x09,0xCF,0xFF,0xFF,0xFC,0x60,0xFF,0xFF,0xFE,
+0x00,0x3F,0xFC,0xFF,0x08,0xFE,0x3F,0xFF,0xFF,0xFC,0xE1,0xFF,0xFF,0xF6,0xFA,0x00,
+0x00,0x01,0xFE,0xFF,0x04,0xFC,0xE3,0xFF,0xFF,0xF7,0xFA,0x00,0x00,0x1F,0xFE,0xFF,
+0x05,0xFC,0xE3,0xFF,0xFF,0xE7,0xC0,0xFD,0x00,0x00,0x03,0xFC,0xFF,0x05,0xFC,0xE7,
+0xFF,0xFF,0xE7,0xF0,0xFC,0x00,0x01,0x3F,0xDF,0xFE,0xFF,0x05,0xFC,0xC7,0xFF,0xFF,
+0xE7,0xFE,0xFC,0x00,0x01,0x07,0xDF,0xFE,0xFF,0x06,0xFC,0xCF,0xFF,0xFF,0xE7,0xFF,
+0x80,0xFD,0x00,0x01,0x01,0xCF,0xFE,0xFF,0x07,0xFD,0x9F,0xFF,0xFF,0xEB,0xFF,0xF7,
+0x80,0xFE,0x00,0x01,0x03,0xCF,0xFE,0xFF,0x0C,0xFD,0xBF,0xFF,0xFF,0xEB,0xFF,0xCF,
+0xFF,0xF0,0x00,0x00,0x07,0x8F,0xFE,0xFF,0x06,0xFD,0xBF,0xFF,0xFF,0xED,0xFF,0xBF,
+0xFD,0xFF,0x01,0xFB,0x9F,0xFE,0xFF,0x06,0xFC,0x7F,0xFF,0xFF,0xC5,0xFF,0x7F,0xFD,
+0xFF,0x01,0xFC,0x1F,0xFE,0xFF,0x05,0xFC,0x7F,0xFF,0xFF,0xC4,0xFE,0xFC,0xFF,0x01,
+0xFE,0x1F,0xFE,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xC0,0xFD,0xFC,0xFF,0x01,0xFE,0x3F,
+0xFE,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xC0,0x03,0xFC,0xFF,0x00,0xF0,0xFD,0xFF,0x00,
+0xFC,0xFE,0xFF,0x02,0xC0,0x06,0x7F,0xFD,0xFF,0x00,0xF7,0xFD,0xFF,0x00,0xFD,0xFE,
+0xFF,0x02,0xC0,0x04,0x0F,0xFD,0xFF,0x00,0xF3,0xFD,0xFF,0x00,0xFD,0xFE,0xFF,0x02,
+0xC0,0x08,0x03,0xFD,0xFF,0x00,0xFC,0xFD,0xFF,0x00,0xFD,0xFE,0xFF,0x02,0xE0,0x08,
+0x01,0xFD,0xFF,0x01,0xFE,0x7F,0xFE,0xFF,0x00,0xFD,0xFE,0xFF,0x02,0xF0,0xF8,0x00,
+0xFC,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xFD,0xFE,0xFF,0x03,0xF8,0xF0,0x00,0x7F,0xFD,
+0xFF,0x00,0x0F,0xFA,0xFF,0x03,0xFC,0xF0,0x00,0x3F,0xFD,0xFF,0x00,0x07,0xFA,0xFF,
+0x00,0xFE,0xFE,0x00,0x04,0x1F,0xFF,0xFF,0xFE,0x0F,0xF8,0xFF,0x06,0xE0,0x00,0x00,
+0x01,0xFF,0xF9,0xEF,0xF8,0xFF,0x00,0xF0,0xFD,0x00,0x01,0x07,0xE7,0xF8,0xFF,0x00,
+0xFC,0xFE,0x00,0x02,0x01,0xFF,0xE7,0xF8,0xFF,0x00,0xFE,0xFD,0x00,0x01,0xFF,0xF7,
+0xF7,0xFF,0x00,0x80,0xFE,0x00,0xF5,0xFF,0x03,0xC0,0x00,0x00,0x01,0xFA,0xFF,0x00,
+0xFD,0xFD,0xFF,0x03,0xF0,0x00,0x00,0x01,0xFA,0xFF,0x00,0xFD,0xFD,0xFF,0x04,0xFE,
+0x00,0x3F,0xFC,0x3F,0xFB,0xFF,0x00,0xFD,0xFC,0xFF,0x03,0x07,0xFF,0xFF,0x83,0xFB,
+0xFF,0x00,0xFC,0xFD,0xFF,0x06,0xFE,0x3F,0xFF,0xFF,0xF8,0x7F,0xFD,0xFD,0xFF,0x01,
+0xFC,0x7F,0xFE,0xFF,0x00,0xF1,0xFD,0xFF,0x01,0x07,0xF9,0xFD,0xFF,0x05,0xFD,0x7F,
+0xFF,0xFF,0x7F,0x8F,0xFD,0xFF,0x01,0xF0,0xF0,0xFC,0xFF,0x04,0xBF,0xFF,0xFF,0x7E,
+0x3F,0xFD,0xFF,0x01,0xFE,0x21,0xFD,0xFF,0x04,0xFE,0xDF,0xFF,0xFF,0xB9,0xFB,0xFF,
+0x00,0x81,0xFD,0xFF,0x04,0xFE,0xCF,0xFF,0xFF,0x87,0xFB,0xFF,0x00,0x81,0xFD,0xFF,
+0x04,0xFE,0x67,0xFF,0xFF,0x3F,0xFB,0xFF,0x00,0x81,0xFC,0xFF,0x02,0x43,0xFF,0xFC,
+0xFB,0xFF,0x01,0xFE,0x31,0xFC,0xFF,0x02,0x00,0xFF,0xE3,0xFB,0xFF,0x00,0xF8,0xFB,
+0xFF,0x02,0x00,0x3F,0x1F,0xFB,0xFF,0x00,0xF3,0xFB,0xFF,0x01,0x00,0x00,0xFA,0xFF,
+0x00,0xF7,0xFB,0xFF,0x01,0x00,0x0F,0xFA,0xFF,0x00,0xF3,0xFB,0xFF,0x01,0x00,0x0F,
+0xFA,0xFF,0x00,0xFB,0xFB,0xFF,0x02,0x00,0x0C,0x3F,0xFB,0xFF,0x00,0xFB,0xFB,0xFF,
+0x02,0x80,0x00,0x3F,0xFB,0xFF,0x00,0xFB,0xFB,0xFF,0x02,0x80,0x10,0x1F,0xFB,0xFF,
+0x01,0xF9,0xFE,0xFC,0xFF,0x02,0xC0,0x30,0x1F,0xFB,0xFF,0x01,0xFC,0x3C,0xFC,0xFF,
+0x02,0xE1,0xE0,0x0F,0xFB,0xFF,0x02,0xFE,0x00,0x3F,0xFD,0xFF,0x02,0xFB,0xC0,0x07,
+0xFA,0xFF,0x01,0x00,0x3F,0xFC,0xFF,0x01,0xE7,0x03,0xFA,0xFF,0x01,0x00,0x3F,0xFC,
+0xFF,0x01,0xF7,0xC1,0xFB,0xFF,0x02,0xFE,0x00,0x7F,0xFC,0xFF,0x01,0xF7,0xF0,0xFB,
+0xFF,0x02,0xF9,0xFE,0x7F,0xFC,0xFF,0x02,0xF3,0xF8,0x3F,0xFC,0xFF,0x00,0xE7,0xFA,
+0xFF,0x02,0xF7,0xFE,0x0F,0xFC,0xFF,0x00,0x1F,0xFA,0xFF,0x02,0xF1,0xFF,0x07,0xFD,
+0xFF,0x00,0xFC,0xF9,0xFF,0x02,0xF0,0x7F,0x80,0xFD,0xFF,0x00,0xC3,0xF9,0xFF,0x07,
+0xF0,0x0F,0xC0,0x0F,0xFF,0xFF,0xFC,0x1F,0xF9,0xFF,0x02,0xF0,0x1E,0x60,0xFE,0x00,
+0x00,0x03,0xF8,0xFF,0x02,0xF0,0x18,0x18,0xFE,0x00,0x00,0x01,0xF8,0xFF,0x02,0xF0,
+0x18,0x0E,0xFD,0x00,0x00,0x1F,0xF9,0xFF,0x03,0xF0,0x30,0x07,0x80,0xFE,0x00,0x00,
+0x07,0xF9,0xFF,0x03,0xFB,0xE0,0x07,0xE0,0xFE,0x00,0x00,0x03,0xF9,0xFF,0x03,0xFD,
+0xE0,0x01,0xFE,0xFE,0x00,0x00,0x03,0xF9,0xFF,0x0A,0xFE,0xC0,0x00,0x7F,0xF0,0x00,
+0x00,0x07,0xFF,0xFF,0x9F,0xFB,0xFF,0x09,0xFE,0x00,0x1F,0xFF,0x00,0x00,0x0F,0xFF,
+0xFF,0xC3,0xFA,0xFF,0x08,0x80,0x0F,0xFF,0xF0,0x00,0x0F,0xFF,0xFF,0xF8,0xFB,0xFF,
+0x09,0xF7,0xE0,0x00,0x3F,0xFE,0x00,0x3F,0xFF,0xFF,0xC3,0xFB,0xFF,0x04,0xF3,0xF0,
+0x00,0x00,0xF9,0xFD,0xFF,0x00,0x9F,0xFB,0xFF,0x04,0xE3,0xF8,0x00,0x00,0x07,0xFD,
+0xFF,0x00,0xE1,0xFB,0xFF,0x04,0xED,0xFE,0x00,0x00,0x01,0xFD,0xFF,0x00,0xFC,0xFB,
+0xFF,0x04,0xCE,0x7F,0xC0,0x00,0x00,0xFD,0xFF,0x00,0xE3,0xFB,0xFF,0x04,0xE4,0x3F,
+0xFC,0x00,0x7F,0xFD,0xFF,0x00,0x9F,0xFB,0xFF,0x03,0xF0,0x3F,0xFF,0xF9,0xF4,0xFF,
+0x02,0x9F,0xFF,0xFB,0xFC,0xFF,0x00,0x9F,0xFA,0xFF,0x02,0xCF,0xFF,0xFD,0xFC,0xFF,
+0x00,0xC3,0xFA,0xFF,0x03,0xE7,0xFF,0xFE,0x3F,0xFD,0xFF,0x00,0xF8,0xFA,0xFF,0x03,
+0xF0,0x7F,0xFC,0x3F,0xFD,0xFF,0x00,0xC3,0xFA,0xFF,0x02,0xF8,0x07,0xE1,0xFC,0xFF,
+0x00,0x9F,0xFA,0xFF,0x02,0xFE,0x00,0x1F,0xFC,0xFF,0x00,0xE1,0xF9,0xFF,0x01,0xF0,
+0x0F,0xFC,0xFF,0x00,0xFC,0xF8,0xFF,0x00,0xCF,0xFC,0xFF,0x00,0xE3,0xF2,0xFF,0x00,
+0x9F,0xD2,0xFF,0x00,0x9F,0xF2,0xFF,0x00,0xC3,0xFB,0xFF,0x01,0xF8,0x07,0xFA,0xFF,
+0x00,0xF8,0xFB,0xFF,0x02,0xC7,0xF0,0x3F,0xFB,0xFF,0x00,0xC3,0xFE,0xFF,0x05,0xFB,
+0xFF,0xFF,0x3F,0xFF,0xC7,0xFB,0xFF,0x00,0x9F,0xFE,0xFF,0x05,0xFB,0xFC,0x1C,0xFF,
+0xFF,0xF8,0xFB,0xFF,0x00,0xE1,0xFE,0xFF,0x02,0xFB,0xF8,0x03,0xFE,0xFF,0x00,0x1F,
+0xFC,0xFF,0x00,0xFC,0xFE,0xFF,0x02,0xF3,0xF0,0x03,0xFE,0xFF,0x00,0xE3,0xFC,0xFF,
+0x00,0xE3,0xFE,0xFF,0x06,0xF3,0xF1,0x04,0x1F,0xFF,0xFF,0xFC,0xFC,0xFF,0x00,0x9F,
+0xFE,0xFF,0x03,0xF3,0xF0,0x08,0x0F,0xFE,0xFF,0x00,0x3F,0xF9,0xFF,0x03,0xF7,0xF0,
+0x00,0x07,0xFE,0xFF,0x00,0xCF,0xF9,0xFF,0x03,0xF7,0xF8,0x00,0x07,0xFE,0xFF,0x01,
+0xF6,0x00,0xFE,0xFF,0x00,0xFC,0xFE,0xFF,0x0C,0xF7,0xFF,0xFE,0x03,0xFF,0xFE,0x03,
+0xF0,0x00,0x7F,0xFF,0xFF,0xFC,0xFE,0xFF,0x08,0xF7,0xFF,0xFF,0x03,0xFF,0x01,0xFC,
+0x00,0x00,0xFA,0xFF,0x04,0xF7,0xFF,0xFF,0x83,0xF0,0xFE,0xFF,0x00,0x01,0xFA,0xFF,
+0x04,0xF7,0xFF,0xFF,0xC1,0xCF,0xFE,0xFF,0x00,0xE3,0xFA,0xFF,0x04,0xF3,0xFF,0xFF,
+0xE0,0x3F,0xFE,0xFF,0x0B,0xFC,0x7F,0xFF,0xFF,0xC1,0xBF,0xFF,0xFF,0xF3,0xFF,0xFF,
+0xF3,0xFC,0xFF,0x0A,0x9F,0xFF,0xFF,0x9C,0xDF,0xFF,0xFF,0xF2,0xFF,0xFF,0xE7,0xFC,
+0xFF,0x0A,0xE7,0xFF,0xFF,0xBE,0xDF,0xFF,0xFF,0xE0,0x7F,0xFF,0x1F,0xFC,0xFF,0x09,
+0xF3,0xFF,0xFF,0xBE,0xDF,0xFF,0xFF,0xE0,0x3F,0xF8,0xFB,0xFF,0x09,0xFC,0xFF,0xFF,
+0xDD,0xBF,0xFF,0xFF,0xE0,0x1F,0x07,0xFA,0xFF,0x07,0x7C,0xFF,0x80,0x7F,0xFF,0xFF,
+0xE0,0x00,0xF9,0xFF,0x00,0xB8,0xFC,0xFF,0x01,0xE0,0x0F,0xF9,0xFF,0x00,0xC0,0xFC,
+0xFF,0x01,0xE0,0x0F,0xF9,0xFF,0x00,0xC0,0xFC,0xFF,0x02,0xE0,0x10,0x3F,0xFA,0xFF,
+0x02,0xC0,0xFF,0xC1,0xFE,0xFF,0x02,0xE7,0xE0,0x0F,0xFA,0xFF,0x02,0xC0,0xFF,0x9C,
+0xFE,0xFF,0x02,0xE7,0xC0,0x01,0xFB,0xFF,0x03,0xFE,0x3F,0xFF,0xBE,0xFE,0xFF,0x02,
+0xF3,0xC0,0x00,0xFB,0xFF,0x03,0xFD,0xFF,0xFF,0xBE,0xFE,0xFF,0x03,0xF8,0x00,0x00,
+0x7F,0xFC,0xFF,0x03,0xFD,0xFF,0xBF,0x9C,0xFD,0xFF,0x02,0x80,0x00,0x1F,0xFC,0xFF,
+0x03,0xFD,0xFF,0x3F,0xC1,0xFD,0xFF,0x02,0xFC,0x00,0x07,0xFC,0xFF,0x02,0xF9,0xFE,
+0x7F,0xFC,0xFF,0x02,0xFC,0x00,0x01,0xFC,0xFF,0x02,0xFE,0x78,0x5F,0xFC,0xFF,0x02,
+0xF9,0xE0,0x01,0xFB,0xFF,0x01,0x70,0x3F,0xFC,0xFF,0x02,0xFB,0xF0,0x00,0xFB,0xFF,
+0x01,0x00,0x7F,0xFC,0xFF,0x03,0xF7,0xF8,0x00,0x3F,0xFC,0xFF,0x02,0x00,0x1F,0xC1,
+0xFC,0xFF,0x03,0xFC,0x00,0x00,0x3F,0xFD,0xFF,0x02,0x00,0xFF,0x9C,0xFC,0xFF,0x00,
+0xFE,0xFE,0x00,0x00,0x7F,0xFE,0xFF,0x02,0x00,0xFF,0xBE,0xFC,0xFF,0x00,0xBF,0xFE,
+0x00,0x06,0x01,0xFF,0xFF,0xFE,0x00,0x3F,0xBE,0xFC,0xFF,0x01,0xBF,0x80,0xFE,0x00,
+0x05,0x0F,0xFF,0xE0,0xF8,0xFF,0x9C,0xFC,0xFF,0x01,0xBF,0xC0,0xFD,0x00,0x04,0x7E,
+0x1F,0xFF,0xFF,0xC1,0xFC,0xFF,0x01,0x9F,0xE0,0xFD,0x00,0x00,0x01,0xF8,0xFF,0x01,
+0x83,0xE0,0xFC,0x00,0xF8,0xFF,0x00,0x82,0xFB,0x00,0x00,0x1F,0xF9,0xFF,0x00,0x9C,
+0xFB,0x00,0x03,0x07,0xFF,0xFF,0xC1,0xFC,0xFF,0x00,0xD8,0xFB,0x00,0x03,0x01,0xFF,
+0xFF,0x9C,0xFC,0xFF,0x00,0xD0,0xFB,0x00,0x03,0x01,0xFF,0xFF,0xBE,0xFC,0xFF,0x02,
+0xFC,0x00,0x1C,0xFD,0x00,0x03,0x03,0xFF,0xFF,0xBE,0xFC,0xFF,0x03,0xF9,0xC0,0x07,
+0xF8,0xFE,0x00,0x03,0x07,0xFF,0xFF,0x9D,0xFC,0xFF,0x0A,0xC3,0xE0,0x01,0xFF,0xEC,
+0x00,0x00,0x3F,0xFF,0xFC,0x00,0xFC,0xFF,0x04,0xC6,0x20,0x00,0xFF,0x0F,0xF6,0xFF,
+0x04,0xC4,0x03,0x80,0x3C,0x1F,0xF6,0xFF,0x04,0xF0,0x01,0xE0,0x03,0xDF,0xF5,0xFF,
+0x02,0xE0,0x60,0x0F,0xF4,0xFF,0x02,0xE4,0x3E,0x07,0xFB,0xFF,0x00,0xF7,0xFB,0xFF,
+0x00,0xE7,0xF9,0xFF,0x00,0xF7,0xFB,0xFF,0x00,0xE7,0xF9,0xFF,0x00,0xF7,0xFB,0xFF,
+0x03,0xE7,0xFF,0xFC,0x0F,0xF5,0xFF,0x03,0xE7,0xFF,0xE0,0x1F,0xF5,0xFF,0x03,0xF7,
+0xFF,0xC0,0x7F,0xF3,0xFF,0x00,0x00,0xFB,0xFF,0x00,0xC1,0xFA,0xFF,0x01,0xE1,0xFC,
+0xFB,0xFF,0x00,0x9C,0xFA,0xFF,0x02,0x9F,0xFF,0x1F,0xFC,0xFF,0x00,0xBE,0xFB,0xFF,
+0x03,0xFE,0x7F,0xFF,0xE3,0xFC,0xFF,0x00,0xBE,0xFB,0xFF,0x03,0xF9,0xFF,0xFF,0xFC,
+0xFC,0xFF,0x00,0x9D,0xFB,0xFF,0x04,0xF7,0xFF,0xFF,0xFE,0x79,0xFE,0xFF,0x01,0xFC,
+0x00,0xFB,0xFF,0x00,0xCF,0xFE,0xFF,0x00,0x81,0xF7,0xFF,0x01,0x7F,0xBF,0xFE,0xFF,
+0x00,0x81,0xF7,0xFF,0x01,0x3E,0x7F,0xFE,0xFF,0x00,0x8F,0xF7,0xFF,0x0A,0x80,0x9F,
+0xFF,0xFF,0xC0,0x00,0x0F,0xFF,0xFF,0xFC,0x80,0xFC,0xFF,0x06,0xA1,0x0F,0xFF,0xF8,
+0x00,0x00,0x1F,0xF8,0xFF,0x05,0xB1,0x07,0xFF,0xC0,0x00,0x07,0xF7,0xFF,0x05,0xC3,
+0x03,0xFE,0x00,0x00,0x3F,0xF7,0xFF,0x05,0xE6,0x00,0x30,0x00,0x03,0xDF,0xF8,0xFF,
+0x06,0xF7,0xF0,0xFE,0x07,0xFF,0xE7,0x99,0xFD,0xFF,0x00,0xCE,0xFD,0xFF,0x06,0xF7,
+0xFF,0xFE,0x7F,0xFF,0xFF,0x81,0xFD,0xFF,0x00,0xB6,0xFD,0xFF,0x02,0xF7,0xFF,0xFD,
+0xFE,0xFF,0x00,0xF8,0xFD,0xFF,0x00,0xB6,0xFD,0xFF,0x02,0xF3,0xFF,0xFB,0xFE,0xFF,
+0x05,0xFE,0x1F,0xEF,0xFF,0xFF,0xB9,0xFD,0xFF,0x02,0xF5,0xFF,0xE7,0xFD,0xFF,0x01,
+0xE3,0xCF,0xFA,0xFF,0x02,0xF5,0xFF,0xDF,0xFD,0xFF,0x01,0xFD,0x8F,0xFA,0xFF,0x02,
+0xF6,0xBF,0xBF,0xFD,0xFF,0x01,0xFC,0x0F,0xFA,0xFF,0x02,0xF2,0x3E,0x7F,0xFD,0xFF,
+0x05,0xFC,0x0F,0xFF,0xFF,0x80,0x1F,0xFE,0xFF,0x01,0xF8,0x01,0xFC,0xFF,0x04,0xFC,
+0x0F,0xFF,0xFF,0xDD,0xFD,0xFF,0x01,0xF8,0x03,0xFC,0xFF,0x00,0xFD,0xFE,0xFF,0x00,
+0xBE,0xFD,0xFF,0x01,0xF8,0x03,0xFC,0xFF,0x00,0xFD,0xFE,0xFF,0x00,0xBE,0xFD,0xFF,
+0x01,0xF8,0x06,0xF8,0xFF,0x00,0x9C,0xFD,0xFF,0x02,0xF8,0x0C,0x7F,0xFD,0xFF,0x04,
+0xFD,0xE7,0xFF,0xFF,0xC1,0xFD,0xFF,0x02,0xFC,0x18,0x3F,0xFD,0xFF,0x01,0xFC,0xC7,
+0xFA,0xFF,0x02,0xFE,0x30,0x1F,0xFD,0xFF,0x01,0xFE,0x07,0xF9,0xFF,0x01,0x80,0x0F,
+0xFD,0xFF,0x01,0xFE,0x07,0xF9,0xFF,0x01,0x30,0x03,0xFD,0xFF,0x01,0xFE,0x47,0xF9,
+0xFF,0x01,0x70,0x01,0xFD,0xFF,0x04,0xF1,0xF7,0xFF,0xFC,0x00,0xFC,0xFF,0x02,0x8F,
+0x00,0x7F,0xFE,0xFF,0x00,0x8F,0xF7,0xFF,0x05,0xFC,0x0F,0xFF,0xFF,0xFC,0x7F,0xF6,
+0xFF,0x03,0x00,0xFF,0xFF,0xE3,0xF5,0xFF,0x03,0xC0,0x00,0x00,0x0F,0xFD,0xFF,0x00,
+0xF9,0xFA,0xFF,0x03,0xF0,0x00,0x00,0x03,0xFD,0xFF,0x00,0xD6,0xFA,0xFF,0x03,0xFC,
+0x00,0x00,0x01,0xFD,0xFF,0x00,0xB6,0xF9,0xFF,0x02,0xC0,0x00,0x00,0xFD,0xFF,0x00,
+0xB5,0xF9,0xFF,0x03,0xFC,0x00,0x00,0x7F,0xFE,0xFF,0x00,0xC0,0xF8,0xFF,0x02,0xE0,
+0x00,0x3F,0xF3,0xFF,0x01,0xE0,0x1F,0xDE,0xFF,0x01,0xBF,0xDF,0xF3,0xFF,0x01,0xC7,
+0xDF,0xF3,0xFF,0x01,0xF8,0x3F,0xF9,0xFF,0x00,0xC1,0xFC,0xFF,0x00,0xF8,0xF9,0xFF,
+0x01,0xFC,0x03,0xFC,0xFF,0x00,0xC7,0xF9,0xFF,0x01,0xE0,0x07,0xFC,0xFF,0x00,0xBF,
+0xFA,0xFF,0x02,0xFC,0x08,0x0F,0xF4,0xFF,0x02,0xE3,0xFF,0xCF,0xF5,0xFF,0x03,0xFE,
+0x9F,0xFF,0xF1,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x04,0xEF,0xBE,0x7F,0xFF,0xFC,0xFC,
+0xFF,0x00,0xFC,0xFC,0xFF,0x05,0xEF,0xBC,0xFF,0xFE,0x7F,0x1E,0xF7,0xFF,0x05,0xEF,
+0xC3,0xF0,0x00,0x0F,0xC0,0xF7,0xFF,0x05,0xEF,0xC7,0x0F,0xFF,0xF0,0xF0,0xFD,0xFF,
+0x00,0xE1,0xFC,0xFF,0x05,0xF7,0xC0,0xFF,0xFF,0xFE,0x07,0xFD,0xFF,0x00,0xDC,0xFC,
+0xFF,0x01,0xF7,0xCF,0xFE,0xFF,0x00,0xF0,0xFD,0xFF,0x00,0xBE,0xFC,0xFF,0x01,0xD0,
+0x3F,0xFE,0xFF,0x05,0xFE,0x3F,0xDF,0xFF,0xFF,0xBE,0xFC,0xFF,0x00,0xC0,0xFC,0xFF,
+0x04,0x8F,0xDF,0xFF,0xFF,0xBE,0xFC,0xFF,0x01,0xC3,0x0F,0xFD,0xFF,0x01,0xF3,0x9F,
+0xF9,0xFF,0x01,0xC2,0x07,0xFD,0xFF,0x01,0xF9,0x1F,0xF9,0xFF,0x01,0xC4,0x03,0xFD,
+0xFF,0x01,0xFC,0x1F,0xF9,0xFF,0x01,0xEC,0x01,0xFD,0xFF,0x04,0xFC,0x1F,0xFF,0xFF,
+0xC1,0xFC,0xFF,0x01,0xEC,0x00,0xFD,0xFF,0x00,0xFD,0xFE,0xFF,0x00,0x9C,0xFC,0xFF,
+0x02,0xF0,0x00,0x1F,0xFE,0xFF,0x00,0xC3,0xFE,0xFF,0x00,0xBE,0xFC,0xFF,0x00,0xFC,
+0xFE,0x00,0x06,0x1F,0xFF,0xF3,0xC7,0xFF,0xFF,0xBE,0xFB,0xFF,0x09,0x80,0x00,0x00,
+0x03,0xFF,0xFC,0x07,0xFF,0xFF,0x9C,0xFB,0xFF,0x00,0xFC,0xFE,0x00,0x05,0x7F,0xFC,
+0x07,0xFF,0xFF,0xC1,0xFA,0xFF,0x05,0xC0,0x00,0x00,0x0F,0xFC,0x0F,0xF7,0xFF,0x04,
+0xF0,0x00,0x00,0x07,0xFD,0xF6,0xFF,0x04,0xF8,0x00,0x00,0x01,0xFB,0xF6,0xFF,0x00,
+0x7F,0xFE,0x00,0x00,0xE7,0xFE,0xFF,0x00,0x80,0xFA,0xFF,0x04,0x7F,0xE0,0x00,0x00,
+0x1F,0xFE,0xFF,0x00,0xDF,0xFA,0xFF,0x04,0x7F,0xF8,0x00,0x00,0x1F,0xFE,0xFF,0x00,
+0xBF,0xFD,0xFF,0x03,0xFD,0xFF,0x7F,0x38,0xFE,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xBF,
+0xFD,0xFF,0x07,0xFD,0xF7,0x7F,0x07,0xFE,0x00,0x00,0x07,0xFE,0xFF,0x00,0xC0,0xFD,
+0xFF,0x07,0xFD,0xF7,0x7C,0x7F,0xFF,0xF3,0xF0,0x03,0xFE,0xFF,0x00,0xDF,0xFD,0xFF,
+0x07,0xFD,0xF7,0x33,0xFF,0xFF,0xFC,0x7F,0xF7,0xFE,0xFF,0x00,0xBF,0xFD,0xFF,0x02,
+0xFD,0xF7,0x0F,0xFE,0xFF,0x00,0x1F,0xFD,0xFF,0x00,0xBF,0xFD,0xFF,0x02,0xFC,0xF3,
+0x3F,0xFE,0xFF,0x00,0xC7,0xFD,0xFF,0x00,0xC0,0xFD,0xFF,0x01,0xFC,0x78,0xFD,0xFF,
+0x00,0xF7,0xF8,0xFF,0x01,0xFC,0x03,0xFD,0xFF,0x01,0xF9,0xEF,0xF9,0xFF,0x07,0xFC,
+0x03,0xFF,0xE1,0xFF,0xFF,0xFE,0x67,0xF9,0xFF,0x07,0xFC,0x02,0x08,0x00,0x03,0xFF,
+0xFF,0x87,0xF9,0xFF,0x01,0xFC,0x04,0xFE,0x00,0x02,0xFF,0xFF,0xCF,0xF9,0xFF,0x01,
+0xFC,0x04,0xFE,0x00,0x02,0x3F,0xFF,0x7B,0xF9,0xFF,0x01,0xFE,0x3C,0xFE,0x00,0x02,
+0x0F,0xFE,0x71,0xF9,0xFF,0x01,0xFE,0x78,0xFE,0x00,0x02,0x03,0xFF,0x21,0xF8,0xFF,
+0x00,0x38,0xFD,0x00,0x01,0xFF,0x81,0xF8,0xFF,0x01,0x87,0xF0,0xFE,0x00,0x01,0x7F,
+0x9F,0xF8,0xFF,0x01,0xCF,0xFC,0xFE,0x00,0x01,0x1F,0x3F,0xF6,0xFF,0x00,0x80,0xFE,
+0x00,0xFB,0xFF,
+};
+
+#define BitmapExample2_packed logo_packed
+
+#endif
@@ -0,0 +1,1419 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// logo : 5000 bytes, packed 1841
+const unsigned char logo_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0xF3,0xFF,0x01,0xFE,0x1F,0xEA,0xFF,0x01,0xFE,0x00,0xF0,0xFF,
+0x00,0x80,0xFD,0x00,0x02,0x03,0xFE,0x00,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,
+0xFF,0xC0,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFF,0xC3,0xE9,0xFF,0x00,0x0F,
+0xEA,0xFF,0x01,0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x00,0xE9,0xFF,0x00,0x80,0xE9,0xFF,
+0x00,0xC1,0xEA,0xFF,0x01,0xFE,0x07,0xEA,0xFF,0x01,0xFE,0x3F,0xEA,0xFF,0x00,0xFE,
+0xD0,0xFF,0x01,0xFE,0x07,0xEF,0xFF,0x06,0x80,0xFF,0xC0,0x00,0x0F,0xFE,0x00,0xF0,
+0xFF,0x07,0xFE,0x00,0x3F,0x80,0x00,0x0F,0xFE,0x00,0xF0,0xFF,0x07,0xF8,0x00,0x1F,
+0x80,0x00,0x0F,0xFF,0xE1,0xF0,0xFF,0x07,0xF0,0x00,0x0F,0x80,0x00,0x0F,0xFF,0x87,
+0xF0,0xFF,0x07,0xF0,0x18,0x0F,0x83,0xFF,0x0F,0xFE,0x0F,0xF0,0xFF,0x07,0xE0,0x7F,
+0x07,0x8F,0xFF,0x0F,0xFE,0x00,0xF0,0xFF,0x07,0xE1,0xFF,0x87,0x8F,0xFF,0x0F,0xFE,
+0x00,0xF0,0xFF,0x07,0xE1,0xFF,0xC7,0x8F,0xFF,0x0F,0xFF,0xE0,0xF0,0xFF,0x07,0xC3,
+0xFF,0xC7,0x8F,0xFF,0x0F,0xFF,0x83,0xF0,0xFF,0x07,0xC3,0xFF,0xC7,0x8F,0xFF,0x0F,
+0xFE,0x0F,0xF0,0xFF,0x07,0xC7,0xFF,0xC7,0x87,0xFF,0x1F,0xFE,0x3F,0xF0,0xFF,0xFE,
+0xC7,0x02,0x87,0xFE,0x1F,0xEE,0xFF,0xFE,0xC7,0x04,0x83,0xFC,0x1F,0xFE,0x7F,0xF0,
+0xFF,0xFE,0xC7,0x04,0xC0,0x00,0x1F,0xFE,0x01,0xF0,0xFF,0x07,0xC3,0xC0,0x07,0xC0,
+0x00,0x3F,0xFE,0x00,0xF0,0xFF,0x07,0xC3,0xC0,0x07,0xE0,0x00,0x7F,0xFE,0x00,0xF0,
+0xFF,0x07,0xE3,0xC0,0x07,0xF0,0x01,0xFF,0xFF,0xE3,0xF0,0xFF,0x07,0xE3,0xC0,0x07,
+0xFC,0x07,0xFF,0xFF,0x87,0xEA,0xFF,0x01,0xFE,0x0D,0xEA,0xFF,0x01,0xFE,0x00,0xEA,
+0xFF,0x01,0xFE,0x00,0xEF,0xFF,0x06,0xE7,0xFF,0xFE,0x00,0x0F,0xFF,0xE0,0xEF,0xFF,
+0x06,0x00,0x7F,0x80,0x00,0x0F,0xFF,0x03,0xF0,0xFF,0x07,0xFC,0x00,0x3F,0x80,0x00,
+0x0F,0xFE,0x0F,0xF0,0xFF,0x07,0xF8,0x00,0x1F,0x80,0x00,0x0F,0xFE,0x7F,0xF0,0xFF,
+0x07,0xF0,0x00,0x0F,0x80,0x00,0x1F,0xFF,0xFC,0xF0,0xFF,0x02,0xE0,0x7E,0x0F,0xFD,
+0xFF,0x00,0xF8,0xF0,0xFF,0x02,0xE1,0xFF,0x07,0xFD,0xFF,0x00,0xF8,0xF0,0xFF,0x02,
+0xE3,0xFF,0x87,0xFD,0xFF,0x00,0xF8,0xF0,0xFF,0x05,0xC3,0xFF,0xC7,0xFF,0xFF,0x1F,
+0xEE,0xFF,0x08,0xC3,0xFF,0xC7,0xE0,0xFF,0x0F,0xFF,0xFF,0x3F,0xF1,0xFF,0x08,0xC7,
+0xFF,0xC7,0xC0,0x7F,0x0F,0xFF,0xF8,0x1F,0xF1,0xFF,0x08,0xC7,0xFF,0xC7,0x80,0x3F,
+0x8F,0xFF,0x10,0x1F,0xF1,0xFF,0x08,0xC3,0xFF,0xC7,0x80,0x1F,0x8F,0xFE,0x00,0x9F,
+0xF1,0xFF,0x08,0xC3,0xFF,0xC7,0x86,0x0F,0x8F,0xFE,0x0C,0xDF,0xF1,0xFF,0x08,0xC3,
+0xFF,0x87,0x8F,0x07,0x0F,0xFE,0x64,0x9F,0xF1,0xFF,0x08,0xE1,0xFF,0x07,0x8F,0x82,
+0x0F,0xFE,0x68,0x9F,0xF1,0xFF,0x08,0xE0,0x7E,0x0F,0x8F,0xC0,0x0F,0xFE,0x0C,0x1F,
+0xF1,0xFF,0x08,0xF0,0x00,0x0F,0x8F,0xE0,0x1F,0xF8,0x0C,0x1F,0xF1,0xFF,0x08,0xF0,
+0x00,0x1F,0x8F,0xE0,0x1F,0xF1,0x0C,0x3F,0xF1,0xFF,0x07,0xF8,0x00,0x3F,0xC7,0xF8,
+0x7F,0xF1,0xBF,0xF0,0xFF,0x01,0xFE,0x00,0xE9,0xFF,0x00,0xE7,0xFC,0xFF,0x00,0xC3,
+0xE9,0xFF,0x00,0x01,0xEB,0xFF,0x02,0xDF,0xFF,0x00,0xEF,0xFF,0x06,0x80,0xFF,0x80,
+0x00,0x0F,0xFE,0x08,0xF0,0xFF,0x07,0xFE,0x00,0x3F,0x80,0x00,0x0F,0xFE,0x7C,0xF0,
+0xFF,0x07,0xF8,0x00,0x1F,0x80,0x00,0x0F,0xFE,0x78,0xF0,0xFF,0x07,0xF0,0x00,0x1F,
+0x80,0x00,0x1F,0xFE,0x00,0xF0,0xFF,0x07,0xF0,0x00,0x0F,0x8F,0x9F,0xFF,0xFE,0x01,
+0xF0,0xFF,0x07,0xE0,0xFF,0x07,0x8F,0x8F,0xFF,0xFF,0x03,0xF0,0xFF,0x07,0xE1,0xFF,
+0x87,0x8F,0x8F,0xFF,0xFF,0xEF,0xF0,0xFF,0x04,0xE3,0xFF,0x87,0x8F,0x8F,0xED,0xFF,
+0x07,0xC3,0xFF,0xC7,0x8F,0x0F,0xFF,0xFF,0xC3,0xF0,0xFF,0x07,0xC7,0xFF,0xC7,0x80,
+0x0F,0xFF,0xFF,0x01,0xF0,0xFF,0x07,0xC7,0xFF,0xC7,0x80,0x1F,0xFF,0xFF,0x00,0xF0,
+0xFF,0x07,0xC7,0xFF,0xC7,0xC0,0x1F,0xFF,0xFE,0x08,0xF0,0xFF,0x07,0xC3,0xFF,0xC7,
+0xC0,0x3F,0xFF,0xFE,0x7C,0xF0,0xFF,0x07,0xC3,0xFF,0x87,0xF0,0xFF,0xFF,0xFE,0x78,
+0xF0,0xFF,0x02,0xE1,0xFF,0x87,0xFE,0xFF,0x01,0xFE,0x00,0xF0,0xFF,0x02,0xE0,0xFF,
+0x0F,0xFE,0xFF,0x01,0xFE,0x01,0xF0,0xFF,0x07,0xE0,0x38,0x0F,0xFF,0xF0,0x0F,0xFF,
+0x03,0xF0,0xFF,0x05,0xF0,0x00,0x1F,0x80,0x00,0x0F,0xEE,0xFF,0x05,0xF8,0x00,0x3F,
+0x80,0x00,0x0F,0xEE,0xFF,0x07,0xFC,0x00,0x7F,0x80,0x00,0x0F,0xFF,0xE3,0xEF,0xFF,
+0x06,0x01,0xFF,0x80,0x00,0x0F,0xFF,0x80,0xEB,0xFF,0x02,0x0F,0xFE,0x00,0xEB,0xFF,
+0x02,0x0F,0xFE,0x00,0xEB,0xFF,0x02,0x0F,0xFE,0x7C,0xEF,0xFF,0x06,0xF0,0x07,0xFF,
+0xFF,0x0F,0xFE,0x78,0xF0,0xFF,0x07,0xC0,0x00,0x07,0xFF,0xFF,0x0F,0xFE,0x00,0xF0,
+0xFF,0x07,0xC0,0x00,0x07,0xFF,0xFF,0x0F,0xF0,0x00,0xF0,0xFF,0x07,0xC0,0x00,0x07,
+0xFF,0xFF,0x8F,0xF0,0x00,0xF0,0xFF,0x07,0xC0,0x00,0x07,0xFF,0xFF,0x0F,0xF0,0x1F,
+0xF0,0xFF,0x02,0xC3,0xFF,0xC7,0xFE,0xFF,0x00,0xF7,0xEF,0xFF,0x07,0xC3,0xFF,0xC7,
+0xFF,0xFF,0x8F,0xFF,0xE7,0xF0,0xFF,0x07,0xC3,0xFF,0xC7,0xFF,0xFE,0x0F,0xFF,0xC7,
+0xF0,0xFF,0x07,0xC3,0xFF,0xC7,0xFF,0xF8,0x0F,0xFF,0xC7,0xF0,0xFF,0x07,0xE3,0xFF,
+0xC7,0xFF,0xE0,0x0F,0xFF,0xC7,0xF0,0xFF,0x07,0xC3,0xFF,0x87,0xFF,0x80,0x3F,0xFF,
+0xC7,0xF0,0xFF,0x04,0xC3,0xFF,0x87,0xFE,0x00,0xED,0xFF,0x07,0xE1,0xFF,0x07,0xF8,
+0x03,0xFF,0xFF,0x81,0xF0,0xFF,0x07,0xE0,0xFC,0x0F,0xE0,0x07,0xFF,0xFF,0x00,0xF0,
+0xFF,0x07,0xE0,0x00,0x1F,0x80,0x07,0xFF,0xFE,0x00,0xF0,0xFF,0x07,0xF0,0x00,0x1F,
+0x80,0xC7,0xFF,0xFE,0x3C,0xF0,0xFF,0x07,0xF8,0x00,0x7F,0x83,0xC7,0xFF,0xFE,0x7C,
+0xF0,0xFF,0x07,0xFE,0x00,0xFF,0x83,0xC7,0xFF,0xFE,0x70,0xEF,0xFF,0x06,0xCF,0xFF,
+0x80,0x47,0xFF,0xF8,0x00,0xED,0xFF,0x04,0x80,0x07,0xFF,0xF0,0x00,0xED,0xFF,0x04,
+0xE0,0x00,0xFF,0xF0,0x03,0xED,0xFF,0x04,0xFC,0x00,0x3F,0xF0,0x7F,0xEC,0xFF,0x01,
+0x00,0x0F,0xEA,0xFF,0x03,0xE0,0x0F,0xFF,0xE0,0xEC,0xFF,0x03,0xFC,0x0F,0xFA,0x00,
+0xEB,0xFF,0x02,0x8F,0xF2,0x00,0xEA,0xFF,0x01,0xF2,0x03,0xED,0xFF,0x03,0xBF,0xFF,
+0xFF,0xE2,0xEC,0xFF,0x00,0x8F,0xE9,0xFF,0x00,0x83,0xFE,0xFF,0x00,0x19,0xED,0xFF,
+0x04,0x80,0xFF,0xFF,0xFE,0x08,0xED,0xFF,0x04,0x80,0x7F,0xFF,0xFE,0x04,0xED,0xFF,
+0x04,0xC0,0x1F,0xFF,0xFE,0x44,0xED,0xFF,0x04,0xF0,0x00,0x0F,0xFE,0x44,0xED,0xFF,
+0x04,0xFC,0x00,0x0F,0xFE,0x40,0xEC,0xFF,0x03,0x00,0x0F,0xFE,0x40,0xED,0xFF,0x04,
+0xFE,0x00,0x0F,0xFF,0x61,0xED,0xFF,0x01,0xF8,0x0F,0xEA,0xFF,0x01,0xE0,0x1F,0xEA,
+0xFF,0x05,0xC0,0x7F,0xFF,0xFF,0xF0,0x1F,0xEE,0xFF,0x05,0x80,0xFF,0xFF,0xFE,0x00,
+0x1F,0xEE,0xFF,0x05,0x83,0xFF,0xFF,0xFE,0x00,0x1F,0xEE,0xFF,0x04,0x87,0xFF,0xFF,
+0xFE,0x01,0xED,0xFF,0x04,0x9F,0xFF,0xFF,0xFE,0x3C,0xEA,0xFF,0x01,0xFE,0x7C,0xEA,
+0xFF,0x01,0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x03,0xE9,0xFF,
+0x00,0x8F,0xD0,0xFF,0x00,0xFC,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x03,0xFE,0x00,
+0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xF0,0x00,0xF0,0xFF,0x00,0x80,0xFD,0x00,
+0x02,0x01,0xF0,0x00,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xF0,0x3F,0xF0,0xFF,
+0x00,0x80,0xFD,0x00,0x02,0x01,0xFF,0xFB,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,
+0xFF,0xE0,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFF,0x60,0xF0,0xFF,0x00,0x80,
+0xFD,0x00,0x02,0x01,0xFE,0x60,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,0xFE,
+0x0C,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,0xFE,0x4D,0xF0,0xFF,0x07,0x80,
+0x00,0xFF,0xFF,0xFE,0x01,0xFE,0x40,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,
+0xFE,0x00,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,0xFE,0x00,0xF0,0xFF,0x00,
+0x80,0xFE,0x00,0x03,0x3E,0x01,0xFF,0x00,0xF0,0xFF,0x00,0x80,0xFE,0x00,0x01,0x3E,
+0x01,0xEE,0xFF,0x00,0x80,0xFE,0x00,0x01,0x3E,0x01,0xEE,0xFF,0x00,0x80,0xFE,0x00,
+0x04,0x3E,0x01,0xFE,0xFF,0x9F,0xF1,0xFF,0x00,0x80,0xFE,0x00,0x04,0x3E,0x01,0xFE,
+0x0F,0x9F,0xF1,0xFF,0x08,0x80,0x7F,0xFF,0xF8,0x3E,0x01,0xFE,0x00,0x1F,0xF1,0xFF,
+0x08,0x80,0x7F,0xFF,0xF8,0x3E,0x01,0xFE,0x00,0x1F,0xF1,0xFF,0x08,0x80,0x7F,0xFF,
+0xF8,0x3E,0x01,0xFF,0xC0,0x3F,0xF1,0xFF,0x07,0x80,0x7F,0xFF,0xF8,0x3E,0x01,0xFF,
+0xC0,0xF0,0xFF,0x07,0x80,0x7F,0xFF,0xF8,0x3E,0x01,0xFF,0x07,0xF0,0xFF,0x07,0x80,
+0x7C,0x00,0xF8,0x3E,0x01,0xFE,0x1F,0xF0,0xFF,0x07,0x80,0x78,0x00,0xF8,0x3E,0x01,
+0xFE,0x7F,0xF0,0xFF,0x07,0x80,0x78,0x00,0xF8,0x3E,0x01,0xFF,0xFC,0xF0,0xFF,0x07,
+0x80,0x78,0x00,0xF8,0x3E,0x01,0xFF,0xF8,0xF0,0xFF,0x07,0x80,0x78,0x00,0xF8,0x3E,
+0x01,0xFF,0xF8,0xF0,0xFF,0x07,0x80,0x78,0x00,0xF8,0x3E,0x01,0xFF,0xF8,0xF0,0xFF,
+0x05,0x80,0x78,0x00,0xF8,0x3E,0x01,0xEE,0xFF,0x05,0x80,0x78,0x00,0xF8,0x00,0x01,
+0xEE,0xFF,0x07,0x80,0x78,0x00,0xF8,0x00,0x01,0xFF,0xC3,0xF0,0xFF,0x07,0x80,0x78,
+0x00,0xF8,0x00,0x01,0xFF,0x81,0xF0,0xFF,0x07,0x80,0x78,0x00,0xF8,0x00,0x01,0xFF,
+0x00,0xF0,0xFF,0x07,0x80,0x00,0xF8,0x00,0x3C,0x01,0xFE,0x00,0xF0,0xFF,0x07,0x80,
+0x00,0xF8,0x00,0x3E,0x01,0xFE,0x7C,0xF0,0xFF,0x07,0x80,0x00,0xF8,0x00,0x3E,0x01,
+0xFE,0x78,0xF0,0xFF,0x07,0x80,0x00,0xF8,0x00,0x3E,0x01,0xFE,0x18,0xF0,0xFF,0x07,
+0x80,0x00,0xF8,0x00,0x3E,0x01,0xFF,0x39,0xF0,0xFF,0x07,0x80,0x00,0xF8,0x00,0x3E,
+0x01,0xFF,0x9F,0xF0,0xFF,0x05,0x80,0x00,0xF8,0x00,0x3E,0x01,0xEE,0xFF,0x07,0x80,
+0x00,0xF8,0x00,0x3E,0x01,0xFF,0xC3,0xF0,0xFF,0x07,0x80,0x00,0xF8,0x00,0x3E,0x01,
+0xFF,0x81,0xF0,0xFF,0x07,0x80,0x00,0xF8,0x00,0x3E,0x01,0xFF,0x00,0xF0,0xFF,0x07,
+0x80,0x00,0xF8,0x00,0x3E,0x01,0xFE,0x00,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,
+0x01,0xFE,0x7C,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,0xFE,0x7C,0xF0,0xFF,
+0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,0xFE,0x00,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,
+0xFE,0x01,0xFE,0x01,0xF0,0xFF,0x07,0x80,0x00,0xFF,0xFF,0xFE,0x01,0xFF,0x01,0xF0,
+0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFF,0x87,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x00,
+0x01,0xEE,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFF,0xFC,0xF0,0xFF,0x00,0x80,0xFD,
+0x00,0x02,0x01,0xFE,0x00,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFE,0x00,0xF0,
+0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFE,0x01,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,
+0x01,0xFE,0x3F,0xF0,0xFF,0x00,0x80,0xFD,0x00,0x02,0x01,0xFE,0x7C,0xEA,0xFF,0x01,
+0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x03,0xE9,0xFF,0x00,0x3F,
+0xEA,0xFF,0x01,0xFE,0x7E,0xEA,0xFF,0x01,0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x00,0xF8,
+0xFF,
+};
+
+// first : 5000 bytes, packed 2362
+const unsigned char first_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0xFB,0xFF,0x00,0xC3,0xE9,0xFF,0x00,0x83,0xE9,0xFF,0x00,0x81,
+0xE9,0xFF,0x00,0x00,0xE9,0xFF,0x01,0x00,0x0F,0xEA,0xFF,0x01,0x60,0x01,0xEB,0xFF,
+0x03,0xFE,0x70,0x00,0x7F,0xED,0xFF,0x04,0xFC,0xFF,0x70,0x00,0x1F,0xED,0xFF,0x04,
+0xFD,0xFF,0xB8,0x00,0x07,0xED,0xFF,0x04,0xFD,0xFF,0xFC,0x00,0x03,0xED,0xFF,0x04,
+0xFD,0xFF,0xFC,0x00,0x01,0xED,0xFF,0x04,0xFD,0xFF,0xFE,0x00,0x00,0xED,0xFF,0x05,
+0xF2,0xFF,0xFE,0x00,0x00,0x7F,0xEE,0xFF,0x05,0xF8,0x3F,0xFF,0x00,0x00,0x7F,0xEE,
+0xFF,0x05,0xFC,0x1F,0xFF,0x00,0x10,0x3F,0xEE,0xFF,0x05,0xFE,0x1F,0xFF,0x00,0x08,
+0x3F,0xEE,0xFF,0x05,0xFE,0x1F,0xFF,0x00,0x08,0x3F,0xED,0xFF,0x04,0x1F,0xFF,0x80,
+0x0C,0x3F,0xED,0xFF,0x04,0x1F,0xFF,0x80,0x0C,0x3F,0xED,0xFF,0x04,0x9F,0xFF,0x80,
+0x0C,0x3F,0xED,0xFF,0x04,0x8F,0xFF,0x80,0x0C,0x7F,0xED,0xFF,0x04,0x8F,0xFF,0x80,
+0x08,0x3F,0xED,0xFF,0x04,0x8F,0xFF,0x80,0x08,0x3F,0xED,0xFF,0x04,0xCF,0xFF,0x80,
+0x18,0x3F,0xED,0xFF,0x04,0xCF,0xFF,0x80,0x18,0x3F,0xED,0xFF,0x04,0xCF,0xFF,0xC0,
+0x10,0x3F,0xED,0xFF,0x04,0xCF,0xFF,0xC0,0x10,0x3F,0xED,0xFF,0x04,0xCF,0xFF,0xC0,
+0x10,0x7F,0xED,0xFF,0x04,0xCF,0xFF,0xC0,0x30,0x7F,0xEE,0xFF,0x05,0xCF,0xCF,0xFF,
+0xC0,0x30,0x7F,0xEE,0xFF,0x06,0xD7,0xC7,0xFF,0xC0,0x30,0x7F,0xDF,0xEF,0xFF,0x06,
+0xDB,0xC7,0xFF,0xC0,0x30,0x7F,0xE1,0xEF,0xFF,0x06,0xF9,0xC7,0xFE,0xC0,0x30,0x3F,
+0xF8,0xEF,0xFF,0x06,0xFD,0xC7,0xFE,0xC0,0x38,0x1F,0xFC,0xEF,0xFF,0x07,0xFC,0xC7,
+0xFE,0xC0,0x3C,0x07,0xFC,0x7F,0xF0,0xFF,0x07,0xFE,0xE3,0xFE,0xC0,0x1C,0x01,0xFE,
+0x7F,0xF0,0xFF,0x07,0xFE,0x63,0xFF,0x40,0x1E,0x00,0xFE,0x3F,0xF0,0xFF,0x07,0xFE,
+0x63,0xFF,0x40,0x1F,0x80,0x3E,0x3F,0xEF,0xFF,0x06,0x63,0xFF,0x40,0x0F,0xC0,0x1E,
+0x3F,0xEF,0xFF,0x06,0x23,0xFF,0x40,0x07,0xF0,0x1E,0x1F,0xEF,0xFF,0x06,0xA1,0xFF,
+0x40,0x01,0xF8,0x0E,0x1F,0xEF,0xFF,0x06,0xA1,0xFF,0x40,0x00,0x3C,0x0E,0x1F,0xEF,
+0xFF,0x06,0xA1,0xFF,0x40,0x00,0x0E,0x06,0x1F,0xEF,0xFF,0x06,0xC0,0xFF,0x40,0x00,
+0x0E,0x06,0x1F,0xF0,0xFF,0x07,0xFD,0xC0,0xFF,0x60,0x00,0x06,0x06,0x1F,0xEF,0xFF,
+0x09,0x40,0x7F,0x60,0x00,0x06,0x0E,0x3F,0xFF,0xFF,0xC3,0xF2,0xFF,0x09,0xA0,0x7F,
+0x60,0x00,0x04,0x0C,0x3F,0xFF,0xFF,0xA1,0xF2,0xFF,0x09,0xC0,0x3F,0x60,0x00,0x8C,
+0x0C,0x3F,0xFF,0xFF,0xF1,0xF2,0xFF,0x09,0xC0,0x3F,0x60,0x00,0x78,0x18,0x7F,0xFF,
+0xFF,0xE1,0xF2,0xFF,0x09,0xE0,0x1F,0xE2,0x00,0x00,0x18,0x7F,0xFF,0xFF,0xE1,0xF2,
+0xFF,0x09,0xF0,0x1F,0xE2,0x00,0x00,0x30,0x7F,0xFF,0xFF,0xC1,0xF2,0xFF,0x09,0xF0,
+0x0F,0xA2,0x00,0x00,0x70,0xFF,0xF1,0xFE,0x01,0xF2,0xFF,0x09,0xF8,0x07,0xA3,0x00,
+0x00,0x60,0xFE,0x00,0x00,0x01,0xF2,0xFF,0x09,0xFC,0x03,0xA2,0x00,0x00,0xC1,0xF8,
+0x00,0x00,0x01,0xF2,0xFF,0x09,0xFC,0x03,0xE3,0x00,0x00,0xC3,0xE0,0x00,0x00,0x07,
+0xF1,0xFF,0x08,0x01,0xC3,0x00,0x01,0x07,0x80,0x3F,0x00,0x3F,0xF1,0xFF,0x07,0x80,
+0xC3,0x00,0x00,0x07,0x00,0xFF,0xE1,0xF0,0xFF,0x05,0xC0,0x63,0x00,0x00,0x0E,0x01,
+0xF2,0xFF,0x0B,0xF0,0x3F,0xFF,0xFF,0xE0,0x01,0x00,0x00,0x0C,0x02,0x01,0xBF,0xF4,
+0xFF,0x0B,0xC0,0x0F,0xFF,0xFF,0xF0,0x01,0x00,0x00,0x08,0x80,0x00,0x3F,0xF4,0xFF,
+0x0B,0x8F,0xC7,0xFF,0xFF,0xFC,0x00,0x80,0x00,0x01,0x00,0x00,0x7F,0xF4,0xFF,0x0C,
+0x1F,0xE3,0xFF,0xFF,0xFE,0x00,0xF0,0x00,0x01,0x00,0x07,0xFF,0xFD,0xF5,0xFF,0x06,
+0x3F,0xF3,0xFF,0xFF,0x0F,0x00,0x20,0xFE,0x00,0x03,0xFF,0x00,0xF8,0x7F,0xF6,0xFF,
+0x0D,0x3C,0xF3,0xFF,0xFF,0x63,0x80,0x00,0x00,0x02,0x03,0xFC,0x00,0x3C,0x3F,0xF6,
+0xFF,0x05,0x3C,0xF3,0xFF,0xFF,0xF0,0xC0,0xFE,0x00,0x04,0x01,0xE0,0x00,0x00,0x3F,
+0xF6,0xFF,0x05,0x1C,0xE3,0xFF,0xFF,0xF8,0x60,0xFA,0x00,0x00,0x3F,0xF6,0xFF,0x05,
+0x8C,0x07,0xFF,0xFF,0xFC,0x70,0xFA,0x00,0x00,0x7F,0xF6,0xFF,0x05,0xDC,0x07,0xFF,
+0xFF,0xFE,0x38,0xFD,0x00,0x03,0x02,0x00,0x00,0x7F,0xF2,0xFF,0x01,0xFE,0x18,0xFD,
+0x00,0x02,0x0F,0x80,0xC1,0xFC,0xFF,0x01,0xFE,0x0F,0xF7,0xFF,0x06,0x0C,0x00,0x40,
+0x00,0x00,0x1F,0xC0,0xFB,0xFF,0x01,0xFC,0x1F,0xFC,0xFF,0x01,0xFC,0x0F,0xFE,0xFF,
+0x06,0x8C,0x00,0x40,0x00,0x00,0x3E,0x40,0xFB,0xFF,0x01,0xF0,0x3F,0xFC,0xFF,0x01,
+0xF8,0x07,0xFE,0xFF,0x06,0x86,0x00,0x60,0x00,0x00,0x7E,0x01,0xFB,0xFF,0x01,0x00,
+0x7F,0xFC,0xFF,0x0B,0xF1,0xE3,0xFF,0xFF,0xFE,0x42,0x0C,0x60,0x00,0x00,0xFE,0x01,
+0xFB,0xFF,0x00,0x01,0xFB,0xFF,0x01,0xF3,0xF3,0xFE,0xFF,0x06,0x80,0x0C,0x30,0x00,
+0x00,0xFF,0x03,0xFB,0xFF,0x00,0x03,0xFB,0xFF,0x01,0xF1,0xE3,0xFE,0xFF,0x06,0xC0,
+0x00,0x3E,0x00,0x01,0xFF,0x87,0xFC,0xFF,0x01,0xFE,0x07,0xFB,0xFF,0x01,0xF8,0x07,
+0xFE,0xFF,0x04,0xE0,0x00,0xE1,0xF0,0x01,0xFA,0xFF,0x01,0xFC,0x1F,0xFB,0xFF,0x01,
+0xFC,0x0F,0xFE,0xFF,0x04,0xF0,0x01,0x00,0x0E,0x01,0xFA,0xFF,0x01,0xF0,0x3F,0xF6,
+0xFF,0x00,0xF8,0xFE,0x00,0x02,0x03,0xFC,0x7F,0xFC,0xFF,0x00,0xC0,0xF5,0xFF,0x06,
+0xFC,0x04,0x03,0xE0,0x03,0xF0,0x3F,0xFD,0xFF,0x01,0xFC,0x01,0xFA,0xFF,0x01,0xFC,
+0x0F,0xFE,0xFF,0x06,0xFE,0x00,0x1F,0xFC,0x03,0xE0,0x1F,0xFD,0xFF,0x01,0xE0,0x07,
+0xFA,0xFF,0x01,0xF8,0x07,0xFD,0xFF,0x05,0x80,0xFF,0xFE,0x03,0xC0,0x0F,0xFD,0xFF,
+0x01,0x80,0x0F,0xFA,0xFF,0x01,0xF1,0xE3,0xFE,0xFF,0x0C,0xF3,0xFF,0xE0,0x7F,0x01,
+0x81,0x87,0x9F,0xFF,0xFF,0xFC,0x00,0x3F,0xFA,0xFF,0x01,0xF3,0xF3,0xFE,0xFF,0x0B,
+0xE3,0x0F,0x80,0x1F,0x80,0x03,0xC0,0x01,0xFF,0xFF,0xF8,0xC0,0xF9,0xFF,0x10,0xF1,
+0xE3,0xFF,0xFF,0xE1,0xE2,0x2F,0x00,0x0F,0xC0,0x07,0xE0,0x00,0x1F,0xFF,0xC0,0x03,
+0xF9,0xFF,0x10,0xF8,0x07,0xFF,0xFF,0xDC,0xF4,0x1C,0x1F,0x83,0xE0,0x03,0xE0,0x00,
+0x00,0x70,0x00,0x0F,0xF9,0xFF,0x01,0xFC,0x0F,0xFE,0xFF,0x04,0x30,0x00,0x30,0x00,
+0xE0,0xFE,0x00,0x03,0x03,0xC0,0x00,0x3F,0xF4,0xFF,0x02,0x98,0x00,0x40,0xFC,0x00,
+0x02,0x06,0x00,0x00,0xF4,0xFF,0x01,0xF0,0xC4,0xF8,0x00,0x00,0x07,0xF8,0xFF,0x04,
+0xFC,0x0F,0xFF,0xFF,0xC0,0xF8,0x00,0x01,0x10,0x3F,0xF8,0xFF,0x04,0xF8,0x07,0xFF,
+0xFF,0x86,0xF8,0x00,0x00,0xE1,0xF7,0xFF,0x05,0xF1,0xE3,0xFF,0xFF,0x3F,0xE0,0xFA,
+0x00,0x01,0x07,0x9F,0xF7,0xFF,0x05,0xF3,0xF3,0xFF,0xFF,0x3F,0xF0,0xFE,0x00,0x00,
+0x18,0xFE,0x00,0x00,0x3F,0xF6,0xFF,0x05,0xF9,0xE7,0xFF,0xFF,0x1F,0xEC,0xFE,0x00,
+0x03,0x1C,0x1C,0x00,0x01,0xF5,0xFF,0x01,0x00,0x03,0xFE,0xFF,0x00,0xEC,0xFE,0x00,
+0x03,0x0F,0xFF,0x80,0x7F,0xF5,0xFF,0x01,0x00,0x03,0xFE,0xFF,0x00,0xE0,0xFE,0x00,
+0x00,0x0F,0xED,0xFF,0x04,0xF8,0x00,0xE0,0x00,0x1F,0xEC,0xFF,0x02,0xFD,0x78,0x7F,
+0xEB,0xFF,0x01,0xFC,0x7F,0xF2,0xFF,0xB4,0x00,0x01,0xFF,0xFC,0xFD,0x00,0x02,0x03,
+0x87,0x80,0xF1,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x01,0xF2,0x8F,0xFF,0xC0,0xF2,
+0x00,0x01,0xC0,0x0C,0xFE,0x00,0x04,0x0F,0xFF,0x3F,0xFF,0xF0,0xF2,0x00,0x01,0xC0,
+0x0C,0xFE,0x00,0x00,0x1B,0xFE,0xFF,0x00,0xF0,0xF2,0x00,0x05,0xC0,0x0C,0x00,0x00,
+0x60,0x13,0xFE,0xFF,0x03,0xE1,0xC0,0xFF,0xF0,0xF5,0x00,0x05,0xC0,0x0C,0x00,0x00,
+0xC0,0x07,0xFE,0xFF,0x03,0xE3,0xE7,0xFF,0xFF,0xF5,0x00,0x05,0x70,0x18,0x00,0x00,
+0xC0,0x0F,0xFE,0xFF,0x00,0xEF,0xFE,0xFF,0x00,0xE0,0xF6,0x00,0x05,0x3F,0xF8,0x00,
+0x00,0xE0,0x3F,0xFA,0xFF,0x01,0xFC,0x38,0xF7,0x00,0x04,0x1F,0xE0,0x00,0x00,0x7F,
+0xF8,0xFF,0x01,0x8F,0x80,0xF4,0x00,0x00,0x1F,0xF7,0xFF,0x00,0xF0,0xF3,0x00,0x02,
+0x33,0xFF,0x7F,0xFA,0xFF,0x00,0xFC,0xF8,0x00,0x01,0xCF,0xFC,0xFE,0x00,0x04,0x47,
+0xFF,0xDF,0xFF,0x8F,0xFE,0xFF,0x03,0xF8,0x7F,0xFF,0x80,0xF9,0x00,0x10,0xCF,0xFC,
+0x00,0x00,0x21,0x8B,0xEF,0xE3,0xFD,0x1F,0xFF,0x3F,0xFF,0xFE,0x1F,0xFF,0xE0,0xF5,
+0x00,0x0C,0x1F,0x09,0xC1,0xF0,0xF8,0x3F,0xF8,0x1F,0xFF,0xFF,0xC7,0xFF,0xF8,0xF4,
+0x00,0x0B,0x1E,0xF0,0xFF,0xF0,0x3F,0xF8,0x1F,0xFF,0x80,0x00,0x0F,0xFE,0xF9,0x00,
+0x01,0x07,0x98,0xFE,0x00,0x0C,0x0C,0x60,0x3F,0xC0,0x7E,0xFC,0x7F,0xF8,0x00,0x00,
+0x03,0x9F,0x80,0xFA,0x00,0x01,0x0F,0xDC,0xFD,0x00,0x05,0x1E,0x02,0x00,0xFE,0x7F,
+0xF0,0xFD,0x00,0x01,0xFF,0xE0,0xFA,0x00,0x01,0x0D,0xCC,0xFD,0x00,0x05,0xFF,0xC0,
+0x01,0xFC,0x1F,0xE0,0xFD,0x00,0x01,0x3F,0xF0,0xFA,0x00,0x01,0x0C,0xCC,0xFE,0x00,
+0x06,0x03,0xFF,0xF0,0x07,0xFC,0x0F,0xC0,0xFD,0x00,0x01,0x07,0xFC,0xFA,0x00,0x01,
+0x0E,0xFC,0xFE,0x00,0x06,0x07,0xFB,0xFF,0xFF,0xFC,0x03,0x80,0xFC,0x00,0x00,0xFF,
+0xFA,0x00,0x01,0x06,0x78,0xFE,0x00,0x04,0x0F,0xFD,0xFF,0xFF,0xFC,0xFA,0x00,0x01,
+0x1F,0x80,0xF6,0x00,0x04,0x1F,0xFE,0x7F,0xC7,0xFE,0xFA,0x00,0x01,0x07,0xE0,0xF6,
+0x00,0x06,0x3F,0xFF,0x80,0x3F,0xFE,0x00,0x30,0xFC,0x00,0x01,0x01,0xF0,0xFB,0x00,
+0x0B,0x0F,0xFF,0xC0,0x00,0x00,0x7F,0xFB,0xC3,0xFF,0xFE,0x00,0xFC,0xFB,0x00,0x00,
+0xF8,0xFB,0x00,0x0B,0x0F,0xFF,0xC0,0x00,0x00,0xBD,0xF3,0xCF,0xFF,0xFF,0x01,0xFE,
+0xFB,0x00,0x00,0xFE,0xFB,0x00,0x0B,0x06,0x18,0x00,0x00,0x07,0x3D,0xF3,0x9F,0xFF,
+0xFF,0x01,0xFE,0xFB,0x00,0x00,0xFF,0xFB,0x00,0x01,0x0C,0x0C,0xFE,0x00,0x06,0x79,
+0xFF,0xBF,0xFF,0xFF,0x81,0x3E,0xFB,0x00,0x01,0xFF,0x80,0xFC,0x00,0x01,0x0E,0x1C,
+0xFE,0x00,0x06,0xF3,0xFF,0xBF,0xFF,0xFF,0xC0,0x3F,0xFB,0x00,0x01,0x07,0xC0,0xFC,
+0x00,0x01,0x07,0xF8,0xFE,0x00,0x00,0xE3,0xFD,0xFF,0x01,0xE0,0x7F,0xFB,0x00,0x01,
+0x01,0xE0,0xFC,0x00,0x05,0x03,0xF0,0x00,0x00,0x01,0xE7,0xFD,0xFF,0x02,0xF8,0xFF,
+0x3E,0xFB,0x00,0x00,0xF0,0xF8,0x00,0x01,0x03,0xCF,0xFA,0xFF,0x00,0x80,0xF2,0x00,
+0x01,0x03,0x8F,0xFA,0xFF,0x00,0x80,0xF6,0x00,0x05,0xFF,0xFC,0x00,0x00,0x07,0x1F,
+0xFA,0xFF,0x00,0xC0,0xF6,0x00,0x0D,0xFF,0xFC,0x00,0x00,0x8E,0x3F,0xFF,0xFF,0xFD,
+0xFC,0x07,0xFF,0xE1,0xC0,0xF2,0x00,0x09,0x9C,0x7F,0xFF,0xFF,0xFD,0xFE,0x01,0xFF,
+0x87,0x80,0xF2,0x00,0x08,0x41,0xFF,0x9F,0xFF,0xFE,0xFF,0x80,0x7E,0x02,0xF5,0x00,
+0x0A,0x06,0x78,0x00,0x00,0x03,0xFF,0x3F,0xFF,0xFE,0xFF,0xFE,0xF3,0x00,0x0B,0x0C,
+0xFC,0x00,0x00,0x07,0xFE,0xFF,0xFF,0xF7,0x7F,0xFF,0x80,0xF4,0x00,0x0B,0x0C,0xCC,
+0x00,0x00,0x0F,0xEE,0xFF,0xFF,0xF7,0x7B,0xFF,0xC0,0xF4,0x00,0x09,0x0D,0x9C,0x00,
+0x00,0x1F,0xDE,0xFF,0xFF,0xF3,0xFC,0xF2,0x00,0x09,0x0F,0xF8,0x00,0x00,0x7F,0x9C,
+0xFF,0xFF,0xF1,0xFE,0xF2,0x00,0x0C,0x07,0xFC,0x00,0x00,0xFF,0x3C,0xFF,0xFE,0xF8,
+0xFF,0x80,0x3F,0x80,0xF2,0x00,0x09,0x01,0xFE,0x3C,0xFF,0xFE,0x7C,0x3F,0xFF,0xFF,
+0xF0,0xF5,0x00,0x0C,0x0C,0x00,0x00,0x03,0xFC,0x5D,0xFF,0xFF,0x3E,0x0F,0xFF,0xFF,
+0xFC,0xF5,0x00,0x0C,0x0F,0xE0,0xC0,0x07,0xF8,0x5C,0xFF,0xFF,0x1F,0x03,0xFF,0xFF,
+0xFE,0xF5,0x00,0x0C,0x03,0xFF,0xC0,0x07,0xF0,0x5C,0xFF,0xFF,0x8F,0x00,0x7F,0xFF,
+0xFE,0xF4,0x00,0x0B,0x1F,0x80,0x0F,0xF0,0x1D,0xFF,0xFF,0x8F,0x80,0x00,0x00,0x7E,
+0xF5,0x00,0x0C,0x03,0xFE,0x00,0x1F,0xE0,0x1D,0xFF,0xFF,0xC7,0x80,0x00,0x00,0x1E,
+0xF5,0x00,0x0C,0x0F,0xE0,0x00,0x1F,0xE0,0x1D,0xFF,0xFF,0xE7,0x80,0x00,0x00,0x1E,
+0xF5,0x00,0x0C,0x0C,0x00,0x00,0x3F,0xC0,0x9F,0xFF,0x87,0xE3,0x80,0x00,0x00,0x1E,
+0xF2,0x00,0x09,0x7F,0x80,0x9F,0xFF,0x7B,0xF3,0xC0,0x00,0x00,0x4E,0xF2,0x00,0x09,
+0x7F,0x80,0x9F,0xFF,0xF9,0xF3,0xC0,0x00,0x00,0x3C,0xF3,0x00,0x07,0x01,0x3F,0x00,
+0x9F,0xFF,0xF9,0xF1,0xC0,0xF0,0x00,0x07,0x04,0x3F,0x00,0xBF,0xFF,0xF9,0xF9,0xE0,
+0xEF,0x00,0x06,0x7F,0x00,0xBF,0xFF,0xF1,0xF9,0xE0,0xEF,0x00,0x06,0x5E,0x00,0xBF,
+0xFF,0xE3,0xF1,0xE0,0xEF,0x00,0x06,0x5E,0x00,0xBF,0xFF,0x03,0xF1,0xE0,0xEF,0x00,
+0x06,0xDE,0x00,0xBF,0xFC,0x0F,0xF1,0xE0,0xEF,0x00,0x06,0x9C,0x00,0xBF,0xF8,0x1F,
+0xE1,0xC0,0xEF,0x00,0x06,0x9C,0x00,0xBF,0xF0,0x7F,0xC1,0xC0,0xF0,0x00,0x07,0x01,
+0x9C,0x00,0xBF,0xE0,0xFF,0x81,0xC0,0xF0,0x00,0x07,0x01,0x1C,0x00,0x3F,0xE1,0xFE,
+0x01,0xC0,0xF0,0x00,0x07,0x03,0x18,0x01,0x3F,0xC3,0xFC,0x01,0x80,0xF0,0x00,0x07,
+0x02,0x18,0x01,0x3F,0xC7,0xF0,0x03,0x80,0xF0,0x00,0x06,0x06,0x38,0x01,0x3F,0xC7,
+0xE0,0x07,0xEF,0x00,0x06,0x24,0x38,0x01,0x3F,0xCF,0xC0,0x0E,0xEF,0x00,0x06,0x2C,
+0x38,0x00,0x3F,0xCF,0x80,0x18,0xEF,0x00,0x05,0x28,0x38,0x00,0x3F,0xCF,0x80,0xEE,
+0x00,0x05,0x10,0x30,0x00,0x3F,0xCF,0x80,0xED,0x00,0x04,0x30,0x00,0x3F,0xCF,0x80,
+0xED,0x00,0x04,0x30,0x00,0x3F,0xEF,0x80,0xED,0x00,0x04,0x30,0x00,0x3F,0xEF,0xC0,
+0xED,0x00,0x04,0x30,0x00,0x3F,0xE7,0xC0,0xED,0x00,0x04,0x30,0x00,0x7F,0xE7,0xC0,
+0xED,0x00,0x04,0x30,0x00,0x7F,0xE7,0xC0,0xED,0x00,0x04,0x70,0x00,0x7F,0xF7,0xC0,
+0xED,0x00,0x04,0x70,0x00,0x7F,0xF3,0x80,0xED,0x00,0x04,0x70,0x00,0x7F,0xF3,0x80,
+0xED,0x00,0x04,0x70,0x00,0x7F,0xF3,0x80,0xED,0x00,0x04,0xE0,0x00,0x7F,0xF3,0x80,
+0xED,0x00,0x04,0xE0,0x00,0xFF,0xF7,0xC0,0xEE,0x00,0x05,0x01,0xE0,0x00,0xFF,0xF7,
+0xC0,0xEE,0x00,0x05,0x03,0xE0,0x00,0xFF,0xEF,0xC0,0xEE,0x00,0x05,0x07,0xE0,0x00,
+0xFF,0xFF,0xC0,0xEE,0x00,0x05,0x05,0x80,0x01,0xFF,0xFF,0x80,0xEE,0x00,0x04,0x09,
+0x00,0x01,0xFF,0xFF,0xED,0x00,0x04,0x02,0x00,0x01,0xFF,0xFE,0xED,0x00,0x04,0x02,
+0x00,0x03,0xFF,0xFC,0xED,0x00,0x04,0x02,0x00,0x03,0xFF,0xF8,0xED,0x00,0x04,0x02,
+0x00,0xC7,0xFF,0xF0,0xEB,0x00,0x02,0x8F,0xFF,0xC0,0xEB,0x00,0x01,0x9F,0xFF,0xEA,
+0x00,0x01,0xFF,0xFC,0xEA,0x00,0x00,0xFF,0xE9,0x00,0x00,0x7E,0xE9,0x00,0x00,0x7E,
+0xE9,0x00,0x00,0x3C,0xE9,0x00,0x00,0x20,0xD6,0x00,
+};
+
+// second : 5000 bytes, packed 2466
+const unsigned char second_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0xAE,0xFF,0x00,0xCF,0xEA,0xFF,0x01,0xE1,0xE7,0xEA,0xFF,0x01,0x80,0x71,
+0xFE,0xFF,0x01,0xC0,0x03,0xEF,0xFF,0x01,0xFC,0x38,0xFE,0xFF,0x01,0x00,0x01,0xEE,
+0xFF,0x05,0x8E,0x7F,0xFF,0xFF,0x1F,0xF0,0xEE,0xFF,0x06,0xC6,0x3F,0xFF,0xFE,0x3F,
+0xF8,0x7F,0xEF,0xFF,0x06,0xE3,0x1F,0xFF,0xFE,0x7F,0xF8,0x7F,0xF0,0xFF,0x06,0xC0,
+0x71,0x9F,0xFF,0xFC,0x7F,0xF8,0xF6,0x00,0x00,0x07,0xFC,0xFF,0x07,0xF8,0x00,0x38,
+0x9F,0xFF,0xFC,0x7F,0xF8,0xF6,0x00,0x00,0x01,0xFC,0xFF,0x07,0xE0,0x00,0x0C,0xDF,
+0xFF,0xFC,0x7F,0xF0,0xF6,0xFF,0x00,0xC0,0xFC,0xFF,0x07,0xC0,0x00,0x0E,0x4F,0xFF,
+0xFC,0x7F,0xE0,0xF6,0xFF,0x01,0xF8,0x7F,0xFD,0xFF,0x07,0x80,0x00,0x06,0x6F,0xFF,
+0xFC,0x7F,0xE0,0xF6,0xFF,0x01,0xF8,0x3F,0xFD,0xFF,0x07,0x80,0x00,0x03,0x7F,0xFF,
+0xFC,0x7F,0xC0,0xF6,0xFF,0x01,0xFC,0x3F,0xFD,0xFF,0x07,0x80,0x01,0x03,0x3F,0xFF,
+0xF8,0x7F,0x00,0xF6,0xFF,0x01,0xFE,0x1F,0xFD,0xFF,0x07,0x80,0x03,0x9B,0xFF,0xFF,
+0xF8,0x7E,0x00,0xF5,0xFF,0x00,0x9F,0xFD,0xFF,0x07,0x80,0x03,0x99,0xFF,0xFF,0xF8,
+0x7C,0x00,0xF5,0xFF,0x00,0x8F,0xFD,0xFF,0x07,0x80,0x07,0xC9,0xFF,0xFF,0xF8,0x7C,
+0x00,0xF5,0xFF,0x00,0x87,0xFD,0xFF,0x07,0x80,0x07,0xC9,0xFF,0xFF,0xF9,0x78,0x00,
+0xF5,0xFF,0x00,0xC3,0xFD,0xFF,0x07,0xC0,0x0F,0xC9,0xFF,0xFF,0xF9,0x70,0x00,0xF5,
+0xFF,0x00,0xC3,0xFD,0xFF,0x07,0xC0,0x0F,0xCD,0xFF,0xFF,0xF9,0x60,0x00,0xF5,0xFF,
+0x00,0xC3,0xFD,0xFF,0x07,0xE0,0x1F,0xCD,0xFF,0xFF,0xF9,0x60,0x00,0xF5,0xFF,0x00,
+0xC3,0xFD,0xFF,0x07,0xE0,0x1F,0xE4,0xFF,0xFF,0xF9,0x00,0x00,0xF5,0xFF,0x00,0xC3,
+0xFD,0xFF,0x07,0xE0,0x3F,0xE4,0xFF,0xFF,0xF9,0x00,0x00,0xF5,0xFF,0x00,0xC3,0xFD,
+0xFF,0x07,0xF0,0x3F,0xE6,0xFF,0xFF,0xF9,0x00,0x00,0xF5,0xFF,0x00,0xC1,0xFD,0xFF,
+0x07,0xF0,0x3F,0xE6,0x7F,0xFF,0xF9,0x00,0x00,0xF5,0xFF,0x00,0xC1,0xFD,0xFF,0x07,
+0xF0,0x3F,0xE6,0x7F,0xFF,0xF9,0x00,0x00,0xF5,0xFF,0x00,0xC1,0xFD,0xFF,0x14,0xF0,
+0x7F,0xC6,0x7F,0xFF,0xF9,0x00,0x00,0xFF,0xC0,0x00,0x01,0xC7,0x3C,0x00,0x07,0x00,
+0x00,0x07,0xFF,0xC1,0xFD,0xFF,0x14,0xF0,0x7F,0xC2,0x7F,0xFF,0xF9,0x00,0x00,0xFF,
+0xC0,0x00,0x01,0xC7,0x3C,0x00,0x07,0x00,0x00,0x07,0xFF,0xC1,0xFD,0xFF,0x14,0xF0,
+0x7F,0xC2,0x7F,0xFF,0xF9,0x00,0x00,0xFF,0xC0,0x00,0x01,0xC7,0x3C,0x00,0x07,0x00,
+0x00,0x07,0xFF,0xC1,0xFE,0xFF,0x15,0xF0,0xF8,0x7F,0xC0,0x7F,0xFF,0xF9,0x00,0x00,
+0xFF,0xCF,0xFF,0xE1,0xC0,0x03,0x8F,0xFF,0x1F,0xFF,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,
+0xE6,0x78,0xFF,0x81,0x3F,0xFF,0xF9,0x00,0x08,0xFF,0xCF,0xFF,0xE1,0xC0,0x03,0x8F,
+0xFF,0x1F,0xFF,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xCF,0xB8,0xFF,0x81,0x3F,0xFF,0xF9,
+0x00,0x18,0xFF,0xCF,0xFF,0xE1,0xC0,0x03,0x8F,0xFF,0x1F,0xFF,0xC7,0xFF,0xC1,0xFE,
+0xFF,0x15,0xDF,0xB9,0xFF,0x01,0x1F,0xFF,0xF9,0x00,0x38,0xFF,0xCF,0x00,0x61,0xF8,
+0x3F,0x8E,0x07,0x1C,0x01,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xDF,0xDD,0xFF,0x00,0x9F,
+0xFF,0xF9,0x00,0x38,0xFF,0xCF,0x00,0x61,0xF8,0x3F,0x8E,0x07,0x1C,0x01,0xC7,0xFF,
+0xC1,0xFE,0xFF,0x15,0xDD,0xDC,0xFF,0x00,0x9F,0xFF,0xF9,0x00,0x78,0xFF,0xCF,0x00,
+0x61,0xF8,0x3F,0x8E,0x07,0x1C,0x01,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xDE,0xDC,0xFE,
+0x00,0x9F,0xFF,0xF9,0x00,0xF8,0xFF,0xCF,0x00,0x61,0xFF,0x03,0x81,0xFF,0x1C,0x01,
+0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xDE,0xDC,0xFE,0x00,0x9F,0xFF,0xF9,0x01,0xF8,0xFF,
+0xCF,0x00,0x61,0xFF,0x03,0x81,0xFF,0x1C,0x01,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xEE,
+0xDC,0x7C,0x00,0x8F,0xFF,0xF9,0x03,0xF8,0xFF,0xCF,0x00,0x61,0xFF,0x03,0x81,0xFF,
+0x1C,0x01,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xE2,0x1C,0x7C,0x00,0xCF,0xFF,0xF9,0x07,
+0xF8,0xFF,0xCF,0x00,0x61,0xFF,0x03,0x81,0xFF,0x1C,0x01,0xC7,0xFF,0xC1,0xFE,0xFF,
+0x15,0xF3,0x1E,0x7C,0x00,0x4F,0xFF,0xF9,0x0F,0xF8,0xFF,0xCF,0x00,0x61,0xF8,0xFC,
+0x7F,0xFF,0x1C,0x01,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xFE,0x0E,0x78,0x00,0x4F,0xFF,
+0xF9,0x1F,0xF8,0xFF,0xCF,0x00,0x61,0xF8,0xFC,0x7F,0xFF,0x1C,0x01,0xC7,0xFF,0xC1,
+0xFE,0xFF,0x15,0xFE,0xF6,0x38,0x00,0x47,0xFF,0xF9,0x3F,0xF8,0xFF,0xCF,0xFF,0xE1,
+0xC7,0x03,0x8E,0x7F,0x1F,0xFF,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xFE,0xF6,0x30,0x00,
+0x67,0xFF,0xF9,0x7F,0xF8,0xFF,0xCF,0xFF,0xE1,0xC7,0x03,0x8E,0x7F,0x1F,0xFF,0xC7,
+0xFF,0xC1,0xFE,0xFF,0x15,0xFE,0xFB,0x30,0x00,0x27,0xFF,0xF9,0x7F,0xF8,0xFF,0xCF,
+0xFF,0xE1,0xC7,0x03,0x8E,0x7F,0x1F,0xFF,0xC7,0xFF,0xC1,0xFE,0xFF,0x15,0xFE,0xF7,
+0x30,0x00,0x27,0xFF,0xF9,0x7F,0xF0,0xFF,0xC0,0x00,0x01,0xC7,0x3C,0x71,0x87,0x00,
+0x00,0x07,0xFF,0xC1,0xFE,0xFF,0x15,0xFE,0x67,0x80,0x00,0xA3,0xFF,0xF9,0x7F,0xF0,
+0xFF,0xC0,0x00,0x01,0xC7,0x3C,0x71,0x87,0x00,0x00,0x07,0xFF,0xC1,0xFD,0xFF,0x14,
+0x0F,0x80,0x00,0xB3,0xFF,0xF9,0x7F,0xE0,0xFF,0xC0,0x00,0x01,0xC7,0x3C,0x71,0x87,
+0x00,0x00,0x07,0xFF,0xC1,0xFC,0xFF,0x06,0x80,0x00,0x99,0xFF,0xF9,0x7F,0x80,0xFD,
+0xFF,0x03,0xC0,0xFC,0x7E,0x7F,0xFD,0xFF,0x00,0xC1,0xFD,0xFF,0x07,0xF3,0xC0,0x01,
+0x99,0xFF,0xF9,0x7F,0x00,0xFD,0xFF,0x03,0xC0,0xFC,0x7E,0x7F,0xFD,0xFF,0x00,0xC1,
+0xFD,0xFF,0x07,0xC1,0xC0,0x01,0xC9,0xFF,0xF9,0x7E,0x00,0xFD,0xFF,0x03,0xC0,0xFC,
+0x7E,0x7F,0xFD,0xFF,0x00,0xC1,0xFD,0xFF,0x14,0xDE,0xC0,0x01,0xC9,0xFF,0xF9,0x7C,
+0x00,0xFF,0xFF,0xE0,0x61,0xF8,0xFC,0x7F,0x80,0x03,0xFE,0x07,0xFF,0xC1,0xFD,0xFF,
+0x14,0xDE,0xC0,0x03,0xCD,0xFF,0xF9,0x78,0x00,0xFF,0xFF,0xE0,0x61,0xF8,0xFC,0x7F,
+0x80,0x03,0xFE,0x07,0xFF,0xC1,0xFD,0xFF,0x14,0xDF,0x40,0x03,0xEC,0xFF,0xF9,0x70,
+0x00,0xFF,0xFF,0xE0,0x61,0xF8,0xFC,0x7F,0x80,0x03,0xFE,0x07,0xFF,0xC1,0xFD,0xFF,
+0x14,0xDE,0xE0,0x03,0xE4,0xFF,0xF9,0x40,0x00,0xFF,0xFF,0xE0,0x61,0xF8,0xFC,0x7F,
+0x80,0x03,0xFE,0x07,0xFF,0xC1,0xFD,0xFF,0x14,0xCC,0xE0,0x07,0xE4,0xFF,0xF9,0x00,
+0x00,0xFF,0xCF,0x1F,0x9E,0x07,0x3C,0x00,0x7F,0xE0,0xFE,0x3F,0xFF,0xC1,0xFD,0xFF,
+0x14,0xE1,0xE0,0x07,0xE4,0xFF,0xF9,0x00,0x00,0xFF,0xCF,0x1F,0x9E,0x07,0x3C,0x00,
+0x7F,0xE0,0xFE,0x3F,0xFF,0xC1,0xFC,0xFF,0x13,0xF0,0x0F,0xE6,0x7F,0xF9,0x00,0x00,
+0xFF,0xCF,0x00,0x01,0xC0,0xC0,0x0F,0xFF,0xFC,0xFE,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,
+0xFC,0xF0,0x0F,0xF2,0x7F,0xF9,0x00,0x00,0xFF,0xCF,0x00,0x01,0xC0,0xC0,0x0F,0xFF,
+0xFC,0xFE,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,0xF0,0x70,0x1F,0xF2,0x7F,0xF9,0x00,0x00,
+0xFF,0xCF,0x00,0x01,0xC0,0xC0,0x0F,0xFF,0xFC,0xFE,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,
+0xF7,0xB8,0x1F,0xF2,0x7F,0xF9,0x00,0x00,0xFF,0xC0,0x03,0xFE,0x00,0xFF,0x8E,0x00,
+0x03,0x0E,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,0xF7,0xB8,0x3F,0xE2,0x7F,0xF9,0x00,0x00,
+0xFF,0xC0,0x03,0xFE,0x00,0xFF,0x8E,0x00,0x03,0x0E,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,
+0xF7,0xB8,0x3F,0xE1,0x7F,0xF9,0x00,0x00,0xFF,0xC0,0x03,0xFE,0x00,0xFF,0x8E,0x00,
+0x03,0x0E,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,0xF7,0x98,0x7F,0xE1,0x3F,0xF9,0x00,0x08,
+0xFF,0xF0,0xE0,0x61,0xC0,0xFC,0x7F,0x87,0xE0,0xF1,0xC7,0xFF,0xC1,0xFD,0xFF,0x14,
+0xF8,0x18,0x7F,0xC1,0xBF,0xF9,0x00,0x18,0xFF,0xF0,0xE0,0x61,0xC0,0xFC,0x7F,0x87,
+0xE0,0xF1,0xC7,0xFF,0xC1,0xFD,0xFF,0x14,0xC0,0xFC,0xFF,0xC0,0x9F,0xF9,0x00,0x38,
+0xFF,0xF0,0xE0,0x61,0xC0,0xFC,0x7F,0x87,0xE0,0xF1,0xC7,0xFF,0xC1,0xFD,0xFF,0x14,
+0xCF,0xFC,0xFF,0x80,0x9F,0xF9,0x00,0x78,0xFF,0xFF,0xE3,0x9F,0xC7,0xFF,0x8F,0x87,
+0x1C,0x0F,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xFC,0x7F,0x80,0x9F,0xF9,0x00,0xF8,0xFF,
+0xFF,0xE3,0x9F,0xC7,0xFF,0x8F,0x87,0x1C,0x0F,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xFE,
+0x7F,0x80,0x9F,0xF9,0x01,0xF8,0xFF,0xFF,0xE3,0x9F,0xC7,0xFF,0x8F,0x87,0x1C,0x0F,
+0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xFE,0x7F,0x80,0x9F,0xF9,0x03,0xF8,0xFF,0xFF,0xE3,
+0x9F,0xC7,0xFF,0x8F,0x87,0x1C,0x0F,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xEF,0x3F,0x00,
+0xDF,0xF9,0x07,0xF8,0xFF,0xCF,0x1C,0x60,0x07,0xFF,0xF0,0x07,0x00,0xFE,0x07,0xFF,
+0xC1,0xFD,0xFF,0x14,0xFE,0x07,0x3F,0x00,0x4F,0xF9,0x0F,0xF8,0xFF,0xCF,0x1C,0x60,
+0x07,0xFF,0xF0,0x07,0x00,0xFE,0x07,0xFF,0xC1,0xFD,0xFF,0x14,0xF0,0x37,0x3E,0x00,
+0x6F,0xF9,0x1F,0xF8,0xFF,0xFF,0x1F,0xFF,0xF8,0x3C,0x00,0x7F,0xE0,0x0F,0xFF,0xFF,
+0xC1,0xFD,0xFF,0x14,0xF3,0xF7,0x1E,0x00,0x27,0xF9,0x3F,0xF8,0xFF,0xFF,0x1F,0xFF,
+0xF8,0x3C,0x00,0x7F,0xE0,0x0F,0xFF,0xFF,0xC1,0xFD,0xFF,0x14,0xF7,0xF7,0x1E,0x00,
+0x27,0xF9,0x7F,0xF8,0xFF,0xFF,0x1F,0xFF,0xF8,0x3C,0x00,0x7F,0xE0,0x0F,0xFF,0xFF,
+0xC1,0xFD,0xFF,0x14,0xFB,0xFB,0x9C,0x00,0x27,0xF9,0x7F,0xF8,0xFF,0xFF,0x00,0x00,
+0x38,0xC0,0x01,0x80,0x00,0xF0,0x07,0xFF,0xC1,0xFD,0xFF,0x14,0xFB,0xFB,0x9C,0x00,
+0x23,0xF9,0x7F,0xF8,0xFF,0xFF,0x00,0x00,0x38,0xC0,0x01,0x80,0x00,0xF0,0x07,0xFF,
+0xC1,0xFD,0xFF,0x14,0xFB,0xF3,0x8C,0x00,0x13,0xF9,0x7F,0xF8,0xFF,0xFF,0x00,0x00,
+0x38,0xC0,0x01,0x80,0x00,0xF0,0x07,0xFF,0xC1,0xFD,0xFF,0x07,0xF9,0xF7,0xC8,0x00,
+0x13,0xF9,0x7F,0xF8,0xFD,0xFF,0x08,0xF8,0x00,0x71,0x87,0xFC,0x0E,0x3F,0xFF,0xC1,
+0xFD,0xFF,0x07,0xFC,0x07,0xC8,0x00,0x1B,0xF9,0x7F,0xF0,0xFD,0xFF,0x08,0xF8,0x00,
+0x71,0x87,0xFC,0x0E,0x3F,0xFF,0xC1,0xFD,0xFF,0x07,0xFE,0x1F,0xC0,0x00,0xDB,0xF9,
+0x7F,0xE0,0xFD,0xFF,0x08,0xF8,0x00,0x71,0x87,0xFC,0x0E,0x3F,0xFF,0xC1,0xFB,0xFF,
+0x12,0xE0,0x00,0xC9,0xF9,0x7F,0xC0,0xFF,0xC0,0x00,0x01,0xFF,0x3C,0x7F,0x87,0x1C,
+0x0E,0x3F,0xFF,0xC1,0xFC,0xFF,0x13,0xFD,0xE0,0x00,0xC9,0xF9,0x7F,0x00,0xFF,0xC0,
+0x00,0x01,0xFF,0x3C,0x7F,0x87,0x1C,0x0E,0x3F,0xFF,0xC1,0xFC,0xFF,0x13,0xC0,0xE0,
+0x01,0xC9,0xF9,0x7E,0x00,0xFF,0xC0,0x00,0x01,0xFF,0x3C,0x7F,0x87,0x1C,0x0E,0x3F,
+0xFF,0xC1,0xFD,0xFF,0x14,0xFE,0x8F,0xE0,0x03,0xC8,0xF9,0x7C,0x00,0xFF,0xC0,0x00,
+0x01,0xFF,0x3C,0x7F,0x87,0x1C,0x0E,0x3F,0xFF,0xC1,0xFD,0xFF,0x14,0xFE,0xFF,0xE0,
+0x07,0xE4,0xF9,0x78,0x00,0xFF,0xCF,0xFF,0xE1,0xF8,0x03,0x80,0x07,0xFC,0x00,0x3F,
+0xFF,0xC1,0xFC,0xFF,0x13,0xFC,0xF0,0x07,0xE4,0xF9,0x60,0x00,0xFF,0xCF,0xFF,0xE1,
+0xF8,0x03,0x80,0x07,0xFC,0x00,0x3F,0xFF,0xC1,0xFC,0xFF,0x13,0xE6,0x70,0x0F,0xE4,
+0xF9,0x40,0x00,0xFF,0xCF,0x00,0x61,0xC0,0x3F,0xF0,0x00,0x00,0xFE,0x3F,0xFF,0xC1,
+0xFC,0xFF,0x13,0xC3,0x70,0x0F,0xF6,0x79,0x00,0x00,0xFF,0xCF,0x00,0x61,0xC0,0x3F,
+0xF0,0x00,0x00,0xFE,0x3F,0xFF,0xC1,0xFC,0xFF,0x13,0xDB,0x70,0x1F,0xE2,0x79,0x00,
+0x00,0xFF,0xCF,0x00,0x61,0xC0,0x3F,0xF0,0x00,0x00,0xFE,0x3F,0xFF,0xC1,0xFC,0xFF,
+0x13,0xED,0x78,0x1F,0xE2,0x79,0x00,0x00,0xFF,0xCF,0x00,0x61,0xC0,0x03,0xF1,0xFF,
+0x1C,0x0F,0xC7,0xFF,0xC1,0xFC,0xFF,0x13,0xEC,0x78,0x3F,0xC2,0x79,0x00,0x00,0xFF,
+0xCF,0x00,0x61,0xC0,0x03,0xF1,0xFF,0x1C,0x0F,0xC7,0xFF,0xC1,0xFC,0xFF,0x13,0xF6,
+0x7C,0x3F,0xC3,0x39,0x00,0x00,0xFF,0xCF,0x00,0x61,0xC0,0x03,0xF1,0xFF,0x1C,0x0F,
+0xC7,0xFF,0xC1,0xFB,0xFF,0x12,0xF4,0x3F,0x81,0x39,0x00,0x00,0xFF,0xCF,0x00,0x61,
+0xF8,0xFF,0xFE,0x00,0xFC,0xF1,0xFF,0xFF,0xC1,0xFB,0xFF,0x12,0x84,0x7F,0x81,0x39,
+0x00,0x00,0xFF,0xCF,0x00,0x61,0xF8,0xFF,0xFE,0x00,0xFC,0xF1,0xFF,0xFF,0xC1,0xFC,
+0xFF,0x13,0xF8,0x1C,0x7F,0x01,0xB9,0x00,0x18,0xFF,0xCF,0x00,0x61,0xF8,0xFF,0xFE,
+0x00,0xFC,0xF1,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xF1,0xDE,0x7F,0x00,0x99,0x00,0x38,
+0xFF,0xCF,0xFF,0xE1,0xF8,0x3F,0x81,0xFF,0xFC,0x0F,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,
+0xFB,0xDE,0x7F,0x00,0x99,0x00,0x78,0xFF,0xCF,0xFF,0xE1,0xF8,0x3F,0x81,0xFF,0xFC,
+0x0F,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xFB,0xEE,0x7E,0x00,0xD9,0x01,0xF8,0xFF,0xCF,
+0xFF,0xE1,0xF8,0x3F,0x81,0xFF,0xFC,0x0F,0xFF,0xFF,0xC1,0xFC,0xFF,0x13,0xFB,0xDE,
+0x7E,0x00,0x19,0x03,0xF8,0xFF,0xCF,0xFF,0xE1,0xF8,0x3F,0x81,0xFF,0xFC,0x0F,0xFF,
+0xFF,0xC1,0xFC,0xFF,0x13,0xF9,0x9F,0x3E,0x00,0x01,0x07,0xF8,0xFF,0xC0,0x00,0x01,
+0xFF,0x00,0x70,0x7F,0x03,0x00,0x07,0xFF,0xC1,0xFC,0xFF,0x13,0xFC,0x3F,0x7E,0x00,
+0x01,0x0F,0xF8,0xFF,0xC0,0x00,0x01,0xFF,0x00,0x70,0x7F,0x03,0x00,0x07,0xFF,0xC1,
+0xFB,0xFF,0x05,0xC7,0x7C,0x00,0x01,0x3F,0xF8,0xF5,0xFF,0x00,0xC1,0xFC,0xFF,0x06,
+0xFE,0x0F,0x38,0x01,0x01,0x3F,0xF8,0xF5,0xFF,0x00,0xC1,0xFC,0xFF,0x06,0xF0,0x7F,
+0x38,0x03,0x21,0x7F,0xF8,0xF5,0xFF,0x00,0xC1,0xFC,0xFF,0x06,0xF7,0xE7,0xB0,0x03,
+0x21,0x7F,0xF8,0xF5,0xFF,0x00,0xC1,0xFB,0xFF,0x05,0x43,0xB0,0x00,0x00,0x3F,0xF8,
+0xF5,0xFF,0x00,0xC1,0xFB,0xFF,0x05,0x5B,0x80,0x00,0x00,0x1F,0xF0,0xF5,0xFF,0x00,
+0xC1,0xFB,0xFF,0x05,0x5B,0x80,0x07,0xFF,0x8F,0xE0,0xF5,0xFF,0x00,0xC1,0xFB,0xFF,
+0x05,0x6B,0xC0,0x0F,0xBF,0xCF,0x80,0xF5,0xFF,0x00,0xC3,0xFB,0xFF,0x05,0x6B,0xC0,
+0x0F,0x0F,0xCF,0x00,0xF5,0xFF,0x00,0xC3,0xFB,0xFF,0x05,0x01,0xE0,0x0F,0x07,0xCE,
+0x00,0xF5,0xFF,0x00,0x83,0xFB,0xFF,0x05,0x8F,0xE0,0x0E,0x07,0xC8,0x00,0xF5,0xFF,
+0x00,0x87,0xFA,0xFF,0x04,0xA0,0x2C,0x03,0xC0,0x00,0xF5,0xFF,0x00,0x87,0xFA,0xFF,
+0x04,0xA0,0x6C,0x03,0xC0,0x00,0xF5,0xFF,0x00,0x07,0xFB,0xFF,0x05,0x8F,0xA0,0xEC,
+0x03,0xC0,0x00,0xF6,0xFF,0x01,0xFC,0x0F,0xFB,0xFF,0x05,0xC0,0x20,0xEE,0x03,0xC0,
+0x00,0xF6,0xFF,0x01,0xF0,0x1F,0xFB,0xFF,0x04,0xFE,0x70,0x0F,0x07,0xC0,0xF4,0x00,
+0x00,0x1F,0xFB,0xFF,0x04,0xF9,0xF0,0x0F,0xFF,0xC0,0xF4,0x00,0x00,0x3F,0xFB,0xFF,
+0x05,0xF3,0xF8,0x0F,0xFF,0x80,0x00,0xF7,0xFF,0x01,0xFE,0x00,0xFA,0xFF,0x05,0xC7,
+0xF8,0x01,0xE0,0x00,0x00,0xF7,0xFF,0x01,0xF8,0x07,0xFA,0xFF,0x05,0xEF,0xFC,0x80,
+0x00,0x00,0x18,0xF6,0x00,0x00,0x3F,0xF9,0xFF,0x04,0xFC,0x4F,0xFF,0x8F,0xE0,0xF7,
+0x00,0x00,0x07,0xF8,0xFF,0x04,0xFE,0x0F,0xFF,0x9F,0xC3,0xEC,0xFF,0x03,0x0F,0xFF,
+0x80,0x03,0xEC,0xFF,0x03,0xC7,0xFE,0x00,0x1F,0xEC,0xFF,0x02,0xF0,0x00,0x1F,0xEB,
+0xFF,0x01,0xF8,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x9E,0xFF,
+};
+
+// third : 5000 bytes, packed 2997
+const unsigned char third_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x8C,0xFF,0x00,0xC3,0xE9,0xFF,0x00,0x83,0xEF,0xFF,0xFA,0x00,
+0x00,0x3F,0xF0,0xFF,0xFA,0x00,0x00,0x3F,0xF0,0xFF,0xFA,0x00,0x00,0x3F,0xF0,0xFF,
+0xFA,0x00,0x00,0x3F,0xF0,0xFF,0xFA,0x00,0x00,0x3F,0xEB,0xFF,0x02,0xF0,0x00,0x3F,
+0xEB,0xFF,0x02,0xF0,0x00,0x3F,0xEB,0xFF,0x02,0xF0,0x00,0x3F,0xF8,0xFF,0x0F,0x80,
+0x00,0x00,0xF8,0x0E,0x1F,0xE0,0x3F,0xE0,0x00,0xC0,0x00,0x00,0x70,0x00,0x3F,0xF8,
+0xFF,0x0F,0x80,0x00,0x00,0xF8,0x06,0x1F,0xE0,0x1F,0xE0,0x00,0xC0,0x00,0x00,0x70,
+0x00,0x3F,0xF8,0xFF,0x0F,0x80,0x00,0x00,0xF8,0x04,0x1F,0xE0,0x1F,0xE0,0x00,0xC0,
+0x00,0x00,0x70,0x00,0x3F,0xF8,0xFF,0x03,0x80,0x00,0x00,0xF8,0xFE,0x00,0x08,0x3F,
+0xE0,0x00,0xC0,0x00,0x00,0x70,0x00,0x3F,0xF8,0xFF,0x0E,0x87,0xFF,0xF0,0xFF,0x00,
+0xC0,0x01,0xFF,0xE1,0xFF,0xC1,0xFF,0xF8,0x70,0x00,0xF7,0xFF,0x10,0x87,0xFF,0xF0,
+0xFF,0x00,0xC0,0x01,0xFF,0xE1,0xFF,0xC1,0xFF,0xF8,0x70,0x01,0xFC,0x3F,0xF9,0xFF,
+0x03,0x86,0x00,0x30,0xC0,0xFD,0x00,0x08,0xE0,0x00,0xC1,0x80,0x18,0x70,0x07,0xC0,
+0x03,0xF9,0xFF,0x10,0x86,0x00,0x30,0xC0,0x20,0x18,0x7C,0x00,0x7C,0x00,0xC1,0x80,
+0x18,0x70,0x0F,0x00,0x01,0xF9,0xFF,0x11,0x86,0x00,0x30,0xC0,0x60,0x18,0x7C,0x00,
+0x7C,0x00,0xC1,0x80,0x18,0x70,0x1E,0x00,0x00,0x7F,0xFA,0xFF,0x11,0x86,0x00,0x30,
+0xC0,0x00,0x18,0x0C,0x00,0x1C,0x00,0xC1,0x80,0x18,0x70,0x3C,0x00,0x00,0x3F,0xFA,
+0xFF,0x11,0x86,0x00,0x30,0xC0,0x00,0xF8,0x0C,0x1E,0x0C,0x3F,0xC1,0x80,0x18,0x70,
+0x38,0x00,0x00,0x1F,0xFA,0xFF,0x11,0x86,0x00,0x30,0xC0,0x00,0xF8,0x0C,0x1F,0x0C,
+0x3F,0xC1,0x80,0x18,0x70,0x70,0x00,0x00,0x0F,0xFA,0xFF,0x11,0x86,0x00,0x30,0xC0,
+0x00,0x38,0x00,0x38,0x00,0x07,0xC1,0x80,0x18,0x70,0xE0,0x00,0x00,0x0F,0xFA,0xFF,
+0x11,0x86,0x00,0x30,0xC0,0x00,0x1C,0x00,0x70,0x00,0x07,0xC1,0x80,0x18,0x70,0xE0,
+0x0F,0xE0,0x07,0xFA,0xFF,0x11,0x86,0x00,0x30,0xC0,0x06,0x1F,0x01,0xF0,0x60,0x07,
+0xC1,0x80,0x18,0x70,0xC0,0x1F,0xF8,0x07,0xFA,0xFF,0x11,0x86,0x00,0x30,0xC0,0x00,
+0x07,0x01,0xC0,0x00,0x07,0xC1,0x80,0x18,0x71,0xC0,0x3F,0xF8,0x07,0xFA,0xFF,0x11,
+0x87,0x00,0x70,0xE0,0x00,0x03,0x01,0x80,0x00,0x07,0xC1,0x80,0x38,0x71,0xC0,0x7F,
+0xFC,0x03,0xFA,0xFF,0x11,0x87,0xFF,0xF0,0xFF,0xE0,0xC3,0x01,0x83,0x0C,0x07,0xC1,
+0xFF,0xF8,0x71,0xC0,0x7F,0xFC,0x03,0xFA,0xFF,0x11,0x83,0xFF,0xE0,0xFF,0xE0,0x83,
+0x01,0x83,0x0C,0x03,0xC1,0xFF,0xF8,0x71,0x80,0x7F,0xFE,0x03,0xFA,0xFF,0x11,0x80,
+0x00,0x00,0xC3,0x00,0x00,0x01,0x83,0x0C,0x00,0xC0,0x00,0x00,0x71,0x80,0x7F,0xFE,
+0x03,0xFA,0xFF,0x11,0x80,0x00,0x00,0xC3,0x06,0x18,0x61,0x83,0x0C,0x30,0xC0,0x00,
+0x00,0x71,0x80,0x7F,0xFE,0x03,0xFA,0xFF,0x11,0x80,0x00,0x00,0xC3,0x06,0x18,0x60,
+0x82,0x0C,0x30,0xC0,0x00,0x00,0x71,0x80,0x7F,0xFE,0x03,0xFA,0xFF,0x11,0x80,0x00,
+0x00,0xC3,0x06,0x00,0x60,0x00,0x00,0x30,0xE0,0x00,0x00,0x71,0xC0,0x7F,0xFC,0x03,
+0xF6,0xFF,0x05,0x06,0x00,0x7C,0x10,0x00,0x3F,0xFE,0xFF,0x04,0xF1,0xC0,0x3F,0xFC,
+0x03,0xF6,0xFF,0x05,0x06,0x00,0x7C,0x10,0x00,0x3F,0xFE,0xFF,0x04,0xF0,0xC0,0x3F,
+0xF8,0x07,0xFA,0xFF,0x11,0x80,0x1F,0x80,0x00,0x06,0x00,0x00,0x30,0x00,0x00,0x1F,
+0x80,0x1F,0xF0,0xC0,0x0F,0xF0,0x07,0xFA,0xFF,0x11,0x80,0x0F,0x80,0x00,0x06,0x1F,
+0x00,0x10,0x7C,0x00,0x0F,0x80,0x1F,0xF0,0xE0,0x03,0xC0,0x0F,0xFA,0xFF,0x11,0x80,
+0x0F,0x80,0x00,0x06,0x1F,0x00,0x10,0x7C,0x00,0x0F,0x80,0x1F,0xF0,0x70,0x00,0x00,
+0x0F,0xFA,0xFF,0x00,0x80,0xFE,0x00,0x0D,0x06,0x18,0x00,0x38,0x0C,0x00,0x03,0x80,
+0x00,0x70,0x70,0x00,0x00,0x1F,0xFA,0xFF,0x11,0xFE,0x00,0x06,0x03,0x07,0xF8,0x01,
+0xFF,0x0C,0x3F,0xC1,0xFF,0xC0,0x70,0x38,0x00,0x00,0x3F,0xFA,0xFF,0x11,0xFE,0x00,
+0x06,0x03,0x07,0xF8,0x01,0xFF,0x0C,0x3F,0xC1,0xFF,0xC0,0x70,0x1C,0x00,0x00,0x7F,
+0xFA,0xFF,0x00,0x80,0xF9,0x00,0x07,0x07,0xC3,0xF0,0x00,0x70,0x0E,0x00,0x00,0xF9,
+0xFF,0x03,0x80,0x7F,0x00,0xF8,0xFD,0x00,0x08,0x61,0x87,0xFF,0xF0,0x03,0xF0,0x07,
+0x80,0x03,0xF9,0xFF,0x03,0x80,0xFF,0x80,0xF8,0xFD,0x00,0x08,0x61,0x87,0xFF,0xF0,
+0x03,0xF0,0x03,0xE0,0x0F,0xF9,0xFF,0x03,0x80,0x1F,0x80,0xC0,0xFD,0x00,0x06,0x60,
+0x00,0x1C,0x00,0x00,0x70,0x00,0xF7,0xFF,0x0F,0xFE,0x0F,0xFF,0xC1,0x00,0xF0,0x04,
+0x1F,0xE0,0x30,0x08,0x00,0xF8,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0xFE,0x0F,0xFF,0xC3,
+0x00,0xF8,0x0C,0x1F,0xE0,0x30,0x08,0x00,0xF8,0x70,0x00,0x3F,0xF8,0xFF,0x07,0xF8,
+0x03,0x81,0xC0,0x00,0x38,0x00,0x18,0xFD,0x00,0x03,0xE0,0x70,0x00,0x3F,0xF8,0xFF,
+0x07,0xF0,0x01,0x80,0xC0,0x00,0x18,0x00,0x10,0xFD,0x00,0x03,0xC0,0x70,0x00,0x3F,
+0xF8,0xFF,0x0F,0xF0,0x01,0x80,0xC0,0x7E,0x18,0x60,0x10,0x01,0x80,0xC1,0xF0,0xC0,
+0x70,0x00,0x7F,0xF8,0xFF,0x02,0xC0,0x01,0x80,0xFC,0x00,0x08,0x01,0x80,0x00,0x00,
+0xC0,0x70,0x01,0xFE,0x7F,0xF9,0xFF,0x02,0x80,0x03,0x80,0xFC,0x00,0x08,0x03,0x80,
+0x00,0x01,0xC0,0x70,0x03,0xC0,0x07,0xF9,0xFF,0x10,0x87,0xFF,0x86,0x00,0x00,0xC0,
+0x00,0x03,0xFF,0x86,0x08,0x07,0xC0,0x70,0x0F,0x00,0x01,0xF9,0xFF,0x10,0x83,0xFF,
+0x06,0x00,0x00,0xC0,0x00,0x03,0xFF,0x82,0x08,0x07,0xC0,0x70,0x1E,0x00,0x00,0xF9,
+0xFF,0x11,0x80,0xFC,0x00,0x00,0x01,0xC0,0x00,0x00,0x0F,0x80,0x00,0x07,0xC0,0x70,
+0x3C,0x00,0x00,0x3F,0xFA,0xFF,0x11,0xF0,0xFC,0x30,0x18,0x7F,0xC3,0x0F,0xF0,0x0F,
+0xF0,0x00,0x07,0xF8,0x70,0x38,0x00,0x00,0x1F,0xFA,0xFF,0x11,0xF0,0x78,0x30,0x18,
+0x7F,0x83,0x0F,0xF0,0x0F,0xF0,0x00,0x07,0xF8,0x70,0x70,0x00,0x00,0x1F,0xFA,0xFF,
+0x11,0x80,0x1C,0x30,0x18,0x7E,0x00,0x0F,0x80,0x0C,0x00,0x00,0x06,0x18,0x70,0x60,
+0x00,0x00,0x0F,0xFA,0xFF,0x11,0x86,0x08,0x3E,0x1F,0xFE,0x00,0x0F,0x80,0x0C,0x06,
+0x0F,0x86,0x18,0x70,0xE0,0x07,0xE0,0x07,0xFA,0xFF,0x11,0x86,0x08,0x3E,0x1F,0xFE,
+0x00,0x0F,0x80,0x0C,0x06,0x0F,0x86,0x18,0x70,0xC0,0x1F,0xF0,0x07,0xFA,0xFF,0x11,
+0x86,0x0C,0x30,0x03,0x0E,0x00,0x0C,0x00,0x00,0x06,0x1F,0x86,0x00,0x70,0xC0,0x3F,
+0xF8,0x07,0xFA,0xFF,0x11,0x86,0x0F,0xF0,0xC3,0x06,0x00,0x0C,0x10,0x61,0xFE,0x0F,
+0xFF,0xC0,0x71,0xC0,0x7F,0xFC,0x03,0xFA,0xFF,0x11,0x86,0x0F,0xF0,0xC3,0x06,0x00,
+0x0C,0x10,0x61,0xFE,0x0F,0xFF,0xC0,0x71,0xC0,0x7F,0xFC,0x03,0xFA,0xFF,0x11,0x86,
+0x00,0x30,0xC0,0x0E,0x00,0x0C,0x30,0x61,0x80,0x1C,0x06,0x00,0x71,0x80,0x7F,0xFE,
+0x03,0xFA,0xFF,0x11,0xFE,0x00,0x3F,0xF8,0x3F,0xF8,0x7F,0xF0,0x7F,0x80,0x08,0x06,
+0x18,0x71,0x80,0x7F,0xFE,0x03,0xFA,0xFF,0x11,0xFE,0x00,0x3F,0xF8,0x7F,0xF8,0x7F,
+0xF0,0x7F,0x80,0x08,0x06,0x18,0x71,0x80,0x7F,0xFE,0x03,0xFA,0xFF,0x07,0x80,0x00,
+0x30,0xF8,0x00,0x18,0x61,0xF8,0xFD,0x00,0x05,0x18,0x71,0x80,0x7F,0xFE,0x03,0xFA,
+0xFF,0x11,0x80,0x0F,0xF0,0xF8,0x00,0x18,0x61,0xFE,0x00,0x30,0x01,0xF0,0xFF,0xF1,
+0xC0,0x7F,0xFC,0x03,0xFA,0xFF,0x11,0x80,0x0F,0xF0,0xF8,0x00,0x18,0x61,0xFF,0x00,
+0x30,0x01,0xF0,0xFF,0xF1,0xC0,0x3F,0xFC,0x03,0xFA,0xFF,0x11,0x80,0x03,0xF0,0x18,
+0x00,0x00,0x61,0xC7,0x00,0x30,0x01,0xF0,0xF8,0x70,0xC0,0x3F,0xF8,0x07,0xFA,0xFF,
+0x11,0xF0,0x01,0xFE,0x1F,0xE0,0x00,0x61,0x83,0xFF,0xFE,0x0F,0xF0,0xF8,0x70,0xC0,
+0x1F,0xF0,0x07,0xFA,0xFF,0x11,0xF0,0x01,0xFE,0x1F,0xE0,0x00,0x61,0x83,0xFF,0xFE,
+0x0F,0xF0,0xF8,0x70,0xE0,0x07,0xC0,0x0F,0xFA,0xFF,0x11,0xF0,0x00,0x70,0x03,0x80,
+0x00,0x61,0x83,0xFF,0xC6,0x00,0x70,0x00,0x70,0x60,0x00,0x00,0x0F,0xFA,0xFF,0x11,
+0xF0,0x00,0x30,0x03,0x00,0x00,0xE1,0xC7,0xFF,0x86,0x00,0x38,0x00,0x70,0x70,0x00,
+0x00,0x1F,0xFA,0xFF,0x11,0xF0,0x0C,0x30,0xC3,0x00,0x1F,0xE1,0xFF,0xFF,0x86,0x00,
+0x3E,0x00,0x70,0x38,0x00,0x00,0x3F,0xFA,0xFF,0x11,0xC0,0x08,0x30,0x03,0x00,0x1F,
+0x81,0xC0,0xF3,0x86,0x00,0x0E,0x00,0x70,0x1C,0x00,0x00,0x7F,0xFA,0xFF,0x10,0x80,
+0x0C,0x70,0x03,0x80,0x1F,0x01,0x80,0x61,0x86,0x00,0x07,0x00,0x70,0x0E,0x00,0x00,
+0xF9,0xFF,0x10,0x80,0x0F,0xFE,0x1F,0xFE,0x1F,0x0F,0x80,0x61,0x86,0x00,0x07,0xF8,
+0x70,0x07,0x80,0x01,0xF9,0xFF,0x10,0x80,0x0F,0xFE,0x0F,0xFE,0x1F,0x07,0x80,0x41,
+0x82,0x00,0x07,0xF8,0x70,0x03,0xE0,0x0F,0xF9,0xFF,0x09,0x80,0x1F,0x80,0x03,0x06,
+0x18,0x00,0x00,0x01,0x80,0xFE,0x00,0x01,0x70,0x01,0xF7,0xFF,0x0F,0xF0,0xFF,0x80,
+0xC3,0x06,0x18,0x00,0x00,0x0F,0x80,0xF8,0x30,0x03,0xF0,0x00,0x7F,0xF8,0xFF,0x0F,
+0xF0,0x7F,0x80,0xC3,0x06,0x18,0x00,0x00,0x0F,0x80,0x78,0x30,0x03,0xF0,0x00,0x3F,
+0xF8,0xFF,0x04,0x80,0x01,0x80,0xC0,0x0E,0xFE,0x00,0x07,0x0C,0x00,0x00,0x30,0x00,
+0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x86,0x01,0xFF,0xF8,0x7E,0x03,0x00,0x10,0x0C,0x00,
+0x00,0x30,0xF8,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x86,0x01,0xFF,0xF8,0x7C,0x03,0x00,
+0x10,0x0C,0x00,0x00,0x30,0xF8,0x70,0x00,0x3F,0xF8,0xFF,0x08,0x86,0x00,0x30,0x00,
+0x70,0x03,0x00,0x00,0x0C,0xFE,0x00,0x03,0x18,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x87,
+0xF8,0x30,0x00,0x60,0x1F,0xE0,0x00,0x0C,0x30,0x00,0x00,0x18,0x70,0x00,0x3F,0xF8,
+0xFF,0x0F,0x87,0xF8,0x30,0x00,0x60,0x1F,0xE0,0x00,0x0C,0x30,0x00,0x00,0x18,0x70,
+0x00,0x3F,0xF8,0xFF,0x09,0x87,0xFC,0x30,0x00,0x00,0x18,0x60,0x00,0x00,0x30,0xFE,
+0x00,0x02,0x70,0x00,0x3F,0xF5,0xFF,0x0C,0xC0,0x00,0x18,0x61,0xF0,0x61,0xF0,0xFF,
+0x06,0x00,0x70,0x00,0x3F,0xF5,0xFF,0x0C,0xC0,0x00,0x18,0x61,0xF0,0x61,0xF0,0xFF,
+0x86,0x00,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x38,
+0x61,0xF0,0xE3,0x86,0x00,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x80,0x00,0x00,0xC0,0x20,
+0x80,0x7C,0x1F,0xFF,0xF0,0xC1,0x86,0x00,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x80,0x00,
+0x00,0xC0,0x60,0xC0,0x7C,0x1F,0xFF,0xF0,0xC1,0x86,0x00,0x70,0x00,0x3F,0xF8,0xFF,
+0x0F,0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x1C,0x30,0xC1,0x86,0x00,0x70,0x00,
+0x3F,0xF8,0xFF,0x0F,0x83,0xFF,0xE0,0xC1,0x04,0x10,0x60,0x80,0x0C,0x30,0xFF,0x87,
+0xC1,0xF0,0x00,0x3F,0xF8,0xFF,0x0F,0x87,0xFF,0xF0,0xC3,0x06,0x18,0x61,0x80,0x0C,
+0x30,0xFF,0x87,0xC3,0xF0,0x00,0x3F,0xF8,0xFF,0x0F,0x87,0x00,0x70,0xC3,0x06,0x00,
+0x01,0x80,0x0C,0x00,0x00,0x01,0xC3,0xF0,0x00,0x3F,0xF8,0xFF,0x08,0x86,0x00,0x30,
+0xE7,0x8E,0x00,0x01,0xC0,0x0C,0xFE,0x00,0x03,0xE7,0xF0,0x00,0x3F,0xF8,0xFF,0x08,
+0x86,0x00,0x30,0xFF,0xFF,0xC0,0x01,0xFF,0x0C,0xFE,0x00,0x03,0xFF,0xF0,0x00,0x3F,
+0xF8,0xFF,0x07,0x86,0x00,0x30,0xFF,0x80,0x00,0x01,0xFA,0xFD,0x00,0x03,0x3F,0xF0,
+0x00,0x3F,0xF8,0xFF,0x07,0x86,0x00,0x30,0xFF,0x00,0x00,0x01,0xF0,0xFD,0x00,0x03,
+0x1F,0xF0,0x00,0x3F,0xF8,0xFF,0x0F,0x86,0x00,0x30,0xFF,0x00,0x00,0x7F,0xF0,0x00,
+0x3F,0xC0,0x00,0x1F,0xF0,0x00,0x3F,0xF8,0xFF,0x0F,0x86,0x00,0x30,0xFF,0x00,0x00,
+0x7F,0xF0,0x00,0x3F,0xC0,0x00,0x1F,0xF0,0x00,0x3F,0xF8,0xFF,0x09,0x86,0x00,0x30,
+0xC3,0x00,0x00,0x0F,0x80,0x00,0x06,0xFE,0x00,0x02,0x70,0x00,0x3F,0xF8,0xFF,0x0F,
+0x86,0x00,0x30,0xC3,0x00,0xF8,0x0F,0x80,0x61,0x86,0x08,0x3F,0xC0,0x70,0x00,0x3F,
+0xF8,0xFF,0x0F,0x86,0x00,0x30,0xC3,0x00,0xF8,0x0F,0x80,0x61,0x86,0x08,0x3F,0xC0,
+0x70,0x00,0x3F,0xF8,0xFF,0x07,0x87,0x00,0x30,0xC0,0x00,0x18,0x01,0x80,0xFD,0x00,
+0x03,0xC0,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x87,0xFF,0xF0,0xC0,0x00,0x18,0x61,0x80,
+0x0C,0x30,0x00,0x00,0xF8,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x87,0xFF,0xF0,0xC0,0x00,
+0x18,0x61,0x80,0x0C,0x30,0x00,0x00,0xF8,0x70,0x00,0x3F,0xF8,0xFF,0x0F,0x80,0x00,
+0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0xF8,0x70,0x00,0x3F,0xF8,0xFF,
+0x0F,0x80,0x00,0x00,0xC0,0x60,0xC3,0xE0,0x10,0x01,0xFE,0x08,0x3F,0xFF,0xF0,0x00,
+0x3F,0xF8,0xFF,0x0F,0x80,0x00,0x00,0xC0,0x60,0xC3,0xE0,0x10,0x01,0xFE,0x08,0x3F,
+0xFF,0xF0,0x00,0x3F,0xF8,0xFF,0x0F,0x80,0x00,0x00,0xC0,0x70,0xC3,0xE0,0x38,0x01,
+0xFE,0x1C,0x3F,0xFF,0xF0,0x00,0x3F,0xEB,0xFF,0x02,0xF0,0x00,0x3F,0xEB,0xFF,0x02,
+0xF0,0x00,0x3F,0xEB,0xFF,0x02,0xF0,0x00,0x3F,0xF4,0xFF,0x00,0xF8,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xF0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xE0,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xC0,0xF7,0x00,0xF3,
+0xFF,0x00,0xC0,0xF8,0x00,0x02,0x03,0xE0,0x0F,0xF5,0xFF,0x00,0xC0,0xF8,0x00,0x02,
+0x07,0x80,0x03,0xF5,0xFF,0x00,0xC0,0xF8,0x00,0x02,0x0E,0x00,0x00,0xF5,0xFF,0x00,
+0xC0,0xF8,0x00,0x03,0x1C,0x00,0x00,0x7F,0xF6,0xFF,0x00,0xC0,0xF8,0x00,0x03,0x38,
+0x00,0x00,0x3F,0xF6,0xFF,0x01,0xC0,0x3F,0xFD,0xFF,0x00,0xC0,0xFE,0x00,0x03,0x70,
+0x00,0x00,0x1F,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xE0,0xFE,0x00,0x03,0x70,
+0x00,0x00,0x0F,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0xE0,
+0x01,0x80,0x0F,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0xC0,
+0x0F,0xE0,0x07,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0xC0,
+0x1F,0xF8,0x07,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0xC0,
+0x3F,0xFC,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0xC0,
+0x7F,0xFC,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0x80,
+0x7F,0xFC,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0x80,
+0x7F,0xFE,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0x80,
+0x7F,0xFE,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0x80,
+0x7F,0xFE,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0xC0,
+0x7F,0xFC,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0xC0,
+0x7F,0xFC,0x03,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x07,0xF0,0x00,0x00,0x01,0xC0,
+0x3F,0xFC,0x07,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0xC0,
+0x1F,0xF8,0x07,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0xE0,
+0x0F,0xE0,0x07,0xF6,0xFF,0x01,0xC0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x60,
+0x03,0x80,0x0F,0xF6,0xFF,0x01,0xC0,0x3F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x70,
+0x00,0x00,0x1F,0xF6,0xFF,0x01,0xC0,0x3F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x38,
+0x00,0x00,0x1F,0xF6,0xFF,0x01,0xC0,0x1F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x3C,
+0x00,0x00,0x3F,0xF6,0xFF,0x01,0xC0,0x07,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x1E,
+0x00,0x00,0x7F,0xF6,0xFF,0x01,0xC0,0x01,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x02,0x0F,
+0x00,0x01,0xF5,0xFF,0x01,0xE0,0x00,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x02,0x07,0xC0,
+0x07,0xF5,0xFF,0x02,0xF0,0x00,0x3F,0xFE,0xFF,0x00,0xF0,0xFE,0x00,0x02,0x01,0xFC,
+0x7F,0xF5,0xFF,0x02,0xF0,0x00,0x0F,0xFE,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x7F,0xF4,
+0xFF,0x02,0xFC,0x00,0x07,0xFE,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x3F,0xF3,0xFF,0x01,
+0x00,0x01,0xFE,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x3F,0xF3,0xFF,0x05,0x80,0x00,0x7F,
+0xFF,0xFF,0xF0,0xFD,0x00,0x00,0x3F,0xF3,0xFF,0x05,0xE0,0x00,0x3F,0xFF,0xFF,0xF0,
+0xFD,0x00,0x00,0x3F,0xF3,0xFF,0x05,0xF8,0x00,0x0F,0xFF,0xFF,0xF0,0xFD,0x00,0x00,
+0x3F,0xF3,0xFF,0x05,0xFC,0x00,0x07,0xFF,0xFF,0xF0,0xFD,0x00,0x00,0x3F,0xF2,0xFF,
+0x04,0x00,0x01,0xFF,0xFF,0xF0,0xFD,0x00,0x00,0x3F,0xF2,0xFF,0x04,0xC0,0x00,0x7F,
+0xFF,0xF0,0xFD,0x00,0x00,0x3F,0xF2,0xFF,0x04,0xE0,0x00,0x3F,0xFF,0xF0,0xFD,0x00,
+0x00,0x3F,0xF2,0xFF,0x04,0xF8,0x00,0x0F,0xFF,0xF0,0xFD,0x00,0x00,0x3F,0xF2,0xFF,
+0x04,0xFE,0x00,0x03,0xFF,0xF0,0xFD,0x00,0x00,0x3F,0xF1,0xFF,0x03,0x00,0x01,0xFF,
+0xF0,0xFD,0x00,0x00,0x3F,0xF1,0xFF,0x03,0xC0,0x00,0x7F,0xF0,0xFD,0x00,0x00,0x3F,
+0xF1,0xFF,0x03,0xE0,0x00,0x3F,0xF0,0xFD,0x00,0x00,0x3F,0xF1,0xFF,0x03,0xF8,0x00,
+0x0F,0xF0,0xFD,0x00,0x00,0x3F,0xF1,0xFF,0x03,0xFE,0x00,0x07,0xF0,0xFD,0x00,0x00,
+0x3F,0xF0,0xFF,0x02,0x00,0x01,0xF0,0xFD,0x00,0x00,0x3F,0xF0,0xFF,0x00,0xC0,0xFB,
+0x00,0x00,0x3F,0xF0,0xFF,0x00,0xF0,0xFB,0x00,0x00,0x3F,0xF0,0xFF,0x00,0xF8,0xFB,
+0x00,0x00,0x3F,0xF0,0xFF,0x00,0xFE,0xFB,0x00,0x00,0x3F,0xEF,0xFF,0x00,0x80,0xFC,
+0x00,0x00,0x3F,0xEF,0xFF,0x00,0xC0,0xFC,0x00,0x00,0x3F,0xEF,0xFF,0x00,0xF0,0xFC,
+0x00,0x00,0x3F,0xEF,0xFF,0x00,0xFC,0xFC,0x00,0x00,0x3F,0xEF,0xFF,0x00,0xFE,0xFC,
+0x00,0x00,0x3F,0xEE,0xFF,0x05,0x80,0x00,0x00,0x70,0x00,0x3F,0xEE,0xFF,0x05,0xE0,
+0x00,0x00,0x70,0x00,0x3F,0xED,0xFF,0x04,0x00,0x03,0xF0,0x00,0x3F,0xEB,0xFF,0x02,
+0xF0,0x00,0x3F,0x97,0xFF,
+};
+
+// fourth : 5000 bytes, packed 1425
+const unsigned char fourth_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0xA0,0xFF,0x00,0xE3,0xE9,0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x01,
+0xFC,0x01,0xEA,0xFF,0x01,0xFC,0x01,0xE9,0xFF,0x00,0xE1,0xEA,0xFF,0x01,0xF0,0x07,
+0xEA,0xFF,0x00,0xE1,0xE9,0xFF,0x01,0xF0,0x07,0xEA,0xFF,0x01,0xF0,0x07,0xE9,0xFF,
+0x00,0xE1,0xEA,0xFF,0x01,0xFC,0x01,0xF7,0xFF,0x00,0xCF,0xF5,0xFF,0x01,0xE0,0x1F,
+0xF7,0xFF,0x00,0xCF,0xF5,0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x00,0xE3,0xF7,0xFF,0x01,
+0xFE,0x0F,0xF5,0xFF,0x00,0xE3,0xE9,0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x01,0xE0,0x1F,
+0xEA,0xFF,0x01,0xFC,0x01,0xE9,0xFF,0x00,0xE1,0xF8,0xFF,0x01,0xF0,0x0F,0xF5,0xFF,
+0x01,0xF0,0x07,0xF8,0xFF,0x01,0xF0,0x0F,0xF5,0xFF,0x01,0xF0,0x07,0xF8,0xFF,0x01,
+0xE0,0x0F,0xF5,0xFF,0x00,0xE1,0xF7,0xFF,0x01,0xC0,0x0F,0xF5,0xFF,0x01,0xF0,0x07,
+0xE9,0xFF,0x00,0xE1,0xE9,0xFF,0x00,0xE1,0xEA,0xFF,0x01,0xFC,0x01,0xF9,0xFF,0x02,
+0xFE,0x00,0x0F,0xF5,0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x00,0xE3,0xE9,0xFF,0x00,0xE3,
+0xEB,0xFF,0x02,0x01,0xCF,0xE3,0xEB,0xFF,0x03,0x3D,0xEF,0xE0,0x1F,0xF9,0xFF,0x00,
+0xE0,0xF6,0x00,0x04,0x03,0x3D,0xEF,0xFC,0x01,0xF9,0xFF,0x00,0xC0,0xF6,0x00,0x04,
+0x03,0x3D,0xEF,0xFF,0xE1,0xF9,0xFF,0x00,0xC0,0xF6,0x00,0x04,0x03,0x3D,0xEF,0xFF,
+0xE1,0xF9,0xFF,0x00,0xC0,0xF6,0x00,0x04,0x03,0x3C,0x1F,0xF0,0x07,0xEA,0xFF,0x00,
+0xE1,0xF9,0xFF,0x00,0xFE,0xF5,0x00,0x04,0x03,0xFF,0xFF,0xF0,0x07,0xFA,0xFF,0x00,
+0xFE,0xF5,0x00,0x04,0x03,0xFF,0xFF,0xF0,0x07,0xE9,0xFF,0x00,0xE1,0xEA,0xFF,0x01,
+0xFC,0x01,0xEA,0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x01,0xE0,0x1F,0xEC,0xFF,0x02,0x3F,
+0xFF,0xE3,0xEB,0xFF,0x01,0x3F,0x0F,0xF8,0xFF,0x00,0x80,0xF5,0x00,0x04,0x03,0x3C,
+0x3F,0xFF,0xF1,0xFA,0xFF,0x00,0x80,0xF5,0x00,0x04,0x03,0x3C,0x3F,0xFF,0xF1,0xFA,
+0xFF,0x00,0x80,0xF5,0x00,0x04,0x03,0x21,0xFF,0xFF,0xF1,0xFB,0xFF,0x00,0xFE,0xF4,
+0x00,0x01,0x03,0x0F,0xF8,0xFF,0x00,0xFC,0xF4,0x00,0x01,0x03,0x3F,0xF8,0xFF,0x00,
+0xFC,0xF4,0x00,0x01,0x03,0x3F,0xE7,0xFF,0x02,0xFC,0x0F,0x7F,0xFC,0xFF,0x00,0xF8,
+0xF4,0x00,0x05,0x03,0xFF,0xFF,0xE0,0x01,0x1F,0xEB,0xFF,0x02,0xE3,0xF1,0x1F,0xEB,
+0xFF,0x02,0xE3,0xF1,0x1F,0xEB,0xFF,0x02,0xF3,0xF7,0x1F,0xFC,0xFF,0x00,0xC0,0xF4,
+0x00,0x05,0x03,0xF3,0xFF,0xE0,0x00,0x1F,0xFC,0xFF,0x00,0x80,0xF4,0x00,0x05,0x03,
+0xE3,0xFF,0xE0,0x00,0x7F,0xFD,0xFF,0x00,0xFE,0xF3,0x00,0x01,0x03,0xCF,0xF9,0xFF,
+0x00,0xFE,0xF3,0x00,0x01,0x03,0xCF,0xF9,0xFF,0x00,0xFC,0xF3,0x00,0x02,0x03,0x00,
+0x0F,0xE8,0xFF,0x01,0xFC,0x0F,0xEA,0xFF,0x01,0xF0,0x07,0xEA,0xFF,0x01,0xF0,0x07,
+0xFC,0xFF,0x00,0xE0,0xF3,0x00,0x04,0x03,0xFF,0xFF,0xE3,0xF1,0xFC,0xFF,0x00,0xE0,
+0xF3,0x00,0x04,0x03,0xFF,0xFF,0xE3,0xF1,0xEA,0xFF,0x01,0xF0,0x07,0xEA,0xFF,0x01,
+0xF0,0x07,0xFC,0xFF,0x00,0x80,0xF3,0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0xEC,0xFF,
+0x01,0xE0,0x3F,0xEA,0xFF,0x01,0xDF,0xDF,0xEA,0xFF,0x01,0xDF,0xDF,0xEA,0xFF,0x03,
+0x3F,0xEF,0xFC,0x0F,0xEC,0xFF,0x03,0x3F,0xEF,0xF0,0x07,0xFD,0xFF,0x00,0xF0,0xF2,
+0x00,0x04,0x03,0xDF,0xDF,0xE3,0xF1,0xFD,0xFF,0x00,0xF0,0xF2,0x00,0x04,0x03,0xDF,
+0xDF,0xE3,0xF1,0xEC,0xFF,0x03,0xE0,0x3F,0xE3,0xF1,0xEA,0xFF,0x01,0xF0,0x07,0xFD,
+0xFF,0x00,0x80,0xF2,0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0xFD,0xFF,0x00,0x80,0xF2,
+0x00,0x04,0x03,0xFF,0xFF,0xFC,0x0F,0xFD,0xFF,0x00,0x80,0xF2,0x00,0x00,0x03,0xCF,
+0xFF,0x03,0xE0,0x1F,0xF0,0x0F,0xEC,0xFF,0x03,0xDD,0xCF,0xE0,0x01,0xEC,0xFF,0x03,
+0xDD,0xCF,0xE0,0x01,0xFE,0xFF,0x00,0xF8,0xF1,0x00,0x04,0x03,0x3D,0xEF,0xE3,0xF1,
+0xEC,0xFF,0x03,0x3D,0xEF,0xF3,0xF1,0xEC,0xFF,0x03,0xCC,0xCE,0x00,0x01,0xEC,0xFF,
+0x03,0xCC,0xCE,0x00,0x01,0xFE,0xFF,0x00,0x80,0xF1,0x00,0x04,0x03,0xFE,0x1E,0x00,
+0x01,0xFE,0xFF,0xF0,0x00,0x00,0x03,0xB3,0xFF,0x00,0x1F,0xE9,0xFF,0x03,0x1F,0xFF,
+0xFF,0xF8,0xEE,0x00,0x05,0x0F,0xFF,0x1F,0xFF,0xFF,0xF8,0xEE,0x00,0x02,0x0F,0xFF,
+0x1F,0xE6,0xFF,0x00,0xF8,0xEE,0x00,0x02,0x0F,0xF0,0x0F,0xEA,0xFF,0x01,0xE0,0x01,
+0xEA,0xFF,0x01,0xE0,0x01,0xEA,0xFF,0x01,0xE3,0xF1,0xFE,0xFF,0xF0,0x00,0x04,0x03,
+0xFF,0xFF,0xF3,0xF1,0xFE,0xFF,0x00,0x80,0xF1,0x00,0x04,0x03,0xFF,0xFE,0x00,0x01,
+0xFE,0xFF,0x00,0x80,0xF1,0x00,0x04,0x03,0xFF,0xFE,0x00,0x01,0xEC,0xFF,0x03,0xE0,
+0x3E,0x00,0x01,0xEC,0xFF,0x01,0xDF,0xDF,0xFC,0xFF,0x00,0xF0,0xF1,0x00,0x02,0x03,
+0x3F,0xEF,0xEA,0xFF,0x03,0x3F,0xEE,0x20,0x01,0xEC,0xFF,0x03,0x3F,0xEE,0x20,0x01,
+0xEC,0xFF,0x03,0xDF,0xDE,0x20,0x01,0xEC,0xFF,0x01,0xE0,0x3F,0xFB,0xFF,0x00,0x80,
+0xF2,0x00,0x04,0x03,0xFF,0xFF,0xF0,0xEF,0xFD,0xFF,0x00,0x80,0xF2,0x00,0x04,0x03,
+0xFF,0xFF,0xF0,0xEF,0xFD,0xFF,0x00,0x80,0xF2,0x00,0x04,0x03,0xFF,0xFF,0xE0,0x67,
+0xFD,0xFF,0x00,0xC0,0xF2,0x00,0x04,0x03,0xFF,0xFF,0xE2,0x71,0xEA,0xFF,0x01,0xE2,
+0x11,0xEA,0xFF,0x01,0xE2,0x11,0xEC,0xFF,0x03,0x3F,0xFF,0xE1,0x01,0xFD,0xFF,0x00,
+0xFC,0xF2,0x00,0x04,0x03,0x3F,0x0F,0xF1,0x07,0xEC,0xFF,0x00,0x3C,0xE9,0xFF,0x00,
+0x3C,0xE9,0xFF,0x04,0x21,0xFF,0xE0,0x00,0x1F,0xED,0xFF,0x04,0x0F,0xFF,0xE0,0x00,
+0x1F,0xFD,0xFF,0x00,0x80,0xF3,0x00,0x04,0x03,0xFF,0xFF,0xE3,0xF7,0xFC,0xFF,0x00,
+0x80,0xF3,0x00,0x04,0x03,0xFF,0xFF,0xE3,0xF7,0xEA,0xFF,0x01,0xE3,0xF1,0xEA,0xFF,
+0x01,0xE0,0x01,0xEA,0xFF,0x01,0xF0,0x0F,0xEA,0xFF,0x01,0xF0,0x0F,0xD2,0xFF,0x00,
+0xDF,0xFC,0xFF,0x00,0xF8,0xF1,0x00,0x04,0x03,0x01,0xEE,0x00,0x01,0xFE,0xFF,0x00,
+0xF8,0xF1,0x00,0x04,0x03,0x33,0xEE,0x00,0x01,0xFE,0xFF,0x00,0xF8,0xF1,0x00,0x04,
+0x03,0x33,0xEE,0x00,0x01,0xFE,0xFF,0x00,0xF8,0xF1,0x00,0x02,0x03,0x33,0xEF,0xFC,
+0xFF,0x00,0xF8,0xF1,0x00,0x02,0x03,0x31,0xCF,0xEA,0xFF,0x03,0x3C,0x1F,0xF1,0x87,
+0xEC,0xFF,0x03,0x3C,0x1F,0xF1,0x87,0xEA,0xFF,0x01,0xE3,0x01,0xFE,0xFF,0x00,0xF8,
+0xF1,0x00,0x04,0x03,0xFF,0xFF,0xE3,0x71,0xEA,0xFF,0x01,0xE2,0x77,0xEA,0xFF,0x01,
+0xE2,0x77,0xFB,0xFF,0x00,0xFE,0xF4,0x00,0x04,0x03,0xFF,0xFF,0xE0,0x01,0xFA,0xFF,
+0x00,0x80,0xF5,0x00,0x04,0x03,0xFF,0xFF,0xF0,0x01,0xFA,0xFF,0x00,0x80,0xF5,0x00,
+0x02,0x03,0xCF,0x0F,0xF8,0xFF,0x00,0x80,0xF5,0x00,0x02,0x03,0xCF,0x0F,0xF8,0xFF,
+0x00,0xC0,0xF5,0x00,0x05,0x03,0x3F,0x2F,0xE3,0xFF,0x1F,0xFB,0xFF,0x00,0xE0,0xF5,
+0x00,0x05,0x03,0x3E,0xEF,0xE0,0x1F,0x1F,0xFB,0xFF,0x00,0xF8,0xF5,0x00,0x05,0x03,
+0x3D,0xEF,0xFC,0x00,0x1F,0xFB,0xFF,0x00,0xF8,0xF5,0x00,0x05,0x03,0x3D,0xEF,0xFC,
+0x00,0x1F,0xED,0xFF,0x04,0xC3,0xEF,0xFF,0xE0,0x7F,0xEB,0xFF,0x01,0xFC,0x01,0xEA,
+0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x01,0xE0,0x1F,0xF9,0xFF,0x00,0x80,0xF6,0x00,0x03,
+0x03,0xFF,0xFF,0xE3,0xDF,0xFF,0x00,0xC0,0xF6,0x00,0x04,0x03,0xC2,0x1F,0xFF,0xF1,
+0xF9,0xFF,0x00,0xE0,0xF6,0x00,0x04,0x03,0xDC,0xCF,0xFF,0xF1,0xF9,0xFF,0x00,0xE0,
+0xF6,0x00,0x04,0x03,0xDC,0xCF,0xFF,0xF1,0xF9,0xFF,0x00,0xF0,0xF6,0x00,0x02,0x03,
+0x3D,0xEF,0xEA,0xFF,0x01,0x3D,0xEF,0xEA,0xFF,0x03,0xDC,0xCF,0xFC,0x0F,0xEC,0xFF,
+0x03,0xDC,0xCF,0xFC,0x0F,0xEC,0xFF,0x03,0xC2,0x1F,0xF0,0x01,0xF9,0xFF,0x02,0xFE,
+0x00,0x0F,0xF5,0xFF,0x01,0xE3,0xF1,0xEA,0xFF,0x01,0xE3,0xF1,0xEA,0xFF,0x01,0xE3,
+0xF1,0xEA,0xFF,0x01,0xE1,0xE1,0xF8,0xFF,0x01,0xE0,0x0F,0xF5,0xFF,0x01,0xF1,0xE7,
+0xF8,0xFF,0x01,0xE0,0x0F,0xEA,0xFF,0x01,0xE0,0x0F,0xEA,0xFF,0x01,0xF0,0x0F,0xF5,
+0xFF,0x01,0xFC,0x0F,0xEA,0xFF,0x01,0xF0,0x07,0xEA,0xFF,0x01,0xE3,0xF1,0xEA,0xFF,
+0x01,0xE3,0xF1,0xEA,0xFF,0x01,0xE3,0xF1,0xF7,0xFF,0x00,0x0F,0xF5,0xFF,0x01,0xF0,
+0x07,0xEA,0xFF,0x01,0xFC,0x0F,0xEA,0xFF,0x01,0xFC,0x0F,0xF7,0xFF,0x00,0xCF,0xE9,
+0xFF,0x00,0xEF,0xDC,0xFF,0x01,0xE0,0x01,0xEA,0xFF,0x01,0xE0,0x01,0xEA,0xFF,0x01,
+0xE0,0x01,0xEA,0xFF,0x00,0xF3,0xE9,0xFF,0x00,0xE3,0xE9,0xFF,0x01,0xE0,0x01,0xEA,
+0xFF,0x01,0xE0,0x01,0xEA,0xFF,0x01,0xF0,0x01,0xEA,0xFF,0x00,0xF3,0xE9,0xFF,0x00,
+0xE3,0xE9,0xFF,0x00,0xE3,0xE9,0xFF,0x01,0xE0,0x01,0xEA,0xFF,0x01,0xF0,0x01,0xB5,
+0xFF,
+};
+
+// fifth : 5000 bytes, packed 2155
+const unsigned char fifth_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x81,0xFF,0x81,0xFF,0xD8,0xFF,0x00,0x8F,0xE9,0xFF,0x00,0xA7,
+0xE9,0xFF,0x00,0xB7,0xE9,0xFF,0x00,0xF7,0xE9,0xFF,0x00,0xF7,0xE9,0xFF,0x00,0xEF,
+0xE9,0xFF,0x00,0xEF,0xE9,0xFF,0x00,0xDF,0xE9,0xFF,0x00,0x9F,0xE9,0xFF,0x00,0x3F,
+0xEA,0xFF,0x01,0xFC,0x7F,0xEA,0xFF,0x01,0xE0,0x1F,0xEA,0xFF,0x01,0x8F,0xC7,0xF3,
+0xFF,0x00,0xE7,0xF9,0xFF,0x01,0x3F,0xF3,0xF4,0xFF,0x01,0xFC,0x01,0xFA,0xFF,0x02,
+0xFC,0x7F,0xF9,0xF4,0xFF,0x01,0xFC,0x00,0xFA,0xFF,0x02,0xFD,0xFF,0x1D,0xF4,0xFF,
+0x01,0xFE,0x00,0xFA,0xFF,0x02,0xF9,0xFE,0x4C,0xF3,0xFF,0x01,0x80,0x7F,0xFB,0xFF,
+0x02,0xF3,0xFE,0xCC,0xF3,0xFF,0x01,0xE2,0x7F,0xFB,0xFF,0x02,0xF3,0xFE,0xFC,0xF2,
+0xFF,0x00,0x7F,0xFB,0xFF,0x02,0xE7,0xFE,0xFD,0xEB,0xFF,0x02,0xE7,0xFE,0x7B,0xF2,
+0xFF,0x00,0x7F,0xFB,0xFF,0x02,0xE7,0xFF,0x07,0xF2,0xFF,0x00,0x7F,0xFB,0xFF,0x00,
+0xE7,0xF1,0xFF,0x02,0xFE,0x00,0x7F,0xFC,0xFF,0x00,0xE7,0xF1,0xFF,0x02,0xF8,0x1C,
+0x0F,0xFC,0xFF,0x00,0xE7,0xF1,0xFF,0x03,0xF1,0xFF,0x87,0xC7,0xFD,0xFF,0x00,0xE7,
+0xF1,0xFF,0x08,0xE3,0xFF,0xE1,0xCB,0xFF,0xFF,0xFC,0x07,0xE7,0xF1,0xFF,0x08,0xCF,
+0xFF,0xF8,0xCF,0xFF,0xFF,0xF1,0xE3,0xE7,0xF1,0xFF,0x08,0x9F,0xFF,0xFC,0x7F,0xFF,
+0xFF,0xF7,0xF8,0xE7,0xF1,0xFF,0x08,0x1F,0xFF,0xFE,0x3B,0xFF,0xFF,0xEF,0xFE,0x67,
+0xF2,0xFF,0x0A,0xFE,0x3F,0xFF,0xFF,0x07,0xFF,0xFF,0xEF,0xFE,0x60,0x3F,0xF3,0xFF,
+0x0A,0xFE,0x7F,0xFF,0xFF,0x8F,0xFF,0xFF,0xDF,0xFF,0x23,0xBF,0xF3,0xFF,0x0A,0xFE,
+0x7F,0xFF,0xFF,0xCF,0xFF,0xFF,0xDF,0xCF,0x87,0x9F,0xF3,0xFF,0x0A,0xFC,0x7F,0xFF,
+0xFF,0xCF,0xFF,0xFF,0xDF,0xA7,0x87,0xDF,0xF3,0xFF,0x00,0xFC,0xFE,0xFF,0x06,0xE7,
+0xFF,0xFF,0xDF,0xF7,0xC7,0x9F,0xF3,0xFF,0x00,0xFC,0xFE,0xFF,0x06,0xE7,0xFF,0xFF,
+0xEF,0xF7,0xC6,0xBF,0xF3,0xFF,0x00,0xF8,0xFE,0xFF,0x06,0xE7,0xFF,0xFF,0xE7,0xEF,
+0xC6,0x7F,0xF3,0xFF,0x00,0xF8,0xFE,0xFF,0x05,0xE7,0xFF,0xFF,0xF1,0x8F,0xC7,0xF2,
+0xFF,0x00,0xF8,0xFE,0xFF,0x07,0xE7,0xFF,0xFF,0xF8,0x3F,0xC7,0xFC,0x7F,0xF4,0xFF,
+0x00,0xE0,0xFE,0xFF,0x01,0xE6,0x3F,0xFE,0xFF,0x02,0xCF,0xFF,0x83,0xF4,0xFF,0x05,
+0x90,0xFF,0x9F,0xFF,0xE6,0x7F,0xFE,0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x04,0xB8,
+0xFE,0x07,0xFF,0xE2,0xFD,0xFF,0x02,0x8F,0xFF,0x03,0xF4,0xFF,0x05,0xAC,0xFE,0x03,
+0xFF,0xE3,0xBF,0xFE,0xFF,0x01,0x9F,0xFC,0xF3,0xFF,0x05,0xC4,0xFC,0x01,0xFF,0xC0,
+0x3F,0xFE,0xFF,0x02,0x1F,0xFF,0x03,0xF4,0xFF,0x04,0xCC,0x7C,0x00,0xFF,0xC4,0xFD,
+0xFF,0x02,0x3F,0xFF,0xFC,0xF4,0xFF,0x04,0xFE,0x7E,0x00,0x7F,0x87,0xFE,0xFF,0x03,
+0xFE,0x3F,0xFF,0x83,0xF4,0xFF,0x04,0xFE,0x7E,0x00,0x3F,0x0F,0xFE,0xFF,0x03,0xFE,
+0x7F,0xFC,0x7F,0xF4,0xFF,0x04,0xFE,0x3E,0x00,0x0C,0x0F,0xFE,0xFF,0x03,0xFC,0xFF,
+0xFC,0x7F,0xF3,0xFF,0x03,0x3F,0x00,0x00,0x1F,0xFE,0xFF,0x03,0xF8,0xFF,0xFF,0x83,
+0xF3,0xFF,0x03,0x1F,0x00,0x00,0x3F,0xFE,0xFF,0x03,0xF1,0xFF,0xFF,0xFC,0xF3,0xFF,
+0x03,0x8F,0x80,0x00,0x7F,0xFE,0xFF,0x03,0xE3,0xFF,0xFF,0x03,0xF3,0xFF,0x02,0xC7,
+0xE0,0x00,0xFD,0xFF,0x02,0x87,0xFF,0xFC,0xF2,0xFF,0x0A,0xE3,0xF8,0x07,0xFF,0xEF,
+0xFF,0xFF,0x0F,0xFF,0xFF,0x03,0xF3,0xFF,0x00,0xF1,0xFE,0xFF,0x06,0xF0,0x07,0xFE,
+0x1F,0xFF,0xFF,0xFC,0xF3,0xFF,0x01,0xF8,0x7F,0xFE,0xFF,0x05,0xF1,0xF8,0x3F,0xFF,
+0xFF,0x83,0xF3,0xFF,0x01,0xFC,0x1F,0xFE,0xFF,0x05,0xFC,0xE0,0x7F,0xFF,0xFC,0x7F,
+0xF2,0xFF,0x00,0x07,0xFD,0xFF,0x04,0x00,0x7F,0xFF,0xFC,0x7F,0xF2,0xFF,0x09,0x80,
+0x7F,0xFF,0xFF,0xF8,0x02,0x7F,0xFF,0xFF,0x83,0xF2,0xFF,0x05,0xE0,0x03,0xFF,0xFE,
+0x00,0x0E,0xFE,0xFF,0x00,0xFC,0xF2,0xFF,0x00,0xF8,0xFD,0x00,0x04,0x7E,0xFE,0x03,
+0xFF,0x03,0xF2,0xFF,0x00,0xF0,0xFE,0x00,0x04,0x01,0xFE,0x78,0x07,0xFC,0xF4,0xFF,
+0x03,0x8F,0xFF,0xFF,0x80,0xFE,0x00,0x05,0x1F,0xFF,0x70,0x1F,0xFF,0x03,0xF5,0xFF,
+0x0C,0xE1,0xFF,0xFC,0x1F,0xFF,0xC0,0x07,0xFF,0xFF,0x80,0x3F,0xFF,0xFC,0xF5,0xFF,
+0x0C,0xFC,0x3F,0xE0,0xFF,0xFF,0x00,0x7F,0xFF,0xFF,0x80,0x7F,0xFF,0x83,0xF4,0xFF,
+0x04,0x0F,0x07,0xFF,0xFE,0x03,0xFE,0xFF,0x03,0xE0,0xFF,0xFC,0x7F,0xF4,0xFF,0x04,
+0xF0,0x1F,0xFF,0xFC,0x0F,0xFE,0xFF,0x00,0xFB,0xF4,0xFF,0x07,0xF0,0x0F,0xFF,0xFC,
+0x7F,0xFF,0xF8,0x3F,0xF0,0xFF,0x06,0xC0,0x07,0xFF,0xF1,0xFF,0xFF,0xE0,0xFA,0xFF,
+0x00,0xFC,0xF7,0xFF,0x06,0xBC,0x03,0xFF,0xE3,0xFE,0xFF,0xE1,0xEE,0xFF,0x05,0x81,
+0xFF,0xCF,0xFE,0xFF,0xC7,0xEE,0xFF,0x05,0xC0,0xFF,0x9F,0xFC,0xFF,0x8F,0xFA,0xFF,
+0x01,0x03,0x9F,0xF7,0xFF,0x08,0xE0,0x7F,0x3F,0xF9,0xFF,0x0F,0xFF,0xC0,0x0F,0xFE,
+0xFF,0x02,0xFE,0xFD,0xCF,0xF7,0xFF,0x08,0xF0,0x7E,0x7F,0xF3,0xFF,0x1F,0xFF,0x00,
+0x01,0xFE,0xFF,0x02,0xFC,0xFC,0xCF,0xF7,0xFF,0x0E,0xF8,0x3C,0xFF,0xE7,0xFE,0x3F,
+0xFC,0x33,0xF8,0x7F,0xFF,0xFF,0xFC,0xFC,0xCF,0xF7,0xFF,0x0E,0xFC,0x09,0xFF,0xCF,
+0xFE,0x7F,0xF8,0xF3,0xFE,0x3F,0xFF,0xFF,0xFE,0x78,0x8F,0xF6,0xFF,0x0D,0xC3,0xFF,
+0xDF,0xFC,0x7F,0xF1,0xF1,0xFF,0x8F,0xFF,0xFF,0xFC,0x00,0x3F,0xF8,0xFF,0x0A,0xC3,
+0xFF,0xF3,0xFF,0xFF,0xFC,0xFF,0xE3,0xF9,0xFF,0xC7,0xF3,0xFF,0x0A,0x00,0x7F,0xE1,
+0xFF,0xFF,0xFC,0xFF,0xC7,0xFF,0xFF,0xE7,0xF4,0xFF,0x0B,0xFC,0x00,0x1F,0xC0,0xFF,
+0xFF,0xF8,0xFF,0xC7,0xFF,0xFF,0xF3,0xFE,0xFF,0x00,0x03,0xF8,0xFF,0x0F,0xF8,0x00,
+0x07,0x08,0x3F,0xFF,0xF9,0xFF,0x8F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0xFD,0xF8,0xFF,
+0x0F,0xE0,0x00,0x00,0x0C,0x0F,0xFF,0xF9,0xFF,0x8F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFC,
+0xFC,0xF9,0xFF,0x10,0xFB,0x80,0x00,0x00,0x1C,0x03,0xFF,0xF9,0xFF,0x1F,0xFF,0xFF,
+0xFC,0xFF,0xFF,0xFC,0xFC,0xF9,0xFF,0x00,0xF8,0xFE,0x00,0x0C,0x1E,0x01,0xFF,0xF1,
+0xFF,0x1F,0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0xFD,0xF9,0xFF,0x00,0xFC,0xFE,0x00,0x0C,
+0x0F,0x01,0xFF,0xF1,0xFF,0x1F,0xFF,0xFF,0xFC,0xC7,0xFF,0xFF,0x03,0xF9,0xFF,0x00,
+0xFE,0xFE,0x00,0x09,0x07,0x80,0xFF,0xF1,0xFF,0x1F,0xFF,0xFF,0xFE,0x33,0xF5,0xFF,
+0xFE,0x00,0x09,0x03,0xC0,0xFF,0xF1,0xFF,0x1F,0xFF,0xFF,0xFE,0x7B,0xF5,0xFF,0x0F,
+0x80,0x00,0x00,0x03,0xF0,0xFF,0xF1,0xFF,0x0F,0xFF,0xFF,0xFE,0x63,0xFF,0xFF,0x03,
+0xF8,0xFF,0x0F,0xE0,0x00,0x00,0x01,0xF8,0x7F,0xF1,0xFF,0x0F,0xFF,0xFF,0xFE,0xF7,
+0xFF,0xFE,0xFD,0xF8,0xFF,0x00,0xFE,0xFE,0x00,0x0B,0xF8,0x7F,0xF9,0xFF,0x07,0xFF,
+0xFF,0xFE,0xFF,0xFF,0xFC,0xFC,0xF8,0xFF,0x00,0xFC,0xFE,0x00,0x0B,0x7C,0x7F,0xF9,
+0xFF,0x03,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFC,0xF8,0xFF,0x00,0xC0,0xFE,0x00,0x0B,
+0x3C,0xFF,0xF8,0xFF,0x00,0x7F,0xFF,0xFC,0xFF,0xFF,0xFE,0xFD,0xF8,0xFF,0x00,0xE0,
+0xFE,0x00,0x07,0x3C,0xFF,0xF8,0xFF,0x80,0x00,0x3F,0xFD,0xFE,0xFF,0x00,0x03,0xF8,
+0xFF,0x00,0xF8,0xFE,0x00,0x07,0x1C,0xFF,0xFC,0xFF,0x80,0x00,0x1F,0xF9,0xF4,0xFF,
+0x00,0xFC,0xFE,0x00,0x07,0x1D,0xFF,0xFC,0x7F,0xC0,0x00,0x1F,0xF9,0xF3,0xFF,0x0A,
+0x80,0x00,0x00,0x1D,0xFF,0xFE,0x3F,0xC0,0x00,0x1F,0xFB,0xFE,0xFF,0x00,0x03,0xF8,
+0xFF,0x0F,0xDF,0x30,0x00,0x00,0x1F,0xFF,0xFE,0x3F,0xE0,0x00,0x1F,0xF3,0xFF,0xFF,
+0xFC,0xFD,0xF8,0xFF,0x0F,0x80,0xF0,0x00,0x00,0x1F,0xFF,0xFF,0x1F,0xF0,0x00,0x1F,
+0xE7,0xFF,0xFF,0xFC,0xFC,0xF7,0xFF,0x0E,0xE0,0x40,0x00,0x1F,0xFF,0xFF,0x8F,0xF8,
+0x00,0x3F,0xE7,0xFF,0xFF,0xFC,0xFC,0xF7,0xFF,0x0E,0xC0,0xC0,0x00,0x1F,0xFF,0xFF,
+0xC7,0xFE,0x00,0x7F,0xCF,0xFF,0xFF,0xFE,0x79,0xF8,0xFF,0x0F,0xF3,0x31,0xC0,0x00,
+0x3F,0xFF,0xFF,0xC3,0xFF,0xE7,0xFF,0x9F,0xFF,0xFF,0xC0,0x00,0xF8,0xFF,0x07,0xF0,
+0xF1,0x80,0x40,0x3F,0xFF,0xFF,0xC0,0xFE,0xFF,0x00,0x3F,0xF3,0xFF,0x0A,0xFB,0xA0,
+0xC0,0x3F,0xFF,0xFF,0xDC,0x7F,0xFF,0xFE,0x7F,0xFE,0xFF,0x00,0xCF,0xF7,0xFF,0x09,
+0xFB,0xB0,0xE0,0x3F,0xFF,0xFF,0xDE,0x1F,0xFF,0xF8,0xFD,0xFF,0x00,0xCF,0xF7,0xFF,
+0x09,0xFB,0xB8,0xE0,0x3F,0xFF,0xFF,0xDF,0x83,0xFF,0xC1,0xFD,0xFF,0x00,0xCF,0xF7,
+0xFF,0x09,0xFB,0xBC,0x70,0x3F,0xFF,0xFF,0xDF,0xE0,0x00,0x07,0xFD,0xFF,0x00,0xCF,
+0xF7,0xFF,0x09,0xF9,0x9F,0x78,0x3F,0xFF,0xFF,0xDF,0xFC,0x00,0x1F,0xF2,0xFF,0x08,
+0xF9,0xDF,0xFC,0x1F,0xFF,0xFF,0xDF,0xFF,0xF8,0xF1,0xFF,0x08,0xF9,0xCF,0xFF,0x1F,
+0xFF,0xFF,0xDF,0xFF,0xFC,0xFC,0xFF,0x00,0x03,0xF6,0xFF,0x00,0xEF,0xFB,0xFF,0x01,
+0xFE,0x7F,0xFE,0xFF,0x01,0xFC,0xFD,0xEE,0xFF,0x00,0x7F,0xFE,0xFF,0x01,0xFC,0xFC,
+0xEE,0xFF,0x00,0x7F,0xFE,0xFF,0x01,0xFC,0xFC,0xEF,0xFF,0x00,0xFE,0xFD,0xFF,0x01,
+0xFE,0x79,0xEF,0xFF,0x00,0xFE,0xFD,0xFF,0x01,0xC0,0x00,0xF7,0xFF,0x00,0x7F,0xFA,
+0xFF,0x00,0xFD,0xF1,0xFF,0x00,0x7F,0xFA,0xFF,0x00,0xF1,0xF2,0xFF,0x00,0xFE,0xF9,
+0xFF,0x00,0xC3,0xFD,0xFF,0x01,0xCC,0x00,0xF8,0xFF,0x00,0xFE,0xF9,0xFF,0x00,0x03,
+0xF2,0xFF,0x00,0xFC,0xF9,0xFF,0x00,0x03,0xF2,0xFF,0x00,0xFD,0xFA,0xFF,0x01,0xFE,
+0x07,0xFD,0xFF,0x01,0xFE,0x19,0xF8,0xFF,0x00,0xF9,0xFA,0xFF,0x01,0xFE,0x0F,0xFD,
+0xFF,0x01,0xFC,0x9C,0xF8,0xFF,0x00,0xF9,0xFA,0xFF,0x01,0xFE,0x1F,0xFD,0xFF,0x01,
+0xFC,0xCC,0xF8,0xFF,0x00,0xF3,0xFA,0xFF,0x01,0xFE,0x3F,0xFD,0xFF,0x01,0xFC,0xC4,
+0xF8,0xFF,0x00,0xE3,0xFA,0xFF,0x01,0xFE,0x7F,0xFD,0xFF,0x01,0xFE,0x61,0xF8,0xFF,
+0x00,0xE3,0xFA,0xFF,0x01,0xFE,0x7F,0xF2,0xFF,0x00,0xC3,0xE9,0xFF,0x00,0x83,0xF4,
+0xFF,0x02,0xFC,0x00,0x0F,0xFA,0xFF,0x01,0xFE,0x03,0xF4,0xFF,0x01,0xFE,0x79,0xF9,
+0xFF,0x01,0xFC,0x01,0xF4,0xFF,0x01,0xFC,0xFC,0xF9,0xFF,0x01,0xF8,0x00,0xF4,0xFF,
+0x01,0xFC,0xFC,0xF9,0xFF,0x01,0xF0,0x00,0xF4,0xFF,0x01,0xFC,0xFC,0xF9,0xFF,0x02,
+0xF0,0x00,0x7F,0xF4,0xFF,0x00,0x01,0xF9,0xFF,0x02,0xF0,0x00,0x3F,0xEB,0xFF,0x02,
+0xE0,0x00,0x1F,0xEB,0xFF,0x02,0xE0,0x00,0x1F,0xF5,0xFF,0x01,0xC0,0x00,0xF9,0xFF,
+0x02,0xE0,0x00,0x0F,0xEB,0xFF,0x02,0xE0,0x00,0x0F,0xEB,0xFF,0x02,0xE0,0x00,0x07,
+0xF5,0xFF,0x01,0xFE,0x61,0xF9,0xFF,0x02,0xF0,0x00,0x03,0xF5,0xFF,0x01,0xFC,0xCC,
+0xF9,0xFF,0x02,0xF0,0x00,0x03,0xF5,0xFF,0x01,0xFC,0xCC,0xF9,0xFF,0x02,0xF0,0x00,
+0x01,0xF5,0xFF,0x01,0xFC,0x9C,0xF9,0xFF,0x02,0xF0,0x00,0x00,0xF5,0xFF,0x01,0xFC,
+0x99,0xF9,0xFF,0x05,0xF0,0x00,0x00,0xFF,0xFE,0x07,0xF8,0xFF,0x01,0xFE,0x00,0xF9,
+0xFF,0x05,0xE0,0x00,0x00,0x7F,0xF0,0x07,0xEE,0xFF,0x05,0xC0,0x00,0x00,0x7F,0xC0,
+0x07,0xF8,0xFF,0x00,0xFC,0xF8,0xFF,0xFE,0x00,0x03,0x3E,0x00,0x00,0x7F,0xF8,0xFF,
+0x01,0x1F,0xCF,0xFB,0xFF,0x00,0xF8,0xFE,0x00,0x03,0x38,0x00,0x00,0x7F,0xF8,0xFF,
+0x01,0xE3,0x8F,0xFB,0xFF,0x00,0xC0,0xFB,0x00,0x00,0x7F,0xF8,0xFF,0x01,0xFC,0x3F,
+0xFC,0xFF,0x00,0xFE,0xFA,0x00,0xF7,0xFF,0x00,0xE3,0xFB,0xFF,0x00,0xF0,0xFA,0x00,
+0xF7,0xFF,0x00,0x1F,0xFB,0xFF,0x00,0xC0,0xFA,0x00,0x00,0x7F,0xF9,0xFF,0x00,0xFC,
+0xFB,0xFF,0x00,0xFE,0xF9,0x00,0x00,0x3F,0xF2,0xFF,0x00,0xF8,0xF9,0x00,0x00,0x3F,
+0xF2,0xFF,0x00,0xE0,0xF9,0x00,0x00,0x3F,0xF8,0xFF,0x00,0xFC,0xFC,0xFF,0x00,0x80,
+0xF9,0x00,0x00,0x7F,0xF3,0xFF,0x00,0xFE,0xF8,0x00,0xF2,0xFF,0x00,0xFC,0xF8,0x00,
+0xF7,0xFF,0x00,0x03,0xFD,0xFF,0x00,0xF8,0xF8,0x00,0x00,0x3F,0xF9,0xFF,0x01,0xFC,
+0xFC,0xFD,0xFF,0x00,0xE0,0xF8,0x00,0x00,0x3F,0xF9,0xFF,0x01,0xFC,0xFC,0xFD,0xFF,
+0x00,0xC0,0xF8,0x00,0x00,0x3F,0xF9,0xFF,0x01,0xFC,0xFC,0xFD,0xFF,0x00,0x80,0xF8,
+0x00,0x00,0x7F,0xF9,0xFF,0x01,0xFE,0x79,0xFD,0xFF,0x00,0x80,0xF8,0x00,0xF2,0xFF,
+0xFC,0x00,0x00,0x7C,0xFE,0x00,0x00,0x01,0xF3,0xFF,0x00,0xFE,0xFD,0x00,0x01,0x01,
+0xFE,0xFE,0x00,0x00,0x01,0xF7,0xFF,0x00,0x03,0xFE,0xFF,0x00,0xFE,0xFD,0x00,0x02,
+0x0F,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x01,0xFE,0xFD,0xFE,0xFF,0x00,0xFC,0xFD,0x00,
+0x05,0x7F,0xFF,0xC0,0x00,0x00,0x01,0xF8,0xFF,0x01,0xFC,0xFC,0xFE,0xFF,0x0A,0xFC,
+0x00,0x07,0xFC,0x7F,0xFF,0xFF,0xF0,0x00,0x00,0x03,0xF8,0xFF,0x01,0xFC,0xFC,0xFD,
+0xFF,0x00,0x87,0xFC,0xFF,0x03,0xFE,0x00,0x00,0x07,0xF8,0xFF,0x01,0xFE,0xFD,0xF6,
+0xFF,0x02,0xE0,0x00,0x0F,0xF7,0xFF,0x00,0x03,0xF5,0xFF,0x01,0xC1,0xDF,0xC6,0xFF,
+0x01,0xFC,0x00,0xEA,0xFF,0x01,0xFE,0x7F,0xEA,0xFF,0x00,0xFC,0xE9,0xFF,0x00,0xFC,
+0xE9,0xFF,0x01,0xFE,0x00,0xEA,0xFF,0x01,0xFE,0x7F,0xEA,0xFF,0x00,0xFC,0xE9,0xFF,
+0x00,0xFC,0xE9,0xFF,0x01,0xFE,0x00,0x81,0xFF,0x85,0xFF,
+};
+
+// sixth : 5000 bytes, packed 2341
+const unsigned char sixth_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x81,0xFF,0x81,0xFF,0x9D,0xFF,0x00,0xC7,0xE9,0xFF,0x00,0xE7,
+0xF4,0xFF,0x01,0xF8,0x7F,0xF8,0xFF,0x00,0xF3,0xF4,0xFF,0x01,0xF8,0x01,0xF8,0xFF,
+0x02,0xF1,0xFF,0x7F,0xF5,0xFF,0x00,0xE1,0xF8,0xFF,0x02,0xF9,0xFF,0x3F,0xF5,0xFF,
+0x00,0x83,0xF9,0xFF,0x03,0xFE,0x00,0xF9,0x3F,0xF5,0xFF,0x00,0x1F,0xF8,0xFF,0x02,
+0x00,0x7C,0xBF,0xF5,0xFF,0x00,0x81,0xF8,0xFF,0x02,0x3E,0x3E,0x3F,0xF5,0xFF,0x00,
+0xE1,0xF9,0xFF,0x03,0xFE,0x7F,0x3F,0x1F,0xF6,0xFF,0x01,0xF8,0x01,0xF9,0xFF,0x03,
+0xFC,0xFF,0x1F,0xDF,0xF6,0xFF,0x00,0xF9,0xF7,0xFF,0x02,0x8F,0x8F,0xCF,0xF6,0xFF,
+0x01,0xF8,0x7F,0xF8,0xFF,0x02,0xC3,0xCF,0xEF,0xF9,0xFF,0x04,0xFE,0x7C,0xFF,0xF8,
+0x01,0xF8,0xFF,0x02,0xE1,0xC3,0xE7,0xF9,0xFF,0x04,0xFD,0xFE,0x7F,0xFF,0xE1,0xF8,
+0xFF,0x02,0xF8,0x60,0xF7,0xF9,0xFF,0x04,0xF9,0xDE,0x7F,0xFF,0x83,0xF8,0xFF,0x02,
+0xFC,0x3C,0x33,0xF9,0xFF,0x04,0xFD,0xCE,0x7F,0xFF,0x1F,0xF8,0xFF,0x02,0xFE,0x0F,
+0x03,0xF9,0xFF,0x04,0xFC,0x00,0xFF,0xFF,0x81,0xF9,0xFF,0x03,0xFB,0xFC,0x07,0xC1,
+0xF8,0xFF,0x03,0xF1,0xFF,0xFF,0xE1,0xF9,0xFF,0x04,0xF9,0xF1,0xE1,0xF0,0x7F,0xF7,
+0xFF,0x01,0xF8,0x01,0xF9,0xFF,0x04,0xFC,0xF7,0xF0,0xFE,0x1F,0xF7,0xFF,0x01,0xF8,
+0x7F,0xF9,0xFF,0x04,0xFE,0x7F,0xFC,0x3F,0x80,0xF9,0x00,0x03,0x01,0xFF,0xF8,0x01,
+0xF8,0xFF,0x04,0x1F,0xFE,0x1F,0xFF,0xF3,0xF7,0xFF,0x00,0xE1,0xF8,0xFF,0x04,0x8F,
+0xFF,0x07,0xFF,0xF1,0xF7,0xFF,0x00,0x83,0xF9,0xFF,0x05,0xE0,0x00,0xFF,0xC0,0xFF,
+0xF8,0xF7,0xFF,0x00,0x1F,0xF8,0xFF,0x03,0xC0,0x01,0xF0,0x0F,0xF9,0x00,0x03,0x01,
+0xFF,0xFF,0x81,0xF7,0xFF,0x01,0xE0,0x1C,0xF8,0x00,0x03,0x03,0xFF,0xFF,0xE1,0xFA,
+0xFF,0x06,0xFC,0x7F,0xE7,0xFF,0x00,0x00,0x07,0xF8,0xFF,0x01,0xF8,0x01,0xF9,0xFF,
+0x03,0x0F,0xF8,0x3F,0xE0,0xF9,0x00,0x03,0x0F,0xFF,0xFF,0xF9,0xF8,0xFF,0x04,0xC3,
+0xFF,0x02,0x01,0x80,0xFA,0x00,0x00,0x0D,0xF5,0xFF,0x04,0xF0,0x7F,0x80,0x1F,0xFC,
+0xFA,0x00,0x02,0x0D,0xFE,0x7F,0xF7,0xFF,0x05,0xFC,0x1C,0x01,0xFF,0xFF,0xC0,0xFB,
+0x00,0x01,0x0D,0xF0,0xF5,0xFF,0x04,0x00,0x3C,0x00,0x07,0xFE,0xFB,0x00,0x04,0x0D,
+0xC3,0xFF,0xFF,0xF1,0xF9,0xFF,0x05,0xFC,0x03,0xFF,0x80,0x00,0x07,0xFB,0xFF,0x04,
+0xFC,0x1F,0xFF,0xFF,0xE1,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xF9,0x00,0x04,0x0C,
+0x7F,0xFF,0xFF,0xF1,0xFA,0xFF,0x05,0xFE,0x03,0xFF,0xFF,0xFE,0x0E,0xFA,0x00,0x00,
+0x0F,0xF6,0xFF,0x06,0xF0,0x3F,0xFF,0xEF,0xFC,0x1F,0xFE,0xFB,0x00,0x00,0x0F,0xF6,
+0xFF,0x05,0xC7,0xE3,0xFF,0xF3,0xF8,0x7F,0xEE,0xFF,0x04,0xEF,0xF8,0xFF,0xF9,0xF9,
+0xED,0xFF,0x05,0xDF,0xFE,0x3F,0xFC,0x07,0xFE,0xFA,0x00,0x05,0x0F,0x9E,0xFF,0xFE,
+0x22,0x3F,0xFB,0xFF,0x03,0xDF,0xFF,0x8F,0xC0,0xF8,0x00,0x05,0x0C,0x1E,0x7F,0xF8,
+0x00,0x1F,0xFB,0xFF,0x02,0xF8,0x3F,0xC0,0xFE,0x00,0x00,0x7F,0xFB,0xFF,0x05,0xFD,
+0x9E,0x7F,0xF9,0xC9,0x9F,0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x01,0xFA,0xFF,0x05,
+0xFD,0x9E,0x7F,0xF9,0xC9,0x9F,0xFA,0xFF,0x04,0xE0,0x04,0x00,0x20,0xFC,0xFA,0x00,
+0x05,0x0D,0xC0,0xFF,0xF9,0x89,0x9F,0xFA,0xFF,0x04,0xFE,0x3F,0x1F,0xF0,0x3F,0xF9,
+0xFF,0x04,0xF3,0xFF,0xF8,0x18,0x1F,0xFA,0xFF,0x03,0xFE,0x7F,0xFF,0xF8,0xF9,0x00,
+0x05,0x0F,0xFF,0xFF,0xF9,0xFC,0x3F,0xFA,0xFF,0x04,0xFC,0xFF,0xC0,0x00,0x01,0xED,
+0xFF,0x00,0xF9,0xFE,0xFF,0x00,0x80,0xFA,0x00,0x00,0x0F,0xF5,0xFF,0x04,0xF9,0xFF,
+0xFF,0x1F,0xE0,0xFA,0x00,0x04,0x0F,0xFF,0xFF,0xFC,0x03,0xF6,0xFF,0x01,0x1F,0xF0,
+0xFA,0x00,0x04,0x0D,0xFF,0xFF,0xF8,0x01,0xF6,0xFF,0x00,0x8F,0xF9,0xFF,0x04,0xFD,
+0xFF,0xFF,0xF9,0xF9,0xF8,0xFF,0x03,0xEF,0xFF,0x87,0xE0,0xFA,0x00,0x04,0x0C,0x00,
+0x7F,0xF9,0xF9,0xF8,0xFF,0x02,0xF1,0xFF,0xC0,0xF9,0x00,0x04,0x0F,0xFF,0xFF,0xF9,
+0xF9,0xF8,0xFF,0x02,0xF8,0x7F,0xC0,0xF9,0x00,0x04,0x0F,0xFF,0xFF,0xF8,0x01,0xF8,
+0xFF,0x03,0xFE,0x1E,0x00,0x0F,0xF7,0xFF,0x01,0xFE,0x07,0xF7,0xFF,0x03,0x80,0x01,
+0xFF,0x0F,0xEC,0xFF,0x04,0xC0,0x0F,0xFF,0x87,0xF0,0xFC,0x00,0x01,0x0F,0x3F,0xF4,
+0xFF,0x04,0x9E,0x1F,0xFF,0xC1,0xF0,0xFC,0x00,0x04,0x0C,0x7C,0x7F,0xFC,0x03,0xF8,
+0xFF,0x05,0xBE,0x7E,0x3F,0xFF,0xE0,0xF0,0xFC,0x00,0x04,0x0D,0xF8,0x7F,0xF8,0x01,
+0xF8,0xFF,0x05,0x99,0xFC,0x7F,0xFF,0xC0,0x7F,0xFC,0xFF,0x04,0xF9,0xE2,0x7F,0xF9,
+0xF9,0xFA,0xFF,0x07,0xC7,0xFF,0xCF,0xF8,0xFF,0xFF,0x80,0x17,0xFC,0xFF,0x04,0x8C,
+0xCE,0x7F,0xF9,0xF9,0xFA,0xFF,0x06,0xF8,0x1F,0xE7,0xF9,0xFF,0xFE,0x06,0xFB,0x00,
+0x04,0x0C,0x1E,0x7F,0xF9,0xF9,0xF9,0xFF,0x05,0x80,0xF1,0xFF,0xFF,0xFC,0x1F,0xFB,
+0x00,0x04,0x0F,0xFF,0xFF,0xF8,0x01,0xF9,0xFF,0x06,0xF8,0x00,0xFF,0xFF,0xF8,0x3F,
+0x80,0xFC,0x00,0x04,0x0F,0xFF,0xFF,0xFE,0x07,0xF8,0xFF,0x05,0x80,0x0F,0xFF,0xE0,
+0xFF,0xC0,0xFC,0x00,0x00,0x0F,0xF4,0xFF,0x02,0xF8,0x00,0x7F,0xF6,0xFF,0x01,0xFE,
+0x03,0xF8,0xFF,0x02,0xF0,0x00,0x01,0xF9,0xFF,0x04,0xFE,0x7C,0xFF,0xFC,0x01,0xF8,
+0xFF,0x00,0x80,0xF7,0x00,0x04,0x0D,0xFE,0x7F,0xF9,0xF9,0xF9,0xFF,0x02,0xFC,0x03,
+0xF0,0xF8,0x00,0x04,0x09,0xDE,0x7F,0xF9,0xF9,0xF9,0xFF,0x02,0xE0,0x7F,0xFC,0xF8,
+0x00,0x04,0x0D,0xCE,0x7F,0xF9,0xF3,0xF9,0xFF,0x03,0x07,0xFF,0xFF,0x80,0xF9,0x00,
+0x04,0x0C,0x00,0xFF,0x80,0x01,0xF9,0xFF,0x03,0x7F,0xFF,0xFF,0x80,0xF9,0x00,0x04,
+0x0F,0xF1,0xFF,0x80,0x01,0xF7,0xFF,0x00,0xFC,0xF8,0x00,0x00,0x0F,0xF3,0xFF,0x00,
+0xC0,0xF8,0x00,0x00,0x0F,0xF6,0xFF,0x05,0xF3,0xFF,0xFE,0x00,0x01,0xDF,0xEE,0xFF,
+0x06,0xE0,0x7F,0xE0,0x00,0x0F,0xE0,0x1F,0xFB,0xFF,0x04,0xFE,0x7C,0xFF,0xFF,0x9F,
+0xFA,0xFF,0x07,0x87,0x0F,0x00,0x00,0xE0,0xFE,0x00,0x3F,0xFC,0xFF,0x04,0xFC,0xFE,
+0x7F,0xFF,0x9F,0xF9,0xFF,0x05,0x83,0x80,0x0F,0xF8,0x0F,0x80,0xFB,0x00,0x04,0x09,
+0xDE,0x7F,0xFF,0x9F,0xFB,0xFF,0x07,0xF8,0xFE,0x01,0xC0,0x70,0xFF,0x80,0x0F,0xFB,
+0x00,0x04,0x0D,0xCE,0x7F,0xFF,0x9F,0xFA,0xFF,0x06,0x00,0x3C,0xE7,0xF0,0x3F,0xF0,
+0x7F,0xFB,0xFF,0x04,0xFC,0x00,0xFF,0xFF,0x9F,0xFA,0xFF,0x05,0xC3,0xFE,0x7F,0xFC,
+0x0F,0xF1,0xF9,0xFF,0x00,0xF1,0xF7,0xFF,0x03,0xDF,0xF8,0x3F,0xFF,0xF8,0x00,0x00,
+0x0F,0xF5,0xFF,0x03,0xC0,0x1F,0xFF,0x80,0xF9,0x00,0x00,0x0F,0xF5,0xFF,0x03,0xDF,
+0xCF,0xFF,0xE0,0xF9,0x00,0x04,0x0F,0xFF,0xFF,0xFE,0x03,0xF9,0xFF,0x01,0xEF,0xE7,
+0xF4,0xFF,0x01,0xFC,0x01,0xF9,0xFF,0x01,0xF7,0xF3,0xF4,0xFF,0x01,0xF9,0xF9,0xF9,
+0xFF,0x01,0xF7,0xF9,0xF4,0xFF,0x01,0xF9,0xF9,0xFA,0xFF,0x02,0xFC,0xFB,0xFC,0xF6,
+0x00,0x03,0x01,0xFF,0xF9,0xF3,0xFA,0xFF,0x02,0xFE,0x79,0xFE,0xF6,0x00,0x03,0x03,
+0xFF,0x80,0x01,0xFA,0xFF,0x01,0xEE,0x3D,0xF3,0xFF,0x01,0x80,0x01,0xFA,0xFF,0x02,
+0xF0,0x1C,0xFE,0xF6,0x00,0x00,0x03,0xF7,0xFF,0x02,0xC1,0x80,0x70,0xF6,0x00,0x00,
+0x03,0xF7,0xFF,0x02,0xDF,0xC0,0x01,0xF4,0xFF,0x01,0xF9,0xF9,0xF9,0xFF,0x02,0xE0,
+0x00,0x7F,0xF5,0xFF,0x01,0xF9,0xF9,0xF9,0xFF,0x02,0xE0,0x00,0x03,0xF5,0xFF,0x01,
+0x99,0xF9,0xFB,0xFF,0x03,0xFD,0xFF,0x01,0xE0,0xF7,0x00,0x04,0x0F,0xFF,0xFF,0x88,
+0x01,0xFB,0xFF,0x03,0xFE,0x3C,0x07,0xFF,0xF7,0x00,0x04,0x0D,0xFF,0xFF,0x98,0x01,
+0xFA,0xFF,0x03,0x80,0x3F,0xFF,0xE0,0xF8,0x00,0x00,0x0D,0xFE,0xFF,0x00,0xF9,0xFA,
+0xFF,0x03,0xE0,0xFF,0xFF,0xE0,0xF8,0x00,0x04,0x0C,0x00,0x7F,0xFF,0xF9,0xFA,0xFF,
+0x03,0xC7,0xFF,0xFF,0xE0,0xF8,0x00,0x00,0x0F,0xF6,0xFF,0x03,0x9F,0xFF,0xFF,0xC0,
+0xF8,0x00,0x00,0x0F,0xF3,0xFF,0x00,0x80,0xF8,0x00,0x04,0x0F,0xFF,0xFF,0xFE,0x79,
+0xF7,0xFF,0x00,0x07,0xF5,0xFF,0x01,0xF8,0x39,0xFA,0xFF,0x03,0x7F,0xFF,0xFE,0x0B,
+0xF5,0xFF,0x01,0xF9,0x19,0xFA,0xFF,0x05,0x9F,0xFF,0xFC,0x18,0x7F,0xF0,0xFA,0x00,
+0x04,0x0F,0x01,0xFF,0xF9,0x99,0xFA,0xFF,0x05,0xEF,0xFF,0xF8,0x2F,0x1E,0x03,0xFA,
+0xFF,0x04,0xFC,0x78,0xFF,0xF9,0x89,0xFA,0xFF,0x05,0xF3,0xFF,0xF0,0x63,0xE0,0xFC,
+0xFA,0x00,0x04,0x0D,0xFE,0x7F,0xF9,0xC1,0xFA,0xFF,0x05,0xFC,0xFF,0xE1,0xF8,0x7F,
+0x80,0xFA,0x00,0x04,0x09,0xFE,0x7F,0xFF,0xE7,0xFA,0xFF,0x05,0xFE,0x78,0x03,0xFF,
+0x00,0x1F,0xFA,0xFF,0x01,0xFC,0xFE,0xF8,0xFF,0x06,0xF1,0xF8,0x00,0x0F,0xFF,0xC3,
+0xF0,0xFA,0x00,0x05,0x0E,0x01,0xFF,0xF8,0x00,0x1F,0xFC,0xFF,0x06,0xFC,0x40,0x07,
+0xFF,0xFF,0xFE,0x07,0xF9,0xFF,0x04,0x87,0xFF,0xF8,0x00,0x1F,0xFC,0xFF,0x01,0xFE,
+0x03,0xFE,0xFF,0x01,0xE0,0xFC,0xFA,0x00,0x04,0x0F,0xFF,0xFF,0xFC,0xF9,0xFB,0xFF,
+0x01,0xFE,0x3F,0xFE,0xFF,0x01,0xCF,0x81,0xF7,0xFF,0x01,0xF9,0xF9,0xFB,0xFF,0x01,
+0xF8,0xFD,0xFE,0xFF,0x01,0x38,0x1F,0xF7,0xFF,0x01,0xF9,0xF9,0xFB,0xFF,0x06,0xF3,
+0xFE,0x7F,0xFF,0xFE,0x61,0xF8,0xFA,0x00,0x04,0x0F,0xFF,0xFF,0xF8,0x03,0xF9,0xFF,
+0x04,0x3F,0xFF,0xFC,0xCD,0xF8,0xFA,0x00,0x04,0x0F,0xFC,0xFF,0xFC,0x07,0xFB,0xFF,
+0x06,0x7F,0xFF,0x9F,0xFF,0xF3,0x98,0x78,0xFA,0x00,0x02,0x0C,0x1E,0x7F,0xF9,0xFF,
+0x06,0x3F,0xFF,0xCF,0xFF,0xE7,0x3F,0x1F,0xFA,0xFF,0x02,0xFD,0x9E,0x7F,0xF9,0xFF,
+0x06,0x0F,0xFF,0xE7,0xFF,0xCE,0x5F,0xC7,0xFA,0xFF,0x04,0xFD,0x9E,0x7F,0x9F,0xF9,
+0xFB,0xFF,0x06,0x07,0xFF,0xF3,0xFF,0x3C,0x83,0xF0,0xFA,0x00,0x04,0x0D,0xC0,0xFF,
+0x9F,0xF9,0xFB,0xFF,0x06,0x03,0xFF,0xF8,0xFE,0x71,0xE0,0x7C,0xFA,0x00,0x04,0x0D,
+0xE1,0xFF,0x9F,0xF9,0xFB,0xFF,0x06,0xC1,0xFF,0xF8,0x7C,0xE3,0xFC,0x0F,0xF7,0xFF,
+0x01,0x80,0x01,0xFB,0xFF,0x05,0xE0,0xFF,0xFC,0x33,0xC7,0xFF,0xF9,0x00,0x04,0x0F,
+0xFF,0xFF,0x80,0x01,0xFB,0xFF,0x06,0xE0,0x7C,0x06,0x1F,0x8F,0xFF,0xE0,0xFA,0x00,
+0x00,0x0F,0xFE,0xFF,0x00,0xF9,0xFB,0xFF,0x04,0xF0,0x00,0x00,0x0F,0x1F,0xF8,0xFF,
+0x00,0xFD,0xFE,0xFF,0x00,0xF9,0xFB,0xFF,0x03,0xC0,0x00,0x00,0x01,0xF7,0xFF,0x02,
+0xFD,0xFC,0x7F,0xF9,0xFF,0x04,0x00,0x01,0xFE,0x00,0x7F,0xF8,0xFF,0x01,0xFD,0xF1,
+0xF8,0xFF,0x03,0x00,0x3F,0xFF,0xC0,0xF7,0x00,0x04,0x0D,0x87,0xFF,0xFD,0xC3,0xFB,
+0xFF,0x03,0x03,0xFF,0xFF,0xF8,0xF7,0x00,0x04,0x0C,0x1F,0xFF,0xF9,0x81,0xFB,0xFF,
+0x00,0x7F,0xFE,0xFF,0xF7,0x00,0x04,0x0C,0xFF,0xFF,0xF9,0x99,0xF7,0xFF,0xF7,0x00,
+0x04,0x0F,0xFF,0xFF,0xF9,0x99,0xF7,0xFF,0xF7,0x00,0x04,0x0F,0xFF,0xFF,0xF9,0x93,
+0xF7,0xFF,0xF7,0x00,0x04,0x0F,0x87,0xFF,0xF8,0x01,0xF8,0xFF,0x00,0xFE,0xF7,0x00,
+0x04,0x0E,0x00,0xFF,0xFE,0x01,0xF8,0xFF,0x00,0xFC,0xF7,0x00,0x01,0x0C,0xFE,0xF5,
+0xFF,0x01,0xF8,0x07,0xF8,0xFF,0x05,0xF9,0xFE,0x7F,0xFB,0xFF,0x9F,0xF9,0xFF,0x02,
+0xF8,0x0F,0xE0,0xF9,0x00,0x05,0x0D,0xFE,0x7F,0xF8,0x7F,0x9F,0xF9,0xFF,0x02,0xF0,
+0x1F,0xC0,0xF9,0x00,0x05,0x0C,0x78,0xFF,0xFC,0x0F,0x9F,0xF9,0xFF,0x02,0xE0,0x3F,
+0x87,0xF8,0xFF,0x04,0x01,0xFF,0xFF,0x80,0x3F,0xF9,0xFF,0x02,0xC0,0x7F,0x1F,0xF5,
+0xFF,0x01,0xF0,0x7F,0xF9,0xFF,0x02,0xC1,0xFE,0x30,0xF9,0x00,0x00,0x0F,0xFE,0xFF,
+0x00,0x81,0xF8,0xFF,0x02,0x83,0xFC,0x70,0xF9,0x00,0x04,0x0F,0xFF,0xFF,0xF8,0x0F,
+0xF8,0xFF,0x02,0x07,0xF8,0xE0,0xF9,0x00,0x04,0x0F,0xC1,0xFF,0xF8,0x7F,0xF9,0xFF,
+0x03,0xFE,0x09,0xF1,0xCF,0xF8,0xFF,0x02,0x0E,0xFF,0xFB,0xFA,0xFF,0x05,0xE3,0xFE,
+0x1C,0x18,0x23,0x88,0xF9,0x00,0x02,0x0E,0x1E,0x7F,0xF9,0xFF,0x05,0xC0,0x7F,0x00,
+0x3E,0x07,0x90,0xF9,0x00,0x02,0x0D,0x9E,0x7F,0xF9,0xFF,0x05,0x80,0x07,0xC0,0x7F,
+0xCF,0x30,0xF9,0x00,0x01,0x0F,0xCC,0xF8,0xFF,0x05,0x80,0x00,0x00,0x83,0xFE,0x38,
+0xF9,0x00,0x04,0x0F,0xE1,0xFF,0xFF,0xF1,0xFB,0xFF,0x05,0xF8,0x00,0x01,0x80,0x0C,
+0x70,0xF9,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xE1,0xFA,0xFF,0x04,0xC0,0x03,0xF8,0x00,
+0xE0,0xF9,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF1,0xFA,0xFF,0x05,0xFC,0x0F,0xFF,0xC0,
+0xE0,0x7F,0xEE,0xFF,0x05,0xFC,0x1F,0x3F,0xF1,0xC0,0xF0,0xF9,0x00,0x00,0x01,0xF7,
+0xFF,0x05,0xF0,0x3F,0x03,0xF3,0x81,0xE0,0xF9,0x00,0x00,0x03,0xF7,0xFF,0x05,0xC0,
+0x77,0xC0,0x23,0x03,0x8F,0xF6,0xFF,0x00,0x07,0xFA,0xFF,0x05,0x80,0xF1,0xFC,0x07,
+0x07,0x18,0xF9,0x00,0x03,0x03,0xFF,0xFC,0x03,0xFB,0xFF,0x06,0xFE,0x00,0xF8,0xFF,
+0x0E,0x0E,0x30,0xF9,0x00,0x03,0x01,0xFF,0xF8,0xF1,0xFB,0xFF,0x06,0xF8,0x19,0xFC,
+0x7F,0x1C,0x1C,0x63,0xF7,0xFF,0x01,0xF9,0xF9,0xFB,0xFF,0x06,0xF0,0x71,0xFF,0x1E,
+0x18,0x38,0xC7,0xF7,0xFF,0x01,0xF9,0xF9,0xFB,0xFF,0x06,0xC1,0xF3,0xFF,0x8C,0x30,
+0x73,0x8F,0xF7,0xFF,0x01,0xF9,0xF9,0xFB,0xFF,0x06,0x03,0xF3,0xFF,0xC6,0x70,0xC7,
+0x9F,0xF6,0xFF,0x00,0xF9,0xFB,0xFF,0x06,0x0F,0xF7,0xE0,0x03,0xFD,0x8F,0x3F,0xEF,
+0xFF,0x06,0x1F,0xEF,0xE0,0x00,0xEF,0x1E,0x7F,0xEF,0xFF,0x06,0x7F,0xEF,0xFF,0xF8,
+0x60,0x3C,0x7F,0xF7,0xFF,0x01,0xFC,0x03,0xF8,0xFF,0x02,0xFE,0x3F,0x78,0xF6,0xFF,
+0x01,0xF8,0x01,0xF8,0xFF,0x02,0x8F,0x0F,0xF1,0xF6,0xFF,0x01,0xF9,0xF9,0xF9,0xFF,
+0x03,0xFC,0x00,0x00,0x03,0xF6,0xFF,0x01,0xF9,0xF9,0xF8,0xFF,0x02,0xF0,0x00,0x07,
+0xF6,0xFF,0x01,0xF9,0xF9,0xF6,0xFF,0x00,0xCF,0xF6,0xFF,0x01,0xF8,0x01,0xF6,0xFF,
+0x00,0x8F,0xF6,0xFF,0x01,0xFE,0x07,0xF6,0xFF,0x00,0x1F,0xEA,0xFF,0x01,0xFE,0x3F,
+0xF6,0xFF,0x01,0xF8,0x01,0xF7,0xFF,0x01,0xFE,0x7F,0xF6,0xFF,0x01,0xF8,0x01,0xF7,
+0xFF,0x00,0xFC,0xF5,0xFF,0x00,0xF9,0xF6,0xFF,0x00,0xF9,0xF5,0xFF,0x00,0xF9,0xE9,
+0xFF,0x01,0xF8,0x01,0xEA,0xFF,0x00,0xF8,0xE9,0xFF,0x00,0xF9,0xE9,0xFF,0x01,0xF8,
+0x01,0x81,0xFF,0x84,0xFF,
+};
+
+// senventh : 5000 bytes, packed 2897
+const unsigned char senventh_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0xF5,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,
+0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,
+0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,
+0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,
+0xE9,0xFF,0x02,0xE7,0xFF,0xFD,0xFC,0xFF,0x01,0xC0,0x0F,0xF2,0xFF,0x09,0xE7,0xFF,
+0xFD,0xFF,0xFF,0xF0,0x03,0xFF,0xC0,0x0F,0xF2,0xFF,0x08,0xE7,0xFF,0xFC,0x00,0xFF,
+0xF0,0x03,0xFF,0xF9,0xF1,0xFF,0x08,0xE7,0xFF,0xFC,0x00,0xFF,0xF7,0x7B,0xFF,0xFB,
+0xF1,0xFF,0x09,0xE7,0xFF,0xFD,0xFF,0xFF,0xF7,0x7B,0xFF,0xF8,0x0F,0xF2,0xFF,0x09,
+0xE7,0xFF,0xFD,0xFF,0xFF,0xF7,0x7B,0xFF,0xFC,0x0F,0xF2,0xFF,0x08,0xE7,0xFF,0xFF,
+0xC1,0xFF,0xF7,0x7B,0xFF,0xFB,0xF1,0xFF,0x03,0xE7,0xFF,0xFF,0x80,0xFD,0xFF,0x01,
+0xE0,0x0F,0xFA,0xFF,0x00,0xC0,0xFD,0x00,0xFE,0xFF,0x09,0xE7,0xFF,0xFF,0xB4,0xFF,
+0xFF,0xEF,0xFF,0xE0,0x0F,0xFA,0xFF,0xFC,0x00,0x0C,0x3F,0xFF,0xFF,0xE7,0xFF,0xFF,
+0xB6,0xFF,0xFF,0xEF,0xFF,0xFB,0xEF,0xFB,0xFF,0x00,0xFE,0xFC,0x00,0x0B,0x1F,0xFF,
+0xFF,0xE7,0xFF,0xFF,0x84,0xFF,0xFF,0xEF,0xFF,0xFB,0xFA,0xFF,0x00,0xFC,0xFC,0x00,
+0x06,0x0F,0xFF,0xFF,0xE7,0xFF,0xFF,0xC5,0xFD,0xFF,0x01,0xE0,0x0F,0xFB,0xFF,0x00,
+0xFC,0xFC,0x00,0x03,0x0F,0xFF,0xFF,0xE7,0xFA,0xFF,0x01,0xE0,0x0F,0xFB,0xFF,0x00,
+0xFC,0xFC,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFF,0xFE,0x03,0xFF,0xFB,
+0xEF,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x09,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFF,
+0xFE,0x03,0xF8,0xFF,0x00,0xF8,0xFC,0x00,0x03,0x07,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,
+0xFE,0x7F,0xFF,0xF8,0x01,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x03,0x07,0xFF,0xFF,0xE7,
+0xFD,0xFF,0x04,0xFE,0x03,0xFF,0xF8,0x01,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x03,0x07,
+0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x03,0xFF,0xF9,0xCF,0xFB,0xFF,0x00,0xF8,0xFC,
+0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0x9C,0xFF,0xFE,0x7F,0xFF,0xF9,0xEF,0xFB,
+0xFF,0x02,0xF8,0x00,0x1C,0xFE,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0x9C,0xFF,
+0xFE,0x03,0xFF,0xF8,0x0F,0xFB,0xFF,0x02,0xF8,0x00,0xFC,0xFE,0x00,0x03,0x07,0xFF,
+0xFF,0xE7,0xFC,0xFF,0x03,0x03,0xFF,0xFC,0x1F,0xFB,0xFF,0x02,0xF8,0x03,0xFC,0xFE,
+0x00,0x06,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0xF5,0xFF,0x02,0xF8,0x07,0xFC,0xFE,
+0x00,0x09,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0xFF,0xFF,0x67,0xF8,0xFF,0x02,0xF8,
+0x0F,0xFC,0xFE,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0x83,0xFF,0xFE,0x43,0xFF,
+0xF9,0xCF,0xFB,0xFF,0x02,0xF8,0x0F,0xFC,0xFE,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,
+0xFF,0x83,0xFF,0xFE,0x9B,0xFF,0xF9,0xCF,0xFB,0xFF,0x02,0xF8,0x1F,0xFC,0xFE,0x00,
+0x09,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0xFF,0xFE,0xB3,0xF8,0xFF,0x02,0xF8,0x1F,
+0xF8,0xFE,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0xFF,0xFE,0x03,0xFF,0xFF,
+0xCF,0xFB,0xFF,0x02,0xF8,0x1F,0xC0,0xFE,0x00,0x03,0x07,0xFF,0xFF,0xE7,0xFC,0xFF,
+0x03,0x03,0xFF,0xF8,0x0F,0xFB,0xFF,0x0C,0xF8,0x1F,0x80,0x00,0x38,0xFF,0x07,0xFF,
+0xFF,0xE7,0xFF,0xFE,0x21,0xFD,0xFF,0x01,0xC0,0x3F,0xFB,0xFF,0x11,0xF8,0x3F,0x80,
+0x03,0xF8,0xFF,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFF,0xF2,0x03,0xFF,0xC7,0xFA,
+0xFF,0x12,0xF8,0x3F,0x80,0x07,0xF8,0xFF,0x07,0xFF,0xFF,0xE7,0xFF,0xFD,0xDE,0xFF,
+0xF2,0x03,0xFF,0xFF,0xCF,0xFB,0xFF,0x0C,0xF8,0x3F,0x00,0x0F,0xF8,0xFF,0x07,0xFF,
+0xFF,0xE7,0xFF,0xFD,0xDE,0xFD,0xFF,0x01,0xF8,0x0F,0xFB,0xFF,0x0C,0xF8,0x1F,0x80,
+0x1F,0xF8,0xFF,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFD,0xFF,0x01,0xC0,0x3F,0xFB,
+0xFF,0x11,0xF8,0x1F,0x80,0x1F,0xF8,0xFF,0x07,0xFF,0xFF,0xE7,0xFF,0xFE,0x21,0xFF,
+0xF0,0x03,0xFF,0xC7,0xFA,0xFF,0x09,0xF8,0x1F,0x80,0x3F,0xF8,0xFF,0x07,0xFF,0xFF,
+0xE7,0xFD,0xFF,0x03,0xF0,0x03,0xFF,0xF9,0xFA,0xFF,0x0C,0xF8,0x1F,0xC0,0x7F,0xC0,
+0xFF,0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0x03,0xFD,0xFF,0x01,0xF8,0x3F,0xFB,0xFF,0x0C,
+0xF8,0x0F,0xF3,0xFF,0x80,0x00,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFD,0xFF,0x01,
+0xFC,0x0F,0xFB,0xFF,0x0C,0xF8,0x0F,0xFF,0xFE,0x00,0x00,0x07,0xFF,0xFF,0xE7,0xFF,
+0xFC,0xDC,0xFD,0xFF,0x01,0xFE,0x0F,0xFB,0xFF,0x0C,0xF8,0x0F,0xFF,0xFE,0x00,0x00,
+0x07,0xFF,0xFF,0xE7,0xFF,0xFD,0xDE,0xFD,0xFF,0x01,0xF8,0x7F,0xFB,0xFF,0x0C,0xF8,
+0x07,0xFF,0xFC,0x00,0x00,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0xC0,0xFD,0xFF,0x01,0xF8,
+0x3F,0xFB,0xFF,0x0C,0xF8,0x07,0xFF,0xF8,0x00,0x00,0x07,0xFF,0xFF,0xE7,0xFF,0xFE,
+0xE1,0xFD,0xFF,0x01,0xFE,0x0F,0xFB,0xFF,0x09,0xF8,0x03,0xFF,0xF0,0x00,0x00,0x07,
+0xFF,0xFF,0xE7,0xFA,0xFF,0x01,0xFC,0x0F,0xFB,0xFF,0x09,0xF8,0x03,0xFF,0xE0,0x00,
+0x00,0x07,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xF0,0x03,0xFF,0xF8,0x3F,0xFB,0xFF,0x09,
+0xF8,0x00,0xFF,0x80,0x00,0x00,0x07,0xFF,0xFF,0xE7,0xFD,0xFF,0x03,0xF0,0x03,0xFF,
+0xF9,0xFA,0xFF,0x02,0xF8,0x00,0x08,0xFE,0x00,0x03,0x07,0xFF,0xFF,0xE7,0xFA,0xFF,
+0x00,0xF9,0xFA,0xFF,0x00,0xF8,0xFC,0x00,0x03,0x07,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,
+0xFE,0x03,0xFF,0xF8,0x3F,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x0C,0x07,0xFF,0xFF,0xE7,
+0xFF,0xFF,0xF3,0xFF,0xFE,0x03,0xFF,0xFC,0x0F,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x0C,
+0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0x83,0xFF,0xFE,0x7F,0xFF,0xFE,0x0F,0xFB,0xFF,0x00,
+0xF8,0xFC,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFE,0x0B,0xFF,0xFE,0xFF,0xFF,0xF8,
+0x7F,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFF,
+0xFE,0x03,0xFF,0xF8,0x3F,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x0C,0x07,0xFF,0xFF,0xE7,
+0xFF,0xFC,0x00,0xFF,0xFF,0x03,0xFF,0xFE,0x0F,0xFB,0xFF,0x00,0xF8,0xFC,0x00,0x0C,
+0x07,0xFF,0xFF,0xE7,0xFF,0xFF,0xFB,0xFF,0xFE,0xFF,0xFF,0xFC,0x0F,0xFB,0xFF,0x00,
+0xFC,0xFC,0x00,0x03,0x0F,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xF8,0x03,0xFF,0xF8,0x3F,
+0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x03,0x0F,0xFF,0xFF,0xE7,0xFD,0xFF,0x03,0xF0,0x03,
+0xFF,0xF9,0xFA,0xFF,0x00,0xFE,0xFC,0x00,0x0B,0x1F,0xFF,0xFF,0xE7,0xFF,0xFF,0x3F,
+0xFF,0xF6,0xFF,0xFF,0xF9,0xF9,0xFF,0xFC,0x00,0x06,0x3F,0xFF,0xFF,0xE7,0xFF,0xFE,
+0x3F,0xFD,0xFF,0x01,0xF8,0x3F,0xFA,0xFF,0x00,0xC0,0xFD,0x00,0xFE,0xFF,0x09,0xE7,
+0xFF,0xFC,0x00,0xFF,0xFF,0x07,0xFF,0xFC,0x0F,0xF2,0xFF,0x09,0xE7,0xFF,0xFC,0x00,
+0xFF,0xFE,0x03,0xFF,0xFE,0x0F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,
+0xF8,0x7F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,0xF8,0x3F,0xF2,0xFF,
+0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x03,0xFF,0xFE,0x0F,0xF2,0xFF,0x09,0xE7,0xFF,0xFF,
+0x3F,0xFF,0xFF,0x07,0xFF,0xFC,0x0F,0xF2,0xFF,0x03,0xE7,0xFF,0xFE,0x3F,0xFD,0xFF,
+0x01,0xF8,0x3F,0xF2,0xFF,0x08,0xE7,0xFF,0xFC,0x00,0xFF,0xFF,0x03,0xFF,0xF9,0xF1,
+0xFF,0x06,0xE7,0xFF,0xFC,0x00,0xFF,0xFC,0x01,0xEF,0xFF,0x00,0xE7,0xFD,0xFF,0x04,
+0xF8,0x84,0xFF,0xFF,0xCF,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xF3,0x02,0x7F,0xFF,
+0xCF,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x02,0xF6,0x73,0x7F,0xF0,0xFF,0x00,0xE7,0xFD,
+0xFF,0x04,0xF6,0x63,0x7F,0xFC,0x1B,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xF6,0x03,
+0x7F,0xF8,0x09,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xF2,0x03,0x7F,0xF9,0xCD,0xF2,
+0xFF,0x09,0xE7,0xFF,0xFE,0x21,0xFF,0xF0,0x72,0x7F,0xF9,0xCD,0xF2,0xFF,0x09,0xE7,
+0xFF,0xFC,0x00,0xFF,0xF8,0x04,0xFF,0xF8,0x01,0xF2,0xFF,0x09,0xE7,0xFF,0xFD,0xDE,
+0xFF,0xFE,0x0D,0xFF,0xF8,0x03,0xF2,0xFF,0x06,0xE7,0xFF,0xFD,0xDE,0xFF,0xFF,0x06,
+0xEF,0xFF,0x09,0xE7,0xFF,0xFC,0x00,0xFF,0xFE,0x02,0x7F,0xFC,0x1F,0xF2,0xFF,0x09,
+0xE7,0xFF,0xFE,0x21,0xFF,0xFE,0x73,0x7F,0xF8,0x0F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,
+0x04,0xFE,0x73,0x7F,0xF9,0xCF,0xF2,0xFF,0x09,0xE7,0xFF,0xFF,0xF3,0xFF,0xFE,0x00,
+0x7F,0xF9,0xCF,0xF2,0xFF,0x09,0xE7,0xFF,0xFF,0x83,0xFF,0xFE,0x00,0xFF,0xF8,0x0F,
+0xF2,0xFF,0x03,0xE7,0xFF,0xFE,0x0B,0xFD,0xFF,0x01,0xFC,0x1F,0xF2,0xFF,0x06,0xE7,
+0xFF,0xFC,0x00,0xFF,0xFF,0x07,0xEF,0xFF,0x09,0xE7,0xFF,0xFC,0x00,0xFF,0xFE,0x03,
+0xFF,0xFC,0x1F,0xF2,0xFF,0x09,0xE7,0xFF,0xFF,0xFB,0xFF,0xFE,0x73,0xFF,0xF8,0x0F,
+0xFE,0xFF,0x00,0x80,0xF6,0x00,0x00,0x07,0xFD,0xFF,0x04,0xFE,0x73,0xFF,0xF9,0xCF,
+0xFE,0xFF,0x00,0x80,0xF6,0x00,0x09,0x07,0xFF,0xFF,0x03,0xFF,0xFE,0x03,0xFF,0xF9,
+0xCF,0xF2,0xFF,0x09,0xE7,0xFF,0xFC,0x00,0xFF,0xFF,0x07,0xFF,0xF8,0x0F,0xF2,0xFF,
+0x03,0xE7,0xFF,0xFC,0xDC,0xFD,0xFF,0x01,0xFC,0x1F,0xF2,0xFF,0x06,0xE7,0xFF,0xFD,
+0xDE,0xFF,0xFF,0x07,0xEF,0xFF,0x09,0xE7,0xFF,0xFC,0xC0,0xFF,0xFE,0x03,0xFF,0xFC,
+0x1F,0xF2,0xFF,0x09,0xE7,0xFF,0xFE,0xE1,0xFF,0xFE,0x73,0xFF,0xF8,0x0F,0xF2,0xFF,
+0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,0xF9,0xCF,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,
+0x04,0xFE,0x03,0xFF,0xF9,0xCF,0xF2,0xFF,0x09,0xE7,0xFF,0xFF,0x3F,0xFF,0xFF,0x07,
+0xFF,0xC0,0x0F,0xF2,0xFF,0x03,0xE7,0xFF,0xFE,0x3F,0xFD,0xFF,0x01,0xC0,0x0F,0xF2,
+0xFF,0x06,0xE7,0xFF,0xFC,0x00,0xFF,0xFF,0x07,0xEF,0xFF,0x09,0xE7,0xFF,0xFC,0x00,
+0xFF,0xFE,0x03,0xFF,0xFF,0xBF,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,
+0xFF,0xBF,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,0xFF,0xBF,0xF2,0xFF,
+0x06,0xE7,0xFF,0xFE,0x1D,0xFF,0xF0,0x03,0xEF,0xFF,0x09,0xE7,0xFF,0xFC,0x0C,0xFF,
+0xF0,0x03,0xFF,0xFC,0x1F,0xF2,0xFF,0x03,0xE7,0xFF,0xFD,0xEE,0xFD,0xFF,0x01,0xF8,
+0x0F,0xF2,0xFF,0x09,0xE7,0xFF,0xFC,0xEC,0xFF,0xFF,0xEF,0xFF,0xF9,0xCF,0xF2,0xFF,
+0x09,0xE7,0xFF,0xFC,0x00,0xFF,0xFF,0xEF,0xFF,0xF9,0xCF,0xF2,0xFF,0x09,0xE7,0xFF,
+0xFE,0x03,0xFF,0xFF,0xEF,0xFF,0xC0,0x0F,0xF2,0xFF,0x00,0xE7,0xFA,0xFF,0x01,0xC0,
+0x0F,0xF2,0xFF,0x06,0xE7,0xFF,0xFF,0x1D,0xFF,0xFF,0x07,0xEF,0xFF,0x09,0xE7,0xFF,
+0xFC,0x1C,0xFF,0xFE,0x03,0xFF,0xC8,0x0F,0xF2,0xFF,0x09,0xE7,0xFF,0xFC,0x3E,0xFF,
+0xFE,0x73,0xFF,0xC8,0x0F,0xF2,0xFF,0x06,0xE7,0xFF,0xFD,0xBC,0xFF,0xFE,0x73,0xEF,
+0xFF,0x06,0xE7,0xFF,0xFD,0x80,0xFF,0xF0,0x03,0xF7,0xFF,0x00,0xE0,0xFD,0x00,0x0C,
+0x7F,0xFF,0xFF,0xE7,0xFF,0xFD,0xC1,0xFF,0xF0,0x03,0xFF,0xFC,0xDF,0xFA,0xFF,0x00,
+0x80,0xFD,0x00,0x03,0x1F,0xFF,0xFF,0xE7,0xFA,0xFF,0x01,0xF8,0x4F,0xFA,0xFF,0xFC,
+0x00,0x0C,0x0F,0xFF,0xFF,0xE7,0xFF,0xFF,0x03,0xFF,0xF2,0x03,0xFF,0xFA,0x6F,0xFA,
+0xFF,0xFC,0x00,0x0C,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0xFF,0xF2,0x03,0xFF,0xFB,
+0x2F,0xFB,0xFF,0x00,0xFE,0xFC,0x00,0x06,0x07,0xFF,0xFF,0xE7,0xFF,0xFC,0xDC,0xFD,
+0xFF,0x01,0xF9,0x0F,0xFB,0xFF,0x00,0xFE,0xFC,0x00,0x06,0x03,0xFF,0xFF,0xE7,0xFF,
+0xFD,0xDE,0xFD,0xFF,0x01,0xFD,0x9F,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x09,0x03,0xFF,
+0xFF,0xE7,0xFF,0xFC,0xC0,0xFF,0xFF,0x37,0xF8,0xFF,0x00,0xFC,0xFC,0x00,0x0C,0x03,
+0xFF,0xFF,0xE7,0xFF,0xFE,0xE1,0xFF,0xFE,0x13,0xFF,0xF8,0x01,0xFB,0xFF,0x00,0xFC,
+0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x9B,0xFF,0xF8,0x01,0xFB,
+0xFF,0x00,0xFC,0xFC,0x00,0x0C,0x03,0xFF,0xFF,0xE7,0xFF,0xFF,0x1D,0xFF,0xFE,0xCB,
+0xFF,0xF9,0xCF,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x0C,0x03,0xFF,0xFF,0xE7,0xFF,0xFC,
+0x1C,0xFF,0xFE,0x43,0xFF,0xF9,0xEF,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x0C,0x03,0xFF,
+0xFF,0xE7,0xFF,0xFC,0x3E,0xFF,0xFF,0x67,0xFF,0xF8,0x0F,0xFB,0xFF,0x02,0xFC,0x00,
+0xFE,0xFE,0x00,0x06,0x03,0xFF,0xFF,0xE7,0xFF,0xFD,0xBC,0xFD,0xFF,0x01,0xFC,0x1F,
+0xFB,0xFF,0x10,0xFC,0x01,0xFF,0xF8,0x00,0x00,0x03,0xFF,0xFF,0xE7,0xFF,0xFD,0x80,
+0xFF,0xFE,0x00,0x7F,0xF9,0xFF,0x12,0xFC,0x03,0xFF,0xFF,0x80,0x00,0x03,0xFF,0xFF,
+0xE7,0xFF,0xFD,0xC1,0xFF,0xFE,0x00,0x7F,0xC0,0x0F,0xFB,0xFF,0x09,0xFC,0x07,0xFF,
+0xFF,0xE0,0x00,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,0xC0,0x0F,0xFB,
+0xFF,0x09,0xFC,0x07,0xFF,0xFF,0xF8,0x00,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x01,0xFE,
+0x7B,0xF8,0xFF,0x01,0xFC,0x0F,0xFE,0xFF,0x04,0x00,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,
+0x01,0xFE,0x03,0xF8,0xFF,0x09,0xFC,0x1F,0xFD,0xFF,0xFF,0x80,0x03,0xFF,0xFF,0xE7,
+0xFC,0xFF,0x03,0x07,0xFF,0xFD,0x9F,0xFB,0xFF,0x09,0xFC,0x1F,0xF8,0x3F,0xFF,0xC0,
+0x03,0xFF,0xFF,0xE7,0xFA,0xFF,0x01,0xF9,0x0F,0xFB,0xFF,0x09,0xFC,0x00,0x78,0x0F,
+0xFF,0xF0,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xF0,0x03,0xFF,0xFA,0x6F,0xFB,0xFF,
+0x09,0xFC,0x00,0x00,0x01,0xFF,0xF8,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xF0,0x03,
+0xFF,0xFA,0xCF,0xFB,0xFF,0x09,0xFC,0x1F,0x80,0x00,0x7F,0xFC,0x03,0xFF,0xFF,0xE7,
+0xFA,0xFF,0x01,0xF8,0x0F,0xFB,0xFF,0x09,0xFC,0x1F,0xF0,0x00,0x0F,0xFF,0x03,0xFF,
+0xFF,0xE7,0xFA,0xFF,0x01,0xFC,0x0F,0xFB,0xFF,0x09,0xFC,0x01,0xE0,0x00,0x03,0xFF,
+0x03,0xFF,0xFF,0xE7,0xFC,0xFF,0x00,0x67,0xF8,0xFF,0x00,0xFC,0xFD,0x00,0x04,0x7F,
+0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x43,0xFF,0xF9,0xFD,0xFB,0xFF,0x00,0xFC,
+0xFD,0x00,0x04,0xFF,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x9B,0xFF,0xF8,0x19,
+0xFB,0xFF,0x00,0xFC,0xFD,0x00,0x04,0xFF,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,
+0xB3,0xFF,0xFE,0x01,0xFB,0xFF,0x00,0xFC,0xFD,0x00,0x04,0xFF,0x03,0xFF,0xFF,0xE7,
+0xFD,0xFF,0x04,0xFE,0x03,0xFF,0xFE,0x03,0xFB,0xFF,0x00,0xFC,0xFD,0x00,0x04,0x3F,
+0x03,0xFF,0xFF,0xE7,0xFC,0xFF,0x03,0x03,0xFF,0xF8,0x1F,0xFB,0xFF,0x00,0xFC,0xFE,
+0x00,0x05,0x01,0x1F,0x03,0xFF,0xFF,0xE7,0xFA,0xFF,0x00,0xF9,0xFA,0xFF,0x00,0xFC,
+0xFE,0x00,0x05,0x03,0x8F,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x02,0xFE,0x7F,0x7F,0xF9,
+0xFF,0x00,0xFC,0xFE,0x00,0x05,0x01,0xE3,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,
+0x06,0x7F,0xFF,0xCF,0xFB,0xFF,0x00,0xFC,0xFD,0x00,0x04,0xF1,0x03,0xFF,0xFF,0xE7,
+0xFC,0xFF,0x03,0x80,0x7F,0xFF,0xCF,0xFB,0xFF,0x00,0xFC,0xFD,0x00,0x04,0x38,0x03,
+0xFF,0xFF,0xE7,0xFC,0xFF,0x00,0x80,0xF8,0xFF,0x00,0xFC,0xFD,0x00,0x04,0x1E,0x03,
+0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x07,0xFF,0xFC,0x1F,0xFB,0xFF,0x00,0xFC,0xFD,
+0x00,0x04,0x04,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x7F,0xFF,0xF8,0x0F,0xFB,
+0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFA,0xFF,0x01,0xFB,0xCF,0xFB,
+0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFC,0xFF,0x03,0xF3,0xFF,0xFB,
+0xEF,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFC,0xFF,0x03,0xF3,
+0xFF,0xF9,0xCF,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFA,0xFF,
+0x01,0xFD,0xDF,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFC,0xFF,
+0x00,0x07,0xF8,0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,
+0xFE,0x03,0xFF,0xFC,0x1F,0xFB,0xFF,0x00,0xFC,0xFC,0x00,0x03,0x03,0xFF,0xFF,0xE7,
+0xFD,0xFF,0x04,0xFE,0xF3,0xFF,0xF8,0x0F,0xFB,0xFF,0x00,0xFE,0xFC,0x00,0x03,0x03,
+0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0xFB,0xFF,0xF9,0xCF,0xFB,0xFF,0x00,0xFE,0xFC,
+0x00,0x03,0x07,0xFF,0xFF,0xE7,0xFD,0xFF,0x04,0xFE,0x73,0xFF,0xF9,0xCF,0xFA,0xFF,
+0xFC,0x00,0x03,0x07,0xFF,0xFF,0xE7,0xFC,0xFF,0x03,0x77,0xFF,0xF8,0x0F,0xFA,0xFF,
+0xFC,0x00,0x03,0x0F,0xFF,0xFF,0xE7,0xFA,0xFF,0x01,0xFC,0x1F,0xFA,0xFF,0x00,0x80,
+0xFD,0x00,0x03,0x1F,0xFF,0xFF,0xE7,0xFC,0xFF,0x00,0x07,0xF7,0xFF,0x00,0xE0,0xFD,
+0x00,0x03,0x7F,0xFF,0xFF,0xE7,0xFD,0xFF,0x01,0xFE,0x03,0xEF,0xFF,0x00,0xE7,0xFD,
+0xFF,0x04,0xFE,0x73,0xFF,0xF8,0x0F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x73,
+0xFF,0xF8,0x0F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x03,0xFE,0x03,0xFF,0xF9,0xF1,0xFF,
+0x00,0xE7,0xFC,0xFF,0x03,0x07,0xFF,0xF8,0x0F,0xF2,0xFF,0x00,0xE7,0xFA,0xFF,0x01,
+0xF8,0x0F,0xF2,0xFF,0x00,0xE7,0xFA,0xFF,0x00,0xF9,0xF1,0xFF,0x00,0xE7,0xFD,0xFF,
+0x04,0xFE,0x03,0xFF,0xF8,0x0F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x04,0xFE,0x03,0xFF,
+0xFC,0x0F,0xF2,0xFF,0x00,0xE7,0xFD,0xFF,0x01,0xFE,0x7F,0xEF,0xFF,0x00,0xE7,0xFD,
+0xFF,0x01,0xFE,0x03,0xEF,0xFF,0x00,0xE7,0xFD,0xFF,0x01,0xFE,0x03,0xEF,0xFF,0x00,
+0xE7,0xFD,0xFF,0x01,0xFE,0x7F,0xEF,0xFF,0x00,0xE7,0xFD,0xFF,0x01,0xFE,0x03,0xEF,
+0xFF,0x00,0xE7,0xFC,0xFF,0x00,0x03,0xEF,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,
+0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,
+0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xE9,0xFF,0x00,0xE7,0xF5,
+0xFF,
+};
+
+// eighth : 5000 bytes, packed 3124
+const unsigned char eighth_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x81,0xFF,0x93,0xFF,0x01,0xFC,0x7F,0xEA,0xFF,0x02,0xC0,0x08,
+0x1F,0xEC,0xFF,0x03,0xC0,0x00,0x00,0x03,0xED,0xFF,0x00,0xFE,0xFE,0x00,0x00,0x01,
+0xED,0xFF,0x05,0xF0,0x00,0x00,0x70,0x00,0x7F,0xEE,0xFF,0x05,0x80,0x10,0x43,0xC0,
+0x00,0x03,0xF1,0xFF,0x08,0xF3,0xFF,0xFF,0x00,0x21,0x07,0x01,0xC0,0x00,0xF1,0xFF,
+0x09,0xE1,0xFF,0xFC,0x00,0x62,0x1C,0x1E,0x00,0x00,0x3F,0xF2,0xFF,0x09,0xE1,0xFF,
+0xF8,0x00,0xC4,0x38,0x78,0x00,0x00,0x0F,0xF3,0xFF,0x0A,0xFE,0xF1,0xFF,0xF0,0x00,
+0x88,0x61,0xC0,0xF0,0x00,0x07,0xF3,0xFF,0x0A,0xFC,0x71,0xFF,0xE0,0x11,0x18,0xC3,
+0x83,0x00,0x00,0x03,0xF3,0xFF,0x0A,0xF8,0x18,0xFF,0xE1,0x03,0x30,0x87,0x0E,0x00,
+0x00,0x03,0xF3,0xFF,0x0A,0xF8,0x08,0xFF,0xC2,0x22,0x23,0x0C,0x18,0x3F,0xC0,0x01,
+0xF3,0xFF,0x0A,0xFC,0x00,0xFF,0x82,0x22,0x63,0x1C,0x20,0xF8,0x38,0x01,0xF3,0xFF,
+0x0A,0x0C,0x00,0x7F,0x80,0x64,0x46,0x38,0x43,0x80,0x00,0x00,0xF4,0xFF,0x08,0xFE,
+0x06,0x00,0x7F,0x84,0x44,0xC4,0x30,0x86,0xFE,0x00,0xF4,0xFF,0x08,0xFC,0x02,0x30,
+0x7F,0x84,0x4C,0x8C,0x61,0x0C,0xFE,0x00,0x00,0x7F,0xF5,0xFF,0x08,0xF8,0x60,0x18,
+0x7F,0x00,0x4C,0x88,0x43,0x18,0xFE,0x00,0x00,0x7F,0xF5,0xFF,0x08,0xFC,0x30,0x1C,
+0xFF,0x00,0x48,0x88,0xC2,0x30,0xFE,0x00,0x00,0x7F,0xF5,0xFF,0x08,0xDE,0x38,0x1F,
+0xFF,0x00,0x48,0x98,0xC4,0x20,0xFE,0x00,0x00,0x7F,0xF5,0xFF,0x08,0x86,0x1E,0x0F,
+0xFF,0x80,0x48,0x98,0x84,0x60,0xFE,0x00,0x01,0x3C,0x7F,0xF6,0xFF,0x08,0x02,0x1F,
+0x1F,0xFF,0x80,0x08,0x91,0x84,0x40,0xFE,0x00,0x01,0x30,0x1F,0xF6,0xFF,0x08,0x00,
+0x1F,0xFF,0xFE,0x00,0x08,0x91,0x80,0x40,0xFE,0x00,0x01,0x30,0x0F,0xF6,0xFF,0x07,
+0x80,0x0F,0xFF,0xE0,0x00,0x08,0x91,0x80,0xFD,0x00,0x01,0x20,0x03,0xF7,0xFF,0x07,
+0xF1,0xC0,0x0F,0xFF,0x80,0x3F,0x08,0x91,0xFC,0x00,0x01,0x20,0x03,0xF7,0xFF,0x03,
+0xE0,0x43,0x07,0xFE,0xFE,0x00,0x01,0x99,0x80,0xFD,0x00,0x01,0x21,0xC1,0xF7,0xFF,
+0x03,0xC0,0x03,0x8F,0xFC,0xFE,0x00,0x01,0x88,0x80,0xFD,0x00,0x01,0x20,0xE1,0xF7,
+0xFF,0x03,0xC6,0x01,0xDF,0xF8,0xFE,0x00,0x01,0x08,0x80,0xFD,0x00,0x01,0x30,0x61,
+0xF7,0xFF,0x08,0xC3,0x00,0xFF,0xF0,0x00,0x08,0x00,0x40,0xC0,0xFD,0x00,0x01,0x10,
+0x61,0xF7,0xFF,0x08,0xE1,0xE0,0xFF,0xE0,0x00,0x20,0x00,0x04,0x60,0xFD,0x00,0x01,
+0x1C,0x61,0xF8,0xFF,0x04,0xFE,0xF1,0xF0,0xFF,0xC0,0xF8,0x00,0x01,0x0F,0xC3,0xF8,
+0xFF,0x06,0xFC,0x30,0xFF,0xFF,0xC0,0x04,0x0C,0xFA,0x00,0x01,0x07,0x83,0xF8,0xFF,
+0x06,0xF8,0x00,0x7F,0xFF,0x80,0x18,0x30,0xF9,0x00,0x00,0x03,0xF8,0xFF,0x06,0xFC,
+0x00,0x7F,0xFF,0x84,0x20,0x41,0xFE,0x00,0x00,0x1E,0xFD,0x00,0x00,0x07,0xF8,0xFF,
+0x0A,0xFE,0x00,0x3F,0xFF,0x08,0x61,0x82,0x00,0x00,0x03,0x9C,0xFC,0x00,0x00,0x03,
+0xF9,0xFF,0x0C,0xCF,0x08,0x3F,0xFE,0x11,0x83,0x08,0x00,0x00,0x0F,0x80,0x03,0xC2,
+0xFE,0x00,0x00,0x03,0xF9,0xFF,0x10,0xC1,0x0E,0x7F,0xFE,0x31,0x82,0x10,0x00,0x80,
+0x0F,0x00,0x07,0xC7,0x80,0x00,0x00,0x07,0xF9,0xFF,0x10,0xC0,0x07,0xFF,0xFC,0x23,
+0x04,0x60,0x02,0x00,0x00,0x03,0xC7,0xC7,0xC0,0x00,0x01,0x07,0xF9,0xFF,0x10,0xF0,
+0x03,0xFF,0xFC,0x66,0x08,0xC0,0x0C,0x02,0x00,0x0E,0x40,0x07,0xCF,0x00,0x02,0x07,
+0xF9,0xFF,0x10,0xFE,0x01,0xFF,0xF8,0xC4,0x19,0x81,0x18,0x18,0x03,0xCF,0x00,0x07,
+0x0F,0x00,0x06,0x07,0xF8,0xFF,0x09,0xC3,0xFF,0xF8,0xCC,0x31,0x02,0x30,0xC0,0x01,
+0xCE,0xFD,0x00,0x01,0x0C,0x07,0xF6,0xFF,0x0D,0xF9,0x98,0x62,0x24,0x63,0x80,0x00,
+0x40,0x03,0xC0,0xC0,0x7C,0x00,0x03,0xF6,0xFF,0x0D,0xF1,0x98,0x66,0x08,0xC6,0x0F,
+0xF0,0x00,0x07,0x83,0xE1,0xFE,0x00,0x03,0xFA,0xFF,0x11,0xFC,0xFE,0x3F,0xFF,0xF3,
+0x90,0x64,0x49,0x8C,0x3F,0xFC,0x01,0x8F,0x07,0xE3,0xFC,0x00,0x01,0xFA,0xFF,0x11,
+0xF0,0x1E,0x1F,0xFF,0xF3,0x30,0xCC,0x01,0x18,0x7F,0xFF,0x07,0x8C,0x0E,0xE3,0xDC,
+0x00,0x00,0xFA,0xFF,0x12,0xE0,0x06,0x3F,0xFF,0xF3,0x30,0xCC,0x93,0x30,0xFF,0xFF,
+0x83,0x8C,0x1E,0x67,0xC0,0x30,0x00,0x7F,0xFB,0xFF,0x12,0xE0,0x03,0xFF,0xFF,0xF6,
+0x21,0x98,0x86,0x31,0xFF,0xFF,0xE1,0x8C,0x1E,0x00,0x00,0xF8,0x00,0x1F,0xFB,0xFF,
+0x12,0xE1,0xC1,0xFF,0xFF,0xF6,0x21,0x99,0x86,0x63,0xFF,0xFF,0xE1,0xC0,0x1C,0x00,
+0x01,0xFC,0x00,0x07,0xFB,0xFF,0x12,0xC3,0xE0,0x7F,0xFF,0xF6,0x21,0x91,0x8C,0x63,
+0xFF,0xFF,0xC0,0x80,0x00,0x00,0x01,0xFE,0x00,0x03,0xFB,0xFF,0x12,0x81,0xE0,0x3F,
+0xFF,0xF6,0x23,0x11,0x8C,0x47,0xFF,0xFE,0x00,0x07,0x00,0x00,0x01,0xCC,0x00,0x01,
+0xFB,0xFF,0x12,0xC0,0xC0,0x1F,0xFF,0xF6,0x63,0x11,0x0C,0xC7,0xFF,0xF8,0x00,0x1E,
+0x0E,0x1F,0xC1,0xC0,0x00,0x03,0xFB,0xFF,0x12,0xE0,0x02,0x1F,0xFF,0xF6,0x63,0x11,
+0x08,0x87,0xFF,0xF0,0x00,0x3C,0x7E,0x3E,0xE1,0xC0,0x00,0x0B,0xFB,0xFF,0x12,0xFC,
+0x04,0x3F,0xFF,0xF6,0x23,0x31,0x08,0x8F,0xFF,0xE0,0x00,0x0C,0xFE,0x7C,0xE0,0x01,
+0xE0,0x7B,0xFB,0xFF,0x12,0xBF,0x00,0x3F,0xFF,0xF6,0x23,0x31,0x18,0x8F,0xFF,0xC0,
+0x7E,0x01,0xEC,0x1C,0x00,0x07,0xF0,0x73,0xFC,0xFF,0x13,0xFE,0x01,0xC0,0x7F,0xFF,
+0xF6,0x23,0x31,0x98,0x8F,0xE0,0x41,0x80,0x01,0xC8,0x00,0x06,0x0F,0xF8,0x21,0xFC,
+0xFF,0x13,0xFC,0x00,0xF0,0xFF,0xFF,0xF6,0x33,0x11,0x98,0x8F,0xC0,0x03,0x00,0x01,
+0xC0,0x00,0x1F,0x87,0x78,0x01,0xFC,0xFF,0x0B,0xFC,0x30,0x7F,0xFF,0xFF,0xF6,0x33,
+0x11,0x98,0x8F,0x8F,0x04,0xFE,0x00,0x04,0x60,0x3F,0xC2,0x7C,0x01,0xFC,0xFF,0x13,
+0xFC,0x7C,0x3F,0xFF,0xFF,0xFA,0x33,0x10,0x98,0x8F,0x9F,0x08,0x1C,0x00,0x03,0xFC,
+0x1F,0xE2,0x7C,0x01,0xFC,0xFF,0x13,0xFC,0x7C,0x3F,0xFF,0xFF,0xFB,0x1B,0x10,0xD8,
+0xC7,0x91,0x18,0xE0,0x00,0x01,0xFF,0x0E,0xE0,0x00,0x00,0xFC,0xFF,0x13,0xFC,0x3C,
+0x3F,0xFF,0xFF,0xFB,0x1B,0x18,0x78,0x43,0x81,0x11,0xC0,0x00,0x60,0xCF,0x84,0xF0,
+0x00,0x00,0xFC,0xFF,0x14,0xFC,0x18,0x7F,0xFF,0xFF,0xF9,0x8D,0x98,0x68,0x63,0x81,
+0x03,0x80,0x00,0x70,0x8F,0x85,0xF0,0x00,0x00,0x7F,0xFD,0xFF,0x14,0xFE,0x00,0x7F,
+0xFF,0xFF,0xFD,0x8D,0x8C,0x38,0x61,0x83,0x03,0x01,0xE0,0x78,0x0F,0xC1,0xF0,0x3F,
+0x00,0x3F,0xFC,0xFF,0x00,0x00,0xFE,0xFF,0x0F,0xFD,0x8F,0x8C,0x1C,0x30,0xC7,0x02,
+0x07,0xF8,0x3C,0x07,0xC1,0xF0,0x7F,0x80,0x3F,0xFD,0xFF,0x01,0xFC,0xA3,0xFE,0xFF,
+0x0F,0xFE,0xC7,0x8E,0x0C,0x30,0x7E,0x02,0x1F,0xFC,0x3E,0x00,0x60,0x01,0xFF,0xC0,
+0x1F,0xFD,0xFF,0x01,0xE0,0x1F,0xFE,0xFF,0x08,0xFE,0x43,0xC6,0x06,0x1C,0x00,0x04,
+0x3F,0xFE,0xFD,0x00,0x02,0xFF,0xE0,0x0F,0xFD,0xFF,0x01,0xE0,0x07,0xFD,0xFF,0x0E,
+0x61,0xC3,0x02,0x0C,0x00,0x04,0x7C,0x7E,0x00,0x1E,0x00,0x00,0x7D,0xE0,0x0F,0xFD,
+0xFF,0x01,0xC1,0x03,0xFD,0xFF,0x0E,0x90,0xE3,0x81,0x07,0x00,0x04,0x70,0x1F,0x00,
+0x3F,0x83,0xF0,0x19,0xF0,0x07,0xFD,0xFF,0x01,0xC3,0xC3,0xFD,0xFF,0x0E,0x80,0x61,
+0xC0,0x03,0xE0,0x04,0xF0,0x1F,0x1E,0x1F,0xC3,0xFC,0x11,0xF0,0x03,0xFD,0xFF,0x01,
+0xC7,0xC3,0xFD,0xFF,0x0E,0xC0,0x10,0xF0,0x80,0xFF,0x00,0xE0,0x0F,0x1F,0x8F,0xE1,
+0xFE,0x01,0xC0,0x01,0xFD,0xFF,0x01,0xC3,0xC3,0xFD,0xFF,0x0E,0xF0,0x08,0x7C,0x60,
+0x00,0x00,0xE0,0x0F,0x1C,0x8E,0xF1,0xDF,0x80,0x00,0x00,0xFD,0xFF,0x01,0xE1,0x83,
+0xFD,0xFF,0x0F,0xF8,0x00,0x3F,0xF0,0x00,0x00,0xE3,0x0F,0x19,0xCC,0xF1,0x9F,0x80,
+0x00,0x00,0x7F,0xFE,0xFF,0x01,0xE0,0x07,0xFD,0xFF,0x0F,0xFC,0x00,0x07,0xF8,0x00,
+0x00,0x73,0x8F,0x01,0xC1,0xF8,0x1F,0xC0,0x38,0xFC,0x1F,0xFE,0xFF,0x01,0xF8,0x0F,
+0xFD,0xFF,0x0F,0xFE,0x00,0x00,0x0F,0x00,0x00,0x3F,0x0F,0x03,0xC3,0xF8,0x3F,0xC0,
+0xFC,0x70,0x3F,0xFE,0xFF,0x00,0xFC,0xFB,0xFF,0x0E,0x00,0x00,0x07,0xF0,0x08,0x1E,
+0x0F,0x03,0xC0,0x08,0x1F,0x80,0xFA,0x20,0x7F,0xFE,0xFF,0x00,0x80,0xFB,0xFF,0x08,
+0xC0,0x00,0x00,0xF0,0x1C,0x00,0x1F,0x00,0xC0,0xFE,0x00,0x01,0x7A,0x00,0xFD,0xFF,
+0x01,0x00,0x3F,0xFC,0xFF,0x06,0xF0,0x00,0x00,0x80,0x1E,0x00,0x3F,0xFC,0x00,0x01,
+0x3A,0x00,0xFD,0xFF,0x01,0x0C,0x1F,0xFC,0xFF,0x0D,0xF8,0x00,0x01,0x80,0x3F,0x80,
+0x7E,0x18,0x03,0xE0,0xE0,0x00,0x03,0x01,0xFD,0xFF,0x01,0x1F,0x0F,0xFB,0xFF,0x0C,
+0x80,0x07,0xC0,0x3F,0xFB,0xFE,0x1F,0x0F,0xF8,0x78,0x7F,0x03,0x01,0xFD,0xFF,0x01,
+0x1F,0x0F,0xF9,0xFF,0x0A,0xC0,0x7F,0xFF,0xFE,0x3F,0x1F,0xFC,0x7C,0x3F,0x81,0x03,
+0xFE,0xFF,0x02,0xE0,0x0F,0x1F,0xF9,0xFF,0x0A,0x80,0xFF,0xFF,0xFE,0x3B,0x8F,0xFE,
+0x3E,0x1F,0xC3,0x03,0xFE,0xFF,0x02,0xE0,0x00,0x1F,0xF9,0xFF,0x0A,0x83,0xFF,0xFF,
+0xFE,0x33,0x8F,0xBE,0x3F,0x1F,0xE3,0x03,0xFE,0xFF,0x02,0xF0,0x00,0x1F,0xF6,0xFF,
+0x07,0xFC,0x23,0xCF,0x7E,0x1F,0x8D,0xE3,0x03,0xFD,0xFF,0x01,0xD0,0x1F,0xF6,0xFF,
+0x07,0xFC,0x03,0xC4,0x7E,0x1B,0x81,0xE3,0x03,0xF0,0xFF,0x07,0xF8,0x00,0x00,0xFE,
+0x13,0x81,0xF1,0x03,0xFD,0xFF,0x00,0xE3,0xF5,0xFF,0x00,0xF8,0xFE,0x00,0x03,0x07,
+0xC1,0xF0,0x03,0xFD,0xFF,0x00,0xE3,0xF5,0xFF,0x00,0xF8,0xFE,0x00,0x03,0x07,0xC3,
+0xF0,0x01,0xFD,0xFF,0x00,0xE3,0xF5,0xFF,0x07,0xF0,0xC1,0xE0,0x00,0x0F,0xC0,0xE0,
+0x01,0xFD,0xFF,0x00,0xE3,0xF5,0xFF,0x02,0xE1,0xE3,0xF0,0xFE,0x00,0x01,0x04,0x01,
+0xFD,0xFF,0x00,0xE3,0xF5,0xFF,0x07,0xE1,0xF3,0xF9,0xFE,0x00,0x00,0x0C,0x00,0xFD,
+0xFF,0x00,0xE3,0xF5,0xFF,0x07,0xC1,0xF1,0xD8,0xFF,0x80,0x07,0x00,0x00,0xFD,0xFF,
+0x00,0x00,0xF5,0xFF,0x0D,0x80,0x79,0x9C,0xFB,0xCF,0x83,0xC1,0x00,0x7F,0xFF,0xFF,
+0xFC,0x00,0x7F,0xF6,0xFF,0x0D,0x80,0xF8,0x1C,0x77,0xC7,0xC1,0xE1,0x00,0x3F,0xFF,
+0xFF,0xFC,0x00,0x3F,0xF6,0xFF,0x0D,0x01,0xF8,0x3C,0x47,0xC7,0xE1,0xF0,0x3E,0x3F,
+0xFF,0xFF,0xFC,0x3C,0x3F,0xF7,0xFF,0x0E,0xFE,0x00,0x78,0x3C,0x0F,0xC7,0xF0,0xF8,
+0x10,0x1F,0xFF,0xFF,0xFC,0x7E,0x3F,0xF7,0xFF,0x0E,0xFC,0x00,0x00,0x08,0x0F,0xC3,
+0x78,0xF8,0x00,0x1F,0xFF,0xFF,0xFC,0x3C,0x3F,0xF7,0xFF,0x00,0xF8,0xFE,0x00,0x0A,
+0x0F,0xC2,0x78,0x7C,0x00,0x7F,0xFF,0xFF,0xE0,0x00,0x3F,0xF7,0xFF,0x08,0xF0,0x01,
+0x80,0x00,0x03,0x80,0x7C,0x6C,0x01,0xFE,0xFF,0x02,0xC0,0x00,0x3F,0xF7,0xFF,0x08,
+0xE0,0xC7,0xF0,0x40,0x00,0x00,0xFC,0x6C,0x03,0xFE,0xFF,0x02,0xE0,0x00,0x3F,0xF7,
+0xFF,0x08,0xC1,0xC7,0xF8,0x70,0xF0,0x00,0x0C,0x5C,0x07,0xF1,0xFF,0x08,0x07,0x63,
+0xDC,0x7C,0x7C,0x00,0x00,0x1C,0x0F,0xF2,0xFF,0x09,0xFE,0x00,0x63,0x9E,0x3E,0x3E,
+0x18,0x00,0x1C,0x1F,0xFE,0xFF,0x02,0xE0,0x00,0x3F,0xF8,0xFF,0x02,0xFC,0x00,0xE1,
+0xFE,0x3E,0x03,0x1E,0x18,0x1E,0x1F,0xFE,0xFF,0x02,0xC0,0x00,0x1F,0xF8,0xFF,0x09,
+0xF8,0x00,0xE0,0x3E,0x32,0x13,0x1F,0x1E,0x00,0x1F,0xFE,0xFF,0x01,0xE4,0x07,0xF9,
+0xFF,0x0B,0xF9,0xFF,0xE0,0x70,0xF0,0x3E,0x06,0x13,0x1F,0x0F,0x00,0x1F,0xF4,0xFF,
+0x0B,0xE0,0x7F,0xC0,0xB8,0xE0,0x3E,0x06,0x07,0x1B,0x8F,0x00,0x1F,0xFD,0xFF,0x01,
+0xCE,0x3F,0xFB,0xFF,0x0C,0xFE,0x00,0x3F,0x00,0x3C,0x00,0x06,0x0E,0x07,0x03,0x8D,
+0x98,0x1F,0xFD,0xFF,0x01,0x06,0x1F,0xFB,0xFF,0x0C,0xFC,0x00,0x3E,0x00,0x38,0x00,
+0x00,0x0E,0x0F,0x03,0x89,0x88,0x0F,0xFE,0xFF,0x02,0xFE,0x03,0x1F,0xFB,0xFF,0x04,
+0xFC,0x00,0x1C,0x00,0x40,0xFE,0x00,0x04,0x0E,0x07,0x81,0x80,0x07,0xFE,0xFF,0x02,
+0xFE,0x03,0x1F,0xFB,0xFF,0x03,0xC0,0x00,0x18,0x1C,0xFC,0x00,0x03,0x0F,0x83,0x80,
+0x07,0xFE,0xFF,0x02,0xFE,0x61,0x1F,0xFB,0xFF,0x03,0x80,0x00,0x00,0x04,0xFE,0x00,
+0x05,0x30,0x00,0x07,0x83,0x80,0x07,0xFE,0xFF,0x02,0xFE,0x30,0x1F,0xFB,0xFF,0xFE,
+0x00,0x00,0x08,0xFE,0x00,0x05,0x1E,0x00,0x00,0x07,0x80,0xC3,0xFD,0xFF,0x01,0x18,
+0x3F,0xFC,0xFF,0x02,0xFE,0x00,0x10,0xFC,0x00,0x05,0x1E,0x08,0x00,0x01,0x83,0xE1,
+0xFD,0xFF,0x01,0x1C,0x7F,0xFC,0xFF,0x02,0xFE,0x0F,0xC4,0xFC,0x00,0x05,0x0F,0x1F,
+0x00,0x00,0x06,0x01,0xFC,0xFF,0x01,0xE0,0x7F,0xFD,0xFF,0x02,0xFE,0x00,0x73,0xFC,
+0x00,0x02,0x05,0x8F,0x8E,0xFE,0x00,0xFD,0xFF,0x02,0xFC,0x00,0x7F,0xFD,0xFF,0x02,
+0xFE,0x00,0x19,0xFC,0x00,0x05,0x01,0x8F,0x8F,0x1C,0x00,0x00,0xFD,0xFF,0x01,0x80,
+0x01,0xFC,0xFF,0x03,0xFE,0x1F,0x84,0x80,0xFD,0x00,0x00,0x01,0xFE,0x8F,0x01,0x00,
+0x07,0xFD,0xFF,0x01,0x00,0x07,0xFC,0xFF,0x02,0xFE,0x1F,0xE2,0xFC,0x00,0x05,0x01,
+0xCF,0x8F,0x8F,0x80,0x0F,0xFD,0xFF,0x01,0x83,0x87,0xFC,0xFF,0x03,0xFE,0x00,0x39,
+0x40,0xFD,0x00,0x05,0x03,0xCF,0x8F,0x8F,0x80,0x3F,0xFD,0xFF,0x01,0x87,0xC3,0xFB,
+0xFF,0x02,0x0F,0xCC,0x80,0xFD,0x00,0x05,0x01,0xCD,0x87,0x8D,0x80,0x7F,0xFD,0xFF,
+0x01,0x87,0xC3,0xFB,0xFF,0x01,0x80,0x66,0xFC,0x00,0x04,0x01,0x81,0x87,0xC1,0x00,
+0xFC,0xFF,0x01,0xC3,0x07,0xFB,0xFF,0x01,0xC0,0x03,0xFB,0x00,0x03,0x81,0x85,0x83,
+0x00,0xFC,0xFF,0x01,0xC0,0x0F,0xFB,0xFF,0x01,0xF0,0x04,0xFB,0x00,0x03,0x03,0x81,
+0x82,0x01,0xFC,0xFF,0x01,0xE0,0x1F,0xFA,0xFF,0x0A,0x80,0x00,0x00,0x0F,0xFC,0x00,
+0x00,0x03,0x03,0x80,0x01,0xFC,0xFF,0x01,0xF9,0xF1,0xFA,0xFF,0x0A,0xE0,0x00,0x00,
+0x7F,0xFF,0x00,0x00,0x06,0x03,0x80,0x03,0xFB,0xFF,0x00,0x80,0xFA,0xFF,0x0A,0xF0,
+0x00,0x01,0xFE,0x1F,0xC0,0x00,0x02,0x07,0x00,0x03,0xFC,0xFF,0x01,0xFC,0x01,0xFA,
+0xFF,0x0A,0xF8,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x0E,0x00,0x03,0xFC,0xFF,0x01,
+0xC0,0x0F,0xFA,0xFF,0x0A,0xF8,0x00,0x1C,0x00,0x00,0x70,0x00,0x40,0x04,0x00,0x03,
+0xFC,0xFF,0x01,0x00,0x78,0xFA,0xFF,0x0A,0xFC,0x00,0x38,0x00,0x00,0x38,0x00,0x70,
+0x00,0x00,0x03,0xFC,0xFF,0x02,0x03,0xF0,0x7F,0xFB,0xFF,0x0A,0xF8,0x00,0x60,0x00,
+0x00,0x18,0x00,0x78,0x00,0xE3,0xC3,0xFC,0xFF,0x02,0x9F,0xE0,0x3F,0xFB,0xFF,0x0A,
+0xF8,0x00,0x80,0x00,0x00,0x0C,0x00,0x78,0x60,0xE7,0xE3,0xFC,0xFF,0x02,0xFE,0x20,
+0x3F,0xFB,0xFF,0x00,0xF0,0xFD,0x00,0x05,0x06,0x00,0x3C,0x7C,0x44,0x03,0xFC,0xFF,
+0x02,0xFE,0x26,0x3F,0xFB,0xFF,0x00,0xF0,0xFD,0x00,0x05,0x06,0x00,0x1C,0x7E,0x00,
+0x03,0xFC,0xFF,0x02,0xFC,0x30,0x1F,0xFB,0xFF,0x00,0xE0,0xFD,0x00,0x05,0x02,0x00,
+0x1C,0x6F,0x00,0x03,0xFC,0xFF,0x02,0xFE,0x30,0x0E,0xFB,0xFF,0x00,0xE0,0xFD,0x00,
+0x05,0x01,0x00,0x1C,0x6F,0x00,0x03,0xFC,0xFF,0x03,0xFE,0x00,0x7C,0x7F,0xFC,0xFF,
+0x00,0xE0,0xFD,0x00,0x05,0x01,0x00,0x1C,0x0E,0x00,0x01,0xFC,0xFF,0x03,0xFE,0x01,
+0xFC,0x7F,0xFC,0xFF,0x00,0xC0,0xFD,0x00,0x05,0x01,0x00,0x3C,0x1E,0x00,0x01,0xFB,
+0xFF,0x02,0x07,0xFC,0x7F,0xFC,0xFF,0x00,0x80,0xFB,0x00,0x02,0x38,0x1C,0x01,0xF9,
+0xFF,0x01,0xF0,0x7F,0xFC,0xFF,0x00,0x80,0xFB,0x00,0x02,0x70,0x00,0x07,0xFA,0xFF,
+0x01,0xFC,0x00,0xFB,0xFF,0x00,0x80,0xF9,0x00,0x00,0x0F,0xFA,0xFF,0x01,0xC0,0x01,
+0xFB,0xFF,0x00,0x80,0xFB,0x00,0x02,0x01,0xC0,0x1F,0xFA,0xFF,0x01,0xC0,0x03,0xFB,
+0xFF,0xFE,0x00,0x00,0xC0,0xFE,0x00,0x02,0x07,0xE0,0x1F,0xFA,0xFF,0x01,0xCF,0x87,
+0xFB,0xFF,0xFE,0x00,0x00,0x30,0xFE,0x00,0x02,0x41,0x80,0x1F,0xF9,0xFF,0x00,0x0F,
+0xFB,0xFF,0xFE,0x00,0x00,0x10,0xFE,0x00,0x02,0x61,0x80,0x3F,0xFA,0xFF,0x02,0xFE,
+0x1F,0x3F,0xFC,0xFF,0xFE,0x00,0x00,0x18,0xFE,0x00,0x02,0x70,0x00,0x3F,0xFA,0xFF,
+0x02,0xFC,0x3E,0x1F,0xFC,0xFF,0x03,0x00,0x00,0x40,0x18,0xFE,0x00,0x02,0xF8,0x00,
+0x3F,0xFA,0xFF,0x02,0xF8,0x7E,0x1F,0xFD,0xFF,0x04,0xFE,0x00,0x00,0x40,0x10,0xFE,
+0x00,0x02,0xFC,0x00,0x3F,0xFA,0xFF,0x02,0xF8,0xFF,0x7F,0xFD,0xFF,0x0A,0xFE,0x00,
+0x00,0x40,0x10,0x00,0x00,0x01,0xB8,0x00,0x3F,0xFA,0xFF,0x00,0xFD,0xFB,0xFF,0x03,
+0xFE,0x00,0x00,0x60,0xFE,0x00,0x03,0x01,0x30,0x30,0x3F,0xF8,0xFF,0x00,0x07,0xFD,
+0xFF,0x03,0xFE,0x00,0x00,0x20,0xFD,0x00,0x02,0x61,0xFC,0x3F,0xF9,0xFF,0x01,0xFC,
+0x03,0xFD,0xFF,0x03,0xFE,0x00,0x00,0x18,0xFD,0x00,0x02,0x40,0x00,0x3F,0xF9,0xFF,
+0x01,0xF8,0x01,0xFD,0xFF,0x03,0xFE,0x00,0x00,0x1C,0xFD,0x00,0x02,0x80,0x00,0x3F,
+0xF9,0xFF,0x01,0xF0,0x61,0xFD,0xFF,0x04,0xFE,0x00,0x00,0x03,0xC0,0xFC,0x00,0x00,
+0x3F,0xF9,0xFF,0x01,0xF0,0xF1,0xFD,0xFF,0x00,0xFE,0xF8,0x00,0x00,0x3F,0xF9,0xFF,
+0x01,0xF1,0xE1,0xFD,0xFF,0x00,0xFE,0xF8,0x00,0x00,0x3F,0xF9,0xFF,0x01,0xF0,0xE3,
+0xFE,0xFF,0x01,0x0F,0xFE,0xF9,0x00,0xF7,0xFF,0x06,0xF0,0x33,0xBF,0xFF,0xFC,0x03,
+0xFE,0xFA,0x00,0x00,0x03,0xF7,0xFF,0x06,0xF8,0x1C,0x07,0xFF,0xF8,0x01,0xFC,0xFA,
+0x00,0x00,0x1F,0xF7,0xFF,0x06,0xF8,0x18,0x03,0xFF,0xF0,0x78,0xF8,0xFC,0x00,0x02,
+0xC0,0x00,0x3F,0xF6,0xFF,0x05,0x70,0x03,0xFF,0xF1,0x8C,0xF8,0xFD,0x00,0x03,0x01,
+0x80,0x00,0x7F,0xF6,0xFF,0x05,0xE1,0xE1,0xFF,0xF1,0x0C,0x70,0xFD,0x00,0x02,0x07,
+0x00,0x01,0xF5,0xFF,0x05,0xE3,0xE1,0xFF,0xF3,0x0C,0x70,0xFD,0x00,0x02,0x0E,0x00,
+0x03,0xF5,0xFF,0x0C,0xE3,0xE1,0xFF,0xF2,0x00,0xE0,0x03,0xF8,0x00,0x07,0xF8,0x00,
+0x07,0xF5,0xFF,0x0C,0xE1,0xC3,0x9F,0xF3,0x00,0xE0,0x00,0x1F,0x00,0x1F,0xC0,0x00,
+0x1F,0xF5,0xFF,0x0C,0xE0,0x83,0x0F,0xF3,0x01,0xE0,0x00,0x07,0x00,0x3C,0x00,0x00,
+0x3F,0xF5,0xFF,0x0C,0xF0,0x06,0x0F,0xF1,0x87,0xC0,0x00,0x01,0xC0,0xC0,0x00,0x00,
+0x7F,0xF5,0xFF,0x0B,0xF8,0x0C,0x1F,0xF9,0xFF,0x84,0x03,0x80,0xC0,0x80,0x00,0x00,
+0xF4,0xFF,0x0B,0xFE,0x38,0x38,0xF8,0xFE,0x0C,0x00,0xF8,0x01,0x00,0x00,0x03,0xF3,
+0xFF,0x0A,0xF0,0x70,0x7C,0x00,0x18,0x00,0x1C,0x20,0x00,0x00,0x0F,0xF3,0xFF,0x06,
+0xE0,0xE0,0xFE,0x00,0x78,0xC0,0x0E,0xFE,0x00,0x00,0x1F,0xF3,0xFF,0x06,0xC1,0xE1,
+0xC7,0x81,0xF8,0xC0,0x03,0xFE,0x00,0x00,0x7F,0xF3,0xFF,0x09,0xC0,0xC3,0xC7,0xFF,
+0xF8,0x61,0x01,0x00,0x00,0x01,0xF2,0xFF,0x09,0xE0,0x07,0x87,0xFF,0xFC,0x00,0xC0,
+0x00,0x00,0x07,0xF2,0xFF,0x09,0xF8,0x07,0x0F,0xFF,0xFC,0x00,0x78,0x00,0x00,0x3F,
+0xF2,0xFF,0x04,0xFC,0x0E,0x1F,0xFF,0xFF,0xFE,0x00,0x00,0x01,0xF1,0xFF,0x07,0xFE,
+0x04,0x1F,0xFF,0xFF,0xFC,0x00,0x01,0xEF,0xFF,0x01,0xC0,0x3F,0xFE,0xFF,0x00,0x8F,
+0xEE,0xFF,0x01,0xE0,0x7F,0xEA,0xFF,0x01,0xE0,0x7F,0xEA,0xFF,0x00,0xF0,0x81,0xFF,
+0x81,0xFF,0xC4,0xFF,
+};
+
+#define BitmapExample1_packed logo_packed
+#define BitmapExample2_packed first_packed
+
+#endif
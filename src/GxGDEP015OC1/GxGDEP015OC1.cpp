@@ -46,47 +46,34 @@ const uint8_t GxGDEP015OC1::Gatetime[] = {0x3b, 0x08}; // 2us per line
 
 GxGDEP015OC1::GxGDEP015OC1(GxIO& io, int8_t rst, int8_t busy) :
   GxEPD(GxGDEP015OC1_WIDTH, GxGDEP015OC1_HEIGHT), IO(io),
-  _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+  _using_partial_mode(false), _diag_enabled(false),
   _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDEP015OC1::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEP015OC1_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEP015OC1_WIDTH - x - 1;
-      y = GxGDEP015OC1_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEP015OC1_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEP015OC1_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEP015OC1_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEP015OC1_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEP015OC1_WIDTH / 8;
-  }
+void GxGDEP015OC1::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEP015OC1::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEP015OC1::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDEP015OC1::init(uint32_t serial_diag_bitrate)
@@ -104,6 +91,7 @@ void GxGDEP015OC1::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   if (_busy >= 0) pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -111,30 +99,22 @@ void GxGDEP015OC1::init(uint32_t serial_diag_bitrate)
 
 void GxGDEP015OC1::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEP015OC1::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxGDEP015OC1_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEP015OC1_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEP015OC1_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDEP015OC1_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _Update_Full();
   _PowerOff();
+  _setShadow(_fb_black, _fb_size, GxGDEP015OC1_BUFFER_SIZE);
 }
 
 void  GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
@@ -146,6 +126,8 @@ void  GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
+  _invalidateShadow();
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_x for normal display (bm_flip_y would be rotated)
   if (mode & bm_default) mode |= bm_flip_x;
@@ -158,38 +140,16 @@ void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = true; // remember
     _Init_Part(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEP015OC1_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _Update_Part();
     delay(GxGDEP015OC1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEP015OC1_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     delay(GxGDEP015OC1_PU_DELAY);
     _PowerOff();
   }
@@ -198,20 +158,9 @@ void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _Init_Full(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEP015OC1_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _Update_Full();
     _PowerOff();
   }
@@ -220,23 +169,19 @@ void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
 void GxGDEP015OC1::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
+  _invalidateShadow();
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEP015OC1_BUFFER_SIZE);
     _Update_Part();
     delay(GxGDEP015OC1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEP015OC1_BUFFER_SIZE);
     delay(GxGDEP015OC1_PU_DELAY);
   }
   else
@@ -244,10 +189,7 @@ void GxGDEP015OC1::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEP015OC1_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -256,6 +198,7 @@ void GxGDEP015OC1::eraseDisplay(bool using_partial_update)
 void GxGDEP015OC1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEP015OC1_WIDTH) return;
   if (y >= GxGDEP015OC1_HEIGHT) return;
@@ -263,20 +206,19 @@ void GxGDEP015OC1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   uint16_t ye = gx_uint16_min(GxGDEP015OC1_HEIGHT, y + h) - 1;
   uint16_t xs_d8 = x / 8;
   uint16_t xe_d8 = xe / 8;
+  if (!_diffWindow(_fb_black, _fb_size, GxGDEP015OC1_WIDTH / 8, xs_d8, xe_d8, y, ye)) return; // unchanged
   _Init_Part(0x03);
   _SetRamArea(xs_d8, xe_d8, y % 256, y / 256, ye % 256, ye / 256); // X-source area,Y-gate area
   _SetRamPointer(xs_d8, y % 256, y / 256); // set ram
   _waitWhileBusy(0, 100); // needed ?
   _writeCommand(0x24);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEP015OC1_WIDTH / 8) + xs_d8;
+    _writePlaneData(IO, 0, idx, xe_d8 - xs_d8 + 1, true, 0xFF);
   }
+  IO.endTransaction();
   _Update_Part();
   delay(GxGDEP015OC1_PU_DELAY);
   // update erase buffer
@@ -284,17 +226,52 @@ void GxGDEP015OC1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _SetRamPointer(xs_d8, y % 256, y / 256); // set ram
   _waitWhileBusy(0, 100); // needed ?
   _writeCommand(0x24);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
+    uint32_t idx = uint32_t(y1) * (GxGDEP015OC1_WIDTH / 8) + xs_d8;
+    _writePlaneData(IO, 0, idx, xe_d8 - xs_d8 + 1, true, 0xFF);
+  }
+  IO.endTransaction();
+  _updateShadow(_fb_black, _fb_size, GxGDEP015OC1_WIDTH / 8, xs_d8, xe_d8, y, ye);
+  delay(GxGDEP015OC1_PU_DELAY);
+}
+
+#if GxEPD_DIRTY_TRACKING
+void GxGDEP015OC1::updateDirty()
+{
+  if ((_current_page != -1) || (_dirty_count == 0)) return;
+  op_scope op(this, IO, op_partial_update);
+  if (_dirtyWindows(_fb_black, _fb_size, GxGDEP015OC1_WIDTH / 8) == 0) return; // unchanged
+  _Init_Part(0x03);
+  _writeDirtyWindows();
+  _Update_Part();
+  delay(GxGDEP015OC1_PU_DELAY);
+  // update erase buffer
+  _writeDirtyWindows();
+  _dirtyWindowsSent(_fb_black, _fb_size, GxGDEP015OC1_WIDTH / 8);
+  delay(GxGDEP015OC1_PU_DELAY);
+}
+
+void GxGDEP015OC1::_writeDirtyWindows()
+{
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    const dirty_rect& r = _dirty_rects[i];
+    _SetRamArea(r.x0, r.x1, r.y0 % 256, r.y0 / 256, r.y1 % 256, r.y1 / 256); // X-source area,Y-gate area
+    _SetRamPointer(r.x0, r.y0 % 256, r.y0 / 256); // set ram
+    _waitWhileBusy(0, 100); // needed ?
+    _writeCommand(0x24);
+    IO.startTransaction();
+    for (int16_t y1 = r.y0; y1 <= r.y1; y1++)
     {
-      uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
+      uint32_t idx = uint32_t(y1) * (GxGDEP015OC1_WIDTH / 8) + r.x0;
+      _writePlaneData(IO, 0, idx, r.x1 - r.x0 + 1, true, 0xFF);
     }
+    IO.endTransaction();
   }
-  delay(GxGDEP015OC1_PU_DELAY);
 }
+#endif
 
 void GxGDEP015OC1::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h)
 {
@@ -318,19 +295,19 @@ void GxGDEP015OC1::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   _SetRamPointer(xds_d8, yd % 256, yd / 256); // set ram
   _waitWhileBusy(0, 100); // needed ?
   _writeCommand(0x24);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEP015OC1_WIDTH / 8) + xs / 8;
+    _writePlaneData(IO, 0, idx, xse_d8 - xs / 8 + 1, true, 0xFF);
   }
+  IO.endTransaction();
 }
 
 void GxGDEP015OC1::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
+  _invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -409,15 +386,9 @@ void GxGDEP015OC1::_waitWhileBusy(const char* comment, uint16_t busy_time)
   if (_busy >= 0)
   {
     unsigned long start = micros();
-    while (1)
+    if (!_waitBusy(_busy, HIGH, 10000000))
     {
-      if (!digitalRead(_busy)) break;
-      delay(1);
-      if (micros() - start > 10000000)
-      {
-        if (_diag_enabled) Serial.println("Busy Timeout!");
-        break;
-      }
+      if (_diag_enabled) Serial.println("Busy Timeout!");
     }
     if (comment)
     {
@@ -546,24 +517,24 @@ void GxGDEP015OC1::_Update_Part(void)
 void GxGDEP015OC1::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -571,24 +542,24 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(void))
 void GxGDEP015OC1::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -596,24 +567,24 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEP015OC1::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -621,24 +592,24 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEP015OC1::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _Update_Full();
   _PowerOff();
 }
@@ -667,6 +638,8 @@ void GxGDEP015OC1::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -675,41 +648,51 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
   }
   _using_partial_mode = true;
   _Init_Part(0x03);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDEP015OC1_PU_DELAY);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(GxGDEP015OC1_PU_DELAY);
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -718,41 +701,51 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
   }
   _using_partial_mode = true;
   _Init_Part(0x03);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDEP015OC1_PU_DELAY);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(GxGDEP015OC1_PU_DELAY);
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -761,41 +754,51 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
   }
   _using_partial_mode = true;
   _Init_Part(0x03);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDEP015OC1_PU_DELAY);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(GxGDEP015OC1_PU_DELAY);
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -804,43 +807,53 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*, const voi
   }
   _using_partial_mode = true;
   _Init_Part(0x03);
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _Update_Part();
   delay(GxGDEP015OC1_PU_DELAY);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEP015OC1_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEP015OC1_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(GxGDEP015OC1_PU_DELAY);
-  _current_page = -1;
+  _endPaged();
   _PowerOff();
 }
 
 void GxGDEP015OC1::drawCornerTest(uint8_t em)
 {
   if (_current_page != -1) return;
+  _invalidateShadow();
   _Init_Full(em);
   _writeCommand(0x24);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEP015OC1_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEP015OC1_WIDTH / 8; x++)
@@ -850,9 +863,10 @@ void GxGDEP015OC1::drawCornerTest(uint8_t em)
       if ((x > GxGDEP015OC1_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEP015OC1_WIDTH / 8 - 4) && (y > GxGDEP015OC1_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEP015OC1_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   _Update_Full();
   _PowerOff();
 }
@@ -26,7 +26,7 @@
 
 #define GxGDEP015OC1_BUFFER_SIZE (uint32_t(GxGDEP015OC1_WIDTH) * uint32_t(GxGDEP015OC1_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEP015OC1_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEP015OC1_HEIGHT
 #define GxGDEP015OC1_PAGES 5
 
 #define GxGDEP015OC1_PAGE_HEIGHT (GxGDEP015OC1_HEIGHT / GxGDEP015OC1_PAGES)
@@ -43,6 +43,10 @@ class GxGDEP015OC1 : public GxEPD
     GxGDEP015OC1(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -53,11 +57,16 @@ class GxGDEP015OC1 : public GxEPD
     void eraseDisplay(bool using_partial_update = false);
     // partial update of rectangle from buffer to screen, does not power off
     void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true);
+#if GxEPD_DIRTY_TRACKING
+    // partial update of the regions drawn since last updateDirty(), one refresh for all, does not power off
+    void updateDirty();
+#endif
     // partial update of rectangle at (xs,ys) from buffer to screen at (xd,yd), does not power off
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEP015OC1_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEP015OC1_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -69,6 +78,7 @@ class GxGDEP015OC1 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEP015OC1";};
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -82,6 +92,10 @@ class GxGDEP015OC1 : public GxEPD
     void _writeCommand(uint8_t command);
     void _writeCommandData(const uint8_t* pCommandData, uint8_t datalen);
     void _SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1);
+#if GxEPD_DIRTY_TRACKING
+    void _writeDirtyWindows();
+    uint32_t _dirtyCost() {return GxEPD_DIRTY_WINDOW_COST;};
+#endif
     void _SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1);
     void _PowerOn(void);
     void _PowerOff(void);
@@ -94,14 +108,16 @@ class GxGDEP015OC1 : public GxEPD
     void _Update_Part(void);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   protected:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEP015OC1_WIDTH, GxGDEP015OC1_HEIGHT, 1> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif defined(__AVR)
     uint8_t _buffer[GxGDEP015OC1_PAGE_SIZE];
 #else
     uint8_t _buffer[GxGDEP015OC1_BUFFER_SIZE];
 #endif
   private:
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -133,6 +149,7 @@ class GxGDEP015OC1 : public GxEPD
 #define GxEPD_HEIGHT GxGDEP015OC1_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEP015OC1/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEP015OC1/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEP015OC1/BitmapExamples_packed.h>
 #endif
 
 #endif
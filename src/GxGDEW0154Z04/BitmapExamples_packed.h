@@ -0,0 +1,548 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h BitmapWaveshare.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 10000 bytes, packed 2529
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x10,0x27,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x8A,0xFF,0x01,0xC0,0x03,0xFE,
+0xFF,0x02,0xF0,0x00,0x00,0xD8,0xFF,0x09,0xFC,0x00,0x00,0x3F,0xFF,0xFF,0xF0,0x00,
+0x00,0x3F,0xD9,0xFF,0x09,0xF0,0x00,0x00,0x3F,0xFF,0xFF,0xF0,0x00,0x00,0x0F,0xD9,
+0xFF,0x09,0xC0,0x0F,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xF0,0x0F,0xD9,0xFF,0x15,0xC0,
+0x3F,0xFF,0x3F,0xFF,0xFF,0xF0,0x0F,0xF0,0x0F,0xFF,0xC0,0x0F,0xFF,0x00,0xC0,0xF0,
+0x0C,0x00,0x03,0xFC,0x00,0xE5,0xFF,0x00,0x00,0xFC,0xFF,0x0F,0xF0,0x0F,0xF0,0x3F,
+0xFC,0x00,0x00,0xFF,0x00,0x00,0xF0,0x00,0x0C,0x03,0xFC,0x03,0xE5,0xFF,0x00,0x00,
+0xFC,0xFF,0x0F,0xF0,0x00,0x00,0x3F,0xF0,0x00,0x00,0xFF,0x00,0x00,0xF0,0x00,0x0C,
+0x03,0xFC,0x03,0xE5,0xFF,0x00,0x00,0xFC,0xFF,0x0F,0xF0,0x00,0x00,0x3F,0xC0,0x0F,
+0xC0,0x3F,0x00,0xFF,0xF0,0x0F,0xFC,0x00,0xF0,0x0F,0xE5,0xFF,0x15,0x00,0xFF,0xFF,
+0xFC,0x00,0x03,0xF0,0x00,0x00,0x0F,0xC0,0x3F,0xC0,0x3F,0x00,0xFF,0xF0,0x0F,0xFF,
+0x00,0xF0,0x0F,0xE5,0xFF,0x15,0x00,0xFF,0xFF,0xFC,0x00,0x03,0xF0,0x0F,0xF0,0x03,
+0xC0,0x00,0x00,0x3F,0x00,0xFF,0xF0,0x0F,0xFF,0x00,0xF0,0x0F,0xE5,0xFF,0x15,0x00,
+0xFF,0xFF,0xFC,0x00,0x03,0xF0,0x0F,0xFC,0x03,0xC0,0x00,0x00,0x3F,0x00,0xFF,0xF0,
+0x0F,0xFF,0xC0,0x00,0x3F,0xE5,0xFF,0x15,0xC0,0x3F,0xFF,0x3F,0xFF,0xFF,0xF0,0x0F,
+0xFC,0x03,0xC0,0x3F,0xFF,0xFF,0x00,0xFF,0xF0,0x0F,0xFF,0xC0,0x00,0x3F,0xE5,0xFF,
+0x14,0xC0,0x0F,0xF0,0x3F,0xFF,0xFF,0xF0,0x0F,0xF0,0x03,0xC0,0x0F,0xFC,0x3F,0x00,
+0xFF,0xF0,0x0F,0xFF,0xC0,0x00,0xE4,0xFF,0x14,0xF0,0x00,0x00,0x3F,0xFF,0xFF,0xF0,
+0x00,0x00,0x0F,0xF0,0x00,0x00,0x3F,0x00,0xFF,0xF0,0x0F,0xFF,0xF0,0x00,0xE4,0xFF,
+0x14,0xFC,0x00,0x00,0x3F,0xFF,0xFF,0xF0,0x00,0x00,0x0F,0xFC,0x00,0x00,0x3F,0x00,
+0xFF,0xF0,0x0F,0xFF,0xF0,0x03,0xE3,0xFF,0x01,0xC0,0x03,0xFE,0xFF,0x0E,0xF0,0x00,
+0x00,0xFF,0xFF,0xC0,0x00,0xFF,0x00,0xFF,0xF0,0x0F,0xFF,0xFC,0x03,0xD1,0xFF,0x01,
+0xF0,0x03,0xD1,0xFF,0x01,0xF0,0x0F,0xD1,0xFF,0x01,0xC0,0x0F,0xD1,0xFF,0x01,0xC0,
+0x3F,0x81,0xFF,0x81,0xFF,0xB6,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0x0F,0xF9,0xFF,0x01,
+0xFC,0x3F,0xFE,0xFF,0x00,0xC3,0xFD,0xFF,0x00,0xF0,0xE9,0xFF,0x06,0x0F,0xFC,0x3C,
+0x3F,0xFF,0xFF,0x0F,0xFE,0xFF,0x01,0x00,0x03,0xFE,0xFF,0x05,0xFC,0x3F,0xFC,0x00,
+0x3F,0xC3,0xFD,0xFF,0x00,0xF0,0xE9,0xFF,0x02,0x0F,0xFC,0x3F,0xFE,0xFF,0x00,0x0F,
+0xFE,0xFF,0x00,0x0F,0xFD,0xFF,0x04,0xFC,0x3F,0xFC,0x3F,0x0F,0xFC,0xFF,0x00,0xF0,
+0xE9,0xFF,0x1E,0x0F,0xFC,0x3C,0x3F,0x00,0x0F,0x0C,0x0F,0xFF,0xFF,0x0F,0xFF,0xC3,
+0x03,0xFC,0x00,0x3F,0xFC,0x3F,0xC3,0xC3,0xF0,0x03,0xC3,0x03,0xF0,0xFC,0x00,0xFC,
+0x3F,0x0F,0xEE,0xFF,0x12,0x0F,0xFC,0x3C,0x3C,0x3F,0x0F,0x03,0xC3,0xFF,0xFF,0x0F,
+0xFF,0xC0,0xF0,0xF0,0xFC,0x3F,0xFC,0x3F,0xFE,0xC3,0x08,0xFF,0xC0,0xF0,0xF0,0xFF,
+0xFC,0x3C,0x3F,0x0F,0xEE,0xFF,0x1E,0x00,0x00,0x3C,0x3C,0x3F,0x0F,0x0F,0xC3,0xC0,
+0x0F,0x00,0x03,0xC3,0xF0,0xF0,0xFC,0x3F,0xFC,0x3F,0xC3,0xC3,0xC0,0xFF,0xC3,0xF0,
+0xF0,0xFC,0x00,0x3C,0x3F,0x0F,0xEE,0xFF,0x17,0x0F,0xFC,0x3C,0x3C,0x3F,0x0F,0x0F,
+0xC3,0xFF,0xFF,0x0F,0xFF,0xC3,0xF0,0xF0,0xFC,0x3F,0xFC,0x3F,0xC3,0xC3,0xF0,0x0F,
+0xC3,0xFE,0xF0,0x03,0xFC,0x3F,0x0C,0x3F,0xEE,0xFF,0x17,0x0F,0xFC,0x3C,0x3C,0x3F,
+0x0F,0x0F,0xC3,0xFF,0xFF,0x0F,0xFF,0xC3,0xF0,0xF0,0xFC,0x3F,0xFC,0x3F,0xC3,0xC3,
+0xFF,0x03,0xC3,0xFE,0xF0,0x03,0xFC,0x3F,0x0C,0x3F,0xEE,0xFF,0x01,0x0F,0xFC,0xFE,
+0x3C,0x07,0x0F,0x0F,0xC3,0xFF,0xFF,0x0F,0xFF,0xC3,0xFE,0xF0,0x07,0x3F,0xFC,0x3F,
+0x0F,0xC3,0xFF,0xC3,0xC3,0xFE,0xF0,0x02,0xFC,0x3F,0xC0,0xED,0xFF,0x1D,0x0F,0xFC,
+0x3C,0x3F,0x03,0x0F,0x0F,0xC3,0xFF,0xFF,0x00,0x03,0xC3,0xF0,0xFC,0x0C,0x3F,0xFC,
+0x00,0x3F,0xC3,0xC0,0x0F,0xC0,0x03,0xF0,0xFC,0x00,0x3F,0xC0,0xE8,0xFF,0x00,0x0F,
+0xF0,0xFF,0x00,0xC3,0xFC,0xFF,0x00,0xF0,0xE8,0xFF,0x00,0x0F,0xF0,0xFF,0x00,0xC3,
+0xFC,0xFF,0x00,0xC3,0xE9,0xFF,0x01,0x00,0x3F,0xF0,0xFF,0x00,0xC3,0xFC,0xFF,0x00,
+0xC3,0x81,0xFF,0xD7,0xFF,0x02,0xC0,0xF3,0xF3,0xF6,0xFF,0x01,0xFC,0x3F,0xF6,0xFF,
+0x01,0xFC,0x3F,0xEC,0xFF,0x02,0x0F,0xF3,0xF3,0xFE,0xFF,0x01,0x00,0x0F,0xFB,0xFF,
+0x01,0xFC,0x3F,0xF8,0xFF,0x03,0xF0,0x00,0xFC,0x3F,0xEC,0xFF,0x00,0x0F,0xFC,0xFF,
+0x01,0x0F,0xC3,0xFB,0xFF,0x01,0xFC,0x3F,0xF8,0xFF,0x02,0xF0,0xFC,0x3F,0xEC,0xFF,
+0x1D,0xFC,0x00,0xC3,0xF0,0xF0,0xC3,0xFF,0x0F,0xC3,0xF0,0x03,0xFC,0x00,0xF0,0xC0,
+0xFC,0x30,0x3F,0xC0,0x0F,0xC3,0x0C,0x30,0xC3,0xF0,0xFF,0xF0,0xFC,0x3C,0x3F,0xEC,
+0xFF,0x0E,0x0F,0xC3,0xF0,0xF0,0x03,0xFF,0x0F,0xC3,0xFF,0xF0,0xF0,0xFF,0xF0,0x3C,
+0x3C,0xFE,0x0F,0x0A,0xC3,0xC0,0x0C,0x00,0xC3,0xF0,0xFF,0xF0,0xFC,0x3C,0x3F,0xEC,
+0xFF,0x1C,0x0F,0xC3,0xF0,0xF0,0xFF,0xFF,0x00,0x0F,0xF0,0x00,0xF0,0x3F,0xF0,0xFC,
+0x3C,0x3F,0x0F,0x0F,0xC3,0xC3,0xFC,0x3F,0xC3,0xF0,0xFF,0xF0,0xFC,0x3C,0x3F,0xEC,
+0xFF,0x1C,0x0F,0xC3,0xF0,0xF0,0xFF,0xFF,0x0C,0x3F,0xC3,0xF0,0xFC,0x03,0xF0,0xFC,
+0x3C,0x3F,0x0F,0x00,0x03,0xC3,0xFC,0x3F,0xF0,0xC3,0xFF,0xF0,0x00,0xFC,0x3F,0xEC,
+0xFF,0x1C,0x0F,0xC3,0xF0,0xF0,0xFF,0xFF,0x0F,0x0F,0xC3,0xF0,0xFF,0xC0,0xF0,0xFC,
+0x3C,0x3F,0x0F,0x0F,0xFF,0xC3,0xFC,0x3F,0xF0,0xC3,0xFF,0xF0,0xFF,0xFC,0x3F,0xEC,
+0xFF,0x1C,0x0F,0xC3,0xC0,0xF0,0xFF,0xFF,0x0F,0xC3,0xC3,0xF0,0xFF,0xF0,0xF0,0xFC,
+0x3C,0x3F,0x0F,0x0F,0xC3,0xC3,0xFC,0x3F,0xFC,0x0F,0xFF,0xF0,0xFF,0xFC,0x3F,0xEC,
+0xFF,0x1C,0x0F,0xF0,0x30,0xF0,0xFF,0xFF,0x0F,0xF0,0xF0,0x00,0xF0,0x03,0xF0,0x00,
+0xFC,0x00,0x3F,0xC0,0x0F,0xC3,0xFC,0x3F,0xFC,0x0F,0xFF,0xF0,0xFF,0xFC,0x3F,0xE0,
+0xFF,0x00,0xF0,0xF7,0xFF,0x00,0x0F,0xDB,0xFF,0x00,0xF0,0xF8,0xFF,0x01,0xFC,0x3F,
+0xDB,0xFF,0x00,0xF0,0xF8,0xFF,0x01,0xFC,0x3F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xE1,0xFF,0x03,0xF5,0x5F,0xF5,0x5F,0xFA,0xFF,
+0x01,0xD5,0x7F,0xDC,0xFF,0x03,0xF5,0x5F,0xF5,0x5F,0xFA,0xFF,0x01,0xD5,0x7F,0xDC,
+0xFF,0x03,0xF5,0x5F,0xF5,0x5F,0xFA,0xFF,0x01,0xD5,0x7F,0xDC,0xFF,0x1B,0xF5,0x5F,
+0xF5,0x5F,0xFF,0x55,0x5F,0xFD,0x57,0xD5,0x7F,0x55,0x55,0xFF,0x55,0x5F,0xFF,0xFF,
+0xF5,0x5D,0x57,0xFF,0x55,0xF5,0x5F,0xF5,0x5D,0x7F,0xEB,0xFF,0x1C,0xF5,0x5F,0xF5,
+0x5F,0xFD,0x55,0x57,0xFD,0x57,0xD5,0x7F,0x55,0x55,0xFD,0x55,0x57,0xFF,0xFF,0xF5,
+0x55,0x55,0xFF,0x55,0xF5,0x5F,0xF5,0x55,0x7D,0x57,0xEC,0xFF,0x1C,0xF5,0x55,0x55,
+0x5F,0xF5,0x7F,0x55,0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xF5,0x7F,0x55,0xFF,0xFF,0xF5,
+0x5F,0x55,0xFF,0x55,0xF5,0x5F,0xF5,0x5F,0xFD,0x57,0xEC,0xFF,0x1C,0xF5,0x55,0x55,
+0x5F,0xD5,0x7F,0x55,0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xD5,0x7F,0x55,0xFF,0xFF,0xF5,
+0x5F,0x55,0xFF,0x55,0xF5,0x5F,0xF5,0x5F,0xFD,0x57,0xEC,0xFF,0x1C,0xF5,0x55,0x55,
+0x5F,0xD5,0x55,0x55,0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xD5,0x55,0x55,0xFF,0xFF,0xF5,
+0x5F,0x55,0xFF,0x55,0xF5,0x5F,0xF5,0x5F,0xFD,0x57,0xEC,0xFF,0x1A,0xF5,0x5F,0xF5,
+0x5F,0xD5,0x55,0x55,0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xD5,0x55,0x55,0xFF,0xFF,0xF5,
+0x5F,0x55,0xFF,0x55,0xF5,0x5F,0xF5,0x5F,0xEA,0xFF,0x0E,0xF5,0x5F,0xF5,0x5F,0xD5,
+0x7F,0xFF,0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xD5,0x7F,0xFE,0xFF,0x08,0xF5,0x5F,0x55,
+0xFF,0x55,0xF5,0x5F,0xF5,0x5F,0xEA,0xFF,0x1C,0xF5,0x5F,0xF5,0x5F,0xD5,0x7F,0xFD,
+0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xD5,0x7F,0xFD,0xFF,0xFF,0xF5,0x5F,0x55,0xFF,0x55,
+0xF5,0x5F,0xF5,0x5F,0xFD,0x57,0xEC,0xFF,0x1C,0xF5,0x5F,0xF5,0x5F,0xF5,0x5F,0xF5,
+0xFD,0x57,0xD5,0x7F,0xD5,0x7F,0xF5,0x5F,0xF5,0xFF,0xFF,0xF5,0x5F,0x55,0xFF,0x55,
+0xF5,0x5F,0xF5,0x5F,0xFD,0x57,0xEC,0xFF,0x1C,0xF5,0x5F,0xF5,0x5F,0xFD,0x55,0x55,
+0xFD,0x55,0x55,0x7F,0xD5,0x55,0xFD,0x55,0x55,0xFF,0xFF,0xF5,0x5F,0x55,0xFF,0x55,
+0x55,0x5F,0xF5,0x5F,0xFD,0x57,0xEC,0xFF,0x1C,0xF5,0x5F,0xF5,0x5F,0xFF,0x55,0x57,
+0xFF,0x55,0xD5,0x7F,0xFD,0x55,0xFF,0x55,0x57,0xFF,0xFF,0xF5,0x5F,0x55,0xFF,0xD5,
+0x75,0x5F,0xF5,0x5F,0xFD,0x57,0x81,0xFF,0x81,0xFF,0xB6,0xFF,0x02,0xF5,0x55,0x5F,
+0xFC,0xFF,0x05,0xF5,0x55,0x5F,0xFF,0xFF,0xF5,0xFE,0x55,0x00,0x5F,0xFC,0xFF,0x01,
+0xD5,0x55,0xFD,0xFF,0x01,0x55,0x57,0xEE,0xFF,0xFE,0x55,0x00,0x7F,0xFE,0xFF,0x00,
+0xF5,0xFE,0x55,0x02,0x7F,0xFF,0xF5,0xFE,0x55,0x00,0x5F,0xFD,0xFF,0x09,0xFD,0x55,
+0x55,0x5F,0xFF,0xFF,0xF5,0x55,0x55,0x7F,0xF0,0xFF,0x00,0xFD,0xFE,0x55,0x00,0x5F,
+0xFE,0xFF,0x00,0xF5,0xFE,0x55,0x02,0x5F,0xFF,0xF5,0xFE,0x55,0x00,0x5F,0xFD,0xFF,
+0x05,0xD5,0x55,0x55,0x57,0xFF,0xFF,0xFE,0x55,0x00,0x5F,0xF0,0xFF,0x00,0xF5,0xFE,
+0x55,0x00,0x5F,0xFE,0xFF,0x00,0xF5,0xFE,0x55,0x02,0x57,0xFF,0xF5,0xFE,0x55,0x00,
+0x5F,0xFD,0xFF,0x00,0xD5,0xFE,0x55,0x01,0xFF,0xFF,0xFE,0x55,0x00,0x57,0xF0,0xFF,
+0x04,0xD5,0x55,0x7F,0xD5,0x5F,0xFE,0xFF,0x07,0xF5,0x5F,0xFF,0x55,0x57,0xFF,0xF5,
+0x55,0xFA,0xFF,0x09,0x55,0x57,0xF5,0x55,0x7F,0xFD,0x55,0x5F,0xD5,0x55,0xF0,0xFF,
+0x04,0x55,0x57,0xFF,0xFD,0x5F,0xFE,0xFF,0x07,0xF5,0xFF,0xFF,0xD5,0x57,0xFF,0xF5,
+0x55,0xFB,0xFF,0x0A,0xFD,0x55,0x5F,0xFD,0x55,0x7F,0xF5,0x55,0x7F,0xF5,0x55,0xF0,
+0xFF,0x04,0x55,0x5F,0xFF,0xFF,0x5F,0xFE,0xFF,0x07,0xF7,0xFF,0xFF,0xD5,0x57,0xFF,
+0xF5,0x55,0xFB,0xFF,0x0B,0xFD,0x55,0x7F,0xFF,0x55,0x5F,0xF5,0x55,0xFF,0xFD,0x55,
+0x7F,0xF2,0xFF,0x05,0xFD,0x55,0x5F,0xFF,0xFF,0xDF,0xFB,0xFF,0x04,0xD5,0x57,0xFF,
+0xF5,0x55,0xFB,0xFF,0x0B,0xFD,0x55,0x7F,0xFF,0x55,0x5F,0xF5,0x55,0xFF,0xFD,0x55,
+0x7F,0xF2,0xFF,0x03,0xF5,0x55,0x55,0x5F,0xF9,0xFF,0x06,0x55,0x5F,0xFF,0xF5,0x55,
+0x55,0x5F,0xFD,0xFF,0x0B,0xFD,0x55,0x7F,0xFF,0x55,0x5F,0xF5,0x55,0xFF,0xFD,0x55,
+0x7F,0xF2,0xFF,0x03,0xD5,0x55,0x55,0x7F,0xFB,0xFF,0x05,0xFD,0x55,0x55,0x7F,0xFF,
+0xF5,0xFE,0x55,0xFD,0xFF,0x0B,0xFD,0x55,0x7F,0xFF,0x55,0x5F,0xF5,0x55,0xFF,0xFD,
+0x55,0x7F,0xF2,0xFF,0x02,0xFD,0x55,0x7F,0xFA,0xFF,0x05,0xFD,0x55,0x57,0xFF,0xFF,
+0xF5,0xFE,0x55,0x00,0x7F,0xFE,0xFF,0x0B,0xFD,0x55,0x5F,0xFF,0x55,0x5F,0xF5,0x55,
+0x7F,0xFD,0x55,0x7F,0xF2,0xFF,0x02,0xFD,0x55,0x7F,0xFA,0xFF,0x05,0xFD,0x55,0x55,
+0x7F,0xFF,0xF5,0xFE,0x55,0x00,0x5F,0xFE,0xFF,0x0B,0xFD,0x55,0x57,0xFF,0x55,0x5F,
+0xF5,0x55,0x5F,0xFD,0x55,0x7F,0xF2,0xFF,0x02,0xFD,0x55,0x7F,0xFA,0xFF,0x09,0xFD,
+0x55,0x55,0x5F,0xFF,0xF5,0xFF,0xFD,0x55,0x57,0xFD,0xFF,0xFD,0x55,0x01,0x5F,0xFD,
+0xFD,0x55,0x00,0x7F,0xF2,0xFF,0x02,0xF5,0x55,0x55,0xF8,0xFF,0x01,0xD5,0x57,0xFD,
+0xFF,0x01,0x55,0x57,0xFD,0xFF,0x00,0xD5,0xFE,0x55,0x01,0x5F,0xFF,0xFD,0x55,0x00,
+0x7F,0xF2,0xFF,0x02,0xD5,0x55,0x55,0xF8,0xFF,0x01,0xF5,0x55,0xFD,0xFF,0x01,0xD5,
+0x57,0xFD,0xFF,0x00,0xF5,0xFE,0x55,0x02,0x5F,0xFF,0xD5,0xFE,0x55,0x00,0x7F,0xF2,
+0xFF,0x02,0xFD,0x55,0x5F,0xF8,0xFF,0x01,0xF5,0x55,0xFD,0xFF,0x01,0xD5,0x57,0xFD,
+0xFF,0x09,0xFD,0x55,0x5F,0x55,0x7F,0xFF,0xF5,0x55,0x7D,0x55,0xF0,0xFF,0x04,0x55,
+0x5F,0xFF,0xFF,0xDF,0xFB,0xFF,0x01,0xF5,0x55,0xFD,0xFF,0x01,0xD5,0x57,0xFB,0xFF,
+0x02,0xFD,0x55,0x7F,0xFE,0xFF,0x01,0xF5,0x55,0xF0,0xFF,0x04,0x55,0x57,0xFF,0xFF,
+0x5F,0xFE,0xFF,0x0A,0xDF,0xFF,0xFF,0xF5,0x55,0xFF,0xDF,0xFF,0xFF,0xD5,0x57,0xFB,
+0xFF,0x02,0xFD,0x55,0x7F,0xFE,0xFF,0x01,0xF5,0x55,0xF0,0xFF,0x04,0x55,0x57,0xFF,
+0xFD,0x5F,0xFE,0xFF,0x0D,0xD5,0xFF,0xFF,0xD5,0x55,0xFF,0xD5,0xFF,0xFF,0x55,0x5F,
+0xFF,0xD5,0x57,0xFE,0xFF,0x01,0xF5,0x55,0xFD,0xFF,0x01,0xD5,0x57,0xF0,0xFF,0x04,
+0xD5,0x55,0x7F,0xD5,0x5F,0xFE,0xFF,0x18,0xD5,0x5F,0xFF,0x55,0x57,0xFF,0xD5,0x7F,
+0xFD,0x55,0x5F,0xFF,0xD5,0x5F,0xFF,0xD7,0xFF,0x55,0x55,0xFF,0xFF,0x5F,0xFD,0x55,
+0x57,0xF0,0xFF,0x00,0xF5,0xFE,0x55,0x00,0x5F,0xFE,0xFF,0x00,0xD5,0xFE,0x55,0x02,
+0x57,0xFF,0xD5,0xFE,0x55,0x0A,0x7F,0xFF,0x55,0x5F,0xFF,0xD5,0x55,0x55,0x57,0xFF,
+0xFF,0xFE,0x55,0x00,0x5F,0xF0,0xFF,0x00,0xFD,0xFE,0x55,0x00,0x5F,0xFE,0xFF,0x00,
+0xD5,0xFE,0x55,0x02,0x5F,0xFF,0xD5,0xFE,0x55,0x0A,0xFF,0xFF,0x55,0x7F,0xFF,0xD5,
+0x55,0x55,0x5F,0xFF,0xFF,0xFE,0x55,0x00,0x7F,0xEF,0xFF,0xFE,0x55,0xFD,0xFF,0x00,
+0xD5,0xFE,0x55,0x0D,0xFF,0xFF,0xD5,0x55,0x55,0x57,0xFF,0xFF,0x55,0x7F,0xFF,0xD5,
+0x55,0x55,0xFE,0xFF,0x02,0x55,0x55,0x57,0xEE,0xFF,0x02,0xF5,0x55,0x5F,0xFC,0xFF,
+0x02,0x55,0x55,0x5F,0xFE,0xFF,0x0A,0x55,0x55,0x7F,0xFF,0xFF,0x55,0xFF,0xFF,0xD5,
+0x55,0x5F,0xFE,0xFF,0x02,0x55,0x55,0x7F,0xDC,0xFF,0x01,0xFD,0x55,0xD1,0xFF,0x01,
+0xFD,0x55,0xD1,0xFF,0x01,0xFD,0x57,0xD1,0xFF,0x01,0xFD,0x57,0xD1,0xFF,0x01,0xF5,
+0x5F,0xD1,0xFF,0x01,0xF5,0x5F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xB5,0xFF,0x02,0xC3,0xFF,0xC3,
+0xFA,0xFF,0x00,0xC3,0xDA,0xFF,0x02,0xC3,0xFF,0xC3,0xFA,0xFF,0x00,0xC3,0xFC,0xFF,
+0x00,0xC3,0xE0,0xFF,0x02,0xC3,0xFF,0xC3,0xFA,0xFF,0x00,0xC3,0xFC,0xFF,0x00,0xC3,
+0xED,0xFF,0x21,0xC0,0x0F,0xF0,0x0F,0xC3,0x0C,0x3F,0x00,0xFC,0x30,0xF0,0x0F,0xF0,
+0x03,0xFF,0xC0,0x0F,0xC3,0xC3,0xFF,0xF0,0x0F,0xF0,0x03,0xC0,0x0C,0x0F,0xF0,0x0F,
+0x00,0x3C,0x03,0xFC,0x03,0xF1,0xFF,0xFC,0xC3,0x00,0x0C,0xFE,0x3C,0x00,0x00,0xFD,
+0xC3,0x00,0xFF,0xFD,0xC3,0x01,0xFF,0xFF,0xFB,0xC3,0x02,0xFF,0xC3,0xC3,0xFE,0xF0,
+0xF0,0xFF,0xFC,0xC3,0x10,0x0C,0x3C,0x00,0x3C,0x3F,0xC0,0x03,0xC3,0xC3,0xFF,0xC3,
+0xC3,0xF0,0x0F,0xFF,0xF0,0x03,0xFC,0xC3,0x05,0xF0,0x03,0xC3,0xF0,0x00,0xF0,0xF0,
+0xFF,0xFC,0xC3,0x0E,0x0C,0x3C,0x3F,0xFC,0x3F,0xC3,0xFF,0xC3,0xC3,0xFF,0xC3,0xC3,
+0xF0,0x0F,0xFF,0xF7,0xC3,0x02,0xF0,0xFF,0xF0,0xF0,0xFF,0xFD,0xC3,0x0F,0xF0,0xF0,
+0xFC,0x3F,0x3C,0x3F,0xC3,0xF3,0xC3,0xC3,0xFF,0xC3,0xC3,0xFC,0x3F,0xFF,0xF7,0xC3,
+0x02,0xF0,0xFC,0xF0,0xF0,0xFF,0x17,0xC0,0x0F,0xF0,0x0F,0xF0,0xF0,0xFF,0x00,0xFC,
+0x3F,0xF0,0x0F,0xF0,0x03,0xFF,0xC0,0x0F,0xFC,0x3F,0xFF,0xF0,0x03,0xF0,0x03,0xFE,
+0xC3,0x06,0xF0,0x03,0xF0,0x3C,0x03,0xFC,0x03,0xF1,0xFF,0x00,0xC3,0xF1,0xFF,0x00,
+0xF0,0xE1,0xFF,0x00,0xC3,0xF1,0xFF,0x00,0xF0,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xA0,
+0xFF,
+};
+
+// BitmapExample2 : 5000 bytes, packed 795
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0xE4,0xFF,0x01,0xC3,0xC3,0xFE,0xFF,0x01,0xF8,0x7F,0xEF,0xFF,
+0x01,0xC3,0xC3,0xFE,0xFF,0x01,0xF8,0x7F,0xEF,0xFF,0x01,0xC3,0xC3,0xFE,0xFF,0x01,
+0xF8,0x7F,0xEF,0xFF,0x0D,0xC3,0xC3,0xF0,0x3E,0x18,0x70,0x0F,0x03,0xFF,0xC2,0x1F,
+0x0C,0x3C,0x27,0xF6,0xFF,0x0E,0xC3,0xC3,0xE0,0x1E,0x18,0x70,0x0E,0x01,0xFF,0xC0,
+0x0F,0x0C,0x3C,0x06,0x1F,0xF7,0xFF,0x0E,0xC0,0x03,0xC7,0x0E,0x18,0x78,0x7C,0x70,
+0xFF,0xC3,0x0F,0x0C,0x3C,0x3E,0x1F,0xF7,0xFF,0x0E,0xC0,0x03,0x87,0x0E,0x18,0x78,
+0x78,0x70,0xFF,0xC3,0x0F,0x0C,0x3C,0x3E,0x1F,0xF7,0xFF,0x0E,0xC0,0x03,0x80,0x0E,
+0x18,0x78,0x78,0x00,0xFF,0xC3,0x0F,0x0C,0x3C,0x3E,0x1F,0xF7,0xFF,0x0D,0xC3,0xC3,
+0x80,0x0E,0x18,0x78,0x78,0x00,0xFF,0xC3,0x0F,0x0C,0x3C,0x3F,0xF6,0xFF,0x0D,0xC3,
+0xC3,0x87,0xFE,0x18,0x78,0x78,0x7F,0xFF,0xC3,0x0F,0x0C,0x3C,0x3F,0xF6,0xFF,0x0E,
+0xC3,0xC3,0x87,0xEE,0x18,0x78,0x78,0x7E,0xFF,0xC3,0x0F,0x0C,0x3C,0x3E,0x1F,0xF7,
+0xFF,0xFE,0xC3,0x0B,0xCE,0x18,0x78,0x7C,0x3C,0xFF,0xC3,0x0F,0x0C,0x3C,0x3E,0x1F,
+0xF7,0xFF,0x0E,0xC3,0xC3,0xE0,0x0E,0x00,0x78,0x0E,0x00,0xFF,0xC3,0x0F,0x00,0x3C,
+0x3E,0x1F,0xF7,0xFF,0x0E,0xC3,0xC3,0xF0,0x1F,0x08,0x7E,0x0F,0x01,0xFF,0xC3,0x0F,
+0x84,0x3C,0x3E,0x1F,0x81,0xFF,0xDC,0xFF,0x0F,0xC0,0x3F,0xFF,0xFF,0xC0,0x3F,0xFC,
+0x00,0x03,0xFF,0xFF,0xF8,0x0F,0xFF,0xF0,0x1F,0xF8,0xFF,0x0F,0x00,0x07,0xFF,0xFC,
+0x00,0x07,0xFC,0x00,0x03,0xFF,0xFF,0xE0,0x03,0xFF,0xC0,0x07,0xF9,0xFF,0x10,0xFE,
+0x00,0x03,0xFF,0xFC,0x00,0x03,0xFC,0x00,0x03,0xFF,0xFF,0x80,0x01,0xFF,0x00,0x03,
+0xF9,0xFF,0x10,0xFC,0x00,0x03,0xFF,0xFC,0x00,0x01,0xFC,0x00,0x03,0xFF,0xFF,0x80,
+0x00,0xFF,0x00,0x01,0xF9,0xFF,0x08,0xF8,0x07,0x83,0xFF,0xFC,0x3F,0x01,0xFC,0x0F,
+0xFE,0xFF,0x04,0x01,0xC0,0x7E,0x03,0x80,0xF9,0xFF,0x10,0xF0,0x1F,0xE3,0xFF,0xFC,
+0xFF,0x81,0xFC,0x0F,0xFF,0xFF,0xFE,0x03,0xE0,0x7C,0x07,0xC0,0xF9,0xFF,0x11,0xF0,
+0x3F,0xF3,0xFF,0xFD,0xFF,0x81,0xFC,0x0F,0xFF,0xFF,0xFE,0x07,0xF0,0x3C,0x0F,0xE0,
+0x7F,0xFA,0xFF,0x02,0xE0,0x3F,0xFB,0xFE,0xFF,0x0B,0x81,0xFC,0x0F,0xFF,0xFF,0xFE,
+0x07,0xF0,0x3C,0x0F,0xE0,0x7F,0xFA,0xFF,0x01,0xC0,0x03,0xFD,0xFF,0x0B,0x03,0xFC,
+0x00,0x3F,0xFF,0xFE,0x07,0xF0,0x3C,0x0F,0xE0,0x7F,0xFA,0xFF,0x01,0x80,0x07,0xFE,
+0xFF,0x0C,0xE0,0x07,0xFC,0x00,0x0F,0xFF,0xFE,0x07,0xF0,0x3C,0x0F,0xE0,0x7F,0xFA,
+0xFF,0x01,0xE0,0x7F,0xFE,0xFF,0x0C,0xE0,0x1F,0xFC,0x00,0x07,0xFF,0xFE,0x03,0xF0,
+0x3C,0x07,0xE0,0x7F,0xFA,0xFF,0x01,0xE0,0x7F,0xFE,0xFF,0x0C,0xE0,0x07,0xFC,0x00,
+0x03,0xFF,0xFE,0x01,0xF0,0x3C,0x03,0xE0,0x7F,0xFA,0xFF,0x01,0xE0,0x7F,0xFE,0xFF,
+0x0C,0xE0,0x03,0xFC,0xFE,0x01,0xFF,0xFF,0x00,0x00,0x3E,0x00,0x00,0x7F,0xFA,0xFF,
+0x01,0xC0,0x0F,0xFD,0xFF,0x0B,0x81,0xFF,0xFF,0x01,0xFF,0xFF,0x80,0x00,0x3F,0x00,
+0x00,0x7F,0xFA,0xFF,0x01,0x80,0x0F,0xFD,0xFF,0x0B,0xC0,0xFF,0xFF,0x81,0xFF,0xFF,
+0xC0,0x00,0x3F,0x80,0x00,0x7F,0xFA,0xFF,0x01,0xE0,0x3F,0xFD,0xFF,0x0A,0xC0,0xFF,
+0xFF,0x81,0xFF,0xFF,0xE0,0x30,0x7F,0xC0,0x60,0xF9,0xFF,0x02,0xF0,0x3F,0xFB,0xFE,
+0xFF,0x03,0xC0,0xFF,0xFF,0x81,0xFE,0xFF,0x03,0xE0,0x7F,0xFF,0xC0,0xF9,0xFF,0x09,
+0xF0,0x1F,0xF3,0xFF,0xFB,0xFF,0xC0,0xFB,0xFF,0x81,0xFE,0xFF,0x03,0xE0,0x7F,0xFF,
+0xC0,0xF9,0xFF,0x10,0xF0,0x1F,0xE3,0xFF,0xF8,0xFF,0x80,0xF8,0xFF,0x03,0xF8,0x1F,
+0xFF,0xC0,0xFF,0xFF,0x81,0xF9,0xFF,0x10,0xF8,0x07,0x83,0xFF,0xF8,0x3F,0x01,0xF8,
+0x7E,0x03,0xF8,0x3F,0x9F,0x00,0xFF,0x3E,0x01,0xF9,0xFF,0x10,0xFC,0x00,0x03,0xFF,
+0xF8,0x00,0x01,0xF8,0x00,0x07,0xF0,0x3F,0x80,0x01,0xFF,0x00,0x03,0xF9,0xFF,0x10,
+0xFE,0x00,0x03,0xFF,0xF8,0x00,0x03,0xF8,0x00,0x0F,0xF0,0x7F,0x80,0x03,0xFF,0x00,
+0x07,0xF8,0xFF,0x0F,0x00,0x0F,0xFF,0xF8,0x00,0x0F,0xF8,0x00,0x1F,0xF0,0x7F,0x80,
+0x0F,0xFF,0x00,0x1F,0xF8,0xFF,0x0F,0xC0,0x3F,0xFF,0xFF,0x00,0x3F,0xFF,0x00,0x7F,
+0xF0,0xFF,0x80,0x3F,0xFF,0x00,0x7F,0xEF,0xFF,0x00,0xE0,0xE9,0xFF,0x00,0xE0,0xE9,
+0xFF,0x00,0xE1,0xE9,0xFF,0x00,0xE1,0xE9,0xFF,0x00,0xC3,0xE9,0xFF,0x00,0xC3,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xEE,0xFF,
+};
+
+// BitmapWaveshare_black : 5000 bytes, packed 2696
+const unsigned char BitmapWaveshare_black_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0x83,0xFF,0x02,0xF7,0xFF,0x3F,0xEB,0xFF,0x02,0xE1,0xFE,0x1F,
+0xEB,0xFF,0x02,0xE3,0xFF,0x1F,0xEB,0xFF,0x02,0xE3,0xFF,0x9F,0xF2,0xFF,0x00,0xE0,
+0xFE,0x00,0x05,0x01,0xFF,0xFF,0xE7,0xFF,0x8F,0xEE,0xFF,0x05,0xFC,0xFF,0xFF,0xE3,
+0xFF,0x8F,0xEE,0xFF,0x05,0xFE,0xFF,0xFF,0xE3,0xFF,0x1F,0xEE,0xFF,0x05,0xFE,0xFF,
+0xFF,0xE1,0xFE,0x1F,0xEE,0xFF,0x05,0xFE,0xFF,0xFF,0xF0,0xFC,0x1F,0xEE,0xFF,0x05,
+0xFE,0xFF,0xFF,0xF0,0x00,0x3F,0xEE,0xFF,0x05,0xFE,0xFF,0xFF,0xF8,0x00,0x7F,0xEE,
+0xFF,0x04,0xFE,0xFF,0xFF,0xFE,0x01,0xED,0xFF,0x00,0xFE,0xE9,0xFF,0x03,0x7E,0xFF,
+0xFF,0xFB,0xED,0xFF,0x04,0xFC,0x3E,0xFF,0xFF,0xE0,0xF2,0xFF,0x00,0xFE,0xFD,0xFF,
+0x05,0xF0,0x3E,0xFF,0xFF,0xC6,0x7F,0xF3,0xFF,0x00,0xFE,0xFD,0xFF,0x05,0xE0,0xCE,
+0xFF,0xFF,0xCE,0x7F,0xF3,0xFF,0x00,0xFE,0xFD,0xFF,0x05,0x81,0x86,0xFF,0xFF,0xCE,
+0x7F,0xF3,0xFF,0x00,0xFE,0xFD,0xFF,0x05,0x02,0x06,0xFF,0xFF,0xC6,0x7F,0xF3,0xFF,
+0x00,0xFE,0xFE,0xFF,0x05,0xFE,0x0C,0x02,0xFF,0xFF,0xE0,0xF2,0xFF,0x00,0xFE,0xFE,
+0xFF,0x05,0xFE,0x18,0x02,0xFF,0xFF,0xFB,0xF2,0xFF,0x00,0xFE,0xFE,0xFF,0x02,0xFE,
+0x20,0x00,0xEF,0xFF,0x00,0xFE,0xFE,0xFF,0x02,0xFE,0xC0,0x02,0xFE,0xFF,0x00,0x03,
+0xF3,0xFF,0x00,0xFE,0xFD,0xFF,0x06,0x00,0x02,0xFF,0xFF,0xF8,0x00,0x7F,0xF4,0xFF,
+0x00,0xFE,0xFD,0xFF,0x06,0x00,0x02,0xFF,0xFF,0xF0,0x00,0x3F,0xF4,0xFF,0x00,0xFE,
+0xFD,0xFF,0x06,0x80,0x06,0xFF,0xFF,0xE0,0xCC,0x1F,0xF4,0xFF,0x00,0xFE,0xFD,0xFF,
+0x06,0xC0,0x0E,0xFF,0xFF,0xE3,0xC7,0x1F,0xF4,0xFF,0x00,0xFE,0xFD,0xFF,0x06,0xC0,
+0x0E,0xFF,0xFF,0xE7,0xE7,0x8F,0xF4,0xFF,0x00,0xFE,0xFD,0xFF,0x06,0x00,0x1E,0xFF,
+0xFF,0xE7,0xE7,0x8F,0xF4,0xFF,0x00,0xFE,0xFE,0xFF,0x07,0xFC,0x00,0x3E,0xFF,0xFF,
+0xE3,0xC7,0x8F,0xF4,0xFF,0x0B,0xFE,0xFF,0x83,0xFF,0xF0,0x00,0x7E,0xFF,0xFF,0xE0,
+0x07,0x1F,0xF4,0xFF,0x0B,0xFE,0xFC,0x01,0xFF,0xE0,0x00,0xFE,0xFF,0xFF,0xF0,0x0F,
+0x1F,0xF4,0xFF,0x0B,0xFE,0xF0,0x07,0xFF,0x80,0x01,0xFE,0xFF,0xFF,0xF8,0x1F,0xBF,
+0xF4,0xFF,0x06,0xFE,0xC0,0x18,0xFE,0x00,0x03,0xFE,0xEF,0xFF,0x06,0xFE,0xC0,0xE0,
+0xF8,0x00,0x0F,0xFE,0xEF,0xFF,0x06,0xFE,0xC7,0x00,0xE0,0x00,0x1F,0xFE,0xFD,0xFF,
+0x00,0x9F,0xF4,0xFF,0x0B,0xFE,0xDC,0x00,0xC0,0x00,0x3F,0xFE,0xFF,0xFF,0xF8,0x3F,
+0x1F,0xF4,0xFF,0x01,0xFE,0xE0,0xFE,0x00,0x06,0xFF,0xFE,0xFF,0xFF,0xF0,0x0F,0x1F,
+0xF4,0xFF,0x0B,0xFE,0xC0,0x00,0x00,0x03,0xFF,0xFE,0xFF,0xFF,0xE0,0x03,0x1F,0xF4,
+0xFF,0x0B,0xFE,0xE0,0x00,0x00,0x07,0xFF,0xFE,0xFF,0xFF,0xE3,0xC1,0x9F,0xF4,0xFF,
+0x0B,0xFE,0xE0,0x00,0x00,0x1F,0xFF,0xFE,0xFF,0xFF,0xE7,0xE0,0x9F,0xF4,0xFF,0x0B,
+0xFE,0xF0,0x00,0x00,0xFF,0xFF,0xFE,0xFF,0xFF,0xE7,0xF8,0x1F,0xF4,0xFF,0x0B,0xFE,
+0xF8,0x00,0x03,0xFF,0xFF,0xFE,0xFF,0xFF,0xE7,0xFC,0x1F,0xF4,0xFF,0x0B,0xFE,0xFC,
+0x00,0x3F,0xFF,0xFF,0xFE,0xFF,0xFF,0xE3,0xFE,0x1F,0xF4,0xFF,0x02,0xFE,0xFF,0xB7,
+0xFE,0xFF,0x05,0xFE,0xFF,0xFF,0xF1,0xFF,0x1F,0xF4,0xFF,0x00,0xFE,0xFC,0xFF,0x05,
+0xFE,0xFF,0xFF,0xF3,0xFF,0x9F,0xF4,0xFF,0x00,0xFE,0xFC,0xFF,0x00,0xFE,0xEF,0xFF,
+0x00,0xFE,0xFC,0xFF,0x00,0xFE,0xEF,0xFF,0x00,0xFE,0xFC,0xFF,0x00,0xFE,0xFE,0xFF,
+0x00,0xDF,0xF3,0xFF,0x00,0xFE,0xFC,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0x8F,0xF3,0xFF,
+0x00,0xFE,0xFC,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0x87,0xF3,0xFF,0x00,0xFE,0xFC,0xFF,
+0x00,0xFE,0xFE,0xFF,0x00,0xC3,0xF3,0xFF,0x00,0xFE,0xFC,0xFF,0x00,0xFE,0xFE,0xFF,
+0x00,0xE3,0xF3,0xFF,0x01,0xFE,0x7F,0xFD,0xFF,0x00,0xFC,0xFE,0xFF,0x00,0xF3,0xF2,
+0xFF,0xFC,0x00,0x00,0x01,0xFE,0xFF,0x00,0xE3,0xE9,0xFF,0x00,0xE3,0xE9,0xFF,0x00,
+0xC3,0xE9,0xFF,0x00,0x87,0xE9,0xFF,0x00,0x8F,0xE9,0xFF,0x00,0x1F,0xE9,0xFF,0x00,
+0x1F,0xE9,0xFF,0x00,0x3F,0xEA,0xFF,0x01,0xFE,0x3F,0xE9,0xFF,0x00,0x1F,0xE9,0xFF,
+0x00,0x1F,0xE9,0xFF,0x00,0x0F,0xE9,0xFF,0x00,0x87,0xE9,0xFF,0x00,0xCF,0xB7,0xFF,
+0x00,0xF8,0xEA,0xFF,0x02,0xF8,0x70,0x3F,0xF0,0xFF,0x00,0xFA,0xFD,0xFF,0x02,0xF0,
+0x20,0x1F,0xFA,0xFF,0x01,0xE0,0x00,0xF9,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x02,0xE0,
+0x02,0x1F,0xFA,0xFF,0x02,0x00,0x00,0x0F,0xFA,0xFF,0x01,0x00,0x0F,0xFE,0xFF,0x02,
+0xE3,0x87,0x1F,0xFB,0xFF,0x03,0xFC,0x00,0x00,0x03,0xFB,0xFF,0x02,0xFE,0x00,0x07,
+0xFE,0xFF,0x02,0xE7,0x8F,0x8F,0xFB,0xFF,0x03,0xF0,0x00,0x00,0x01,0xFB,0xFF,0x08,
+0xFE,0x00,0x02,0x7F,0xFF,0xFF,0xE7,0xCF,0x8F,0xFB,0xFF,0x00,0xE0,0xFE,0x00,0xFB,
+0xFF,0x08,0xFC,0x00,0x00,0x7F,0xFF,0xFF,0xE7,0xCF,0x9F,0xFB,0xFF,0x00,0xC0,0xFE,
+0x00,0x00,0x7F,0xFC,0xFF,0x02,0xF8,0x00,0x00,0xFE,0xFF,0x02,0xE3,0xFF,0x1F,0xFB,
+0xFF,0x04,0xC0,0x0F,0xFE,0x00,0x3F,0xFC,0xFF,0x02,0xF8,0x30,0x00,0xFE,0xFF,0x02,
+0xF3,0xFE,0x1F,0xFB,0xFF,0x04,0x80,0xFF,0xFF,0xE0,0x3F,0xFC,0xFF,0x02,0xF8,0x30,
+0x00,0xFE,0xFF,0x02,0xF7,0xFF,0x3F,0xFB,0xFF,0x04,0x81,0xFF,0xFF,0xF8,0x1F,0xFC,
+0xFF,0x02,0xF0,0x00,0x00,0xF5,0xFF,0x04,0x83,0xFF,0xFF,0xF8,0x1F,0xFC,0xFF,0x02,
+0xF0,0x00,0x00,0xF5,0xFF,0x04,0x83,0xFF,0xFF,0xFC,0x1F,0xFC,0xFF,0x02,0x90,0x00,
+0x00,0xFC,0xFF,0x00,0x1F,0xFB,0xFF,0x04,0x83,0xFF,0xFF,0xFC,0x1F,0xFC,0xFF,0x02,
+0x10,0x00,0x00,0xFE,0xFF,0x02,0xF8,0x1F,0x1F,0xFB,0xFF,0x04,0x83,0xFF,0xFF,0xFC,
+0x1F,0xFD,0xFF,0x03,0xFC,0x10,0x00,0x00,0xFE,0xFF,0x02,0xF0,0x0F,0x1F,0xFB,0xFF,
+0x04,0x81,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0x03,0xF8,0x18,0x30,0x00,0xFE,0xFF,0x02,
+0xE0,0x03,0x1F,0xFB,0xFF,0x04,0x80,0xFF,0xFF,0xF0,0x3F,0xFD,0xFF,0x03,0xF8,0x08,
+0x38,0x00,0xFE,0xFF,0x02,0xE3,0xC1,0x9F,0xFB,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x3F,
+0xFD,0xFF,0x03,0xF0,0x08,0x30,0x01,0xFE,0xFF,0x02,0xE7,0xF0,0x9F,0xFB,0xFF,0x00,
+0xC0,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x03,0xE0,0x08,0x00,0x01,0xFE,0xFF,0x02,0xE7,
+0xF8,0x1F,0xFB,0xFF,0x00,0xE0,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x03,0xE0,0xE4,0x00,
+0x01,0xFE,0xFF,0x02,0xE7,0xFC,0x1F,0xFB,0xFF,0x00,0xF0,0xFE,0x00,0xFC,0xFF,0x03,
+0xE0,0xE2,0x00,0x03,0xFE,0xFF,0x02,0xE3,0xFE,0x1F,0xFB,0xFF,0x03,0xF8,0x00,0x00,
+0x03,0xFC,0xFF,0x03,0xC0,0xE2,0x00,0x07,0xFE,0xFF,0x02,0xF1,0xFF,0x1F,0xFB,0xFF,
+0x03,0xFE,0x00,0x00,0x0F,0xFC,0xFF,0x03,0xC0,0x41,0x00,0x0F,0xFE,0xFF,0x02,0xF3,
+0xFF,0x9F,0xFA,0xFF,0x02,0xC0,0x00,0x7F,0xFC,0xFF,0x03,0xC0,0x00,0xC0,0x1F,0xEC,
+0xFF,0x02,0xC0,0x00,0x30,0xEB,0xFF,0x03,0xC0,0x00,0x07,0x7F,0xEC,0xFF,0x03,0xC0,
+0x00,0x00,0x3F,0xEC,0xFF,0x03,0xC0,0x00,0x00,0x7F,0xF4,0xFF,0x01,0xF8,0x03,0xFB,
+0xFF,0x03,0xC0,0x40,0x00,0x7F,0xF4,0xFF,0x02,0x80,0x00,0x1F,0xFC,0xFF,0x03,0xC0,
+0xE0,0x00,0x7F,0xF5,0xFF,0x03,0xFC,0x00,0x00,0x07,0xFC,0xFF,0x03,0xE0,0xE0,0x00,
+0x7F,0xF5,0xFF,0x03,0xF8,0x00,0x00,0x01,0xFC,0xFF,0x03,0xE0,0xE0,0x00,0x7F,0xF5,
+0xFF,0x00,0xE0,0xFE,0x00,0xFC,0xFF,0x03,0xE0,0x00,0x00,0x3F,0xF5,0xFF,0x00,0xE0,
+0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x03,0xF0,0x00,0x00,0x3F,0xF5,0xFF,0x04,0xC0,0x00,
+0x60,0x00,0x3F,0xFD,0xFF,0x03,0xF8,0x00,0x01,0x1F,0xF5,0xFF,0x04,0x80,0x7F,0xFF,
+0xC0,0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x03,0xF4,0xFF,0x04,0x81,0xFF,0xFF,0xF0,0x1F,
+0xFD,0xFF,0x02,0xFC,0x00,0x07,0xF4,0xFF,0x04,0x83,0xFF,0xFF,0xF8,0x1F,0xFC,0xFF,
+0x01,0x00,0x0F,0xF4,0xFF,0x04,0x83,0xFF,0xFF,0xFC,0x1F,0xFC,0xFF,0x01,0x80,0x3F,
+0xF4,0xFF,0x04,0x83,0xFF,0xFF,0xFC,0x1F,0xED,0xFF,0x04,0x83,0xFF,0xFF,0xFC,0x1F,
+0xED,0xFF,0x04,0x83,0xFF,0xFF,0xF8,0x1F,0xED,0xFF,0x04,0x81,0xFF,0xFF,0xF0,0x3F,
+0xED,0xFF,0x04,0x80,0x7F,0xFF,0xC0,0x3F,0xED,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x3F,
+0xED,0xFF,0x00,0xE0,0xFE,0x00,0x00,0x7F,0xED,0xFF,0x00,0xF0,0xFE,0x00,0xEC,0xFF,
+0x03,0xF8,0x00,0x00,0x01,0xEC,0xFF,0x03,0xFC,0x00,0x00,0x07,0xEB,0xFF,0x02,0x80,
+0x00,0x3F,0xEB,0xFF,0x01,0xFC,0x07,0x81,0xFF,0xED,0xFF,0x03,0xE0,0xFF,0xF0,0x7F,
+0xFD,0xFF,0xFE,0x00,0x01,0x01,0x7F,0xF5,0xFF,0x03,0xC0,0x7F,0xE0,0x3F,0xFE,0xFF,
+0x05,0xFD,0x80,0x00,0x00,0x03,0x1F,0xF5,0xFF,0x03,0xC0,0x3F,0xE0,0x1F,0xFE,0xFF,
+0x05,0xF8,0x80,0x00,0x00,0x02,0x0F,0xF5,0xFF,0x03,0x80,0x3F,0xC0,0x1F,0xFE,0xFF,
+0x05,0xF0,0x40,0x00,0x00,0x04,0x0F,0xF5,0xFF,0x03,0x80,0x3F,0xC0,0x1F,0xFE,0xFF,
+0x05,0xF0,0x60,0x00,0x00,0x0C,0x07,0xF5,0xFF,0x03,0xC0,0x3F,0xE0,0x1F,0xFE,0xFF,
+0x05,0xF0,0x20,0x00,0x00,0x08,0x07,0xF5,0xFF,0x03,0xC0,0x7F,0xE0,0x3F,0xFE,0xFF,
+0x05,0xF0,0x30,0x00,0x00,0x10,0x07,0xF5,0xFF,0x03,0xF0,0xFF,0xF8,0x7F,0xFE,0xFF,
+0x05,0xF0,0x10,0x00,0x00,0x30,0x07,0xEE,0xFF,0x05,0xF0,0x18,0x00,0x00,0x20,0x07,
+0xEE,0xFF,0x05,0xF0,0x08,0x00,0x00,0x60,0x07,0xEE,0xFF,0x05,0xF0,0x04,0x00,0x00,
+0x40,0x07,0xEE,0xFF,0x05,0xF0,0x06,0x00,0x00,0x80,0x07,0xEE,0xFF,0x05,0xF0,0x02,
+0x00,0x01,0x80,0x07,0xF4,0xFF,0x01,0xFE,0x0F,0xFD,0xFF,0x05,0xF0,0x03,0x00,0x01,
+0x00,0x07,0xFD,0xFF,0x00,0xE0,0xFE,0x00,0xFD,0xFF,0x02,0x3F,0xF8,0x03,0xFD,0xFF,
+0x05,0xF0,0x01,0x00,0x02,0x00,0x07,0xFD,0xFF,0xFD,0x00,0xFE,0xFF,0x03,0xF8,0x07,
+0xF0,0x00,0xFD,0xFF,0x05,0xF0,0x01,0x80,0x06,0x00,0x07,0xFE,0xFF,0x00,0xFC,0xFD,
+0x00,0xFE,0xFF,0x04,0xF0,0x01,0xE0,0x00,0x7F,0xFE,0xFF,0x05,0xF0,0x00,0x80,0x04,
+0x00,0x07,0xFE,0xFF,0x04,0xF0,0x00,0x38,0x00,0x00,0xFE,0xFF,0x04,0xE0,0x00,0xC0,
+0x00,0x7F,0xFE,0xFF,0x05,0xF0,0x00,0x40,0x08,0x00,0x07,0xFE,0xFF,0x04,0xE0,0x00,
+0xFE,0x00,0x00,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x05,0xF0,0x00,
+0x40,0x08,0x00,0x07,0xFE,0xFF,0x04,0xC0,0x03,0xFF,0x80,0x00,0xFE,0xFF,0x04,0xC0,
+0x00,0x00,0xE0,0x3F,0xFE,0xFF,0x05,0xF0,0x00,0x20,0x10,0x00,0x07,0xFE,0xFF,0x04,
+0x80,0x0F,0xFF,0xF8,0x00,0xFE,0xFF,0x04,0x81,0xF8,0x01,0xF8,0x3F,0xFE,0xFF,0x05,
+0xF0,0x00,0x30,0x30,0x00,0x07,0xFE,0xFF,0x04,0x00,0x3F,0xFF,0xFC,0x00,0xFE,0xFF,
+0x04,0x83,0xFE,0x03,0xFC,0x1F,0xFE,0xFF,0x0D,0xF0,0x00,0x10,0x20,0x00,0x07,0xFF,
+0xFF,0xFE,0x00,0xFF,0xE7,0xFE,0x00,0xFE,0xFF,0x04,0x83,0xFE,0x07,0xFC,0x1F,0xFE,
+0xFF,0x0D,0xF0,0x00,0x18,0x40,0x00,0x07,0xFF,0xFF,0xFC,0x01,0xFF,0x81,0xFF,0x00,
+0xFE,0xFF,0x04,0x87,0xFE,0x07,0xFC,0x1F,0xFE,0xFF,0x0D,0xF0,0x00,0x08,0xC0,0x00,
+0x07,0xFF,0xFF,0xFC,0x01,0xFF,0x00,0x7F,0x00,0xFE,0xFF,0x04,0x87,0xFC,0x0F,0xFC,
+0x1F,0xFE,0xFF,0x0D,0xF0,0x00,0x04,0x80,0x00,0x07,0xFF,0xFF,0xF8,0x01,0xFF,0xC0,
+0x7F,0x80,0xFE,0xFF,0x04,0x87,0xFC,0x0F,0xFC,0x1F,0xFE,0xFF,0x0D,0xF0,0x00,0x05,
+0x00,0x00,0x07,0xFF,0xFF,0xF8,0x00,0xFF,0xF8,0x00,0x00,0xFE,0xFF,0x04,0x83,0xF8,
+0x1F,0xFC,0x1F,0xFE,0xFF,0x0D,0xF0,0x00,0x03,0x00,0x00,0x07,0xFF,0xFF,0xF0,0x00,
+0x1F,0xFE,0x00,0x00,0xFE,0xFF,0x04,0x81,0xF0,0x0F,0xF8,0x1F,0xFE,0xFF,0x0D,0xF0,
+0x00,0x03,0x00,0x00,0x07,0xFF,0xFF,0xF0,0x00,0x07,0xFF,0x80,0x00,0xFE,0xFF,0x04,
+0x80,0x00,0x07,0xF0,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x01,0x00,0x00,0x07,0xFF,0xFF,
+0xF1,0xFF,0x81,0xFF,0x80,0x00,0xFE,0xFF,0x04,0xC0,0x00,0x00,0xE0,0x3F,0xFE,0xFF,
+0x0D,0xF0,0x00,0x01,0x80,0x00,0x07,0xFF,0xFF,0xE0,0xFF,0x00,0x7F,0x80,0x00,0xFE,
+0xFF,0x04,0xC0,0x00,0x40,0x00,0x3F,0xFE,0xFF,0x0D,0xF0,0x47,0x80,0x80,0x00,0x07,
+0xFF,0xFF,0xE0,0x7F,0xC1,0x3F,0x80,0x00,0xFE,0xFF,0x04,0xE0,0x00,0xE0,0x00,0x7F,
+0xFE,0xFF,0x0D,0xF0,0x4F,0xC0,0x40,0x00,0x07,0xFF,0xFF,0xE0,0x3F,0xF9,0x4F,0x00,
+0x00,0xFE,0xFF,0x03,0xF0,0x03,0xE0,0x00,0xFD,0xFF,0x0D,0xF0,0x4C,0x40,0x40,0x00,
+0x07,0xFF,0xFF,0xE0,0x1F,0xFE,0x78,0x00,0x00,0xFE,0xFF,0x03,0xFC,0x07,0xF8,0x01,
+0xFD,0xFF,0x0D,0xF0,0x64,0xC0,0x40,0x00,0x07,0xFF,0xFF,0xE0,0x0F,0xFF,0x80,0x00,
+0x00,0xFC,0xFF,0x01,0xFC,0x03,0xFD,0xFF,0x0D,0xF0,0x7F,0xC0,0x40,0x00,0x07,0xFF,
+0xFF,0xE0,0x05,0xFF,0xF0,0x00,0x00,0xF6,0xFF,0x0D,0xF0,0x1F,0x00,0xC0,0x00,0x07,
+0xFF,0xFF,0xE0,0x00,0x3F,0xFC,0x00,0x00,0xF6,0xFF,0x0D,0xF0,0x00,0x00,0x80,0x00,
+0x07,0xFF,0xFF,0xE0,0x00,0x0F,0xFF,0x00,0x00,0xF6,0xFF,0x0D,0xF0,0x00,0x01,0x00,
+0x00,0x07,0xFF,0xFF,0xE0,0x00,0x03,0xFF,0x80,0x00,0xF6,0xFF,0x0D,0xF0,0x00,0x01,
+0x00,0x00,0x07,0xFF,0xFF,0xE0,0x00,0x07,0xFF,0x80,0x01,0xF6,0xFF,0x0D,0xF0,0x00,
+0x02,0x00,0x00,0x07,0xFF,0xFF,0xE0,0x00,0x3F,0xFF,0x00,0x01,0xFB,0xFF,0x01,0xF8,
+0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x06,0x00,0x00,0x07,0xFF,0xFF,0xE0,0x00,0xFF,0xFC,
+0x00,0x01,0xFB,0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x05,0x00,0x00,0x07,
+0xFF,0xFF,0xE0,0x01,0xFF,0xE0,0x00,0x01,0xFB,0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x0D,
+0xF0,0x00,0x0D,0x80,0x00,0x07,0xFF,0xFF,0xE0,0x01,0xFF,0x00,0x00,0x03,0xFB,0xFF,
+0x01,0xF8,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x08,0x80,0x00,0x07,0xFF,0xFF,0xE0,0x01,
+0xFF,0x80,0x00,0x03,0xFB,0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x10,0x40,
+0x00,0x07,0xFF,0xFF,0xE0,0x00,0xFF,0xF0,0x00,0x03,0xFB,0xFF,0x01,0xF8,0x3F,0xFE,
+0xFF,0x0D,0xF0,0x00,0x10,0x40,0x00,0x07,0xFF,0xFF,0xE0,0x00,0x1F,0xFE,0x00,0x07,
+0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x20,0x20,0x00,
+0x07,0xFF,0xFF,0xE0,0x00,0x03,0xFF,0x80,0x07,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x00,
+0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x60,0x30,0x00,0x07,0xFF,0xFF,0xE0,0x00,0x07,0xFF,
+0x80,0x0F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0x40,
+0x10,0x00,0x07,0xFF,0xFF,0xE0,0x00,0x3F,0xFF,0x80,0x1F,0xFE,0xFF,0x00,0x80,0xFE,
+0x00,0x00,0x3F,0xFE,0xFF,0x0D,0xF0,0x00,0xC0,0x08,0x00,0x07,0xFF,0xFF,0xE0,0x01,
+0xFF,0xFF,0x00,0x1F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x0D,0xF0,
+0x00,0x80,0x0C,0x00,0x07,0xFF,0xFF,0xE0,0x01,0xFF,0xF8,0x00,0x3F,0xFE,0xFF,0x00,
+0x80,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x0D,0xF0,0x01,0x80,0x04,0x00,0x07,0xFF,0xFF,
+0xE0,0x01,0xFF,0xE0,0x00,0x7F,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x3F,0xFE,0xFF,
+0x0C,0xF0,0x01,0x00,0x02,0x00,0x07,0xFF,0xFF,0xE0,0x01,0xFE,0x00,0x00,0xFD,0xFF,
+0x04,0xC0,0xFF,0xFF,0xF8,0x3F,0xFE,0xFF,0x0C,0xF0,0x02,0x00,0x03,0x00,0x07,0xFF,
+0xFF,0xE0,0x01,0xF0,0x00,0x03,0xFD,0xFF,0x04,0xE0,0xFF,0xFF,0xF8,0x3F,0xFE,0xFF,
+0x0C,0xF0,0x06,0x00,0x01,0x00,0x07,0xFF,0xFF,0xE0,0x01,0x80,0x00,0x07,0xFD,0xFF,
+0x04,0xE0,0xFF,0xFF,0xF8,0x3F,0xFE,0xFF,0x08,0xF0,0x04,0x00,0x01,0x80,0x07,0xFF,
+0xFF,0xE0,0xFE,0x00,0x00,0x1F,0xFD,0xFF,0x04,0xE0,0xFF,0xFF,0xF8,0x3F,0xFE,0xFF,
+0x08,0xF0,0x0C,0x00,0x00,0x80,0x07,0xFF,0xFF,0xE0,0xFE,0x00,0xFC,0xFF,0x04,0xF0,
+0xFF,0xFF,0xF8,0x3F,0xFE,0xFF,0x0B,0xF0,0x08,0x00,0x00,0x40,0x07,0xFF,0xFF,0xE0,
+0x00,0x00,0x0F,0xFC,0xFF,0x04,0xF0,0xFF,0xFF,0xF8,0x3F,0xFE,0xFF,0x05,0xF0,0x18,
+0x00,0x00,0x60,0x07,0xF3,0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x05,0xF0,0x10,0x00,0x00,
+0x20,0x07,0xEE,0xFF,0x05,0xF0,0x20,0x00,0x00,0x10,0x07,0xEE,0xFF,0x05,0xF0,0x60,
+0x00,0x00,0x18,0x07,0xEE,0xFF,0x05,0xF0,0x40,0x00,0x00,0x08,0x07,0xEE,0xFF,0x05,
+0xF8,0xC0,0x00,0x00,0x04,0x0F,0xEE,0xFF,0x05,0xF8,0x80,0x00,0x00,0x04,0x1F,0xED,
+0xFF,0xFE,0x00,0x01,0x02,0x3F,0xB5,0xFF,
+};
+
+// BitmapWaveshare_red : 5000 bytes, packed 2172
+const unsigned char BitmapWaveshare_red_packed[] PROGMEM =
+{
+0x88,0x13,0x00,0x00,0xF9,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,
+0xFA,0xFF,0x02,0xF1,0xFE,0x01,0xF3,0xFF,0x00,0x8F,0xFA,0xFF,0x03,0xF1,0xF8,0x00,
+0x7F,0xF4,0xFF,0x00,0x8F,0xFA,0xFF,0x03,0xF1,0xF0,0x00,0x3F,0xF4,0xFF,0x00,0x8F,
+0xFA,0xFF,0x03,0xF1,0xF0,0x00,0x1F,0xF4,0xFF,0x00,0x8F,0xFA,0xFF,0x03,0xF1,0xE0,
+0x00,0x1F,0xF4,0xFF,0x00,0x8F,0xFA,0xFF,0x03,0xF1,0xE1,0xE3,0x1F,0xF4,0xFF,0x00,
+0x8F,0xFA,0xFF,0x03,0xF1,0xC3,0xF3,0x0F,0xF4,0xFF,0x00,0x8F,0xFA,0xFF,0x03,0xF1,
+0xC3,0x3B,0x0F,0xF4,0xFF,0x00,0x8F,0xFA,0xFF,0x03,0xF1,0xC3,0x0F,0x0F,0xF4,0xFF,
+0x00,0x8F,0xFA,0xFF,0x03,0xF1,0xC3,0x0F,0x0F,0xF4,0xFF,0x02,0x8F,0xFF,0xE3,0xFC,
+0xFF,0x03,0xF1,0xC3,0x87,0x0F,0xF4,0xFF,0x03,0x8F,0xFF,0xE0,0x7F,0xFD,0xFF,0x03,
+0xF1,0xC1,0x03,0x0F,0xF4,0xFF,0x03,0x8F,0xFF,0xE0,0x0F,0xFD,0xFF,0x03,0xF1,0xE0,
+0x00,0x1F,0xF4,0xFF,0x03,0x8F,0xFF,0xFC,0x03,0xFD,0xFF,0x03,0xF1,0xE0,0x00,0x1F,
+0xF4,0xFF,0x04,0x8F,0xFF,0xFF,0x80,0x7F,0xFE,0xFF,0x03,0xF1,0xF0,0x00,0x3F,0xF4,
+0xFF,0x04,0x8F,0xFF,0xFF,0xF0,0x1F,0xFE,0xFF,0x03,0xF1,0xF8,0x00,0x7F,0xF4,0xFF,
+0x04,0x8F,0xFF,0xFF,0x00,0x1F,0xFE,0xFF,0x02,0xF1,0xFE,0x00,0xF3,0xFF,0x04,0x8F,
+0xFF,0xF8,0x07,0x8F,0xFE,0xFF,0x02,0xF1,0xFF,0x87,0xF3,0xFF,0x08,0x8F,0xFF,0xE0,
+0x1F,0x8F,0xC0,0x07,0xFF,0xF1,0xF1,0xFF,0x08,0x8F,0xFF,0xE0,0xFF,0xCF,0x80,0x07,
+0xFF,0xF1,0xF1,0xFF,0x08,0x8F,0xFF,0xE3,0xFF,0xEF,0x00,0x07,0xFF,0xF1,0xF1,0xFF,
+0x00,0x8F,0xFD,0xFF,0x03,0x1F,0xFF,0xFF,0xF1,0xF1,0xFF,0x00,0x8F,0xFD,0xFF,0x03,
+0x1F,0xFF,0xFF,0xF1,0xF1,0xFF,0x08,0x8F,0xFF,0xFE,0x01,0xFF,0x1F,0xFF,0xFF,0xF1,
+0xF1,0xFF,0x08,0x8F,0xFF,0xF0,0x01,0xFF,0x9F,0xFF,0xFF,0xF1,0xF1,0xFF,0x08,0x8F,
+0xFF,0xE0,0x01,0xE0,0x80,0x0F,0xFF,0xF1,0xF4,0xFF,0x0B,0xE7,0xFF,0xFF,0x8F,0xFF,
+0xE0,0x03,0xE0,0x00,0x07,0xFF,0xF1,0xF4,0xFF,0x0B,0xE0,0xFF,0xFF,0x8F,0xFF,0xE2,
+0x71,0xE0,0x00,0x07,0xFF,0xF1,0xF4,0xFF,0x0B,0xE0,0x3F,0xFF,0x8F,0xFF,0xE7,0x39,
+0xE0,0x00,0x0F,0xFF,0xF1,0xF4,0xFF,0x06,0xF0,0x07,0xFF,0x8F,0xFF,0xE7,0x38,0xFD,
+0xFF,0x00,0xF1,0xF4,0xFF,0x06,0xFE,0x01,0xFF,0x8F,0xFF,0xE3,0x10,0xFD,0xFF,0x00,
+0xF1,0xF3,0xFF,0x0A,0xC0,0x7F,0x8F,0xFF,0xE3,0x01,0xFF,0x1F,0xC7,0xFF,0xF1,0xF3,
+0xFF,0x0A,0xF8,0x3F,0x8F,0xFF,0xF3,0x81,0xFF,0x1F,0xC7,0xFF,0xF1,0xF3,0xFF,0x0A,
+0xC0,0x1F,0x8F,0xFF,0xFF,0xC7,0xFF,0x1F,0xC7,0xFF,0xF1,0xF4,0xFF,0x03,0xFE,0x00,
+0x0F,0x8F,0xFE,0xFF,0x04,0xF8,0x00,0x07,0xFF,0xF1,0xF4,0xFF,0x03,0xF0,0x07,0x87,
+0x8F,0xFE,0xFF,0x04,0xF8,0x00,0x0F,0xFF,0xF1,0xF4,0xFF,0x03,0xE0,0x1F,0xC7,0x8F,
+0xFE,0xFF,0x04,0xF8,0x00,0x0F,0xFF,0xF1,0xF4,0xFF,0x0B,0xE0,0xFF,0xC7,0x8F,0xFE,
+0x00,0x01,0xFF,0x1E,0xFF,0xFF,0xF1,0xF4,0xFF,0x0B,0xE3,0xFF,0xC7,0x8F,0xFE,0x00,
+0x01,0xFF,0x1F,0xFF,0xFF,0xF1,0xF2,0xFF,0x04,0xC7,0x8F,0xFE,0x00,0x01,0xFD,0xFF,
+0x00,0xF1,0xF1,0xFF,0x08,0x8F,0xFE,0x03,0xFF,0xF8,0x7F,0xFF,0xFF,0xF1,0xF1,0xFF,
+0x08,0x8F,0xFF,0xC0,0x7F,0xF8,0x1F,0xFF,0xFF,0xF1,0xF4,0xFF,0x0B,0xF8,0x00,0xFF,
+0x8F,0xFF,0xF8,0x1F,0xF8,0x07,0xFF,0xFF,0xF1,0xF4,0xFF,0x0B,0xF0,0x00,0xFF,0x8F,
+0xFF,0xFE,0x03,0xF8,0x01,0xFF,0xFF,0xF1,0xF4,0xFF,0x0B,0xE0,0x00,0xFF,0x8F,0xFF,
+0xFF,0x83,0xF8,0xC0,0x7F,0xFF,0xF1,0xF4,0xFF,0x0B,0xE0,0x00,0xFF,0x8F,0xFF,0xFC,
+0x07,0xF8,0xF0,0x1F,0xFF,0xF1,0xF4,0xFF,0x0B,0xE3,0x31,0xFF,0x8F,0xFF,0xE0,0x3F,
+0xF8,0xFC,0x07,0xFF,0xF1,0xF4,0xFF,0x0B,0xE3,0x38,0xFF,0x8F,0xFF,0x00,0xFF,0xF8,
+0xFF,0x03,0xFF,0xF1,0xF4,0xFF,0x0B,0xE3,0x38,0xFF,0x8F,0xFE,0x07,0xFF,0xF8,0xFF,
+0xC3,0xFF,0xF1,0xF4,0xFF,0x0B,0xE3,0x18,0xFF,0x8F,0xFE,0x00,0x01,0xF8,0xFF,0xF3,
+0xFF,0xF1,0xF4,0xFF,0x07,0xE3,0x00,0xFF,0x8F,0xFE,0x00,0x01,0xF8,0xFE,0xFF,0x00,
+0xF1,0xF4,0xFF,0x07,0xE3,0x80,0xFF,0x8F,0xFE,0x00,0x01,0xF8,0xFE,0xFF,0x00,0xF1,
+0xF4,0xFF,0x03,0xF1,0x81,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF3,0xFF,0x02,0xC3,0xFF,
+0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,
+0x8F,0xFA,0xFF,0x00,0xF1,0xF5,0xFF,0x04,0xFC,0x00,0x00,0xFF,0x8F,0xFA,0xFF,0x00,
+0xF1,0xF5,0xFF,0x04,0xFC,0x00,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF5,0xFF,0x04,
+0xFC,0x00,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF5,0xFF,0x04,0xFC,0x00,0x00,0xFF,
+0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE3,0xF1,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,
+0xF4,0xFF,0x03,0xE3,0xF9,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE3,0xF8,
+0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE3,0xF8,0xFF,0x80,0xFA,0x00,0x00,
+0x01,0xF4,0xFF,0x03,0xE1,0xF0,0xFF,0x80,0xFA,0x00,0x00,0x01,0xF4,0xFF,0x03,0xF0,
+0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xF0,0x01,0xFF,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF4,0xFF,0x03,0xF8,0x01,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,
+0xFE,0x07,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,
+0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xF8,0x00,0xFF,0x8F,0xFA,
+0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xF0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,
+0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE3,0xFF,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,
+0xFF,0x03,0xE3,0xFF,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE3,0xFF,0xFF,
+0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xF0,0xFF,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,
+0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,
+0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,
+0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,
+0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,
+0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,
+0xF3,0xFF,0x02,0xE1,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF3,0xFF,0x02,0xF9,0xFF,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF3,0xFF,0x02,0xF8,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF3,0xFF,
+0x02,0xF8,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,
+0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x00,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,
+0x03,0xE0,0x01,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF4,0xFF,0x03,0xE0,0x03,0xFF,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF7,0xFF,0x00,0xBF,
+0xFC,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF7,0xFF,0x00,0x3F,0xFE,0xFF,0x02,0x87,
+0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF7,0xFF,0x06,0x3F,0xFF,0xFF,0x1E,0x03,0xFF,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x08,0xFE,0xFF,0xBF,0xCF,0xFE,0x3E,0x01,0xFF,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x08,0xFE,0x3F,0xFF,0x8F,0xFE,0x3C,0x01,0xFF,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x07,0x3C,0x0F,0x9F,0xFE,0x3C,0x30,0xFF,0x8F,0xFA,
+0xFF,0x00,0xF1,0xF8,0xFF,0x07,0xF0,0x03,0xFF,0xFE,0x3C,0x78,0xFF,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF8,0xFF,0x07,0xE0,0x00,0xFF,0xFE,0x38,0x78,0xFF,0x8F,0xFA,0xFF,0x00,
+0xF1,0xF8,0xFF,0x07,0xC0,0x00,0xFF,0xFE,0x18,0x78,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,
+0xF8,0xFF,0x07,0xC0,0x00,0x7F,0xFE,0x00,0xF8,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,
+0xFF,0x07,0x80,0x00,0x3F,0xFF,0x00,0xF8,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,0xFF,
+0x07,0x80,0x00,0x3F,0xFF,0x01,0xF0,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x07,
+0x80,0x00,0x3F,0xFF,0xC3,0xF1,0xFF,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x03,0xF1,
+0x00,0x00,0x31,0xFD,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x03,0xF1,0x00,
+0x00,0x31,0xFD,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x02,0x80,0x00,0x3F,
+0xFD,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x02,0x80,0x00,0x3F,0xFD,0xFF,
+0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x02,0x80,0x00,0x7F,0xFD,0xFF,0x00,0x8F,
+0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x02,0xC0,0x00,0x7F,0xFD,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF8,0xFF,0x01,0xE0,0x00,0xFC,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,
+0xFF,0x01,0xF0,0x01,0xFC,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF8,0xFF,0x02,0x78,
+0x03,0xDF,0xFD,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x03,0xFE,0x3F,0x1F,
+0x8F,0xFD,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x03,0xFE,0x7F,0xFF,0xCF,
+0xFD,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0x02,0xFE,0xFF,0x3F,0xFC,0xFF,
+0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF7,0xFF,0x00,0x3F,0xFC,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF7,0xFF,0x00,0x3F,0xFC,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,
+0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,0xF9,0x00,0x00,0x0F,0xFA,0xFF,0x00,0xF1,
+0xF9,0xFF,0xF9,0x00,0x00,0x0F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,
+0x00,0xF1,0xF1,0xFF,0x00,0x8F,0xFA,0xFF,0x00,0xF1,0xF9,0xFF,
+};
+
+#endif
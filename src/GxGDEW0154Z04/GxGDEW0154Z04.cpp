@@ -40,56 +40,36 @@ const uint8_t GxGDEW0154Z04::bw2grey[] =
 
 GxGDEW0154Z04::GxGDEW0154Z04(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW0154Z04_WIDTH, GxGDEW0154Z04_HEIGHT), IO(io),
-  _current_page(-1), _diag_enabled(false),
+  _diag_enabled(false),
   _rst(rst), _busy(busy) 
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#elif GxEPD_INTERLEAVED_3C
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer) / 2);
+#else
+  _initFrameBuffer<FrameBuffer>(_black_buffer, _red_buffer, sizeof(_black_buffer));
+#endif
 }
 
 void GxGDEW0154Z04::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0154Z04_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0154Z04_WIDTH - x - 1;
-      y = GxGDEW0154Z04_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0154Z04_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0154Z04_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    if (i < GxGDEW0154Z04_PAGE_SIZE * _current_page) return;
-    if (i >= GxGDEW0154Z04_PAGE_SIZE * (_current_page + 1)) return;
-    i -= GxGDEW0154Z04_PAGE_SIZE * _current_page;
-  }
+void GxGDEW0154Z04::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+void GxGDEW0154Z04::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW0154Z04::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 
@@ -108,42 +88,34 @@ void GxGDEW0154Z04::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
 }
 
 void GxGDEW0154Z04::fillScreen(uint16_t color)
 {
-  uint8_t black = 0x00;
-  uint8_t red = 0x00;
-  if (color == GxEPD_WHITE);
-  else if (color == GxEPD_BLACK) black = 0xFF;
-  else if (color == GxEPD_RED) red = 0xFF;
-  else if ((color & 0xF100) > (0xF100 / 2))  red = 0xFF;
-  else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = 0xFF;
-  for (uint16_t x = 0; x < sizeof(_black_buffer); x++)
-  {
-    _black_buffer[x] = black;
-    _red_buffer[x] = red;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW0154Z04::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _wakeUp();
   _writeCommand(0x10);
+  IO.startTransaction();
   for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
   {
-    uint8_t data = (i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF;
-    _writeData(bw2grey[(data & 0xF0) >> 4]);
-    _writeData(bw2grey[data & 0x0F]);
+    uint8_t data = (i < _fb_size) ? ~_planeByte(0, i) : 0xFF;
+    IO.writeData(bw2grey[(data & 0xF0) >> 4]);
+    IO.writeData(bw2grey[data & 0x0F]);
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 1, 0, GxGDEW0154Z04_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -160,23 +132,13 @@ void GxGDEW0154Z04::drawExamplePicture(const uint8_t* black_bitmap, const uint8_
   if (_current_page != -1) return;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE * 2; i++)
-  {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    _writeData((i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00);
-#else
-    _writeData((i < black_size) ? black_bitmap[i] : 0x00);
-#endif
-  }
+  IO.startTransaction();
+  _writeBitmapData(IO, black_bitmap, black_size, GxGDEW0154Z04_BUFFER_SIZE * 2, false, 0x00);
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    _writeData((i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00);
-#else
-    _writeData((i < red_size) ? red_bitmap[i] : 0x00);
-#endif
-  }
+  IO.startTransaction();
+  _writeBitmapData(IO, red_bitmap, red_size, GxGDEW0154Z04_BUFFER_SIZE, false, 0x00);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPicture");
   _sleep();
@@ -185,38 +147,28 @@ void GxGDEW0154Z04::drawExamplePicture(const uint8_t* black_bitmap, const uint8_
 void GxGDEW0154Z04::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+  IO.startTransaction();
+  // a bitmap reader as sent delivers the 2 bit per pixel black
+  if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, black_bitmap, black_size, GxGDEW0154Z04_BUFFER_SIZE * 2, mode & bm_invert, 0xFF);
+  else for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
   {
     uint8_t data = 0xFF; // white is 0xFF on device
     if (i < black_size)
     {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&black_bitmap[i]);
-#else
-      data = black_bitmap[i];
-#endif
+      data = _readBitmap(black_bitmap, i);
       if (mode & bm_invert) data = ~data;
     }
-    _writeData(bw2grey[(data & 0xF0) >> 4]);
-    _writeData(bw2grey[data & 0x0F]);
+    IO.writeData(bw2grey[(data & 0xF0) >> 4]);
+    IO.writeData(bw2grey[data & 0x0F]);
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < red_size)
-    {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&red_bitmap[i]);
-#else
-      data = red_bitmap[i];
-#endif
-      if (mode & bm_invert_red) data = ~data;
-    }
-    _writeData(data);
-  }
+  IO.startTransaction();
+  _writeBitmapData(IO, red_bitmap, red_size, GxGDEW0154Z04_BUFFER_SIZE, mode & bm_invert_red, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPicture");
   _sleep();
@@ -225,28 +177,25 @@ void GxGDEW0154Z04::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_
 void GxGDEW0154Z04::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_default) mode |= bm_normal; // no change
   uint8_t mask = 0xFF; // black
   //uint8_t mask = 0b0101010101010101; // (light) grey
   //uint8_t mask = 0b1010101010101010; // (dark) grey, same grey
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+  IO.startTransaction();
+  if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, GxGDEW0154Z04_BUFFER_SIZE * 2, mode & bm_invert, 0xFF);
+  else for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
   {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    uint8_t data = (i < size) ? pgm_read_byte(&bitmap[i]) : 0x00;
-#else
-    uint8_t data = (i < size) ? bitmap[i] : 0x00;
-#endif
+    uint8_t data = (i < size) ? _readBitmap(bitmap, i) : 0x00;
     if (mode & bm_invert) data = ~data;
-    _writeData(~(bw2grey[(data & 0xF0) >> 4] & mask));
-    _writeData(~(bw2grey[data & 0x0F] & mask));
+    IO.writeData(~(bw2grey[(data & 0xF0) >> 4] & mask));
+    IO.writeData(~(bw2grey[data & 0x0F] & mask));
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF);
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z04_BUFFER_SIZE);
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawBitmap");
   _sleep();
@@ -255,22 +204,26 @@ void GxGDEW0154Z04::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
 void GxGDEW0154Z04::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE * 2; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z04_BUFFER_SIZE * 2);
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z04_BUFFER_SIZE);
   _writeCommand(0x12);      //display refresh
   _waitWhileBusy("eraseDisplay");
   _sleep();
 }
 
+#if GxEPD_DIRTY_TRACKING
+void GxGDEW0154Z04::updateDirty()
+{
+  if (_dirty_count == 0) return;
+  _dirty_count = 0;
+  update();
+}
+#endif
+
 void GxGDEW0154Z04::_writeCommand(uint8_t command)
 {
   IO.writeCommandTransaction(command);
@@ -284,15 +237,9 @@ void GxGDEW0154Z04::_writeData(uint8_t data)
 void GxGDEW0154Z04::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
+  if (!_waitBusy(_busy, LOW, 10000000))
   {
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 10000000)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -368,107 +315,98 @@ void GxGDEW0154Z04::_writeLUT(void)
   unsigned int count;
   // lut_bw
   _writeCommand(0x20);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_vcom0[count]));
+    IO.writeData(pgm_read_byte(&lut_vcom0[count]));
   }
+  IO.endTransaction();
 
   _writeCommand(0x21);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_w[count]));
+    IO.writeData(pgm_read_byte(&lut_w[count]));
   }
+  IO.endTransaction();
 
   _writeCommand(0x22);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_b[count]));
+    IO.writeData(pgm_read_byte(&lut_b[count]));
   }
+  IO.endTransaction();
 
   _writeCommand(0x23);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_g1[count]));
+    IO.writeData(pgm_read_byte(&lut_g1[count]));
   }
+  IO.endTransaction();
 
   _writeCommand(0x24);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_g2[count]));
+    IO.writeData(pgm_read_byte(&lut_g2[count]));
   }
+  IO.endTransaction();
   // lut_red
   _writeCommand(0x25);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_vcom1[count]));
+    IO.writeData(pgm_read_byte(&lut_vcom1[count]));
   }
+  IO.endTransaction();
 
   _writeCommand(0x26);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_red0[count]));
+    IO.writeData(pgm_read_byte(&lut_red0[count]));
   }
+  IO.endTransaction();
 
   _writeCommand(0x27);
+  IO.startTransaction();
   for (count = 0; count < 15; count++)
   {
-    _writeData(pgm_read_byte(&lut_red1[count]));
+    IO.writeData(pgm_read_byte(&lut_red1[count]));
   }
+  IO.endTransaction();
 }
 
 #else
 
 void GxGDEW0154Z04::_writeLUT(void)
 {
-  unsigned int count;
   // lut_bw
   _writeCommand(0x20);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_vcom0[count]);
-  }
+  IO.writeDataTransaction(lut_vcom0, 15);
 
   _writeCommand(0x21);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_w[count]);
-  }
+  IO.writeDataTransaction(lut_w, 15);
 
   _writeCommand(0x22);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_b[count]);
-  }
+  IO.writeDataTransaction(lut_b, 15);
 
   _writeCommand(0x23);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_g1[count]);
-  }
+  IO.writeDataTransaction(lut_g1, 15);
 
   _writeCommand(0x24);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_g2[count]);
-  }
+  IO.writeDataTransaction(lut_g2, 15);
   // lut_red
   _writeCommand(0x25);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_vcom1[count]);
-  }
+  IO.writeDataTransaction(lut_vcom1, 15);
 
   _writeCommand(0x26);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_red0[count]);
-  }
+  IO.writeDataTransaction(lut_red0, 15);
 
   _writeCommand(0x27);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_red1[count]);
-  }
+  IO.writeDataTransaction(lut_red1, 15);
 }
 
 #endif
@@ -476,39 +414,44 @@ void GxGDEW0154Z04::_writeLUT(void)
 void GxGDEW0154Z04::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback();
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW0154Z04_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(~bw2grey[(data & 0xF0) >> 4]);
+        IO.writeData(~bw2grey[data & 0x0F]);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -517,39 +460,44 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(void))
 void GxGDEW0154Z04::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW0154Z04_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(~bw2grey[(data & 0xF0) >> 4]);
+        IO.writeData(~bw2grey[data & 0x0F]);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -558,39 +506,44 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW0154Z04::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW0154Z04_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(~bw2grey[(data & 0xF0) >> 4]);
+        IO.writeData(~bw2grey[data & 0x0F]);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -599,39 +552,44 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW0154Z04::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p1, p2);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW0154Z04_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(~bw2grey[(data & 0xF0) >> 4]);
+        IO.writeData(~bw2grey[data & 0x0F]);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -642,6 +600,7 @@ void GxGDEW0154Z04::drawCornerTest(uint8_t em)
   if (_current_page != -1) return;
   _wakeUp();
   _writeCommand(0x10);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW0154Z04_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW0154Z04_WIDTH / 8; x++)
@@ -651,15 +610,13 @@ void GxGDEW0154Z04::drawCornerTest(uint8_t em)
       if ((x > GxGDEW0154Z04_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW0154Z04_WIDTH / 8 - 4) && (y > GxGDEW0154Z04_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW0154Z04_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
-      _writeData(data);
+      IO.writeData(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF);
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z04_BUFFER_SIZE);
   _writeCommand(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
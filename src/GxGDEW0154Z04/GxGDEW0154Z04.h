@@ -21,7 +21,7 @@
 
 #define GxGDEW0154Z04_BUFFER_SIZE (uint32_t(GxGDEW0154Z04_WIDTH) * uint32_t(GxGDEW0154Z04_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW0154Z04_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW0154Z04_HEIGHT
 #define GxGDEW0154Z04_PAGES 10
 
 #define GxGDEW0154Z04_PAGE_HEIGHT (GxGDEW0154Z04_HEIGHT / GxGDEW0154Z04_PAGES)
@@ -38,6 +38,10 @@ class GxGDEW0154Z04 : public GxEPD
     GxGDEW0154Z04(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -50,13 +54,19 @@ class GxGDEW0154Z04 : public GxEPD
     // to full screen, filled with white if size is less, no update needed
     void drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode = bm_normal); // only bm_normal, bm_invert mode implemented
     void eraseDisplay(bool using_partial_update = false); // parameter ignored
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW0154Z04_PAGES times
+#if GxEPD_DIRTY_TRACKING
+    // no partial update on this panel, full update if anything is dirty
+    void updateDirty();
+#endif
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW0154Z04_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
     void drawPaged(void (*drawCallback)(const void*), const void*);
     void drawPaged(void (*drawCallback)(const void*, const void*), const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEW0154Z04";};
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -72,7 +82,14 @@ class GxGDEW0154Z04 : public GxEPD
     void _sleep();
     void _waitWhileBusy(const char* comment = 0);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW0154Z04_WIDTH, GxGDEW0154Z04_HEIGHT, 2, GxEPD_INTERLEAVED_3C ? GxFB_INTERLEAVED : 0> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif GxEPD_INTERLEAVED_3C && defined(__AVR)
+    uint8_t _buffer[2 * GxGDEW0154Z04_PAGE_SIZE]; // black and red interleaved
+#elif GxEPD_INTERLEAVED_3C
+    uint8_t _buffer[2 * GxGDEW0154Z04_BUFFER_SIZE]; // black and red interleaved
+#elif defined(__AVR)
     uint8_t _black_buffer[GxGDEW0154Z04_PAGE_SIZE];
     uint8_t _red_buffer[GxGDEW0154Z04_PAGE_SIZE];
 #else
@@ -80,7 +97,6 @@ class GxGDEW0154Z04 : public GxEPD
     uint8_t _red_buffer[GxGDEW0154Z04_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _diag_enabled;
     int8_t _rst;
     int8_t _busy;
@@ -109,6 +125,7 @@ class GxGDEW0154Z04 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW0154Z04_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW0154Z04/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW0154Z04/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW0154Z04/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,357 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 2888 bytes, packed 537
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x48,0x0B,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0xC0,0xFF,0x00,0x9F,0xEF,0xFF,0x00,0x83,0xEF,0xFF,0x01,0xE0,
+0x3F,0xF9,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x01,0xE0,0x1F,0xF9,0xFF,0x01,0x80,0x7F,
+0xFA,0xFF,0x01,0x83,0xDF,0xF0,0xFF,0x01,0x9F,0xDF,0xE6,0xFF,0x01,0x80,0x7F,0xF0,
+0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xC0,0xEF,0xFF,0x00,0x80,0xEF,0xFF,0x00,0xB4,
+0xEF,0xFF,0x00,0xB6,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0x90,0xF8,0xFF,0x01,
+0x80,0x7F,0xFA,0xFF,0x00,0xD9,0xD2,0xFF,0x01,0x80,0x7F,0xFB,0xFF,0x01,0xFC,0x00,
+0xF0,0xFF,0x01,0xFC,0x00,0xF8,0xFF,0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xF0,
+0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xC1,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,
+0x80,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xBE,0xF8,0xFF,0x01,0x80,0x7F,0xFA,
+0xFF,0x00,0x9C,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x01,0x80,0x1F,0xF0,0xFF,0x01,
+0x80,0x1F,0xE6,0xFF,0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xD9,
+0xEF,0xFF,0x00,0x90,0xEF,0xFF,0x00,0xB6,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,
+0xB6,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0x84,0xEF,0xFF,0x00,0xCD,0xE5,0xFF,
+0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xFB,0xFF,0x01,0xFD,0x80,0xF0,0xFF,0x01,
+0xFD,0x80,0xF8,0xFF,0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xE7,0xFF,0x00,0x03,
+0xF0,0xFF,0x01,0xFE,0x01,0xF8,0xFF,0x01,0x80,0x7F,0xFB,0xFF,0x01,0xFC,0xFC,0xF8,
+0xFF,0x01,0x80,0x7F,0xFB,0xFF,0x01,0xFD,0xFE,0xF0,0xFF,0x01,0xFD,0xFE,0xF8,0xFF,
+0x01,0x80,0x7F,0xFB,0xFF,0x01,0xFD,0xFE,0xF8,0xFF,0x01,0x80,0x7F,0xFB,0xFF,0x01,
+0xFC,0x00,0xF0,0xFF,0x01,0xFC,0x00,0xE5,0xFF,0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,
+0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xCA,0xFF,0x01,0x80,0x7F,
+0xFB,0xFF,0x01,0xFC,0x00,0xF8,0xFF,0x01,0x80,0x7F,0xFB,0xFF,0x01,0xFC,0x00,0xF8,
+0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0x9E,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,
+0xBE,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0x80,0xEF,0xFF,0x00,0xC1,0xE5,0xFF,
+0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xC1,0xF8,0xFF,0x01,0x80,
+0x7F,0xFA,0xFF,0x00,0x80,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xBE,0xEF,0xFF,
+0x00,0xBE,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0x80,0xF8,0xFF,0x01,0x80,0x7F,
+0xFA,0xFF,0x00,0xC1,0xD2,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xC1,0xF8,0xFF,0x01,
+0x80,0x7F,0xFA,0xFF,0x00,0x80,0xF8,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xBE,0xF8,
+0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x00,0xBE,0xEF,0xFF,0x00,0x80,0xEF,0xFF,0x00,0xC1,
+0xF8,0xFF,0x01,0x80,0x7F,0xF0,0xFF,0x01,0x80,0x7F,0xE7,0xFF,0x00,0x63,0xF0,0xFF,
+0x01,0xFE,0x61,0xF0,0xFF,0x01,0xFC,0xEC,0xF0,0xFF,0x01,0xFD,0xEE,0xF0,0xFF,0x01,
+0xFD,0xEE,0xF0,0xFF,0x01,0xFD,0xFE,0xF0,0xFF,0x01,0xFC,0xFC,0xF0,0xFF,0x01,0xFE,
+0x01,0xEF,0xFF,0x00,0x03,0x81,0xFF,0xF0,0xFF,
+};
+
+// BitmapExample2 : 2888 bytes, packed 1646
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0x48,0x0B,0x00,0x00,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,
+0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xFB,0xFF,
+0x01,0xC0,0x00,0xFB,0xFF,0xFC,0x00,0xFC,0xFF,0x03,0xFC,0x00,0x00,0x0F,0xFC,0xFF,
+0xFC,0x00,0xFC,0xFF,0x03,0xF0,0x00,0x00,0x03,0xFC,0xFF,0xFC,0x00,0xFC,0xFF,0x00,
+0xC0,0xFE,0x00,0xFC,0xFF,0xFC,0x00,0xFC,0xFF,0x00,0x80,0xFE,0x00,0x00,0x7F,0xFD,
+0xFF,0xFC,0x00,0xFC,0xFF,0x00,0x80,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0xFC,0x00,0xFC,
+0xFF,0x04,0x00,0x1F,0xFE,0x00,0x3F,0xFD,0xFF,0xFC,0x00,0xFC,0xFF,0x04,0x00,0xFF,
+0xFF,0xE0,0x3F,0xFD,0xFF,0xFC,0x00,0xFD,0xFF,0x05,0xFE,0x03,0xFF,0xFF,0xF0,0x1F,
+0xFD,0xFF,0xFC,0x00,0xFD,0xFF,0x05,0xFE,0x07,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0xFC,
+0x00,0xFD,0xFF,0x05,0xFE,0x07,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0xFC,0x00,0xFD,0xFF,
+0x05,0xFE,0x0F,0xFF,0xFF,0xFC,0x1F,0xFD,0xFF,0xFC,0x00,0xFD,0xFF,0x05,0xFE,0x0F,
+0xFF,0xFF,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x00,0xFF,0xF0,0x00,0xFD,0xFF,0x05,0xFE,
+0x0F,0xFF,0xFF,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x01,0xFF,0xF0,0x00,0xFD,0xFF,0x05,
+0xFE,0x07,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFD,0xFF,
+0x05,0xFE,0x07,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xC0,0x00,0x00,0xFD,
+0xFF,0x05,0xFE,0x03,0xFF,0xFF,0xF0,0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,
+0xFC,0xFF,0x04,0x01,0xFF,0xFF,0xE0,0x3F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,
+0xFC,0xFF,0x04,0x00,0x1F,0xFE,0x00,0x3F,0xFD,0xFF,0x04,0x00,0x03,0xC0,0x00,0x00,
+0xFC,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFD,0xFF,0x04,0x00,0x01,0xE0,0x00,0x00,
+0xFC,0xFF,0x00,0x80,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,
+0xFC,0xFF,0x00,0xC0,0xFE,0x00,0xFC,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFC,0xFF,
+0x03,0xF0,0x00,0x00,0x03,0xFC,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFC,0xFF,0x03,
+0xFC,0x00,0x00,0x0F,0xFC,0xFF,0xFC,0x00,0xFB,0xFF,0x01,0xC0,0x00,0xFB,0xFF,0xFC,
+0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0x04,0x00,0x00,0x7F,0x80,0x00,0xF3,0xFF,0x04,
+0x00,0x00,0xFF,0xC0,0x00,0xFD,0xFF,0x01,0xFE,0x0F,0xF9,0xFF,0x04,0x00,0x01,0xFF,
+0xE0,0x00,0xFD,0xFF,0x01,0xFE,0x07,0xF9,0xFF,0x04,0x00,0x03,0xE1,0xF0,0x00,0xFD,
+0xFF,0x01,0xFE,0x03,0xF9,0xFF,0x04,0x00,0x03,0xC0,0xF0,0x00,0xFD,0xFF,0x01,0xFE,
+0x01,0xF9,0xFF,0x04,0x00,0x03,0x80,0x70,0x00,0xFD,0xFF,0x02,0xFE,0x00,0x7F,0xFA,
+0xFF,0x04,0x00,0x03,0x80,0x70,0x00,0xFD,0xFF,0x02,0xFE,0x00,0x3F,0xFA,0xFF,0x04,
+0x00,0x03,0xC0,0xF0,0x00,0xFD,0xFF,0x02,0xFE,0x00,0x0F,0xFA,0xFF,0x04,0x00,0x03,
+0xE1,0xF0,0x00,0xFD,0xFF,0x02,0xFE,0x08,0x03,0xFA,0xFF,0x04,0x00,0x01,0xFF,0xE0,
+0x00,0xFD,0xFF,0x02,0xFE,0x0C,0x00,0xFA,0xFF,0x04,0x00,0x00,0xFF,0xC0,0x00,0xFD,
+0xFF,0x03,0xFE,0x0E,0x00,0x3F,0xFB,0xFF,0x04,0x00,0x00,0x7F,0x80,0x00,0xFD,0xFF,
+0x03,0xFE,0x0F,0x00,0x0F,0xFB,0xFF,0xFC,0x00,0xFD,0xFF,0x03,0xFE,0x0F,0xC0,0x01,
+0xFB,0xFF,0xFC,0x00,0xFD,0xFF,0x04,0xFE,0x0F,0xE0,0x00,0x3F,0xFC,0xFF,0x04,0x00,
+0x3B,0xFF,0xF0,0x00,0xFD,0xFF,0x04,0xFE,0x0F,0xF8,0x00,0x01,0xFC,0xFF,0x04,0x00,
+0x3B,0xFF,0xF0,0x00,0xFD,0xFF,0x05,0xFE,0x0F,0xFE,0x00,0x00,0x1F,0xFD,0xFF,0x04,
+0x00,0x3B,0xFF,0xF0,0x00,0xFD,0xFF,0x05,0xFE,0x0F,0xFF,0x80,0x00,0x1F,0xFD,0xFF,
+0xFC,0x00,0xFD,0xFF,0x05,0xFE,0x0F,0xFF,0xE0,0x00,0x1F,0xFD,0xFF,0xFC,0x00,0xFD,
+0xFF,0x05,0xFE,0x0F,0xFF,0xFC,0x00,0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x70,0x00,
+0xFD,0xFF,0x05,0xFE,0x0F,0xFF,0xFF,0x80,0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x70,
+0x00,0xFD,0xFF,0x05,0xFE,0x0F,0xFF,0xFF,0xF8,0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,
+0x70,0x00,0xFD,0xFF,0x01,0xFE,0x0F,0xF9,0xFF,0x04,0x00,0x3F,0xFF,0xF0,0x00,0xFD,
+0xFF,0x01,0xFE,0x0F,0xF9,0xFF,0x04,0x00,0x3F,0xFF,0xF0,0x00,0xFD,0xFF,0x01,0xFE,
+0x0F,0xF9,0xFF,0x04,0x00,0x1F,0xFF,0xE0,0x00,0xFD,0xFF,0x01,0xFE,0x0F,0xF9,0xFF,
+0x04,0x00,0x03,0x80,0x00,0x00,0xFD,0xFF,0x01,0xFE,0x0F,0xF9,0xFF,0x04,0x00,0x03,
+0x80,0x00,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0x04,0x00,0x00,0x7F,0x80,0x00,0xF3,
+0xFF,0x04,0x00,0x00,0xFF,0xC0,0x00,0xF3,0xFF,0x04,0x00,0x01,0xFF,0xE0,0x00,0xF3,
+0xFF,0x04,0x00,0x03,0xE1,0xF0,0x00,0xF3,0xFF,0x04,0x00,0x03,0xC0,0xF0,0x00,0xF3,
+0xFF,0x04,0x00,0x03,0x80,0x70,0x00,0xF9,0xFF,0x01,0xFC,0x1F,0xFD,0xFF,0x04,0x00,
+0x03,0x80,0x70,0x00,0xF9,0xFF,0x01,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xC0,0xF0,
+0x00,0xF9,0xFF,0x01,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xE1,0xF0,0x00,0xF9,0xFF,
+0x01,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x01,0xFF,0xE0,0x00,0xF9,0xFF,0x01,0xFC,0x1F,
+0xFD,0xFF,0x04,0x00,0x00,0xFF,0xC0,0x00,0xF9,0xFF,0x01,0xFC,0x1F,0xFD,0xFF,0x04,
+0x00,0x00,0x7F,0x80,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,
+0x00,0xF3,0xFF,0x04,0x00,0x00,0xFF,0xF0,0x00,0xF3,0xFF,0x04,0x00,0x01,0xFF,0xF0,
+0x00,0xF3,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFC,0xFF,0x04,0xFC,0x07,0xFF,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x03,0xC0,0x00,0x00,0xFC,0xFF,0x04,0xE0,0x01,0xFF,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,0xFC,0xFF,0x04,0xC0,0x00,0x7F,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,0xFC,0xFF,0x04,0x80,0x00,0x3F,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x03,0xC0,0x00,0x00,0xFC,0xFF,0x04,0x80,0x00,0x1F,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x01,0xFF,0xF0,0x00,0xFC,0xFF,0x04,0x00,0x00,0x0F,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x01,0xFF,0xF0,0x00,0xFC,0xFF,0x04,0x00,0xF0,0x07,0xFC,
+0x1F,0xFD,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFD,0xFF,0x05,0xFE,0x03,0xF8,0x03,
+0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xC0,0x00,0x00,0xFD,0xFF,0x05,0xFE,0x07,0xFE,
+0x01,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,0xFD,0xFF,0x05,0xFE,0x07,
+0xFF,0x00,0xFC,0x1F,0xFD,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,0xFD,0xFF,0x05,0xFE,
+0x0F,0xFF,0x80,0x7C,0x1F,0xFD,0xFF,0x04,0x00,0x01,0xC0,0x00,0x00,0xFD,0xFF,0x05,
+0xFE,0x0F,0xFF,0xC0,0x3C,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFD,0xFF,
+0x05,0xFE,0x0F,0xFF,0xE0,0x3C,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFD,
+0xFF,0x05,0xFE,0x0F,0xFF,0xF0,0x1C,0x1F,0xFD,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,
+0xFD,0xFF,0x05,0xFE,0x07,0xFF,0xF8,0x0C,0x1F,0xFD,0xFF,0xFC,0x00,0xFD,0xFF,0x05,
+0xFE,0x07,0xFF,0xFC,0x04,0x1F,0xFD,0xFF,0xFC,0x00,0xFD,0xFF,0x05,0xFE,0x03,0xFF,
+0xFC,0x00,0x1F,0xFD,0xFF,0xFC,0x00,0xFC,0xFF,0x04,0x00,0xFF,0xFE,0x00,0x1F,0xFD,
+0xFF,0x04,0x00,0x00,0x7F,0x80,0x00,0xFC,0xFF,0x04,0x00,0x1F,0xFF,0x00,0x1F,0xFD,
+0xFF,0x04,0x00,0x00,0xFF,0xC0,0x00,0xFC,0xFF,0x04,0x80,0x1F,0xFF,0x80,0x1F,0xFD,
+0xFF,0x04,0x00,0x01,0xFF,0xE0,0x00,0xFC,0xFF,0x04,0x80,0x1F,0xFF,0xC0,0x1F,0xFD,
+0xFF,0x04,0x00,0x03,0xE1,0xF0,0x00,0xFC,0xFF,0x04,0xC0,0x1F,0xFF,0xE0,0x1F,0xFD,
+0xFF,0x04,0x00,0x03,0xC0,0xF0,0x00,0xFC,0xFF,0x04,0xF0,0x3F,0xFF,0xF0,0x1F,0xFD,
+0xFF,0x04,0x00,0x03,0x80,0x70,0x00,0xFC,0xFF,0x04,0xFC,0x3F,0xFF,0xF8,0x1F,0xFD,
+0xFF,0x04,0x00,0x03,0x80,0x70,0x00,0xF9,0xFF,0x01,0xFE,0x1F,0xFD,0xFF,0x04,0x00,
+0x03,0xC0,0xF0,0x00,0xF3,0xFF,0x04,0x00,0x03,0xE1,0xF0,0x00,0xF3,0xFF,0x04,0x00,
+0x01,0xFF,0xE0,0x00,0xF3,0xFF,0x04,0x00,0x00,0xFF,0xC0,0x00,0xF3,0xFF,0x04,0x00,
+0x00,0x7F,0x80,0x00,0xF3,0xFF,0xFC,0x00,0xFC,0xFF,0x01,0xE7,0x83,0xFA,0xFF,0x04,
+0x00,0x03,0x80,0x00,0x00,0xFC,0xFF,0x01,0xC7,0x01,0xFA,0xFF,0x04,0x00,0x03,0x80,
+0x00,0x00,0xFC,0xFF,0x01,0x86,0x00,0xFA,0xFF,0x04,0x00,0x03,0x80,0x00,0x00,0xFC,
+0xFF,0x01,0x8E,0x10,0xFA,0xFF,0x04,0x00,0x03,0xC0,0x00,0x00,0xFC,0xFF,0x02,0x00,
+0x00,0x3F,0xFB,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFC,0xFF,0x02,0x00,0x00,0x3F,
+0xFB,0xFF,0x04,0x00,0x03,0xFF,0xF0,0x00,0xFC,0xFF,0x01,0x84,0x70,0xFA,0xFF,0x04,
+0x00,0x03,0xFF,0xF0,0x00,0xFC,0xFF,0x01,0x80,0x60,0xFA,0xFF,0xFC,0x00,0xFC,0xFF,
+0x01,0xC0,0xE1,0xFA,0xFF,0xFC,0x00,0xFC,0xFF,0x01,0xE1,0xE3,0xFA,0xFF,0xFC,0x00,
+0xF3,0xFF,0x04,0x00,0x07,0xC0,0x00,0x00,0xF3,0xFF,0x04,0x00,0x1F,0xF0,0x00,0x00,
+0xF3,0xFF,0x04,0x00,0x1F,0xF0,0x00,0x00,0xF3,0xFF,0x04,0x00,0x3C,0x78,0x00,0x00,
+0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,
+0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,
+0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,
+0xF3,0xFF,0x04,0x00,0x38,0x38,0x00,0x00,0xF3,0xFF,0x04,0x00,0x3F,0xFF,0xF0,0x00,
+0xF3,0xFF,0x04,0x00,0x3F,0xFF,0xF0,0x00,0xF3,0xFF,0x04,0x00,0x3F,0xFF,0xF0,0x00,
+0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,
+0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,
+0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,
+0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,
+0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,0xFC,0x00,0xF3,0xFF,
+};
+
+// BitmapExample3 : 2888 bytes, packed 1771
+const unsigned char BitmapExample3_packed[] PROGMEM =
+{
+0x48,0x0B,0x00,0x00,0xFD,0xFF,0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xEF,0xFF,0x00,0xFC,
+0xEF,0xFF,0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xF1,0xFF,0x02,0xF8,0x3F,0xFC,0xF1,0xFF,
+0x02,0xC7,0xC7,0xFC,0xF1,0xFF,0x02,0xBC,0x7B,0xFC,0xF1,0xFF,0x02,0x67,0xCD,0xFC,
+0xF9,0xFF,0x00,0xF0,0xFE,0x00,0x00,0x7F,0xFE,0xFF,0x02,0x5C,0x75,0xFC,0xF9,0xFF,
+0x00,0xF0,0xFE,0x00,0x06,0x7F,0xFF,0xFF,0xFE,0xF7,0xDE,0xFC,0xF9,0xFF,0x0A,0xF1,
+0xFF,0xFF,0xF8,0x7F,0xFF,0xFF,0xFE,0xBF,0xEA,0xFC,0xF9,0xFF,0x0A,0xF1,0xFF,0xFF,
+0xE2,0x7F,0xFF,0xFF,0xFD,0xEF,0xEF,0x7C,0xF9,0xFF,0x04,0xF0,0xFF,0xFF,0xC6,0x7F,
+0xFE,0xFF,0x02,0xFE,0xFF,0xFC,0xF9,0xFF,0x04,0xF2,0x7F,0xFF,0x8E,0x7F,0xFE,0xFF,
+0x02,0xFC,0x7F,0xFC,0xF9,0xFF,0x0A,0xF2,0x7F,0xFF,0x3E,0x7F,0xFF,0xFF,0xF8,0x00,
+0x00,0x3C,0xF9,0xFF,0x0A,0xF3,0x3F,0xFE,0x7E,0x7F,0xFF,0xFF,0xFD,0xFF,0xFF,0x7C,
+0xF9,0xFF,0x0A,0xF3,0x9F,0xF8,0xFE,0x7F,0xFF,0xFF,0xFC,0xFF,0xFE,0x7C,0xF9,0xFF,
+0x0A,0xF3,0x9F,0xF1,0xFE,0x7F,0xFF,0xFF,0xFE,0x7F,0xFC,0xFC,0xF9,0xFF,0x04,0xF3,
+0xCF,0xE3,0xFE,0x7F,0xFE,0xFF,0x02,0x3F,0xF9,0xFC,0xF9,0xFF,0x04,0xF3,0xE7,0xCF,
+0xFE,0x7F,0xFE,0xFF,0x02,0xCF,0xE7,0xFC,0xF9,0xFF,0x04,0xF3,0xE7,0x1F,0xFE,0x7F,
+0xFE,0xFF,0x02,0xF7,0xDF,0xFC,0xF9,0xFF,0x04,0xF3,0xF2,0x3F,0xFE,0x7F,0xFE,0xFF,
+0x02,0xF7,0xDF,0xFC,0xF9,0xFF,0x04,0xF3,0xF0,0x7F,0xFE,0x7F,0xFE,0xFF,0x02,0xF7,
+0xDF,0xFC,0xF9,0xFF,0x04,0xF3,0xF9,0xFF,0xFE,0x7F,0xFE,0xFF,0x02,0xF0,0x1F,0xFC,
+0xF9,0xFF,0x04,0xF3,0xFC,0xFF,0xFE,0x7F,0xFE,0xFF,0x02,0xF7,0xDF,0xFC,0xF9,0xFF,
+0x04,0xF3,0xFC,0xFF,0xFE,0x7F,0xFE,0xFF,0x02,0xF7,0xDF,0xFC,0xF9,0xFF,0x04,0xF3,
+0xFE,0x7F,0xFE,0x7F,0xFE,0xFF,0x02,0xF0,0x1F,0xFC,0xF9,0xFF,0x04,0xF3,0xFF,0x3F,
+0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xF9,0xFF,0x04,0xF3,0xFF,0x3F,0xFE,0x7F,0xFC,0xFF,
+0x00,0xFC,0xF9,0xFF,0x04,0xF3,0xFF,0x9F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xF9,0xFF,
+0x04,0xF3,0xFF,0xCF,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xF9,0xFF,0x04,0xF3,0xFF,0x9F,
+0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xF9,0xFF,0x04,0xF3,0xFF,0x3F,0xFE,0x7F,0xFC,0xFF,
+0x00,0xFC,0xFB,0xFF,0x06,0x04,0xFF,0xF3,0xFF,0x3F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,
+0xFC,0xFF,0x07,0xFE,0x72,0xFF,0xF3,0xFE,0x7F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,
+0xFF,0x07,0xFE,0xF3,0x7F,0xF3,0xFC,0xFF,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,
+0x07,0xFE,0x95,0x7F,0xF3,0xFC,0xFF,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,
+0xFE,0x91,0x7F,0xF3,0xF9,0xFF,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xFE,
+0xFF,0x7F,0xF3,0xF0,0x7F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFB,0xFF,0x06,0x7E,0x7F,
+0xF3,0xF2,0x3F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xFE,0x00,0xFF,0xF3,
+0xE7,0x1F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xF8,0x81,0x7F,0xF3,0xE7,
+0x8F,0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xFB,0xFF,0x7F,0xF3,0xCF,0xE7,
+0xFE,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xFB,0xFF,0x7F,0xF3,0x9F,0xF1,0xFE,
+0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xF8,0x80,0xFF,0xF3,0x9F,0xF8,0xFE,0x7F,
+0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xFC,0x00,0x7F,0xF3,0x3F,0xFC,0x7E,0x7F,0xFC,
+0xFF,0x00,0xFC,0xFC,0xFF,0x07,0xFA,0xFF,0x7F,0xF2,0x7F,0xFF,0x3E,0x7F,0xFC,0xFF,
+0x00,0xFC,0xFC,0xFF,0x07,0xFA,0xFF,0x7F,0xF2,0x7F,0xFF,0x8E,0x7F,0xFC,0xFF,0x00,
+0xFC,0xFC,0xFF,0x07,0xF8,0x00,0xFF,0xF0,0xFF,0xFF,0xC6,0x7F,0xFC,0xFF,0x00,0xFC,
+0xFB,0xFF,0x06,0x80,0x7F,0xF0,0xFF,0xFF,0xE2,0x7F,0xFC,0xFF,0x00,0xFC,0xFB,0xFF,
+0x06,0x7F,0x7F,0xF1,0xFF,0xFF,0xF8,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x03,0xFE,
+0xFF,0x7F,0xF0,0xFE,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x03,0xFE,0x80,
+0x7F,0xF0,0xFE,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xF8,0xC0,0x7F,
+0xF7,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xFB,0xFF,0x7F,0xF7,0xFF,0x00,0xFC,0xFC,0xFF,
+0x02,0xFB,0xFF,0x7F,0xF7,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xF8,0x00,0x7F,0xF7,0xFF,
+0x00,0xFC,0xFC,0xFF,0x01,0xFB,0x07,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xFB,0xF8,
+0x7F,0xF7,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xF8,0xFF,0x7F,0xF7,0xFF,0x00,0xFC,0xFC,
+0xFF,0x02,0xFE,0x1F,0x7F,0xF7,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xF9,0xFC,0x7F,0xF7,
+0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFB,0xE3,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFB,
+0xE1,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xF9,0xFC,0x7F,0xF7,0xFF,0x00,0xFC,0xFC,
+0xFF,0x02,0xFE,0x1F,0x7F,0xF7,0xFF,0x00,0xFC,0xFC,0xFF,0x02,0xF8,0x7F,0x7F,0xF7,
+0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFB,0xFC,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFB,
+0x81,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xF8,0x7F,0xF6,0xFF,0x00,0xFC,0xF6,0xFF,
+0x00,0x3F,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,0x00,0x0F,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,
+0x00,0xC1,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xFC,0x1F,0xFB,0xFF,0x00,0xC0,0xFB,
+0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xF8,0x1F,0xFB,0xFF,0x00,0x0E,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x00,0xFB,0xFA,0xFF,0x00,0x3F,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x00,0xF9,
+0xF3,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xE0,0x1F,0xFB,0xFF,0x00,0x83,0xFB,0xFF,0x00,
+0xFC,0xFE,0xFF,0x01,0xE0,0x1F,0xFB,0xFF,0x00,0x03,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,
+0x00,0x53,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xFD,0xBF,0xFB,0xFF,0x00,0x5B,0xFB,
+0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xF9,0x9F,0xFB,0xFF,0x00,0x03,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x01,0xFB,0xDF,0xFB,0xFF,0x00,0xA7,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x01,
+0xFB,0xDF,0xF4,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xF8,0x1F,0xFC,0xFF,0x01,0xFC,0x03,
+0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xFC,0x3F,0xFC,0xFF,0x01,0xFC,0x03,0xFB,0xFF,
+0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xFC,0x1F,0xFB,0xFF,0x00,0x87,0xFB,
+0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xF8,0x1F,0xFB,0xFF,0x00,0x03,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x00,0xFB,0xFA,0xFF,0x00,0x7B,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x00,0xFB,
+0xFA,0xFF,0x00,0x33,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xF8,0x1F,0xFB,0xFF,0x00,
+0x00,0xFB,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xF8,0x1F,0xFB,0xFF,0x00,0x00,0xFB,0xFF,
+0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xE8,0x1F,0xFB,0xFF,0x00,0xB7,0xFB,
+0xFF,0x00,0xFC,0xFE,0xFF,0x01,0xE8,0x1F,0xFB,0xFF,0x00,0x23,0xFB,0xFF,0x00,0xFC,
+0xF6,0xFF,0x00,0x4B,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,0x00,0x5B,0xFB,0xFF,0x00,0xFC,
+0xF6,0xFF,0x00,0x13,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,0x00,0xB7,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x00,0xF8,0xF3,0xFF,0x00,0xFC,0xFE,0xFF,0x00,0xF8,0xFB,0xFF,0x01,0xFD,
+0x03,0xFB,0xFF,0x05,0xFC,0xFF,0xFF,0xC0,0x00,0x0F,0xFC,0xFF,0x01,0xFD,0x03,0xFB,
+0xFF,0x05,0xFC,0xFF,0xFF,0xC0,0x00,0x0F,0xF4,0xFF,0x05,0xFC,0xFF,0xFF,0xC0,0x00,
+0x0F,0xFB,0xFF,0x00,0x0F,0xFB,0xFF,0x04,0xFC,0xFF,0xFF,0xE0,0x78,0xFB,0xFF,0x01,
+0xFE,0x07,0xFB,0xFF,0x04,0xFC,0xFF,0xFF,0xF0,0x38,0xFB,0xFF,0x01,0xFC,0xF3,0xFB,
+0xFF,0x04,0xFC,0xFF,0xFF,0xFC,0x08,0xFB,0xFF,0x01,0xFD,0xFB,0xFB,0xFF,0x07,0xFC,
+0xFF,0xFF,0xFE,0x00,0xFF,0xFF,0xBE,0xFE,0xFF,0x01,0xFD,0xFB,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x03,0x80,0xFF,0xFF,0x98,0xFE,0xFF,0x01,0xFC,0x03,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x03,0xE0,0xFF,0xFF,0xC1,0xFE,0xFF,0x01,0xFC,0x03,0xFB,0xFF,0x00,0xFC,
+0xFE,0xFF,0x03,0xF0,0xFF,0xFF,0xE7,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFC,0x00,
+0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFC,0x00,0xF6,0xFF,0x00,0xFC,0xFE,0xFF,0x00,
+0xC0,0xF3,0xFF,0x05,0xFC,0xFF,0xFF,0xC7,0x80,0x3F,0xF4,0xFF,0x07,0xFC,0xFF,0xFF,
+0xC7,0x00,0x1F,0xFF,0xDD,0xFE,0xFF,0x01,0xFC,0x03,0xFB,0xFF,0x07,0xFC,0xFF,0xFF,
+0xC6,0x1F,0x0F,0xFF,0x9C,0xFE,0xFF,0x01,0xFC,0x03,0xFB,0xFF,0x07,0xFC,0xFF,0xFF,
+0xC6,0x3F,0x8F,0xFF,0xBE,0xFD,0xFF,0x00,0x33,0xFB,0xFF,0x07,0xFC,0xFF,0xFF,0xC6,
+0x3F,0x8F,0xFF,0xBE,0xFD,0xFF,0x00,0x7B,0xFB,0xFF,0x07,0xFC,0xFF,0xFF,0xC6,0x3F,
+0x8F,0xFF,0x80,0xFD,0xFF,0x00,0x03,0xFB,0xFF,0x07,0xFC,0xFF,0xFF,0xC6,0x3F,0x8F,
+0xFF,0xC1,0xFD,0xFF,0x00,0x87,0xFB,0xFF,0x05,0xFC,0xFF,0xFF,0xC0,0x1F,0x0F,0xF4,
+0xFF,0x05,0xFC,0xFF,0xFF,0xC0,0x0C,0x1F,0xFB,0xFF,0x00,0x87,0xFB,0xFF,0x07,0xFC,
+0xFF,0xFF,0xF0,0x0C,0x3F,0xFF,0xC0,0xFD,0xFF,0x00,0x03,0xFB,0xFF,0x00,0xFC,0xFE,
+0xFF,0x03,0x8C,0x7F,0xFF,0x80,0xFD,0xFF,0x00,0x7B,0xFB,0xFF,0x00,0xFC,0xFB,0xFF,
+0x00,0xB4,0xFD,0xFF,0x00,0x7B,0xFB,0xFF,0x00,0xFC,0xFB,0xFF,0x00,0xB6,0xFD,0xFF,
+0x00,0x03,0xFB,0xFF,0x00,0xFC,0xFB,0xFF,0x00,0x90,0xFD,0xFF,0x00,0x87,0xFB,0xFF,
+0x00,0xFC,0xFB,0xFF,0x00,0xD9,0xF6,0xFF,0x00,0xFC,0xFD,0xFF,0x00,0x8F,0xFB,0xFF,
+0x00,0x87,0xFB,0xFF,0x00,0xFC,0xFD,0xFF,0x00,0x8F,0xFB,0xFF,0x00,0x03,0xFB,0xFF,
+0x00,0xFC,0xFD,0xFF,0x02,0x8F,0xFC,0x00,0xFD,0xFF,0x00,0x7B,0xFB,0xFF,0x00,0xFC,
+0xFC,0xFF,0x01,0xFC,0x00,0xFD,0xFF,0x00,0x7B,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,0x00,
+0x03,0xFB,0xFF,0x00,0xFC,0xF6,0xFF,0x00,0x87,0xFB,0xFF,0x00,0xFC,0xFC,0xFF,0x01,
+0xFE,0x21,0xF6,0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFC,0x00,0xFD,0xFF,0x00,0x4F,0xFB,
+0xFF,0x00,0xFC,0xFC,0xFF,0x01,0xFD,0xDE,0xFE,0xFF,0x01,0xFE,0x47,0xFB,0xFF,0x07,
+0xFC,0xFF,0xFF,0xC0,0x00,0x0F,0xFD,0xDE,0xFE,0xFF,0x01,0xFC,0xD3,0xFB,0xFF,0x07,
+0xFC,0xFF,0xFF,0xC0,0x00,0x0F,0xFD,0xDE,0xFE,0xFF,0x01,0xFD,0xDB,0xFB,0xFF,0x07,
+0xFC,0xFF,0xFF,0xC0,0x00,0x0F,0xFD,0xDE,0xFE,0xFF,0x01,0xFD,0xFB,0xFB,0xFF,0x07,
+0xFC,0xFF,0xFF,0xF0,0xFF,0xFF,0xFC,0x00,0xFE,0xFF,0x01,0xFC,0xF3,0xFB,0xFF,0x07,
+0xFC,0xFF,0xFF,0xF8,0x7F,0xFF,0xFC,0x00,0xFE,0xFF,0x01,0xFE,0x07,0xFB,0xFF,0x04,
+0xFC,0xFF,0xFF,0xF8,0x7F,0xFA,0xFF,0x00,0x0F,0xFB,0xFF,0x04,0xFC,0xFF,0xFF,0xFC,
+0x7F,0xF3,0xFF,0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xEF,0xFF,0x00,
+0xFC,0xEF,0xFF,0x00,0xFC,0xEF,0xFF,0x00,0xFC,0xF3,0xFF,
+};
+
+// BitmapExample4 : 2888 bytes, packed 1188
+const unsigned char BitmapExample4_packed[] PROGMEM =
+{
+0x48,0x0B,0x00,0x00,0xAD,0xFF,0x00,0xF3,0xEF,0xFF,0x01,0xF3,0xDF,0xF0,0xFF,0x01,
+0xF0,0x1F,0xF0,0xFF,0x01,0xF0,0x1F,0xF0,0xFF,0x01,0xF7,0xDF,0xDD,0xFF,0x01,0xF8,
+0x3F,0xFE,0xFF,0x03,0xFE,0x00,0x00,0x07,0xF7,0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x03,
+0xFE,0x00,0x00,0x1D,0xF7,0xFF,0x01,0xF7,0xDF,0xFD,0xFF,0x02,0x00,0x00,0x39,0xF7,
+0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x03,0xFD,0x80,0x00,0x71,0xF7,0xFF,0x01,0xF8,0x3F,
+0xFE,0xFF,0x03,0xFD,0x80,0x00,0xC1,0xF2,0xFF,0x03,0xFC,0xC0,0x01,0x81,0xF6,0xFF,
+0x00,0xDF,0xFE,0xFF,0x03,0xFC,0x60,0x07,0x01,0xF7,0xFF,0x01,0x80,0x1F,0xFE,0xFF,
+0x03,0xFC,0x60,0x0E,0x01,0xF7,0xFF,0x01,0x80,0x1F,0xFE,0xFF,0x03,0xFC,0x30,0x1C,
+0x01,0xF7,0xFF,0x01,0xBF,0xDF,0xFE,0xFF,0x03,0xFC,0x18,0x30,0x01,0xF2,0xFF,0x03,
+0xFC,0x18,0xE0,0x01,0xF2,0xFF,0x03,0xFC,0x0D,0xC0,0x01,0xF7,0xFF,0x01,0xF8,0x3F,
+0xFE,0xFF,0x03,0xFC,0x0F,0x80,0x01,0xF7,0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x03,0xFC,
+0x06,0x00,0x01,0xF7,0xFF,0x01,0xF7,0xDF,0xFE,0xFF,0x03,0xFC,0x03,0x00,0x01,0xF7,
+0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x03,0xFC,0x03,0x00,0x01,0xF7,0xFF,0x01,0xF8,0x3F,
+0xFE,0xFF,0x03,0xFC,0x01,0x80,0x01,0xF2,0xFF,0x03,0xFC,0x00,0xC0,0x01,0xF7,0xFF,
+0x01,0x9F,0xBF,0xFE,0xFF,0x03,0xFC,0x00,0xC0,0x01,0xF7,0xFF,0x01,0x9F,0x9F,0xFE,
+0xFF,0x03,0xFC,0x00,0x60,0x01,0xF7,0xFF,0x01,0x9F,0x9F,0xFE,0xFF,0x03,0xFC,0x00,
+0x30,0x01,0xF7,0xFF,0x01,0x80,0x1F,0xFE,0xFF,0x03,0xFC,0x00,0x60,0x01,0xF7,0xFF,
+0x01,0xE0,0x3F,0xFE,0xFF,0x03,0xFC,0x00,0xC0,0x01,0xF2,0xFF,0x03,0xFC,0x00,0xC0,
+0x01,0xF2,0xFF,0x03,0xFC,0x01,0x80,0x01,0xF2,0xFF,0x03,0xFC,0x03,0x00,0x01,0xF2,
+0xFF,0x03,0xFC,0x03,0x00,0x01,0xF2,0xFF,0x03,0xFC,0x06,0x00,0x01,0xF2,0xFF,0x03,
+0xFC,0x0F,0x80,0x01,0xF2,0xFF,0x03,0xFC,0x0D,0xC0,0x01,0xF7,0xFF,0x01,0xF9,0xDF,
+0xFE,0xFF,0x03,0xFC,0x18,0xE0,0x01,0xF7,0xFF,0x01,0xF1,0xDF,0xFE,0xFF,0x03,0xFC,
+0x18,0x70,0x01,0xF7,0xFF,0x01,0xF5,0x9F,0xFE,0xFF,0x03,0xFC,0x30,0x18,0x01,0xF7,
+0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x03,0xFC,0x60,0x0E,0x01,0xF7,0xFF,0x01,0xF8,0x3F,
+0xFE,0xFF,0x03,0xFC,0x60,0x07,0x01,0xF2,0xFF,0x03,0xFC,0xC0,0x03,0x81,0xF7,0xFF,
+0x01,0xF9,0xDF,0xFE,0xFF,0x03,0xFD,0x80,0x00,0xC1,0xF7,0xFF,0x01,0xF1,0xDF,0xFE,
+0xFF,0x03,0xFD,0x80,0x00,0x71,0xF7,0xFF,0x01,0xF5,0x9F,0xFD,0xFF,0x02,0x00,0x00,
+0x39,0xF7,0xFF,0x01,0xF0,0x1F,0xFD,0xFF,0x02,0x00,0x00,0x1D,0xF7,0xFF,0x01,0xF8,
+0x3F,0xFE,0xFF,0x03,0xFE,0x00,0x00,0x07,0xE4,0xFF,0x00,0xF3,0xEF,0xFF,0x01,0xF3,
+0xDF,0xF0,0xFF,0x01,0xF0,0x1F,0xF0,0xFF,0x01,0xF0,0x1F,0xF0,0xFF,0x01,0xF7,0xDF,
+0xEF,0xFF,0x00,0xDF,0xF0,0xFF,0x01,0xF0,0x1F,0xF0,0xFF,0x01,0xF0,0x1F,0xF0,0xFF,
+0x00,0x87,0xEF,0xFF,0x01,0x80,0x1F,0xF0,0xFF,0x01,0xBF,0xDF,0xF0,0xFF,0x00,0xBF,
+0xEF,0xFF,0x01,0xBF,0xDF,0xF0,0xFF,0x01,0x80,0x1F,0xF0,0xFF,0x01,0x80,0x1F,0xF7,
+0xFF,0x02,0xFC,0x00,0x03,0xFD,0xFF,0x01,0x9F,0xDF,0xF7,0xFF,0x02,0xFC,0x00,0x03,
+0xFD,0xFF,0x00,0x9F,0xF6,0xFF,0x02,0xFC,0x00,0x03,0xF1,0xFF,0x02,0xFC,0x00,0x03,
+0xF1,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF2,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF2,0xFF,
+0x03,0xC3,0xFF,0xFC,0x3F,0xF2,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF2,0xFF,0x03,0xC3,
+0xFF,0xFC,0x3F,0xF2,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF2,0xFF,0x03,0xC3,0xFF,0xFC,
+0x3F,0xFC,0xFF,0x01,0xFC,0x00,0xF9,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xFC,0xFF,0x01,
+0xFC,0x00,0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFA,0xFF,0x00,0x9E,0xF9,0xFF,0x02,0xFC,
+0x00,0x03,0xFA,0xFF,0x00,0xBE,0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFA,0xFF,0x00,0x80,
+0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFA,0xFF,0x00,0xC1,0xC9,0xFF,0x00,0xC5,0xEF,0xFF,
+0x00,0x84,0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFA,0xFF,0x00,0xB6,0xF9,0xFF,0x02,0xFC,
+0x00,0x03,0xFA,0xFF,0x00,0xB6,0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFA,0xFF,0x00,0x80,
+0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFA,0xFF,0x00,0xC1,0xF9,0xFF,0x03,0xC3,0xFF,0xFC,
+0x3F,0xF2,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,0xFF,0x01,0xE1,0xEF,0xFC,0xFF,0x03,
+0xC3,0xFF,0xFC,0x3F,0xFC,0xFF,0x04,0xFE,0x1E,0xFF,0xC0,0xEF,0xFC,0xFF,0x03,0xC3,
+0xFF,0xFC,0x3F,0xFC,0xFF,0x04,0xFC,0x08,0xFF,0xDE,0x2F,0xFC,0xFF,0x03,0xC3,0xFF,
+0xFC,0x3F,0xFC,0xFF,0x04,0xFD,0xE1,0xFF,0xDF,0x0F,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,
+0x3F,0xFC,0xFF,0x04,0xFD,0xE7,0xFF,0xC7,0xCF,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,
+0xFC,0xFF,0x04,0xFD,0xEF,0xFF,0xE7,0xEF,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xFC,
+0xFF,0x01,0xFD,0xEF,0xF9,0xFF,0x02,0xFC,0x00,0x03,0xFB,0xFF,0x01,0xFC,0x00,0xF9,
+0xFF,0x02,0xFC,0x00,0x03,0xFB,0xFF,0x04,0xFC,0x00,0xFF,0xDC,0x1F,0xFC,0xFF,0x02,
+0xFC,0x00,0x03,0xF8,0xFF,0x01,0xD8,0x0F,0xFC,0xFF,0x02,0xFC,0x00,0x03,0xF8,0xFF,
+0x01,0xDB,0xEF,0xF0,0xFF,0x01,0xCB,0xEF,0xF0,0xFF,0x01,0xC1,0x8F,0xF0,0xFF,0x01,
+0xF1,0x9F,0xE8,0xFF,0x02,0xC3,0xFC,0x3F,0xF1,0xFF,0x02,0xC3,0xFC,0x3F,0xF1,0xFF,
+0x02,0xC3,0xFC,0x3F,0xF1,0xFF,0x02,0xC3,0xFC,0x3F,0xF9,0xFF,0x01,0xC0,0x0F,0xF0,
+0xFF,0x01,0xC0,0x0F,0xF0,0xFF,0x00,0xE7,0xEF,0xFF,0x00,0xF7,0xE8,0xFF,0x02,0xFC,
+0x00,0x03,0xF8,0xFF,0x01,0xF7,0xEF,0xFC,0xFF,0x02,0xFC,0x00,0x03,0xF8,0xFF,0x01,
+0xF1,0x8F,0xFC,0xFF,0x02,0xFC,0x00,0x03,0xF8,0xFF,0x01,0xF8,0x1F,0xFC,0xFF,0x02,
+0xFC,0x00,0x03,0xF8,0xFF,0x01,0xF8,0x1F,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,
+0xFF,0x01,0xF1,0x8F,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,0xFF,0x01,0xF7,0xEF,
+0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF2,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,0xFF,
+0x01,0xE1,0xEF,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,0xFF,0x01,0xC0,0xEF,0xFC,
+0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,0xFF,0x01,0xDE,0x2F,0xFC,0xFF,0x03,0xC3,0xFF,
+0xFC,0x3F,0xF9,0xFF,0x01,0xDF,0x0F,0xFC,0xFF,0x03,0xC3,0xFF,0xFC,0x3F,0xF9,0xFF,
+0x01,0xC7,0xCF,0xFC,0xFF,0x02,0xFC,0x00,0x03,0xF8,0xFF,0x01,0xE7,0xEF,0xFC,0xFF,
+0x02,0xFC,0x00,0x03,0xF1,0xFF,0x02,0xFC,0x00,0x03,0xF1,0xFF,0x02,0xFC,0x00,0x03,
+0xF8,0xFF,0x01,0xDC,0x1F,0xF0,0xFF,0x01,0xD8,0x0F,0xF0,0xFF,0x01,0xDB,0xEF,0xF0,
+0xFF,0x01,0xCB,0xEF,0xF0,0xFF,0x01,0xC1,0x8F,0xFC,0xFF,0x03,0xC0,0x00,0x00,0x3F,
+0xF9,0xFF,0x01,0xF1,0x9F,0xFC,0xFF,0x03,0xC0,0x00,0x00,0x3F,0xF2,0xFF,0x03,0xC0,
+0x00,0x00,0x3F,0xF2,0xFF,0x03,0xC0,0x00,0x00,0x3F,0xF2,0xFF,0x01,0xFC,0x3F,0xF0,
+0xFF,0x01,0xFC,0x3F,0xF7,0xFF,0x01,0xC0,0x0F,0xFC,0xFF,0x01,0xFC,0x3F,0xF7,0xFF,
+0x01,0xC0,0x0F,0xFC,0xFF,0x01,0xFC,0x3F,0xF7,0xFF,0x00,0xE7,0xEF,0xFF,0x00,0xF7,
+0x81,0xFF,0xE4,0xFF,
+};
+
+#endif
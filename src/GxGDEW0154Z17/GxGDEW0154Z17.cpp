@@ -26,56 +26,36 @@
 
 GxGDEW0154Z17::GxGDEW0154Z17(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW0154Z17_WIDTH, GxGDEW0154Z17_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#elif GxEPD_INTERLEAVED_3C
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer) / 2);
+#else
+  _initFrameBuffer<FrameBuffer>(_black_buffer, _red_buffer, sizeof(_black_buffer));
+#endif
 }
 
 void GxGDEW0154Z17::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0154Z17_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0154Z17_WIDTH - x - 1;
-      y = GxGDEW0154Z17_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0154Z17_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0154Z17_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW0154Z17_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW0154Z17_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW0154Z17_WIDTH / 8;
-  }
+void GxGDEW0154Z17::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+void GxGDEW0154Z17::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW0154Z17::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 
@@ -94,6 +74,7 @@ void GxGDEW0154Z17::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -101,35 +82,23 @@ void GxGDEW0154Z17::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW0154Z17::fillScreen(uint16_t color)
 {
-  uint8_t black = 0x00;
-  uint8_t red = 0x00;
-  if (color == GxEPD_WHITE);
-  else if (color == GxEPD_BLACK) black = 0xFF;
-  else if (color == GxEPD_RED) red = 0xFF;
-  else if ((color & 0xF100) > (0xF100 / 2))  red = 0xFF;
-  else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = 0xFF;
-  for (uint16_t x = 0; x < sizeof(_black_buffer); x++)
-  {
-    _black_buffer[x] = black;
-    _red_buffer[x] = red;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW0154Z17::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDEW0154Z17_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 1, 0, GxGDEW0154Z17_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -149,38 +118,17 @@ void GxGDEW0154Z17::drawExamplePicture(const uint8_t* black_bitmap, const uint8_
 void GxGDEW0154Z17::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-  {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < black_size)
-    {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&black_bitmap[i]);
-#else
-      data = black_bitmap[i];
-#endif
-      if (mode & bm_invert) data = ~data;
-    }
-    _writeData(data);
-  }
+  IO.startTransaction();
+  _writeBitmapData(IO, black_bitmap, black_size, GxGDEW0154Z17_BUFFER_SIZE, mode & bm_invert, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-  {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < red_size)
-    {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&red_bitmap[i]);
-#else
-      data = red_bitmap[i];
-#endif
-      if (mode & bm_invert_red) data = ~data;
-    }
-    _writeData(data);
-  }
+  IO.startTransaction();
+  _writeBitmapData(IO, red_bitmap, red_size, GxGDEW0154Z17_BUFFER_SIZE, mode & bm_invert_red, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPicture");
   _sleep();
@@ -189,6 +137,7 @@ void GxGDEW0154Z17::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_
 void GxGDEW0154Z17::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   // example bitmaps are normal on b/w, but inverted on red
   if (mode & bm_default) mode |= bm_normal;
   if (mode & bm_partial_update)
@@ -198,25 +147,11 @@ void GxGDEW0154Z17::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0154Z17_WIDTH - 1, GxGDEW0154Z17_HEIGHT - 1);
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW0154Z17_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE);
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("drawBitmap");
     IO.writeCommandTransaction(0x92); // partial out
@@ -226,25 +161,11 @@ void GxGDEW0154Z17::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW0154Z17_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE);
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -254,6 +175,7 @@ void GxGDEW0154Z17::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
 void GxGDEW0154Z17::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
@@ -261,15 +183,9 @@ void GxGDEW0154Z17::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0154Z17_WIDTH - 1, GxGDEW0154Z17_HEIGHT - 1);
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE * 2);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE);
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("eraseDisplay");
     IO.writeCommandTransaction(0x92); // partial out
@@ -279,15 +195,9 @@ void GxGDEW0154Z17::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE * 2);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE);
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -297,6 +207,7 @@ void GxGDEW0154Z17::eraseDisplay(bool using_partial_update)
 void GxGDEW0154Z17::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -330,25 +241,21 @@ void GxGDEW0154Z17::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW0154Z17_WIDTH / 8) + xs_bx;
+    _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x13);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW0154Z17_WIDTH / 8) + xs_bx;
+    _writePlaneData(IO, 1, idx, xe_bx - xs_bx, true, 0xFF);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("updateWindow");
   IO.writeCommandTransaction(0x92); // partial out
@@ -357,6 +264,7 @@ void GxGDEW0154Z17::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW0154Z17::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
@@ -406,25 +314,21 @@ void GxGDEW0154Z17::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW0154Z17_WIDTH / 8) + xss_d8;
+    _writePlaneData(IO, 0, idx, xse_d8 - xss_d8, true, 0xFF);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x13);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW0154Z17_WIDTH / 8) + xss_d8;
+    _writePlaneData(IO, 1, idx, xse_d8 - xss_d8, true, 0xFF);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
 }
 
@@ -465,15 +369,9 @@ void GxGDEW0154Z17::_writeData(uint8_t data)
 void GxGDEW0154Z17::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
+  if (!_waitBusy(_busy, LOW, 20000000)) // >14.9s !
   {
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 20000000) // >14.9s !
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -532,39 +430,36 @@ void GxGDEW0154Z17::_sleep(void)
 void GxGDEW0154Z17::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -573,39 +468,36 @@ void GxGDEW0154Z17::drawPaged(void (*drawCallback)(void))
 void GxGDEW0154Z17::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -614,39 +506,36 @@ void GxGDEW0154Z17::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW0154Z17::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -655,39 +544,36 @@ void GxGDEW0154Z17::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW0154Z17::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z17_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z17_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z17_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -717,6 +603,7 @@ void GxGDEW0154Z17::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -724,19 +611,23 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, ui
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0154Z17_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0154Z17_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW0154Z17_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0154Z17_PU_DELAY); // don't stress this display
@@ -745,6 +636,7 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, ui
 void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -752,19 +644,23 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0154Z17_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0154Z17_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW0154Z17_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0154Z17_PU_DELAY); // don't stress this display
@@ -773,6 +669,7 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x
 void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -780,19 +677,23 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(const void*), uint16_
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0154Z17_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0154Z17_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW0154Z17_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0154Z17_PU_DELAY); // don't stress this display
@@ -801,6 +702,7 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(const void*), uint16_
 void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -808,19 +710,23 @@ void GxGDEW0154Z17::drawPagedToWindow(void (*drawCallback)(const void*, const vo
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0154Z17_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0154Z17_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0154Z17_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW0154Z17_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0154Z17_PU_DELAY); // don't stress this display
@@ -832,6 +738,7 @@ void GxGDEW0154Z17::drawCornerTest(uint8_t em)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW0154Z17_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW0154Z17_WIDTH / 8; x++)
@@ -841,14 +748,12 @@ void GxGDEW0154Z17::drawCornerTest(uint8_t em)
       if ((x > GxGDEW0154Z17_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW0154Z17_WIDTH / 8 - 4) && (y > GxGDEW0154Z17_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW0154Z17_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z17_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0154Z17_BUFFER_SIZE);
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
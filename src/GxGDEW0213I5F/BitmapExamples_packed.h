@@ -0,0 +1,550 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h BitmapWaveshare.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample2 : 2756 bytes, packed 2037
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0xC8,0x00,0x00,0x0F,0xF5,0x00,0x01,0x0F,0x80,0xF6,0x00,0x01,
+0x0F,0xC0,0xF6,0x00,0x01,0x07,0xE0,0xF6,0x00,0x01,0x03,0xF0,0xF6,0x00,0x01,0x01,
+0xF8,0xF5,0x00,0x00,0xFC,0xF5,0x00,0x00,0x7E,0xF5,0x00,0x01,0x3F,0x80,0xF6,0x00,
+0x01,0x1F,0xC0,0xF6,0x00,0x01,0x0F,0xF0,0xF6,0x00,0x01,0x07,0xF8,0xF6,0x00,0x01,
+0x03,0xFC,0xF9,0x00,0x04,0x78,0x00,0x00,0x01,0xFE,0xF9,0x00,0x00,0xFE,0xFE,0x00,
+0x01,0xFF,0x80,0xFA,0x00,0x05,0xFF,0x80,0x00,0x00,0x7F,0x80,0xFA,0x00,0x05,0x7F,
+0xF0,0x00,0x00,0x3F,0xE0,0xFA,0x00,0x05,0x3F,0xFE,0x00,0x00,0x1F,0xE0,0xFA,0x00,
+0x05,0x1F,0xFF,0xC0,0x00,0x0F,0xF8,0xFA,0x00,0x05,0x07,0xFF,0xF0,0x00,0x07,0xFC,
+0xF9,0x00,0x04,0xFF,0xFE,0x00,0x03,0xFF,0xF9,0x00,0x05,0x3F,0xFF,0x80,0x03,0xFF,
+0x80,0xFA,0x00,0x05,0x07,0xFF,0xE0,0x01,0xFF,0xE0,0xFA,0x00,0x05,0x03,0xFF,0xF8,
+0x01,0xFF,0xF8,0xFD,0x00,0x08,0x03,0x80,0x00,0x00,0xFF,0xFC,0x01,0xFF,0xFE,0xFD,
+0x00,0x08,0x07,0xE0,0x00,0x00,0x3F,0xFF,0x81,0xFF,0xFF,0xFD,0x00,0x09,0x07,0xF8,
+0x00,0x00,0x1F,0xFF,0xE3,0xFF,0xFF,0xE0,0xFE,0x00,0x04,0x07,0xFF,0x00,0x00,0x07,
+0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x04,0x07,0xFF,0xF0,0x00,0x03,0xFD,0xFF,0x00,0xFE,
+0xFE,0x00,0x09,0x03,0xFF,0xFE,0x00,0x00,0xFF,0xFF,0xFC,0x03,0xFF,0xFD,0x00,0x09,
+0xFF,0xFF,0xC0,0x00,0x3F,0xFF,0xF8,0x01,0xFF,0xC0,0xFE,0x00,0x09,0x3F,0xFF,0xFC,
+0x00,0x0F,0xFF,0xF8,0x01,0xFF,0xE0,0xFE,0x00,0x09,0x0F,0xFF,0xFF,0xC0,0x07,0xFF,
+0xF9,0xF9,0xFF,0xF0,0xFE,0x00,0x09,0x03,0xFF,0xFF,0xFC,0x07,0xFF,0xF8,0x01,0xFF,
+0xF8,0xFD,0x00,0x08,0x7F,0xFF,0xFF,0x8F,0xFF,0xF8,0x01,0xFF,0xF8,0xFD,0x00,0x00,
+0x1F,0xFD,0xFF,0x03,0xFC,0x03,0xFF,0xFE,0xFD,0x00,0x00,0x07,0xF9,0xFF,0xFC,0x00,
+0xFD,0xFF,0x03,0xFC,0x03,0xFF,0xFF,0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xF8,0x01,
+0xFF,0xFF,0x80,0xFD,0x00,0x00,0x07,0xFE,0xFF,0x04,0xF8,0x01,0xFF,0xFF,0xC0,0xFC,
+0x00,0x07,0x7F,0xFF,0xFF,0xF9,0xF9,0xFF,0xFF,0xC0,0xFC,0x00,0x0A,0x07,0xFF,0xFF,
+0xF8,0x01,0xFF,0xFF,0xC0,0x00,0x07,0xE0,0xFE,0x00,0x09,0xFF,0xFF,0xF8,0x01,0xFF,
+0xFF,0xE0,0x00,0x0F,0xFC,0xFE,0x00,0x0C,0xFF,0xFF,0xFC,0x03,0xFF,0xFF,0xE0,0x00,
+0x0F,0xFF,0xF0,0x00,0x00,0xFB,0xFF,0x06,0xE0,0x00,0x07,0xFF,0xFF,0xFC,0x01,0xFE,
+0xFF,0x05,0xF9,0xFF,0xFF,0xE0,0x00,0x03,0xFA,0xFF,0x06,0xF9,0xFF,0xFF,0xE0,0x00,
+0x00,0x7F,0xFB,0xFF,0x06,0xF9,0xFF,0xFF,0xE0,0x00,0x00,0x1F,0xF8,0xFF,0x00,0xC0,
+0xFE,0x00,0xF8,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x3F,0xFD,0xFF,0x04,0xFC,0x03,0xFF,
+0xFF,0xC0,0xFD,0x00,0xFD,0xFF,0x04,0xF8,0x01,0xFF,0xFF,0xC0,0xFD,0x00,0x00,0x1F,
+0xFE,0xFF,0x04,0xF8,0x01,0xFF,0xFF,0x80,0xFC,0x00,0x07,0x1F,0xFF,0xFF,0xF9,0xF9,
+0xFF,0xFF,0x80,0xFC,0x00,0x07,0x01,0xFF,0xFF,0xF8,0x01,0xFF,0xFF,0x80,0xFB,0x00,
+0x05,0x7F,0xFF,0xF8,0x01,0xFF,0xFF,0xFE,0x00,0x00,0x02,0xFE,0x00,0x09,0x0F,0xFF,
+0xFC,0x03,0xFF,0xFF,0x00,0x00,0x03,0xCE,0xFE,0x00,0x00,0x01,0xFC,0xFF,0x03,0x00,
+0x00,0x07,0xFE,0xFD,0x00,0x08,0xFF,0xF9,0x83,0xFF,0xFF,0x00,0x00,0x07,0xFC,0xFD,
+0x00,0x08,0x7F,0xF9,0x01,0xFF,0xFE,0x00,0x00,0x06,0x70,0xFD,0x00,0x08,0x3F,0xF9,
+0x01,0xFF,0xFE,0x00,0x00,0x06,0x60,0xFD,0x00,0x08,0x3F,0xF9,0x39,0xFF,0xFC,0x00,
+0x00,0x07,0xFE,0xFD,0x00,0x08,0x1F,0xF8,0x11,0xFF,0xFC,0x00,0x00,0x07,0xFE,0xFD,
+0x00,0x08,0x1F,0xF8,0x11,0xFF,0xF8,0x00,0x00,0x07,0xFE,0xFD,0x00,0x04,0x1F,0xFF,
+0x13,0xFF,0xF0,0xF9,0x00,0x00,0x1F,0xFE,0xFF,0x00,0xE0,0xF9,0x00,0x00,0x7F,0xFE,
+0xFF,0x04,0xC0,0x00,0x00,0x06,0x66,0xFE,0x00,0x00,0x03,0xFD,0xFF,0xFE,0x00,0x01,
+0x06,0x66,0xFE,0x00,0xFD,0xFF,0x00,0xFC,0xFE,0x00,0x04,0x06,0x66,0x00,0x00,0x1F,
+0xFD,0xFF,0x00,0xE0,0xFE,0x00,0x03,0x06,0x66,0x00,0x01,0xFC,0xFF,0xFD,0x00,0x03,
+0x07,0xFE,0x00,0x07,0xFD,0xFF,0x00,0xF8,0xFD,0x00,0x03,0x07,0xFE,0x00,0x0F,0xFD,
+0xFF,0x00,0x80,0xFD,0x00,0x03,0x07,0xFE,0x00,0x1F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,
+0x03,0x1F,0xFF,0xFF,0x80,0xF8,0x00,0x02,0x3F,0xFF,0xE0,0xFA,0x00,0x04,0x03,0xC0,
+0x00,0x3F,0xFC,0xF9,0x00,0x03,0x07,0xE0,0x00,0x1F,0xF8,0x00,0x01,0x07,0xE0,0xF6,
+0x00,0x01,0x06,0x60,0xF6,0x00,0x01,0x06,0x60,0xF6,0x00,0x01,0x07,0xFE,0xF6,0x00,
+0x01,0x07,0xFE,0xFC,0x00,0x00,0x0C,0xFC,0x00,0x01,0x07,0xFE,0xFC,0x00,0x00,0x0E,
+0xF5,0x00,0x01,0x0F,0x80,0xFC,0x00,0x00,0x06,0xFC,0x00,0x01,0x03,0xFC,0xFC,0x00,
+0x00,0x3E,0xFC,0x00,0x01,0x01,0xFC,0xFD,0x00,0x01,0x01,0xFE,0xFC,0x00,0x01,0x03,
+0xFC,0xFD,0x00,0x01,0x07,0xF8,0xFC,0x00,0x01,0x0F,0x80,0xFD,0x00,0x01,0x07,0xD8,
+0xFC,0x00,0x00,0x0E,0xFC,0x00,0x01,0x07,0xD8,0xFC,0x00,0x00,0x0C,0xFC,0x00,0x01,
+0x07,0xF8,0xFA,0x00,0x05,0x7F,0xFF,0x80,0x00,0x01,0xFE,0xFB,0x00,0x06,0x0C,0x7F,
+0xFF,0x80,0x00,0x00,0x3E,0xFB,0x00,0x06,0x0C,0x40,0x00,0x80,0x00,0x00,0x06,0xFB,
+0x00,0x03,0x0C,0x40,0x00,0x80,0xF8,0x00,0x06,0x0C,0x40,0x00,0x80,0x00,0x03,0xC0,
+0xFC,0x00,0x07,0x0F,0xFC,0x7F,0xFF,0x80,0x00,0x07,0xE0,0xFC,0x00,0x07,0x0F,0xFC,
+0x40,0x00,0x80,0x00,0x07,0xE0,0xFC,0x00,0x07,0x0F,0xFC,0x7F,0xFF,0x80,0x00,0x06,
+0x60,0xFA,0x00,0x05,0x7F,0xFF,0x80,0x00,0x06,0x60,0xFB,0x00,0x06,0x0C,0x7F,0xFF,
+0x80,0x00,0x07,0xFE,0xFB,0x00,0x06,0x7C,0x40,0x00,0x80,0x00,0x07,0xFE,0xFC,0x00,
+0x07,0x03,0xFC,0x40,0x00,0x80,0x00,0x07,0xFE,0xFC,0x00,0x04,0x0F,0xF0,0x40,0x00,
+0x80,0xF9,0x00,0x07,0x0F,0xB0,0x40,0x00,0x80,0x00,0x00,0x30,0xFE,0x00,0x09,0x0F,
+0xC0,0x0F,0xB0,0x40,0x00,0x80,0x00,0x00,0x30,0xFE,0x00,0x09,0x3F,0xF0,0x0F,0xF0,
+0x40,0x00,0x80,0x00,0x00,0x30,0xFE,0x00,0x09,0x70,0x38,0x03,0xFC,0x7F,0xFF,0x80,
+0x00,0x00,0x30,0xFE,0x00,0x06,0x60,0x18,0x00,0x7C,0x40,0x00,0x80,0xFB,0x00,0x06,
+0x60,0x18,0x00,0x0C,0x7F,0xFF,0x80,0xFB,0x00,0x09,0x60,0x18,0x00,0x00,0x7F,0xFF,
+0x80,0x00,0x06,0x66,0xFE,0x00,0x09,0x7F,0xF8,0x07,0x80,0x40,0x00,0x80,0x00,0x06,
+0x66,0xFE,0x00,0x09,0x7F,0xF8,0x0F,0xC0,0x40,0x00,0x80,0x00,0x06,0x66,0xFC,0x00,
+0x07,0x0F,0xC0,0x40,0x00,0x80,0x00,0x06,0x66,0xFC,0x00,0x07,0x0C,0xC0,0x40,0x00,
+0x80,0x00,0x07,0xFE,0xFE,0x00,0x09,0x1E,0x00,0x0C,0xC0,0x7F,0xFF,0x80,0x00,0x07,
+0xFE,0xFE,0x00,0x09,0x7E,0x00,0x0F,0xFC,0x7F,0xFF,0x80,0x00,0x07,0xFE,0xFE,0x00,
+0x06,0x61,0x00,0x0F,0xFC,0x40,0x00,0x80,0xFB,0x00,0x06,0x61,0x00,0x0F,0xFC,0x40,
+0x00,0x80,0xFB,0x00,0x00,0x61,0xFE,0x00,0x02,0x7F,0xFF,0x80,0xFB,0x00,0x06,0x7F,
+0xF8,0x00,0x00,0x40,0x00,0x80,0xFB,0x00,0x06,0x7F,0xF8,0x06,0x78,0x7F,0xFF,0x80,
+0xF9,0x00,0x04,0x0E,0xFC,0x7F,0xFF,0x80,0xF9,0x00,0x04,0x0E,0xFC,0x7F,0xFF,0x80,
+0xFB,0x00,0x09,0x63,0x18,0x0C,0xCC,0x40,0x00,0x80,0x00,0x07,0xFE,0xFE,0x00,0x09,
+0x63,0x18,0x0C,0xCC,0x7F,0xFF,0x80,0x00,0x07,0xFE,0xFE,0x00,0x09,0x63,0x18,0x0F,
+0xDC,0x7F,0xFF,0x80,0x00,0x07,0xFE,0xFE,0x00,0x09,0x63,0x18,0x0F,0xDC,0x40,0x00,
+0x80,0x00,0x00,0x60,0xFE,0x00,0x09,0x63,0x18,0x07,0x98,0x40,0x00,0x80,0x00,0x00,
+0x60,0xFE,0x00,0x09,0x7F,0xF8,0x00,0x00,0x40,0x00,0x80,0x00,0x07,0xFE,0xFE,0x00,
+0x09,0x7F,0xF8,0x00,0x00,0x7F,0xFF,0x80,0x00,0x07,0xFE,0xFC,0x00,0x07,0x0F,0xFC,
+0x7F,0xFF,0x80,0x00,0x07,0xFE,0xFC,0x00,0x04,0x0F,0xFC,0x7F,0xFF,0x80,0xF9,0x00,
+0x0A,0x0F,0xFC,0x40,0x00,0x80,0x00,0x01,0x08,0x00,0x0C,0x38,0xFD,0x00,0x08,0x7F,
+0xFF,0x80,0x00,0x03,0x9C,0x00,0x0C,0x38,0xFD,0x00,0x05,0x7F,0xFF,0x80,0x00,0x07,
+0x9E,0xFC,0x00,0x07,0x03,0xF0,0x40,0x00,0x80,0x00,0x07,0x0E,0xFE,0x00,0x47,0x03,
+0x90,0x07,0xF8,0x40,0x00,0x80,0x00,0x06,0x06,0x00,0x03,0x10,0x06,0x98,0x0F,0xFC,
+0x7F,0xFF,0x80,0x00,0x07,0x0E,0x00,0x07,0x98,0x0C,0x98,0x0E,0x1C,0x7F,0xFF,0x80,
+0x00,0x07,0xFE,0x00,0x0D,0x98,0x0C,0x98,0x0C,0x0C,0x40,0x00,0x80,0x00,0x03,0xFC,
+0x00,0x0D,0x98,0x04,0x98,0x0F,0xFC,0x7F,0xFF,0x80,0x00,0x01,0xF8,0x00,0x0D,0x98,
+0x07,0xE0,0x0F,0xFC,0x40,0x00,0x80,0xFD,0x00,0x08,0x07,0xB0,0x01,0xE0,0x0F,0xFC,
+0x7F,0xFF,0x80,0xFD,0x00,0x01,0x03,0xE0,0xFD,0x00,0x05,0x7F,0xFF,0x80,0x00,0x07,
+0xFE,0xFA,0x00,0x21,0x7F,0xFF,0x80,0x00,0x07,0xFE,0x00,0x0C,0x00,0x7F,0xF8,0x00,
+0x00,0x40,0x00,0x80,0x00,0x07,0xFE,0x00,0x0C,0x00,0x7F,0xF8,0x00,0x00,0x40,0x00,
+0x80,0x00,0x00,0xFC,0x00,0x0C,0xFC,0x00,0x08,0x7F,0xFF,0x80,0x00,0x03,0xF0,0x00,
+0x07,0xF8,0xFD,0x00,0x12,0x7F,0xFF,0x80,0x00,0x07,0xFE,0x00,0x0F,0xF8,0x03,0xE0,
+0x00,0x00,0x40,0x00,0x80,0x00,0x07,0xFE,0xFE,0x00,0x09,0x07,0xF0,0x03,0xF0,0x7F,
+0xFF,0x80,0x00,0x07,0xFE,0xFE,0x00,0x06,0x0E,0x38,0x07,0xF8,0x7F,0xFF,0x80,0xFD,
+0x00,0x08,0x0F,0xF8,0x0E,0x18,0x0F,0xFC,0x7F,0xFF,0x80,0xFD,0x00,0x2F,0x0F,0xF8,
+0x06,0x10,0x0E,0x1C,0x40,0x00,0x80,0x00,0x07,0xFE,0x00,0x00,0x30,0x7F,0xF8,0x0C,
+0x0C,0x40,0x00,0x80,0x00,0x07,0xFE,0x00,0x00,0x18,0x7F,0xF8,0x0F,0xFC,0x7F,0xFF,
+0x80,0x00,0x07,0xFE,0x00,0x00,0x18,0x00,0x00,0x0F,0xFC,0x7F,0xFF,0x80,0xFD,0x00,
+0x08,0x0F,0xF8,0x00,0x00,0x0F,0xFC,0x40,0x00,0x80,0xFD,0x00,0x08,0x0F,0xE0,0x6F,
+0xF8,0x00,0x00,0x7F,0xFF,0x80,0xFB,0x00,0x06,0x6F,0xF8,0x00,0x00,0x7F,0xFF,0x80,
+0xFD,0x00,0x08,0x0C,0x18,0x00,0x00,0x03,0xF0,0x40,0x00,0x80,0xFD,0x00,0x08,0x0C,
+0x08,0x00,0x00,0x07,0xF8,0x40,0x00,0x80,0xFD,0x00,0x08,0x7F,0xF8,0x0C,0x18,0x0F,
+0xFC,0x40,0x00,0x80,0xFD,0x00,0x18,0x3F,0xF0,0x0F,0x70,0x0E,0x1C,0x7F,0xFF,0x80,
+0x00,0x03,0xBC,0x00,0x0C,0x00,0x03,0xE0,0x0C,0x0C,0x40,0x00,0x80,0x00,0x07,0xFE,
+0xFE,0x00,0x33,0x03,0xE0,0x0E,0x1C,0x40,0x00,0x80,0x00,0x07,0xFE,0x00,0x07,0xF8,
+0x0F,0x78,0x0F,0xFC,0x7F,0xFF,0x80,0x00,0x06,0x46,0x00,0x0D,0xF0,0x08,0x18,0x07,
+0xF8,0x7F,0xFF,0x80,0x00,0x07,0x5E,0x00,0x0D,0x90,0x00,0x00,0x03,0xF0,0x40,0x00,
+0x80,0x00,0x07,0x1E,0x00,0x0D,0x98,0xFD,0x00,0x0F,0x40,0x00,0x80,0x00,0x03,0x18,
+0x00,0x0D,0xF8,0x03,0x90,0x00,0x00,0x40,0x00,0x80,0xFD,0x00,0x08,0x04,0xF0,0x07,
+0x98,0x03,0xF0,0x40,0x00,0x80,0xFB,0x00,0x09,0x0C,0x98,0x07,0xF8,0x7F,0xFF,0x80,
+0x00,0x07,0xFE,0xFE,0x00,0x3A,0x0C,0x98,0x0F,0xFC,0x7F,0xFF,0x80,0x00,0x07,0xFE,
+0x00,0x03,0x90,0x0C,0x98,0x0E,0x1C,0x40,0x00,0x80,0x00,0x07,0xFE,0x00,0x07,0x98,
+0x07,0xF0,0x0C,0x0C,0x7F,0xFF,0x80,0x00,0x03,0x80,0x00,0x0D,0x98,0x03,0xE0,0x0E,
+0x1C,0x40,0x00,0x80,0x00,0x01,0x80,0x00,0x0D,0x98,0x00,0x00,0x0F,0xFC,0x40,0x00,
+0x80,0xFD,0x00,0x08,0x0D,0x98,0x00,0x00,0x07,0xF8,0x40,0x00,0x80,0xFD,0x00,0x18,
+0x07,0xF0,0x7F,0xF8,0x03,0xF0,0x40,0x00,0x80,0x00,0x00,0x06,0x00,0x03,0xE0,0x7F,
+0xF8,0x00,0x00,0x7F,0xFF,0x80,0x00,0x00,0x06,0xFA,0x00,0x05,0x40,0x00,0x80,0x00,
+0x00,0x06,0xFC,0x00,0x04,0x02,0x70,0x40,0x00,0x80,0xFD,0x00,0x08,0x60,0x00,0x60,
+0x00,0x07,0x78,0x7F,0xFF,0x80,0xFD,0x00,0x4C,0x63,0x00,0x61,0x00,0x0F,0x7C,0x7F,
+0xFF,0x80,0x00,0x03,0x86,0x00,0x63,0x00,0x61,0x00,0x0E,0x6C,0x40,0x00,0x80,0x00,
+0x07,0xC6,0x00,0x63,0x00,0x61,0x00,0x0C,0x6C,0x7F,0xFF,0x80,0x00,0x07,0xE6,0x00,
+0x63,0x00,0x61,0x00,0x0E,0x1C,0x40,0x00,0x80,0x00,0x06,0x36,0x00,0x7F,0xF8,0x7F,
+0xF8,0x0F,0xFC,0x40,0x00,0x80,0x00,0x07,0x9E,0x00,0x7F,0xF8,0x7F,0xF8,0x07,0xF8,
+0x40,0x00,0x80,0x00,0x07,0x8E,0xFC,0x00,0x07,0x03,0xF0,0x7F,0xFF,0x80,0x00,0x01,
+0x86,0x81,0x00,0xB4,0x00,
+};
+
+// BitmapExample3 : 2756 bytes, packed 2058
+const unsigned char BitmapExample3_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0x81,0xFF,0xEA,0xFF,0x02,0xF0,0x00,0x01,0xF7,0xFF,0x04,0xF0,
+0x00,0x01,0xF0,0x3F,0xFA,0xFF,0x05,0xDF,0xF0,0x00,0x01,0xE0,0x3F,0xFC,0xFF,0x06,
+0xFC,0x1F,0x1F,0xF0,0x3F,0x01,0xEF,0xFB,0xFF,0x06,0xF8,0x0C,0x1F,0xF0,0x7F,0x81,
+0xF7,0xFB,0xFF,0x07,0xF0,0x08,0x1F,0xF0,0xE1,0xC1,0x80,0x3F,0xFC,0xFF,0x07,0xF1,
+0xC0,0x7F,0xF0,0xC0,0xC1,0x80,0x3F,0xFC,0xFF,0x05,0xF1,0xC1,0xFF,0xF0,0xC0,0xC1,
+0xFA,0xFF,0x07,0xF1,0xC3,0xFF,0xF0,0xC0,0xC1,0xF6,0x7F,0xFC,0xFF,0x07,0xF1,0xC7,
+0xFF,0xF0,0xFF,0xC1,0xE4,0x3F,0xFC,0xFF,0x07,0xF1,0xC7,0xFF,0xF0,0xFF,0xC1,0xEC,
+0xBF,0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0x00,0x01,0xE9,0xBF,0xFC,0xFF,0x07,0xF0,
+0x00,0x1F,0xF0,0x00,0x01,0xE1,0x3F,0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0x78,0x01,
+0xF3,0x7F,0xF9,0xFF,0x02,0xF0,0xFC,0x01,0xF7,0xFF,0x04,0xF0,0xCC,0x01,0xF1,0x7F,
+0xFC,0xFF,0x07,0xF1,0xFF,0x1F,0xF0,0xCC,0x01,0xE1,0x3F,0xFC,0xFF,0x07,0xF1,0xC7,
+0x1F,0xF0,0xCC,0x01,0xED,0xBF,0xFC,0xFF,0x07,0xF1,0xC7,0x1F,0xF0,0xFF,0xC1,0xED,
+0xBF,0xFC,0xFF,0x07,0xF1,0xC7,0x1F,0xF0,0xFF,0xC1,0xE0,0x3F,0xFC,0xFF,0x07,0xF1,
+0xC7,0x1F,0xF0,0x00,0x01,0xF0,0x7F,0xFC,0xFF,0x05,0xF1,0xC7,0x1F,0xF0,0x00,0x01,
+0xFA,0xFF,0x06,0xF1,0xC7,0x1F,0xF0,0xCC,0xC1,0xEF,0xFB,0xFF,0x06,0xF1,0xC7,0x1F,
+0xF0,0xCC,0xC1,0xEF,0xFB,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0xCC,0xC1,0xE0,0x3F,0xFC,
+0xFF,0x07,0xF0,0x00,0x1F,0xF0,0xCC,0xC1,0xE0,0x3F,0xFC,0xFF,0x06,0xF0,0x00,0x1F,
+0xF0,0xCC,0xC1,0xBF,0xF8,0xFF,0x03,0xF0,0xFF,0xC1,0xAF,0xF8,0xFF,0x04,0xF0,0xFF,
+0xC1,0x80,0x3F,0xFC,0xFF,0x07,0xFC,0x1F,0xFF,0xF0,0x00,0x01,0xC0,0x3F,0xFC,0xFF,
+0x06,0xF8,0x0F,0xFF,0xF0,0x00,0x01,0xEF,0xFB,0xFF,0x07,0xF0,0x07,0xFF,0xF0,0x00,
+0x01,0xF1,0x7F,0xFC,0xFF,0x07,0xF1,0xC7,0xFF,0xF0,0x00,0x01,0xE1,0x3F,0xFC,0xFF,
+0x07,0xF1,0xC7,0xFF,0xF0,0x00,0x01,0xED,0xBF,0xFC,0xFF,0x07,0xF1,0xC7,0xFF,0xF0,
+0x00,0x01,0xED,0xBF,0xFC,0xFF,0x07,0xF1,0xC7,0xFF,0xF0,0x0E,0x81,0xE0,0x3F,0xFC,
+0xFF,0x07,0xF1,0xC7,0xFF,0xF0,0x1E,0xC1,0xF0,0x7F,0xFC,0xFF,0x07,0xF0,0x00,0x1F,
+0xF0,0x36,0xC1,0xFF,0xBF,0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0x36,0xC1,0xC6,0x3F,
+0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0x36,0xC1,0x80,0x7F,0xF9,0xFF,0x03,0xF0,0x1F,
+0x81,0xB9,0xF9,0xFF,0x04,0x9F,0xF0,0x0F,0x01,0xBB,0xFA,0xFF,0x05,0xFC,0x1F,0xF0,
+0x00,0x01,0xBB,0xFA,0xFF,0x06,0xC0,0x1F,0xF0,0x00,0x01,0x80,0x3F,0xFC,0xFF,0x07,
+0xFE,0x00,0x7F,0xF0,0xFF,0xC1,0x80,0x3F,0xFC,0xFF,0x05,0xF0,0x00,0xFF,0xF0,0xFF,
+0xC1,0xFA,0xFF,0x05,0xF0,0x38,0xFF,0xF0,0x00,0x01,0xFA,0xFF,0x05,0xF1,0xF8,0xFF,
+0xF0,0x00,0x01,0xFA,0xFF,0x05,0xF0,0x38,0xFF,0xF0,0x0F,0x01,0xFA,0xFF,0x07,0xF0,
+0x00,0xFF,0xF0,0x1F,0x81,0x80,0x3F,0xFC,0xFF,0x07,0xFE,0x00,0x7F,0xF0,0x39,0xC1,
+0x80,0x3F,0xFB,0xFF,0x04,0xE0,0x1F,0xF0,0x30,0xC1,0xF9,0xFF,0x06,0xFC,0x1F,0xF0,
+0x18,0x81,0xF0,0x3F,0xFA,0xFF,0x05,0x9F,0xF0,0xFF,0xC1,0xE0,0x3F,0xF9,0xFF,0x04,
+0xF0,0xFF,0xC1,0xEB,0xBF,0xFC,0xFF,0x07,0xFC,0x1F,0xFF,0xF0,0x00,0x01,0xE9,0xBF,
+0xFC,0xFF,0x07,0xF8,0x0F,0xFF,0xF0,0x00,0x01,0xEC,0x3F,0xFC,0xFF,0x07,0xF0,0x07,
+0xFF,0xF0,0xBF,0xC1,0xF6,0x7F,0xFC,0xFF,0x05,0xF1,0xC7,0xFF,0xF0,0xBF,0xC1,0xFA,
+0xFF,0x07,0xF1,0xC7,0xFF,0xF0,0x00,0x01,0xA0,0x3F,0xFC,0xFF,0x07,0xF1,0xC7,0xFF,
+0xF0,0x00,0x01,0xA0,0x3F,0xFC,0xFF,0x05,0xF1,0xC7,0xFF,0xF0,0x30,0xC1,0xFA,0xFF,
+0x07,0xF1,0xC7,0xFF,0xF0,0x39,0xC1,0xEF,0xBF,0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,
+0x0F,0x01,0x80,0x3F,0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0x0F,0x01,0xC0,0x7F,0xFC,
+0xFF,0x06,0xF0,0x00,0x1F,0xF0,0x39,0xC1,0xEF,0xF8,0xFF,0x03,0xF0,0x30,0xC1,0xEF,
+0xFA,0xFF,0x05,0xF1,0xFF,0xF0,0x00,0x01,0xEF,0xFA,0xFF,0x06,0xF1,0xFF,0xF0,0x00,
+0x01,0xE0,0x3F,0xFB,0xFF,0x06,0xF1,0xFF,0xF0,0x0E,0x81,0xE0,0x3F,0xFB,0xFF,0x04,
+0xF1,0xFF,0xF0,0x1E,0xC1,0xF9,0xFF,0x06,0xF1,0xFF,0xF0,0x36,0xC1,0xF0,0x3F,0xFB,
+0xFF,0x06,0xF1,0xFF,0xF0,0x36,0xC1,0xE0,0x3F,0xF9,0xFF,0x04,0xF0,0x36,0xC1,0xEB,
+0xBF,0xF9,0xFF,0x04,0xF0,0x1F,0x81,0xE9,0xBF,0xFC,0xFF,0x07,0xF1,0xFF,0x1F,0xF0,
+0x0F,0x01,0xEC,0x3F,0xFC,0xFF,0x07,0xF1,0xC7,0x1F,0xF0,0x00,0x01,0xF6,0x7F,0xFC,
+0xFF,0x05,0xF1,0xC7,0x1F,0xF0,0x00,0x01,0xFA,0xFF,0x06,0xF1,0xC7,0x1F,0xF0,0xFF,
+0xC1,0xC3,0xFB,0xFF,0x06,0xF1,0xC7,0x1F,0xF0,0xFF,0xC1,0x81,0xFB,0xFF,0x06,0xF1,
+0xC7,0x1F,0xF0,0x00,0x01,0xBD,0xFB,0xFF,0x06,0xF1,0xC7,0x1F,0xF0,0x00,0x01,0xBD,
+0xFB,0xFF,0x06,0xF1,0xC7,0x1F,0xF0,0xC0,0x01,0xBD,0xFB,0xFF,0x07,0xF0,0x00,0x1F,
+0xF0,0xCC,0x01,0x80,0x3F,0xFC,0xFF,0x07,0xF0,0x00,0x1F,0xF0,0xCC,0x01,0x80,0x3F,
+0xFC,0xFF,0x05,0xF0,0x00,0x1F,0xF0,0xCC,0x01,0xF7,0xFF,0x02,0xF0,0xCC,0x01,0xF7,
+0xFF,0x02,0xF0,0xFF,0xC1,0xF7,0xFF,0x02,0xF0,0xFF,0xC1,0xF7,0xFF,0x04,0xF0,0x00,
+0x01,0xEF,0xBF,0xF9,0xFF,0x04,0xF0,0x00,0x01,0x80,0x3F,0xF9,0xFF,0x04,0xF0,0x00,
+0x01,0xC0,0x7F,0xF9,0xFF,0x03,0xF0,0x00,0x01,0xEF,0xF6,0xFF,0x01,0xF9,0xEF,0xFB,
+0xFF,0x28,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xEF,0xFF,0xFF,0xF0,0x01,0xFF,0xFF,0xF0,
+0x00,0x1F,0xFF,0xFF,0xF9,0xE0,0x3F,0xFF,0xE0,0x00,0xFF,0xFF,0xF0,0x00,0x1F,0xFF,
+0xFF,0xF9,0xE0,0x3F,0xFF,0xC0,0x00,0x7F,0xFF,0xFF,0xC7,0xFE,0xFF,0x00,0xF9,0xFE,
+0xFF,0x05,0x80,0x00,0x3F,0xFF,0xFF,0xC7,0xFE,0xFF,0x09,0xF9,0xF0,0x7F,0xFF,0x00,
+0x00,0x3F,0xFF,0xFF,0xC7,0xFE,0xFF,0x09,0xF9,0xE0,0x3F,0xFF,0x00,0x00,0x1F,0xFF,
+0xFF,0xC7,0xFE,0xFF,0x09,0xF9,0xEF,0xBF,0xFE,0x00,0x00,0x0F,0xFF,0xFF,0xC7,0xFE,
+0xFF,0x09,0xF9,0xEF,0xBF,0xFE,0x00,0x00,0x0F,0xFF,0xFF,0xC7,0xFE,0xFF,0x2D,0xF9,
+0xE0,0x3F,0xFE,0x02,0x00,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xF0,0x7F,0xFE,
+0x03,0x80,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0xC0,0x0F,
+0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xF0,0x7F,0xFE,0x03,0xFE,0x0F,0xFB,0xFF,0x06,
+0xF9,0xE0,0x3F,0xFE,0x00,0xFE,0x0F,0xFB,0xFF,0x09,0xF9,0xEF,0xBF,0xFE,0x03,0xFE,
+0x0F,0xFF,0xFE,0xFE,0xFE,0xFF,0x7F,0xF9,0xF7,0x7F,0xFE,0x03,0xC0,0x0F,0xFF,0xF8,
+0x7C,0x3F,0xFF,0xFF,0xF9,0xE0,0x0F,0xFE,0x03,0x80,0x0F,0xFF,0xF8,0x7C,0x3F,0xFF,
+0xFF,0xF9,0xE0,0x0F,0xFE,0x02,0x00,0x0F,0xFF,0xF0,0xFE,0x1F,0xFF,0xFF,0xF9,0xFF,
+0xFF,0xFE,0x00,0x06,0x0F,0xFF,0xF1,0xFF,0x1F,0xFF,0xFF,0xF9,0xF0,0x7F,0xFE,0x00,
+0xFE,0x0F,0xFF,0xF1,0xFF,0x1F,0xFF,0xFF,0xF9,0xE0,0x3F,0xFE,0x03,0xFE,0x0F,0xFF,
+0xF1,0xFF,0x1F,0xFF,0xFF,0xF9,0xEF,0xBF,0xFE,0x03,0xFC,0x0F,0xFF,0xF1,0xFF,0x1F,
+0xFF,0xFF,0xF9,0xF7,0x7F,0xFE,0x03,0x8C,0x0F,0xFF,0xF8,0x7C,0x3F,0xFF,0xFF,0xF9,
+0xE0,0x0F,0xFE,0x03,0xFC,0x0F,0xFF,0xF8,0x00,0x3F,0xFF,0xFF,0xF9,0xE0,0x0F,0xFE,
+0x03,0xFE,0x0F,0xFF,0xFC,0x00,0x7F,0x0B,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x01,0xFE,
+0x0F,0xFF,0xFF,0x01,0xFE,0xFF,0x06,0xF9,0xE0,0x3F,0xFE,0x00,0x0E,0x0F,0xFB,0xFF,
+0x06,0xF9,0xE0,0x3F,0xFE,0x00,0x00,0x0F,0xFB,0xFF,0x4A,0xF9,0xFF,0x7F,0xFE,0x00,
+0x06,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,0xBF,0xFE,0x00,0x06,0x0F,0xFF,
+0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xE0,0x3F,0xFE,0x00,0x06,0x0F,0xFF,0xF0,0x00,0x1F,
+0xFF,0xFF,0xF9,0xE0,0x7F,0xFE,0x03,0xFE,0x0F,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xF9,
+0xFF,0xFF,0xFE,0x03,0xFE,0x0F,0xFF,0xFF,0xF0,0x7F,0xFF,0xFF,0xF9,0xDC,0x7F,0xFE,
+0x03,0xFE,0x0F,0xFF,0xFF,0xC1,0xFE,0xFF,0x09,0xF9,0x98,0x3F,0xFE,0x00,0x00,0x0F,
+0xFF,0xFF,0x07,0xFE,0xFF,0x09,0xF9,0xB9,0xBF,0xFE,0x01,0xE0,0x0F,0xFF,0xFC,0x1F,
+0xFE,0xFF,0x09,0xF9,0xB1,0xBF,0xFE,0x03,0xF0,0x0F,0xFF,0xF8,0x7F,0xFE,0xFF,0x2D,
+0xF9,0xB3,0xBF,0xFE,0x03,0xF0,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0x83,0x3F,
+0xFE,0x03,0x30,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xC7,0x7F,0xFE,0x03,0xFE,
+0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0xFE,0x0F,0xFB,0xFF,
+0x06,0xF9,0xFF,0xFF,0xFE,0x03,0xFE,0x0F,0xFB,0xFF,0x2D,0xF9,0xFF,0xFF,0xFE,0x00,
+0x00,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x01,0x9C,0x0F,0xFF,
+0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0xBE,0x0F,0xFF,0xF0,0x00,0x1F,
+0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0xBE,0x0F,0xFB,0xFF,0x06,0xF9,0xFF,0xFF,0xFE,
+0x03,0x66,0x0F,0xFB,0xFF,0x06,0xF9,0xFF,0xFF,0xFE,0x03,0xEE,0x0F,0xFB,0xFF,0x06,
+0xF9,0xFF,0xFF,0xFE,0x03,0xEE,0x0F,0xFB,0xFF,0x06,0xF9,0xFF,0xFF,0xFE,0x01,0xCC,
+0x0F,0xFB,0xFF,0x06,0xF9,0xFF,0xFF,0xFE,0x00,0x00,0x0F,0xFB,0xFF,0x06,0xF9,0xFF,
+0xFF,0xFE,0x03,0xFE,0x0F,0xFB,0xFF,0x06,0xF9,0xFF,0xFF,0xFE,0x03,0xFE,0x0F,0xFB,
+0xFF,0x72,0xF9,0xFF,0xFF,0xFE,0x03,0xFE,0x0F,0xFF,0xFC,0x30,0x7F,0xFF,0xFF,0xF9,
+0xFF,0xFF,0xFE,0x00,0x00,0x0F,0xFF,0xF8,0x00,0x3F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,
+0x00,0xF8,0x0F,0xFF,0xF0,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x01,0xFC,0x0F,
+0xFF,0xF3,0x87,0x9F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0xFE,0x0F,0xFF,0xF3,0xCF,
+0x9F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0x06,0x0F,0xFF,0xF3,0xCF,0x9F,0xFF,0xFF,
+0xF9,0xFF,0xFF,0xFE,0x03,0x06,0x0F,0xFF,0xF0,0xFE,0x1F,0xFF,0xFF,0xF9,0xFF,0xFF,
+0xFE,0x03,0xFE,0x0F,0xFF,0xF8,0xFE,0x3F,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x03,0xFE,
+0x0F,0xFF,0xFC,0xFE,0x7F,0xFC,0xFF,0x03,0xFE,0x03,0xFE,0x0F,0xF8,0xFF,0x03,0xFE,
+0x00,0x00,0x0F,0xF8,0xFF,0x03,0xFE,0x00,0x00,0x0F,0xF8,0xFF,0x03,0xFE,0x00,0x00,
+0x0F,0xF8,0xFF,0x07,0xFE,0x00,0x00,0x0F,0xFF,0xF0,0x00,0x1F,0xFC,0xFF,0x07,0xFE,
+0x00,0x00,0x0F,0xFF,0xF0,0x00,0x1F,0xFC,0xFF,0x07,0xFE,0x00,0xF8,0x0F,0xFF,0xF0,
+0x00,0x1F,0xFC,0xFF,0x06,0xFE,0x01,0xFC,0x0F,0xFF,0xFC,0x7F,0xFB,0xFF,0x06,0xFE,
+0x03,0xFE,0x0F,0xFF,0xFE,0x3F,0xFB,0xFF,0x06,0xFE,0x03,0x06,0x0F,0xFF,0xFE,0x3F,
+0xFB,0xFF,0x06,0xFE,0x03,0x06,0x0F,0xFF,0xFF,0x1F,0xFB,0xFF,0x03,0xFE,0x03,0xFE,
+0x0F,0xF8,0xFF,0x03,0xFE,0x03,0xFE,0x0F,0xF8,0xFF,0x03,0xFE,0x03,0xFE,0x0F,0xF8,
+0xFF,0x03,0xFE,0x00,0x00,0x0F,0xFE,0xFF,0x00,0x1F,0xFC,0xFF,0x03,0xFE,0x00,0xF8,
+0x0F,0xFE,0xFF,0x00,0x1F,0xFC,0xFF,0x03,0xFE,0x01,0xFC,0x0F,0xFE,0xFF,0x00,0x1F,
+0xFC,0xFF,0x03,0xFE,0x03,0xFE,0x0F,0xF8,0xFF,0x03,0xFE,0x03,0x06,0x0F,0xF8,0xFF,
+0x07,0xFE,0x03,0x06,0x0F,0xFF,0xFC,0x3F,0x9F,0xFC,0xFF,0x07,0xFE,0x03,0xFE,0x0F,
+0xFF,0xF8,0x0F,0x9F,0xFC,0xFF,0x07,0xFE,0x01,0xFC,0x0F,0xFF,0xF0,0x07,0x9F,0xFC,
+0xFF,0x07,0xFE,0x00,0xF8,0x0F,0xFF,0xF3,0xC3,0x9F,0xFC,0xFF,0x07,0xFE,0x00,0x00,
+0x0F,0xFF,0xF3,0xE0,0x9F,0xFC,0xFF,0x07,0xFE,0x00,0xF8,0x0F,0xFF,0xF3,0xF0,0x1F,
+0xFC,0xFF,0x07,0xFE,0x01,0xFC,0x0F,0xFF,0xF0,0xFC,0x1F,0xFC,0xFF,0x07,0xFE,0x03,
+0xFE,0x0F,0xFF,0xF8,0xFE,0x1F,0xFC,0xFF,0x07,0xFE,0x03,0x06,0x0F,0xFF,0xFC,0xFF,
+0x9F,0xFC,0xFF,0x03,0xFE,0x03,0x06,0x0F,0xF8,0xFF,0x03,0xFE,0x03,0xFE,0x0F,0xF8,
+0xFF,0x03,0xFE,0x01,0xFC,0x0F,0xF8,0xFF,0x03,0xFE,0x00,0xF8,0x0F,0xF8,0xFF,0x03,
+0xFE,0x00,0x00,0x0F,0xF8,0xFF,0x03,0xFE,0x01,0xBC,0x0F,0xF8,0xFF,0x03,0xFE,0x03,
+0xBE,0x0F,0xF8,0xFF,0x03,0xFE,0x03,0xBE,0x0F,0xF8,0xFF,0x03,0xFE,0x03,0x36,0x0F,
+0xF8,0xFF,0x03,0xFE,0x03,0x06,0x0F,0xF8,0xFF,0x03,0xFE,0x03,0xFE,0x0F,0xF8,0xFF,
+0x03,0xFE,0x01,0xFC,0x0F,0xF8,0xFF,0x03,0xFE,0x00,0xF8,0x0F,0xF8,0xFF,0x03,0xFE,
+0x00,0x00,0x0F,0xF8,0xFF,0x03,0xFE,0x00,0x00,0x0F,0xF8,0xFF,0x03,0xFE,0x00,0x00,
+0x0F,0xF8,0xFF,0x03,0xFE,0x00,0x00,0x0F,0xF8,0xFF,
+};
+
+// BitmapExample4 : 2756 bytes, packed 1957
+const unsigned char BitmapExample4_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0x90,0xFF,0x02,0xFE,0x00,0x1F,0xF7,0xFF,0x02,0xF8,0x00,0x07,
+0xF7,0xFF,0x02,0xF8,0x00,0x07,0xF7,0xFF,0x02,0xF8,0x00,0x07,0xF7,0xFF,0x02,0xF8,
+0x17,0x07,0xF7,0xFF,0x02,0xF8,0x14,0x87,0xF7,0xFF,0x02,0xF8,0x08,0x87,0xFE,0xFF,
+0x00,0xF7,0xFE,0xFF,0x05,0xFC,0x07,0xFF,0xF8,0x00,0x07,0xFE,0xFF,0x09,0xF7,0xFF,
+0xFF,0xC0,0x70,0x00,0xFF,0xF8,0x10,0x07,0xFE,0xFF,0x09,0xF7,0xFF,0xFF,0x00,0x20,
+0x00,0x7F,0xF8,0x1F,0x87,0xFE,0xFF,0x02,0xF7,0xFF,0xFE,0xFE,0x00,0x03,0x3F,0xF8,
+0x00,0x07,0xFE,0xFF,0x71,0xF0,0x7F,0xFC,0x00,0x00,0xF0,0x3F,0xF8,0x00,0x07,0xFF,
+0xFF,0xFB,0xE0,0x1F,0xF8,0x1E,0x01,0xF8,0x1F,0xF8,0x0C,0x87,0xFF,0xFF,0xF9,0xC7,
+0x8F,0xF8,0x3F,0x03,0xFC,0x1F,0xF8,0x14,0x87,0xFF,0xFF,0xF3,0xC7,0xCF,0xF8,0x7F,
+0x07,0xFE,0x1F,0xF8,0x14,0x87,0xFF,0xFF,0xF3,0xC7,0xCF,0xF8,0x7F,0x87,0xFE,0x1F,
+0xF8,0x0F,0x07,0xFF,0xFF,0xF3,0xC7,0xCF,0xF8,0x7F,0x07,0xFE,0x1F,0xF8,0x00,0x07,
+0xFF,0xFF,0xF9,0xE7,0x9F,0xF8,0x3F,0x03,0xFC,0x1F,0xF8,0x50,0x07,0xFF,0xFF,0xF8,
+0x72,0x1F,0xF8,0x1E,0x01,0xF8,0x1F,0xF8,0x7F,0x87,0xFF,0xFF,0xFE,0x00,0x7F,0xFC,
+0x00,0x00,0xF0,0x3F,0xF8,0x00,0x07,0xFE,0xFF,0x02,0x81,0xFF,0xFE,0xFE,0x00,0x03,
+0x3F,0xF8,0x50,0x07,0xFE,0xFF,0x09,0xF7,0xFF,0xFF,0x00,0x20,0x00,0x7F,0xF8,0x7F,
+0x87,0xFE,0xFF,0x09,0xF7,0xFF,0xFF,0xC0,0x70,0x00,0xFF,0xF8,0x10,0x07,0xFE,0xFF,
+0x00,0xF7,0xFE,0xFF,0x05,0xFC,0x03,0xFF,0xF8,0x00,0x07,0xFE,0xFF,0x00,0xF7,0xFB,
+0xFF,0x02,0xF8,0x0F,0x07,0xFE,0xFF,0x01,0xF7,0xCF,0xFC,0xFF,0x02,0xF8,0x10,0x87,
+0xFE,0xFF,0x01,0xF7,0xCF,0xFC,0xFF,0x02,0xF8,0x10,0x87,0xFE,0xFF,0x00,0xF7,0xFB,
+0xFF,0x02,0xF8,0x0F,0x07,0xFE,0xFF,0x00,0xF7,0xFB,0xFF,0x02,0xF8,0x00,0x07,0xFE,
+0xFF,0x00,0xF7,0xFB,0xFF,0x02,0xF8,0x00,0x07,0xFE,0xFF,0x00,0x81,0xFD,0xFF,0x09,
+0xFC,0x3F,0xF8,0x00,0x07,0xFF,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,0x09,0xF8,0x1F,0xF8,
+0x00,0x07,0xFF,0xFF,0xF8,0x76,0x1F,0xFE,0xFF,0x09,0xF8,0x1F,0xF8,0x00,0x07,0xFF,
+0xFF,0xF9,0xF7,0x9F,0xFE,0xFF,0x09,0xF8,0x1F,0xF8,0x00,0x07,0xFF,0xFF,0xF3,0xF7,
+0xCF,0xFE,0xFF,0x09,0xFC,0x3F,0xF8,0x0C,0x87,0xFF,0xFF,0xF3,0xF7,0xCF,0xFC,0xFF,
+0x07,0xF8,0x14,0x87,0xFF,0xFF,0xF3,0xF7,0xCF,0xFC,0xFF,0x07,0xF8,0x14,0x87,0xFF,
+0xFF,0xF9,0xF7,0x9F,0xFC,0xFF,0x07,0xF8,0x0F,0x07,0xFF,0xFF,0xF8,0x76,0x1F,0xFC,
+0xFF,0x07,0xF8,0x00,0x07,0xFF,0xFF,0xFE,0x00,0x7F,0xFC,0xFF,0x02,0xF8,0x10,0x07,
+0xFE,0xFF,0x00,0x81,0xFB,0xFF,0x02,0xF8,0x1F,0x87,0xFE,0xFF,0x09,0xF7,0xFF,0xFF,
+0xFE,0x00,0x3F,0xFF,0xF8,0x00,0x07,0xFE,0xFF,0x09,0xF7,0xFF,0xFF,0xF0,0x00,0x07,
+0xFF,0xF8,0x00,0x07,0xFE,0xFF,0x0F,0xF7,0xFF,0xFF,0xC0,0x00,0x01,0xFF,0xF8,0x0F,
+0x07,0xFF,0xFF,0xF0,0x00,0x0F,0xFF,0xFE,0x00,0x37,0xFF,0xF8,0x10,0x87,0xFF,0xFF,
+0xF0,0x00,0x0F,0xFE,0x00,0x03,0x80,0x7F,0xF8,0x10,0x87,0xFF,0xFF,0xF1,0xF7,0xFF,
+0xFC,0x03,0x81,0xF0,0x3F,0xF8,0x0F,0x07,0xFF,0xFF,0xF9,0xF7,0xFF,0xFC,0x0F,0xC1,
+0xFC,0x1F,0xF8,0x00,0x07,0xFF,0xFF,0xFD,0xF7,0xFF,0xF8,0x3F,0xE0,0xFC,0x1F,0xF8,
+0x00,0x07,0xFE,0xFF,0x7E,0xF7,0xFF,0xF8,0x3F,0xF0,0xFE,0x1F,0xF8,0x0F,0x87,0xFF,
+0xFF,0xFC,0xF0,0x3F,0xF8,0x7F,0xF0,0xFE,0x1F,0xF8,0x10,0x07,0xFF,0xFF,0xF8,0xF0,
+0x1F,0xF8,0x7F,0xF0,0xFE,0x1F,0xF8,0x08,0x07,0xFF,0xFF,0xF1,0xE7,0x8F,0xF8,0x3F,
+0xE0,0xFC,0x1F,0xF8,0x0F,0x87,0xFF,0xFF,0xF3,0xE7,0xCF,0xF8,0x3F,0xC0,0xFC,0x1F,
+0xF8,0x10,0x07,0xFF,0xFF,0xC0,0x00,0x03,0xFC,0x0F,0x81,0xF8,0x3F,0xF8,0x08,0x07,
+0xFF,0xFF,0xF3,0xC7,0xCF,0xFC,0x00,0x01,0xF8,0x7F,0xF8,0x1F,0x87,0xFF,0xFF,0xF1,
+0xC7,0x8F,0xFE,0x00,0x03,0xFE,0x7F,0xF8,0x00,0x07,0xFF,0xFF,0xF8,0x16,0x1F,0xFF,
+0x80,0x07,0xFF,0xFF,0xF8,0x00,0x07,0xFF,0xFF,0xFC,0x36,0x7F,0xFF,0xE0,0x1F,0xFF,
+0xFF,0xF8,0x00,0x07,0xFE,0xFF,0x00,0xF7,0xFB,0xFF,0x02,0xF8,0x00,0x07,0xFE,0xFF,
+0x00,0xF7,0xFB,0xFF,0x02,0xF8,0x00,0x07,0xFE,0xFF,0x00,0xF7,0xFB,0xFF,0x02,0xF8,
+0x00,0x07,0xF7,0xFF,0x02,0xF8,0x38,0x87,0xF7,0xFF,0x02,0xF8,0x44,0x87,0xF7,0xFF,
+0x02,0xF8,0x42,0x87,0xF7,0xFF,0x02,0xF8,0x21,0x87,0xF7,0xFF,0x02,0xF8,0x00,0x07,
+0xF7,0xFF,0x02,0xF8,0x00,0x07,0xFA,0xFF,0x05,0xF8,0x07,0xFF,0xF8,0x00,0x07,0xFB,
+0xFF,0x06,0xC7,0xF0,0x03,0xFF,0xF8,0x00,0x07,0xFB,0xFF,0x06,0x07,0xE0,0x00,0xFF,
+0xF8,0x00,0x07,0xFC,0xFF,0x07,0xFE,0x07,0xC0,0x00,0xFF,0xF8,0x18,0x07,0xFC,0xFF,
+0x07,0xFC,0x07,0xC0,0xE0,0x7F,0xF8,0x07,0x07,0xFC,0xFF,0x07,0xFC,0x1F,0x83,0xF0,
+0x7F,0xF8,0x00,0xC7,0xFC,0xFF,0x00,0xF8,0xFE,0x00,0x03,0x0F,0xF8,0x07,0x27,0xFC,
+0xFF,0x00,0xF8,0xFE,0x00,0x03,0x0F,0xF8,0x18,0x27,0xFC,0xFF,0x00,0xF8,0xFE,0x00,
+0x03,0x0F,0xF8,0x00,0x07,0xFC,0xFF,0x07,0xFC,0x1F,0x07,0xF8,0x7F,0xF8,0x1F,0x87,
+0xFC,0xFF,0x07,0xFC,0x0E,0x0F,0xF0,0x7F,0xF8,0x00,0x87,0xFC,0xFF,0x07,0xFE,0x00,
+0x0F,0xC0,0xFF,0xF8,0x00,0x87,0xFC,0xFF,0x07,0xFE,0x00,0x1F,0x00,0xFF,0xF8,0x1F,
+0x87,0xFB,0xFF,0x06,0x00,0x3F,0x01,0xFF,0xF8,0x00,0x07,0xFB,0xFF,0x06,0xC0,0x7F,
+0x03,0xFF,0xF8,0x00,0x07,0xF9,0xFF,0x04,0x0F,0xFF,0xF8,0x37,0x07,0xF7,0xFF,0x02,
+0xF8,0x48,0x87,0xF7,0xFF,0x02,0xF8,0x48,0x87,0xF7,0xFF,0x02,0xF8,0x48,0x87,0xF7,
+0xFF,0x02,0xF8,0x7F,0x87,0xF7,0xFF,0x02,0xF8,0x00,0x07,0xF7,0xFF,0x02,0xF8,0x00,
+0x07,0xF7,0xFF,0x02,0xFE,0x00,0x1F,0xB2,0xFF,0x01,0xFE,0x7F,0xF6,0xFF,0x01,0xFE,
+0x7F,0xFC,0xFF,0x00,0xF0,0xFE,0x00,0x03,0x01,0xFF,0xFE,0x3F,0xFC,0xFF,0x00,0xF0,
+0xFE,0x00,0x04,0x01,0xFF,0xFF,0x1E,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x04,0x01,
+0xFF,0xFF,0x80,0x7F,0xF6,0xFF,0x01,0x80,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x04,
+0x01,0xFF,0xFF,0x00,0x7F,0xF7,0xFF,0x02,0xFE,0x1E,0x7F,0xF7,0xFF,0x01,0xFE,0x3F,
+0xF6,0xFF,0x01,0xFE,0x7F,0xFC,0xFF,0x00,0xF0,0xFE,0x00,0x04,0x01,0xFF,0xFF,0xFE,
+0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x04,0x01,0xFF,0xFF,0xFC,0x7F,0xFD,0xFF,0x00,
+0xF0,0xFE,0x00,0x04,0x01,0xFF,0xFF,0xE0,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x09,
+0x01,0xFF,0xFF,0x80,0x7F,0xF9,0xE7,0xFF,0xFF,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFE,
+0x09,0xFF,0xF9,0xE7,0xFF,0xFF,0xF0,0xFE,0x00,0x03,0x01,0xFF,0xFC,0x19,0xF6,0xFF,
+0x01,0xFE,0x09,0xFC,0xFF,0x00,0xF0,0xFE,0x00,0x04,0x01,0xFF,0xFF,0x80,0x7F,0xF6,
+0xFF,0x01,0xF0,0x7F,0xF6,0xFF,0x01,0xFC,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x04,
+0x01,0xFF,0xFF,0xFE,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x00,0x01,0xFD,0xFF,0x04,
+0xFC,0x07,0xFF,0xFF,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFF,0xF8,0x7F,0xF8,0x07,0xFF,
+0xFF,0xF0,0xFE,0x00,0x05,0x01,0xFF,0xFF,0xFE,0x7F,0xF9,0xF8,0xFF,0x03,0xFE,0x7E,
+0x7F,0xFB,0xF8,0xFF,0x03,0xFE,0x00,0x7F,0xF9,0xF8,0xFF,0x04,0xFE,0x00,0x7F,0xF8,
+0x07,0xF9,0xFF,0x04,0xFE,0x00,0x7F,0xFC,0x07,0xF9,0xFF,0x02,0xFE,0x7E,0x7F,0xFD,
+0xFF,0x00,0xF0,0xFE,0x00,0x00,0x01,0xF2,0xFF,0x00,0x0F,0xF6,0xFF,0x04,0xFE,0x07,
+0xFF,0xFC,0x0F,0xF9,0xFF,0x07,0xFE,0x07,0xFF,0xFC,0x0F,0xFF,0xFF,0xF0,0xFE,0x00,
+0x06,0x01,0xFF,0xFE,0x66,0x7F,0xFB,0xF7,0xF9,0xFF,0x06,0xFE,0x00,0x7F,0xFB,0xF7,
+0xFF,0x9F,0xFB,0xFF,0x07,0xFE,0x00,0x7F,0xFB,0xF7,0xC0,0x07,0xF0,0xFE,0x00,0x09,
+0x01,0xFF,0xFE,0x00,0x7F,0xFC,0x0F,0xC0,0x07,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFE,
+0x7E,0x7F,0xFC,0x0F,0xEF,0xBF,0xF0,0xFE,0x00,0x00,0x01,0xFB,0xFF,0x01,0xF1,0xBF,
+0xFA,0xFF,0x00,0x30,0xFE,0xFF,0x01,0xFC,0x3F,0xFB,0xFF,0x06,0xFE,0x60,0x7F,0xC8,
+0x07,0xFF,0x3F,0xFB,0xFF,0x07,0xFE,0x40,0x7F,0xC8,0x07,0xFF,0xFF,0xF0,0xFE,0x00,
+0x08,0x01,0xFF,0xFE,0x02,0x7F,0xFF,0xFF,0xE0,0x1F,0xFB,0xFF,0x06,0xFE,0x06,0x7F,
+0xFB,0xF7,0xE0,0x0F,0xFA,0xFF,0x06,0x08,0xFF,0xFB,0xF7,0xCF,0xC7,0xF0,0xFE,0x00,
+0x00,0x01,0xFD,0xFF,0x04,0xC0,0x07,0xDF,0xE7,0xF0,0xFE,0x00,0x08,0x01,0xFF,0xFE,
+0x7E,0x7F,0xE0,0x0F,0xCF,0xC7,0xFB,0xFF,0x06,0xFE,0x00,0x7F,0xFB,0xFF,0xC0,0x0F,
+0xFB,0xFF,0x07,0xFE,0x00,0x7F,0xFF,0xFF,0xE0,0x1F,0xF0,0xFE,0x00,0x06,0x01,0xFF,
+0xFE,0x00,0x7F,0xF8,0x07,0xF9,0xFF,0x07,0xFE,0x7E,0x7F,0xF8,0x0F,0xFF,0xFF,0xF0,
+0xFE,0x00,0x00,0x01,0xFC,0xFF,0x00,0xE7,0xF8,0xFF,0x05,0x81,0xFF,0xFF,0xF7,0xC0,
+0x07,0xFA,0xFF,0x05,0x00,0xFF,0xFF,0xF7,0xC0,0x07,0xFB,0xFF,0x07,0xFE,0x00,0x7F,
+0xF8,0x07,0xE7,0xFF,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFE,0x3E,0x7F,0xF8,0x07,0xF3,
+0xFF,0xF0,0xFE,0x00,0x07,0x01,0xFF,0xFE,0x7E,0x7F,0xFF,0xFF,0xF9,0xFA,0xFF,0x02,
+0xFE,0x00,0x7F,0xF7,0xFF,0x02,0xFE,0x00,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x06,
+0x01,0xFF,0xFE,0x00,0x7F,0xC0,0x07,0xF9,0xFF,0x04,0xFE,0x7E,0x7F,0xC0,0x07,0xE5,
+0xFF,0x00,0xF0,0xFE,0x00,0x00,0x01,0xFD,0xFF,0x04,0xFC,0x0F,0xF3,0xE7,0xF0,0xFE,
+0x00,0x00,0x01,0xFD,0xFF,0x03,0xF8,0x07,0xF0,0x87,0xFA,0xFF,0x05,0x81,0xFF,0xF9,
+0xE7,0xFC,0x1F,0xFA,0xFF,0x06,0x00,0xFF,0xFB,0xF7,0xFC,0x1F,0xF0,0xFE,0x00,0x08,
+0x01,0xFF,0xFE,0x00,0x7F,0xF9,0xE7,0xF0,0xC7,0xFB,0xFF,0x06,0xFE,0x3E,0x7F,0xFC,
+0x0F,0xF3,0xE7,0xFB,0xFF,0x04,0xFE,0x7E,0x7F,0xFC,0x0F,0xF9,0xFF,0x02,0xFE,0x00,
+0x7F,0xF7,0xFF,0x02,0xFE,0x00,0x7F,0xFD,0xFF,0x00,0xF0,0xFE,0x00,0x06,0x01,0xFF,
+0xFE,0x00,0x7F,0xFD,0x8F,0xF9,0xFF,0x07,0xFE,0x7E,0x7F,0xF9,0x87,0xFF,0xFF,0xF0,
+0xFE,0x00,0x00,0x01,0xFD,0xFF,0x04,0xFB,0x37,0xFF,0xFF,0xF0,0xFE,0x00,0x08,0x01,
+0xFF,0xFF,0xC1,0xFF,0xFA,0x37,0xE1,0xE7,0xFA,0xFF,0x05,0x00,0xFF,0xF8,0x67,0xE0,
+0x67,0xFB,0xFF,0x07,0xFE,0x00,0x7F,0xFC,0x67,0xCC,0x67,0xF0,0xFE,0x00,0x09,0x01,
+0xFF,0xFE,0x3E,0x7F,0xFF,0xFF,0xDF,0x27,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFE,0x7C,
+0x7F,0xFF,0xFF,0xDF,0x07,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFE,0x00,0x7F,0xFE,0x3F,
+0xC7,0x87,0xF0,0xFE,0x00,0x08,0x01,0xFF,0xFF,0x00,0xFF,0xFC,0x37,0xE7,0xE7,0xFA,
+0xFF,0x03,0x81,0xFF,0xF9,0xB7,0xF6,0xFF,0x04,0xFB,0xB7,0xFF,0xFF,0xF0,0xFE,0x00,
+0x00,0x01,0xFD,0xFF,0x01,0xFB,0xB7,0xF8,0xFF,0x06,0xC1,0xFF,0xF9,0xA7,0xFF,0xFF,
+0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFF,0x00,0xFF,0xFC,0x0F,0xC0,0x07,0xF0,0xFE,0x00,
+0x09,0x01,0xFF,0xFE,0x00,0x7F,0xFE,0x1F,0xC0,0x07,0xF0,0xFE,0x00,0x09,0x01,0xFF,
+0xFE,0x3E,0x7F,0xFF,0xFF,0xF7,0xFF,0xF0,0xFE,0x00,0x07,0x01,0xFF,0xFE,0x7C,0x7F,
+0xFF,0xF7,0xF9,0xFA,0xFF,0x04,0xFE,0x00,0x7F,0xF1,0xE7,0xF8,0xFF,0x03,0x00,0xFF,
+0xC0,0x8F,0xF8,0xFF,0x05,0x81,0xFF,0xCE,0x1F,0xE1,0xE7,0xF8,0xFF,0x03,0xCE,0x3F,
+0xC0,0x67,0xFA,0xFF,0x06,0xF3,0xFF,0xCE,0x7F,0xCC,0x27,0xF0,0xFE,0x00,0x08,0x01,
+0xFF,0xFE,0x10,0xFF,0xCE,0x7F,0xDF,0x27,0xFB,0xFF,0x07,0xFE,0x10,0xFF,0xC0,0x07,
+0xDF,0x87,0xF0,0xFE,0x00,0x09,0x01,0xFF,0xFE,0x72,0x7F,0xC0,0x07,0xE7,0xC7,0xF0,
+0xFE,0x00,0x09,0x01,0xFF,0xFE,0x7E,0x7F,0xFF,0xFF,0xE7,0xE7,0xF0,0xFE,0x00,0x04,
+0x01,0xFF,0xFE,0x3C,0x7F,0xF7,0xFF,0x02,0xFE,0x00,0x7F,0xF6,0xFF,0x00,0x00,0xF5,
+0xFF,0x00,0xC3,0xC2,0xFF,
+};
+
+// BitmapExample1 : 2762 bytes, packed 2164
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xCA,0x0A,0x00,0x00,0x81,0x00,0xD2,0x00,0x02,0x03,0xFC,0x0C,0xF7,0x00,0x02,0x07,
+0xFF,0x1C,0xF7,0x00,0x02,0x0F,0xFF,0x9C,0xF7,0x00,0x02,0x18,0x07,0xDC,0xF7,0x00,
+0x02,0x38,0x07,0xFC,0xF7,0x00,0x02,0x74,0x06,0x7C,0xF7,0x00,0x02,0x66,0x06,0x7C,
+0xF7,0x00,0x02,0x66,0x02,0x7C,0xF7,0x00,0x06,0xE4,0x00,0x3C,0x00,0x00,0x01,0x80,
+0xFC,0x00,0x07,0x01,0xC0,0x00,0x3C,0x00,0x0E,0x01,0x80,0xFC,0x00,0x07,0x7F,0xC0,
+0x00,0x3C,0x00,0x0E,0x01,0x80,0xFD,0x00,0x08,0x1F,0xC0,0x00,0x00,0x7C,0x00,0x0E,
+0xE1,0x80,0xFD,0x00,0x00,0x3F,0xFE,0x00,0x04,0x7C,0x00,0x0E,0xE1,0x80,0xFD,0x00,
+0x00,0x3C,0xFE,0x00,0x04,0xFC,0x00,0x0E,0xE1,0x80,0xFD,0x00,0x00,0x70,0xFE,0x00,
+0x09,0xFC,0x00,0x0E,0xE1,0x80,0x00,0x04,0x00,0x00,0xC0,0xFE,0x00,0x22,0xFC,0x00,
+0x0E,0xE1,0x80,0x00,0x04,0x00,0x01,0xC0,0x00,0x00,0x01,0xFC,0x00,0x0E,0xE1,0x80,
+0x00,0x0C,0x00,0x07,0x80,0x00,0x00,0x01,0xFC,0x00,0x0E,0xE1,0x80,0x00,0x1E,0x00,
+0x0F,0xFE,0x00,0x09,0x03,0xDC,0x00,0x0E,0xE1,0x80,0x00,0x1E,0x00,0x3C,0xFE,0x00,
+0x09,0x3F,0x1C,0x00,0x0E,0xE1,0x80,0x00,0x3B,0x00,0x78,0xFE,0x00,0x35,0xFE,0x1C,
+0x00,0x0F,0xE1,0x80,0x00,0x3B,0x00,0x70,0x00,0x00,0x01,0xFE,0x1E,0x00,0x0F,0xFF,
+0x80,0x00,0x33,0x00,0x70,0x00,0x00,0x07,0xF8,0x1E,0x00,0x0F,0xFF,0x80,0x00,0x33,
+0x00,0x7C,0x00,0x00,0x07,0xC0,0x0E,0x00,0x0F,0xFF,0x80,0x00,0x73,0x00,0x3F,0xFF,
+0xC0,0x07,0xFF,0xCE,0xFC,0x00,0x07,0x63,0x00,0x1F,0xFF,0xC0,0x01,0xFF,0xFE,0xFC,
+0x00,0x10,0x63,0x00,0x1F,0xFF,0xC0,0x00,0xFF,0xFF,0x00,0x07,0xF0,0x80,0x00,0x63,
+0x00,0xFF,0x80,0xFE,0x00,0x08,0xF7,0x80,0x07,0xF0,0x80,0x00,0x63,0x00,0xFE,0xFD,
+0x00,0x08,0x7F,0x80,0x07,0xF9,0x80,0x00,0x63,0x01,0xF8,0xFD,0x00,0x08,0x3F,0x80,
+0x0E,0x3B,0x80,0x00,0x63,0x03,0xE0,0xFD,0x00,0x08,0x3F,0x80,0x0E,0x3F,0x80,0x00,
+0x63,0x07,0x80,0xFD,0x00,0x07,0x1F,0x80,0x0E,0x3F,0x00,0x00,0x63,0x0F,0xFC,0x00,
+0x07,0x1F,0x80,0x0E,0x3F,0x00,0x00,0x63,0x1E,0xFC,0x00,0x07,0x0F,0x80,0x0E,0x3E,
+0x00,0x00,0x63,0xFC,0xFC,0x00,0x07,0x0F,0x80,0x0E,0x3C,0x00,0x00,0x67,0xF8,0xFC,
+0x00,0x07,0x0F,0x80,0x0E,0x3C,0x00,0x00,0x67,0xF0,0xFC,0x00,0x07,0x0F,0x80,0x0E,
+0x3C,0x00,0x00,0x67,0xE0,0xFC,0x00,0x07,0x0F,0x80,0x0E,0x38,0x00,0x00,0x7F,0xC0,
+0xFC,0x00,0x07,0x1F,0x80,0x0E,0x38,0x00,0x00,0x7F,0xC0,0xFC,0x00,0x07,0x1C,0x00,
+0x0E,0x78,0x00,0x00,0x7F,0x80,0xFC,0x00,0x06,0x1C,0x00,0x0F,0xFF,0x80,0x00,0x7F,
+0xFD,0x00,0x08,0x07,0xFF,0xF8,0x00,0x0F,0xFF,0x80,0x00,0x3F,0xFD,0x00,0x08,0x3F,
+0x01,0xF0,0x00,0x0F,0xFF,0x00,0x00,0x3F,0xFD,0x00,0x02,0xF8,0x01,0xE0,0xFC,0x00,
+0x00,0x3E,0xFE,0x00,0x03,0x07,0xE0,0x00,0xF0,0xFC,0x00,0x00,0x1E,0xFE,0x00,0x09,
+0x0F,0x80,0x00,0x78,0x00,0x07,0xFF,0x80,0x00,0x1E,0xFE,0x00,0x09,0x1F,0x00,0x00,
+0x3C,0x00,0x07,0xFF,0x80,0x00,0x1E,0xFE,0x00,0x09,0x1E,0x00,0x00,0x1E,0x00,0x07,
+0xFF,0x80,0x00,0x0E,0xFE,0x00,0x09,0x18,0x00,0x00,0x07,0x00,0x0F,0x18,0x00,0x00,
+0x06,0xFE,0x00,0x09,0x18,0x00,0x00,0x07,0x80,0x0E,0x18,0x00,0x00,0x07,0xFE,0x00,
+0x7F,0x70,0x00,0x00,0x07,0x80,0x0E,0x18,0x00,0x00,0x07,0x00,0x00,0x01,0xE0,0x00,
+0x00,0x03,0x80,0x0E,0x18,0x00,0x00,0x07,0x00,0x00,0x0F,0xE0,0x00,0x00,0x03,0x80,
+0x0E,0x18,0x00,0x00,0x03,0x80,0x00,0x3F,0xF0,0x00,0x00,0x03,0x80,0x0E,0x18,0x00,
+0x00,0x03,0x80,0x00,0x00,0x3F,0x00,0x00,0x03,0x80,0x0E,0x18,0x00,0x00,0x03,0xC0,
+0x00,0x00,0x3F,0x00,0x00,0x03,0x80,0x0E,0x18,0x00,0x00,0x03,0xC0,0x00,0x00,0x3E,
+0x00,0x00,0x07,0x80,0x0F,0x18,0x00,0x00,0x01,0xE0,0x00,0x00,0x3C,0x04,0x00,0x07,
+0x80,0x07,0xFF,0x80,0x00,0x01,0xE0,0x00,0x00,0x3C,0x04,0x00,0x07,0x80,0x07,0xFF,
+0x80,0x00,0x00,0xF0,0x00,0x00,0x1C,0x1C,0x60,0x07,0x80,0x03,0xFF,0x80,0x00,0x00,
+0xF0,0x06,0x00,0x00,0x1E,0x3F,0xF0,0x07,0x80,0xFC,0x00,0x07,0x7F,0xF8,0x00,0x1F,
+0x7F,0xF0,0x07,0x80,0xFC,0x00,0x30,0x7F,0xFF,0x80,0x1F,0xFF,0xF0,0x07,0x80,0x0F,
+0xFF,0x80,0x00,0x00,0x3F,0xFF,0xC0,0x0F,0xFF,0xE0,0x07,0x80,0x0F,0xFF,0x80,0x00,
+0x00,0x0F,0xFF,0xF0,0x00,0x7C,0xC0,0x07,0x80,0x0F,0xFF,0x80,0x00,0x00,0x03,0xFF,
+0xF8,0x00,0x18,0xE0,0x07,0x80,0x00,0xE0,0xFE,0x00,0x09,0x01,0xFF,0xFE,0x00,0x00,
+0xF0,0x07,0x80,0x00,0xE0,0xFD,0x00,0x08,0xFF,0xFF,0x00,0x00,0xF0,0x0F,0x00,0x00,
+0xE0,0xFD,0x00,0x08,0xFF,0xFF,0x80,0x00,0xF0,0x0E,0x00,0x00,0xE0,0xFD,0x00,0x08,
+0x7F,0xFF,0xE0,0x00,0xF0,0x0E,0x00,0x00,0xE0,0xFD,0x00,0x08,0x1F,0xFF,0xE0,0x00,
+0xF0,0x0E,0x00,0x00,0xE0,0xFC,0x00,0x07,0xFF,0xE0,0x00,0xF0,0x0E,0x00,0x00,0xE0,
+0xFC,0x00,0x07,0x7F,0xF0,0x00,0xF0,0x06,0x00,0x00,0xE0,0xFC,0x00,0x07,0x07,0xF0,
+0x00,0xF0,0x07,0x00,0x00,0xE0,0xFC,0x00,0x07,0x01,0xF0,0x00,0xF0,0x07,0x80,0x00,
+0xE0,0xFB,0x00,0x07,0x98,0x00,0xF0,0x07,0x80,0x0F,0xFF,0x80,0xFC,0x00,0x07,0x1C,
+0x01,0xF0,0x07,0x80,0x0F,0xFF,0x80,0xFC,0x00,0x07,0x1E,0x01,0xF0,0x07,0x00,0x0F,
+0xFF,0x80,0xFC,0x00,0x03,0x0F,0x81,0xF0,0x0E,0xF8,0x00,0x06,0x07,0x81,0xF0,0x0E,
+0x00,0x00,0x1E,0xFB,0x00,0x06,0x03,0x81,0xF0,0x0E,0x00,0x0C,0x7F,0xFB,0x00,0x07,
+0x03,0xC1,0xF0,0x0E,0x00,0x0E,0xFF,0x80,0xFC,0x00,0x07,0x01,0xC0,0xE0,0x0F,0x00,
+0x0E,0xE3,0x80,0xFB,0x00,0x06,0xC0,0x00,0x07,0x00,0x0E,0xE3,0x80,0xFB,0x00,0x06,
+0xE0,0x00,0x07,0x80,0x0E,0xE3,0x80,0xFB,0x00,0x06,0x60,0x00,0x07,0x80,0x0E,0xE3,
+0x80,0xFB,0x00,0x06,0x60,0x00,0x07,0x80,0x0E,0xE3,0x80,0xFB,0x00,0x06,0x60,0x00,
+0x07,0x80,0x0E,0xE3,0x80,0xFB,0x00,0x06,0x70,0x00,0x0F,0x00,0x0E,0xE3,0x80,0xFB,
+0x00,0x06,0xF0,0x00,0x0E,0x00,0x0E,0xE3,0x80,0xFD,0x00,0x08,0x01,0xFF,0xFF,0xC0,
+0x0E,0x00,0x0E,0xE3,0x80,0xFD,0x00,0x08,0x3F,0xFF,0xFF,0xF8,0x0E,0x00,0x0F,0xE3,
+0x80,0xFD,0x00,0x08,0x7F,0xFF,0xFF,0xFC,0x0F,0x00,0x07,0xE3,0x80,0xFE,0x00,0x09,
+0x0F,0xFC,0x00,0x03,0xFF,0xFF,0x00,0x07,0xE3,0x80,0xFE,0x00,0x09,0x3F,0xE0,0x7F,
+0xFC,0x7F,0xFF,0x80,0x07,0xC3,0x80,0xFE,0x00,0x06,0xFF,0xCF,0xFF,0xFF,0xE7,0xFF,
+0x80,0xFC,0x00,0x02,0x01,0xF8,0x3F,0xFD,0xFF,0x00,0x80,0xFC,0x00,0x01,0x07,0xE0,
+0xFE,0xFF,0x09,0xFE,0xFF,0x80,0x0E,0x01,0x80,0x00,0x00,0x0F,0x81,0xFE,0xFF,0x09,
+0xFE,0x7F,0x00,0x0E,0x01,0x80,0x00,0x00,0x1F,0x00,0xFE,0xFF,0x09,0xFE,0x3E,0x00,
+0x0E,0xE1,0x80,0x00,0x00,0x7E,0x00,0xFD,0xFF,0x23,0xBE,0x00,0x0E,0xE1,0x80,0x00,
+0x00,0xFC,0x01,0xFF,0x7F,0xFF,0xFF,0xC7,0x80,0x0E,0xE1,0x80,0x00,0x01,0xF8,0x00,
+0xFE,0x3F,0xFF,0xFF,0xC3,0x80,0x0E,0xE1,0x80,0x00,0x03,0xF0,0x00,0x7F,0xFE,0xFF,
+0x08,0xE3,0x80,0x0E,0xE1,0x80,0x00,0x03,0xE0,0x00,0xFD,0xFF,0x08,0xF1,0x80,0x0E,
+0xE1,0x80,0x00,0x03,0xC0,0x01,0xFD,0xFF,0x08,0xF1,0xC0,0x0E,0xE1,0x80,0x00,0x03,
+0x80,0x03,0xFD,0xFF,0x08,0xF8,0xE0,0x0E,0xE1,0x80,0x00,0x07,0x00,0x01,0xFD,0xFF,
+0x09,0xFC,0xE0,0x0E,0xE1,0x80,0x00,0x0E,0x00,0x00,0x1F,0xFE,0xFF,0x09,0xFE,0x70,
+0x0F,0xE1,0x80,0x00,0x1C,0x00,0x00,0x07,0xFE,0xFF,0x09,0xFE,0x70,0x0F,0xE1,0x80,
+0x00,0x1C,0x00,0x00,0x03,0xFD,0xFF,0x09,0xF0,0x0F,0xFF,0x80,0x00,0x3C,0x00,0x00,
+0x20,0x7F,0xFE,0xFF,0x09,0xF0,0x0F,0xFF,0x80,0x00,0x3C,0x00,0x00,0x30,0x1F,0xFE,
+0xFF,0x09,0xF0,0x0F,0xFF,0x80,0x00,0x3C,0x00,0x00,0x38,0x0F,0xFE,0xFF,0x00,0xF0,
+0xFD,0x00,0x04,0x38,0x00,0x00,0x1E,0x03,0xFE,0xFF,0x01,0xF0,0x0C,0xFE,0x00,0x09,
+0x78,0x00,0x00,0x0F,0xE0,0x7F,0xFF,0xFE,0xF0,0x0E,0xFE,0x00,0x0D,0x70,0x00,0x00,
+0x01,0xFC,0x00,0x0F,0xF9,0x80,0x07,0x80,0x00,0x00,0xF0,0xFE,0x00,0x09,0x7F,0xC0,
+0x01,0xE7,0x80,0x07,0xC0,0x00,0x00,0xE0,0xFE,0x00,0x09,0x0F,0xFF,0xFE,0x3F,0x00,
+0x01,0xE0,0x00,0x00,0xE0,0xFD,0x00,0x08,0xFF,0xFF,0xFE,0x00,0x00,0xF8,0x00,0x00,
+0xE0,0xFD,0x00,0x08,0x1F,0xFF,0xFE,0x00,0x00,0x7C,0x00,0x00,0xF0,0xFD,0x00,0x08,
+0x01,0xFF,0xFC,0x00,0x00,0x1F,0x00,0x00,0xF0,0xFB,0x00,0x06,0x1C,0x00,0x00,0x0F,
+0x80,0x00,0xF0,0xFB,0x00,0x06,0x1C,0x00,0x00,0x07,0x80,0x00,0xF0,0xFB,0x00,0x06,
+0x1C,0x00,0x00,0x1F,0x00,0x00,0xF0,0xFB,0x00,0x06,0x1C,0x00,0x00,0x3E,0x00,0x00,
+0x78,0xFB,0x00,0x06,0x1C,0x00,0x00,0xF8,0x00,0x00,0x78,0xFB,0x00,0x06,0x1C,0x00,
+0x01,0xF0,0x00,0x00,0x7C,0xFB,0x00,0x06,0x1C,0x00,0x07,0xE0,0x00,0x00,0x3C,0xFB,
+0x00,0x06,0x1C,0x00,0x0F,0x80,0x00,0x00,0x1C,0xFB,0x00,0x02,0x0C,0x00,0x0E,0xFE,
+0x00,0x00,0x1C,0xFB,0x00,0x02,0x0C,0x00,0x0C,0xFE,0x00,0x00,0x0E,0xFB,0x00,0x00,
+0x0C,0xFC,0x00,0x00,0x07,0xFB,0x00,0x00,0x0C,0xFC,0x00,0x01,0x03,0x80,0xFC,0x00,
+0x07,0x0C,0x00,0x03,0xFF,0x00,0x00,0x03,0x80,0xFC,0x00,0x09,0x0C,0x00,0x07,0xFF,
+0x80,0x00,0x03,0xC0,0x00,0x07,0xFE,0x00,0x09,0x0C,0x00,0x07,0xFF,0x80,0x00,0x01,
+0xF0,0x00,0x0F,0xFE,0x00,0x03,0x0C,0x00,0x07,0x3B,0xFE,0x00,0x02,0x78,0x00,0x3F,
+0xFE,0x00,0x03,0x0E,0x00,0x0E,0x18,0xFE,0x00,0x02,0x3C,0x00,0x3E,0xFE,0x00,0x03,
+0x0E,0x00,0x0E,0x18,0xFE,0x00,0x02,0x0F,0x00,0x7C,0xFE,0x00,0x03,0x0E,0x00,0x0E,
+0x18,0xFE,0x00,0x02,0x07,0x00,0xF8,0xFE,0x00,0x03,0x0E,0x00,0x0E,0x18,0xFE,0x00,
+0x02,0x07,0x01,0xF0,0xFE,0x00,0x03,0x0E,0x00,0x0E,0x18,0xFE,0x00,0x02,0x03,0x01,
+0xC0,0xFE,0x00,0x03,0x0E,0x00,0x0E,0x18,0xFE,0x00,0x01,0x01,0x80,0xFD,0x00,0x03,
+0x0E,0x00,0x0E,0x18,0xFD,0x00,0x00,0x80,0xFD,0x00,0x03,0x0E,0x00,0x0E,0x18,0xFD,
+0x00,0x00,0xC0,0xFD,0x00,0x03,0x0E,0x00,0x0F,0x18,0xFD,0x00,0x00,0xC0,0xFD,0x00,
+0x04,0x0E,0x00,0x07,0xFF,0x80,0xFE,0x00,0x00,0xC0,0xFD,0x00,0x04,0x0E,0x00,0x07,
+0xFF,0x80,0xFE,0x00,0x00,0xE0,0xFD,0x00,0x04,0x0E,0x00,0x03,0xFF,0x80,0xFE,0x00,
+0x00,0xE0,0xFD,0x00,0x00,0x0E,0xFA,0x00,0x00,0xE0,0xFD,0x00,0x00,0x0E,0xFA,0x00,
+0x00,0xE0,0xFD,0x00,0x03,0x0F,0x00,0x0F,0xFF,0xFD,0x00,0x00,0xE0,0xFD,0x00,0x04,
+0x0F,0x80,0x0F,0xFF,0x80,0xFE,0x00,0x00,0xF0,0xFD,0x00,0x04,0x0F,0x80,0x0F,0xFF,
+0x80,0xFE,0x00,0x00,0xF0,0xFD,0x00,0x04,0x0F,0x80,0x00,0x07,0x80,0xFE,0x00,0x00,
+0xF0,0xFD,0x00,0x04,0x0F,0x80,0x00,0x03,0x80,0xFE,0x00,0x00,0xF0,0xFD,0x00,0x04,
+0x0F,0x80,0x00,0x03,0x80,0xFE,0x00,0x00,0x70,0xFD,0x00,0x04,0x0F,0x80,0x00,0x03,
+0x80,0xFE,0x00,0x00,0x78,0xFD,0x00,0x04,0x0F,0x80,0x00,0x03,0x80,0xFE,0x00,0x00,
+0x38,0xFD,0x00,0x04,0x0F,0x80,0x00,0x03,0x80,0xFE,0x00,0x00,0x3C,0xFD,0x00,0x04,
+0x0F,0x80,0x00,0x03,0x80,0xFE,0x00,0x00,0x3C,0xFD,0x00,0x04,0x0F,0x80,0x0F,0xFF,
+0x80,0xFE,0x00,0x00,0x3C,0xFD,0x00,0x04,0x1F,0x80,0x0F,0xFF,0x80,0xFE,0x00,0x00,
+0x3C,0xFD,0x00,0x04,0x1F,0x80,0x0F,0xFF,0x80,0xFE,0x00,0x00,0x1E,0xFD,0x00,0x04,
+0x1F,0x80,0x00,0x03,0x80,0xFE,0x00,0x00,0x1F,0xFD,0x00,0x04,0x1F,0x80,0x00,0x03,
+0x80,0xFE,0x00,0x00,0x0F,0xFD,0x00,0x04,0x3F,0x80,0x00,0x03,0x80,0xFE,0x00,0x01,
+0x07,0x80,0xFE,0x00,0x04,0x3F,0x80,0x00,0x03,0x80,0xFE,0x00,0x01,0x07,0x80,0xFE,
+0x00,0x04,0x3F,0x80,0x00,0x03,0x80,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0x04,0x3B,
+0x80,0x00,0x03,0x80,0xFE,0x00,0x01,0x03,0xC0,0xFE,0x00,0x04,0x79,0x80,0x00,0x03,
+0x80,0xFE,0x00,0x01,0x01,0xC0,0xFE,0x00,0x04,0x7B,0x80,0x00,0x07,0x80,0xFE,0x00,
+0x01,0x01,0xC0,0xFE,0x00,0x04,0xF3,0x80,0x0F,0xFF,0x80,0xFD,0x00,0x07,0xF0,0x00,
+0x00,0x01,0xF3,0x80,0x0F,0xFF,0xFC,0x00,0x07,0x38,0x00,0x00,0x01,0xE3,0x80,0x0F,
+0xFE,0xFC,0x00,0x05,0x3C,0x00,0x00,0x01,0xE3,0x80,0xFA,0x00,0x05,0x3E,0x00,0x00,
+0x01,0xC3,0x80,0xFA,0x00,0x05,0x1F,0x80,0x00,0x01,0x83,0x80,0xFA,0x00,0x05,0x0F,
+0xC0,0x00,0x03,0x03,0x80,0xFA,0x00,0x05,0x07,0xE0,0x00,0x07,0x03,0x80,0xFA,0x00,
+0x05,0x01,0xF0,0x00,0x1E,0x03,0x80,0xF9,0x00,0x04,0x0F,0xFF,0xFF,0xC3,0x80,0xF8,
+0x00,0x03,0xFF,0xFF,0xE3,0x80,0xF8,0x00,0x03,0x07,0xDF,0xE3,0x80,0xF8,0x00,0x03,
+0x03,0x8F,0xF3,0x80,0xF8,0x00,0x03,0x03,0x0F,0xF3,0x80,0xF8,0x00,0x03,0x03,0x87,
+0xF3,0x80,0xF8,0x00,0x03,0x01,0xC7,0xF3,0x80,0xF8,0x00,0x03,0x01,0xF3,0xE3,0x80,
+0xF7,0x00,0x02,0xFF,0xE3,0x80,0xF7,0x00,0x02,0x7F,0x83,0x80,0xF7,0x00,0x02,0x3F,
+0x03,0x80,0xAA,0x00,
+};
+
+#endif
@@ -122,47 +122,34 @@ const unsigned char GxGDEW0213I5F::lut_24_bb_partial[] = {
 
 GxGDEW0213I5F::GxGDEW0213I5F(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW0213I5F_WIDTH, GxGDEW0213I5F_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDEW0213I5F::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0213I5F_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0213I5F_WIDTH - x - 1;
-      y = GxGDEW0213I5F_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0213I5F_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0213I5F_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW0213I5F_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW0213I5F_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW0213I5F_WIDTH / 8;
-  }
+void GxGDEW0213I5F::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEW0213I5F::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW0213I5F::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 
@@ -181,6 +168,7 @@ void GxGDEW0213I5F::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -188,28 +176,21 @@ void GxGDEW0213I5F::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW0213I5F::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW0213I5F::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_buffer)) ? ~_buffer[i] : 0xFF);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDEW0213I5F_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -223,6 +204,7 @@ void  GxGDEW0213I5F::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, u
 void GxGDEW0213I5F::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_default) mode |= bm_invert; // Snoopy is inverted
   if (mode & bm_partial_update)
   {
@@ -234,20 +216,9 @@ void GxGDEW0213I5F::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
       IO.writeCommandTransaction(0x91); // partial in
       _setPartialRamArea(0, 0, GxGDEW0213I5F_WIDTH - 1, GxGDEW0213I5F_HEIGHT - 1);
       _writeCommand(0x13);
-      for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-      {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
-#else
-          data = bitmap[i];
-#endif
-          if (mode & bm_invert) data = ~data;
-        }
-        _writeData(data);
-      }
+      IO.startTransaction();
+      _writeBitmapData(IO, bitmap, size, GxGDEW0213I5F_BUFFER_SIZE, mode & bm_invert, 0xFF);
+      IO.endTransaction();
       _writeCommand(0x12); //display refresh
       _waitWhileBusy("drawBitmap");
       IO.writeCommandTransaction(0x92); // partial out
@@ -259,25 +230,11 @@ void GxGDEW0213I5F::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW0213I5F_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -287,6 +244,7 @@ void GxGDEW0213I5F::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
 void GxGDEW0213I5F::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
@@ -297,10 +255,7 @@ void GxGDEW0213I5F::eraseDisplay(bool using_partial_update)
       IO.writeCommandTransaction(0x91); // partial in
       _setPartialRamArea(0, 0, GxGDEW0213I5F_WIDTH - 1, GxGDEW0213I5F_HEIGHT - 1);
       _writeCommand(0x13);
-      for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-      {
-        _writeData(0xFF); // white is 0xFF on device
-      }
+      IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
       _writeCommand(0x12); //display refresh
       _waitWhileBusy("eraseDisplay");
       IO.writeCommandTransaction(0x92); // partial out
@@ -312,15 +267,9 @@ void GxGDEW0213I5F::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE * 2);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -330,6 +279,7 @@ void GxGDEW0213I5F::eraseDisplay(bool using_partial_update)
 void GxGDEW0213I5F::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEW0213I5F_WIDTH) return;
   if (y >= GxGDEW0213I5F_HEIGHT) return;
@@ -346,15 +296,13 @@ void GxGDEW0213I5F::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(x, y, xe, ye);
     IO.writeCommandTransaction(0x13);
+    IO.startTransaction();
     for (int16_t y1 = y; y1 <= ye; y1++)
     {
-      for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0213I5F_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-        IO.writeDataTransaction(~data); // white is 0xFF on device
-      }
+      uint32_t idx = uint32_t(y1) * (GxGDEW0213I5F_WIDTH / 8) + xs_bx;
+      _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF);
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("updateWindow");
     IO.writeCommandTransaction(0x92); // partial out
@@ -364,6 +312,7 @@ void GxGDEW0213I5F::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW0213I5F::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -408,15 +357,13 @@ void GxGDEW0213I5F::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16
     uint16_t xss_d8 = xs / 8;
     uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
     IO.writeCommandTransaction(0x13);
+    IO.startTransaction();
     for (int16_t y1 = ys; y1 <= yse; y1++)
     {
-      for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0213I5F_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-        IO.writeDataTransaction(~data); // white is 0xFF on device
-      }
+      uint32_t idx = uint32_t(y1) * (GxGDEW0213I5F_WIDTH / 8) + xss_d8;
+      _writePlaneData(IO, 0, idx, xse_d8 - xss_d8, true, 0xFF);
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("updateToWindow");
     IO.writeCommandTransaction(0x92); // partial out
@@ -461,15 +408,9 @@ void GxGDEW0213I5F::_writeData(uint8_t data)
 void GxGDEW0213I5F::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
+  if (!_waitBusy(_busy, LOW, 20000000)) // >14.9s !
   {
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 20000000) // >14.9s !
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -545,37 +486,21 @@ void GxGDEW0213I5F::_Init_FullUpdate(void)
   _writeData (0x08);
   _writeCommand(0X50); //VCOM AND DATA INTERVAL SETTING
   _writeData(0x97);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  unsigned int count;
   {
     _writeCommand(0x20);              //vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC[count]);
-    }
+    IO.writeDataTransaction(lut_20_vcomDC, 44);
 
     _writeCommand(0x21);              //ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww[count]);
-    }
+    IO.writeDataTransaction(lut_21_ww, 42);
 
     _writeCommand(0x22);              //bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw[count]);
-    }
+    IO.writeDataTransaction(lut_22_bw, 42);
 
     _writeCommand(0x23);              //wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb[count]);
-    }
+    IO.writeDataTransaction(lut_23_wb, 42);
 
     _writeCommand(0x24);              //bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb[count]);
-    }
+    IO.writeDataTransaction(lut_24_bb, 42);
   }
 }
 
@@ -587,66 +512,46 @@ void GxGDEW0213I5F::_Init_PartialUpdate(void)
   //_writeData(0x47);
   //_writeData(0x97);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   _writeData(0x17);
-  unsigned int count;
   {
     _writeCommand(0x20);              //vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC_partial[count]);
-    }
+    IO.writeDataTransaction(lut_20_vcomDC_partial, 44);
 
     _writeCommand(0x21);              //ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww_partial[count]);
-    }
+    IO.writeDataTransaction(lut_21_ww_partial, 42);
 
     _writeCommand(0x22);              //bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw_partial[count]);
-    }
+    IO.writeDataTransaction(lut_22_bw_partial, 42);
 
     _writeCommand(0x23);              //wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb_partial[count]);
-    }
+    IO.writeDataTransaction(lut_23_wb_partial, 42);
 
     _writeCommand(0x24);              //bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb_partial[count]);
-    }
+    IO.writeDataTransaction(lut_24_bb_partial, 42);
   }
 }
 
 void GxGDEW0213I5F::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0213I5F_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0213I5F_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0213I5F_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -655,29 +560,25 @@ void GxGDEW0213I5F::drawPaged(void (*drawCallback)(void))
 void GxGDEW0213I5F::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0213I5F_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0213I5F_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0213I5F_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -686,29 +587,25 @@ void GxGDEW0213I5F::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW0213I5F::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0213I5F_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0213I5F_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0213I5F_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -717,29 +614,25 @@ void GxGDEW0213I5F::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW0213I5F::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0213I5F_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0213I5F_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0213I5F_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -769,6 +662,7 @@ void GxGDEW0213I5F::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (x >= GxGDEW0213I5F_WIDTH) return;
   if (y >= GxGDEW0213I5F_HEIGHT) return;
@@ -784,27 +678,29 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, ui
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(x, y, xe, ye);
     IO.writeCommandTransaction(0x13);
-    for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+    for (_current_page = 0; _current_page < _pages; _current_page++)
     {
-      uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0213I5F_PAGE_HEIGHT);
-      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0213I5F_PAGE_HEIGHT) - 1;
+      uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height) - 1;
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback();
-        uint16_t ys = yds % GxGDEW0213I5F_PAGE_HEIGHT;
+        if (!_replayPage())
+        {
+          drawCallback();
+          _endRecording();
+        }
+        uint16_t ys = yds % _page_height;
+        IO.startTransaction();
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0213I5F_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          uint32_t idx = uint32_t(ys) * (GxGDEW0213I5F_WIDTH / 8) + xs_bx;
+          _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF); // white is 0xFF on device
         }
+        IO.endTransaction();
       }
     }
-    _current_page = -1;
+    _endPaged();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawPagedToWindow");
     IO.writeCommandTransaction(0x92); // partial out
@@ -815,6 +711,7 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, ui
 void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (x >= GxGDEW0213I5F_WIDTH) return;
   if (y >= GxGDEW0213I5F_HEIGHT) return;
@@ -830,27 +727,29 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(x, y, xe, ye);
     IO.writeCommandTransaction(0x13);
-    for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+    for (_current_page = 0; _current_page < _pages; _current_page++)
     {
-      uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0213I5F_PAGE_HEIGHT);
-      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0213I5F_PAGE_HEIGHT) - 1;
+      uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height) - 1;
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
-        uint16_t ys = yds % GxGDEW0213I5F_PAGE_HEIGHT;
+        if (!_replayPage())
+        {
+          drawCallback(p);
+          _endRecording();
+        }
+        uint16_t ys = yds % _page_height;
+        IO.startTransaction();
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0213I5F_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          uint32_t idx = uint32_t(ys) * (GxGDEW0213I5F_WIDTH / 8) + xs_bx;
+          _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF); // white is 0xFF on device
         }
+        IO.endTransaction();
       }
     }
-    _current_page = -1;
+    _endPaged();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawPagedToWindow");
     IO.writeCommandTransaction(0x92); // partial out
@@ -861,6 +760,7 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x
 void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (x >= GxGDEW0213I5F_WIDTH) return;
   if (y >= GxGDEW0213I5F_HEIGHT) return;
@@ -876,27 +776,29 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(const void*), uint16_
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(x, y, xe, ye);
     IO.writeCommandTransaction(0x13);
-    for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+    for (_current_page = 0; _current_page < _pages; _current_page++)
     {
-      uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0213I5F_PAGE_HEIGHT);
-      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0213I5F_PAGE_HEIGHT) - 1;
+      uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height) - 1;
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
-        uint16_t ys = yds % GxGDEW0213I5F_PAGE_HEIGHT;
+        if (!_replayPage())
+        {
+          drawCallback(p);
+          _endRecording();
+        }
+        uint16_t ys = yds % _page_height;
+        IO.startTransaction();
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0213I5F_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          uint32_t idx = uint32_t(ys) * (GxGDEW0213I5F_WIDTH / 8) + xs_bx;
+          _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF); // white is 0xFF on device
         }
+        IO.endTransaction();
       }
     }
-    _current_page = -1;
+    _endPaged();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawPagedToWindow");
     IO.writeCommandTransaction(0x92); // partial out
@@ -907,6 +809,7 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(const void*), uint16_
 void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (x >= GxGDEW0213I5F_WIDTH) return;
   if (y >= GxGDEW0213I5F_HEIGHT) return;
@@ -922,27 +825,29 @@ void GxGDEW0213I5F::drawPagedToWindow(void (*drawCallback)(const void*, const vo
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(x, y, xe, ye);
     IO.writeCommandTransaction(0x13);
-    for (_current_page = 0; _current_page < GxGDEW0213I5F_PAGES; _current_page++)
+    for (_current_page = 0; _current_page < _pages; _current_page++)
     {
-      uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0213I5F_PAGE_HEIGHT);
-      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0213I5F_PAGE_HEIGHT) - 1;
+      uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+      uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height) - 1;
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p1, p2);
-        uint16_t ys = yds % GxGDEW0213I5F_PAGE_HEIGHT;
+        if (!_replayPage())
+        {
+          drawCallback(p1, p2);
+          _endRecording();
+        }
+        uint16_t ys = yds % _page_height;
+        IO.startTransaction();
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0213I5F_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          uint32_t idx = uint32_t(ys) * (GxGDEW0213I5F_WIDTH / 8) + xs_bx;
+          _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF); // white is 0xFF on device
         }
+        IO.endTransaction();
       }
     }
-    _current_page = -1;
+    _endPaged();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawPagedToWindow");
     IO.writeCommandTransaction(0x92); // partial out
@@ -956,11 +861,9 @@ void GxGDEW0213I5F::drawCornerTest(uint8_t em)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0213I5F_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW0213I5F_BUFFER_SIZE);
   _writeCommand(0x13);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW0213I5F_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW0213I5F_WIDTH / 8; x++)
@@ -970,9 +873,10 @@ void GxGDEW0213I5F::drawCornerTest(uint8_t em)
       if ((x > GxGDEW0213I5F_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW0213I5F_WIDTH / 8 - 4) && (y > GxGDEW0213I5F_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW0213I5F_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
@@ -21,7 +21,7 @@
 
 #define GxGDEW0213I5F_BUFFER_SIZE (uint32_t(GxGDEW0213I5F_WIDTH) * uint32_t(GxGDEW0213I5F_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW0213I5F_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW0213I5F_HEIGHT
 #define GxGDEW0213I5F_PAGES 4
 
 #define GxGDEW0213I5F_PAGE_HEIGHT (GxGDEW0213I5F_HEIGHT / GxGDEW0213I5F_PAGES)
@@ -38,6 +38,10 @@ class GxGDEW0213I5F : public GxEPD
     GxGDEW0213I5F(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -52,7 +56,8 @@ class GxGDEW0213I5F : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW0213I5F_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW0213I5F_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -64,6 +69,7 @@ class GxGDEW0213I5F : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEW0213I5F";};
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -82,13 +88,15 @@ class GxGDEW0213I5F : public GxEPD
     void _waitWhileBusy(const char* comment = 0);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW0213I5F_WIDTH, GxGDEW0213I5F_HEIGHT, 1> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif defined(__AVR)
     uint8_t _buffer[GxGDEW0213I5F_PAGE_SIZE];
 #else
     uint8_t _buffer[GxGDEW0213I5F_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -119,6 +127,7 @@ class GxGDEW0213I5F : public GxEPD
 #define GxEPD_HEIGHT GxGDEW0213I5F_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW0213I5F/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW0213I5F/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW0213I5F/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,661 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h BitmapWaveshare.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 2756 bytes, packed 2629
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0xDA,0x00,0x03,0x07,0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xE0,0x0F,
+0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xF0,0x1F,0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xF8,0x3F,
+0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,0x07,0xFC,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0xFC,0x00,0x07,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xF8,0xFC,0x00,0x7F,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0x03,0xFF,0x80,
+0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0x0F,0xFF,0xF0,0x00,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0x3F,0xFF,0xFC,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xF8,0x00,0x7F,0xFF,0xFE,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,
+0x00,0xFF,0xFF,0xFE,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0xFC,0x00,
+0x3F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0xE0,0x00,0x07,0x00,0x1C,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0xE0,0x00,0x07,0x00,0x1C,0x3F,0xFF,0xFF,
+0xF7,0xFF,0xFF,0xF8,0x00,0xE0,0x00,0x07,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xF8,0x00,0xFC,0x00,0x7F,0x3F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,
+0x7F,0xFF,0xFF,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0x7F,0xFF,0xFE,
+0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0x3F,0xFF,0xFC,0x00,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0x0F,0xFF,0xF0,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xF8,0x00,0x01,0xFF,0xC0,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,
+0x00,0x0F,0xFF,0xF0,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0x39,0xF8,0x00,0x3F,0xFF,
+0xFC,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0x31,0xF8,0x00,0x7F,0xFF,0xFE,0x00,0x1C,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0xFF,0xFF,0xFE,0x00,0x1C,0x3F,0xFF,0xFF,
+0xF7,0xFF,0x7F,0xF8,0x00,0x7F,0xFC,0x00,0x3F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFE,
+0x7F,0xF8,0x00,0xE0,0x00,0x07,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFE,0x7F,0xF8,0x00,
+0xE0,0x00,0x07,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFC,0x7F,0xF8,0x00,0xE0,0x00,0x07,
+0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xF8,0x00,0xF8,0x00,0xFC,0x00,0x3F,0x00,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xBB,0xFF,0xF8,0x00,0x7F,0xFF,0xFF,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,
+0x87,0xFF,0xF8,0x00,0x7F,0xFF,0xFC,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xF3,0x07,0xF8,
+0x00,0x3F,0xFF,0xFC,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFC,0xF3,0xF8,0x00,0x0F,0xFF,
+0xF0,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFE,0x7B,0xF8,0x00,0x01,0xFF,0xDF,0x00,0x1C,
+0x3F,0xFF,0xFF,0xF7,0xC7,0x7F,0x00,0xF8,0xFE,0x00,0x09,0x1F,0x00,0x1C,0x3F,0xFF,
+0xFF,0xF7,0xF1,0x01,0xF8,0xFE,0x00,0x09,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFE,
+0x7F,0xF8,0xFE,0x00,0x09,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0x3F,0xF8,0xFE,
+0x00,0x7F,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xDF,0xF8,0x00,0xE0,0x1F,0xC0,
+0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xF8,0x00,0xF8,0x7F,0xF0,0x00,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xFF,0x93,0xF8,0x00,0xF8,0xFF,0xFC,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,
+0xEA,0x81,0xF8,0x00,0xF9,0xFF,0xFE,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xAA,0x8C,0xF8,
+0x00,0xFB,0xFE,0x3E,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0x80,0x0E,0xF8,0x00,0xFB,0xF8,
+0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xE5,0x46,0xF8,0x00,0xFF,0xF0,0x0F,0x00,0x1C,
+0x3F,0xFF,0xFF,0xF7,0xF5,0x56,0xF8,0x00,0xFF,0xE0,0x0F,0x00,0x1C,0x3F,0xFF,0xFF,
+0xF7,0x83,0xD0,0xF8,0x00,0xFF,0xE0,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xE0,0x03,
+0xF8,0x00,0x7F,0x7F,0xC0,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xF3,0xFF,0xF8,0x00,
+0x1F,0xC0,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFC,0x7F,0xF8,0x00,0x07,0xC0,0x1F,
+0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFE,0x7F,0xF8,0x00,0x01,0xC0,0x1E,0x00,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xBF,0xF8,0x00,0xE0,0x1F,0xC0,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xF8,0x00,0xF8,0x3F,0xF0,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xEF,0xF8,
+0x00,0xF8,0xFF,0xFC,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xFD,0xEF,0xF8,0x00,0xF9,0xFF,
+0xFE,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xF1,0xCF,0xF8,0x00,0xFB,0xFE,0x3E,0x00,0x1C,
+0x3F,0xFF,0xFF,0xF7,0xED,0xCF,0xF8,0x00,0xFB,0xF8,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,
+0xF7,0xED,0xAF,0x5B,0xF8,0x00,0xFF,0xF0,0x0F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xA1,
+0x27,0xF8,0x00,0xFF,0xE0,0x0F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xAF,0x40,0x78,0x00,
+0xFF,0xE0,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0x80,0xCD,0xF8,0x00,0x7F,0xC0,0x1F,
+0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xB7,0x17,0xF8,0x00,0x1F,0xC0,0x1F,0x00,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xB1,0xB7,0xF8,0x00,0x07,0xC0,0x1F,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,
+0xF6,0xDF,0xF8,0x00,0x01,0xC0,0x1E,0x00,0x1C,0x3F,0xFF,0xFF,0xF7,0xF9,0xE7,0xF8,
+0xFC,0x00,0x07,0x1C,0x3F,0xFF,0xFF,0xF7,0xFF,0xF7,0xF8,0xFC,0x00,0x07,0x1C,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xF7,0xF8,0xFC,0x00,0x04,0x1C,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,
+0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,
+0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,
+0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0xF7,0xF9,0xFF,
+0x04,0xFC,0x3F,0xFF,0xFF,0xF0,0xF8,0x00,0x7F,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,
+0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xDF,0xFF,0xFF,0x7F,0xFF,0xEF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,
+0x7F,0xEF,0xE7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xEF,0xC7,
+0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xED,0xC7,0xFC,0x3F,0xFF,
+0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xE8,0x7F,0xCF,0xFC,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x03,0x1F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0x83,0x1F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xEB,0x5F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xEA,0x4F,0xFC,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xE4,0xCF,0xFC,0x3F,0xFF,0xFF,
+0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF5,0xEF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xDF,0xFF,0xFF,0x7F,0xA5,0xE7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,
+0x7F,0x01,0xEF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xE0,0x0F,
+0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x7F,0xEE,0x07,0xFC,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xE6,0xE7,0xFC,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF6,0xF7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0xFE,0xF7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xFF,0xF7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFE,0xEF,0xFC,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFE,0x7F,0xFC,0x3F,0xFF,0xFF,
+0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFE,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xDF,0xFF,0xFF,0x7F,0x9E,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,
+0x7F,0x00,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0x7F,0xFF,0xFF,0x7F,0xF0,
+0x07,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xEF,0x43,0xFC,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xCF,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xCB,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0xFB,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xB3,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xB6,0xFF,0xFC,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x84,0xFF,0xFC,0x3F,0xFF,0xFF,
+0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x80,0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xDF,0xFF,0xFF,0x7F,0xD0,0x07,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0x7F,0xFF,0xDF,0xFF,
+0xFF,0x7F,0xD4,0xC3,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xD6,
+0x7F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF7,0x3F,0xFC,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xBF,0xFC,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0x9F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0xFF,0xDF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xDF,0xBF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xDF,0x9F,0xFC,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xD0,0xBF,0xFC,0x3F,0xFF,0xFF,
+0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x90,0xBF,0xFC,0x3F,0xFF,0xFF,0x7F,0xF7,0xFF,
+0xFF,0xDF,0xFF,0xFF,0x7F,0xD2,0x3F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,
+0xFF,0x7F,0x92,0x07,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x00,
+0xA3,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xD0,0xA3,0xFC,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xD2,0x83,0xFC,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xD2,0x97,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0xD0,0xB7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xEE,0x3F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF7,0xBF,0xFC,
+0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF7,0xBF,0xFC,0x3F,0x7F,0xFF,
+0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0x81,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,
+0xFF,0xDF,0xFF,0xFF,0x7F,0xC0,0x07,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,
+0xFF,0x7F,0xF7,0x07,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF7,
+0xF7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xF7,0xFF,0xFC,0x3F,
+0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,
+0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xE3,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,
+0xFF,0xFF,0x7F,0xE0,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xEF,0xFF,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xAF,0x3F,0x7F,
+0xFC,0x3F,0xFB,0xFF,0xF7,0xFF,0xFB,0xDF,0xFF,0xFF,0x7F,0xAD,0x07,0xFC,0x3F,0xFB,
+0xFF,0xF7,0x80,0x7B,0xDF,0xFF,0xFF,0x7F,0xA5,0x43,0xFC,0x3F,0xFB,0xFF,0xF7,0xFF,
+0x7B,0xDF,0xFF,0xFF,0x7F,0xAD,0x53,0xFC,0x3F,0x9B,0x9F,0xF7,0xE1,0xDB,0xDF,0xFF,
+0xFF,0x7F,0xAF,0x57,0xFC,0x3F,0xA3,0x63,0xF7,0xFB,0xCB,0xDF,0xFF,0xFF,0x7F,0x81,
+0x57,0xFC,0x3F,0xB3,0x79,0xF7,0xDB,0x83,0xDF,0xFF,0xFF,0x7F,0xA1,0x07,0xFC,0x3F,
+0xB4,0x7B,0xF7,0xC0,0x6B,0xDF,0xFF,0xFF,0x7F,0xAF,0x07,0xFC,0x3F,0xC3,0x7F,0xF7,
+0xDB,0xEB,0xDF,0xFF,0xFF,0x7F,0xAD,0x57,0xFC,0x3F,0xFD,0xFF,0xF7,0xE0,0xFB,0xDF,
+0xFF,0xFF,0x7F,0xA5,0x57,0xFC,0x3F,0xFD,0xFF,0xF7,0xFD,0x3B,0xDF,0xFD,0xFF,0x7F,
+0x7F,0xA5,0x57,0xFC,0x3F,0xFD,0xFF,0xF7,0xFD,0xDF,0xDF,0xFD,0xFF,0x7F,0xEC,0x03,
+0xFC,0x3F,0xFD,0xFF,0xF7,0xFD,0xFF,0xDF,0xE5,0xFF,0x7F,0xEF,0x03,0xFC,0x3F,0xFF,
+0xFF,0xF7,0xFF,0xFF,0xDF,0xAD,0xFF,0x7F,0xE3,0xFF,0xFC,0x3F,0xFF,0xFB,0xF7,0xFF,
+0xBD,0xDF,0xD5,0xFF,0x7F,0xF8,0xFF,0xFC,0x3F,0x80,0x7B,0xF7,0xFF,0xBD,0xDE,0x25,
+0xFF,0x7F,0xFF,0xFF,0xFC,0x3F,0xFF,0x7B,0xF7,0xF7,0xB9,0xDC,0xD0,0x07,0x7F,0xFF,
+0xEF,0xFC,0x3F,0xE1,0xDB,0xF7,0xB6,0xBB,0xDE,0x45,0xFF,0x7F,0xDF,0x67,0xFC,0x3F,
+0xFB,0xCB,0xF7,0xD5,0xB7,0xDE,0x92,0xFF,0x7F,0xDB,0x63,0xFC,0x3F,0xDB,0x83,0xF7,
+0xE5,0xAF,0xDF,0xFE,0xFF,0x7F,0xDB,0x63,0xFC,0x3F,0xC0,0x6B,0xF7,0x00,0x1F,0xDF,
+0x96,0x7F,0xFF,0x7F,0xDB,0x63,0xFC,0x3F,0xDB,0xEB,0xF7,0xF9,0xA7,0xDF,0xFE,0xFF,
+0x7F,0x90,0x67,0xFC,0x3F,0xE0,0xFB,0xF7,0xEA,0xDB,0xDF,0xFE,0xFF,0x7F,0x80,0x07,
+0xFC,0x3F,0xFD,0x3B,0xF7,0xDB,0x5D,0xDF,0xFF,0xFF,0x7F,0xCA,0x4F,0xFC,0x3F,0xFD,
+0xDF,0xF7,0xFF,0xDD,0xDF,0xFB,0xFF,0x7F,0xC2,0x4F,0xFC,0x3F,0xFD,0xFF,0xF7,0xFF,
+0xDF,0xDF,0xEB,0xFF,0x7F,0xD0,0x4F,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0x0B,
+0xFF,0x7F,0xD8,0x5F,0xFC,0x3F,0xFF,0xFF,0xF7,0xF7,0xFF,0xDD,0x60,0x0F,0x7F,0xFE,
+0x5F,0xFC,0x3F,0xFF,0x3F,0xF7,0xE3,0xFF,0xDF,0x4D,0xFF,0x7F,0xD3,0x5F,0xFC,0x3F,
+0xFF,0x07,0xF7,0xE8,0x3F,0xDF,0xEF,0xFF,0x7F,0xD2,0x5F,0xFC,0x3F,0xFF,0x77,0xF7,
+0xEF,0xBF,0x7F,0xDF,0x07,0xFF,0x7F,0x90,0x1F,0xFC,0x3F,0xCF,0x77,0xF7,0xEF,0xDF,
+0xDF,0xE8,0xFF,0x7F,0xD2,0x9F,0xFC,0x3F,0xC3,0x43,0xF7,0xF7,0xDF,0xDF,0x77,0x7F,
+0x7F,0xF3,0x9F,0xFC,0x3F,0xDD,0xBF,0xF7,0xF7,0xDF,0xDC,0x55,0xBF,0x7F,0xFB,0x9F,
+0xFC,0x3F,0xED,0xFF,0xF7,0xF7,0xDF,0xDD,0xA0,0x7F,0x7F,0xFF,0x9F,0xFC,0x3F,0xEC,
+0x0F,0xF7,0xF0,0x0F,0xDF,0x95,0x9F,0x7F,0xFF,0xDF,0xFC,0x3F,0xE3,0x37,0xF7,0xF3,
+0xFF,0xDF,0xFB,0xFF,0x7F,0xFF,0xEF,0xFC,0x3F,0xFF,0xB7,0xF7,0xFF,0xFF,0xDF,0xFF,
+0xFF,0x7F,0xFF,0xE7,0xFC,0x3F,0xFF,0xB3,0xF7,0xFF,0xBF,0xDF,0xFF,0xFF,0x7F,0xF7,
+0xC7,0xFC,0x3F,0xFF,0x8F,0xF7,0xFF,0xBF,0xDF,0xF7,0xFF,0x7F,0xF7,0xC3,0xFC,0x3F,
+0xFF,0xFF,0xF7,0x7F,0xFF,0xBD,0xDF,0xE7,0xFF,0x7F,0xF7,0x87,0xFC,0x3F,0xFD,0xFF,
+0xF7,0xED,0xBB,0xDF,0xE7,0xFF,0x7F,0xF7,0x0F,0xFC,0x3F,0xDD,0xFF,0xF7,0xA0,0x87,
+0xDF,0xCF,0xFF,0x7F,0xF6,0x3F,0xFC,0x3F,0xDD,0xFF,0xF7,0xAE,0xB7,0xDF,0xB1,0xFF,
+0x7F,0x94,0x7F,0xFC,0x3F,0xC1,0xFF,0xF7,0xF0,0x0B,0xDF,0x76,0x1F,0x7F,0x81,0xFF,
+0xFC,0x3F,0x2E,0xFF,0xF7,0xF6,0xCD,0xDE,0xF7,0xCF,0x7F,0x80,0xFF,0xFC,0x3F,0x6A,
+0xFF,0xF7,0xFE,0xDD,0xDD,0xFB,0xDF,0x7F,0xF0,0x7F,0xFC,0x3F,0xE6,0xFF,0xF7,0xF6,
+0xDF,0xDF,0x38,0xFF,0x7F,0xF7,0x3F,0xFC,0x3F,0xEE,0xFF,0xF7,0x80,0x03,0xDF,0x9B,
+0x7F,0x7F,0xF7,0x9F,0xFC,0x3F,0xEE,0x1F,0xF7,0xFB,0x7B,0xDF,0xEB,0xBF,0x7F,0xF3,
+0x8F,0xFC,0x3F,0xFF,0x7F,0xE3,0xF7,0xFB,0xBF,0xDF,0xF7,0xDF,0x7F,0xF3,0xCF,0xFC,
+0x3F,0xFF,0xF9,0xF7,0xFF,0xDF,0xDF,0xFB,0xDF,0x7F,0xF3,0xC7,0xFC,0x3F,0xFF,0xFE,
+0xF7,0xFF,0xDF,0xDF,0xFF,0xFF,0x7F,0xFF,0xE7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,
+0xDF,0xFF,0xFF,0x7F,0xFF,0xE7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,
+0x7F,0xFF,0xE7,0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xEF,
+0xFC,0x3F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x3F,0xFF,
+0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFC,0x1F,0xFF,0xFF,0xF7,0xFF,
+0xFF,0xDF,0xFF,0xFF,0x7F,0xFF,0xFF,0xF8,0x0F,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,
+0xFF,0x7F,0xFF,0xFF,0xF0,0x0C,0x07,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0x7F,
+0xFF,0xFF,0xE0,0xDA,0x00,
+};
+
+// BitmapExample2 : 2756 bytes, packed 1228
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0x8B,0x00,0x00,0x20,0xF5,0x00,0x01,0x21,0xE0,0xF6,0x00,0x01,
+0x33,0xF0,0xFC,0x00,0x01,0x01,0xFF,0xFD,0x00,0x01,0x13,0xF8,0xFC,0x00,0x02,0x07,
+0xFF,0xE0,0xFE,0x00,0x01,0x1A,0x1C,0xFC,0x00,0x02,0x1F,0xFF,0xF8,0xFE,0x00,0x01,
+0x0E,0x04,0xFC,0x00,0x02,0x3C,0x00,0x3C,0xFE,0x00,0x01,0x07,0xFC,0xFC,0x00,0x02,
+0x60,0x00,0x04,0xFE,0x00,0x01,0x03,0xFC,0xFC,0x00,0x02,0x40,0x00,0x02,0xFD,0x00,
+0x00,0xF8,0xFC,0x00,0x02,0x40,0x00,0x02,0xF7,0x00,0x02,0x40,0x00,0x02,0xF7,0x00,
+0x02,0x20,0x00,0x06,0xF7,0x00,0x02,0x3C,0x00,0x3C,0xFE,0x00,0x01,0x38,0x04,0xFC,
+0x00,0x02,0x1F,0xFF,0xF8,0xFE,0x00,0x01,0x1F,0xE4,0xFC,0x00,0x02,0x07,0xFF,0xE0,
+0xFE,0x00,0x01,0x1F,0xFC,0xFB,0x00,0x01,0xFF,0x80,0xFE,0x00,0x01,0x1F,0xFC,0xF6,
+0x00,0x01,0x08,0x1C,0xFC,0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x04,0xFC,0x00,0x02,
+0x07,0xFF,0xE0,0xFD,0x00,0x00,0x04,0xFC,0x00,0x02,0x1F,0xFF,0xF8,0xF7,0x00,0x02,
+0x3C,0x00,0x3C,0xFE,0x00,0x01,0x20,0x20,0xFC,0x00,0x02,0x60,0x00,0x04,0xFE,0x00,
+0x01,0x30,0x1C,0xFC,0x00,0x02,0x40,0x00,0x02,0xFE,0x00,0x01,0x38,0x0C,0xFC,0x00,
+0x02,0x40,0x00,0x02,0xFE,0x00,0x01,0x3C,0x04,0xFC,0x00,0x02,0x40,0x00,0x02,0xFE,
+0x00,0x01,0x2F,0x04,0xFC,0x00,0x02,0x20,0x00,0x06,0xFE,0x00,0x01,0x27,0x84,0xFC,
+0x00,0x02,0x3C,0x00,0x3C,0xFE,0x00,0x01,0x23,0xC4,0xFC,0x00,0x02,0x1F,0xFF,0xF8,
+0xFE,0x00,0x01,0x21,0xE4,0xFC,0x00,0x02,0x07,0xFF,0xE0,0xFE,0x00,0x01,0x30,0x74,
+0xFB,0x00,0x01,0xFF,0x80,0xFE,0x00,0x01,0x3C,0x3C,0xF6,0x00,0x01,0x04,0x1C,0xFA,
+0x00,0x00,0x0E,0xFD,0x00,0x00,0x0C,0xFA,0x00,0x00,0x0E,0xFD,0x00,0x00,0x04,0xFA,
+0x00,0x00,0x0E,0xFE,0x00,0x01,0x18,0x60,0xF6,0x00,0x01,0x3C,0xF0,0xF6,0x00,0x01,
+0x3F,0xF8,0xFC,0x00,0x02,0x40,0x0F,0x80,0xFE,0x00,0x01,0x3F,0xDC,0xFC,0x00,0x02,
+0x70,0x3F,0xE0,0xFE,0x00,0x01,0x31,0x84,0xFC,0x00,0x02,0x70,0x7C,0x18,0xFE,0x00,
+0x01,0x11,0x04,0xFC,0x00,0x02,0x70,0xF0,0x0C,0xFE,0x00,0x01,0x08,0x0C,0xFC,0x00,
+0x02,0x71,0xE0,0x04,0xFD,0x00,0x00,0x1C,0xFC,0x00,0x02,0x71,0xC0,0x06,0xFD,0x00,
+0x00,0x08,0xFC,0x00,0x02,0x73,0xC0,0x06,0xF7,0x00,0x02,0x33,0x80,0x06,0xF7,0x00,
+0x02,0x0F,0x80,0x0E,0xFE,0x00,0x01,0x38,0x04,0xFC,0x00,0x02,0x03,0x80,0x0E,0xFE,
+0x00,0x01,0x1F,0xE4,0xFB,0x00,0x01,0x80,0x0C,0xFE,0x00,0x01,0x1F,0xFC,0xF6,0x00,
+0x01,0x1F,0xFC,0xF6,0x00,0x01,0x08,0x1C,0xFC,0x00,0x02,0x40,0x0F,0x80,0xFD,0x00,
+0x00,0x04,0xFC,0x00,0x02,0x70,0x3F,0xE0,0xFD,0x00,0x00,0x04,0xFC,0x00,0x02,0x70,
+0x7C,0x18,0xF7,0x00,0x02,0x70,0xF0,0x0C,0xF7,0x00,0x02,0x71,0xE0,0x04,0xFE,0x00,
+0x00,0x08,0xFB,0x00,0x02,0x71,0xC0,0x06,0xFE,0x00,0x01,0x1E,0x18,0xFC,0x00,0x02,
+0x73,0xC0,0x06,0xFE,0x00,0x01,0x3F,0x0C,0xFC,0x00,0x02,0x33,0x80,0x06,0xFE,0x00,
+0x01,0x3F,0x8C,0xFC,0x00,0x02,0x0F,0x80,0x0E,0xFE,0x00,0x01,0x30,0xCC,0xFC,0x00,
+0x02,0x03,0x80,0x0E,0xFE,0x00,0x01,0x30,0x6C,0xFB,0x00,0x01,0x80,0x0C,0xFE,0x00,
+0x01,0x18,0x2C,0xF6,0x00,0x01,0x08,0x1C,0xF5,0x00,0x00,0x0C,0xF5,0x00,0x00,0x04,
+0xF6,0x00,0x01,0x1F,0xC0,0xF6,0x00,0x01,0x3F,0xF0,0xF6,0x00,0x01,0x27,0xF8,0xF6,
+0x00,0x01,0x20,0x1C,0xF6,0x00,0x01,0x3C,0x04,0xF6,0x00,0x01,0x1F,0xFC,0xF6,0x00,
+0x01,0x0F,0xFC,0xF6,0x00,0x01,0x23,0xF8,0xF6,0x00,0x00,0x20,0xF5,0x00,0x00,0x30,
+0xF5,0x00,0x00,0x2C,0xF5,0x00,0x00,0x03,0xF4,0x00,0x00,0xC0,0xFE,0x00,0x02,0x01,
+0xF0,0xC0,0xFB,0x00,0x00,0x20,0xFE,0x00,0x02,0x01,0xFF,0xC0,0xFC,0x00,0x01,0x21,
+0xF8,0xFD,0x00,0x01,0x7F,0xF8,0xFC,0x00,0x01,0x3F,0xFC,0xFD,0x00,0x01,0x2F,0xF8,
+0xFC,0x00,0x01,0x3F,0xE0,0xFD,0x00,0x01,0x10,0xF8,0xFC,0x00,0x00,0x3C,0xFC,0x00,
+0x01,0x0C,0xC0,0xFC,0x00,0x00,0x33,0xFC,0x00,0x01,0x02,0xC0,0xFC,0x00,0x01,0x20,
+0xC0,0xFD,0x00,0x01,0x01,0xC0,0xFB,0x00,0x00,0x20,0xFC,0x00,0x00,0x40,0xFC,0x00,
+0x01,0x20,0xF8,0xFD,0x00,0x00,0xFF,0xFB,0x00,0x01,0x2F,0xFC,0xFE,0x00,0x02,0x01,
+0xFF,0xE0,0xFC,0x00,0x01,0x3F,0xF0,0xFE,0x00,0x02,0x01,0x1F,0xF0,0xFC,0x00,0x07,
+0x3F,0x00,0x00,0x40,0x00,0x01,0x00,0x38,0xFC,0x00,0x07,0x30,0x00,0x00,0x40,0x00,
+0x01,0xE0,0x08,0xFC,0x00,0x07,0x20,0x00,0x00,0x7C,0x02,0x00,0xFF,0xC8,0xF9,0x00,
+0x04,0x7F,0xF2,0x00,0x3F,0xF8,0xF9,0x00,0x04,0x7F,0xFE,0x00,0x0F,0xE0,0xFC,0x00,
+0x04,0x38,0x20,0x00,0x43,0xFE,0xF9,0x00,0x07,0x30,0x1C,0x00,0x40,0x0E,0x01,0xF0,
+0x08,0xFC,0x00,0x07,0x20,0x0C,0x00,0x00,0x02,0x00,0xFF,0xC8,0xFC,0x00,0x07,0x24,
+0x04,0x00,0x18,0x02,0x00,0xFF,0xF8,0xFC,0x00,0x07,0x27,0xC4,0x00,0x3E,0x00,0x00,
+0xCF,0xF8,0xFC,0x00,0x07,0x21,0x04,0x00,0x7F,0x00,0x00,0x40,0x38,0xFC,0x00,0x07,
+0x39,0x04,0x00,0x67,0x80,0x00,0x00,0x08,0xFC,0x00,0x07,0x3F,0xE4,0x00,0x41,0x80,
+0x00,0x00,0x08,0xFC,0x00,0x04,0x3F,0xFC,0x00,0x40,0x80,0xF9,0x00,0x06,0x23,0xFC,
+0x00,0x7C,0x82,0x00,0x40,0xFB,0x00,0x07,0x20,0x1C,0x00,0x7F,0xF2,0x00,0x20,0x40,
+0xFB,0x00,0x06,0x04,0x00,0x7F,0xFE,0x00,0x10,0x80,0xFB,0x00,0x05,0x04,0x00,0x43,
+0xFE,0x00,0x09,0xFB,0x00,0x06,0x07,0xC0,0x00,0x40,0x0E,0x00,0x06,0xFB,0x00,0x06,
+0x1F,0xE0,0x00,0x00,0x02,0x00,0x0A,0xFB,0x00,0x06,0x1F,0xF0,0x00,0x00,0x02,0x00,
+0x31,0xFB,0x00,0x07,0x30,0x38,0x00,0x7C,0x30,0x00,0x40,0x80,0xFC,0x00,0x07,0x20,
+0x08,0x00,0x3C,0x78,0x00,0x00,0x40,0xFC,0x00,0x06,0x20,0x0C,0x00,0x40,0xFC,0x00,
+0x60,0xFB,0x00,0x07,0x20,0x04,0x00,0x41,0xFE,0x00,0xF8,0x70,0xFC,0x00,0x07,0x38,
+0x04,0x00,0x43,0xC2,0x01,0xFC,0x38,0xFC,0x00,0x07,0x3F,0xE4,0x00,0x7F,0x82,0x01,
+0xCE,0x38,0xFC,0x00,0x07,0x3F,0xFC,0x00,0x3F,0x02,0x01,0x81,0x38,0xFC,0x00,0x07,
+0x23,0xFC,0x00,0x1E,0x04,0x00,0x80,0xB8,0xFC,0x00,0x07,0x20,0x1C,0x00,0x00,0x3C,
+0x00,0xC0,0x78,0xFB,0x00,0x06,0x04,0x00,0x00,0x0E,0x00,0x60,0x78,0xFB,0x00,0x00,
+0x44,0xFC,0x00,0x00,0x18,0xFC,0x00,0x01,0x38,0x40,0xFC,0x00,0x00,0x08,0xFC,0x00,
+0x01,0x1C,0x60,0xFE,0x00,0x02,0x01,0xF0,0x08,0xFC,0x00,0x01,0x10,0x78,0xFD,0x00,
+0x01,0xFF,0xC8,0xFC,0x00,0x01,0x20,0x78,0xFD,0x00,0x01,0xFF,0xF8,0xFC,0x00,0x01,
+0x20,0x5C,0xFD,0x00,0x01,0xCF,0xF8,0xFC,0x00,0x01,0x20,0x44,0xFD,0x00,0x01,0x40,
+0x38,0xFC,0x00,0x01,0x20,0x04,0xFC,0x00,0x00,0x08,0xFC,0x00,0x01,0x30,0x04,0xFC,
+0x00,0x00,0x08,0xFC,0x00,0x01,0x18,0x04,0xF6,0x00,0x01,0x1C,0x0C,0xFD,0x00,0x00,
+0x60,0xFB,0x00,0x01,0x0F,0xF8,0xFD,0x00,0x01,0xF8,0x70,0xFC,0x00,0x01,0x07,0xF8,
+0xFE,0x00,0x02,0x01,0xFC,0x38,0xFC,0x00,0x01,0x01,0xE0,0xFE,0x00,0x02,0x01,0xCE,
+0x38,0xF7,0x00,0x02,0x01,0x81,0x38,0xF6,0x00,0x01,0x80,0xB8,0xF6,0x00,0x01,0xC0,
+0x78,0xF6,0x00,0x01,0x60,0x78,0xF5,0x00,0x00,0x18,0xF5,0x00,0x00,0x08,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xB0,0x00,
+};
+
+// BitmapExample3 : 2756 bytes, packed 978
+const unsigned char BitmapExample3_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xF4,0xFF,
+0x00,0xE3,0xF5,0xFF,0x01,0x03,0x3F,0xF7,0xFF,0x02,0xFE,0x03,0x1F,0xF7,0xFF,0x02,
+0xFC,0x73,0x8F,0xFB,0xFF,0x00,0xEF,0xFE,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,
+0xFC,0x0F,0xFE,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,
+0xFC,0xF3,0xCF,0xFC,0xFF,0x00,0xFB,0xFD,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,
+0xFD,0xEF,0xFE,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,0xFC,0x0F,0xFE,0xFF,0x02,
+0xFC,0x73,0x8F,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,0xFE,0x00,0x1F,0xFC,0xFF,
+0x00,0xFB,0xFC,0xFF,0x01,0x00,0x3F,0xFC,0xFF,0x01,0xFD,0xEF,0xFD,0xFF,0x01,0xC0,
+0x7F,0xFC,0xFF,0x01,0xF8,0x0F,0xF6,0xFF,0x01,0xFD,0xEF,0xF1,0xFF,0x02,0xFC,0xFF,
+0xCF,0xFC,0xFF,0x01,0xFC,0x1F,0xFE,0xFF,0x02,0xFC,0x3F,0xCF,0xFC,0xFF,0x01,0xFB,
+0xEF,0xFE,0xFF,0x02,0xFC,0x1F,0xCF,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,0xFC,
+0x0F,0xCF,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,0xFC,0xC7,0xCF,0xFC,0xFF,0x01,
+0xFC,0x1F,0xFE,0xFF,0x02,0xFC,0xE3,0xCF,0xF7,0xFF,0x02,0xFC,0xF1,0xCF,0xF7,0xFF,
+0x02,0xFC,0xF8,0xCF,0xFC,0xFF,0x01,0xFD,0xDF,0xFE,0xFF,0x02,0xFC,0xFC,0x0F,0xFC,
+0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,0xFC,0xFE,0x0F,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,
+0xFF,0x02,0xFC,0xFF,0x0F,0xFC,0xFF,0x01,0xFB,0xEF,0xFC,0xFF,0x00,0xCF,0xFC,0xFF,
+0x01,0xFC,0x1F,0xE4,0xFF,0x02,0x9C,0x00,0x0F,0xF7,0xFF,0x02,0x8C,0x00,0x0F,0xFB,
+0xFF,0x00,0xEF,0xFE,0xFF,0x02,0x9C,0x00,0x0F,0xEF,0xFF,0x01,0xFC,0xDF,0xF6,0xFF,
+0x01,0xFA,0xEF,0xFE,0xFF,0x02,0xFC,0xFF,0xCF,0xFC,0xFF,0x01,0xFA,0xEF,0xFE,0xFF,
+0x02,0xFC,0xFF,0xCF,0xFC,0xFF,0x01,0xFA,0xEF,0xFE,0xFF,0x02,0xC0,0x00,0x0F,0xFC,
+0xFF,0x01,0xFC,0x1F,0xFE,0xFF,0x02,0xC0,0x00,0x0F,0xF7,0xFF,0x02,0xE0,0x00,0x1F,
+0xFC,0xFF,0x01,0xFB,0xCF,0xFE,0xFF,0x00,0xFC,0xFA,0xFF,0x01,0xF9,0xEF,0xF6,0xFF,
+0x01,0xFA,0xEF,0xF6,0xFF,0x01,0xFB,0x2F,0xFD,0xFF,0x01,0xC3,0x7F,0xFC,0xFF,0x01,
+0xFB,0xCF,0xFD,0xFF,0x01,0x03,0x1F,0xFC,0xFF,0x01,0xF9,0xEF,0xFE,0xFF,0x02,0xFE,
+0x03,0x0F,0xFB,0xFF,0x00,0xEF,0xFE,0xFF,0x02,0xFC,0x73,0x8F,0xFC,0xFF,0x01,0xD8,
+0x0F,0xFE,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,0xFD,0xEF,0xFE,0xFF,0x02,0xFC,
+0xF3,0xCF,0xFB,0xFF,0x00,0xDF,0xFE,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,0xFB,
+0xEF,0xFE,0xFF,0x02,0xFC,0xF3,0xCF,0xFC,0xFF,0x01,0xE0,0x0F,0xFE,0xFF,0x02,0xFC,
+0x73,0xCF,0xFC,0xFF,0x00,0xFB,0xFD,0xFF,0x02,0xFE,0x33,0x0F,0xFC,0xFF,0x01,0xFC,
+0xDF,0xFE,0xFF,0x02,0xFE,0x00,0x1F,0xFC,0xFF,0x01,0xFA,0xEF,0xFD,0xFF,0x01,0x00,
+0x3F,0xFC,0xFF,0x01,0xFA,0xEF,0xFD,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0xFA,0xEF,0xF6,
+0xFF,0x01,0xFC,0x1F,0xF0,0xFF,0x01,0x80,0x7F,0xF6,0xFF,0x01,0x00,0x3F,0xFC,0xFF,
+0x01,0xFC,0x1F,0xFE,0xFF,0x02,0xFE,0x1E,0x1F,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,
+0x02,0xFC,0x7F,0x8F,0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,0xFC,0xFF,0xCF,0xFC,
+0xFF,0x01,0xFD,0xDD,0xFE,0xFF,0x02,0xFC,0xFF,0xCF,0xFC,0xFF,0x01,0xF8,0x01,0xFE,
+0xFF,0x02,0xFC,0xFF,0xCF,0xFC,0xFF,0x01,0xFD,0xFD,0xFE,0xFF,0x02,0xFC,0xFF,0xCF,
+0xFC,0xFF,0x01,0xFB,0xEF,0xFE,0xFF,0x02,0xFE,0x7F,0x8F,0xFC,0xFF,0x01,0xF9,0xCF,
+0xFE,0xFF,0x03,0xFE,0x1E,0x0F,0x7F,0xFD,0xFF,0x01,0xFA,0xAF,0xFE,0xFF,0x03,0xFC,
+0x00,0x00,0x7F,0xFC,0xFF,0x00,0x7F,0xFE,0xFF,0x03,0xFC,0x00,0x00,0x7F,0xFD,0xFF,
+0x01,0xFA,0xAF,0xF6,0xFF,0x01,0xF9,0xCF,0xF6,0xFF,0x01,0xFB,0xEF,0xFC,0xFF,0x00,
+0xEF,0xF7,0xFF,0x02,0xBF,0xFF,0xCF,0xF7,0xFF,0x02,0x8F,0xFF,0x0F,0xFB,0xFF,0x00,
+0xEF,0xFE,0xFF,0x02,0x87,0xFE,0x1F,0xF7,0xFF,0x02,0xC3,0xFC,0x3F,0xFC,0xFF,0x00,
+0xFB,0xFD,0xFF,0x02,0xF0,0xF0,0x7F,0xFC,0xFF,0x00,0xF8,0xFD,0xFF,0x01,0xF8,0x61,
+0xFB,0xFF,0x01,0xFB,0x3F,0xFE,0xFF,0x01,0xFC,0x03,0xFA,0xFF,0x00,0xCF,0xFD,0xFF,
+0x00,0x0F,0xFB,0xFF,0x01,0xFB,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFB,0xFF,0x00,0xF8,
+0xFD,0xFF,0x01,0xF8,0x61,0xFB,0xFF,0x01,0xFB,0x3F,0xFE,0xFF,0x01,0xF0,0xF0,0xFA,
+0xFF,0x00,0xCF,0xFE,0xFF,0x02,0xC1,0xF8,0x7F,0xFC,0xFF,0x01,0xFB,0x1F,0xFE,0xFF,
+0x02,0x87,0xFE,0x1F,0xFC,0xFF,0x00,0xF8,0xFD,0xFF,0x02,0x8F,0xFF,0x0F,0xFC,0xFF,
+0x00,0xFB,0xFD,0xFF,0x02,0xBF,0xFF,0x8F,0xFC,0xFF,0x00,0xFB,0xFB,0xFF,0x00,0xEF,
+0xFC,0xFF,0x00,0xF8,0xF5,0xFF,0x01,0xFB,0x3F,0xF5,0xFF,0x00,0xCF,0xFE,0xFF,0x02,
+0x8F,0x8F,0x1F,0xFC,0xFF,0x01,0xFB,0x1F,0xFE,0xFF,0x02,0x07,0x06,0x0F,0xFC,0xFF,
+0x00,0xF8,0xFD,0xFF,0x02,0x07,0x06,0x0F,0xFC,0xFF,0x01,0xFB,0x3F,0xFE,0xFF,0x02,
+0x07,0x06,0x0F,0xFB,0xFF,0x00,0xCF,0xFE,0xFF,0x02,0x8F,0x8F,0x1F,0xFC,0xFF,0x01,
+0xFB,0x1F,0xF6,0xFF,0x00,0xF8,0xF5,0xFF,0x00,0xFB,0xF5,0xFF,0x00,0xFB,0xFD,0xFF,
+0x02,0x8F,0x8F,0x1F,0xFC,0xFF,0x00,0xF8,0xFD,0xFF,0x02,0x07,0x06,0x0F,0xFC,0xFF,
+0x01,0xFB,0x3F,0xFE,0xFF,0x02,0x07,0x06,0x0F,0xFB,0xFF,0x00,0xCF,0xFE,0xFF,0x02,
+0x07,0x06,0x0F,0xFC,0xFF,0x01,0xFB,0x1F,0xFE,0xFF,0x02,0x8F,0x8F,0x1F,0xFC,0xFF,
+0x00,0xF8,0xF5,0xFF,0x01,0xFB,0x3F,0xF5,0xFF,0x00,0xCF,0xF6,0xFF,0x01,0xFB,0x1F,
+0xFE,0xFF,0x02,0x8F,0x8F,0x1F,0xFC,0xFF,0x00,0xF8,0xFD,0xFF,0x02,0x07,0x06,0x0F,
+0xFC,0xFF,0x00,0xFB,0xFD,0xFF,0x02,0x07,0x06,0x0F,0xF7,0xFF,0x02,0x07,0x06,0x0F,
+0xF7,0xFF,0x02,0x8F,0x8F,0x1F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0xE2,0xFF,
+};
+
+// BitmapExample4 : 2756 bytes, packed 2274
+const unsigned char BitmapExample4_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,
+0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,
+0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,
+0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,
+0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,
+0xFE,0x00,0xFA,0xFF,0x02,0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF0,0x07,0xFF,
+0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF7,0x77,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,
+0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0xFA,0xFF,
+0x02,0x0F,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,
+0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF8,0x07,0xFF,0x80,0xFE,0x00,0xFB,0xFF,
+0x03,0xFE,0xFF,0xFF,0x80,0xFE,0x00,0xFA,0xFF,0x02,0xEF,0xFF,0x80,0xFE,0x00,0xFA,
+0xFF,0x02,0xF7,0xFF,0x80,0xFE,0x00,0xFA,0xFF,0x02,0xF7,0xFF,0x80,0xFE,0x00,0xFA,
+0xFF,0x02,0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF7,0xF7,0xFF,0x80,0xFE,0x00,
+0xFB,0xFF,0x03,0xF0,0x07,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF7,0xF7,0xFF,0x80,
+0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,
+0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xF7,0xFF,
+0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF8,0x07,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,
+0xFF,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xFF,0xFF,0x80,0xFE,0x00,0xFB,0xFF,
+0x03,0xFE,0x7F,0xFF,0x80,0xFE,0x00,0xFA,0xFF,0x02,0x9F,0xFF,0x80,0xFE,0x00,0xFA,
+0xFF,0x02,0xE7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0x9F,0xFF,0x80,0xFE,0x00,
+0xFB,0xFF,0x03,0xFE,0x7F,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xFF,0xFF,0x80,
+0xFE,0x00,0xFB,0xFF,0x03,0xF8,0xFF,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF7,0x7F,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0x7F,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0x77,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x04,0x3F,0xF0,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x04,0x3F,0xF7,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,
+0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x04,0x3F,0xFE,0x4F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xFE,0xD7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xB7,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x27,0xFF,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xFF,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,
+0x3F,0xFE,0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x77,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0x07,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,
+0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x04,0x3F,0xFF,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xF6,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xF8,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,
+0x3F,0xFE,0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xF7,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0x07,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x04,0x3F,0xFE,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,
+0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xF7,0xFF,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF0,0x07,0xFF,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,
+0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF3,0x8F,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0x77,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0x77,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x04,0x3F,0xF6,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x04,0x3F,0xF9,0xE7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,
+0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x04,0x3F,0xFE,0x7F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xFE,0x8F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xF3,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xCD,0xFF,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0x3E,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xFE,0xFE,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,
+0x3F,0xFE,0xF9,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0x36,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xD6,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xD6,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x29,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,
+0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xFF,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF0,0x07,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0xF7,0xFF,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,
+0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x04,0x3F,0xFF,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x04,0x3F,0xFF,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,
+0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x77,0xFF,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0x07,0xFF,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x04,0x3F,0xFF,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xFF,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xFF,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x77,0xFF,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF0,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xF7,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,
+0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0x6F,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,
+0x2F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xB7,0xFF,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xB7,0xFF,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,
+0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,
+0xF3,0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0xFF,0xFF,
+0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF7,0xF7,0xFF,0x80,0xFE,0x00,
+0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF0,0x07,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,
+0xFE,0x00,0x04,0x3F,0xF7,0xF7,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,
+0x3F,0xF7,0xFF,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xF3,0xFF,
+0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,
+0x00,0x01,0xFF,0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,
+0xFC,0xFE,0x00,0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,
+0x00,0x3F,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,
+0x2F,0xFF,0x80,0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xB7,0xFF,0x80,
+0xFE,0x00,0x01,0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFE,0xB7,0xFF,0x80,0xFE,0x00,0x01,
+0xFF,0xFC,0xFE,0x00,0x04,0x3F,0xFF,0x0F,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,
+0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xE7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0x77,
+0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0x97,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,
+0xFE,0xE7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0x77,0xFF,0x80,0xFE,0x00,0xFA,
+0xFF,0x02,0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF6,0x07,0xFF,0x80,0xFE,0x00,
+0xFB,0xFF,0x03,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xFB,
+0xFF,0x03,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF8,0x07,0xFF,0x80,0xFE,
+0x00,0xFB,0xFF,0x03,0xFE,0xFF,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,
+0xFA,0xFF,0x02,0x2F,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xB7,0xFF,0x80,0xFE,
+0x00,0xFB,0xFF,0x03,0xFE,0xB7,0xFF,0x80,0xFE,0x00,0xFA,0xFF,0x02,0x0F,0xFF,0x80,
+0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xFA,0xFF,0x02,0x0F,0xFF,0x80,0xFE,0x00,
+0xFB,0xFF,0x03,0xFE,0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xF7,0xFF,0x80,
+0xFE,0x00,0xFA,0xFF,0x02,0x6E,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0x00,0xFF,
+0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xFE,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,
+0xFE,0x00,0xFB,0xFF,0x03,0xF7,0xF7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF3,0xE7,
+0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF5,0xD7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,
+0xFE,0x3F,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xFE,0xBF,0xFF,0x80,0xFE,0x00,0xFB,
+0xFF,0x03,0xF5,0xD7,0xFF,0x80,0xFE,0x00,0xFB,0xFF,0x03,0xF3,0xE7,0xFF,0x80,0xFE,
+0x00,0xFB,0xFF,0x03,0xF7,0xF7,0xFF,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,
+0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,
+0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,
+0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,
+0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,0xFE,0x00,0xF8,0xFF,0x00,0x80,
+0xFE,0x00,
+};
+
+// BitmapWaveshare_black : 2756 bytes, packed 2204
+const unsigned char BitmapWaveshare_black_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0xB0,0xFF,0x00,0xBF,0xF5,0xFF,0x00,0xCF,0xF5,0xFF,0x00,0xE0,
+0xF5,0xFF,0x01,0xF8,0x3F,0xF6,0xFF,0x01,0xFE,0x0F,0xF5,0xFF,0x00,0x07,0xF8,0xFF,
+0x03,0xE7,0xFF,0xFF,0xC3,0xF8,0xFF,0x04,0xC7,0xFF,0xFF,0xC0,0x3F,0xF9,0xFF,0x04,
+0xE7,0xFF,0xFF,0xE0,0x0F,0xF9,0xFF,0x04,0xE7,0xFF,0xFF,0xF0,0x07,0xF9,0xFF,0x04,
+0xE7,0xFF,0xFF,0xF8,0x07,0xF9,0xFF,0x04,0xE7,0xFF,0xFF,0xFC,0x03,0xF9,0xFF,0x04,
+0xE7,0xFF,0xFF,0xFE,0x01,0xF9,0xFF,0x00,0xE7,0xFE,0xFF,0x00,0x00,0xF9,0xFF,0x00,
+0xE7,0xFE,0xFF,0x00,0x80,0xF9,0xFF,0x00,0xE7,0xFE,0xFF,0x00,0xC0,0xF9,0xFF,0x00,
+0xE7,0xFE,0xFF,0x00,0xC0,0xF9,0xFF,0x00,0xE7,0xFE,0xFF,0x01,0xE0,0x7F,0xFA,0xFF,
+0x00,0xE7,0xFE,0xFF,0x01,0xE0,0x7F,0xFA,0xFF,0x00,0xE7,0xFE,0xFF,0x01,0xE0,0x7F,
+0xFA,0xFF,0x00,0xE7,0xFE,0xFF,0x01,0xF0,0x7F,0xFA,0xFF,0x00,0xE7,0xFE,0xFF,0x01,
+0xF0,0x7F,0xFA,0xFF,0x00,0xE7,0xFE,0xFF,0x02,0xF0,0x7F,0xDF,0xFB,0xFF,0x00,0xE7,
+0xFE,0xFF,0x02,0xF0,0x7F,0xBF,0xFB,0xFF,0x00,0xE7,0xFE,0xFF,0x02,0xF0,0x7E,0x7F,
+0xFB,0xFF,0x00,0xE7,0xFE,0xFF,0x02,0xF0,0x7E,0x7F,0xFB,0xFF,0x00,0xE7,0xFE,0xFF,
+0x01,0xF0,0x7C,0xFA,0xFF,0x00,0xE7,0xFE,0xFF,0x01,0xF0,0x7D,0xFA,0xFF,0x05,0xE7,
+0xFF,0xFC,0x03,0xE0,0xFD,0xFA,0xFF,0x05,0xE7,0xFF,0xF8,0x00,0xE0,0x79,0xFA,0xFF,
+0x04,0xE7,0xFF,0xF0,0x00,0x60,0xF9,0xFF,0x07,0xE7,0xFF,0xE0,0x00,0x30,0xF8,0x00,
+0x1F,0xFC,0xFF,0x07,0xE7,0xFF,0xC0,0x60,0x11,0x80,0x00,0x1F,0xFC,0xFF,0x07,0xE7,
+0xFF,0x00,0x30,0x19,0x00,0x00,0x1F,0xFC,0xFF,0x06,0xE7,0xFE,0x40,0x20,0x08,0x00,
+0x00,0xFB,0xFF,0x06,0xE7,0xC1,0xC0,0x00,0x08,0x00,0x7F,0xFB,0xFF,0x05,0xE7,0x80,
+0xC0,0x20,0x08,0x00,0xFA,0xFF,0x05,0xE7,0x00,0x4C,0x20,0x08,0x07,0xFA,0xFF,0x05,
+0xE6,0x10,0x04,0x20,0x00,0x1D,0xFA,0xFF,0x07,0xE6,0x10,0x04,0x20,0x40,0x7C,0xFF,
+0xF9,0xFC,0xFF,0x08,0xE4,0x10,0x00,0x00,0x80,0xFC,0xFF,0xE0,0x7F,0xFD,0xFF,0x08,
+0xE4,0x0C,0x00,0x03,0x0F,0xFC,0x7F,0xE4,0x3F,0xFD,0xFF,0x08,0xE4,0x0E,0x00,0xC0,
+0x1F,0xFC,0x7F,0xC0,0x1F,0xFD,0xFF,0x08,0xE4,0x0B,0x83,0xE0,0x0F,0xFC,0x7F,0xC2,
+0x1F,0xFD,0xFF,0x08,0xE6,0x00,0x07,0xF0,0x0F,0xFE,0x7F,0xC1,0x0F,0xFD,0xFF,0x08,
+0xE6,0x00,0x07,0xF0,0x07,0xFE,0x7F,0xC0,0x8F,0xFD,0xFF,0x08,0xE7,0x00,0x07,0xF0,
+0x03,0xFE,0x7F,0xE0,0x7F,0xFD,0xFF,0x08,0xE7,0x80,0x03,0xF3,0x01,0xFE,0x7F,0xE0,
+0x1F,0xFD,0xFF,0x08,0xE7,0xC0,0x03,0xE3,0x80,0xFE,0x7F,0xF0,0x1F,0xFD,0xFF,0x08,
+0xE7,0xF8,0x00,0xC0,0xE0,0xFC,0x7F,0xF0,0x87,0xFD,0xFF,0x08,0xE7,0xF7,0x00,0x00,
+0x3C,0xFC,0x7F,0xF0,0x83,0xFD,0xFF,0x08,0xE7,0xF9,0x80,0x00,0x18,0xFC,0xFF,0xF0,
+0x81,0xFD,0xFF,0x08,0xE7,0x9D,0x80,0x04,0x00,0xFC,0xFF,0xF1,0xC1,0xFD,0xFF,0x08,
+0xE6,0x35,0x01,0x04,0x00,0xFD,0xFF,0xF3,0x71,0xFD,0xFF,0x08,0xE6,0x62,0x02,0x00,
+0x00,0xFD,0xFF,0xE2,0x01,0xFD,0xFF,0x08,0xE4,0xC2,0x02,0x00,0x00,0xFB,0xFF,0xE2,
+0x01,0xFD,0xFF,0x08,0xE5,0x82,0x02,0x00,0x01,0xF3,0xFF,0xE0,0x01,0xFD,0xFF,0x08,
+0xE3,0x01,0x0E,0x00,0x03,0xF3,0xFF,0xE4,0x01,0xFD,0xFF,0x08,0xE6,0x01,0x83,0x00,
+0x7F,0xE7,0xFF,0xC0,0x00,0xFD,0xFF,0x09,0xE4,0x01,0x81,0x00,0xFF,0xCF,0xFF,0xE0,
+0x00,0x3F,0xFE,0xFF,0x09,0xE0,0x01,0x80,0x00,0xFF,0x8F,0xFF,0xE0,0x00,0x1F,0xFE,
+0xFF,0x09,0xE0,0x03,0xC0,0x01,0xFF,0x9F,0xFF,0xE0,0x01,0x1F,0xFE,0xFF,0x09,0xE0,
+0x0F,0xF8,0x01,0xFF,0xDF,0xFF,0xFC,0x16,0x1F,0xFE,0xFF,0x09,0xE0,0x1F,0xF0,0xC7,
+0xF8,0x3F,0xFF,0xF6,0x1F,0x1F,0xFE,0xFF,0x09,0xE0,0x3F,0xC0,0x6F,0xF0,0x1F,0xFF,
+0xE2,0x01,0x1F,0xFE,0xFF,0x09,0xE0,0x7F,0xC0,0x3F,0xC0,0x0F,0xFF,0xCC,0x00,0x9F,
+0xFE,0xFF,0x09,0xE0,0xFF,0xC0,0x1F,0xC0,0x0F,0xFF,0xDE,0x00,0x19,0xFE,0xFF,0x09,
+0xE0,0xFF,0x80,0x0F,0x80,0x0F,0xFF,0x9F,0x00,0x00,0xFE,0xFF,0x09,0xE1,0xFF,0x80,
+0x40,0x00,0x07,0xFF,0x9F,0xFE,0x00,0xFE,0xFF,0x3D,0xF3,0xFF,0x80,0xC0,0x00,0x07,
+0xFF,0xBF,0xFF,0x00,0x7F,0xFF,0xFF,0xE7,0xFF,0xC0,0x80,0x00,0x07,0xFF,0xBF,0xFF,
+0x90,0x7F,0xFF,0xFF,0xE7,0xFF,0xC7,0x80,0x00,0x0F,0xFF,0xBF,0xFF,0xD8,0x7F,0xFF,
+0xFF,0xE7,0xFF,0xE0,0xC0,0x00,0x3F,0xFF,0x3F,0xFF,0xE0,0x7F,0xFF,0xFF,0xE7,0xFF,
+0xE0,0xC0,0x00,0x1F,0xFF,0x3F,0xFF,0xF0,0xFE,0xFF,0x07,0xE7,0xFF,0xF0,0x20,0x80,
+0x07,0xFF,0x3F,0xFC,0xFF,0x07,0xE7,0xFF,0xE0,0x30,0x00,0x03,0xFF,0x7F,0xFC,0xFF,
+0x07,0xE7,0xFF,0xC0,0x30,0x40,0x03,0xFF,0x3F,0xFC,0xFF,0x07,0xE7,0xFC,0x40,0x10,
+0x60,0x03,0xFF,0x7F,0xFC,0xFF,0x07,0xE7,0xE0,0xC0,0x18,0x3C,0x07,0xFE,0x7F,0xFC,
+0xFF,0x07,0xE7,0x87,0xC0,0x08,0x18,0x0F,0xFC,0x7F,0xFC,0xFF,0x06,0xF7,0x0F,0xE0,
+0x08,0x10,0x1F,0xFC,0xFB,0xFF,0x06,0xF6,0x7F,0xFE,0x0C,0x10,0x43,0xF9,0xFB,0xFF,
+0x06,0xF0,0xFF,0xF1,0x04,0x10,0x81,0xF3,0xFB,0xFF,0x06,0xF1,0xFF,0xE1,0x04,0x11,
+0x81,0xE3,0xFB,0xFF,0x06,0xF3,0xFF,0xC0,0x06,0x11,0x80,0x4F,0xFB,0xFF,0x06,0xF3,
+0xFF,0xC0,0x02,0x10,0x00,0x7F,0xFB,0xFF,0x06,0xF7,0xFF,0xC0,0x22,0x10,0x08,0x7F,
+0xFB,0xFF,0x06,0xF7,0xFF,0xC0,0x3A,0x30,0x0C,0x7F,0xFB,0xFF,0x06,0xF7,0xFF,0xC2,
+0x18,0x00,0x0C,0x7F,0xFB,0xFF,0x06,0xF7,0xFF,0xC3,0x10,0x00,0x1C,0x7F,0xFB,0xFF,
+0x06,0xF7,0xFF,0xC1,0x80,0x00,0x60,0x7F,0xFB,0xFF,0x06,0xF7,0xFF,0x80,0xC0,0x00,
+0xC0,0x3F,0xFB,0xFF,0x06,0xF7,0xFF,0x80,0xC0,0x01,0x80,0x3F,0xFB,0xFF,0x06,0xF7,
+0xF0,0x00,0x30,0x00,0x00,0x1F,0xFB,0xFF,0x06,0xF7,0x03,0xE0,0x00,0xE0,0x00,0x1F,
+0xFB,0xFF,0x06,0xF6,0x0F,0xF0,0x01,0xF0,0x02,0x3F,0xFB,0xFF,0x06,0xF0,0xFF,0xF8,
+0x03,0xF8,0x3C,0x3F,0xFB,0xFF,0x06,0xF1,0xE0,0x04,0x07,0xF8,0x00,0x7F,0xFB,0xFF,
+0x05,0xF3,0x80,0x02,0x07,0xF8,0x00,0xFA,0xFF,0x05,0xF6,0x0F,0xFE,0x07,0xF8,0x01,
+0xFA,0xFF,0x06,0xF0,0x7F,0xFC,0x03,0xF8,0x03,0xBF,0xFB,0xFF,0x06,0xF1,0xE0,0x10,
+0x21,0xF0,0x03,0x27,0xFB,0xFF,0x06,0xF3,0x07,0xC0,0xC0,0x60,0x81,0x91,0xFB,0xFF,
+0x06,0xF0,0x3F,0xC1,0x00,0x00,0xC1,0xD8,0xFB,0xFF,0x07,0xF0,0x7F,0x87,0x04,0x00,
+0x60,0x4C,0x3F,0xFC,0xFF,0x07,0xF3,0xFF,0x86,0x0C,0x00,0x20,0x4F,0x3F,0xFC,0xFF,
+0x06,0xF7,0xFF,0x80,0x18,0x08,0x10,0x0F,0xFB,0xFF,0x06,0xF7,0xFF,0xC0,0x18,0x08,
+0x08,0x0F,0xFB,0xFF,0x06,0xF7,0xFF,0xC0,0x10,0x4C,0x0F,0x1F,0xFB,0xFF,0x06,0xF7,
+0x00,0x40,0x00,0x44,0x0C,0x3F,0xFB,0xFF,0x06,0xF0,0x00,0x00,0x0C,0x46,0x0C,0x3F,
+0xFB,0xFF,0x06,0xF0,0x00,0x30,0x1C,0xC6,0x0C,0x3F,0xFB,0xFF,0x06,0xF1,0xFF,0xF8,
+0xF8,0xC6,0x0C,0x3F,0xFB,0xFF,0x06,0xF0,0x00,0x1C,0x00,0xC6,0x0C,0x3F,0xFB,0xFF,
+0x06,0xF0,0x00,0x0C,0x00,0xC3,0x00,0x3F,0xFB,0xFF,0x06,0xF3,0x80,0x18,0x00,0xC3,
+0x00,0x3F,0xFB,0xFF,0x06,0xF7,0xFF,0x70,0x00,0xC1,0x00,0x3F,0xFB,0xFF,0x06,0xF7,
+0xFF,0xE0,0x00,0xC3,0x80,0x7F,0xFB,0xFF,0x05,0xF3,0xFF,0xC0,0x00,0xC7,0x0F,0xFA,
+0xFF,0x06,0xF1,0xFF,0x80,0x00,0xC6,0x07,0x9F,0xFB,0xFF,0x06,0xF0,0x7F,0xC0,0x08,
+0xC4,0x03,0x0F,0xFB,0xFF,0x06,0xF0,0x0F,0xC0,0x18,0xC0,0x03,0x47,0xFB,0xFF,0x06,
+0xF3,0x83,0x80,0x20,0xC0,0x02,0x39,0xFB,0xFF,0x07,0xF0,0xE0,0xC0,0x00,0xC0,0x02,
+0x0C,0x7F,0xFC,0xFF,0x07,0xF0,0x1C,0x40,0x43,0x70,0xFC,0x03,0x3F,0xFC,0xFF,0x07,
+0xF0,0x0F,0x20,0xC2,0x31,0xEC,0x03,0x8F,0xFC,0xFF,0x07,0xF0,0x03,0x9F,0xC4,0x03,
+0xFF,0x00,0xC7,0xFC,0xFF,0x07,0xF0,0x00,0x6F,0xE0,0x07,0x3F,0x80,0x63,0xFC,0xFF,
+0x07,0xF7,0x00,0x31,0xE0,0x04,0xFF,0xC0,0x31,0xFC,0xFF,0x07,0xF7,0xE0,0x18,0xF0,
+0x01,0xFF,0xF0,0x1C,0xFC,0xFF,0x08,0xF7,0xF8,0x0E,0x30,0x0B,0xFF,0xF0,0x0C,0x7F,
+0xFD,0xFF,0x08,0xF7,0xFC,0x07,0x18,0x1F,0xFF,0xFC,0x0F,0x3F,0xFD,0xFF,0x08,0xF3,
+0xFE,0x07,0x1C,0x3F,0xFF,0xFE,0x07,0x9F,0xFD,0xFF,0x03,0xF3,0xFF,0x83,0xCF,0xFE,
+0xFF,0x01,0x03,0x8F,0xFD,0xFF,0x03,0xF3,0xFF,0xC3,0xE7,0xFE,0xFF,0x01,0x83,0xE7,
+0xFD,0xFF,0x03,0xF3,0xFF,0xC1,0xF7,0xFE,0xFF,0x01,0x81,0xE3,0xFD,0xFF,0x03,0xF3,
+0xFF,0xE1,0xF3,0xFE,0xFF,0x01,0xC1,0xF1,0xFD,0xFF,0x03,0xF3,0xFF,0xE0,0xFB,0xFE,
+0xFF,0x01,0xE0,0xF9,0xFD,0xFF,0x03,0xF3,0xFF,0xF0,0xF9,0xFE,0xFF,0x01,0xF0,0xFC,
+0xFD,0xFF,0x03,0xF3,0xFF,0xF8,0xFD,0xFE,0xFF,0x01,0xF8,0xFE,0xFD,0xFF,0x03,0xF3,
+0xFF,0xF8,0x7C,0xFE,0xFF,0x02,0xFC,0x7F,0x7F,0xFE,0xFF,0x09,0xF3,0xFF,0xFC,0x7C,
+0x7F,0xFF,0xFF,0xFE,0x7F,0x3F,0xFE,0xFF,0x04,0xF3,0xFF,0xFC,0x3E,0x7F,0xFE,0xFF,
+0x01,0x7F,0xBF,0xFE,0xFF,0x04,0xF3,0xFF,0xFE,0x3E,0x3F,0xFD,0xFF,0x00,0xDF,0xFE,
+0xFF,0x04,0xF3,0xFF,0xFE,0x3F,0x3F,0xFD,0xFF,0x00,0xCF,0xFE,0xFF,0x05,0xF3,0xFF,
+0xFF,0x3F,0x3F,0xF0,0xFE,0xFF,0x00,0xEF,0xFE,0xFF,0x09,0xF3,0xFF,0xFE,0x3F,0xBF,
+0xF0,0x03,0xFF,0xFF,0xC7,0xFE,0xFF,0x09,0xF3,0xFF,0xFE,0x3F,0xBF,0xE0,0x01,0xFF,
+0xFF,0xE7,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0x3F,0x9F,0xE0,0x00,0xFF,0xFF,0xE7,0xFE,
+0xFF,0x09,0xF3,0xFF,0xFF,0x3F,0xDF,0xF0,0x00,0x7F,0xFF,0xF3,0xFE,0xFF,0x09,0xF3,
+0xFF,0xFF,0x3F,0xDF,0xFB,0x00,0x7F,0xFF,0xF3,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0x3F,
+0xDF,0xF0,0x00,0x7F,0xFF,0xFB,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0x7F,0xDF,0xC0,0x10,
+0x3F,0xFF,0xFB,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x05,0xDF,0xC0,0x10,0x3F,0xFF,0xFB,
+0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x05,0xDF,0xC0,0x10,0x1F,0xFF,0xFB,0xFE,0xFF,0x00,
+0xF3,0xFE,0xFF,0x05,0xDF,0xC1,0xF8,0x1F,0xFF,0xFB,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,
+0x05,0xDF,0xC0,0x0C,0x0F,0xFF,0xFB,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x05,0xDF,0xE0,
+0x06,0x03,0xFF,0xF3,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x05,0xDF,0xE0,0x03,0x00,0x1F,
+0xF3,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x05,0xDF,0xF8,0x01,0xC0,0x03,0xE7,0xFE,0xFF,
+0x00,0xF3,0xFE,0xFF,0x05,0xDF,0xFC,0x00,0x7F,0x01,0xE7,0xFE,0xFF,0x00,0xF3,0xFE,
+0xFF,0x05,0xDF,0xFC,0x00,0x3F,0xC0,0xC7,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x01,0xDF,
+0xFC,0xFE,0x00,0x00,0xEF,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x01,0xDF,0xFC,0xFE,0x00,
+0x00,0xDF,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x01,0xDF,0xFC,0xFE,0x00,0x00,0xDF,0xFE,
+0xFF,0x00,0xF3,0xFE,0xFF,0x01,0x9F,0xFE,0xFE,0x00,0xFD,0xFF,0x00,0xF3,0xFE,0xFF,
+0x04,0x1F,0xFF,0x80,0x00,0x00,0xFD,0xFF,0x09,0xF3,0xFF,0xFF,0xFE,0x1F,0xFF,0xE0,
+0x00,0x00,0x1F,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0xFC,0x1F,0xFF,0xF0,0x00,0x00,0x1F,
+0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x05,0x9F,0xFF,0xF0,0x00,0x18,0x1F,0xFE,0xFF,0x00,
+0xF3,0xFE,0xFF,0x05,0xDF,0xFF,0xF0,0x00,0x30,0x1F,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,
+0x05,0xDF,0xFF,0xF1,0x83,0xC0,0x3F,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0xFE,0xCF,0xFF,
+0xE0,0xFF,0x01,0x3F,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0x84,0xCF,0xFF,0x00,0x70,0x01,
+0x1F,0xFE,0xFF,0x09,0xF3,0xFF,0xFF,0x06,0x67,0xFE,0x00,0x40,0x02,0x3F,0xFE,0xFF,
+0x09,0xF3,0xFF,0xFE,0x07,0xE7,0xFE,0x00,0x40,0x06,0x3F,0xFE,0xFF,0x09,0xFB,0xFF,
+0xFC,0x03,0xE1,0xFE,0x00,0x40,0x06,0x7F,0xFE,0xFF,0x08,0xFB,0xFF,0xFC,0x04,0x60,
+0xFF,0x00,0x40,0x0C,0xFD,0xFF,0x08,0xFB,0xFF,0xFE,0x18,0x30,0x7F,0x80,0x00,0x18,
+0xFD,0xFF,0x08,0xFB,0xFF,0xE0,0x38,0x36,0x3F,0xC0,0x00,0x19,0xFD,0xFF,0x08,0xFB,
+0xFF,0xC0,0x20,0x33,0x1F,0xF0,0x00,0x31,0xFD,0xFF,0x08,0xFB,0xFF,0xC0,0xC8,0x11,
+0x8F,0xF8,0x00,0x63,0xFD,0xFF,0x08,0xFB,0xFF,0x80,0xC0,0x39,0x8F,0xFC,0x00,0x63,
+0xFD,0xFF,0x08,0xFB,0xFF,0xF9,0x80,0x48,0xC7,0xFC,0x00,0x43,0xFD,0xFF,0x08,0xFB,
+0xFF,0xBF,0x06,0xC4,0x07,0xFC,0x00,0xC3,0xFD,0xFF,0x08,0xFB,0xFE,0x03,0x07,0x86,
+0x07,0xFC,0x0C,0x83,0xFD,0xFF,0x08,0xFB,0xFE,0x01,0x07,0x86,0x07,0xFC,0x1E,0x83,
+0xFD,0xFF,0x08,0xFB,0xFC,0x05,0x07,0x93,0x07,0xFC,0x1D,0x81,0xFD,0xFF,0x08,0xFB,
+0xFC,0x08,0x0F,0xB1,0x03,0xFE,0x23,0xE1,0xFD,0xFF,0x08,0xFB,0xFF,0xF8,0xFF,0x99,
+0x23,0xFF,0xE7,0x30,0xFD,0xFF,0x09,0xFB,0xFE,0x00,0xFF,0xC0,0x91,0xFF,0x80,0x10,
+0x7F,0xFE,0xFF,0x09,0xFB,0xFC,0x00,0xFF,0xE0,0x98,0xFF,0x00,0x00,0x7F,0xFD,0xFF,
+0x08,0xFC,0x00,0xFF,0xE0,0x8C,0x7F,0x00,0x00,0x7F,0xFD,0xFF,0x08,0xFC,0x21,0xFF,
+0xF8,0x80,0x7F,0x00,0x00,0x7F,0xFD,0xFF,0x07,0xFC,0x71,0xFF,0xFC,0x80,0x7F,0x00,
+0x00,0xF9,0xFF,0x04,0xFE,0x40,0x3F,0x80,0x00,0xF8,0xFF,0x03,0xC0,0x3F,0x80,0x01,
+0xF8,0xFF,0x03,0x80,0x3F,0xE0,0x01,0xF8,0xFF,0x03,0xC0,0x7F,0xFC,0x01,0xF8,0xFF,
+0x03,0xE0,0x3F,0xFC,0x01,0xF8,0xFF,0x03,0xF8,0x3F,0xFC,0x01,0xF6,0xFF,0x01,0xFC,
+0x03,0xF6,0xFF,0x01,0xFE,0x07,0xF5,0xFF,0x00,0x9F,0xE4,0xFF,
+};
+
+// BitmapWaveshare_red : 2756 bytes, packed 502
+const unsigned char BitmapWaveshare_red_packed[] PROGMEM =
+{
+0xC4,0x0A,0x00,0x00,0xDD,0xFF,0x00,0x1F,0xF8,0xFF,0x03,0xFC,0x7F,0xFE,0x3F,0xF8,
+0xFF,0x03,0xF8,0x3F,0xFC,0x3F,0xF8,0xFF,0x03,0xC0,0x1F,0xF0,0x3F,0xF8,0xFF,0x03,
+0x80,0x0F,0xC0,0x3F,0xF8,0xFF,0x03,0x80,0x47,0x80,0x7F,0xF8,0xFF,0x02,0x80,0x02,
+0x1F,0xF7,0xFF,0x03,0x83,0x86,0x78,0x3F,0xF8,0xFF,0x03,0x82,0x0C,0xE0,0x0F,0xF8,
+0xFF,0x03,0x80,0x0C,0x80,0x03,0xF8,0xFF,0x03,0x80,0x05,0x00,0x00,0xF8,0xFF,0x03,
+0xC6,0x04,0x00,0x00,0xF8,0xFF,0x03,0xC0,0x04,0x00,0x01,0xF8,0xFF,0x03,0xE0,0x04,
+0x60,0x01,0xF8,0xFF,0x03,0xF0,0x06,0x60,0x01,0xF8,0xFF,0x03,0xFC,0x0E,0x00,0x01,
+0xF7,0xFF,0x02,0xE2,0x20,0x01,0xF8,0xFF,0x03,0xF0,0x00,0x10,0x03,0xF8,0xFF,0x03,
+0xE0,0x80,0x00,0x07,0xF8,0xFF,0x03,0xF0,0x80,0x18,0x07,0xF8,0xFF,0x03,0xF0,0x00,
+0x80,0x1F,0xF8,0xFF,0x04,0xF0,0xC0,0x80,0x3C,0x7F,0xF9,0xFF,0x04,0xE0,0xC0,0x7F,
+0xF0,0x3F,0xF9,0xFF,0x04,0xE0,0x60,0x40,0x00,0x1F,0xF9,0xFF,0x04,0xE0,0x38,0x20,
+0x00,0x0F,0xF9,0xFF,0x04,0xE0,0x1C,0x18,0x00,0x1F,0xF9,0xFF,0x03,0xFC,0x03,0x0C,
+0x0F,0xF7,0xFF,0x01,0x06,0x03,0xF6,0xFF,0x01,0xFC,0x01,0xF6,0xFF,0x01,0xF0,0xC9,
+0xF6,0xFF,0x01,0xC0,0xCF,0xF6,0xFF,0x01,0xC0,0x47,0xF6,0xFF,0x01,0xE0,0x07,0xF6,
+0xFF,0x01,0xE0,0x07,0xF6,0xFF,0x01,0xF0,0x07,0xF6,0xFF,0x01,0xF0,0x3F,0xF6,0xFF,
+0x01,0xF9,0xCF,0xF5,0xFF,0x00,0xEF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0xF7,0xFF,0x00,0x3F,0xF6,0xFF,0x01,0xF0,0x3F,0xF6,0xFF,0x01,0x80,0x1F,0xF6,
+0xFF,0x01,0x00,0x0F,0xF7,0xFF,0x02,0xFE,0x00,0x0F,0xF7,0xFF,0x02,0xFE,0x00,0x07,
+0xF7,0xFF,0x02,0xFE,0x00,0x07,0xF7,0xFF,0x02,0xFE,0x4E,0x07,0xF7,0xFF,0x02,0xFE,
+0x01,0x07,0xF7,0xFF,0x02,0xFE,0x01,0x07,0xF7,0xFF,0x02,0xFE,0x00,0x0F,0xF7,0xFF,
+0x01,0xFE,0x00,0xF6,0xFF,0x01,0xFE,0x03,0xF6,0xFF,0x02,0xFE,0x1C,0x01,0xF7,0xFF,
+0x02,0xFE,0x68,0x00,0xF7,0xFF,0x03,0xF0,0xC4,0x00,0x7F,0xF8,0xFF,0x03,0xF1,0x06,
+0x00,0x3F,0xF8,0xFF,0x03,0xE1,0x03,0x00,0x3F,0xF8,0xFF,0x03,0xE2,0x01,0x80,0x1F,
+0xF8,0xFF,0x03,0xC1,0xC0,0x80,0x07,0xF8,0xFF,0x03,0xC0,0x70,0xC0,0x0F,0xF8,0xFF,
+0x03,0xE0,0x38,0x00,0x1F,0xF8,0xFF,0x02,0xE0,0x0C,0x01,0xF7,0xFF,0x03,0xC0,0x1F,
+0xFF,0x8F,0xF8,0xFF,0x03,0x80,0x70,0x00,0x0F,0xF8,0xFF,0x03,0x81,0x00,0x00,0x1F,
+0xF8,0xFF,0x03,0xC1,0x00,0x00,0x3F,0xF8,0xFF,0x03,0xC0,0x0F,0xC0,0x7F,0xF8,0xFF,
+0x02,0xE0,0x0F,0xC0,0xF7,0xFF,0x02,0xF0,0x00,0x3F,0xF7,0xFF,0x02,0xFA,0x07,0x0F,
+0xF7,0xFF,0x02,0xFE,0x07,0x07,0xF6,0xFF,0x01,0x08,0x03,0xF6,0xFF,0x01,0x00,0x03,
+0xF6,0xFF,0x01,0xC0,0x01,0xF6,0xFF,0x01,0xE0,0x00,0xF6,0xFF,0x01,0xF8,0x01,0xF6,
+0xFF,0x01,0xFC,0x07,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0xAE,0xFF,
+};
+
+#endif
@@ -21,11 +21,11 @@
 
 #define GxGDEW0213Z16_BUFFER_SIZE (uint32_t(GxGDEW0213Z16_WIDTH) * uint32_t(GxGDEW0213Z16_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW0213Z16_HEIGHT
-#define GxGDEW0213Z16_PAGES 8 // not a factor, workaround needed
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW0213Z16_HEIGHT
+#define GxGDEW0213Z16_PAGES 8
 
-#define GxGDEW0213Z16_PAGE_HEIGHT (GxGDEW0213Z16_HEIGHT / (GxGDEW0213Z16_PAGES - 1))
-#define GxGDEW0213Z16_PAGE_SIZE (GxGDEW0213Z16_BUFFER_SIZE / (GxGDEW0213Z16_PAGES - 1))
+#define GxGDEW0213Z16_PAGE_HEIGHT ((GxGDEW0213Z16_HEIGHT + GxGDEW0213Z16_PAGES - 1) / GxGDEW0213Z16_PAGES) // the last page has less
+#define GxGDEW0213Z16_PAGE_SIZE (uint32_t(GxGDEW0213Z16_WIDTH / 8) * GxGDEW0213Z16_PAGE_HEIGHT)
 
 class GxGDEW0213Z16 : public GxEPD
 {
@@ -38,6 +38,10 @@ class GxGDEW0213Z16 : public GxEPD
     GxGDEW0213Z16(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -56,7 +60,8 @@ class GxGDEW0213Z16 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW0213Z16_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW0213Z16_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -68,6 +73,7 @@ class GxGDEW0213Z16 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEW0213Z16";};
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -85,7 +91,14 @@ class GxGDEW0213Z16 : public GxEPD
     void _waitWhileBusy(const char* comment = 0);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW0213Z16_WIDTH, GxGDEW0213Z16_HEIGHT, 2, GxEPD_INTERLEAVED_3C ? GxFB_INTERLEAVED : 0> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif GxEPD_INTERLEAVED_3C && defined(__AVR)
+    uint8_t _buffer[2 * GxGDEW0213Z16_PAGE_SIZE]; // black and red interleaved
+#elif GxEPD_INTERLEAVED_3C
+    uint8_t _buffer[2 * GxGDEW0213Z16_BUFFER_SIZE]; // black and red interleaved
+#elif defined(__AVR)
     uint8_t _black_buffer[GxGDEW0213Z16_PAGE_SIZE];
     uint8_t _red_buffer[GxGDEW0213Z16_PAGE_SIZE];
 #else
@@ -93,7 +106,6 @@ class GxGDEW0213Z16 : public GxEPD
     uint8_t _red_buffer[GxGDEW0213Z16_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -114,6 +126,7 @@ class GxGDEW0213Z16 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW0213Z16_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW0213Z16/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW0213Z16/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW0213Z16/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,343 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 5808 bytes, packed 1573
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xB0,0x16,0x00,0x00,0x81,0x00,0xBE,0x00,0x01,0x01,0xFE,0xED,0x00,0x02,0x07,0xFF,
+0x80,0xEE,0x00,0x02,0x0F,0xFF,0x80,0xEE,0x00,0x02,0x0E,0x01,0xC0,0xEE,0x00,0x02,
+0x0C,0x00,0xC0,0xEE,0x00,0x02,0x0C,0x00,0xC0,0xEE,0x00,0x02,0x0E,0x01,0xC0,0xEE,
+0x00,0x02,0x07,0xFF,0xC0,0xEE,0x00,0x02,0x07,0xFF,0x80,0xEE,0x00,0x01,0x01,0xFE,
+0xD6,0x00,0x00,0x06,0xEC,0x00,0x00,0x06,0xED,0x00,0x02,0x0F,0xFF,0xC0,0xEE,0x00,
+0x02,0x0F,0xFF,0xC0,0xEE,0x00,0x02,0x0F,0xFF,0xC0,0xEE,0x00,0x01,0x0E,0x06,0xED,
+0x00,0x01,0x07,0x86,0xEC,0x00,0x00,0xF6,0xEC,0x00,0x00,0x3E,0xEC,0x00,0x00,0x0E,
+0x81,0x00,0xFE,0x00,0x01,0x01,0xC0,0xED,0x00,0x01,0x01,0xF0,0xED,0x00,0x01,0x01,
+0xF8,0xEC,0x00,0x00,0x18,0xD8,0x00,0x01,0x01,0xFC,0xED,0x00,0x01,0x07,0xFF,0xED,
+0x00,0x02,0x0F,0xFF,0x80,0xEE,0x00,0x02,0x0E,0x19,0xC0,0xEE,0x00,0x02,0x0C,0x18,
+0xC0,0xEE,0x00,0x02,0x0C,0x18,0xC0,0xEE,0x00,0x02,0x0E,0x38,0xC0,0xEE,0x00,0x02,
+0x07,0xF8,0xC0,0xEE,0x00,0x02,0x07,0xF0,0xC0,0xEE,0x00,0x01,0x03,0xE0,0xD6,0x00,
+0x00,0x0F,0xED,0x00,0x02,0x03,0x9F,0x80,0xF5,0x00,0x00,0xFC,0xFB,0x00,0x02,0x07,
+0xDF,0xC0,0xF5,0x00,0x00,0xFC,0xFB,0x00,0x02,0x0F,0xF9,0xC0,0xF5,0x00,0x00,0xCC,
+0xFB,0x00,0x02,0x0C,0x70,0xC0,0xF5,0x00,0x00,0xCC,0xFB,0x00,0x02,0x0C,0x30,0xC0,
+0xF5,0x00,0x00,0xFC,0xFB,0x00,0x02,0x0C,0x30,0xC0,0xF5,0x00,0x00,0xFC,0xFB,0x00,
+0x02,0x0C,0x30,0xC0,0xEE,0x00,0x02,0x06,0x01,0x80,0x81,0x00,0xE9,0x00,0x01,0x01,
+0xC0,0xED,0x00,0x01,0x01,0xF0,0xED,0x00,0x01,0x01,0xF8,0xEC,0x00,0x00,0x18,0xD8,
+0x00,0x01,0x03,0x8F,0xED,0x00,0x02,0x07,0xDF,0x80,0xEE,0x00,0x02,0x0F,0xFF,0xC0,
+0xEE,0x00,0x02,0x0C,0x78,0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xEE,0x00,0x02,0x0C,
+0x70,0xC0,0xEE,0x00,0x02,0x0C,0x78,0xC0,0xEE,0x00,0x02,0x0F,0xFF,0xC0,0xEE,0x00,
+0x02,0x07,0xCF,0x80,0xEE,0x00,0x01,0x03,0x87,0xD6,0x00,0x00,0x0F,0xED,0x00,0x02,
+0x03,0x9F,0x80,0xEE,0x00,0x02,0x07,0xDF,0xC0,0xEE,0x00,0x02,0x0F,0xF9,0xC0,0xEE,
+0x00,0x02,0x0C,0x70,0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xEE,0x00,0x02,0x0C,0x30,
+0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xEE,0x00,0x02,0x06,0x01,0x80,0x81,0x00,0xE9,
+0x00,0x01,0x01,0xC0,0xED,0x00,0x01,0x01,0xF0,0xED,0x00,0x01,0x01,0xF0,0xEC,0x00,
+0x00,0x10,0xD8,0x00,0x00,0x0E,0xEC,0x00,0x01,0x0F,0x80,0xED,0x00,0x01,0x0F,0xF0,
+0xED,0x00,0x01,0x0D,0xFC,0xED,0x00,0x01,0x0C,0x7F,0xED,0x00,0x02,0x0C,0x0F,0xC0,
+0xEE,0x00,0x02,0x0C,0x03,0xC0,0xEE,0x00,0x02,0x0C,0x00,0xC0,0xEE,0x00,0x00,0x0C,
+0xBF,0x00,0x00,0x0F,0xED,0x00,0x02,0x03,0x9F,0x80,0xEE,0x00,0x02,0x07,0xDF,0xC0,
+0xEE,0x00,0x02,0x0F,0xF9,0xC0,0xEE,0x00,0x02,0x0C,0x70,0xC0,0xEE,0x00,0x02,0x0C,
+0x30,0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xEE,0x00,
+0x02,0x06,0x01,0x80,0x81,0x00,0x81,0x00,0x81,0x00,0xF0,0x00,0x01,0x01,0xFE,0xED,
+0x00,0x02,0x07,0xFF,0x80,0xEE,0x00,0x02,0x0F,0xFF,0x80,0xEE,0x00,0x02,0x0E,0x01,
+0xC0,0xEE,0x00,0x02,0x0C,0x00,0xC0,0xEE,0x00,0x02,0x0C,0x00,0xC0,0xEE,0x00,0x02,
+0x0E,0x01,0xC0,0xEE,0x00,0x02,0x07,0xFF,0xC0,0xEE,0x00,0x02,0x07,0xFF,0x80,0xFB,
+0x00,0x00,0x0F,0xFD,0xFF,0x00,0xC0,0xFA,0x00,0x01,0x01,0xFE,0xE4,0x00,0x00,0x0F,
+0xFD,0xFF,0x00,0xC0,0xF9,0x00,0x00,0x06,0xEC,0x00,0x00,0x06,0xED,0x00,0x02,0x0F,
+0xFF,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF9,0x00,0x02,0x0F,0xFF,0xC0,
+0xEE,0x00,0x02,0x0F,0xFF,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0xF8,0xFA,
+0x00,0x01,0x0E,0x06,0xFA,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x14,0xFA,0x00,0x01,
+0x07,0x86,0xFA,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x14,0xF9,0x00,0x00,0xF6,0xF6,
+0x00,0x01,0x01,0x14,0xF9,0x00,0x00,0x3E,0xFA,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,
+0xE8,0xF9,0x00,0x00,0x0E,0xFA,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xD6,0x00,0x01,
+0x01,0xFC,0xF1,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0x80,0xF1,0x00,0x00,0x0F,0xFE,
+0xFF,0x01,0xF8,0x40,0xE3,0x00,0x01,0x01,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,
+0xF8,0xF8,0x00,0x01,0x01,0xF0,0xF6,0x00,0x00,0xF8,0xF9,0x00,0x01,0x01,0xF0,0xF7,
+0x00,0x01,0x01,0x04,0xF8,0x00,0x00,0x10,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,
+0x04,0xF1,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x04,0xFA,0x00,0x01,0x01,0xFC,0xFA,
+0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0xF8,0xFA,0x00,0x01,0x07,0xFF,0xED,0x00,0x02,
+0x0F,0xFF,0x80,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF9,0x00,0x02,0x0E,0x19,
+0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0xFC,0xFA,0x00,0x02,0x0C,0x18,0xC0,
+0xF6,0x00,0x00,0x80,0xFA,0x00,0x02,0x0C,0x18,0xC0,0xF6,0x00,0x00,0x40,0xFA,0x00,
+0x02,0x0E,0x38,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF9,0x00,0x02,0x07,
+0xF8,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF9,0x00,0x02,0x07,0xF0,0xC0,
+0xF6,0x00,0x00,0xF8,0xFA,0x00,0x01,0x03,0xE0,0xF6,0x00,0x01,0x01,0x14,0xF1,0x00,
+0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x14,0xF9,0x00,0x00,0x0F,0xF6,0x00,0x01,0x01,0x14,
+0xFA,0x00,0x02,0x03,0x9F,0x80,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0xE8,0xFA,
+0x00,0x02,0x07,0xDF,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF9,0x00,0x02,
+0x0F,0xF9,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0xD8,0xFA,0x00,0x02,0x0C,
+0x70,0xC0,0xF7,0x00,0x01,0x01,0x24,0xFA,0x00,0x02,0x0C,0x30,0xC0,0xF7,0x00,0x01,
+0x01,0x24,0xFA,0x00,0x02,0x0C,0x30,0xC0,0xF7,0x00,0x01,0x01,0x24,0xFA,0x00,0x02,
+0x0C,0x30,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0xD8,0xFA,0x00,0x02,0x06,
+0x01,0x80,0xCF,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xDA,0x00,0x00,0x0F,0xFD,0xFF,
+0x00,0xC0,0xDB,0x00,0x00,0x0F,0xFD,0xFF,0x00,0xC0,0xF9,0x00,0x01,0x01,0xC0,0xED,
+0x00,0x01,0x01,0xF0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF8,0x00,0x01,0x01,
+0xF0,0xEC,0x00,0x00,0x10,0xD8,0x00,0x01,0x03,0x8F,0xFA,0x00,0x00,0x0F,0xFE,0xFF,
+0x01,0xF9,0x80,0xFA,0x00,0x02,0x07,0xDF,0x80,0xF7,0x00,0x01,0x01,0x40,0xFA,0x00,
+0x02,0x0F,0xFF,0xC0,0xF7,0x00,0x01,0x01,0x30,0xFA,0x00,0x02,0x0C,0x78,0xC0,0xFB,
+0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x0C,0xFA,0x00,0x02,0x0C,0x30,0xC0,0xF7,0x00,
+0x00,0x01,0xF9,0x00,0x02,0x0C,0x70,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,
+0xF9,0x00,0x02,0x0C,0x78,0xC0,0xF6,0x00,0x00,0xB8,0xFA,0x00,0x02,0x0F,0xFF,0xC0,
+0xF7,0x00,0x01,0x01,0x44,0xFA,0x00,0x02,0x07,0xCF,0x80,0xF7,0x00,0x01,0x01,0x44,
+0xFA,0x00,0x01,0x03,0x87,0xF6,0x00,0x01,0x01,0x44,0xF1,0x00,0x00,0x0F,0xFE,0xFF,
+0x01,0xF8,0xF8,0xF9,0x00,0x00,0x0F,0xED,0x00,0x02,0x03,0x9F,0x80,0xF7,0x00,0x01,
+0x01,0x38,0xFA,0x00,0x02,0x07,0xDF,0xC0,0xF7,0x00,0x01,0x01,0x44,0xFA,0x00,0x02,
+0x0F,0xF9,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x44,0xFA,0x00,0x02,0x0C,
+0x70,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0xCC,0xFA,0x00,0x02,0x0C,0x30,
+0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0x10,
+0xFA,0x00,0x02,0x0C,0x30,0xC0,0xFD,0x00,0x01,0x1F,0x80,0xFD,0x00,0x01,0x01,0xFC,
+0xFA,0x00,0x02,0x06,0x01,0x80,0xFD,0x00,0x02,0x1F,0x80,0x0F,0xFE,0xFF,0x01,0xF9,
+0x10,0xF3,0x00,0x02,0x19,0x80,0x0F,0xFE,0xFF,0x01,0xF8,0x90,0xF3,0x00,0x02,0x19,
+0x80,0x0F,0xFE,0xFF,0x01,0xF8,0x50,0xF3,0x00,0x01,0x1F,0x80,0xFC,0x00,0x00,0x30,
+0xF3,0x00,0x01,0x1F,0x80,0xEB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0xD8,0xED,0x00,
+0x01,0x01,0x24,0xF9,0x00,0x01,0x01,0xC0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,
+0x24,0xF9,0x00,0x01,0x01,0xF0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x04,0xF9,
+0x00,0x01,0x01,0xF0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF8,0x88,0xF8,0x00,0x00,
+0x10,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xEB,0x00,0x00,0xC4,0xFA,0x00,0x00,
+0x0E,0xF9,0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x24,0xFA,0x00,0x01,0x0F,0x80,0xFA,
+0x00,0x00,0x0F,0xFE,0xFF,0x01,0xF9,0x14,0xFA,0x00,0x01,0x0F,0xF0,0xF6,0x00,0x01,
+0x01,0x0C,0xFA,0x00,0x01,0x0D,0xFC,0xF5,0x00,0x00,0x84,0xFA,0x00,0x01,0x0C,0x7F,
+0xFA,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xF8,0xF9,0x00,0x02,0x0C,0x0F,0xC0,0xEE,0x00,
+0x02,0x0C,0x03,0xC0,0xEE,0x00,0x02,0x0C,0x00,0xC0,0xFB,0x00,0x00,0x0F,0xFD,0xFF,
+0x00,0xC0,0xFA,0x00,0x00,0x0C,0xE3,0x00,0x00,0x0F,0xFD,0xFF,0x00,0xC0,0xE3,0x00,
+0x00,0x0F,0xED,0x00,0x02,0x03,0x9F,0x80,0xEE,0x00,0x02,0x07,0xDF,0xC0,0xEE,0x00,
+0x02,0x0F,0xF9,0xC0,0xF7,0x00,0x01,0x01,0xFC,0xFA,0x00,0x02,0x0C,0x70,0xC0,0xF6,
+0x00,0x00,0x80,0xFA,0x00,0x02,0x0C,0x30,0xC0,0xF6,0x00,0x00,0x40,0xFA,0x00,0x02,
+0x0C,0x30,0xC0,0xEE,0x00,0x02,0x0C,0x30,0xC0,0xEE,0x00,0x02,0x06,0x01,0x80,0x81,
+0x00,0x81,0x00,0xEB,0x00,
+};
+
+// BitmapExample2 : 5808 bytes, packed 3512
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0xB0,0x16,0x00,0x00,0xEF,0xFF,0x00,0xFE,0xEC,0xFF,0x00,0xFE,0xEC,0xFF,0x00,0xFE,
+0xEC,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,
+0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,
+0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,
+0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xFE,
+0xFE,0x01,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xF3,0x1F,0xFF,0xFE,0xF8,0x00,0x7F,0xF0,
+0xF4,0x00,0x08,0x0F,0xE6,0x0F,0xFF,0xFE,0xF0,0x00,0x7F,0xF0,0xF4,0x00,0x08,0x0F,
+0xE6,0x4F,0xFF,0xFE,0xF1,0xFE,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xE4,0xCF,0xFF,0xFE,
+0xF3,0xFF,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xE0,0xCF,0xFF,0xFE,0xF3,0xFF,0x3F,0xF0,
+0xF4,0x00,0x08,0x0F,0xF1,0x9F,0xFF,0xFE,0xF1,0xFE,0x3F,0xF0,0xF4,0x00,0x00,0x0F,
+0xFE,0xFF,0x04,0xFE,0xF8,0x00,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xF8,0x9F,0xFF,0xFE,
+0xF8,0x00,0x7F,0xF0,0xF4,0x00,0x08,0x0F,0xF0,0xCF,0xFF,0xFE,0xFE,0x01,0xFF,0xF0,
+0xF4,0x00,0x04,0x0F,0xE4,0xCF,0xFF,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x08,0x0F,
+0xE4,0xCF,0xFF,0xFE,0xFF,0xF9,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xE4,0xCF,0xFF,0xFE,
+0xFF,0xF9,0xFF,0xF0,0xF4,0x00,0x09,0x0F,0xE4,0x8F,0xFF,0xFE,0xF0,0x00,0x3F,0xF0,
+0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x08,0x0F,0xF0,0x1F,0xFF,0xFE,0xF0,0x00,0x3F,
+0xF0,0xF4,0x00,0x09,0x0F,0xF8,0x3F,0xFF,0xFE,0xF0,0x00,0x3F,0xF0,0x0F,0xFE,0xFF,
+0x00,0xF0,0xF9,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xFE,0xF1,0xF9,0xFF,0xF0,0xF4,0x00,
+0x00,0x0F,0xFE,0xFF,0x04,0xFE,0xF8,0x79,0xFF,0xF0,0xF4,0x00,0x09,0x0F,0xE7,0xCF,
+0xFF,0xFE,0xFF,0x09,0xFF,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x08,0x0F,0xE1,
+0xCF,0xFF,0xFE,0xFF,0xC1,0xFF,0xF0,0xF4,0x00,0x09,0x0F,0xE4,0xCF,0xFF,0xFE,0xFF,
+0xF1,0xFF,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x03,0xE0,0xFB,0x00,0x04,0x0F,0xE6,0x4F,
+0xFF,0xFE,0xFE,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x50,0xFB,0x00,0x04,
+0x0F,0xE7,0x0F,0xFF,0xFE,0xFE,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x50,
+0xFB,0x00,0x04,0x0F,0xE7,0xCF,0xFF,0xFE,0xFE,0xFF,0x00,0xF0,0xFC,0x00,0x01,0x04,
+0x50,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,
+0x02,0xF0,0x03,0xA0,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x01,0xF0,
+0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x08,0x0F,0x3F,0xFF,0xFF,0xFE,0xFF,0xFE,0x3F,
+0xF0,0xF4,0x00,0x08,0x0F,0x20,0x0F,0xF1,0x3E,0xFF,0xFE,0x0F,0xF0,0xFC,0x00,0x01,
+0x07,0xF0,0xFB,0x00,0x09,0x0F,0x20,0x0F,0xE1,0x9E,0xFF,0xFE,0x07,0xF0,0x0F,0xFE,
+0xFF,0x01,0xF0,0x02,0xFA,0x00,0x09,0x0F,0xFF,0xFF,0xC9,0x9E,0xFF,0xFF,0xE7,0xF0,
+0x0F,0xFE,0xFF,0x01,0xF0,0x01,0xFA,0x00,0x04,0x0F,0xFF,0xFF,0xC9,0x9E,0xFE,0xFF,
+0x00,0xF0,0xF4,0x00,0x09,0x0F,0xF3,0x1F,0xC9,0x9E,0xFE,0x03,0xFF,0xF0,0x0F,0xFE,
+0xFF,0x00,0xF0,0xF9,0x00,0x08,0x0F,0xE6,0x0F,0xC9,0x1E,0xF8,0x00,0xFF,0xF0,0xFC,
+0x00,0x01,0x03,0xE0,0xFB,0x00,0x08,0x0F,0xE6,0x4F,0xE0,0x3E,0xF0,0x00,0x7F,0xF0,
+0xFC,0x00,0x01,0x04,0x10,0xFB,0x00,0x09,0x0F,0xE4,0xCF,0xF0,0x7E,0xF1,0xE6,0x3F,
+0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x10,0xFB,0x00,0x09,0x0F,0xE0,0xCF,0xFF,0xFE,
+0xF3,0xE7,0x3F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x10,0xFB,0x00,0x09,0x0F,0xF1,
+0x9F,0xFF,0xFE,0xF3,0xE7,0x3F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x03,0xE0,0xFB,0x00,
+0x08,0x0F,0xFF,0xFF,0xCF,0xFE,0xF1,0xC7,0x3F,0xF0,0xF4,0x00,0x09,0x0F,0xFF,0xFF,
+0xCF,0xFE,0xF8,0x07,0x3F,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x09,0x0F,0xFF,
+0xFF,0xE7,0xFE,0xF8,0x0F,0x3F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x07,0xF0,0xFB,0x00,
+0x08,0x0F,0xFF,0xFF,0xC0,0x1E,0xFC,0x1F,0xFF,0xF0,0xFC,0x00,0x00,0x02,0xFA,0x00,
+0x04,0x0F,0xFF,0xFF,0xC0,0x1E,0xFE,0xFF,0x00,0xF0,0xFC,0x00,0x00,0x01,0xFA,0x00,
+0x00,0x0F,0xFE,0xFF,0x05,0xFE,0xFF,0xF0,0xFF,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,
+0x00,0x09,0x0F,0xF8,0x9F,0xF0,0x7E,0xFC,0x60,0x7F,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,
+0xFD,0x00,0x00,0x3F,0xFE,0x00,0x08,0x0F,0xF0,0xCF,0xE0,0x3E,0xF8,0x20,0x3F,0xF0,
+0xFC,0x00,0x04,0x03,0xE0,0x00,0x00,0x3F,0xFE,0x00,0x08,0x0F,0xE4,0xCF,0xC7,0x1E,
+0xF0,0x06,0x3F,0xF0,0xFC,0x00,0x04,0x04,0x50,0x00,0x00,0x33,0xFE,0x00,0x09,0x0F,
+0xE4,0xCF,0xCF,0x9E,0xF3,0x8F,0x3F,0xF0,0x0F,0xFE,0xFF,0x05,0xF0,0x04,0x50,0x00,
+0x00,0x33,0xFE,0x00,0x08,0x0F,0xE4,0xCF,0xCF,0x9E,0xF3,0xCF,0x3F,0xF0,0xFC,0x00,
+0x04,0x04,0x50,0x00,0x00,0x3F,0xFE,0x00,0x09,0x0F,0xE4,0x8F,0xCF,0x9E,0xF3,0xCF,
+0x3F,0xF0,0x0F,0xFE,0xFF,0x05,0xF0,0x03,0xA0,0x00,0x00,0x3F,0xFE,0x00,0x09,0x0F,
+0xF0,0x1F,0xC7,0x1E,0xF3,0xCF,0x3F,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x09,
+0x0F,0xF8,0x3F,0xE0,0x3E,0xF9,0xFE,0x7F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x03,0x60,
+0xFB,0x00,0x04,0x0F,0xFF,0xFF,0xF0,0x7E,0xFE,0xFF,0x00,0xF0,0xFC,0x00,0x01,0x04,
+0x90,0xFB,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xFC,0x00,0x01,
+0x04,0x90,0xFB,0x00,0x04,0x0F,0xFF,0xFF,0xCF,0x9E,0xFE,0xFF,0x00,0xF0,0xFC,0x00,
+0x01,0x04,0x90,0xFB,0x00,0x04,0x0E,0x00,0x0F,0xCF,0x9E,0xFE,0xFF,0x01,0xF0,0x0F,
+0xFE,0xFF,0x02,0xF0,0x03,0x60,0xFB,0x00,0x04,0x0E,0x00,0x0F,0x00,0x1E,0xFE,0xFF,
+0x00,0xF0,0xF4,0x00,0x04,0x0F,0xFF,0xFF,0x00,0x3E,0xFE,0xFF,0x00,0xF0,0xFC,0x00,
+0x00,0x06,0xFA,0x00,0x09,0x0F,0xF8,0x3F,0xCF,0xFE,0xFF,0xFE,0x3F,0xF0,0x0F,0xFE,
+0xFF,0x01,0xF0,0x05,0xFA,0x00,0x08,0x0F,0xF0,0x1F,0xCF,0xFE,0xFF,0xFE,0x0F,0xF0,
+0xFC,0x00,0x01,0x04,0xC0,0xFB,0x00,0x09,0x0F,0xE3,0x8F,0xFF,0xFE,0xFF,0xFE,0x07,
+0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x30,0xFB,0x00,0x08,0x0F,0xE7,0xCF,0xE6,0x3E,
+0xFF,0xFF,0xE7,0xF0,0xFC,0x00,0x00,0x04,0xFA,0x00,0x04,0x0F,0xE7,0xCF,0xCC,0x1E,
+0xFE,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x08,0x0F,0xF3,0x9F,0xCC,
+0x9E,0xFC,0x70,0xFF,0xF0,0xFC,0x00,0x01,0x02,0xE0,0xFB,0x00,0x09,0x0E,0x00,0x0F,
+0xC9,0x9E,0xF8,0x20,0x7F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x05,0x10,0xFB,0x00,0x08,
+0x0E,0x00,0x0F,0xC1,0x9E,0xF0,0x00,0x3F,0xF0,0xFC,0x00,0x01,0x05,0x10,0xFB,0x00,
+0x08,0x0F,0xFF,0xFF,0xE3,0x3E,0xF3,0x87,0x3F,0xF0,0xFC,0x00,0x01,0x05,0x10,0xFB,
+0x00,0x08,0x0F,0xF0,0x0F,0xFF,0xFE,0xF3,0xCF,0x3F,0xF0,0xFC,0x00,0x01,0x03,0xE0,
+0xFB,0x00,0x09,0x0F,0xE0,0x0F,0xF9,0xFE,0xF3,0x8F,0x3F,0xF0,0x0F,0xFE,0xFF,0x00,
+0xF0,0xF9,0x00,0x08,0x0F,0xE4,0x8F,0xF9,0xFE,0xF3,0x87,0x3F,0xF0,0xFC,0x00,0x01,
+0x04,0xE0,0xFB,0x00,0x08,0x0F,0xE4,0xCF,0xF9,0xFE,0xF0,0x00,0x3F,0xF0,0xFC,0x00,
+0x01,0x05,0x10,0xFB,0x00,0x09,0x0F,0xE4,0xCF,0xF9,0xFE,0xF8,0x30,0x7F,0xF0,0x0F,
+0xFE,0xFF,0x02,0xF0,0x05,0x10,0xFB,0x00,0x08,0x0F,0xE4,0xCF,0xF9,0xFE,0xFC,0x78,
+0xFF,0xF0,0xFC,0x00,0x01,0x07,0x30,0xFB,0x00,0x04,0x0F,0xE6,0x0F,0xFF,0xFE,0xFE,
+0xFF,0x01,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x08,0x0F,0xF2,0x1F,0xFF,0xFE,
+0xFF,0xF0,0xFF,0xF0,0xFB,0x00,0x00,0x40,0xFB,0x00,0x08,0x0F,0xFF,0xFF,0xE0,0x1E,
+0xFC,0x60,0x7F,0xF0,0xFC,0x00,0x01,0x07,0xF0,0xFB,0x00,0x08,0x0F,0xFF,0xFF,0xC0,
+0x1E,0xF8,0x20,0x3F,0xF0,0xFC,0x00,0x01,0x04,0x40,0xFB,0x00,0x08,0x0F,0xFF,0xFF,
+0xCF,0xFE,0xF0,0x06,0x3F,0xF0,0xFC,0x00,0x01,0x02,0x40,0xFB,0x00,0x09,0x0E,0x00,
+0x0F,0xCF,0xFE,0xF3,0x8F,0x3F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x01,0x40,0xFB,0x00,
+0x08,0x0E,0x00,0x0F,0xCF,0xFE,0xF3,0xCF,0x3F,0xF0,0xFB,0x00,0x00,0xC0,0xFB,0x00,
+0x08,0x0F,0xFF,0xFF,0xE7,0xFE,0xF3,0xCF,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xFF,
+0xC0,0x1E,0xF3,0xCF,0x3F,0xF0,0xFC,0x00,0x01,0x03,0x60,0xFB,0x00,0x09,0x0F,0x3F,
+0xFF,0xC0,0x1E,0xF9,0xFE,0x7F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x90,0xFB,0x00,
+0x04,0x0F,0x20,0x0F,0xFF,0xFE,0xFE,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,
+0x90,0xFB,0x00,0x04,0x0F,0x20,0x0F,0xFF,0xFE,0xFE,0xFF,0x00,0xF0,0xFC,0x00,0x01,
+0x04,0x10,0xFB,0x00,0x04,0x0F,0xFF,0xFE,0x7F,0xFE,0xFE,0xFF,0x01,0xF0,0x0F,0xFE,
+0xFF,0x02,0xF0,0x02,0x20,0xFB,0x00,0x04,0x0F,0xF0,0x0E,0x40,0x1E,0xFE,0xFF,0x00,
+0xF0,0xF4,0x00,0x04,0x0F,0xE0,0x0E,0x40,0x1E,0xFE,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,
+0x02,0xF0,0x03,0x10,0xFB,0x00,0x04,0x0F,0xE4,0x8F,0xFF,0xFE,0xFE,0xFF,0x01,0xF0,
+0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x90,0xFB,0x00,0x09,0x0F,0xE4,0xCF,0xFF,0xFE,0xFF,
+0xFE,0x3F,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x04,0x50,0xFB,0x00,0x08,0x0F,0xE4,0xCF,
+0xFF,0xFE,0xFF,0xFE,0x0F,0xF0,0xFC,0x00,0x01,0x04,0x30,0xFB,0x00,0x08,0x0F,0xE4,
+0xCF,0xFF,0xFE,0xFF,0xFE,0x0F,0xF0,0xFC,0x00,0x01,0x02,0x10,0xFB,0x00,0x09,0x0F,
+0xE6,0x0F,0xFF,0xFE,0xFF,0xFF,0xEF,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x04,
+0x0F,0xF2,0x1F,0xFF,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x05,
+0xFE,0xF1,0xFF,0xFF,0xF0,0x0F,0xFE,0xFF,0x02,0xF0,0x07,0xF0,0xFB,0x00,0x00,0x0F,
+0xFE,0xFF,0x05,0xFE,0xF0,0x7F,0xFF,0xF0,0x0F,0xFE,0xFF,0x01,0xF0,0x02,0xFA,0x00,
+0x09,0x0F,0xE1,0xFF,0xFF,0xFE,0xF0,0x0F,0xFF,0xF0,0x0F,0xFE,0xFF,0x01,0xF0,0x01,
+0xFA,0x00,0x09,0x0F,0xE0,0x3F,0xFF,0xFE,0xF2,0x03,0xFF,0xF0,0x0F,0xFE,0xFF,0x00,
+0xF0,0xF9,0x00,0x08,0x0F,0xFE,0x0F,0xFF,0xFE,0xF3,0x80,0xFF,0xF0,0xF4,0x00,0x09,
+0x0F,0xFF,0xCF,0xFF,0xFE,0xF3,0xF0,0x3F,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,
+0x09,0x0F,0xFE,0x0F,0xFF,0xFE,0xF3,0xFC,0x3F,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,
+0x00,0x08,0x0F,0xE0,0x3F,0xFF,0xFE,0xF3,0xFF,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xE1,
+0xFF,0xFF,0xFE,0xF3,0xFF,0xFF,0xF0,0xF4,0x00,0x04,0x0F,0xFF,0xEF,0xFF,0xFE,0xFE,
+0xFF,0x01,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,0x04,0x0F,0xFF,0x8F,0xFF,0xFE,
+0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x08,0x0F,0xFC,0x0F,0xFF,0xFE,0xFF,0xF0,0xFF,0xF0,
+0xF4,0x00,0x09,0x0F,0xE0,0x3F,0xFF,0xFE,0xFC,0x60,0x7F,0xF0,0x0F,0xFE,0xFF,0x00,
+0xF0,0xF9,0x00,0x08,0x0F,0x80,0x7F,0xFF,0xFE,0xF8,0x20,0x3F,0xF0,0xF4,0x00,0x09,
+0x0F,0x06,0x7F,0xFF,0xFE,0xF0,0x06,0x3F,0xF0,0x0F,0xFE,0xFF,0x00,0xF0,0xF9,0x00,
+0x08,0x0F,0x3E,0x7F,0xFF,0xFE,0xF3,0x8F,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0x02,0x7F,
+0xFF,0xFE,0xF3,0xCF,0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xC0,0x7F,0xFF,0xFE,0xF3,0xCF,
+0x3F,0xF0,0xF4,0x00,0x08,0x0F,0xF8,0x0F,0xFF,0xFE,0xF3,0xCF,0x3F,0xF0,0xF4,0x00,
+0x08,0x0F,0xFF,0x0F,0xFF,0xFE,0xF9,0xFE,0x7F,0xF0,0xF4,0x00,0x04,0x0F,0xFF,0xEF,
+0xFF,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,
+0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,
+0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,
+0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,
+0x00,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xF4,0x00,
+0x00,0x0F,0xFE,0xFF,0x00,0xFE,0xFE,0xFF,0x00,0xF0,0xED,0x00,0x01,0x0F,0xF0,0xED,
+0x00,0x01,0x0F,0xF0,0xED,0x00,0x01,0x0F,0xF0,0xED,0x00,0x01,0x0F,0xF0,0xED,0x00,
+0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,
+0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,
+0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,
+0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFE,0x01,0xF0,
+0xF4,0x00,0x08,0x0F,0xFF,0xF3,0x1F,0xFF,0xFE,0xF8,0x00,0x70,0xF4,0x00,0x08,0x0F,
+0xFF,0xE6,0x0F,0xFF,0xFE,0xF0,0x00,0x70,0xF4,0x00,0x08,0x0F,0xFF,0xE6,0x4F,0xFF,
+0xFE,0xF1,0xFE,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xFF,0xFE,0xF3,0xFF,0x30,
+0xF4,0x00,0x08,0x0F,0xFF,0xE0,0xCF,0xFF,0xFE,0xF3,0xFF,0x30,0xF4,0x00,0x08,0x0F,
+0xFF,0xF1,0x9F,0xFF,0xFE,0xF1,0xFE,0x30,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,
+0xF8,0x00,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xF8,0x9F,0xFF,0xFE,0xF8,0x00,0x70,0xF4,
+0x00,0x08,0x0F,0xFF,0xF0,0xCF,0xFF,0xFE,0xFE,0x01,0xF0,0xF4,0x00,0x08,0x0F,0xFF,
+0xE4,0xCF,0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xFF,0xFE,
+0xFF,0xF9,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xFF,0xFE,0xFF,0xF9,0xF0,0xF4,
+0x00,0x08,0x0F,0xFF,0xE4,0x8F,0xFF,0xFE,0xF0,0x00,0x30,0xF4,0x00,0x08,0x0F,0xFF,
+0xF0,0x1F,0xFF,0xFE,0xF0,0x00,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xF8,0x3F,0xFF,0xFE,
+0xF0,0x00,0x30,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xF1,0xF9,0xF0,0xF4,0x00,
+0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xF8,0x79,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE7,0xCF,
+0xFF,0xFE,0xFF,0x09,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE1,0xCF,0xFF,0xFE,0xFF,0xC1,
+0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xFF,0xFE,0xFF,0xF1,0xF0,0xF4,0x00,0x08,
+0x0F,0xFF,0xE6,0x4F,0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE7,0x0F,
+0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE7,0xCF,0xFF,0xFE,0xFF,0xFF,
+0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,
+0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0x3F,0xFF,0xFF,0xFE,
+0xFF,0xFE,0x30,0xF4,0x00,0x07,0x0F,0xFF,0x20,0x0F,0xF1,0x3E,0xFF,0xFE,0xF3,0x00,
+0x07,0x0F,0xFF,0x20,0x0F,0xE1,0x9E,0xFF,0xFE,0xF3,0x00,0x00,0x0F,0xFE,0xFF,0x04,
+0xC9,0x9E,0xFF,0xFF,0xE0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xC9,0x9E,0xFF,0xFF,
+0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xF3,0x1F,0xC9,0x9E,0xFE,0x03,0xF0,0xF4,0x00,0x08,
+0x0F,0xFF,0xE6,0x0F,0xC9,0x1E,0xF8,0x00,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE6,0x4F,
+0xE0,0x3E,0xF0,0x00,0x70,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xF0,0x7E,0xF1,0xE6,
+0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE0,0xCF,0xFF,0xFE,0xF3,0xE7,0x30,0xF4,0x00,0x08,
+0x0F,0xFF,0xF1,0x9F,0xFF,0xFE,0xF3,0xE7,0x30,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,
+0xCF,0xFE,0xF1,0xC7,0x30,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xCF,0xFE,0xF8,0x07,
+0x30,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xE7,0xFE,0xF8,0x0F,0x30,0xF4,0x00,0x00,
+0x0F,0xFE,0xFF,0x04,0xC0,0x1E,0xFC,0x1F,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,
+0xC0,0x1E,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xF0,0xF0,
+0xF4,0x00,0x08,0x0F,0xFF,0xF8,0x9F,0xF0,0x7E,0xFC,0x60,0x70,0xF4,0x00,0x08,0x0F,
+0xFF,0xF0,0xCF,0xE0,0x3E,0xF8,0x20,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xC7,
+0x1E,0xF0,0x06,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xCF,0x9E,0xF3,0x8F,0x30,
+0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xCF,0x9E,0xF3,0xCF,0x30,0xF4,0x00,0x08,0x0F,
+0xFF,0xE4,0x8F,0xCF,0x9E,0xF3,0xCF,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xF0,0x1F,0xC7,
+0x1E,0xF3,0xCF,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xF8,0x3F,0xE0,0x3E,0xF9,0xFE,0x70,
+0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xF0,0x7E,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,
+0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xCF,0x9E,
+0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFE,0x00,0x0F,0xCF,0x9E,0xFF,0xFF,0xF0,0xF4,
+0x00,0x08,0x0F,0xFE,0x00,0x0F,0x00,0x1E,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFE,
+0xFF,0x04,0x00,0x3E,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xF8,0x3F,0xCF,0xFE,
+0xFF,0xFE,0x30,0xF4,0x00,0x07,0x0F,0xFF,0xF0,0x1F,0xCF,0xFE,0xFF,0xFE,0xF3,0x00,
+0x07,0x0F,0xFF,0xE3,0x8F,0xFF,0xFE,0xFF,0xFE,0xF3,0x00,0x08,0x0F,0xFF,0xE7,0xCF,
+0xE6,0x3E,0xFF,0xFF,0xE0,0xF4,0x00,0x08,0x0F,0xFF,0xE7,0xCF,0xCC,0x1E,0xFF,0xFF,
+0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xF3,0x9F,0xCC,0x9E,0xFC,0x70,0xF0,0xF4,0x00,0x08,
+0x0F,0xFE,0x00,0x0F,0xC9,0x9E,0xF8,0x20,0x70,0xF4,0x00,0x08,0x0F,0xFE,0x00,0x0F,
+0xC1,0x9E,0xF0,0x00,0x30,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xE3,0x3E,0xF3,0x87,
+0x30,0xF4,0x00,0x08,0x0F,0xFF,0xF0,0x0F,0xFF,0xFE,0xF3,0xCF,0x30,0xF4,0x00,0x08,
+0x0F,0xFF,0xE0,0x0F,0xF9,0xFE,0xF3,0x8F,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0x8F,
+0xF9,0xFE,0xF3,0x87,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xF9,0xFE,0xF0,0x00,
+0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xF9,0xFE,0xF8,0x30,0x70,0xF4,0x00,0x08,
+0x0F,0xFF,0xE4,0xCF,0xF9,0xFE,0xFC,0x78,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE6,0x0F,
+0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xF2,0x1F,0xFF,0xFE,0xFF,0xF0,
+0xF0,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,0xE0,0x1E,0xFC,0x60,0x70,0xF4,0x00,0x00,
+0x0F,0xFE,0xFF,0x04,0xC0,0x1E,0xF8,0x20,0x30,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x04,
+0xCF,0xFE,0xF0,0x06,0x30,0xF4,0x00,0x08,0x0F,0xFE,0x00,0x0F,0xCF,0xFE,0xF3,0x8F,
+0x30,0xF4,0x00,0x08,0x0F,0xFE,0x00,0x0F,0xCF,0xFE,0xF3,0xCF,0x30,0xF4,0x00,0x00,
+0x0F,0xFE,0xFF,0x04,0xE7,0xFE,0xF3,0xCF,0x30,0xF4,0x00,0x00,0x0F,0xFE,0xFF,0x08,
+0xC0,0x1E,0xF3,0xCF,0x30,0x00,0x00,0x07,0xE0,0xF8,0x00,0x0C,0x0F,0xFF,0x3F,0xFF,
+0xC0,0x1E,0xF9,0xFE,0x70,0x00,0x00,0x07,0xE0,0xF8,0x00,0x0C,0x0F,0xFF,0x20,0x0F,
+0xFF,0xFE,0xFF,0xFF,0xF0,0x00,0x00,0x06,0x60,0xF8,0x00,0x0C,0x0F,0xFF,0x20,0x0F,
+0xFF,0xFE,0xFF,0xFF,0xF0,0x00,0x00,0x06,0x60,0xF8,0x00,0x0C,0x0F,0xFF,0xFF,0xFE,
+0x7F,0xFE,0xFF,0xFF,0xF0,0x00,0x00,0x07,0xE0,0xF8,0x00,0x0C,0x0F,0xFF,0xF0,0x0E,
+0x40,0x1E,0xFF,0xFF,0xF0,0x00,0x00,0x07,0xE0,0xF8,0x00,0x08,0x0F,0xFF,0xE0,0x0E,
+0x40,0x1E,0xFF,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0x8F,0xFF,0xFE,0xFF,0xFF,
+0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE4,0xCF,0xFF,0xFE,0xFF,0xFE,0x30,0xF4,0x00,0x07,
+0x0F,0xFF,0xE4,0xCF,0xFF,0xFE,0xFF,0xFE,0xF3,0x00,0x07,0x0F,0xFF,0xE4,0xCF,0xFF,
+0xFE,0xFF,0xFE,0xF3,0x00,0x08,0x0F,0xFF,0xE6,0x0F,0xFF,0xFE,0xFF,0xFF,0xE0,0xF4,
+0x00,0x08,0x0F,0xFF,0xF2,0x1F,0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,
+0xFF,0x03,0xFE,0xF1,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xF0,0x7F,
+0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE1,0xFF,0xFF,0xFE,0xF0,0x0F,0xF0,0xF4,0x00,0x08,
+0x0F,0xFF,0xE0,0x3F,0xFF,0xFE,0xF2,0x03,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xFE,0x0F,
+0xFF,0xFE,0xF3,0x80,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xFF,0xCF,0xFF,0xFE,0xF3,0xF0,
+0x30,0xF4,0x00,0x08,0x0F,0xFF,0xFE,0x0F,0xFF,0xFE,0xF3,0xFC,0x30,0xF4,0x00,0x08,
+0x0F,0xFF,0xE0,0x3F,0xFF,0xFE,0xF3,0xFF,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xE1,0xFF,
+0xFF,0xFE,0xF3,0xFF,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xFF,0xEF,0xFF,0xFE,0xFF,0xFF,
+0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xFF,0x8F,0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x08,
+0x0F,0xFF,0xFC,0x0F,0xFF,0xFE,0xFF,0xF0,0xF0,0xF4,0x00,0x08,0x0F,0xFF,0xE0,0x3F,
+0xFF,0xFE,0xFC,0x60,0x70,0xF4,0x00,0x08,0x0F,0xFF,0x80,0x7F,0xFF,0xFE,0xF8,0x20,
+0x30,0xF4,0x00,0x08,0x0F,0xFF,0x06,0x7F,0xFF,0xFE,0xF0,0x06,0x30,0xF4,0x00,0x08,
+0x0F,0xFF,0x3E,0x7F,0xFF,0xFE,0xF3,0x8F,0x30,0xF4,0x00,0x08,0x0F,0xFF,0x02,0x7F,
+0xFF,0xFE,0xF3,0xCF,0x30,0xF4,0x00,0x08,0x0F,0xFF,0xC0,0x7F,0xFF,0xFE,0xF3,0xCF,
+0x30,0xF4,0x00,0x08,0x0F,0xFF,0xF8,0x0F,0xFF,0xFE,0xF3,0xCF,0x30,0xF4,0x00,0x08,
+0x0F,0xFF,0xFF,0x0F,0xFF,0xFE,0xF9,0xFE,0x70,0xF4,0x00,0x08,0x0F,0xFF,0xFF,0xEF,
+0xFF,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,
+0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,
+0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,
+0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,
+0xFD,0xFF,0x03,0xFE,0xFF,0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xFD,0xFF,0x03,0xFE,0xFF,
+0xFF,0xF0,0xF4,0x00,0x00,0x0F,0xA9,0xFF,
+};
+
+#endif
@@ -75,56 +75,36 @@ const uint8_t GxGDEW027C44::lut_24_black[] = {
 
 GxGDEW027C44::GxGDEW027C44(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#elif GxEPD_INTERLEAVED_3C
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer) / 2);
+#else
+  _initFrameBuffer<FrameBuffer>(_black_buffer, _red_buffer, sizeof(_black_buffer));
+#endif
 }
 
 void GxGDEW027C44::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW027C44_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW027C44_WIDTH - x - 1;
-      y = GxGDEW027C44_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW027C44_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW027C44_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW027C44_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW027C44_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW027C44_WIDTH / 8;
-  }
+void GxGDEW027C44::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+void GxGDEW027C44::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW027C44::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 
@@ -143,6 +123,7 @@ void GxGDEW027C44::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -150,35 +131,29 @@ void GxGDEW027C44::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW027C44::fillScreen(uint16_t color)
 {
-  uint8_t black = 0x00;
-  uint8_t red = 0x00;
-  if (color == GxEPD_WHITE);
-  else if (color == GxEPD_BLACK) black = 0xFF;
-  else if (color == GxEPD_RED) red = 0xFF;
-  else if ((color & 0xF100) > (0xF100 / 2))  red = 0xFF;
-  else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = 0xFF;
-  for (uint16_t x = 0; x < sizeof(_black_buffer); x++)
-  {
-    _black_buffer[x] = black;
-    _red_buffer[x] = red;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW027C44::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
+  IO.startTransaction();
   for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
   {
-    _writeData((i < sizeof(_black_buffer)) ? _black_buffer[i] : 0x00);
+    IO.writeData((i < _fb_size) ? _planeByte(0, i) : 0x00);
   }
+  IO.endTransaction();
   _writeCommand(0x13);
+  IO.startTransaction();
   for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
   {
-    _writeData((i < sizeof(_red_buffer)) ? _red_buffer[i] : 0x00);
+    IO.writeData((i < _fb_size) ? _planeByte(1, i) : 0x00);
   }
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -198,40 +173,19 @@ void GxGDEW027C44::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t
 void GxGDEW027C44::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true;
     _wakeUp();
     _setPartialRamArea(0x14, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < black_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
-#else
-        data = black_bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, black_bitmap, black_size, GxGDEW027C44_BUFFER_SIZE, mode & bm_invert, 0x00);
+    IO.endTransaction();
     _setPartialRamArea(0x15, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < red_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
-#else
-        data = red_bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, red_bitmap, red_size, GxGDEW027C44_BUFFER_SIZE, mode & bm_invert, 0x00);
+    IO.endTransaction();
     _refreshWindow(0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
     _waitWhileBusy("drawPicture");
   }
@@ -240,35 +194,13 @@ void GxGDEW027C44::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < black_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
-#else
-        data = black_bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, black_bitmap, black_size, GxGDEW027C44_BUFFER_SIZE, mode & bm_invert, 0x00);
+    IO.endTransaction();
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < red_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
-#else
-        data = red_bitmap[i];
-#endif
-        if (mode & bm_invert_red) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, red_bitmap, red_size, GxGDEW027C44_BUFFER_SIZE, mode & bm_invert_red, 0x00);
+    IO.endTransaction();
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("drawPicture");
     _sleep();
@@ -278,31 +210,23 @@ void GxGDEW027C44::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
 void GxGDEW027C44::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_default) mode |= bm_normal; // no change
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true;
     _wakeUp();
     _setPartialRamArea(0x14, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW027C44_BUFFER_SIZE, mode & bm_invert, 0x00);
+    IO.endTransaction();
     _setPartialRamArea(0x15, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
+    IO.startTransaction();
     for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      _writeData(0);
+      IO.writeData(0);
     }
+    IO.endTransaction();
     _refreshWindow(0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
     _waitWhileBusy("drawBitmap");
   }
@@ -311,25 +235,16 @@ void GxGDEW027C44::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW027C44_BUFFER_SIZE, mode & bm_invert, 0x00);
+    IO.endTransaction();
     _writeCommand(0x13);
+    IO.startTransaction();
     for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      _writeData(0);
+      IO.writeData(0);
     }
+    IO.endTransaction();
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -339,20 +254,15 @@ void GxGDEW027C44::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
 void GxGDEW027C44::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
     _using_partial_mode = true; // remember
     _setPartialRamArea(0x14, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    IO.writeDataPatternTransaction(0x00, GxGDEW027C44_BUFFER_SIZE);
     _setPartialRamArea(0x15, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    IO.writeDataPatternTransaction(0x00, GxGDEW027C44_BUFFER_SIZE);
     _refreshWindow(0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
     _waitWhileBusy("drawBitmap");
   }
@@ -361,15 +271,9 @@ void GxGDEW027C44::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    IO.writeDataPatternTransaction(0x00, GxGDEW027C44_BUFFER_SIZE);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    IO.writeDataPatternTransaction(0x00, GxGDEW027C44_BUFFER_SIZE);
     _writeCommand(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -379,6 +283,7 @@ void GxGDEW027C44::eraseDisplay(bool using_partial_update)
 void GxGDEW027C44::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -409,6 +314,7 @@ void GxGDEW027C44::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW027C44::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -455,26 +361,22 @@ void GxGDEW027C44::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   h = gx_uint16_min(h, GxGDEW027C44_HEIGHT - yd);
   _setPartialRamArea(0x14, xd, yd, w, h);
   int16_t xe = (xs / 8) + (w / 8);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 < ys + h; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 < xe; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-      IO.writeDataTransaction(data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW027C44_WIDTH / 8) + xs / 8;
+    _writePlaneData(IO, 0, idx, xe - xs / 8, false, 0x00);
   }
+  IO.endTransaction();
   delay(2);
   _setPartialRamArea(0x15, xd, yd, w, h);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 < ys + h; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 < xe; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-      IO.writeDataTransaction(data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW027C44_WIDTH / 8) + xs / 8;
+    _writePlaneData(IO, 1, idx, xe - xs / 8, false, 0x00);
   }
+  IO.endTransaction();
   delay(2);
 }
 
@@ -525,15 +427,9 @@ void GxGDEW027C44::_writeData(uint8_t data)
 void GxGDEW027C44::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
+  if (!_waitBusy(_busy, LOW, 20000000)) // > 15.5s !
   {
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 20000000) // > 15.5s !
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -632,76 +528,73 @@ void GxGDEW027C44::_sleep(void)
 
 void GxGDEW027C44::_writeLUT(void)
 {
-  unsigned int count;
   {
     _writeCommand(0x20);							//vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC[count]);
-    }
+    IO.writeDataTransaction(lut_20_vcomDC, 44);
 
     _writeCommand(0x21);							//ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21[count]);
-    }
+    IO.writeDataTransaction(lut_21, 42);
 
     _writeCommand(0x22);							//bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_red[count]);
-    }
+    IO.writeDataTransaction(lut_22_red, 42);
 
     _writeCommand(0x23);							//wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_white[count]);
-    }
+    IO.writeDataTransaction(lut_23_white, 42);
 
     _writeCommand(0x24);							//bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_black[count]);
-    }
+    IO.writeDataTransaction(lut_24_black, 42);
   }
 }
 
 void GxGDEW027C44::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback();
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback();
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(1, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
-  _current_page = -1;
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -710,39 +603,52 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(void))
 void GxGDEW027C44::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(1, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
-  _current_page = -1;
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -751,39 +657,52 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW027C44::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(1, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
-  _current_page = -1;
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -792,39 +711,52 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW027C44::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p1, p2);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(0, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
+    {
+      drawCallback(p1, p2);
+      _endRecording();
+    }
+    IO.startTransaction();
+    for (int16_t y1 = 0; y1 < int16_t(_pageSize() / (GxGDEW027C44_WIDTH / 8)); y1++)
     {
       for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
       {
         uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
+        uint8_t data = (idx < _fb_size) ? _planeByte(1, idx) : 0x00;
+        IO.writeData(data);
       }
     }
+    IO.endTransaction();
   }
-  _current_page = -1;
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -854,6 +786,7 @@ void GxGDEW027C44::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -861,26 +794,31 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027C44_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027C44_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -888,27 +826,32 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027C44_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027C44_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
       //fillScreen(p);
-      uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -916,26 +859,31 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027C44_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027C44_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -943,21 +891,25 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027C44_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027C44_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027C44::drawCornerTest(uint8_t em)
@@ -966,6 +918,7 @@ void GxGDEW027C44::drawCornerTest(uint8_t em)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW027C44_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW027C44_WIDTH / 8; x++)
@@ -975,14 +928,17 @@ void GxGDEW027C44::drawCornerTest(uint8_t em)
       if ((x > GxGDEW027C44_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW027C44_WIDTH / 8 - 4) && (y > GxGDEW027C44_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW027C44_HEIGHT - 33)) data = 0x00;
-      _writeData(~data);
+      IO.writeData(~data);
     }
   }
+  IO.endTransaction();
   _writeCommand(0x13);
+  IO.startTransaction();
   for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
   {
-    _writeData(0);
+    IO.writeData(0);
   }
+  IO.endTransaction();
   _writeCommand(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
@@ -0,0 +1,596 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h BitmapWaveshare.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 5808 bytes, packed 2491
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xB0,0x16,0x00,0x00,0x81,0xFF,0xC2,0xFF,0x01,0xFC,0x01,0xED,0xFF,0x02,0xC0,0x00,
+0x1F,0xEE,0xFF,0x02,0x80,0x00,0x03,0xEF,0xFF,0x00,0xFE,0xFE,0x00,0xEF,0xFF,0x00,
+0xFC,0xFE,0x00,0x00,0x3F,0xF0,0xFF,0x04,0xF8,0x03,0xFE,0x00,0x0F,0xF0,0xFF,0x04,
+0xF0,0x0F,0xFF,0xC0,0x03,0xF0,0xFF,0x04,0xF0,0x3F,0xFF,0xF8,0x01,0xF0,0xFF,0x05,
+0xE0,0x7F,0xFF,0xFE,0x00,0x7F,0xF1,0xFF,0x00,0xE0,0xFE,0xFF,0x01,0x80,0x3F,0xF1,
+0xFF,0x00,0xE0,0xFE,0xFF,0x01,0xE0,0x1F,0xF1,0xFF,0x00,0xC1,0xFE,0xFF,0x01,0xF0,
+0x0F,0xF1,0xFF,0x00,0xC1,0xFE,0xFF,0x01,0xFC,0x07,0xF1,0xFF,0x00,0xC1,0xFE,0xFF,
+0x01,0xFE,0x03,0xF1,0xFF,0x00,0xC1,0xFD,0xFF,0x00,0x01,0xF1,0xFF,0x00,0xE0,0xFD,
+0xFF,0x00,0x80,0xF1,0xFF,0x00,0xE0,0xFD,0xFF,0x01,0xC0,0x7F,0xF2,0xFF,0x01,0xE0,
+0x7F,0xFE,0xFF,0x01,0xE0,0x7F,0xF2,0xFF,0x01,0xF0,0x3F,0xFE,0xFF,0x01,0xF0,0x3F,
+0xF2,0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x01,0xF8,0x1F,0xF2,0xFF,0x01,0xF8,0x0F,0xFE,
+0xFF,0x01,0xF8,0x0F,0xF2,0xFF,0x01,0xFC,0x03,0xFE,0xFF,0x01,0xFC,0x0F,0xF2,0xFF,
+0x01,0xFE,0x00,0xFE,0xFF,0x01,0xFE,0x07,0xF1,0xFF,0x05,0x00,0x3F,0xFF,0xFF,0xFE,
+0x07,0xF1,0xFF,0x01,0x80,0x1F,0xFE,0xFF,0x00,0x03,0xF1,0xFF,0x01,0xE0,0x1F,0xFE,
+0xFF,0x00,0x83,0xF1,0xFF,0x01,0x80,0x1F,0xFE,0xFF,0x00,0x03,0xF1,0xFF,0x05,0x00,
+0x3F,0xFF,0xFF,0xFE,0x07,0xF2,0xFF,0x01,0xFE,0x00,0xFE,0xFF,0x01,0xFE,0x07,0xF2,
+0xFF,0x01,0xFC,0x03,0xFE,0xFF,0x01,0xFC,0x0F,0xF2,0xFF,0x01,0xF8,0x0F,0xFE,0xFF,
+0x01,0xF8,0x1F,0xF2,0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x01,0xF8,0x1F,0xFA,0xFF,0x01,
+0xFE,0x03,0xFB,0xFF,0x01,0xF0,0x3F,0xFE,0xFF,0x01,0xF0,0x3F,0xFA,0xFF,0x01,0x00,
+0x01,0xFB,0xFF,0x01,0xE0,0x7F,0xFE,0xFF,0x01,0xE0,0x7F,0xFB,0xFF,0x02,0xFC,0x00,
+0x00,0xFB,0xFF,0x00,0xE0,0xFD,0xFF,0x00,0xC0,0xFA,0xFF,0x03,0xF8,0x00,0x00,0x7F,
+0xFC,0xFF,0x00,0xE0,0xFD,0xFF,0x00,0x80,0xFA,0xFF,0x03,0xF0,0x00,0x00,0x3F,0xFC,
+0xFF,0x00,0xC1,0xFD,0xFF,0x00,0x01,0xFA,0xFF,0x03,0xF0,0x00,0x70,0x1F,0xFC,0xFF,
+0x00,0xC1,0xFE,0xFF,0x01,0xFE,0x03,0xFA,0xFF,0x03,0xE0,0x70,0x38,0x1F,0xFC,0xFF,
+0x00,0xC1,0xFE,0xFF,0x01,0xFC,0x07,0xFA,0xFF,0x03,0xE0,0xF8,0x3C,0x1F,0xFC,0xFF,
+0x00,0xC1,0xFE,0xFF,0x01,0xF0,0x0F,0xFA,0xFF,0x03,0x80,0xFC,0x7E,0x0F,0xFC,0xFF,
+0x00,0xE0,0xFE,0xFF,0x01,0xC0,0x1F,0xFA,0xFF,0x03,0x00,0xFF,0xFC,0x03,0xFC,0xFF,
+0x00,0xE0,0xFE,0xFF,0x01,0x80,0x3F,0xFB,0xFF,0x04,0xFE,0x01,0xFF,0xF0,0x01,0xFC,
+0xFF,0x04,0xE0,0x7F,0xFF,0xFE,0x00,0xFA,0xFF,0x04,0xFE,0x03,0xFF,0xE0,0x00,0xFC,
+0xFF,0x04,0xF0,0x3F,0xFF,0xF8,0x01,0xFA,0xFF,0x05,0xFC,0x0F,0xFF,0xE0,0x00,0x7F,
+0xFD,0xFF,0x04,0xF0,0x0F,0xFF,0xC0,0x03,0xFA,0xFF,0x05,0xFC,0x1F,0xFF,0xC0,0x00,
+0x7F,0xFD,0xFF,0x04,0xF8,0x01,0xFC,0x00,0x0F,0xFA,0xFF,0x05,0xF8,0x1F,0xFF,0xC0,
+0xF0,0x3F,0xFD,0xFF,0x00,0xFC,0xFE,0x00,0x00,0x3F,0xFA,0xFF,0x05,0xF8,0x3F,0xFF,
+0x81,0xF8,0x3F,0xFD,0xFF,0x00,0xFE,0xFE,0x00,0xF9,0xFF,0x05,0xF8,0x3F,0xFF,0x83,
+0xF8,0x1F,0xFC,0xFF,0x02,0x80,0x00,0x03,0xF9,0xFF,0x05,0xF8,0x3F,0xFF,0xC7,0xFC,
+0x1F,0xFC,0xFF,0x02,0xE0,0x00,0x1F,0xF9,0xFF,0x05,0xF8,0x3F,0xFF,0xEF,0xFC,0x1F,
+0xFC,0xFF,0x01,0xFE,0x03,0xF8,0xFF,0x05,0xF8,0x1F,0xFF,0xFF,0xFC,0x1F,0xF1,0xFF,
+0x05,0xFC,0x0F,0xFF,0xFF,0xFC,0x1F,0xF1,0xFF,0x05,0xFC,0x07,0xFF,0xFF,0xF8,0x1F,
+0xF1,0xFF,0x05,0xFC,0x07,0xFF,0xFF,0xF0,0x1F,0xF1,0xFF,0x05,0xFC,0x07,0xFF,0xFF,
+0xE0,0x1F,0xF1,0xFF,0x05,0xFC,0x07,0xFF,0xFF,0xE0,0x0F,0xF1,0xFF,0x05,0xFC,0x07,
+0xFF,0xFF,0xF0,0x07,0xF1,0xFF,0x05,0xF8,0x3F,0xFF,0xFF,0xFC,0x03,0xF1,0xFF,0x01,
+0xF8,0x3F,0xFE,0xFF,0x00,0x03,0xF1,0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x00,0x81,0xF1,
+0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x00,0xC1,0xF1,0xFF,0x01,0xF8,0x1F,0xFE,0xFF,0x00,
+0xC1,0xF1,0xFF,0x01,0xFC,0x0F,0xFE,0xFF,0x00,0xC0,0xF1,0xFF,0x01,0xFC,0x07,0xFE,
+0xFF,0x00,0xE0,0xF1,0xFF,0x01,0xFE,0x07,0xFE,0xFF,0x00,0xE0,0xF1,0xFF,0x01,0xFE,
+0x03,0xFE,0xFF,0x00,0xE0,0xF1,0xFF,0x01,0xFE,0x03,0xFE,0xFF,0x00,0xE0,0xF1,0xFF,
+0x01,0xFE,0x03,0xFE,0xFF,0x00,0xE0,0xF1,0xFF,0x01,0xFE,0x07,0xFE,0xFF,0x00,0xC0,
+0xF1,0xFF,0x01,0xFE,0x0F,0xFE,0xFF,0x00,0xC1,0xF1,0xFF,0x01,0xFC,0x1F,0xFE,0xFF,
+0x00,0xC1,0xF1,0xFF,0x01,0xFE,0x0F,0xFE,0xFF,0x00,0x81,0xF1,0xFF,0x01,0xFE,0x0F,
+0xFE,0xFF,0x00,0x03,0xF1,0xFF,0x05,0xFE,0x0F,0xFF,0xFF,0xFE,0x03,0xF1,0xFF,0x05,
+0xFE,0x01,0xFF,0xFF,0xFC,0x07,0xF1,0xFF,0x05,0xFE,0x01,0xFF,0xFF,0xFC,0x0F,0xF0,
+0xFF,0x04,0x00,0xFF,0xFF,0xFC,0x07,0xF0,0xFF,0x04,0x00,0xFF,0xFF,0xFE,0x07,0xF0,
+0xFF,0x00,0x81,0xFE,0xFF,0x00,0x07,0xF0,0xFF,0x00,0x81,0xFE,0xFF,0x00,0x07,0xF0,
+0xFF,0x00,0x83,0xFE,0xFF,0x00,0x00,0xF0,0xFF,0x00,0x83,0xFE,0xFF,0x01,0x00,0x7F,
+0xF1,0xFF,0x00,0x83,0xFE,0xFF,0x01,0x00,0x3F,0xF1,0xFF,0x00,0x83,0xFE,0xFF,0x01,
+0x00,0x3F,0xF1,0xFF,0x00,0x83,0xFE,0xFF,0x01,0x00,0x3F,0xF1,0xFF,0x00,0x83,0xFE,
+0xFF,0x01,0x00,0x3F,0xF1,0xFF,0x05,0x83,0xFF,0xFF,0xF8,0x00,0x1F,0xF1,0xFF,0x05,
+0x81,0xFF,0xFF,0xF0,0x00,0x0F,0xF1,0xFF,0x05,0xC1,0xFF,0xFF,0xF0,0x00,0x0F,0xF1,
+0xFF,0x05,0xC0,0xFF,0xFF,0xF0,0x00,0x07,0xF1,0xFF,0x05,0xC0,0x7F,0xFF,0xF0,0x00,
+0x07,0xF1,0xFF,0x05,0xE0,0x01,0xF8,0xF0,0x00,0x03,0xF1,0xFF,0x05,0xF0,0x00,0xF0,
+0x70,0x20,0x03,0xF1,0xFF,0x05,0xF8,0x00,0xF0,0x70,0x7C,0x03,0xF1,0xFF,0x05,0xFC,
+0x01,0xF0,0x60,0x7C,0x03,0xF0,0xFF,0x04,0x01,0xF0,0x40,0x7E,0x03,0xF0,0xFF,0x04,
+0xC0,0xE0,0x00,0xFF,0x07,0xF0,0xFF,0x04,0xE0,0xC0,0x01,0xFF,0x8F,0xF0,0xFF,0x02,
+0xE0,0x00,0x01,0xEE,0xFF,0x02,0xF0,0x00,0x03,0xFC,0xFF,0x03,0xFE,0x7F,0xFF,0xF3,
+0xF7,0xFF,0x02,0xF0,0x02,0x0F,0xFC,0xFF,0x03,0xFC,0x1F,0xFF,0xE1,0xF7,0xFF,0x01,
+0xF8,0x07,0xFB,0xFF,0x03,0xFC,0x0F,0xFF,0xC1,0xF7,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,
+0x03,0xF8,0x0F,0xFF,0x81,0xEF,0xFF,0x03,0xF8,0x07,0xFF,0x01,0xEF,0xFF,0x03,0xF8,
+0x03,0xFE,0x01,0xEF,0xFF,0x03,0xF8,0x01,0xFC,0x01,0xEF,0xFF,0x03,0xF8,0x00,0xF8,
+0x01,0xEF,0xFF,0x03,0xF8,0x00,0x70,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x20,0x01,0xEF,
+0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,
+0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,
+0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,
+0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,
+0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,
+0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x00,0xF8,0xFE,0x00,
+0xEF,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xF0,0xFF,0x00,0xF0,0xFE,0x00,0x00,0x7F,
+0xF0,0xFF,0x00,0xE0,0xFE,0x00,0x00,0x3F,0xF0,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x1F,
+0xF0,0xFF,0x00,0x80,0xFE,0x00,0x00,0x0F,0xF0,0xFF,0xFD,0x00,0x00,0x07,0xF1,0xFF,
+0x00,0xFE,0xFD,0x00,0x00,0x03,0xF1,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x01,0xF1,0xFF,
+0x00,0xFC,0xFD,0x00,0x00,0x01,0xF1,0xFF,0x00,0xF8,0xFC,0x00,0xF1,0xFF,0x00,0xF0,
+0xFC,0x00,0x00,0x7F,0xF2,0xFF,0x00,0xE0,0xFC,0x00,0x00,0x3F,0xF2,0xFF,0x00,0xE0,
+0xFC,0x00,0x00,0x3F,0xF2,0xFF,0x00,0xE0,0xFC,0x00,0x00,0x3F,0xF2,0xFF,0x00,0xF0,
+0xFC,0x00,0x00,0x7F,0xF2,0xFF,0x00,0xF8,0xFC,0x00,0xF1,0xFF,0x00,0xFC,0xFD,0x00,
+0x00,0x01,0xF1,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x01,0xF1,0xFF,0x00,0xFE,0xFD,0x00,
+0x00,0x03,0xF0,0xFF,0xFD,0x00,0x00,0x07,0xF0,0xFF,0x00,0x80,0xFE,0x00,0x00,0x0F,
+0xF0,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x1F,0xF0,0xFF,0x00,0xE0,0xFE,0x00,0x00,0x3F,
+0xF0,0xFF,0x00,0xF0,0xFE,0x00,0x00,0x7F,0xF0,0xFF,0x00,0xF8,0xFE,0x00,0xEF,0xFF,
+0x00,0xF8,0xFE,0x00,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,
+0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,
+0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,
+0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,
+0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,
+0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,0xFF,0x03,0xF8,0x00,0x00,0x01,0xEF,
+0xFF,0x03,0xF8,0x00,0x20,0x01,0xF8,0xFF,0x00,0x8F,0xF9,0xFF,0x03,0xF8,0x00,0x70,
+0x01,0xF8,0xFF,0x00,0x0F,0xF9,0xFF,0x03,0xF8,0x00,0xF8,0x01,0xF9,0xFF,0x01,0xFE,
+0x07,0xF9,0xFF,0x03,0xF8,0x01,0xFC,0x01,0xF9,0xFF,0x01,0xFE,0x07,0xF9,0xFF,0x03,
+0xF8,0x03,0xFE,0x01,0xFD,0xFF,0x05,0xFC,0x00,0x3F,0xFF,0xFE,0x07,0xF9,0xFF,0x03,
+0xF8,0x07,0xFF,0x01,0xFD,0xFF,0x05,0xF8,0x00,0x3F,0xFF,0xFE,0x07,0xF9,0xFF,0x03,
+0xF8,0x0F,0xFF,0x81,0xFD,0xFF,0x05,0xF8,0x00,0x7F,0xFF,0xFE,0x03,0xF9,0xFF,0x03,
+0xF8,0x1F,0xFF,0xC1,0xFC,0xFF,0x04,0xBE,0xBF,0xFF,0xFC,0x03,0xFB,0xFF,0x05,0x3F,
+0xFF,0xFC,0x3F,0xFF,0xE1,0xFC,0xFF,0x04,0x3F,0x3F,0xFF,0xFC,0x03,0xFC,0xFF,0x06,
+0xFE,0x1F,0xFF,0xFE,0x7F,0xFF,0xF3,0xFC,0xFF,0x04,0x1F,0x3F,0xFF,0xFC,0x03,0xFC,
+0xFF,0x01,0xFC,0x0F,0xF7,0xFF,0x04,0x00,0x7F,0xFF,0xFC,0x03,0xFC,0xFF,0x01,0xFC,
+0x07,0xF7,0xFF,0x04,0x80,0xFF,0xFF,0xF8,0x01,0xFC,0xFF,0x01,0xFC,0x07,0xF7,0xFF,
+0x04,0xC1,0xFF,0xFF,0xF8,0x01,0xFC,0xFF,0x01,0xFC,0x03,0xF4,0xFF,0x01,0xF8,0x01,
+0xFC,0xFF,0x01,0xFC,0x03,0xF7,0xFF,0x04,0xCE,0x7F,0xFF,0xF8,0x01,0xFC,0xFF,0x01,
+0xFC,0x01,0xF7,0xFF,0x04,0x9C,0x3F,0xFF,0xF0,0x00,0xFC,0xFF,0x01,0xFC,0x00,0xF7,
+0xFF,0x04,0x3E,0x3F,0xFF,0xF0,0x00,0xFC,0xFF,0x04,0xFC,0x00,0xFF,0xFC,0x7F,0xFA,
+0xFF,0x04,0x3F,0x3F,0xFF,0xF0,0x00,0xFC,0xFF,0x04,0xFC,0x00,0x7F,0xE0,0x3F,0xFA,
+0xFF,0x04,0x1F,0x3F,0xFF,0xF0,0x00,0xFC,0xFF,0x04,0xFC,0x00,0x7F,0x00,0x3F,0xFA,
+0xFF,0x05,0x00,0x7F,0xFF,0xE0,0x00,0x7F,0xFD,0xFF,0x04,0xFC,0x10,0x38,0x00,0x3F,
+0xFA,0xFF,0x05,0x80,0xFF,0xFF,0x80,0x00,0x1F,0xFD,0xFF,0x04,0xFC,0x18,0x00,0x00,
+0x7F,0xFA,0xFF,0x05,0xC1,0xFF,0xFC,0x00,0x00,0x03,0xFD,0xFF,0x04,0xFC,0x18,0x00,
+0x00,0x7F,0xF9,0xFF,0x01,0xBF,0xF0,0xFE,0x00,0xFD,0xFF,0x03,0xFC,0x1C,0x00,0x00,
+0xF8,0xFF,0x01,0x3F,0x80,0xFE,0x00,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1C,0x00,0x40,
+0xF8,0xFF,0x00,0x3E,0xFD,0x00,0x00,0x07,0xFE,0xFF,0x03,0xFC,0x1E,0x03,0x81,0xF8,
+0xFF,0x00,0x3C,0xFD,0x00,0x00,0x01,0xFE,0xFF,0x03,0xFC,0x1F,0x1F,0x83,0xF8,0xFF,
+0x00,0x38,0xFD,0x00,0x00,0x01,0xFE,0xFF,0x03,0xF0,0x1F,0xFF,0x03,0xF8,0xFF,0x00,
+0x38,0xFD,0x00,0x00,0x01,0xFE,0xFF,0x03,0x80,0x1F,0xFF,0x07,0xFA,0xFF,0x02,0xFC,
+0x00,0x3C,0xFD,0x00,0x07,0x03,0xFF,0xFF,0xFE,0x00,0x1F,0xFE,0x07,0xFA,0xFF,0x02,
+0xF8,0x00,0x3E,0xFD,0x00,0x07,0x07,0xFF,0xFF,0xF0,0x00,0x3F,0xFC,0x0F,0xFA,0xFF,
+0x03,0xF8,0x00,0x7F,0xC0,0xFE,0x00,0x07,0x1F,0xFF,0xFF,0xC0,0x01,0xFF,0xFC,0x0F,
+0xF7,0xFF,0x00,0xF0,0xFE,0x00,0xFE,0xFF,0x04,0x80,0x07,0xFF,0xF8,0x1F,0xF7,0xFF,
+0x03,0xFC,0x00,0x00,0x03,0xFE,0xFF,0x04,0x00,0x3F,0xFF,0xF8,0x1F,0xFA,0xFF,0x06,
+0xFE,0x1F,0xBF,0xFF,0x80,0x00,0x1F,0xFE,0xFF,0x04,0x00,0x1F,0xFF,0xF8,0x1F,0xFA,
+0xFF,0x06,0xFC,0x0F,0x3F,0xFF,0xE0,0x00,0x7F,0xFE,0xFF,0x04,0x80,0x07,0xFF,0xF8,
+0x1F,0xFA,0xFF,0x05,0xF8,0x07,0x3F,0xFF,0xF0,0x00,0xFD,0xFF,0x04,0xC0,0x01,0xFF,
+0xFC,0x0F,0xFA,0xFF,0x05,0xF9,0xC3,0x3F,0xFF,0xF0,0x00,0xFD,0xFF,0x04,0xF8,0x00,
+0x3F,0xFC,0x0F,0xFA,0xFF,0x05,0xF9,0xE1,0x3F,0xFF,0xF0,0x00,0xFD,0xFF,0x04,0xFE,
+0x00,0x1F,0xFE,0x07,0xFA,0xFF,0x05,0xF8,0xF0,0x3F,0xFF,0xF0,0x00,0xFC,0xFF,0x03,
+0xC0,0x1F,0xFF,0x07,0xFA,0xFF,0x05,0xF8,0x78,0x3F,0xFF,0xF8,0x01,0xFC,0xFF,0x03,
+0xF0,0x1F,0xFF,0x03,0xFA,0xFF,0x05,0xFC,0xFC,0x7F,0xFF,0xF8,0x01,0xFC,0xFF,0x03,
+0xFC,0x1F,0x0F,0x83,0xF6,0xFF,0x01,0xF8,0x01,0xFC,0xFF,0x03,0xFC,0x1E,0x03,0x01,
+0xF9,0xFF,0x04,0xE3,0x7F,0xFF,0xF8,0x01,0xFC,0xFF,0x03,0xFC,0x1C,0x00,0x40,0xF9,
+0xFF,0x04,0xC2,0x3F,0xFF,0xFC,0x03,0xFC,0xFF,0x03,0xFC,0x1C,0x00,0x00,0xF9,0xFF,
+0x04,0x82,0x3F,0xFF,0xFC,0x03,0xFC,0xFF,0x04,0xFC,0x18,0x00,0x00,0x7F,0xFA,0xFF,
+0x04,0x33,0x3F,0xFF,0xFC,0x03,0xFC,0xFF,0x04,0xFC,0x18,0x00,0x00,0x7F,0xFA,0xFF,
+0x04,0x33,0x3F,0xFF,0xFC,0x03,0xFC,0xFF,0x04,0xFC,0x10,0x3C,0x00,0x3F,0xFA,0xFF,
+0x04,0x13,0x3F,0xFF,0xFE,0x03,0xFC,0xFF,0x04,0xFC,0x00,0x7F,0x00,0x3F,0xFA,0xFF,
+0x04,0x00,0x7F,0xFF,0xFE,0x07,0xFC,0xFF,0x04,0xFC,0x00,0x7F,0xE0,0x3F,0xFA,0xFF,
+0x04,0x80,0xFF,0xFF,0xFE,0x07,0xFC,0xFF,0x04,0xFC,0x00,0xFF,0xFC,0x7F,0xFA,0xFF,
+0x04,0xC1,0xFF,0xFF,0xFE,0x07,0xFC,0xFF,0x01,0xFC,0x00,0xF4,0xFF,0x01,0xFE,0x07,
+0xFC,0xFF,0x01,0xFC,0x01,0xF7,0xFF,0x04,0x80,0x0F,0xFF,0xFF,0x0F,0xFC,0xFF,0x01,
+0xFC,0x03,0xF7,0xFF,0x04,0x00,0x07,0xFF,0xFF,0x9F,0xFC,0xFF,0x01,0xFC,0x03,0xF7,
+0xFF,0x01,0x00,0x03,0xF9,0xFF,0x01,0xFC,0x07,0xF7,0xFF,0x01,0xBE,0xA3,0xF9,0xFF,
+0x01,0xFC,0x0F,0xF7,0xFF,0x01,0x3F,0x33,0xF9,0xFF,0x01,0xFC,0x0F,0xF7,0xFF,0x01,
+0x1F,0x33,0xF9,0xFF,0x01,0xFE,0x1F,0xF7,0xFF,0x01,0x00,0x73,0xF8,0xFF,0x00,0x3F,
+0xF7,0xFF,0x01,0x80,0xE7,0xED,0xFF,0x01,0xC1,0xEF,0xEC,0xFF,0x00,0xBF,0xED,0xFF,
+0x01,0xC0,0x3F,0xED,0xFF,0x01,0x80,0x7F,0xED,0xFF,0x01,0x00,0xBF,0xED,0xFF,0x01,
+0x27,0x3F,0xED,0xFF,0x01,0x23,0x3F,0xED,0xFF,0x01,0x23,0x3F,0xED,0xFF,0x01,0x10,
+0x3F,0xED,0xFF,0x01,0x10,0x7F,0xED,0xFF,0x00,0xB8,0xD6,0xFF,0x01,0xC0,0x3F,0xED,
+0xFF,0x01,0x80,0x3F,0xED,0xFF,0x01,0x00,0x7F,0xED,0xFF,0x00,0x3F,0xEC,0xFF,0x00,
+0x5F,0xEC,0xFF,0x01,0x80,0x3F,0xED,0xFF,0x01,0x80,0x3F,0xED,0xFF,0x01,0x00,0x7F,
+0xED,0xFF,0x00,0x3F,0xEC,0xFF,0x00,0x5F,0xEC,0xFF,0x01,0x80,0x3F,0xED,0xFF,0x01,
+0x00,0x3F,0xED,0xFF,0x01,0x00,0x7F,0xD8,0xFF,0x02,0xFC,0x00,0x3F,0xEE,0xFF,0x02,
+0xF8,0x00,0x3F,0xEE,0xFF,0x02,0xF8,0x00,0x7F,0xAC,0xFF,
+};
+
+// BitmapExample2 : 5808 bytes, packed 2087
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0xB0,0x16,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x03,0xFF,0xFF,0xFE,0x7F,0xFE,0xFF,0x01,0x1F,0xFC,0xFD,0xFF,0x00,0xBF,
+0xFC,0xFF,0x06,0xFC,0x0F,0xFF,0xFF,0xFC,0xFE,0x7F,0xFE,0xFF,0x06,0x1F,0x7C,0x1F,
+0xFF,0xFF,0xF3,0x9F,0xFC,0xFF,0x10,0xFC,0x00,0xFF,0xFF,0xFC,0xC0,0x40,0x3F,0xFF,
+0xFF,0x1E,0x38,0x0F,0xFF,0xFF,0x73,0x9F,0xFD,0xFF,0x12,0xFD,0xFC,0x00,0xFF,0xFF,
+0xFC,0xC0,0x40,0x3F,0xFF,0xFF,0x1E,0x1F,0x0F,0xFF,0xFE,0x73,0x00,0x07,0xFE,0xFF,
+0x12,0xFC,0x0C,0xC0,0x7F,0xFF,0xFC,0xC0,0x40,0x3F,0xFF,0xFF,0x1F,0x1F,0x8F,0xFF,
+0xFE,0x73,0x00,0x07,0xFE,0xFF,0x12,0xFC,0x04,0xFC,0x7F,0xFF,0xFC,0xCE,0x4E,0x7F,
+0xFF,0xFC,0x07,0x8F,0x8F,0xFF,0xFE,0x72,0x20,0x07,0xFE,0xFF,0x12,0xFC,0x04,0xCC,
+0x7F,0xFF,0xFC,0xCE,0x4E,0x7F,0xFF,0xFC,0x07,0x87,0x8F,0xFF,0xFE,0x72,0x24,0xCF,
+0xFE,0xFF,0x12,0xFC,0xC4,0xCC,0x7F,0xFF,0xFC,0xCE,0x4E,0x7F,0xFF,0xFC,0x07,0xC7,
+0x8F,0xFF,0xFE,0x70,0x64,0xCF,0xFE,0xFF,0x12,0xFC,0xC4,0xCC,0x7F,0xFF,0xFC,0xCE,
+0x4E,0x7F,0xFF,0xFC,0x04,0x00,0x0F,0xFF,0xFE,0x30,0xE4,0xCF,0xFE,0xFF,0x12,0xFC,
+0xC4,0xCC,0x7F,0xFF,0xFC,0x0E,0x4E,0x7F,0xFF,0xFF,0x1C,0x00,0x0F,0xFF,0xFF,0x31,
+0xE4,0xCF,0xFE,0xFF,0x12,0xFC,0xDC,0xCC,0x7F,0xFF,0xFC,0x00,0x4E,0x7F,0xFF,0xFF,
+0x1C,0x00,0x1F,0xFF,0xFF,0x00,0x24,0xCF,0xFE,0xFF,0x0C,0xF8,0xCC,0xCF,0xFF,0xFF,
+0xFC,0x00,0x4E,0x7F,0xFF,0xFF,0x1F,0xF1,0xFE,0xFF,0x02,0x00,0x24,0xCF,0xFE,0xFF,
+0x0C,0xF0,0x8C,0xCF,0xFF,0xFF,0xFC,0xC0,0x40,0x3F,0xFF,0xFF,0x1F,0xF8,0xFE,0xFF,
+0x02,0x00,0x24,0xCF,0xFE,0xFF,0x0C,0xF0,0x9C,0xCF,0xFF,0xFF,0xFC,0xCE,0x40,0x3F,
+0xFF,0xFF,0x1F,0xF8,0xFE,0xFF,0x02,0x31,0xE4,0xCF,0xFE,0xFF,0x12,0xF0,0xDC,0xCF,
+0xFF,0xFF,0xFC,0xCE,0x40,0x3F,0xFF,0xFC,0x07,0xFC,0x7F,0xFF,0xFF,0x30,0xE4,0xCF,
+0xFE,0xFF,0x0C,0xFC,0xFC,0xCF,0xFF,0xFF,0xFC,0xFE,0x7F,0xFF,0xFF,0xFC,0x06,0x7D,
+0xFE,0xFF,0x02,0x30,0x64,0xCF,0xFE,0xFF,0x02,0xFC,0xFC,0xCF,0xFD,0xFF,0x0B,0xF1,
+0xFF,0xFF,0xFC,0x04,0x00,0x0F,0xFF,0xFF,0x32,0x24,0xCF,0xFE,0xFF,0x02,0xFC,0x00,
+0xCF,0xFE,0xFF,0x0C,0x3F,0xF8,0xFF,0xFF,0xFC,0x04,0x00,0x0F,0xFF,0xFF,0x32,0x00,
+0x07,0xFE,0xFF,0x12,0xFC,0x00,0xCF,0xFF,0xFF,0xFE,0x30,0x00,0x7F,0xFF,0xFF,0x1F,
+0x00,0x0F,0xFF,0xFF,0x33,0x00,0x07,0xFE,0xFF,0x0C,0xFC,0x00,0xCF,0xFF,0xFF,0xF8,
+0x10,0x00,0x3F,0xFF,0xFF,0x1F,0x87,0xFE,0xFF,0x02,0x33,0x00,0x07,0xFC,0xFF,0x0A,
+0xCF,0xFF,0xFF,0xFC,0x70,0x00,0x7F,0xFF,0xFF,0x1F,0xC3,0xFE,0xFF,0x01,0x73,0x8F,
+0xFB,0xFF,0x04,0xCF,0xFF,0xFF,0xFD,0xF1,0xFD,0xFF,0x01,0x1F,0xE1,0xFE,0xFF,0x01,
+0xF3,0x9F,0xFB,0xFF,0x00,0xCF,0xFE,0xFF,0x00,0xF1,0xFC,0xFF,0x00,0xF7,0xFD,0xFF,
+0x00,0xBF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xE4,0xFF,
+0x00,0xE0,0xFE,0x00,0x00,0x3F,0xF0,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x01,0x7F,0xF1,
+0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF1,0xFF,0x00,0x07,0xFE,0xFF,0x02,0x40,0x00,
+0x5F,0xF3,0xFF,0x01,0xFE,0x0F,0xFE,0xFF,0x02,0xFE,0x00,0x07,0xF3,0xFF,0x01,0xFC,
+0x1F,0xFD,0xFF,0x02,0xF5,0x01,0x7F,0xF4,0xFF,0x01,0xFC,0x7F,0xFC,0xFF,0x01,0x80,
+0x0F,0xF4,0xFF,0x01,0xFC,0x7F,0xFC,0xFF,0x02,0xF0,0x01,0x7F,0xF5,0xFF,0x01,0xF8,
+0x7F,0xFC,0xFF,0x02,0xFE,0x00,0x3F,0xF5,0xFF,0x00,0xF1,0xFA,0xFF,0x01,0xD0,0x17,
+0xF5,0xFF,0x00,0xE1,0xFA,0xFF,0x01,0xFE,0x01,0xF5,0xFF,0x00,0xC1,0xF9,0xFF,0x01,
+0xC0,0x7F,0xFC,0xFF,0x00,0xDF,0xFC,0xFF,0x00,0xE3,0xF9,0xFF,0x01,0xE0,0x1F,0xFC,
+0xFF,0x00,0x8F,0xFC,0xFF,0x00,0xC7,0xF9,0xFF,0x01,0xFC,0x07,0xFC,0xFF,0x00,0x8F,
+0xFC,0xFF,0x00,0xC7,0xFE,0xFF,0x00,0xE0,0xFE,0x00,0x02,0x3F,0xFF,0x03,0xFC,0xFF,
+0x00,0x8F,0xFC,0xFF,0x00,0xC7,0xFE,0xFF,0x00,0xE0,0xFE,0x00,0x03,0x01,0x7F,0xC0,
+0x7F,0xFD,0xFF,0x00,0x87,0xFC,0xFF,0x04,0x8F,0xF0,0xFF,0xFF,0xE0,0xFD,0x00,0x02,
+0x03,0xF0,0x1F,0xFD,0xFF,0x00,0x87,0xFC,0xFF,0x04,0x1F,0xF0,0x1F,0xFF,0xE3,0xFE,
+0xFF,0x03,0x40,0x00,0x00,0x07,0xFD,0xFF,0x00,0xC7,0xFC,0xFF,0x04,0x0F,0xE0,0x03,
+0xFF,0xE3,0xFE,0xFF,0x03,0xFE,0x00,0x00,0x03,0xFD,0xFF,0x00,0xC7,0xFC,0xFF,0x04,
+0x1F,0xE3,0x03,0xFF,0xE3,0xFD,0xFF,0x03,0xFC,0x00,0x00,0x05,0xFE,0xFF,0x00,0xC7,
+0xFD,0xFF,0x04,0xFE,0x1F,0xE3,0xE3,0xFF,0xFE,0x00,0x09,0x07,0xFF,0xFF,0xFE,0x00,
+0x00,0x3F,0xFF,0xFF,0xC3,0xFD,0xFF,0x04,0xFC,0x3F,0xE3,0xE3,0xFF,0xFD,0x00,0x08,
+0x01,0xFF,0xFF,0xD0,0x00,0x01,0x7F,0xFF,0xC3,0xFD,0xFF,0x04,0xFC,0x3F,0xE3,0xE3,
+0xFE,0xFC,0x00,0x07,0x1F,0xFF,0xFC,0x28,0x00,0x03,0xFF,0xE3,0xFD,0xFF,0x11,0xFC,
+0x7F,0xE3,0xE3,0xFE,0x23,0xFF,0xFF,0xF0,0x00,0x05,0xFF,0xFC,0x1F,0xC0,0x00,0x5F,
+0xE3,0xFD,0xFF,0x05,0xF8,0x7F,0xE3,0xE3,0xFE,0x03,0xFE,0xFF,0x08,0xF8,0x00,0xFF,
+0xFE,0x1F,0xFE,0x00,0x00,0x23,0xFD,0xFF,0x05,0xF8,0x7F,0xE3,0xE3,0xFF,0x03,0xFD,
+0xFF,0x07,0xC0,0x1F,0xFF,0x1F,0xFF,0xF4,0x00,0x01,0xFD,0xFF,0x05,0xF8,0xFF,0xE3,
+0xE3,0xFF,0x03,0xFD,0xFF,0x07,0xF8,0x0F,0xFF,0x87,0xFF,0xFF,0x80,0x00,0xFD,0xFF,
+0x05,0xF0,0xFF,0xF1,0xE3,0xFF,0x83,0xFC,0xFF,0x02,0x07,0xFF,0xC7,0xFE,0xFF,0x00,
+0x00,0xFD,0xFF,0x07,0xF0,0xFF,0xF1,0xE3,0xFF,0xC3,0xFE,0x0F,0xFE,0xFF,0x02,0x81,
+0xFF,0xE3,0xFE,0xFF,0x00,0xF0,0xFD,0xFF,0x0D,0xF1,0xFF,0xF1,0xE3,0xFF,0xC1,0xFC,
+0x0F,0xFF,0xC0,0x3F,0xF1,0xFF,0xF1,0xFE,0xFF,0x00,0xF0,0xFE,0xFF,0x0E,0xFC,0x00,
+0x3F,0xF8,0xE3,0xFF,0xE1,0xFC,0x07,0xFF,0xC0,0x1F,0xF8,0x7F,0xF1,0xFE,0xFF,0x00,
+0xF0,0xFE,0xFF,0x0E,0xF8,0x00,0x3F,0xF8,0x63,0xFF,0xE1,0xFC,0x47,0xFF,0xC0,0x1F,
+0xFC,0x7F,0xF1,0xFE,0xFF,0x00,0xF0,0xFE,0xFF,0x0E,0xF8,0x00,0x7F,0xF8,0x63,0xFF,
+0xE0,0xFC,0x61,0xFF,0x87,0x07,0xFE,0x1F,0xF1,0xFE,0xFF,0x00,0xF8,0xFD,0xFF,0x0D,
+0xBE,0xBF,0xFC,0x63,0xFF,0xE0,0x7C,0x71,0xFF,0x07,0x07,0xFF,0x1F,0xF1,0xFE,0xFF,
+0x00,0xF8,0xFD,0xFF,0x0D,0x3A,0x3F,0xFC,0x23,0xFF,0xE0,0x3E,0xF8,0x7F,0x0F,0xC3,
+0xFF,0x87,0xF0,0xFE,0xFF,0x00,0xF8,0xFD,0xFF,0x0D,0x19,0x3F,0xFC,0x03,0xFF,0xE0,
+0x1F,0xFC,0x7F,0x1F,0xC3,0xFF,0xC7,0xF0,0xFE,0xFF,0x00,0xF8,0xFD,0xFF,0x0D,0x00,
+0x7F,0xFE,0x03,0xFF,0xE2,0x07,0xFE,0x1E,0x1F,0xE3,0xFF,0xE3,0xF8,0xFE,0xFF,0x00,
+0xF8,0xFD,0xFF,0x0D,0x80,0x7F,0xFF,0x03,0xFF,0xE3,0x01,0xFF,0x1E,0x3F,0xE1,0xFF,
+0xF1,0xF8,0xFE,0xFF,0x00,0xF8,0xFD,0xFF,0x0D,0xC0,0x7F,0xFF,0x83,0xFF,0xE3,0xE0,
+0xFF,0x84,0x3F,0xE1,0xFF,0xF0,0xF8,0xFE,0xFF,0x00,0xF8,0xFD,0xFF,0x11,0xFC,0x7F,
+0xFF,0xC3,0xFF,0xE3,0xF0,0x1F,0xC4,0x7F,0xF1,0xFF,0xF0,0x7C,0x7F,0xFF,0xFF,0xFD,
+0xFD,0xFF,0x0E,0xCC,0x1F,0xFF,0xC3,0xFF,0xE3,0xF8,0x0F,0xE0,0x7F,0xF1,0xFF,0xF8,
+0x7C,0x7F,0xFA,0xFF,0x0E,0x9C,0x17,0xFF,0xC1,0xFF,0xE3,0xFF,0x01,0xE0,0x7F,0xF1,
+0x00,0x00,0x7C,0x7F,0xFA,0xFF,0x0E,0x3E,0x03,0xFF,0xE0,0xFF,0xE3,0xFF,0x80,0xE0,
+0x7F,0xF8,0x00,0x00,0x1C,0x7F,0xFA,0xFF,0x0E,0x3F,0x01,0x7F,0xE0,0xFF,0xE3,0xFF,
+0xC0,0x10,0x7F,0xF8,0x00,0x00,0x1C,0x7F,0xFA,0xFF,0x0E,0x1F,0x20,0x07,0xE0,0x7F,
+0xE3,0xFF,0xF8,0x00,0x7F,0xF8,0x7F,0xFE,0x04,0x7F,0xFA,0xFF,0x0E,0x00,0x70,0x00,
+0x00,0x3F,0xE3,0xFF,0xFF,0x00,0x7F,0xFC,0x7F,0xFF,0x00,0x7F,0xFA,0xFF,0x09,0x80,
+0xFE,0x00,0x00,0x3F,0xE3,0xFF,0xFF,0xC0,0x7F,0xFE,0xFF,0x01,0x80,0x3F,0xFA,0xFF,
+0x09,0xC1,0xFF,0xF0,0x07,0x1F,0xE3,0xFF,0xFF,0xF0,0x17,0xFE,0xFF,0x01,0x80,0x3F,
+0xF9,0xFF,0x08,0xBF,0xFF,0xFF,0x0F,0xE3,0xFF,0xFF,0xFC,0x03,0xFE,0xFF,0x01,0x88,
+0x3F,0xF9,0xFF,0x04,0x3F,0xFF,0xFF,0x03,0xE3,0xFE,0xFF,0x00,0x01,0xFE,0xFF,0x01,
+0x84,0x1F,0xF9,0xFF,0x04,0x3F,0xFF,0xFF,0x81,0xE3,0xFE,0xFF,0x05,0xE0,0x3F,0xFF,
+0xFF,0x84,0x1F,0xF9,0xFF,0x04,0x3F,0xFF,0xFF,0xD1,0xE3,0xFE,0xFF,0x05,0xF4,0x05,
+0xFF,0xFF,0xC6,0x1F,0xF9,0xFF,0x04,0x3F,0xFF,0xFF,0xF0,0xE3,0xFE,0xFF,0x05,0xFE,
+0x00,0xFF,0xFF,0xE0,0x1F,0xF9,0xFF,0x04,0x3F,0xFF,0xFF,0xFC,0x63,0xFD,0xFF,0x04,
+0x40,0x7F,0xFF,0xF1,0x1F,0xFB,0xFF,0x06,0xFC,0x00,0x3F,0xFF,0xFF,0xFC,0x23,0xFD,
+0xFF,0x04,0xF8,0x0F,0xFF,0xF0,0x0F,0xFB,0xFF,0x06,0xF8,0x00,0x3F,0xFF,0xFF,0xFC,
+0x23,0xFD,0xFF,0x04,0xFC,0x05,0xFF,0xF8,0x07,0xFB,0xFF,0x06,0xF8,0x00,0x7F,0xFF,
+0xFF,0xFE,0x23,0xFC,0xFF,0x03,0x00,0xFF,0xF8,0x07,0xF5,0xFF,0x00,0x03,0xFC,0xFF,
+0x03,0xD0,0x1F,0xFC,0x07,0xF5,0xFF,0x00,0x03,0xFC,0xFF,0x03,0xF8,0x0F,0xFE,0x03,
+0xFB,0xFF,0x02,0xFE,0x1F,0xBF,0xFE,0xFF,0x00,0x03,0xFB,0xFF,0x02,0x05,0xFE,0x07,
+0xFB,0xFF,0x02,0xFC,0x0F,0x3F,0xFE,0xFF,0x00,0x83,0xFB,0xFF,0x02,0x80,0xFF,0x03,
+0xFB,0xFF,0x02,0xF8,0x07,0x3F,0xFE,0xFF,0x00,0xC3,0xFB,0xFF,0x02,0xF0,0x7F,0x03,
+0xFB,0xFF,0x02,0xF9,0xC3,0x3F,0xFE,0xFF,0x00,0xE3,0xFB,0xFF,0x02,0xF8,0x3F,0x83,
+0xFB,0xFF,0x02,0xF9,0xE1,0x3F,0xFE,0xFF,0x00,0xF7,0xFB,0xFF,0x02,0xFC,0x07,0xC1,
+0xFB,0xFF,0x02,0xF8,0xF0,0x3F,0xF6,0xFF,0x01,0x03,0xC1,0xFB,0xFF,0x02,0xF8,0x78,
+0x3F,0xF6,0xFF,0x01,0xC1,0xC1,0xFB,0xFF,0x02,0xFC,0xFC,0x7F,0xF6,0xFF,0x01,0xE0,
+0xE1,0xED,0xFF,0x01,0xF0,0x01,0xFA,0xFF,0x01,0xE3,0x7F,0xF6,0xFF,0x01,0xF8,0x00,
+0xFA,0xFF,0x01,0xC2,0x3F,0xF6,0xFF,0x02,0xFD,0x00,0x7F,0xFB,0xFF,0x01,0x82,0x3F,
+0xF5,0xFF,0x01,0xC0,0x7F,0xFB,0xFF,0x01,0x33,0x3F,0xF5,0xFF,0x01,0xF0,0x7F,0xFB,
+0xFF,0x01,0x33,0x3F,0xF5,0xFF,0x01,0xF8,0x3F,0xFB,0xFF,0x01,0x13,0x3F,0xF5,0xFF,
+0x01,0xF8,0x1F,0xFB,0xFF,0x01,0x00,0x7F,0xF5,0xFF,0x01,0xF8,0x0F,0xFB,0xFF,0x00,
+0x80,0xF4,0xFF,0x01,0xFC,0x07,0xFB,0xFF,0x00,0xC1,0xF4,0xFF,0x01,0xFC,0x03,0xED,
+0xFF,0x02,0xFC,0x01,0x7F,0xFC,0xFF,0x01,0x80,0x0F,0xF5,0xFF,0x02,0xFC,0x00,0x3F,
+0xFC,0xFF,0x01,0x00,0x07,0xF5,0xFF,0x02,0xFC,0x00,0x1F,0xFC,0xFF,0x01,0x00,0x03,
+0xF5,0xFF,0x02,0xFE,0x02,0x0F,0xFC,0xFF,0x01,0xBE,0xA3,0xF4,0xFF,0x01,0x61,0x07,
+0xFC,0xFF,0x01,0x3F,0x33,0xF4,0xFF,0x01,0xE1,0x83,0xFC,0xFF,0x01,0x1F,0x33,0xF4,
+0xFF,0x01,0xF1,0xC1,0xFC,0xFF,0x01,0x00,0x73,0xF4,0xFF,0x02,0xF0,0xE0,0x7F,0xFD,
+0xFF,0x01,0x80,0xE7,0xF4,0xFF,0x02,0xF8,0x70,0x3F,0xFD,0xFF,0x01,0xC1,0xEF,0xF4,
+0xFF,0x02,0xF8,0x7C,0x1F,0xFC,0xFF,0x00,0xBF,0xF4,0xFF,0x02,0xFC,0x7F,0x1F,0xFD,
+0xFF,0x01,0xC0,0x3F,0xF4,0xFF,0x02,0xFE,0x3F,0x0F,0xFD,0xFF,0x01,0x80,0x7F,0xF4,
+0xFF,0x02,0xFC,0x3F,0xC7,0xFD,0xFF,0x01,0x00,0xBF,0xF4,0xFF,0x02,0xFE,0x3F,0xC3,
+0xFD,0xFF,0x01,0x27,0x3F,0xF3,0xFF,0x01,0x1F,0xC3,0xFD,0xFF,0x01,0x23,0x3F,0xF3,
+0xFF,0x01,0x0F,0xE3,0xFD,0xFF,0x01,0x23,0x3F,0xF3,0xFF,0x01,0x07,0xF1,0xFD,0xFF,
+0x01,0x10,0x3F,0xF3,0xFF,0x01,0x83,0xF0,0xFD,0xFF,0x01,0x10,0x7F,0xF3,0xFF,0x01,
+0xC3,0xF0,0xFD,0xFF,0x00,0xB8,0xF2,0xFF,0x01,0xE3,0xF8,0xED,0xFF,0x02,0xF1,0xFC,
+0x7F,0xFE,0xFF,0x01,0xC0,0x3F,0xF3,0xFF,0x02,0xF0,0xFC,0x7F,0xFE,0xFF,0x01,0x80,
+0x3F,0xF3,0xFF,0x02,0xF8,0x7C,0x7F,0xFE,0xFF,0x01,0x00,0x7F,0xF3,0xFF,0x02,0xF8,
+0x7E,0x3F,0xFE,0xFF,0x00,0x3F,0xF2,0xFF,0x02,0xFC,0x3E,0x3F,0xFE,0xFF,0x00,0x5F,
+0xF2,0xFF,0x02,0xFE,0x0E,0x3F,0xFE,0xFF,0x01,0x80,0x3F,0xF2,0xFF,0x01,0x07,0x1F,
+0xFE,0xFF,0x01,0x80,0x3F,0xF2,0xFF,0x01,0x83,0x1F,0xFE,0xFF,0x01,0x00,0x7F,0xF2,
+0xFF,0x01,0xC3,0x1F,0xFE,0xFF,0x00,0x3F,0xF1,0xFF,0x01,0xE0,0x1F,0xFE,0xFF,0x00,
+0x5F,0xF1,0xFF,0x01,0xF0,0x1F,0xFE,0xFF,0x01,0x80,0x3F,0xF2,0xFF,0x01,0xF8,0x1F,
+0xFE,0xFF,0x01,0x00,0x3F,0xF2,0xFF,0x01,0xFC,0x1F,0xFE,0xFF,0x01,0x00,0x7F,0xF1,
+0xFF,0x00,0x3F,0xE9,0xFF,0x02,0xFC,0x00,0x3F,0xEE,0xFF,0x02,0xF8,0x00,0x3F,0xEE,
+0xFF,0x02,0xF8,0x00,0x7F,0xAC,0xFF,
+};
+
+// BitmapWaveshare : 5808 bytes, packed 4468
+const unsigned char BitmapWaveshare_packed[] PROGMEM =
+{
+0xB0,0x16,0x00,0x00,0xF9,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,
+0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,
+0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,
+0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,
+0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,
+0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,
+0x02,0xFE,0x1F,0x80,0xFD,0x00,0x01,0x03,0xE1,0xF4,0xFF,0x02,0xFE,0x1F,0x80,0xFD,
+0x00,0x01,0x03,0xE1,0xF4,0xFF,0x02,0xFE,0x1F,0x80,0xFD,0x00,0x01,0x03,0xE1,0xF4,
+0xFF,0x02,0xFE,0x1F,0x80,0xFD,0x00,0x01,0x03,0xE1,0xF7,0xFF,0x05,0xE0,0xFF,0xFF,
+0xFE,0x1F,0x80,0xFD,0x00,0x01,0x03,0xE1,0xF7,0xFF,0x05,0x80,0x1F,0xFF,0xFE,0x1F,
+0x83,0xFD,0xFF,0x01,0x83,0xE1,0xF8,0xFF,0x06,0xFE,0x00,0x0F,0xFF,0xFE,0x1F,0x83,
+0xFD,0xFF,0x01,0x83,0xE1,0xF8,0xFF,0x06,0xFC,0x0E,0x07,0xFF,0xFE,0x1F,0x83,0xFD,
+0xFF,0x01,0x83,0xE1,0xF8,0xFF,0x06,0xF8,0x3F,0x83,0xFF,0xFE,0x1F,0x83,0xFD,0xFF,
+0x01,0x83,0xE1,0xF8,0xFF,0x06,0xF0,0x7F,0xE1,0xFF,0xFE,0x1F,0x83,0xFD,0xFF,0x01,
+0x83,0xE1,0xF8,0xFF,0x0C,0xC0,0xFF,0xF1,0xFF,0xFE,0x1F,0x83,0xFF,0xC0,0x00,0x01,
+0x83,0xE1,0xF8,0xFF,0x06,0x01,0xFF,0xF1,0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x02,0x01,
+0x83,0xE1,0xF9,0xFF,0x07,0xFC,0x01,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x02,
+0x01,0x83,0xE1,0xF9,0xFF,0x07,0xF0,0x03,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0x00,
+0x02,0x01,0x83,0xE1,0xF9,0xFF,0x07,0xF0,0x7F,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,
+0x00,0x02,0x01,0x83,0xE1,0xF9,0xFF,0x08,0xE0,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,
+0x01,0xFE,0xFF,0x01,0x83,0xE1,0xF9,0xFF,0x0D,0xC3,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,
+0x83,0x00,0x3F,0xFF,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,0xC7,0xFF,0xFF,0xF0,0xFF,0xFE,
+0x1F,0x83,0x00,0x07,0xFF,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,0x87,0xFF,0xFF,0xF0,0xFF,
+0xFE,0x1F,0x83,0xE0,0x00,0x7F,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,0x8F,0xFF,0xFF,0xF0,
+0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x0F,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,0x8F,0xFF,0xFF,
+0xF0,0xFF,0xFE,0x1F,0x83,0xFF,0xE0,0x03,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,0x8F,0xFF,
+0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFF,0xFE,0x03,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,0x8F,
+0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFF,0xE0,0x03,0xFF,0x83,0xE1,0xF9,0xFF,0x0D,
+0x8F,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x03,0xFF,0x83,0xE1,0xF9,0xFF,
+0x0D,0x8F,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xE0,0x00,0x1F,0xFF,0x83,0xE1,0xF9,
+0xFF,0x0D,0x87,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0x00,0x01,0xFF,0xFF,0x83,0xE1,
+0xF9,0xFF,0x0D,0x87,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0x00,0x1F,0xFF,0xFF,0x83,
+0xE1,0xF9,0xFF,0x08,0xC3,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0x00,0xFE,0xFF,0x01,
+0x83,0xE1,0xFA,0xFF,0x08,0xF9,0xC1,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0x00,
+0x02,0x1F,0x83,0xE1,0xFA,0xFF,0x08,0xFC,0xE0,0xFF,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,
+0xFE,0x00,0x02,0x01,0x83,0xE1,0xFA,0xFF,0x08,0xFC,0x70,0x1F,0xFF,0xF0,0xFF,0xFE,
+0x1F,0x83,0xFE,0x00,0x02,0x01,0x83,0xE1,0xFA,0xFF,0x08,0xFE,0x38,0x1F,0xFF,0xF0,
+0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x02,0x01,0x83,0xE1,0xF9,0xFF,0x0D,0x3E,0x1F,0xFF,
+0xF0,0xFF,0xFE,0x1F,0x83,0xFF,0xC0,0x00,0x01,0x83,0xE1,0xF9,0xFF,0x07,0xBE,0x1F,
+0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFD,0xFF,0x01,0x83,0xE1,0xFA,0xFF,0x08,0x3F,0xBE,
+0x1F,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFD,0xFF,0x01,0x83,0xE1,0xFA,0xFF,0x08,0x0F,
+0x1E,0x1F,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0xFF,0x02,0xE1,0x83,0xE1,0xFA,0xFF,
+0x08,0x82,0x0E,0x1F,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0xFF,0x02,0x01,0x83,0xE1,
+0xFA,0xFF,0x0E,0xE0,0x1E,0x1F,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFF,0xFF,0xF0,0x01,
+0x83,0xE1,0xFA,0xFF,0x0E,0xFC,0x3F,0x0F,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,0xFF,0xFF,
+0x80,0x01,0x83,0xE1,0xFA,0xFF,0x0E,0xFC,0x3F,0x07,0xFF,0xF0,0xFF,0xFE,0x1F,0x83,
+0xFF,0xF8,0x00,0x01,0x83,0xE1,0xFA,0xFF,0x0E,0xFC,0x7F,0x81,0xFF,0xF0,0xFF,0xFE,
+0x1F,0x83,0xFF,0xC0,0x00,0x01,0x83,0xE1,0xFA,0xFF,0x0E,0xF8,0x7F,0xC0,0x0F,0xF0,
+0xFF,0xFE,0x1F,0x83,0xFC,0x00,0x00,0x07,0x83,0xE1,0xFB,0xFF,0x0F,0xFC,0x00,0x7F,
+0xE0,0x1F,0xF0,0xFF,0xFE,0x1F,0x83,0xE0,0x00,0x00,0x7F,0x83,0xE1,0xFB,0xFF,0x09,
+0xFC,0x00,0x7F,0xFC,0x1F,0xF0,0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x06,0x7F,0x83,0xE1,
+0xFF,0xFF,0xFE,0x3F,0xFE,0xFF,0x12,0xFC,0x7F,0xFE,0x1F,0xF0,0xFF,0xFE,0x1F,0x83,
+0x00,0x00,0x70,0x7F,0x83,0xE1,0xFF,0xFF,0xFC,0x1F,0xFE,0xFF,0x12,0xFC,0x3F,0xFE,
+0x1F,0xF0,0xFF,0xFE,0x1F,0x83,0x00,0x07,0xF0,0x7F,0x83,0xE1,0xFF,0xFF,0xFC,0x1F,
+0xFE,0xFF,0x12,0xFC,0x1F,0xFF,0x1F,0xF1,0xFF,0xFE,0x1F,0x83,0x00,0x7F,0xF0,0x7F,
+0x83,0xE1,0xFF,0xFF,0xFE,0x3F,0xFE,0xFF,0x0E,0xF8,0x0F,0xFF,0x0F,0xE1,0xFF,0xFE,
+0x1F,0x83,0x07,0xFF,0xF0,0x7F,0x83,0xE1,0xFA,0xFF,0x0E,0xF0,0x01,0x0F,0x83,0xC1,
+0xFF,0xFE,0x1F,0x83,0x00,0x7F,0xF0,0x7F,0x83,0xE1,0xFA,0xFF,0x0E,0xC3,0x80,0x07,
+0x80,0x03,0xFF,0xFE,0x1F,0x83,0x00,0x0F,0xF0,0x7F,0x83,0xE1,0xFA,0xFF,0x0E,0x8F,
+0xC0,0x03,0xC0,0x07,0xFF,0xFE,0x1F,0x83,0x00,0x00,0xF0,0x7F,0x83,0xE1,0xFA,0xFF,
+0x0E,0x9F,0xC0,0x19,0xF0,0x1F,0xFF,0xFE,0x1F,0x83,0x80,0x00,0x10,0x7F,0x83,0xE1,
+0xF9,0xFF,0x0D,0x9E,0x7C,0xFC,0x7F,0xFF,0xFE,0x1F,0x83,0xF0,0x00,0x00,0x7F,0x83,
+0xE1,0xF9,0xFF,0x0D,0x9F,0x7C,0x7F,0xFF,0xFF,0xFE,0x1F,0x83,0xFE,0x00,0x00,0x3F,
+0x83,0xE1,0xF9,0xFF,0x0D,0x3F,0x7E,0x7F,0xFF,0xFF,0xFE,0x1F,0x83,0xFF,0xE0,0x00,
+0x03,0x83,0xE1,0xF9,0xFF,0x11,0x3F,0x7F,0x3F,0xFF,0xFF,0xFE,0x1F,0x83,0xFF,0xFC,
+0x00,0x01,0x83,0xE1,0xFF,0x00,0x00,0x1F,0xFE,0xFF,0x12,0xFE,0x7F,0x3F,0xBF,0xFF,
+0xFF,0xFE,0x1F,0x83,0xFF,0xFF,0xC0,0x01,0x83,0xE1,0xFF,0x00,0x00,0x1F,0xFC,0xFF,
+0x00,0x3F,0xFE,0xFF,0x0C,0xFE,0x1F,0x83,0xFF,0xFF,0xF8,0x01,0x83,0xE1,0xFF,0xF8,
+0xFC,0x7F,0xFC,0xFF,0x00,0x3F,0xFE,0xFF,0x02,0xFE,0x1F,0x83,0xFE,0xFF,0x06,0x01,
+0x83,0xE1,0xFF,0xF9,0xFE,0x3F,0xF8,0xFF,0x02,0xFE,0x1F,0x83,0xFE,0xFF,0x06,0xF1,
+0x83,0xE1,0xFF,0xF9,0xFF,0x3F,0xF8,0xFF,0x02,0xFE,0x1F,0x83,0xFD,0xFF,0x05,0x83,
+0xE1,0xFF,0xF9,0xFF,0x9F,0xF8,0xFF,0x02,0xFE,0x1F,0x83,0xFD,0xFF,0x05,0x83,0xE1,
+0xFF,0xF9,0xFF,0x9F,0xF8,0xFF,0x02,0xFE,0x1F,0x83,0xFD,0xFF,0x05,0x83,0xE1,0xFF,
+0xFC,0xFF,0x9F,0xF8,0xFF,0x02,0xFE,0x1F,0x83,0xFD,0xFF,0x05,0x83,0xE1,0xFF,0xFC,
+0x7F,0x1F,0xF8,0xFF,0x02,0xFE,0x1F,0x80,0xFD,0x00,0x05,0x03,0xE1,0xFF,0xFE,0x00,
+0x3F,0xF8,0xFF,0x02,0xFE,0x1F,0x80,0xFD,0x00,0x05,0x03,0xE1,0xFF,0xFF,0x00,0x7F,
+0xF8,0xFF,0x02,0xFE,0x1F,0x80,0xFD,0x00,0x01,0x03,0xE1,0xF4,0xFF,0x02,0xFE,0x1F,
+0x80,0xFD,0x00,0x01,0x03,0xE1,0xF4,0xFF,0x02,0xFE,0x1F,0x80,0xFD,0x00,0x01,0x03,
+0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFC,0xFF,0xF8,0x00,0x00,0x1F,
+0xFB,0xFF,0x05,0xE1,0xFF,0xFF,0x07,0xFF,0xFF,0xF8,0x00,0x00,0x1F,0xFB,0xFF,0x05,
+0xE1,0xFF,0xFE,0x07,0xBF,0xFF,0xF8,0x00,0x00,0x1F,0xFB,0xFF,0x05,0xE1,0xFF,0xFC,
+0x67,0x9F,0xFF,0xF8,0x00,0x00,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xF8,0xE7,0x9F,0xF8,
+0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xF9,0xE7,0x9F,0xF8,0xFF,0x01,0xFE,
+0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xF9,0xE7,0x9F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,
+0x04,0xE1,0xFF,0xF9,0xE7,0x9F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,
+0xF9,0xE7,0x1F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x08,0xE1,0xFF,0xFC,0xE7,0x3F,
+0xFF,0xFF,0xF8,0x03,0xFC,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x08,0xE1,0xFF,0xFC,0x00,
+0x3F,0xFF,0xFF,0xF0,0x01,0xFC,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x09,0xE1,0xFF,0xFE,
+0x00,0x7F,0xFF,0xFF,0xC1,0xE0,0x3F,0xFD,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x03,0xE1,
+0xFF,0xFF,0x81,0xFE,0xFF,0x02,0x0F,0xFE,0x1F,0xFD,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,
+0x00,0xE1,0xFC,0xFF,0x03,0xFE,0x3F,0xFF,0x07,0xFD,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,
+0x00,0xE1,0xFC,0xFF,0x03,0xFC,0x38,0x63,0x83,0xFD,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,
+0x09,0xE1,0xFF,0x80,0x1F,0xFF,0xFF,0xF8,0x70,0x31,0xC1,0xFD,0xFF,0x01,0xFE,0x1F,
+0xFB,0xFF,0x09,0xE1,0xFF,0x80,0x00,0x1F,0xFF,0xF0,0x60,0x30,0xC1,0xFD,0xFF,0x11,
+0xFE,0x1F,0xFF,0xFC,0x00,0x03,0xFF,0xFF,0xE1,0xFF,0xFF,0xFC,0x1F,0xFF,0xE0,0x60,
+0x30,0x40,0xFD,0xFF,0x11,0xFE,0x1F,0xFF,0xC0,0x00,0x00,0x7F,0xFF,0xE1,0xFF,0xFF,
+0xFE,0x1F,0xFF,0xE0,0x60,0x30,0x60,0xFE,0x00,0x03,0x01,0xFE,0x1F,0xFF,0xFE,0x00,
+0x0B,0x1F,0xFF,0xE1,0xFF,0xFF,0xF0,0x7F,0xFF,0xC0,0x70,0x30,0x60,0xFE,0x00,0x03,
+0x01,0xFE,0x1F,0xFE,0xFE,0x00,0x0B,0x07,0xFF,0xE1,0xFF,0xFF,0x83,0xFF,0xFF,0xC0,
+0x30,0x70,0x60,0xFE,0x00,0x03,0x01,0xFE,0x1F,0xFC,0xFE,0x00,0x0B,0x03,0xFF,0xE1,
+0xFF,0xFE,0x1F,0xFF,0xFF,0x80,0x3F,0xE0,0x60,0xFE,0x00,0x11,0x01,0xFE,0x1F,0xF8,
+0x00,0x3F,0xFC,0x01,0xFF,0xE1,0xFF,0xFE,0x0F,0xFF,0xFF,0x80,0x1F,0xC0,0xFD,0x00,
+0x10,0x01,0xFE,0x1F,0xF0,0x18,0x1F,0xFF,0x80,0xFF,0xE1,0xFF,0xFF,0xC1,0xFF,0xFF,
+0x80,0x03,0xFC,0x00,0x0F,0x01,0xFE,0x1F,0xE0,0x7C,0x0F,0xFF,0xE0,0xFF,0xE1,0xFF,
+0xFF,0xF8,0x3F,0xFF,0x80,0xFE,0x00,0x0C,0x1F,0xFF,0xF0,0x01,0xFE,0x1F,0xE0,0xFE,
+0x07,0xFF,0xF0,0x7F,0xE1,0xFE,0xFF,0x02,0x1F,0xFF,0x80,0xFE,0x00,0x12,0x1F,0xFF,
+0xE0,0x01,0xFE,0x1F,0xE1,0xFF,0x07,0xFF,0xF8,0x7F,0xE1,0xFF,0xE0,0x00,0x1F,0xFF,
+0x80,0xFE,0x00,0x24,0x1F,0xFF,0xC0,0x01,0xFE,0x1F,0xC1,0xFF,0x03,0xFF,0xF8,0x7F,
+0xE1,0xFF,0x80,0x00,0x1F,0xFF,0x80,0x07,0xFC,0x00,0x1F,0xFF,0x80,0x01,0xFE,0x1F,
+0xC3,0xFF,0x81,0xFF,0xFC,0x3F,0xE1,0xFF,0x83,0xFE,0xFF,0x10,0x80,0x1F,0xFF,0x00,
+0x1F,0xFF,0x00,0x01,0xFE,0x1F,0xC3,0xFF,0xC0,0xFF,0xFC,0x3F,0xE1,0xFC,0xFF,0x10,
+0x80,0x3C,0x67,0x80,0x1F,0xFE,0x00,0x81,0xFE,0x1F,0xC3,0xFF,0xE0,0xFF,0xFC,0x3F,
+0xE1,0xFC,0xFF,0x10,0x80,0x30,0x21,0xC0,0x1F,0xFC,0x01,0x81,0xFE,0x1F,0xC3,0xFF,
+0xE0,0x7F,0xFC,0x3F,0xE1,0xFC,0xFF,0x10,0xC0,0x60,0x30,0xC0,0x3F,0xF8,0x03,0x81,
+0xFE,0x1F,0xC3,0xFF,0xF0,0x3F,0xFC,0x3F,0xE1,0xFC,0xFF,0x10,0xC0,0x60,0x30,0xC0,
+0x7F,0xF0,0x0F,0x81,0xFE,0x1F,0xE1,0xFF,0xF8,0x3F,0xF8,0x3F,0xE1,0xFC,0xFF,0x10,
+0xC0,0x60,0x30,0x60,0x7F,0xE0,0x1F,0x81,0xFE,0x1F,0xE1,0xFF,0xFC,0x1F,0xF8,0x7F,
+0xE1,0xFC,0xFF,0x10,0xE0,0x60,0x30,0x60,0xFF,0xC0,0x3F,0x81,0xFE,0x1F,0xE0,0xFF,
+0xFC,0x0F,0xF0,0x7F,0xE1,0xFC,0xFF,0x10,0xE0,0x30,0x70,0x60,0xFF,0x80,0x7F,0x81,
+0xFE,0x1F,0xF0,0x7F,0xFE,0x07,0xC0,0x7F,0xE1,0xFC,0xFF,0x10,0xF0,0x38,0xE0,0x61,
+0xFE,0x00,0xFF,0x81,0xFE,0x1F,0xF0,0x1F,0xFF,0x07,0x80,0xFF,0xE1,0xFC,0xFF,0x10,
+0xF8,0x1F,0xE0,0x61,0xFC,0x01,0xFF,0x81,0xFE,0x1F,0xF8,0x03,0xFF,0x00,0x01,0xFF,
+0xE1,0xFC,0xFF,0x0A,0xFC,0x0F,0x80,0x00,0xF8,0x03,0xFF,0x81,0xFE,0x1F,0xFC,0xFE,
+0x00,0x02,0x01,0xFF,0xE1,0xFC,0xFF,0x00,0xFE,0xFE,0x00,0x06,0x70,0x07,0xFF,0x81,
+0xFE,0x1F,0xFE,0xFE,0x00,0x02,0x07,0xFF,0xE1,0xFB,0xFF,0xFE,0x00,0x0C,0x20,0x0F,
+0xFF,0x81,0xFE,0x1F,0xFF,0x80,0x00,0x00,0x0F,0xFF,0xE1,0xFB,0xFF,0x0F,0x80,0x00,
+0x60,0x00,0x1F,0xFF,0x81,0xFE,0x1F,0xFF,0xE0,0x00,0x00,0x3F,0xFF,0xE1,0xFB,0xFF,
+0x0F,0x80,0x01,0xF0,0x00,0x3F,0xFF,0x81,0xFE,0x1F,0xFF,0xFC,0x00,0x03,0xFF,0xFF,
+0xE1,0xFB,0xFF,0x08,0x81,0xFF,0xF8,0x00,0xFF,0xFF,0x81,0xFE,0x1F,0xFB,0xFF,0x00,
+0xE1,0xFB,0xFF,0x08,0x81,0xFF,0xFC,0x01,0xFF,0xFF,0x81,0xFE,0x1F,0xFB,0xFF,0x00,
+0xE1,0xFB,0xFF,0x08,0x81,0xFF,0xFE,0x01,0xFF,0xFF,0x81,0xFE,0x1F,0xFB,0xFF,0x00,
+0xE1,0xFB,0xFF,0x08,0x81,0xFF,0xFE,0x01,0xFF,0xFF,0x81,0xFE,0x1F,0xFB,0xFF,0x03,
+0xE1,0xFF,0xFF,0xC0,0xFE,0xFF,0x08,0x81,0xFF,0xFF,0x00,0xFF,0xFF,0x81,0xFE,0x1F,
+0xFB,0xFF,0x0F,0xE1,0xFF,0x9F,0x80,0x3F,0xFF,0xFF,0x81,0xFF,0xFF,0x80,0x7F,0xFF,
+0x81,0xFE,0x1F,0xFB,0xFF,0x3C,0xE1,0xFF,0x9F,0x9E,0x3F,0xFF,0xFF,0x81,0xFF,0xFF,
+0xC0,0x3F,0xFF,0x81,0xFE,0x1F,0xFF,0xFC,0x00,0x03,0xFF,0xFF,0xE1,0xFF,0x9F,0x3F,
+0x1F,0xFF,0xFF,0x81,0xFF,0xFF,0xE0,0x1F,0xFF,0x81,0xFE,0x1F,0xFF,0xC0,0x00,0x00,
+0x7F,0xFF,0xE1,0xFF,0x9F,0x3F,0x9F,0xFF,0xFF,0x81,0xFF,0xFF,0xF0,0x0F,0xFF,0x81,
+0xFE,0x1F,0xFF,0xFE,0x00,0x12,0x1F,0xFF,0xE1,0xFF,0x9F,0x3F,0x9F,0xFF,0xFF,0x81,
+0xFF,0xFF,0xF8,0x0F,0xFF,0x81,0xFE,0x1F,0xFE,0xFE,0x00,0x12,0x07,0xFF,0xE1,0xFF,
+0xCF,0x3F,0x9F,0xFF,0xFF,0x81,0xFF,0xFF,0xFC,0x07,0xFF,0x81,0xFE,0x1F,0xFC,0xFE,
+0x00,0x5D,0x03,0xFF,0xE1,0xFF,0xCF,0x3F,0x9F,0xFF,0xFF,0x81,0xFF,0xFF,0xFE,0x03,
+0xFF,0x81,0xFE,0x1F,0xF8,0x00,0x3F,0xFC,0x01,0xFF,0xE1,0xFF,0xE3,0x9F,0x3F,0xFF,
+0xFF,0x81,0xFF,0xFF,0xFE,0x03,0xFF,0x81,0xFE,0x1F,0xF0,0x18,0x1F,0xFF,0x80,0xFF,
+0xE1,0xFF,0xF0,0x00,0x3F,0xFF,0xFF,0x81,0xFF,0xFF,0xFC,0x03,0xFF,0x81,0xFE,0x1F,
+0xE0,0x7C,0x0F,0xFF,0xE0,0xFF,0xE1,0xFF,0xF8,0x00,0x7F,0xFF,0xFF,0x81,0xFF,0xFF,
+0xF8,0x07,0xFF,0x81,0xFE,0x1F,0xE0,0xFE,0x07,0xFF,0xF0,0x7F,0xE1,0xFF,0xFF,0x03,
+0xFE,0xFF,0x0F,0x81,0xFF,0xFF,0xF0,0x0F,0xFF,0x81,0xFE,0x1F,0xE1,0xFF,0x07,0xFF,
+0xF8,0x7F,0xE1,0xFB,0xFF,0x0F,0x81,0xFF,0xFF,0xE0,0x1F,0xFF,0x81,0xFE,0x1F,0xC1,
+0xFF,0x03,0xFF,0xF8,0x7F,0xE1,0xFB,0xFF,0x0F,0x81,0xFF,0xFF,0xC0,0x3F,0xFF,0x81,
+0xFE,0x1F,0xC3,0xFF,0x81,0xFF,0xFC,0x3F,0xE1,0xFB,0xFF,0x0F,0x81,0xFF,0xFF,0xC0,
+0x7F,0xFF,0x81,0xFE,0x1F,0xC3,0xFF,0xC0,0xFF,0xFC,0x3F,0xE1,0xFE,0xFF,0x12,0x9F,
+0xFF,0xFF,0x81,0xFF,0xFF,0x80,0xFF,0xFF,0x81,0xFE,0x1F,0xC3,0xFF,0xE0,0xFF,0xFC,
+0x3F,0xE1,0xFE,0xFF,0x12,0x9F,0xFF,0xFF,0x81,0xFF,0xFF,0x01,0xFF,0xFF,0x81,0xFE,
+0x1F,0xC3,0xFF,0xE0,0x7F,0xFC,0x3F,0xE1,0xFE,0xFF,0x12,0x9F,0xFF,0xFF,0x81,0xFF,
+0xFE,0x01,0xFF,0xFF,0x81,0xFE,0x1F,0xC3,0xFF,0xF0,0x3F,0xFC,0x3F,0xE1,0xFE,0xFF,
+0x7F,0x9F,0xFF,0xFF,0x81,0xFF,0xFC,0x01,0xFF,0xFF,0x81,0xFE,0x1F,0xE1,0xFF,0xF8,
+0x3F,0xF8,0x3F,0xE1,0xFF,0x80,0x00,0x1F,0xFF,0xFF,0x81,0xFF,0xF8,0x00,0xFF,0xFF,
+0x81,0xFE,0x1F,0xE1,0xFF,0xFC,0x1F,0xF8,0x7F,0xE1,0xFF,0x80,0x00,0x1F,0xFF,0xFF,
+0x81,0xFF,0xF0,0x00,0x7F,0xFF,0x81,0xFE,0x1F,0xE0,0xFF,0xFC,0x0F,0xF0,0x7F,0xE1,
+0xFF,0x80,0x00,0x1F,0xFF,0xFF,0x81,0xFF,0xE0,0x00,0x3F,0xFF,0x81,0xFE,0x1F,0xF0,
+0x7F,0xFE,0x07,0xC0,0x7F,0xE1,0xFF,0xDF,0xFF,0x9F,0xFF,0xFF,0x81,0xFF,0xE0,0x00,
+0x1F,0xFF,0x81,0xFE,0x1F,0xF0,0x1F,0xFF,0x07,0x80,0xFF,0xE1,0xFF,0xCF,0xFF,0x9F,
+0xFF,0xFF,0x81,0xFF,0xC0,0x70,0x0F,0xFF,0x81,0xFE,0x1F,0xF8,0x03,0xFF,0x00,0x01,
+0xFF,0x10,0xE1,0xFF,0xE7,0xFF,0x9F,0xFF,0xFF,0x81,0xFF,0x80,0xF8,0x07,0xFF,0x81,
+0xFE,0x1F,0xFC,0xFE,0x00,0x12,0x01,0xFF,0xE1,0xFF,0xE7,0xFF,0x9F,0xFF,0xFF,0x81,
+0xFF,0x01,0xFC,0x01,0xFF,0x81,0xFE,0x1F,0xFE,0xFE,0x00,0x18,0x07,0xFF,0xE1,0xFF,
+0xF7,0xFF,0x9F,0xFF,0xFF,0x81,0xFE,0x01,0xFE,0x00,0xFF,0x81,0xFE,0x1F,0xFF,0x80,
+0x00,0x00,0x0F,0xFF,0xE1,0xFB,0xFF,0x0F,0x81,0xFC,0x03,0xFF,0x00,0x7F,0x81,0xFE,
+0x1F,0xFF,0xE0,0x00,0x00,0x3F,0xFF,0xE1,0xFB,0xFF,0x0F,0x81,0xF8,0x07,0xFF,0x80,
+0x3F,0x81,0xFE,0x1F,0xFF,0xFC,0x00,0x03,0xFF,0xFF,0xE1,0xFB,0xFF,0x08,0x81,0xF0,
+0x0F,0xFF,0xC0,0x1F,0x81,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x08,0x81,0xE0,
+0x1F,0xFF,0xE0,0x0F,0x81,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x08,0x81,0xE0,
+0x3F,0xFF,0xF0,0x07,0x81,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x08,0x81,0xC0,
+0x7F,0xFF,0xFC,0x03,0x81,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x08,0x81,0x80,
+0xFF,0xFF,0xFE,0x01,0x81,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0x81,0x00,
+0xFE,0xFF,0x03,0x00,0x81,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0x80,0x01,
+0xFE,0xFF,0x03,0x80,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0x80,0x03,
+0xFE,0xFF,0x03,0xC0,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0x80,0x07,
+0xFE,0xFF,0x03,0xE0,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0x80,0x0F,
+0xFE,0xFF,0x03,0xF0,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x01,0x80,0x0F,
+0xFE,0xFF,0x03,0xF0,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x00,0x80,0xFC,
+0x00,0x02,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x00,0x80,0xFC,0x00,0x02,
+0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x00,0x80,0xFC,0x00,0x02,0x01,0xFE,
+0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,0x00,0x80,0xFC,0x00,0x02,0x01,0xFE,0x1F,0xFB,
+0xFF,0x00,0xE1,0xFB,0xFF,0x00,0x80,0xFC,0x00,0x0D,0x01,0xFE,0x1F,0xFF,0xFC,0x7F,
+0xFF,0xF1,0xFF,0xE1,0xFF,0xF9,0xFF,0xE7,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xF0,0x1F,
+0xFF,0xC0,0x7F,0xE1,0xFF,0xF9,0xFF,0xC3,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xF0,0x1F,
+0xFF,0xC0,0x7F,0xE1,0xFF,0xF8,0x0F,0x81,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xE0,0x0F,
+0xFF,0x80,0x3F,0xE1,0xFF,0xF8,0x07,0x99,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xE0,0x0F,
+0xFF,0x80,0x3F,0xE1,0xFF,0xF8,0xE7,0x9C,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xE0,0x0F,
+0xFF,0x80,0x3F,0xE1,0xFF,0xF9,0xF3,0x9C,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xF0,0x1F,
+0xFF,0xC0,0x7F,0xE1,0xFF,0xF9,0xF3,0x9C,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xF0,0x1F,
+0xFF,0xC0,0x7F,0xE1,0xFF,0xF9,0xF3,0x9C,0xF8,0xFF,0x0C,0xFE,0x1F,0xFF,0xFC,0x7F,
+0xFF,0xF1,0xFF,0xE1,0xFF,0xF9,0xF3,0x9C,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x04,
+0xE1,0xFF,0xFC,0xE7,0x9C,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xFC,
+0x00,0x09,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xFE,0x08,0x01,0xF8,
+0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xFF,0xFC,0x61,0xF8,0xFF,0x01,0xFE,
+0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFC,0xFF,
+0xF8,0x00,0x00,0x1F,0xFB,0xFF,0x00,0xE1,0xFC,0xFF,0xF8,0x00,0x00,0x1F,0xFB,0xFF,
+0x00,0xE1,0xFC,0xFF,0xF8,0x00,0x00,0x1F,0xFB,0xFF,0x05,0xE1,0xFF,0xF8,0x00,0x1F,
+0xFF,0xF8,0x00,0x00,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xF8,0x00,0x1F,0xF8,0xFF,0x01,
+0xFE,0x1F,0xFB,0xFF,0x04,0xE1,0xFF,0xFF,0xFE,0x7F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,
+0xFF,0x00,0xE1,0xFE,0xFF,0x00,0x3F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,
+0xFE,0xFF,0x00,0x9F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFE,0xFF,0x00,
+0x9F,0xF8,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFE,0xFF,0x00,0x9F,0xF8,0xFF,
+0x08,0xFE,0x1F,0xFF,0xFC,0x00,0x03,0xFF,0xFF,0xE1,0xFE,0xFF,0x00,0x9F,0xF8,0xFF,
+0x0C,0xFE,0x1F,0xFF,0xC0,0x00,0x00,0x7F,0xFF,0xE1,0xFF,0xFF,0xFC,0x1F,0xF8,0xFF,
+0x02,0xFE,0x1F,0xFF,0xFE,0x00,0x06,0x1F,0xFF,0xE1,0xFF,0xF8,0x00,0x3F,0xF8,0xFF,
+0x02,0xFE,0x1F,0xFE,0xFE,0x00,0x05,0x07,0xFF,0xE1,0xFF,0xF8,0x00,0xF7,0xFF,0x02,
+0xFE,0x1F,0xFC,0xFE,0x00,0x02,0x03,0xFF,0xE1,0xF9,0xFF,0x00,0xF0,0xFE,0x00,0x09,
+0x01,0xFE,0x1F,0xF8,0x00,0x3F,0xFC,0x01,0xFF,0xE1,0xF9,0xFF,0x00,0x80,0xFE,0x00,
+0x09,0x01,0xFE,0x1F,0xF0,0x18,0x1F,0xFF,0x80,0xFF,0xE1,0xFE,0xFF,0x00,0xDF,0xFE,
+0xFF,0x00,0xFE,0xFD,0x00,0x0D,0x01,0xFE,0x1F,0xE0,0x7C,0x0F,0xFF,0xE0,0xFF,0xE1,
+0xFF,0xFF,0xFE,0x1F,0xFE,0xFF,0x00,0xF8,0xFD,0x00,0x0D,0x01,0xFE,0x1F,0xE0,0xFE,
+0x07,0xFF,0xF0,0x7F,0xE1,0xFF,0xFF,0xF0,0x1F,0xFE,0xFF,0x00,0xF0,0xFD,0x00,0x0D,
+0x01,0xFE,0x1F,0xE1,0xFF,0x07,0xFF,0xF8,0x7F,0xE1,0xFF,0xFF,0x80,0x7F,0xFE,0xFF,
+0x11,0xC0,0x00,0x00,0x80,0x00,0x01,0xFE,0x1F,0xC1,0xFF,0x03,0xFF,0xF8,0x7F,0xE1,
+0xFF,0xFC,0x01,0xFD,0xFF,0x11,0x80,0x00,0x03,0xE0,0x00,0x01,0xFE,0x1F,0xC3,0xFF,
+0x81,0xFF,0xFC,0x3F,0xE1,0xFF,0xE0,0x39,0xFD,0xFF,0x11,0x00,0x00,0x0F,0xF8,0x00,
+0x01,0xFE,0x1F,0xC3,0xFF,0xC0,0xFF,0xFC,0x3F,0xE1,0xFF,0x81,0xF9,0xFE,0xFF,0x12,
+0xFE,0x00,0x00,0x3F,0xFE,0x00,0x01,0xFE,0x1F,0xC3,0xFF,0xE0,0xFF,0xFC,0x3F,0xE1,
+0xFF,0x8F,0xF9,0xFE,0xFF,0x12,0xFC,0x00,0x00,0xFF,0xFF,0xE0,0x01,0xFE,0x1F,0xC3,
+0xFF,0xE0,0x7F,0xFC,0x3F,0xE1,0xFF,0x87,0xF9,0xFE,0xFF,0x12,0xF8,0x00,0x03,0xFC,
+0x0F,0xF0,0x01,0xFE,0x1F,0xC3,0xFF,0xF0,0x3F,0xFC,0x3F,0xE1,0xFF,0x80,0xF9,0xFE,
+0xFF,0x12,0xF0,0x00,0x0F,0xF0,0x03,0xF0,0x01,0xFE,0x1F,0xE1,0xFF,0xF8,0x3F,0xF8,
+0x3F,0xE1,0xFF,0xF0,0x19,0xFE,0xFF,0x12,0xF0,0x00,0x1F,0xF0,0x00,0xF8,0x01,0xFE,
+0x1F,0xE1,0xFF,0xFC,0x1F,0xF8,0x7F,0xE1,0xFF,0xFE,0x01,0xFE,0xFF,0x3B,0xE0,0x00,
+0x1F,0xF0,0x00,0xFC,0x01,0xFE,0x1F,0xE0,0xFF,0xFC,0x0F,0xF0,0x7F,0xE1,0xFF,0xFF,
+0xC0,0x3F,0xFF,0xFF,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x01,0xFE,0x1F,0xF0,0x7F,0xFE,
+0x07,0xC0,0x7F,0xE1,0xFF,0xFF,0xF8,0x1F,0xFF,0xFF,0xC0,0x00,0x03,0xFE,0x00,0x00,
+0x01,0xFE,0x1F,0xF0,0x1F,0xFF,0x07,0x80,0xFF,0xE1,0xFE,0xFF,0x12,0x9F,0xFF,0xFF,
+0xC0,0x00,0x00,0xFF,0x80,0x00,0x01,0xFE,0x1F,0xF8,0x03,0xFF,0x00,0x01,0xFF,0xE1,
+0xFB,0xFF,0x09,0x80,0x00,0x00,0x3F,0xE0,0x00,0x01,0xFE,0x1F,0xFC,0xFE,0x00,0x02,
+0x01,0xFF,0xE1,0xFB,0xFF,0x09,0x80,0x00,0x00,0x07,0xFC,0x00,0x01,0xFE,0x1F,0xFE,
+0xFE,0x00,0x02,0x07,0xFF,0xE1,0xFB,0xFF,0x0F,0x80,0x00,0x00,0x03,0xFC,0x00,0x01,
+0xFE,0x1F,0xFF,0x80,0x00,0x00,0x0F,0xFF,0xE1,0xFB,0xFF,0x0F,0x00,0x1F,0xC0,0x03,
+0xFC,0x00,0x01,0xFE,0x1F,0xFF,0xE0,0x00,0x00,0x3F,0xFF,0xE1,0xFB,0xFF,0x0F,0x00,
+0x0F,0xC0,0x03,0xFC,0x00,0x01,0xFE,0x1F,0xFF,0xFC,0x00,0x03,0xFF,0xFF,0xE1,0xFB,
+0xFF,0x08,0x00,0x07,0xF8,0x1F,0xF0,0x00,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,
+0xFF,0x08,0x00,0x03,0xFE,0x3F,0x00,0x00,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,
+0xFF,0x08,0x00,0x01,0xFF,0xFE,0x00,0x00,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,
+0xFF,0x08,0x00,0x00,0x1F,0xFE,0x00,0x00,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,
+0xFF,0x08,0x00,0x00,0x03,0xFE,0x00,0x00,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,
+0xFF,0xFE,0x00,0x05,0xFF,0x80,0x00,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xFB,0xFF,
+0xFE,0x00,0x05,0x3F,0xE0,0x00,0x01,0xFE,0x1F,0xFD,0xFF,0x02,0xF0,0x7F,0xE1,0xFB,
+0xFF,0xFE,0x00,0x05,0x1F,0xFC,0x00,0x01,0xFE,0x1F,0xFD,0xFF,0x02,0xF0,0x7F,0xE1,
+0xFB,0xFF,0xFE,0x00,0x05,0x1F,0xFC,0x00,0x01,0xFE,0x1F,0xFD,0xFF,0x02,0xF0,0x7F,
+0xE1,0xFB,0xFF,0xFE,0x00,0x05,0x1F,0xFC,0x00,0x01,0xFE,0x1F,0xFD,0xFF,0x02,0xF0,
+0x7F,0xE1,0xFB,0xFF,0xFE,0x00,0x05,0xFF,0xE0,0x00,0x01,0xFE,0x1F,0xFD,0xFF,0x02,
+0xF0,0x7F,0xE1,0xFB,0xFF,0x08,0x00,0x00,0x07,0xFF,0x00,0x00,0x01,0xFE,0x1F,0xFD,
+0xFF,0x02,0xF0,0x7F,0xE1,0xFB,0xFF,0x08,0x00,0x00,0x1F,0xFC,0x00,0x00,0x01,0xFE,
+0x1F,0xFD,0xFF,0x02,0xF0,0x7F,0xE1,0xFB,0xFF,0x08,0x00,0x00,0x1F,0xF0,0x00,0x00,
+0x03,0xFE,0x1F,0xFD,0xFF,0x02,0xF0,0x7F,0xE1,0xFB,0xFF,0x09,0x00,0x00,0x1F,0xF0,
+0x00,0x00,0x03,0xFE,0x1F,0xE0,0xFD,0x00,0x01,0x7F,0xE1,0xFB,0xFF,0x09,0x00,0x00,
+0x0F,0xF0,0x00,0x00,0x03,0xFE,0x1F,0xE0,0xFD,0x00,0x01,0x7F,0xE1,0xFB,0xFF,0x09,
+0x00,0x00,0x01,0xFE,0x00,0x00,0x07,0xFE,0x1F,0xE0,0xFD,0x00,0x01,0x7F,0xE1,0xFB,
+0xFF,0xFE,0x00,0x06,0x3F,0xC0,0x00,0x07,0xFE,0x1F,0xE0,0xFD,0x00,0x01,0x7F,0xE1,
+0xFB,0xFF,0xFE,0x00,0x06,0x3F,0xF8,0x00,0x0F,0xFE,0x1F,0xE0,0xFD,0x00,0x01,0x7F,
+0xE1,0xFB,0xFF,0xFE,0x00,0x06,0x3F,0xFC,0x00,0x0F,0xFE,0x1F,0xE0,0xFD,0x00,0x01,
+0x7F,0xE1,0xFB,0xFF,0xFE,0x00,0x06,0x7F,0xFC,0x00,0x1F,0xFE,0x1F,0xF0,0xFE,0xFF,
+0x02,0xF0,0x7F,0xE1,0xFB,0xFF,0x0F,0x00,0x00,0x03,0xFF,0xF8,0x00,0x3F,0xFE,0x1F,
+0xF8,0x7F,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0x0F,0x00,0x00,0x0F,0xFF,0xC0,0x00,
+0x3F,0xFE,0x1F,0xF8,0x3F,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0x0F,0x00,0x00,0x1F,
+0xFE,0x00,0x00,0x7F,0xFE,0x1F,0xFC,0x3F,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0x0F,
+0x00,0x00,0x1F,0xF0,0x00,0x00,0xFF,0xFE,0x1F,0xFC,0x1F,0xFF,0xFF,0xF0,0x7F,0xE1,
+0xFB,0xFF,0x0F,0x00,0x00,0x1F,0x80,0x00,0x01,0xFF,0xFE,0x1F,0xFE,0x0F,0xFF,0xFF,
+0xF0,0x7F,0xE1,0xFB,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x03,0xFF,0xFE,0x1F,0xFE,
+0x0F,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0xFC,0x00,0x0A,0x07,0xFF,0xFE,0x1F,0xFF,
+0x07,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0xFC,0x00,0x0A,0x1F,0xFF,0xFE,0x1F,0xFF,
+0x83,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0xFC,0x00,0x0A,0x3F,0xFF,0xFE,0x1F,0xFF,
+0x87,0xFF,0xFF,0xF0,0x7F,0xE1,0xFB,0xFF,0xFC,0x00,0x05,0xFF,0xFF,0xFE,0x1F,0xFF,
+0xDF,0xFD,0xFF,0x00,0xE1,0xFB,0xFF,0xFD,0x00,0x04,0x03,0xFF,0xFF,0xFE,0x1F,0xFB,
+0xFF,0x00,0xE1,0xFB,0xFF,0xFD,0x00,0x04,0x1F,0xFF,0xFF,0xFE,0x1F,0xFB,0xFF,0x00,
+0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,
+0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,
+0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,
+0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,
+0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,0xE1,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,
+0x00,0xE1,0xFC,0xFF,
+};
+
+#endif
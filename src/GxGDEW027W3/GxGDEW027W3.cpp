@@ -79,47 +79,34 @@ const uint8_t GxGDEW027W3::lut_24_bb[] =
 
 GxGDEW027W3::GxGDEW027W3(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDEW027W3::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW027W3_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW027W3_WIDTH - x - 1;
-      y = GxGDEW027W3_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW027W3_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW027W3_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW027W3_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW027W3_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW027W3_WIDTH / 8;
-  }
+void GxGDEW027W3::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEW027W3::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW027W3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 
@@ -138,6 +125,7 @@ void GxGDEW027W3::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -145,28 +133,21 @@ void GxGDEW027W3::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW027W3::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW027W3::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW027W3_BUFFER_SIZE);
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_buffer)) ? ~_buffer[i] : 0xFF);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDEW027W3_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -181,26 +162,16 @@ void  GxGDEW027W3::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_default) mode |= bm_normal; // no change
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true;
     _wakeUp();
     _setPartialRamArea(0x15, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW027W3_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _refreshWindow(0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
     _waitWhileBusy("drawBitmap");
   }
@@ -209,25 +180,16 @@ void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
+    IO.startTransaction();
     for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
     {
-      _writeData(0);
+      IO.writeData(0);
     }
+    IO.endTransaction();
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _writeData(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW027W3_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     _writeCommand(0x12); //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -237,20 +199,15 @@ void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 void GxGDEW027W3::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
     _using_partial_mode = true; // remember
     _setPartialRamArea(0x14, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW027W3_BUFFER_SIZE);
     _setPartialRamArea(0x15, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW027W3_BUFFER_SIZE);
     _refreshWindow(0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
     _waitWhileBusy("drawBitmap");
   }
@@ -259,15 +216,9 @@ void GxGDEW027W3::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW027W3_BUFFER_SIZE);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW027W3_BUFFER_SIZE);
     _writeCommand(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -277,6 +228,7 @@ void GxGDEW027W3::eraseDisplay(bool using_partial_update)
 void GxGDEW027W3::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -307,6 +259,7 @@ void GxGDEW027W3::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
 
 void GxGDEW027W3::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -353,15 +306,13 @@ void GxGDEW027W3::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   h = gx_uint16_min(h, GxGDEW027W3_HEIGHT - yd);
   uint16_t xe = (xs / 8) + (w / 8);
   _setPartialRamArea(0x15, xd, yd, w, h);
+  IO.startTransaction();
   for (uint16_t y1 = ys; y1 < ys + h; y1++)
   {
-    for (uint16_t x1 = xs / 8; x1 < xe; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW027W3_WIDTH / 8) + xs / 8;
+    _writePlaneData(IO, 0, idx, xe - xs / 8, true, 0xFF);
   }
+  IO.endTransaction();
   delay(2);
 }
 
@@ -412,15 +363,9 @@ void GxGDEW027W3::_writeData(uint8_t data)
 void GxGDEW027W3::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
+  if (!_waitBusy(_busy, LOW, 20000000)) // > 15.5s !
   {
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 20000000) // > 15.5s !
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -526,61 +471,44 @@ void GxGDEW027W3::_sleep(void)
 
 void GxGDEW027W3::_writeLUT(void)
 {
-  unsigned int count;
   {
     _writeCommand(0x20);							//vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC[count]);
-    }
+    IO.writeDataTransaction(lut_20_vcomDC, 44);
 
     _writeCommand(0x21);							//ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww[count]);
-    }
+    IO.writeDataTransaction(lut_21_ww, 42);
 
     _writeCommand(0x22);							//bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw[count]);
-    }
+    IO.writeDataTransaction(lut_22_bw, 42);
 
     _writeCommand(0x23);							//wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb[count]);
-    }
+    IO.writeDataTransaction(lut_23_wb, 42);
 
     _writeCommand(0x24);							//bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb[count]);
-    }
+    IO.writeDataTransaction(lut_24_bb, 42);
   }
 }
 
 void GxGDEW027W3::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -589,24 +517,23 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(void))
 void GxGDEW027W3::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -615,24 +542,23 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW027W3::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -641,24 +567,23 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW027W3::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x13);
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -688,6 +613,7 @@ void GxGDEW027W3::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -695,26 +621,31 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027W3_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027W3_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -722,27 +653,32 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027W3_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027W3_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
       //fillScreen(p);
-      uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -750,26 +686,31 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027W3_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027W3_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -777,21 +718,25 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*, const void
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW027W3_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW027W3_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW027W3::drawCornerTest(uint8_t em)
@@ -800,6 +745,7 @@ void GxGDEW027W3::drawCornerTest(uint8_t em)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x13);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW027W3_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW027W3_WIDTH / 8; x++)
@@ -809,9 +755,10 @@ void GxGDEW027W3::drawCornerTest(uint8_t em)
       if ((x > GxGDEW027W3_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW027W3_WIDTH / 8 - 4) && (y > GxGDEW027W3_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW027W3_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   _writeCommand(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
@@ -21,7 +21,7 @@
 
 #define GxGDEW027W3_BUFFER_SIZE (uint32_t(GxGDEW027W3_WIDTH) * uint32_t(GxGDEW027W3_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW027W3_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW027W3_HEIGHT
 #define GxGDEW027W3_PAGES 6
 
 #define GxGDEW027W3_PAGE_HEIGHT (GxGDEW027W3_HEIGHT / GxGDEW027W3_PAGES)
@@ -38,6 +38,10 @@ class GxGDEW027W3 : public GxEPD
     GxGDEW027W3(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -52,7 +56,8 @@ class GxGDEW027W3 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly, not needed as all screen drawing methods of this class do power down
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW027W3_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW027W3_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -64,6 +69,7 @@ class GxGDEW027W3 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEW027W3";};
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -83,13 +89,15 @@ class GxGDEW027W3 : public GxEPD
     void _waitWhileBusy(const char* comment = 0);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT, 1> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif defined(__AVR)
     uint8_t _buffer[GxGDEW027W3_PAGE_SIZE];
 #else
     uint8_t _buffer[GxGDEW027W3_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -115,6 +123,7 @@ class GxGDEW027W3 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW027W3_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW027W3/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW027W3/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW027W3/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,812 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h BitmapWaveshare.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 4736 bytes, packed 3222
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0xAB,0xFF,0x01,0xF8,0x07,0xF3,0xFF,0x01,0xC0,0x00,
+0xF3,0xFF,0x02,0x1F,0xF0,0x7F,0xF5,0xFF,0x03,0xFC,0x7F,0xFC,0x3F,0xF5,0xFF,0x03,
+0xF9,0xFF,0xFF,0x1F,0xF5,0xFF,0x03,0xF3,0xC0,0x7F,0x8F,0xF5,0xFF,0x03,0xE7,0x00,
+0x3F,0xC7,0xF5,0xFF,0x03,0xCC,0x7F,0x1F,0xE7,0xF5,0xFF,0x03,0x91,0xFF,0xDF,0xE7,
+0xF5,0xFF,0x03,0x27,0xFF,0xEF,0xF3,0xF6,0xFF,0x04,0xFE,0x4F,0xFF,0x87,0xF3,0xF6,
+0xFF,0x04,0xFE,0x1F,0xFF,0x33,0xF3,0xF6,0xFF,0x04,0xFC,0x3F,0xFE,0x43,0xF3,0xF6,
+0xFF,0x04,0xFC,0x7F,0xFE,0x43,0xE3,0xF6,0xFF,0x04,0xF8,0xFF,0xFE,0x67,0xE7,0xF6,
+0xFF,0x04,0xF9,0xFF,0xFE,0x7F,0xE7,0xF6,0xFF,0x04,0xF1,0xFF,0xFF,0x3F,0xCF,0xF6,
+0xFF,0x04,0xF3,0xFF,0xFF,0x9F,0x1F,0xF6,0xFF,0x04,0xF7,0xFF,0xFF,0xC0,0x3F,0xF6,
+0xFF,0x03,0xE7,0xFF,0xFF,0xF0,0xF6,0xFF,0x01,0xF0,0xE7,0xF3,0xFF,0x01,0xE0,0x6F,
+0xF3,0xFF,0x04,0xC0,0x4F,0xFF,0xFE,0x0F,0xF6,0xFF,0x05,0xC0,0xCF,0xFF,0x80,0x00,
+0x3F,0xF7,0xFF,0x05,0xC9,0xCF,0xFC,0x00,0x00,0x03,0xF7,0xFF,0x02,0xEF,0xCF,0xF0,
+0xFE,0x00,0x00,0x7F,0xF9,0xFF,0x03,0x7F,0xF7,0xCF,0xC0,0xFE,0x00,0x00,0x1F,0xFA,
+0xFF,0x08,0xF8,0x07,0xF9,0x8F,0x00,0x03,0xE0,0x00,0x03,0xFA,0xFF,0x08,0xC7,0xE3,
+0xFE,0x4C,0x00,0x3F,0x80,0x00,0x01,0xFA,0xFF,0x09,0x9F,0xF1,0xFF,0xC8,0x00,0xFC,
+0x0F,0xFF,0x80,0x7F,0xFB,0xFF,0x09,0x7F,0xF8,0xFF,0xC0,0x03,0xF8,0x7F,0xFF,0xF8,
+0x1F,0xFC,0xFF,0x0A,0xFE,0xFF,0xFC,0xFF,0xC0,0x0F,0xF1,0xFF,0xFF,0xFE,0x0F,0xFC,
+0xFF,0x06,0xFD,0xFF,0xFE,0x7F,0xC0,0x1F,0xE3,0xFE,0xFF,0x00,0xC1,0xFC,0xFF,0x06,
+0xF9,0xFF,0xFE,0x7F,0x80,0x7F,0xC7,0xFE,0xFF,0x00,0xF0,0xFC,0xFF,0x06,0xF3,0xFF,
+0xFE,0x7F,0x00,0xFF,0x8F,0xFE,0xFF,0x01,0xFC,0x7F,0xFD,0xFF,0x06,0xF7,0xFF,0xFE,
+0x7E,0x01,0xFF,0x1F,0xFD,0xFF,0x00,0x1F,0xFD,0xFF,0x06,0xE7,0xFF,0xFE,0x7C,0x03,
+0xFE,0x3F,0xFD,0xFF,0x00,0xCF,0xFD,0xFF,0x06,0xEF,0xFF,0xFE,0x78,0x07,0xFE,0x3F,
+0xFD,0xFF,0x00,0xE7,0xFD,0xFF,0x06,0xCF,0xFF,0xFE,0xF0,0x0B,0xFC,0x7F,0xFC,0xFF,
+0x09,0xF0,0x0F,0xFF,0xFF,0xCF,0xFF,0xFF,0xF0,0x1D,0xF8,0xFB,0xFF,0x09,0xC0,0x03,
+0xFF,0xFF,0xCF,0xFF,0xFF,0xE0,0x3D,0xF8,0xFB,0xFF,0x09,0x9F,0xF8,0xFF,0xFF,0xDF,
+0xFF,0xFF,0xE0,0x7E,0xF1,0xFB,0xFF,0x09,0x3F,0xFE,0x7F,0xFF,0xDF,0xFF,0xFF,0xC0,
+0x7F,0x71,0xFC,0xFF,0x0A,0xFE,0x7F,0xFF,0x3F,0xFF,0xDF,0xFF,0xFF,0xC0,0xFF,0xA3,
+0xFC,0xFF,0x0A,0xFC,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0x81,0xFF,0x83,0xFD,0xFF,
+0x0B,0xFC,0x3D,0xFF,0xFF,0xCF,0xFF,0xDF,0xFF,0xFF,0x81,0xFF,0xC7,0xFD,0xFF,0x0B,
+0xF0,0x01,0xFF,0xFF,0xE7,0xFF,0xCF,0xFF,0xFF,0x03,0xFF,0xC7,0xFD,0xFF,0x0B,0xE0,
+0xF1,0xFF,0xFF,0xF7,0xFF,0xCF,0xFF,0xFF,0x03,0xFF,0x83,0xFD,0xFF,0x0B,0xC1,0xFB,
+0xFF,0xFF,0xF3,0xFF,0xCF,0xFF,0xFE,0x07,0xFF,0x0C,0xFD,0xFF,0x0C,0x83,0xF3,0xFF,
+0xFF,0xF3,0xFF,0xCF,0xFF,0xFE,0x07,0xFF,0x1E,0x7F,0xFE,0xFF,0x0C,0x83,0xF3,0xFF,
+0xFF,0xF3,0xFF,0xE7,0xFF,0xFE,0x0F,0xFE,0x3F,0x1F,0xFE,0xFF,0x0C,0x87,0xF3,0xFF,
+0xFF,0xF3,0xFF,0xE7,0xFF,0xFC,0x0F,0xFE,0x3F,0xCF,0xFE,0xFF,0x0C,0x87,0xFB,0xFF,
+0xFF,0xF3,0xFF,0xE3,0xFF,0xFC,0x1F,0xFC,0x7F,0xF3,0xFE,0xFF,0x0C,0x87,0xFB,0xFF,
+0xFF,0xF3,0xFF,0xF3,0xFF,0xFC,0x1F,0xF8,0xFF,0xF8,0xFE,0xFF,0x4A,0x87,0xF9,0xFF,
+0xFF,0xF7,0xFF,0xF1,0xFF,0xFC,0x3F,0xF0,0xFF,0xFE,0x1F,0xFF,0xFF,0xC3,0xF9,0xFF,
+0xF7,0xE7,0xFF,0xF8,0xFF,0xF8,0x3F,0xE1,0xFF,0xFF,0xC7,0xFF,0xFF,0xC3,0xFD,0xDF,
+0xB7,0x8F,0xFF,0xFC,0x7F,0xF8,0x3F,0xC3,0xFF,0xFF,0xF0,0xFF,0xFF,0xE1,0xFC,0xCF,
+0xC0,0x3F,0xFF,0xFC,0x3F,0xF8,0x7F,0x87,0xFF,0xFF,0xFC,0x1F,0xFF,0xF0,0x3C,0xE7,
+0xC0,0xFF,0xFF,0xFE,0x1F,0xF8,0x7E,0x0F,0xFE,0xFF,0x05,0x81,0xFF,0xFC,0x3E,0xF3,
+0x9F,0xFE,0xFF,0x0C,0x87,0xF8,0x7C,0x1F,0xFF,0xFF,0xE0,0x08,0x07,0xFF,0xFE,0x78,
+0x3F,0xFE,0xFF,0x0B,0xC1,0xF8,0xE0,0x7F,0xFF,0xFF,0xE0,0x0F,0xE0,0x03,0xFF,0x3F,
+0xFD,0xFF,0x02,0xE0,0x10,0x00,0xFE,0xFF,0x05,0xE0,0x0F,0xFF,0x80,0x7F,0x3F,0xFD,
+0xFF,0x0B,0xF8,0x00,0x07,0xFF,0xFF,0xFC,0x00,0x0F,0xFC,0x00,0x1F,0x9F,0xFC,0xFF,
+0x0A,0x00,0x1F,0xFF,0xFF,0xFC,0x00,0x7F,0xF0,0x00,0x07,0xDF,0xFC,0xFF,0x00,0xF0,
+0xFD,0xFF,0x05,0xE1,0xFF,0xC1,0xFF,0x01,0xCF,0xFC,0xFF,0x00,0xF1,0xFD,0xFF,0x05,
+0xF3,0xFF,0x0F,0xFF,0xF0,0x67,0xFC,0xFF,0x00,0xF1,0xFD,0xFF,0x05,0xF7,0xFE,0x3F,
+0xFF,0xFE,0x17,0xFC,0xFF,0x0A,0xF1,0xFF,0xE3,0xFF,0xFF,0xF7,0xFC,0xFF,0x00,0x3F,
+0x83,0xFC,0xFF,0x02,0xF1,0xFF,0xF8,0xFE,0xFF,0x04,0xF9,0xF8,0x00,0x07,0xC3,0xFC,
+0xFF,0x0A,0xF1,0xFF,0xFE,0x3F,0xFF,0xFF,0xF3,0xE1,0xFF,0xF0,0xF1,0xFC,0xFF,0x0A,
+0xF1,0xFF,0xFF,0xBF,0xFF,0xFF,0xE7,0xC7,0xFF,0xFC,0x78,0xFC,0xFF,0x0B,0xF1,0xFF,
+0xFF,0x9F,0xFF,0xFF,0xCF,0x1F,0xFF,0xFF,0x9C,0x7F,0xFD,0xFF,0x0B,0xF1,0xFF,0xFF,
+0xCF,0xFF,0xFF,0x9F,0x7F,0xFF,0xFF,0xC7,0x3F,0xFD,0xFF,0x0B,0xF1,0xFF,0xFF,0xCF,
+0xFF,0xFF,0x9E,0x7F,0xFF,0xFF,0xF3,0x9F,0xFD,0xFF,0x06,0xF1,0xFF,0xFF,0xCF,0xFF,
+0xFF,0x3C,0xFE,0xFF,0x01,0xFD,0xCF,0xFD,0xFF,0x06,0xF9,0xFF,0xFF,0xCF,0xFF,0xFF,
+0x38,0xFE,0xFF,0x01,0xFE,0xC7,0xFD,0xFF,0x06,0xF9,0xFF,0xFF,0xCC,0x07,0xFE,0x79,
+0xFD,0xFF,0x00,0xE3,0xFD,0xFF,0x06,0xF9,0xFF,0xFF,0xC8,0xF3,0xFE,0x79,0xFD,0xFF,
+0x00,0xF1,0xFD,0xFF,0x06,0xF9,0xFF,0xFF,0xC3,0xFD,0xFC,0xF9,0xFD,0xFF,0x00,0xF1,
+0xFD,0xFF,0x06,0xF9,0xFF,0xFF,0xC7,0xFE,0xFC,0xF9,0xFD,0xFF,0x00,0xF8,0xFD,0xFF,
+0x0B,0xF8,0xFF,0xFF,0xCF,0xFF,0xFC,0xF9,0xFF,0x01,0xFF,0xFF,0xFC,0xFD,0xFF,0x0B,
+0xF8,0xFF,0xFF,0xCF,0xFF,0xF9,0xFD,0xFC,0x00,0x7F,0xFF,0xFC,0xFD,0xFF,0x0C,0xFC,
+0xFF,0xFF,0x9F,0xFF,0xF9,0xFE,0xF8,0x7F,0x9F,0xFF,0xFE,0x7F,0xFE,0xFF,0x0C,0xFC,
+0xFF,0xFE,0x1F,0xFF,0xF9,0xFF,0x31,0xFF,0xEF,0xFF,0xFE,0x7F,0xFE,0xFF,0x0C,0xFC,
+0xFF,0xFC,0x3F,0xFF,0xF9,0xFF,0xF3,0xFF,0xF7,0xFF,0xFE,0x3F,0xFE,0xFF,0x0C,0xFC,
+0x7F,0xF8,0x7F,0xFF,0xF9,0xFF,0xE3,0xFF,0xF9,0xFF,0xFF,0x3F,0xFE,0xFF,0x0C,0xFE,
+0x7F,0xF8,0xFF,0xFF,0xF9,0xFF,0xC7,0xFF,0xFD,0xFF,0xFF,0x3F,0xFE,0xFF,0x0C,0xFE,
+0x7F,0xF0,0xFF,0xFF,0xF9,0xFF,0xC7,0xFF,0xFC,0xFF,0xFF,0x1F,0xFE,0xFF,0x0C,0xFE,
+0x7F,0xF1,0xFF,0xFF,0xF9,0xFF,0xC7,0xFD,0xFE,0x7F,0xFF,0x1F,0xFE,0xFF,0x0C,0xFE,
+0x3F,0xF1,0xFF,0xFF,0xF9,0xFF,0xC7,0xFC,0xFF,0x7F,0xFF,0x1F,0xFD,0xFF,0x0B,0x3F,
+0xE1,0xFF,0xFF,0xF9,0xFF,0xC7,0xFC,0xFF,0x3F,0xFF,0x9F,0xFD,0xFF,0x0B,0x3F,0xE3,
+0xFF,0xFF,0xF9,0xFF,0xC7,0xFC,0xFF,0xBF,0xFF,0x9F,0xFD,0xFF,0x0B,0x9F,0xE3,0xFF,
+0xFF,0xFD,0xFF,0xE7,0xFC,0xFF,0xBF,0xFF,0x9F,0xFD,0xFF,0x0B,0x9F,0xE3,0xFF,0xFF,
+0xFC,0xFF,0xF3,0xFC,0xFF,0xBF,0xFF,0x9F,0xFD,0xFF,0x0B,0x9F,0xE3,0xFF,0xFF,0xFC,
+0xFF,0xF1,0xF8,0xFF,0xBF,0xFF,0x9F,0xFD,0xFF,0x0B,0xCF,0xE3,0xFF,0xFF,0xFE,0x7F,
+0xF8,0xF9,0xFF,0xBF,0xFF,0x9F,0xFE,0xFF,0x0C,0xFE,0x4F,0xE3,0xFF,0xFF,0xFE,0x7F,
+0xFC,0x03,0xFF,0x3F,0xFF,0x1F,0xFE,0xFF,0x02,0xFE,0x47,0xE3,0xFE,0xFF,0x06,0x3F,
+0xFF,0x0E,0x3F,0x7F,0xFF,0x1F,0xFE,0xFF,0x02,0xFE,0xC7,0xF3,0xFE,0xFF,0x06,0x1F,
+0xFF,0xFC,0x1F,0x7F,0xFF,0x3F,0xFE,0xFF,0x02,0xFC,0xC3,0xF3,0xFE,0xFF,0x0C,0x9F,
+0xFF,0xFB,0xEE,0xFF,0xFF,0x3F,0xFF,0xFF,0xF7,0xF9,0xC3,0xF1,0xFE,0xFF,0x0C,0xCF,
+0xFF,0xF3,0xF4,0xFF,0xFE,0x3F,0xFF,0xFF,0xF9,0xF3,0x89,0xF9,0xFE,0xFF,0x0C,0xE7,
+0xFF,0xF7,0xF1,0xFF,0xFE,0x3F,0xFF,0xFF,0xFE,0x07,0x98,0xF9,0xFE,0xFF,0x06,0xF1,
+0xFF,0xF7,0xF3,0xFF,0xFE,0x7F,0xFD,0xFF,0x2A,0x1C,0xFC,0xFF,0x80,0xFF,0xF8,0xFF,
+0xF7,0xE1,0xFF,0xFE,0x7F,0xFF,0xFF,0xE3,0xFE,0x3E,0x7C,0xFC,0x00,0x1F,0xFC,0x3F,
+0xF7,0x0D,0xFF,0xFC,0x7F,0xFF,0xFF,0x80,0x00,0x7E,0x3E,0x70,0x1C,0x0F,0xFF,0x00,
+0x00,0x1C,0xFF,0xFC,0xFE,0xFF,0x0C,0x20,0x00,0xFF,0x3E,0x61,0xFF,0x83,0xFF,0xC0,
+0x00,0x7C,0xFF,0xFC,0xFE,0xFF,0x0C,0x7C,0x03,0xFF,0x9F,0x03,0xFF,0xE1,0xFF,0xF8,
+0x01,0xFE,0xFF,0xF9,0xFE,0xFF,0x0C,0x7F,0xFF,0xFF,0x8F,0x8F,0xFF,0xF0,0xFF,0xFF,
+0xFB,0xFE,0xFF,0xF9,0xFE,0xFF,0x0C,0x7F,0xFF,0xFF,0xC7,0x8F,0xFF,0xF8,0x7F,0xFF,
+0xFB,0xFE,0xFF,0xF3,0xFE,0xFF,0x0C,0xBF,0xFF,0xFF,0xE7,0x0F,0xFF,0xFC,0x7F,0xFF,
+0xFD,0xFE,0xFF,0xF3,0xFE,0xFF,0x0C,0xDF,0xFF,0xFF,0xF3,0x27,0xFF,0xFE,0x3F,0xFF,
+0xFF,0xFE,0xFF,0xE7,0xFB,0xFF,0x09,0xF8,0x73,0xFF,0xFF,0x1F,0xFF,0xFF,0xFE,0xFF,
+0xCF,0xFB,0xFF,0x09,0xF8,0x79,0xFF,0xFF,0x1F,0xFF,0xFF,0xFE,0xFF,0xCF,0xFB,0xFF,
+0x09,0xFC,0x7C,0xFF,0xFF,0x8F,0xFF,0xFF,0xFE,0xFF,0x9F,0xFB,0xFF,0x09,0xFC,0x3E,
+0x7F,0xFF,0x8F,0xFF,0xFF,0xFE,0xFF,0x3F,0xFB,0xFF,0x09,0xF9,0x1F,0x3F,0xFF,0xC7,
+0xFF,0x8F,0xFC,0xFE,0x7F,0xFB,0xFF,0x08,0xF9,0x8F,0xDF,0xFF,0xC7,0xFF,0x07,0xFC,
+0xFC,0xFA,0xFF,0x08,0xF9,0xC3,0xE7,0xFF,0xE3,0xFE,0xF3,0xFC,0x19,0xFA,0xFF,0x08,
+0xF1,0xF1,0xF3,0xFF,0xE3,0xFD,0xFD,0xF1,0xC3,0xFA,0xFF,0x08,0xF3,0xF8,0xF8,0xFF,
+0xF3,0xFD,0xFC,0xE5,0xE7,0xFA,0xFF,0x08,0xF3,0xFC,0x3E,0x3F,0xF1,0xFB,0xFE,0xE9,
+0xC7,0xFA,0xFF,0x08,0xF3,0xFF,0x1F,0x9F,0xF9,0xFB,0xFE,0xC9,0x17,0xFA,0xFF,0x08,
+0xF3,0xFF,0x87,0xC7,0xF8,0xFB,0xFE,0x58,0x73,0xFA,0xFF,0x08,0xF3,0xFF,0xE1,0xF8,
+0xF8,0xFB,0x06,0x59,0xFB,0xFA,0xFF,0x08,0xF3,0xFF,0xF8,0x7E,0x00,0x00,0x3E,0x53,
+0xFB,0xFA,0xFF,0x08,0xE3,0xFF,0xFC,0x0F,0xFC,0x7D,0xFE,0x37,0xFB,0xFA,0xFF,0x08,
+0xE3,0xFF,0xFF,0x83,0xFC,0x7D,0xFE,0x37,0xF3,0xFA,0xFF,0x08,0xE3,0xFF,0xFF,0xF0,
+0x04,0x7D,0x86,0x27,0xF3,0xFA,0xFF,0x08,0xE3,0xFF,0xFF,0xFE,0x00,0x00,0x3E,0x2F,
+0xF7,0xFA,0xFF,0x00,0xE3,0xFE,0xFF,0x04,0xFE,0x3E,0xFE,0x6F,0xE7,0xFA,0xFF,0x00,
+0xE3,0xFE,0xFF,0x04,0xFE,0x3E,0xFE,0xCF,0xEF,0xFA,0xFF,0x00,0xE3,0xFD,0xFF,0x03,
+0x3F,0xFC,0xDF,0xCF,0xFA,0xFF,0x00,0xF3,0xFD,0xFF,0x03,0x3F,0xFD,0x9F,0xDF,0xFA,
+0xFF,0x00,0xF3,0xFD,0xFF,0x03,0x1F,0xFD,0xBF,0x9F,0xFA,0xFF,0x00,0xF3,0xFD,0xFF,
+0x03,0x1F,0xF9,0x3F,0x3F,0xFA,0xFF,0x00,0xF3,0xFD,0xFF,0x03,0x1F,0xFB,0x7E,0x7F,
+0xFA,0xFF,0x00,0xF3,0xFD,0xFF,0x02,0x9F,0xF6,0x7C,0xF9,0xFF,0x00,0xF3,0xFD,0xFF,
+0x02,0x9F,0xF4,0xF9,0xF9,0xFF,0x00,0xF3,0xFD,0xFF,0x02,0x9F,0xED,0xE3,0xF9,0xFF,
+0x00,0xF3,0xFD,0xFF,0x02,0x9F,0xDB,0xCF,0xF9,0xFF,0x00,0xFB,0xFD,0xFF,0x02,0x8F,
+0x97,0x1F,0xF9,0xFF,0x00,0xFB,0xFD,0xFF,0x02,0x8F,0x08,0x7F,0xF9,0xFF,0x00,0xFB,
+0xFD,0xFF,0x01,0x00,0x03,0xF8,0xFF,0x00,0xF9,0xFE,0xFF,0x02,0xFE,0x8C,0x7F,0xF8,
+0xFF,0x00,0xF9,0xFE,0xFF,0x02,0xFD,0x8F,0x3F,0xF8,0xFF,0x00,0xFD,0xFE,0xFF,0x02,
+0xF9,0x8F,0xDF,0xF8,0xFF,0x00,0xFD,0xFE,0xFF,0x02,0xFB,0x8F,0xEF,0xF8,0xFF,0x00,
+0xFC,0xFE,0xFF,0x02,0xF7,0x8F,0xF7,0xF8,0xFF,0x00,0xFE,0xFE,0xFF,0x02,0xE7,0x8F,
+0xFB,0xF4,0xFF,0x06,0xEF,0x8F,0xF9,0xFF,0xFF,0xC0,0x0F,0xF8,0xFF,0x06,0xCF,0x8F,
+0xFC,0xFF,0xFF,0x9F,0xE1,0xF8,0xFF,0x06,0xCF,0x8F,0xFE,0xFE,0x00,0x7F,0xFC,0xF8,
+0xFF,0x07,0xDF,0x8F,0xFF,0x70,0xF7,0x0F,0xFE,0x7F,0xF9,0xFF,0x07,0x9F,0x8F,0xFF,
+0x07,0xF9,0xE3,0xFF,0x3F,0xF9,0xFF,0x07,0x9F,0x8F,0xFF,0x3F,0xFE,0xF1,0xFF,0xBF,
+0xF9,0xFF,0x07,0x9F,0x9F,0xFC,0x3F,0xFF,0x7A,0x7F,0xBF,0xFC,0xFF,0x0A,0xFE,0x3F,
+0xFF,0x1F,0x9F,0xF9,0x9F,0xFF,0xBD,0x07,0x3F,0xFC,0xFF,0x0A,0xFC,0x87,0xFF,0x1F,
+0x9F,0xF3,0xDF,0xFF,0xDE,0x93,0x7F,0xFC,0xFF,0x0A,0xFD,0x2F,0xFF,0x1F,0x9F,0xF7,
+0xCF,0xFF,0xCF,0x4C,0x7F,0xFC,0xFF,0x0A,0xF2,0x0F,0xFF,0x1F,0x9F,0xE7,0xEF,0xFF,
+0xCF,0x2F,0x7F,0xFC,0xFF,0x0A,0xFD,0x7F,0xFF,0x1F,0xBF,0xEF,0xEF,0xFF,0xCF,0xB7,
+0xBF,0xFC,0xFF,0x0A,0xFD,0x8F,0xFF,0x1F,0xBF,0xCF,0xE7,0xFD,0xDF,0x93,0xDF,0xFC,
+0xFF,0x0A,0xFE,0xFF,0xFF,0x1F,0x3F,0xCF,0xE7,0xFE,0x3F,0xD9,0xEF,0xF9,0xFF,0x07,
+0x1F,0x3F,0xCF,0xE7,0xFF,0xFF,0xCD,0xF7,0xF9,0xFF,0x07,0x9F,0x7F,0xCF,0xE7,0xFF,
+0xFF,0xCC,0xF3,0xF9,0xFF,0x07,0x9F,0x7F,0xEF,0xE7,0xFF,0xF7,0xCE,0xFB,0xF9,0xFF,
+0x07,0x9E,0x7F,0xE7,0xE7,0xFF,0xFB,0xDE,0x79,0xF9,0xFF,0x07,0x8E,0x7F,0xF7,0xEF,
+0xFF,0xFC,0x1F,0x79,0xF9,0xFF,0x07,0x8C,0xFF,0xF3,0xCF,0xFF,0xFE,0x3F,0x79,0xF9,
+0xFF,0x07,0x8C,0xFF,0xF8,0x1F,0xFF,0xFF,0xFC,0x79,0xF9,0xFF,0x07,0x0D,0xFF,0xFE,
+0x3F,0xFF,0xFF,0xFE,0x33,0xFA,0xFF,0x01,0xFE,0x43,0xFB,0xFF,0x00,0x07,0xFA,0xFF,
+0x01,0xFC,0xC3,0xFB,0xFF,0x00,0x9F,0xFA,0xFF,0x01,0xF9,0xC7,0xFB,0xFF,0x00,0xBF,
+0xFA,0xFF,0x01,0xF3,0xE3,0xFB,0xFF,0x00,0xBF,0xFA,0xFF,0x01,0xE3,0xC3,0xFB,0xFF,
+0x00,0xBF,0xFA,0xFF,0x01,0xC3,0x81,0xFB,0xFF,0x00,0xBF,0xFA,0xFF,0x01,0x83,0x71,
+0xFB,0xFF,0x00,0xBF,0xFA,0xFF,0x01,0x84,0xF8,0xFB,0xFF,0x00,0x7F,0xFA,0xFF,0x01,
+0x17,0xF8,0xFB,0xFF,0x00,0x7F,0xFB,0xFF,0x03,0xC6,0x17,0xFC,0x7F,0xFD,0xFF,0x01,
+0xFE,0x7F,0xFB,0xFF,0x03,0x02,0x27,0xFE,0x3F,0xFD,0xFF,0x00,0xFE,0xFB,0xFF,0x04,
+0xFE,0x7C,0x2F,0xFE,0x3F,0xFD,0xFF,0x00,0xFC,0xFB,0xFF,0x04,0xFE,0xFC,0x4F,0xFF,
+0x3F,0xFD,0xFF,0x00,0xF9,0xFB,0xFF,0x02,0xFC,0xF8,0x5F,0xFB,0xFF,0x00,0xFB,0xFB,
+0xFF,0x02,0xFD,0xF8,0x3F,0xFB,0xFF,0x00,0xF7,0xFB,0xFF,0x02,0xFD,0xF8,0x3F,0xFB,
+0xFF,0x00,0xCF,0xFB,0xFF,0x02,0xFD,0xF0,0x3F,0xFB,0xFF,0x00,0x3F,0xFB,0xFF,0x05,
+0xFC,0xF0,0x3F,0xFF,0xFF,0xF7,0xF7,0xFF,0x05,0xFC,0xF1,0x3F,0xFF,0xFF,0xF3,0xF7,
+0xFF,0x05,0xFE,0x21,0x3F,0xFF,0xFF,0xE0,0xF6,0xFF,0x05,0x01,0x7F,0xFF,0xFF,0xF0,
+0x0F,0xF7,0xFF,0x07,0xE1,0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0xF9,0xFF,0x01,0xE3,
+0x7F,0xFE,0xFF,0x02,0x80,0x00,0x7F,0xF9,0xFF,0x03,0xE2,0xFF,0xFF,0xAF,0xF5,0xFF,
+0x03,0xE0,0xFF,0xFF,0x4B,0xF5,0xFF,0x03,0xE1,0xFF,0xFF,0x83,0xF5,0xFF,0x03,0xE1,
+0xFF,0xFF,0x8B,0xF5,0xFF,0x03,0xE1,0xFF,0xFF,0x7F,0xF5,0xFF,0x00,0xE1,0xFB,0xFF,
+0x02,0xC0,0x00,0x07,0xFB,0xFF,0x00,0xC1,0xFB,0xFF,0x02,0xC0,0x00,0x07,0xFB,0xFF,
+0x00,0x31,0xFB,0xFF,0x02,0xC0,0x00,0x07,0xFC,0xFF,0x01,0xF8,0x71,0xFB,0xFF,0x02,
+0xC0,0x00,0x07,0xFE,0xFF,0x03,0xF0,0x00,0x03,0xF8,0xFB,0xFF,0x02,0xC0,0x00,0x07,
+0xFB,0xFF,0x00,0xF8,0xFB,0xFF,0x02,0xC0,0x40,0x07,0xFB,0xFF,0x01,0xFC,0x7F,0xFC,
+0xFF,0x02,0xC0,0x40,0x07,0xFB,0xFF,0x01,0xFC,0x3F,0xFC,0xFF,0x02,0xC2,0x40,0x07,
+0xFB,0xFF,0x01,0xFE,0x3F,0xFC,0xFF,0x02,0xC5,0xFF,0x87,0xFA,0xFF,0x00,0x1F,0xFC,
+0xFF,0x02,0xC2,0xA0,0x87,0xFA,0xFF,0x00,0x8F,0xFC,0xFF,0x02,0xC2,0x20,0x87,0xFA,
+0xFF,0x00,0xC7,0xFC,0xFF,0x02,0xC1,0x20,0x07,0xFA,0xFF,0x00,0xE3,0xFC,0xFF,0x02,
+0xC0,0x10,0x07,0xFA,0xFF,0x00,0xF0,0xFC,0xFF,0x02,0xC0,0x10,0x07,0xFA,0xFF,0x02,
+0xFC,0x3F,0x87,0xFE,0xFF,0x02,0xC0,0x00,0x07,0xF9,0xFF,0x01,0x1F,0x07,0xFE,0xFF,
+0x02,0xC0,0x00,0x07,0xF9,0xFF,0x01,0xC0,0x0F,0xFE,0xFF,0x02,0xC0,0x0F,0x07,0xF9,
+0xFF,0x01,0xC4,0x1F,0xFE,0xFF,0x02,0xC0,0x01,0x07,0xF9,0xFF,0x01,0xE3,0xDF,0xFE,
+0xFF,0x02,0xC0,0xF1,0x07,0xF9,0xFF,0x00,0xE3,0xFD,0xFF,0x02,0xC0,0x89,0x07,0xFC,
+0xFF,0x03,0xFE,0x5F,0xFF,0xE1,0xFD,0xFF,0x02,0xC0,0xE9,0x07,0xFB,0xFF,0x09,0xAF,
+0xFF,0xE1,0xFF,0x7F,0xFF,0xFF,0xC3,0xFE,0x07,0xFB,0xFF,0x09,0x1F,0xFF,0xD1,0xFF,
+0x6F,0xFF,0xFF,0xC0,0xF8,0x07,0xFB,0xFF,0x09,0x47,0xFF,0xD1,0xFC,0x1F,0xFF,0xFF,
+0xC0,0xA8,0x07,0xFC,0xFF,0x0A,0xFC,0xBB,0xFF,0xDB,0xFF,0x3F,0xFF,0xFF,0xC0,0x70,
+0x07,0xFB,0xFF,0x03,0x7F,0xFF,0xDF,0xFE,0xFE,0xFF,0x02,0xC0,0x00,0x07,0xFB,0xFF,
+0x02,0x7F,0xFF,0xDF,0xFD,0xFF,0x02,0xC0,0x00,0x07,0xF9,0xFF,0x00,0xCF,0xFD,0xFF,
+0x02,0xC0,0x03,0x07,0xF9,0xFF,0x00,0xCF,0xFD,0xFF,0x02,0xC3,0x12,0x07,0xF9,0xFF,
+0x00,0xCF,0xFD,0xFF,0x02,0xC3,0xEA,0x07,0xF9,0xFF,0x00,0xCF,0xFD,0xFF,0x02,0xC3,
+0x3E,0x07,0xF9,0xFF,0x00,0xCF,0xFD,0xFF,0x02,0xC3,0x22,0x07,0xF9,0xFF,0x00,0xCF,
+0xFD,0xFF,0x02,0xC3,0x3E,0x07,0xF9,0xFF,0x00,0xCF,0xFD,0xFF,0x02,0xC1,0xCA,0x07,
+0xF9,0xFF,0x00,0x8F,0xFD,0xFF,0x02,0xC0,0x05,0x07,0xFA,0xFF,0x01,0xFE,0x0F,0xFD,
+0xFF,0x02,0xC0,0x01,0x07,0xFA,0xFF,0x01,0xF0,0x0F,0xFD,0xFF,0x02,0xC0,0x00,0x07,
+0xFA,0xFF,0x01,0xC0,0x1F,0xFD,0xFF,0x02,0xC0,0x00,0x07,0xFA,0xFF,0x01,0xC0,0x5F,
+0xFD,0xFF,0x02,0xC0,0x42,0x07,0xFA,0xFF,0x01,0xF1,0x9F,0xFD,0xFF,0x02,0xC1,0x52,
+0x07,0xF9,0xFF,0x00,0x9F,0xFD,0xFF,0x02,0xCF,0x72,0x07,0xFA,0xFF,0x01,0x0F,0x9F,
+0xFD,0xFF,0x02,0xC0,0xFE,0x07,0xFB,0xFF,0x02,0xFE,0xEF,0x9F,0xFD,0xFF,0x02,0xC0,
+0xAA,0x07,0xFB,0xFF,0x02,0xFC,0xF7,0x1F,0xFD,0xFF,0x02,0xC0,0x21,0x07,0xFB,0xFF,
+0x02,0xFE,0xFF,0x5F,0xFD,0xFF,0x02,0xC3,0x00,0x07,0xFB,0xFF,0x02,0xFE,0xFE,0x47,
+0xFD,0xFF,0x02,0xC0,0xFF,0x07,0xFB,0xFF,0x02,0xFE,0x70,0xC3,0xFD,0xFF,0x02,0xC0,
+0x20,0x07,0xFB,0xFF,0x02,0xFE,0x8E,0xD0,0xFD,0xFF,0x02,0xC0,0x10,0x07,0xFB,0xFF,
+0x03,0xFD,0x1E,0xD0,0x7F,0xFE,0xFF,0x02,0xC0,0x00,0x87,0xFB,0xFF,0x03,0xFE,0x3F,
+0xD8,0x3F,0xFE,0xFF,0x02,0xC0,0x00,0x87,0xFB,0xFF,0x03,0xFE,0x1F,0xDC,0x3F,0xFE,
+0xFF,0x02,0xC0,0x10,0x87,0xF9,0xFF,0x00,0xCF,0xFD,0xFF,0x02,0xC2,0x51,0x07,0xF9,
+0xFF,0x00,0xCF,0xFD,0xFF,0x02,0xC5,0xFF,0x07,0xF9,0xFF,0x00,0xEF,0xFD,0xFF,0x02,
+0xC3,0xF2,0x07,0xF9,0xFF,0x00,0xE7,0xFD,0xFF,0x02,0xC1,0xEA,0x07,0xF9,0xFF,0x01,
+0xF0,0xBF,0xFE,0xFF,0x02,0xC0,0x0A,0x07,0xF9,0xFF,0x01,0xEF,0x7F,0xFE,0xFF,0x02,
+0xC0,0x06,0x07,0xF9,0xFF,0x00,0xEF,0xFD,0xFF,0x02,0xC1,0xBA,0x07,0xF4,0xFF,0x02,
+0xC0,0x02,0x07,0xF4,0xFF,0x02,0xC0,0x00,0x07,0xF4,0xFF,0x02,0xC0,0x01,0x07,0xF8,
+0xFF,0x00,0xBF,0xFE,0xFF,0x02,0xC0,0x01,0x07,0xF9,0xFF,0x01,0xFC,0x3F,0xFE,0xFF,
+0x02,0xC0,0x03,0x07,0xF9,0xFF,0x01,0xFE,0xAF,0xFE,0xFF,0x02,0xC0,0x03,0x07,0xF9,
+0xFF,0x01,0xFE,0x1F,0xFE,0xFF,0x02,0xC0,0xC4,0x07,0xFB,0xFF,0x03,0xEB,0xFF,0xFE,
+0xAF,0xFE,0xFF,0x02,0xC0,0x48,0x07,0xFB,0xFF,0x03,0xEB,0xFF,0xFF,0x3F,0xFE,0xFF,
+0x02,0xCF,0xF8,0x07,0xF8,0xFF,0x00,0x7F,0xFE,0xFF,0x02,0xC0,0x78,0x07,0xF4,0xFF,
+0x02,0xC0,0x26,0x07,0xF4,0xFF,0x02,0xC0,0x21,0x07,0xF4,0xFF,0x02,0xC0,0x01,0x07,
+0xF4,0xFF,0x02,0xC0,0x01,0x07,0xF4,0xFF,0x02,0xC0,0x00,0x07,0xF4,0xFF,0x02,0xC0,
+0x00,0x07,0xF4,0xFF,0x02,0xC0,0x00,0x07,0xF4,0xFF,0x02,0xC0,0x00,0x07,0xF4,0xFF,
+0x02,0xC0,0x00,0x07,0xA1,0xFF,
+};
+
+// BitmapExample2 : 4736 bytes, packed 980
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x9F,0x00,
+0x00,0xF0,0xF3,0x00,0x01,0x01,0xF8,0xF3,0x00,0x01,0x03,0xFC,0xF3,0x00,0x01,0x03,
+0xFE,0xF3,0x00,0x01,0x07,0xFF,0xF3,0x00,0x01,0x07,0xFF,0xF3,0x00,0x01,0x03,0xFE,
+0xF3,0x00,0x01,0x03,0xFE,0xF3,0x00,0x01,0x01,0xF8,0xF2,0x00,0x00,0x60,0x81,0x00,
+0xE8,0x00,0x00,0x0E,0xF2,0x00,0x00,0x1F,0xF2,0x00,0x00,0x3F,0xF2,0x00,0x00,0x3F,
+0xF2,0x00,0x00,0x3F,0xF2,0x00,0x00,0x3E,0xF2,0x00,0x00,0x08,0x81,0x00,0x85,0x00,
+0x00,0xF0,0xF7,0x00,0x00,0x3E,0xFE,0x00,0x01,0x01,0xFC,0xF7,0x00,0x00,0x7F,0xFE,
+0x00,0x01,0x01,0xFC,0xF7,0x00,0x01,0x7F,0x80,0xFE,0x00,0x00,0xFC,0xF7,0x00,0x01,
+0xFF,0x80,0xFE,0x00,0x00,0xFC,0xFD,0x00,0x00,0x1E,0xFC,0x00,0x01,0xFF,0xC0,0xFE,
+0x00,0x00,0x7C,0xFD,0x00,0x00,0x3E,0xFC,0x00,0x01,0x7F,0x80,0xFE,0x00,0x00,0x30,
+0xFD,0x00,0x00,0x3F,0xFC,0x00,0x01,0x7F,0x80,0xF9,0x00,0x00,0x3F,0xFC,0x00,0x02,
+0x3F,0x17,0x80,0xFB,0x00,0x01,0x70,0x3E,0xFC,0x00,0x02,0x0C,0x3F,0xC0,0xFB,0x00,
+0x01,0xF8,0x0C,0xFB,0x00,0x01,0x3F,0xE0,0xFC,0x00,0x01,0x01,0xF8,0xFA,0x00,0x01,
+0x3F,0xE0,0xFC,0x00,0x01,0x01,0xF8,0xFA,0x00,0x01,0x3F,0xE0,0xFB,0x00,0x00,0xF8,
+0xFA,0x00,0x01,0x3F,0xE0,0xFB,0x00,0x00,0x70,0xFA,0x00,0x01,0x1F,0xE0,0xF3,0x00,
+0x01,0x0F,0xC0,0xF3,0x00,0x00,0x07,0xE5,0x00,0x00,0x3C,0xF2,0x00,0x00,0x7E,0xF2,
+0x00,0x00,0xFF,0xF2,0x00,0x00,0xFF,0xF2,0x00,0x00,0xFF,0xF2,0x00,0x00,0xFF,0xF2,
+0x00,0x00,0x7F,0xF2,0x00,0x00,0x18,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0xEE,0x00,0x00,0xFE,0xF3,0x00,0x01,0x01,0xFE,0xF3,0x00,0x01,0x01,
+0xFF,0xF3,0x00,0x01,0xF9,0xFF,0xF4,0x00,0x03,0x07,0xFD,0xFF,0x80,0xF5,0x00,0x03,
+0x07,0xFD,0xFF,0x80,0xF5,0x00,0x03,0x07,0xFF,0xFF,0x80,0xF5,0x00,0x03,0x07,0xFE,
+0xFF,0x80,0xF5,0x00,0x02,0x0F,0xFE,0xFF,0xF4,0x00,0x03,0x0F,0xFE,0xFE,0x78,0xF5,
+0x00,0x03,0x0F,0xFE,0xB9,0xFC,0xF5,0x00,0x03,0x03,0xFE,0x07,0xFC,0xF4,0x00,0x02,
+0x0C,0x1F,0xFC,0xF5,0x00,0x03,0x03,0xF0,0x0F,0xFC,0xF5,0x00,0x03,0x07,0xFC,0x1F,
+0xFE,0xF5,0x00,0x03,0x0F,0xFC,0x0F,0xFE,0xF5,0x00,0x03,0x0F,0xFE,0xEF,0xFC,0xF5,
+0x00,0x03,0x0F,0xFD,0xF7,0xF8,0xF5,0x00,0x03,0x0F,0xFF,0xFB,0xF0,0xF5,0x00,0x03,
+0x0F,0xFB,0xFC,0xE0,0xF5,0x00,0x02,0x0F,0xFF,0xFE,0xF4,0x00,0x02,0x07,0xF7,0xFF,
+0xF4,0x00,0x02,0x01,0xF7,0xFF,0xF3,0x00,0x01,0xE7,0xFF,0xF3,0x00,0x01,0x03,0xFF,
+0xF3,0x00,0x01,0x03,0xFC,0xF2,0x00,0x00,0x78,0xF2,0x00,0x00,0x10,0x81,0x00,0xEF,
+0x00,0x01,0x7F,0x80,0xF3,0x00,0x01,0xFF,0xC0,0xF3,0x00,0x01,0x7F,0xC0,0xF4,0x00,
+0x02,0x3E,0x7F,0xE0,0xF5,0x00,0x03,0x03,0xFF,0x7F,0xF0,0xF5,0x00,0x03,0x03,0xFF,
+0x7F,0xF0,0xF5,0x00,0x03,0x03,0xFF,0xFF,0xF0,0xF5,0x00,0x03,0x03,0xFF,0xBF,0xF8,
+0xF5,0x00,0x03,0x07,0xFF,0xBF,0xF0,0xF5,0x00,0x03,0x07,0xFF,0xBF,0xEF,0xF5,0x00,
+0x04,0x07,0xFF,0xBF,0x8F,0x80,0xF6,0x00,0x04,0x07,0xFF,0xAF,0x3F,0x80,0xF6,0x00,
+0x04,0x01,0xFE,0x80,0xFF,0x80,0xF5,0x00,0x03,0x3F,0x03,0xFF,0xC0,0xF5,0x00,0x03,
+0xF8,0x01,0xFF,0xC0,0xF6,0x00,0x04,0x03,0xFF,0x03,0xFF,0xC0,0xF6,0x00,0x04,0x07,
+0xFF,0x03,0xFF,0xE0,0xF6,0x00,0x04,0x07,0xFF,0x89,0xFF,0xE0,0xF6,0x00,0x04,0x07,
+0xFF,0x2D,0xFF,0x80,0xF6,0x00,0x03,0x07,0xFF,0x7E,0xFF,0xF5,0x00,0x03,0x07,0xFE,
+0xFF,0x7E,0xF5,0x00,0x03,0x07,0xFE,0xFF,0x9C,0xF5,0x00,0x03,0x0F,0xFF,0xFF,0xC0,
+0xF5,0x00,0x03,0x07,0xFD,0xFF,0xE0,0xF5,0x00,0x03,0x01,0xF9,0xFF,0xE0,0xF4,0x00,
+0x02,0x79,0xFF,0xE0,0xF4,0x00,0x02,0x01,0xFF,0xE0,0xF3,0x00,0x01,0xFF,0xC0,0xF3,
+0x00,0x00,0x7F,0xF5,0x00,0x03,0x3E,0x00,0x00,0x0E,0xF6,0x00,0x04,0x07,0x7F,0x00,
+0x00,0x04,0xF6,0x00,0x01,0x0F,0xFF,0xF3,0x00,0x02,0x0F,0xFF,0x80,0xF4,0x00,0x05,
+0x1F,0xFF,0x80,0x00,0x00,0x80,0xF7,0x00,0x05,0x0F,0xFF,0x80,0x00,0x05,0xC0,0xF7,
+0x00,0x05,0x07,0x7F,0xF0,0x00,0x1F,0xF0,0xF7,0x00,0x05,0x03,0xFF,0xF8,0x00,0x1F,
+0xF0,0xF7,0x00,0x05,0x0C,0x17,0xFE,0x00,0x1F,0xF0,0xF7,0x00,0x05,0x06,0x0F,0xFE,
+0x00,0x1F,0xF0,0xF7,0x00,0x05,0x07,0x0F,0xFC,0x00,0x1F,0x60,0xF7,0x00,0x04,0x03,
+0x07,0xFC,0x00,0x3E,0xF5,0x00,0x03,0x3B,0xF8,0x00,0x3E,0xF5,0x00,0x04,0x7F,0xF0,
+0x00,0x3F,0x60,0xF6,0x00,0x04,0x7F,0xE0,0x00,0x3F,0xE0,0xF6,0x00,0x04,0x7F,0xF0,
+0x00,0x1F,0xC0,0xF6,0x00,0x04,0x3F,0xF0,0x00,0x07,0x80,0xF6,0x00,0x03,0x1F,0xF0,
+0x00,0x07,0xF5,0x00,0x01,0x0E,0x30,0xF3,0x00,0x00,0x06,0xF2,0x00,0x00,0x02,0x81,
+0x00,0xE1,0x00,0x00,0xF0,0xF3,0x00,0x01,0x0C,0xF0,0xF3,0x00,0x01,0x3F,0xF8,0xF3,
+0x00,0x01,0x3F,0xF8,0xF3,0x00,0x01,0x3F,0xF0,0xF3,0x00,0x01,0x3E,0x7E,0xF3,0x00,
+0x01,0x0E,0x3E,0xF3,0x00,0x01,0x3E,0x3F,0xF3,0x00,0x01,0x3E,0x7E,0xF3,0x00,0x01,
+0x3F,0xFC,0xF3,0x00,0x01,0x3F,0xF0,0xF3,0x00,0x01,0x1D,0xF0,0xF3,0x00,0x01,0x01,
+0xF0,0xF2,0x00,0x02,0xE0,0x08,0x30,0xF3,0x00,0x01,0x0F,0x70,0xF3,0x00,0x01,0x0F,
+0xF0,0xF3,0x00,0x01,0x1F,0xFC,0xF3,0x00,0x01,0x1F,0xFC,0xF3,0x00,0x01,0x0F,0xFC,
+0xF5,0x00,0x03,0x0E,0x00,0x3F,0xB8,0xF5,0x00,0x03,0x6E,0x00,0x3F,0x38,0xF5,0x00,
+0x02,0xFF,0x00,0x7E,0xF4,0x00,0x03,0xFE,0x00,0x7F,0x40,0xF5,0x00,0x03,0x63,0x80,
+0x3F,0x20,0xF5,0x00,0x03,0xE3,0xC0,0x3F,0x60,0xF5,0x00,0x03,0xFF,0x80,0x0F,0xC0,
+0xF5,0x00,0x02,0xFE,0x00,0x0F,0xF4,0x00,0x02,0x7E,0x00,0x0F,0xF4,0x00,0x00,0x0E,
+0x81,0x00,0xB8,0x00,
+};
+
+// BitmapExample3 : 4736 bytes, packed 3834
+const unsigned char BitmapExample3_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0x81,0xFF,0xC0,0xFF,0x00,0xE0,0xF6,0x00,0x00,0x01,
+0xFE,0xFF,0x00,0xC0,0xF5,0x00,0xFE,0xFF,0x00,0x9F,0xF6,0xFF,0x04,0xFE,0x7F,0xFF,
+0xFF,0x3F,0xF5,0xFF,0x03,0x3F,0xFF,0xFE,0x7F,0xF5,0xFF,0x02,0x9F,0xFF,0xFC,0xF4,
+0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x02,0xCF,0xFF,
+0xFC,0xF4,0xFF,0x02,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFD,
+0xFF,0x02,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x02,
+0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x02,0xCF,0xFF,
+0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x02,0xCF,0xFF,0xFC,0xFD,
+0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0x00,0x03,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,
+0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0x00,0x03,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,
+0xF8,0xFE,0x00,0x00,0x7F,0xFE,0x00,0x03,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,
+0xFE,0x00,0x07,0x7F,0x00,0x07,0xF0,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,
+0x00,0x07,0x7F,0x07,0xDF,0xF8,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,
+0x07,0x7F,0x0F,0xFF,0xFC,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x0B,0xF8,0x00,0xC0,0x00,
+0x7F,0x1F,0xFF,0xFE,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x0B,0xF8,0x00,0x87,0xFE,0x7F,
+0x1F,0xFF,0xFF,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x70,0xF8,0x4C,0x06,0x02,0x7F,0x1F,
+0xFF,0xFF,0x1F,0xCF,0xFF,0xFC,0xFF,0xFC,0xFF,0xFF,0xF8,0x4E,0x85,0x72,0x7F,0x1F,
+0xFF,0x9F,0x1F,0xCF,0xFF,0xFC,0xFF,0xF8,0x00,0xFF,0xF9,0xFA,0x05,0xBC,0x7F,0x1F,
+0x3E,0x1F,0x1F,0xCF,0xFF,0xFC,0xFF,0xF8,0x01,0xFF,0xF8,0x0A,0x82,0xC0,0x7F,0x1F,
+0x1C,0x1F,0x1F,0xCF,0xFF,0xFC,0xFF,0xFB,0xFD,0xFF,0xF8,0x0C,0x04,0xA0,0x7F,0x0F,
+0x80,0x3F,0x1F,0xCF,0xFF,0xFC,0xFF,0xFB,0x73,0xFF,0xF8,0x00,0x81,0xF8,0x7F,0x07,
+0x80,0x3F,0x1F,0xCF,0xFF,0xFC,0xFF,0xFB,0x33,0xFF,0xF8,0x00,0x40,0x00,0x7F,0x03,
+0x80,0x3F,0x1F,0xCF,0xFF,0xFC,0xFF,0xFD,0x33,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0x00,
+0x00,0x3E,0x1F,0xCF,0xFF,0xFC,0xFF,0xFC,0x03,0xFF,0xF8,0xFE,0x00,0x00,0x7F,0xFE,
+0x00,0x03,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0x00,0x00,0x02,0x7F,0xFE,0x00,
+0x03,0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0x00,0x00,0x02,0x7F,0xFE,0x00,0x03,
+0x1F,0xCF,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0x00,0x42,0x02,0x7F,0xFD,0xFF,0x02,0xCF,
+0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0x48,0x46,0x06,0x7F,0xFD,0xFF,0x02,0xCF,0xFF,0xFC,
+0xFD,0xFF,0x04,0xF9,0xB9,0x45,0x44,0x7F,0xFD,0xFF,0x02,0xCF,0xFF,0xFC,0xFD,0xFF,
+0x04,0xF8,0x5B,0xC5,0x68,0x7F,0xFD,0xFF,0x02,0xCF,0xFF,0xFC,0xFD,0xFF,0x50,0xF8,
+0xB6,0x4A,0xF8,0x7F,0xFF,0xF7,0xFF,0xFF,0xCF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,
+0x6D,0xC2,0x90,0x7F,0xFF,0xEF,0x00,0x7F,0xCF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,
+0x14,0x42,0xB0,0x7F,0xC7,0xEF,0x6F,0x7F,0xCF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,
+0x00,0x21,0x08,0x7F,0xD8,0xEF,0x67,0xFF,0xCF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,
+0x00,0x00,0x04,0x7F,0xD4,0xCF,0x03,0xFF,0xCF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,
+0xFE,0x00,0x0C,0x7F,0xE4,0x0F,0x78,0xFF,0xCF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,
+0xFE,0x00,0x0C,0x7F,0xE4,0x54,0x01,0x7F,0xFF,0xFF,0xFC,0xFE,0x1F,0xBF,0x87,0xF8,
+0xFE,0x00,0x03,0x7F,0xE2,0x57,0x4B,0xFE,0xFF,0x05,0xFC,0xFE,0x3F,0xFF,0xC7,0xF8,
+0xFE,0x00,0x03,0x7F,0xFE,0x76,0x01,0xFE,0xFF,0x0C,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,
+0x0E,0x00,0xE0,0x7F,0xFF,0xB7,0xFA,0xFE,0xFF,0x19,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,
+0x1F,0x01,0xF0,0x7F,0xFF,0xF7,0xFD,0x7F,0xFF,0xFF,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,
+0x3F,0x83,0xF8,0x7F,0xFB,0xFF,0x09,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0x7F,0xC7,0xFC,
+0x7F,0xFB,0xFF,0x09,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0x7F,0xC7,0xFC,0x7F,0xFE,0xFF,
+0x0C,0xFC,0xFF,0xFF,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0x3F,0x83,0xF8,0x7F,0xFE,0xFF,
+0x0C,0xFC,0x00,0xFF,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0x1F,0x01,0xF0,0x7F,0xFE,0xFF,
+0x0C,0xFC,0xFE,0x3F,0xFC,0xFE,0x3F,0xFF,0xC7,0xF8,0x0E,0x00,0xE0,0x7F,0xFE,0xFF,
+0x08,0xFC,0x7F,0x3F,0xFC,0xFE,0x1F,0x9F,0x87,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xFC,0x4F,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xF8,0x53,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xF8,0x53,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xFC,0x53,0x7F,0xFC,0xFE,0x00,0x00,0xE7,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xFC,0x53,0xFF,0xFC,0xFE,0x00,0x00,0xE7,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xFC,0x5B,0xFF,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x08,0xFC,0x69,0xFF,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFF,0x7F,
+0x7F,0xFC,0x21,0xFF,0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0xFF,
+0xBF,0xFF,0x3D,0xFF,0xFC,0xFE,0x3F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0xFF,
+0xBF,0xFF,0xBF,0xFF,0xFC,0xFE,0x3F,0xFF,0xE7,0xF8,0xFE,0x00,0x03,0x7F,0xFE,0xFF,
+0xBF,0xFE,0xFF,0x05,0xFC,0xFE,0x1E,0x00,0xE7,0xF8,0xFE,0x00,0x03,0x7F,0xFE,0xFF,
+0xBF,0xFE,0xFF,0x05,0xFC,0xFE,0x0E,0x00,0xE7,0xF8,0xFE,0x00,0x70,0x7F,0xFF,0x7F,
+0x7F,0xFF,0xBF,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xE0,0x00,0x00,0x7F,0xFF,0xBE,
+0x7F,0xFF,0x1F,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFC,0x00,0x00,0x7F,0xFF,0xC1,
+0xFF,0xFF,0x1C,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFF,0x80,0x00,0x7F,0xFF,0x3F,
+0xFF,0xFE,0x38,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFF,0xF0,0x00,0x7F,0xFE,0xDF,
+0xFF,0xFC,0xF0,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFF,0xFE,0x00,0x7F,0xFE,0xDF,
+0xFF,0xFF,0xE4,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFF,0xFF,0xC0,0x7F,0xFF,0x3F,
+0xFF,0xFF,0xDC,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFD,0xFF,0xF8,0x7F,0xFD,0xFF,
+0x02,0x9C,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0xFC,0x3F,0xFC,0x7F,0xFD,0xFF,0x02,0xE4,
+0xFF,0xFC,0xFD,0xFF,0x0B,0xF8,0xFC,0x07,0xFC,0x7F,0xC0,0x00,0x07,0xFC,0x70,0xFF,
+0xFC,0xFD,0xFF,0x0B,0xF8,0xFC,0x00,0xFC,0x7F,0xC0,0x00,0x07,0xFE,0x38,0xFF,0xFC,
+0xFD,0xFF,0x0B,0xF8,0xFC,0x00,0x1C,0x7F,0xC0,0x00,0x07,0xFF,0x1C,0xFF,0xFC,0xFD,
+0xFF,0x0B,0xF8,0xFE,0x00,0x00,0x7F,0xC1,0xFC,0x07,0xFF,0x9E,0x7F,0xFC,0xFD,0xFF,
+0x0B,0xF8,0xFF,0x00,0x00,0x7F,0xC7,0xFF,0x07,0xFF,0x9F,0xFF,0xFC,0xFD,0xFF,0x07,
+0xF8,0xFF,0x00,0x00,0x7F,0xCF,0xFF,0x87,0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x07,0xF8,
+0x0F,0x00,0x00,0x7F,0xCF,0xFF,0xC7,0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,
+0x00,0x07,0x7F,0xCF,0xFF,0xC7,0xFF,0xFE,0x7F,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,
+0x07,0x7F,0xCF,0xFF,0xE7,0xFE,0xFE,0x7F,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x0C,
+0x7F,0xCF,0xFF,0xE7,0xFE,0x3C,0xFF,0xFC,0xFF,0xE0,0x00,0x7F,0xF8,0xFE,0x00,0x7F,
+0x7F,0xCF,0xFD,0xE7,0xFE,0x82,0xFF,0xFC,0xFF,0xE3,0xFE,0xFF,0xF8,0x00,0x3F,0x80,
+0x7F,0xC7,0xF8,0xE7,0xFE,0xA6,0xFF,0xFC,0xFF,0xEF,0xFC,0xFF,0xF8,0x3E,0x7F,0xE0,
+0x7F,0xC3,0xF0,0xE7,0xFE,0xA8,0xFF,0xFC,0xFF,0xED,0xBD,0xFF,0xF8,0x7F,0xFF,0xF0,
+0x7F,0xC0,0x00,0x07,0xFE,0xAE,0xFF,0xFC,0xFF,0xF4,0x9F,0xFF,0xF8,0xFF,0xFF,0xF8,
+0x7F,0xC0,0x00,0xE7,0xFE,0x00,0xFF,0xFC,0xFF,0xF0,0x1F,0xFF,0xF8,0xFF,0xFF,0xF8,
+0x7F,0xC0,0x00,0xE7,0xFC,0xDE,0x7F,0xFC,0xFF,0xFF,0xE7,0xFF,0xF8,0xFF,0xFF,0xFC,
+0x7F,0xCF,0xFF,0xE7,0xFC,0x4F,0x7F,0xFC,0xFF,0xFF,0xF9,0xFF,0xF8,0xFF,0xFC,0x7C,
+0x7F,0xCF,0xFF,0xE7,0xFC,0x27,0x7F,0xFC,0xFF,0xFF,0xFC,0xFF,0xF8,0xFB,0xF8,0x3C,
+0x17,0x7F,0xCF,0xFF,0xE7,0xFC,0xB3,0xFF,0xFC,0xFF,0xFF,0xFE,0xFF,0xF8,0xF1,0xF0,
+0x7C,0x7F,0xC7,0xFF,0xE7,0xFC,0x00,0x7F,0xFC,0xFD,0xFF,0x0B,0xF8,0xF8,0xE0,0xFC,
+0x7F,0xC7,0xFF,0xE7,0xFE,0xFF,0xFF,0xFC,0xFD,0xFF,0x07,0xF8,0x7C,0x01,0xFC,0x7F,
+0xC7,0x80,0xE7,0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x0B,0xF8,0x3C,0x01,0xFC,0x7F,0xC3,
+0x80,0xE7,0xFE,0xFF,0xFF,0xFC,0xFD,0xFF,0x0B,0xF8,0x1C,0x01,0xF8,0x7F,0xC0,0x00,
+0x07,0xFE,0x7F,0xFF,0xFC,0xFD,0xFF,0x0B,0xF8,0x00,0x01,0xF8,0x7F,0xC0,0x00,0x07,
+0xFE,0x7F,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x07,0x7F,0xC0,0x00,0x07,0xFC,
+0x7F,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x07,0x7F,0xC0,0x00,0x07,0xFC,0x80,
+0x3F,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,0x08,0xFC,0xAB,0xFF,
+0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,0x08,0xFC,0xAB,0xFF,
+0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFF,0xFF,0x7F,0xFC,0xAB,0xFF,
+0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0xFF,0x7F,0xF8,0x2B,0xFF,
+0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0xBE,0x7F,0xFC,0x01,0xFF,
+0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0x06,0xFF,0xFC,0x9C,0x7F,
+0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFA,0xA9,0xFF,0xFC,0xCE,0x7F,
+0xFC,0xFE,0x78,0x7F,0x87,0xF8,0xFE,0x00,0x0C,0x7F,0xFA,0x09,0xFF,0xFC,0x6F,0x7F,
+0xFC,0xFE,0x7D,0xFF,0xC7,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0xB6,0xFF,0xFE,0x67,0xFF,
+0xFC,0xFE,0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0x0E,0xFF,0xFF,0xE7,0xFF,
+0xFC,0xFE,0x7F,0xF9,0xE7,0xF8,0xFE,0x00,0x03,0x7F,0xFF,0xF1,0x7F,0xFE,0xFF,0x0B,
+0xFC,0xFE,0x7F,0xF0,0xE7,0xF8,0x07,0x81,0xE0,0x7F,0xFF,0xFE,0xFD,0xFF,0x19,0xFC,
+0xFE,0x7F,0xE1,0xE7,0xF8,0x0F,0xC3,0xF0,0x7F,0xFF,0xFF,0x7F,0xFF,0xEF,0xFF,0xFC,
+0xFE,0x7F,0xE3,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xFD,0xFF,0x0B,0xE7,0xFF,0xFC,0xFE,
+0x7F,0xC3,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xFE,0xFF,0x48,0xFC,0xE7,0xFF,0xFC,0xFE,
+0x3F,0xC3,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xFF,0xFE,0xFF,0xFC,0xEF,0xFF,0xFC,0xFE,
+0x0F,0xC3,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xFF,0xFD,0xFF,0xFC,0x6F,0xFF,0xFC,0xFE,
+0x01,0xC3,0xC7,0xF8,0x0F,0xC3,0xF0,0x7F,0xFC,0x71,0xFF,0xFD,0x2F,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0x07,0x81,0xE0,0x7F,0xFD,0x91,0xFF,0xFD,0x80,0x7F,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0x55,0xFF,0xFD,0x1F,0x3F,0xFC,0xFE,
+0x07,0xFE,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0x51,0xFF,0xFC,0x4F,0xBF,0xFC,0xFE,
+0x1F,0xFF,0x87,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0x00,0xFF,0xFC,0x4F,0xBF,0xFC,0xFE,
+0x3F,0xFF,0xC7,0xF8,0xFE,0x00,0x0C,0x7F,0xFF,0xF6,0xFF,0xFE,0x6F,0xFF,0xFC,0xFE,
+0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFF,0xFE,0xFF,0xFE,0x67,0xFF,0xFC,0xFE,
+0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0xE7,0xFF,0xFF,0xE7,0xFF,0xFC,0xFE,
+0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFF,0xB8,0xFF,0xFF,0xE7,0xFF,0xFC,0xFE,
+0x7F,0xFF,0xE7,0xF8,0xFE,0x00,0x00,0x7F,0xFB,0xFF,0x05,0xFC,0xFE,0x7F,0xFF,0xE7,
+0xF8,0xFE,0x00,0x00,0x7F,0xFB,0xFF,0x05,0xFC,0xFE,0x3F,0xFF,0xC7,0xF8,0xFE,0x00,
+0x00,0x7F,0xFD,0xFF,0x07,0xFE,0xFF,0xFC,0xFE,0x1F,0xFF,0x87,0xF8,0xFE,0x00,0x00,
+0x7F,0xFD,0xFF,0x07,0xFE,0x3F,0xFC,0xFE,0x07,0xFE,0x07,0xF8,0xFE,0x00,0x00,0x7F,
+0xFE,0xFF,0x08,0xFC,0xFF,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,
+0xFE,0xFF,0x08,0xFC,0x3F,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,
+0xFE,0xFF,0x08,0xFC,0x87,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,
+0xFE,0xFF,0x08,0xFC,0x97,0x7F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,0x00,0x00,0x7F,
+0xFE,0xFF,0x0C,0xFC,0x97,0x7F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0x00,0x03,0xE0,0x7F,
+0xFE,0xFF,0x0C,0xF8,0x17,0x7F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0x1F,0xC3,0xFC,0x7F,
+0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xFC,0xFD,0xFF,0x04,0xF8,0x7F,0xF3,0xFC,0x7F,0xFE,
+0xFF,0x03,0xFC,0x40,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0x7F,0xF8,0xFC,0x7F,0xFE,0xFF,
+0x03,0xFC,0x4B,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0xFF,0xFC,0xFC,0x7F,0xFE,0xFF,0x03,
+0xFC,0x0B,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0xFF,0xFF,0xFC,0x7F,0xFE,0xFF,0x03,0xFC,
+0x03,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0xFF,0xFF,0xFC,0x7F,0xFE,0xFF,0x03,0xFC,0xF3,
+0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0xFC,0x3F,0xFC,0x7F,0xFB,0xFF,0x00,0xFC,0xFD,0xFF,
+0x04,0xF8,0xF8,0x0F,0xFC,0x7F,0xFB,0xFF,0x00,0xFC,0xFD,0xFF,0x04,0xF8,0xFC,0x03,
+0xFC,0x7F,0xFD,0xFF,0x02,0xFE,0xFF,0xFC,0xFD,0xFF,0x04,0xF8,0x7E,0x01,0xFC,0x7F,
+0xFC,0xFF,0x36,0x3F,0xFC,0xFF,0xFF,0xDF,0xFF,0xF8,0x7E,0x00,0xFC,0x7F,0xFE,0x01,
+0xFF,0xFC,0xFF,0x3F,0xFC,0xFF,0xFF,0x9F,0xFF,0xF8,0x3E,0x00,0x3C,0x7F,0xFE,0xFB,
+0xFF,0xFC,0x33,0x3F,0xFC,0xFF,0xFC,0x9F,0xFF,0xF8,0x0E,0x00,0x1C,0x7F,0xFE,0xB7,
+0xFF,0xFD,0x02,0x7F,0xFC,0xFF,0xEC,0x9F,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0x17,
+0xFF,0xFD,0x4A,0xFF,0xFC,0xFF,0xE4,0x9F,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0xFF,0x03,
+0xFF,0xFD,0x40,0xFF,0xFC,0xFF,0xE0,0x07,0xFF,0xF8,0xFE,0x00,0x00,0x7F,0xFE,0xFF,
+0x0C,0xFD,0x40,0xFF,0xFC,0xFF,0xE0,0x40,0x1F,0xF8,0x00,0x00,0x1C,0x7F,0xFE,0xFF,
+0x0C,0xFD,0x5C,0xFF,0xFC,0xFF,0xC2,0x6F,0xFF,0xF8,0x00,0x00,0x1C,0x7F,0xFE,0xFF,
+0x0C,0xFD,0x40,0xFF,0xFC,0xFF,0xC6,0x0F,0xFF,0xF8,0x00,0x00,0x1C,0x7F,0xFE,0xFF,
+0x4F,0xFC,0x5C,0xFF,0xFC,0xFF,0xF3,0x0F,0xFF,0xF8,0xFF,0xFF,0xFC,0x7F,0x80,0x00,
+0x0F,0xFC,0x10,0xFF,0xFC,0xFF,0xF9,0x6F,0xFF,0xF8,0xFF,0xFF,0xFC,0x7F,0x80,0x00,
+0x0F,0xFC,0xC2,0x7F,0xFC,0xFF,0xFD,0x67,0xFF,0xF8,0xFF,0xFF,0xFC,0x7F,0x80,0x00,
+0x0F,0xFF,0xFE,0x7F,0xFC,0xFF,0xFF,0xF7,0xFF,0xF8,0xFF,0xFF,0xFC,0x7F,0x80,0x07,
+0x0F,0xFF,0xFE,0x7F,0xFC,0xFF,0xFF,0xF7,0xFF,0xF8,0x7F,0xFF,0xFC,0x7F,0x87,0xE7,
+0xCF,0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x07,0xF8,0x7F,0xFF,0xFC,0x7F,0x8F,0xFF,0xCF,
+0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x0B,0xF8,0x3C,0x00,0x1C,0x7F,0x9F,0xFF,0xCF,0xFF,
+0xFE,0xFF,0xFC,0xFD,0xFF,0x0B,0xF8,0x3C,0x00,0x1C,0x7F,0x9F,0xFF,0xCF,0xFD,0xFE,
+0x7F,0xFC,0xFD,0xFF,0x0B,0xF8,0x1C,0x00,0x1C,0x7F,0x9F,0xFF,0xCF,0xFC,0x92,0x7F,
+0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x07,0x7F,0x9F,0x3F,0xCF,0xFC,0x92,0x7F,0xFC,
+0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x0C,0x7F,0x9F,0x8F,0xCF,0xFC,0x92,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x8F,0x87,0xCF,0xF8,0x00,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x83,0x81,0xCF,0xFD,0x92,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFC,0x9A,0x7F,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x01,0xCF,0xFE,0x9B,0x7F,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x01,0xCF,0xFF,0xFF,0x7F,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x9F,0xFF,0xCF,0xFC,0xFF,0xFF,0xFC,0xFE,
+0x70,0x7F,0x07,0xF8,0xFE,0x00,0x0C,0x7F,0x9F,0xFF,0xCF,0xFC,0x00,0x3F,0xFC,0xFE,
+0x70,0xFF,0xC7,0xF8,0xFE,0x00,0x0C,0x7F,0x9F,0xFF,0xCF,0xFC,0x7F,0xFF,0xFC,0xFE,
+0x79,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0x8F,0xFF,0xCF,0xFE,0x7F,0xFF,0xFC,0xFE,
+0x7D,0xFF,0xE7,0xF8,0xFE,0x00,0x03,0x7F,0x8F,0xFF,0xCF,0xFE,0xFF,0x05,0xFC,0xFE,
+0x7D,0xFF,0xE7,0xF8,0xFE,0x00,0x03,0x7F,0x8F,0x01,0xCF,0xFE,0xFF,0x05,0xFC,0xFE,
+0x3F,0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0x87,0x01,0xCF,0xFF,0xFF,0x7F,0xFC,0xFE,
+0x3F,0xFF,0xE7,0xF8,0xFE,0x00,0x40,0x7F,0x80,0x00,0x0F,0xFD,0x4F,0x3F,0xFC,0xFE,
+0x1F,0xFF,0xE7,0xF8,0x0E,0x00,0xE0,0x7F,0x80,0x00,0x0F,0xFD,0x0F,0x3F,0xFC,0xFE,
+0x0F,0xFF,0xC7,0xF8,0x1F,0x01,0xF0,0x7F,0x80,0x00,0x0F,0xFD,0x0E,0x7F,0xFC,0xFE,
+0x07,0xFF,0x87,0xF8,0x3F,0x83,0xF8,0x7F,0x80,0x00,0x0F,0xFD,0x0E,0x7F,0xFC,0xFE,
+0x01,0xFF,0x07,0xF8,0x7F,0xC7,0xFC,0x7F,0xFE,0xFF,0x0C,0xFC,0x80,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0x7F,0xC7,0xFC,0x7F,0xFE,0xFF,0x0C,0xF8,0x84,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0x3F,0x83,0xF8,0x7F,0xFE,0xFF,0x0C,0xFC,0x15,0xFF,0xFC,0xFE,
+0x00,0x00,0x07,0xF8,0x1F,0x01,0xF0,0x7F,0xFE,0xFF,0x0C,0xFE,0x95,0xFF,0xFC,0xFE,
+0x00,0x00,0xE7,0xF8,0x0E,0x00,0xE0,0x7F,0xFD,0xFF,0x07,0xFD,0xFF,0xFC,0xFE,0x00,
+0x00,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFC,0x00,0xFF,0xFD,0xF5,0xFF,0xFC,0xFE,0x7F,
+0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0xDD,0xFF,0xFC,0xA9,0xFF,0xFC,0xFE,0x7F,
+0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0x2D,0xFF,0xFC,0xA9,0xFF,0xFC,0xFE,0x7F,
+0xFF,0xE7,0xF8,0xFE,0x00,0x0C,0x7F,0xFE,0x0F,0xFF,0xFD,0xF5,0xFF,0xFC,0xFE,0x3F,
+0xFF,0xE7,0xF8,0xFE,0x00,0x02,0x7F,0xFF,0xF3,0xFD,0xFF,0x05,0xFC,0xFE,0x3F,0xFF,
+0xE7,0xF8,0xFE,0x00,0x02,0x7F,0xFF,0xFD,0xFD,0xFF,0x09,0xFC,0xFE,0x1E,0x00,0xE7,
+0xF8,0x10,0x01,0x00,0x7F,0xFD,0xFF,0x0B,0xFE,0x7F,0xFC,0xFE,0x0E,0x00,0xE7,0xF8,
+0x10,0x01,0x00,0x7F,0xFD,0xFF,0x67,0xBE,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF8,0x50,
+0x05,0x00,0x7F,0x80,0x00,0x0F,0xFF,0x3E,0x3F,0xFC,0xFE,0x00,0x00,0x07,0xF9,0x7F,
+0xF7,0xFE,0x7F,0x80,0x00,0x0F,0xFF,0x3C,0x7F,0xFC,0xFE,0x00,0x00,0x07,0xF9,0xE8,
+0x1E,0x80,0x7F,0x80,0x00,0x0F,0xFF,0x39,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0x68,
+0x06,0x80,0x7F,0x80,0x00,0x0F,0xFF,0x33,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0x14,
+0x01,0x40,0x7F,0x80,0x00,0x0F,0xFD,0x0F,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0x04,
+0x00,0x40,0x7F,0x80,0x00,0x0F,0xFC,0x0F,0xFF,0xFC,0xFE,0x00,0x00,0x07,0xF8,0xFE,
+0x00,0x07,0x7F,0x80,0x00,0x0F,0xFF,0x33,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,
+0x07,0x7F,0x80,0x00,0x0F,0xFF,0x38,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x07,
+0x7F,0x80,0x1E,0x0F,0xFF,0x1C,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x07,0x7F,
+0x9F,0xFF,0xCF,0xFF,0x1E,0x7F,0xFC,0xFD,0xFF,0x0B,0xF8,0x01,0x88,0x00,0x7F,0x9F,
+0xFF,0xCF,0xFF,0xFE,0x7F,0xFC,0xFD,0xFF,0x0B,0xF8,0x01,0x08,0x80,0x7F,0x9F,0xFF,
+0xCF,0xFF,0xFE,0xFF,0xFC,0xFD,0xFF,0x07,0xF8,0x21,0x09,0x80,0x7F,0x9F,0xFF,0xCF,
+0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x07,0xF8,0x31,0x08,0x00,0x7F,0x87,0xFF,0xCF,0xFE,
+0xFF,0x00,0xFC,0xFD,0xFF,0x07,0xF8,0xFF,0x0F,0xFC,0x7F,0x83,0xFE,0x0F,0xFE,0xFF,
+0x0C,0xFC,0xFF,0xFF,0x9F,0xFF,0xF8,0x01,0x0C,0x00,0x7F,0x81,0xFE,0x0F,0xFE,0xFF,
+0x0C,0xFC,0xFF,0xF7,0x81,0xFF,0xF8,0x01,0x04,0x00,0x7F,0x80,0x7E,0x0F,0xFE,0xFF,
+0x0C,0xFC,0xFF,0xE7,0xB8,0x7F,0xF8,0x00,0x84,0x00,0x7F,0x80,0x3E,0x0F,0xFE,0xFF,
+0x0C,0xFC,0xFF,0xE6,0x3F,0x3F,0xF8,0x00,0x84,0x00,0x7F,0x80,0x00,0x0F,0xFE,0xFF,
+0x05,0xFC,0xFF,0xE7,0x0F,0x7F,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFF,0xCF,
+0xFF,0xFC,0xFF,0xF7,0x87,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFF,0xCF,
+0xFF,0xFC,0xFF,0xF7,0xD9,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFF,0xCF,
+0xFF,0xFC,0xFF,0xF1,0xFC,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFF,0xCF,
+0xFF,0xFC,0xFF,0xF0,0x7E,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFF,0xCF,
+0xFF,0xFC,0xFF,0xFF,0x3F,0x7F,0xF8,0xFE,0x00,0x0C,0x7F,0x80,0x00,0x0F,0xFF,0xCF,
+0xFF,0xFC,0xFF,0xFF,0xC7,0xFF,0xF8,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x07,0xCF,0xFF,
+0xFC,0xFF,0xFF,0xE3,0xFF,0xF8,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x07,0xCF,0xFF,0xFC,
+0xFF,0xFF,0xFB,0xFF,0xF8,0xFE,0x00,0x00,0x7F,0xFD,0xFF,0x07,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xF5,0xFF,0xF8,0xFE,0x00,0x7F,0x7F,0xFD,0x87,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xE7,0xFF,0xF8,0x40,0x00,0x00,0x7F,0xF9,0xB9,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xC7,0xFF,0xF8,0x40,0x0F,0xFF,0x7F,0xF9,0x1D,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xC7,0xFF,0xFB,0xFF,0xC8,0x01,0x7F,0xFD,0x8F,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0x3F,0xFF,0xF8,0x40,0x48,0x01,0x7F,0xFD,0xD3,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFE,0x78,0xFF,0xF8,0x40,0x09,0xFC,0x7F,0xFC,0x3B,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFC,0xF6,0xFF,0xF8,0x4C,0x09,0x24,0x7F,0xFF,0xDF,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xF1,0xF7,0xFF,0xF8,0x50,0x09,0x24,0x7F,0xFF,0xE7,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xE3,0x99,0xFF,0xF8,0x00,0x09,0x24,0x10,0x7F,0xFF,0xFB,0xFF,0xFF,0xCF,0xFF,0xFC,
+0xFF,0xC7,0x8C,0xFF,0xF9,0xFF,0x05,0xFC,0x7F,0xFD,0xFF,0x37,0xCF,0xFF,0xFC,0xFF,
+0xFC,0xE0,0xFF,0xF9,0x22,0x0C,0x00,0x7F,0xFF,0xF9,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFE,0x78,0xFF,0xF9,0x22,0x00,0x00,0x7F,0xFF,0xBB,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0x1C,0x7F,0xF9,0xFF,0x83,0xFF,0x7F,0xFC,0x37,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xCF,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0xFD,0x57,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xE7,0xFF,0xF8,0xFE,0x00,0x0C,0x7F,0xF1,0xEB,0xFF,0xFF,0xCF,0xFF,0xFC,0xFF,
+0xFF,0xF7,0xFF,0xF8,0xFE,0x00,0x07,0x7F,0xFC,0x5D,0xFF,0xFF,0xCF,0xFF,0xFC,0xFD,
+0xFF,0x00,0xF8,0xFE,0x00,0x07,0x7F,0xFF,0x80,0xFF,0xFF,0xCF,0xFF,0xFC,0xFD,0xFF,
+0x00,0xF8,0xFE,0x00,0x07,0x7F,0xFE,0x6F,0xFF,0xFF,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,
+0xF8,0xFE,0x00,0x07,0x7F,0xFF,0xF7,0xFF,0xFF,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,
+0xFE,0x00,0x07,0x7F,0xFF,0xFB,0xFF,0xFF,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,
+0x00,0x00,0x7F,0xFD,0xFF,0x02,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,
+0x7F,0xFD,0xFF,0x02,0xCF,0xFF,0xFC,0xFD,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xFD,
+0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x02,0xCF,0xFF,
+0xFC,0xF4,0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x02,0xCF,0xFF,0xFC,0xF4,0xFF,0x03,
+0xCF,0xFF,0xFE,0x7F,0xF5,0xFF,0x03,0x9F,0xFF,0xFF,0x3F,0xF5,0xFF,0x03,0x3F,0xFF,
+0xFF,0x9F,0xF6,0xFF,0x04,0xFE,0x7F,0xFF,0xFF,0xC0,0xF5,0x00,0xFE,0xFF,0x00,0xE0,
+0xF6,0x00,0x00,0x01,0x81,0xFF,0x81,0xFF,0xCF,0xFF,
+};
+
+// BitmapExample4 : 4736 bytes, packed 1024
+const unsigned char BitmapExample4_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xA6,0x00,0x01,0x03,
+0xE0,0xF4,0x00,0x02,0x03,0x8F,0xF0,0xF7,0x00,0x05,0xC0,0x00,0x00,0x07,0xDF,0xF8,
+0xF7,0x00,0x05,0x80,0x00,0x00,0x0F,0xFF,0xFC,0xF8,0x00,0x00,0x4C,0xFE,0x00,0x02,
+0x0F,0xFF,0x0E,0xF8,0x00,0x06,0x4E,0x80,0x00,0x00,0x0E,0x1C,0x06,0xF9,0x00,0x01,
+0x01,0xFA,0xFE,0x00,0x02,0x0C,0x08,0x06,0xF8,0x00,0x06,0x0A,0x80,0x00,0x00,0x04,
+0x00,0x0E,0xF8,0x00,0x00,0x0C,0xFE,0x00,0x02,0x02,0x00,0x0E,0xF7,0x00,0x05,0x80,
+0x00,0x00,0x01,0x00,0x1E,0xF7,0x00,0x00,0x40,0xFD,0x00,0x00,0x1C,0xB7,0x00,0x00,
+0x40,0xF3,0x00,0x01,0x48,0x40,0xF4,0x00,0x02,0x01,0xB9,0x40,0xF3,0x00,0x01,0x5B,
+0xC0,0xF3,0x00,0x01,0xB6,0x40,0xF3,0x00,0x01,0x6D,0xC0,0xF3,0x00,0x01,0x14,0x40,
+0xF2,0x00,0x00,0x20,0xB7,0x00,0x01,0x0F,0x1F,0xF3,0x00,0x02,0x1F,0xBF,0x80,0xF4,
+0x00,0x04,0x31,0xFF,0xC0,0x00,0x0E,0xF6,0x00,0x04,0x20,0xF8,0xC0,0x00,0x1F,0xF6,
+0x00,0x05,0x21,0xF0,0x40,0x00,0x3F,0x80,0xF7,0x00,0x05,0x33,0xE0,0x40,0x00,0x3F,
+0x80,0xF7,0x00,0x04,0x3F,0xF0,0xC0,0x00,0x1F,0xF6,0x00,0x04,0x1F,0x9F,0x80,0x00,
+0x0E,0xF6,0x00,0x01,0x0F,0x0F,0xA1,0x00,0x00,0x40,0xF2,0x00,0x00,0x40,0xF4,0x00,
+0x02,0x3F,0xFF,0xC0,0xF4,0x00,0x02,0x1F,0xFF,0xC0,0xF4,0x00,0x02,0x1F,0xFF,0xC0,
+0xF4,0x00,0x02,0x0C,0x00,0x40,0xF4,0x00,0x02,0x04,0x00,0x40,0xD0,0x00,0x00,0x40,
+0xF2,0x00,0x00,0x78,0xF2,0x00,0x00,0x7F,0xF2,0x00,0x01,0x7F,0xE0,0xF3,0x00,0x01,
+0x78,0xFC,0xF3,0x00,0x02,0x78,0x1F,0x80,0xF4,0x00,0x02,0x78,0x03,0xF0,0xF4,0x00,
+0x02,0x78,0x00,0x78,0xF4,0x00,0x02,0x78,0x00,0x08,0xF4,0x00,0x00,0x78,0xF2,0x00,
+0x00,0x78,0xF2,0x00,0x00,0x7C,0xFD,0x00,0x00,0xF8,0xF7,0x00,0x00,0x06,0xFE,0x00,
+0x01,0x03,0xFE,0xF3,0x00,0x01,0x07,0xFF,0xF3,0x00,0x02,0x06,0x0B,0x80,0xF4,0x00,
+0x02,0x04,0x19,0x80,0xF4,0x00,0x02,0x07,0xF8,0xC0,0xF4,0x00,0x02,0x03,0xF0,0x40,
+0xF4,0x00,0x02,0x01,0xE0,0x40,0xF7,0x00,0x00,0x1F,0xF3,0x00,0x02,0x1C,0x3F,0xC0,
+0xF4,0x00,0x02,0x3E,0x7F,0xE0,0xF4,0x00,0x02,0x7F,0xFF,0xF0,0xFE,0x00,0x00,0x40,
+0xF8,0x00,0x02,0x7F,0xF8,0x30,0xFE,0x00,0x00,0x40,0xF8,0x00,0x06,0x71,0xF0,0x18,
+0x00,0x07,0xFF,0xC0,0xF8,0x00,0x06,0x60,0xE0,0x18,0x00,0x03,0xFF,0xC0,0xF8,0x00,
+0x06,0x60,0x40,0x18,0x00,0x03,0xFF,0xC0,0xF8,0x00,0x06,0x20,0x00,0x38,0x00,0x03,
+0x00,0x40,0xF8,0x00,0x06,0x10,0x00,0x78,0x00,0x01,0x00,0x40,0xF8,0x00,0x02,0x08,
+0x00,0xF0,0xF2,0x00,0x00,0xF0,0x81,0x00,0xC8,0x00,0x01,0x30,0x3F,0xF3,0x00,0x02,
+0x38,0xF0,0x80,0xF4,0x00,0x02,0x39,0xE0,0x40,0xF4,0x00,0x02,0x39,0xC0,0x40,0xF4,
+0x00,0x06,0x3B,0xC0,0x40,0x00,0x03,0x00,0xC0,0xF8,0x00,0x06,0x3B,0x80,0xC0,0x00,
+0x07,0x81,0xE0,0xF8,0x00,0x06,0x1B,0x81,0xC0,0x00,0x0F,0xC3,0xF0,0xF8,0x00,0x06,
+0x07,0x81,0xC0,0x00,0x0F,0xC3,0xF0,0xF7,0x00,0x05,0x81,0x80,0x00,0x07,0x81,0xE0,
+0xF4,0x00,0x02,0x03,0x00,0xC0,0xC8,0x00,0x01,0x03,0xFC,0xF3,0x00,0x01,0x0F,0xFF,
+0xF3,0x00,0x02,0x1F,0xFF,0x80,0xF4,0x00,0x02,0x20,0x00,0x40,0xF4,0x00,0x02,0x20,
+0x00,0x40,0xF4,0x00,0x02,0x30,0x00,0xC0,0xF4,0x00,0x02,0x1F,0xFF,0x80,0xF4,0x00,
+0x01,0x0F,0xFF,0xF3,0x00,0x01,0x03,0xFC,0x8E,0x00,0x01,0x01,0xC0,0xF4,0x00,0x02,
+0x0F,0x80,0x78,0xF4,0x00,0x02,0x3F,0xE0,0x78,0xF4,0x00,0x02,0x3F,0xF0,0x78,0xF4,
+0x00,0x02,0x7F,0xF8,0x78,0xF4,0x00,0x02,0x78,0x1E,0x78,0xF4,0x00,0x02,0x70,0x07,
+0x78,0xF4,0x00,0x02,0x70,0x01,0xF8,0xF4,0x00,0x02,0x30,0x00,0xF8,0xF4,0x00,0x02,
+0x38,0x00,0x78,0xF4,0x00,0x02,0x1C,0x00,0x18,0xF4,0x00,0x02,0x04,0x00,0x08,0xA2,
+0x00,0x00,0x08,0xF2,0x00,0x00,0x08,0xF2,0x00,0x00,0x08,0xF4,0x00,0x02,0x7F,0xFF,
+0xF8,0xF4,0x00,0x02,0x7F,0xFF,0xF8,0xF4,0x00,0x02,0x3F,0xFF,0xF8,0xF4,0x00,0x05,
+0x3F,0xFF,0xF8,0x00,0x00,0x02,0xF7,0x00,0x06,0x18,0x00,0x08,0x00,0x03,0xC1,0x80,
+0xF8,0x00,0x06,0x18,0x00,0x08,0x00,0x07,0xF1,0x80,0xF8,0x00,0x06,0x08,0x00,0x08,
+0x00,0x0F,0xF9,0x80,0xF4,0x00,0x02,0x0C,0x1D,0x80,0xF4,0x00,0x02,0x0C,0x07,0x80,
+0xF4,0x00,0x02,0x06,0x03,0x80,0xF4,0x00,0x02,0x01,0x00,0x80,0xC2,0x00,0x00,0x80,
+0xF2,0x00,0x00,0x80,0xF4,0x00,0x02,0x0F,0xFF,0x80,0xFC,0x00,0x01,0x20,0x3E,0xFB,
+0x00,0x02,0x07,0xFF,0x80,0xFC,0x00,0x02,0x20,0x7F,0x80,0xFC,0x00,0x02,0x07,0xFF,
+0x80,0xFC,0x00,0x02,0x30,0xFF,0xC0,0xFC,0x00,0x02,0x06,0x00,0x80,0xFC,0x00,0x02,
+0x18,0xC0,0x40,0xFC,0x00,0x02,0x02,0x00,0x80,0xFC,0x00,0x02,0x18,0x80,0x40,0xF4,
+0x00,0x02,0x0E,0x80,0xC0,0xF4,0x00,0x02,0x07,0xFF,0x80,0xF4,0x00,0x01,0x03,0xFF,
+0xFD,0x00,0x00,0xE0,0xF7,0x00,0x00,0xFE,0xFE,0x00,0x01,0x01,0xF0,0xF3,0x00,0x01,
+0x03,0xF8,0xF3,0x00,0x01,0x03,0xF8,0xF3,0x00,0x01,0x01,0xF0,0xF2,0x00,0x00,0xE0,
+0xE6,0x00,0x00,0x40,0xF2,0x00,0x00,0x40,0xF4,0x00,0x02,0x3F,0xFF,0xC0,0xF4,0x00,
+0x02,0x1F,0xFF,0xC0,0xF4,0x00,0x02,0x1F,0xFF,0xC0,0xF4,0x00,0x02,0x0C,0x00,0x40,
+0xF4,0x00,0x05,0x04,0x00,0x40,0x00,0x00,0x01,0xF2,0x00,0x00,0x01,0xF2,0x00,0x00,
+0x05,0xF2,0x00,0x01,0x17,0xFE,0xF3,0x00,0x01,0x1E,0x80,0xF3,0x00,0x01,0x06,0x80,
+0xF3,0x00,0x01,0x01,0x40,0xF2,0x00,0x00,0x40,0xBF,0x00,0x00,0x0C,0xF6,0x00,0x05,
+0x08,0x00,0x00,0x0F,0xFF,0x80,0xF7,0x00,0x05,0x08,0x80,0x00,0x0F,0xFF,0x80,0xF7,
+0x00,0x05,0x09,0x80,0x00,0x03,0xFF,0x80,0xF7,0x00,0x04,0x08,0x00,0x00,0x01,0x0C,
+0xF6,0x00,0x04,0x0F,0xFC,0x00,0x00,0xCC,0xF6,0x00,0x00,0x0C,0xFE,0x00,0x00,0x2C,
+0xF6,0x00,0x00,0x04,0xFE,0x00,0x00,0x1C,0xF6,0x00,0x00,0x04,0xF2,0x00,0x00,0x04,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xA9,0x00,
+};
+
+// BitmapWaveshare_black : 4736 bytes, packed 1848
+const unsigned char BitmapWaveshare_black_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xEC,0xFF,0x00,0x80,0xFD,0x00,
+0x00,0x03,0xF7,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0x80,0xFD,0x00,
+0x00,0x03,0xF7,0xFF,0x00,0x80,0xFE,0x00,0x01,0x38,0x03,0xF7,0xFF,0x05,0x80,0x00,
+0x00,0x01,0xF8,0x03,0xF7,0xFF,0x05,0x80,0x00,0x00,0x0F,0xF8,0x03,0xF7,0xFF,0x05,
+0x80,0x00,0x00,0x7F,0xF8,0x03,0xF7,0xFF,0x06,0x80,0x00,0x03,0xFF,0xF8,0x00,0x0F,
+0xF8,0xFF,0x06,0x80,0x00,0x1F,0xFF,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,
+0xFF,0xF0,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,0xFF,0x80,0x00,0x0F,0xF8,0xFF,
+0x06,0x80,0x00,0x7F,0xFC,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,0xF8,0x00,
+0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x3F,0xFE,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,
+0x00,0x07,0xFF,0xC0,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x00,0xFF,0xF8,0x00,0x0F,
+0xF8,0xFF,0x06,0x80,0x00,0x00,0x1F,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x00,
+0x1F,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x00,0x7F,0xF8,0x00,0x0F,0xF8,0xFF,
+0x06,0x80,0x00,0x03,0xFF,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x1F,0xFF,0xE0,
+0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,0xFF,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,
+0x00,0x7F,0xFC,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,0xF0,0x00,0x00,0x0F,
+0xF8,0xFF,0x06,0x80,0x00,0x7F,0xFC,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x1F,
+0xFF,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x03,0xFF,0xE0,0x00,0x0F,0xF8,0xFF,
+0x06,0x80,0x00,0x00,0xFF,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x00,0x3F,0xFF,
+0x80,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x00,0x07,0xFF,0xC0,0x0F,0xF8,0xFF,0x06,0x80,
+0x00,0x00,0x01,0xFF,0xE0,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7C,0x00,0x7F,0xF0,0x0F,
+0xF8,0xFF,0x06,0x80,0x00,0x7F,0x00,0x0F,0xF8,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,
+0xC0,0x07,0xFC,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x7F,0xE0,0x00,0x00,0x0F,0xF8,0xFF,
+0x06,0x80,0x00,0x7F,0xF8,0x00,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x3F,0xFE,0x00,
+0x00,0x0F,0xF8,0xFF,0x06,0x80,0x00,0x07,0xFF,0xC0,0x00,0x0F,0xF8,0xFF,0x06,0x80,
+0x00,0x01,0xFF,0xF0,0x00,0x0F,0xF8,0xFF,0x06,0x83,0xFF,0x00,0x7F,0xF8,0x00,0x0F,
+0xF8,0xFF,0x06,0x81,0xFE,0x00,0x1F,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0xFF,0x00,
+0x1F,0xF8,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x7F,0xC0,0x7F,0xF8,0x00,0x0F,0xF8,0xFF,
+0x06,0x80,0x3F,0xF9,0xFF,0xF0,0x00,0x0F,0xF8,0xFF,0x06,0x80,0x1F,0xFF,0xFF,0x80,
+0x00,0x0F,0xF7,0xFF,0x05,0x0B,0xFF,0xFE,0x00,0x00,0x0F,0xF7,0xFF,0x05,0x00,0xFF,
+0xF8,0x00,0x00,0x0F,0xF7,0xFF,0x05,0x00,0x3F,0xE0,0x00,0x00,0x0F,0xF7,0xFF,0x05,
+0x00,0x0F,0x80,0x00,0x00,0x0F,0xF7,0xFF,0x01,0x00,0x02,0xFE,0x00,0x00,0x0F,0xF7,
+0xFF,0xFC,0x00,0x00,0x0F,0xA5,0xFF,0x02,0xFE,0x7F,0xF9,0xF4,0xFF,0x02,0xF8,0x1F,
+0xF0,0xF4,0xFF,0x02,0xE0,0x0F,0xC0,0xF4,0xFF,0x03,0xE0,0x07,0x80,0x7F,0xF5,0xFF,
+0x03,0xF0,0x03,0xC0,0x1F,0xF5,0xFF,0x03,0xF8,0x00,0xE0,0x0F,0xF7,0xFF,0x00,0xC0,
+0xFE,0x00,0x01,0x70,0x07,0xF7,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x18,0x01,0xF7,0xFF,
+0x00,0xC0,0xFE,0x00,0x01,0x04,0x01,0xF7,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x06,0x01,
+0xF7,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0x01,0xF4,0xFF,0x02,0xFC,0x07,0xC3,0xF7,
+0xFF,0x05,0xF8,0xFF,0xFF,0xFE,0x0F,0xE3,0xF7,0xFF,0x05,0xF8,0x3F,0xFF,0x06,0x00,
+0x13,0xF7,0xFF,0x05,0xE0,0x03,0xFF,0x06,0x00,0x1F,0xF7,0xFF,0x05,0xE0,0x00,0x01,
+0x06,0x00,0x1F,0xF7,0xFF,0x05,0xE0,0x00,0x01,0x06,0x00,0x1F,0xF7,0xFF,0x05,0xF8,
+0x00,0x01,0x06,0x00,0x1F,0xF7,0xFF,0x04,0xFE,0x00,0x01,0x06,0x0F,0xF5,0xFF,0x04,
+0xC0,0x01,0x06,0x00,0x01,0xF5,0xFF,0x03,0xC1,0x06,0x00,0x01,0xF5,0xFF,0x03,0xC1,
+0x06,0x00,0x01,0xF6,0xFF,0x04,0x8F,0xC1,0x06,0x00,0x01,0xF7,0xFF,0x05,0xFC,0x00,
+0x01,0x06,0x00,0x01,0xF7,0xFF,0x04,0xFE,0x00,0x01,0x06,0x0F,0xF6,0xFF,0x05,0xFE,
+0x00,0x01,0x06,0x00,0x1F,0xF7,0xFF,0x05,0xFD,0x00,0x01,0x06,0x00,0x1F,0xF7,0xFF,
+0x05,0xF8,0x80,0x01,0x06,0x00,0x1F,0xF7,0xFF,0x05,0xE0,0x40,0xFF,0x02,0x00,0x1F,
+0xF7,0xFF,0x05,0xC0,0x40,0xFF,0x00,0x00,0x1F,0xF7,0xFF,0x04,0xC0,0x20,0x7E,0x00,
+0x0F,0xF6,0xFF,0x04,0xE0,0x00,0x7E,0x00,0x00,0xF6,0xFF,0x05,0xF0,0x07,0xF0,0x00,
+0x00,0x03,0xF7,0xFF,0x01,0xF8,0x03,0xFE,0x00,0x00,0x01,0xF7,0xFF,0x00,0xFC,0xFD,
+0x00,0x00,0x01,0xF7,0xFF,0x05,0xFE,0x00,0x00,0x01,0x00,0x01,0xF6,0xFF,0x04,0x00,
+0x00,0x7F,0x80,0x01,0xF6,0xFF,0x04,0x00,0x00,0x7F,0x83,0x01,0xF7,0xFF,0x00,0xFC,
+0xFE,0x00,0x00,0x03,0xF6,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x03,0xF6,0xFF,0x04,0xF0,
+0x03,0x00,0x00,0x03,0xF6,0xFF,0x04,0xE0,0x07,0xE0,0x00,0x03,0xF6,0xFF,0x04,0xE0,
+0x1F,0xFC,0x00,0x03,0xF6,0xFF,0x04,0xE0,0x3F,0xFF,0xE0,0x03,0xF6,0xFF,0x04,0xF8,
+0x7F,0xFF,0xFF,0x83,0xF6,0xFF,0x00,0xFC,0xFE,0xFF,0x00,0x83,0xF6,0xFF,0x00,0xFE,
+0xBF,0xFF,0x01,0xE0,0x00,0xF3,0xFF,0x01,0xE0,0x00,0xF3,0xFF,0x02,0xE0,0x00,0x83,
+0xF7,0xFF,0x05,0xF0,0x7F,0xFF,0xE0,0x00,0x83,0xF7,0xFF,0x05,0xF0,0x7F,0x83,0xE0,
+0x00,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0xFF,0xE0,0x83,0xF7,0xFF,0x05,0xF0,0x60,
+0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,
+0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,
+0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,
+0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,
+0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,
+0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0xFF,0xE0,0x83,0xF7,0xFF,
+0x05,0xF0,0x60,0x83,0xFF,0xE0,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x00,0x00,0x03,
+0xF7,0xFF,0x05,0xF0,0x60,0x83,0x00,0x00,0x03,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x00,
+0x00,0x03,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x00,0x00,0x03,0xF7,0xFF,0x05,0xF0,0x60,
+0x83,0x00,0x00,0x03,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x00,0x00,0x03,0xF7,0xFF,0x05,
+0xF0,0x60,0x83,0xFF,0xE0,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,
+0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,
+0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,
+0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xF0,
+0x60,0x83,0x84,0x20,0x83,0xF7,0xFF,0x05,0xC0,0x00,0x03,0x84,0x20,0x83,0xF7,0xFF,
+0x05,0xC0,0x00,0x03,0x84,0x20,0x83,0xF7,0xFF,0x05,0xC0,0x00,0x03,0x84,0x20,0x83,
+0xF7,0xFF,0x05,0xC0,0x00,0x03,0xFF,0xE0,0x83,0xF7,0xFF,0x05,0xC0,0x00,0x03,0xE0,
+0x00,0x83,0xF7,0xFF,0x05,0xC0,0x00,0x03,0xE0,0x00,0x83,0xF4,0xFF,0x02,0xE0,0x00,
+0x83,0xF4,0xFF,0x01,0xE0,0x00,0xF3,0xFF,0x01,0xE0,0x00,0xF3,0xFF,0x01,0xE0,0x00,
+0x81,0xFF,0xF5,0xFF,0x00,0xF0,0xFE,0x00,0xF5,0xFF,0x00,0xF0,0xFE,0x00,0xF5,0xFF,
+0x00,0xF0,0xFE,0x00,0xF5,0xFF,0x00,0xF0,0xFE,0x00,0xF5,0xFF,0x00,0xF0,0xFE,0x00,
+0xF5,0xFF,0x00,0xF0,0xFE,0x00,0xF5,0xFF,0x03,0xFE,0x07,0x83,0xC0,0xF5,0xFF,0x03,
+0xFE,0x07,0x83,0xC0,0xF5,0xFF,0x03,0xFE,0x07,0x83,0xC0,0xF5,0xFF,0x03,0xFE,0x07,
+0x83,0xC0,0xF5,0xFF,0x03,0xFE,0x07,0x83,0xC0,0xF5,0xFF,0x03,0xFE,0x07,0x83,0xC0,
+0xF5,0xFF,0x03,0xFE,0x07,0x83,0xC0,0xF5,0xFF,0x03,0xFE,0x07,0x83,0xC0,0xF5,0xFF,
+0x04,0xFE,0x07,0x03,0xC0,0x7F,0xF7,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x01,0xF7,0xFF,
+0x00,0xF8,0xFD,0x00,0x00,0x01,0xF7,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x01,0xF7,0xFF,
+0x00,0xE0,0xFD,0x00,0x00,0x01,0xF7,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x01,0xF7,0xFF,
+0x00,0xE0,0xFD,0x00,0x00,0x01,0xF7,0xFF,0x04,0xE0,0x3E,0x07,0x83,0xC0,0xF6,0xFF,
+0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,
+0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,
+0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,
+0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,0x04,0xE0,0x7E,0x07,0x83,0xC0,0xF6,0xFF,
+0x01,0xE0,0x7E,0xFE,0x00,0xF6,0xFF,0x01,0xE0,0x7E,0xFE,0x00,0xF6,0xFF,0x01,0xE0,
+0x7E,0xFE,0x00,0xF6,0xFF,0x01,0xE0,0x3E,0xFE,0x00,0xF6,0xFF,0x01,0xE0,0x02,0xFE,
+0x00,0xF6,0xFF,0x00,0xE0,0xFD,0x00,0xF6,0xFF,0x01,0xE0,0x01,0xF3,0xFF,0x01,0xF0,
+0x01,0xF3,0xFF,0x01,0xF8,0x01,0xF3,0xFF,0x01,0xFE,0x03,0xF2,0xFF,0x00,0xC3,0xC1,
+0xFF,0x01,0xF8,0x1F,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,
+0x01,0xF8,0x1F,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,0x03,0xF8,0x1F,0xFC,0x07,0xF5,
+0xFF,0x03,0xF8,0x1F,0xFC,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0xFC,0x07,0xF5,0xFF,0x03,
+0xF8,0x1F,0xFC,0x07,0xF6,0xFF,0x04,0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x05,0xFC,
+0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x05,0xE0,0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,
+0x05,0xC0,0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x05,0xC0,0x7F,0xF8,0x1F,0xFC,0x07,
+0xF7,0xFF,0x05,0xC0,0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x05,0xC0,0x7F,0xF8,0x1F,
+0xFC,0x07,0xF7,0xFF,0x05,0xC0,0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x05,0xE0,0x7F,
+0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x05,0xE0,0x7F,0xF8,0x1F,0xFC,0x07,0xF7,0xFF,0x00,
+0xE0,0xFE,0x00,0x01,0x3C,0x07,0xF7,0xFF,0x00,0xE0,0xFE,0x00,0x01,0x3C,0x07,0xF7,
+0xFF,0x00,0xE0,0xFE,0x00,0x01,0x1C,0x07,0xF7,0xFF,0x00,0xF0,0xFE,0x00,0x01,0x1C,
+0x07,0xF7,0xFF,0x00,0xF0,0xFE,0x00,0x01,0x0C,0x07,0xF7,0xFF,0x00,0xF8,0xFE,0x00,
+0x01,0x04,0x07,0xF5,0xFF,0x03,0xF8,0x1C,0x04,0x07,0xF5,0xFF,0x03,0xF8,0x1E,0x00,
+0x07,0xF5,0xFF,0x03,0xF8,0x1E,0x00,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0x00,0x07,0xF5,
+0xFF,0x03,0xF8,0x1F,0x00,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0x80,0x07,0xF5,0xFF,0x03,
+0xF8,0x1F,0xC0,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0xC0,0x07,0xF5,0xFF,0x03,0xF8,0x1F,
+0xE0,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0xF0,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0xF8,0x07,
+0xF5,0xFF,0x03,0xF8,0x1F,0xF8,0x07,0xF5,0xFF,0x03,0xF8,0x1F,0xFC,0x0F,0xF5,0xFF,
+0x03,0xF8,0x1F,0xFE,0x1F,0xF5,0xFF,0x03,0xF8,0x1F,0xFF,0x3F,0xF5,0xFF,0x01,0xF8,
+0x1F,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,0x01,0xF8,0x1F,0xF3,0xFF,0x01,0xF8,0x1F,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0xCB,0xFF,
+};
+
+// BitmapWaveshare_red : 4736 bytes, packed 1330
+const unsigned char BitmapWaveshare_red_packed[] PROGMEM =
+{
+0x80,0x12,0x00,0x00,0x81,0xFF,0x81,0xFF,0xC7,0xFF,0x02,0xF8,0x00,0x1F,0xF4,0xFF,
+0x02,0xF8,0x00,0x1F,0xF4,0xFF,0x02,0xF8,0x00,0x1F,0xF4,0xFF,0x02,0xF8,0x00,0x1F,
+0xF4,0xFF,0x02,0xF8,0x00,0x1F,0xF4,0xFF,0x02,0xF8,0x00,0x1F,0xF4,0xFF,0x02,0xF8,
+0x00,0x1F,0xF3,0xFF,0x01,0xF0,0x1F,0xF3,0xFF,0x01,0xF0,0x1F,0xF3,0xFF,0x01,0xF0,
+0x1F,0xF3,0xFF,0x01,0xF0,0x1F,0xF3,0xFF,0x01,0xF0,0x1F,0xF3,0xFF,0x01,0xF0,0x1F,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xAB,0xFF,0x02,0xF0,0x00,0x3F,0xF4,0xFF,
+0x02,0xF0,0x00,0x3F,0xF4,0xFF,0x02,0xF0,0x00,0x3F,0xF4,0xFF,0x02,0xF0,0x00,0x3F,
+0xF4,0xFF,0x02,0xF0,0x00,0x3F,0xF4,0xFF,0x02,0xF0,0x00,0x3F,0xF4,0xFF,0x02,0xF0,
+0x00,0x3F,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,
+0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,
+0xF4,0xFF,0x02,0xF0,0x00,0x18,0xF4,0xFF,0x02,0xF0,0x01,0xF8,0xF4,0xFF,0x02,0xF0,
+0x3F,0xF8,0xF4,0xFF,0x02,0xF0,0xFF,0xE0,0xF4,0xFF,0x02,0xF0,0xFC,0x00,0xF4,0xFF,
+0x02,0xF0,0xFF,0x00,0xF4,0xFF,0x02,0xF0,0x3F,0xF0,0xF4,0xFF,0x02,0xF0,0x03,0xF8,
+0xF4,0xFF,0x02,0xF0,0x07,0xF8,0xF4,0xFF,0x02,0xF0,0x7F,0xE0,0xF4,0xFF,0x02,0xF0,
+0xFF,0x00,0xF4,0xFF,0x02,0xF0,0xFC,0x00,0xF4,0xFF,0x02,0xF0,0xFF,0xE0,0xF4,0xFF,
+0x02,0xF0,0x1F,0xF8,0xF4,0xFF,0x02,0xF0,0x01,0xF8,0xF4,0xFF,0x02,0xF0,0x00,0x18,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x70,0x00,0xF4,0xFF,0x02,0xF0,
+0xF9,0x80,0xF4,0xFF,0x02,0xF0,0xF9,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,
+0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0x80,
+0xF4,0xFF,0x02,0xF0,0xFF,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0x00,0x40,0xF4,0xFF,0x02,0xF0,0x03,0xC0,0xF4,0xFF,0x02,0xF0,0x1F,0xC0,0xF4,0xFF,
+0x02,0xF0,0xFF,0x80,0xF4,0xFF,0x02,0xF0,0xFC,0x00,0xF4,0xFF,0x02,0xF0,0xFC,0x00,
+0xF4,0xFF,0x02,0xF0,0xFF,0x80,0xF4,0xFF,0x02,0xF0,0x1F,0xC0,0xF4,0xFF,0x02,0xF0,
+0x03,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0x40,0xF4,0xFF,0x02,0xF0,0x1E,0x00,0xF4,0xFF,
+0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,0xED,0xC0,
+0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,
+0xCF,0xC0,0xF4,0xFF,0x02,0xF0,0xCF,0x80,0xF4,0xFF,0x02,0xF0,0x0E,0x00,0xF4,0xFF,
+0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x43,0x00,0xF4,0xFF,0x02,0xF0,0xC7,0x80,
+0xF4,0xFF,0x02,0xF0,0xCF,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,
+0xFC,0xC0,0xF4,0xFF,0x02,0xF0,0x78,0xC0,0xF4,0xFF,0x02,0xF0,0x30,0x40,0xF4,0xFF,
+0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0xFF,0xFC,0xF4,0xFF,0x02,0xF0,0xFF,0xFC,
+0xF4,0xFF,0x02,0xF0,0xFF,0xFC,0xF4,0xFF,0x02,0xF0,0x01,0xC0,0xF4,0xFF,0x02,0xF0,
+0x00,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,
+0x02,0xF0,0xFF,0x80,0xF4,0xFF,0x02,0xF0,0xFF,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x70,0x00,0xF4,0xFF,0x02,0xF0,
+0xF9,0x80,0xF4,0xFF,0x02,0xF0,0xF9,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,
+0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0x80,
+0xF4,0xFF,0x02,0xF0,0xFF,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0x00,0x00,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,
+0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0x01,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0xC0,
+0xF4,0xFF,0x02,0xF0,0x00,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0x1E,0x00,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,
+0x02,0xF0,0xED,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,
+0xF4,0xFF,0x02,0xF0,0xCF,0xC0,0xF4,0xFF,0x02,0xF0,0xCF,0x80,0xF4,0xFF,0x02,0xF0,
+0x0E,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,
+0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,
+0xF4,0xFF,0x02,0xF0,0xFF,0xF8,0xF4,0xFF,0x02,0xF0,0xFF,0xF8,0xF4,0xFF,0x02,0xF0,
+0xFF,0xF8,0xF4,0xFF,0x02,0xF0,0xC3,0x18,0xF4,0xFF,0x02,0xF0,0xC3,0x18,0xF4,0xFF,
+0x02,0xF0,0xC3,0x18,0xF4,0xFF,0x02,0xF0,0xC3,0x18,0xF4,0xFF,0x02,0xF0,0xC0,0x18,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0xFF,0xFC,0xF4,0xFF,0x02,0xF0,0xFF,0xFC,0xF4,0xFF,0x02,0xF0,0xFF,0xFC,0xF4,0xFF,
+0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x1E,0x00,
+0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,
+0xED,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,
+0x02,0xF0,0xCF,0xC0,0xF4,0xFF,0x02,0xF0,0xCF,0x80,0xF4,0xFF,0x02,0xF0,0x0E,0x00,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x1E,0x00,0xF4,0xFF,0x02,0xF0,
+0x7F,0x80,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,0xE1,0xC0,0xF4,0xFF,
+0x02,0xF0,0xC0,0xC0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,
+0xF4,0xFF,0x02,0xF0,0x40,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0x00,0xC0,0xF4,0xFF,0x02,0xF0,0x7F,0xF0,0xF4,0xFF,0x02,0xF0,0xFF,0xF0,0xF4,0xFF,
+0x02,0xF0,0xFF,0xF0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,
+0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0x01,0xC0,0xF4,0xFF,
+0x02,0xF0,0x00,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0x00,
+0xF4,0xFF,0x02,0xF0,0x1E,0x00,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,
+0xFF,0x80,0xF4,0xFF,0x02,0xF0,0xE1,0xC0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,0xF4,0xFF,
+0x02,0xF0,0xE1,0xC0,0xF4,0xFF,0x02,0xF0,0x7F,0xC0,0xF4,0xFF,0x02,0xF0,0x7F,0x80,
+0xF4,0xFF,0x02,0xF0,0x1E,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,
+0x02,0xF0,0x01,0x80,0xF4,0xFF,0x02,0xF0,0x00,0xC0,0xF4,0xFF,0x02,0xF0,0x00,0xC0,
+0xF4,0xFF,0x02,0xF0,0xFF,0xC0,0xF4,0xFF,0x02,0xF0,0xFF,0x80,0xF4,0xFF,0x02,0xF0,
+0xFF,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,
+0x02,0xF0,0xFF,0xD8,0xF4,0xFF,0x02,0xF0,0xFF,0xD8,0xF4,0xFF,0x02,0xF0,0xFF,0xD8,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,
+0x1E,0x00,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,0x02,0xF0,0x7F,0x80,0xF4,0xFF,
+0x02,0xF0,0xE1,0xC0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,0xF4,0xFF,0x02,0xF0,0xC0,0xC0,
+0xF4,0xFF,0x02,0xF0,0xC0,0xC0,0xF4,0xFF,0x02,0xF0,0x40,0xC0,0xF4,0xFF,0x02,0xF0,
+0x00,0x00,0xF4,0xFF,0x02,0xF0,0x43,0x00,0xF4,0xFF,0x02,0xF0,0xC7,0x80,0xF4,0xFF,
+0x02,0xF0,0xCF,0xC0,0xF4,0xFF,0x02,0xF0,0xCC,0xC0,0xF4,0xFF,0x02,0xF0,0xFC,0xC0,
+0xF4,0xFF,0x02,0xF0,0x78,0xC0,0xF4,0xFF,0x02,0xF0,0x30,0x40,0xF4,0xFF,0x02,0xF0,
+0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,
+0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,
+0xF4,0xFF,0x02,0xF0,0x00,0x00,0xF4,0xFF,0x02,0xF0,0x00,0x00,0x81,0xFF,0x81,0xFF,
+0xA7,0xFF,
+};
+
+#endif
@@ -0,0 +1,999 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 15000 bytes, packed 7956
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0xC3,0xFF,0x03,0xCF,0xFF,0xFF,0xC3,0xD4,0xFF,0x06,0xF0,0x01,
+0xFF,0xFC,0x00,0x00,0x7F,0xD7,0xFF,0x07,0xFE,0x00,0x00,0x3F,0xE0,0x00,0x00,0x07,
+0xD7,0xFF,0x00,0xF0,0xFA,0x00,0xD7,0xFF,0x00,0xC0,0xFA,0x00,0x00,0x0F,0xD9,0xFF,
+0x00,0xFE,0xF8,0x00,0xFC,0xFF,0x00,0xFD,0xF1,0xFF,0x00,0xC0,0xF0,0xFF,0x00,0xF0,
+0xF8,0x00,0x00,0x0F,0xFE,0xFF,0x02,0xFC,0x00,0x00,0xFD,0xFF,0x04,0xF8,0x0F,0xFF,
+0xFF,0xFC,0xFE,0x00,0x0E,0xFF,0xFF,0x80,0x00,0x00,0x03,0xFF,0xFC,0x00,0x3F,0xFF,
+0xFE,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xFE,0xF6,0x00,0x01,0x0F,0xFF,0xFD,0x00,0xFE,
+0xFF,0x04,0xF0,0x00,0x01,0xFF,0xFF,0xF3,0x00,0x01,0x03,0xC0,0xFE,0x00,0x00,0x7F,
+0xFE,0xFF,0x00,0xFE,0xEF,0x00,0x02,0x03,0xFF,0x80,0x81,0x00,0x8A,0x00,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xB5,0xFF,
+0xFE,0x00,0xD2,0xFF,0x00,0x03,0x9E,0xFF,0x00,0xF8,0xD0,0xFF,0x00,0xE3,0xD0,0xFF,
+0x00,0xE3,0xD0,0xFF,0x00,0xC7,0xFC,0xFF,0x00,0xC7,0xE3,0xFF,0x00,0xF9,0xF5,0xFF,
+0x00,0xC7,0xFC,0xFF,0x00,0x1F,0xE3,0xFF,0x00,0xF0,0xF5,0xFF,0x00,0xC7,0xFD,0xFF,
+0x06,0xFE,0x3F,0xFF,0xFF,0x00,0x00,0x3F,0xE8,0xFF,0x01,0xE0,0x7F,0xF6,0xFF,0x01,
+0xC6,0x01,0xFE,0xFF,0x04,0xFE,0x3F,0xFF,0xFC,0x3F,0xE6,0xFF,0x01,0xC0,0x1F,0xF6,
+0xFF,0x08,0xC6,0x01,0x9F,0x0F,0xFF,0xFC,0x7F,0xFF,0xF8,0xE5,0xFF,0x01,0x00,0x0F,
+0xF6,0xFF,0x08,0xC6,0x01,0x9F,0xE0,0x00,0x7C,0x7F,0xFF,0xF8,0xFD,0xFF,0x03,0xC0,
+0x00,0x00,0x03,0xEE,0xFF,0x02,0xFE,0x00,0x03,0xF6,0xFF,0x08,0xC6,0x01,0x9F,0xFF,
+0xFE,0x0C,0x7F,0xFF,0xF1,0xFD,0xFF,0x00,0x0F,0xEB,0xFF,0x02,0xFC,0x00,0x01,0xF6,
+0xFF,0x08,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x9F,0xF1,0xFD,0xFF,0x02,0x3F,0xFF,
+0xE3,0xED,0xFF,0x03,0xF0,0x00,0x00,0x7F,0xF7,0xFF,0x08,0xC6,0x01,0x9F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xFE,0xFF,0x03,0xFE,0x3F,0xFF,0x8F,0xED,0xFF,0x00,0xE0,0xFE,
+0x00,0x00,0x03,0xF8,0xFF,0x12,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF7,
+0xFF,0xFF,0xFE,0x7F,0xFF,0x9F,0xFF,0xFF,0x8F,0xF0,0xFF,0x00,0xC0,0xFD,0x00,0xF8,
+0xFF,0x12,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFF,0xFF,0xFE,0x7F,
+0xFF,0x1F,0xFF,0xFE,0x3F,0xF1,0xFF,0x00,0xFC,0xFC,0x00,0x00,0x27,0xF9,0xFF,0x12,
+0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0xFE,0x7F,0xFF,0x1F,
+0xFF,0xFE,0x7F,0xF1,0xFF,0x00,0xFA,0xFC,0x00,0x00,0x1B,0xF9,0xFF,0x12,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7F,0xFF,0x1F,0xFF,0xFC,
+0x7F,0xF1,0xFF,0x01,0xFB,0x80,0xFD,0x00,0x00,0x19,0xF9,0xFF,0x14,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1F,0xFF,0xFC,0x7F,
+0xFF,0xFF,0xFA,0x00,0x00,0x0B,0xFB,0xFF,0x01,0xFB,0xE0,0xFE,0x00,0x01,0x07,0xF3,
+0xF9,0xFF,0x15,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0xFC,0x7F,0xFF,0xFC,0x7F,0xF4,0xFF,0x06,0xFD,0xE0,0x01,0xFB,
+0xFF,0xFF,0xE7,0xF9,0xFF,0x16,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xFF,0xF8,0xFF,0x80,0xFC,0x00,0x00,
+0x0F,0xFB,0xFF,0x06,0xFE,0x3C,0x07,0xFF,0xFF,0x11,0xCF,0xF9,0xFF,0x16,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xFF,0xF1,0xFE,0x3F,0xF4,0xFF,0x00,0xDE,0xFE,0x00,0x01,0xEC,0x1F,0xF9,0xFF,
+0x16,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xFF,0xF1,0xFC,0x7F,0xF4,0xFF,0x00,0xE1,0xF4,0xFF,0x16,0xC6,
+0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC7,0xF1,0xFC,0x7F,0xE6,0xFF,0x15,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0xFC,0xE5,
+0xFF,0x15,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0xFC,0xFE,0xFF,0x00,0x8F,0xE9,0xFF,0x15,0xC6,
+0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xFE,0xFF,0x00,0x1F,0xE9,0xFF,0x19,0xC6,0x01,0x9F,0xFF,
+0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xFF,0xFE,0x3F,0xE9,0xFF,0x19,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xFF,0xFC,0x7F,0xE9,0xFF,0x19,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xCF,0xFC,0x7F,
+0xE9,0xFF,0x19,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0xFC,0x7F,0xE9,0xFF,0x19,
+0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,
+0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x7F,0xE9,0xFF,0x19,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x7F,0xFE,0xFF,0x00,0xCF,0xED,0xFF,0x19,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x63,0xFE,0xFF,0x00,0x1F,0xED,0xFF,0x1D,0xC6,
+0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xFF,0xFF,0xFE,0x3F,0xED,0xFF,0x1D,
+0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,
+0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xFF,0xFC,0x7F,0xED,0xFF,
+0x1D,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xFF,0xFC,0x7F,0xED,
+0xFF,0x1F,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x7C,0x7F,
+0xFF,0xF1,0xEF,0xFF,0x1F,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x7F,0xFF,0xE3,0xEF,0xFF,0x1F,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x7F,0xFF,0xC7,0xEF,0xFF,0x1F,0xC6,0x01,0x9F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x7F,0xFF,0xCF,0xEF,0xFF,0x1F,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x1F,0xCF,0xF2,0xFF,
+0x25,0x8F,0xFF,0xFF,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,
+0x0C,0x78,0x07,0xCF,0xFF,0xFF,0xE3,0xF5,0xFF,0x25,0x01,0xFF,0xFF,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCF,0xFF,0xFF,0x8F,
+0xF6,0xFF,0x26,0xFE,0x00,0xFF,0xFF,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,
+0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCE,0xFF,0xFF,0x1F,0xF6,0xFF,0x26,0xFC,0x00,0x3F,
+0xFF,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0xFF,0x3F,0xF6,0xFF,0x26,0xFC,0x00,0x0F,0xFF,0xC6,0x01,0x9F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0xFF,0x3F,0xF6,0xFF,
+0x26,0xF8,0x00,0x00,0x07,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x3F,0xF7,0xFF,0x01,0x7F,0xF0,0xFE,0x00,0x22,
+0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,
+0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,
+0x7F,0x1E,0x3F,0xF8,0xFF,0x02,0xFE,0x3F,0xE0,0xFE,0x00,0x22,0xC6,0x01,0x9F,0xFF,
+0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x3F,0xF8,
+0xFF,0x02,0xFC,0x0F,0xE0,0xFE,0x00,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x33,0xF8,0xFF,0x00,0xF8,0xFC,
+0x00,0x23,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,
+0x07,0xCC,0x7F,0x1E,0x31,0xBF,0xF9,0xFF,0x00,0xE0,0xFC,0x00,0x23,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xC7,0xF9,0xFF,0xFB,0x00,0x23,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xF0,0xFA,0xFF,0x2B,0xFE,0x70,0x00,
+0x01,0xF1,0xBF,0xFF,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,
+0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0x3F,0xFB,0xFF,0x03,0xFD,0xFE,0x00,0xF7,
+0xFE,0xFF,0x26,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xC7,0xFF,0xFE,0xFE,0x00,0x01,0x01,0xF9,0xFB,
+0xFF,0x26,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,
+0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xF1,0xFF,0xF8,0xFD,0xFF,0x01,0xFC,0x3F,0xFE,0xFF,
+0x28,0xF8,0x00,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFE,0x7F,0xF1,0xFC,0xFF,0x5F,0x8F,0xFF,0xFF,
+0x80,0x07,0xFF,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFF,0x8F,0xE3,0xE0,0x00,0x00,0x7F,0xFF,0xF0,
+0x0F,0xF0,0x3F,0xFF,0xFF,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFF,0xE3,0xE3,0x87,0xFD,0xFF,0x02,
+0xFE,0x60,0x0F,0xFE,0xFF,0x27,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFF,0xFC,0xE3,0x9F,0xF7,0xFF,
+0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x1F,0xF7,0xFF,0x22,0xC6,0x01,0x9F,0xFF,
+0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,
+0xFF,0x01,0xE3,0x1F,0xF7,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,
+0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x3F,0xF7,
+0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,
+0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x3F,0xF7,0xFF,0x22,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFE,0xFF,0x01,0xE3,0x1F,0xF7,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x0F,
+0xF7,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x13,0xF7,0xFF,0x22,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,
+0x31,0xFE,0xFF,0x01,0xE3,0x39,0xF7,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,
+0x3E,0x7F,0xF8,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3F,0x3F,0xF8,0xFF,
+0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3F,0xCF,0xF8,0xFF,0x22,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFE,0xFF,0x02,0xE3,0x3F,0xF7,0xF8,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,
+0x3F,0xF9,0xF8,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3F,0xFC,0xF8,0xFF,
+0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0x7F,0xF9,0xFF,0x22,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,
+0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xBF,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,
+0x03,0xE3,0x3F,0xFF,0x9F,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,
+0xFF,0xCF,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xEF,0xF9,
+0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,
+0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xF7,0xF9,0xFF,0x22,0xC6,
+0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,
+0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xF7,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,
+0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,
+0xFF,0x03,0xE3,0x3F,0xFF,0xFB,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,
+0x3F,0xFF,0xFB,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFB,
+0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFD,0xF9,0xFF,0x22,
+0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,
+0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,
+0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFD,0xF9,0xFF,0x22,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFD,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,
+0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,
+0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,
+0xE3,0x3F,0xFF,0xFD,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,
+0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,
+0xFE,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,
+0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFE,0xF9,0xFF,
+0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFE,0xF9,0xFF,0x22,0xC6,0x01,
+0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,
+0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFE,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,
+0x03,0xE3,0x3F,0xFF,0xFE,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,
+0xFF,0xFE,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFE,0xF9,
+0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,
+0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFE,0xF9,0xFF,0x22,0xC6,
+0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,
+0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFE,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,
+0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,
+0xFF,0x03,0xE3,0x3F,0xFF,0xFD,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,
+0x3F,0xFF,0xFD,0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xFB,
+0xF9,0xFF,0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xF7,0xF9,0xFF,0x22,
+0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,
+0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,
+0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xE7,0xF9,0xFF,0x22,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFE,0xFF,0x03,0xE3,0x3F,0xFF,0xCF,0xF9,0xFF,0x22,0x46,0x01,0x9F,0xFF,0xFF,0xFC,
+0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,
+0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,
+0xE3,0x3F,0xFF,0x9F,0xF9,0xFF,0x22,0x46,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,
+0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFF,
+0x3F,0xF9,0xFF,0x22,0x06,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,
+0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x03,0xE3,0x3F,0xFE,0x7F,0xF9,0xFF,
+0x22,0x06,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3F,0xFC,0xF8,0xFF,0x22,0x86,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFE,0xFF,0x02,0xE3,0x3F,0xF9,0xF8,0xFF,0x22,0x86,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,
+0x3F,0xF3,0xF8,0xFF,0x22,0x86,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3F,0xE7,0xF8,0xFF,
+0x22,0xC6,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3F,0xCF,0xF8,0xFF,0x22,0xC6,0x01,0x9F,
+0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFE,0xFF,0x02,0xE3,0x3F,0x9F,0xF8,0xFF,0x22,0xC0,0x01,0x9F,0xFF,0xFF,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,
+0x3F,0x3F,0xF8,0xFF,0x22,0xC0,0x01,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x02,0xE3,0x3E,0x7F,0xF8,0xFF,
+0x22,0xCF,0xF0,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x3D,0xF6,0xFF,0x21,0xF8,0x1F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,
+0x01,0xE3,0x3B,0xF6,0xFF,0x21,0xFC,0x1F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x37,0xF6,0xFF,0x21,
+0xFE,0x1F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,
+0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x0F,0xF5,0xFF,0x20,0x1F,0xFF,0xFF,0xFC,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x1F,
+0xF5,0xFF,0x20,0x1F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,0xE3,0x3F,0xF5,0xFF,0x20,0x9F,0xFF,0xFF,0xFC,
+0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,
+0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x01,
+0xE2,0x7F,0xF5,0xFF,0x20,0x9F,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x00,0xE0,0xF4,0xFF,0x20,0x9F,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,
+0x00,0xE1,0xF4,0xFF,0x20,0xDF,0xFF,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x00,0xE7,0xF4,0xFF,0x20,0xDF,0xFF,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,
+0x00,0xEF,0xF4,0xFF,0x20,0xDF,0x1F,0xFF,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,0x00,0xDF,0xF4,0xFF,0x20,0x80,0x00,0xFF,
+0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFE,0xFF,
+0x00,0x3F,0xF4,0xFF,0x24,0x87,0xE0,0x3F,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,
+0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFF,0xFC,0x7F,0xF3,0xFF,0x22,0xFE,0x1F,0xFC,
+0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,
+0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFF,0xF1,
+0xF1,0xFF,0x21,0x87,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,
+0x1E,0x31,0xFF,0xFF,0xC7,0xF1,0xFF,0x21,0xC3,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,
+0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xFF,0x1F,0xF1,0xFF,0x20,0xE1,0xFC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xFF,0xF8,0xF0,0xFF,
+0x20,0xF8,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,
+0xFF,0xE3,0xF0,0xFF,0x20,0xF8,0x7C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,
+0xCC,0x7F,0x1E,0x31,0xFF,0x1F,0xF0,0xFF,0x1F,0xFC,0x7C,0x63,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,
+0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xF8,0xEF,0xFF,0x1F,0xFE,0x3C,0x63,0x07,
+0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,
+0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x31,0xC7,0xEE,0xFF,0x1E,0x3C,
+0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,
+0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x30,0x3F,0xEE,0xFF,
+0x1D,0x1C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x03,0xED,
+0xFF,0x1D,0x9C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x1E,0x1F,
+0xED,0xFF,0x1C,0x8C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x10,
+0xEC,0xFF,0x1C,0x8C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7F,0x07,
+0xEC,0xFF,0x1C,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x7E,0x7F,
+0xEC,0xFF,0x1B,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x71,0xEB,
+0xFF,0x1B,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x07,0xEB,0xFF,
+0x1B,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0xCC,0x3F,0xEB,0xFF,0x1A,
+0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0x83,0xEA,0xFF,0x1A,0xCC,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x07,0x1F,0xEA,0xFF,0x19,0xCC,0x63,0x07,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,
+0x60,0xC1,0xF0,0x0C,0x78,0x00,0xE9,0xFF,0x19,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,
+0x0C,0x78,0x0F,0xE9,0xFF,0x19,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x78,0x7F,
+0xE9,0xFF,0x18,0xCC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x43,0xE8,0xFF,0x18,0x9C,
+0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,
+0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0C,0x3F,0xE8,0xFF,0x17,0x9C,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0xC1,0xF0,0x01,0xE7,0xFF,0x17,0xBC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0x0F,0xE7,0xFF,
+0x16,0x3C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC1,0xF0,0xE6,0xFF,0x16,0x7C,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0xC1,0x87,0xE7,0xFF,0x17,0xFE,0x7C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC0,0x7F,0xE7,0xFF,0x16,
+0xFE,0xFC,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,
+0x31,0x9C,0xFF,0xC0,0x7C,0x60,0xC3,0xE6,0xFF,0x16,0xFD,0xFC,0x63,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x60,
+0x1F,0xE6,0xFF,0x15,0xF8,0x3C,0x63,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,
+0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x61,0xE5,0xFF,0x15,0xF0,0x00,0x63,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,
+0xC0,0x7C,0x0F,0xE5,0xFF,0x15,0x80,0x00,0x23,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x7C,0x7F,0xE5,0xFF,0x14,0x1F,
+0xF8,0x03,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xFF,0xC0,0x63,0xE5,0xFF,0x15,0xFC,0x7F,0xFF,0x03,0x07,0xF1,0xF3,0xFC,0xF8,
+0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC0,0x0F,0xE5,0xFF,0x14,
+0xF9,0xFF,0xFF,0x83,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xC0,0xE4,0xFF,0x14,0xF7,0xFF,0xFF,0xE1,0x07,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0xC3,0xE4,0xFF,0x14,
+0xEF,0xFF,0xFF,0xF1,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x9C,0xFF,0xCF,0xE1,0xFF,0x11,0xF8,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,
+0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFF,0x3F,0xE1,0xFF,0x10,0xFC,0x07,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0xFC,0xE0,0xFF,
+0x10,0xFC,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0x9C,0xF3,0xE0,0xFF,0x10,0xFE,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x31,0x9C,0xE7,0xE0,0xFF,0x10,0xFE,0x07,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0x1F,0xDF,0xFF,0x0F,0x07,0xF1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x9C,0x7F,0xDF,0xFF,0x26,
+0x07,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x99,0xFF,
+0xE7,0xFC,0x07,0xE0,0x07,0xFC,0xFF,0xF3,0xFF,0xC7,0xFC,0x03,0xFF,0xBF,0xF8,0x7F,
+0xE1,0xFF,0xC7,0xFF,0x0F,0xE0,0x03,0xF6,0xFF,0x26,0x87,0xF1,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x83,0xFF,0xC7,0xFC,0x07,0xE0,0x03,0xF8,
+0xFF,0xE3,0xFF,0x01,0xF8,0x03,0xFF,0x1F,0xE0,0x3F,0x80,0xFF,0x01,0xFE,0x07,0xE0,
+0x03,0xF6,0xFF,0x26,0x87,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC6,0x31,0x8F,0xFF,0xC7,0xFC,0x7F,0xFF,0xE3,0xF0,0xFF,0xC3,0xFE,0x00,0xFF,0xC3,
+0xFF,0x3F,0xE2,0x1F,0x8C,0x7E,0x00,0xFC,0x63,0xFF,0xE3,0xF6,0xFF,0x26,0x87,0xF1,
+0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,0x3F,0xFF,0x8F,0xFC,
+0xFF,0xFF,0xE7,0xC0,0xFF,0x03,0xFE,0x7C,0xFF,0xC7,0xFE,0x3F,0xC7,0x9F,0xBE,0x7E,
+0x7C,0xF8,0xF1,0xFF,0xE7,0xF6,0xFF,0x26,0x87,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x7F,0xC6,0x30,0x7F,0xFF,0x9F,0xFC,0xFF,0xFF,0xCF,0xC0,0xFF,0x03,
+0xFC,0x7C,0x7F,0x8F,0xFC,0x7F,0xCF,0x8F,0xFE,0x7C,0x7C,0x79,0xF9,0xFF,0xC7,0xF6,
+0xFF,0x26,0x87,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x31,
+0xFF,0xFF,0x1F,0xFC,0xFF,0xFF,0x8F,0xFC,0xFF,0xF3,0xFC,0xFE,0x7F,0x1F,0xF8,0xFF,
+0xCF,0x8F,0xFE,0x7C,0xFE,0x79,0xF9,0xFF,0xCF,0xF6,0xFF,0x26,0x87,0xF1,0xF3,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x27,0xFF,0xFE,0x37,0xFC,0x1F,0xFF,
+0x1F,0xFC,0xFF,0xF3,0xFC,0xFE,0x7E,0x1F,0xF8,0x1F,0xCF,0xCF,0xFC,0x7C,0xFE,0x79,
+0xF9,0xFF,0x8F,0xF6,0xFF,0x26,0x87,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,
+0x0C,0x7F,0xC6,0x1F,0xFF,0xFE,0x67,0xFC,0x0F,0xFF,0x3F,0xFC,0xFF,0xF3,0xFC,0x7C,
+0x7E,0x07,0xF0,0x0F,0x8F,0xCF,0xF8,0xFC,0x7C,0x79,0xF9,0xFF,0x1F,0xF6,0xFF,0x26,
+0x87,0xF1,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC6,0x3F,0xFF,0xFC,
+0x67,0xFF,0xC7,0xFE,0x3F,0xFC,0xFF,0xF3,0xFE,0x38,0xFF,0xE3,0xF1,0xC7,0x8F,0xCF,
+0xF1,0xFE,0x38,0xF9,0xF9,0xFF,0x3F,0xF6,0xFF,0x26,0x80,0x01,0xF3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC4,0xFF,0xFF,0xFC,0xE7,0xFF,0xE3,0xFC,0x7F,0xFC,
+0xFF,0xF3,0xFE,0x00,0xFF,0xF3,0xE3,0xE7,0x8F,0xCF,0xE3,0xFF,0x00,0xF9,0xF9,0xFE,
+0x7F,0xF6,0xFF,0x26,0x80,0x01,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,
+0xC1,0xFF,0xFF,0xF8,0xE3,0xFF,0xF3,0xFC,0x7F,0xFC,0xFF,0xF3,0xFF,0x81,0xFF,0xF3,
+0xE7,0xE3,0xCF,0xCF,0xE3,0xFF,0x81,0xF9,0xF9,0xFC,0x7F,0xF5,0xFF,0x24,0xC1,0xF3,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0xC7,0xFF,0xFF,0xF0,0x00,0xFF,0xF3,
+0xF8,0xFF,0xFC,0xFF,0xF3,0xFF,0xE3,0xFF,0xF3,0xE7,0xE3,0xCF,0x8F,0xC7,0xFF,0xE3,
+0xF9,0xF9,0xFC,0xF4,0xFF,0x24,0xF0,0xF3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7F,0x9F,0xFF,0xFF,0xF8,0x00,0xFF,0xE3,0xF9,0xFF,0xFC,0xFF,0xF3,0xFF,0xE3,0xFF,
+0xF3,0xE7,0xE3,0xCF,0x8F,0x8F,0xFF,0xE3,0xF9,0xF9,0xF8,0xF4,0xFF,0x0B,0xF8,0x73,
+0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7F,0x3F,0xFE,0xFF,0x15,0xE7,0xFF,0xE7,
+0xF9,0xFF,0xFC,0xFF,0xF3,0xFF,0xC7,0xFD,0xE3,0xE3,0xE7,0xCF,0x9F,0x9F,0xFF,0xC7,
+0xF8,0xF1,0xF9,0xF4,0xFF,0x0A,0xFC,0x33,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,
+0x7C,0xFD,0xFF,0x15,0xE7,0xF1,0xC7,0xF9,0xFF,0xFC,0xFF,0xF3,0xFF,0x8F,0xF8,0xC7,
+0xF1,0x87,0xE3,0x1F,0x9F,0xFF,0x8F,0xFC,0x63,0xF9,0xF4,0xFF,0x0A,0xFE,0x33,0xFC,
+0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x7B,0xFD,0xFF,0x15,0xE7,0xF8,0x0F,0xF9,0xFF,
+0xFC,0xFF,0xF3,0xFF,0x9F,0xFC,0x0F,0xF8,0x0F,0xE0,0x3F,0x80,0x3F,0x9F,0xFE,0x07,
+0xF9,0xF3,0xFF,0x09,0x13,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x0C,0x67,0xFD,0xFF,
+0x15,0xF7,0xFC,0x1F,0xF9,0xFF,0xFC,0xFF,0xF3,0xFF,0x9F,0xFE,0x1F,0xFC,0x3F,0xF8,
+0x7F,0x80,0x7F,0x9F,0xFF,0x0F,0xF9,0xF3,0xFF,0x09,0x13,0xFC,0xF8,0x3E,0x7C,0x1F,
+0x1E,0x30,0x0C,0x1F,0xD9,0xFF,0x09,0x83,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x08,
+0x7F,0xD9,0xFF,0x08,0x83,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x03,0xD8,0xFF,0x08,
+0x83,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x30,0x3F,0xD8,0xFF,0x07,0xC3,0xFC,0xF8,0x3E,
+0x7C,0x1F,0x1E,0x23,0xD7,0xFF,0x07,0xC3,0xFC,0xF8,0x3E,0x7C,0x1F,0x1E,0x1F,0xD7,
+0xFF,0x06,0xC3,0xFC,0xF8,0x3E,0x7C,0x1F,0x01,0xD6,0xFF,0x06,0xC3,0xFC,0xF8,0x3E,
+0x7C,0x1E,0x1F,0xD6,0xFF,0x05,0x83,0xFC,0xF8,0x3E,0x7C,0x00,0xD5,0xFF,0x05,0x93,
+0xFC,0xF8,0x3E,0x7C,0x1F,0xD5,0xFF,0x04,0x93,0xFC,0xF8,0x3E,0x01,0xD4,0xFF,0x04,
+0x33,0xFC,0xF8,0x3C,0x0F,0xD4,0xFF,0x03,0x73,0xFC,0xF8,0x01,0xD6,0xFF,0x06,0xE0,
+0x00,0x00,0x01,0xF8,0xF0,0x1F,0xD7,0xFF,0x06,0x00,0x3F,0xFF,0xFF,0xFE,0x00,0x0F,
+0xD7,0xFF,0x01,0x80,0x7F,0x81,0xFF,0x81,0xFF,0xD4,0xFF,0x00,0xE0,0xDE,0x00,0x00,
+0x0F,0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,
+0x0F,0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,
+0x0F,0xF4,0xFF,0x00,0xE0,0xFA,0x00,0x00,0x01,0xF9,0x00,0x00,0x40,0xFD,0x00,0x00,
+0x03,0xF4,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x01,0x00,0x00,0x03,
+0xFC,0x01,0x81,0x80,0x00,0xFF,0xC0,0x00,0x60,0x00,0x03,0xFD,0x01,0x7F,0xFE,0x01,
+0xF3,0xFC,0x00,0x00,0x80,0x00,0x3F,0x80,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,
+0xFD,0x00,0x1B,0x01,0x00,0x03,0xFF,0xFC,0x03,0xCF,0xF8,0x03,0xC0,0x30,0x11,0xFF,
+0x40,0x1F,0xFF,0x01,0xFF,0xFF,0xC3,0xF2,0x08,0x00,0x20,0xC0,0x03,0xFF,0xF8,0xFE,
+0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x01,0x00,0x03,0xDF,0xC0,0x0F,
+0x9F,0xF8,0x03,0xBF,0xE0,0x3F,0xFF,0xC0,0x1F,0x0E,0x01,0xE6,0x07,0x83,0xE2,0x08,
+0x00,0xE0,0x70,0x03,0xFF,0xF8,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,
+0x1B,0x1F,0xFC,0x03,0x02,0x40,0x0F,0x1D,0x80,0x01,0xFF,0xC0,0x3F,0xE1,0xC0,0x01,
+0x98,0x00,0x0F,0xF8,0x01,0x23,0xF8,0x01,0xC0,0x7C,0x03,0xC0,0x10,0xFE,0x00,0x00,
+0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x7F,0xFE,0x01,0xCE,0x7C,0x03,0x01,0xF0,
+0x01,0x80,0x40,0x1C,0x61,0x80,0x00,0x70,0x00,0x0F,0xFC,0x01,0x43,0xF0,0x07,0xC4,
+0x3E,0x00,0xFF,0x90,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x7F,
+0xFE,0x03,0x8F,0xFC,0x01,0x1F,0xF8,0x01,0x7F,0xC0,0x1D,0xFF,0x00,0x00,0x70,0x00,
+0x3E,0x08,0x01,0xE2,0x10,0x07,0x8C,0x1E,0x1F,0xFF,0x90,0xFE,0x00,0x00,0x0F,0xF4,
+0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x73,0x00,0x00,0x0E,0x40,0x01,0x1F,0x30,0x03,0xE7,
+0xC0,0x1F,0xFF,0x00,0x1F,0xFF,0xE1,0xF7,0xF8,0x01,0x32,0x10,0x07,0x0E,0x1C,0x1F,
+0x00,0x20,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x03,0x80,0x01,
+0xC1,0xFE,0x01,0x01,0x00,0x03,0xE4,0x80,0x1F,0xE1,0x00,0x7F,0xFF,0xE1,0xE7,0xF8,
+0x01,0x23,0xF0,0x00,0x0F,0x00,0x00,0xFF,0x20,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,
+0xE0,0xFD,0x00,0x1B,0x02,0xC0,0x03,0x0F,0xFC,0x01,0x07,0xF0,0x00,0x24,0x00,0x1C,
+0x61,0x00,0x7E,0x21,0xC1,0xC4,0x08,0x01,0x43,0xF0,0x00,0x1B,0x00,0x07,0xFF,0x20,
+0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x06,0x60,0x00,0x4E,0xC0,
+0x01,0x1F,0xF0,0x03,0xA6,0x60,0x18,0xFE,0x00,0x70,0x20,0x01,0x07,0xF8,0x01,0xC2,
+0x50,0x00,0x31,0x80,0x07,0x02,0x20,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,
+0x00,0x1B,0x0C,0x30,0x01,0x80,0x80,0x01,0x1D,0x80,0x03,0xA6,0x60,0x1F,0xFE,0x00,
+0x00,0x20,0x00,0x07,0xF8,0x01,0x02,0x58,0x00,0x60,0xC0,0x06,0x3E,0x20,0xFE,0x00,
+0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,0x1C,0x38,0x03,0xFE,0xC0,0x01,0x01,
+0x80,0x00,0x26,0x00,0x3E,0xC0,0x00,0x00,0x20,0x00,0x0C,0x18,0x02,0x06,0x98,0x00,
+0xE0,0xE0,0x0F,0xFE,0x20,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFD,0x00,0x1B,
+0x38,0x1E,0x03,0xFF,0xE0,0x01,0x0F,0xFE,0x01,0xFF,0xC0,0x00,0xC0,0x30,0x00,0x60,
+0x00,0x1C,0x18,0x02,0x07,0xFC,0x01,0xFF,0xF0,0x0F,0x00,0x60,0xFE,0x00,0x00,0x0F,
+0xF4,0xFF,0x00,0xE0,0xFE,0x00,0x1C,0x01,0xF0,0x1F,0xC2,0x03,0xFF,0x01,0x7F,0xFC,
+0x1F,0xFF,0xFC,0x00,0xFF,0xF0,0x00,0x60,0x00,0x38,0x08,0x02,0x1F,0xEF,0x03,0xFF,
+0xF8,0x00,0x3F,0xE0,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xFE,0x00,0x1C,0x01,
+0xC0,0x0F,0x80,0x00,0x3F,0x01,0x78,0x3C,0x1E,0x00,0xF8,0x00,0xFF,0xF0,0x01,0xC0,
+0x00,0xF0,0x08,0x02,0x30,0x0F,0x03,0x00,0x30,0x00,0x3F,0xC0,0xFE,0x00,0x00,0x0F,
+0xF4,0xFF,0x00,0xE0,0xFC,0x00,0x04,0x07,0x00,0x00,0x1E,0x01,0xFD,0x00,0x0B,0x38,
+0x00,0x03,0xE0,0x07,0x80,0x00,0x00,0x08,0x02,0x00,0x06,0xFD,0x00,0x01,0x07,0xC0,
+0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xF0,0x00,0x00,0xC0,0xF0,0x00,0x00,0x0F,
+0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,0x0F,
+0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xDE,0x00,0x00,0x0F,
+0x81,0xFF,0xE5,0xFF,
+};
+
+// BitmapExample2 : 14992 bytes, packed 7618
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0x90,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x9E,0xFF,
+0x00,0xE1,0xD0,0xFF,0x00,0x0F,0xD1,0xFF,0x01,0xFE,0x3F,0xD1,0xFF,0x01,0xFE,0x70,
+0xD1,0xFF,0x03,0xFE,0x67,0xF3,0x01,0xE7,0xFF,0x04,0xC3,0x73,0xF3,0xFF,0xDF,0xF3,
+0xFF,0x04,0xF8,0x3E,0xFF,0x93,0xFD,0xE7,0xFF,0x04,0x9F,0x00,0x7C,0xEE,0x7C,0xF2,
+0xFF,0x00,0x0C,0xE4,0xFF,0x04,0x38,0xE0,0x7E,0x67,0xEF,0xF2,0xFF,0x00,0xCD,0xE5,
+0xFF,0x07,0xFE,0xE7,0x38,0x3F,0x33,0xFF,0xFF,0x07,0xF5,0xFF,0x05,0xFE,0x6D,0xEF,
+0xFC,0x1E,0x7F,0xE9,0xFF,0x07,0xFC,0xFF,0xBF,0xBF,0xFB,0xFF,0xF8,0xF1,0xF5,0xFF,
+0x01,0xF0,0x0B,0xFE,0xFF,0x00,0x9F,0xE9,0xFF,0x01,0x84,0x3F,0xFC,0xFF,0x01,0xFE,
+0x7F,0xF6,0xFF,0x05,0xFE,0x0B,0xFF,0xFB,0xCC,0x3F,0xEA,0xFF,0x02,0xFC,0x7F,0xDF,
+0xFB,0xFF,0x00,0x3F,0xF5,0xFF,0x04,0x1F,0xFE,0x1F,0xFE,0x03,0xEA,0xFF,0x02,0xF9,
+0xCF,0xE7,0xFB,0xFF,0x00,0x8F,0xF5,0xFF,0x04,0x9F,0xFE,0x7F,0xFF,0x03,0xEA,0xFF,
+0x01,0xE3,0xF1,0xFB,0xFF,0x01,0xF8,0x01,0xF8,0xFF,0x07,0xC0,0x1D,0xFF,0x1F,0xFB,
+0xE4,0x3F,0xE1,0xEA,0xFF,0x01,0xE0,0xFC,0xFE,0xFF,0x00,0xFD,0xFE,0xFF,0x01,0xF8,
+0x7F,0xFA,0xFF,0x08,0xF8,0x00,0x00,0xDF,0x3F,0xF3,0xFF,0xCF,0xF0,0xE9,0xFF,0x00,
+0xBE,0xFD,0xFF,0x00,0xE7,0xFE,0xFF,0x00,0x3F,0xFA,0xFF,0x00,0xE0,0xFE,0x00,0x05,
+0x7F,0xFF,0xFF,0xFB,0x38,0x3F,0xE1,0xFF,0x00,0x9F,0xFB,0xFF,0x00,0xFE,0xFD,0x00,
+0x00,0x07,0xFE,0xFF,0x01,0x0C,0x1F,0xE1,0xFF,0x00,0xCF,0xFB,0xFF,0x05,0x80,0x03,
+0x39,0x98,0xE4,0x01,0xFE,0xFF,0x01,0x25,0x9F,0xE1,0xFF,0x00,0xEF,0xFB,0xFF,0x0A,
+0x00,0x67,0xFF,0xFD,0xCE,0x30,0x7F,0x0F,0xFF,0xC4,0xDF,0xED,0xFF,0x01,0xFC,0x4F,
+0xF1,0xFF,0x0B,0xFC,0x61,0xEC,0x1F,0xFF,0xFC,0xF0,0x0F,0x07,0xFE,0xE2,0x4F,0xED,
+0xFF,0x01,0xF9,0x87,0xFD,0xFF,0x00,0xEF,0xF6,0xFF,0x0B,0xE0,0x0F,0x86,0x3F,0xB9,
+0xF7,0xFF,0x03,0xE1,0xFF,0x73,0x0F,0xED,0xFF,0x00,0xFB,0xF0,0xFF,0x0B,0xC3,0x3E,
+0x1E,0x7F,0xA3,0xC1,0x7E,0x01,0xE1,0xFF,0xB9,0x8F,0xE7,0xFF,0x03,0xFE,0xFF,0xFF,
+0xF7,0xFA,0xFF,0x0C,0xFE,0x3F,0x71,0xFC,0xFF,0xCF,0xFB,0xFE,0x00,0xFC,0xFF,0xDD,
+0x8F,0xEB,0xFF,0x00,0x7F,0xFB,0xFF,0x00,0xFB,0xFA,0xFF,0x02,0xFC,0x3F,0xC3,0xFD,
+0xFF,0x05,0xCE,0x00,0x3E,0x7F,0xFC,0x07,0xEB,0xFF,0x00,0x3F,0xFB,0xFF,0x03,0xFD,
+0xFF,0xFF,0xCF,0xFD,0xFF,0x02,0xFD,0xFD,0x8E,0xFC,0xFF,0x04,0xFC,0x0F,0x9F,0xEC,
+0x8F,0xEB,0xFF,0x01,0x1F,0xEF,0xFC,0xFF,0x03,0xFD,0xFF,0xFF,0xE7,0xFB,0xFF,0x00,
+0x1E,0xFD,0xFF,0x05,0xF8,0x7C,0x07,0xCF,0xFE,0xC7,0xED,0xFF,0x0C,0xFE,0x7F,0x0F,
+0xFB,0xFF,0xFF,0xFB,0xFF,0xFF,0xFE,0xFF,0xFF,0xFB,0xFD,0xFF,0x03,0xF1,0x1F,0xFF,
+0xFB,0xFD,0xFF,0x04,0xFC,0x06,0xCF,0xF6,0x47,0xED,0xFF,0x02,0xE1,0xFF,0x0F,0xFB,
+0xFF,0x09,0xEF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFC,0x00,0x01,0xFB,0xFF,0x04,0xC0,
+0x04,0xE7,0xFE,0x67,0xED,0xFF,0x12,0x07,0xEF,0x01,0xFF,0x7F,0xFF,0xFD,0xFF,0xFF,
+0xEF,0x7F,0xE7,0xFE,0xEF,0xFF,0xFF,0xE0,0x00,0x00,0xFB,0xFF,0x04,0xF4,0x80,0xF7,
+0xFF,0x63,0xEE,0xFF,0x03,0xFE,0x1F,0xFF,0x80,0xF9,0xFF,0x08,0xF7,0xFE,0xF7,0xFF,
+0xFF,0xC0,0x00,0x40,0x3F,0xFE,0xFF,0x06,0x7F,0xFF,0xFF,0x00,0xF3,0xFB,0x43,0xEE,
+0xFF,0x04,0xFE,0x3F,0x7F,0x80,0x7B,0xFC,0xFF,0x14,0xF7,0xFF,0xF3,0xFF,0x7B,0xFF,
+0xFF,0x00,0x00,0x04,0x1F,0xFF,0xFD,0xF6,0xFF,0xFF,0xF3,0xE0,0xFB,0xFB,0x03,0xEF,
+0xFF,0x05,0xF9,0x3C,0x3F,0xFF,0x80,0x39,0xFC,0xFF,0x14,0xF7,0xDF,0xFB,0xFF,0xF9,
+0xFF,0xFE,0x10,0x00,0x0E,0x0F,0xFF,0xFF,0xA7,0xB7,0xFF,0xFF,0xFC,0x5C,0xFB,0xC3,
+0xEF,0xFF,0x05,0xFC,0x00,0xFF,0xFF,0x80,0x14,0xFB,0xFF,0x13,0xDF,0xF9,0xFF,0xFD,
+0xFF,0xF8,0xE0,0x00,0x1E,0x0F,0xFF,0xFB,0x03,0x07,0xFF,0xFF,0x82,0x3E,0xFB,0xE1,
+0xEF,0xFF,0x1F,0xFE,0x01,0xFF,0xFF,0x80,0x16,0xFB,0xFF,0xFF,0xBF,0xFF,0xFF,0xEF,
+0xFD,0xFF,0xF0,0xFF,0xF1,0xC0,0x00,0x7E,0x0F,0xFF,0xFB,0x06,0x0F,0xFF,0xFF,0x08,
+0x3E,0xFF,0xE1,0xEF,0xFF,0x08,0xFE,0x03,0xFF,0xFF,0x00,0x1B,0x7B,0xFF,0xFD,0xFE,
+0xFF,0x13,0xEF,0xFC,0xFD,0xF0,0xFF,0xE3,0x00,0x00,0x3E,0x2F,0xFF,0xFF,0x0C,0x38,
+0xFF,0xFF,0xFC,0x3F,0xFF,0xF9,0xEE,0xFF,0x05,0x07,0xFF,0xFF,0x00,0x1B,0x7F,0xFC,
+0xFF,0x13,0xEF,0xFC,0xFE,0xF8,0x7F,0xE7,0x00,0x01,0xCE,0x0F,0xFF,0xFF,0x08,0x63,
+0xFF,0xFF,0xEE,0x1F,0xFF,0xF9,0xEE,0xFF,0x05,0x0F,0xFF,0xFE,0x00,0x0D,0xBF,0xFB,
+0xFF,0x12,0xFE,0x7F,0x7C,0x07,0xCE,0x00,0x00,0x7E,0x3F,0xFF,0xFF,0x81,0x8F,0xBF,
+0xFF,0xF3,0x0F,0xFF,0xED,0xEE,0xFF,0x07,0x0F,0xFF,0xFE,0x20,0x0D,0x9F,0xFF,0xFE,
+0xFD,0xFF,0x12,0xFE,0x3F,0xBC,0x81,0xFE,0x00,0x02,0x3E,0x6F,0xFF,0xFF,0xF0,0x1F,
+0xFF,0xFF,0xFD,0x87,0xF7,0xE0,0xEF,0xFF,0x06,0xFE,0x1F,0xFF,0xFC,0x60,0x0C,0xDF,
+0xFE,0xFF,0x15,0xFD,0xFD,0xFF,0xFE,0xBF,0xBE,0xC0,0xFC,0x00,0x00,0x0E,0x4F,0xFF,
+0xFF,0xFC,0x6F,0xFF,0xFF,0xF6,0x07,0xF7,0xE0,0xEF,0xFF,0x05,0xFC,0x1F,0xFF,0xFC,
+0xC0,0x1E,0xFE,0xFF,0x0C,0xF7,0xFE,0xFD,0xEF,0xFE,0xDF,0xDE,0x60,0x38,0x00,0x00,
+0x6E,0x4F,0xFB,0xFF,0x04,0xF0,0x43,0xF7,0xE0,0x7F,0xF0,0xFF,0x0F,0xF8,0x2F,0xFF,
+0xFC,0xC0,0x1E,0xEF,0xFF,0xFF,0x7F,0xFF,0xFD,0xC7,0xFE,0xDF,0xDF,0xFE,0x00,0x02,
+0x03,0x3E,0x1F,0xFE,0xFF,0x07,0xF3,0xFF,0xFF,0xFC,0x63,0xF7,0xE0,0x3F,0xF0,0xFF,
+0x06,0xF0,0x3F,0xFF,0xFC,0xC7,0x9A,0xEF,0xFC,0xFF,0x09,0xE7,0xFE,0xDF,0xFC,0x20,
+0x00,0x31,0xC5,0xFE,0x1F,0xFE,0xFF,0x07,0xF7,0x7F,0xFF,0xFF,0x73,0xF7,0xE0,0x1F,
+0xF0,0xFF,0x15,0xF0,0x7F,0xFF,0xFC,0x87,0x9B,0x6F,0xFF,0xFF,0xBB,0xFF,0xFD,0xE7,
+0xFE,0xCF,0xE8,0x30,0x00,0x00,0x72,0xFC,0x3F,0xFE,0xFF,0x07,0xFD,0x9F,0xFF,0xFF,
+0xF1,0xF7,0xEC,0x80,0xF0,0xFF,0x15,0xF8,0xFF,0xFF,0xFC,0x83,0x9F,0x6F,0xFF,0xFF,
+0xBB,0xFE,0xFD,0xF7,0xFF,0xEF,0xE9,0x18,0x03,0x09,0x39,0xFC,0x3F,0xFB,0xFF,0x04,
+0xFE,0xE8,0xF7,0xCC,0xE1,0xF0,0xFF,0x15,0xF9,0xFF,0xFF,0xFD,0x8C,0x1F,0xFF,0xFD,
+0xFF,0xBB,0xFE,0xFD,0xF7,0xFF,0xEF,0xE8,0x2E,0x0D,0xCC,0x0F,0xF8,0x7F,0xFE,0xFF,
+0x07,0xF0,0x7F,0xFF,0xFE,0x64,0xE7,0xCC,0x71,0xF0,0xFF,0x14,0xF3,0xFF,0xFF,0xFD,
+0x9F,0x36,0x7F,0xFD,0xFF,0xBB,0xFF,0x7D,0xF7,0xFF,0xEF,0xFC,0x33,0x06,0xF7,0x0F,
+0xF8,0xFC,0xFF,0x06,0x8F,0xFF,0xFF,0x30,0xE7,0xCC,0x1F,0xF0,0xFF,0x14,0xE7,0xFF,
+0xFF,0xFD,0x9F,0xBE,0x7F,0xFE,0xFF,0xB9,0xFF,0x7F,0xFF,0xFF,0xE7,0xFC,0x3D,0x87,
+0x7F,0xCF,0xF1,0xFC,0xFF,0x06,0xCF,0xFF,0xFF,0x98,0x77,0xCC,0x3F,0xF0,0xFF,0x14,
+0xEF,0xFF,0xFF,0xFD,0x9F,0xB6,0x7F,0xFE,0xFF,0xF9,0xFF,0xFD,0xFF,0xFF,0xE7,0xF8,
+0x1E,0xC7,0xFF,0xFF,0xE3,0xFD,0xFF,0x07,0xFE,0x3F,0xFF,0xFF,0xEC,0x77,0x8C,0x5F,
+0xF0,0xFF,0x07,0xCF,0xFF,0xFD,0xFC,0xDF,0x36,0x7F,0xFE,0xFE,0xFF,0x09,0xBF,0xFF,
+0xFF,0xE7,0xF8,0x07,0x63,0xFF,0x9F,0x87,0xFC,0xFF,0x06,0x1F,0xFF,0xFF,0xFE,0x77,
+0x9C,0xEF,0xF0,0xFF,0x05,0xDF,0xFF,0xFF,0xFC,0xCE,0x33,0xFE,0xFF,0x0B,0xFE,0xFF,
+0xBF,0xFF,0xFF,0xE7,0xFC,0x7B,0xB3,0xFF,0xFE,0x0F,0xFC,0xFF,0x06,0x4F,0xFF,0xFF,
+0xFE,0x77,0x9C,0x79,0xF0,0xFF,0x14,0x9F,0xFF,0xFF,0xFC,0xC0,0x3B,0xFF,0xFF,0x6F,
+0xFE,0x7F,0xFF,0xF7,0xFF,0xEF,0xFE,0x39,0xE1,0xFF,0xFC,0x0F,0xFE,0xFF,0x08,0xFE,
+0xFF,0xC7,0xFF,0xFD,0xDD,0x3F,0xDC,0x7F,0xF0,0xFF,0x14,0x9F,0xFF,0xFF,0xFC,0xC0,
+0x3B,0xFF,0xFF,0x6F,0xFF,0x7E,0xDF,0xE7,0xFF,0xDF,0xFE,0x1C,0xE0,0x07,0xF8,0x8F,
+0xFE,0xFF,0x08,0xFE,0x3F,0xC3,0xFF,0xFF,0xED,0x3F,0xFC,0x7F,0xF0,0xFF,0x14,0x3F,
+0xFF,0xFF,0xFC,0xC0,0x19,0xFF,0xFF,0x6F,0xFF,0x7E,0xDF,0xE7,0x7F,0xDF,0xFE,0x0E,
+0x78,0x00,0x01,0xC7,0xFD,0xFF,0x01,0x0F,0xCF,0xFE,0xFF,0x02,0xBF,0xFC,0x7F,0xF0,
+0xFF,0x14,0xBF,0xFF,0xBF,0xFC,0x40,0xDC,0xFF,0xFF,0x6F,0xFF,0x7F,0x4F,0xF7,0x7F,
+0xDF,0xFF,0x67,0x38,0x00,0x03,0xC7,0xFD,0xFF,0x07,0x83,0xAF,0xFF,0xFF,0xDF,0x1F,
+0xF6,0x7F,0xF0,0xFF,0x1A,0x9F,0xFF,0xBB,0xFC,0x63,0xCE,0xEF,0xFF,0x6F,0xFF,0xBF,
+0x4F,0xF7,0xFF,0xDF,0xFF,0x63,0xD8,0x3F,0x33,0xE7,0xFF,0xFF,0xFC,0x7F,0xF1,0xF7,
+0xFE,0xFF,0x02,0x1F,0xF2,0x7F,0xF0,0xFF,0x14,0x9F,0xFF,0xBB,0xFC,0x67,0xE6,0x77,
+0xFF,0xEF,0xBF,0xBF,0x6F,0xF7,0x7F,0xB7,0xFF,0x71,0xEE,0x1F,0xBB,0xF3,0xFD,0xFF,
+0x01,0xFE,0xDB,0xFE,0xFF,0x02,0x1F,0xE3,0x7F,0xF0,0xFF,0x14,0x9F,0xFF,0xFF,0xFC,
+0x7F,0xFF,0x37,0xFB,0x7F,0xFF,0xBF,0xAF,0xFF,0x7F,0xB7,0xF9,0x3C,0xFE,0x1F,0x99,
+0xF1,0xFD,0xFF,0x07,0x9F,0xDF,0xFF,0xFF,0xFC,0x9F,0xC3,0x7F,0xF0,0xFF,0x14,0x9B,
+0xFF,0x7F,0xFC,0x7F,0xFF,0x9A,0xFF,0x7F,0xFF,0xBF,0xAF,0xFF,0xFF,0xBD,0xF8,0x3E,
+0x7B,0x1F,0x9C,0xF8,0xFD,0xFF,0x07,0x8F,0xEF,0xFF,0xFF,0xFC,0x1F,0xE7,0x3F,0xF0,
+0xFF,0x06,0x9F,0xFF,0x7F,0xF8,0xB7,0xFF,0xDA,0xFE,0xFF,0x0B,0xBF,0xBF,0xFF,0xFF,
+0x6D,0xFC,0x1F,0xFF,0x8F,0x8C,0x98,0x7F,0xFE,0xFF,0x07,0xF3,0xF7,0xFF,0xFF,0xEE,
+0x1F,0xE7,0x3F,0xF0,0xFF,0x20,0x9F,0xFB,0x7F,0xFC,0xBF,0xFF,0xC9,0x7C,0xFF,0xFF,
+0xBF,0xDF,0xFF,0xFF,0x6D,0xFF,0x9F,0x7F,0xCF,0x8C,0x98,0x7F,0xFF,0xFF,0x7F,0xF9,
+0xFB,0xFF,0xEF,0xF7,0x1F,0x0F,0xBF,0xF0,0xFF,0x20,0x9B,0xFB,0x7F,0xFC,0xF7,0xFF,
+0xC5,0x7D,0xDF,0xFF,0xBF,0xDF,0xEF,0xFE,0xFD,0xFE,0x1C,0x7F,0xCF,0xC6,0x1F,0x3F,
+0xFF,0xFF,0x9F,0xFC,0xCF,0xFB,0xF7,0xFF,0x0F,0x0E,0x9F,0xF0,0xFF,0x20,0xDB,0xFF,
+0x7B,0xF8,0xFF,0xFF,0xE5,0x7F,0xDF,0xFF,0x7F,0xDF,0xFF,0xFE,0xFD,0xFE,0x9F,0x1F,
+0xE7,0xC6,0x1F,0x8F,0xFF,0xFF,0xEF,0xE6,0x67,0xFF,0xFF,0xFC,0x1F,0x6E,0x0F,0xF0,
+0xFF,0x15,0xD7,0xFB,0x7B,0xFC,0xFE,0x3F,0xE1,0x3F,0xDF,0xFF,0x7F,0xDF,0xFF,0xFE,
+0xDD,0xFE,0x0F,0x8F,0xE7,0xC2,0x43,0x8F,0xFE,0xFF,0x07,0xF3,0x37,0xFF,0xFF,0xFE,
+0x1F,0x4E,0x07,0xF0,0xFF,0x20,0xF3,0xFB,0x7B,0xFC,0xF8,0x0F,0xE1,0xBD,0xFF,0xFF,
+0x7F,0xDF,0xFF,0xFE,0xDF,0xFE,0x0D,0xFF,0xE5,0x63,0x70,0x0F,0xFF,0xFF,0xDF,0xF9,
+0x3F,0xEF,0xFF,0xF6,0x1F,0x4F,0x73,0xF0,0xFF,0x07,0xF3,0xFB,0x7B,0xFD,0xFF,0xE3,
+0xF1,0xBF,0xFE,0xFF,0x14,0xDF,0xDF,0xFF,0xFB,0xFE,0x0E,0x7F,0xE7,0xE3,0x7E,0xEF,
+0xFF,0xFF,0xCF,0xFC,0x3F,0xF7,0xF7,0xFB,0x0F,0x6F,0xEF,0xFF,0x1F,0xF3,0xFB,0xFB,
+0xFF,0xFF,0xFB,0xF1,0xBB,0xBF,0xFE,0xFF,0xDF,0xDF,0xFF,0xBB,0xFC,0xCF,0x3F,0xF3,
+0xE3,0xFF,0xE7,0xFF,0xFF,0xF7,0xFE,0x1F,0xFF,0xF3,0xDB,0x1E,0x6F,0xEF,0xFF,0x01,
+0xFB,0xFB,0xFE,0xFF,0x10,0xF8,0x31,0xB3,0x9F,0xFE,0xFF,0x9F,0xDE,0xFF,0xBA,0xFC,
+0xCF,0xDC,0xF3,0xB1,0xBF,0xE3,0xFD,0xFF,0x05,0x1F,0xFF,0xF9,0xFC,0x1E,0x0F,0xEF,
+0xFF,0x01,0xFB,0xFB,0xFE,0xFF,0x10,0xF0,0x71,0xB3,0xBB,0xFF,0xFF,0x1F,0x9C,0xFD,
+0xBE,0xF8,0x07,0xEE,0xF3,0xB1,0xBB,0xD3,0xFE,0xFF,0x06,0xF9,0x8F,0xDF,0xFD,0xF6,
+0x1F,0xE7,0xEF,0xFF,0x1F,0xF3,0xFF,0x7F,0xFE,0x3E,0x01,0xF1,0xBB,0x3F,0xFD,0xFF,
+0x1F,0x9C,0xFF,0xFB,0xF8,0x13,0xF7,0xF1,0xF1,0x9F,0x71,0xFF,0xFF,0xE3,0xF8,0x0F,
+0xFF,0xFE,0xF6,0x1E,0xE7,0xEF,0xFF,0x00,0xF3,0xFE,0xFF,0x1B,0x00,0x01,0xF1,0xBB,
+0x3F,0xFD,0xEF,0x7F,0x9C,0xFF,0xF7,0xF8,0x3F,0xF3,0xF9,0xD9,0x9F,0x69,0xFF,0xFF,
+0xF9,0xFC,0x0F,0xFF,0xFF,0xFA,0x1F,0xE7,0xEF,0xFF,0x00,0xF3,0xFE,0xFF,0x1B,0xC0,
+0x39,0xF1,0xBA,0x7F,0xFD,0xFF,0x5F,0x9E,0xFF,0xF7,0xF8,0x3F,0x1B,0xF9,0xD8,0xCB,
+0xAD,0xFF,0xFF,0xFB,0xFE,0x9F,0xFF,0xFF,0xDF,0x1F,0xC3,0xEF,0xFF,0x15,0xF7,0xF6,
+0x1F,0xEF,0xE0,0x39,0xF1,0xB9,0xFF,0xFD,0xFF,0x3F,0x9F,0x7F,0xF5,0xF8,0x3F,0xCF,
+0xF9,0xF8,0xDD,0xAC,0xFE,0xFF,0x06,0xFE,0xCF,0xFF,0xFF,0xF8,0x1F,0xC3,0xEF,0xFF,
+0x15,0xCF,0xC0,0x3F,0xDF,0xE0,0x03,0xF3,0xB9,0xFF,0xFB,0xFF,0x3F,0xDF,0x3F,0xED,
+0xF8,0xF3,0xE7,0xF8,0x78,0xC9,0x94,0xFE,0xFF,0x06,0xFE,0x4F,0xFF,0xE7,0xF9,0x0E,
+0x19,0xEF,0xFF,0x15,0x9F,0xE0,0xBF,0xFF,0xF0,0x03,0xFB,0xB3,0x7F,0xFB,0xFF,0x7F,
+0x9F,0x3D,0xED,0xF0,0xFD,0xF3,0xF8,0x1C,0x40,0xD4,0xFD,0xFF,0x05,0x27,0xFF,0xF3,
+0xFD,0x1E,0x78,0xEF,0xFF,0x15,0xBF,0xEC,0x17,0xFF,0xF8,0x07,0xFB,0x33,0x77,0xFB,
+0xFF,0x7F,0x9D,0xBD,0xEF,0xF1,0xFF,0x7B,0xF8,0x0C,0x60,0xD0,0xFE,0xFF,0x06,0xFD,
+0x07,0xFF,0xFD,0xFC,0x1F,0x78,0xF0,0xFF,0x21,0xFE,0xFF,0xEE,0x06,0xFF,0xFE,0x0F,
+0xFB,0x72,0x77,0xFB,0x6F,0xFF,0x9D,0xBC,0xEF,0xF3,0xFF,0xDD,0xFC,0x80,0x00,0x58,
+0x7F,0xFF,0xEF,0xF8,0x8F,0xFF,0xFF,0xFC,0x3F,0x7C,0x7F,0xEF,0xFF,0x1F,0xCF,0xE6,
+0x7F,0xFF,0xFF,0xF7,0xF2,0x73,0xFB,0xFE,0xFF,0x9D,0xBC,0xFF,0xF3,0xFF,0xE6,0xFC,
+0x03,0x04,0x48,0x7F,0xFF,0xF7,0xBC,0x47,0xFF,0xFF,0xF8,0x3F,0x7E,0x7F,0xEF,0xFF,
+0x1E,0xCF,0xFE,0x3F,0xFF,0xFF,0xF7,0xF2,0x7F,0xF7,0xFE,0xFF,0xDD,0xBC,0xFF,0xF3,
+0xFD,0xF6,0x7C,0x03,0x0E,0x48,0x7F,0xFF,0xFB,0xFE,0x07,0xFF,0xFF,0xFC,0x3F,0x1F,
+0xEE,0xFF,0x1E,0xDF,0xEC,0x1F,0xFF,0xFF,0xF8,0xEE,0x73,0xF6,0xFC,0xFF,0xDD,0xBC,
+0xDB,0xF7,0xFF,0xFB,0xFC,0x03,0x06,0x28,0x7F,0xFF,0xFC,0xFE,0x03,0xFF,0xFD,0xFC,
+0x3F,0x1F,0xEE,0xFF,0x1E,0xDF,0xED,0x9F,0xFF,0xFF,0xF8,0xCE,0x73,0xF6,0xFC,0xFF,
+0xED,0xBC,0xDB,0xF7,0xFF,0xEF,0xFC,0x02,0x03,0x28,0x7F,0xFF,0xCE,0x7E,0x07,0xFF,
+0xFF,0xF4,0x3E,0x0F,0xEE,0xFF,0x1E,0xBF,0xFF,0xCF,0xFF,0xFF,0xF1,0xC6,0xD3,0xFE,
+0xFC,0xFF,0xFD,0xBE,0xFB,0xE3,0xFF,0xFC,0xFE,0x02,0x61,0x80,0x7F,0xFF,0xE7,0xFB,
+0x07,0xFF,0xF7,0xF0,0x3E,0x0F,0xEF,0xFF,0x1F,0xFB,0xBF,0xDB,0xEF,0xFF,0xFF,0xF1,
+0xC9,0xC3,0xFF,0xFD,0xFF,0xF7,0xBE,0xFB,0xF7,0xFF,0xFC,0xFE,0x00,0x40,0x80,0x7F,
+0xFF,0xF3,0xB9,0x87,0xFF,0xF7,0xF8,0x3E,0x0F,0xEE,0xFF,0x1E,0x7F,0xFF,0xE7,0xFF,
+0xFF,0xF3,0xF9,0xE3,0xFF,0xFD,0xFF,0xFD,0xBE,0x7B,0xF3,0xFF,0xFE,0x7E,0x00,0x60,
+0x80,0x7F,0xFF,0xF9,0xDF,0x83,0xFF,0xF3,0xF8,0x3C,0x6F,0xEF,0xFF,0x1F,0xF7,0xFF,
+0xFF,0xF7,0xFF,0xFF,0xF3,0xE8,0x63,0xBF,0xFD,0xFF,0xF8,0x3F,0x7B,0xF3,0xFF,0x7F,
+0xFE,0x01,0x40,0x84,0x7F,0xFF,0xDD,0xFF,0x8B,0xFF,0xFB,0xF8,0x7C,0x77,0xEF,0xFF,
+0x1F,0xEF,0xFF,0x7F,0xF3,0xFF,0xFF,0xF7,0xE8,0x73,0xBE,0xFF,0xFF,0xFC,0x3F,0xFB,
+0xB3,0xFF,0xBD,0xBE,0x00,0x00,0x04,0x7F,0xFF,0xFF,0xF4,0xCF,0xFD,0xDB,0xF8,0x7E,
+0xFB,0xED,0xFF,0x01,0x7F,0xF9,0xFE,0xFF,0x18,0xFC,0xF3,0xBF,0xFB,0xFF,0xFE,0x3F,
+0xFF,0xF3,0xFF,0xDF,0xDE,0x00,0x07,0x80,0x7F,0xFF,0xEF,0xB0,0x47,0xFF,0xCF,0xF8,
+0x7F,0xF8,0xED,0xFF,0x1D,0x3F,0xF9,0xFF,0xFF,0xDC,0xEC,0xF1,0xBF,0x79,0xFF,0xFF,
+0x6D,0xF3,0xF1,0xFF,0xEE,0x6F,0x00,0x01,0xC0,0x7F,0xFF,0xE7,0xFC,0x03,0xFF,0xFF,
+0xB8,0xFF,0xFC,0xF0,0xFF,0x00,0xFE,0xFE,0xFF,0x1B,0xFC,0xFF,0xFF,0xF0,0x6C,0xF1,
+0xBF,0x79,0xFF,0xFF,0xEC,0x71,0xD9,0xFF,0xFB,0x3F,0x00,0xC4,0x00,0xFF,0xFF,0xB7,
+0xD8,0x03,0xFF,0xFE,0xC0,0xFE,0xEF,0xFF,0x00,0xFD,0xFE,0xFF,0x1B,0xFC,0xFF,0xFF,
+0xE0,0x6C,0xF9,0xFB,0x7B,0xFF,0xFF,0xE6,0x31,0xFC,0xFF,0xF9,0xBF,0x00,0xEC,0x10,
+0xFF,0xFF,0xF7,0xEF,0x1F,0xFF,0xFE,0xC1,0xFE,0xED,0xFF,0x1D,0xFD,0xFF,0xFE,0xFF,
+0xFF,0xC0,0x0C,0xF3,0xFB,0x7F,0xFF,0xFF,0x66,0x39,0xEE,0x7F,0xEC,0xDF,0x00,0x00,
+0x20,0xFF,0xFF,0xDF,0xE7,0x9F,0xFF,0xFB,0xC1,0xF4,0xED,0xFF,0x14,0xFB,0xFF,0xFC,
+0xFF,0xFE,0x01,0x0E,0xF3,0xFB,0xFD,0xFF,0xFF,0x67,0x39,0xF3,0x1F,0xF6,0xCF,0x80,
+0x00,0x01,0xFE,0xFF,0x05,0xE0,0x0F,0xFF,0xFF,0xE3,0xFC,0xEB,0xFF,0x12,0xFC,0x7F,
+0xF8,0x03,0x4E,0xF1,0xF9,0xBD,0xFF,0xFE,0x77,0x18,0xFF,0xFF,0xF3,0x6F,0xC0,0x21,
+0x01,0xFE,0xFF,0x05,0xF4,0x4F,0xFF,0xFF,0xE3,0xFC,0xEB,0xFF,0x1B,0xF8,0x7E,0x20,
+0x01,0x6E,0x71,0xD9,0xBC,0xFF,0xFC,0x73,0x9A,0xFF,0xFF,0xF9,0xB7,0xC1,0xA1,0x03,
+0xFF,0xFF,0x7F,0xBE,0x4F,0xFF,0xFF,0xC3,0xEC,0xEB,0xFF,0x00,0xF0,0xFE,0x00,0x17,
+0xD7,0x70,0xCD,0x9C,0xFF,0xFC,0x73,0x9B,0x7F,0xFF,0xFD,0x9B,0xE1,0xA1,0x07,0xFF,
+0xFF,0xBF,0xF6,0x0F,0xFF,0xFE,0xC7,0xEC,0xEB,0xFF,0x1B,0xF8,0x00,0x00,0x04,0x33,
+0x74,0xCD,0x9C,0xFF,0xFC,0xF3,0x9B,0x7F,0xFF,0xFC,0xDF,0xF0,0x81,0x0F,0xFF,0xFF,
+0x9F,0xE6,0x0F,0xFF,0xFF,0xC7,0xCD,0xEB,0xFF,0x1B,0xF8,0x00,0x00,0x21,0x3B,0xF4,
+0x6F,0xDE,0x7F,0xF8,0xFB,0x9B,0x3F,0xFF,0xFE,0x6F,0xF0,0x00,0x1F,0xFF,0xFF,0xEF,
+0xE7,0x1F,0xFF,0xFF,0x0F,0xCD,0xEB,0xFF,0x12,0xFC,0x00,0x00,0xF0,0x1F,0xF0,0x66,
+0xDA,0x7F,0xFD,0xFB,0xDF,0x3F,0xFF,0xF3,0x2F,0xF8,0x00,0x3F,0xFE,0xFF,0x05,0x73,
+0x1F,0xFF,0xFE,0x0E,0xCF,0xEB,0xFF,0x11,0xFC,0x00,0x07,0xF0,0x1F,0xF0,0xB6,0xCA,
+0x7F,0xFF,0xFD,0xDF,0xBF,0xFF,0xFB,0x17,0xFF,0x00,0xFE,0xFF,0x07,0x7F,0xF9,0x1F,
+0xFF,0xFC,0x8E,0xDB,0x7F,0xEC,0xFF,0x11,0xFE,0x00,0x1F,0xE7,0x0F,0xE0,0x36,0xCB,
+0x3F,0xFF,0xFC,0xDF,0x7F,0xFF,0xFC,0x7B,0xFF,0xE0,0xFD,0xFF,0x06,0xB9,0x1B,0xFF,
+0xBC,0x6E,0xFB,0x7F,0xEB,0xFF,0x10,0x3F,0xFB,0xE3,0x8F,0xE1,0x7F,0xCB,0x1F,0xFF,
+0xF3,0xDF,0x7F,0xFF,0xFE,0x7D,0xFF,0xF0,0xFE,0xFF,0x06,0xFD,0xB8,0x5F,0xFE,0xBC,
+0x7F,0xFB,0xEA,0xFF,0x10,0x7F,0xFB,0xE1,0x0F,0xC1,0x7E,0xCB,0xBF,0xBF,0xC3,0xDB,
+0x7F,0xFF,0xFE,0x3D,0xFF,0xF0,0xFE,0xFF,0x04,0x3F,0xD8,0x3F,0xFE,0xDC,0xE9,0xFF,
+0x0A,0xFE,0x7F,0xFD,0xE0,0x1F,0xC1,0x36,0xC3,0xFF,0xFD,0xDB,0xFD,0xFF,0x0D,0x37,
+0xFF,0xF0,0xFF,0xFF,0x7F,0xBF,0xD0,0x3B,0xEE,0xC8,0xFE,0xCF,0xBF,0xEC,0xFF,0x07,
+0xFE,0xFF,0xFC,0xE8,0x1F,0xC0,0x3F,0xD1,0xFE,0xFF,0x11,0xD8,0xFF,0xFF,0xF7,0xB7,
+0xFF,0xF0,0xFF,0xFF,0x7F,0x9F,0xF8,0xFB,0x7E,0x09,0xFE,0xFF,0xBF,0xEC,0xFF,0x1C,
+0xFC,0xFE,0x7E,0x48,0x3F,0xC0,0x1F,0xD1,0xF7,0xFF,0xFF,0xF9,0xFF,0xFF,0xFE,0x9F,
+0xFF,0xF0,0xFF,0xF7,0x9F,0xDF,0xF8,0x1B,0x7E,0x09,0xFE,0xF3,0xBF,0xEC,0xFF,0x1C,
+0xF9,0xFF,0xFF,0x00,0x1F,0xE0,0x06,0xD9,0xFF,0xE7,0xFF,0xFB,0xFF,0xFF,0xFE,0x1F,
+0xFF,0xF0,0xFF,0xF3,0x9F,0xFB,0x70,0x19,0x6E,0x03,0xFF,0xF3,0xBF,0xEC,0xFF,0x0B,
+0xF9,0xFF,0xFF,0xC4,0x1F,0xC0,0x07,0xB8,0xFB,0xE7,0xFF,0xB7,0xFE,0xFF,0x0C,0x0F,
+0xFF,0xF0,0xFF,0xBB,0x8F,0xFB,0x10,0x19,0x24,0x03,0xFF,0x73,0xEB,0xFF,0x09,0xFB,
+0xFF,0xE1,0xEE,0x0F,0xC0,0x0F,0xB8,0x7B,0xC7,0xFC,0xFF,0x0C,0xB7,0xFF,0xF0,0xFF,
+0x9B,0xCE,0xC9,0x08,0x09,0x20,0x03,0xFF,0x7F,0xEB,0xFF,0x09,0xF3,0x9F,0xC0,0x66,
+0x0F,0xC0,0x0D,0xF0,0x7F,0xC3,0xFC,0xFF,0x0C,0x93,0xFF,0xE1,0xFF,0x98,0xE6,0xC8,
+0x0C,0x02,0x20,0x03,0xFF,0x6F,0xEB,0xFF,0x09,0xF3,0x0F,0x80,0x36,0x07,0xE0,0x0D,
+0xF4,0x3F,0xC7,0xFC,0xFF,0x0D,0x1B,0xFF,0xE0,0xFF,0x99,0xE6,0xEC,0x0F,0x01,0x00,
+0x43,0xFF,0x6B,0xDF,0xEC,0xFF,0x09,0xF1,0x09,0x80,0x38,0x07,0xE0,0x03,0xB6,0x3F,
+0xC7,0xFC,0xFF,0x0C,0x1D,0xFF,0xE1,0xFE,0xD9,0x77,0xFC,0x0F,0x80,0x00,0x03,0xFF,
+0xE3,0xEB,0xFF,0x09,0xF8,0x01,0x80,0x38,0x07,0xE2,0x01,0xA6,0x3F,0xCF,0xFC,0xFF,
+0x0D,0x9D,0xFF,0xF1,0xFB,0xDB,0x73,0xFC,0x0F,0xC0,0x00,0x07,0xFF,0x63,0xDF,0xEC,
+0xFF,0x09,0xFC,0x01,0x80,0x30,0x07,0xE2,0x21,0x67,0x1F,0x8F,0xFC,0xFF,0x0D,0x9F,
+0xFF,0xF1,0xF9,0xD9,0xF3,0xF8,0x0F,0xC1,0x80,0x07,0xFF,0x43,0x9F,0xEC,0xFF,0x09,
+0xFC,0x01,0x90,0x32,0x0F,0xF0,0x39,0x47,0x07,0x1F,0xFC,0xFF,0x0D,0xCF,0xFF,0x71,
+0xD9,0xFD,0xB7,0xD8,0x1F,0xE1,0x80,0x07,0xFF,0xC7,0x8F,0xEC,0xFF,0x09,0xFE,0x01,
+0xB0,0x30,0x1F,0xF0,0x04,0x7F,0x00,0x1F,0xFC,0xFF,0x0D,0xCF,0xFF,0x71,0xB9,0xF7,
+0xB3,0xD8,0x3F,0xE0,0x00,0x07,0xFF,0xCF,0x8F,0xEB,0xFF,0x08,0xC0,0xF3,0x70,0x3F,
+0xF0,0x04,0x67,0x80,0x1F,0xFC,0xFF,0x0D,0xCF,0xFF,0xE1,0xBD,0xB7,0xB3,0xC8,0x3F,
+0xE0,0x00,0x0F,0x7F,0x47,0x8F,0xEB,0xFF,0x08,0xF0,0x7F,0xC0,0x3F,0xF8,0x04,0x67,
+0xC0,0x1F,0xFC,0xFF,0x0D,0xC7,0xFF,0xE1,0xBC,0xB7,0xB2,0x40,0x1F,0xE0,0x04,0x3E,
+0x7F,0x87,0xDF,0xEB,0xFF,0x08,0xFE,0x0D,0xC0,0x3F,0xF8,0x04,0x07,0xE0,0x3F,0xFC,
+0xFF,0x0D,0x05,0xFF,0xC3,0x8C,0x97,0xB0,0x60,0x1F,0xF0,0x46,0x7E,0x7F,0x87,0xD7,
+0xEA,0xFF,0x07,0x00,0xC6,0x3F,0xF8,0x04,0x03,0xF0,0x3F,0xFC,0xFF,0x0D,0x81,0xFF,
+0x83,0x8C,0x9B,0xB0,0x40,0x1F,0xF0,0x00,0x7F,0x7F,0x83,0xC7,0xEA,0xFF,0x07,0x80,
+0x0E,0x3F,0xFC,0x12,0x02,0xF8,0x7F,0xFC,0xFF,0x0D,0x87,0xFF,0x03,0x86,0x9B,0xB1,
+0x00,0x0F,0xF0,0x00,0xFF,0x7D,0x93,0xE7,0xEA,0xFF,0x07,0xC0,0x1E,0x3F,0xFE,0x12,
+0x06,0x38,0x7F,0xFC,0xFF,0x0D,0xC7,0xFF,0x06,0xC6,0x1B,0xB9,0x00,0x0F,0xF0,0x00,
+0xFE,0x7C,0x93,0xF3,0xEA,0xFF,0x07,0xE0,0x1F,0x3F,0xFF,0x12,0x04,0x38,0x7D,0xFD,
+0xFF,0x0D,0xFE,0xCB,0xFF,0x04,0x76,0x1F,0x98,0x00,0x07,0xF0,0x01,0xBE,0x7C,0x93,
+0xE9,0xFF,0x07,0xF8,0x7F,0x3F,0xFF,0x0A,0x00,0x18,0x7F,0xFC,0xFF,0x0C,0x0F,0xFC,
+0x04,0x7B,0x27,0x88,0x04,0x03,0xF0,0x01,0xFC,0x7C,0x93,0xE9,0xFF,0x07,0xFC,0x7F,
+0x3F,0xFF,0x80,0x00,0x1C,0x7F,0xFC,0xFF,0x0C,0x0F,0xFC,0x0E,0x3B,0x24,0x98,0x0C,
+0x01,0xF0,0x03,0xFC,0xD8,0x93,0xE9,0xFF,0x07,0xFC,0x7F,0x3F,0xFF,0xC0,0x40,0x1C,
+0x3F,0xFC,0xFF,0x0C,0x8F,0xEC,0x0F,0x9B,0x2C,0x58,0x00,0x00,0xF0,0x03,0x7C,0x99,
+0x91,0xE9,0xFF,0x08,0xFC,0x7F,0x1F,0xFF,0xE0,0x00,0x18,0x3F,0xDF,0xFD,0xFF,0x0C,
+0x8E,0xE0,0x19,0x18,0x6C,0x01,0x80,0x00,0x70,0x03,0xDC,0x13,0x9B,0xE9,0xFF,0x08,
+0xFC,0x6F,0x1F,0xFF,0xF0,0x00,0x00,0x37,0xDF,0xFE,0xFF,0x0D,0xFB,0x0E,0x60,0x08,
+0x10,0x6C,0x01,0xC0,0x00,0xE1,0x01,0xBC,0x03,0x9B,0xE9,0xFF,0x07,0xFC,0x6F,0x1F,
+0xFF,0xF8,0x00,0x04,0x07,0xFD,0xFF,0x0C,0xFB,0x0E,0x20,0x00,0x02,0x60,0x07,0xE0,
+0x00,0xE1,0x00,0xB0,0x83,0xE8,0xFF,0x07,0xFC,0x6F,0x1F,0xFF,0xFE,0x00,0x0C,0x03,
+0xFC,0xFF,0x0D,0x06,0x00,0x0C,0x92,0x40,0x0F,0xE0,0x00,0xC1,0x80,0xB1,0xA2,0xFD,
+0xBF,0xEA,0xFF,0x07,0xFC,0x7F,0x1F,0xFF,0xFF,0x00,0x08,0x03,0xFC,0xFF,0x0C,0x07,
+0x00,0x0C,0x93,0xC0,0x1F,0xF0,0x00,0xC8,0x81,0xF1,0x26,0x3F,0xE9,0xFF,0x07,0xFC,
+0x6F,0x1F,0xFF,0xFF,0x80,0x08,0x03,0xFC,0xFF,0x0C,0x07,0x00,0x6C,0xC1,0x00,0x7F,
+0xF0,0x00,0xC8,0x81,0xF3,0x07,0x3F,0xE9,0xFF,0x07,0xFC,0x6F,0x1F,0xFF,0xFF,0x80,
+0x08,0x23,0xFD,0xFF,0x0D,0xFE,0x07,0x00,0x6C,0x80,0x00,0xFF,0xF8,0x01,0xC8,0x01,
+0xE3,0x07,0x3F,0xE9,0xFF,0x08,0xFC,0x6F,0x1F,0xFF,0xFF,0xE0,0x00,0x01,0xBF,0xFE,
+0xFF,0x0D,0xFE,0x67,0x00,0x60,0x00,0x01,0xFF,0xF8,0x01,0xC8,0x01,0xE7,0x2F,0x3F,
+0xE9,0xFF,0x08,0xFC,0x6F,0x1F,0xFF,0xFF,0xF0,0x00,0x01,0xCF,0xFE,0xFF,0x0D,0xF8,
+0x02,0x01,0x20,0x00,0x0F,0xFF,0xF8,0x00,0xE0,0x07,0xC3,0x2F,0x9F,0xE9,0xFF,0x08,
+0xFC,0x6F,0x0F,0xFF,0xFF,0xF8,0x08,0x00,0xED,0xFE,0xFF,0x0D,0xE0,0x8B,0x03,0x03,
+0x00,0x1F,0xFF,0xFC,0x00,0xE0,0x07,0xE7,0x0F,0x9F,0xE9,0xFF,0x08,0xFC,0x6F,0x8F,
+0xFF,0xFF,0xFC,0x00,0x00,0x71,0xFE,0xFF,0x0D,0x61,0x8C,0x07,0x03,0x00,0x7F,0xFF,
+0xFC,0x01,0xE0,0x06,0xF6,0x4F,0x9F,0xE9,0xFF,0x02,0xFC,0x4F,0x8F,0xFE,0xFF,0x13,
+0x00,0x00,0x71,0xBF,0xFF,0xFF,0xE1,0x8C,0x07,0x82,0x00,0xFF,0xFF,0xFE,0x01,0xE0,
+0x04,0xC6,0x4F,0xCF,0xE9,0xFF,0x02,0xFC,0x6F,0x8F,0xFE,0xFF,0x13,0x00,0x0C,0x39,
+0xBF,0xFF,0xFF,0x00,0x00,0x0F,0x80,0x03,0xFF,0xFF,0xFE,0x03,0xF0,0x0E,0xC6,0x4F,
+0xEF,0xE9,0xFF,0x02,0xFC,0x6F,0x8F,0xFE,0xFF,0x13,0x80,0x0E,0x09,0x2F,0xFF,0xFF,
+0x00,0x00,0x1B,0x00,0x07,0xFF,0xFF,0xFE,0x03,0xF0,0x0F,0xC6,0x4F,0xF7,0xE9,0xFF,
+0x02,0xFC,0x7F,0x8F,0xFE,0xFF,0x12,0x80,0x06,0x00,0x06,0xFF,0xFF,0x00,0x00,0x1B,
+0x00,0x1F,0xFF,0xFF,0xFE,0x03,0xF0,0x0F,0xC6,0xEF,0xE8,0xFF,0x02,0xFC,0x7F,0x8F,
+0xFE,0xFF,0x12,0xC2,0x03,0x02,0x37,0xFF,0xF8,0x04,0x00,0x26,0x00,0x7F,0xFF,0xFF,
+0xFE,0x03,0xF0,0x0F,0xCE,0xEF,0xE8,0xFF,0x02,0xFC,0x7F,0x8F,0xFE,0xFF,0x09,0xC0,
+0x00,0x03,0x3D,0xFB,0x38,0x02,0x03,0x00,0x0F,0xFE,0xFF,0x05,0xFE,0x03,0xF8,0x0F,
+0xCE,0xEF,0xE8,0xFF,0x02,0xFC,0x7F,0x8F,0xFE,0xFF,0x08,0xC0,0x00,0x03,0x84,0xBB,
+0x18,0x00,0x00,0x01,0xFD,0xFF,0x05,0xFE,0x03,0xF8,0x0F,0x6E,0xEF,0xE8,0xFF,0x02,
+0xFC,0x7F,0x87,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x04,0x17,0x80,0x00,0x00,0x0F,0xFD,
+0xFF,0x05,0xFE,0x07,0xF8,0x9F,0x6F,0xEF,0xE8,0xFF,0x02,0xFC,0x7F,0x87,0xFE,0xFF,
+0x00,0xC0,0xFE,0x00,0x03,0x7F,0xC0,0x00,0x01,0xFC,0xFF,0x05,0xFE,0x07,0xF8,0x9F,
+0xFE,0xEF,0xE8,0xFF,0x02,0xFC,0x7F,0x87,0xFE,0xFF,0x00,0xE0,0xFE,0x00,0x02,0x7B,
+0xC0,0x0F,0xFB,0xFF,0x05,0xFE,0x07,0xF8,0x9F,0xFE,0x67,0xE8,0xFF,0x02,0xFC,0x7F,
+0x87,0xFE,0xFF,0x06,0xE0,0x00,0x00,0x80,0x5F,0xE2,0x7F,0xFB,0xFF,0x05,0xFE,0x07,
+0xF8,0x9F,0xFE,0x67,0xE8,0xFF,0x02,0xFC,0x7F,0x87,0xFE,0xFF,0x06,0xE0,0x00,0x00,
+0xF0,0x7F,0xE2,0x7F,0xFB,0xFF,0x05,0xFE,0x07,0xF8,0x9F,0xFE,0x67,0xE8,0xFF,0x02,
+0xFC,0x7F,0x87,0xFE,0xFF,0x06,0xF0,0x00,0x01,0xFE,0x7F,0xE0,0x7F,0xFB,0xFF,0x05,
+0xFE,0x07,0xF9,0x9F,0xFE,0x77,0xE8,0xFF,0x02,0xFE,0x7F,0x87,0xFE,0xFF,0x06,0xF8,
+0x03,0x01,0xFE,0x3F,0xF8,0x7F,0xFB,0xFF,0x05,0xFE,0x07,0xF9,0x9F,0xFE,0x77,0xE8,
+0xFF,0x02,0xFE,0x7F,0x87,0xFE,0xFF,0x06,0xF8,0x03,0x00,0x20,0x3F,0xFC,0x7F,0xFB,
+0xFF,0x05,0xFE,0x07,0xF9,0x9F,0xFF,0x7B,0xE8,0xFF,0x02,0xFE,0x7F,0x87,0xFE,0xFF,
+0x06,0xFC,0x03,0xC0,0x00,0x3F,0xFC,0x7F,0xFB,0xFF,0x05,0xFE,0x07,0xF8,0x9F,0xFF,
+0x7F,0xE8,0xFF,0x02,0xFE,0x7F,0x87,0xFE,0xFF,0x06,0xFE,0x00,0xC3,0x83,0x1F,0xE4,
+0x7F,0xFB,0xFF,0x03,0xFE,0x03,0xF8,0xDF,0xE6,0xFF,0x02,0xFE,0x7F,0x87,0xFD,0xFF,
+0x05,0x30,0x83,0xFF,0x9F,0xF6,0x7F,0xFB,0xFF,0x03,0xFC,0x03,0xF0,0xDF,0xE6,0xFF,
+0x02,0xFE,0x7F,0x87,0xFD,0xFF,0x05,0x00,0x83,0xFF,0x8F,0xFC,0x7F,0xFB,0xFF,0x03,
+0xFC,0x03,0xF0,0xCF,0xE6,0xFF,0x02,0xFE,0x7F,0x87,0xFD,0xFF,0x05,0x8C,0x83,0xFF,
+0xCF,0xFC,0x7F,0xFB,0xFF,0x03,0xFC,0x03,0xF1,0xCF,0xE6,0xFF,0x02,0xFE,0x7F,0x87,
+0xFD,0xFF,0x04,0x85,0x03,0xFF,0xCD,0xD8,0xFA,0xFF,0x03,0xF8,0x03,0xE3,0xCF,0xE9,
+0xFF,0x05,0xF3,0xFF,0xFF,0xFE,0x7F,0x87,0xFD,0xFF,0x04,0xC3,0x03,0xFF,0xE7,0xF0,
+0xFA,0xFF,0x03,0xF1,0x03,0xE3,0xCF,0xE9,0xFF,0x05,0x77,0x6F,0xFF,0xFE,0x7F,0x87,
+0xFD,0xFF,0x04,0xE3,0x07,0xFF,0xE6,0x60,0xFA,0xFF,0x03,0xF3,0x01,0xE2,0xCF,0xE9,
+0xFF,0x05,0x76,0xFF,0xFF,0xFA,0x7F,0x87,0xFD,0xFF,0x04,0xE2,0x43,0xFF,0xE6,0x63,
+0xFA,0xFF,0x03,0xE3,0x83,0xC7,0xEF,0xEA,0xFF,0x06,0xF9,0xFF,0xFB,0xFF,0xFA,0x3F,
+0x87,0xFD,0xFF,0x04,0xE0,0x43,0xFF,0xF6,0x33,0xFA,0xFF,0x03,0xC1,0x83,0xC7,0xE7,
+0xE6,0xFF,0x02,0xCE,0x3F,0x83,0xFD,0xFF,0x04,0xF0,0x03,0xFF,0xF6,0x23,0xFA,0xFF,
+0x03,0xC9,0x81,0xCF,0xE7,0xEC,0xFF,0x02,0xFB,0xFF,0xDF,0xFE,0xFF,0x03,0xEE,0x3F,
+0x81,0xBF,0xFE,0xFF,0x04,0xF8,0x03,0xFF,0xF6,0x43,0xFB,0xFF,0x04,0xBF,0x85,0x81,
+0xC3,0xE3,0xE6,0xFF,0x03,0xFE,0x7F,0x83,0xEF,0xFE,0xFF,0x04,0xF8,0x19,0xFF,0xF6,
+0x63,0xFC,0xFF,0x05,0xF7,0x3F,0x87,0x81,0xC3,0x07,0xE6,0xFF,0x0B,0xBE,0x7C,0x83,
+0x7F,0xFD,0xFF,0xFF,0xF8,0x19,0xFF,0xF6,0x23,0xFC,0xFF,0x05,0xF7,0x3F,0x80,0x00,
+0x40,0x07,0xE6,0xFF,0x0B,0xBE,0x19,0x03,0xFF,0xED,0xFF,0xFF,0xF8,0x18,0xFF,0xF6,
+0x03,0xFC,0xFF,0x05,0xF7,0xFE,0x00,0x03,0xC4,0x47,0xE6,0xFF,0x02,0xFE,0x7F,0x83,
+0xFD,0xFF,0x04,0xF8,0x08,0x7F,0xE6,0x63,0xFC,0xFF,0x05,0xFB,0xFC,0x00,0x07,0x86,
+0x0F,0xE6,0xFF,0x02,0xFE,0x3F,0x83,0xFD,0xFF,0x04,0xF8,0x06,0x7F,0xC2,0x23,0xFC,
+0xFF,0x05,0xFB,0xFC,0x00,0x07,0x37,0x8F,0xE9,0xFF,0x05,0x7F,0xFF,0xFF,0x7E,0x3F,
+0xC7,0xFD,0xFF,0x04,0xF8,0x06,0x7F,0xC0,0x13,0xFC,0xFF,0x05,0xFB,0xFC,0x00,0x0F,
+0x24,0xF7,0xE9,0xFF,0x05,0x7F,0xFF,0xFF,0xFE,0x3F,0xC7,0xFD,0xFF,0x04,0xF8,0x06,
+0x7F,0xC6,0x13,0xFC,0xFF,0x05,0xF9,0xFC,0x00,0x0E,0x00,0x37,0xEA,0xFF,0x00,0xF4,
+0xFE,0xFF,0x02,0xFE,0x3F,0xC3,0xFD,0xFF,0x04,0xF8,0x00,0x7F,0xC6,0x01,0xFC,0xFF,
+0x05,0xFD,0xB8,0x00,0x0F,0x00,0x07,0xE7,0xFF,0x03,0xF7,0xFE,0x3F,0xC7,0xFD,0xFF,
+0x04,0xFC,0x10,0x7F,0xC0,0x01,0xFC,0xFF,0x06,0xEC,0xF8,0x00,0x1F,0x00,0x0F,0xFE,
+0xF1,0xFF,0x0C,0xC0,0x7F,0xFF,0x80,0x7F,0xFF,0xDF,0xFF,0xFF,0xE7,0xFE,0x3F,0x87,
+0xFD,0xFF,0x04,0xFC,0x00,0x7F,0xC0,0x01,0xFC,0xFF,0x06,0xE4,0xF0,0x01,0xBE,0x00,
+0xC7,0xDD,0xF1,0xFF,0x04,0xCE,0x1F,0xFC,0x78,0x3F,0xFD,0xFF,0x0C,0xEF,0xFE,0x3F,
+0x87,0xFF,0xFB,0xFF,0xFF,0xFC,0x00,0x7F,0xC0,0x01,0xFC,0xFF,0x06,0xF0,0x13,0xFF,
+0xFE,0x00,0x01,0x99,0xF1,0xFF,0x04,0xCF,0xE1,0xFF,0xFC,0x3F,0xFC,0xFF,0x0B,0xFE,
+0x3F,0x87,0xFF,0xE7,0xF9,0xFF,0xFC,0x00,0xFF,0xC0,0x01,0xFC,0xFF,0x06,0xF0,0x1B,
+0xF0,0xFC,0x00,0x01,0xB9,0xF1,0xFF,0x04,0xE1,0xFD,0x0F,0xF1,0xBF,0xFC,0xFF,0x0B,
+0xFE,0x3F,0x87,0xFF,0xEF,0xFB,0xCF,0xFE,0x02,0xFF,0xE0,0x01,0xFC,0xFF,0x06,0xFC,
+0x1E,0x07,0xDC,0x00,0x07,0xB7,0xF1,0xFF,0x04,0xFE,0x3F,0x97,0x1F,0xBF,0xFC,0xFF,
+0x02,0xFE,0x3F,0x83,0xFE,0xFF,0x05,0xCF,0xFE,0x00,0xFF,0xF0,0x01,0xFC,0xFF,0x06,
+0xF6,0x7F,0xFD,0xBE,0x00,0x07,0x7F,0xF0,0xFF,0x03,0xC7,0xFE,0x1F,0x3F,0xFC,0xFF,
+0x02,0xFE,0x3F,0x83,0xFD,0xFF,0x04,0xFE,0x00,0xFF,0xF0,0x01,0xFC,0xFF,0x06,0xF6,
+0xFF,0xFF,0xBE,0x00,0x7F,0x3F,0xF0,0xFF,0x03,0xC4,0x1F,0xE1,0x3F,0xFC,0xFF,0x02,
+0xFE,0x3F,0x83,0xFD,0xFF,0x04,0xFE,0x00,0xFF,0xF0,0x01,0xFC,0xFF,0x00,0xF9,0xFD,
+0xFF,0x01,0xFE,0x3F,0xF1,0xFF,0x04,0xFE,0x7E,0x03,0xFF,0x1F,0xFC,0xFF,0x0B,0xFE,
+0x3F,0x83,0xFF,0xFF,0xFC,0xFF,0xFF,0x00,0xFF,0xF0,0x01,0xFD,0xFF,0x01,0xEF,0x79,
+0xFD,0xFF,0x01,0xFE,0x7F,0xF1,0xFF,0x04,0xFB,0xFC,0x1F,0x3F,0xF8,0xFC,0xFF,0x0B,
+0xFE,0x3F,0x83,0xFF,0xFF,0xF8,0xFF,0xFF,0x01,0xFF,0xF8,0x01,0xFD,0xFF,0x04,0xF7,
+0x7F,0xFF,0xFB,0xDF,0xFD,0xFF,0x00,0xF9,0xF2,0xFF,0x04,0xF8,0x3F,0xF3,0xFF,0x8F,
+0xFD,0xFF,0x02,0xFE,0x3F,0x83,0xFC,0xFF,0x03,0x01,0xFF,0xF8,0x03,0xFD,0xFF,0x04,
+0xF7,0xBF,0xFF,0xFB,0x7F,0xEF,0xFF,0x06,0xFC,0x3F,0xFE,0x3F,0xFE,0x7F,0xF0,0xFD,
+0xFF,0x02,0xFE,0x3F,0x83,0xFC,0xFF,0x03,0x01,0xFF,0xF8,0x07,0xFC,0xFF,0x02,0xDF,
+0x7F,0xFB,0xEE,0xFF,0x07,0xF8,0x01,0xFC,0x7F,0xFF,0xCF,0xFF,0x0F,0xFE,0xFF,0x02,
+0xFE,0x3F,0x83,0xFC,0xFF,0x03,0x01,0xFF,0xFC,0x07,0xFC,0xFF,0x02,0xFE,0x77,0xBF,
+0xEE,0xFF,0x0D,0xFD,0xE1,0xFC,0xFF,0xFF,0xFC,0xFF,0xF0,0x7F,0xFF,0xFF,0xFE,0x3F,
+0x83,0xFC,0xFF,0x03,0x01,0xFF,0xFC,0x4F,0xFC,0xFF,0x02,0xF2,0xE7,0x9F,0xEE,0xFF,
+0x01,0xFD,0xFB,0xFD,0xFF,0x07,0xC7,0xFE,0x07,0xFF,0xFF,0xFE,0x1F,0x83,0xFC,0xFF,
+0x03,0x10,0xFF,0xFC,0x4F,0xFC,0xFF,0x02,0xA6,0xCF,0x9F,0xEE,0xFF,0x0D,0xFD,0xFB,
+0xFF,0xFB,0xFF,0xFF,0xFC,0x7F,0xF0,0xFF,0xFF,0xFE,0x1F,0xC3,0xFC,0xFF,0x03,0x00,
+0xFF,0xFC,0x0F,0xFC,0xFF,0x01,0xAC,0xB7,0xED,0xFF,0x03,0xFD,0xFB,0xFF,0xF9,0xFE,
+0xFF,0x06,0xC1,0xFE,0x0F,0xFF,0xFE,0x1F,0xC3,0xFC,0xFF,0x03,0x00,0xFF,0xFC,0x0F,
+0xFD,0xFF,0x02,0x7F,0xAD,0xB7,0xEE,0xFF,0x04,0xFE,0x7D,0xFB,0xFF,0xD9,0xFE,0xFF,
+0x06,0xFC,0x3F,0xE0,0xFF,0xFE,0x1F,0xC3,0xFC,0xFF,0x03,0x20,0xFF,0xFC,0x07,0xFE,
+0xFF,0x05,0xF7,0xFF,0xA9,0x7F,0xFF,0xFD,0xEF,0xFF,0x03,0x39,0xFB,0xFF,0xCF,0xFD,
+0xFF,0x05,0x83,0xFE,0x1F,0xFE,0x1F,0xC7,0xFD,0xFF,0x0D,0xFE,0x20,0x7F,0xFC,0x67,
+0xFF,0xFF,0xFB,0x7F,0xFE,0x33,0x6F,0xFF,0xFC,0xEF,0xFF,0x01,0xD9,0xFB,0xFB,0xFF,
+0x05,0xF8,0x3F,0xC0,0xFE,0x1F,0xC7,0xFD,0xFF,0x0D,0xFE,0x10,0x7F,0xFC,0x67,0xFF,
+0xFF,0xFB,0x3F,0x7C,0x33,0xFF,0xFF,0xFC,0xF0,0xFF,0x03,0xFB,0xE1,0xFF,0xEF,0xFB,
+0xFF,0x04,0x83,0xFC,0x1E,0x1F,0xC7,0xFD,0xFF,0x0E,0xFE,0x18,0x7F,0xFC,0xE7,0xFF,
+0xDF,0xDF,0x3C,0xFF,0x7F,0xF7,0xFF,0xFF,0x3F,0xF1,0xFF,0x03,0xFC,0xF0,0xFF,0xCF,
+0xFB,0xFF,0x04,0xF8,0x7F,0xC0,0x1F,0xC3,0xFD,0xFF,0x0A,0xFE,0x48,0x7F,0xFC,0xE3,
+0xFF,0xFF,0xDF,0xE0,0xFF,0x7F,0xED,0xFF,0x03,0xFE,0xFD,0xFC,0x3F,0xFA,0xFF,0x03,
+0x07,0xFC,0x1F,0xC3,0xFD,0xFF,0x08,0xFC,0x6C,0x7F,0xFC,0xF3,0x77,0xFE,0x9B,0x61,
+0xFD,0xFF,0x00,0x7F,0xEE,0xFF,0x01,0xC8,0x7F,0xFA,0xFF,0x03,0xF0,0x7E,0x03,0xC3,
+0xFD,0xFF,0x08,0xF8,0x24,0x7F,0xFC,0xF3,0xC7,0xFE,0x53,0x69,0xE9,0xFF,0x00,0xE9,
+0xFE,0xFF,0x00,0x83,0xFC,0xFF,0x02,0x06,0x18,0x03,0xFD,0xFF,0x09,0xF9,0xB6,0x7F,
+0xFD,0xFB,0xC7,0xFE,0xC3,0x4B,0xF9,0xE7,0xFF,0x01,0xFE,0x01,0xFC,0xFF,0x02,0xE0,
+0x1F,0x83,0xFD,0xFF,0x0A,0xF9,0x92,0x7F,0x7D,0xF9,0x87,0xFE,0xD7,0xDB,0xF0,0x7F,
+0xE8,0xFF,0x02,0xF0,0x00,0x3F,0xFD,0xFF,0x03,0xFE,0x0F,0xC0,0x3F,0xFE,0xFF,0x09,
+0xF8,0x48,0x76,0xF9,0xF9,0x86,0xDF,0xDF,0x3F,0xE4,0xE7,0xFF,0x02,0xC0,0x00,0x1F,
+0xFD,0xFF,0x03,0xFE,0x10,0x03,0x83,0xFE,0xFF,0x09,0xF8,0x20,0xE0,0x3B,0xF9,0xB4,
+0x3F,0xCE,0x0F,0xED,0xE7,0xFF,0x02,0x00,0x00,0x07,0xFD,0xFF,0x10,0xFE,0x1E,0x03,
+0xF0,0x7F,0xFF,0xF7,0xF8,0x31,0xE0,0x7B,0xF9,0xB0,0xFF,0xC8,0x1F,0xEF,0xFD,0xFF,
+0x00,0xE3,0xED,0xFF,0x03,0xFE,0x00,0x00,0x03,0xFD,0xFF,0x0E,0xFE,0x1F,0xC0,0xFE,
+0x03,0xFF,0xF7,0xE3,0xB9,0xE6,0x77,0xF9,0x30,0xEE,0xC9,0xFB,0xFF,0x00,0xE7,0xED,
+0xFF,0x03,0xFC,0x00,0x00,0x01,0xFC,0xFF,0x0E,0x3F,0xC0,0x1F,0xE0,0x3F,0x77,0xEF,
+0xFA,0x66,0x07,0xF8,0x61,0xAC,0xC2,0x7F,0xE8,0xFF,0x00,0xF0,0xFD,0x00,0xFC,0xFF,
+0x0D,0x3F,0xC3,0xC1,0xFF,0x07,0x27,0xC7,0xFB,0xF6,0x27,0xF8,0x65,0x2C,0x4C,0xE7,
+0xFF,0x00,0xC0,0xFD,0x00,0xFD,0xFF,0x0F,0xFD,0x31,0xC3,0xFC,0x1F,0xF0,0x27,0xC1,
+0xF9,0xE7,0x67,0xF8,0x3B,0x4C,0x0D,0xFE,0xFE,0xFF,0x00,0xCF,0xEF,0xFF,0x03,0xFB,
+0xFF,0xFF,0xC0,0xFD,0x00,0x00,0x7F,0xFE,0xFF,0x0E,0xF3,0xFC,0xC7,0xFF,0xC1,0xFE,
+0x03,0xC0,0x39,0xC3,0xE3,0xF9,0x32,0x1C,0x0F,0xFD,0xFF,0x00,0xCF,0xEC,0xFF,0x00,
+0xE0,0xFD,0x00,0x00,0x3F,0xFE,0xFF,0x0E,0xCF,0xF8,0xE7,0xFF,0xFC,0x1F,0xF0,0x00,
+0x01,0x83,0xE3,0xF0,0x74,0xBC,0xDF,0xEA,0xFF,0x03,0xF7,0xFF,0xFF,0xE0,0xFD,0x00,
+0x00,0x1F,0xFE,0xFF,0x0D,0x3E,0x00,0xE7,0xFF,0xFF,0x83,0xFF,0x00,0x01,0xF3,0xF3,
+0xC3,0xFC,0xE4,0xE9,0xFF,0x03,0xF7,0xFF,0xFF,0xF0,0xFD,0x00,0x11,0x1F,0xFF,0xFF,
+0xFC,0xF8,0x00,0xC0,0x07,0xFF,0xF8,0x7F,0xF0,0x07,0xFF,0xE7,0xC7,0xED,0xE3,0xE9,
+0xFF,0x03,0xB6,0xFF,0xFF,0xF8,0xFD,0x00,0x11,0x1F,0xFF,0xFF,0xF9,0xE0,0x03,0xC0,
+0xFD,0xFF,0xFC,0x01,0xFF,0x03,0xFF,0xBF,0xDF,0x27,0xE7,0xEB,0xFF,0x05,0xF7,0x7C,
+0xEC,0x3F,0xFF,0xFC,0xFD,0x00,0x11,0x1F,0xFF,0xFF,0xF9,0x80,0x7F,0x8F,0xFE,0x7F,
+0xFE,0xD0,0x1F,0xE4,0x1F,0x3F,0xEF,0xA6,0x7F,0xEB,0xFF,0x1A,0xE7,0x7C,0xCC,0x7F,
+0xFF,0xFE,0x01,0xF8,0x00,0x00,0x0F,0xFF,0xFF,0xF8,0x00,0xFC,0x0F,0xC2,0x3F,0xFE,
+0x58,0x01,0xFF,0x03,0x3F,0xE3,0xCC,0xEA,0xFF,0x1A,0xE3,0x7C,0x0D,0xFF,0xFF,0xFC,
+0x03,0xFF,0x00,0x00,0x0F,0xFF,0xFF,0xF8,0x00,0xF0,0x08,0x00,0x3F,0xF7,0x6C,0x00,
+0x1F,0xF0,0x00,0x71,0xE9,0xEA,0xFF,0x1A,0xF3,0x7E,0x79,0xF3,0xFF,0xE0,0x0F,0xFF,
+0x80,0x00,0x0F,0xFF,0xFF,0xFC,0x00,0xF3,0x80,0x00,0x3F,0xFB,0xFF,0x01,0xE1,0xFF,
+0x80,0x01,0xF9,0xEA,0xFF,0x12,0xBB,0x3F,0xFF,0xE7,0xFF,0xC2,0x1F,0xFF,0xE0,0x00,
+0x0F,0xFF,0xFF,0xFC,0x1E,0x63,0x80,0x00,0x7F,0xFE,0xFF,0x03,0xFE,0x3F,0xF8,0x03,
+0xE9,0xFF,0x10,0xBD,0xFF,0xFF,0xEF,0xFF,0xFC,0x3E,0x9F,0xF8,0x00,0x07,0xFF,0xFF,
+0xFC,0x7F,0x20,0x01,0xFB,0xFF,0x02,0xE1,0xFF,0xC3,0xF9,0xFF,0x00,0xF3,0xF2,0xFF,
+0x0A,0xFD,0xFF,0xFF,0xDF,0xFF,0x9C,0x3E,0x1F,0xFC,0x00,0x07,0xFE,0xFF,0x04,0x07,
+0xB0,0x03,0xFF,0xFD,0xFD,0xFF,0x03,0xF8,0x1F,0xF8,0x7F,0xEA,0xFF,0x00,0xF7,0xFD,
+0xFF,0x05,0x00,0x3E,0x3F,0xFE,0x00,0x07,0xFE,0xFF,0x02,0x0F,0xC0,0x03,0xFB,0xFF,
+0x03,0xF8,0x00,0xFF,0x83,0xE6,0xFF,0x06,0xFC,0x0F,0x80,0x3F,0xBF,0x00,0x07,0xFE,
+0xFF,0x02,0x1F,0xC0,0x3B,0xFC,0xFF,0x05,0xF7,0xF8,0x00,0x0F,0xF8,0x3F,0xE7,0xFF,
+0x06,0xFC,0x5F,0x80,0x1F,0x3F,0x00,0x07,0xFE,0xFF,0x02,0x9F,0xE1,0xF9,0xFC,0xFF,
+0x05,0xF6,0xFE,0x00,0x01,0xFF,0x83,0xEA,0xFF,0x00,0x9F,0xFD,0xFF,0x04,0xF0,0x86,
+0x7F,0x00,0x07,0xFE,0xFF,0x02,0xCF,0xF1,0xD9,0xFC,0xFF,0x06,0xF7,0xDF,0x00,0x7E,
+0x1F,0xF8,0x7F,0xEB,0xFF,0x00,0x9F,0xFD,0xFF,0x04,0x79,0xC0,0xFF,0x00,0x07,0xFE,
+0xFF,0x02,0xC7,0xFB,0xFC,0xFD,0xFF,0x01,0xFB,0xBF,0xFE,0xFF,0x02,0xE0,0xFF,0x83,
+0xE7,0xFF,0x0B,0xED,0x07,0x81,0xFF,0x80,0x07,0x7F,0xFF,0xFF,0xE3,0xF9,0xFC,0xFD,
+0xFF,0x01,0xBB,0x3F,0xFE,0xFF,0x07,0xFE,0x03,0xF8,0x1F,0xFF,0xFF,0xF8,0x3F,0xED,
+0xFF,0x06,0xEF,0xEC,0x3F,0xA1,0xFF,0x80,0x04,0xFE,0xFF,0x03,0xF3,0xFC,0xFE,0x7F,
+0xFE,0xFF,0x0D,0xB3,0x0F,0xFF,0xFF,0x0F,0xFF,0xF0,0x7F,0x83,0xFF,0xFF,0xF0,0x00,
+0x7F,0xED,0xFF,0x05,0xFE,0x7F,0xF9,0xFF,0x83,0x01,0xFE,0xFF,0x03,0xFB,0xFE,0x7E,
+0x7F,0xFE,0xFF,0x0D,0xB2,0xCF,0xFF,0xFF,0x0F,0xFF,0xFF,0x03,0xF8,0x3F,0xFF,0xC7,
+0xF8,0x7F,0xEC,0xFF,0x0B,0x3D,0xB9,0xFF,0x93,0xFF,0xFF,0xC0,0x01,0x79,0xBE,0x7F,
+0x3F,0xFE,0xFF,0x0C,0xDA,0xDF,0xFF,0xFE,0x4F,0xFF,0xFF,0xF0,0x1F,0x87,0xFE,0x1F,
+0xF8,0xEB,0xFF,0x0B,0xE6,0xB9,0xFF,0x0C,0x7C,0x7E,0x3F,0xE0,0x00,0x37,0x3F,0x9F,
+0xFE,0xFF,0x04,0xC9,0xDF,0xFF,0xFE,0xCF,0xFE,0xFF,0x05,0x03,0xFC,0x18,0xFF,0xE2,
+0x7F,0xED,0xFF,0x14,0xFB,0xC1,0x83,0xFF,0x0E,0x00,0x7C,0xFF,0xC1,0x0E,0x7F,0x3F,
+0x9F,0xFF,0xFF,0xFE,0xFC,0xCE,0xFF,0xF7,0xCF,0xFE,0xFF,0x05,0xF8,0x3F,0x81,0xFF,
+0x1F,0x7F,0xED,0xFF,0x0C,0xFB,0xDD,0xE7,0xFF,0x07,0x03,0xFB,0xFF,0x3F,0xD1,0xBF,
+0x1F,0xCF,0xFE,0xFF,0x04,0x3C,0xCE,0xFF,0xFE,0x9F,0xFD,0xFF,0x04,0x03,0xFC,0x1C,
+0x3E,0x3F,0xED,0xFF,0x0C,0xFB,0xDF,0xFF,0xFF,0x19,0x87,0xF7,0xFF,0xFF,0xF0,0xFB,
+0x1F,0xE7,0xFD,0xFF,0x02,0xCF,0xFF,0xBF,0xFC,0xFF,0x04,0xF0,0x3F,0x80,0x66,0x3F,
+0xED,0xFF,0x0F,0xFB,0xFF,0xFF,0xFE,0x36,0x40,0x6F,0xFF,0xFF,0xFE,0x38,0x4F,0xF3,
+0xFF,0xFF,0xF9,0xFE,0xFF,0x00,0xBF,0xFC,0xFF,0x04,0xF0,0xC3,0xFC,0x07,0x7F,0xED,
+0xFF,0x06,0xFB,0xFF,0xFF,0xFE,0x73,0xF8,0xEF,0xFE,0xFF,0x05,0x8F,0xCF,0xF1,0xFF,
+0xFF,0xFD,0xF8,0xFF,0x04,0xC3,0xF8,0x3F,0xC0,0x7F,0xED,0xFF,0x06,0xFB,0xFF,0xFF,
+0xFC,0x40,0xFF,0x4F,0xFE,0xFF,0x02,0xE3,0xC4,0xF9,0xF5,0xFF,0x04,0x9F,0xFC,0x03,
+0xFC,0x0F,0xED,0xFF,0x0C,0xFB,0xCF,0xFF,0xFC,0x86,0x06,0x07,0x3F,0xFF,0xFF,0xF8,
+0x08,0x1C,0xF6,0xFF,0x05,0xFE,0x7F,0xF0,0x20,0x3F,0xE3,0xEC,0xFF,0x06,0xC7,0xFF,
+0xFF,0x83,0x07,0xFF,0x5F,0xFE,0xFF,0x01,0x3F,0x1C,0xF6,0xFF,0x06,0xF8,0xFF,0xE0,
+0x01,0xE3,0xFF,0xCF,0xEF,0xFF,0x06,0x80,0xFB,0xE3,0xFF,0xFF,0x80,0x8F,0xFB,0xFF,
+0x01,0x9E,0x37,0xF7,0xFF,0x06,0xC3,0xFF,0x84,0x0F,0xF8,0x1F,0xCF,0xF0,0xFF,0x09,
+0xFE,0x00,0x79,0xE3,0xFF,0xFF,0x84,0x07,0xFF,0xFC,0xFD,0xFF,0x01,0xDC,0x77,0xF7,
+0xFF,0x06,0x83,0xFF,0x3C,0x7F,0xFF,0x83,0xEF,0xF0,0xFF,0x0A,0xFE,0x64,0x7D,0xE3,
+0xFF,0xFF,0x06,0x07,0xFF,0xF6,0x7F,0xFE,0xFF,0x00,0xFC,0xF6,0xFF,0x06,0x80,0x38,
+0xF0,0x7E,0x7F,0xF0,0x4F,0xF0,0xFF,0x0E,0xFE,0x44,0x3D,0xC1,0xFF,0xFE,0x19,0x0F,
+0xFF,0xFB,0x7F,0xFF,0xFF,0xFB,0xF9,0xF6,0xFF,0x06,0xCE,0x01,0xE0,0xF8,0xEF,0xFF,
+0x1F,0xF0,0xFF,0x0E,0xFC,0xCC,0x3D,0xC1,0xFF,0xFC,0x39,0xFF,0xFF,0xFD,0xBF,0xFF,
+0xFF,0xF3,0x83,0xF6,0xFF,0x04,0xCF,0xC7,0x81,0xE1,0xCF,0xEE,0xFF,0x05,0xFC,0x86,
+0x1C,0xC1,0xFF,0xFC,0xFD,0xFF,0x04,0x9F,0xFF,0xFF,0xE3,0x01,0xF6,0xFF,0x04,0xCF,
+0xEF,0x00,0xA7,0x8F,0xEE,0xFF,0x0E,0xFC,0x16,0x0E,0xF1,0xFF,0xF9,0xBF,0xFF,0xFF,
+0xFE,0xDF,0xFF,0xFF,0xE0,0x33,0xF6,0xFF,0x04,0xCF,0xEE,0x30,0x3B,0x9F,0xEE,0xFF,
+0x06,0xFC,0x73,0xCE,0x7B,0xFF,0xF3,0x7D,0xFE,0xFF,0x03,0xCF,0xFF,0xFF,0xC0,0xF5,
+0xFF,0x04,0xCF,0xEC,0x30,0xDB,0xFB,0xEE,0xFF,0x06,0xFC,0x8F,0xC6,0x3F,0xFF,0xCE,
+0x7B,0xFE,0xFF,0x03,0x4F,0xFF,0xFF,0xC3,0xF8,0xFF,0x06,0xFE,0xFF,0xFF,0xCF,0xEC,
+0x01,0x8F,0xED,0xFF,0x06,0xFC,0x8F,0xD1,0x9F,0xFF,0x9C,0xE7,0xFE,0xFF,0x03,0x2F,
+0xFF,0xFF,0xC7,0xF8,0xFF,0x07,0x9D,0xFF,0xFF,0xCF,0xEC,0x07,0x8F,0xDF,0xEE,0xFF,
+0x06,0xFC,0xCF,0xDB,0xCF,0xFF,0x79,0xEF,0xFE,0xFF,0x03,0xAF,0xFF,0xFF,0xCF,0xF8,
+0xFF,0x06,0x9B,0xBF,0xFF,0xCF,0xEE,0x1E,0xCF,0xED,0xFF,0x06,0xFC,0xDF,0xC3,0xC7,
+0xF0,0xE3,0xCF,0xFE,0xFF,0x03,0xAF,0xFF,0xFF,0xCF,0xF8,0xFF,0x05,0x9B,0x37,0xFF,
+0xCF,0xEF,0x7E,0xEC,0xFF,0x06,0xFE,0xDF,0xE3,0xF8,0x00,0x0F,0x8F,0xFE,0xFF,0x03,
+0x87,0xFF,0xFF,0x9F,0xF9,0xFF,0x07,0xFD,0xF7,0x77,0xFF,0x67,0xEF,0xFE,0x7F,0xED,
+0xFF,0x02,0xFE,0x7F,0xF7,0xFE,0xFF,0x00,0x81,0xFE,0xFF,0x03,0x87,0xFF,0xFF,0x1F,
+0xF9,0xFF,0x06,0xFE,0x1F,0x7F,0xFF,0x87,0xEF,0xFD,0xEC,0xFF,0x02,0xFE,0x7F,0xF7,
+0xFE,0xFF,0x00,0x1C,0xFE,0xFF,0x03,0xCF,0xFF,0xFE,0x1F,0xF8,0xFF,0x05,0x1F,0xFF,
+0xFB,0x87,0xEF,0x1F,0xEC,0xFF,0x0D,0xFE,0x4F,0xE7,0xFD,0xFF,0xFE,0x0E,0x7F,0xFF,
+0x7B,0x80,0xFF,0xF8,0x3F,0xFE,0xFF,0x00,0xFE,0xFD,0xFF,0x06,0xFB,0x8F,0xFE,0x99,
+0x83,0xEE,0x6F,0xEC,0xFF,0x0D,0xFE,0x6F,0xE7,0xFC,0xFF,0xFC,0x77,0xFF,0xFF,0xFB,
+0x80,0x03,0x7E,0x7F,0xFE,0xFF,0x00,0xFC,0xFD,0xFF,0x05,0xFD,0xCF,0xFF,0xDF,0xFC,
+0xE0,0xED,0xFF,0x07,0xFB,0x7F,0xFE,0x6F,0xF7,0xF0,0x3F,0xF8,0xFD,0xFF,0xFE,0x00,
+0x04,0xFF,0xFF,0xFE,0xFF,0xFD,0xFD,0xFF,0x06,0x7E,0x7F,0xF3,0xFF,0xF8,0xC3,0x7F,
+0xEE,0xFF,0x07,0xDB,0xFF,0xFC,0x67,0xE7,0xE0,0x0F,0xF9,0xFE,0xFF,0x11,0xF8,0x60,
+0xF3,0xC7,0xFF,0xFF,0xFE,0xFF,0xFD,0x7B,0xFF,0xFF,0xDF,0x1F,0xFF,0xFB,0xFF,0xF9,
+0xEC,0xFF,0x0C,0xDF,0xFE,0x7C,0x17,0xF7,0xC4,0x01,0xE3,0xFF,0xF3,0xFF,0xC8,0x31,
+0xFD,0xFF,0x0A,0xFE,0xDF,0xEC,0x77,0xFF,0xFF,0xDF,0xCF,0xFF,0xFF,0x1F,0xEB,0xFF,
+0x15,0xCF,0xFE,0xFD,0xFB,0xF3,0x80,0x1C,0x47,0xFF,0xE7,0xFF,0xC0,0x7B,0xFF,0x7F,
+0xFF,0xFF,0xF6,0xDF,0xEC,0xFE,0x7F,0xFC,0xFF,0x00,0x1F,0xEB,0xFF,0x0B,0xDF,0xFF,
+0xF9,0xF1,0xF8,0x20,0x7D,0x0F,0xFF,0x9F,0xFF,0x80,0xFC,0xFF,0x02,0xF5,0xDF,0x2F,
+0xFB,0xFF,0x00,0xEF,0xE8,0xFF,0x09,0xFB,0xE6,0xF8,0x7F,0xFF,0x9F,0xFF,0x1F,0xFF,
+0x83,0xFC,0xFF,0x04,0xF4,0xDF,0x3F,0xFF,0xDF,0xFD,0xFF,0x00,0xC3,0xE8,0xFF,0x09,
+0xE7,0xE6,0x70,0x7F,0xFF,0x3F,0xFC,0x3F,0xDF,0x8F,0xFC,0xFF,0x04,0xF6,0x9F,0x9F,
+0xFF,0xBF,0xFD,0xFF,0x00,0xC3,0xE9,0xFF,0x0A,0xDF,0xE7,0xE3,0x87,0x3F,0xFE,0x7F,
+0xF8,0x1C,0x00,0x1F,0xFC,0xFF,0x02,0xFB,0xFE,0xDF,0xFB,0xFF,0x00,0xCF,0xE8,0xFF,
+0x09,0xE7,0xC7,0x8F,0x8F,0xFC,0xFF,0xE0,0x00,0x00,0x3F,0xFC,0xFF,0x04,0x9B,0xFE,
+0x7F,0xFF,0xF3,0xE3,0xFF,0x08,0x67,0xCF,0xC5,0xE7,0xF9,0xFF,0xE0,0x01,0x00,0xFB,
+0xFF,0x04,0x0D,0xDF,0xFF,0xFF,0xE4,0xE3,0xFF,0x08,0xCF,0xCD,0xE3,0xFB,0xF3,0xFF,
+0xDE,0x00,0x1F,0xFB,0xFF,0x05,0x8C,0xDD,0xFF,0xFE,0xCD,0xFB,0xE6,0xFF,0x08,0xFE,
+0xFF,0xCF,0xD9,0xE7,0xFD,0xC7,0xFF,0x3F,0xF8,0xFF,0x04,0xCE,0xFF,0xFE,0xDF,0xEF,
+0xE5,0xFF,0x07,0x73,0x0F,0xD9,0xF3,0xFF,0x07,0xFE,0x7F,0xF7,0xFF,0x03,0x7F,0xFC,
+0xD3,0xDF,0xE6,0xFF,0x07,0xF7,0x1B,0x0F,0xF3,0xF9,0xFF,0x07,0xFC,0xF5,0xFF,0x01,
+0xFD,0xB7,0xE4,0xFF,0x05,0x9A,0x0F,0x7F,0xFC,0xFF,0xDB,0xF4,0xFF,0x01,0xDD,0xB7,
+0xE4,0xFF,0x06,0xE3,0x3F,0xFF,0xFE,0x7F,0xDB,0xE7,0xF5,0xFF,0x01,0xDF,0xBF,0xE5,
+0xFF,0x07,0xFE,0xF3,0xBF,0xFF,0xFF,0x3F,0xEF,0xCF,0xF5,0xFF,0x00,0xEF,0xE4,0xFF,
+0x00,0xFE,0xFD,0xFF,0x02,0x9F,0xFF,0x9F,0xF6,0xFF,0x01,0xFE,0x7F,0xE4,0xFF,0x00,
+0xFE,0xFD,0xFF,0x02,0xCF,0xFF,0xB3,0xD8,0xFF,0x00,0xFE,0xFC,0xFF,0x02,0xE7,0xF8,
+0x0F,0xD2,0xFF,0x02,0xE3,0xF8,0x1F,0xD2,0xFF,0x02,0xF9,0xF8,0x3F,0xD2,0xFF,0x02,
+0xFC,0xF8,0x7F,0xD2,0xFF,0x01,0xFE,0x7F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x8A,0xFF,
+};
+
+#endif
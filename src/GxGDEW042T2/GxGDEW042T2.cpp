@@ -25,48 +25,34 @@
 
 GxGDEW042T2::GxGDEW042T2(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW042T2_WIDTH, GxGDEW042T2_HEIGHT), IO(io),
-    _current_page(-1), _initial(true), _using_partial_mode(false), _diag_enabled(false),
+    _initial(true), _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDEW042T2::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
+  _drawPixelFB(x, y, color);
+}
 
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+void GxGDEW042T2::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW042T2_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW042T2_WIDTH - x - 1;
-      y = GxGDEW042T2_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW042T2_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW042T2_WIDTH / 8;
-  if (_current_page < 0)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW042T2_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW042T2_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW042T2_WIDTH / 8;
-  }
+void GxGDEW042T2::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEW042T2::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDEW042T2::init(uint32_t serial_diag_bitrate)
@@ -84,6 +70,7 @@ void GxGDEW042T2::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _initial = true;
   _current_page = -1;
@@ -92,24 +79,19 @@ void GxGDEW042T2::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW042T2::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW042T2::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-  {
-    uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-    IO.writeDataTransaction(~data);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDEW042T2_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("update");
 #if 0
@@ -119,11 +101,9 @@ void GxGDEW042T2::update(void)
     // use second full refresh to init second controller buffer
     // needed for subsequent partial updates
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    IO.startTransaction();
+    _writePlaneData(IO, 0, 0, GxGDEW042T2_BUFFER_SIZE, true, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("update");
   }
@@ -138,17 +118,16 @@ void GxGDEW042T2::update(void)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, WIDTH, HEIGHT);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    IO.startTransaction();
+    _writePlaneData(IO, 0, 0, GxGDEW042T2_BUFFER_SIZE, true, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("update");
     IO.writeCommandTransaction(0x92); // partial out
   }
 #endif
   _sleep();
+  _setShadow(_fb_black, _fb_size, GxGDEW042T2_BUFFER_SIZE);
 }
 
 void  GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
@@ -160,6 +139,8 @@ void  GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
+  _invalidateShadow();
   if (mode & bm_default) mode |= bm_normal;
   if (mode & bm_partial_update)
   {
@@ -170,20 +151,9 @@ void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042T2_WIDTH - 1, GxGDEW042T2_HEIGHT - 1);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW042T2_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x92); // partial out
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
@@ -191,20 +161,9 @@ void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042T2_WIDTH - 1, GxGDEW042T2_HEIGHT - 1);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW042T2_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x92); // partial out
     _waitWhileBusy("drawBitmap");
   }
@@ -213,40 +172,18 @@ void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW042T2_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     if (_initial)
     {
       _initial = false;
       IO.writeCommandTransaction(0x13);
-      for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-      {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
-#else
-          data = bitmap[i];
-#endif
-          if (mode & bm_invert) data = ~data;
-        }
-        IO.writeDataTransaction(data);
-      }
+      IO.startTransaction();
+      _writeBitmapData(IO, bitmap, size, GxGDEW042T2_BUFFER_SIZE, mode & bm_invert, 0xFF);
+      IO.endTransaction();
       IO.writeCommandTransaction(0x12);      //display refresh
       _waitWhileBusy("drawBitmap");
     }
@@ -257,6 +194,8 @@ void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 void GxGDEW042T2::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
+  _invalidateShadow();
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
@@ -266,15 +205,9 @@ void GxGDEW042T2::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042T2_WIDTH - 1, GxGDEW042T2_HEIGHT - 1);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042T2_BUFFER_SIZE);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042T2_BUFFER_SIZE);
     IO.writeCommandTransaction(0x92); // partial out
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
@@ -284,10 +217,7 @@ void GxGDEW042T2::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF);
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042T2_BUFFER_SIZE);
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -297,6 +227,7 @@ void GxGDEW042T2::eraseDisplay(bool using_partial_update)
 void GxGDEW042T2::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -326,38 +257,79 @@ void GxGDEW042T2::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   // x &= 0xFFF8; // byte boundary, not needed here
   uint16_t xs_bx = x / 8;
   uint16_t xe_bx = (xe + 7) / 8;
+  if (_shadowValid())
+  {
+    uint16_t xe_b = xe_bx - 1;
+    if (!_diffWindow(_fb_black, _fb_size, GxGDEW042T2_WIDTH / 8, xs_bx, xe_b, y, ye)) return; // unchanged
+    x = xs_bx * 8;
+    xe = xe_b * 8 + 8; // byte boundary as in _setPartialRamArea()
+    xe_bx = xe_b + 1;
+  }
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _Init_PartialUpdate();
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x13);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW042T2_WIDTH / 8) + xs_bx;
+    _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("updateWindow");
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x13);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
+    uint32_t idx = uint32_t(y1) * (GxGDEW042T2_WIDTH / 8) + xs_bx;
+    _writePlaneData(IO, 0, idx, xe_bx - xs_bx, true, 0xFF);
+  }
+  IO.endTransaction();
+  IO.writeCommandTransaction(0x92); // partial out
+  _updateShadow(_fb_black, _fb_size, GxGDEW042T2_WIDTH / 8, xs_bx, xe_bx - 1, y, ye);
+}
+
+#if GxEPD_DIRTY_TRACKING
+void GxGDEW042T2::updateDirty()
+{
+  if ((_current_page != -1) || (_dirty_count == 0)) return;
+  op_scope op(this, IO, op_partial_update);
+  if (_dirtyWindows(_fb_black, _fb_size, GxGDEW042T2_WIDTH / 8) == 0) return; // unchanged
+  if (!_using_partial_mode) _wakeUp();
+  _using_partial_mode = true;
+  _Init_PartialUpdate();
+  _writeDirtyWindows();
+  IO.writeCommandTransaction(0x12); //display refresh
+  _waitWhileBusy("updateDirty");
+  _writeDirtyWindows();
+  _dirtyWindowsSent(_fb_black, _fb_size, GxGDEW042T2_WIDTH / 8);
+}
+
+void GxGDEW042T2::_writeDirtyWindows()
+{
+  for (uint8_t i = 0; i < _dirty_count; i++)
+  {
+    const dirty_rect& r = _dirty_rects[i];
+    IO.writeCommandTransaction(0x91); // partial in
+    _setPartialRamArea(r.x0 * 8, r.y0, r.x1 * 8 + 8, r.y1);
+    IO.writeCommandTransaction(0x13);
+    IO.startTransaction();
+    for (int16_t y1 = r.y0; y1 <= r.y1; y1++)
     {
-      uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
+      uint32_t idx = uint32_t(y1) * (GxGDEW042T2_WIDTH / 8) + r.x0;
+      _writePlaneData(IO, 0, idx, r.x1 - r.x0 + 1, true, 0xFF);
     }
+    IO.endTransaction();
+    IO.writeCommandTransaction(0x92); // partial out
   }
-  IO.writeCommandTransaction(0x92); // partial out
 }
+#endif
 
 void GxGDEW042T2::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h)
 {
@@ -375,21 +347,21 @@ void GxGDEW042T2::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   IO.writeCommandTransaction(0x91); // partial in
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x13);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW042T2_WIDTH / 8) + xss_d8;
+    _writePlaneData(IO, 0, idx, xse_d8 - xss_d8, true, 0xFF);
   }
+  IO.endTransaction();
   delay(2);
   IO.writeCommandTransaction(0x92); // partial out
 }
 
 void GxGDEW042T2::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
+  _invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -427,6 +399,7 @@ void GxGDEW042T2::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
 
 void GxGDEW042T2::powerDown()
 {
+  _finishAsync();
   _sleep();
 }
 
@@ -451,15 +424,9 @@ uint16_t GxGDEW042T2::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, ui
 void GxGDEW042T2::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
-  { //=0 BUSY
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > GxGDEW042T2_BUSY_TIMEOUT)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+  if (!_waitBusy(_busy, LOW, GxGDEW042T2_BUSY_TIMEOUT)) //=0 BUSY
+  {
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -477,6 +444,15 @@ void GxGDEW042T2::_waitWhileBusy(const char* comment)
 }
 
 void GxGDEW042T2::_wakeUp(void)
+{
+  _startWakeUp();
+  _waitWhileBusy("Power On");
+  //IO.writeCommandTransaction(0x00);
+  //IO.writeDataTransaction(0x1f); // LUT from OTP Pixel with B/W.
+  _Init_FullUpdate();
+}
+
+void GxGDEW042T2::_startWakeUp()
 {
   if (_rst >= 0)
   {
@@ -490,18 +466,24 @@ void GxGDEW042T2::_wakeUp(void)
   IO.writeDataTransaction(0x17);
   IO.writeDataTransaction(0x17);
   IO.writeCommandTransaction(0x04);
-  _waitWhileBusy("Power On");
-  //IO.writeCommandTransaction(0x00);
-  //IO.writeDataTransaction(0x1f); // LUT from OTP Pixel with B/W.
-  _Init_FullUpdate();
 }
 
 void GxGDEW042T2::_sleep(void)
+{
+  _startPowerOff();
+  _waitWhileBusy("Power Off");
+  _deepSleep();
+}
+
+void GxGDEW042T2::_startPowerOff()
 {
   IO.writeCommandTransaction(0x50); // border floating
   IO.writeDataTransaction(0x17);
   IO.writeCommandTransaction(0x02); // power off
-  _waitWhileBusy("Power Off");
+}
+
+void GxGDEW042T2::_deepSleep()
+{
   if (_rst >= 0)
   {
     IO.writeCommandTransaction(0x07); // deep sleep
@@ -509,27 +491,72 @@ void GxGDEW042T2::_sleep(void)
   }
 }
 
+bool GxGDEW042T2::isBusy()
+{
+  return (_busy >= 0) && (digitalRead(_busy) == 0); //=0 BUSY, no BUSY pin: never
+}
+
+#if GxEPD_ASYNC_UPDATE
+bool GxGDEW042T2::_asyncPowerOn()
+{
+  if (_current_page != -1) return false;
+  if (_initial) return false; // the first update() after init() also initializes the second controller buffer
+  _using_partial_mode = false;
+  _setShadow(_fb_black, _fb_size, GxGDEW042T2_BUFFER_SIZE); // buffer must not change until completion
+  _startWakeUp();
+  return true;
+}
+
+bool GxGDEW042T2::_asyncTransfer()
+{
+  if (_async_index == 0)
+  {
+    _async_index = 1;
+    _Init_FullUpdate();
+    IO.queueCommand(0x13);
+    _queueBufferData(IO, _fb_black, _fb_size, GxGDEW042T2_BUFFER_SIZE, true, 0xFF);
+    IO.startQueue();
+  }
+  return IO.processQueue();
+}
+
+void GxGDEW042T2::_asyncRefresh()
+{
+  IO.writeCommandTransaction(0x12); //display refresh
+}
+
+void GxGDEW042T2::_asyncPowerOff()
+{
+  _startPowerOff();
+}
+
+void GxGDEW042T2::_asyncSleep()
+{
+  _deepSleep();
+}
+#endif
+
 void GxGDEW042T2::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -538,24 +565,24 @@ void GxGDEW042T2::drawPaged(void (*drawCallback)(void))
 void GxGDEW042T2::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -564,24 +591,24 @@ void GxGDEW042T2::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW042T2::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -590,24 +617,24 @@ void GxGDEW042T2::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW042T2::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -637,6 +664,8 @@ void GxGDEW042T2::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -644,15 +673,19 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
@@ -660,26 +693,32 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
   delay(2);
   _waitWhileBusy("updateToWindow");
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -687,16 +726,20 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
       //fillScreen(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
@@ -704,27 +747,33 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
   delay(2);
   _waitWhileBusy("updateToWindow");
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
       //fillScreen(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -732,15 +781,19 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
@@ -748,26 +801,32 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
   delay(2);
   _waitWhileBusy("updateToWindow");
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
+  _invalidateShadow();
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -775,15 +834,19 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*, const void
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
@@ -791,29 +854,35 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*, const void
   delay(2);
   _waitWhileBusy("updateToWindow");
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
   _waitWhileBusy("updateToWindow");
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042T2::drawCornerTest(uint8_t em)
 {
   if (_current_page != -1) return;
+  _invalidateShadow();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW042T2_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW042T2_WIDTH / 8; x++)
@@ -823,9 +892,10 @@ void GxGDEW042T2::drawCornerTest(uint8_t em)
       if ((x > GxGDEW042T2_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW042T2_WIDTH / 8 - 4) && (y > GxGDEW042T2_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW042T2_HEIGHT - 33)) data = 0x00;
-      IO.writeDataTransaction(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
@@ -836,64 +906,32 @@ void GxGDEW042T2::_Init_FullUpdate()
   //IO.writeDataTransaction(0x1f); // LUT from OTP Pixel with B/W.
   IO.writeCommandTransaction(0x00);
   IO.writeDataTransaction(0x3F); //300x400 B/W mode, LUT set by register
-  unsigned int count;
   IO.writeCommandTransaction(0x20); //vcom
-  for (count = 0; count < 44; count++)
-  {
-    IO.writeDataTransaction(lut_vcom0_full[count]);
-  }
+  IO.writeDataTransaction(lut_vcom0_full, 44);
   IO.writeCommandTransaction(0x21); //ww --
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_ww_full[count]);
-  }
+  IO.writeDataTransaction(lut_ww_full, 42);
   IO.writeCommandTransaction(0x22); //bw r
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_bw_full[count]);
-  }
+  IO.writeDataTransaction(lut_bw_full, 42);
   IO.writeCommandTransaction(0x23); //wb w
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_wb_full[count]);
-  }
+  IO.writeDataTransaction(lut_wb_full, 42);
   IO.writeCommandTransaction(0x24); //bb b
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_bb_full[count]);
-  }
+  IO.writeDataTransaction(lut_bb_full, 42);
 }
 
 void GxGDEW042T2::_Init_PartialUpdate()
 {
   IO.writeCommandTransaction(0x00);
   IO.writeDataTransaction(0x3F); //300x400 B/W mode, LUT set by register
-  unsigned int count;
   IO.writeCommandTransaction(0x20); //vcom
-  for (count = 0; count < 44; count++)
-  {
-    IO.writeDataTransaction(lut_vcom0_partial[count]);
-  }
+  IO.writeDataTransaction(lut_vcom0_partial, 44);
   IO.writeCommandTransaction(0x21); //ww --
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_ww_partial[count]);
-  }
+  IO.writeDataTransaction(lut_ww_partial, 42);
   IO.writeCommandTransaction(0x22); //bw r
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_bw_partial[count]);
-  }
+  IO.writeDataTransaction(lut_bw_partial, 42);
   IO.writeCommandTransaction(0x23); //wb w
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_wb_partial[count]);
-  }
+  IO.writeDataTransaction(lut_wb_partial, 42);
   IO.writeCommandTransaction(0x24); //bb b
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_bb_partial[count]);
-  }
+  IO.writeDataTransaction(lut_bb_partial, 42);
 }
 
 const unsigned char GxGDEW042T2::lut_vcom0_full[] =
@@ -21,7 +21,7 @@
 
 #define GxGDEW042T2_BUFFER_SIZE (uint32_t(GxGDEW042T2_WIDTH) * uint32_t(GxGDEW042T2_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW042T2_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW042T2_HEIGHT
 #define GxGDEW042T2_PAGES 20
 
 #define GxGDEW042T2_PAGE_HEIGHT (GxGDEW042T2_HEIGHT / GxGDEW042T2_PAGES)
@@ -38,6 +38,10 @@ class GxGDEW042T2 : public GxEPD
     GxGDEW042T2(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -48,11 +52,16 @@ class GxGDEW042T2 : public GxEPD
     void eraseDisplay(bool using_partial_update = false);
     // partial update of rectangle from buffer to screen, does not power off
     void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true);
+#if GxEPD_DIRTY_TRACKING
+    // partial update of the regions drawn since last updateDirty(), one refresh for all, does not power off
+    void updateDirty();
+#endif
     // partial update of rectangle at (xs,ys) from buffer to screen at (xd,yd), does not power off
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW042T2_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW042T2_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -64,6 +73,8 @@ class GxGDEW042T2 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0);
+    const char* panelName() {return "GDEW042T2";};
+    bool isBusy();
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -73,21 +84,37 @@ class GxGDEW042T2 : public GxEPD
       b = t;
     }
     void _writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h);
+#if GxEPD_DIRTY_TRACKING
+    void _writeDirtyWindows();
+    uint32_t _dirtyCost() {return GxEPD_DIRTY_WINDOW_COST;};
+#endif
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
+    void _startWakeUp();
     void _sleep(void);
+    void _startPowerOff();
+    void _deepSleep();
+#if GxEPD_ASYNC_UPDATE
+    bool _asyncPowerOn();
+    bool _asyncTransfer();
+    void _asyncRefresh();
+    void _asyncPowerOff();
+    void _asyncSleep();
+#endif
     void _waitWhileBusy(const char* comment = 0);
     void _Init_FullUpdate();
     void _Init_PartialUpdate();
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW042T2_WIDTH, GxGDEW042T2_HEIGHT, 1> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif defined(__AVR)
     uint8_t _buffer[GxGDEW042T2_PAGE_SIZE];
 #else
     uint8_t _buffer[GxGDEW042T2_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _initial, _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -118,6 +145,7 @@ class GxGDEW042T2 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW042T2_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW042T2/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW042T2/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW042T2/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,1472 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h BitmapWaveshare.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 15000 bytes, packed 3633
+#if defined(__AVR)
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xE8,0x35,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x8E,0xFF,0x00,0xF9,
+0xD0,0xFF,0x00,0xF8,0xD0,0xFF,0x01,0xF8,0x7F,0xD1,0xFF,0x01,0xFC,0x7F,0xD1,0xFF,
+0x01,0xFE,0x1F,0xD0,0xFF,0x00,0x0F,0xD0,0xFF,0x00,0xC7,0xD0,0xFF,0x00,0x23,0xD1,
+0xFF,0x01,0xFC,0x31,0xD0,0xFF,0x01,0xF8,0x7F,0xD1,0xFF,0x01,0xFC,0x7F,0xFE,0xFF,
+0x00,0xF3,0xD5,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x00,0xF3,0xD4,0xFF,0x00,0x7F,0xFE,
+0xFF,0x00,0xF1,0xD0,0xFF,0x00,0xF1,0xEC,0xFF,0x00,0xF8,0xEA,0xFF,0x00,0xE3,0xFE,
+0xFF,0x00,0xF0,0xEC,0xFF,0x00,0xF1,0xEA,0xFF,0x00,0xC1,0xFE,0xFF,0x00,0xF0,0xEC,
+0xFF,0x00,0xE1,0xEA,0xFF,0x04,0xF0,0x7F,0xFF,0xFF,0xF8,0xEC,0xFF,0x00,0xE1,0xEA,
+0xFF,0x04,0xF8,0x3F,0xFF,0xFF,0xF8,0xF1,0xFF,0x00,0xF3,0xFD,0xFF,0x00,0xF9,0xEA,
+0xFF,0x04,0xFC,0x0F,0xFF,0xFF,0xF8,0xF1,0xFF,0x01,0xC0,0x7F,0xFE,0xFF,0x00,0xF9,
+0xEA,0xFF,0x04,0xFC,0x07,0xFF,0xFF,0xF8,0xF1,0xFF,0x01,0xF8,0x1F,0xFE,0xFF,0x00,
+0xF9,0xEA,0xFF,0x04,0xF8,0x03,0xFF,0xFF,0x80,0xF1,0xFF,0x01,0xFE,0x07,0xFE,0xFF,
+0x00,0xF9,0xEA,0xFF,0x04,0xFC,0x83,0xFF,0xFF,0x80,0xF0,0xFF,0x00,0x81,0xFE,0xFF,
+0x00,0xFC,0xE9,0xFF,0x03,0x01,0xFF,0xFF,0xE0,0xF0,0xFF,0x04,0xE0,0x7F,0xFF,0xFF,
+0xFC,0xEA,0xFF,0x04,0xFC,0x20,0xFF,0xFF,0xF8,0xF0,0xFF,0x04,0xF8,0x1F,0xFF,0xFF,
+0xFC,0xEA,0xFF,0x04,0xFC,0x70,0x7F,0xFF,0xF8,0xF0,0xFF,0x05,0xFE,0x07,0xFF,0xFF,
+0xFC,0x67,0xEA,0xFF,0x03,0xF8,0x7F,0xFF,0xF8,0xEF,0xFF,0x04,0x80,0xFF,0xFF,0xFE,
+0x07,0xEA,0xFF,0x03,0xFC,0x3F,0xFF,0xF8,0xEF,0xFF,0x04,0xF0,0x3F,0xFF,0xF8,0x07,
+0xEA,0xFF,0x03,0xFE,0x1F,0xFF,0xF8,0xEF,0xFF,0x04,0xFC,0x07,0xFF,0xC0,0x0F,0xEA,
+0xFF,0x03,0x82,0x0F,0xFF,0xF8,0xEE,0xFF,0x03,0x00,0xFF,0x00,0x3F,0xEB,0xFF,0x04,
+0xFE,0x00,0x07,0xFF,0xF1,0xEE,0xFF,0x02,0xC0,0x3F,0x00,0xEA,0xFF,0x04,0xFE,0x00,
+0x07,0xFF,0xF9,0xEE,0xFF,0x02,0xFC,0x03,0x0F,0xEA,0xFF,0x03,0xFE,0x00,0x03,0xCF,
+0xEC,0xFF,0x01,0x00,0x1F,0xE8,0xFF,0x01,0xE1,0x8F,0xEC,0xFF,0x04,0xE0,0x01,0xFF,
+0xFF,0xFC,0xEB,0xFF,0x01,0xF0,0x0F,0xEC,0xFF,0x04,0xFC,0x00,0x0F,0xFF,0xFC,0xEB,
+0xFF,0x01,0xF8,0x0F,0xEB,0xFF,0x03,0xC0,0x00,0xFF,0xF8,0xEB,0xFF,0x01,0xFC,0x1F,
+0xEB,0xFF,0x03,0xFE,0x00,0x0F,0xF8,0xEB,0xFF,0x01,0xFC,0x0F,0xEA,0xFF,0x02,0xF0,
+0x00,0x30,0xEB,0xFF,0x01,0xFE,0x0F,0xE9,0xFF,0x01,0x80,0x00,0xEA,0xFF,0x00,0x07,
+0xE9,0xFF,0x02,0xF8,0x00,0x1F,0xEB,0xFF,0x00,0x87,0xE8,0xFF,0x01,0xC0,0x00,0xEB,
+0xFF,0x00,0x87,0xE8,0xFF,0x02,0xFC,0x00,0x01,0xEC,0xFF,0x00,0x87,0xE7,0xFF,0x02,
+0xE0,0x00,0x1F,0xED,0xFF,0x00,0xC7,0xE7,0xFF,0x03,0xE1,0x00,0x00,0x3F,0xEE,0xFF,
+0x00,0xEF,0xE7,0xFF,0x04,0xE3,0xFC,0x00,0x00,0x7F,0xD4,0xFF,0x04,0xC1,0xFF,0xC0,
+0x00,0x0F,0xD4,0xFF,0x05,0xE3,0xFF,0xFE,0x00,0x01,0xC3,0xFE,0xFF,0x01,0xFE,0x3F,
+0xDA,0xFF,0x0A,0xE7,0xFF,0xFF,0xF8,0x00,0x00,0x3F,0xFF,0xFF,0xFE,0x0F,0xD6,0xFF,
+0x06,0x00,0x00,0x01,0xFF,0xFF,0xFE,0x07,0xD6,0xFF,0x06,0xF0,0x00,0x00,0x07,0xFF,
+0xFE,0x03,0xD6,0xFF,0x06,0xF8,0xE0,0x00,0x00,0xFF,0xFE,0x03,0xD6,0xFF,0x07,0xE7,
+0xFC,0x00,0x00,0x07,0xFF,0x03,0xFB,0xD7,0xFF,0x07,0x07,0xFF,0xFC,0x00,0x00,0x0F,
+0x03,0xF8,0xD8,0xFF,0x09,0xFC,0x07,0xFF,0xFF,0xE0,0x00,0x00,0x03,0xF8,0x7F,0xF4,
+0xFF,0x00,0xBF,0xE7,0xFF,0x01,0xE0,0x0F,0xFE,0xFF,0x04,0xC0,0x00,0x00,0x7C,0x3F,
+0xF4,0xFF,0x00,0x3F,0xE7,0xFF,0x01,0x80,0x3F,0xFE,0xFF,0x04,0x06,0x00,0x00,0x06,
+0x1F,0xF4,0xFF,0x00,0x3F,0xE8,0xFF,0x01,0xFC,0x00,0xFE,0xFF,0x05,0xFC,0x0F,0xF8,
+0x00,0x00,0x1F,0xF5,0xFF,0x01,0xFE,0x7F,0xF2,0xFF,0x00,0xF3,0xFD,0xFF,0x00,0xE7,
+0xFE,0xFF,0x02,0xFB,0x00,0x07,0xFE,0xFF,0x05,0xC0,0x0F,0xFF,0xE0,0x00,0x0F,0xF5,
+0xFF,0x00,0xFE,0xF1,0xFF,0x00,0xF3,0xFD,0xFF,0x05,0x80,0x80,0x07,0xFF,0x80,0x01,
+0xFE,0xFF,0x06,0xFE,0x00,0x1F,0xFF,0xFF,0xC0,0x00,0xF5,0xFF,0x00,0xFC,0xF2,0xFF,
+0x01,0xFE,0x73,0xFD,0xFF,0x05,0x00,0x00,0x0F,0xFF,0x80,0x1F,0xFE,0xFF,0x07,0xF0,
+0x00,0x7F,0xFF,0xFF,0xFE,0x00,0x00,0xF6,0xFF,0x01,0xF5,0xCF,0xF3,0xFF,0x01,0xF8,
+0x13,0xFE,0xFF,0x05,0xFE,0x03,0xC1,0xFF,0xFC,0x00,0xFE,0xFF,0x02,0xFE,0x00,0x03,
+0xFD,0xFF,0x02,0xE0,0x00,0x7F,0xF7,0xFF,0x01,0xF7,0x8F,0xF3,0xFF,0x0A,0xF0,0x00,
+0x7E,0x0F,0xFF,0xFE,0x7F,0x87,0xFF,0xFF,0x03,0xFE,0xFF,0x02,0xC0,0x00,0x7F,0xFD,
+0xFF,0x02,0xFC,0x00,0x07,0xF7,0xFF,0x01,0xF1,0x9F,0xF2,0xFF,0x0E,0x00,0x00,0x0F,
+0xFF,0xFF,0xFC,0x0F,0xFF,0xFF,0x83,0xFF,0xFF,0xFC,0x00,0x1F,0xFB,0xFF,0x01,0xE0,
+0x0F,0xF7,0xFF,0x01,0xF1,0xBF,0xF2,0xFF,0x0D,0xFC,0x00,0x0F,0xFF,0xFF,0xF0,0x7F,
+0xFF,0xFF,0xEF,0xFF,0xF0,0x00,0x07,0xF9,0xFF,0x00,0x0F,0xE5,0xFF,0x04,0x87,0x7F,
+0xFF,0xFF,0xC3,0xFD,0xFF,0x03,0x87,0xE0,0x00,0x7F,0xF4,0xFF,0x00,0x7F,0xEA,0xFF,
+0x00,0x8F,0xF9,0xFF,0x02,0x07,0xC0,0x07,0xF4,0xFF,0x01,0xFE,0x1F,0xFB,0xFF,0x00,
+0x7F,0xF1,0xFF,0x00,0xCF,0xF9,0xFF,0x02,0xBF,0x00,0x1F,0xF3,0xFF,0x00,0x1F,0xFB,
+0xFF,0x00,0x3F,0xE8,0xFF,0x02,0xFE,0x00,0x7F,0xF3,0xFF,0x00,0x1F,0xFC,0xFF,0x01,
+0xFC,0x8F,0xE8,0xFF,0x01,0xFC,0x7F,0xF2,0xFF,0x00,0x8F,0xFC,0xFF,0x01,0xFC,0x6F,
+0xE8,0xFF,0x00,0xFE,0xF3,0xFF,0x02,0xC0,0xFF,0x87,0xFC,0xFF,0x01,0xFE,0x37,0xD9,
+0xFF,0x03,0x80,0x1F,0xC7,0xFD,0xFC,0xFF,0x00,0x1B,0xD9,0xFF,0x03,0xF0,0x07,0xC7,
+0xFD,0xFC,0xFF,0x00,0xC7,0xD9,0xFF,0x06,0xFC,0x00,0x07,0xFD,0xFF,0xFF,0xEF,0xD5,
+0xFF,0x05,0x80,0x07,0xFD,0xFF,0xFF,0xEF,0xE7,0xFF,0x00,0xFC,0xF0,0xFF,0x05,0xF8,
+0x01,0xFD,0xFF,0xFF,0xE7,0xE7,0xFF,0x00,0xF9,0xEF,0xFF,0x04,0x00,0x3D,0xFF,0xFF,
+0xE7,0xE7,0xFF,0x00,0xF1,0xEF,0xFF,0x04,0xC0,0x0D,0xFF,0xC7,0xE7,0xE7,0xFF,0x00,
+0xC7,0xEF,0xFF,0x04,0xF8,0x01,0xFF,0xE3,0xE3,0xE7,0xFF,0x00,0x0F,0xEF,0xFF,0x04,
+0xFC,0x00,0xFF,0xE1,0xE3,0xE8,0xFF,0x01,0xFE,0x3F,0xEF,0xFF,0x04,0xFC,0x00,0xFF,
+0xF0,0xF3,0xE8,0xFF,0x01,0xF0,0x7F,0xEF,0xFF,0x04,0xFE,0x00,0x7F,0xF8,0x31,0xE9,
+0xFF,0x01,0xFC,0x01,0xEE,0xFF,0x04,0xFE,0x00,0x7F,0xFC,0x01,0xE9,0xFF,0x01,0xF0,
+0x07,0xED,0xFF,0x03,0x00,0x3F,0xFF,0x81,0xE9,0xFF,0x01,0xE0,0x7F,0xED,0xFF,0x04,
+0x00,0x3F,0xFF,0xC0,0xBF,0xEA,0xFF,0x00,0xE1,0xEC,0xFF,0x03,0x80,0xBF,0xFF,0xE0,
+0xFE,0xFF,0x00,0x3F,0xD7,0xFF,0x03,0x81,0xFF,0xFF,0xF0,0xFE,0xFF,0x00,0x3F,0xD7,
+0xFF,0x07,0xC1,0xFF,0xFF,0xF8,0x7F,0xFF,0xFF,0x1F,0xD7,0xFF,0x07,0xE3,0xFF,0xFF,
+0xF8,0x7F,0xFF,0xFF,0x0F,0xD7,0xFF,0x07,0xE7,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0x8F,
+0xD4,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0xC7,0xD4,0xFF,0x04,0xFC,0x1F,0xFF,0xFF,0xE3,
+0xD4,0xFF,0x04,0xFC,0x1F,0xFF,0xFF,0xE1,0xD4,0xFF,0x04,0xFC,0x1F,0xFF,0xDF,0xF1,
+0xD4,0xFF,0x04,0xFC,0x0F,0xFF,0xCF,0xF0,0xD4,0xFF,0x04,0xFE,0x0F,0xFF,0xCF,0xF8,
+0xD3,0xFF,0x04,0x03,0xFF,0xC7,0xF8,0x7F,0xD4,0xFF,0x04,0x01,0xFF,0xC7,0xFC,0x7F,
+0xD4,0xFF,0x04,0x80,0x7F,0xC7,0xFE,0x3F,0xD4,0xFF,0x04,0x80,0x1F,0xC3,0xFE,0x3F,
+0xE2,0xFF,0x00,0xFC,0xF4,0xFF,0x04,0xE6,0x07,0xC3,0xFE,0x1F,0xE2,0xFF,0x01,0xF0,
+0x7F,0xF4,0xFF,0x03,0x00,0x83,0xFF,0x1F,0xE2,0xFF,0x01,0xF0,0x3F,0xF4,0xFF,0x03,
+0xE0,0x03,0xFF,0x1F,0xE2,0xFF,0x01,0xF8,0x0F,0xF4,0xFF,0x03,0xF0,0x03,0xFF,0x8F,
+0xE2,0xFF,0x01,0xFE,0x07,0xF4,0xFF,0x03,0xFC,0x03,0xFF,0x87,0xE1,0xFF,0x02,0x81,
+0xFF,0x3F,0xF5,0xFF,0x02,0x01,0xFF,0xC3,0xE1,0xFF,0x02,0xE0,0x7C,0x1F,0xF5,0xFF,
+0x02,0xC0,0x7F,0xC1,0xE1,0xFF,0x02,0xF8,0x38,0x1F,0xF5,0xFF,0x02,0xE0,0x1F,0xC1,
+0xE0,0xFF,0x01,0x80,0x1F,0xF5,0xFF,0x02,0xF8,0x07,0xC0,0xE0,0xFF,0x01,0x00,0x3F,
+0xF5,0xFF,0x02,0xFE,0x01,0xC0,0xE1,0xFF,0x01,0xF8,0x00,0xF3,0xFF,0x01,0xC0,0xE0,
+0xE2,0xFF,0x02,0xE1,0x00,0x1F,0xF3,0xFF,0x01,0xC0,0x20,0xE2,0xFF,0x01,0xC0,0x01,
+0xF2,0xFF,0x02,0xC0,0x00,0x7F,0xE3,0xFF,0x01,0xC0,0x0F,0xF2,0xFF,0x02,0x80,0x00,
+0x7F,0xE3,0xFF,0x01,0x80,0x7F,0xF2,0xFF,0x02,0x83,0x00,0x7F,0xE3,0xFF,0x00,0x83,
+0xF1,0xFF,0x02,0x87,0xC0,0x7F,0xE3,0xFF,0x00,0xDF,0xF1,0xFF,0x02,0xBF,0xF0,0x3F,
+0xD1,0xFF,0x01,0xF8,0x0F,0xD1,0xFF,0x01,0xFE,0x07,0xD0,0xFF,0x00,0x03,0xD0,0xFF,
+0x00,0xC0,0xD0,0xFF,0x01,0xE0,0x7F,0xD1,0xFF,0x01,0xF8,0x1F,0xD1,0xFF,0x01,0xFC,
+0x07,0xD1,0xFF,0x01,0xFE,0x03,0xD0,0xFF,0x00,0x81,0xD0,0xFF,0x00,0xC0,0xD0,0xFF,
+0x01,0xF0,0x7F,0xD1,0xFF,0x01,0xF8,0x1F,0xD1,0xFF,0x01,0xFC,0x0F,0xD0,0xFF,0x00,
+0x07,0xD0,0xFF,0x00,0x83,0xD0,0xFF,0x00,0xC0,0xD0,0xFF,0x01,0xF0,0x7F,0xD1,0xFF,
+0x01,0xF8,0x1F,0xD1,0xFF,0x01,0xFE,0x0F,0xD0,0xFF,0x00,0x03,0xD0,0xFF,0x00,0xC1,
+0xD0,0xFF,0x01,0xE0,0x7F,0xD1,0xFF,0x01,0xF0,0x1F,0xD1,0xFF,0x01,0xFC,0x0F,0xD1,
+0xFF,0x01,0xFE,0x03,0xD0,0xFF,0x00,0x01,0xFC,0xFF,0x00,0xFB,0xD6,0xFF,0x00,0xC0,
+0xFC,0xFF,0x00,0xC1,0xD6,0xFF,0x01,0xE0,0x7F,0xFD,0xFF,0x00,0x83,0xD9,0xFF,0x04,
+0x47,0xF7,0xFF,0xF0,0x3F,0xFD,0xFF,0x00,0x83,0xD9,0xFF,0x04,0x03,0xE7,0xFF,0xF8,
+0x1F,0xFD,0xFF,0x00,0x03,0xD9,0xFF,0x04,0x00,0x01,0xFF,0xFE,0x07,0xFE,0xFF,0x01,
+0xFC,0x03,0xD9,0xFF,0x04,0x00,0x00,0xFF,0xFF,0x03,0xFE,0xFF,0x01,0xFC,0x03,0xDA,
+0xFF,0x05,0xFE,0x00,0x00,0xFF,0xFF,0x01,0xFE,0xFF,0x01,0xF0,0x03,0xDA,0xFF,0x05,
+0xFE,0x00,0x00,0xFF,0xFE,0x00,0xFE,0xFF,0x01,0xE0,0x03,0xDA,0xFF,0x0A,0xFC,0x00,
+0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0xC0,0x07,0xDA,0xFF,0x0A,0xFC,0x00,0x00,0x7F,
+0xFF,0x10,0x3F,0xFC,0xFF,0x00,0x0F,0xDA,0xFF,0x0A,0xFC,0x00,0x01,0xFF,0xFF,0xF8,
+0x1F,0xFC,0x3E,0x00,0x0F,0xDA,0xFF,0x0A,0xFE,0x00,0x03,0xFF,0xFF,0xFC,0x0F,0xFC,
+0x0C,0x00,0x1F,0xDA,0xFF,0x0A,0xF8,0x00,0x03,0xFF,0xFF,0xFE,0x07,0xFE,0x00,0x00,
+0x0F,0xDA,0xFF,0x02,0xFA,0x00,0x01,0xFE,0xFF,0x04,0x03,0xFE,0x00,0x00,0x0F,0xDA,
+0xFF,0x02,0xF7,0x00,0x01,0xFE,0xFF,0x04,0x81,0xFF,0x00,0x00,0x1F,0xDA,0xFF,0x02,
+0xFE,0x00,0x03,0xFE,0xFF,0x04,0xC0,0xFF,0x80,0x00,0x3F,0xDA,0xFF,0x02,0xFC,0x00,
+0x03,0xFE,0xFF,0x04,0xE0,0x7F,0xC0,0x03,0x7F,0xDA,0xFF,0x02,0xF8,0x40,0x03,0xFE,
+0xFF,0x03,0xE0,0x3F,0xC0,0x03,0xD9,0xFF,0x02,0xF8,0xC0,0x03,0xFE,0xFF,0x03,0xF0,
+0x1F,0xE0,0x01,0xD8,0xFF,0x01,0x80,0x07,0xFE,0xFF,0x03,0xF8,0x0F,0xC0,0x03,0xD8,
+0xFF,0x01,0x80,0x0F,0xFE,0xFF,0x03,0xF8,0x07,0x80,0x27,0xD8,0xFF,0x01,0x00,0x1F,
+0xFE,0xFF,0x03,0xFC,0x07,0x00,0x4F,0xD9,0xFF,0x02,0xF6,0x00,0x1F,0xFE,0xFF,0x03,
+0xFE,0x02,0x00,0x9F,0xD9,0xFF,0x02,0xCC,0x00,0x3F,0xFE,0xFF,0x03,0xF7,0x00,0x01,
+0x3F,0xD9,0xFF,0x02,0x98,0x00,0x3F,0xFE,0xFF,0x03,0xE1,0x80,0x02,0x7F,0xDA,0xFF,
+0x03,0xC7,0x30,0x80,0x7F,0xFE,0xFF,0x02,0xF0,0x00,0x07,0xDA,0xFF,0x03,0xF8,0x1E,
+0x70,0x80,0xFD,0xFF,0x02,0xF0,0x00,0x1B,0xDA,0xFF,0x03,0xF0,0x3E,0xE0,0x03,0xFD,
+0xFF,0x02,0xF8,0x00,0x03,0xDA,0xFF,0x03,0xF0,0x3D,0xC0,0x07,0xFD,0xFF,0x02,0xF8,
+0x00,0x07,0xDA,0xFF,0x03,0xF8,0x18,0xC0,0x07,0xFD,0xFF,0x02,0xF8,0x00,0x0F,0xDA,
+0xFF,0x03,0xFC,0x31,0xC0,0x0F,0xFD,0xFF,0x02,0xF8,0x00,0x07,0xDB,0xFF,0x04,0xFE,
+0x00,0x74,0x00,0x1F,0xFD,0xFF,0x02,0xE0,0x00,0x03,0xDB,0xFF,0x04,0xFE,0x00,0xE6,
+0x20,0x3F,0xFD,0xFF,0x02,0x80,0x00,0x01,0xDA,0xFF,0x03,0x00,0xDC,0x00,0x3F,0xFD,
+0xFF,0x02,0x00,0x01,0x80,0xDA,0xFF,0x03,0xC1,0xCC,0x00,0x7F,0xFE,0xFF,0x04,0xFC,
+0x00,0x01,0xE0,0x7F,0xDB,0xFF,0x02,0xC3,0x08,0x30,0xFD,0xFF,0x04,0xF0,0x00,0x03,
+0xF0,0x3F,0xDB,0xFF,0x02,0xC2,0x10,0x40,0xFD,0xFF,0x04,0xE0,0x00,0x0F,0xF8,0x0F,
+0xDB,0xFF,0x05,0x84,0x10,0x01,0xFF,0xFF,0xF0,0xFE,0x00,0x02,0x3F,0xFC,0x07,0xDB,
+0xFF,0x05,0x8C,0x20,0x03,0xFF,0xFF,0xC0,0xFE,0x00,0x02,0xFF,0xFC,0x07,0xDB,0xFF,
+0x0C,0x00,0x40,0x87,0xFF,0xFF,0xC0,0x00,0x00,0x01,0xFF,0xFE,0x00,0x03,0xDD,0xFF,
+0x0D,0xFE,0x10,0x00,0x07,0xFF,0xFF,0x80,0x00,0x00,0x03,0xFF,0xFE,0x00,0x00,0xDD,
+0xFF,0x05,0xFC,0x30,0x80,0x0F,0xFF,0xFF,0xFC,0x00,0x03,0x3E,0x00,0x00,0x7F,0xDE,
+0xFF,0x05,0xFC,0x01,0x00,0x1F,0xFF,0xFF,0xF9,0x00,0x00,0x7F,0xDE,0xFF,0x05,0xF8,
+0x40,0x00,0x1F,0xFF,0xFF,0xF9,0x00,0x00,0x0F,0xDE,0xFF,0x05,0xF8,0x82,0x00,0x3F,
+0xFF,0xFF,0xF9,0x00,0x00,0x0F,0xDE,0xFF,0x05,0xF0,0x04,0x08,0x7F,0xFF,0xFC,0xFE,
+0x00,0x00,0x02,0xFD,0x00,0x00,0x1F,0xDE,0xFF,0x05,0xE1,0x08,0x00,0x7F,0xFF,0xF0,
+0xFE,0x00,0x04,0x03,0xF8,0x3F,0xC0,0x07,0xDD,0xFF,0x05,0xC0,0x08,0x00,0xFF,0xFF,
+0xC0,0xFE,0x00,0x02,0x03,0xF8,0x7F,0xDB,0xFF,0x04,0xC2,0x10,0x01,0xFF,0xFC,0xFD,
+0x00,0x01,0x03,0xF8,0xDA,0xFF,0x04,0x04,0x00,0x01,0xFF,0xE0,0xFD,0x00,0x01,0x03,
+0xF8,0xDA,0xFF,0x03,0x84,0x20,0x03,0xFE,0xFE,0x00,0x03,0x07,0xFE,0x03,0xF9,0xDB,
+0xFF,0x04,0xFE,0x00,0x40,0x07,0xE0,0xFE,0x00,0x00,0x3F,0xD8,0xFF,0x00,0xFE,0xFB,
+0x00,0x00,0x03,0xD7,0xFF,0x01,0xFC,0x10,0xFC,0x00,0x00,0x1F,0xF6,0xFF,0x00,0xDF,
+0xFE,0xFF,0x00,0xF7,0xF6,0xFF,0x00,0x9F,0xF3,0xFF,0x01,0xF8,0x20,0xFC,0x00,0x00,
+0x7F,0xF6,0xFF,0x00,0x9F,0xFE,0xFF,0x10,0xF3,0xFF,0xFF,0xFB,0xFE,0xFF,0xFF,0xFC,
+0x00,0x1F,0xFF,0xFF,0x8F,0xFF,0xFF,0xFE,0x00,0xF7,0xFF,0x00,0xF0,0xFC,0x00,0x00,
+0x03,0xF5,0xFF,0x15,0x9F,0xFF,0xFE,0x03,0xE0,0x03,0xFF,0xC1,0xF8,0x03,0xFF,0x80,
+0x00,0x03,0xFF,0xFF,0x8F,0xFF,0xFF,0xF0,0x00,0x1F,0xF8,0xFF,0x01,0xF0,0x40,0xFD,
+0x00,0x00,0x1F,0xF5,0xFF,0x15,0x9F,0xFF,0xFE,0x02,0x00,0x01,0xFF,0x81,0xC0,0x01,
+0xFF,0xC0,0xFF,0xC3,0xFF,0x38,0x00,0x1B,0xFF,0x80,0x00,0x1F,0xF8,0xFF,0x00,0xF0,
+0xFC,0x00,0xF4,0xFF,0x15,0x9F,0xFF,0xFE,0x0E,0x00,0x03,0xFE,0x03,0x00,0x01,0xFF,
+0xE3,0xFF,0xE7,0xFE,0x00,0x00,0x03,0xFF,0x00,0x7C,0x1F,0xF8,0xFF,0x00,0xE0,0xFD,
+0x00,0x00,0x03,0xF4,0xFF,0x15,0x80,0x0F,0xFE,0x3E,0x06,0xFF,0xFE,0x03,0x00,0x7F,
+0xFF,0xE7,0x00,0x0F,0xFE,0x00,0x07,0x03,0xFF,0x00,0xF8,0x3F,0xF8,0xFF,0x00,0xC0,
+0xFD,0x00,0x00,0x3F,0xF5,0xFF,0x15,0xF0,0x00,0x07,0xFF,0xFE,0x4E,0xFF,0xFF,0x07,
+0x0C,0x7F,0xFF,0xE0,0x00,0x0F,0xFE,0x00,0x0F,0xC7,0xFF,0xFC,0x30,0xF7,0xFF,0x00,
+0xC0,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x15,0x00,0x00,0x07,0xFF,0x87,0xCC,0xFF,0xFF,
+0x87,0xFC,0x07,0xFF,0xE0,0x00,0x1F,0xFF,0x07,0x0F,0xCF,0xFF,0xFF,0x01,0xF7,0xFF,
+0x03,0x80,0x00,0x00,0x01,0xF3,0xFF,0x15,0x00,0x00,0x07,0xFE,0x0F,0x10,0x03,0xFF,
+0xE7,0xE0,0x01,0xFF,0xE3,0xFF,0xDF,0xFF,0x8F,0x00,0x0F,0xFF,0xFF,0x87,0xF7,0xFF,
+0xFE,0x00,0x00,0x1F,0xF3,0xFF,0x15,0x00,0x1F,0xFF,0xFE,0x1E,0x00,0x03,0xFF,0xE7,
+0x00,0x01,0xFF,0xE7,0x00,0x1F,0xFF,0x88,0x00,0x0F,0xFF,0xFF,0xC7,0xF8,0xFF,0x03,
+0xFE,0x00,0x00,0x03,0xF2,0xFF,0x16,0x03,0x8F,0xFF,0xFF,0xFE,0x00,0x03,0xFF,0xE7,
+0x00,0x03,0xFF,0xE0,0x00,0x1F,0xFF,0x80,0x00,0x1F,0xFF,0xF0,0x00,0x7F,0xF9,0xFF,
+0x03,0xFC,0x00,0x00,0x07,0xF1,0xFF,0x15,0x07,0xFF,0xFF,0xC6,0x04,0xFF,0xFF,0xE7,
+0x3C,0xFF,0xFF,0xC0,0x18,0x1F,0xFF,0x80,0x1F,0x1F,0xFF,0x80,0x00,0x00,0xF9,0xFF,
+0x03,0xF8,0x00,0x00,0x0F,0xF1,0xFF,0x12,0x07,0xFF,0xFF,0x0F,0xFC,0xFF,0xFF,0xE7,
+0xFC,0xFF,0xFF,0x87,0x3B,0xFF,0xFF,0x82,0x3F,0x1F,0xFC,0xFE,0x00,0xF9,0xFF,0x03,
+0xF0,0x00,0x00,0x0F,0xF1,0xFF,0x15,0x23,0xFF,0xFE,0x1F,0xE0,0x03,0xFF,0xE7,0xE0,
+0x07,0xFF,0xFF,0x3B,0xFF,0xFF,0x9E,0x3F,0x1F,0xF8,0x00,0xE7,0x01,0xF9,0xFF,0x03,
+0xE0,0x00,0x00,0x1F,0xF2,0xFF,0x16,0xFE,0x71,0xFF,0xFF,0xFE,0x00,0x01,0xFF,0xE7,
+0x00,0x03,0xFF,0xFF,0x3B,0xCF,0xFF,0x3E,0x00,0x3F,0xF8,0x0F,0xE7,0xC3,0xF9,0xFF,
+0x03,0xC0,0x00,0x00,0x3F,0xF2,0xFF,0x15,0xFC,0x78,0xFF,0xFF,0xE6,0x00,0x03,0xFF,
+0xE7,0x00,0x03,0xFF,0xC3,0x33,0x07,0xFF,0x38,0x00,0x3F,0xFC,0x7F,0xE7,0xF8,0xFF,
+0xFE,0x00,0x00,0x3F,0xF2,0xFF,0x15,0xFC,0xF8,0x7F,0xFF,0x8E,0x1C,0xFF,0xFF,0xE7,
+0x1C,0x7F,0xFF,0xC3,0x33,0x8F,0xFF,0x00,0x00,0x3F,0xFF,0xFF,0xE7,0xF9,0xFF,0x00,
+0xF8,0xFE,0x00,0x00,0x7F,0xF2,0xFF,0x11,0xF8,0xFC,0x3F,0xFF,0x1F,0xFD,0xFF,0xFF,
+0xE7,0xFC,0x7F,0xFF,0xC7,0x33,0xFF,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xE7,0xFA,0xFF,
+0x00,0xF0,0xFD,0x00,0xF1,0xFF,0x15,0xF1,0xFC,0x0F,0xFE,0x00,0x3D,0xFF,0xFF,0xE7,
+0xFC,0x7F,0xBF,0xFE,0x00,0xFF,0xFF,0x1E,0x3F,0xFF,0x7F,0xFF,0xC7,0xFA,0xFF,0x00,
+0x80,0xFD,0x00,0xF1,0xFF,0x15,0xC3,0xFE,0x03,0xFE,0x00,0x00,0x3F,0xBF,0xE7,0x80,
+0x00,0x7F,0xC0,0x00,0x1E,0x7F,0x7F,0x3F,0xFC,0x7F,0xFF,0xCF,0xFB,0xFF,0x00,0xFE,
+0xFD,0x00,0x00,0x01,0xF2,0xFF,0x04,0xFC,0x07,0xFE,0x00,0x7E,0xFE,0x00,0x04,0x7F,
+0xE4,0x00,0x00,0x7C,0xFE,0x00,0x06,0x7F,0xFF,0x00,0x18,0x7F,0xFF,0x8F,0xFB,0xFF,
+0x00,0xF8,0xFD,0x00,0x00,0x01,0xF2,0xFF,0x16,0xFC,0x0F,0xFF,0x00,0xFE,0xFF,0xC0,
+0x00,0x7F,0xE4,0x00,0x00,0xFC,0x07,0xFE,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x0F,
+0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x03,0xF2,0xFF,0x16,0xFC,0x3F,0xFF,0x01,0xFF,
+0xFF,0xFC,0x00,0xFF,0xE4,0x1F,0xF0,0xFC,0x3F,0xFF,0xC0,0xFF,0xFF,0x00,0x00,0xFF,
+0xE0,0x1F,0xFB,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x07,0xEF,0xFF,0x00,0x83,0xFE,0xFF,
+0x02,0x80,0xFF,0xEF,0xFC,0xFF,0x07,0xF1,0xFF,0xFF,0xFE,0x00,0xFF,0xF8,0x7F,0xFA,
+0xFF,0x00,0xC0,0xFE,0x00,0x00,0x07,0xEB,0xFF,0x02,0xE3,0xFF,0xF7,0xF8,0xFF,0x00,
+0x81,0xF7,0xFF,0x00,0x80,0xFE,0x00,0x00,0x0F,0xD4,0xFF,0x00,0x80,0xFE,0x00,0x00,
+0x0F,0xD4,0xFF,0xFD,0x00,0x00,0x1F,0xD5,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x1F,0xD5,
+0xFF,0x00,0xF0,0xFD,0x00,0x00,0x1F,0xD5,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x3F,0xD5,
+0xFF,0xFC,0x00,0x00,0x3F,0xD6,0xFF,0x00,0xFE,0xFC,0x00,0x00,0x7F,0xE7,0xFF,0x06,
+0xFC,0x7F,0xFC,0x7F,0xFF,0xFF,0xF8,0xF7,0xFF,0x00,0xFE,0xFC,0x00,0xE6,0xFF,0x02,
+0xFB,0xFF,0xFB,0xFE,0xFF,0x00,0xF7,0xF7,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x01,0xE6,
+0xFF,0x06,0xF7,0xFF,0xF7,0xEF,0xFF,0xFF,0xEF,0xF7,0xFF,0x00,0xFE,0xFD,0x00,0x00,
+0x01,0xE6,0xFF,0x06,0xF7,0xFF,0xF7,0xEF,0xFF,0xFF,0xEF,0xF7,0xFF,0x00,0xFE,0xFD,
+0x00,0x00,0x03,0xE6,0xFF,0x02,0xE7,0xFF,0xE7,0xFE,0xFF,0x00,0xEF,0xF7,0xFF,0x00,
+0xFE,0xFD,0x00,0x00,0x03,0xE6,0xFF,0x02,0xEF,0xFF,0xEF,0xFE,0xFF,0x00,0xCF,0xF7,
+0xFF,0x00,0xFC,0xFD,0x00,0x00,0x03,0xF0,0xFF,0x15,0x86,0xEE,0x1B,0xBC,0x37,0x7F,
+0xF8,0x78,0x7E,0x1F,0x0F,0xFF,0x0F,0x8F,0x8F,0x89,0xDF,0xC3,0xE7,0xBF,0xF1,0xC4,
+0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x07,0xF1,0xFF,0x16,0xFE,0x4C,0xE9,0x33,0xB2,
+0x67,0x7F,0xF6,0x76,0x7D,0x9E,0xCF,0xFE,0xCF,0x5F,0x6F,0x45,0xDF,0xB3,0xD3,0xBF,
+0xED,0xA2,0xFC,0xFF,0x05,0xFE,0x00,0x01,0x00,0x00,0x07,0xF1,0xFF,0x16,0xFE,0xCC,
+0xEB,0x33,0xB6,0x67,0x7F,0xEE,0xF7,0x7D,0xDD,0xCF,0xFD,0xCF,0xDF,0x7F,0xDD,0xDF,
+0x77,0xFB,0xBF,0xCF,0xE6,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x07,0xF0,0xFF,0x15,
+0x9D,0xEE,0x77,0xBC,0xEF,0x7F,0xEE,0xEF,0x7B,0xDD,0xCF,0xFD,0xCF,0x9F,0x3F,0xDD,
+0xDF,0x77,0xF9,0xBF,0xDF,0xEE,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x0F,0xF0,0xFF,
+0x15,0x9D,0xDE,0x77,0x7C,0xEE,0xFF,0xDC,0xEF,0x7B,0xDB,0x8F,0x0B,0x8F,0x9F,0xBF,
+0xBD,0x9E,0xE7,0xFD,0x7F,0x9F,0xCE,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x0F,0xF0,
+0xFF,0x15,0x9D,0xDE,0x77,0x7C,0xEE,0xFF,0xDC,0xEF,0x7B,0xDB,0x9F,0xFB,0x9F,0xBF,
+0xDF,0xBB,0xBE,0xE7,0xFD,0x7F,0x9F,0xDD,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x0F,
+0xF0,0xFF,0x15,0x99,0xBE,0x66,0xFC,0xCD,0xFF,0xDC,0xEE,0xFB,0xBB,0x9F,0xFB,0x9F,
+0x3D,0xDF,0xBB,0xB6,0xE7,0xFD,0x7F,0x9F,0xDD,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,
+0x1F,0xF0,0xFF,0x16,0x95,0x7E,0x55,0xFC,0xAB,0xF7,0xD9,0xE6,0xF9,0xBB,0x17,0xFB,
+0x17,0x2D,0xDF,0xB7,0xAE,0xC3,0xFC,0xF7,0x9B,0xDD,0x7F,0xFD,0xFF,0x00,0xFE,0xFD,
+0x00,0x00,0x1F,0xF0,0xFF,0x15,0x8C,0xFE,0x33,0xFC,0x67,0xE7,0xC5,0xE1,0xF8,0x78,
+0x8F,0xF8,0x8F,0x1E,0x3F,0x0F,0x9E,0x27,0xFC,0xE7,0xC7,0xFC,0xFC,0xFF,0x05,0xFE,
+0x00,0x00,0x20,0x00,0x1F,0xEA,0xFF,0x00,0xCD,0xF9,0xFF,0x03,0x3F,0xFF,0xFF,0xFD,
+0xF9,0xFF,0x05,0xFE,0x00,0x01,0xFC,0x00,0x1F,0xEA,0xFF,0x00,0xBD,0xF9,0xFF,0x03,
+0x7F,0xFF,0xFF,0xFB,0xF8,0xFF,0x00,0x05,0xE6,0xFF,0x00,0x79,0xF9,0xFF,0x03,0x7F,
+0xFF,0xFF,0xFB,0xDC,0xFF,0x00,0x79,0xFA,0xFF,0x04,0xFE,0x7F,0xFF,0xFF,0xF7,0xDC,
+0xFF,0x00,0x73,0xFA,0xFF,0x04,0xFC,0x1F,0xFF,0xFF,0x0F,0xDC,0xFF,0x00,0x87,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xEA,0xFF,
+};
+#else
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0xDE,0xFF,0x00,0xF9,0xD0,0xFF,0x00,0xF8,0xD0,0xFF,0x01,0xF8,0x7F,0xD1,0xFF,0x01,
+0xFC,0x7F,0xD1,0xFF,0x01,0xFE,0x1F,0xD0,0xFF,0x00,0x0F,0xD0,0xFF,0x00,0xC7,0xD0,
+0xFF,0x00,0x23,0xD1,0xFF,0x01,0xFC,0x31,0xD0,0xFF,0x01,0xF8,0x7F,0xD1,0xFF,0x01,
+0xFC,0x7F,0xFE,0xFF,0x00,0xF3,0xD5,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x00,0xF3,0xD4,
+0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF1,0xD0,0xFF,0x00,0xF1,0xEC,0xFF,0x00,0xF8,0xEA,
+0xFF,0x00,0xE3,0xFE,0xFF,0x00,0xF0,0xEC,0xFF,0x00,0xF1,0xEA,0xFF,0x00,0xC1,0xFE,
+0xFF,0x00,0xF0,0xEC,0xFF,0x00,0xE1,0xEA,0xFF,0x04,0xF0,0x7F,0xFF,0xFF,0xF8,0xEC,
+0xFF,0x00,0xE1,0xEA,0xFF,0x04,0xF8,0x3F,0xFF,0xFF,0xF8,0xF1,0xFF,0x00,0xF3,0xFD,
+0xFF,0x00,0xF9,0xEA,0xFF,0x04,0xFC,0x0F,0xFF,0xFF,0xF8,0xF1,0xFF,0x01,0xC0,0x7F,
+0xFE,0xFF,0x00,0xF9,0xEA,0xFF,0x04,0xFC,0x07,0xFF,0xFF,0xF8,0xF1,0xFF,0x01,0xF8,
+0x1F,0xFE,0xFF,0x00,0xF9,0xEA,0xFF,0x04,0xF8,0x03,0xFF,0xFF,0x80,0xF1,0xFF,0x01,
+0xFE,0x07,0xFE,0xFF,0x00,0xF9,0xEA,0xFF,0x04,0xFC,0x83,0xFF,0xFF,0x80,0xF0,0xFF,
+0x00,0x81,0xFE,0xFF,0x00,0xFC,0xE9,0xFF,0x03,0x01,0xFF,0xFF,0xE0,0xF0,0xFF,0x04,
+0xE0,0x7F,0xFF,0xFF,0xFC,0xEA,0xFF,0x04,0xFC,0x20,0xFF,0xFF,0xF8,0xF0,0xFF,0x04,
+0xF8,0x1F,0xFF,0xFF,0xFC,0xEA,0xFF,0x04,0xFC,0x70,0x7F,0xFF,0xF8,0xF0,0xFF,0x05,
+0xFE,0x07,0xFF,0xFF,0xFC,0x67,0xEA,0xFF,0x03,0xF8,0x7F,0xFF,0xF8,0xEF,0xFF,0x04,
+0x80,0xFF,0xFF,0xFE,0x07,0xEA,0xFF,0x03,0xFC,0x3F,0xFF,0xF8,0xEF,0xFF,0x04,0xF0,
+0x3F,0xFF,0xF8,0x07,0xEA,0xFF,0x03,0xFE,0x1F,0xFF,0xF8,0xEF,0xFF,0x04,0xFC,0x07,
+0xFF,0xC0,0x0F,0xEA,0xFF,0x03,0x82,0x0F,0xFF,0xF8,0xEE,0xFF,0x03,0x00,0xFF,0x00,
+0x3F,0xEB,0xFF,0x04,0xFE,0x00,0x07,0xFF,0xF1,0xEE,0xFF,0x02,0xC0,0x3F,0x00,0xEA,
+0xFF,0x04,0xFE,0x00,0x07,0xFF,0xF9,0xEE,0xFF,0x02,0xFC,0x03,0x0F,0xEA,0xFF,0x03,
+0xFE,0x00,0x03,0xCF,0xEC,0xFF,0x01,0x00,0x1F,0xE8,0xFF,0x01,0xE1,0x8F,0xEC,0xFF,
+0x04,0xE0,0x01,0xFF,0xFF,0xFC,0xEB,0xFF,0x01,0xF0,0x0F,0xEC,0xFF,0x04,0xFC,0x00,
+0x0F,0xFF,0xFC,0xEB,0xFF,0x01,0xF8,0x0F,0xEB,0xFF,0x03,0xC0,0x00,0xFF,0xF8,0xEB,
+0xFF,0x01,0xFC,0x1F,0xEB,0xFF,0x03,0xFE,0x00,0x0F,0xF8,0xEB,0xFF,0x01,0xFC,0x0F,
+0xEA,0xFF,0x02,0xF0,0x00,0x30,0xEB,0xFF,0x01,0xFE,0x0F,0xE9,0xFF,0x01,0x80,0x00,
+0xEA,0xFF,0x00,0x07,0xE9,0xFF,0x02,0xF8,0x00,0x1F,0xEB,0xFF,0x00,0x87,0xE8,0xFF,
+0x01,0xC0,0x00,0xEB,0xFF,0x00,0x87,0xE8,0xFF,0x02,0xFC,0x00,0x01,0xEC,0xFF,0x00,
+0x87,0xE7,0xFF,0x02,0xE0,0x00,0x1F,0xED,0xFF,0x00,0xC7,0xE7,0xFF,0x03,0xE1,0x00,
+0x00,0x3F,0xEE,0xFF,0x00,0xEF,0xE7,0xFF,0x04,0xE3,0xFC,0x00,0x00,0x7F,0xD4,0xFF,
+0x04,0xC1,0xFF,0xC0,0x00,0x0F,0xD4,0xFF,0x05,0xE3,0xFF,0xFE,0x00,0x01,0xC3,0xFE,
+0xFF,0x01,0xFE,0x3F,0xDA,0xFF,0x0A,0xE7,0xFF,0xFF,0xF8,0x00,0x00,0x3F,0xFF,0xFF,
+0xFE,0x0F,0xD6,0xFF,0x06,0x00,0x00,0x01,0xFF,0xFF,0xFE,0x07,0xD6,0xFF,0x06,0xF0,
+0x00,0x00,0x07,0xFF,0xFE,0x03,0xD6,0xFF,0x06,0xF8,0xE0,0x00,0x00,0xFF,0xFE,0x03,
+0xD6,0xFF,0x07,0xE7,0xFC,0x00,0x00,0x07,0xFF,0x03,0xFB,0xD7,0xFF,0x07,0x07,0xFF,
+0xFC,0x00,0x00,0x0F,0x03,0xF8,0xD8,0xFF,0x09,0xFC,0x07,0xFF,0xFF,0xE0,0x00,0x00,
+0x03,0xF8,0x7F,0xF4,0xFF,0x00,0xBF,0xE7,0xFF,0x01,0xE0,0x0F,0xFE,0xFF,0x04,0xC0,
+0x00,0x00,0x7C,0x3F,0xF4,0xFF,0x00,0x3F,0xE7,0xFF,0x01,0x80,0x3F,0xFE,0xFF,0x04,
+0x06,0x00,0x00,0x06,0x1F,0xF4,0xFF,0x00,0x3F,0xE8,0xFF,0x01,0xFC,0x00,0xFE,0xFF,
+0x05,0xFC,0x0F,0xF8,0x00,0x00,0x1F,0xF5,0xFF,0x01,0xFE,0x7F,0xF2,0xFF,0x00,0xF3,
+0xFD,0xFF,0x00,0xE7,0xFE,0xFF,0x02,0xFB,0x00,0x07,0xFE,0xFF,0x05,0xC0,0x0F,0xFF,
+0xE0,0x00,0x0F,0xF5,0xFF,0x00,0xFE,0xF1,0xFF,0x00,0xF3,0xFD,0xFF,0x05,0x80,0x80,
+0x07,0xFF,0x80,0x01,0xFE,0xFF,0x06,0xFE,0x00,0x1F,0xFF,0xFF,0xC0,0x00,0xF5,0xFF,
+0x00,0xFC,0xF2,0xFF,0x01,0xFE,0x73,0xFD,0xFF,0x05,0x00,0x00,0x0F,0xFF,0x80,0x1F,
+0xFE,0xFF,0x07,0xF0,0x00,0x7F,0xFF,0xFF,0xFE,0x00,0x00,0xF6,0xFF,0x01,0xF5,0xCF,
+0xF3,0xFF,0x01,0xF8,0x13,0xFE,0xFF,0x05,0xFE,0x03,0xC1,0xFF,0xFC,0x00,0xFE,0xFF,
+0x02,0xFE,0x00,0x03,0xFD,0xFF,0x02,0xE0,0x00,0x7F,0xF7,0xFF,0x01,0xF7,0x8F,0xF3,
+0xFF,0x0A,0xF0,0x00,0x7E,0x0F,0xFF,0xFE,0x7F,0x87,0xFF,0xFF,0x03,0xFE,0xFF,0x02,
+0xC0,0x00,0x7F,0xFD,0xFF,0x02,0xFC,0x00,0x07,0xF7,0xFF,0x01,0xF1,0x9F,0xF2,0xFF,
+0x0E,0x00,0x00,0x0F,0xFF,0xFF,0xFC,0x0F,0xFF,0xFF,0x83,0xFF,0xFF,0xFC,0x00,0x1F,
+0xFB,0xFF,0x01,0xE0,0x0F,0xF7,0xFF,0x01,0xF1,0xBF,0xF2,0xFF,0x0D,0xFC,0x00,0x0F,
+0xFF,0xFF,0xF0,0x7F,0xFF,0xFF,0xEF,0xFF,0xF0,0x00,0x07,0xF9,0xFF,0x00,0x0F,0xE5,
+0xFF,0x04,0x87,0x7F,0xFF,0xFF,0xC3,0xFD,0xFF,0x03,0x87,0xE0,0x00,0x7F,0xF4,0xFF,
+0x00,0x7F,0xEA,0xFF,0x00,0x8F,0xF9,0xFF,0x02,0x07,0xC0,0x07,0xF4,0xFF,0x01,0xFE,
+0x1F,0xFB,0xFF,0x00,0x7F,0xF1,0xFF,0x00,0xCF,0xF9,0xFF,0x02,0xBF,0x00,0x1F,0xF3,
+0xFF,0x00,0x1F,0xFB,0xFF,0x00,0x3F,0xE8,0xFF,0x02,0xFE,0x00,0x7F,0xF3,0xFF,0x00,
+0x1F,0xFC,0xFF,0x01,0xFC,0x8F,0xE8,0xFF,0x01,0xFC,0x7F,0xF2,0xFF,0x00,0x8F,0xFC,
+0xFF,0x01,0xFC,0x6F,0xE8,0xFF,0x00,0xFE,0xF3,0xFF,0x02,0xC0,0xFF,0x87,0xFC,0xFF,
+0x01,0xFE,0x37,0xD9,0xFF,0x03,0x80,0x1F,0xC7,0xFD,0xFC,0xFF,0x00,0x1B,0xD9,0xFF,
+0x03,0xF0,0x07,0xC7,0xFD,0xFC,0xFF,0x00,0xC7,0xD9,0xFF,0x06,0xFC,0x00,0x07,0xFD,
+0xFF,0xFF,0xEF,0xD5,0xFF,0x05,0x80,0x07,0xFD,0xFF,0xFF,0xEF,0xE7,0xFF,0x00,0xFC,
+0xF0,0xFF,0x05,0xF8,0x01,0xFD,0xFF,0xFF,0xE7,0xE7,0xFF,0x00,0xF9,0xEF,0xFF,0x04,
+0x00,0x3D,0xFF,0xFF,0xE7,0xE7,0xFF,0x00,0xF1,0xEF,0xFF,0x04,0xC0,0x0D,0xFF,0xC7,
+0xE7,0xE7,0xFF,0x00,0xC7,0xEF,0xFF,0x04,0xF8,0x01,0xFF,0xE3,0xE3,0xE7,0xFF,0x00,
+0x0F,0xEF,0xFF,0x04,0xFC,0x00,0xFF,0xE1,0xE3,0xE8,0xFF,0x01,0xFE,0x3F,0xEF,0xFF,
+0x04,0xFC,0x00,0xFF,0xF0,0xF3,0xE8,0xFF,0x01,0xF0,0x7F,0xEF,0xFF,0x04,0xFE,0x00,
+0x7F,0xF8,0x31,0xE9,0xFF,0x01,0xFC,0x01,0xEE,0xFF,0x04,0xFE,0x00,0x7F,0xFC,0x01,
+0xE9,0xFF,0x01,0xF0,0x07,0xED,0xFF,0x03,0x00,0x3F,0xFF,0x81,0xE9,0xFF,0x01,0xE0,
+0x7F,0xED,0xFF,0x04,0x00,0x3F,0xFF,0xC0,0xBF,0xEA,0xFF,0x00,0xE1,0xEC,0xFF,0x03,
+0x80,0xBF,0xFF,0xE0,0xFE,0xFF,0x00,0x3F,0xD7,0xFF,0x03,0x81,0xFF,0xFF,0xF0,0xFE,
+0xFF,0x00,0x3F,0xD7,0xFF,0x07,0xC1,0xFF,0xFF,0xF8,0x7F,0xFF,0xFF,0x1F,0xD7,0xFF,
+0x07,0xE3,0xFF,0xFF,0xF8,0x7F,0xFF,0xFF,0x0F,0xD7,0xFF,0x07,0xE7,0xFF,0xFF,0xFC,
+0x3F,0xFF,0xFF,0x8F,0xD4,0xFF,0x04,0xFC,0x3F,0xFF,0xFF,0xC7,0xD4,0xFF,0x04,0xFC,
+0x1F,0xFF,0xFF,0xE3,0xD4,0xFF,0x04,0xFC,0x1F,0xFF,0xFF,0xE1,0xD4,0xFF,0x04,0xFC,
+0x1F,0xFF,0xDF,0xF1,0xD4,0xFF,0x04,0xFC,0x0F,0xFF,0xCF,0xF0,0xD4,0xFF,0x04,0xFE,
+0x0F,0xFF,0xCF,0xF8,0xD3,0xFF,0x04,0x03,0xFF,0xC7,0xF8,0x7F,0xD4,0xFF,0x04,0x01,
+0xFF,0xC7,0xFC,0x7F,0xD4,0xFF,0x04,0x80,0x7F,0xC7,0xFE,0x3F,0xD4,0xFF,0x04,0x80,
+0x1F,0xC3,0xFE,0x3F,0xE2,0xFF,0x00,0xFC,0xF4,0xFF,0x04,0xE6,0x07,0xC3,0xFE,0x1F,
+0xE2,0xFF,0x01,0xF0,0x7F,0xF4,0xFF,0x03,0x00,0x83,0xFF,0x1F,0xE2,0xFF,0x01,0xF0,
+0x3F,0xF4,0xFF,0x03,0xE0,0x03,0xFF,0x1F,0xE2,0xFF,0x01,0xF8,0x0F,0xF4,0xFF,0x03,
+0xF0,0x03,0xFF,0x8F,0xE2,0xFF,0x01,0xFE,0x07,0xF4,0xFF,0x03,0xFC,0x03,0xFF,0x87,
+0xE1,0xFF,0x02,0x81,0xFF,0x3F,0xF5,0xFF,0x02,0x01,0xFF,0xC3,0xE1,0xFF,0x02,0xE0,
+0x7C,0x1F,0xF5,0xFF,0x02,0xC0,0x7F,0xC1,0xE1,0xFF,0x02,0xF8,0x38,0x1F,0xF5,0xFF,
+0x02,0xE0,0x1F,0xC1,0xE0,0xFF,0x01,0x80,0x1F,0xF5,0xFF,0x02,0xF8,0x07,0xC0,0xE0,
+0xFF,0x01,0x00,0x3F,0xF5,0xFF,0x02,0xFE,0x01,0xC0,0xE1,0xFF,0x01,0xF8,0x00,0xF3,
+0xFF,0x01,0xC0,0xE0,0xE2,0xFF,0x02,0xE1,0x00,0x1F,0xF3,0xFF,0x01,0xC0,0x20,0xE2,
+0xFF,0x01,0xC0,0x01,0xF2,0xFF,0x02,0xC0,0x00,0x7F,0xE3,0xFF,0x01,0xC0,0x0F,0xF2,
+0xFF,0x02,0x80,0x00,0x7F,0xE3,0xFF,0x01,0x80,0x7F,0xF2,0xFF,0x02,0x83,0x00,0x7F,
+0xE3,0xFF,0x00,0x83,0xF1,0xFF,0x02,0x87,0xC0,0x7F,0xE3,0xFF,0x00,0xDF,0xF1,0xFF,
+0x02,0xBF,0xF0,0x3F,0xD1,0xFF,0x01,0xF8,0x0F,0xD1,0xFF,0x01,0xFE,0x07,0xD0,0xFF,
+0x00,0x03,0xD0,0xFF,0x00,0xC0,0xD0,0xFF,0x01,0xE0,0x7F,0xD1,0xFF,0x01,0xF8,0x1F,
+0xD1,0xFF,0x01,0xFC,0x07,0xD1,0xFF,0x01,0xFE,0x03,0xD0,0xFF,0x00,0x81,0xD0,0xFF,
+0x00,0xC0,0xD0,0xFF,0x01,0xF0,0x7F,0xD1,0xFF,0x01,0xF8,0x1F,0xD1,0xFF,0x01,0xFC,
+0x0F,0xD0,0xFF,0x00,0x07,0xD0,0xFF,0x00,0x83,0xD0,0xFF,0x00,0xC0,0xD0,0xFF,0x01,
+0xF0,0x7F,0xD1,0xFF,0x01,0xF8,0x1F,0xD1,0xFF,0x01,0xFE,0x0F,0xD0,0xFF,0x00,0x03,
+0xD0,0xFF,0x00,0xC1,0xD0,0xFF,0x01,0xE0,0x7F,0xD1,0xFF,0x01,0xF0,0x1F,0xD1,0xFF,
+0x01,0xFC,0x0F,0xD1,0xFF,0x01,0xFE,0x03,0xD0,0xFF,0x00,0x01,0xFC,0xFF,0x00,0xFB,
+0xD6,0xFF,0x00,0xC0,0xFC,0xFF,0x00,0xC1,0xD6,0xFF,0x01,0xE0,0x7F,0xFD,0xFF,0x00,
+0x83,0xD9,0xFF,0x04,0x47,0xF7,0xFF,0xF0,0x3F,0xFD,0xFF,0x00,0x83,0xD9,0xFF,0x04,
+0x03,0xE7,0xFF,0xF8,0x1F,0xFD,0xFF,0x00,0x03,0xD9,0xFF,0x04,0x00,0x01,0xFF,0xFE,
+0x07,0xFE,0xFF,0x01,0xFC,0x03,0xD9,0xFF,0x04,0x00,0x00,0xFF,0xFF,0x03,0xFE,0xFF,
+0x01,0xFC,0x03,0xDA,0xFF,0x05,0xFE,0x00,0x00,0xFF,0xFF,0x01,0xFE,0xFF,0x01,0xF0,
+0x03,0xDA,0xFF,0x05,0xFE,0x00,0x00,0xFF,0xFE,0x00,0xFE,0xFF,0x01,0xE0,0x03,0xDA,
+0xFF,0x0A,0xFC,0x00,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0xC0,0x07,0xDA,0xFF,0x0A,
+0xFC,0x00,0x00,0x7F,0xFF,0x10,0x3F,0xFC,0xFF,0x00,0x0F,0xDA,0xFF,0x0A,0xFC,0x00,
+0x01,0xFF,0xFF,0xF8,0x1F,0xFC,0x3E,0x00,0x0F,0xDA,0xFF,0x0A,0xFE,0x00,0x03,0xFF,
+0xFF,0xFC,0x0F,0xFC,0x0C,0x00,0x1F,0xDA,0xFF,0x0A,0xF8,0x00,0x03,0xFF,0xFF,0xFE,
+0x07,0xFE,0x00,0x00,0x0F,0xDA,0xFF,0x02,0xFA,0x00,0x01,0xFE,0xFF,0x04,0x03,0xFE,
+0x00,0x00,0x0F,0xDA,0xFF,0x02,0xF7,0x00,0x01,0xFE,0xFF,0x04,0x81,0xFF,0x00,0x00,
+0x1F,0xDA,0xFF,0x02,0xFE,0x00,0x03,0xFE,0xFF,0x04,0xC0,0xFF,0x80,0x00,0x3F,0xDA,
+0xFF,0x02,0xFC,0x00,0x03,0xFE,0xFF,0x04,0xE0,0x7F,0xC0,0x03,0x7F,0xDA,0xFF,0x02,
+0xF8,0x40,0x03,0xFE,0xFF,0x03,0xE0,0x3F,0xC0,0x03,0xD9,0xFF,0x02,0xF8,0xC0,0x03,
+0xFE,0xFF,0x03,0xF0,0x1F,0xE0,0x01,0xD8,0xFF,0x01,0x80,0x07,0xFE,0xFF,0x03,0xF8,
+0x0F,0xC0,0x03,0xD8,0xFF,0x01,0x80,0x0F,0xFE,0xFF,0x03,0xF8,0x07,0x80,0x27,0xD8,
+0xFF,0x01,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x07,0x00,0x4F,0xD9,0xFF,0x02,0xF6,0x00,
+0x1F,0xFE,0xFF,0x03,0xFE,0x02,0x00,0x9F,0xD9,0xFF,0x02,0xCC,0x00,0x3F,0xFE,0xFF,
+0x03,0xF7,0x00,0x01,0x3F,0xD9,0xFF,0x02,0x98,0x00,0x3F,0xFE,0xFF,0x03,0xE1,0x80,
+0x02,0x7F,0xDA,0xFF,0x03,0xC7,0x30,0x80,0x7F,0xFE,0xFF,0x02,0xF0,0x00,0x07,0xDA,
+0xFF,0x03,0xF8,0x1E,0x70,0x80,0xFD,0xFF,0x02,0xF0,0x00,0x1B,0xDA,0xFF,0x03,0xF0,
+0x3E,0xE0,0x03,0xFD,0xFF,0x02,0xF8,0x00,0x03,0xDA,0xFF,0x03,0xF0,0x3D,0xC0,0x07,
+0xFD,0xFF,0x02,0xF8,0x00,0x07,0xDA,0xFF,0x03,0xF8,0x18,0xC0,0x07,0xFD,0xFF,0x02,
+0xF8,0x00,0x0F,0xDA,0xFF,0x03,0xFC,0x31,0xC0,0x0F,0xFD,0xFF,0x02,0xF8,0x00,0x07,
+0xDB,0xFF,0x04,0xFE,0x00,0x74,0x00,0x1F,0xFD,0xFF,0x02,0xE0,0x00,0x03,0xDB,0xFF,
+0x04,0xFE,0x00,0xE6,0x20,0x3F,0xFD,0xFF,0x02,0x80,0x00,0x01,0xDA,0xFF,0x03,0x00,
+0xDC,0x00,0x3F,0xFD,0xFF,0x02,0x00,0x01,0x80,0xDA,0xFF,0x03,0xC1,0xCC,0x00,0x7F,
+0xFE,0xFF,0x04,0xFC,0x00,0x01,0xE0,0x7F,0xDB,0xFF,0x02,0xC3,0x08,0x30,0xFD,0xFF,
+0x04,0xF0,0x00,0x03,0xF0,0x3F,0xDB,0xFF,0x02,0xC2,0x10,0x40,0xFD,0xFF,0x04,0xE0,
+0x00,0x0F,0xF8,0x0F,0xDB,0xFF,0x05,0x84,0x10,0x01,0xFF,0xFF,0xF0,0xFE,0x00,0x02,
+0x3F,0xFC,0x07,0xDB,0xFF,0x05,0x8C,0x20,0x03,0xFF,0xFF,0xC0,0xFE,0x00,0x02,0xFF,
+0xFC,0x07,0xDB,0xFF,0x0C,0x00,0x40,0x87,0xFF,0xFF,0xC0,0x00,0x00,0x01,0xFF,0xFE,
+0x00,0x03,0xDD,0xFF,0x0D,0xFE,0x10,0x00,0x07,0xFF,0xFF,0x80,0x00,0x00,0x03,0xFF,
+0xFE,0x00,0x00,0xDD,0xFF,0x05,0xFC,0x30,0x80,0x0F,0xFF,0xFF,0xFC,0x00,0x03,0x3E,
+0x00,0x00,0x7F,0xDE,0xFF,0x05,0xFC,0x01,0x00,0x1F,0xFF,0xFF,0xF9,0x00,0x00,0x7F,
+0xDE,0xFF,0x05,0xF8,0x40,0x00,0x1F,0xFF,0xFF,0xF9,0x00,0x00,0x0F,0xDE,0xFF,0x05,
+0xF8,0x82,0x00,0x3F,0xFF,0xFF,0xF9,0x00,0x00,0x0F,0xDE,0xFF,0x05,0xF0,0x04,0x08,
+0x7F,0xFF,0xFC,0xFE,0x00,0x00,0x02,0xFD,0x00,0x00,0x1F,0xDE,0xFF,0x05,0xE1,0x08,
+0x00,0x7F,0xFF,0xF0,0xFE,0x00,0x04,0x03,0xF8,0x3F,0xC0,0x07,0xDD,0xFF,0x05,0xC0,
+0x08,0x00,0xFF,0xFF,0xC0,0xFE,0x00,0x02,0x03,0xF8,0x7F,0xDB,0xFF,0x04,0xC2,0x10,
+0x01,0xFF,0xFC,0xFD,0x00,0x01,0x03,0xF8,0xDA,0xFF,0x04,0x04,0x00,0x01,0xFF,0xE0,
+0xFD,0x00,0x01,0x03,0xF8,0xDA,0xFF,0x03,0x84,0x20,0x03,0xFE,0xFE,0x00,0x03,0x07,
+0xFE,0x03,0xF9,0xDB,0xFF,0x04,0xFE,0x00,0x40,0x07,0xE0,0xFE,0x00,0x00,0x3F,0xD8,
+0xFF,0x00,0xFE,0xFB,0x00,0x00,0x03,0xD7,0xFF,0x01,0xFC,0x10,0xFC,0x00,0x00,0x1F,
+0xF6,0xFF,0x00,0xDF,0xFE,0xFF,0x00,0xF7,0xF6,0xFF,0x00,0x9F,0xF3,0xFF,0x01,0xF8,
+0x20,0xFC,0x00,0x00,0x7F,0xF6,0xFF,0x00,0x9F,0xFE,0xFF,0x10,0xF3,0xFF,0xFF,0xFB,
+0xFE,0xFF,0xFF,0xFC,0x00,0x1F,0xFF,0xFF,0x8F,0xFF,0xFF,0xFE,0x00,0xF7,0xFF,0x00,
+0xF0,0xFC,0x00,0x00,0x03,0xF5,0xFF,0x15,0x9F,0xFF,0xFE,0x03,0xE0,0x03,0xFF,0xC1,
+0xF8,0x03,0xFF,0x80,0x00,0x03,0xFF,0xFF,0x8F,0xFF,0xFF,0xF0,0x00,0x1F,0xF8,0xFF,
+0x01,0xF0,0x40,0xFD,0x00,0x00,0x1F,0xF5,0xFF,0x15,0x9F,0xFF,0xFE,0x02,0x00,0x01,
+0xFF,0x81,0xC0,0x01,0xFF,0xC0,0xFF,0xC3,0xFF,0x38,0x00,0x1B,0xFF,0x80,0x00,0x1F,
+0xF8,0xFF,0x00,0xF0,0xFC,0x00,0xF4,0xFF,0x15,0x9F,0xFF,0xFE,0x0E,0x00,0x03,0xFE,
+0x03,0x00,0x01,0xFF,0xE3,0xFF,0xE7,0xFE,0x00,0x00,0x03,0xFF,0x00,0x7C,0x1F,0xF8,
+0xFF,0x00,0xE0,0xFD,0x00,0x00,0x03,0xF4,0xFF,0x15,0x80,0x0F,0xFE,0x3E,0x06,0xFF,
+0xFE,0x03,0x00,0x7F,0xFF,0xE7,0x00,0x0F,0xFE,0x00,0x07,0x03,0xFF,0x00,0xF8,0x3F,
+0xF8,0xFF,0x00,0xC0,0xFD,0x00,0x00,0x3F,0xF5,0xFF,0x15,0xF0,0x00,0x07,0xFF,0xFE,
+0x4E,0xFF,0xFF,0x07,0x0C,0x7F,0xFF,0xE0,0x00,0x0F,0xFE,0x00,0x0F,0xC7,0xFF,0xFC,
+0x30,0xF7,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x0F,0xF4,0xFF,0x15,0x00,0x00,0x07,0xFF,
+0x87,0xCC,0xFF,0xFF,0x87,0xFC,0x07,0xFF,0xE0,0x00,0x1F,0xFF,0x07,0x0F,0xCF,0xFF,
+0xFF,0x01,0xF7,0xFF,0x03,0x80,0x00,0x00,0x01,0xF3,0xFF,0x15,0x00,0x00,0x07,0xFE,
+0x0F,0x10,0x03,0xFF,0xE7,0xE0,0x01,0xFF,0xE3,0xFF,0xDF,0xFF,0x8F,0x00,0x0F,0xFF,
+0xFF,0x87,0xF7,0xFF,0xFE,0x00,0x00,0x1F,0xF3,0xFF,0x15,0x00,0x1F,0xFF,0xFE,0x1E,
+0x00,0x03,0xFF,0xE7,0x00,0x01,0xFF,0xE7,0x00,0x1F,0xFF,0x88,0x00,0x0F,0xFF,0xFF,
+0xC7,0xF8,0xFF,0x03,0xFE,0x00,0x00,0x03,0xF2,0xFF,0x16,0x03,0x8F,0xFF,0xFF,0xFE,
+0x00,0x03,0xFF,0xE7,0x00,0x03,0xFF,0xE0,0x00,0x1F,0xFF,0x80,0x00,0x1F,0xFF,0xF0,
+0x00,0x7F,0xF9,0xFF,0x03,0xFC,0x00,0x00,0x07,0xF1,0xFF,0x15,0x07,0xFF,0xFF,0xC6,
+0x04,0xFF,0xFF,0xE7,0x3C,0xFF,0xFF,0xC0,0x18,0x1F,0xFF,0x80,0x1F,0x1F,0xFF,0x80,
+0x00,0x00,0xF9,0xFF,0x03,0xF8,0x00,0x00,0x0F,0xF1,0xFF,0x12,0x07,0xFF,0xFF,0x0F,
+0xFC,0xFF,0xFF,0xE7,0xFC,0xFF,0xFF,0x87,0x3B,0xFF,0xFF,0x82,0x3F,0x1F,0xFC,0xFE,
+0x00,0xF9,0xFF,0x03,0xF0,0x00,0x00,0x0F,0xF1,0xFF,0x15,0x23,0xFF,0xFE,0x1F,0xE0,
+0x03,0xFF,0xE7,0xE0,0x07,0xFF,0xFF,0x3B,0xFF,0xFF,0x9E,0x3F,0x1F,0xF8,0x00,0xE7,
+0x01,0xF9,0xFF,0x03,0xE0,0x00,0x00,0x1F,0xF2,0xFF,0x16,0xFE,0x71,0xFF,0xFF,0xFE,
+0x00,0x01,0xFF,0xE7,0x00,0x03,0xFF,0xFF,0x3B,0xCF,0xFF,0x3E,0x00,0x3F,0xF8,0x0F,
+0xE7,0xC3,0xF9,0xFF,0x03,0xC0,0x00,0x00,0x3F,0xF2,0xFF,0x15,0xFC,0x78,0xFF,0xFF,
+0xE6,0x00,0x03,0xFF,0xE7,0x00,0x03,0xFF,0xC3,0x33,0x07,0xFF,0x38,0x00,0x3F,0xFC,
+0x7F,0xE7,0xF8,0xFF,0xFE,0x00,0x00,0x3F,0xF2,0xFF,0x15,0xFC,0xF8,0x7F,0xFF,0x8E,
+0x1C,0xFF,0xFF,0xE7,0x1C,0x7F,0xFF,0xC3,0x33,0x8F,0xFF,0x00,0x00,0x3F,0xFF,0xFF,
+0xE7,0xF9,0xFF,0x00,0xF8,0xFE,0x00,0x00,0x7F,0xF2,0xFF,0x11,0xF8,0xFC,0x3F,0xFF,
+0x1F,0xFD,0xFF,0xFF,0xE7,0xFC,0x7F,0xFF,0xC7,0x33,0xFF,0xFF,0x00,0x3F,0xFE,0xFF,
+0x00,0xE7,0xFA,0xFF,0x00,0xF0,0xFD,0x00,0xF1,0xFF,0x15,0xF1,0xFC,0x0F,0xFE,0x00,
+0x3D,0xFF,0xFF,0xE7,0xFC,0x7F,0xBF,0xFE,0x00,0xFF,0xFF,0x1E,0x3F,0xFF,0x7F,0xFF,
+0xC7,0xFA,0xFF,0x00,0x80,0xFD,0x00,0xF1,0xFF,0x15,0xC3,0xFE,0x03,0xFE,0x00,0x00,
+0x3F,0xBF,0xE7,0x80,0x00,0x7F,0xC0,0x00,0x1E,0x7F,0x7F,0x3F,0xFC,0x7F,0xFF,0xCF,
+0xFB,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x01,0xF2,0xFF,0x04,0xFC,0x07,0xFE,0x00,0x7E,
+0xFE,0x00,0x04,0x7F,0xE4,0x00,0x00,0x7C,0xFE,0x00,0x06,0x7F,0xFF,0x00,0x18,0x7F,
+0xFF,0x8F,0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x01,0xF2,0xFF,0x16,0xFC,0x0F,0xFF,
+0x00,0xFE,0xFF,0xC0,0x00,0x7F,0xE4,0x00,0x00,0xFC,0x07,0xFE,0x00,0xFF,0xFF,0x00,
+0x00,0xFF,0xFE,0x0F,0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x03,0xF2,0xFF,0x16,0xFC,
+0x3F,0xFF,0x01,0xFF,0xFF,0xFC,0x00,0xFF,0xE4,0x1F,0xF0,0xFC,0x3F,0xFF,0xC0,0xFF,
+0xFF,0x00,0x00,0xFF,0xE0,0x1F,0xFB,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x07,0xEF,0xFF,
+0x00,0x83,0xFE,0xFF,0x02,0x80,0xFF,0xEF,0xFC,0xFF,0x07,0xF1,0xFF,0xFF,0xFE,0x00,
+0xFF,0xF8,0x7F,0xFA,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x07,0xEB,0xFF,0x02,0xE3,0xFF,
+0xF7,0xF8,0xFF,0x00,0x81,0xF7,0xFF,0x00,0x80,0xFE,0x00,0x00,0x0F,0xD4,0xFF,0x00,
+0x80,0xFE,0x00,0x00,0x0F,0xD4,0xFF,0xFD,0x00,0x00,0x1F,0xD5,0xFF,0x00,0xF8,0xFD,
+0x00,0x00,0x1F,0xD5,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x1F,0xD5,0xFF,0x00,0xE0,0xFD,
+0x00,0x00,0x3F,0xD5,0xFF,0xFC,0x00,0x00,0x3F,0xD6,0xFF,0x00,0xFE,0xFC,0x00,0x00,
+0x7F,0xE7,0xFF,0x06,0xFC,0x7F,0xFC,0x7F,0xFF,0xFF,0xF8,0xF7,0xFF,0x00,0xFE,0xFC,
+0x00,0xE6,0xFF,0x02,0xFB,0xFF,0xFB,0xFE,0xFF,0x00,0xF7,0xF7,0xFF,0x00,0xFE,0xFD,
+0x00,0x00,0x01,0xE6,0xFF,0x06,0xF7,0xFF,0xF7,0xEF,0xFF,0xFF,0xEF,0xF7,0xFF,0x00,
+0xFE,0xFD,0x00,0x00,0x01,0xE6,0xFF,0x06,0xF7,0xFF,0xF7,0xEF,0xFF,0xFF,0xEF,0xF7,
+0xFF,0x00,0xFE,0xFD,0x00,0x00,0x03,0xE6,0xFF,0x02,0xE7,0xFF,0xE7,0xFE,0xFF,0x00,
+0xEF,0xF7,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x03,0xE6,0xFF,0x02,0xEF,0xFF,0xEF,0xFE,
+0xFF,0x00,0xCF,0xF7,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x03,0xF0,0xFF,0x15,0x86,0xEE,
+0x1B,0xBC,0x37,0x7F,0xF8,0x78,0x7E,0x1F,0x0F,0xFF,0x0F,0x8F,0x8F,0x89,0xDF,0xC3,
+0xE7,0xBF,0xF1,0xC4,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x07,0xF1,0xFF,0x16,0xFE,
+0x4C,0xE9,0x33,0xB2,0x67,0x7F,0xF6,0x76,0x7D,0x9E,0xCF,0xFE,0xCF,0x5F,0x6F,0x45,
+0xDF,0xB3,0xD3,0xBF,0xED,0xA2,0xFC,0xFF,0x05,0xFE,0x00,0x01,0x00,0x00,0x07,0xF1,
+0xFF,0x16,0xFE,0xCC,0xEB,0x33,0xB6,0x67,0x7F,0xEE,0xF7,0x7D,0xDD,0xCF,0xFD,0xCF,
+0xDF,0x7F,0xDD,0xDF,0x77,0xFB,0xBF,0xCF,0xE6,0xFC,0xFF,0x00,0xFE,0xFD,0x00,0x00,
+0x07,0xF0,0xFF,0x15,0x9D,0xEE,0x77,0xBC,0xEF,0x7F,0xEE,0xEF,0x7B,0xDD,0xCF,0xFD,
+0xCF,0x9F,0x3F,0xDD,0xDF,0x77,0xF9,0xBF,0xDF,0xEE,0xFC,0xFF,0x00,0xFE,0xFD,0x00,
+0x00,0x0F,0xF0,0xFF,0x15,0x9D,0xDE,0x77,0x7C,0xEE,0xFF,0xDC,0xEF,0x7B,0xDB,0x8F,
+0x0B,0x8F,0x9F,0xBF,0xBD,0x9E,0xE7,0xFD,0x7F,0x9F,0xCE,0xFC,0xFF,0x00,0xFE,0xFD,
+0x00,0x00,0x0F,0xF0,0xFF,0x15,0x9D,0xDE,0x77,0x7C,0xEE,0xFF,0xDC,0xEF,0x7B,0xDB,
+0x9F,0xFB,0x9F,0xBF,0xDF,0xBB,0xBE,0xE7,0xFD,0x7F,0x9F,0xDD,0xFC,0xFF,0x00,0xFE,
+0xFD,0x00,0x00,0x0F,0xF0,0xFF,0x15,0x99,0xBE,0x66,0xFC,0xCD,0xFF,0xDC,0xEE,0xFB,
+0xBB,0x9F,0xFB,0x9F,0x3D,0xDF,0xBB,0xB6,0xE7,0xFD,0x7F,0x9F,0xDD,0xFC,0xFF,0x00,
+0xFE,0xFD,0x00,0x00,0x1F,0xF0,0xFF,0x16,0x95,0x7E,0x55,0xFC,0xAB,0xF7,0xD9,0xE6,
+0xF9,0xBB,0x17,0xFB,0x17,0x2D,0xDF,0xB7,0xAE,0xC3,0xFC,0xF7,0x9B,0xDD,0x7F,0xFD,
+0xFF,0x00,0xFE,0xFD,0x00,0x00,0x1F,0xF0,0xFF,0x15,0x8C,0xFE,0x33,0xFC,0x67,0xE7,
+0xC5,0xE1,0xF8,0x78,0x8F,0xF8,0x8F,0x1E,0x3F,0x0F,0x9E,0x27,0xFC,0xE7,0xC7,0xFC,
+0xFC,0xFF,0x05,0xFE,0x00,0x00,0x20,0x00,0x1F,0xEA,0xFF,0x00,0xCD,0xF9,0xFF,0x03,
+0x3F,0xFF,0xFF,0xFD,0xF9,0xFF,0x05,0xFE,0x00,0x01,0xFC,0x00,0x1F,0xEA,0xFF,0x00,
+0xBD,0xF9,0xFF,0x03,0x7F,0xFF,0xFF,0xFB,0xF8,0xFF,0x00,0x05,0xE6,0xFF,0x00,0x79,
+0xF9,0xFF,0x03,0x7F,0xFF,0xFF,0xFB,0xDC,0xFF,0x00,0x79,0xFA,0xFF,0x04,0xFE,0x7F,
+0xFF,0xFF,0xF7,0xDC,0xFF,0x00,0x73,0xFA,0xFF,0x04,0xFC,0x1F,0xFF,0xFF,0x0F,0xDC,
+0xFF,0x00,0x87,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xEA,
+0xFF,
+};
+#endif
+
+// BitmapExample2 : 15000 bytes, packed 1864
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0xFA,0xFF,0x00,0xCF,0xD0,0xFF,0x00,0x87,0xD0,0xFF,0x00,0x03,
+0xD1,0xFF,0x01,0xFE,0x00,0xD1,0xFF,0x01,0xFC,0x00,0xD1,0xFF,0x02,0xFC,0x00,0x7F,
+0xD2,0xFF,0x02,0xF8,0x00,0x7F,0xD2,0xFF,0x02,0xF8,0x00,0x7F,0xD2,0xFF,0x01,0xF8,
+0x00,0xD1,0xFF,0x01,0xF8,0x00,0xD1,0xFF,0x01,0xF8,0x01,0xD1,0xFF,0x01,0xFC,0x03,
+0xD1,0xFF,0x01,0xFC,0x67,0xD1,0xFF,0x00,0xFE,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0xF7,0xFF,0x01,0xF8,0x7F,0xD1,0xFF,0x01,0xE0,0x3F,0xD1,
+0xFF,0x01,0xF0,0x1F,0xD1,0xFF,0x01,0xF0,0x07,0xD1,0xFF,0x01,0xF8,0x07,0xD1,0xFF,
+0x01,0xF8,0x03,0xD1,0xFF,0x01,0xFC,0x01,0xD1,0xFF,0x01,0xFE,0x00,0xD1,0xFF,0x01,
+0xFE,0x00,0xD0,0xFF,0x01,0x00,0x7F,0xD1,0xFF,0x01,0x80,0x7F,0xD8,0xFF,0x00,0xBF,
+0xFD,0xFF,0x03,0xFC,0x7F,0x80,0x3F,0xD8,0xFF,0x01,0x30,0x07,0xFE,0xFF,0x03,0xF0,
+0x1F,0xC0,0x3F,0xDC,0xFF,0x00,0x8F,0xFE,0xFF,0x01,0x00,0x07,0xFE,0xFF,0x03,0xF0,
+0x07,0xE0,0x3F,0xDD,0xFF,0x06,0xFE,0x01,0xE3,0xFF,0xFE,0x00,0x01,0xFE,0xFF,0x03,
+0xF0,0x01,0xE0,0x3F,0xDD,0xFF,0x06,0xFC,0x00,0xF1,0xFF,0xFC,0x00,0x00,0xFE,0xFF,
+0x03,0xF0,0x00,0x70,0x3F,0xDD,0xFF,0x06,0xFC,0x00,0xE0,0xFF,0xF8,0x00,0x00,0xFE,
+0xFF,0x03,0xE0,0x00,0x78,0x1F,0xDD,0xFF,0x0D,0xFC,0x00,0xE0,0xFF,0xF0,0x00,0x00,
+0x7F,0xFF,0xFF,0xE0,0x00,0x38,0x1F,0xDD,0xFF,0x0D,0xF8,0x00,0x70,0x7F,0xE0,0x00,
+0x00,0x7F,0xFF,0xFF,0xC0,0x00,0x18,0x3F,0xDD,0xFF,0x0D,0xF0,0x00,0x30,0x3F,0xE0,
+0x00,0x00,0x7F,0xFF,0xFF,0xE0,0x00,0x1C,0x3F,0xDD,0xFF,0x0D,0xF0,0x00,0x70,0x3F,
+0xE0,0x00,0x00,0x3F,0xFF,0xFF,0xE0,0x00,0x1C,0x3F,0xDD,0xFF,0x0D,0xF0,0x00,0x70,
+0x3F,0xE0,0x00,0x00,0x3F,0xFF,0xFF,0xE0,0x00,0x1F,0x33,0xDD,0xFF,0x0D,0xF0,0x00,
+0x70,0x3F,0xE0,0x00,0x00,0x3F,0xFF,0xFF,0xE0,0x00,0x1F,0x23,0xEE,0xFF,0x00,0x8F,
+0xF1,0xFF,0x0D,0xF0,0x00,0x78,0x3F,0xE0,0x00,0x00,0x7F,0xFF,0xFF,0xE0,0x00,0x0F,
+0xE1,0xEF,0xFF,0x01,0xFC,0x07,0xF1,0xFF,0x0D,0xF0,0x00,0x78,0x07,0xF0,0x00,0x00,
+0x7F,0xFF,0xFF,0xE0,0x00,0x0F,0xE1,0xEF,0xFF,0x01,0xE0,0x07,0xF1,0xFF,0x0D,0xF8,
+0x00,0x3C,0x03,0xF0,0x00,0x00,0x7F,0xFF,0xFF,0xE0,0x00,0x0F,0xE1,0xEF,0xFF,0x05,
+0xC0,0x0F,0xFF,0xFF,0xF8,0x07,0xF5,0xFF,0x0D,0xFE,0x61,0xFE,0x07,0xF0,0x00,0x00,
+0x7F,0xFF,0xFF,0xF0,0x00,0x07,0xE0,0xEF,0xFF,0x06,0x00,0x0F,0xFF,0xFF,0xF0,0x00,
+0x1F,0xF5,0xFF,0x0C,0x7C,0xFF,0x01,0xF0,0x00,0x00,0x7F,0xFF,0xFF,0xF8,0x00,0x07,
+0xF0,0xF0,0xFF,0x07,0xFC,0x00,0x07,0xFF,0xFF,0xC0,0x00,0x0F,0xF5,0xFF,0x06,0x00,
+0x0E,0x01,0xF0,0x00,0x00,0x7F,0xFE,0xFF,0x02,0x80,0x07,0xF0,0xF0,0xFF,0x07,0xF8,
+0x00,0x03,0xFF,0xFF,0xC0,0x00,0x03,0xF5,0xFF,0x06,0x00,0x04,0x00,0x70,0x00,0x00,
+0x7F,0xFE,0xFF,0x02,0x80,0x07,0xF0,0xF0,0xFF,0x07,0xF0,0x00,0x00,0x7F,0xFF,0x80,
+0x00,0x0F,0xF5,0xFF,0xFE,0x00,0x02,0x78,0x00,0x20,0xFD,0xFF,0x02,0xC0,0x0F,0xF0,
+0xF0,0xFF,0x07,0xE0,0x00,0x00,0x0F,0xFF,0x80,0x00,0x0F,0xF5,0xFF,0x05,0x80,0x00,
+0x00,0x1C,0x00,0x63,0xFD,0xFF,0x02,0xD0,0x0F,0xF0,0xF0,0xFF,0x08,0xE0,0x00,0x00,
+0x1F,0xFF,0x80,0x00,0x07,0x7F,0xF7,0xFF,0x00,0xFC,0xFE,0x00,0x02,0x1E,0x00,0x1F,
+0xFD,0xFF,0x02,0xF0,0x07,0xF0,0xF0,0xFF,0x08,0xF0,0x00,0x00,0x3F,0xFF,0x00,0x00,
+0x07,0x3F,0xF7,0xFF,0x00,0xF8,0xFE,0x00,0x02,0x1F,0xFF,0x7F,0xFD,0xFF,0x02,0x80,
+0x03,0xF0,0xF0,0xFF,0x08,0xF0,0x00,0x00,0xFF,0xFF,0x00,0x00,0x06,0x0F,0xF7,0xFF,
+0x04,0xF0,0x00,0x0C,0x00,0x1F,0xFB,0xFF,0x02,0x00,0x03,0xF1,0xF0,0xFF,0x08,0xF0,
+0x00,0x01,0xFF,0xFF,0x80,0x00,0x04,0x01,0xF7,0xFF,0x04,0xE0,0x00,0x0F,0x80,0x0F,
+0xFB,0xFF,0x02,0x00,0x03,0xF9,0xF0,0xFF,0x08,0xF0,0x00,0x01,0xFF,0xFF,0xC0,0x00,
+0x08,0x00,0xF7,0xFF,0x0D,0x80,0x00,0x0F,0x80,0x0F,0xFF,0xFF,0xFE,0x7F,0xFF,0xFE,
+0x00,0x03,0xF9,0xF0,0xFF,0x09,0xF8,0x00,0x07,0xFF,0xFF,0xE0,0x04,0x70,0x00,0x7F,
+0xF8,0xFF,0x0D,0x80,0x00,0x3F,0xC0,0x0F,0xFF,0xFF,0xFC,0x1F,0xFF,0xFE,0x00,0x03,
+0xFB,0xF0,0xFF,0x09,0xFC,0x00,0x0F,0xFF,0xFF,0xF0,0x1F,0xE0,0x00,0x7F,0xF8,0xFF,
+0x0D,0x00,0x00,0x0F,0xC0,0x3F,0xFF,0xFF,0xFC,0x0F,0xFF,0xFE,0x00,0x01,0xF7,0xF0,
+0xFF,0x09,0xFC,0x00,0x0F,0xFF,0xFF,0xFC,0xFF,0xE0,0x00,0x3F,0xF8,0xFF,0x0D,0x00,
+0x00,0x07,0x80,0x7F,0xFF,0xFF,0xFC,0x0F,0xFF,0xFC,0x00,0x00,0xE0,0xF0,0xFF,0x02,
+0xFE,0x00,0x3F,0xFD,0xFF,0x02,0xE0,0x00,0x1F,0xF8,0xFF,0x03,0x00,0x00,0x0F,0x00,
+0xFE,0xFF,0x06,0xFC,0x07,0xFF,0xFC,0x00,0x00,0xC1,0xEF,0xFF,0x00,0x41,0xFC,0xFF,
+0x02,0xF0,0x00,0x1F,0xF8,0xFF,0x03,0x00,0x00,0x07,0x80,0xFE,0xFF,0x06,0xFC,0x03,
+0xFF,0xFE,0x00,0x00,0x80,0xE9,0xFF,0x02,0xFC,0x00,0x3F,0xF8,0xFF,0x0D,0x00,0x00,
+0x03,0xE0,0x3F,0xFF,0xFF,0xFC,0x03,0xFF,0xFE,0x00,0x00,0x80,0xE8,0xFF,0x01,0xFE,
+0x7F,0xF8,0xFF,0x0D,0x80,0x00,0x01,0xE0,0x7F,0xFF,0xFF,0xEC,0x03,0xFF,0xFE,0x00,
+0x00,0xC0,0xDD,0xFF,0x0D,0x80,0x00,0x01,0xE0,0x0F,0xFF,0xFF,0xC0,0x01,0xFF,0xFF,
+0x00,0x00,0xC0,0xDD,0xFF,0x0D,0xC0,0x00,0x01,0x00,0x03,0xFF,0xFC,0x00,0x01,0xFF,
+0xFF,0x00,0x00,0xC0,0xDD,0xFF,0x00,0xC0,0xFE,0x00,0x09,0x01,0xFF,0x80,0x00,0x00,
+0xFF,0xFF,0x00,0x01,0x80,0xDD,0xFF,0x05,0xE0,0x00,0x00,0xE0,0x00,0xF8,0xFE,0x00,
+0x04,0xFF,0xFF,0x00,0x01,0x80,0xDD,0xFF,0x05,0xF0,0x00,0x00,0x80,0x00,0x70,0xFE,
+0x00,0x04,0x7C,0x03,0x00,0x0F,0x01,0xDD,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x60,0xFE,
+0x00,0x04,0x70,0x01,0x80,0x32,0x01,0xDC,0xFF,0xFD,0x00,0x00,0xE0,0xFE,0x00,0x04,
+0x70,0x00,0x80,0xE0,0x01,0xDC,0xFF,0x0C,0x80,0x00,0x00,0x01,0xC0,0x00,0x00,0x80,
+0xF0,0x00,0xC1,0xE0,0x03,0xDC,0xFF,0x0C,0xE0,0x02,0x00,0x03,0xC0,0x00,0x01,0xE0,
+0xF8,0x00,0xC3,0xE0,0x03,0xDB,0xFF,0x0B,0xFE,0x00,0x07,0xE0,0x00,0x01,0x00,0x98,
+0x00,0x63,0xC0,0x07,0xDB,0xFF,0x0B,0xFE,0x00,0x1F,0xC0,0x00,0x00,0xF8,0x30,0x00,
+0x7F,0xC0,0x0F,0xDB,0xFF,0x0B,0xFE,0x00,0x3F,0xC0,0x00,0x07,0x7F,0xF0,0x00,0x3F,
+0x80,0x1F,0xDB,0xFF,0x0B,0xFE,0x00,0x7F,0xE0,0x00,0x0C,0x11,0xE0,0x00,0x3F,0x80,
+0x3F,0xDB,0xFF,0x0B,0xFE,0x00,0xFF,0xF0,0x00,0x10,0x01,0xE0,0x00,0x1F,0x80,0x7F,
+0xDB,0xFF,0x03,0xFE,0x01,0xFF,0xF8,0xFE,0x00,0x03,0xE0,0x00,0x1F,0x80,0xDA,0xFF,
+0x03,0xFE,0x01,0xFF,0xFF,0xFE,0x00,0x03,0xE0,0x00,0x1F,0xC1,0xDA,0xFF,0x09,0xFC,
+0x07,0xFF,0xFF,0xF0,0x00,0x00,0xF8,0x00,0x0F,0xD9,0xFF,0x09,0xFC,0x0F,0xFF,0xFF,
+0xF0,0x00,0x01,0xF8,0x00,0x0F,0xDB,0xFF,0x0B,0xFE,0x0F,0xFF,0x7F,0xFF,0xFF,0xC0,
+0x00,0x01,0xB0,0x00,0x3F,0xDB,0xFF,0x02,0xFC,0x07,0xF3,0xFE,0xFF,0x05,0x80,0x00,
+0x00,0x38,0x00,0x7F,0xDB,0xFF,0x02,0xFE,0x03,0xF1,0xFE,0xFF,0x04,0x80,0x00,0x00,
+0xFC,0x01,0xDA,0xFF,0x02,0xFE,0x03,0xF3,0xFE,0xFF,0x04,0x80,0x00,0x00,0xF8,0x01,
+0xDA,0xFF,0x02,0xFC,0x01,0xE1,0xFE,0xFF,0x05,0x80,0x00,0x01,0xF0,0x00,0x7F,0xDB,
+0xFF,0x02,0xFC,0x00,0xE0,0xFE,0xFF,0x05,0x80,0x00,0x01,0xE0,0x00,0x7F,0xDB,0xFF,
+0x02,0xFC,0x00,0xC0,0xFE,0xFF,0x05,0x00,0x00,0x01,0xC0,0x30,0x7F,0xDB,0xFF,0x0A,
+0xFC,0x00,0xE0,0x7F,0xFF,0xFF,0x00,0x00,0x01,0x00,0x39,0xDA,0xFF,0x05,0xFC,0x00,
+0x60,0x7F,0xFF,0xFF,0xFD,0x00,0x00,0x39,0xDA,0xFF,0x06,0xFE,0x00,0x30,0x7F,0xFF,
+0xFF,0x80,0xFE,0x00,0x00,0x3F,0xDA,0xFF,0x05,0xFE,0x00,0x30,0x3F,0xFF,0xFF,0xFD,
+0x00,0x00,0x7F,0xD9,0xFF,0x04,0x00,0x38,0x3F,0xFF,0xFF,0xFD,0x00,0x00,0x7F,0xD9,
+0xFF,0x04,0x00,0x38,0x3F,0xFF,0xFF,0xFD,0x00,0x00,0x7F,0xDA,0xFF,0x05,0xFE,0x00,
+0x1C,0x3F,0xFF,0xFF,0xFD,0x00,0x00,0x7F,0xDA,0xFF,0x05,0xF8,0x00,0x1C,0x1F,0xFF,
+0xFF,0xFD,0x00,0x00,0x7F,0xDA,0xFF,0x06,0xF0,0x00,0x0E,0x1F,0xFF,0xFF,0x80,0xFE,
+0x00,0x00,0x7F,0xDA,0xFF,0x0A,0xF0,0x00,0x06,0x1F,0xFF,0xFF,0x80,0x00,0x10,0x00,
+0x7F,0xDA,0xFF,0x0A,0xF0,0x00,0x66,0x1F,0xFF,0xFF,0xC0,0x00,0x30,0x00,0x7F,0xDA,
+0xFF,0x09,0xF0,0x00,0x36,0x1F,0xFF,0xFF,0xC0,0x00,0x70,0x00,0xD9,0xFF,0x09,0xF0,
+0x00,0x3E,0x03,0xFF,0xFF,0xE0,0x00,0xF0,0x00,0xD9,0xFF,0x09,0xE0,0x00,0x7C,0x11,
+0xFF,0xFF,0xF0,0x01,0xF8,0x00,0xD9,0xFF,0x09,0xF0,0x00,0x38,0x18,0xFF,0xFF,0xF8,
+0x03,0xFC,0x01,0xD9,0xFF,0x09,0xE0,0x00,0x60,0x18,0x7F,0xFF,0xFC,0x07,0xFC,0x07,
+0xD9,0xFF,0x07,0xF0,0x00,0x40,0x08,0x7F,0xFF,0xFE,0x1F,0xD7,0xFF,0x00,0xF0,0xFE,
+0x00,0x00,0x7F,0xD4,0xFF,0x04,0xF0,0x00,0x38,0x00,0x7F,0xD4,0xFF,0x04,0xF0,0x00,
+0x3C,0x06,0x7F,0xD4,0xFF,0x04,0xF8,0x00,0x30,0x02,0x7F,0xD4,0xFF,0x04,0xF8,0x00,
+0x24,0x03,0x7F,0xD4,0xFF,0x04,0xF8,0x00,0x08,0x03,0x7F,0xD4,0xFF,0x03,0xF8,0x00,
+0x18,0x03,0xD3,0xFF,0x03,0xFC,0x00,0x18,0x03,0xD3,0xFF,0x03,0xFE,0x00,0x08,0x03,
+0xD2,0xFF,0x02,0x00,0xC0,0x03,0xD2,0xFF,0x02,0x83,0xC0,0x03,0xD2,0xFF,0x02,0x83,
+0xC0,0x03,0xD2,0xFF,0x02,0xD1,0x80,0x03,0xD2,0xFF,0x02,0xF9,0xC0,0x01,0xD2,0xFF,
+0x02,0xFD,0xC0,0x01,0xD1,0xFF,0x01,0xC0,0x01,0xD1,0xFF,0x01,0xE0,0x03,0xD1,0xFF,
+0x01,0xE0,0x03,0xD1,0xFF,0x01,0xF0,0x07,0xD1,0xFF,0x01,0xF8,0x07,0xD1,0xFF,0x01,
+0xF8,0x0F,0xD1,0xFF,0x01,0xFE,0x0F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0xE6,0xFF,0x00,0xFD,0xD0,0xFF,0x00,0xF0,0xD0,0xFF,0x01,0xE0,0x7F,
+0xD1,0xFF,0x01,0xE0,0x7F,0xD1,0xFF,0x01,0xE0,0x3F,0xD1,0xFF,0x01,0xF0,0x7F,0xD1,
+0xFF,0x01,0xF0,0x7F,0x81,0xFF,0x81,0xFF,0xD9,0xFF,0x02,0xF8,0x03,0xF8,0xD2,0xFF,
+0x03,0xC0,0x03,0xF8,0x1F,0xD4,0xFF,0x04,0xFE,0x00,0x03,0xF8,0x07,0xD4,0xFF,0x04,
+0xFE,0x00,0x03,0xF8,0x07,0xD4,0xFF,0x04,0xFC,0x00,0x07,0xF8,0x03,0xD4,0xFF,0x04,
+0xFE,0x00,0x03,0xF8,0x03,0xD4,0xFF,0x04,0xFE,0x00,0x07,0xF8,0x03,0xD4,0xFF,0x04,
+0xFC,0x00,0x07,0xFC,0x03,0xD4,0xFF,0x04,0xFC,0x00,0x0F,0xFC,0x03,0xD4,0xFF,0x04,
+0xFE,0x00,0x0F,0xFE,0x03,0xD4,0xFF,0x04,0xFE,0x03,0x0F,0xFE,0x07,0xD3,0xFF,0x03,
+0xDF,0xDF,0xFF,0x8F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0xFE,0xFF,
+};
+
+// BitmapExample3 : 15000 bytes, packed 5385
+const unsigned char BitmapExample3_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xA0,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xE4,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFA,0xFF,0x02,0xC0,0x00,0x1F,0xFE,0xFF,
+0x00,0xF8,0xFD,0x00,0x02,0x07,0xFF,0xC0,0xFD,0x00,0x00,0x3F,0xFE,0xFF,0x14,0x32,
+0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,
+0x3D,0xBC,0x1B,0x3F,0xFB,0xFF,0x03,0xFE,0x00,0x00,0x01,0xFE,0xFF,0x00,0xE0,0xFD,
+0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xFB,0xFF,0x00,0xF8,0xFE,0x00,0x03,0x7F,0xFF,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,
+0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,
+0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFB,0xFF,0x00,0xE0,
+0xFE,0x00,0x03,0x3F,0xFF,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x0F,
+0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFB,0xFF,0x00,0x80,0xFE,0x00,0x03,0x0F,
+0xFF,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x14,0x32,
+0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,
+0x3D,0xBC,0x1B,0x3F,0xFB,0xFF,0xFD,0x00,0x03,0x07,0xFF,0xFF,0xE0,0xFD,0x00,0x01,
+0x01,0xFF,0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,
+0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,
+0x00,0xFE,0xFD,0x00,0x03,0x03,0xFF,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,0xFC,0x00,
+0x00,0x0F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,
+0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x00,0xFC,0xFD,0x00,
+0x03,0x01,0xFF,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x0F,0xFE,0xFF,
+0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,
+0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x00,0xF8,0xFC,0x00,0x02,0xFF,0xFF,0xE0,
+0xFD,0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,
+0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,
+0x3F,0xFC,0xFF,0x00,0xF0,0xFC,0x00,0x02,0x7F,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,
+0xFC,0x00,0x00,0x0F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,
+0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x00,0xE0,
+0xFC,0x00,0x02,0x3F,0xFF,0xE0,0xFD,0x00,0x01,0x01,0xFF,0xFC,0x00,0x00,0x0F,0xFE,
+0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,
+0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x0A,0xC0,0x00,0x07,0xFF,0x80,0x00,
+0x1F,0xFF,0xE0,0x00,0x7F,0xFD,0xFF,0x01,0x00,0x03,0xFA,0xFF,0x14,0x32,0x0C,0x7C,
+0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,
+0x1B,0x3F,0xFC,0xFF,0x09,0xC0,0x00,0x1F,0xFF,0xC0,0x00,0x0F,0xFF,0xE0,0x00,0xFC,
+0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,
+0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x09,0x80,
+0x00,0x7F,0xFF,0xF0,0x00,0x0F,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,
+0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,
+0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x09,0x80,0x00,0xFF,0xFF,0xF8,0x00,0x07,
+0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xFC,0xFF,0x09,0x00,0x01,0xFF,0xFF,0xFC,0x00,0x07,0xFF,0xE0,0x00,0xFC,0xFF,0x01,
+0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,
+0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFC,0xFF,0x09,0x00,0x03,0xFF,
+0xFF,0xFE,0x00,0x03,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,
+0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,
+0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xFE,0x00,0x07,0xFE,0xFF,0x04,0x00,0x03,0xFF,
+0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,
+0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,
+0xFF,0x02,0xFE,0x00,0x07,0xFE,0xFF,0x04,0x80,0x01,0xFF,0xE0,0x00,0xFC,0xFF,0x01,
+0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,
+0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xFC,0x00,0x0F,
+0xFE,0xFF,0x04,0x80,0x01,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,
+0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,
+0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xFC,0x00,0x0F,0xFE,0xFF,0x04,0xC0,0x01,
+0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xFD,0xFF,0x02,0xFC,0x00,0x1F,0xFE,0xFF,0x04,0xC0,0x00,0xFF,0xE0,0x00,0xFC,0xFF,
+0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,
+0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xFC,0x00,
+0x1F,0xFE,0xFF,0x04,0xC0,0x00,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,
+0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,
+0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x3F,0xFE,0xFF,0x04,0xE0,
+0x00,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,
+0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,
+0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x3F,0xFE,0xFF,0x04,0xE0,0x00,0xFF,0xE0,0x00,0xFC,
+0xFF,0x01,0x00,0x07,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,
+0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF8,
+0x00,0x3F,0xFE,0xFF,0x03,0xE0,0x00,0xFF,0xE0,0xFD,0x00,0x01,0x3F,0xFF,0xFD,0x00,
+0x00,0x01,0xFD,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,
+0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x3F,
+0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xE0,0xFD,0x00,0x01,0x1F,0xFF,0xFC,0x00,0xFD,0xFF,
+0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,
+0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x3F,0xFE,0xFF,0x03,0xF0,
+0x00,0x7F,0xE0,0xFD,0x00,0x01,0x0F,0xFF,0xFC,0x00,0x00,0x7F,0xFE,0xFF,0x14,0x32,
+0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,
+0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x7F,0xFE,0xFF,0x03,0xF0,0x00,0x7F,
+0xE0,0xFD,0x00,0x01,0x0F,0xFF,0xFC,0x00,0x00,0x7F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,
+0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,
+0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x7F,0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xE0,0xFD,
+0x00,0x01,0x0F,0xFF,0xFC,0x00,0x00,0x7F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,
+0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,
+0xFD,0xFF,0x02,0xF0,0x00,0x7F,0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xE0,0xFD,0x00,0x01,
+0x0F,0xFF,0xFC,0x00,0x00,0x7F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,
+0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,
+0x02,0xF0,0x00,0x7F,0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xE0,0xFD,0x00,0x01,0x0F,0xFF,
+0xFC,0x00,0x00,0x7F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,
+0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF0,
+0x00,0x7F,0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xE0,0xFD,0x00,0x01,0x0F,0xFF,0xFC,0x00,
+0x00,0x7F,0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,
+0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x7F,
+0xFE,0xFF,0x03,0xF0,0x00,0x7F,0xE0,0xFD,0x00,0x01,0x0F,0xFF,0xFC,0x00,0x00,0x7F,
+0xFE,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,
+0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x7F,0xFE,0xFF,
+0x03,0xF0,0x00,0x7F,0xE0,0xFD,0x00,0x01,0x0F,0xFF,0xFC,0x00,0x00,0x7F,0xFE,0xFF,
+0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,
+0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x7F,0xFE,0xFF,0x03,0xF0,
+0x00,0x7F,0xE0,0xFD,0x00,0x01,0x1F,0xFF,0xFC,0x00,0xFD,0xFF,0x14,0x32,0x0C,0x7C,
+0xF7,0xBE,0x7C,0x27,0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,
+0x1B,0x3F,0xFD,0xFF,0x02,0xF0,0x00,0x7F,0xFE,0xFF,0x05,0xF0,0x00,0x7F,0xE0,0x00,
+0x7F,0xFD,0xFF,0x01,0x00,0x03,0xFA,0xFF,0x14,0x32,0x0C,0x7C,0xF7,0xBE,0x7C,0x27,
+0x0C,0x7C,0x24,0xC8,0x3C,0x9F,0xD9,0xCF,0x9F,0xD8,0x3D,0xBC,0x1B,0x3F,0xFD,0xFF,
+0x02,0xF0,0x00,0x3F,0xFE,0xFF,0x04,0xF0,0x00,0x7F,0xE0,0x00,0xFC,0xFF,0x01,0x00,
+0x07,0xFA,0xFF,0x00,0x33,0xF9,0xFF,0x01,0xFC,0xCF,0xF9,0xFF,0x01,0xFB,0x3F,0xFD,
+0xFF,0x02,0xF8,0x00,0x3F,0xFE,0xFF,0x04,0xF0,0x00,0x7F,0xE0,0x00,0xFC,0xFF,0x01,
+0x00,0x07,0xFA,0xFF,0x00,0x33,0xF9,0xFF,0x01,0xFC,0xCF,0xF9,0xFF,0x01,0xFB,0x3F,
+0xFD,0xFF,0x02,0xF8,0x00,0x3F,0xFE,0xFF,0x04,0xE0,0x00,0xFF,0xE0,0x00,0xFC,0xFF,
+0x01,0x00,0x07,0xFA,0xFF,0x00,0x33,0xF9,0xFF,0x01,0xFC,0xCF,0xF9,0xFF,0x01,0xFB,
+0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x3F,0xFE,0xFF,0x04,0xE0,0x00,0xFF,0xE0,0x00,0xFC,
+0xFF,0x01,0x00,0x07,0xFC,0xFF,0x02,0xFE,0x1F,0x33,0xF9,0xFF,0x01,0xFC,0xCF,0xF9,
+0xFF,0x01,0xFB,0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x3F,0xFE,0xFF,0x04,0xE0,0x00,0xFF,
+0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFC,0xFF,0x16,0xFD,0xCF,0x33,0xFC,0x0F,0x07,
+0xE0,0x7C,0x3F,0x0F,0xE1,0xFC,0xCF,0xF0,0xFE,0x1F,0x83,0xF0,0xFE,0x1F,0x81,0xFB,
+0x3F,0xFD,0xFF,0x02,0xF8,0x00,0x1F,0xFE,0xFF,0x04,0xE0,0x00,0xFF,0xE0,0x00,0xFC,
+0xFF,0x01,0x00,0x07,0xFC,0xFF,0x16,0xF9,0xE7,0x33,0xF8,0x0C,0xE3,0xC0,0x79,0x9E,
+0x07,0xCC,0xFC,0xCF,0xE6,0x7C,0x0E,0x71,0xE0,0x7C,0xCF,0x03,0xFB,0x3F,0xFD,0xFF,
+0x02,0xFC,0x00,0x1F,0xFE,0xFF,0x04,0xC0,0x00,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,
+0x07,0xFC,0xFF,0x16,0xF9,0xE7,0x33,0xFB,0xEC,0xF3,0xDF,0x7B,0xDE,0xC7,0xDE,0xFC,
+0xCF,0xEF,0x79,0xCE,0x79,0xCE,0x7D,0xEF,0x7F,0xFB,0x3F,0xFD,0xFF,0x02,0xFC,0x00,
+0x0F,0xFE,0xFF,0x04,0xC0,0x01,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFC,0xFF,
+0x16,0xF9,0xE7,0x33,0xFF,0xDC,0xF3,0xFE,0xF3,0xCF,0xE7,0x9E,0x7C,0xCF,0xCF,0x3F,
+0xCE,0x79,0xFE,0x79,0xE7,0x0F,0xFB,0x3F,0xFD,0xFF,0x02,0xFC,0x00,0x0F,0xFE,0xFF,
+0x04,0x80,0x01,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFC,0xFF,0x16,0xF9,0xE7,
+0x33,0xFF,0xDE,0x37,0xFE,0xF3,0xCF,0xE7,0x9E,0x7C,0xCF,0xCF,0x3F,0x9F,0x1B,0xFC,
+0xF9,0xE6,0x03,0xFB,0x3F,0xFD,0xFF,0x02,0xFE,0x00,0x07,0xFE,0xFF,0x04,0x80,0x01,
+0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFC,0xFF,0x16,0xFC,0xE7,0x33,0xFF,0xDF,
+0x0F,0xFE,0xF3,0xCF,0xEF,0x9E,0x7C,0xCF,0xCF,0x3F,0x0F,0x87,0xF8,0x79,0xE6,0x03,
+0xFB,0x3F,0xFD,0xFF,0x02,0xFE,0x00,0x07,0xFE,0xFF,0x04,0x00,0x03,0xFF,0xE0,0x00,
+0xFC,0xFF,0x01,0x00,0x07,0xFC,0xFF,0x14,0xFE,0x0F,0xFF,0xFF,0xBE,0x47,0xFD,0xF3,
+0xCF,0xCF,0x9E,0x7F,0xFF,0xCF,0x3F,0x87,0x23,0xFC,0x39,0xE7,0xE1,0xFB,0xFF,0x0A,
+0xFE,0x00,0x03,0xFF,0xFF,0xFE,0x00,0x03,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,
+0xFB,0xFF,0x13,0xCF,0xFF,0xFF,0xBC,0xE3,0xFD,0xF3,0xCF,0xDF,0x9E,0x7F,0xFF,0xCF,
+0x3F,0xC6,0x71,0xFE,0x39,0xE7,0xF9,0xFA,0xFF,0x09,0x00,0x01,0xFF,0xFF,0xFC,0x00,
+0x07,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFB,0xFF,0x13,0x9F,0xFF,0xFF,0xBC,
+0xF3,0xFD,0xF3,0xCF,0xBF,0x9E,0x7F,0xFF,0xCF,0x3F,0xE6,0x79,0xFF,0x39,0xE7,0xFD,
+0xFA,0xFF,0x09,0x80,0x00,0xFF,0xFF,0xF8,0x00,0x07,0xFF,0xE0,0x00,0xFC,0xFF,0x01,
+0x00,0x07,0xFC,0xFF,0x14,0xFE,0x3F,0xFF,0xFF,0x7C,0xF3,0xFB,0xFB,0xDF,0x7B,0xDE,
+0xFF,0xFF,0xEF,0x79,0xE6,0x79,0xCF,0x3D,0xEE,0x7D,0xFA,0xFF,0x09,0x80,0x00,0x7F,
+0xFF,0xF0,0x00,0x0F,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xFC,0xFF,0x00,0xF8,
+0xFE,0xFF,0x10,0x7C,0x67,0xFB,0xF9,0x9E,0x07,0xCC,0xFF,0xFF,0xE6,0x78,0xEE,0x33,
+0xC7,0x7C,0xCE,0x1B,0xFA,0xFF,0x09,0xC0,0x00,0x1F,0xFF,0xC0,0x00,0x1F,0xFF,0xE0,
+0x00,0xFC,0xFF,0x01,0x00,0x07,0xF8,0xFF,0x10,0x7F,0x0F,0xFB,0xFC,0x3C,0x07,0xE1,
+0xFF,0xFF,0xF0,0xFC,0x1F,0x87,0xE0,0xFE,0x1F,0x07,0xFA,0xFF,0x09,0xC0,0x00,0x07,
+0xFF,0x00,0x00,0x1F,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xE0,0xFF,0x09,0xE0,
+0x00,0x00,0x70,0x00,0x00,0x3F,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xE0,0xFF,
+0x00,0xF0,0xFC,0x00,0x03,0x7F,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xE0,0xFF,
+0x00,0xF8,0xFC,0x00,0x03,0xFF,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xE0,0xFF,
+0x00,0xFC,0xFD,0x00,0x04,0x01,0xFF,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xE0,
+0xFF,0x00,0xFE,0xFD,0x00,0x04,0x03,0xFF,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,
+0xDF,0xFF,0xFD,0x00,0x04,0x07,0xFF,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,0xDF,
+0xFF,0x00,0x80,0xFE,0x00,0x04,0x0F,0xFF,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,0x07,
+0xDF,0xFF,0x00,0xE0,0xFE,0x00,0x04,0x3F,0xFF,0xFF,0xE0,0x00,0xFC,0xFF,0x01,0x00,
+0x07,0xDF,0xFF,0x00,0xF8,0xFE,0x00,0xFE,0xFF,0x01,0xE0,0x00,0xFC,0xFF,0x01,0x00,
+0x07,0xDF,0xFF,0x03,0xFE,0x00,0x00,0x03,0xFE,0xFF,0x01,0xF8,0x03,0xFC,0xFF,0x01,
+0xC0,0x1F,0xDE,0xFF,0x02,0xC0,0x00,0x1F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x99,0xFF,0x00,0x80,0xD2,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0xFE,0xFF,0x03,0xF8,0x3F,0xFE,0x7F,0xD9,0xFF,0x02,0xFC,0x7F,0xF7,0xFE,
+0xFF,0x03,0xF0,0x1F,0xFE,0x7F,0xD9,0xFF,0x01,0xFB,0xBF,0xFD,0xFF,0x03,0xE3,0x8F,
+0xFE,0x7F,0xD9,0xFF,0x01,0xF7,0xDF,0xFD,0xFF,0x03,0xE7,0xCF,0xFE,0x7F,0xD9,0xFF,
+0x01,0xF7,0xDF,0xFD,0xFF,0x03,0xE7,0xFF,0x0E,0x71,0xD9,0xFF,0x09,0xEF,0xEE,0x97,
+0xCB,0xFF,0xFF,0xF3,0xFE,0x06,0x60,0xD9,0xFF,0x0A,0xEF,0xEE,0x57,0xB3,0xFF,0xFF,
+0xF8,0x7C,0xE6,0x46,0x7F,0xDA,0xFF,0x0A,0xEF,0xEE,0xF7,0x7B,0xFF,0xFF,0xFE,0x1F,
+0x86,0x4E,0x7F,0xDA,0xFF,0x03,0xEF,0xEE,0xF7,0x7B,0xFE,0xFF,0x03,0xCE,0x06,0x40,
+0x7F,0xDA,0xFF,0x0A,0xEF,0xEE,0xF7,0x7B,0xFF,0xFF,0xE7,0xCC,0x66,0x40,0x7F,0xDA,
+0xFF,0x09,0xEF,0xEE,0xF7,0x7B,0xFF,0xFF,0xE7,0xCC,0xE6,0x4F,0xD9,0xFF,0x0A,0xF7,
+0xDE,0xF7,0x7B,0xFF,0xFF,0xF3,0x8C,0xC6,0x46,0x7F,0xDA,0xFF,0x09,0xF7,0xDE,0xF7,
+0x7B,0xFF,0xFF,0xF0,0x1C,0x06,0x60,0xD9,0xFF,0x09,0xFB,0xBE,0xF7,0xB3,0xFF,0xFF,
+0xF8,0x3E,0x26,0x71,0xD9,0xFF,0x03,0xFC,0x7E,0xF7,0xCA,0xD0,0xFF,0x00,0xFB,0xD0,
+0xFF,0x00,0x7B,0xD0,0xFF,0x00,0x77,0xD0,0xFF,0x00,0x87,0x81,0xFF,0x81,0xFF,0xE9,
+0xFF,0x09,0xFE,0x07,0xBB,0xF7,0xFF,0xBF,0xF8,0xFF,0xFF,0x81,0xD9,0xFF,0x02,0xFE,
+0xF7,0xFB,0xFE,0xFF,0x05,0xF7,0x7F,0xFF,0xBD,0xFF,0xED,0xDB,0xFF,0x02,0xFE,0xFB,
+0xFB,0xFE,0xFF,0x05,0xEF,0xBF,0xFF,0xBE,0xFF,0xED,0xDB,0xFF,0x02,0xFE,0xFB,0xFB,
+0xFE,0xFF,0x05,0xDF,0xBF,0xFF,0xBE,0xFF,0xED,0xDB,0xFF,0x0D,0xFE,0xF7,0xBB,0x77,
+0x0F,0xBF,0xDF,0xB8,0xFF,0xBD,0xE3,0xC0,0xC7,0xC3,0xDD,0xFF,0x0D,0xFD,0xF7,0x77,
+0x6E,0x37,0x7F,0xBF,0xB0,0xFF,0x7D,0xD9,0xDB,0xB3,0x8D,0xDD,0xFF,0x0D,0xFC,0x0F,
+0x76,0xEE,0x77,0x7F,0xBF,0xB3,0xFF,0x03,0x9D,0xDB,0x3B,0x9D,0xDD,0xFF,0x0D,0xFD,
+0xE7,0x75,0xEE,0xF7,0x7F,0xBF,0xB7,0xFF,0x79,0xBD,0xDB,0x7B,0xBD,0xDD,0xFF,0x0D,
+0xFD,0xF7,0x71,0xEE,0xF7,0x7F,0xBF,0xB7,0xFF,0x7D,0xBD,0xDB,0x7B,0xBD,0xDD,0xFF,
+0x0D,0xFD,0xF7,0x75,0xEE,0xF7,0x7F,0xBF,0x77,0xFF,0x7D,0xBD,0xDB,0x7B,0xBD,0xDD,
+0xFF,0x0D,0xFD,0xF7,0x75,0xEE,0xF7,0x7F,0xBF,0x77,0xFF,0x7D,0xBB,0xDB,0x77,0xBD,
+0xDD,0xFF,0x0D,0xFB,0xEE,0xEE,0xDD,0xEE,0xFF,0xBE,0xEF,0xFE,0xFB,0xBB,0xB7,0x77,
+0x7B,0xDD,0xFF,0x0D,0xFB,0xCE,0xEE,0xDD,0xEE,0xFF,0xDC,0xEF,0xFE,0xF3,0xB3,0xB7,
+0x67,0x7B,0xDD,0xFF,0x0D,0xF8,0x1E,0xEE,0xDD,0xEE,0xFF,0xE3,0xEF,0xFE,0x07,0xC7,
+0x93,0x8F,0x7B,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xD3,0xFF,0x04,0xE3,0x80,
+0xFE,0x3E,0x3F,0xDA,0xFF,0x0A,0xF1,0xF1,0xFE,0x1F,0x1F,0xFF,0xC1,0x80,0xFC,0x1C,
+0x1F,0xDA,0xFF,0x0A,0xE7,0xCC,0xFE,0x1E,0xEF,0xFF,0x99,0xFC,0xF9,0xD9,0xDF,0xDA,
+0xFF,0x0A,0xDF,0xDE,0xFD,0xFE,0xEF,0xFF,0x99,0xF9,0xF9,0xC9,0xCF,0xDA,0xFF,0x05,
+0xBF,0xFE,0xFC,0xFD,0xF7,0xFF,0xFE,0xF9,0x01,0xC9,0xCF,0xDA,0xFF,0x0A,0x47,0xFD,
+0xF8,0x3D,0xF7,0xFF,0xF3,0xFB,0xF9,0xC9,0xCF,0xDA,0xFF,0x0A,0x3B,0xF1,0xFF,0x3D,
+0xF7,0xFF,0xF1,0xF3,0xF9,0x89,0x8F,0xDA,0xFF,0x0A,0x7D,0xFC,0xFF,0x9D,0xF7,0xFF,
+0xFC,0xF3,0xFC,0x0C,0x0F,0xDA,0xFF,0x0A,0x7D,0xFE,0xFF,0xDD,0xF7,0xFF,0xFC,0xF3,
+0xFC,0x4C,0x4F,0xDA,0xFF,0x0A,0x7D,0xFE,0xFF,0xDD,0xF7,0xFF,0xFC,0xF7,0xFF,0xCF,
+0xCF,0xDA,0xFF,0x0A,0x3D,0xFE,0xFF,0xDE,0xEF,0xFF,0x9C,0xE7,0xF9,0xC9,0xCF,0xDA,
+0xFF,0x0A,0xBB,0xCD,0xDB,0xBE,0xEF,0xFF,0x9C,0xE7,0xFD,0x8D,0x8F,0xDA,0xFF,0x0A,
+0xC7,0xC3,0xD8,0x7F,0x1F,0xFF,0xC1,0xE7,0xCC,0x1C,0x1F,0xD4,0xFF,0x04,0xE3,0xE7,
+0xCE,0x3E,0x3F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xDC,0xFF,0x01,
+0xFC,0x03,0xFC,0xFF,0x04,0xF1,0xFF,0xFF,0xFC,0x78,0xFD,0xFF,0x00,0xE3,0xE0,0xFF,
+0x01,0xF0,0x01,0xFC,0xFF,0x04,0xF1,0xFF,0xFF,0xFC,0x78,0xFD,0xFF,0x00,0xE3,0xE0,
+0xFF,0x01,0xE0,0x00,0xFC,0xFF,0x04,0xF1,0xFF,0xFF,0xFC,0x78,0xFD,0xFF,0x00,0xE3,
+0xE0,0xFF,0x02,0xC1,0xF0,0x7F,0xFD,0xFF,0x04,0xF1,0xFF,0xFF,0xFC,0x78,0xFD,0xFF,
+0x00,0xE3,0xE0,0xFF,0x02,0x87,0xF8,0x7F,0xFD,0xFF,0x04,0xF1,0xFF,0xFF,0xFC,0x7F,
+0xFD,0xFF,0x00,0xE3,0xE0,0xFF,0x02,0x0F,0xFC,0x7F,0xFD,0xFF,0x04,0xE1,0xFF,0xFF,
+0xF8,0x7F,0xFD,0xFF,0x00,0xC3,0xE0,0xFF,0x14,0x0F,0xFC,0x7E,0x07,0xFC,0x0F,0xF8,
+0x23,0xFF,0xFE,0x08,0xF1,0xF8,0x1F,0xC4,0x0F,0xC7,0xE0,0x3F,0x1F,0x8F,0xE5,0xFF,
+0x15,0xFE,0x1F,0xFF,0xF8,0x03,0xF0,0x07,0xE0,0x03,0xFF,0xF8,0x00,0xF1,0xE0,0x0F,
+0xC0,0x07,0xC7,0xC0,0x1F,0x1F,0x8F,0xE5,0xFF,0x15,0xFE,0x3F,0xFF,0xF0,0x01,0xE0,
+0x03,0xC0,0x03,0xFF,0xF0,0x00,0xF1,0xC0,0x07,0xC0,0x03,0xC7,0x80,0x0F,0x8F,0x0F,
+0xE5,0xFF,0x15,0xFE,0x3F,0xFF,0xF0,0xE1,0xE1,0xC3,0xC3,0x83,0xFF,0xF0,0xE0,0xF1,
+0xC3,0x87,0xC1,0xC3,0xC7,0x0F,0x0F,0x8F,0x1F,0xE5,0xFF,0x15,0xFE,0x3F,0x80,0x61,
+0xF1,0xC3,0xE3,0x87,0xC3,0xFF,0xE1,0xF0,0xF1,0xC7,0xC7,0xC3,0xE3,0xC7,0x1F,0x8F,
+0x8E,0x1F,0xE5,0xFF,0x15,0xFE,0x3F,0x80,0x63,0xF1,0xC7,0xE3,0x8F,0xC3,0xFF,0xE3,
+0xF0,0xF1,0xC3,0xFF,0xC7,0xE3,0xC7,0x1F,0x8F,0x8E,0x3F,0xE5,0xFF,0x15,0xFC,0x3F,
+0x80,0x43,0xF1,0x87,0xE3,0x0F,0xC3,0x00,0xC3,0xF0,0xE1,0xC0,0x7F,0x87,0xE3,0x87,
+0xFC,0x0F,0x8C,0x3F,0xE5,0xFF,0x15,0xFC,0x3F,0xF8,0xC7,0xF1,0x8F,0xE3,0x1F,0xC7,
+0x00,0xC7,0xF1,0xE3,0xC0,0x0F,0x8F,0xE3,0x8F,0x80,0x1F,0x8C,0x7F,0xE5,0xFF,0x15,
+0xFC,0x3F,0xF8,0xC7,0xF1,0x8F,0xE3,0x1F,0xC7,0x00,0xC7,0xF1,0xE3,0xE0,0x07,0x8F,
+0xE3,0x8F,0x00,0x1F,0x88,0x7F,0xE5,0xFF,0x14,0xFE,0x3F,0xF8,0xC7,0xF1,0x8F,0xE3,
+0x1F,0xC7,0x00,0xC7,0xF1,0xE3,0xFC,0x07,0x8F,0xE3,0x8E,0x01,0x1F,0x88,0xE4,0xFF,
+0x14,0xFE,0x3F,0xF8,0xC7,0xE1,0x8F,0xC3,0x1F,0x87,0xFF,0xC7,0xE1,0xE3,0x8F,0x87,
+0x8F,0xC3,0x8E,0x1E,0x1F,0x80,0xE4,0xFF,0x0D,0xFE,0x1F,0xE0,0xC3,0xC3,0x87,0x87,
+0x0F,0x87,0xFF,0xC3,0xE1,0xE3,0x8F,0xFE,0x87,0x03,0x8E,0x3E,0x1F,0x81,0xE3,0xFF,
+0x13,0x07,0x80,0xC1,0x83,0x83,0x07,0x06,0x07,0xFF,0xC1,0x81,0xC3,0x87,0x0F,0x03,
+0x07,0x0E,0x38,0x1F,0xC1,0xE3,0xFF,0x13,0x00,0x03,0xE0,0x07,0xC0,0x0F,0x80,0x0F,
+0xFF,0xE0,0x03,0xC7,0x80,0x0F,0x00,0x0F,0x1E,0x00,0x1F,0xC3,0xE3,0xFF,0x13,0x80,
+0x07,0xE0,0x0F,0xC0,0x1F,0x80,0x0F,0xFF,0xE0,0x03,0xC7,0xC0,0x1F,0x00,0x1F,0x1E,
+0x00,0x1F,0xC3,0xE3,0xFF,0x13,0xE0,0x1F,0xF8,0x3F,0xF0,0x7F,0xE0,0x8F,0xFF,0xF8,
+0x23,0xC7,0xE0,0x7F,0x10,0x7F,0x1F,0x03,0x1F,0xC7,0xD5,0xFF,0x00,0x1F,0xFD,0xFF,
+0x00,0x87,0xD5,0xFF,0x00,0x1F,0xFD,0xFF,0x00,0x8F,0xD6,0xFF,0x01,0xFE,0x1F,0xFD,
+0xFF,0x00,0x0F,0xD6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x01,0xFC,0x1F,0xD6,0xFF,0x01,
+0xFE,0x3F,0xFE,0xFF,0x01,0xFC,0x1F,0xD6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x01,0xFC,
+0x3F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xEC,0xFF,
+};
+
+// BitmapExample4 : 15000 bytes, packed 3253
+const unsigned char BitmapExample4_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0xF3,0xFF,0x02,0xFC,0x00,0x1F,0xD7,0xFF,0x07,0xE0,0x00,0x3F,0xFF,0xFF,
+0xF0,0x00,0x03,0xD7,0xFF,0x07,0xC0,0x00,0x3F,0xFF,0xFF,0xC0,0x00,0x01,0xD7,0xFF,
+0x04,0xC0,0x00,0x3F,0xFF,0xFF,0xFE,0x00,0x00,0x7F,0xD8,0xFF,0x04,0x80,0x00,0x3F,
+0xFF,0xFE,0xFE,0x00,0x00,0x3F,0xD8,0xFF,0x04,0x80,0x00,0x3F,0xFF,0xFC,0xFE,0x00,
+0x00,0x1F,0xD8,0xFF,0x04,0x00,0x00,0x3F,0xFF,0xF8,0xFE,0x00,0x00,0x0F,0xFA,0xFF,
+0x01,0xFE,0x07,0xE2,0xFF,0x05,0xFE,0x00,0x00,0x3F,0xFF,0xF0,0xFE,0x00,0x00,0x07,
+0xFE,0xFF,0x05,0xC0,0x1F,0xFF,0xFF,0xFC,0x07,0xE2,0xFF,0x05,0xFE,0x00,0x00,0x3F,
+0xFF,0xF0,0xFE,0x00,0x09,0x03,0xFF,0xFF,0xFE,0x00,0x07,0xFF,0xFF,0xFC,0x07,0xE2,
+0xFF,0x05,0xFC,0x00,0x00,0x3F,0xFF,0xE0,0xFE,0x00,0x09,0x03,0xFF,0xFF,0xFC,0x00,
+0x01,0xFF,0xFF,0xF8,0x0F,0xE2,0xFF,0x12,0xFC,0x00,0x00,0x3F,0xFF,0xC0,0x00,0x7F,
+0x00,0x01,0xFF,0xFF,0xF8,0x00,0x00,0xFF,0xFF,0xF8,0x0F,0xE2,0xFF,0x12,0xF8,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,0xFF,0x80,0x01,0xFF,0xFF,0xF0,0x00,0x00,0x7F,0xFF,0xF0,
+0x1F,0xE2,0xFF,0x12,0xF0,0x00,0x00,0x3F,0xFF,0x80,0x01,0xFF,0xC0,0x00,0xFF,0xFF,
+0xE0,0x00,0x00,0x3F,0xFF,0xE0,0x3F,0xE2,0xFF,0x12,0xF0,0x00,0x00,0x3F,0xFF,0x80,
+0x03,0xFF,0xE0,0x00,0xFF,0xFF,0xC0,0x00,0x00,0x1F,0xFF,0xE0,0x3F,0xE2,0xFF,0x12,
+0xE0,0x04,0x00,0x3F,0xFF,0x80,0x07,0xFF,0xF0,0x00,0x7F,0xFF,0x80,0x00,0x00,0x0F,
+0xFF,0xC0,0x7F,0xE2,0xFF,0x12,0xE0,0x0C,0x00,0x3F,0xFF,0x00,0x07,0xFF,0xF0,0x00,
+0x7F,0xFF,0x80,0x1F,0x80,0x0F,0xFF,0xC0,0x7F,0xE2,0xFF,0x11,0xC0,0x1C,0x00,0x3F,
+0xFF,0x00,0x07,0xFF,0xF8,0x00,0x7F,0xFF,0x00,0x3F,0xE0,0x07,0xFF,0x80,0xE1,0xFF,
+0x11,0x80,0x1C,0x00,0x3F,0xFF,0x00,0x0F,0xFF,0xF8,0x00,0x7F,0xFF,0x00,0x7F,0xF0,
+0x07,0xFF,0x00,0xE1,0xFF,0x11,0x80,0x3C,0x00,0x3F,0xFF,0x00,0x0F,0xFF,0xF8,0x00,
+0x7F,0xFF,0x00,0xFF,0xF0,0x07,0xFF,0x01,0xE1,0xFF,0x11,0x00,0x3C,0x00,0x3F,0xFF,
+0x00,0x0F,0xFF,0xF8,0x00,0x3F,0xFF,0x00,0xFF,0xF8,0x07,0xFE,0x01,0xE1,0xFF,0x11,
+0x00,0x7C,0x00,0x3F,0xFE,0x00,0x0F,0xFF,0xF8,0x00,0x3F,0xFF,0x01,0xFF,0xF8,0x07,
+0xFE,0x03,0xE2,0xFF,0x12,0xFE,0x00,0xFC,0x00,0x3F,0xFE,0x00,0x0F,0xFF,0xF8,0x00,
+0x3F,0xFF,0x01,0xFF,0xF8,0x07,0xFC,0x07,0xE2,0xFF,0x12,0xFC,0x00,0xFC,0x00,0x3F,
+0xFE,0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFF,0x01,0xFF,0xF8,0x07,0xFC,0x07,0xE2,0xFF,
+0x12,0xFC,0x01,0xFC,0x00,0x3F,0xFE,0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFF,0x00,0xFF,
+0xF8,0x07,0xF8,0x0F,0xE2,0xFF,0x12,0xF8,0x03,0xFC,0x00,0x3F,0xFE,0x00,0x0F,0xFF,
+0xFC,0x00,0x3F,0xFF,0x00,0xFF,0xF0,0x07,0xF8,0x0F,0xE2,0xFF,0x12,0xF8,0x03,0xFC,
+0x00,0x3F,0xFE,0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFF,0x00,0x7F,0xF0,0x07,0xF0,0x1F,
+0xE2,0xFF,0x12,0xF0,0x07,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x3F,0xFF,
+0x00,0x3F,0xE0,0x07,0xE0,0x1F,0xE2,0xFF,0x12,0xE0,0x07,0xFC,0x00,0x3F,0xFE,0x00,
+0x1F,0xFF,0xFC,0x00,0x1F,0xFF,0x80,0x1F,0xC0,0x0F,0xE0,0x3F,0xE2,0xFF,0x12,0xE0,
+0x0F,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFF,0x80,0x00,0x00,0x0F,
+0xC0,0x7F,0xE2,0xFF,0x12,0xC0,0x1F,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,
+0x1F,0xFF,0xC0,0x00,0x00,0x1F,0xC0,0x7F,0xE2,0xFF,0x11,0xC0,0x1F,0xFC,0x00,0x3F,
+0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFF,0xE0,0x00,0x00,0x3F,0x80,0xE1,0xFF,0x11,
+0x80,0x3F,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFF,0xE0,0x00,0x00,
+0x7F,0x80,0xE1,0xFF,0x11,0x00,0x3F,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,
+0x1F,0xFF,0xF8,0x00,0x00,0xFF,0x01,0xE1,0xFF,0x11,0x00,0x7F,0xFC,0x00,0x3F,0xFE,
+0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFF,0xFC,0x00,0x01,0xFF,0x01,0xE2,0xFF,0x12,0xFE,
+0x00,0xFF,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFF,0xFE,0x00,0x07,
+0xFE,0x03,0xE2,0xFF,0x15,0xFE,0x00,0xFF,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,
+0x00,0x1F,0xFF,0xFF,0xC0,0x1F,0xFC,0x03,0xFF,0x80,0x7F,0xE5,0xFF,0x0C,0xFC,0x01,
+0xFF,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFD,0xFF,0x04,0xFC,0x07,
+0xFC,0x00,0x1F,0xE5,0xFF,0x0C,0xF8,0x01,0xFF,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,
+0xFC,0x00,0x1F,0xFD,0xFF,0x04,0xF8,0x0F,0xF0,0x00,0x07,0xE5,0xFF,0x0C,0xF8,0x03,
+0xFF,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFD,0xFF,0x04,0xF8,0x0F,
+0xE0,0x00,0x03,0xE5,0xFF,0x0C,0xF0,0x07,0xFF,0xFC,0x00,0x3F,0xFE,0x00,0x1F,0xFF,
+0xFC,0x00,0x3F,0xFD,0xFF,0x04,0xF0,0x1F,0xC0,0x00,0x00,0xE5,0xFF,0x00,0xF0,0xFC,
+0x00,0x06,0x7E,0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFD,0xFF,0x04,0xF0,0x1F,0x80,0x00,
+0x00,0xE5,0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7E,0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFD,
+0xFF,0x01,0xE0,0x3F,0xFE,0x00,0x00,0x7F,0xE6,0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7E,
+0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFD,0xFF,0x01,0xC0,0x3F,0xFE,0x00,0x00,0x3F,0xE6,
+0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7E,0x00,0x0F,0xFF,0xFC,0x00,0x3F,0xFD,0xFF,0x05,
+0xC0,0x7E,0x00,0x3E,0x00,0x3F,0xE6,0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7E,0x00,0x0F,
+0xFF,0xF8,0x00,0x3F,0xFD,0xFF,0x05,0x80,0x7E,0x00,0x7F,0x80,0x1F,0xE6,0xFF,0x00,
+0xF0,0xFC,0x00,0x06,0x7E,0x00,0x0F,0xFF,0xF8,0x00,0x3F,0xFD,0xFF,0x05,0x80,0xFC,
+0x00,0xFF,0xC0,0x1F,0xE6,0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7F,0x00,0x0F,0xFF,0xF8,
+0x00,0x3F,0xFD,0xFF,0x05,0x01,0xFC,0x01,0xFF,0xE0,0x1F,0xE6,0xFF,0x00,0xF0,0xFC,
+0x00,0x06,0x7F,0x00,0x0F,0xFF,0xF8,0x00,0x3F,0xFD,0xFF,0x05,0x01,0xFC,0x03,0xFF,
+0xE0,0x0F,0xE6,0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7F,0x00,0x0F,0xFF,0xF8,0x00,0x7F,
+0xFE,0xFF,0x06,0xFE,0x03,0xFC,0x03,0xFF,0xF0,0x0F,0xE6,0xFF,0x00,0xF0,0xFC,0x00,
+0x06,0x7F,0x00,0x07,0xFF,0xF8,0x00,0x7F,0xFE,0xFF,0x06,0xFC,0x03,0xFC,0x03,0xFF,
+0xF0,0x0F,0xE6,0xFF,0x00,0xF0,0xFC,0x00,0x06,0x7F,0x00,0x07,0xFF,0xF0,0x00,0x7F,
+0xFE,0xFF,0x06,0xFC,0x07,0xFC,0x03,0xFF,0xF0,0x0F,0xE3,0xFF,0x09,0xFC,0x00,0x3F,
+0xFF,0x80,0x07,0xFF,0xF0,0x00,0x7F,0xFE,0xFF,0x06,0xF8,0x07,0xFC,0x03,0xFF,0xE0,
+0x0F,0xE3,0xFF,0x08,0xFC,0x00,0x3F,0xFF,0x80,0x03,0xFF,0xE0,0x00,0xFD,0xFF,0x06,
+0xF8,0x0F,0xFC,0x01,0xFF,0xE0,0x0F,0xE3,0xFF,0x08,0xFC,0x00,0x3F,0xFF,0x80,0x01,
+0xFF,0xC0,0x00,0xFD,0xFF,0x06,0xF0,0x1F,0xFC,0x01,0xFF,0xC0,0x1F,0xE3,0xFF,0x08,
+0xFC,0x00,0x3F,0xFF,0xC0,0x00,0xFF,0x80,0x00,0xFD,0xFF,0x06,0xF0,0x1F,0xFE,0x00,
+0xFF,0xC0,0x1F,0xE3,0xFF,0x08,0xFC,0x00,0x3F,0xFF,0xC0,0x00,0x3E,0x00,0x01,0xFD,
+0xFF,0x06,0xE0,0x3F,0xFE,0x00,0x7F,0x00,0x1F,0xE3,0xFF,0x04,0xFC,0x00,0x3F,0xFF,
+0xE0,0xFE,0x00,0x00,0x01,0xFD,0xFF,0x06,0xE0,0x3F,0xFF,0x00,0x0C,0x00,0x3F,0xE3,
+0xFF,0x04,0xFC,0x00,0x3F,0xFF,0xE0,0xFE,0x00,0x00,0x03,0xFD,0xFF,0x02,0xC0,0x7F,
+0xFF,0xFE,0x00,0x00,0x7F,0xE3,0xFF,0x04,0xFC,0x00,0x3F,0xFF,0xF0,0xFE,0x00,0x00,
+0x07,0xFD,0xFF,0x06,0x80,0x7F,0xFF,0x80,0x00,0x00,0x7F,0xE3,0xFF,0x04,0xFC,0x00,
+0x3F,0xFF,0xF8,0xFE,0x00,0x00,0x0F,0xFD,0xFF,0x05,0x80,0xFF,0xFF,0xC0,0x00,0x00,
+0xE2,0xFF,0x04,0xFC,0x00,0x3F,0xFF,0xFC,0xFE,0x00,0x00,0x0F,0xFD,0xFF,0x05,0x01,
+0xFF,0xFF,0xE0,0x00,0x01,0xE2,0xFF,0x04,0xFC,0x00,0x3F,0xFF,0xFE,0xFE,0x00,0x00,
+0x1F,0xFD,0xFF,0x05,0x01,0xFF,0xFF,0xF0,0x00,0x03,0xE2,0xFF,0x04,0xFC,0x00,0x3F,
+0xFF,0xFF,0xFE,0x00,0x00,0x7F,0xFE,0xFF,0x06,0xFE,0x03,0xFF,0xFF,0xF8,0x00,0x0F,
+0xE2,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFF,0x80,0x00,0x00,0xFD,0xFF,0x06,0xFE,0x03,
+0xFF,0xFF,0xFE,0x00,0x3F,0xE2,0xFF,0x07,0xFC,0x00,0x3F,0xFF,0xFF,0xE0,0x00,0x03,
+0xFD,0xFF,0x01,0xFE,0x07,0xD8,0xFF,0x02,0xF8,0x00,0x0F,0xD1,0xFF,0x00,0xC0,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xB7,0xFF,0x11,
+0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,
+0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,
+0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,
+0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,
+0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,
+0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,
+0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,
+0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,
+0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,
+0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,
+0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,
+0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xEA,0xFF,0x04,0xE3,0xF1,0xFE,
+0x3E,0x3F,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,
+0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xEA,0xFF,0x04,0xC1,0xE0,0xFC,0x1C,0x1F,0xFD,
+0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,
+0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0xC7,0xE3,0xFE,0x3F,0x1F,0xFF,0x9C,0xCE,0x79,
+0xD9,0xDF,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,
+0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0x33,0xDD,0xFD,0xDE,0xEF,0xFF,
+0x9C,0xCE,0x79,0xC9,0xCF,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,
+0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0x7B,0xBE,0xFD,
+0xDE,0xEF,0xFF,0xFC,0xFE,0x79,0xC9,0xCF,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,
+0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,
+0xFB,0x9D,0xFB,0xED,0xF7,0xFF,0xFC,0xFE,0x79,0xC9,0xCF,0xFD,0xFF,0x11,0xF2,0x4F,
+0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,
+0xF0,0xFF,0x0A,0xF7,0xCB,0xFB,0xED,0xF7,0xFF,0xFD,0xFE,0xF9,0x89,0x8F,0xFD,0xFF,
+0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,
+0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0xC7,0xE3,0xFB,0xED,0xF7,0xFF,0xF9,0xFC,0xFC,0x0C,
+0x0F,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,
+0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0xF3,0xD9,0xFB,0xED,0xF7,0xFF,0xF3,
+0xF9,0xFC,0x4C,0x4F,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,
+0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0xFB,0xBC,0xFB,0xED,
+0xF7,0xFF,0xE7,0xF3,0xFF,0xCF,0xCF,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,
+0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0xFB,
+0xBE,0xFB,0xED,0xF7,0xFF,0xCF,0xE7,0xF9,0xC9,0xCF,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,
+0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF0,
+0xFF,0x0A,0xFB,0xBE,0xFD,0xDE,0xEF,0xFF,0xCF,0xE7,0xFD,0x8D,0x8F,0xFD,0xFF,0x11,
+0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,
+0x3B,0x6F,0xF0,0xFF,0x0A,0x37,0xDD,0xBD,0xDE,0xEF,0xFF,0x80,0xC0,0x4C,0x1C,0x1F,
+0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,
+0xC7,0x11,0x1C,0x3B,0x6F,0xF0,0xFF,0x0A,0x0F,0xE3,0xBE,0x3F,0x1F,0xFF,0x80,0xC0,
+0x4E,0x3E,0x3F,0xFD,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,
+0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,
+0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,
+0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,
+0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,
+0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,
+0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,
+0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,
+0x6F,0xE1,0xFF,0x19,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,
+0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFF,0x0F,0xFE,0xFF,0xFF,0xF8,0x7F,0xE9,0xFF,
+0x14,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,
+0x1C,0x3B,0x6F,0xFF,0xFE,0xEF,0xFE,0xFF,0x01,0xF7,0x7F,0xFE,0xFF,0x00,0xFE,0xED,
+0xFF,0x14,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,
+0x11,0x1C,0x3B,0x6F,0xFF,0xFD,0xF7,0xFE,0xFF,0x01,0xEF,0xBF,0xFE,0xFF,0x00,0xFE,
+0xED,0xFF,0x14,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,
+0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFD,0xF7,0xFE,0xFF,0x01,0xEF,0xBF,0xFE,0xFF,0x00,
+0xFE,0xED,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,
+0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFD,0xFB,0x36,0xC2,0x3F,0xEF,0xF1,0xF0,0xF0,
+0xE3,0x84,0x63,0xC7,0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,
+0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFD,0xFB,0x35,0x99,0xBF,0xEF,
+0xEE,0xE2,0x6E,0xC3,0x75,0xDD,0xBB,0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,0x89,0xC6,
+0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFE,0x7B,0x35,
+0xBB,0xBF,0xF3,0xEE,0xE7,0x5E,0xCE,0xF5,0xDD,0x7B,0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,
+0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,
+0xFF,0x3A,0xAD,0xBB,0xBF,0xF9,0xDE,0xEF,0x7C,0xDF,0xE5,0xBD,0x7F,0xEF,0xFF,0x1F,
+0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,
+0x3B,0x6F,0xFF,0xFF,0xDA,0xAD,0xBB,0xBF,0xFE,0xC0,0xEF,0x62,0xDF,0x15,0x81,0x9F,
+0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,
+0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFF,0xDA,0xAD,0xBB,0xBF,0xFE,0xDF,0xEF,0x5E,0xDE,
+0xF5,0xBF,0xE7,0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,
+0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFB,0xD9,0x9D,0xBB,0xBF,0xDE,0xDF,
+0xEE,0xDC,0xDE,0xE5,0xBF,0xF7,0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,
+0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFB,0xD9,0x9B,0x77,
+0x7F,0xDE,0xDD,0xCE,0xBD,0xBD,0xEB,0xBA,0xF7,0xEF,0xFF,0x1F,0xF2,0x4F,0x1E,0x27,
+0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xFF,0xFB,
+0xB9,0x9B,0x77,0x7F,0xDD,0xD9,0xC5,0x99,0xBC,0xCB,0xB3,0x77,0xEF,0xFF,0x1F,0xF2,
+0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,
+0x6F,0xFF,0xFC,0x7B,0xBB,0x77,0x7F,0xE3,0xE3,0xD3,0xC5,0xBE,0x29,0xC7,0x0F,0xEF,
+0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,
+0x11,0x1C,0x3B,0x6F,0xF9,0xFF,0x00,0xDF,0xEA,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,
+0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF9,0xFF,0x00,
+0xDF,0xEA,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,
+0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF9,0xFF,0x00,0xDF,0xEA,0xFF,0x11,0xF2,0x4F,0x1E,
+0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xF9,
+0xFF,0x00,0xBF,0xEA,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,
+0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,
+0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,
+0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,
+0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,
+0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,
+0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,0x6F,0xE1,0xFF,0x11,0xF2,
+0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,0x18,0xC7,0x11,0x1C,0x3B,
+0x6F,0xE1,0xFF,0x11,0xF2,0x4F,0x1E,0x27,0x89,0xC6,0x78,0x9E,0x24,0x90,0xDC,0x39,
+0x18,0xC7,0x11,0x1C,0x3B,0x6F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xD1,0xFF,0x0E,0xDF,
+0xFF,0xFF,0xE3,0xF1,0xF9,0xF1,0xF1,0xFF,0xFF,0xE3,0xE3,0xF3,0xF3,0xE3,0xFE,0xFF,
+0x00,0x8F,0xE2,0xFF,0x0E,0x9F,0xFF,0xFF,0xDD,0xEE,0xE1,0xEE,0xEE,0xFF,0xFF,0xD9,
+0xDD,0xC3,0xC3,0xC1,0xFE,0xFF,0x00,0x77,0xE2,0xFF,0x12,0x1F,0xFF,0xFF,0x9C,0xCE,
+0x79,0xCE,0x4E,0x7F,0xFF,0x9C,0x9C,0xF3,0xF3,0x99,0xFF,0xFF,0xFE,0x73,0xE3,0xFF,
+0x13,0xFE,0x9F,0xFF,0xFF,0x9C,0xCE,0x79,0xCE,0x4E,0x7F,0xFF,0x9C,0x9C,0xF3,0xF3,
+0xF9,0xFF,0xFF,0xFE,0x73,0xE3,0xFF,0x13,0xFD,0x9F,0xFF,0xFF,0x9C,0xCE,0x79,0xCE,
+0x4E,0x7F,0xFF,0x9C,0x9C,0xF3,0xF3,0xF9,0xFF,0xFF,0xFE,0x73,0xE3,0xFF,0x13,0xFB,
+0x9F,0xFF,0xFF,0x9C,0xCE,0x79,0xCE,0x4E,0x7F,0xFF,0x8C,0x9C,0xF3,0xF3,0xFB,0xFF,
+0xFF,0xFE,0x73,0xE3,0xFF,0x0C,0xF8,0x0F,0xFF,0xFF,0x9C,0xCE,0x79,0xCE,0x4E,0x7F,
+0xFF,0xC0,0x9C,0xFE,0xF3,0x03,0xFF,0xFF,0xFE,0x73,0xE3,0xFF,0x13,0xF8,0x0F,0xFF,
+0xFF,0x9C,0xCE,0x79,0xCE,0x4E,0x7F,0xFF,0xF9,0x9C,0xF3,0xF3,0xF7,0xFF,0xFF,0xFE,
+0x73,0xE2,0xFF,0x12,0x9F,0xFF,0xFF,0x9C,0xCE,0x79,0xCE,0x4E,0x7F,0xFF,0xF9,0x9C,
+0xF3,0xF3,0xEE,0xFF,0xFF,0xFE,0x73,0xE2,0xFF,0x0E,0x9F,0xFF,0xFF,0xDD,0xEE,0xF9,
+0xEE,0xEE,0xFF,0xFF,0xE3,0xDD,0xF3,0xF3,0xC1,0xFE,0xFF,0x00,0x77,0xE2,0xFF,0x0E,
+0x9F,0xFF,0xFF,0xE3,0xF1,0xE0,0x71,0xF1,0xFF,0xFF,0x8F,0xE3,0xC0,0xC0,0x81,0xFE,
+0xFF,0x00,0x8F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,
+0xFF,0x81,0xFF,0x98,0xFF,
+};
+
+// BitmapWaveshare_black : 15000 bytes, packed 3177
+const unsigned char BitmapWaveshare_black_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0xE5,0xFF,0x00,0xF7,
+0xD0,0xFF,0x00,0xC3,0xD1,0xFF,0x01,0xFE,0x03,0xD1,0xFF,0x01,0xF0,0x07,0xD1,0xFF,
+0x01,0x80,0x07,0xD2,0xFF,0x02,0xFE,0x00,0x03,0xD2,0xFF,0x02,0xF8,0x00,0x03,0xD2,
+0xFF,0x02,0xE3,0xD0,0x03,0xD2,0xFF,0x02,0xCF,0xEB,0x03,0xD2,0xFF,0x02,0x03,0xE3,
+0x83,0xD3,0xFF,0x03,0xFE,0x43,0xF3,0xC3,0xD3,0xFF,0x04,0xF8,0xC3,0xF3,0xE3,0xFC,
+0xD4,0xFF,0x04,0xF3,0xE3,0xF9,0xE3,0xF8,0xD4,0xFF,0x04,0xE5,0xFF,0xF9,0xF3,0xE0,
+0xD4,0xFF,0x05,0xC8,0xFF,0xF9,0xF3,0x80,0x7F,0xD5,0xFF,0x05,0x92,0x7F,0xFB,0xF3,
+0x00,0x7F,0xD5,0xFF,0x05,0x30,0xFF,0xF3,0xF4,0x00,0x7F,0xD6,0xFF,0x06,0xFE,0x5B,
+0xFF,0xF3,0xF0,0x70,0x7F,0xD6,0xFF,0x06,0xFE,0x0B,0xFF,0xF3,0xE1,0xF8,0x7F,0xD6,
+0xFF,0x06,0xFC,0x09,0xFF,0xF3,0x85,0xFC,0x7F,0xD6,0xFF,0x06,0xF9,0x4C,0xFF,0xE7,
+0x3D,0xFE,0x7F,0xD6,0xFF,0x06,0xF2,0x7E,0x7F,0xE6,0xFD,0xFE,0x3F,0xD6,0xFF,0x06,
+0xF0,0x3F,0xBF,0xE1,0x99,0xFE,0x3F,0xD6,0xFF,0x06,0xE4,0x3F,0xDF,0xE3,0x9D,0xFF,
+0x3F,0xD6,0xFF,0x06,0xE4,0x5F,0xFF,0xC6,0x7D,0xFF,0x3F,0xD6,0xFF,0x06,0xCF,0xFF,
+0xFF,0xDE,0xFF,0xFF,0x1F,0xD6,0xFF,0x06,0xCF,0xFF,0xFF,0x93,0xFF,0xFF,0x9F,0xD6,
+0xFF,0x06,0xCC,0xFF,0xFF,0x33,0xFF,0xFF,0x9F,0xD6,0xFF,0x06,0xC0,0xFF,0xFE,0x1F,
+0xFD,0xFF,0x9F,0xD6,0xFF,0x06,0xC9,0xFF,0xFC,0x8F,0xFF,0xFF,0x8F,0xD6,0xFF,0x06,
+0xC9,0xFF,0xF9,0xDF,0xFD,0xFF,0x8F,0xD6,0xFF,0x06,0xCF,0xFF,0xF0,0xFF,0xF5,0xFF,
+0x8F,0xD6,0xFF,0x06,0xE7,0xFF,0xF6,0x7F,0xF5,0xFF,0x8F,0xD6,0xFF,0x06,0xE7,0xFF,
+0xE3,0x3F,0xB5,0xFF,0x87,0xD6,0xFF,0x06,0xF3,0xFF,0xEF,0x9F,0x0B,0xFF,0x87,0xD6,
+0xFF,0x06,0xF3,0xFF,0xCE,0x4F,0xA1,0xFF,0x87,0xD6,0xFF,0x06,0xF9,0xFF,0xD7,0x27,
+0xF3,0xFF,0x97,0xD6,0xFF,0x06,0xFC,0xFB,0xD3,0xC3,0xFB,0xFF,0x97,0xD6,0xFF,0x06,
+0xFE,0x7C,0xD3,0xE1,0xFB,0xFF,0x97,0xD7,0xFF,0x07,0xF0,0x0F,0x3E,0x1F,0xF1,0xFF,
+0xFF,0xC7,0xD7,0xFF,0x07,0xC0,0x00,0x0F,0x93,0xF8,0xDF,0xFF,0xC3,0xD7,0xFF,0x07,
+0xCF,0xFC,0x03,0x93,0xFE,0x5F,0xFF,0xC7,0xD7,0xFF,0x07,0xA3,0xFF,0xE0,0xCF,0xFF,
+0x3F,0xFF,0xC7,0xD7,0xFF,0x07,0x79,0xFF,0xFC,0x07,0xFF,0x3F,0x7F,0xE3,0xD8,0xFF,
+0x08,0xFE,0xFE,0x7F,0xF8,0xF7,0xFF,0x9F,0x3F,0xE3,0xD8,0xFF,0x08,0xFE,0xFF,0xFF,
+0xF3,0xD3,0xF7,0xDF,0xBF,0xE3,0xD8,0xFF,0x08,0xFC,0xBF,0xFF,0xC1,0xEB,0xFB,0xCF,
+0x9F,0xE3,0xD8,0xFF,0x08,0xFC,0x0F,0xFF,0xD8,0x71,0xFB,0xEF,0xCF,0xE7,0xD8,0xFF,
+0x08,0xF9,0xBF,0xFF,0xAF,0xF8,0xF9,0xE7,0xEF,0xE7,0xD8,0xFF,0x08,0xF9,0xFF,0xFF,
+0x47,0xFE,0x79,0xF7,0xF7,0xA7,0xD8,0xFF,0x08,0xFB,0xFF,0xFE,0x47,0xFF,0x39,0xF3,
+0xFB,0xA7,0xD8,0xFF,0x08,0xFA,0x3F,0xFC,0xEF,0xFF,0x99,0xFB,0xF9,0x87,0xD8,0xFF,
+0x0A,0xF2,0x3F,0xFC,0xFF,0xFF,0xC8,0xFD,0xFC,0x07,0xF8,0x3F,0xDA,0xFF,0x0A,0xF2,
+0x03,0xFD,0xFF,0xFF,0xE0,0xFC,0xFC,0x07,0xC0,0x0F,0xDA,0xFF,0x0A,0xF8,0x7F,0xF9,
+0xFF,0xFF,0xF8,0x7E,0x7E,0x0F,0x9F,0xE3,0xDA,0xFF,0x0A,0xF3,0xFF,0xFB,0xFF,0xFF,
+0xFC,0x3F,0x39,0x0F,0x20,0x19,0xDA,0xFF,0x02,0xF3,0x7F,0xFB,0xFE,0xFF,0x04,0x0F,
+0x90,0x0E,0x0F,0xC1,0xDA,0xFF,0x02,0xF2,0x3F,0xF3,0xFE,0xFF,0x04,0xC7,0xC0,0x0C,
+0x7F,0xF3,0xDA,0xFF,0x02,0xF2,0x3F,0xF3,0xFE,0xFF,0x04,0xF0,0x20,0x09,0xFF,0xF9,
+0xDA,0xFF,0x0A,0xFB,0xFF,0xF3,0xFF,0xFE,0xFF,0xFC,0x00,0x01,0xFF,0xF9,0xDA,0xFF,
+0x0A,0xFB,0xFF,0xEB,0xFF,0x80,0x3F,0xFC,0x00,0x07,0xFF,0xFC,0xDA,0xFF,0x0A,0xF9,
+0x1F,0xDB,0xD8,0x1F,0xC7,0xFF,0x00,0x0F,0xFF,0xFC,0xDA,0xFF,0x08,0xF9,0x1E,0x5B,
+0xCC,0x3F,0xF8,0x3F,0x80,0x0F,0xD8,0xFF,0x08,0xFC,0xBF,0x1B,0xFF,0x8F,0xFF,0x80,
+0x00,0x1F,0xD8,0xFF,0x08,0xFC,0xFF,0x3B,0xFF,0xF9,0xFF,0xFF,0x00,0x1F,0xD8,0xFF,
+0x02,0xFE,0x7E,0xBB,0xFD,0xFF,0x01,0x80,0x1F,0xD7,0xFF,0x07,0x3E,0xB3,0xFF,0xFF,
+0xCF,0xFE,0x00,0x3F,0xD7,0xFF,0x07,0xBE,0x53,0xFF,0xFF,0xF3,0xFE,0x00,0x3F,0xD7,
+0xFF,0x07,0x9F,0x13,0xFF,0xFF,0xF8,0xF8,0x04,0x7F,0xD7,0xFF,0x07,0xCF,0x83,0xFF,
+0xFF,0xFE,0x18,0x0C,0x7F,0xD7,0xFF,0x01,0xE7,0xC3,0xFE,0xFF,0x01,0xC0,0x1C,0xD6,
+0xFF,0x01,0xF3,0xE7,0xFE,0xFF,0x01,0xFC,0x7C,0xD6,0xFF,0x01,0xF8,0xE3,0xFE,0xFF,
+0x01,0xF9,0xFD,0xD6,0xFF,0x06,0xFE,0x73,0xFF,0xFE,0xFF,0xE3,0xFD,0xD5,0xFF,0x04,
+0x33,0xFD,0xFE,0xF8,0x8F,0xD4,0xFF,0x04,0x93,0xEB,0x7E,0xF8,0x3F,0xD4,0xFF,0x03,
+0xC3,0xE8,0xFF,0xF8,0xD3,0xFF,0x03,0xE1,0xF1,0xFF,0xC3,0xD3,0xFF,0x03,0xF9,0xF3,
+0xFF,0x0F,0xD3,0xFF,0x03,0xFC,0xF7,0xF8,0x7F,0xD3,0xFF,0x02,0xFE,0x77,0xC1,0xD1,
+0xFF,0x01,0x20,0x1F,0xD1,0xFF,0x00,0xE0,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x9B,0xFF,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xF6,0x00,
+0x00,0x03,0xFD,0xFF,0xD4,0x00,0x00,0x07,0xFD,0xFF,0x00,0xF8,0xD5,0x00,0x00,0x07,
+0xFC,0xFF,0xD5,0x00,0x00,0x07,0xFC,0xFF,0x00,0xE0,0xD6,0x00,0x00,0x07,0xFC,0xFF,
+0x00,0xF0,0xD6,0x00,0x00,0x07,0xFC,0xFF,0x00,0xFC,0xD6,0x00,0x00,0x07,0xFC,0xFF,
+0x11,0xFE,0x00,0x00,0x0F,0x00,0x01,0xE0,0x00,0x78,0x00,0x7F,0xFE,0x00,0x7C,0x00,
+0x00,0x07,0xCF,0xFE,0xFF,0x10,0x80,0x7F,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x00,0x3F,
+0xFF,0x00,0x0F,0xFF,0xFF,0xE0,0x1F,0xFE,0xFF,0xFE,0x00,0x00,0x07,0xFB,0xFF,0x10,
+0x80,0x00,0x0F,0x00,0x01,0xE0,0x00,0x78,0x01,0xFF,0xFF,0x80,0x3E,0x00,0x00,0x0F,
+0x8F,0xFE,0xFF,0x10,0x81,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x00,0xFF,0xFF,0xC0,
+0x0F,0xFF,0xFF,0xF8,0x1F,0xFE,0xFF,0xFE,0x00,0x00,0x07,0xFB,0xFF,0x10,0xC0,0x00,
+0x0F,0x00,0x01,0xE0,0x00,0x78,0x07,0xFF,0xFF,0xE0,0x3E,0x00,0x00,0x0F,0x8F,0xFE,
+0xFF,0x10,0x83,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x03,0xFF,0xFF,0xF0,0x0F,0xFF,
+0xFF,0xFC,0x1F,0xFE,0xFF,0xFE,0x00,0x00,0x07,0xFD,0xFF,0x12,0xF9,0xFF,0xE0,0x00,
+0x0F,0x00,0x01,0xE0,0x00,0x78,0x0F,0xFF,0xFF,0xF0,0x1F,0x00,0x00,0x1F,0x0F,0xFE,
+0xFF,0x10,0x87,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x07,0xFF,0xFF,0xF8,0x0F,0xFF,
+0xFF,0xFE,0x1F,0xFE,0xFF,0xFE,0x00,0x00,0x07,0xFD,0xFF,0x12,0xF1,0xFF,0xF0,0x00,
+0x0F,0x00,0x01,0xE0,0x00,0x78,0x1F,0xFF,0xFF,0xF8,0x1F,0x00,0x00,0x1F,0x0F,0xFE,
+0xFF,0x0C,0x87,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x0F,0xFF,0xFF,0xFC,0x0F,0xFE,
+0xFF,0x00,0x1F,0xFE,0xFF,0xFE,0x00,0x00,0x07,0xFD,0xFF,0x26,0xE1,0xFF,0xF8,0x00,
+0x0F,0x00,0x01,0xE0,0x00,0x78,0x1F,0xE0,0x07,0xF8,0x0F,0x80,0x00,0x3E,0x0F,0x80,
+0x00,0x00,0x07,0xF0,0x00,0x00,0x1E,0x00,0x00,0x1E,0x0F,0xF0,0x03,0xFC,0x0F,0x00,
+0x01,0xFF,0x1F,0xFB,0x00,0x00,0x07,0xFD,0xFF,0x12,0xC1,0xFF,0xFC,0x00,0x0F,0x00,
+0x01,0xE0,0x00,0x78,0x3F,0x80,0x01,0xFC,0x07,0x80,0x00,0x3E,0x0F,0xFE,0x00,0x10,
+0x07,0x80,0x00,0x00,0x1E,0x00,0x00,0x1E,0x1F,0xC0,0x00,0x7E,0x0F,0x00,0x00,0x1F,
+0x1E,0xFB,0x00,0x00,0x07,0xFD,0xFF,0x12,0x81,0xFF,0xFC,0x00,0x0F,0x00,0x01,0xE0,
+0x00,0x78,0x3F,0x00,0x00,0x7C,0x07,0xC0,0x00,0x7C,0x0F,0xFE,0x00,0x10,0x07,0x80,
+0x00,0x00,0x1E,0x00,0x00,0x1E,0x1F,0x80,0x00,0x3E,0x0F,0x00,0x00,0x0F,0x1E,0xFB,
+0x00,0x00,0x07,0xFD,0xFF,0x12,0x01,0xFF,0xFE,0x00,0x0F,0x00,0x01,0xE0,0x00,0x78,
+0x3E,0x00,0x00,0x7C,0x03,0xC0,0x00,0x7C,0x0F,0xFE,0x00,0x10,0x07,0x80,0x00,0x00,
+0x1E,0x00,0x00,0x1E,0x1F,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1E,0xFB,0x00,0x00,
+0x07,0xFE,0xFF,0x27,0xFE,0x01,0xFF,0xFF,0x00,0x0F,0x00,0x01,0xE0,0x00,0x78,0x3C,
+0x00,0x00,0x3C,0x03,0xE0,0x00,0xF8,0x0F,0x80,0x00,0x00,0x07,0xC0,0x00,0x00,0x1F,
+0x00,0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1F,0xFB,0x00,0x00,0x07,
+0xFE,0xFF,0x2A,0xFC,0x01,0xFF,0xFF,0x00,0x0F,0x00,0x01,0xE0,0x00,0x78,0x3C,0x00,
+0x00,0x3C,0x01,0xE0,0x00,0xF8,0x0F,0xFF,0xFF,0xF0,0x07,0xFF,0xFF,0xF0,0x1F,0xFF,
+0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1F,0xFF,0xFF,0xE0,0xFE,0x00,
+0x00,0x07,0xFE,0xFF,0x2A,0xF8,0x01,0xFF,0xFF,0x80,0x0F,0x00,0x01,0xE0,0x00,0x78,
+0x3C,0x00,0x00,0x3C,0x01,0xF0,0x01,0xF0,0x0F,0xFF,0xFF,0xF0,0x07,0xFF,0xFF,0xFC,
+0x1F,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1F,0xFF,0xFF,0xE0,
+0xFE,0x00,0x00,0x07,0xFE,0xFF,0x2A,0xF8,0x01,0xFF,0xFF,0x80,0x0F,0x00,0x01,0xE0,
+0x00,0x78,0x3C,0x00,0x00,0x3C,0x00,0xF8,0x01,0xE0,0x0F,0xFF,0xFF,0xF0,0x07,0xFF,
+0xFF,0xFE,0x1F,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1F,0xFF,
+0xFF,0xE0,0xFE,0x00,0x00,0x07,0xFE,0xFF,0x2A,0xF8,0x01,0xFF,0xFF,0xC0,0x0F,0x00,
+0x01,0xE0,0x00,0x78,0x3C,0x00,0x00,0x3C,0x00,0xF8,0x03,0xE0,0x0F,0xFF,0xFF,0xF0,
+0x01,0xFF,0xFF,0xFE,0x1F,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x00,0x1F,
+0x1F,0xFF,0xFF,0xE0,0xFE,0x00,0x27,0x07,0xC0,0x1F,0x01,0xFC,0x01,0xE0,0xFF,0xC0,
+0x0F,0x00,0x01,0xE0,0x00,0x78,0x3C,0x00,0x00,0x3C,0x00,0x7C,0x03,0xC0,0x0F,0xFF,
+0xFF,0xF0,0x00,0x7F,0xFF,0xFF,0x1F,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x1E,0x0F,0xFE,
+0xFF,0x03,0x1F,0xFF,0xFF,0xE0,0xFE,0x00,0x17,0x07,0xC0,0x1F,0x01,0xF8,0x01,0xC0,
+0x7F,0xC0,0x0F,0x00,0x01,0xE0,0x00,0x78,0x3F,0xFF,0xFF,0xFC,0x00,0x7C,0x07,0xC0,
+0x0F,0xFB,0x00,0x09,0x3F,0x1E,0x00,0x00,0x1E,0x1F,0xFF,0xFF,0xFE,0x0F,0xFE,0xFF,
+0x00,0x1F,0xFB,0x00,0x17,0x07,0xC0,0x1F,0x01,0xF8,0x01,0xC0,0x7F,0xE0,0x0F,0x00,
+0x01,0xE0,0x00,0x78,0x3F,0xFF,0xFF,0xFC,0x00,0x3E,0x07,0x80,0x0F,0xFB,0x00,0x0D,
+0x1F,0x1E,0x00,0x00,0x1E,0x1F,0xFF,0xFF,0xFE,0x0F,0xFF,0xFF,0xFE,0x1E,0xFB,0x00,
+0x17,0x07,0xC0,0x0E,0x00,0xF0,0x07,0xC0,0x3F,0xE0,0x0F,0x00,0x01,0xE0,0x00,0x78,
+0x3F,0xFF,0xFF,0xFC,0x00,0x3E,0x0F,0x80,0x0F,0xFB,0x00,0x0D,0x0F,0x1E,0x00,0x00,
+0x1E,0x1F,0xFF,0xFF,0xFE,0x0F,0xFF,0xFF,0xFC,0x1E,0xFB,0x00,0x17,0x07,0xC0,0x0E,
+0x00,0xF0,0x07,0x80,0x3F,0xE0,0x0F,0x00,0x01,0xE0,0x00,0x78,0x3F,0xFF,0xFF,0xFC,
+0x00,0x1F,0x0F,0x00,0x0F,0xFB,0x00,0x0D,0x0F,0x1E,0x00,0x00,0x1E,0x1F,0xFF,0xFF,
+0xFE,0x0F,0xFF,0xFF,0xF8,0x1E,0xFB,0x00,0x17,0x07,0xC0,0x0C,0x00,0xF0,0x0F,0x80,
+0x1F,0xF0,0x0F,0x00,0x01,0xE0,0x00,0x78,0x3F,0xFF,0xFF,0xFC,0x00,0x1F,0x1F,0x00,
+0x0F,0xFB,0x00,0x0D,0x0F,0x1E,0x00,0x00,0x1E,0x1F,0xFF,0xFF,0xFE,0x0F,0xFF,0xF7,
+0x80,0x1E,0xFB,0x00,0x17,0x07,0xE0,0x04,0x00,0x60,0x0F,0x00,0x1F,0xF0,0x0F,0x00,
+0x01,0xE0,0x00,0x78,0x3C,0x00,0x00,0x3C,0x00,0x0F,0x9E,0x00,0x0F,0xFB,0x00,0x0D,
+0x0F,0x1E,0x00,0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x0F,0xF0,0x00,0x1E,0xFB,0x00,
+0x17,0x07,0xE0,0x04,0x00,0x60,0x1F,0x00,0x0F,0xF0,0x0F,0x00,0x01,0xE0,0x00,0x78,
+0x3C,0x00,0x00,0x3C,0x00,0x0F,0xBE,0x00,0x0F,0xFB,0x00,0x0D,0x0F,0x1E,0x00,0x00,
+0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x07,0xF8,0x00,0x1E,0xFB,0x00,0x17,0x07,0xE0,0x04,
+0x00,0x40,0x1E,0x00,0x0F,0xF0,0x0F,0x00,0x01,0xE0,0x00,0x78,0x3C,0x00,0x00,0x3C,
+0x00,0x07,0xFC,0x00,0x0F,0xFB,0x00,0x0D,0x0F,0x1E,0x00,0x00,0x1E,0x1E,0x00,0x00,
+0x1E,0x0F,0x01,0xFE,0x00,0x1E,0xFB,0x00,0x01,0x07,0xF0,0xFE,0x00,0x12,0x0E,0x00,
+0x07,0xF0,0x0F,0x80,0x01,0xE0,0x00,0xF8,0x3C,0x00,0x00,0x3C,0x00,0x07,0xFC,0x00,
+0x0F,0xFB,0x00,0x0D,0x1F,0x1E,0x00,0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0xFF,
+0x00,0x1E,0xFB,0x00,0x01,0x07,0xF0,0xFE,0x00,0x13,0x0C,0x00,0x07,0xF0,0x0F,0xF0,
+0x03,0xE0,0x07,0xF8,0x3C,0x00,0x00,0x3C,0x00,0x03,0xF8,0x00,0x0F,0x80,0xFC,0x00,
+0x0D,0xFF,0x1E,0x00,0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x3F,0x80,0x1F,0xFB,
+0x00,0x01,0x07,0xF0,0xFE,0x00,0x04,0x04,0x00,0x03,0xF0,0x0F,0xFD,0xFF,0x09,0xF8,
+0x3C,0x00,0x00,0x3C,0x00,0x03,0xF8,0x00,0x0F,0xFE,0xFF,0x10,0x87,0xFF,0xFF,0xFE,
+0x1E,0x00,0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x1F,0xE0,0x1F,0xFE,0xFF,0xFE,
+0x00,0x01,0x07,0xF8,0xFE,0x00,0x04,0x04,0x00,0x03,0xF0,0x0F,0xFD,0xFF,0x09,0xF8,
+0x3C,0x00,0x00,0x3C,0x00,0x01,0xF0,0x00,0x0F,0xFE,0xFF,0x10,0x87,0xFF,0xFF,0xFE,
+0x1E,0x00,0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x07,0xF0,0x1F,0xFE,0xFF,0xFE,
+0x00,0x01,0x07,0xF8,0xFC,0x00,0x02,0x01,0xF0,0x07,0xFD,0xFF,0x09,0xF0,0x3C,0x00,
+0x00,0x3C,0x00,0x01,0xF0,0x00,0x0F,0xFE,0xFF,0x10,0x87,0xFF,0xFF,0xFC,0x1E,0x00,
+0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x03,0xFC,0x1F,0xFE,0xFF,0xFE,0x00,0x01,
+0x03,0xF8,0xFD,0x00,0x03,0x04,0x01,0xF0,0x01,0xFD,0xFF,0x09,0xE0,0x3C,0x00,0x00,
+0x3C,0x00,0x00,0xE0,0x00,0x0F,0xFE,0xFF,0x10,0x87,0xFF,0xFF,0xF8,0x1E,0x00,0x00,
+0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x01,0xFE,0x1F,0xFE,0xFF,0xFE,0x00,0x0A,0x03,
+0xFC,0x00,0x20,0x00,0x00,0x06,0x00,0xF0,0x00,0x3F,0xFE,0xFF,0x09,0x00,0x3C,0x00,
+0x00,0x3C,0x00,0x00,0xC0,0x00,0x0F,0xFE,0xFF,0x10,0x07,0xFF,0xFF,0xC0,0x1E,0x00,
+0x00,0x1E,0x1E,0x00,0x00,0x1E,0x0F,0x00,0x00,0x7F,0x9F,0xFE,0xFF,0xFE,0x00,0x08,
+0x03,0xFC,0x00,0x20,0x00,0x00,0x0E,0x00,0xF0,0xD8,0x00,0x08,0x03,0xFC,0x00,0x30,
+0x00,0x00,0x0F,0x00,0xF0,0xD8,0x00,0x08,0x03,0xFE,0x00,0x70,0x01,0x00,0x0F,0x00,
+0xF0,0xD8,0x00,0x08,0x03,0xFE,0x00,0x78,0x03,0x00,0x1E,0x00,0xF0,0xD8,0x00,0x08,
+0x01,0xFE,0x00,0x78,0x03,0x80,0x1E,0x01,0xF0,0xD8,0x00,0x08,0x01,0xFF,0x00,0xF8,
+0x03,0x80,0x3E,0x01,0xF0,0xD8,0x00,0x08,0x01,0xFF,0x00,0xFC,0x07,0x80,0x3C,0x03,
+0xF0,0xD7,0x00,0x09,0xFF,0x00,0xFC,0x07,0xC0,0x7C,0x03,0xF0,0x00,0x04,0xEB,0x00,
+0x00,0x20,0xFC,0x00,0x00,0x10,0xF6,0x00,0x09,0xFF,0x81,0xFC,0x0F,0xC0,0x78,0x07,
+0xF0,0x00,0x04,0xEB,0x00,0x00,0x20,0xFC,0x00,0x00,0x10,0xF6,0x00,0x09,0x7F,0x81,
+0xFE,0x0F,0xFF,0xE0,0x07,0xF0,0x00,0x04,0xEB,0x00,0x00,0x20,0xFC,0x00,0x00,0x10,
+0xF6,0x00,0x00,0x7F,0xFD,0xFF,0x04,0xE0,0x0F,0xF0,0x00,0x04,0xEB,0x00,0x00,0x20,
+0xFC,0x00,0x00,0x10,0xF6,0x00,0x00,0x3F,0xFD,0xFF,0x28,0xE0,0x0F,0xF0,0x0F,0x04,
+0x78,0x01,0xE2,0x13,0x03,0xE0,0x00,0x0F,0x88,0x00,0x00,0x40,0xF8,0x07,0x00,0x7C,
+0x04,0x78,0x38,0x01,0xE0,0x00,0x23,0xC0,0x0F,0x10,0x98,0x1F,0x10,0x00,0x00,0x81,
+0xF1,0x01,0x81,0xE0,0xFD,0x00,0x00,0x3F,0xFD,0xFF,0x28,0xE0,0x0F,0xF0,0x19,0x85,
+0x8C,0x06,0x1A,0x14,0x0C,0x30,0x00,0x18,0x48,0x80,0x80,0x41,0x8C,0x0C,0xC1,0x86,
+0x04,0x8C,0xC6,0x06,0x18,0x00,0x2C,0x60,0x30,0xD0,0xA0,0x71,0x91,0x01,0x00,0x83,
+0x19,0x1E,0x06,0x18,0xFD,0x00,0x00,0x1F,0xFD,0xFF,0x28,0xE0,0x0F,0xF0,0x10,0x06,
+0x06,0x0C,0x06,0x18,0x18,0x08,0x00,0x20,0x38,0x80,0xC0,0x82,0x02,0x08,0x03,0x01,
+0x07,0x05,0x02,0x0C,0x04,0x00,0x30,0x30,0x60,0x30,0xC0,0xC0,0x71,0x01,0x81,0x04,
+0x07,0x1C,0x08,0x0C,0xFD,0x00,0x00,0x0F,0xFD,0xFF,0x28,0xE0,0x0F,0xF0,0x10,0x06,
+0x02,0x18,0x06,0x18,0x10,0x04,0x00,0x40,0x18,0x41,0xC0,0x84,0x01,0x08,0x02,0x00,
+0x86,0x03,0x02,0x08,0x02,0x00,0x30,0x10,0xC0,0x30,0x80,0x80,0x30,0x83,0x81,0x08,
+0x03,0x18,0x18,0x04,0xFD,0x00,0x00,0x0F,0xFD,0xFF,0x28,0xE0,0x3F,0xF0,0x10,0x04,
+0x02,0x10,0x02,0x10,0x30,0x04,0x00,0xC0,0x18,0x41,0x21,0x84,0x01,0x08,0x04,0x00,
+0x86,0x02,0x03,0x10,0x02,0x00,0x20,0x10,0x80,0x10,0x81,0x80,0x30,0x82,0xC2,0x18,
+0x03,0x18,0x10,0x02,0xFD,0x00,0x00,0x07,0xFD,0xFF,0x28,0xE0,0x7F,0xF0,0x0C,0x04,
+0x02,0x10,0x02,0x10,0x3F,0xFE,0x00,0x80,0x08,0x21,0x21,0x0F,0xFF,0x86,0x04,0x00,
+0xC4,0x02,0x03,0x1F,0xFE,0x00,0x20,0x10,0x80,0x10,0x81,0x00,0x10,0xC6,0x42,0x10,
+0x01,0x18,0x1F,0xFE,0xFD,0x00,0x00,0x03,0xFD,0xFF,0x27,0xE0,0xFF,0xF0,0x06,0x04,
+0x02,0x10,0x02,0x10,0x30,0x00,0x00,0x80,0x08,0x22,0x31,0x0C,0x00,0x03,0x04,0x00,
+0x44,0x02,0x03,0x10,0x00,0x00,0x20,0x10,0x80,0x10,0x81,0x00,0x10,0x44,0x46,0x10,
+0x01,0x18,0x10,0xFC,0x00,0x00,0x01,0xFD,0xFF,0x27,0xE1,0xFF,0xF0,0x01,0x84,0x02,
+0x10,0x02,0x10,0x20,0x00,0x00,0x80,0x08,0x32,0x12,0x08,0x00,0x00,0x84,0x00,0xC4,
+0x02,0x03,0x10,0x00,0x00,0x20,0x10,0x80,0x10,0x81,0x00,0x10,0x44,0x24,0x10,0x01,
+0x18,0x10,0xFB,0x00,0xFD,0xFF,0x27,0xE3,0xFF,0xF0,0x00,0x84,0x02,0x10,0x02,0x10,
+0x30,0x00,0x00,0xC0,0x18,0x14,0x12,0x04,0x00,0x00,0x44,0x00,0x84,0x02,0x03,0x10,
+0x00,0x00,0x20,0x10,0x80,0x10,0x81,0x80,0x30,0x28,0x24,0x18,0x03,0x18,0x10,0xFB,
+0x00,0x00,0x7F,0xFC,0xFF,0x26,0xF0,0x00,0x84,0x02,0x18,0x06,0x10,0x10,0x04,0x00,
+0x40,0x18,0x1C,0x0C,0x04,0x01,0x00,0x42,0x00,0x84,0x02,0x03,0x08,0x02,0x00,0x20,
+0x10,0xC0,0x30,0x80,0x80,0x30,0x38,0x18,0x08,0x03,0x18,0x18,0x04,0xFC,0x00,0x00,
+0x1F,0xFC,0xFF,0x26,0xF0,0x00,0x84,0x02,0x0C,0x06,0x10,0x18,0x08,0x00,0x20,0x38,
+0x0C,0x0C,0x02,0x03,0x00,0x43,0x01,0x04,0x02,0x03,0x0C,0x04,0x00,0x20,0x10,0x60,
+0x30,0x80,0xC0,0x70,0x10,0x18,0x04,0x07,0x18,0x08,0x0C,0xFC,0x00,0x00,0x0F,0xFC,
+0xFF,0x26,0xF0,0x11,0x84,0x02,0x06,0x1A,0x10,0x0C,0x30,0x00,0x18,0xC8,0x08,0x04,
+0x03,0x8E,0x18,0x81,0x86,0x04,0x02,0x03,0x06,0x18,0x00,0x20,0x10,0x30,0xD0,0x80,
+0x71,0x90,0x10,0x10,0x07,0x19,0x18,0x06,0x18,0xFC,0x00,0x00,0x03,0xFC,0xFF,0x0B,
+0xF0,0x0E,0x04,0x02,0x01,0xE2,0x10,0x03,0xE0,0x00,0x0F,0x88,0xFE,0x00,0x17,0xF8,
+0x07,0x00,0x7C,0x04,0x02,0x00,0x01,0xF0,0x00,0x20,0x10,0x0F,0x10,0x80,0x1F,0x10,
+0x00,0x00,0x01,0xF1,0x00,0x03,0xE0,0xFB,0x00,0xFC,0xFF,0x00,0xF0,0xD5,0x00,0x00,
+0x1F,0xFD,0xFF,0x00,0xF0,0xD5,0x00,0x00,0x03,0xFD,0xFF,0x00,0xF0,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x9D,0x00,
+};
+
+// BitmapWaveshare_red : 15000 bytes, packed 1774
+const unsigned char BitmapWaveshare_red_packed[] PROGMEM =
+{
+0x98,0x3A,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0xF3,0xFF,0x00,0x00,0xD1,0xFF,0x02,0xF8,0x00,0x0F,0xD2,0xFF,
+0x02,0xF1,0xFF,0x83,0xD2,0xFF,0x02,0xE7,0xFF,0xF0,0xD2,0xFF,0x03,0xDF,0xFF,0xD8,
+0x7F,0xD3,0xFF,0x03,0x9F,0xF8,0x1B,0x1F,0xD5,0xFF,0x05,0x7F,0xF3,0xBF,0xF8,0x0B,
+0xCF,0xD6,0xFF,0x06,0xFE,0x1F,0x81,0x3F,0xFF,0xE3,0xE7,0xD6,0xFF,0x06,0xFE,0xCF,
+0x1C,0x3F,0xFF,0xF3,0xE3,0xD6,0xFF,0x06,0xFE,0xE0,0x9C,0x3F,0xFF,0xFB,0xCB,0xD6,
+0xFF,0x06,0xFC,0xF0,0x9C,0x1F,0xFF,0xF3,0xD9,0xD6,0xFF,0x08,0x7E,0xFE,0xD9,0x9F,
+0xFF,0xF7,0x9C,0xFF,0x87,0xD9,0xFF,0x09,0xFE,0x3E,0x3E,0x59,0xCC,0xFF,0xE4,0x1C,
+0xFF,0x23,0xD8,0xFF,0x08,0x7F,0x1F,0x19,0xCC,0xFF,0xE0,0xC6,0xFE,0xF9,0xD7,0xFF,
+0x07,0x1F,0x19,0xE4,0xFF,0xC7,0xE0,0x7E,0xF9,0xD7,0xFF,0x07,0x1F,0x93,0xE4,0xFF,
+0xCF,0xFF,0x7F,0xF9,0xD7,0xFF,0x07,0x2F,0x93,0xF4,0xFF,0x9F,0xFF,0x7D,0xF9,0xD8,
+0xFF,0x08,0xFE,0x6F,0xC7,0xF0,0x3F,0x3F,0xFF,0x3D,0xF9,0xD8,0xFF,0x09,0xE0,0x7F,
+0xC7,0xF2,0x7E,0x7F,0xFF,0x3D,0xF9,0xFD,0xEA,0xFF,0x00,0xEF,0xF1,0xFF,0x09,0x80,
+0x1F,0xCF,0xF0,0xFC,0xFF,0xFF,0x39,0xF8,0xF8,0xDA,0xFF,0x0A,0xFE,0x07,0x8F,0xCF,
+0xF1,0xF9,0xFF,0xFF,0x33,0xFC,0x78,0xDA,0xFF,0x0A,0xF8,0x63,0xE7,0xE7,0xF1,0xF3,
+0xFF,0xFF,0x27,0xFE,0x1F,0xEA,0xFF,0x00,0x7F,0xF2,0xFF,0x08,0xF1,0xF1,0xF3,0xE7,
+0xF3,0xF7,0xFF,0xFF,0x0F,0xE9,0xFF,0x00,0xFD,0xF1,0xFF,0x0B,0xE7,0xF9,0xF9,0xE3,
+0xE3,0xE7,0xFF,0xFF,0x3F,0xF3,0xFF,0xFD,0xDB,0xFF,0x0B,0xCF,0xFC,0xFC,0xE1,0xE7,
+0xC7,0xFF,0xFE,0x7F,0xF3,0xFF,0xFD,0xEC,0xFF,0x00,0xF7,0xF1,0xFF,0x0B,0xDF,0xFC,
+0xFE,0x71,0xCF,0xCF,0xFF,0xF8,0x7F,0xF7,0xF3,0xFD,0xEC,0xFF,0x00,0xEF,0xF1,0xFF,
+0x0A,0x9F,0xFE,0xFF,0x70,0x9F,0xCF,0xFC,0x00,0xFF,0xFF,0xF7,0xFB,0xFF,0x00,0x87,
+0xFA,0xFF,0x01,0xFC,0x07,0xEA,0xFF,0x07,0x9F,0xFE,0x7F,0x32,0x3F,0x8F,0xE0,0x05,
+0xF9,0xFF,0x01,0xFE,0x10,0xFB,0xFF,0x02,0xC0,0x00,0x03,0xFB,0xFF,0x00,0xBF,0xF1,
+0xFF,0x07,0x3F,0xFE,0x7F,0x38,0x7F,0x8F,0x80,0x19,0xF9,0xFF,0x02,0xF9,0xFE,0x3F,
+0xFD,0xFF,0x03,0xC0,0x00,0x00,0x19,0xFB,0xFF,0x00,0x7F,0xF1,0xFF,0x07,0x3F,0xFF,
+0x3F,0xBC,0x7F,0x8F,0x03,0xF3,0xFE,0xFF,0x00,0xF3,0xFD,0xFF,0x02,0xE7,0xFF,0x8F,
+0xFE,0xFF,0x05,0xFC,0x00,0xE0,0x00,0x0C,0x7F,0xEB,0xFF,0x07,0x3F,0xFF,0x3F,0x9C,
+0x7F,0x8E,0x03,0xC7,0xFE,0xFF,0x00,0xF3,0xFD,0xFF,0x02,0x1F,0xFF,0xE7,0xFE,0xFF,
+0x05,0xF1,0x3F,0xFF,0xE0,0x04,0x7F,0xEB,0xFF,0x07,0x3F,0xFF,0x9F,0x8D,0x3F,0x8C,
+0x07,0x1F,0xFE,0xFF,0x00,0xF7,0xFE,0xFF,0x03,0xFC,0x7F,0xFF,0xF3,0xFE,0xFF,0x05,
+0xC6,0x7F,0xFF,0xF8,0x42,0x7F,0xEB,0xFF,0x09,0x7F,0xFF,0x8F,0xC1,0x9F,0x84,0x1C,
+0x7F,0xFE,0x00,0xFC,0xFF,0x03,0xF3,0xFF,0x00,0xFD,0xFE,0xFF,0x04,0x9D,0xFF,0xFF,
+0xFE,0x22,0xEA,0xFF,0x0B,0x7F,0xF7,0xCF,0xC1,0x9F,0x84,0x18,0xFF,0xFC,0x00,0x00,
+0x03,0xFE,0xFF,0x03,0xCF,0xF8,0x0C,0x1C,0xFE,0xFF,0x04,0x3B,0xFF,0xFF,0xFE,0x10,
+0xEB,0xFF,0x17,0xFE,0x7F,0xE3,0xE3,0xC0,0x8F,0x00,0x13,0xFF,0xF0,0xFF,0x00,0x00,
+0x47,0xFF,0xFC,0x7F,0xE1,0xFF,0xC6,0x7F,0xFF,0xFC,0x77,0xFE,0xFF,0x00,0x18,0xEB,
+0xFF,0x17,0xFE,0x3F,0xE3,0xF0,0x00,0xCE,0x00,0x27,0xFF,0xE1,0xFF,0xE3,0xF8,0x03,
+0xFF,0x83,0xFF,0xC7,0xFF,0xF1,0x3F,0xFF,0xF9,0xE7,0xFE,0xFF,0x00,0x88,0xEB,0xFF,
+0x0B,0xFE,0x3F,0xFF,0xFC,0x00,0x4C,0x00,0x27,0xFF,0x07,0xFF,0xF0,0xFE,0x00,0x08,
+0x1F,0xFF,0x9F,0xFF,0xFC,0x1F,0xFF,0xE3,0x8F,0xFE,0xFF,0x00,0x88,0xEB,0xFF,0x1B,
+0xFE,0x1F,0xFF,0xFF,0x01,0x00,0x00,0x67,0xFC,0x0F,0xFF,0xF8,0x07,0xFC,0x01,0xF9,
+0xFE,0x7F,0xFF,0xFF,0x0F,0xFF,0x07,0x3F,0xFF,0xFF,0xF9,0x80,0xEB,0xFF,0x0B,0xFE,
+0x4F,0xFF,0xFF,0xC1,0x80,0x70,0x00,0x00,0x3F,0xDF,0xFC,0xFE,0xFF,0x01,0xF8,0xFC,
+0xFE,0xFF,0x07,0xC0,0x40,0x3C,0x7F,0xFF,0xFF,0xFD,0xC0,0xEB,0xFF,0x10,0xFE,0x27,
+0xFF,0xFF,0xC1,0xC0,0x08,0x00,0x00,0xFF,0x9F,0xFE,0x7F,0xFF,0xFF,0xFD,0xF9,0xFE,
+0xFF,0x02,0xF8,0x00,0x81,0xFD,0xFF,0x00,0xE0,0xEB,0xFF,0x0C,0xFE,0x33,0xFF,0xFF,
+0xC0,0xE0,0x00,0x38,0x00,0xFF,0xBF,0xFE,0x7F,0xFE,0xFF,0x00,0xF3,0xFD,0xFF,0x01,
+0xC0,0x3F,0xFD,0xFF,0x00,0xE0,0xEB,0xFF,0x0C,0xFE,0x1D,0xFF,0xFF,0xE0,0x70,0x04,
+0x18,0x00,0x7F,0xFF,0xFF,0x7F,0xFE,0xFF,0x00,0xE7,0xF7,0xFF,0x00,0xF0,0xEB,0xFF,
+0x0C,0xFE,0x0E,0x7F,0xFF,0xE0,0x00,0x04,0x08,0x18,0x3F,0xFF,0xFF,0x7F,0xFE,0xFF,
+0x00,0xCF,0xF7,0xFF,0x01,0xFC,0x7F,0xEC,0xFF,0x0C,0xFE,0x47,0x1F,0xFF,0xF0,0x00,
+0x04,0x08,0x8E,0x3F,0xFF,0xFF,0x3F,0xFE,0xFF,0x00,0x9F,0xF7,0xFF,0x02,0xFE,0x07,
+0x8F,0xEC,0xFF,0x0B,0x61,0xC7,0xFF,0xFC,0x00,0x0C,0x00,0x86,0x3F,0xFF,0xFF,0x3F,
+0xFE,0xFF,0x00,0xBF,0xF6,0xFF,0x00,0x01,0xEB,0xFF,0x0B,0x30,0xF1,0xFF,0xFF,0x82,
+0x18,0x00,0x87,0x3F,0xFF,0xFF,0xBF,0xFE,0xFF,0x00,0x3F,0xF6,0xFF,0x02,0x8F,0xFF,
+0xFD,0xED,0xFF,0x0F,0x38,0x1C,0xC1,0xFF,0xF1,0xF0,0x01,0xC7,0x3F,0xFF,0xFF,0x9F,
+0xFF,0xFF,0xFE,0x7F,0xF6,0xFF,0x02,0xE3,0xFF,0xF3,0xED,0xFF,0x0E,0x3E,0x00,0x04,
+0x7F,0x00,0x01,0x03,0xC3,0x3F,0xFF,0xFF,0x8F,0xFF,0xFF,0xFE,0xF5,0xFF,0x02,0xF8,
+0x7F,0xDF,0xED,0xFF,0x02,0xBF,0x87,0x83,0xFE,0x00,0x08,0x21,0xC3,0x9F,0xFF,0xFF,
+0x8F,0xFF,0xFF,0xFD,0xF5,0xFF,0x01,0xFE,0x03,0xEC,0xFF,0x0E,0x9F,0xFF,0xF1,0xE6,
+0x00,0xC2,0x61,0xC3,0x9F,0xFF,0xFF,0x9F,0xFF,0xFF,0xF9,0xDE,0xFF,0x0E,0xDF,0xFF,
+0xF0,0x78,0x00,0x82,0x61,0xE1,0x9F,0xFF,0xFF,0x9F,0xFF,0xFF,0xF3,0xDD,0xFF,0x06,
+0xCF,0xE0,0x00,0x01,0x06,0x61,0xE1,0xFE,0xFF,0x03,0x9F,0xFF,0xFF,0xE7,0xDE,0xFF,
+0x07,0x3F,0xCF,0xE4,0x00,0x01,0x00,0x40,0xF0,0xFE,0xFF,0x03,0x1F,0xFF,0xFF,0xCF,
+0xDE,0xFF,0x0E,0x79,0xFF,0xFE,0x04,0x01,0x80,0x41,0xD0,0x7F,0xFF,0xFF,0x1F,0xFF,
+0xFF,0x1F,0xDE,0xFF,0x0E,0xFC,0x7F,0xF8,0x00,0x13,0x80,0x40,0x88,0x3F,0xFF,0xFF,
+0x4F,0xFF,0xF8,0x3F,0xDD,0xFF,0x0C,0x0F,0xE0,0x23,0xE7,0xC2,0x00,0x8C,0x0F,0xFF,
+0xFF,0x4F,0xFF,0xF8,0xDC,0xFF,0x0C,0x80,0x06,0x4F,0x8F,0xE3,0x00,0xFE,0x03,0xFF,
+0xFE,0x47,0xFF,0xE1,0xDC,0xFF,0x0C,0xFC,0x7C,0x9C,0x3F,0xF3,0x00,0xFF,0x80,0xFF,
+0xFE,0x13,0xFC,0x07,0xDB,0xFF,0x0B,0xF9,0xB1,0xFF,0xF1,0x80,0x7F,0xC0,0x3F,0xFC,
+0x00,0x00,0x3F,0xDB,0xFF,0x0A,0xF1,0x07,0xFF,0xF9,0xC0,0x7F,0xF0,0x0F,0xFC,0x00,
+0x03,0xDA,0xFF,0x0A,0xF3,0x1F,0xFF,0xF9,0xE0,0x3F,0xFE,0x01,0xF0,0x00,0x7F,0xDA,
+0xFF,0x09,0xE3,0x3F,0xFF,0xFC,0xF0,0x3F,0xFF,0x00,0x00,0x3F,0xD9,0xFF,0x08,0xE7,
+0x3F,0xFF,0xFC,0x78,0x1F,0xFF,0xC0,0x01,0xD8,0xFF,0x08,0xC6,0x3F,0xFF,0xFC,0x7E,
+0x1F,0xFF,0xF0,0x03,0xD8,0xFF,0x08,0xC6,0x3F,0xFF,0xFC,0x3F,0x8F,0xFF,0xF8,0x07,
+0xD8,0xFF,0x08,0xCE,0x3F,0xFF,0xFC,0x9F,0xC7,0xFF,0xFC,0x0F,0xD8,0xFF,0x08,0xCC,
+0x9F,0xFF,0xFC,0x9F,0xE7,0xFF,0xFE,0x1F,0xD8,0xFF,0x08,0xC8,0xCF,0xFF,0xFD,0x9F,
+0xE0,0xFF,0xFE,0x3F,0xD8,0xFF,0x08,0xC0,0xE7,0xFC,0x79,0xDF,0xF0,0x7F,0xFE,0x3F,
+0xD8,0xFF,0x08,0xC1,0xF0,0xF0,0x73,0xDF,0xF0,0x7F,0xFC,0x7F,0xD8,0xFF,0x07,0xC1,
+0xFC,0x03,0x07,0xDF,0xF0,0xFF,0xF8,0xD7,0xFF,0x07,0xC1,0xFF,0xFF,0xDF,0xDF,0xF2,
+0x3F,0xE3,0xD7,0xFF,0x00,0xC1,0xFE,0xFF,0x03,0xDF,0xF3,0x0F,0x07,0xD7,0xFF,0x00,
+0xC1,0xFE,0xFF,0x03,0xDF,0xF3,0x80,0x1F,0xD7,0xFF,0x00,0xC1,0xFE,0xFF,0x02,0x9F,
+0xF3,0xE0,0xD6,0xFF,0x00,0xE1,0xFE,0xFF,0x01,0x9F,0xF3,0xD5,0xFF,0x00,0xE1,0xFE,
+0xFF,0x01,0x9F,0xF3,0xD5,0xFF,0x00,0xE1,0xFE,0xFF,0x01,0x9F,0xF3,0xD5,0xFF,0x05,
+0xF1,0xFE,0x7F,0xFF,0x9F,0xF3,0xD5,0xFF,0x05,0xF0,0xFF,0x7F,0xFF,0x8F,0xE7,0xD5,
+0xFF,0x05,0xF0,0x3F,0xFF,0xFF,0x8F,0xE7,0xD5,0xFF,0x05,0xF9,0x0F,0x80,0x0F,0x8F,
+0xCF,0xD5,0xFF,0x05,0xF8,0xC0,0x00,0x01,0x87,0xCF,0xD5,0xFF,0x05,0xFC,0xF8,0x3F,
+0xE0,0x17,0x9F,0xD5,0xFF,0x05,0xFC,0xFF,0xFF,0xFC,0x12,0x3F,0xD5,0xFF,0x05,0xFE,
+0x7F,0xFF,0xFE,0x00,0x7F,0xD5,0xFF,0x04,0xFE,0x7F,0xFF,0xFF,0x81,0xD3,0xFF,0x00,
+0x1F,0xD0,0xFF,0x00,0x87,0xD0,0xFF,0x00,0xC1,0xD0,0xFF,0x00,0xF0,0xD0,0xFF,0x01,
+0xFC,0x7F,0xD1,0xFF,0x01,0xFE,0x7F,0xD1,0xFF,0x01,0xFE,0x3F,0xFD,0xFF,0x00,0x1F,
+0xD5,0xFF,0x00,0x3F,0xFE,0xFF,0x01,0xFC,0x0F,0xD5,0xFF,0x00,0xBF,0xFE,0xFF,0x01,
+0xF8,0x07,0xD5,0xFF,0x00,0x9F,0xFE,0xFF,0x01,0xF1,0xC3,0xD5,0xFF,0x00,0x9F,0xFE,
+0xFF,0x01,0xF3,0xE3,0xD5,0xFF,0x00,0xDF,0xFE,0xFF,0x01,0xF3,0xE3,0xD5,0xFF,0x00,
+0xDF,0xFE,0xFF,0x01,0xE4,0x73,0xD5,0xFF,0x00,0xDF,0xFE,0xFF,0x01,0xE0,0x33,0xD5,
+0xFF,0x00,0xDF,0xFE,0xFF,0x01,0xC0,0x13,0xD5,0xFF,0x00,0xCF,0xFE,0xFF,0x01,0x87,
+0x03,0xD5,0xFF,0x00,0xEF,0xFE,0xFF,0x01,0x1F,0x83,0xD5,0xFF,0x05,0xE7,0xFF,0xFF,
+0xFE,0x3F,0xC3,0xD5,0xFF,0x05,0xF7,0xFF,0xFF,0xFC,0x7F,0xC7,0xD5,0xFF,0x05,0xFB,
+0xFF,0xFF,0xF9,0xFF,0xE7,0xD5,0xFF,0x05,0xF9,0xFF,0xFF,0xE3,0xFF,0xE3,0xD5,0xFF,
+0x05,0xFC,0x7F,0xFF,0xCF,0xFF,0xE3,0xD4,0xFF,0x04,0x1F,0xFF,0x1F,0xFF,0xF3,0xD4,
+0xFF,0x04,0xC7,0xFC,0x7F,0xFF,0xF3,0xD4,0xFF,0x04,0xF0,0x01,0xFF,0xFF,0xF3,0xD3,
+0xFF,0x03,0xEF,0xFF,0xFF,0xF9,0xD0,0xFF,0x00,0xFC,0xD0,0xFF,0x00,0xFE,0xD0,0xFF,
+0x01,0xFE,0x3F,0xD0,0xFF,0x00,0x87,0xD0,0xFF,0x01,0xF0,0xC1,0xD0,0xFF,0x00,0xE1,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x8A,0xFF,
+};
+
+#endif
@@ -30,56 +30,36 @@
 
 GxGDEW042Z15::GxGDEW042Z15(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW042Z15_WIDTH, GxGDEW042Z15_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#elif GxEPD_INTERLEAVED_3C
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer) / 2);
+#else
+  _initFrameBuffer<FrameBuffer>(_black_buffer, _red_buffer, sizeof(_black_buffer));
+#endif
 }
 
 void GxGDEW042Z15::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW042Z15_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW042Z15_WIDTH - x - 1;
-      y = GxGDEW042Z15_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW042Z15_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW042Z15_WIDTH / 8;
-  if (_current_page < 0)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW042Z15_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW042Z15_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW042Z15_WIDTH / 8;
-  }
+void GxGDEW042Z15::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+void GxGDEW042Z15::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW042Z15::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDEW042Z15::init(uint32_t serial_diag_bitrate)
@@ -97,6 +77,7 @@ void GxGDEW042Z15::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -104,37 +85,23 @@ void GxGDEW042Z15::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW042Z15::fillScreen(uint16_t color)
 {
-  uint8_t black = 0x00;
-  uint8_t red = 0x00;
-  if (color == GxEPD_WHITE);
-  else if (color == GxEPD_BLACK) black = 0xFF;
-  else if (color == GxEPD_RED) red = 0xFF;
-  else if ((color & 0xF100) > (0xF100 / 2))  red = 0xFF;
-  else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = 0xFF;
-  for (uint16_t x = 0; x < sizeof(_black_buffer); x++)
-  {
-    _black_buffer[x] = black;
-    _red_buffer[x] = red;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW042Z15::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-  {
-    uint8_t data = i < sizeof(_black_buffer) ? _black_buffer[i] : 0x00;
-    IO.writeDataTransaction(~data);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 0, 0, GxGDEW042Z15_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   IO.writeCommandTransaction(0x13); // red
-  for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-  {
-    uint8_t data = i < sizeof(_red_buffer) ? _red_buffer[i] : 0x00;
-    IO.writeDataTransaction(~data);
-  }
+  IO.startTransaction();
+  _writePlaneData(IO, 1, 0, GxGDEW042Z15_BUFFER_SIZE, true, 0xFF);
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -154,6 +121,7 @@ void GxGDEW042Z15::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t
 void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true; // remember
@@ -162,35 +130,13 @@ void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // 0xFF is white
-      if (i < black_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
-#else
-        data = black_bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, black_bitmap, black_size, GxGDEW042Z15_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // 0xFF is white
-      if (i < red_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
-#else
-        data = red_bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, red_bitmap, red_size, GxGDEW042Z15_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12); //display refresh
     _waitWhileBusy("drawPicture");
     IO.writeCommandTransaction(0x92); // partial out
@@ -200,35 +146,13 @@ void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     _using_partial_mode = false;
     _wakeUp();
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < black_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
-#else
-        data = black_bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, black_bitmap, black_size, GxGDEW042Z15_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < red_size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
-#else
-        data = red_bitmap[i];
-#endif
-        if (mode & bm_invert_red) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, red_bitmap, red_size, GxGDEW042Z15_BUFFER_SIZE, mode & bm_invert_red, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12); //display refresh
     _waitWhileBusy("drawPicture");
     _sleep();
@@ -238,6 +162,7 @@ void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
 void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_default) mode |= bm_normal;
   if (mode & bm_partial_update)
   {
@@ -247,25 +172,11 @@ void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW042Z15_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
     IO.writeCommandTransaction(0x92); // partial out
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
@@ -276,25 +187,11 @@ void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      IO.writeDataTransaction(data);
-    }
+    IO.startTransaction();
+    _writeBitmapData(IO, bitmap, size, GxGDEW042Z15_BUFFER_SIZE, mode & bm_invert, 0xFF);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
     IO.writeCommandTransaction(0x12); //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -304,6 +201,7 @@ void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
 void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
@@ -312,15 +210,9 @@ void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
     IO.writeCommandTransaction(0x12); //display refresh
     _waitWhileBusy("eraseDisplay");
     IO.writeCommandTransaction(0x92); // partial out
@@ -330,15 +222,9 @@ void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
     IO.writeCommandTransaction(0x12); //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -348,6 +234,7 @@ void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
 void GxGDEW042Z15::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -392,27 +279,23 @@ void GxGDEW042Z15::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde); // exclusive
   IO.writeCommandTransaction(0x10); // black
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW042Z15_WIDTH / 8) + xss_d8;
+    _writePlaneData(IO, 0, idx, xse_d8 - xss_d8, true, 0xFF);
   }
+  IO.endTransaction();
   delay(2);
   //_setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x13); // red
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    uint32_t idx = uint32_t(y1) * (GxGDEW042Z15_WIDTH / 8) + xss_d8;
+    _writePlaneData(IO, 1, idx, xse_d8 - xss_d8, true, 0xFF);
   }
+  IO.endTransaction();
 #ifdef USE_PARTIAL_UPDATE_WORKAROUND
   _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
 #endif
@@ -420,6 +303,7 @@ void GxGDEW042Z15::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
 
 void GxGDEW042Z15::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -458,6 +342,7 @@ void GxGDEW042Z15::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
 
 void GxGDEW042Z15::powerDown()
 {
+  _finishAsync();
   _sleep();
 }
 
@@ -484,15 +369,9 @@ uint16_t GxGDEW042Z15::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 void GxGDEW042Z15::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
-  { //=0 BUSY
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > GxGDEW042Z15_BUSY_TIMEOUT)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+  if (!_waitBusy(_busy, LOW, GxGDEW042Z15_BUSY_TIMEOUT)) //=0 BUSY
+  {
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -510,6 +389,14 @@ void GxGDEW042Z15::_waitWhileBusy(const char* comment)
 }
 
 void GxGDEW042Z15::_wakeUp(void)
+{
+  _startWakeUp();
+  _waitWhileBusy("Power On");
+  IO.writeCommandTransaction(0x00);
+  IO.writeDataTransaction(0x0f); // LUT from OTP Pixel with B/W/R.
+}
+
+void GxGDEW042Z15::_startWakeUp()
 {
   if (_rst >= 0)
   {
@@ -523,17 +410,24 @@ void GxGDEW042Z15::_wakeUp(void)
   IO.writeDataTransaction (0x17);
   IO.writeDataTransaction (0x17);
   IO.writeCommandTransaction(0x04);
-  _waitWhileBusy("Power On");
-  IO.writeCommandTransaction(0x00);
-  IO.writeDataTransaction(0x0f); // LUT from OTP Pixel with B/W/R.
 }
 
 void GxGDEW042Z15::_sleep(void)
+{
+  _startPowerOff();
+  _waitWhileBusy("Power Off");
+  _deepSleep();
+}
+
+void GxGDEW042Z15::_startPowerOff()
 {
   IO.writeCommandTransaction(0x50); // border floating
   IO.writeDataTransaction(0x17);
   IO.writeCommandTransaction(0x02); // power off
-  _waitWhileBusy("Power Off");
+}
+
+void GxGDEW042Z15::_deepSleep()
+{
   if (_rst >= 0)
   {
     IO.writeCommandTransaction(0x07); // deep sleep
@@ -541,42 +435,101 @@ void GxGDEW042Z15::_sleep(void)
   }
 }
 
+bool GxGDEW042Z15::isBusy()
+{
+  return (_busy >= 0) && (digitalRead(_busy) == 0); //=0 BUSY, no BUSY pin: never
+}
+
+#if GxEPD_ASYNC_UPDATE
+bool GxGDEW042Z15::_asyncPowerOn()
+{
+  if (_current_page != -1) return false;
+  _using_partial_mode = false;
+  _startWakeUp();
+  return true;
+}
+
+bool GxGDEW042Z15::_asyncTransfer()
+{
+  if (_async_index == 0)
+  {
+    IO.writeCommandTransaction(0x00); // as _wakeUp() after power on
+    IO.writeDataTransaction(0x0f); // LUT from OTP Pixel with B/W/R.
+  }
+  if (_fb_interleaved)
+  {
+    // the planes are de-interleaved while sent, a chunk per poll()
+    uint8_t plane = _async_index / GxGDEW042Z15_BUFFER_SIZE;
+    uint32_t idx = _async_index % GxGDEW042Z15_BUFFER_SIZE;
+    if (idx == 0) IO.writeCommandTransaction(plane ? 0x13 : 0x10); // black, red
+    uint32_t n = gx_uint32_min(GxGDEW042Z15_BUFFER_SIZE - idx, GxEPD_ASYNC_CHUNK);
+    IO.startTransaction();
+    _writePlaneData(IO, plane, idx, n, true, 0xFF);
+    IO.endTransaction();
+    _async_index += n;
+    return _async_index < 2 * GxGDEW042Z15_BUFFER_SIZE;
+  }
+  if (_async_index == 0)
+  {
+    _async_index = 1;
+    IO.queueCommand(0x10); // black
+    _queueBufferData(IO, _fb_black, _fb_size, GxGDEW042Z15_BUFFER_SIZE, true, 0xFF);
+    IO.queueCommand(0x13); // red
+    _queueBufferData(IO, _fb_red, _fb_size, GxGDEW042Z15_BUFFER_SIZE, true, 0xFF);
+    IO.startQueue();
+  }
+  return IO.processQueue();
+}
+
+void GxGDEW042Z15::_asyncRefresh()
+{
+  IO.writeCommandTransaction(0x12); //display refresh
+}
+
+void GxGDEW042Z15::_asyncPowerOff()
+{
+  _startPowerOff();
+}
+
+void GxGDEW042Z15::_asyncSleep()
+{
+  _deepSleep();
+}
+#endif
+
 void GxGDEW042Z15::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   IO.writeCommandTransaction(0x13); // red
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -585,39 +538,36 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(void))
 void GxGDEW042Z15::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   IO.writeCommandTransaction(0x13); // red
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -626,39 +576,36 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW042Z15::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   IO.writeCommandTransaction(0x13); // red
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -667,39 +614,36 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW042Z15::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 0, true, 0xFF);
   }
+  _endPipeline(IO);
   IO.writeCommandTransaction(0x13); // red
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  _beginPipeline();
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    _sendPage(IO, 1, true, 0xFF);
   }
-  _current_page = -1;
+  _endPipeline(IO);
+  _endPaged();
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -729,6 +673,7 @@ void GxGDEW042Z15::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -737,27 +682,32 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
   }
   _using_partial_mode = true;
   IO.writeCommandTransaction(0x91); // partial in
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042Z15_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042Z15_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("updateToWindow");
   IO.writeCommandTransaction(0x92); // partial out
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -766,27 +716,32 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
   }
   _using_partial_mode = true;
   IO.writeCommandTransaction(0x91); // partial in
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042Z15_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042Z15_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("updateToWindow");
   IO.writeCommandTransaction(0x92); // partial out
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -795,27 +750,32 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
   }
   _using_partial_mode = true;
   IO.writeCommandTransaction(0x91); // partial in
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042Z15_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042Z15_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("updateToWindow");
   IO.writeCommandTransaction(0x92); // partial out
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -824,22 +784,26 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(const void*, const voi
   }
   _using_partial_mode = true;
   IO.writeCommandTransaction(0x91); // partial in
-  for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042Z15_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042Z15_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   _waitWhileBusy("updateToWindow");
   IO.writeCommandTransaction(0x92); // partial out
-  _current_page = -1;
+  _endPaged();
 }
 
 void GxGDEW042Z15::drawCornerTest(uint8_t em)
@@ -848,6 +812,7 @@ void GxGDEW042Z15::drawCornerTest(uint8_t em)
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW042Z15_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW042Z15_WIDTH / 8; x++)
@@ -857,14 +822,12 @@ void GxGDEW042Z15::drawCornerTest(uint8_t em)
       if ((x > GxGDEW042Z15_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
       if ((x > GxGDEW042Z15_WIDTH / 8 - 4) && (y > GxGDEW042Z15_HEIGHT - 25)) data = 0x00;
       if ((x < 4) && (y > GxGDEW042Z15_HEIGHT - 33)) data = 0x00;
-      IO.writeDataTransaction(data);
+      IO.writeData(data);
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x13); // red
-  for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-  {
-    IO.writeDataTransaction(0xFF); // 0xFF is white
-  }
+  IO.writeDataPatternTransaction(0xFF, GxGDEW042Z15_BUFFER_SIZE);
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
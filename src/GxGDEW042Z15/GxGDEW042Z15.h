@@ -21,7 +21,7 @@
 
 #define GxGDEW042Z15_BUFFER_SIZE (uint32_t(GxGDEW042Z15_WIDTH) * uint32_t(GxGDEW042Z15_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW042Z15_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW042Z15_HEIGHT
 #define GxGDEW042Z15_PAGES 30
 
 #define GxGDEW042Z15_PAGE_HEIGHT (GxGDEW042Z15_HEIGHT / GxGDEW042Z15_PAGES)
@@ -38,6 +38,10 @@ class GxGDEW042Z15 : public GxEPD
     GxGDEW042Z15(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -56,7 +60,8 @@ class GxGDEW042Z15 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW042Z15_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW042Z15_PAGES with the static frame buffer,
+    // about twice as many with setPipelinedPaging(), once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -68,6 +73,8 @@ class GxGDEW042Z15 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0);
+    const char* panelName() {return "GDEW042Z15";};
+    bool isBusy();
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -79,11 +86,28 @@ class GxGDEW042Z15 : public GxEPD
     void _writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h);
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
+    void _startWakeUp();
     void _sleep(void);
+    void _startPowerOff();
+    void _deepSleep();
+#if GxEPD_ASYNC_UPDATE
+    bool _asyncPowerOn();
+    bool _asyncTransfer();
+    void _asyncRefresh();
+    void _asyncPowerOff();
+    void _asyncSleep();
+#endif
     void _waitWhileBusy(const char* comment = 0);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW042Z15_WIDTH, GxGDEW042Z15_HEIGHT, 2, GxEPD_INTERLEAVED_3C ? GxFB_INTERLEAVED : 0> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif GxEPD_INTERLEAVED_3C && defined(__AVR)
+    uint8_t _buffer[2 * GxGDEW042Z15_PAGE_SIZE]; // black and red interleaved
+#elif GxEPD_INTERLEAVED_3C
+    uint8_t _buffer[2 * GxGDEW042Z15_BUFFER_SIZE]; // black and red interleaved
+#elif defined(__AVR)
     uint8_t _black_buffer[GxGDEW042Z15_PAGE_SIZE];
     uint8_t _red_buffer[GxGDEW042Z15_PAGE_SIZE];
 #else
@@ -91,7 +115,6 @@ class GxGDEW042Z15 : public GxEPD
     uint8_t _red_buffer[GxGDEW042Z15_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -112,6 +135,7 @@ class GxGDEW042Z15 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW042Z15_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW042Z15/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW042Z15/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW042Z15/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,841 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 33600 bytes, packed 13148
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x40,0x83,0x00,0x00,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x87,0xFF,0x09,0x80,0x00,0x07,
+0xFF,0xFF,0xF8,0x01,0xFF,0xFC,0x00,0xFE,0xFF,0x25,0xF0,0x07,0xE0,0x03,0xFE,0x01,
+0xFF,0xF8,0x00,0x7F,0x80,0x3F,0xC0,0x1F,0xFF,0xFC,0x00,0x00,0x0F,0xFF,0xFE,0x00,
+0x01,0xFF,0xFF,0xE0,0x01,0xFF,0xE0,0x00,0x1F,0xFE,0x00,0x00,0x07,0x80,0x00,0x3F,
+0xE9,0xFF,0x32,0x00,0x00,0x07,0xFF,0xFF,0xE0,0x00,0x7F,0xE0,0x00,0x1F,0xFF,0xFF,
+0xF0,0x07,0xC0,0x03,0xFC,0x01,0xFF,0x80,0x00,0x07,0x00,0x3F,0xC0,0x1F,0xFF,0xFC,
+0x00,0x00,0x0F,0xFF,0xFE,0x00,0x00,0x3F,0xFF,0xE0,0x01,0xFF,0xE0,0x00,0x03,0xFE,
+0x00,0x00,0x07,0x00,0x00,0x0F,0xE9,0xFF,0x32,0x00,0x00,0x07,0xFF,0xFF,0x80,0x00,
+0x1F,0xE0,0x00,0x0F,0xFF,0xFF,0xF0,0x07,0xC0,0x03,0xFC,0x01,0xFE,0x00,0x00,0x07,
+0x00,0x7F,0x80,0x3F,0xFF,0xF8,0x00,0x00,0x1F,0xFF,0xFE,0x00,0x00,0x1F,0xFF,0xC0,
+0x01,0xFF,0xE0,0x00,0x01,0xFC,0x00,0x00,0x0F,0x00,0x00,0x03,0xE9,0xFF,0x32,0x00,
+0x00,0x0F,0xFF,0xFF,0x00,0x00,0x0F,0xC0,0x00,0x07,0xFF,0xFF,0xE0,0x0F,0xC0,0x01,
+0xFC,0x01,0xFC,0x00,0x00,0x07,0x00,0x7F,0x80,0x3F,0xFF,0xF8,0x00,0x00,0x1F,0xFF,
+0xFE,0x00,0x00,0x0F,0xFF,0xC0,0x01,0xFF,0xE0,0x00,0x00,0xFC,0x00,0x00,0x0F,0x00,
+0x00,0x01,0xE9,0xFF,0x32,0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x0F,0xC0,0x00,0x03,
+0xFF,0xFF,0xE0,0x0F,0xC0,0x01,0xFC,0x03,0xF0,0x00,0x00,0x0F,0x00,0x7F,0x80,0x3F,
+0xFF,0xF8,0x00,0x00,0x1F,0xFF,0xFC,0x00,0x00,0x0F,0xFF,0x80,0x01,0xFF,0xC0,0x00,
+0x00,0xFC,0x00,0x00,0x0F,0x00,0x00,0x01,0xE9,0xFF,0x32,0x00,0x00,0x0F,0xFF,0xFE,
+0x00,0x00,0x07,0xC0,0x00,0x03,0xFF,0xFF,0xE0,0x0F,0xC0,0x01,0xFC,0x03,0xF0,0x00,
+0x00,0x0F,0x00,0x7F,0x80,0x3F,0xFF,0xF8,0x00,0x00,0x1F,0xFF,0xFC,0x00,0x00,0x07,
+0xFF,0x00,0x01,0xFF,0xC0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x00,0x00,0x01,0xEA,0xFF,
+0x01,0xFE,0x01,0xFE,0xFF,0x2E,0xFE,0x00,0x60,0x07,0xC0,0x00,0x03,0xFF,0xFF,0xE0,
+0x0F,0x80,0x00,0xF8,0x03,0xE0,0x00,0x00,0x0E,0x00,0xFF,0x80,0x3F,0xFF,0xF8,0x00,
+0x00,0x3F,0xFF,0xFC,0x00,0x00,0x07,0xFF,0x00,0x00,0xFF,0xC0,0x00,0x00,0x7C,0x00,
+0x00,0x1E,0x00,0x00,0x01,0xEA,0xFF,0x01,0xFE,0x01,0xFE,0xFF,0x19,0xFE,0x01,0xF0,
+0x07,0xC7,0xF0,0x03,0xFF,0xFF,0xC0,0x0F,0x80,0x00,0xF8,0x03,0xC0,0x01,0xFF,0x1E,
+0x00,0xFF,0x00,0x7F,0xFF,0xF0,0x07,0xFE,0xFF,0x11,0xFC,0x01,0xE0,0x07,0xFE,0x00,
+0x00,0xFF,0xC0,0x1E,0x00,0x78,0x03,0xFF,0xFE,0x00,0xFC,0x01,0xEA,0xFF,0x01,0xFE,
+0x01,0xFE,0xFF,0x19,0xFE,0x01,0xF8,0x07,0xFF,0xF8,0x03,0xFF,0xFF,0xC0,0x1F,0x80,
+0x00,0xF8,0x03,0x80,0x07,0xFF,0x9E,0x00,0xFF,0x00,0x7F,0xFF,0xF0,0x07,0xFE,0xFF,
+0x11,0xFC,0x01,0xF0,0x07,0xFE,0x00,0x00,0xFF,0xC0,0x1F,0x00,0x78,0x03,0xFF,0xFE,
+0x00,0xFE,0x01,0xEA,0xFF,0x01,0xFE,0x01,0xFE,0xFF,0x19,0xFE,0x01,0xF0,0x07,0xFF,
+0xF8,0x03,0xFF,0xFF,0xC0,0x1F,0x80,0x00,0xF8,0x07,0x80,0x0F,0xFF,0xFE,0x00,0xFF,
+0x00,0x7F,0xFF,0xF0,0x07,0xFE,0xFF,0x11,0xF8,0x03,0xF0,0x07,0xFC,0x01,0x00,0xFF,
+0x80,0x3F,0x00,0x78,0x03,0xFF,0xFE,0x00,0xFE,0x01,0xEA,0xFF,0x1E,0xFC,0x00,0x0F,
+0xFF,0xFF,0xFE,0x00,0xE0,0x0F,0xFF,0xF8,0x03,0xFF,0xFF,0xC0,0x1F,0x80,0x00,0x78,
+0x07,0x80,0x1F,0xFF,0xFE,0x00,0xFF,0x00,0x7F,0xFF,0xF0,0x07,0xFE,0xFF,0x11,0xF8,
+0x03,0xF0,0x07,0xF8,0x01,0x00,0xFF,0x80,0x3F,0x00,0x78,0x03,0xFF,0xFE,0x01,0xFC,
+0x01,0xEA,0xFF,0x17,0xFC,0x00,0x03,0xFF,0xFF,0xFE,0x00,0x00,0x0F,0xFF,0xE0,0x07,
+0xFF,0xFF,0xC0,0x1F,0x00,0x00,0x70,0x07,0x00,0x3F,0xFF,0xFC,0xFE,0x00,0x18,0x7F,
+0xFF,0xE0,0x00,0x00,0xFF,0xFF,0xF8,0x03,0xE0,0x07,0xF8,0x03,0x00,0xFF,0x80,0x3E,
+0x00,0x70,0x00,0x00,0x7C,0x01,0xF0,0x01,0xEA,0xFF,0x02,0xFC,0x00,0x00,0xFE,0xFF,
+0x11,0x00,0x00,0x1F,0xF0,0x00,0x07,0xFF,0xFF,0x80,0x1F,0x00,0x80,0x70,0x07,0x00,
+0x3F,0xFF,0xFC,0xFE,0x00,0x18,0xFF,0xFF,0xE0,0x00,0x00,0xFF,0xFF,0xF8,0x03,0xC0,
+0x07,0xF0,0x07,0x00,0x7F,0x80,0x3C,0x00,0x70,0x00,0x00,0x7C,0x00,0x00,0x03,0xEA,
+0xFF,0x02,0xFC,0x00,0x00,0xFE,0xFF,0x11,0x00,0x00,0x3F,0xF0,0x00,0x0F,0xFF,0xFF,
+0x80,0x3F,0x00,0x80,0x30,0x07,0x00,0x7F,0xFF,0xFC,0xFE,0x00,0x0E,0xFF,0xFF,0xE0,
+0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x0F,0xF0,0x07,0x00,0x7F,0xFE,0x00,0x06,0xF0,
+0x00,0x00,0x7C,0x00,0x00,0x07,0xEA,0xFF,0x17,0xFC,0x00,0x00,0x7F,0xFF,0xFF,0x00,
+0x00,0xFF,0xF0,0x00,0x3F,0xFF,0xFF,0x80,0x3F,0x00,0x80,0x30,0x0F,0x00,0x7F,0xFF,
+0xFC,0xFE,0x00,0x0E,0xFF,0xFF,0xE0,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x0F,0xE0,
+0x0F,0x00,0x7F,0xFE,0x00,0x06,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0xEA,0xFF,0x17,
+0xF8,0x00,0x00,0x7F,0xFF,0xFC,0x00,0x00,0xFF,0xF0,0x00,0x7F,0xFF,0xFF,0x80,0x3E,
+0x00,0xC0,0x30,0x0F,0x00,0x7F,0xFF,0xF8,0xFE,0x00,0x18,0xFF,0xFF,0xE0,0x00,0x00,
+0xF0,0x00,0x70,0x00,0x00,0x1F,0xC0,0x0F,0x80,0x7F,0x00,0x00,0x01,0xF0,0x00,0x00,
+0x78,0x00,0x00,0x7F,0xEA,0xFF,0x33,0xF9,0xFE,0x00,0x3F,0xFF,0xF8,0x00,0x00,0x7F,
+0xE0,0x00,0x1F,0xFF,0xFF,0x80,0x3E,0x00,0xC0,0x00,0x0F,0x00,0x7F,0xFF,0xF8,0x00,
+0x00,0x01,0xFF,0xFF,0xC0,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x3F,0xC0,0x1F,0x80,
+0x7F,0x00,0x00,0x03,0xE0,0x00,0x00,0x78,0x00,0x00,0x7F,0xE8,0xFF,0x31,0x00,0x3F,
+0xFF,0xF0,0x00,0x00,0x3F,0xE0,0x00,0x1F,0xFF,0xFF,0x00,0x7E,0x01,0xC0,0x00,0x0F,
+0x00,0x7F,0xFF,0xF8,0x00,0x00,0x01,0xFF,0xFF,0xC0,0x00,0x01,0xF0,0x00,0xF0,0x00,
+0x00,0x7F,0x80,0x00,0x00,0x7F,0x00,0x00,0x07,0xE0,0x00,0x00,0xF8,0x00,0x00,0x3F,
+0xE8,0xFF,0x31,0x80,0x3F,0xFF,0xF0,0x03,0x80,0x3F,0xFF,0xC0,0x0F,0xFF,0xFF,0x00,
+0x7E,0x01,0xE0,0x00,0x1F,0x00,0x7F,0xFF,0xF8,0x03,0xFC,0x01,0xFF,0xFF,0xC0,0x1F,
+0xFF,0xF0,0x00,0xE0,0x00,0x01,0xFF,0x80,0x00,0x00,0x3E,0x00,0x00,0x1F,0xE0,0x0F,
+0xFF,0xF8,0x00,0x00,0x3F,0xE8,0xFF,0x23,0x80,0x3F,0xFF,0xF0,0x0F,0xC0,0x1F,0xFF,
+0xE0,0x0F,0xFF,0xFF,0x00,0x7E,0x01,0xE0,0x00,0x1F,0x00,0x7F,0xFF,0xF8,0x03,0xFC,
+0x01,0xFF,0xFF,0xC0,0x1F,0xFF,0xF0,0x00,0xE0,0x00,0x0F,0xFF,0xFE,0x00,0x0A,0x3E,
+0x00,0x00,0xFF,0xE0,0x0F,0xFF,0xF8,0x03,0x80,0x3F,0xE8,0xFF,0x23,0x80,0x3F,0xFF,
+0xE0,0x0F,0xC0,0x1F,0xFF,0xE0,0x0F,0xFF,0xFF,0x00,0x7C,0x01,0xE0,0x00,0x1F,0x00,
+0x3F,0xFF,0xF0,0x07,0xFC,0x01,0xFF,0xFF,0x80,0x3F,0xFF,0xE0,0x00,0xE0,0x0F,0xFF,
+0xFE,0xFE,0x00,0x0A,0x3E,0x00,0xFF,0xFF,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xE8,
+0xFF,0x23,0x00,0x3F,0xFF,0xE0,0x1F,0xC0,0x1F,0xFF,0xE0,0x0F,0xFF,0xFF,0x00,0x7C,
+0x01,0xF0,0x00,0x1F,0x00,0x1F,0xFF,0xF0,0x07,0xF8,0x03,0xFF,0xFF,0x80,0x3F,0xFF,
+0xE0,0x00,0xE0,0x0F,0xFF,0xFE,0xFE,0x00,0x0A,0x3E,0x00,0xFF,0xFF,0xC0,0x1F,0xFF,
+0xF0,0x07,0xC0,0x1F,0xEA,0xFF,0x1E,0xE1,0xFC,0x00,0x7C,0x03,0xE0,0x0F,0xC0,0x1C,
+0x7F,0x80,0x0F,0xFF,0xFE,0x00,0xFC,0x03,0xF0,0x00,0x1F,0x80,0x07,0xF8,0xF0,0x07,
+0xF8,0x03,0xFF,0xFF,0x80,0x3F,0xFE,0xFF,0x03,0xE0,0x0F,0xFF,0xFC,0xFE,0x00,0x0A,
+0x3E,0x00,0xFF,0xFF,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xEA,0xFF,0x25,0xE0,0x00,
+0x00,0x7C,0x03,0xE0,0x03,0x00,0x38,0x00,0x00,0x0F,0xFF,0xFE,0x00,0xFC,0x03,0xF0,
+0x00,0x3F,0x80,0x00,0x00,0xF0,0x07,0xF8,0x03,0xFF,0xFF,0x80,0x00,0x01,0xFF,0xFF,
+0xC0,0x1F,0xFF,0xFC,0xFE,0x00,0x0A,0x3C,0x01,0xFF,0xFF,0xC0,0x00,0x00,0xF0,0x07,
+0xC0,0x1F,0xEA,0xFF,0x33,0xE0,0x00,0x00,0xFC,0x03,0xF0,0x00,0x00,0x38,0x00,0x00,
+0x1F,0xFF,0xFE,0x00,0xFC,0x03,0xF8,0x00,0x3F,0xC0,0x00,0x00,0xF0,0x07,0xF8,0x03,
+0xFF,0xFF,0x80,0x00,0x01,0xFF,0xFF,0xC0,0x1F,0xFF,0xF8,0x01,0xFF,0xC0,0x1C,0x01,
+0xFF,0xFF,0xC0,0x00,0x00,0xF0,0x07,0xE0,0x1F,0xEA,0xFF,0x33,0xE0,0x00,0x01,0xFC,
+0x03,0xF0,0x00,0x00,0x38,0x00,0x00,0x1F,0xFF,0xFE,0x00,0xF8,0x03,0xF8,0x00,0x3F,
+0xE0,0x00,0x00,0xE0,0x0F,0xF8,0x03,0xFF,0xFF,0x00,0x00,0x01,0xFF,0xFF,0xC0,0x1F,
+0xFF,0xF0,0x03,0xFF,0xC0,0x1C,0x01,0xFF,0xFF,0x80,0x00,0x00,0xE0,0x0F,0xE0,0x0F,
+0xEA,0xFF,0x33,0xE0,0x00,0x03,0xF8,0x03,0xF8,0x00,0x00,0x70,0x00,0x00,0x3F,0xFF,
+0xFC,0x00,0xF8,0x03,0xF8,0x00,0x3F,0xF0,0x00,0x00,0xE0,0x0F,0xF0,0x07,0xFF,0xFF,
+0x00,0x00,0x01,0xFF,0xFF,0xC0,0x1F,0xFF,0xF0,0x03,0xFF,0xC0,0x1C,0x01,0xFF,0xFF,
+0x80,0x00,0x00,0xE0,0x0F,0xE0,0x0F,0xEA,0xFF,0x33,0xC0,0x00,0x07,0xF8,0x07,0xFC,
+0x00,0x00,0xF0,0x00,0x00,0x7F,0xFF,0xFC,0x01,0xF8,0x07,0xF8,0x00,0x3F,0xF8,0x00,
+0x00,0xE0,0x0F,0xF0,0x07,0xFF,0xFF,0x00,0x00,0x03,0xFF,0xFF,0x80,0x3F,0xFF,0xE0,
+0x07,0xFF,0xC0,0x18,0x03,0xFF,0xFF,0x80,0x00,0x01,0xE0,0x0F,0xE0,0x0F,0xEA,0xFF,
+0x33,0xC0,0x00,0x1F,0xF8,0x07,0xFE,0x00,0x03,0xF8,0x00,0x01,0xFF,0xFF,0xFC,0x01,
+0xF8,0x07,0xFC,0x00,0x7F,0xFE,0x00,0x01,0xE0,0x0F,0xF0,0x07,0xFF,0xFF,0x00,0x00,
+0x03,0xFF,0xFF,0x80,0x3F,0xFF,0xC0,0x07,0xFF,0xC0,0x18,0x03,0xFF,0xFF,0x80,0x00,
+0x01,0xE0,0x0F,0xE0,0x07,0xEA,0xFF,0x33,0xFC,0x00,0xFF,0xF8,0x07,0xFF,0xC0,0x0F,
+0xFF,0x00,0x0F,0xFF,0xFF,0xFC,0x01,0xF8,0x07,0xFC,0x00,0x7F,0xFF,0xC0,0x07,0xE0,
+0x0F,0xF0,0x07,0xFF,0xFF,0x00,0x00,0x03,0xFF,0xFF,0x80,0x3F,0xFF,0xC0,0x0F,0xFF,
+0xC0,0x18,0x03,0xFF,0xFF,0x80,0x00,0x01,0xE0,0x0F,0xF0,0x07,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0xBA,0xFF,0x00,0xCF,0xB7,0xFF,0x00,0x83,0xB8,0xFF,0x01,0xFE,0x00,0xB8,
+0xFF,0x02,0xF8,0x00,0x3F,0xB9,0xFF,0x02,0xF0,0x00,0x1F,0xB9,0xFF,0x02,0xC0,0x38,
+0x07,0xB9,0xFF,0x02,0x00,0xFE,0x01,0xBA,0xFF,0x04,0xFC,0x03,0xFF,0x80,0x7F,0xBB,
+0xFF,0x04,0xF8,0x07,0xFF,0xC0,0x1F,0xBB,0xFF,0x04,0xE0,0x1F,0xFF,0xF0,0x0F,0xBB,
+0xFF,0x04,0x80,0x7F,0xFF,0xFC,0x03,0xBB,0xFF,0x00,0x01,0xFE,0xFF,0x00,0x00,0xBC,
+0xFF,0x01,0xFC,0x03,0xFE,0xFF,0x01,0xC0,0x3F,0xBD,0xFF,0x01,0xF0,0x0F,0xFE,0xFF,
+0x01,0xE0,0x0F,0xBD,0xFF,0x01,0xC0,0x3F,0xFE,0xFF,0x01,0xF8,0x07,0xBD,0xFF,0x01,
+0x80,0x7F,0xFE,0xFF,0x01,0xFE,0x01,0xBE,0xFF,0x01,0xFE,0x01,0xFC,0xFF,0x01,0x80,
+0x7F,0xBF,0xFF,0x01,0xF8,0x07,0xFC,0xFF,0x01,0xE0,0x1F,0xBF,0xFF,0x01,0xF0,0x1F,
+0xFC,0xFF,0x01,0xF0,0x07,0xBF,0xFF,0x01,0xC0,0x3F,0xFC,0xFF,0x01,0xFC,0x03,0xBF,
+0xFF,0x00,0x00,0xFA,0xFF,0x00,0x00,0xC0,0xFF,0x01,0xFC,0x03,0xFA,0xFF,0x01,0xC0,
+0x3F,0xC1,0xFF,0x01,0xF8,0x07,0xFA,0xFF,0x01,0xF0,0x0F,0xC1,0xFF,0x01,0xE0,0x1F,
+0xFA,0xFF,0x01,0xF8,0x03,0xC1,0xFF,0x01,0x80,0x7F,0xFA,0xFF,0x01,0xFE,0x01,0xC1,
+0xFF,0x00,0x01,0xF8,0xFF,0x01,0x80,0x7F,0xC3,0xFF,0x01,0xFC,0x03,0xF8,0xFF,0x01,
+0xE0,0x1F,0xC3,0xFF,0x01,0xF0,0x0F,0xF8,0xFF,0x01,0xF8,0x07,0xC3,0xFF,0x01,0xE0,
+0x3F,0xF8,0xFF,0x01,0xFC,0x01,0xC3,0xFF,0x05,0x80,0x7F,0xF8,0x00,0xFE,0x3F,0xFE,
+0xFF,0x03,0xE3,0xFF,0xFF,0x00,0xC4,0xFF,0x06,0xFE,0x01,0xFF,0xF8,0x00,0x3E,0x3F,
+0xFE,0xFF,0x04,0xE3,0xFF,0xFF,0xC0,0x3F,0xCD,0xFF,0x00,0xE0,0xFA,0xFF,0x06,0xF8,
+0x07,0xFF,0xF8,0x00,0x3E,0x3F,0xFE,0xFF,0x04,0xE3,0xFF,0xFF,0xF0,0x0F,0xCD,0xFF,
+0x01,0xC0,0x7F,0xFB,0xFF,0x06,0xF0,0x0F,0xFF,0xF8,0xFE,0x1E,0x3F,0xFE,0xFF,0x04,
+0xE3,0xFF,0xFF,0xFC,0x0F,0xCD,0xFF,0x01,0x00,0x1F,0xFB,0xFF,0x06,0xE0,0x3F,0xFF,
+0xF8,0xFF,0x1E,0x3F,0xFE,0xFF,0x04,0xE3,0xFF,0xFF,0xFE,0x0F,0xCE,0xFF,0x02,0xFC,
+0x00,0x07,0xFB,0xFF,0x0E,0xE0,0xFF,0xFF,0xF8,0xFF,0x1E,0x3F,0x01,0xFE,0x03,0xE3,
+0xC3,0xFF,0xFF,0x0F,0xCE,0xFF,0x02,0xF8,0x00,0x01,0xFB,0xFF,0x0E,0xE1,0xFF,0xFF,
+0xF8,0xFF,0x1E,0x3C,0x00,0xFC,0x01,0xE3,0x83,0xFF,0xFF,0x0F,0xCE,0xFF,0x02,0xE0,
+0x00,0x00,0xFB,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,0xFE,0x1E,0x3C,0x00,0x78,0x00,0xE3,
+0x07,0xFF,0xFF,0x0F,0xF4,0xFF,0x02,0xE0,0x00,0x03,0xF7,0xFF,0x01,0xFC,0x07,0xFC,
+0xFF,0x01,0xF0,0x1F,0xF1,0xFF,0x03,0x80,0x0E,0x00,0x3F,0xFC,0xFF,0x0E,0xE1,0xFF,
+0xFF,0xF8,0x00,0x3E,0x38,0x78,0x70,0x70,0xE2,0x0F,0xFF,0xFF,0x0F,0xF4,0xFF,0x03,
+0xE0,0x00,0x00,0x7F,0xF8,0xFF,0x01,0xFC,0x07,0xFD,0xFF,0x02,0xCF,0xF0,0x1F,0xF2,
+0xFF,0x04,0xFE,0x00,0x3F,0x80,0x0F,0xFC,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,0x00,0x3E,
+0x38,0xFC,0x70,0xF8,0xE0,0x1F,0xFF,0xFF,0x0F,0xF4,0xFF,0x03,0xE0,0x00,0x00,0x3F,
+0xF8,0xFF,0x01,0xFC,0x07,0xFD,0xFF,0x02,0x0F,0xF0,0x1F,0xF2,0xFF,0x04,0xFC,0x00,
+0xFF,0xE0,0x03,0xFC,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,0x00,0x1E,0x3F,0xE0,0x71,0xFF,
+0xE0,0x3F,0xFF,0xFF,0x0F,0xF4,0xFF,0x03,0xE0,0x00,0x00,0x1F,0xF8,0xFF,0x01,0xFC,
+0x07,0xFE,0xFF,0x03,0xFC,0x0F,0xF0,0x1F,0xF2,0xFF,0x04,0xF0,0x01,0xFF,0xF8,0x01,
+0xFC,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,0xFE,0x0E,0x3E,0x00,0x71,0xFF,0xE0,0x3F,0xFF,
+0xFF,0x0F,0xF4,0xFF,0x03,0xE0,0x00,0x00,0x1F,0xF8,0xFF,0x01,0xFC,0x07,0xFE,0xFF,
+0x03,0xF8,0x0F,0xF0,0x1F,0xF2,0xFF,0x05,0xC0,0x07,0xFF,0xFC,0x00,0x7F,0xFD,0xFF,
+0x0E,0xE1,0xFF,0xFF,0xF8,0xFF,0x8E,0x3C,0x00,0x71,0xFF,0xE0,0x1F,0xFF,0xFF,0x0F,
+0xF4,0xFF,0x03,0xE0,0x00,0x00,0x0F,0xF8,0xFF,0x01,0xFC,0x07,0xFE,0xFF,0x01,0xF8,
+0x0F,0xF0,0xFF,0x05,0x00,0x1F,0xFF,0xFF,0x00,0x1F,0xFD,0xFF,0x0E,0xE1,0xFF,0xFF,
+0xF8,0xFF,0x8E,0x38,0x0C,0x71,0xF8,0xE2,0x0F,0xFF,0xFF,0x0F,0xF4,0xFF,0x03,0xE0,
+0x3F,0xE0,0x0F,0xF8,0xFF,0x01,0xFC,0x07,0xFE,0xFF,0x01,0xF8,0x0F,0xF1,0xFF,0x06,
+0xFE,0x00,0x3F,0xFF,0xFF,0xC0,0x07,0xFD,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,0xFF,0x8E,
+0x38,0xF8,0x70,0xF8,0xE3,0x0F,0xFF,0xFF,0x0F,0xF4,0xFF,0x0E,0xE0,0x3F,0xF0,0x0F,
+0xFF,0x01,0xFF,0xFE,0x00,0x7F,0xFF,0x80,0x3F,0xFC,0x07,0xFE,0xFF,0x09,0xF8,0x0F,
+0xFF,0xFF,0xFE,0x00,0xFF,0xFF,0xF8,0x0F,0xF9,0xFF,0x01,0xF8,0x00,0xFE,0xFF,0x01,
+0xF0,0x03,0xFD,0xFF,0x06,0xE1,0xFF,0xFF,0xF8,0xFE,0x0E,0x38,0xFE,0x70,0x04,0xE3,
+0x87,0xFF,0xFF,0x0F,0xF4,0xFF,0x1B,0xE0,0x3F,0xF8,0x0F,0xFC,0x00,0x7F,0xF8,0x00,
+0x1F,0xFE,0x00,0x0F,0xFC,0x07,0xC0,0x7F,0x01,0xC0,0x00,0xF0,0x1F,0xF8,0x00,0x3F,
+0xE0,0x60,0x07,0xF9,0xFF,0x01,0xE0,0x03,0xFE,0xFF,0x01,0xF8,0x00,0xFD,0xFF,0x0E,
+0xE1,0xFF,0xFF,0xF8,0x00,0x1E,0x38,0x00,0x78,0x01,0xE3,0xC3,0xFF,0xFF,0x0F,0xF4,
+0xFF,0x1B,0xE0,0x3F,0xF8,0x0F,0xF0,0x00,0x1F,0xF0,0x00,0x0F,0xFC,0x00,0x07,0xFC,
+0x07,0xC0,0x7F,0x01,0xC0,0x00,0xF0,0x1F,0xF0,0x00,0x1F,0xE0,0x00,0x01,0xF9,0xFF,
+0x07,0xC0,0x0F,0xFF,0xE0,0xFF,0xFE,0x00,0x3F,0xFE,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,
+0x00,0x1E,0x3C,0x00,0x3C,0x03,0xE3,0xC1,0xFF,0xFF,0x0F,0xF4,0xFF,0x1B,0xE0,0x3F,
+0xF0,0x0F,0xE0,0x00,0x0F,0xE0,0x00,0x07,0xF8,0x00,0x03,0xFC,0x07,0xC0,0x7F,0x01,
+0xC0,0x00,0xF0,0x1F,0xE0,0x00,0x0F,0xE0,0x00,0x01,0xF9,0xFF,0x07,0x00,0x1F,0xFF,
+0xC0,0x7F,0xFF,0x80,0x0F,0xFE,0xFF,0x0E,0xE1,0xFF,0xFF,0xF8,0x00,0x7E,0x3E,0x06,
+0x3E,0x07,0xE3,0xE1,0xFF,0xFF,0x0F,0xF4,0xFF,0x1B,0xE0,0x3F,0xE0,0x0F,0xE0,0x00,
+0x0F,0xC0,0x00,0x07,0xF0,0x00,0x01,0xFC,0x07,0xC0,0x7F,0x01,0xC0,0x00,0xF0,0x1F,
+0xC0,0x00,0x07,0xE0,0x00,0x00,0xFA,0xFF,0x08,0xFC,0x00,0x7F,0xFF,0x00,0x1F,0xFF,
+0xE0,0x07,0xFE,0xFF,0x00,0xE1,0xF4,0xFF,0x00,0x8F,0xF4,0xFF,0x1B,0xE0,0x00,0x00,
+0x1F,0xC0,0x38,0x07,0xC0,0x3C,0x03,0xE0,0x0E,0x00,0xFC,0x07,0xC0,0x7F,0x01,0xC0,
+0x00,0xF0,0x1F,0x80,0x38,0x03,0xE0,0x06,0x00,0xFA,0xFF,0x08,0xF0,0x01,0xFF,0xFC,
+0x00,0x07,0xFF,0xF0,0x01,0xFE,0xFF,0x00,0xE1,0xF4,0xFF,0x00,0x8F,0xF4,0xFF,0x1B,
+0xE0,0x00,0x00,0x1F,0xC0,0x7C,0x07,0xC0,0x7C,0x03,0xE0,0x1F,0x00,0xFC,0x07,0xC0,
+0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x80,0x7C,0x03,0xE0,0x1F,0x00,0xFA,0xFF,0x0C,0xE0,
+0x03,0xFF,0xF0,0x00,0x01,0xFF,0xFC,0x00,0x7F,0xFF,0xFF,0xE1,0xF4,0xFF,0x00,0x8F,
+0xF4,0xFF,0x1B,0xE0,0x00,0x00,0x3F,0x80,0x7E,0x07,0xC0,0x7E,0x1F,0xE0,0x3F,0x80,
+0xFC,0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x80,0xFE,0x03,0xE0,0x1F,0x80,0xFA,
+0xFF,0x0C,0x80,0x0F,0xFF,0xE0,0x00,0x00,0xFF,0xFF,0x00,0x1F,0xFF,0xFF,0xE1,0xF4,
+0xFF,0x00,0x8F,0xF4,0xFF,0x1B,0xE0,0x00,0x00,0x7F,0x80,0xFE,0x03,0xC0,0x1F,0xFF,
+0xC0,0x3F,0x80,0x7C,0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x00,0xFE,0x01,0xE0,
+0x3F,0x80,0xFB,0xFF,0x0D,0xFE,0x00,0x3F,0xFF,0x80,0x00,0x00,0x3F,0xFF,0xC0,0x0F,
+0xFF,0xFF,0xE1,0xF4,0xFF,0x00,0x8F,0xF4,0xFF,0x1B,0xE0,0x00,0x01,0xFF,0x80,0x00,
+0x03,0xC0,0x01,0xFF,0xC0,0x7F,0xC0,0x7C,0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,
+0x01,0xFF,0x01,0xE0,0x3F,0x80,0xFB,0xFF,0x03,0xFC,0x00,0xFF,0xFE,0xFE,0x00,0x06,
+0x0F,0xFF,0xE0,0x03,0xFF,0xFF,0xE1,0xF4,0xFF,0x00,0x8F,0xF4,0xFF,0x1B,0xE0,0x00,
+0x03,0xFF,0x80,0x00,0x03,0xE0,0x00,0x3F,0xC0,0x7F,0xC0,0x7C,0x07,0xC0,0x7F,0x01,
+0xF8,0x0F,0xF0,0x1F,0x01,0xFF,0x01,0xE0,0x3F,0x80,0xFB,0xFF,0x03,0xF0,0x01,0xFF,
+0xF8,0xFE,0x00,0x06,0x07,0xFF,0xF8,0x00,0xFF,0xFF,0xE1,0xF4,0xFF,0x00,0x87,0xF4,
+0xFF,0x1B,0xE0,0x3C,0x01,0xFF,0x80,0x00,0x03,0xE0,0x00,0x0F,0xC0,0x7F,0xC0,0x7C,
+0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x01,0xFF,0x01,0xE0,0x3F,0x80,0xFB,0xFF,
+0x03,0xC0,0x07,0xFF,0xF0,0xFE,0x00,0x06,0x01,0xFF,0xFE,0x00,0x3F,0xFF,0xE1,0xF4,
+0xFF,0x00,0x87,0xF4,0xFF,0x1B,0xE0,0x3E,0x00,0xFF,0x80,0x00,0x03,0xF0,0x00,0x07,
+0xC0,0x7F,0xC0,0x7C,0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x01,0xFF,0x01,0xE0,
+0x3F,0x80,0xFB,0xFF,0x03,0x00,0x1F,0xFF,0xC0,0xFD,0x00,0x05,0x7F,0xFF,0x80,0x0F,
+0xFF,0xE1,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0x00,0x7F,0x80,0x00,0x03,
+0xFC,0x00,0x07,0xC0,0x7F,0xC0,0x7C,0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x01,
+0xFF,0x01,0xE0,0x3F,0x80,0xFC,0xFF,0x03,0xFE,0x00,0x3F,0xFF,0xFC,0x00,0x05,0x3F,
+0xFF,0xC0,0x07,0xFF,0xE1,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x04,0xE0,0x3F,0x00,0x7F,
+0x80,0xFE,0xFF,0x13,0x80,0x03,0xC0,0x7F,0xC0,0x7C,0x07,0xC0,0x7F,0x01,0xF8,0x0F,
+0xF0,0x1F,0x01,0xFF,0x01,0xE0,0x3F,0x80,0xFC,0xFF,0x03,0xF8,0x00,0xFF,0xFC,0xFC,
+0x00,0x0E,0x0F,0xFF,0xF0,0x01,0xFF,0xE1,0xFF,0xFF,0xE3,0xFC,0x3F,0xC7,0x1F,0xFE,
+0x3F,0xFD,0xFF,0x00,0x87,0xF4,0xFF,0x04,0xE0,0x3F,0x80,0x3F,0x80,0xFE,0xFF,0x13,
+0xF0,0x03,0xC0,0x3F,0x80,0x7C,0x07,0xC0,0x7F,0x01,0xF8,0x0F,0xF0,0x1F,0x00,0xFE,
+0x01,0xE0,0x3F,0x80,0xFC,0xFF,0x03,0xE0,0x03,0xFF,0xF8,0xFC,0x00,0x0F,0x03,0xFF,
+0xFC,0x00,0x7F,0xE1,0xFF,0xFF,0xE3,0xFC,0x3F,0x87,0x1F,0xFE,0x3C,0x7F,0xFE,0xFF,
+0x00,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0xC0,0x3F,0x80,0x7E,0x1F,0xF0,0xFE,0x03,0xE0,
+0x3F,0x80,0xFC,0x07,0xC0,0x7E,0x01,0xF8,0x0F,0xF0,0x1F,0x80,0xFE,0x03,0xE0,0x3F,
+0x80,0xFC,0xFF,0x03,0xC0,0x0F,0xFF,0xE0,0xFB,0x00,0x0E,0xFF,0xFF,0x00,0x1F,0xE1,
+0xFF,0xFF,0xE1,0xF8,0x1F,0x87,0x1F,0xFE,0x3C,0x7F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,
+0x1B,0xE0,0x3F,0xC0,0x1F,0xC0,0x7C,0x03,0x80,0x7E,0x03,0xE0,0x1F,0x00,0xFC,0x07,
+0xC0,0x3E,0x01,0xF8,0x0F,0xF0,0x1F,0x80,0x7C,0x03,0xE0,0x3F,0x80,0xFC,0xFF,0x03,
+0x00,0x1F,0xFF,0x80,0xFB,0x00,0x0E,0x7F,0xFF,0x80,0x0F,0xE1,0xFF,0xFF,0xF1,0xF8,
+0x1F,0x8F,0x1F,0xFF,0xFC,0x7F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0xE0,
+0x1F,0xC0,0x18,0x03,0x80,0x3C,0x03,0xE0,0x0E,0x00,0xFC,0x07,0xC0,0x1C,0x01,0xF8,
+0x0C,0xF0,0x1F,0x80,0x38,0x03,0xE0,0x3F,0x80,0xFD,0xFF,0x03,0xFC,0x00,0x7F,0xFE,
+0xFA,0x00,0x0E,0x1F,0xFF,0xE0,0x03,0xE1,0xFF,0xFF,0xF1,0xF8,0x1F,0x8F,0x1F,0xFF,
+0xFC,0x7F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0xF0,0x0F,0xE0,0x00,0x07,
+0xC0,0x00,0x07,0xF0,0x00,0x01,0xFC,0x07,0xC0,0x00,0x01,0xF8,0x00,0xF0,0x1F,0xC0,
+0x00,0x07,0xE0,0x3F,0x80,0xFD,0xFF,0x03,0xF0,0x01,0xFF,0xFC,0xFA,0x00,0x12,0x07,
+0xFF,0xF8,0x00,0xE1,0xFF,0xFF,0xF0,0xF0,0x0F,0x0F,0x10,0x7E,0x30,0x0F,0x01,0xFF,
+0xFF,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0xF0,0x07,0xE0,0x00,0x07,0xC0,0x00,0x07,0xF8,
+0x00,0x03,0xFC,0x07,0xE0,0x00,0x01,0xF8,0x00,0xF0,0x1F,0xE0,0x00,0x0F,0xE0,0x3F,
+0x80,0xFD,0xFF,0x03,0xE0,0x07,0xFF,0xF0,0xFA,0x00,0x12,0x03,0xFF,0xFE,0x00,0x21,
+0xFF,0xFF,0xF8,0xF0,0x0F,0x1F,0x00,0x3E,0x30,0x0E,0x00,0xFF,0xFF,0x87,0xF4,0xFF,
+0x1B,0xE0,0x3F,0xF8,0x07,0xF0,0x00,0x0F,0xE0,0x00,0x0F,0xFC,0x00,0x07,0xFC,0x07,
+0xF0,0x00,0x01,0xFC,0x00,0xF0,0x1F,0xF0,0x00,0x1F,0xE0,0x3F,0x80,0xFD,0xFF,0x03,
+0x80,0x0F,0xFF,0xC0,0xF9,0x00,0x11,0xFF,0xFF,0x00,0x01,0xFF,0xFF,0xF8,0xF1,0x8F,
+0x1F,0x00,0x1E,0x30,0x0C,0x00,0x7F,0xFF,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0xF8,0x03,
+0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xFE,0x00,0x0F,0xFC,0x07,0xF8,0x00,0x81,0xFC,0x00,
+0xF0,0x1F,0xF8,0x00,0x3F,0xE0,0x3F,0x80,0xFE,0xFF,0x03,0xFE,0x00,0x3F,0xFF,0xF8,
+0x00,0x11,0x3F,0xFF,0xC0,0x01,0xFF,0xFF,0xF8,0xF1,0x8E,0x1F,0x06,0x1E,0x3C,0x7C,
+0x38,0x3F,0xFF,0x87,0xF4,0xFF,0x1B,0xE0,0x3F,0xFC,0x03,0xFF,0x00,0xFF,0xFE,0x00,
+0xFF,0xFF,0xC0,0x7F,0xFC,0x07,0xFC,0x03,0x81,0xFF,0x01,0xF0,0x1F,0xFF,0x01,0xFF,
+0xE0,0x3F,0x80,0xFE,0xFF,0x03,0xF8,0x00,0xFF,0xFE,0xF8,0x00,0x11,0x0F,0xFF,0xF0,
+0x01,0xFF,0xFF,0xF8,0x61,0x86,0x1F,0x0F,0x1E,0x3C,0x78,0x7C,0x3F,0xFF,0x87,0xD5,
+0xFF,0x03,0xF0,0x01,0xFF,0xF8,0xF8,0x00,0x11,0x07,0xFF,0xFC,0x01,0xFF,0xFF,0xFC,
+0x63,0xC6,0x3F,0x1F,0x1E,0x3C,0x78,0x00,0x3F,0xFF,0x87,0xD5,0xFF,0x03,0xC0,0x07,
+0xFF,0xE0,0xF8,0x00,0x11,0x01,0xFF,0xFE,0x01,0xFF,0xFF,0xFC,0x63,0xC6,0x3F,0x1F,
+0x1E,0x3C,0x78,0x00,0x3F,0xFF,0x87,0xD5,0xFF,0x03,0x00,0x1F,0xFF,0x80,0xF7,0x00,
+0x10,0x7F,0xFF,0x81,0xFF,0xFF,0xFC,0x03,0xC0,0x3F,0x1F,0x1E,0x3C,0x78,0x00,0x3F,
+0xFF,0x87,0xD6,0xFF,0x03,0xFE,0x00,0x7F,0xFF,0xF6,0x00,0x0C,0x3F,0xFF,0xE1,0xFF,
+0xFF,0xFE,0x07,0xE0,0x7F,0x1F,0x1E,0x3C,0x78,0xFE,0xFF,0x00,0x87,0xD6,0xFF,0x03,
+0xF8,0x00,0xFF,0xFC,0xF6,0x00,0x10,0x0F,0xFF,0xE1,0xFF,0xFF,0xFE,0x07,0xE0,0x7F,
+0x1F,0x1E,0x3C,0x78,0x7E,0x3F,0xFF,0x87,0xD6,0xFF,0x03,0xE0,0x03,0xFF,0xF0,0xF6,
+0x00,0x10,0x03,0xFF,0xE1,0xFF,0xFF,0xFE,0x07,0xE0,0x7F,0x1F,0x1E,0x3C,0x78,0x3C,
+0x3F,0xFF,0x87,0xD6,0xFF,0x03,0x80,0x0F,0xFF,0xC0,0xF5,0x00,0x0F,0xFF,0xE1,0xFF,
+0xFF,0xFE,0x07,0xE0,0x7F,0x1F,0x1E,0x3C,0x0C,0x00,0x7F,0xFF,0x87,0xD6,0xFF,0x02,
+0x00,0x1F,0xFF,0xF4,0x00,0x01,0x7F,0xF1,0xFE,0xFF,0x0A,0x0F,0xF0,0xFF,0x1F,0x1E,
+0x3C,0x0E,0x00,0xFF,0xFF,0x87,0xD7,0xFF,0x03,0xFC,0x00,0x7F,0xFE,0xF4,0x00,0x01,
+0x1F,0xF1,0xFE,0xFF,0x0A,0x0F,0xF0,0xFF,0x1F,0x1E,0x3E,0x0F,0x01,0xFF,0xFF,0x87,
+0xD7,0xFF,0x03,0xF0,0x01,0xFF,0xF8,0xF4,0x00,0x01,0x07,0xF1,0xF4,0xFF,0x00,0x87,
+0xD7,0xFF,0x05,0xE0,0x07,0xFF,0xE0,0x00,0x03,0xF6,0x00,0x01,0x03,0xF1,0xF4,0xFF,
+0x00,0x87,0xF3,0xFF,0x07,0x80,0xFF,0xFF,0x80,0x7F,0xFF,0x80,0x7F,0xFD,0xFF,0x07,
+0xFC,0x07,0xFF,0xFC,0x07,0xFF,0xC0,0x3F,0xF9,0xFF,0x0E,0x80,0x0F,0xFF,0x80,0x00,
+0x0F,0xC0,0x3F,0xF0,0x3F,0x00,0x00,0x7F,0x00,0xFE,0xFE,0x00,0x00,0xF1,0xF4,0xFF,
+0x00,0x87,0xF4,0xFF,0x08,0xFE,0x00,0x3F,0xFE,0x00,0x1F,0xFE,0x00,0x1F,0xFD,0xFF,
+0x07,0xFC,0x07,0xFF,0xFC,0x07,0xFF,0x00,0x0F,0xFA,0xFF,0x0F,0xFE,0x00,0x3F,0xFF,
+0x00,0x00,0x3F,0xF0,0x3F,0xF0,0x7F,0xC0,0x00,0xFF,0x81,0xFF,0xFE,0x00,0x00,0x31,
+0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x08,0xFC,0x00,0x1F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,
+0xFD,0xFF,0x07,0xF8,0x07,0xFF,0xF8,0x07,0xFE,0x00,0x07,0xFA,0xFF,0x13,0xF8,0x00,
+0xFF,0xFC,0x00,0x00,0x3F,0xF8,0x7F,0xF0,0xFF,0xE0,0x01,0xFF,0xC3,0xFF,0x83,0xC0,
+0x00,0x10,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x08,0xF8,0x00,0x0F,0xFC,0x00,0x0F,0xFC,
+0x00,0x0F,0xFD,0xFF,0x07,0xF8,0x07,0xFF,0xF8,0x07,0xFC,0x00,0x03,0xFA,0xFF,0x10,
+0xF0,0x01,0xFF,0xF0,0x00,0x00,0x7B,0x78,0x70,0x01,0xF1,0xE0,0x01,0xE3,0xC3,0xC7,
+0xFC,0xFE,0x00,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x08,0xF0,0x00,0x0F,0xF8,0x00,0x07,
+0xF8,0x00,0x07,0xFD,0xFF,0x07,0xF0,0x07,0xFF,0xF0,0x07,0xFC,0x00,0x03,0xFA,0xFF,
+0x10,0xC0,0x07,0xFF,0xC0,0x00,0x00,0x73,0x38,0x70,0x01,0xE0,0xE0,0x03,0xC1,0xE7,
+0xFF,0xC0,0xFE,0x00,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x08,0xF0,0x00,0x07,0xF0,0x00,
+0x03,0xF0,0x00,0x03,0xFD,0xFF,0x07,0xE0,0x07,0xFF,0xE0,0x07,0xF8,0x00,0x01,0xFA,
+0xFF,0x10,0x00,0x1F,0xFF,0x80,0x00,0x00,0x73,0x00,0x70,0x01,0xC0,0xE0,0x03,0x80,
+0xFF,0x01,0xC0,0xFE,0x00,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x08,0xE0,0x18,0x07,0xF0,
+0x0C,0x03,0xF0,0x0C,0x03,0xFD,0xFF,0x07,0xE0,0x07,0xFF,0xE0,0x07,0xF8,0x06,0x01,
+0xFB,0xFF,0x03,0xFE,0x00,0x7F,0xFE,0xFE,0x00,0x0A,0x7B,0x00,0x7F,0xC0,0x01,0xE0,
+0x03,0xFF,0xE7,0x01,0xC0,0xFE,0x00,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x08,0xE0,0x3C,
+0x07,0xF0,0x1E,0x03,0xF0,0x1E,0x03,0xFD,0xFF,0x07,0xC0,0x07,0xFF,0xC0,0x07,0xF8,
+0x0F,0x01,0xFB,0xFF,0x03,0xF8,0x00,0xFF,0xF8,0xFE,0x00,0x0A,0x7F,0x00,0xFF,0xE0,
+0x1F,0xC0,0x3F,0x80,0xE7,0x01,0xC0,0xFE,0x00,0xF4,0xFF,0x00,0x87,0xF4,0xFF,0x14,
+0xE0,0x7C,0x0F,0xF0,0x1E,0x03,0xF0,0x1E,0x03,0xE0,0x3F,0x01,0xFF,0xC0,0x07,0xFF,
+0xC0,0x07,0xF8,0x0F,0x01,0xFB,0xFF,0x03,0xE0,0x03,0xFF,0xE0,0xFE,0x00,0x0A,0x3F,
+0xC0,0xFF,0xF0,0x1F,0xFF,0xC3,0x80,0xE7,0x01,0xC0,0xFE,0x00,0xFE,0xFF,0x06,0xF8,
+0x00,0x7F,0xFF,0xFF,0xFE,0x3F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x14,0xC0,0x7F,0xFF,
+0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xE0,0x1E,0x01,0xFF,0x80,0x07,0xFF,0x80,0x07,0xF8,
+0x0F,0x01,0xFB,0xFF,0x03,0xC0,0x0F,0xFF,0xC0,0xFE,0x00,0x0A,0x1F,0xF0,0xF0,0x78,
+0x1F,0xE0,0x03,0x80,0xE7,0x01,0xC0,0xFE,0x00,0xFE,0xFF,0x06,0xF8,0x00,0x1F,0xFF,
+0xFF,0xFE,0x3F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x14,0xC0,0x7F,0xFF,0xE0,0x3F,0x01,
+0xE0,0x3F,0x01,0xE0,0x1E,0x01,0xFF,0x00,0x07,0xFF,0x00,0x07,0xF8,0x06,0x01,0xFB,
+0xFF,0x02,0xC0,0x3F,0xFF,0xFD,0x00,0x0A,0x03,0xF8,0x00,0x7F,0xE0,0xF0,0x03,0x80,
+0xE7,0x01,0xC0,0xFE,0x00,0xFE,0xFF,0x06,0xF8,0x00,0x1F,0xFF,0xFF,0xFE,0x3F,0xFE,
+0xFF,0x00,0x87,0xF4,0xFF,0x14,0xC0,0x40,0xFF,0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xF0,
+0x0C,0x03,0xFF,0x00,0x07,0xFF,0x00,0x07,0xFC,0x00,0x03,0xFB,0xFF,0x02,0xC0,0x7F,
+0xFC,0xFD,0x00,0x0A,0x03,0x78,0x07,0xF8,0x00,0x70,0x03,0x80,0xE7,0x01,0xC0,0xFE,
+0x00,0xFE,0xFF,0x06,0xF8,0xFE,0x0F,0xFF,0xFF,0xFE,0x3F,0xFE,0xFF,0x00,0x87,0xF4,
+0xFF,0x14,0xC0,0x00,0x3F,0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xF8,0x08,0x07,0xFE,0x04,
+0x07,0xFE,0x04,0x07,0xFE,0x00,0x07,0xFB,0xFF,0x02,0xC1,0xFF,0xF0,0xFD,0x00,0x0A,
+0x03,0x3F,0xF8,0x38,0x00,0x70,0x03,0x80,0xE7,0x01,0xC0,0xFE,0x00,0xFE,0xFF,0x06,
+0xF8,0xFF,0x8F,0xFF,0xFF,0xFE,0x3F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x14,0xC0,0x00,
+0x1F,0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xF8,0x00,0x07,0xFC,0x04,0x07,0xFC,0x04,0x07,
+0xFF,0x00,0x0F,0xFB,0xFF,0x02,0xC1,0xFF,0xE0,0xFD,0x00,0x0A,0x73,0xF8,0xE0,0x39,
+0xC0,0x70,0x03,0x80,0xE7,0x01,0xC0,0xFE,0x00,0xFE,0xFF,0x06,0xF8,0xFF,0x8F,0xC0,
+0x7F,0x82,0x3F,0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x14,0xC0,0x00,0x0F,0xE0,0x3F,0x01,
+0xE0,0x3F,0x01,0xFC,0x00,0x0F,0xFC,0x0C,0x07,0xFC,0x0C,0x07,0xFE,0x00,0x07,0xFB,
+0xFF,0x02,0xC1,0xFF,0x80,0xFE,0x00,0x0B,0x01,0xFF,0x38,0xF0,0x79,0xE0,0xF0,0x03,
+0xC1,0xE7,0x83,0xC0,0xFE,0x00,0xFE,0xFF,0x06,0xF8,0xFF,0x0F,0x80,0x3F,0x00,0x3F,
+0xFE,0xFF,0x00,0x87,0xF4,0xFF,0x14,0xC0,0x00,0x07,0xE0,0x3F,0x01,0xE0,0x3F,0x01,
+0xFE,0x00,0x1F,0xF8,0x1C,0x07,0xF8,0x1C,0x07,0xFC,0x00,0x03,0xFB,0xFF,0x01,0xC1,
+0xFE,0xFD,0x00,0x0B,0x1E,0x7B,0xF8,0xF0,0xF1,0xE1,0xF0,0x01,0xE3,0xC3,0xC7,0x80,
+0xFE,0x00,0xFE,0xFF,0x06,0xF8,0xFE,0x0F,0x00,0x1E,0x00,0x3F,0xFE,0xFF,0x00,0x07,
+0xF4,0xFF,0x14,0xC0,0x00,0x07,0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xFE,0x00,0x1F,0xF8,
+0x1C,0x07,0xF8,0x1C,0x07,0xF8,0x00,0x01,0xFB,0xFF,0x01,0xC1,0xFE,0xFC,0x00,0x0A,
+0x3F,0xF0,0x7F,0xF0,0xFF,0xE1,0xC1,0xFF,0xC3,0xFF,0x80,0xFE,0x00,0x0D,0x7F,0xFF,
+0xFF,0xF8,0x00,0x1F,0x0E,0x0C,0x18,0x3F,0xFF,0xFF,0xFC,0x07,0xF4,0xFF,0x14,0xC0,
+0x18,0x03,0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xFF,0x00,0x3F,0xF0,0x3C,0x07,0xF0,0x3C,
+0x07,0xF8,0x06,0x01,0xFB,0xFF,0x01,0xC1,0xFE,0xFC,0x00,0x09,0x3F,0xF0,0x3F,0xE0,
+0x7F,0xC1,0xC0,0xFF,0x81,0xFF,0xFD,0x00,0x0D,0x3F,0xFF,0xFF,0xF8,0x00,0x1E,0x1F,
+0x0C,0x3C,0x3F,0xFF,0xFF,0xF0,0x0F,0xF4,0xFF,0x14,0xC0,0x3C,0x03,0xE0,0x3F,0x01,
+0xE0,0x3F,0x01,0xFF,0x00,0x7F,0xE0,0x7C,0x07,0xE0,0x7C,0x07,0xF0,0x0F,0x00,0xFB,
+0xFF,0x01,0xC1,0xFE,0xFC,0x00,0x09,0x0F,0xC0,0x1F,0x80,0x3F,0x01,0xC0,0x7F,0x00,
+0xFE,0xFD,0x00,0x0D,0x0F,0xFF,0xFF,0xF8,0x00,0x7E,0x00,0x0C,0x7E,0x3F,0xFF,0xFF,
+0xE0,0x1F,0xF4,0xFF,0x14,0xC0,0x7E,0x03,0xE0,0x3F,0x01,0xE0,0x3F,0x01,0xFF,0x80,
+0x7F,0xE0,0x00,0x00,0x60,0x00,0x00,0x70,0x1F,0x80,0xFB,0xFF,0x01,0xC1,0xFE,0xFC,
+0x00,0x00,0x03,0xF4,0x00,0x0D,0x03,0xFF,0xFF,0xF8,0xF0,0xFE,0x00,0x0C,0x7E,0x3F,
+0xFF,0xFF,0x80,0x7F,0xF4,0xFF,0x14,0xC0,0x7E,0x03,0xE0,0x3F,0x01,0xE0,0x3F,0x01,
+0xFF,0x00,0x3F,0xE0,0x00,0x00,0x60,0x00,0x00,0x70,0x1F,0x80,0xFB,0xFF,0x01,0xC1,
+0xFE,0xFC,0x00,0x00,0x03,0xF3,0x00,0x0B,0xFF,0xFF,0xF8,0xF8,0x7E,0x00,0x0C,0x7E,
+0x3F,0xFF,0xFE,0x01,0xF3,0xFF,0x14,0xC0,0x7E,0x03,0xE0,0x3F,0x01,0xE0,0x3F,0x01,
+0xFE,0x00,0x1F,0xE0,0x00,0x00,0x60,0x00,0x00,0x70,0x1F,0x80,0xFB,0xFF,0x01,0xC1,
+0xFE,0xED,0x00,0x0B,0x3F,0xFF,0xF8,0xF8,0x3E,0x3F,0xFC,0x7E,0x3F,0xFF,0xFC,0x07,
+0xF3,0xFF,0x14,0xE0,0x7E,0x03,0xF0,0x1E,0x03,0xF0,0x1E,0x03,0xFE,0x00,0x1F,0xE0,
+0x00,0x00,0x60,0x00,0x00,0x70,0x1F,0x80,0xFB,0xFF,0x01,0xC1,0xFE,0xED,0x00,0x0B,
+0x1F,0xFF,0xF8,0xFC,0x1E,0x1F,0x8C,0x3C,0x3F,0xFF,0xF0,0x0F,0xF3,0xFF,0x14,0xE0,
+0x3C,0x03,0xF0,0x1E,0x03,0xF0,0x1E,0x03,0xFC,0x00,0x0F,0xE0,0x00,0x00,0x60,0x00,
+0x00,0x70,0x0F,0x00,0xFB,0xFF,0x01,0xC1,0xFE,0xED,0x00,0x0B,0x07,0xFF,0xF8,0xFE,
+0x1E,0x0F,0x0E,0x18,0x3F,0xFF,0xC0,0x3F,0xF3,0xFF,0x14,0xE0,0x18,0x03,0xF0,0x0C,
+0x03,0xF0,0x0C,0x03,0xF8,0x00,0x07,0xE0,0x00,0x00,0x60,0x00,0x00,0x70,0x06,0x00,
+0xFB,0xFF,0x01,0xC1,0xFE,0xED,0x00,0x0A,0x01,0xFF,0xF8,0xFE,0x0F,0x00,0x1E,0x00,
+0x3F,0xFF,0x80,0xF2,0xFF,0x14,0xF0,0x00,0x07,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF8,
+0x00,0x07,0xFF,0xFC,0x07,0xFF,0xFC,0x07,0xF8,0x00,0x01,0xFB,0xFF,0x01,0xC1,0xFE,
+0xEC,0x00,0x09,0x7F,0xF8,0xFF,0x07,0x80,0x3F,0x00,0x3F,0xFE,0x01,0xF2,0xFF,0x14,
+0xF0,0x00,0x07,0xF8,0x00,0x07,0xF8,0x00,0x07,0xF0,0x0C,0x03,0xFF,0xFC,0x07,0xFF,
+0xFC,0x07,0xF8,0x00,0x01,0xFB,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x09,0x1F,0xF8,0xFF,
+0x87,0xC0,0x7F,0x82,0x3F,0xF8,0x07,0xF2,0xFF,0x14,0xF8,0x00,0x0F,0xF8,0x00,0x0F,
+0xF8,0x00,0x0F,0xE0,0x1E,0x01,0xFF,0xFC,0x07,0xFF,0xFC,0x07,0xFC,0x00,0x03,0xFB,
+0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x00,0x0F,0xFA,0xFF,0x01,0xE0,0x1F,0xF2,0xFF,0x14,
+0xFC,0x00,0x1F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,0xE0,0x1E,0x01,0xFF,0xFC,0x07,0xFF,
+0xFC,0x07,0xFE,0x00,0x07,0xFB,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x00,0x03,0xFA,0xFF,
+0x01,0xC0,0x3F,0xF2,0xFF,0x14,0xFE,0x00,0x3F,0xFE,0x00,0x1F,0xFE,0x00,0x1F,0xC0,
+0x3F,0x00,0xFF,0xFC,0x07,0xFF,0xFC,0x07,0xFF,0x00,0x0F,0xFB,0xFF,0x01,0xC1,0xFE,
+0xEB,0x00,0xFA,0xFF,0x00,0x00,0xF0,0xFF,0x13,0x80,0xFF,0xFF,0x80,0x7F,0xFF,0x80,
+0x7F,0xC0,0x7F,0x80,0xFF,0xFC,0x07,0xFF,0xFC,0x07,0xFF,0xC0,0x3F,0xFB,0xFF,0x01,
+0xC1,0xFE,0xEB,0x00,0x00,0x3F,0xFC,0xFF,0x01,0xFC,0x03,0xD6,0xFF,0x01,0xC1,0xFE,
+0xEB,0x00,0x00,0x0F,0xFC,0xFF,0x01,0xF8,0x0F,0xD6,0xFF,0x01,0xC1,0xFE,0xEC,0x00,
+0x01,0x18,0x07,0xFC,0xFF,0x01,0xE0,0x1F,0xD6,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x01,
+0x1E,0x01,0xFC,0xFF,0x01,0x80,0x7F,0xD6,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,
+0x80,0x7F,0xFE,0xFF,0x01,0xFE,0x01,0xD5,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,
+0xE0,0x1F,0xFE,0xFF,0x01,0xFC,0x03,0xD5,0xFF,0x19,0xC1,0xFE,0x00,0x00,0x03,0xFF,
+0x00,0x01,0xFF,0xFF,0xF8,0x7F,0xFF,0xFE,0x0F,0xFF,0xFF,0xE0,0x7F,0xFF,0xF0,0x00,
+0x00,0x1F,0xF0,0x07,0xFE,0xFF,0x01,0xF0,0x0F,0xD5,0xFF,0x19,0xC1,0xFE,0x00,0x00,
+0x0F,0xFF,0xC0,0x01,0xFF,0xFF,0xF8,0x7F,0xFF,0xFE,0x0F,0xFF,0xFF,0xE0,0x7F,0xFF,
+0xFE,0x00,0x00,0x1F,0xF8,0x03,0xFE,0xFF,0x01,0xC0,0x3F,0xD5,0xFF,0x19,0xC1,0xFE,
+0x00,0x00,0x3F,0xFF,0xF0,0x01,0xFF,0xFF,0xF8,0x7F,0xFF,0xFE,0x0F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0x00,0x00,0x1F,0xF8,0x00,0xFE,0xFF,0x00,0x80,0xD4,0xFF,0x1D,0xC1,
+0xFE,0x00,0x00,0x7F,0xFF,0xF8,0x01,0xFF,0xFF,0xF8,0x7F,0xFF,0xFE,0x0F,0xFF,0xFF,
+0xE0,0x7F,0xFF,0xFF,0x80,0x00,0x1F,0xF8,0x00,0x3F,0xFF,0xFE,0x01,0xD4,0xFF,0x1D,
+0xC1,0xFE,0x00,0x00,0xFF,0xFF,0xFC,0x01,0xFF,0xFF,0xF8,0x7F,0xFF,0xFE,0x0F,0xFF,
+0xFF,0xE0,0x7F,0xFF,0xFF,0x80,0x00,0x1F,0xF8,0x30,0x0F,0xFF,0xF8,0x07,0xEE,0xFF,
+0x07,0x00,0x3F,0xFF,0x00,0x00,0x3F,0xF8,0x0F,0xEF,0xFF,0x1D,0xC1,0xFE,0x00,0x01,
+0xFF,0x03,0xFE,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,
+0x3F,0xC0,0x00,0x1F,0xF8,0x38,0x03,0xFF,0xE0,0x1F,0xEF,0xFF,0x08,0xFC,0x00,0x07,
+0xFF,0x00,0x00,0x0F,0xF8,0x0F,0xEF,0xFF,0x1D,0xC1,0xFE,0x00,0x03,0xFC,0x00,0xFF,
+0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0x0F,0xC0,0x00,
+0x1F,0xF8,0x3E,0x01,0xFF,0xC0,0x3F,0xEF,0xFF,0x08,0xF0,0x00,0x03,0xFF,0x00,0x00,
+0x07,0xF8,0x0F,0xEF,0xFF,0x1C,0xC1,0xFE,0x00,0x03,0xF0,0x00,0x3F,0x01,0xF0,0x00,
+0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0x07,0xC0,0x00,0x1F,0xF8,0x3F,
+0x80,0x7F,0x00,0xEE,0xFF,0x08,0xF0,0x00,0x01,0xFF,0x00,0x00,0x03,0xF8,0x0F,0xEF,
+0xFF,0x1C,0xC1,0xFE,0x00,0x07,0xE0,0x00,0x1F,0x81,0xF0,0x00,0x00,0x7C,0x00,0x00,
+0x0F,0x80,0x00,0x00,0x7C,0x00,0x07,0xC0,0x00,0x1F,0xF8,0x3F,0xE0,0x1C,0x03,0xEE,
+0xFF,0x08,0xE0,0x00,0x00,0xFF,0x00,0x00,0x01,0xF8,0x0F,0xEF,0xFF,0x1C,0xC1,0xFE,
+0x00,0x07,0xE0,0x00,0x1F,0x81,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,
+0x7C,0x00,0x07,0xC0,0x00,0x1F,0xF8,0x3F,0xF8,0x00,0x0F,0xEE,0xFF,0x08,0xC0,0x00,
+0x00,0xFF,0x00,0x00,0x01,0xF8,0x0F,0xEF,0xFF,0x1C,0xC1,0xFE,0x00,0x07,0xC0,0x00,
+0x0F,0x81,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0x0F,0xC0,
+0x00,0x1F,0xF8,0x3F,0xFC,0x00,0x1F,0xEE,0xFF,0x08,0xC0,0x1F,0x00,0x7F,0x01,0xFC,
+0x00,0xF8,0x0F,0xEF,0xFF,0x1C,0xC1,0xFE,0x00,0x0F,0xC0,0x00,0x0F,0xC1,0xF0,0x00,
+0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0x0F,0xC0,0x00,0x1F,0xF8,0x3F,
+0xFF,0x00,0x7F,0xEE,0xFF,0x08,0xC0,0x7F,0x80,0x7F,0x01,0xFF,0x00,0xF8,0x0F,0xEF,
+0xFF,0x1B,0xC1,0xFE,0x00,0x0F,0x80,0x00,0x07,0xC1,0xFF,0xFF,0xE0,0x7F,0xFF,0xF8,
+0x0F,0xFF,0xFF,0xC0,0x7C,0x00,0x3F,0xC0,0x00,0x1F,0xF8,0x3F,0xFF,0xC1,0xED,0xFF,
+0x08,0xC0,0x7F,0xC0,0x7F,0x01,0xFF,0x80,0xF8,0x0F,0xEF,0xFF,0x1B,0xC1,0xFE,0x00,
+0x0F,0x80,0x00,0x07,0xC1,0xFF,0xFF,0xE0,0x7F,0xFF,0xF8,0x0F,0xFF,0xFF,0xC0,0x7F,
+0xFF,0xFF,0x80,0x00,0x1F,0xF8,0x3F,0xFF,0xF3,0xED,0xFF,0x08,0xC0,0x3F,0xC0,0x7F,
+0x01,0xFF,0x80,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x0F,0x80,0x00,0x07,0xC1,
+0xFF,0xFF,0xE0,0x7F,0xFF,0xF8,0x0F,0xFF,0xFF,0xC0,0x7F,0xFF,0xFF,0x00,0x00,0x1F,
+0xF8,0x3F,0xEB,0xFF,0x08,0xC0,0x0F,0xFF,0xFF,0x01,0xFF,0x80,0xF8,0x0F,0xEF,0xFF,
+0x19,0xC1,0xFE,0x00,0x0F,0x80,0x00,0x07,0xC1,0xFF,0xFF,0xE0,0x7F,0xFF,0xF8,0x0F,
+0xFF,0xFF,0xC0,0x7F,0xFF,0xFF,0x00,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xC0,0x00,
+0xFF,0xFF,0x01,0xFF,0x80,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x0F,0x80,0x00,
+0x07,0xC1,0xFF,0xFF,0xE0,0x7F,0xFF,0xF8,0x0F,0xFF,0xFF,0xC0,0x7F,0xFF,0xFC,0x00,
+0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xE0,0x00,0x0F,0xFF,0x01,0xFF,0x00,0xF8,0x0F,
+0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x0F,0x80,0x00,0x07,0xC1,0xF0,0x00,0x00,0x7C,0x00,
+0x00,0x0F,0x80,0x00,0x00,0x7F,0xFF,0xF0,0x00,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,
+0xF0,0x00,0x03,0xFF,0x01,0xFC,0x00,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x0F,
+0x80,0x00,0x07,0xC1,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x07,
+0xF0,0x00,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xF8,0x00,0x01,0xFF,0x00,0x00,0x01,
+0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x0F,0xC0,0x00,0x0F,0xC1,0xF0,0x00,0x00,
+0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x03,0xF8,0x00,0x00,0x1F,0xF8,0x3F,0xEB,
+0xFF,0x08,0xFC,0x00,0x00,0xFF,0x00,0x00,0x01,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,
+0x00,0x07,0xC0,0x00,0x0F,0x81,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,
+0x7C,0x01,0xFC,0x00,0x00,0x1F,0xF8,0x3F,0xEA,0xFF,0x07,0x00,0x00,0x7F,0x00,0x00,
+0x03,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x07,0xE0,0x00,0x1F,0x81,0xF0,0x00,
+0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0xFC,0x00,0x00,0x1F,0xF8,0x3F,
+0xEA,0xFF,0x07,0xF0,0x00,0x7F,0x00,0x00,0x07,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,
+0x00,0x07,0xE0,0x00,0x1F,0x81,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,
+0x7C,0x00,0x7E,0x00,0x00,0x1F,0xF8,0x3F,0xE9,0xFF,0x06,0x00,0x3F,0x00,0x00,0x0F,
+0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x03,0xF0,0x00,0x3F,0x01,0xF0,0x00,0x00,
+0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0x7F,0x00,0x00,0x1F,0xF8,0x3F,0xEB,
+0xFF,0x08,0xF0,0xFF,0xC0,0x3F,0x00,0x00,0x3F,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,
+0x00,0x03,0xFC,0x00,0xFF,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,
+0x7C,0x00,0x3F,0x00,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0x80,0xFF,0xE0,0x3F,0x01,
+0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x01,0xFF,0x03,0xFE,0x01,0xF0,
+0x00,0x00,0x7C,0x00,0x00,0x0F,0x80,0x00,0x00,0x7C,0x00,0x1F,0x80,0x00,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x08,0x80,0x7F,0xE0,0x3F,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x19,
+0xC1,0xFE,0x00,0x00,0xFF,0xFF,0xFC,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0xFF,
+0xFF,0xF0,0x7C,0x00,0x1F,0xC0,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0x80,0x7F,0xE0,
+0x3F,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x00,0x7F,0xFF,0xF8,
+0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0xFF,0xFF,0xF0,0x7C,0x00,0x0F,0xC0,0x00,
+0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0x80,0x3F,0xC0,0x3F,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,
+0xFF,0x19,0xC1,0xFE,0x00,0x00,0x3F,0xFF,0xF0,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,
+0x0F,0xFF,0xFF,0xF0,0x7C,0x00,0x07,0xE0,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xC0,
+0x0F,0x00,0x3F,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x00,0x0F,
+0xFF,0xC0,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x0F,0xFF,0xFF,0xF0,0x7C,0x00,0x07,
+0xF0,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xC0,0x00,0x00,0x7F,0x01,0xFF,0xFF,0xF8,
+0x0F,0xEF,0xFF,0x19,0xC1,0xFE,0x00,0x00,0x03,0xFF,0x00,0x01,0xF0,0x00,0x00,0x7C,
+0x00,0x00,0x0F,0xFF,0xFF,0xF0,0x7C,0x00,0x03,0xF0,0x00,0x1F,0xF8,0x3F,0xEB,0xFF,
+0x08,0xE0,0x00,0x00,0x7F,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x01,0xC1,0xFE,0xEC,
+0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xF0,0x00,0x00,0xFF,0x01,0xFF,0xFF,0xF8,
+0x0F,0xEF,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xF8,
+0x00,0x01,0xFF,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,
+0x1F,0xF8,0x3F,0xEB,0xFF,0x08,0xFC,0x00,0x03,0xFF,0x01,0xFF,0xFF,0xF8,0x0F,0xEF,
+0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,0xF8,0x3F,0xEA,0xFF,0x07,0x80,0x1F,0xFF,
+0x01,0xFF,0xFF,0xF8,0x0F,0xEF,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,0xF8,0x3F,
+0xD0,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x01,0xC1,0xFE,
+0xEC,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,0xF8,
+0x3F,0xD0,0xFF,0x01,0xC1,0xFE,0xEC,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x01,0xC1,
+0xFE,0xEC,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x03,0xC1,0xFE,0x00,0x18,0xEE,0x00,
+0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x03,0xC1,0xFE,0x00,0x7E,0xEE,0x00,0x02,0x1F,0xF8,
+0x3F,0xD0,0xFF,0x04,0xC1,0xFE,0x01,0xFF,0x80,0xEF,0x00,0x02,0x1F,0xF8,0x3F,0xD0,
+0xFF,0x04,0xC1,0xFE,0x01,0xFF,0xC0,0xEF,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x04,
+0xC1,0xFE,0x03,0xDB,0xC0,0xEF,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x04,0xC1,0xFE,
+0x03,0x99,0xC0,0xEF,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x01,0xE0,0x3F,0xF7,0xFF,
+0x01,0xFE,0x01,0xF4,0xFF,0x0C,0xC1,0xFE,0x03,0x98,0x00,0x00,0x0F,0xFF,0xFF,0x80,
+0x00,0x3F,0xF0,0xF7,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x01,0xE0,0x3F,0xFD,0xFF,
+0x00,0x3F,0xFC,0xFF,0x01,0xF8,0x00,0xF4,0xFF,0x0C,0xC1,0xFE,0x03,0xD8,0x00,0x00,
+0x0F,0xFF,0xFF,0x80,0x00,0xFF,0xFC,0xF7,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x01,
+0xE0,0x3F,0xFE,0xFF,0x01,0xFC,0x3F,0xFC,0xFF,0x01,0xF0,0x00,0xF4,0xFF,0x0C,0xC1,
+0xFE,0x03,0xF8,0x00,0x00,0x0F,0xFF,0xFF,0x80,0x03,0xFF,0xFF,0xF7,0x00,0x02,0x1F,
+0xF8,0x3F,0xEB,0xFF,0x01,0xE0,0x3F,0xFE,0xFF,0x01,0xF0,0x3F,0xFC,0xFF,0x01,0xE0,
+0x00,0xF4,0xFF,0x0D,0xC1,0xFE,0x01,0xFE,0x00,0x00,0x1F,0xFF,0xFF,0x80,0x07,0xFF,
+0xFF,0x80,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x01,0xE0,0x3F,0xFE,0xFF,0x01,
+0xE0,0x3F,0xFC,0xFF,0x01,0xE0,0x00,0xF4,0xFF,0x0D,0xC1,0xFE,0x00,0xFF,0x80,0x00,
+0x1F,0xFF,0xFF,0x80,0x0F,0xFF,0xFF,0xC0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,
+0x01,0xE0,0x3F,0xFE,0xFF,0x01,0xE0,0x3F,0xFC,0xFF,0x01,0xE0,0x1F,0xF4,0xFF,0x0D,
+0xC1,0xFE,0x00,0x1F,0xC0,0x00,0x1F,0xFF,0xFF,0x80,0x0F,0xFF,0xFF,0xC0,0xF8,0x00,
+0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x01,0xE0,0x3F,0xFE,0xFF,0x01,0xE0,0x3F,0xFC,0xFF,
+0x01,0xE0,0x3F,0xF4,0xFF,0x0D,0xC1,0xFE,0x00,0x1B,0xC0,0x00,0x1F,0xC0,0x00,0x00,
+0x1F,0xF8,0x7F,0xE0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x15,0xE0,0x3F,0xFF,
+0xC0,0x7F,0xE0,0x3F,0xFE,0x03,0xFF,0xFF,0xC0,0xE0,0x3F,0xFC,0x00,0xFF,0xFF,0x80,
+0x7F,0xFF,0x01,0xFC,0xFF,0x0D,0xC1,0xFE,0x00,0x19,0xC0,0x00,0x1F,0xC0,0x00,0x00,
+0x1F,0xF0,0x3F,0xE0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x03,
+0x00,0x3F,0x00,0x03,0xF8,0x00,0xFF,0xC0,0x80,0x00,0x03,0xF0,0x00,0x3F,0xFC,0x00,
+0x1F,0xFC,0x00,0x7F,0xFD,0xFF,0x0D,0xC1,0xFE,0x03,0x99,0xC0,0x00,0x3F,0xC0,0x00,
+0x00,0x1F,0xC0,0x1F,0xE0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,
+0x00,0x00,0x0F,0x00,0x03,0xE0,0x00,0x3F,0xC0,0x00,0x00,0x03,0xE0,0x00,0x1F,0xF8,
+0x00,0x0F,0xF0,0x00,0x1F,0xFD,0xFF,0x0D,0xC1,0xFE,0x03,0xD9,0xC0,0x00,0x3F,0x80,
+0x00,0x00,0x3F,0xC0,0x0F,0xF0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,0xE0,
+0x3F,0x00,0x00,0x0F,0x00,0x03,0xC0,0x00,0x1F,0xC0,0x00,0x00,0x03,0xC0,0x00,0x1F,
+0xF0,0x00,0x07,0xE0,0x00,0x0F,0xFD,0xFF,0x0D,0xC1,0xFE,0x03,0xDF,0xC0,0x00,0x3F,
+0x80,0x00,0x00,0x3F,0x80,0x07,0xF0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,
+0xE0,0x3F,0x00,0x00,0x07,0x00,0x03,0xC0,0x00,0x1F,0xC0,0x00,0x00,0x03,0xC0,0x00,
+0x0F,0xF0,0x00,0x07,0xE0,0x00,0x0F,0xFD,0xFF,0x0D,0xC1,0xFE,0x01,0xFF,0x80,0x00,
+0x3F,0x80,0x00,0x00,0x3F,0x80,0x07,0xF0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,
+0x16,0xE0,0x3F,0x00,0x30,0x07,0x00,0x03,0x80,0x70,0x0F,0xC0,0x00,0x00,0x03,0x80,
+0xF0,0x0F,0xE0,0x1C,0x03,0xC0,0x38,0x07,0xFD,0xFF,0x0D,0xC1,0xFE,0x01,0xFF,0x80,
+0x00,0x3F,0x80,0x00,0x00,0x3F,0x80,0x07,0xF0,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,
+0xFF,0x16,0xE0,0x3F,0x00,0xF8,0x07,0xE0,0x3F,0x80,0xF8,0x0F,0xC0,0x1F,0xE0,0x3F,
+0x80,0xF8,0x0F,0xE0,0x3E,0x03,0xC0,0x7C,0x07,0xFD,0xFF,0x0D,0xC1,0xFE,0x00,0x7E,
+0x00,0x00,0x7F,0xBF,0xE0,0x00,0x7F,0x80,0x07,0xF8,0xF8,0x00,0x02,0x1F,0xF8,0x3F,
+0xEB,0xFF,0x16,0xE0,0x3F,0x00,0xFC,0x07,0xE0,0x3F,0x00,0xFC,0x0F,0xC0,0x3F,0xE0,
+0x3F,0xE1,0xF8,0x0F,0xC0,0x3E,0x1F,0x80,0x7E,0x07,0xFD,0xFF,0x0D,0xC1,0xFE,0x00,
+0x18,0x00,0x00,0x7F,0xFF,0xF8,0x00,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x01,0xFC,0x07,0xC0,0x3F,
+0xE0,0x3F,0xFF,0xF0,0x0F,0xC0,0x7F,0xFF,0x80,0xFE,0x03,0xFD,0xFF,0x0D,0xC1,0xFE,
+0x00,0x18,0x00,0x00,0x7F,0xFF,0xFC,0x00,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,
+0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x00,0x00,0x07,0xC0,
+0x7F,0xE0,0x3F,0xFE,0x00,0x0F,0xC0,0x7F,0xFF,0x80,0x00,0x03,0xFD,0xFF,0x01,0xC1,
+0xFE,0xFD,0x00,0x07,0x7F,0xFF,0xFE,0x00,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,
+0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x00,0x00,0x07,0xC0,
+0x7F,0xE0,0x3F,0xF0,0x00,0x0F,0xC0,0x7F,0xFF,0x80,0x00,0x03,0xFD,0xFF,0x01,0xC1,
+0xFE,0xFD,0x00,0x07,0x7F,0xFF,0xFF,0x00,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,
+0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x00,0x00,0x07,0xC0,
+0x7F,0xE0,0x3F,0xC0,0x00,0x0F,0xC0,0x7F,0xFF,0x80,0x00,0x03,0xFD,0xFF,0x01,0xC1,
+0xFE,0xFD,0x00,0xFE,0xFF,0x04,0x80,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x00,0x00,0x07,0xC0,0x7F,
+0xE0,0x3F,0x80,0x00,0x0F,0xC0,0x7F,0xFF,0x80,0x00,0x03,0xFD,0xFF,0x01,0xC1,0xFE,
+0xFD,0x00,0x07,0xFF,0xE1,0xFF,0xC0,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x00,0x00,0x07,0xC0,0x7F,
+0xE0,0x3F,0x80,0x08,0x0F,0xC0,0x7F,0xFF,0x80,0x00,0x03,0xFD,0xFF,0x01,0xC1,0xFE,
+0xFD,0x00,0x07,0xFF,0x80,0x7F,0xC0,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x14,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x01,0xFF,0xFF,0xC0,0x7F,
+0xE0,0x3F,0x00,0x78,0x0F,0xC0,0x7F,0xFF,0x80,0xFB,0xFF,0x01,0xC1,0xFE,0xFD,0x00,
+0x07,0xFF,0x00,0x3F,0xC0,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,
+0xFF,0x14,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x01,0xFF,0xFF,0xC0,0x7F,0xE0,0x3F,
+0x01,0xF8,0x0F,0xC0,0x7E,0x1F,0x80,0xFB,0xFF,0x01,0xC1,0xFE,0xFD,0x00,0x07,0x3E,
+0x00,0x1F,0xE0,0x7F,0x00,0x03,0xF8,0xF8,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,
+0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x00,0xFC,0x3F,0xC0,0x7F,0xE0,0x3F,0x01,0xF8,
+0x0F,0xC0,0x3E,0x03,0x80,0x7E,0x1F,0xFD,0xFF,0x01,0xC1,0xFE,0xFB,0x00,0x0B,0x1F,
+0xE0,0x7F,0x00,0x03,0xF8,0x00,0x00,0x01,0xF0,0x07,0xE0,0xFE,0x00,0x02,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x3F,0x80,0xF8,0x07,0xC0,0x7F,
+0xE0,0x3F,0x01,0xF0,0x0F,0xE0,0x3C,0x03,0xC0,0x7C,0x03,0xFD,0xFF,0x01,0xC1,0xFE,
+0xFB,0x00,0x0B,0x0F,0xE0,0x7F,0x00,0x03,0xF8,0x00,0x00,0x07,0xFC,0x0F,0xF8,0xFE,
+0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x33,0x80,
+0x30,0x07,0xC0,0x7F,0xE0,0x3F,0x00,0xE0,0x0F,0xE0,0x18,0x03,0xC0,0x18,0x03,0xFD,
+0xFF,0x01,0xC1,0xFE,0xFB,0x00,0x0B,0x0F,0xE0,0x7F,0x00,0x03,0xF8,0x00,0x00,0x0F,
+0xFE,0x1F,0xFC,0xFE,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,
+0x07,0xE0,0x03,0xC0,0x00,0x0F,0xC0,0x7F,0xE0,0x3F,0x00,0x00,0x0F,0xF0,0x00,0x07,
+0xE0,0x00,0x07,0xFD,0xFF,0x01,0xC1,0xFE,0xFB,0x00,0x0B,0x0F,0xE0,0x7F,0x00,0x03,
+0xF8,0x00,0x00,0x0F,0x1E,0x3E,0x3C,0xFE,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,
+0xE0,0x3F,0x01,0xFC,0x07,0xE0,0x03,0xC0,0x00,0x0F,0xC0,0x7F,0xE0,0x3F,0x80,0x00,
+0x07,0xF0,0x00,0x07,0xE0,0x00,0x07,0xFD,0xFF,0x01,0xC1,0xFE,0xFB,0x00,0x0B,0x0F,
+0xE0,0x7F,0x00,0x03,0xF8,0x00,0x00,0x0E,0x0E,0x3C,0x1E,0xFE,0x00,0x02,0x1F,0xF8,
+0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xF0,0x03,0xE0,0x00,0x1F,0xC0,0x7F,
+0xE0,0x3F,0x80,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x0F,0xFD,0xFF,0x01,0xC1,0xFE,
+0xFB,0x00,0x0B,0x0F,0xE0,0x7F,0x80,0x07,0xF8,0x00,0x00,0x0E,0x0E,0x38,0x0E,0xFE,
+0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x16,0xE0,0x3F,0x01,0xFC,0x07,0xF0,0x03,0xF8,
+0x00,0x7F,0xC0,0x7F,0xE0,0x3F,0xC0,0x02,0x03,0xFC,0x00,0x1F,0xFC,0x00,0x3F,0xFD,
+0xFF,0x01,0xC1,0xFE,0xFE,0x00,0x0E,0x01,0xFC,0x00,0x0F,0xE0,0x3F,0x80,0x07,0xF0,
+0x00,0x00,0x0F,0x1E,0x38,0x0E,0xFE,0x00,0x02,0x1F,0xF8,0x3F,0xEB,0xFF,0x15,0xE0,
+0x3F,0x01,0xFC,0x07,0xFC,0x07,0xFE,0x01,0xFF,0xC0,0x7F,0xE0,0x3F,0xF0,0x0E,0x03,
+0xFF,0x00,0xFF,0xFF,0x00,0xFC,0xFF,0x01,0xC1,0xFE,0xFE,0x00,0x0E,0x01,0xFC,0x00,
+0x1F,0xE0,0x3F,0x80,0x07,0xF0,0x00,0x00,0x07,0xFC,0x38,0x0E,0xFE,0x00,0x02,0x1F,
+0xF8,0x3F,0xD0,0xFF,0x01,0xC1,0xFE,0xFE,0x00,0x0E,0x01,0xFE,0x00,0x1F,0xE0,0x3F,
+0x80,0x07,0xF0,0x00,0x00,0x07,0xFC,0x3C,0x1E,0xFE,0x00,0x02,0x1F,0xF8,0x3F,0xD0,
+0xFF,0x01,0xC1,0xFE,0xFE,0x00,0x0E,0x01,0xFE,0x00,0x1F,0xC0,0x3F,0xC0,0x0F,0xF0,
+0x00,0x00,0x0F,0xFE,0x3E,0x3E,0xFE,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x01,0xC1,
+0xFF,0xFD,0x00,0x0D,0xFF,0x00,0x3F,0xC0,0x1F,0xE0,0x1F,0xE0,0x00,0x00,0x1E,0x1F,
+0x1F,0xFE,0xFE,0x00,0x02,0x1F,0xF8,0x3F,0xD0,0xFF,0x02,0xC1,0xFF,0xC0,0xFE,0x00,
+0x0D,0xFF,0x80,0x7F,0x80,0x1F,0xF0,0x3F,0xE0,0x00,0x00,0x1E,0x0F,0x0F,0xFE,0xFE,
+0x00,0x02,0x7F,0xF8,0x3F,0xD0,0xFF,0x02,0xC1,0xFF,0xF0,0xFE,0x00,0x13,0x7F,0xC1,
+0xFF,0x80,0x1F,0xF8,0x7F,0xE0,0x00,0x00,0x1C,0x07,0x07,0xEE,0x00,0x00,0x01,0xFF,
+0xF8,0x3F,0xD0,0xFF,0x02,0xC1,0xFF,0xF8,0xFE,0x00,0x13,0x7F,0xFF,0xFF,0x00,0x0F,
+0xFF,0xFF,0xC0,0x07,0xF0,0x1C,0x07,0x38,0x1E,0x00,0x00,0x03,0xFF,0xF8,0x3F,0xD0,
+0xFF,0x02,0xC1,0xFF,0xFE,0xFE,0x00,0x13,0x3F,0xFF,0xFE,0x00,0x0F,0xFF,0xFF,0xC0,
+0x07,0xF0,0x1C,0x07,0x3C,0x1C,0x00,0x00,0x0F,0xFF,0xF8,0x3F,0xD0,0xFF,0x19,0xC1,
+0xFF,0xFF,0x80,0x00,0x00,0x1F,0xFF,0xFE,0x00,0x07,0xFF,0xFF,0x80,0x07,0xF0,0x1F,
+0x0F,0x3C,0x3C,0x00,0x00,0x3F,0xFF,0xF8,0x3F,0xD0,0xFF,0x1B,0xC0,0xFF,0xFF,0xE0,
+0x00,0x00,0x0F,0xFF,0xF8,0x00,0x03,0xFF,0xFF,0x00,0x07,0xF0,0x0F,0xFE,0x1F,0xF8,
+0x00,0x00,0xFF,0xFF,0xE0,0x3F,0xFF,0xF0,0xF3,0x00,0x00,0x0F,0xE1,0xFF,0x1B,0xC0,
+0x3F,0xFF,0xF0,0x00,0x00,0x07,0xFF,0xF0,0x00,0x00,0xFF,0xFC,0x00,0x07,0xF0,0x07,
+0xFC,0x1F,0xF0,0x00,0x01,0xFF,0xFF,0xC0,0x3F,0xFF,0xF0,0xF3,0x00,0x00,0x0F,0xE1,
+0xFF,0x03,0xC0,0x1F,0xFF,0xFC,0xFE,0x00,0x14,0xFF,0x80,0x00,0x00,0x3F,0xF0,0x00,
+0x07,0xF0,0x03,0xF8,0x07,0xE0,0x00,0x07,0xFF,0xFF,0x00,0x3F,0xFF,0xF0,0xF3,0x00,
+0x00,0x0F,0xE1,0xFF,0x03,0xC0,0x07,0xFF,0xFF,0xF0,0x00,0x06,0x1F,0xFF,0xFC,0x00,
+0x7F,0xFF,0xF0,0xF3,0x00,0x00,0x0F,0xE1,0xFF,0x04,0xF0,0x01,0xFF,0xFF,0x80,0xF1,
+0x00,0x06,0x7F,0xFF,0xF0,0x01,0xFF,0xFF,0xF0,0xFD,0xFF,0x05,0x0F,0x00,0x00,0x7F,
+0xFF,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xE1,0xFF,0x04,0xFC,0x00,0x7F,0xFF,0xE0,0xF1,
+0x00,0x06,0xFF,0xFF,0xE0,0x07,0xFF,0xFF,0xF0,0xFD,0xFF,0x05,0x0F,0x00,0x00,0x7F,
+0xFF,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xE0,0xFF,0x03,0x00,0x3F,0xFF,0xF8,0xF2,0x00,
+0x07,0x03,0xFF,0xFF,0x80,0x0F,0xFF,0xFF,0xF0,0xFD,0xFF,0x05,0x0F,0x00,0x00,0x7F,
+0xFF,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xE0,0xFF,0x03,0x80,0x0F,0xFF,0xFE,0xF2,0x00,
+0x07,0x0F,0xFF,0xFE,0x00,0x3F,0xFF,0xFF,0xF0,0xFD,0xFF,0x05,0x0F,0x00,0x00,0x7F,
+0xFF,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xE0,0xFF,0x03,0xE0,0x03,0xFF,0xFF,0xF2,0x00,
+0x03,0x3F,0xFF,0xF8,0x00,0xFE,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0x00,0x7F,
+0x81,0xE0,0x00,0xF8,0x00,0x00,0x0E,0x0F,0xE0,0xFF,0x04,0xF8,0x00,0xFF,0xFF,0xC0,
+0xF3,0x00,0x03,0x7F,0xFF,0xF0,0x01,0xFE,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,
+0x00,0x7F,0x81,0xE0,0x00,0xF8,0x00,0x00,0x0E,0x0F,0xE0,0xFF,0x04,0xFE,0x00,0x7F,
+0xFF,0xF0,0xF4,0x00,0x04,0x01,0xFF,0xFF,0xC0,0x07,0xFE,0xFF,0x0F,0xF0,0xF0,0x00,
+0x00,0x1F,0x0F,0x00,0x7F,0x81,0xE0,0x00,0xF8,0x00,0x00,0x0E,0x0F,0xDF,0xFF,0x03,
+0x00,0x1F,0xFF,0xF8,0xF4,0x00,0x04,0x07,0xFF,0xFF,0x00,0x1F,0xFE,0xFF,0x0F,0xF0,
+0xF0,0x00,0x00,0x1F,0x0F,0x00,0x7F,0x81,0xE0,0x00,0xF8,0x00,0x00,0x0E,0x0F,0xDF,
+0xFF,0x03,0xC0,0x07,0xFF,0xFE,0xF4,0x00,0x04,0x1F,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,
+0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x01,0x81,0xE0,0x00,0xF8,0xFF,0xFE,0x0E,
+0x0F,0xDF,0xFF,0x04,0xF0,0x01,0xFF,0xFF,0x80,0xF5,0x00,0x03,0x7F,0xFF,0xF8,0x00,
+0xFD,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x01,0x81,0xE0,0x00,0xF8,0xFF,
+0xFE,0x0E,0x0F,0xDF,0xFF,0x04,0xFC,0x00,0xFF,0xFF,0xC0,0xF5,0x00,0x03,0xFF,0xFF,
+0xE0,0x03,0xFD,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x01,0x81,0xE0,0x00,
+0xF8,0xFF,0xFE,0x0E,0x0F,0xDF,0xFF,0x04,0xFE,0x00,0x3F,0xFF,0xF0,0xF6,0x00,0x04,
+0x03,0xFF,0xFF,0x80,0x0F,0xFD,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x01,
+0x81,0xE0,0x00,0xF8,0xFF,0xFE,0x0E,0x0F,0xDE,0xFF,0x03,0x80,0x0F,0xFF,0xFC,0xF6,
+0x00,0x04,0x0F,0xFF,0xFF,0x00,0x1F,0xFD,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,
+0xF0,0x01,0x81,0xE0,0x00,0xF8,0xFF,0xFE,0x0E,0x0F,0xDE,0xFF,0x03,0xE0,0x03,0xFF,
+0xFF,0xF6,0x00,0x04,0x3F,0xFF,0xFC,0x00,0x7F,0xFD,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,
+0x1F,0x0F,0xFF,0x81,0xFF,0xE0,0xF0,0xF8,0xFF,0xFE,0x0E,0x0F,0xDE,0xFF,0x04,0xF8,
+0x01,0xFF,0xFF,0x80,0xF7,0x00,0x03,0x7F,0xFF,0xF0,0x01,0xFC,0xFF,0x0F,0xF0,0xF0,
+0xFF,0xF8,0x1F,0x0F,0xFF,0x81,0xFF,0xE0,0xF0,0xF8,0xFF,0xFE,0x0E,0x0F,0xDE,0xFF,
+0x04,0xFC,0x00,0x7F,0xFF,0xE0,0xF8,0x00,0x04,0x01,0xFF,0xFF,0xE0,0x07,0xFC,0xFF,
+0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xFF,0x81,0xFF,0xE0,0xF0,0xF8,0xFF,0xFE,0x0E,
+0x0F,0xDD,0xFF,0x03,0x00,0x1F,0xFF,0xF8,0xF8,0x00,0x04,0x07,0xFF,0xFF,0x80,0x0F,
+0xFC,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xFF,0x81,0xFF,0xE0,0xF0,0xF8,0xFF,
+0xFE,0x0E,0x0F,0xDD,0xFF,0x03,0xC0,0x07,0xFF,0xFC,0xF8,0x00,0x04,0x1F,0xFF,0xFE,
+0x00,0x3F,0xFC,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xFF,0x81,0xFF,0xE0,0xF0,
+0xF8,0xFF,0xFE,0x0E,0x0F,0xDD,0xFF,0x03,0xF0,0x03,0xFF,0xFF,0xF8,0x00,0x03,0x3F,
+0xFF,0xF8,0x00,0xFB,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xFF,0x81,0xFF,0xE0,
+0xF0,0xF8,0xFF,0xFE,0x0E,0x0F,0xDD,0xFF,0x04,0xF8,0x00,0xFF,0xFF,0xC0,0xF9,0x00,
+0x03,0xFF,0xFF,0xF0,0x01,0xFB,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0xFF,0x81,
+0x81,0xFF,0x00,0xF8,0xFF,0xFE,0x0E,0x0F,0xDD,0xFF,0x04,0xFE,0x00,0x3F,0xFF,0xF0,
+0xFA,0x00,0x04,0x03,0xFF,0xFF,0xC0,0x07,0xFB,0xFF,0x0F,0xF0,0xF0,0xFF,0xF8,0x1F,
+0x00,0xFF,0x81,0x81,0xFF,0x00,0xF8,0xFF,0xFE,0x0E,0x0F,0xDC,0xFF,0x03,0x80,0x0F,
+0xFF,0xF8,0xFA,0x00,0x04,0x0F,0xFF,0xFF,0x00,0x1F,0xFB,0xFF,0x0F,0xF0,0xF0,0x00,
+0x00,0x1F,0x0F,0xFF,0x80,0x00,0x00,0xF0,0xF8,0x00,0x00,0x0E,0x0F,0xDC,0xFF,0x03,
+0xE0,0x07,0xFF,0xFE,0xFA,0x00,0x04,0x1F,0xFF,0xFE,0x00,0x7F,0xFB,0xFF,0x0F,0xF0,
+0xF0,0x00,0x00,0x1F,0x0F,0xFF,0x80,0x00,0x00,0xF0,0xF8,0x00,0x00,0x0E,0x0F,0xDC,
+0xFF,0x04,0xF0,0x01,0xFF,0xFF,0x80,0xFB,0x00,0x03,0x7F,0xFF,0xF8,0x00,0xFA,0xFF,
+0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0x80,0x00,0x00,0xF0,0xF8,0x00,0x00,0x0E,
+0x0F,0xDC,0xFF,0x04,0xFC,0x00,0x7F,0xFF,0xC0,0xFC,0x00,0x04,0x01,0xFF,0xFF,0xE0,
+0x03,0xFA,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0x80,0x00,0x00,0xF0,0xF8,
+0x00,0x00,0x0E,0x0F,0xDB,0xFF,0x03,0x00,0x1F,0xFF,0xF0,0xFC,0x00,0x04,0x07,0xFF,
+0xFF,0x80,0x0F,0xFA,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0x80,0x00,0x00,
+0xF0,0xF8,0x00,0x00,0x0E,0x0F,0xDB,0xFF,0x03,0xC0,0x0F,0xFF,0xFC,0xFC,0x00,0x04,
+0x0F,0xFF,0xFF,0x00,0x3F,0xFA,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0x80,
+0x00,0x00,0xF0,0xF8,0x00,0x00,0x0E,0x0F,0xDB,0xFF,0x03,0xE0,0x03,0xFF,0xFE,0xFC,
+0x00,0x04,0x3F,0xFF,0xFC,0x00,0x7F,0xFA,0xFF,0x00,0xF0,0xFD,0xFF,0x05,0x0F,0x0F,
+0x81,0x81,0xE0,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xDB,0xFF,0x04,0xF8,0x00,0xFF,0xFF,
+0x80,0xFD,0x00,0x03,0xFF,0xFF,0xF0,0x01,0xF9,0xFF,0x00,0xF0,0xFD,0xFF,0x05,0x0F,
+0x0F,0x81,0x81,0xE0,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xDB,0xFF,0x04,0xFE,0x00,0x3F,
+0xFF,0xE0,0xFE,0x00,0x04,0x03,0xFF,0xFF,0xC0,0x07,0xF9,0xFF,0x00,0xF0,0xFD,0xFF,
+0x05,0x0F,0x0F,0x81,0x81,0xE0,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xDA,0xFF,0x03,0x80,
+0x1F,0xFF,0xF8,0xFE,0x00,0x04,0x07,0xFF,0xFF,0x80,0x0F,0xF9,0xFF,0x00,0xF0,0xFD,
+0xFF,0x05,0x0F,0x0F,0x81,0x81,0xE0,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xDA,0xFF,0x03,
+0xC0,0x07,0xFF,0xFC,0xFE,0x00,0x04,0x1F,0xFF,0xFE,0x00,0x3F,0xF9,0xFF,0x00,0xF0,
+0xFD,0xFF,0x05,0x0F,0x0F,0x81,0x81,0xE0,0xF0,0xFE,0xFF,0x01,0xFE,0x0F,0xDA,0xFF,
+0x03,0xF0,0x01,0xFF,0xFF,0xFE,0x00,0x03,0x7F,0xFF,0xF8,0x00,0xF8,0xFF,0x00,0xF0,
+0xFC,0x00,0x04,0x0F,0xFE,0x01,0xFF,0xF0,0xFD,0x00,0x00,0x0F,0xDA,0xFF,0x0A,0xFC,
+0x00,0x7F,0xFF,0xC0,0x00,0x01,0xFF,0xFF,0xF0,0x03,0xF8,0xFF,0x00,0xF0,0xFC,0x00,
+0x04,0x0F,0xFE,0x01,0xFF,0xF0,0xFD,0x00,0x00,0x0F,0xD9,0xFF,0x09,0x00,0x3F,0xFF,
+0xE0,0x00,0x03,0xFF,0xFF,0xC0,0x07,0xF8,0xFF,0x00,0xF0,0xFC,0x00,0x04,0x0F,0xFE,
+0x01,0xFF,0xF0,0xFD,0x00,0x00,0x0F,0xD9,0xFF,0x09,0x80,0x0F,0xFF,0xF8,0x00,0x0F,
+0xFF,0xFF,0x00,0x1F,0xF8,0xFF,0x00,0xF0,0xFC,0x00,0x04,0x0F,0xFE,0x01,0xFF,0xF0,
+0xFD,0x00,0x00,0x0F,0xD9,0xFF,0x09,0xE0,0x03,0xFF,0xFE,0x00,0x3F,0xFF,0xFC,0x00,
+0x7F,0xF8,0xFF,0x0F,0xF0,0xFF,0x00,0x1F,0xFF,0x00,0x0F,0x81,0x80,0x1F,0xF0,0x07,
+0x07,0xFF,0xFE,0x0F,0xD9,0xFF,0x08,0xF8,0x00,0xFF,0xFF,0x80,0xFF,0xFF,0xF8,0x00,
+0xF7,0xFF,0x0F,0xF0,0xFF,0x00,0x1F,0xFF,0x00,0x0F,0x81,0x80,0x1F,0xF0,0x07,0x07,
+0xFF,0xFE,0x0F,0xD9,0xFF,0x08,0xFE,0x00,0x7F,0xFF,0xC1,0xFF,0xFF,0xE0,0x03,0xF7,
+0xFF,0x0F,0xF0,0xFF,0x00,0x1F,0xFF,0x00,0x0F,0x81,0x80,0x1F,0xF0,0x07,0x07,0xFF,
+0xFE,0x0F,0xD8,0xFF,0x01,0x00,0x1F,0xFD,0xFF,0x01,0x80,0x0F,0xF7,0xFF,0x0F,0xF0,
+0xFF,0x00,0x1F,0xFF,0x00,0x0F,0x81,0x80,0x1F,0xF0,0x07,0x07,0xFF,0xFE,0x0F,0xD8,
+0xFF,0x01,0xC0,0x07,0xFD,0xFF,0x01,0x00,0x3F,0xF7,0xFF,0x0F,0xF0,0x0F,0xF8,0x1F,
+0xE0,0xF0,0x00,0x00,0x01,0xFF,0xF0,0x00,0xFF,0x81,0xF0,0x0F,0xD8,0xFF,0x01,0xF0,
+0x01,0xFE,0xFF,0x02,0xFC,0x00,0x7F,0xF7,0xFF,0x0F,0xF0,0x0F,0xF8,0x1F,0xE0,0xF0,
+0x00,0x00,0x01,0xFF,0xF0,0x00,0xFF,0x81,0xF0,0x0F,0xD8,0xFF,0x01,0xFC,0x00,0xFE,
+0xFF,0x01,0xF0,0x01,0xF6,0xFF,0x0F,0xF0,0x0F,0xF8,0x1F,0xE0,0xF0,0x00,0x00,0x01,
+0xFF,0xF0,0x00,0xFF,0x81,0xF0,0x0F,0xD8,0xFF,0x06,0xFE,0x00,0x3F,0xFF,0xFF,0xC0,
+0x07,0xF6,0xFF,0x0F,0xF0,0x0F,0xF8,0x1F,0xE0,0xF0,0x00,0x00,0x01,0xFF,0xF0,0x00,
+0xFF,0x81,0xF0,0x0F,0xD7,0xFF,0x05,0x80,0x0F,0xFF,0xFF,0x80,0x1F,0xF6,0xFF,0x0B,
+0xF0,0x0F,0x07,0xE0,0x1F,0xFF,0xFF,0x80,0x01,0xFF,0x00,0x07,0xFE,0x00,0x00,0x0F,
+0xD7,0xFF,0x05,0xE0,0x03,0xFF,0xFE,0x00,0x3F,0xF6,0xFF,0x0B,0xF0,0x0F,0x07,0xE0,
+0x1F,0xFF,0xFF,0x80,0x01,0xFF,0x00,0x07,0xFE,0x00,0x00,0x0F,0xD7,0xFF,0x04,0xF8,
+0x01,0xFF,0xF8,0x00,0xF5,0xFF,0x0B,0xF0,0x0F,0x07,0xE0,0x1F,0xFF,0xFF,0x80,0x01,
+0xFF,0x00,0x07,0xFE,0x00,0x00,0x0F,0xD7,0xFF,0x04,0xFC,0x00,0x7F,0xE0,0x03,0xF5,
+0xFF,0x0B,0xF0,0x0F,0x07,0xE0,0x1F,0xFF,0xFF,0x80,0x01,0xFF,0x00,0x07,0xFE,0x00,
+0x00,0x0F,0xD6,0xFF,0x03,0x00,0x1F,0xC0,0x07,0xF5,0xFF,0x0B,0xF0,0x0F,0x07,0xE0,
+0x1F,0xFF,0xFF,0x80,0x01,0xFF,0x00,0x07,0xFE,0x00,0x00,0x0F,0xD6,0xFF,0x03,0xC0,
+0x07,0x00,0x1F,0xF5,0xFF,0x0F,0xF0,0xF0,0xF8,0x18,0x00,0xFF,0xF0,0x01,0x81,0xFF,
+0xFF,0x07,0xFF,0xFE,0x0E,0x0F,0xD6,0xFF,0x03,0xF0,0x00,0x00,0x7F,0xF5,0xFF,0x0F,
+0xF0,0xF0,0xF8,0x18,0x00,0xFF,0xF0,0x01,0x81,0xFF,0xFF,0x07,0xFF,0xFE,0x0E,0x0F,
+0xD6,0xFF,0x02,0xF8,0x00,0x01,0xF4,0xFF,0x0F,0xF0,0xF0,0xF8,0x18,0x00,0xFF,0xF0,
+0x01,0x81,0xFF,0xFF,0x07,0xFF,0xFE,0x0E,0x0F,0xD6,0xFF,0x02,0xFE,0x00,0x03,0xF4,
+0xFF,0x0F,0xF0,0xF0,0xF8,0x18,0x00,0xFF,0xF0,0x01,0x81,0xFF,0xFF,0x07,0xFF,0xFE,
+0x0E,0x0F,0xD5,0xFF,0x01,0x80,0x0F,0xF4,0xFF,0x0F,0xF0,0xF0,0xF8,0x18,0x00,0xFF,
+0xF0,0x01,0x81,0xFF,0xFF,0x07,0xFF,0xFE,0x0E,0x0F,0xD5,0xFF,0x01,0xE0,0x3F,0xF4,
+0xFF,0x0F,0xF0,0xF0,0xF8,0x18,0x00,0xFF,0xF0,0x01,0x81,0xFF,0xFF,0x07,0xFF,0xFE,
+0x0E,0x0F,0xD5,0xFF,0x01,0xF0,0x7F,0xF4,0xFF,0x0F,0xF0,0xF0,0xF8,0x00,0x1F,0x0F,
+0x00,0x7E,0x7F,0xE0,0x0F,0xFF,0x00,0x7F,0xFE,0x0F,0xC6,0xFF,0x0F,0xF0,0xF0,0xF8,
+0x00,0x1F,0x0F,0x00,0x7E,0x7F,0xE0,0x0F,0xFF,0x00,0x7F,0xFE,0x0F,0xC6,0xFF,0x0F,
+0xF0,0xFF,0xFF,0xF8,0x00,0xFF,0x0F,0x81,0x81,0xFF,0xF0,0x07,0xFF,0xFF,0xF0,0x0F,
+0xC6,0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,0x00,0xFF,0x0F,0x81,0x81,0xFF,0xF0,0x07,0xFF,
+0xFF,0xF0,0x0F,0xC6,0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,0x00,0xFF,0x0F,0x81,0x81,0xFF,
+0xF0,0x07,0xFF,0xFF,0xF0,0x0F,0xC6,0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,0x00,0xFF,0x0F,
+0x81,0x81,0xFF,0xF0,0x07,0xFF,0xFF,0xF0,0x0F,0xC6,0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,
+0x00,0xFF,0x0F,0x81,0x81,0xFF,0xF0,0x07,0xFF,0xFF,0xF0,0x0F,0xC6,0xFF,0x0F,0xF0,
+0xFF,0xFF,0xF8,0x00,0xFF,0x0F,0x81,0x81,0xFF,0xF0,0x07,0xFF,0xFF,0xF0,0x0F,0xC6,
+0xFF,0x01,0xF0,0x00,0xFD,0xFF,0x01,0xF0,0x7F,0xFE,0xFF,0x04,0xF8,0x07,0x80,0x00,
+0x0F,0xC6,0xFF,0x01,0xF0,0x00,0xFD,0xFF,0x01,0xF0,0x7F,0xFE,0xFF,0x04,0xF8,0x07,
+0x80,0x00,0x0F,0xC6,0xFF,0x01,0xF0,0x00,0xFD,0xFF,0x01,0xF0,0x7F,0xFE,0xFF,0x04,
+0xF8,0x07,0x80,0x00,0x0F,0xC6,0xFF,0x01,0xF0,0x00,0xFD,0xFF,0x01,0xF0,0x7F,0xFE,
+0xFF,0x04,0xF8,0x07,0x80,0x00,0x0F,0xC6,0xFF,0x0F,0xF0,0x00,0x07,0xFF,0xE0,0xFF,
+0x00,0x7E,0x7E,0x1F,0x00,0x07,0x00,0x7E,0x0E,0x0F,0xC6,0xFF,0x0F,0xF0,0x00,0x07,
+0xFF,0xE0,0xFF,0x00,0x7E,0x7E,0x1F,0x00,0x07,0x00,0x7E,0x0E,0x0F,0xC6,0xFF,0x0F,
+0xF0,0x00,0x07,0xFF,0xE0,0xFF,0x00,0x7E,0x7E,0x1F,0x00,0x07,0x00,0x7E,0x0E,0x0F,
+0xC6,0xFF,0x0F,0xF0,0x00,0x07,0xFF,0xE0,0xFF,0x00,0x7E,0x7E,0x1F,0x00,0x07,0x00,
+0x7E,0x0E,0x0F,0xC6,0xFF,0x0F,0xF0,0x00,0x07,0xFF,0xE0,0xFF,0x00,0x7E,0x7E,0x1F,
+0x00,0x07,0x00,0x7E,0x0E,0x0F,0xC6,0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,0x1F,0x0F,0x0F,
+0x81,0xFE,0x1F,0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,0xC6,0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,
+0x1F,0x0F,0x0F,0x81,0xFE,0x1F,0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,0xC6,0xFF,0x0F,0xF0,
+0xFF,0xFF,0xF8,0x1F,0x0F,0x0F,0x81,0xFE,0x1F,0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,0xC6,
+0xFF,0x0F,0xF0,0xFF,0xFF,0xF8,0x1F,0x0F,0x0F,0x81,0xFE,0x1F,0xFF,0xFF,0xF8,0x7F,
+0xFE,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0x00,0x0A,0x0F,0xF0,0x00,0x7F,0xE0,0xF0,0x00,
+0xFF,0x81,0xF0,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0x00,0x0A,0x0F,0xF0,0x00,0x7F,0xE0,
+0xF0,0x00,0xFF,0x81,0xF0,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0x00,0x0A,0x0F,0xF0,0x00,
+0x7F,0xE0,0xF0,0x00,0xFF,0x81,0xF0,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0x00,0x0A,0x0F,
+0xF0,0x00,0x7F,0xE0,0xF0,0x00,0xFF,0x81,0xF0,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0xFF,
+0xFC,0x00,0x05,0xF0,0xF8,0xF8,0x00,0x00,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0xFF,0xFC,
+0x00,0x05,0xF0,0xF8,0xF8,0x00,0x00,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0xFF,0xFC,0x00,
+0x05,0xF0,0xF8,0xF8,0x00,0x00,0x0F,0xFE,0xFF,0x38,0xFC,0x3F,0xE1,0xFF,0x00,0xFF,
+0x87,0xFC,0x03,0xFE,0x1F,0xF0,0xFF,0xFF,0xC0,0x1F,0xFF,0xE0,0x0F,0xFF,0xF0,0x07,
+0xFE,0x00,0x1F,0xFF,0xFF,0xF8,0x00,0x7F,0xF0,0xFF,0x80,0xFF,0xC0,0x00,0xFE,0x1F,
+0xFF,0xFE,0x1F,0xF8,0x7F,0xF8,0x7F,0xFF,0xE0,0x3F,0xFF,0xC0,0x1F,0xF8,0x1F,0xF8,
+0x1F,0xFF,0xF0,0xFD,0xFF,0xFC,0x00,0x05,0xF0,0xF8,0xF8,0x00,0x00,0x0F,0xFE,0xFF,
+0x38,0xFC,0x3F,0xC1,0xFF,0x00,0xFF,0x07,0xFC,0x03,0xFC,0x1F,0xF0,0xFF,0xFF,0x00,
+0x07,0xFF,0x80,0x03,0xFF,0xC0,0x01,0xFE,0x00,0x03,0xFF,0xFF,0xF8,0x00,0x0F,0xF0,
+0xFE,0x00,0x3F,0xC0,0x00,0x3E,0x1F,0xFF,0xFE,0x0F,0xF8,0x3F,0xF0,0x7F,0xFF,0x80,
+0x07,0xFF,0x00,0x07,0xF8,0x1F,0xF8,0x1F,0xFF,0xF0,0xFD,0xFF,0xFC,0x00,0x05,0xF0,
+0xF8,0xF8,0x00,0x00,0x0F,0xFE,0xFF,0x47,0xFC,0x1F,0xC1,0xFE,0x00,0x7F,0x07,0xF8,
+0x01,0xFC,0x1F,0xE0,0xFF,0xFE,0x00,0x01,0xFF,0x00,0x01,0xFF,0x80,0x00,0xFE,0x00,
+0x01,0xFF,0xFF,0xF8,0x00,0x07,0xF0,0xFC,0x00,0x1F,0xC0,0x00,0x1E,0x1F,0xFF,0xFC,
+0x0F,0xFC,0x1F,0xE0,0xFF,0xFE,0x00,0x03,0xFE,0x00,0x03,0xF8,0x0F,0xF0,0x1F,0xFF,
+0xF0,0xF0,0x00,0x00,0x1F,0x0F,0x0F,0x81,0x81,0xE0,0xF0,0x00,0xF8,0x7F,0xF0,0x0F,
+0xFE,0xFF,0x47,0xFE,0x1F,0xC0,0xFE,0x18,0x7F,0x03,0xF8,0x61,0xFC,0x0F,0xE1,0xFF,
+0xFC,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0xFF,0xFF,0xF8,0x00,
+0x03,0xF0,0xFC,0x00,0x0F,0xC0,0x00,0x1E,0x1F,0xFF,0xFC,0x07,0xFE,0x1F,0xE1,0xFF,
+0xFC,0x00,0x01,0xFC,0x00,0x01,0xF8,0x0F,0xF0,0x1F,0xFF,0xF0,0xF0,0x00,0x00,0x1F,
+0x0F,0x0F,0x81,0x81,0xE0,0xF0,0x00,0xF8,0x7F,0xF0,0x0F,0xFE,0xFF,0x47,0xFE,0x1F,
+0x80,0xFE,0x18,0x7E,0x03,0xF8,0x61,0xF8,0x0F,0xE1,0xFF,0xF8,0x0F,0xC0,0xFC,0x07,
+0xC0,0x7E,0x03,0xE0,0x3E,0x1F,0xC0,0x7F,0xFF,0xF8,0x7F,0x01,0xF0,0xF8,0x1E,0x07,
+0xC3,0xFC,0x0E,0x1F,0xFF,0xFC,0x07,0xFE,0x0F,0xC1,0xFF,0xFC,0x0F,0x81,0xF8,0x0F,
+0x80,0xF8,0x0F,0xF0,0x1F,0xFF,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0x0F,0x81,0x81,0xE0,
+0xF0,0x00,0xF8,0x7F,0xF0,0x0F,0xFE,0xFF,0x47,0xFE,0x1F,0x80,0xFE,0x18,0x7E,0x03,
+0xF8,0x61,0xF8,0x0F,0xE1,0xFF,0xF0,0x3F,0xF0,0x78,0x1F,0xF0,0x3C,0x0F,0xF8,0x1E,
+0x1F,0xF0,0x7F,0xFF,0xF8,0x7F,0xC1,0xF0,0xF8,0x7F,0x07,0xC3,0xFE,0x0E,0x1F,0xFF,
+0xF8,0x07,0xFF,0x07,0x83,0xFF,0xF8,0x1F,0xE0,0xF0,0x3F,0xE0,0x78,0x07,0xE0,0x1F,
+0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x7E,0x7F,0xE0,0xFF,0xFF,0xF8,0x7F,0xFE,
+0x0F,0xFE,0xFF,0x47,0xFE,0x0F,0x80,0x7C,0x18,0x3E,0x01,0xF0,0x60,0xF8,0x07,0xC1,
+0xFF,0xF0,0x7F,0xF8,0x78,0x3F,0xF8,0x3C,0x1F,0xFC,0x1E,0x1F,0xF8,0x7F,0xFF,0xF8,
+0x7F,0xE1,0xF0,0xF8,0x7F,0x87,0xC3,0xFF,0x0E,0x1F,0xFF,0xF8,0x03,0xFF,0x07,0x83,
+0xFF,0xF8,0x3F,0xF0,0xF0,0x7F,0xF0,0x78,0x07,0xE0,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,
+0x1F,0x0F,0xF0,0x7E,0x7F,0xE0,0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,0xFD,0xFF,0x05,0x0F,
+0x08,0x7C,0x3C,0x3C,0x21,0xFE,0xF0,0x3D,0x87,0xC3,0xFF,0xF0,0xFF,0xF8,0x78,0x7F,
+0xFC,0x3C,0x3F,0xFE,0x1E,0x1F,0xF8,0x3F,0xFF,0xF8,0x7F,0xE0,0xF0,0xF8,0x3F,0x87,
+0xC3,0xFF,0x0E,0x1F,0xFF,0xF0,0x43,0xFF,0x83,0x07,0xFF,0xF0,0x7F,0xF0,0xF0,0xFF,
+0xF8,0x78,0x07,0xE0,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x7E,0x7F,0xE0,
+0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,0xFD,0xFF,0x05,0x0F,0x0C,0x7C,0x3C,0x3C,0x31,0xFE,
+0xF0,0x3D,0xC7,0xC3,0xFF,0xE0,0xFF,0xFF,0xF0,0x7F,0xFC,0x18,0x3F,0xFE,0x0E,0x1F,
+0xFC,0x3F,0xFF,0xF8,0x7F,0xF0,0xF0,0xF8,0x0F,0xFF,0xC3,0xFE,0x0E,0x1F,0xFF,0xF0,
+0xC1,0xFF,0xC3,0x0F,0xFF,0xF0,0x7F,0xFF,0xE0,0xFF,0xF8,0x38,0x03,0xC0,0x1F,0xFF,
+0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,0xF0,0x7E,0x7F,0xE0,0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,
+0xFD,0xFF,0x01,0x0F,0x0C,0xFE,0x3C,0x00,0x30,0xFE,0xF0,0x3D,0xC3,0xC3,0xFF,0xE1,
+0xFF,0xFF,0xF0,0xFF,0xFE,0x18,0x7F,0xFF,0x0E,0x1F,0xFC,0x3F,0xFF,0xF8,0x7F,0xF0,
+0xF0,0xFC,0x00,0xFF,0xC3,0xFC,0x0E,0x1F,0xFF,0xF0,0xE1,0xFF,0xC0,0x0F,0xFF,0xF0,
+0xFF,0xFF,0xE1,0xFF,0xFC,0x38,0x43,0xC2,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x0F,
+0xF0,0x7E,0x7F,0xE0,0xFF,0xFF,0xF8,0x7F,0xFE,0x0F,0xFD,0xFF,0x46,0x87,0x1C,0x38,
+0x7E,0x1C,0x70,0xE1,0xF8,0x71,0xC3,0x87,0xFF,0xE1,0xFE,0x00,0x70,0xFF,0xFE,0x18,
+0x7F,0xFF,0x0E,0x1F,0xFC,0x3C,0x00,0x78,0x7F,0xF0,0xF0,0xFC,0x00,0x3F,0xC0,0x00,
+0x1E,0x1F,0xFF,0xE0,0xE1,0xFF,0xE0,0x1F,0xFF,0xF0,0xFF,0xFF,0xE1,0xFF,0xFC,0x38,
+0x43,0xC2,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0x0F,0x81,0x80,0x00,0x0F,0xFF,
+0x07,0xFF,0xFE,0x0F,0xFD,0xFF,0x46,0x86,0x1C,0x38,0x7E,0x18,0x70,0xE1,0xF8,0x61,
+0xC3,0x87,0xFF,0xE1,0xFE,0x00,0x70,0xFF,0xFE,0x18,0x7F,0xFF,0x0E,0x1F,0xFC,0x3C,
+0x00,0x78,0x7F,0xF0,0xF0,0xFF,0x00,0x0F,0xC0,0x00,0x1E,0x1F,0xFF,0xE1,0xE0,0xFF,
+0xF0,0x3F,0xFF,0xF0,0xFF,0xFF,0xE1,0xFF,0xFC,0x38,0x41,0x82,0x1F,0xFF,0xF0,0xF0,
+0xFF,0xF8,0x1F,0x00,0x0F,0x81,0x80,0x00,0x0F,0xFF,0x07,0xFF,0xFE,0x0F,0xFD,0xFF,
+0x46,0x86,0x1E,0x18,0x7E,0x18,0x78,0x61,0xF8,0x61,0xE1,0x87,0xFF,0xE1,0xFE,0x00,
+0x70,0xFF,0xFE,0x18,0x7F,0xFF,0x0E,0x1F,0xFC,0x3C,0x00,0x78,0x7F,0xF0,0xF0,0xFF,
+0xC0,0x07,0xC0,0x00,0x3E,0x1F,0xFF,0xE0,0x00,0xFF,0xF0,0x3F,0xFF,0xF0,0xFF,0xFF,
+0xE1,0xFF,0xFC,0x38,0x61,0x86,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0x0F,0x81,
+0x80,0x00,0x0F,0xFF,0x07,0xFF,0xFE,0x0F,0xFD,0xFF,0x46,0x86,0x1E,0x18,0x7E,0x18,
+0x78,0x61,0xF8,0x61,0xE1,0x87,0xFF,0xE1,0xFE,0x00,0x70,0xFF,0xFE,0x18,0x7F,0xFF,
+0x0E,0x1F,0xFC,0x3C,0x00,0x78,0x7F,0xF0,0xF0,0xFF,0xFC,0x03,0xC0,0x01,0xFE,0x1F,
+0xFF,0xC0,0x00,0x7F,0xF8,0x7F,0xFF,0xF0,0xFF,0xFF,0xE1,0xFF,0xFC,0x38,0x61,0x86,
+0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0x0F,0x81,0x80,0x00,0x0F,0xFF,0x07,0xFF,
+0xFE,0x0F,0xFD,0xFF,0x46,0xC0,0x3E,0x10,0xFF,0x00,0xF8,0x43,0xFC,0x03,0xE1,0x0F,
+0xFF,0xE1,0xFF,0xF8,0x70,0xFF,0xFE,0x18,0x7F,0xFF,0x0E,0x1F,0xFC,0x3F,0xFF,0xF8,
+0x7F,0xF0,0xF0,0xFF,0xFF,0x03,0xC3,0xFF,0xFE,0x1F,0xFF,0xC0,0x00,0x7F,0xF8,0x7F,
+0xFF,0xF0,0xFF,0xFF,0xE1,0xFF,0xFC,0x38,0x60,0x06,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,
+0x1F,0x00,0xF0,0x7F,0xFF,0xFF,0xF0,0xFF,0x00,0x01,0xF0,0x0F,0xFD,0xFF,0x46,0xC0,
+0x3F,0x00,0xFF,0x00,0xFC,0x03,0xFC,0x03,0xF0,0x0F,0xFF,0xE0,0xFF,0xF8,0x70,0x7F,
+0xFC,0x18,0x3F,0xFE,0x0E,0x1F,0xF8,0x3F,0xFF,0xF8,0x7F,0xE0,0xF0,0xFF,0xFF,0xC3,
+0xC3,0xFF,0xFE,0x1F,0xFF,0x80,0x00,0x7F,0xF8,0x7F,0xFF,0xF0,0x7F,0xFF,0xE0,0xFF,
+0xF8,0x38,0x70,0x0E,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0xF0,0x7F,0xFF,0xFF,
+0xF0,0xFF,0x00,0x01,0xF0,0x0F,0xFD,0xFF,0x46,0xC0,0x3F,0x00,0xFF,0x00,0xFC,0x03,
+0xFC,0x03,0xF0,0x0F,0xFF,0xF0,0xFF,0xF8,0x78,0x7F,0xFC,0x3C,0x3F,0xFE,0x1E,0x1F,
+0xF8,0x7F,0xFF,0xF8,0x7F,0xE1,0xF0,0xF0,0xFF,0xC3,0xC3,0xFF,0xFE,0x1F,0xFF,0x87,
+0xF8,0x3F,0xF8,0x7F,0xFF,0xF0,0x7F,0xF0,0xF0,0xFF,0xF8,0x78,0x70,0x0E,0x1F,0xFF,
+0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0xF0,0x7F,0xFF,0xFF,0xF0,0xFF,0x00,0x01,0xF0,0x0F,
+0xFD,0xFF,0x46,0xC0,0x3F,0x00,0xFF,0x00,0xFC,0x03,0xFC,0x03,0xF0,0x0F,0xFF,0xF0,
+0x7F,0xF0,0x78,0x3F,0xF8,0x3C,0x1F,0xFC,0x1E,0x1F,0xF0,0x7F,0xFF,0xF8,0x7F,0xC1,
+0xF0,0xF0,0xFF,0xC3,0xC3,0xFF,0xFE,0x1F,0xFF,0x87,0xFC,0x3F,0xF8,0x7F,0xFF,0xF8,
+0x3F,0xF0,0xF0,0x7F,0xF0,0x78,0x70,0x0E,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,
+0xF0,0x7F,0xFF,0xFF,0xF0,0xFF,0x00,0x01,0xF0,0x0F,0xFD,0xFF,0x46,0xE0,0x7F,0x81,
+0xFF,0x81,0xFE,0x07,0xFE,0x07,0xF8,0x1F,0xE0,0xF0,0x3F,0xE0,0x78,0x1F,0xF0,0x3C,
+0x0F,0xF8,0x1E,0x1F,0xC0,0x7F,0xFF,0xF8,0x7F,0x01,0xF0,0xF0,0x7F,0x83,0xC3,0xFF,
+0xFE,0x1F,0xFF,0x07,0xFC,0x1F,0xF8,0x7F,0xF0,0x78,0x1F,0xE0,0xF0,0x3F,0xE0,0x78,
+0x78,0x1E,0x1F,0xFF,0xF0,0xF0,0xFF,0xF8,0x1F,0x00,0xF0,0x7F,0xFF,0xFF,0xF0,0xFF,
+0x00,0x01,0xF0,0x0F,0xFD,0xFF,0x46,0xE0,0x7F,0x81,0xFF,0x81,0xFE,0x07,0xFE,0x07,
+0xF8,0x1F,0xE0,0xF8,0x0F,0x80,0x7C,0x07,0xC0,0x7E,0x03,0xE0,0x3E,0x00,0x00,0xFF,
+0xFF,0xF8,0x00,0x03,0xF0,0xF8,0x1F,0x03,0xC3,0xFF,0xFE,0x00,0x03,0x0F,0xFE,0x1F,
+0xF8,0x7F,0xF0,0x7C,0x0F,0x81,0xF8,0x0F,0x80,0xF8,0x78,0x1E,0x1F,0xFF,0xF0,0xF0,
+0xFF,0xF8,0x1F,0x00,0xF0,0x7F,0xFF,0xFF,0xF0,0xFF,0x00,0x01,0xF0,0x0F,0xFD,0xFF,
+0x46,0xE0,0x7F,0x81,0xFF,0x81,0xFE,0x07,0xFE,0x07,0xF8,0x1F,0xE0,0xFC,0x00,0x00,
+0x7E,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x01,0xFF,0xFF,0xF8,0x00,0x07,0xF0,0xF8,
+0x00,0x07,0xC3,0xFF,0xFE,0x00,0x03,0x0F,0xFE,0x1F,0xF8,0x7F,0xF0,0x7C,0x00,0x01,
+0xFC,0x00,0x01,0xF8,0x78,0x1E,0x1F,0xFF,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0xFE,
+0x7E,0x00,0x0F,0x07,0xF8,0x7F,0xF0,0x0F,0xFD,0xFF,0x46,0xF0,0xFF,0xC3,0xFF,0xC3,
+0xFF,0x0F,0xFF,0x0F,0xFC,0x3F,0xE0,0xFE,0x00,0x00,0x7F,0x00,0x01,0xFF,0x80,0x00,
+0xFE,0x00,0x03,0xFF,0xFF,0xF8,0x00,0x0F,0xF0,0xFC,0x00,0x0F,0xC3,0xFF,0xFE,0x00,
+0x02,0x0F,0xFE,0x0F,0xF8,0x7F,0xF0,0x7E,0x00,0x03,0xFE,0x00,0x03,0xF8,0x7C,0x3E,
+0x1F,0xFF,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0xFE,0x7E,0x00,0x0F,0x07,0xF8,0x7F,
+0xF0,0x0F,0xFD,0xFF,0x46,0xF0,0xFF,0xC3,0xFF,0xC3,0xFF,0x0F,0xFF,0x0F,0xFC,0x3F,
+0xE0,0xFF,0x00,0x0C,0x7F,0x80,0x03,0xFF,0xC0,0x01,0xFE,0x00,0x1F,0xFF,0xFF,0xF8,
+0x00,0x7F,0xF0,0xFE,0x00,0x1F,0xC3,0xFF,0xFE,0x00,0x02,0x1F,0xFF,0x0F,0xF8,0x7F,
+0xF0,0x7F,0x80,0x07,0xFF,0x00,0x07,0xF8,0x7C,0x3E,0x1F,0xFF,0xF0,0xF0,0x00,0x00,
+0x1F,0x0F,0xFF,0xFE,0x7E,0x00,0x0F,0x07,0xF8,0x7F,0xF0,0x0F,0xF0,0xFF,0x07,0xC0,
+0x3F,0xFF,0xF0,0x1F,0xFF,0xF8,0x0F,0xF7,0xFF,0x01,0x80,0x7F,0xF5,0xFF,0x04,0xE0,
+0x1F,0xFF,0xE0,0x3F,0xFC,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,0xFF,0xFE,0x7E,
+0x00,0x0F,0x07,0xF8,0x7F,0xF0,0x0F,0xC6,0xFF,0x0F,0xF0,0xF0,0x00,0x00,0x1F,0x0F,
+0xFF,0xFE,0x7E,0x00,0x0F,0x07,0xF8,0x7F,0xF0,0x0F,0xC6,0xFF,0x00,0xF0,0xFD,0xFF,
+0x0A,0x0F,0x0F,0x81,0xFE,0x1F,0x0F,0x00,0x00,0x7F,0xFE,0x0F,0xC6,0xFF,0x00,0xF0,
+0xFD,0xFF,0x0A,0x0F,0x0F,0x81,0xFE,0x1F,0x0F,0x00,0x00,0x7F,0xFE,0x0F,0xC6,0xFF,
+0x00,0xF0,0xFD,0xFF,0x0A,0x0F,0x0F,0x81,0xFE,0x1F,0x0F,0x00,0x00,0x7F,0xFE,0x0F,
+0xC6,0xFF,0x00,0xF0,0xF3,0x00,0x00,0x0F,0xC6,0xFF,0x00,0xF0,0xF3,0x00,0x00,0x0F,
+0xC6,0xFF,0x00,0xF0,0xF3,0x00,0x00,0x0F,0xC6,0xFF,0x00,0xF0,0xF3,0x00,0x00,0x0F,
+0xC6,0xFF,0x00,0xF0,0xF3,0x00,0x00,0x0F,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,
+0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x81,0xFF,0x84,0xFF,
+};
+
+#endif
@@ -12,6 +12,7 @@
 // Library: https://github.com/ZinggJM/GxEPD
 
 #include "GxGDEW0583T7.h"
+#include "../GxIL0371.h"
 
 //#define DISABLE_DIAGNOSTIC_OUTPUT
 
@@ -26,47 +27,34 @@
 
 GxGDEW0583T7::GxGDEW0583T7(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW0583T7_WIDTH, GxGDEW0583T7_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDEW0583T7::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0583T7_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0583T7_WIDTH - x - 1;
-      y = GxGDEW0583T7_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0583T7_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0583T7_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW0583T7_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW0583T7_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW0583T7_WIDTH / 8;
-  }
+void GxGDEW0583T7::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEW0583T7::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW0583T7::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDEW0583T7::init(uint32_t serial_diag_bitrate)
@@ -84,6 +72,7 @@ void GxGDEW0583T7::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -91,28 +80,19 @@ void GxGDEW0583T7::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW0583T7::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW0583T7::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
-  {
-#if defined(ESP8266)
-    // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
-    // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
-    // if ((i % 10000) == 0) yield(); // avoid watchdog reset
-#endif
-    _send8pixel(i < sizeof(_buffer) ? _buffer[i] : 0x00);
-  }
+  IO.startTransaction();
+  GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, GxGDEW0583T7_BUFFER_SIZE);
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -127,26 +107,17 @@ void  GxGDEW0583T7::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 void GxGDEW0583T7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0583T7_WIDTH - 1, GxGDEW0583T7_HEIGHT - 1);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _send8pixel(data);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, 4 * GxGDEW0583T7_BUFFER_SIZE, false, 0x33); // controller format
+    else GxIL0371::writeBitmap(IO, bitmap, size, GxGDEW0583T7_BUFFER_SIZE, mode & bm_invert, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     IO.writeCommandTransaction(0x92); // partial out
@@ -156,25 +127,10 @@ void GxGDEW0583T7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
-    {
-#if defined(ESP8266)
-      // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
-      // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
-      // if ((i % 10000) == 0) yield(); // avoid watchdog reset
-#endif
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _send8pixel(data);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, 4 * GxGDEW0583T7_BUFFER_SIZE, false, 0x33); // controller format
+    else GxIL0371::writeBitmap(IO, bitmap, size, GxGDEW0583T7_BUFFER_SIZE, mode & bm_invert, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -184,6 +140,7 @@ void GxGDEW0583T7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
 void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
@@ -191,10 +148,9 @@ void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0583T7_WIDTH - 1, GxGDEW0583T7_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
-    {
-      _send8pixel(0x00);
-    }
+    IO.startTransaction();
+    GxIL0371::writeWhite(IO, GxGDEW0583T7_BUFFER_SIZE);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     IO.writeCommandTransaction(0x92); // partial out
@@ -204,10 +160,9 @@ void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
-    {
-      _send8pixel(0x00);
-    }
+    IO.startTransaction();
+    GxIL0371::writeWhite(IO, GxGDEW0583T7_BUFFER_SIZE);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -216,6 +171,7 @@ void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
 
 void GxGDEW0583T7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -250,14 +206,12 @@ void GxGDEW0583T7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-      _send8pixel((idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
-    }
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, y1 * (GxGDEW0583T7_WIDTH / 8) + xs_bx, xe_bx - xs_bx);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("updateWindow");
   IO.writeCommandTransaction(0x92); // partial out
@@ -266,6 +220,7 @@ void GxGDEW0583T7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW0583T7::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
@@ -315,19 +270,18 @@ void GxGDEW0583T7::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-      _send8pixel((idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
-    }
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, y1 * (GxGDEW0583T7_WIDTH / 8) + xss_d8, xse_d8 - xss_d8);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
 }
 
 void GxGDEW0583T7::powerDown()
 {
+  _finishAsync();
   _using_partial_mode = false; // force _wakeUp()
   _sleep();
 }
@@ -353,15 +307,9 @@ uint16_t GxGDEW0583T7::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 void GxGDEW0583T7::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
-  { //=0 BUSY
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 40000000)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+  if (!_waitBusy(_busy, LOW, 40000000)) //=0 BUSY
+  {
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -380,19 +328,18 @@ void GxGDEW0583T7::_waitWhileBusy(const char* comment)
 
 void GxGDEW0583T7::_send8pixel(uint8_t data)
 {
-  for (uint8_t j = 0; j < 8; j++)
-  {
-    uint8_t t = data & 0x80 ? 0x00 : 0x03;
-    t <<= 4;
-    data <<= 1;
-    j++;
-    t |= data & 0x80 ? 0x00 : 0x03;
-    data <<= 1;
-    IO.writeDataTransaction(t);
-  }
+  uint8_t out[4];
+  GxIL0371::expand(out, data);
+  IO.writeData(out, 4, false); // caller holds the transaction
 }
 
 void GxGDEW0583T7::_wakeUp()
+{
+  _startWakeUp();
+  _waitWhileBusy("Power On");
+}
+
+void GxGDEW0583T7::_startWakeUp()
 {
   if (_rst >= 0)
   {
@@ -430,10 +377,16 @@ void GxGDEW0583T7::_wakeUp()
   IO.writeCommandTransaction(0xe5); //FLASH MODE
   IO.writeDataTransaction(0x03);
   IO.writeCommandTransaction(0x04); //POWER ON
-  _waitWhileBusy("Power On");
 }
 
 void GxGDEW0583T7::_sleep(void)
+{
+  _startPowerOff();
+  _waitWhileBusy("Power Off");
+  _deepSleep();
+}
+
+void GxGDEW0583T7::_startPowerOff()
 {
   /**********************************flash sleep**********************************/
   IO.writeCommandTransaction(0X65); //FLASH CONTROL
@@ -443,7 +396,10 @@ void GxGDEW0583T7::_sleep(void)
   IO.writeDataTransaction(0x00);
   /**********************************flash sleep**********************************/
   IO.writeCommandTransaction(0x02); // POWER OFF
-  _waitWhileBusy("Power Off");
+}
+
+void GxGDEW0583T7::_deepSleep()
+{
   if (_rst >= 0)
   {
     IO.writeCommandTransaction(0x07); // DEEP SLEEP
@@ -451,30 +407,71 @@ void GxGDEW0583T7::_sleep(void)
   }
 }
 
+bool GxGDEW0583T7::isBusy()
+{
+  return (_busy >= 0) && (digitalRead(_busy) == 0); //=0 BUSY, no BUSY pin: never
+}
+
+#if GxEPD_ASYNC_UPDATE
+bool GxGDEW0583T7::_asyncPowerOn()
+{
+  if (_current_page != -1) return false;
+  _using_partial_mode = false;
+  _startWakeUp();
+  return true;
+}
+
+bool GxGDEW0583T7::_asyncTransfer()
+{
+  if (_async_index == 0) IO.writeCommandTransaction(0x10);
+  uint32_t end = _async_index + GxEPD_ASYNC_CHUNK;
+  if (end > GxGDEW0583T7_BUFFER_SIZE) end = GxGDEW0583T7_BUFFER_SIZE;
+  IO.startTransaction();
+  GxIL0371::writePixels(IO, _fb_black, _fb_size, _async_index, end - _async_index);
+  _async_index = end;
+  IO.endTransaction();
+  return _async_index < GxGDEW0583T7_BUFFER_SIZE;
+}
+
+void GxGDEW0583T7::_asyncRefresh()
+{
+  IO.writeCommandTransaction(0x12); //display refresh
+}
+
+void GxGDEW0583T7::_asyncPowerOff()
+{
+  _startPowerOff();
+}
+
+void GxGDEW0583T7::_asyncSleep()
+{
+  _deepSleep();
+}
+#endif
+
 void GxGDEW0583T7::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -483,27 +480,26 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(void))
 void GxGDEW0583T7::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -512,27 +508,26 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW0583T7::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -541,27 +536,26 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW0583T7::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -591,6 +585,7 @@ void GxGDEW0583T7::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -598,19 +593,23 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0583T7_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0583T7_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
@@ -619,6 +618,7 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
 void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -626,19 +626,23 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0583T7_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0583T7_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
@@ -647,6 +651,7 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
 void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -654,19 +659,23 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0583T7_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0583T7_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
@@ -675,6 +684,7 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
 void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -682,19 +692,23 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW0583T7_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW0583T7_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
@@ -704,6 +718,7 @@ void GxGDEW0583T7::drawCornerTest(uint8_t em)
 {
   _wakeUp();
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW0583T7_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW0583T7_WIDTH / 8; x++)
@@ -716,6 +731,7 @@ void GxGDEW0583T7::drawCornerTest(uint8_t em)
       _send8pixel(~data);
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
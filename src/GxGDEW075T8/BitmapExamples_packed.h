@@ -0,0 +1,908 @@
+// BitmapExamples_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from BitmapExamples.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _BitmapExamples_packed_H_
+#define _BitmapExamples_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// BitmapExample1 : 30720 bytes, packed 6296
+#if defined(__AVR)
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0xA0,0x34,0x00,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xFE,0x00,0x02,0x01,0xFF,0xF8,0xB4,0x00,
+0x03,0x1F,0xFF,0xFF,0x80,0xB5,0x00,0xFE,0xFF,0x00,0xE0,0xB6,0x00,0x00,0x03,0xFE,
+0xFF,0x00,0xF8,0xB6,0x00,0x00,0x07,0xFE,0xFF,0x00,0xFE,0xB6,0x00,0x00,0x0F,0xFD,
+0xFF,0xB6,0x00,0x04,0x0F,0xFF,0x00,0x0F,0xFF,0xB6,0x00,0x04,0x0F,0xF0,0x00,0x01,
+0xFF,0xB6,0x00,0x04,0x0F,0xC0,0x3F,0xC0,0x3F,0xB6,0x00,0x04,0x03,0x03,0xFF,0xFC,
+0x0E,0xB5,0x00,0x03,0x0F,0xFF,0xFF,0x80,0xB5,0x00,0x03,0x3F,0xFF,0xFF,0xC0,0xB5,
+0x00,0x03,0x7F,0xFF,0xFF,0xE0,0xB5,0x00,0x03,0x7F,0x80,0x1F,0xE0,0xB5,0x00,0x03,
+0x7C,0x00,0x03,0xE0,0xB4,0x00,0x02,0x7F,0xE0,0xC0,0xB5,0x00,0x02,0x01,0xFF,0xFC,
+0xB4,0x00,0x02,0x07,0xFF,0xFE,0xB4,0x00,0x02,0x07,0xFF,0xFF,0xB4,0x00,0x02,0x07,
+0x80,0x1F,0x81,0x00,0xE1,0x00,0x02,0x01,0xFF,0xF0,0xFC,0x00,0x00,0x60,0xFA,0x00,
+0x00,0x18,0xC4,0x00,0x04,0x1F,0x00,0x1F,0xFF,0xFC,0xFC,0x00,0x00,0x78,0xFA,0x00,
+0x00,0x1E,0xC4,0x00,0x04,0x3F,0x80,0x7F,0xFF,0xFE,0xFC,0x00,0x00,0x7C,0xFA,0x00,
+0x00,0x1F,0xC4,0x00,0x04,0x3F,0xC0,0xFF,0xFF,0xFE,0xFC,0x00,0x00,0x7E,0xFA,0x00,
+0x01,0x1F,0x80,0xC5,0x00,0x04,0x3F,0xC1,0xFF,0xFF,0xFE,0xFC,0x00,0x00,0x7E,0xFA,
+0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x3F,0xC3,0xFF,0xFF,0xFE,0xFC,0x00,0x00,0x7E,
+0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x02,0x3F,0xC3,0xFE,0xFA,0x00,0x00,0x7E,0xFA,
+0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x3F,0xC7,0xF8,0x00,0xFE,0xFC,0x00,0x00,0x7E,
+0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x10,0x87,0xF0,0x00,0xFE,0xFC,0x00,0x00,
+0x7E,0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x0F,0x07,0xF0,0x00,0xFE,0xFC,0x00,
+0x00,0x7E,0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x1F,0x87,0xF0,0x00,0xFE,0xFC,
+0x00,0x00,0x7E,0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,
+0x00,0x00,0x0F,0xC0,0x00,0x7E,0x03,0xE0,0x00,0x00,0x03,0xF8,0x00,0x1F,0x80,0xC5,
+0x00,0x13,0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x00,0xFF,0xFC,0x00,0x7E,0x3F,0xFE,0x00,
+0x00,0x1F,0xFF,0x00,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x03,
+0xFF,0xFF,0x00,0x7E,0x7F,0xFF,0x80,0x00,0x7F,0xFF,0xC0,0x1F,0x80,0xC5,0x00,0x13,
+0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x07,0xFF,0xFF,0xC0,0x7E,0x7F,0xFF,0xE0,0x01,0xFF,
+0xFF,0xF0,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x0F,0xFF,0xFF,
+0xE0,0x7E,0x7F,0xFF,0xF0,0x03,0xFF,0xFF,0xF8,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,
+0xFF,0xFE,0xFE,0x00,0x1F,0xFF,0xFF,0xF0,0x7E,0x7F,0xFF,0xF8,0x07,0xFF,0xFF,0xFC,
+0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xFF,0xFC,0xFE,0x00,0x3F,0xE0,0x1F,0xF8,0x7E,
+0x70,0x0F,0xFC,0x0F,0xFC,0x07,0xFE,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,
+0xFE,0x00,0x7F,0xC0,0x07,0xF8,0x7E,0x00,0x03,0xFC,0x1F,0xF0,0x01,0xFF,0x1F,0x80,
+0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0x7F,0x00,0x03,0xFC,0x7E,0x00,0x01,
+0xFE,0x1F,0xE0,0x07,0xFF,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,
+0xFF,0x00,0x01,0xFC,0x7E,0x00,0x00,0xFE,0x3F,0xC0,0x1F,0xFF,0x1F,0x80,0xC5,0x00,
+0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFE,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x3F,
+0x80,0x7F,0xF8,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFE,0x00,
+0x00,0xFE,0x7E,0x00,0x00,0x7F,0x3F,0x81,0xFF,0xE0,0x1F,0x80,0xC5,0x00,0x13,0x3F,
+0xC7,0xF0,0x00,0xFE,0x00,0xFC,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x3F,0x07,0xFF,
+0x80,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFC,0x00,0x00,0xFE,
+0x7E,0x00,0x00,0x7F,0x7F,0x07,0xFE,0x00,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,
+0x00,0xFE,0x00,0xFC,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x7F,0x07,0xF8,0x00,0x1F,
+0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFE,0x00,0x00,0xFE,0x7E,0x00,
+0x00,0x7F,0x3F,0x83,0xE0,0x00,0x9F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,
+0x00,0xFE,0x00,0x00,0xFE,0x7F,0x00,0x00,0x7F,0x3F,0x81,0x80,0x3F,0x9F,0x80,0xC5,
+0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFF,0x00,0xFE,0x00,0x00,0xFE,0x7F,0x00,0x00,0x7F,
+0x3F,0x80,0x00,0x7F,0x9F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x7F,0x00,0xFF,
+0x00,0x00,0xFE,0x7F,0x80,0x00,0xFE,0x3F,0xC0,0x00,0x7F,0x1F,0x80,0xC5,0x00,0x13,
+0x3F,0xC7,0xF0,0x00,0x7F,0x80,0x7F,0x80,0x00,0xFE,0x3F,0x80,0x01,0xFE,0x1F,0xE0,
+0x00,0xFF,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x7F,0xE0,0x7F,0xC0,0x02,
+0xFE,0x3F,0xE0,0x03,0xFC,0x1F,0xF0,0x01,0xFE,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,
+0xF0,0x00,0x3F,0xFF,0xBF,0xF0,0x1E,0xFE,0x1F,0xF8,0x0F,0xFC,0x0F,0xFC,0x0F,0xFE,
+0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x1F,0xFF,0xDF,0xFF,0xFE,0xFE,0x0F,
+0xFF,0xFF,0xF8,0x07,0xFF,0xFF,0xFC,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,
+0x0F,0xFF,0xEF,0xFF,0xFE,0xFE,0x07,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0xF8,0x1F,0x80,
+0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x07,0xFF,0xF7,0xFF,0xFE,0xFE,0x03,0xFF,0xFF,
+0xE0,0x01,0xFF,0xFF,0xF0,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x01,0xFF,
+0xFD,0xFF,0xFE,0xFE,0x00,0xFF,0xFF,0x80,0x00,0x7F,0xFF,0xC0,0x1F,0x80,0xC5,0x00,
+0x13,0x3F,0xC7,0xF0,0x00,0x00,0x3F,0xFE,0x7F,0xFC,0xFE,0x00,0x3F,0xFE,0x00,0x00,
+0x1F,0xFF,0x00,0x1F,0x80,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xE6,0x00,0xD9,
+0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,
+0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,
+0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,
+0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,
+0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,
+0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,
+0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x03,0xFC,0x00,
+0x00,0x1F,0xE1,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x00,0x80,0xFE,0x00,0xE1,0xFF,
+0x00,0x80,0xDA,0x00,0xFE,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x1F,0xE2,0xFF,0x00,0x80,
+0xDA,0x00,0xFE,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x07,0xE2,0xFF,0x00,0x80,0xDA,0x00,
+0xFE,0xFF,0x00,0x80,0xFC,0x00,0xE2,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xFE,
+0xFB,0x00,0x00,0x3F,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xF8,0xFB,0x00,
+0x00,0x0F,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xF0,0xFB,0x00,0x00,0x07,
+0xE3,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xE0,0xFB,0x00,0x00,0x03,0xE3,0xFF,
+0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xE0,0x00,0x00,0xFF,0xFF,0x80,0x00,0x03,0xE3,
+0xFF,0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xE0,0x00,0x0F,0xFF,0xFF,0xF8,0x00,0x01,
+0xE3,0xFF,0x00,0x80,0xDA,0x00,0x04,0xFF,0xFF,0xE0,0x00,0x7F,0xFE,0xFF,0x01,0x00,
+0x01,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x03,0xFF,0xFF,0xE0,0x03,0xFD,0xFF,0x01,0xE0,
+0x01,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xF0,0x0F,0xFF,0xFC,0x1F,0xFF,
+0xF8,0x03,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xF8,0x3F,0xFE,0x00,0x00,
+0x3F,0xFE,0x07,0xE3,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x05,0xF0,0x00,0x00,0x03,
+0xFF,0xDF,0xE3,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x00,0x80,0xFE,0x00,0xE1,0xFF,
+0x00,0x80,0xDA,0x00,0xFE,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x1F,0xE2,0xFF,0x00,0x80,
+0xDA,0x00,0xFE,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x0F,0xFD,0xFF,
+};
+#else
+const unsigned char BitmapExample1_packed[] PROGMEM =
+{
+0x00,0x78,0x00,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xFE,0x00,0x02,0x01,0xFF,0xF8,0xB4,0x00,
+0x03,0x1F,0xFF,0xFF,0x80,0xB5,0x00,0xFE,0xFF,0x00,0xE0,0xB6,0x00,0x00,0x03,0xFE,
+0xFF,0x00,0xF8,0xB6,0x00,0x00,0x07,0xFE,0xFF,0x00,0xFE,0xB6,0x00,0x00,0x0F,0xFD,
+0xFF,0xB6,0x00,0x04,0x0F,0xFF,0x00,0x0F,0xFF,0xB6,0x00,0x04,0x0F,0xF0,0x00,0x01,
+0xFF,0xB6,0x00,0x04,0x0F,0xC0,0x3F,0xC0,0x3F,0xB6,0x00,0x04,0x03,0x03,0xFF,0xFC,
+0x0E,0xB5,0x00,0x03,0x0F,0xFF,0xFF,0x80,0xB5,0x00,0x03,0x3F,0xFF,0xFF,0xC0,0xB5,
+0x00,0x03,0x7F,0xFF,0xFF,0xE0,0xB5,0x00,0x03,0x7F,0x80,0x1F,0xE0,0xB5,0x00,0x03,
+0x7C,0x00,0x03,0xE0,0xB4,0x00,0x02,0x7F,0xE0,0xC0,0xB5,0x00,0x02,0x01,0xFF,0xFC,
+0xB4,0x00,0x02,0x07,0xFF,0xFE,0xB4,0x00,0x02,0x07,0xFF,0xFF,0xB4,0x00,0x02,0x07,
+0x80,0x1F,0x81,0x00,0xE1,0x00,0x02,0x01,0xFF,0xF0,0xFC,0x00,0x00,0x60,0xFA,0x00,
+0x00,0x18,0xC4,0x00,0x04,0x1F,0x00,0x1F,0xFF,0xFC,0xFC,0x00,0x00,0x78,0xFA,0x00,
+0x00,0x1E,0xC4,0x00,0x04,0x3F,0x80,0x7F,0xFF,0xFE,0xFC,0x00,0x00,0x7C,0xFA,0x00,
+0x00,0x1F,0xC4,0x00,0x04,0x3F,0xC0,0xFF,0xFF,0xFE,0xFC,0x00,0x00,0x7E,0xFA,0x00,
+0x01,0x1F,0x80,0xC5,0x00,0x04,0x3F,0xC1,0xFF,0xFF,0xFE,0xFC,0x00,0x00,0x7E,0xFA,
+0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x3F,0xC3,0xFF,0xFF,0xFE,0xFC,0x00,0x00,0x7E,
+0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x02,0x3F,0xC3,0xFE,0xFA,0x00,0x00,0x7E,0xFA,
+0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x3F,0xC7,0xF8,0x00,0xFE,0xFC,0x00,0x00,0x7E,
+0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x10,0x87,0xF0,0x00,0xFE,0xFC,0x00,0x00,
+0x7E,0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x0F,0x07,0xF0,0x00,0xFE,0xFC,0x00,
+0x00,0x7E,0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x04,0x1F,0x87,0xF0,0x00,0xFE,0xFC,
+0x00,0x00,0x7E,0xFA,0x00,0x01,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,
+0x00,0x00,0x0F,0xC0,0x00,0x7E,0x03,0xE0,0x00,0x00,0x03,0xF8,0x00,0x1F,0x80,0xC5,
+0x00,0x13,0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x00,0xFF,0xFC,0x00,0x7E,0x3F,0xFE,0x00,
+0x00,0x1F,0xFF,0x00,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x03,
+0xFF,0xFF,0x00,0x7E,0x7F,0xFF,0x80,0x00,0x7F,0xFF,0xC0,0x1F,0x80,0xC5,0x00,0x13,
+0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x07,0xFF,0xFF,0xC0,0x7E,0x7F,0xFF,0xE0,0x01,0xFF,
+0xFF,0xF0,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xFF,0xFE,0xFE,0x00,0x0F,0xFF,0xFF,
+0xE0,0x7E,0x7F,0xFF,0xF0,0x03,0xFF,0xFF,0xF8,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,
+0xFF,0xFE,0xFE,0x00,0x1F,0xFF,0xFF,0xF0,0x7E,0x7F,0xFF,0xF8,0x07,0xFF,0xFF,0xFC,
+0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xFF,0xFC,0xFE,0x00,0x3F,0xE0,0x1F,0xF8,0x7E,
+0x70,0x0F,0xFC,0x0F,0xFC,0x07,0xFE,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,
+0xFE,0x00,0x7F,0xC0,0x07,0xF8,0x7E,0x00,0x03,0xFC,0x1F,0xF0,0x01,0xFF,0x1F,0x80,
+0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0x7F,0x00,0x03,0xFC,0x7E,0x00,0x01,
+0xFE,0x1F,0xE0,0x07,0xFF,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,
+0xFF,0x00,0x01,0xFC,0x7E,0x00,0x00,0xFE,0x3F,0xC0,0x1F,0xFF,0x1F,0x80,0xC5,0x00,
+0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFE,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x3F,
+0x80,0x7F,0xF8,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFE,0x00,
+0x00,0xFE,0x7E,0x00,0x00,0x7F,0x3F,0x81,0xFF,0xE0,0x1F,0x80,0xC5,0x00,0x13,0x3F,
+0xC7,0xF0,0x00,0xFE,0x00,0xFC,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x3F,0x07,0xFF,
+0x80,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFC,0x00,0x00,0xFE,
+0x7E,0x00,0x00,0x7F,0x7F,0x07,0xFE,0x00,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,
+0x00,0xFE,0x00,0xFC,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x7F,0x07,0xF8,0x00,0x1F,
+0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,0x00,0xFE,0x00,0x00,0xFE,0x7E,0x00,
+0x00,0x7F,0x3F,0x83,0xE0,0x00,0x9F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFE,
+0x00,0xFE,0x00,0x00,0xFE,0x7F,0x00,0x00,0x7F,0x3F,0x81,0x80,0x3F,0x9F,0x80,0xC5,
+0x00,0x13,0x3F,0xC7,0xF0,0x00,0xFF,0x00,0xFE,0x00,0x00,0xFE,0x7F,0x00,0x00,0x7F,
+0x3F,0x80,0x00,0x7F,0x9F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x7F,0x00,0xFF,
+0x00,0x00,0xFE,0x7F,0x80,0x00,0xFE,0x3F,0xC0,0x00,0x7F,0x1F,0x80,0xC5,0x00,0x13,
+0x3F,0xC7,0xF0,0x00,0x7F,0x80,0x7F,0x80,0x00,0xFE,0x3F,0x80,0x01,0xFE,0x1F,0xE0,
+0x00,0xFF,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x7F,0xE0,0x7F,0xC0,0x02,
+0xFE,0x3F,0xE0,0x03,0xFC,0x1F,0xF0,0x01,0xFE,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,
+0xF0,0x00,0x3F,0xFF,0xBF,0xF0,0x1E,0xFE,0x1F,0xF8,0x0F,0xFC,0x0F,0xFC,0x0F,0xFE,
+0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x1F,0xFF,0xDF,0xFF,0xFE,0xFE,0x0F,
+0xFF,0xFF,0xF8,0x07,0xFF,0xFF,0xFC,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,
+0x0F,0xFF,0xEF,0xFF,0xFE,0xFE,0x07,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0xF8,0x1F,0x80,
+0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x07,0xFF,0xF7,0xFF,0xFE,0xFE,0x03,0xFF,0xFF,
+0xE0,0x01,0xFF,0xFF,0xF0,0x1F,0x80,0xC5,0x00,0x13,0x3F,0xC7,0xF0,0x00,0x01,0xFF,
+0xFD,0xFF,0xFE,0xFE,0x00,0xFF,0xFF,0x80,0x00,0x7F,0xFF,0xC0,0x1F,0x80,0xC5,0x00,
+0x13,0x3F,0xC7,0xF0,0x00,0x00,0x3F,0xFE,0x7F,0xFC,0xFE,0x00,0x3F,0xFE,0x00,0x00,
+0x1F,0xFF,0x00,0x1F,0x80,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xE6,0x00,0xD9,
+0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,
+0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,
+0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,
+0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,
+0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,
+0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,
+0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x03,0xFC,0x00,
+0x00,0x1F,0xE1,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x00,0x80,0xFE,0x00,0xE1,0xFF,
+0x00,0x80,0xDA,0x00,0xFE,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x1F,0xE2,0xFF,0x00,0x80,
+0xDA,0x00,0xFE,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x07,0xE2,0xFF,0x00,0x80,0xDA,0x00,
+0xFE,0xFF,0x00,0x80,0xFC,0x00,0xE2,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xFE,
+0xFB,0x00,0x00,0x3F,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xF8,0xFB,0x00,
+0x00,0x0F,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xF0,0xFB,0x00,0x00,0x07,
+0xE3,0xFF,0x00,0x80,0xDA,0x00,0x02,0xFF,0xFF,0xE0,0xFB,0x00,0x00,0x03,0xE3,0xFF,
+0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xE0,0x00,0x00,0xFF,0xFF,0x80,0x00,0x03,0xE3,
+0xFF,0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xE0,0x00,0x0F,0xFF,0xFF,0xF8,0x00,0x01,
+0xE3,0xFF,0x00,0x80,0xDA,0x00,0x04,0xFF,0xFF,0xE0,0x00,0x7F,0xFE,0xFF,0x01,0x00,
+0x01,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x03,0xFF,0xFF,0xE0,0x03,0xFD,0xFF,0x01,0xE0,
+0x01,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xF0,0x0F,0xFF,0xFC,0x1F,0xFF,
+0xF8,0x03,0xE3,0xFF,0x00,0x80,0xDA,0x00,0x09,0xFF,0xFF,0xF8,0x3F,0xFE,0x00,0x00,
+0x3F,0xFE,0x07,0xE3,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x05,0xF0,0x00,0x00,0x03,
+0xFF,0xDF,0xE3,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x00,0x80,0xFE,0x00,0xE1,0xFF,
+0x00,0x80,0xDA,0x00,0xFE,0xFF,0x00,0xFE,0xFD,0x00,0x00,0x1F,0xE2,0xFF,0x00,0x80,
+0xDA,0x00,0xFE,0xFF,0x00,0xF8,0xFD,0x00,0x00,0x0F,0xE2,0xFF,0x00,0x80,0xDA,0x00,
+0xFE,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x03,0xE2,0xFF,0x00,0x80,0xDA,0x00,0xFE,0xFF,
+0x05,0xF0,0x00,0x03,0xF0,0x00,0x03,0xE2,0xFF,0x00,0x80,0xDA,0x00,0xFE,0xFF,0x05,
+0xF0,0x00,0xFF,0xFF,0x80,0x03,0xE2,0xFF,0x00,0x80,0xDA,0x00,0xFE,0xFF,0x05,0xF0,
+0x07,0xFF,0xFF,0xF8,0x03,0xE2,0xFF,0x00,0x80,0xDA,0x00,0xFE,0xFF,0x05,0xF0,0x1F,
+0xFF,0xFF,0xFE,0x03,0xE2,0xFF,0x00,0x80,0xDA,0x00,0xFE,0xFF,0x01,0xFC,0x7F,0xFE,
+0xFF,0x00,0x87,0xE2,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x01,0xC0,0x00,0xE0,0xFF,
+0x00,0x80,0xDA,0x00,0xFD,0xFF,0x03,0xFE,0x00,0x00,0x1F,0xE1,0xFF,0x00,0x80,0xDA,
+0x00,0xFD,0xFF,0x03,0xF0,0x00,0x00,0x07,0xE1,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,
+0x03,0xE0,0x00,0x00,0x01,0xE1,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x00,0xC0,0xFE,
+0x00,0xE1,0xFF,0x00,0x80,0xDA,0x00,0xFD,0xFF,0x03,0xC0,0x0F,0xFC,0x00,0xE1,0xFF,
+0x00,0x80,0xDA,0x00,0xFD,0xFF,0x03,0xC0,0x7F,0xFF,0x80,0xE1,0xFF,0x00,0x80,0xDA,
+0x00,0xFD,0xFF,0x03,0xE3,0xFF,0xFF,0xF0,0xE1,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,
+0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,
+0xFC,0xFF,0x07,0xFE,0x1F,0xFF,0xFF,0xC0,0x00,0x00,0x07,0xF9,0xFF,0x01,0xFC,0x1F,
+0xF5,0xFF,0x01,0xF8,0x3F,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xF8,0x07,
+0xFF,0xFC,0xFE,0x00,0x00,0x03,0xF9,0xFF,0x01,0xFC,0x07,0xF5,0xFF,0x01,0xF8,0x0F,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xE0,0x03,0xFF,0xF0,0xFE,0x00,0x00,
+0x01,0xF9,0xFF,0x01,0xFC,0x03,0xF5,0xFF,0x01,0xF8,0x07,0xFE,0xFF,0x00,0x80,0xDA,
+0x00,0xFC,0xFF,0x03,0xE0,0x01,0xFF,0xE0,0xFE,0x00,0x00,0x01,0xF9,0xFF,0x01,0xFC,
+0x01,0xF5,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xC0,
+0x01,0xFF,0xC0,0xFD,0x00,0xF9,0xFF,0x01,0xFC,0x01,0xF5,0xFF,0x01,0xF8,0x03,0xFE,
+0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xC0,0x01,0xFF,0x80,0xFD,0x00,0xF9,0xFF,
+0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x02,0xC0,0x00,0xFF,0xFC,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xC0,0x00,0xFE,0xFC,0x00,0xF9,0xFF,
+0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x04,0xC0,0x01,0xFE,0x00,0x03,0xF6,0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x04,0xC0,0x01,0xFC,0x00,0x1F,0xF6,0xFF,
+0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x07,0xE0,0x01,0xFC,0x00,0x3F,0xFF,0xF8,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,
+0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x07,0xE0,0x83,0xFC,0x00,
+0x7F,0xFF,0xF8,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,
+0x00,0x80,0xDA,0x00,0xFC,0xFF,0x07,0xF3,0xF7,0xF8,0x00,0xFF,0xFF,0xF8,0x00,0xF9,
+0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFA,
+0xFF,0x05,0xF8,0x00,0xFF,0xFF,0xF8,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,
+0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x07,0xFE,0x3F,0xF8,0x00,0xFF,
+0xFF,0xF8,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,0x00,
+0x80,0xDA,0x00,0xFC,0xFF,0x07,0xF8,0x0F,0xF8,0x00,0xFF,0xFF,0xF8,0x00,0xF9,0xFF,
+0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x07,0xF0,0x07,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,
+0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x07,0xE0,0x03,0xF8,0x01,
+0xFF,0xFF,0xF8,0x00,0xF9,0xFF,0x01,0xFC,0x00,0xF5,0xFF,0x01,0xF8,0x01,0xFE,0xFF,
+0x00,0x80,0xDA,0x00,0xFC,0xFF,0x07,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFD,
+0xFF,0x08,0xC0,0x01,0xFF,0xFF,0xFC,0x00,0xFF,0xE0,0x03,0xFC,0xFF,0x05,0x80,0x03,
+0xFF,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,
+0xFE,0x00,0x01,0x78,0x00,0xFE,0xFF,0x0A,0xFC,0x00,0x00,0x1F,0xFF,0xFC,0x00,0xFC,
+0x00,0x00,0x3F,0xFE,0xFF,0x06,0xF8,0x00,0x00,0x7F,0xFF,0xF8,0x01,0xFE,0xFF,0x00,
+0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,0xFE,0x00,0x01,0x78,0x00,0xFE,0xFF,
+0x0A,0xF0,0x00,0x00,0x07,0xFF,0xFC,0x00,0xF0,0x00,0x00,0x0F,0xFE,0xFF,0x06,0xE0,
+0x00,0x00,0x0F,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,
+0x03,0xF8,0xFE,0x00,0x01,0x78,0x00,0xFE,0xFF,0x0A,0xC0,0x00,0x00,0x01,0xFF,0xFC,
+0x00,0xF0,0x00,0x00,0x03,0xFE,0xFF,0x06,0x80,0x00,0x00,0x03,0xFF,0xF8,0x01,0xFE,
+0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,0xFE,0x00,0x01,0x78,0x00,
+0xFE,0xFF,0xFD,0x00,0x03,0x7F,0xFC,0x00,0xF0,0xFE,0x00,0x02,0xFF,0xFF,0xFE,0xFE,
+0x00,0x03,0x01,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,
+0x03,0xF8,0xFE,0x00,0x04,0x78,0x00,0xFF,0xFF,0xFE,0xFD,0x00,0x03,0x3F,0xFC,0x00,
+0xF0,0xFE,0x00,0x02,0x7F,0xFF,0xFC,0xFD,0x00,0x02,0x7F,0xF8,0x01,0xFE,0xFF,0x00,
+0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,0xFE,0x00,0x04,0x78,0x00,0xFF,0xFF,
+0xFC,0xFD,0x00,0x03,0x0F,0xFC,0x00,0xF0,0xFE,0x00,0x02,0x1F,0xFF,0xF8,0xFD,0x00,
+0x02,0x3F,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,
+0xFE,0x00,0x04,0x78,0x00,0xFF,0xFF,0xF8,0xFD,0x00,0x03,0x07,0xFC,0x00,0xF0,0xFE,
+0x00,0x02,0x0F,0xFF,0xF0,0xFD,0x00,0x02,0x1F,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,
+0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,0xFE,0x00,0x19,0x78,0x00,0xFF,0xFF,0xF0,0x00,
+0x03,0xF0,0x00,0x03,0xFC,0x00,0xF0,0x03,0xC0,0x00,0x07,0xFF,0xE0,0x00,0x0F,0xC0,
+0x00,0x0F,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x02,0xE0,0x03,0xF8,
+0xFE,0x00,0x19,0x78,0x00,0xFF,0xFF,0xE0,0x00,0x3F,0xFF,0x00,0x03,0xFC,0x00,0xF0,
+0x7F,0xFC,0x00,0x03,0xFF,0xC0,0x00,0x7F,0xFC,0x00,0x07,0xF8,0x01,0xFE,0xFF,0x00,
+0x80,0xDA,0x00,0xFC,0xFF,0x1F,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFF,
+0xC0,0x00,0xFF,0xFF,0xC0,0x01,0xFC,0x00,0xF3,0xFF,0xFF,0x80,0x03,0xFF,0x80,0x01,
+0xFF,0xFF,0x00,0x03,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x11,0xE0,
+0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFF,0xC0,0x03,0xFF,0xFF,0xE0,0x00,0xFC,
+0x00,0xFE,0xFF,0x0A,0xC0,0x01,0xFF,0x00,0x07,0xFF,0xFF,0x80,0x03,0xF8,0x01,0xFE,
+0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x11,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0x80,0x07,0xFF,0xFF,0xF0,0x00,0xFC,0x00,0xFE,0xFF,0x0A,0xE0,0x00,0xFF,
+0x00,0x0F,0xFF,0xFF,0x00,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x11,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFF,0x80,0x0F,0xFF,0xFF,0xF8,
+0x00,0x7C,0x00,0xFE,0xFF,0x0A,0xF0,0x00,0xFE,0x00,0x1F,0xFF,0xFC,0x00,0x00,0xF8,
+0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x11,0xE0,0x03,0xF8,0x01,0xFF,0xFF,
+0xF8,0x00,0xFF,0xFF,0x00,0x1F,0xFF,0xFF,0xFC,0x00,0x7C,0x00,0xFE,0xFF,0x0A,0xF8,
+0x00,0x7E,0x00,0x3F,0xFF,0xE0,0x00,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,
+0xFC,0xFF,0x11,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFF,0x00,0x1F,0xFF,
+0xFF,0xFE,0x00,0x3C,0x00,0xFE,0xFF,0x0A,0xFC,0x00,0x7C,0x00,0x7F,0xFF,0x80,0x00,
+0x07,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x11,0xE0,0x03,0xF8,0x01,
+0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x3F,0xFF,0xFF,0xFE,0x00,0x3C,0x00,0xFE,0xFF,
+0x0A,0xFC,0x00,0x7C,0x00,0x7F,0xFE,0x00,0x00,0x3F,0xF8,0x01,0xFE,0xFF,0x00,0x80,
+0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,
+0x3F,0xFE,0xFF,0x02,0x00,0x3C,0x00,0xFE,0xFF,0x0A,0xFE,0x00,0x3C,0x00,0x7F,0xF8,
+0x00,0x00,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,
+0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x3F,0xFE,0xFF,0x02,0x00,0x3C,0x00,
+0xFE,0xFF,0x0A,0xFE,0x00,0x38,0x00,0xFF,0xE0,0x00,0x03,0xFF,0xF8,0x01,0xFE,0xFF,
+0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,
+0xFE,0x00,0x7F,0xFE,0xFF,0x02,0x00,0x1C,0x00,0xFE,0xFF,0x0A,0xFE,0x00,0x38,0x00,
+0xFF,0x80,0x00,0x0F,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,
+0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,0x02,0x00,
+0x1C,0x00,0xFE,0xFF,0x0A,0xFE,0x00,0x38,0x00,0xFF,0x00,0x00,0x3F,0xFF,0xF8,0x01,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,
+0x00,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,0x02,0x00,0x1C,0x00,0xFD,0xFF,0x09,0x00,0x38,
+0x00,0xFF,0x00,0x00,0xFF,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,0x02,
+0x00,0x1C,0x00,0xFD,0xFF,0x09,0x00,0x38,0x00,0xFF,0x00,0x03,0xFF,0xFF,0xF8,0x01,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,
+0x00,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,0x02,0x00,0x1C,0x00,0xFD,0xFF,0x09,0x00,0x38,
+0x00,0xFF,0x80,0x1F,0xFF,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,
+0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x7F,0xFE,0xFF,0x02,
+0x00,0x1C,0x00,0xFE,0xFF,0x0A,0xFE,0x00,0x38,0x00,0xFF,0x80,0x7F,0xFF,0xFF,0xF8,
+0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,
+0xF8,0x00,0xFF,0xFE,0x00,0x3F,0xFE,0xFF,0x10,0x00,0x1C,0x00,0x7F,0xFF,0xFF,0xFE,
+0x00,0x38,0x00,0xFF,0xC1,0xFF,0xFE,0x00,0x78,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,
+0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x3F,0xFE,
+0xFF,0x10,0x00,0x1C,0x00,0x7F,0xFF,0xFF,0xFE,0x00,0x38,0x00,0xFF,0xE7,0xFF,0xFC,
+0x00,0x78,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,
+0xFF,0xFF,0xF8,0x00,0xFF,0xFE,0x00,0x3F,0xFE,0xFF,0x10,0x00,0x1E,0x00,0x7F,0xFF,
+0xFF,0xFE,0x00,0x3C,0x00,0x7F,0xFF,0xFF,0xFC,0x00,0x78,0x01,0xFE,0xFF,0x00,0x80,
+0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xF8,0x00,0x7F,0xFF,0x00,
+0x1F,0xFE,0xFF,0x10,0x00,0x1E,0x00,0x3F,0xFF,0xFF,0xFC,0x00,0x7C,0x00,0x7F,0xFF,
+0xFF,0xF8,0x00,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,
+0xF8,0x01,0xFF,0xFF,0xFC,0x00,0x7F,0xFF,0x00,0x1F,0xFE,0xFF,0x10,0x00,0x1E,0x00,
+0x3F,0xFF,0xFF,0xFC,0x00,0x7C,0x00,0x3F,0xFF,0xFF,0xF8,0x00,0xF8,0x01,0xFE,0xFF,
+0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xFC,0x00,0x3F,
+0xFF,0x00,0x0F,0xFE,0xFF,0x10,0x00,0x1F,0x00,0x1F,0xFF,0xFF,0xF8,0x00,0x7E,0x00,
+0x1F,0xFF,0xFF,0xF0,0x00,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,
+0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xFC,0x00,0x1F,0xFF,0x80,0x07,0xFE,0xFF,0x10,0x00,
+0x1F,0x00,0x0F,0xFF,0xFF,0xF0,0x00,0xFE,0x00,0x0F,0xFF,0xFF,0xE0,0x01,0xF8,0x01,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x0B,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xFE,
+0x00,0x0F,0xFF,0x80,0x03,0xFE,0xFF,0x10,0x00,0x1F,0x80,0x07,0xFF,0xFF,0xE0,0x00,
+0xFF,0x00,0x07,0xFF,0xFF,0xC0,0x01,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,
+0xFF,0x1F,0xE0,0x03,0xF8,0x01,0xFF,0xFF,0xFE,0x00,0x03,0xFF,0xC0,0x01,0xFF,0xFF,
+0xF7,0x00,0x1F,0x80,0x03,0xFF,0xFF,0xC0,0x01,0xFF,0x80,0x03,0xFF,0xFF,0x80,0x03,
+0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFE,
+0xFF,0x18,0x00,0x00,0x7F,0xE0,0x00,0x7F,0xFF,0xC7,0x00,0x1F,0xC0,0x00,0xFF,0xFF,
+0x00,0x03,0xFF,0x80,0x00,0xFF,0xFE,0x00,0x07,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,
+0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFE,0xFF,0x18,0x80,0x00,0x00,0x70,0x00,
+0x0F,0xFE,0x07,0x00,0x1F,0xE0,0x00,0x3F,0xFC,0x00,0x07,0xFF,0xC0,0x00,0x1F,0xF0,
+0x00,0x0F,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,
+0x01,0xFE,0xFF,0x03,0x80,0x00,0x00,0x30,0xFE,0x00,0x03,0x07,0x00,0x1F,0xF0,0xFD,
+0x00,0x02,0x07,0xFF,0xE0,0xFD,0x00,0x02,0x0F,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,
+0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFE,0xFF,0x03,0xC0,0x00,0x00,0x1C,0xFE,
+0x00,0x03,0x07,0x00,0x1F,0xF8,0xFD,0x00,0x02,0x0F,0xFF,0xF0,0xFD,0x00,0x02,0x1F,
+0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFE,
+0xFF,0x03,0xF0,0x00,0x00,0x1E,0xFE,0x00,0x03,0x07,0x00,0x1F,0xFC,0xFD,0x00,0x02,
+0x3F,0xFF,0xF8,0xFD,0x00,0x02,0x7F,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,
+0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFE,0xFF,0x03,0xF8,0x00,0x00,0x07,0xFE,0x00,0x03,
+0x07,0x00,0x1F,0xFE,0xFD,0x00,0x02,0x7F,0xFF,0xFE,0xFD,0x00,0x02,0xFF,0xF8,0x01,
+0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFE,0xFF,0x0B,
+0xFE,0x00,0x00,0x03,0xC0,0x00,0x00,0x07,0x00,0x1F,0xFF,0x80,0xFE,0x00,0xFE,0xFF,
+0xFE,0x00,0x03,0x01,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,
+0xE0,0x03,0xF8,0x01,0xFD,0xFF,0x0D,0x80,0x00,0x01,0xE0,0x00,0x00,0x07,0x00,0x1F,
+0xFF,0xC0,0x00,0x00,0x03,0xFE,0xFF,0x06,0xC0,0x00,0x00,0x07,0xFF,0xF8,0x01,0xFE,
+0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,0xE0,0x03,0xF8,0x01,0xFD,0xFF,0x0D,0xF0,
+0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1F,0xFF,0xF8,0x00,0x00,0x0F,0xFE,0xFF,0x06,
+0xF0,0x00,0x00,0x1F,0xFF,0xF8,0x01,0xFE,0xFF,0x00,0x80,0xDA,0x00,0xFC,0xFF,0x03,
+0xE0,0x03,0xF8,0x01,0xFC,0xFF,0x0C,0x80,0x00,0x3F,0x00,0x00,0x7F,0x00,0x1F,0xFF,
+0xFE,0x00,0x00,0x7F,0xFE,0xFF,0x06,0xFE,0x00,0x00,0xFF,0xFF,0xF8,0x01,0xFE,0xFF,
+0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,
+0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,
+0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,
+0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,
+0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,
+0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,
+0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,
+0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,
+0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,
+0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,
+0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,
+0xDA,0x00,0xD9,0xFF,0x00,0x80,0xDA,0x00,0xD9,0xFF,0x00,0x80,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0xD8,0x00,0xBB,0xFF,0x00,0x80,0xF8,0x00,0xBB,0xFF,
+0x00,0x80,0xF8,0x00,0xBB,0xFF,0x00,0x80,0xF8,0x00,0xBB,0xFF,0x00,0x80,0xF8,0x00,
+0xBB,0xFF,0x00,0x80,0xF8,0x00,0xBB,0xFF,0x00,0x80,0xF8,0x00,0xBB,0xFF,0x00,0x80,
+0xF8,0x00,0xBB,0xFF,0x00,0x80,0xF8,0x00,0xBB,0xFF,0x00,0x80,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0xC7,0x00,0xFE,0xFF,0x01,0xE0,0x7F,0xEC,0x00,0x01,0x01,0xFC,
+0xFB,0x00,0x04,0x07,0xFF,0xE0,0x1F,0xC0,0xFB,0x00,0x07,0x01,0xF8,0x00,0xFF,0xF0,
+0x00,0x0F,0xF0,0xFB,0x00,0x00,0xFE,0xFA,0x00,0x01,0x1F,0x80,0xF6,0x00,0xFE,0xFF,
+0x01,0xE0,0x7F,0xEC,0x00,0x01,0x01,0xFC,0xFB,0x00,0x04,0x3F,0xFF,0xF0,0x1F,0xC0,
+0xFB,0x00,0x07,0x01,0xF8,0x03,0xFF,0xF0,0x00,0x0F,0xF0,0xFB,0x00,0x00,0xFE,0xFA,
+0x00,0x01,0x1F,0x80,0xF6,0x00,0xFE,0xFF,0x01,0xE0,0x7F,0xEC,0x00,0x01,0x01,0xFC,
+0xFB,0x00,0x04,0x7F,0xFF,0xF0,0x1F,0xC0,0xFB,0x00,0x07,0x01,0xF8,0x07,0xFF,0xF0,
+0x00,0x0F,0xF0,0xFB,0x00,0x00,0xFE,0xFA,0x00,0x01,0x1F,0x80,0xF6,0x00,0xFE,0xFF,
+0x01,0xE0,0x7F,0xF9,0x00,0x01,0x01,0x80,0xF6,0x00,0x01,0x01,0xFC,0xFB,0x00,0x04,
+0xFF,0xFF,0xF0,0x1F,0xC0,0xFB,0x00,0x07,0x01,0xF8,0x07,0xFF,0xF0,0x00,0x0F,0xE0,
+0xFB,0x00,0x00,0xFE,0xFA,0x00,0x01,0x1F,0x80,0xF6,0x00,0xFE,0xFF,0x01,0xE0,0x7E,
+0xF9,0x00,0x01,0x1F,0x80,0xF6,0x00,0x01,0x01,0xFC,0xFC,0x00,0x05,0x01,0xFF,0x83,
+0xF0,0x1F,0xC0,0xFB,0x00,0x07,0x01,0xF8,0x07,0xE0,0x00,0x00,0x0F,0xE0,0xFB,0x00,
+0x00,0xFE,0xFA,0x00,0x01,0x1F,0x80,0xF6,0x00,0x00,0xFE,0xFE,0x00,0x00,0x7E,0xF9,
+0x00,0x01,0x1F,0x80,0xEF,0x00,0x05,0x03,0xFC,0x00,0x10,0x1F,0xC0,0xFB,0x00,0x07,
+0x01,0xF8,0x07,0xE0,0x00,0x00,0x0F,0xE0,0xFB,0x00,0x00,0xFE,0xFA,0x00,0x01,0x1F,
+0x80,0xF6,0x00,0x00,0xFE,0xFE,0x00,0x00,0x7E,0xF9,0x00,0x01,0x1F,0x80,0xEF,0x00,
+0x05,0x03,0xF8,0x00,0x00,0x1F,0xC0,0xFB,0x00,0x07,0x01,0xF8,0x0F,0xC0,0x00,0x00,
+0x0F,0xE0,0xFB,0x00,0x00,0xFE,0xFA,0x00,0x01,0x1F,0x80,0xF6,0x00,0x00,0xFE,0xFE,
+0x00,0x00,0x7E,0xF9,0x00,0x00,0x3F,0xEE,0x00,0x05,0x03,0xF0,0x00,0x00,0x1F,0x80,
+0xFB,0x00,0x07,0x01,0xF8,0x0F,0xC0,0x00,0x00,0x0F,0xE0,0xFB,0x00,0x00,0xFE,0xFA,
+0x00,0x01,0x1F,0x80,0xF6,0x00,0x00,0xFE,0xFE,0x00,0x10,0x7E,0x00,0x03,0xFF,0x00,
+0x00,0x03,0xFF,0x80,0x1F,0x00,0x00,0x03,0xF8,0x00,0x3F,0xE0,0xFE,0x00,0x2C,0xFF,
+0x80,0x00,0x04,0x00,0x07,0xFF,0x00,0x00,0x03,0xF0,0x00,0x00,0x1F,0x80,0xFF,0x80,
+0x00,0x00,0xFF,0x80,0x03,0xF8,0x0F,0xC0,0x00,0x00,0x0F,0xE0,0x00,0x00,0x01,0xFF,
+0xE0,0x00,0xFC,0xFF,0xF0,0x00,0x00,0x0F,0xF8,0x00,0x1F,0x80,0xF6,0x00,0x00,0xFE,
+0xFE,0x00,0x40,0x7E,0x00,0x1F,0xFF,0xE0,0x00,0x3F,0xFF,0xE3,0xFF,0xFF,0x0F,0xCF,
+0xF8,0x01,0xFF,0xFE,0x00,0x1F,0xC7,0xFF,0xF0,0x01,0xFC,0x00,0x3F,0xFF,0xE0,0x00,
+0x03,0xF8,0x00,0x00,0x1F,0x87,0xFF,0xF0,0x00,0x0F,0xFF,0xF0,0x03,0xF8,0x7F,0xFF,
+0xC0,0x00,0x0F,0xE0,0x00,0x00,0x3F,0xFF,0xFC,0x00,0xFF,0xFF,0xFE,0x00,0x00,0x7F,
+0xFF,0x00,0x1F,0x80,0xF6,0x00,0x00,0xFE,0xFE,0x00,0x36,0x7E,0x00,0x7F,0xFF,0xF8,
+0x00,0xFF,0xFF,0xF3,0xFF,0xFF,0x0F,0xFF,0xF8,0x0F,0xFF,0xFF,0x80,0x1F,0xDF,0xFF,
+0xFC,0x01,0xFC,0x01,0xFF,0xFF,0xE0,0x00,0x03,0xFC,0x00,0x00,0x1F,0xBF,0xFF,0xFC,
+0x00,0x3F,0xFF,0xFC,0x03,0xF8,0x7F,0xFF,0xC0,0x00,0x0F,0xE0,0x00,0x00,0x3F,0xFF,
+0xFF,0x00,0xFE,0xFF,0x06,0x80,0x03,0xFF,0xFF,0xC0,0x1F,0x80,0xF6,0x00,0x00,0xFC,
+0xFE,0x00,0x36,0x7E,0x00,0xFF,0xFF,0xFC,0x01,0xFF,0xFF,0xF3,0xFF,0xFF,0x0F,0xFF,
+0xF8,0x1F,0xFF,0xFF,0xC0,0x1F,0xFF,0xFF,0xFE,0x01,0xFC,0x03,0xFF,0xFF,0xE0,0x00,
+0x01,0xFE,0x00,0x00,0x1F,0xFF,0xFF,0xFE,0x00,0x7F,0xFF,0xFE,0x03,0xF8,0xFF,0xFF,
+0xC0,0x00,0x0F,0xE0,0x00,0x00,0x7F,0xFF,0xFF,0x80,0xFE,0xFF,0x06,0xC0,0x07,0xFF,
+0xFF,0xE0,0x3F,0x80,0xF6,0x00,0x00,0xFC,0xFE,0x00,0x40,0x7E,0x01,0xFE,0x01,0xFE,
+0x03,0xFF,0x01,0xF3,0xFF,0xFF,0x0F,0xFF,0x38,0x3F,0xE0,0x3F,0xE0,0x1F,0xFF,0x8F,
+0xFF,0x01,0xFC,0x07,0xFE,0x03,0xE0,0x00,0x01,0xFF,0x00,0x00,0x1F,0xFF,0x07,0xFF,
+0x00,0xFF,0x00,0xFF,0x03,0xF8,0x7F,0xFF,0xC0,0x00,0x0F,0xE0,0x00,0x00,0x78,0x00,
+0x3F,0x80,0xFF,0x80,0x7F,0xE0,0x0F,0xF0,0x0F,0xF0,0x3F,0x80,0xF6,0x00,0x00,0xFC,
+0xFE,0x00,0x19,0x7E,0x03,0xF8,0x00,0x7E,0x07,0xFC,0x00,0x00,0x3F,0x00,0x0F,0xF8,
+0x00,0x7F,0x80,0x0F,0xF0,0x1F,0xF8,0x00,0xFF,0x01,0xF8,0x0F,0xF8,0xFD,0x00,0x22,
+0xFF,0x80,0x00,0x1F,0xF8,0x00,0xFF,0x01,0xFC,0x00,0x3F,0x03,0xF8,0x0F,0xC0,0x00,
+0x00,0x0F,0xE0,0x00,0x00,0x40,0x00,0x1F,0x80,0xFC,0x00,0x0F,0xF0,0x1F,0xC0,0x03,
+0xF0,0x3F,0x80,0xF6,0x00,0xFE,0xFF,0x1A,0x00,0x7E,0x07,0xF0,0x00,0x7F,0x07,0xF0,
+0x00,0x00,0x3F,0x00,0x0F,0xF0,0x00,0xFE,0x00,0x03,0xF8,0x1F,0xF0,0x00,0x7F,0x01,
+0xF8,0x0F,0xE0,0xFD,0x00,0x12,0x3F,0xE0,0x00,0x1F,0xF0,0x00,0x7F,0x01,0xF8,0x00,
+0x1F,0x83,0xF0,0x0F,0xC0,0x00,0x00,0x0F,0xE0,0xFD,0x00,0x0B,0x1F,0x80,0xFC,0x00,
+0x07,0xF0,0x1F,0x80,0x01,0xF8,0x3F,0x80,0xF6,0x00,0xFE,0xFF,0x1A,0x00,0x7E,0x07,
+0xE0,0x00,0x3F,0x0F,0xE0,0x00,0x00,0x3F,0x00,0x0F,0xE0,0x00,0xFE,0x00,0x03,0xF8,
+0x1F,0xE0,0x00,0x3F,0x01,0xF8,0x1F,0xC0,0xFD,0x00,0x12,0x1F,0xF0,0x00,0x1F,0xE0,
+0x00,0x3F,0x03,0xF0,0x00,0x1F,0x83,0xF0,0x0F,0xC0,0x00,0x00,0x0F,0xE0,0xFD,0x00,
+0x0A,0x3F,0x80,0xFC,0x00,0x03,0xF8,0x3F,0x80,0x01,0xF8,0x3F,0xF5,0x00,0xFE,0xFF,
+0x1A,0x00,0xFE,0x0F,0xE0,0x00,0x3F,0x0F,0xE0,0x00,0x00,0x3F,0x00,0x1F,0xC0,0x01,
+0xFC,0x00,0x01,0xF8,0x1F,0xC0,0x00,0x3F,0x01,0xF8,0x1F,0xC0,0xFD,0x00,0x12,0x0F,
+0xFC,0x00,0x1F,0xC0,0x00,0x3F,0x03,0xF0,0x00,0x1F,0x83,0xF0,0x0F,0xC0,0x00,0x00,
+0x0F,0xE0,0xFD,0x00,0x0A,0x7F,0x80,0xFC,0x00,0x03,0xF8,0x3F,0x00,0x01,0xF8,0x3F,
+0xF5,0x00,0xFE,0xFF,0x02,0x00,0xFE,0x0F,0xFE,0xFF,0x14,0x0F,0xC0,0x00,0x00,0x3F,
+0x00,0x1F,0xC0,0x01,0xFC,0x00,0x01,0xFC,0x1F,0xC0,0x00,0x3F,0x01,0xF8,0x1F,0x80,
+0xFD,0x00,0x07,0x03,0xFE,0x00,0x1F,0xC0,0x00,0x3F,0x07,0xFE,0xFF,0x07,0x83,0xF0,
+0x0F,0xC0,0x00,0x00,0x0F,0xE0,0xFE,0x00,0x0B,0x03,0xFF,0x80,0xFC,0x00,0x01,0xF8,
+0x7F,0xFF,0xFF,0xFC,0x3F,0xF6,0x00,0x00,0x01,0xFE,0xFF,0x02,0x00,0xFE,0x0F,0xFE,
+0xFF,0x14,0x1F,0xC0,0x00,0x00,0x3F,0x00,0x1F,0xC0,0x01,0xF8,0x00,0x01,0xFC,0x1F,
+0xC0,0x00,0x3F,0x01,0xF8,0x3F,0x80,0xFD,0x00,0x07,0x01,0xFF,0x80,0x1F,0x80,0x00,
+0x3F,0x07,0xFE,0xFF,0x07,0x83,0xF0,0x0F,0xC0,0x00,0x00,0x0F,0xE0,0xFE,0x00,0x0B,
+0x7F,0xFF,0x80,0xFC,0x00,0x01,0xF8,0x7F,0xFF,0xFF,0xFC,0x3F,0xF6,0x00,0x01,0x01,
+0xFC,0xFE,0x00,0x01,0xFE,0x0F,0xFE,0xFF,0x14,0x1F,0xC0,0x00,0x00,0x3F,0x00,0x1F,
+0xC0,0x01,0xF8,0x00,0x01,0xFC,0x1F,0x80,0x00,0x3F,0x01,0xF8,0x3F,0x80,0xFC,0x00,
+0x06,0x7F,0xC0,0x1F,0x80,0x00,0x3F,0x07,0xFE,0xFF,0x16,0x83,0xF0,0x0F,0xC0,0x00,
+0x00,0x0F,0xE0,0x00,0x00,0x07,0xFF,0xFF,0x80,0xFC,0x00,0x01,0xF8,0x7F,0xFF,0xFF,
+0xF8,0x3F,0xF6,0x00,0x01,0x01,0xFC,0xFE,0x00,0x01,0xFC,0x0F,0xFE,0xFF,0x14,0x1F,
+0x80,0x00,0x00,0x7F,0x00,0x1F,0xC0,0x03,0xF8,0x00,0x01,0xFC,0x1F,0x80,0x00,0x3F,
+0x01,0xF8,0x3F,0x80,0xFC,0x00,0x06,0x3F,0xE0,0x1F,0x80,0x00,0x3F,0x07,0xFE,0xFF,
+0x16,0x83,0xF0,0x0F,0xC0,0x00,0x00,0x0F,0xC0,0x00,0x00,0x1F,0xFF,0xDF,0x80,0xFC,
+0x00,0x01,0xF8,0x7F,0xFF,0xFF,0xF8,0x3F,0xF6,0x00,0x01,0x01,0xFC,0xFE,0x00,0x19,
+0xFC,0x0F,0xC0,0x00,0x00,0x1F,0x80,0x00,0x00,0x7F,0x00,0x1F,0x80,0x03,0xF8,0x00,
+0x01,0xFC,0x1F,0x80,0x00,0x3F,0x01,0xF8,0x3F,0x80,0xFC,0x00,0x1C,0x1F,0xF0,0x1F,
+0x80,0x00,0x3F,0x07,0xE0,0x00,0x00,0x03,0xF0,0x0F,0xC0,0x00,0x00,0x0F,0xC0,0x00,
+0x00,0xFF,0xFE,0x1F,0x80,0xFC,0x00,0x01,0xF8,0x7E,0xFE,0x00,0x00,0x3F,0xF6,0x00,
+0x01,0x01,0xFC,0xFE,0x00,0x19,0xFC,0x0F,0xC0,0x00,0x00,0x1F,0xC0,0x00,0x00,0x7F,
+0x00,0x1F,0x80,0x03,0xF8,0x00,0x01,0xFC,0x1F,0x80,0x00,0x3F,0x01,0xF8,0x3F,0x80,
+0xFC,0x00,0x1C,0x07,0xF0,0x1F,0x80,0x00,0x3F,0x07,0xE0,0x00,0x00,0x03,0xF0,0x0F,
+0xC0,0x00,0x00,0x0F,0xC0,0x00,0x01,0xFF,0xC0,0x1F,0x80,0xFC,0x00,0x01,0xF8,0x7E,
+0xFE,0x00,0x00,0x3F,0xF6,0x00,0x01,0x01,0xFC,0xFE,0x00,0x19,0xFC,0x0F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,0x00,0x7F,0x00,0x1F,0x80,0x01,0xF8,0x00,0x01,0xF8,0x1F,0x80,
+0x00,0x3F,0x01,0xF8,0x3F,0x80,0xFC,0x00,0x1C,0x03,0xF8,0x3F,0x80,0x00,0x7F,0x07,
+0xE0,0x00,0x00,0x03,0xF0,0x1F,0xC0,0x00,0x00,0x0F,0xC0,0x00,0x03,0xFC,0x00,0x3F,
+0x81,0xFC,0x00,0x03,0xF8,0x7E,0xFE,0x00,0x00,0x3F,0xF6,0x00,0x01,0x01,0xFC,0xFE,
+0x00,0x19,0xFC,0x0F,0xE0,0x00,0x00,0x1F,0xC0,0x00,0x00,0x7E,0x00,0x1F,0x80,0x01,
+0xF8,0x00,0x01,0xF8,0x1F,0x80,0x00,0x7F,0x03,0xF8,0x3F,0x80,0xFC,0x00,0x1C,0x03,
+0xF8,0x3F,0x80,0x00,0x7F,0x07,0xF0,0x00,0x00,0x03,0xF0,0x1F,0xC0,0x00,0x00,0x1F,
+0xC0,0x00,0x03,0xF8,0x00,0x3F,0x81,0xFC,0x00,0x03,0xF8,0x7F,0xFE,0x00,0x00,0x3F,
+0xF6,0x00,0x01,0x01,0xFC,0xFE,0x00,0x19,0xFC,0x0F,0xE0,0x00,0x00,0x0F,0xC0,0x00,
+0x00,0x7E,0x00,0x1F,0x80,0x01,0xFC,0x00,0x03,0xF8,0x3F,0x80,0x00,0x7F,0x03,0xF8,
+0x1F,0x80,0xFC,0x00,0x1C,0x03,0xF8,0x3F,0x80,0x00,0x7F,0x07,0xF0,0x00,0x00,0x03,
+0xF0,0x1F,0xC0,0x00,0x00,0x1F,0xC0,0x00,0x07,0xF0,0x00,0x3F,0x81,0xFE,0x00,0x03,
+0xF0,0x3F,0xFE,0x00,0x00,0x3F,0xF6,0x00,0x01,0x01,0xFC,0xFE,0x00,0x19,0xFC,0x07,
+0xF0,0x00,0x00,0x0F,0xE0,0x00,0x00,0x7E,0x00,0x1F,0x80,0x00,0xFC,0x00,0x07,0xF0,
+0x3F,0x80,0x00,0x7F,0x03,0xF8,0x1F,0xC0,0xFC,0x00,0x20,0x03,0xF8,0x3F,0x80,0x00,
+0x7F,0x03,0xF8,0x00,0x00,0x07,0xF0,0x1F,0xC0,0x00,0x00,0x1F,0xC0,0x00,0x07,0xE0,
+0x00,0x3F,0x81,0xFE,0x00,0x07,0xF0,0x3F,0x80,0x00,0x00,0x3F,0xF6,0x00,0x01,0x01,
+0xFC,0xFE,0x00,0x19,0xFC,0x07,0xF8,0x00,0x00,0x0F,0xF0,0x00,0x00,0x7F,0x00,0x1F,
+0x80,0x00,0xFE,0x00,0x0F,0xF0,0x3F,0x80,0x00,0x7F,0x03,0xF8,0x0F,0xE0,0xFE,0x00,
+0x22,0x0C,0x00,0x07,0xF8,0x3F,0x80,0x00,0x7F,0x03,0xFC,0x00,0x00,0x07,0xF0,0x1F,
+0xC0,0x00,0x00,0x1F,0xC0,0x00,0x07,0xF0,0x00,0x3F,0x01,0xFF,0x00,0x0F,0xE0,0x3F,
+0xC0,0x00,0x00,0x7F,0xF6,0x00,0x01,0x01,0xF8,0xFE,0x00,0x3F,0xFC,0x03,0xFC,0x00,
+0x0C,0x07,0xFC,0x00,0x60,0x7F,0x00,0x1F,0x80,0x00,0x7F,0x80,0x1F,0xE0,0x3F,0x80,
+0x00,0x7F,0x03,0xF8,0x0F,0xF8,0x00,0xC0,0x00,0x0F,0x80,0x1F,0xF0,0x3F,0x00,0x00,
+0x7F,0x01,0xFF,0x00,0x06,0x07,0xF0,0x1F,0xC0,0x00,0x00,0x1F,0xC0,0x00,0x0B,0xF0,
+0x00,0x3F,0x01,0xFF,0xC0,0x3F,0xE0,0x1F,0xF0,0x00,0x60,0x7F,0xF6,0x00,0x00,0x01,
+0xFE,0xFF,0x37,0x80,0xFC,0x01,0xFF,0xC3,0xFC,0x03,0xFF,0xFF,0xE0,0x7F,0xFF,0x1F,
+0x80,0x00,0x3F,0xFF,0xFF,0xC0,0x3F,0x80,0x00,0x7E,0x03,0xF8,0x07,0xFF,0xFF,0xC0,
+0x00,0x0F,0xFF,0xFF,0xE0,0x3F,0x00,0x00,0x7E,0x00,0xFF,0xE1,0xFE,0x07,0xF0,0x1F,
+0xC0,0x00,0x00,0x1F,0xFF,0xFF,0xFB,0xFC,0x07,0x3F,0x01,0xFE,0xFF,0x05,0xC0,0x0F,
+0xFE,0x1F,0xE0,0x7F,0xF6,0x00,0x00,0x01,0xFE,0xFF,0x40,0x80,0xFC,0x00,0xFF,0xFF,
+0xFC,0x01,0xFF,0xFF,0xC0,0x3F,0xFF,0x1F,0x80,0x00,0x1F,0xFF,0xFF,0x80,0x3F,0x00,
+0x00,0x7E,0x03,0xF8,0x03,0xFF,0xFF,0xC0,0x00,0x07,0xFF,0xFF,0xE0,0x3F,0x00,0x00,
+0x7E,0x00,0x7F,0xFF,0xFE,0x07,0xF0,0x1F,0xC0,0x00,0x00,0x1F,0xFF,0xFF,0xF9,0xFF,
+0xFF,0x3F,0x01,0xFB,0xFF,0xFF,0x80,0x07,0xFF,0xFF,0xE0,0x7F,0xF6,0x00,0x00,0x01,
+0xFE,0xFF,0x40,0x81,0xFC,0x00,0x7F,0xFF,0xF8,0x00,0xFF,0xFF,0xC0,0x3F,0xFE,0x1F,
+0x80,0x00,0x0F,0xFF,0xFE,0x00,0x3F,0x00,0x00,0x7E,0x03,0xF8,0x00,0xFF,0xFF,0x80,
+0x00,0x07,0xFF,0xFF,0x80,0x3F,0x00,0x00,0x7E,0x00,0x3F,0xFF,0xFC,0x07,0xF0,0x1F,
+0xC0,0x00,0x00,0x1F,0xFF,0xFF,0xF8,0xFF,0xFF,0x3F,0x01,0xF9,0xFF,0xFF,0x00,0x01,
+0xFF,0xFF,0xC0,0x7F,0xF6,0x00,0x00,0x01,0xFE,0xFF,0x40,0x81,0xFC,0x00,0x1F,0xFF,
+0xF8,0x00,0x3F,0xFF,0xC0,0x1F,0xFE,0x3F,0x80,0x00,0x03,0xFF,0xF8,0x00,0x3F,0x80,
+0x00,0x7E,0x03,0xF8,0x00,0x3F,0xFF,0x80,0x00,0x03,0xFF,0xFE,0x00,0x3F,0x00,0x00,
+0x7E,0x00,0x0F,0xFF,0xFC,0x07,0xF0,0x1F,0xC0,0x00,0x00,0x1F,0xFF,0xFF,0xF8,0x7F,
+0xFE,0x3F,0x01,0xF8,0x7F,0xFC,0x00,0x00,0x7F,0xFF,0xC0,0x7F,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x8B,0x00,
+};
+#endif
+
+// BitmapExample2 : 30720 bytes, packed 6320
+const unsigned char BitmapExample2_packed[] PROGMEM =
+{
+0x00,0x78,0x00,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0xA7,0x00,0x00,0x1F,0xFE,0xFF,0x01,0x01,0xFC,0xEA,0x00,0x01,0x3F,0xC0,0xD0,0x00,
+0x00,0x1F,0xFE,0xFF,0x01,0x01,0xFC,0xEA,0x00,0x01,0x3F,0xC0,0xD0,0x00,0x00,0x1F,
+0xFE,0xFF,0x01,0x01,0xF8,0xF8,0x00,0x00,0x10,0xF4,0x00,0x01,0x3F,0xC0,0xD0,0x00,
+0x00,0x1F,0xFE,0xFF,0x01,0x01,0xF8,0xF9,0x00,0x01,0x03,0xF0,0xF4,0x00,0x01,0x3F,
+0xC0,0xD0,0x00,0x05,0x1F,0xC0,0x00,0x00,0x01,0xF8,0xF9,0x00,0x01,0x03,0xF0,0xC1,
+0x00,0x05,0x1F,0xC0,0x00,0x00,0x03,0xF8,0xF9,0x00,0x01,0x03,0xF0,0xC1,0x00,0x05,
+0x1F,0xC0,0x00,0x00,0x03,0xF8,0xF9,0x00,0x01,0x07,0xF0,0xC1,0x00,0x05,0x1F,0xC0,
+0x00,0x00,0x03,0xF8,0xF9,0x00,0x01,0x03,0xF0,0xC1,0x00,0x21,0x1F,0xC0,0x00,0x00,
+0x03,0xF8,0x00,0x3F,0xFF,0xE0,0x00,0x0F,0xFF,0xFC,0x7F,0xFF,0xF0,0xFE,0x7F,0xC0,
+0x07,0xFF,0xFC,0x00,0x0F,0xE3,0xFF,0xFC,0x00,0x3F,0x80,0x03,0xFF,0xFF,0xD3,0x00,
+0x21,0x1F,0xC0,0x00,0x00,0x03,0xF8,0x00,0x7F,0xFF,0xF0,0x00,0x3F,0xFF,0xFC,0x7F,
+0xFF,0xF0,0xFD,0xFF,0xC0,0x1F,0xFF,0xFF,0x00,0x0F,0xEF,0xFF,0xFF,0x00,0x3F,0x80,
+0x0F,0xFF,0xFF,0xD3,0x00,0x21,0x1F,0xC0,0x00,0x00,0x03,0xF8,0x01,0xFF,0xFF,0xF8,
+0x00,0x7F,0xFF,0xFC,0x7F,0xFF,0xF0,0xFD,0xFF,0xC0,0x3F,0xFF,0xFF,0x80,0x0F,0xDF,
+0xFF,0xFF,0x80,0x3F,0x80,0x1F,0xFF,0xFF,0xD3,0x00,0x13,0x1F,0xC0,0x00,0x00,0x03,
+0xF8,0x03,0xFF,0x8F,0xFE,0x01,0xFF,0xFF,0xFC,0x7F,0xFF,0xF0,0xFF,0xFF,0xE0,0xFE,
+0xFF,0x01,0xE0,0x0F,0xFE,0xFF,0x05,0xC0,0x3F,0x80,0x3F,0xFF,0xFF,0xD3,0x00,0x20,
+0x1F,0xC0,0x00,0x00,0x03,0xF8,0x07,0xF8,0x00,0xFE,0x03,0xFE,0x00,0x00,0x07,0xF0,
+0x00,0xFF,0xC0,0x01,0xFF,0x00,0x1F,0xE0,0x0F,0xFE,0x00,0x7F,0xC0,0x3F,0x80,0x7F,
+0xC0,0xD2,0x00,0x1F,0x1F,0xC0,0x00,0x00,0x03,0xF8,0x0F,0xE0,0x00,0x7F,0x03,0xFC,
+0x00,0x00,0x07,0xF0,0x00,0xFF,0x80,0x01,0xFC,0x00,0x0F,0xF0,0x0F,0xFC,0x00,0x1F,
+0xC0,0x3F,0x80,0xFF,0xD1,0x00,0x1F,0x1F,0xFF,0xFF,0xF8,0x03,0xF8,0x1F,0xE0,0x00,
+0x3F,0x07,0xF8,0x00,0x00,0x07,0xE0,0x00,0xFF,0x00,0x03,0xF8,0x00,0x07,0xF8,0x0F,
+0xF8,0x00,0x1F,0xE0,0x3F,0x81,0xFE,0xD1,0x00,0x1F,0x1F,0xFF,0xFF,0xF8,0x03,0xF8,
+0x1F,0xC0,0x00,0x3F,0x87,0xF0,0x00,0x00,0x07,0xE0,0x00,0xFE,0x00,0x07,0xF0,0x00,
+0x03,0xF8,0x1F,0xE0,0x00,0x0F,0xE0,0x3F,0x81,0xFC,0xD1,0x00,0x1F,0x1F,0xFF,0xFF,
+0xF8,0x03,0xF8,0x1F,0x80,0x00,0x3F,0x8F,0xE0,0x00,0x00,0x07,0xE0,0x00,0xFE,0x00,
+0x07,0xF0,0x00,0x03,0xF8,0x1F,0xE0,0x00,0x0F,0xE0,0x3F,0x81,0xFC,0xD1,0x00,0x06,
+0x1F,0xFF,0xFF,0xF8,0x03,0xF8,0x3F,0xFE,0xFF,0x15,0x8F,0xE0,0x00,0x00,0x07,0xE0,
+0x00,0xFE,0x00,0x07,0xF0,0x00,0x01,0xFC,0x1F,0xE0,0x00,0x0F,0xE0,0x3F,0x81,0xFC,
+0xD1,0x00,0x06,0x3F,0xFC,0x07,0xF8,0x03,0xF0,0x3F,0xFE,0xFF,0x15,0x8F,0xE0,0x00,
+0x00,0x07,0xE0,0x00,0xFC,0x00,0x0F,0xE0,0x00,0x01,0xFC,0x1F,0xC0,0x00,0x0F,0xE0,
+0x3F,0x83,0xF8,0xD1,0x00,0x06,0x3F,0x80,0x00,0x00,0x03,0xF0,0x3F,0xFE,0xFF,0x15,
+0x8F,0xE0,0x00,0x00,0x0F,0xE0,0x00,0xFC,0x00,0x0F,0xE0,0x00,0x01,0xFC,0x1F,0xC0,
+0x00,0x0F,0xC0,0x3F,0x03,0xF8,0xD1,0x00,0x1F,0x3F,0x80,0x00,0x00,0x03,0xF0,0x3F,
+0x80,0x00,0x00,0x0F,0xE0,0x00,0x00,0x0F,0xE0,0x00,0xFC,0x00,0x0F,0xE0,0x00,0x01,
+0xFC,0x1F,0xC0,0x00,0x0F,0xC0,0x3F,0x03,0xF8,0xD1,0x00,0x1F,0x3F,0x80,0x00,0x00,
+0x03,0xF0,0x3F,0x80,0x00,0x00,0x0F,0xE0,0x00,0x00,0x0F,0xE0,0x00,0xFC,0x00,0x0F,
+0xE0,0x00,0x01,0xFC,0x1F,0xC0,0x00,0x0F,0xC0,0x3F,0x03,0xF8,0xD1,0x00,0x1F,0x3F,
+0x80,0x00,0x00,0x03,0xF0,0x3F,0x80,0x00,0x00,0x0F,0xE0,0x00,0x00,0x0F,0xE0,0x00,
+0xFC,0x00,0x0F,0xE0,0x00,0x01,0xF8,0x1F,0xC0,0x00,0x0F,0xC0,0x3F,0x03,0xF8,0xD1,
+0x00,0x1F,0x3F,0x80,0x00,0x00,0x03,0xF0,0x3F,0x80,0x00,0x00,0x0F,0xE0,0x00,0x00,
+0x0F,0xE0,0x01,0xFC,0x00,0x0F,0xE0,0x00,0x03,0xF8,0x1F,0xC0,0x00,0x0F,0xC0,0x3F,
+0x03,0xF8,0xD1,0x00,0x1F,0x3F,0x80,0x00,0x00,0x07,0xF0,0x3F,0xC0,0x00,0x00,0x0F,
+0xE0,0x00,0x00,0x0F,0xE0,0x01,0xFC,0x00,0x07,0xF0,0x00,0x03,0xF8,0x1F,0xC0,0x00,
+0x0F,0xC0,0x7F,0x03,0xFC,0xD1,0x00,0x1F,0x3F,0x80,0x00,0x00,0x07,0xF0,0x1F,0xC0,
+0x00,0x00,0x0F,0xF0,0x00,0x00,0x0F,0xE0,0x01,0xFC,0x00,0x07,0xF0,0x00,0x07,0xF0,
+0x1F,0x80,0x00,0x1F,0xC0,0x7F,0x01,0xFC,0xD1,0x00,0x1F,0x3F,0x80,0x00,0x00,0x07,
+0xF0,0x1F,0xE0,0x00,0x00,0x07,0xF0,0x00,0x00,0x0F,0xE0,0x01,0xFC,0x00,0x07,0xF8,
+0x00,0x07,0xF0,0x1F,0x80,0x00,0x1F,0xC0,0x7F,0x01,0xFC,0xD1,0x00,0x1F,0x3F,0x80,
+0x00,0x00,0x07,0xF0,0x0F,0xF0,0x00,0x00,0x07,0xFC,0x00,0x00,0x0F,0xE0,0x01,0xFC,
+0x00,0x03,0xFC,0x00,0x1F,0xE0,0x1F,0x80,0x00,0x1F,0xC0,0x7F,0x00,0xFF,0xD1,0x00,
+0x21,0x3F,0x80,0x00,0x7C,0x07,0xF0,0x0F,0xFC,0x00,0x1C,0x03,0xFF,0x00,0x18,0x0F,
+0xF0,0x11,0xFC,0x00,0x03,0xFF,0x00,0x7F,0xE0,0x1F,0x80,0x00,0x1F,0xC0,0x7F,0x00,
+0xFF,0xC0,0x07,0xD3,0x00,0x13,0x3F,0xFF,0xFF,0xFC,0x07,0xF0,0x03,0xFF,0x81,0xFC,
+0x01,0xFF,0xFF,0xF8,0x0F,0xFF,0xF1,0xFC,0x00,0x00,0xFE,0xFF,0x0A,0x80,0x3F,0x80,
+0x00,0x1F,0xC0,0x7F,0x00,0x7F,0xFF,0xFE,0xD3,0x00,0x21,0x3F,0xFF,0xFF,0xFC,0x07,
+0xF0,0x03,0xFF,0xFF,0xFC,0x00,0xFF,0xFF,0xF8,0x0F,0xFF,0xF1,0xFC,0x00,0x00,0x7F,
+0xFF,0xFF,0x80,0x3F,0x80,0x00,0x1F,0xC0,0x7F,0x00,0x3F,0xFF,0xFE,0xD3,0x00,0x21,
+0x3F,0xFF,0xFF,0xFC,0x07,0xF0,0x00,0xFF,0xFF,0xFC,0x00,0x7F,0xFF,0xF8,0x07,0xFF,
+0xE1,0xFC,0x00,0x00,0x3F,0xFF,0xFE,0x00,0x3F,0x80,0x00,0x1F,0xC0,0x7F,0x00,0x1F,
+0xFF,0xFE,0xD3,0x00,0x21,0x3F,0xFF,0xFF,0xFC,0x07,0xF0,0x00,0x1F,0xFF,0xF8,0x00,
+0x0F,0xFF,0xF0,0x01,0xFF,0xE1,0xFC,0x00,0x00,0x07,0xFF,0xF0,0x00,0x3F,0x80,0x00,
+0x1F,0xC0,0x7F,0x00,0x01,0xFF,0xFE,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0xEA,0x00,0x01,0x0F,0xE0,0xF9,0x00,0x01,0x3F,0xE0,0xBD,0x00,0x02,
+0x7F,0xFE,0x1F,0xFC,0x00,0x05,0x07,0xC0,0x7F,0xE0,0x01,0xF0,0xFD,0x00,0x00,0x1F,
+0xFC,0x00,0x00,0x0F,0xCB,0x00,0x03,0x01,0xFF,0xFE,0x1F,0xFC,0x00,0x05,0x07,0xC0,
+0xFF,0xF0,0x01,0xF0,0xFD,0x00,0x00,0x1F,0xFC,0x00,0x00,0x0F,0xCB,0x00,0x03,0x01,
+0xFF,0xFE,0x1F,0xFC,0x00,0x05,0x07,0xC1,0xFC,0x60,0x01,0xF0,0xFD,0x00,0x00,0x1F,
+0xFC,0x00,0x00,0x0F,0xCB,0x00,0x03,0x03,0xF8,0x0C,0x1F,0xFC,0x00,0x05,0x07,0xC1,
+0xF0,0x00,0x01,0xF0,0xFD,0x00,0x00,0x1F,0xFC,0x00,0x00,0x0F,0xCB,0x00,0x03,0x03,
+0xF0,0x00,0x1F,0xFC,0x00,0x05,0x07,0xC1,0xF0,0x00,0x01,0xF0,0xFD,0x00,0x00,0x1F,
+0xFC,0x00,0x00,0x0F,0xCB,0x00,0x19,0x03,0xE0,0x00,0x1F,0x03,0xE0,0x00,0x03,0xC0,
+0x07,0xC1,0xF0,0x00,0x01,0xF0,0x00,0x00,0x7F,0x00,0x1E,0x3F,0x00,0x00,0x0F,0x80,
+0x0F,0xCB,0x00,0x19,0x03,0xE0,0x00,0x1F,0x1F,0xFC,0x00,0x3F,0xF8,0x07,0xC7,0xFF,
+0xC0,0x01,0xF0,0x00,0x07,0xFF,0xE0,0x1F,0xFF,0xE0,0x00,0x7F,0xF0,0x0F,0xCB,0x00,
+0x19,0x03,0xF0,0x00,0x1F,0xFF,0xFE,0x00,0x7F,0xFE,0x07,0xCF,0xFF,0xC0,0x03,0xF0,
+0x00,0x0F,0xFF,0xF8,0x1F,0xFF,0xF8,0x01,0xFF,0xF8,0x0F,0xE1,0x00,0x00,0x03,0xFE,
+0xFF,0x00,0x80,0xF0,0x00,0x19,0x01,0xF0,0x00,0x1F,0xFF,0xFF,0x01,0xFF,0xFF,0x07,
+0xCF,0xFF,0xC0,0x03,0xF0,0x00,0x0F,0xFF,0xF8,0x1F,0xFF,0xFC,0x03,0xFF,0xFC,0x1F,
+0xE2,0x00,0x00,0x01,0xFC,0xFF,0xF0,0x00,0x19,0x01,0xF8,0x00,0x1F,0xF8,0x7F,0x81,
+0xF8,0x1F,0x07,0xC1,0xF0,0x00,0x03,0xF0,0x00,0x0E,0x00,0xF8,0x3F,0x00,0xFE,0x07,
+0xE0,0x7E,0x1F,0xE2,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xFC,0xF0,0x00,0x0D,0xFE,0x00,
+0x1F,0xE0,0x1F,0x83,0xE0,0x0F,0x87,0x81,0xF0,0x00,0x03,0xE0,0xFE,0x00,0x07,0x7C,
+0x3E,0x00,0x7E,0x0F,0xC0,0x3E,0x1F,0xE3,0x00,0x00,0x07,0xFA,0xFF,0x00,0xC0,0xF1,
+0x00,0x0D,0x7F,0x80,0x1F,0xC0,0x0F,0x87,0xC0,0x0F,0x87,0x81,0xF0,0x00,0x03,0xE0,
+0xFE,0x00,0x07,0x7C,0x3E,0x00,0x3F,0x0F,0x80,0x1F,0x1F,0xE3,0x00,0x00,0x7F,0xFA,
+0xFF,0x00,0xFC,0xF1,0x00,0x0D,0x1F,0xC0,0x1F,0x80,0x0F,0x87,0xC0,0x07,0x87,0x81,
+0xF0,0x00,0x03,0xE0,0xFE,0x00,0x07,0xFC,0x3E,0x00,0x1F,0x1F,0x00,0x1F,0x1F,0xE4,
+0x00,0x00,0x03,0xF8,0xFF,0x00,0x80,0xF2,0x00,0x18,0x0F,0xF0,0x1F,0x00,0x0F,0x87,
+0xFF,0xFF,0xC7,0x81,0xE0,0x00,0x03,0xE0,0x00,0x00,0x0F,0xFC,0x3E,0x00,0x1F,0x9F,
+0xFF,0xFF,0x1F,0xE4,0x00,0x00,0x1F,0xF8,0xFF,0x00,0xF0,0xF2,0x00,0x18,0x07,0xF8,
+0x1F,0x00,0x0F,0x8F,0xFF,0xFF,0xCF,0x81,0xE0,0x00,0x03,0xE0,0x00,0x00,0xFF,0xF8,
+0x3E,0x00,0x1F,0x9F,0xFF,0xFF,0x1F,0xE4,0x00,0xF7,0xFF,0x00,0xFE,0xF2,0x00,0x18,
+0x01,0xFC,0x1F,0x80,0x0F,0x8F,0xFF,0xFF,0x8F,0x81,0xE0,0x00,0x03,0xE0,0x00,0x03,
+0xFF,0xF8,0x3E,0x00,0x1F,0x9F,0xFF,0xFF,0x1F,0xE5,0x00,0x00,0x07,0xF6,0xFF,0x00,
+0xC0,0xF2,0x00,0x17,0xFC,0x1F,0x00,0x0F,0x8F,0x80,0x00,0x0F,0x81,0xE0,0x00,0x03,
+0xE0,0x00,0x1F,0xFE,0x78,0x3E,0x00,0x1F,0x9E,0x00,0x00,0x1F,0xE5,0x00,0x00,0x1F,
+0xF6,0xFF,0x00,0xF0,0xF2,0x00,0x17,0x7E,0x1F,0x00,0x0F,0x8F,0x80,0x00,0x0F,0x83,
+0xE0,0x00,0x03,0xE0,0x00,0x3F,0xC0,0x78,0x3E,0x00,0x1F,0x9F,0x00,0x00,0x1F,0xE5,
+0x00,0xF5,0xFF,0x00,0xFE,0xF2,0x00,0x17,0x7E,0x1F,0x00,0x0F,0x8F,0x80,0x00,0x0F,
+0x83,0xE0,0x00,0x03,0xE0,0x00,0x3F,0x00,0xF8,0x3E,0x00,0x1F,0x1F,0x00,0x00,0x1F,
+0xE6,0x00,0x00,0x03,0xF4,0xFF,0x00,0x80,0xF3,0x00,0x17,0x3E,0x1F,0x00,0x0F,0x87,
+0xC0,0x00,0x0F,0x83,0xE0,0x00,0x03,0xE0,0x00,0x7C,0x00,0xF8,0x3E,0x00,0x1F,0x1F,
+0x00,0x00,0x1F,0xE6,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xF3,0x00,0x17,0x3E,0x3F,
+0x00,0x0F,0x87,0xC0,0x00,0x0F,0x83,0xE0,0x00,0x03,0xE0,0x00,0x7C,0x00,0xF8,0x3F,
+0x00,0x3F,0x1F,0x80,0x00,0x1E,0xE6,0x00,0x00,0x3F,0xF4,0xFF,0x00,0xF8,0xF5,0x00,
+0x19,0x06,0x00,0x7E,0x3F,0x00,0x0F,0x87,0xE0,0x00,0x0F,0x83,0xE0,0x00,0x03,0xE0,
+0x00,0x7C,0x00,0xF8,0x3F,0x00,0x7E,0x0F,0x80,0x00,0x1E,0xE6,0x00,0xF3,0xFF,0x00,
+0xFE,0xF5,0x00,0x19,0x07,0xC1,0xFC,0x3F,0x00,0x0F,0x83,0xF8,0x07,0x0F,0x83,0xE0,
+0x00,0x03,0xFF,0xFF,0x7C,0x00,0xF8,0x3F,0xC1,0xFC,0x0F,0xE0,0x0C,0x3E,0xE7,0x00,
+0x00,0x03,0xF2,0xFF,0x00,0x80,0xF6,0x00,0x19,0x07,0xFF,0xFC,0x3F,0x00,0x0F,0x01,
+0xFF,0xFF,0x0F,0x83,0xE0,0x00,0x07,0xFF,0xFF,0xBF,0x9E,0xF8,0x3F,0xFF,0xF8,0x07,
+0xFF,0xFC,0x3E,0xE7,0x00,0x00,0x07,0xF2,0xFF,0x00,0xC0,0xF6,0x00,0x19,0x07,0xFF,
+0xF8,0x3F,0x00,0x1F,0x00,0xFF,0xFE,0x0F,0x83,0xE0,0x00,0x07,0xFF,0xFF,0xBF,0xFE,
+0xF8,0x3D,0xFF,0xF0,0x03,0xFF,0xFC,0x3E,0xE7,0x00,0x00,0x1F,0xF2,0xFF,0x00,0xF0,
+0xF6,0x00,0x19,0x03,0xFF,0xE0,0x3F,0x00,0x1F,0x80,0x3F,0xFE,0x0F,0x83,0xE0,0x00,
+0x07,0xFF,0xFF,0x8F,0xFE,0xF8,0x7C,0x7F,0xC0,0x00,0xFF,0xF8,0x3E,0xE7,0x00,0x00,
+0x7F,0xF2,0xFF,0x00,0xFC,0xC2,0x00,0xF1,0xFF,0x00,0xFE,0xC3,0x00,0x00,0x03,0xF0,
+0xFF,0x00,0x80,0xC4,0x00,0x00,0x07,0xF0,0xFF,0x00,0xC0,0xC4,0x00,0x00,0x1F,0xF0,
+0xFF,0x00,0xF0,0xC4,0x00,0x00,0x3F,0xF0,0xFF,0x00,0xF8,0xC4,0x00,0x00,0x7F,0xF0,
+0xFF,0x00,0xFC,0xC5,0x00,0x00,0x01,0xEE,0xFF,0xC5,0x00,0x00,0x03,0xEE,0xFF,0x00,
+0x80,0xC6,0x00,0x00,0x07,0xEE,0xFF,0x00,0xC0,0xC6,0x00,0x00,0x0F,0xEE,0xFF,0x00,
+0xE0,0xC6,0x00,0x00,0x1F,0xEE,0xFF,0x00,0xF0,0xC6,0x00,0x00,0x7F,0xEE,0xFF,0x00,
+0xFC,0xC6,0x00,0xED,0xFF,0x00,0xFE,0xC7,0x00,0x00,0x01,0xEC,0xFF,0xC7,0x00,0x00,
+0x03,0xEC,0xFF,0x00,0x80,0xC8,0x00,0x00,0x07,0xEC,0xFF,0x00,0xC0,0xC8,0x00,0x00,
+0x0F,0xEC,0xFF,0x00,0xE0,0xC8,0x00,0x00,0x1F,0xEC,0xFF,0x00,0xF0,0xC8,0x00,0x00,
+0x3F,0xEC,0xFF,0x00,0xF8,0xC8,0x00,0x00,0x7F,0xEC,0xFF,0x00,0xFC,0xC8,0x00,0xEB,
+0xFF,0x00,0xFE,0xC8,0x00,0xEB,0xFF,0x00,0xFE,0xC9,0x00,0x00,0x01,0xEA,0xFF,0xC9,
+0x00,0x00,0x03,0xEA,0xFF,0x00,0x80,0xCA,0x00,0x00,0x07,0xEA,0xFF,0x00,0xC0,0xCA,
+0x00,0x00,0x0F,0xEA,0xFF,0x00,0xE0,0xCA,0x00,0x00,0x0F,0xEA,0xFF,0x00,0xE0,0xCA,
+0x00,0x00,0x1F,0xEA,0xFF,0x00,0xF0,0xCA,0x00,0x00,0x3F,0xEA,0xFF,0x00,0xF8,0xCA,
+0x00,0x00,0x7F,0xEA,0xFF,0x00,0xFC,0xCA,0x00,0x00,0x7F,0xEA,0xFF,0x00,0xFC,0xCA,
+0x00,0xE9,0xFF,0x00,0xFE,0xCB,0x00,0x00,0x01,0xE8,0xFF,0xCB,0x00,0x00,0x01,0xE8,
+0xFF,0xCB,0x00,0x00,0x03,0xE8,0xFF,0x00,0x80,0xCC,0x00,0x00,0x07,0xE8,0xFF,0x00,
+0xC0,0xCC,0x00,0x00,0x07,0xE8,0xFF,0x00,0xC0,0xCC,0x00,0x00,0x0F,0xE8,0xFF,0x00,
+0xE0,0xCC,0x00,0x00,0x0F,0xE8,0xFF,0x00,0xE0,0xCC,0x00,0x00,0x1F,0xE8,0xFF,0x00,
+0xF0,0xCC,0x00,0x00,0x1F,0xE8,0xFF,0x00,0xF0,0xCC,0x00,0x00,0x3F,0xE8,0xFF,0x00,
+0xF8,0xCC,0x00,0x00,0x3F,0xE8,0xFF,0x00,0xF8,0xCC,0x00,0x00,0x7F,0xE8,0xFF,0x00,
+0xFC,0xCC,0x00,0x00,0x7F,0xE8,0xFF,0x00,0xFC,0xCC,0x00,0xE7,0xFF,0x00,0xFE,0xCC,
+0x00,0xE7,0xFF,0x00,0xFE,0xCD,0x00,0x00,0x01,0xE6,0xFF,0xCD,0x00,0x00,0x01,0xE6,
+0xFF,0xCD,0x00,0x00,0x03,0xFE,0xFF,0x02,0x00,0x00,0x1F,0xEC,0xFF,0x00,0x80,0xCE,
+0x00,0x06,0x03,0xFF,0xFF,0xF0,0x00,0x00,0x03,0xEC,0xFF,0x00,0x80,0xCE,0x00,0x03,
+0x03,0xFF,0xFF,0xC0,0xFE,0x00,0x00,0x7F,0xED,0xFF,0x00,0x80,0xCE,0x00,0x02,0x07,
+0xFF,0xFF,0xFD,0x00,0x00,0x1F,0xED,0xFF,0x00,0xC0,0xCE,0x00,0x02,0x07,0xFF,0xFC,
+0xFD,0x00,0x00,0x07,0xED,0xFF,0x00,0xC0,0xCE,0x00,0x02,0x0F,0xFF,0xF8,0xFD,0x00,
+0x00,0x03,0xED,0xFF,0x00,0xE0,0xCE,0x00,0x07,0x0F,0xFF,0xF8,0x00,0x0F,0xFC,0x00,
+0x03,0xED,0xFF,0x00,0xE0,0xCE,0x00,0x07,0x0F,0xFF,0xF8,0x00,0xFF,0xFF,0xC0,0x03,
+0xED,0xFF,0x00,0xE0,0xCE,0x00,0x07,0x1F,0xFF,0xF8,0x07,0xFF,0xFF,0xF8,0x03,0xED,
+0xFF,0x00,0xF0,0xCE,0x00,0x07,0x1F,0xFF,0xFC,0x1F,0xF0,0x01,0xFF,0x07,0xED,0xFF,
+0x00,0xF0,0xCE,0x00,0x00,0x1F,0xFE,0xFF,0x03,0x00,0x00,0x1F,0xCF,0xED,0xFF,0x00,
+0xF0,0xCE,0x00,0x06,0x1F,0xFF,0xFF,0xFC,0x00,0x00,0x07,0xEC,0xFF,0x00,0xF0,0xCE,
+0x00,0x06,0x3F,0xFF,0xFF,0xF0,0x00,0x00,0x01,0xEC,0xFF,0x00,0xF8,0xCE,0x00,0x03,
+0x3F,0xFF,0xFF,0xE0,0xFE,0x00,0xEC,0xFF,0x00,0xF8,0xCE,0x00,0x06,0x3F,0xFF,0xFF,
+0xE0,0x07,0xFC,0x00,0xEC,0xFF,0x00,0xF8,0xCE,0x00,0x06,0x7F,0xFF,0xFF,0xE0,0x3F,
+0xFF,0x80,0xEC,0xFF,0x00,0xFC,0xCE,0x00,0x06,0x7F,0xFF,0xFF,0xF1,0xFF,0xFF,0xF0,
+0xEC,0xFF,0x00,0xFC,0xCE,0x00,0x00,0x7F,0xFE,0xFF,0x01,0xF0,0x00,0xEB,0xFF,0x00,
+0xFC,0xCE,0x00,0x00,0x7F,0xFE,0xFF,0x02,0x80,0x00,0x3F,0xEC,0xFF,0x00,0xFC,0xCE,
+0x00,0x06,0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x0F,0xEC,0xFF,0x00,0xFC,0xCE,0x00,0xFE,
+0xFF,0x03,0xFE,0x00,0x00,0x0F,0xEC,0xFF,0x00,0xFE,0xCE,0x00,0xFE,0xFF,0x03,0xFE,
+0x0F,0xFE,0x0F,0xEC,0xFF,0x00,0xFE,0xCE,0x00,0xFD,0xFF,0x02,0x3F,0xFF,0x8F,0xEC,
+0xFF,0x00,0xFE,0xCE,0x00,0xE5,0xFF,0x00,0xFE,0xCE,0x00,0xFC,0xFF,0x04,0xBF,0xFF,
+0xE0,0x00,0x07,0xFC,0xFF,0x01,0xFE,0x3F,0xF9,0xFF,0x03,0xE3,0xFF,0xFF,0xFE,0xCE,
+0x00,0xFD,0xFF,0x05,0xFC,0x0F,0xFF,0x00,0x00,0x03,0xFC,0xFF,0x01,0xFE,0x0F,0xF9,
+0xFF,0x03,0xE0,0xFF,0xFF,0xFE,0xCE,0x00,0xFD,0xFF,0x05,0xF8,0x07,0xFC,0x00,0x00,
+0x01,0xFC,0xFF,0x01,0xFE,0x07,0xF9,0xFF,0x03,0xE0,0x7F,0xFF,0xFE,0xCF,0x00,0x00,
+0x01,0xFD,0xFF,0x05,0xF8,0x03,0xF8,0x00,0x00,0x01,0xFC,0xFF,0x01,0xFE,0x03,0xF9,
+0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x05,0xF0,0x03,0xF0,
+0x00,0x00,0x01,0xFC,0xFF,0x01,0xFE,0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,
+0x00,0x00,0x01,0xFD,0xFF,0x05,0xF0,0x03,0xE0,0x00,0x00,0x01,0xFC,0xFF,0x01,0xFE,
+0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x03,0xF0,
+0x03,0xE0,0x03,0xFA,0xFF,0x01,0xFE,0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,
+0x00,0x00,0x01,0xFD,0xFF,0x05,0xF8,0x03,0xC0,0x1F,0xFE,0x01,0xFC,0xFF,0x01,0xFE,
+0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x05,0xFC,
+0x07,0xC0,0x3F,0xFE,0x01,0xFC,0xFF,0x01,0xFE,0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,
+0xFF,0xCF,0x00,0x00,0x01,0xFB,0xFF,0x03,0xC0,0x3F,0xFE,0x01,0xFC,0xFF,0x01,0xFE,
+0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x05,0xFE,
+0x1F,0xC0,0x7F,0xFE,0x01,0xFC,0xFF,0x01,0xFE,0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,
+0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x05,0xFC,0x07,0xC0,0x7F,0xFE,0x01,0xFC,0xFF,
+0x01,0xFE,0x03,0xF9,0xFF,0x03,0xE0,0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,
+0x05,0xF8,0x07,0xC0,0x7F,0xFE,0x01,0xFC,0xFF,0x01,0xFE,0x03,0xF9,0xFF,0x03,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x0E,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xFF,0xF8,0x00,0x7F,0xFE,0x03,0xE0,0x01,0xFE,0xFF,0x06,0x00,0x07,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xFF,0xC0,0x00,0x0F,0xFE,0x03,0x00,0x00,0x3F,0xFF,0xFC,0x00,0x00,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xFF,0x00,0x00,0x03,0xFE,0x03,0x00,0x00,0x1F,0xFF,0xF0,0x00,0x00,0x7F,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xFE,0x00,0x00,0x01,0xFE,0x03,0x00,0x00,0x07,0xFF,0xE0,0x00,0x00,0x1F,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x07,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xFC,0xFE,0x00,0x0D,0xFE,0x03,0x00,0x00,0x03,0xFF,0xC0,0x00,0x00,0x0F,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x07,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xF8,0xFE,0x00,0x05,0x7E,0x03,0x00,0x00,0x01,0xFF,0xFE,0x00,0x04,0x07,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x00,0x06,0x01,
+0xFF,0xF0,0x01,0xFF,0x00,0x3E,0x03,0x0F,0xF8,0x00,0xFF,0x00,0x3F,0xE0,0x03,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,
+0xFF,0xE0,0x07,0xFF,0xC0,0x1E,0x03,0x3F,0xFE,0x00,0x7E,0x00,0xFF,0xF8,0x01,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,
+0xFF,0xE0,0x1F,0xFF,0xE0,0x0E,0x03,0xFF,0xFF,0x80,0x7C,0x01,0xFF,0xF0,0x00,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,
+0xFF,0xC0,0x1F,0xFF,0xF0,0x0E,0x03,0xFF,0xFF,0xC0,0x3C,0x03,0xFF,0xC0,0x00,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,
+0xFF,0xC0,0x3F,0xFF,0xF8,0x0E,0x03,0xFF,0xFF,0xC0,0x38,0x03,0xFF,0x00,0x03,0xE0,
+0x3F,0xFF,0xFF,0xCF,0x00,0x00,0x01,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,
+0xFF,0x80,0x7F,0xFF,0xF8,0x06,0x03,0xFF,0xFF,0xE0,0x18,0x07,0xFC,0x00,0x1F,0xE0,
+0x3F,0xFF,0xFF,0xCE,0x00,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,0xFF,0x80,
+0x7F,0xFF,0xF8,0x06,0x03,0xFF,0xFF,0xE0,0x18,0x07,0xE0,0x00,0x7F,0xE0,0x3F,0xFF,
+0xFE,0xCE,0x00,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,0xFF,0x80,0x7F,0xFF,
+0xF8,0x06,0x03,0xFF,0xFF,0xE0,0x18,0x0F,0xC0,0x01,0xFF,0xE0,0x3F,0xFF,0xFE,0xCE,
+0x00,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,0xFF,0x80,0x7F,0xFF,0xFC,0x06,
+0x03,0xFF,0xFF,0xE0,0x18,0x0F,0xC0,0x07,0xFF,0xE0,0x3F,0xFF,0xFE,0xCE,0x00,0xFD,
+0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFE,0x01,0xFF,0x80,0x7F,0xFF,0xFC,0x06,0x03,0xFF,
+0xFF,0xE0,0x18,0x0F,0xC0,0x1F,0xFF,0xE0,0x3F,0xFF,0xFE,0xCE,0x00,0xFD,0xFF,0x18,
+0xF8,0x03,0xC0,0x7F,0xFE,0x01,0xFF,0x80,0x7F,0xFF,0xFC,0x06,0x01,0xFF,0xFF,0xE0,
+0x18,0x0F,0xC0,0x7F,0xFF,0xE0,0x3F,0xFF,0xFE,0xCE,0x00,0xFD,0xFF,0x18,0xF8,0x03,
+0xC0,0x7F,0xFE,0x01,0xFF,0x80,0x7F,0xFF,0xFC,0x06,0x01,0xFF,0xFF,0xE0,0x18,0x07,
+0xE1,0xFF,0x80,0x60,0x3F,0xFF,0xFE,0xCE,0x00,0xFD,0xFF,0x18,0xF8,0x03,0xC0,0x7F,
+0xFF,0x00,0xFF,0x80,0x7F,0xFF,0xFC,0x06,0x01,0xFF,0xFF,0xE0,0x18,0x07,0xFF,0xFF,
+0x00,0x60,0x3F,0xFF,0xFE,0xCE,0x00,0x00,0x7F,0xFE,0xFF,0x18,0xF8,0x03,0xC0,0x7F,
+0xFF,0x00,0xFF,0xC0,0x3F,0xFF,0xFC,0x07,0x01,0xFF,0xFF,0xC0,0x38,0x03,0xFF,0xFF,
+0x00,0xE0,0x3F,0xFF,0xFC,0xCE,0x00,0x00,0x7F,0xFE,0xFF,0x18,0xF8,0x03,0xC0,0x7F,
+0xFF,0x00,0x7F,0xC0,0x1F,0xFF,0xFC,0x07,0x00,0xFF,0xFF,0xC0,0x3C,0x03,0xFF,0xFE,
+0x00,0xE0,0x3F,0xFF,0xFC,0xCE,0x00,0x00,0x7F,0xFE,0xFF,0x18,0xF8,0x03,0xC0,0x7F,
+0xFF,0x00,0x3F,0xE0,0x1F,0xFF,0xFC,0x07,0x00,0x7F,0xFF,0x80,0x3C,0x01,0xFF,0xFC,
+0x01,0xE0,0x3F,0xFF,0xFC,0xCE,0x00,0x00,0x7F,0xFE,0xFF,0x18,0xF8,0x03,0xC0,0x7F,
+0xFF,0x80,0x1F,0xE0,0x07,0xFF,0xEC,0x07,0x80,0x3F,0xFF,0x00,0x7E,0x00,0xFF,0xF8,
+0x01,0xE0,0x3F,0xFF,0xFC,0xFC,0x00,0x02,0x03,0xFF,0xFE,0xD6,0x00,0x00,0x7F,0xFE,
+0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFF,0x80,0x01,0xF0,0x01,0xFF,0x8C,0x07,0xC0,0x0F,
+0xFC,0x00,0xFE,0x00,0x3F,0xE0,0x03,0xE0,0x3F,0xFF,0xFC,0xFC,0x00,0x03,0x7F,0xFF,
+0xFF,0xF0,0xD7,0x00,0x00,0x3F,0xFE,0xFF,0x0C,0xF8,0x03,0xC0,0x7F,0xFF,0xC0,0x00,
+0x18,0x00,0x00,0x0C,0x07,0xC0,0xFE,0x00,0x00,0xFF,0xFE,0x00,0x04,0x07,0xE0,0x3F,
+0xFF,0xF8,0xFD,0x00,0x00,0x03,0xFE,0xFF,0x00,0xFE,0xD7,0x00,0x00,0x3F,0xFE,0xFF,
+0x18,0xF8,0x03,0xC0,0x7F,0xFF,0xE0,0x00,0x0C,0x00,0x00,0x0C,0x07,0xE0,0x00,0x00,
+0x01,0xFF,0x80,0x00,0x00,0x0F,0xE0,0x3F,0xFF,0xF8,0xFD,0x00,0x00,0x1F,0xFD,0xFF,
+0x00,0xC0,0xD8,0x00,0x00,0x3F,0xFE,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFF,0xF0,0x00,
+0x06,0x00,0x00,0x0C,0x07,0xF0,0x00,0x00,0x03,0xFF,0xC0,0x00,0x00,0x1F,0xE0,0x3F,
+0xFF,0xF8,0xFD,0x00,0x00,0x7F,0xFD,0xFF,0x00,0xF0,0xD8,0x00,0x00,0x1F,0xFE,0xFF,
+0x18,0xF8,0x03,0xC0,0x7F,0xFF,0xFC,0x00,0x03,0x00,0x00,0x0C,0x07,0xFC,0x00,0x00,
+0x0F,0xFF,0xF0,0x00,0x00,0x3F,0xE0,0x3F,0xFF,0xF0,0xFE,0x00,0x00,0x01,0xFC,0xFF,
+0x00,0xFC,0xD8,0x00,0x00,0x1F,0xFE,0xFF,0x18,0xF8,0x03,0xC0,0x7F,0xFF,0xFF,0x00,
+0x00,0xC0,0x00,0x0C,0x07,0xFF,0x00,0x00,0x1F,0xFF,0xFC,0x00,0x00,0xFF,0xE0,0x3F,
+0xFF,0xF0,0xFE,0x00,0x00,0x07,0xFB,0xFF,0xD8,0x00,0x00,0x1F,0xFE,0xFF,0x0E,0xF8,
+0x03,0xC0,0x7F,0xFF,0xFF,0xE0,0x00,0x70,0x00,0x3C,0x07,0xFF,0xC0,0x00,0xFE,0xFF,
+0x06,0x00,0x03,0xFF,0xE0,0x3F,0xFF,0xF0,0xFE,0x00,0x00,0x1F,0xFB,0xFF,0x00,0xC0,
+0xD9,0x00,0x00,0x1F,0xE6,0xFF,0x00,0xF0,0xFE,0x00,0x00,0x3F,0xFB,0xFF,0x00,0xE0,
+0xD9,0x00,0x00,0x0F,0xE6,0xFF,0x00,0xE0,0xFE,0x00,0x00,0x7F,0xFB,0xFF,0x00,0xF0,
+0xD9,0x00,0x00,0x0F,0xE6,0xFF,0x03,0xE0,0x00,0x00,0x01,0xFA,0xFF,0x00,0xFC,0xD9,
+0x00,0x00,0x0F,0xE6,0xFF,0x03,0xE0,0x00,0x00,0x03,0xFA,0xFF,0x00,0xFE,0xD9,0x00,
+0x00,0x07,0xE6,0xFF,0x03,0xC0,0x00,0x00,0x07,0xF9,0xFF,0xD9,0x00,0x00,0x07,0xE6,
+0xFF,0x03,0xC0,0x00,0x00,0x0F,0xF9,0xFF,0x00,0x80,0xDA,0x00,0x00,0x03,0xE6,0xFF,
+0x03,0x80,0x00,0x00,0x1F,0xF9,0xFF,0x00,0xC0,0xDA,0x00,0x00,0x03,0xE6,0xFF,0x03,
+0x80,0x00,0x00,0x3F,0xF9,0xFF,0x00,0xE0,0xDA,0x00,0x00,0x03,0xE6,0xFF,0x03,0x80,
+0x00,0x00,0x7F,0xF9,0xFF,0x00,0xF0,0xDA,0x00,0x00,0x01,0xE6,0xFF,0xFE,0x00,0xF8,
+0xFF,0x00,0xF8,0xDA,0x00,0x00,0x01,0xE6,0xFF,0x02,0x00,0x00,0x01,0xF8,0xFF,0x00,
+0xFC,0xD9,0x00,0xE7,0xFF,0x03,0xFE,0x00,0x00,0x01,0xF8,0xFF,0x00,0xFC,0xD9,0x00,
+0xE7,0xFF,0x03,0xFE,0x00,0x00,0x03,0xF8,0xFF,0x00,0xFE,0xD9,0x00,0x00,0x7F,0xE8,
+0xFF,0x03,0xFC,0x00,0x00,0x07,0xF7,0xFF,0xD9,0x00,0x00,0x7F,0xE8,0xFF,0x03,0xFC,
+0x00,0x00,0x07,0xF7,0xFF,0xD9,0x00,0x00,0x3F,0xE8,0xFF,0x03,0xF8,0x00,0x00,0x0F,
+0xF7,0xFF,0x00,0x80,0xDA,0x00,0x00,0x3F,0xE8,0xFF,0x03,0xF8,0x00,0x00,0x0F,0xF7,
+0xFF,0x00,0x80,0xDA,0x00,0x00,0x1F,0xE8,0xFF,0x03,0xF0,0x00,0x00,0x1F,0xF7,0xFF,
+0x00,0xC0,0xDA,0x00,0x00,0x1F,0xE8,0xFF,0x03,0xF0,0x00,0x00,0x1F,0xF7,0xFF,0x00,
+0xC0,0xDA,0x00,0x00,0x0F,0xE8,0xFF,0x03,0xE0,0x00,0x00,0x3F,0xF7,0xFF,0x00,0xE0,
+0xDA,0x00,0x00,0x0F,0xE8,0xFF,0x05,0xE0,0x00,0x00,0x3F,0xE0,0x3F,0xF9,0xFF,0x00,
+0xE0,0xDA,0x00,0x00,0x07,0xE8,0xFF,0x05,0xC0,0x00,0x00,0x7F,0x00,0x07,0xF9,0xFF,
+0x00,0xF0,0xDA,0x00,0x00,0x07,0xE8,0xFF,0x05,0xC0,0x00,0x00,0x7C,0x00,0x01,0xF9,
+0xFF,0x00,0xF0,0xDA,0x00,0x00,0x03,0xE8,0xFF,0x05,0x80,0x00,0x00,0x7C,0x7F,0xE1,
+0xF9,0xFF,0x00,0xF0,0xDA,0x00,0x00,0x01,0xE8,0xFF,0xFE,0x00,0x02,0xFF,0xFF,0xFD,
+0xF9,0xFF,0x00,0xF8,0xDA,0x00,0x00,0x01,0xE8,0xFF,0xFE,0x00,0x02,0xFF,0xC0,0x1F,
+0xF9,0xFF,0x00,0xF8,0xD9,0x00,0xE9,0xFF,0x00,0xFE,0xFE,0x00,0x02,0xFF,0x0F,0x87,
+0xF9,0xFF,0x00,0xF8,0xD9,0x00,0x00,0x7F,0xEA,0xFF,0x00,0xFC,0xFE,0x00,0xF6,0xFF,
+0x00,0xF8,0xD9,0x00,0x00,0x7F,0xEA,0xFF,0x06,0xFC,0x00,0x00,0x01,0xFF,0xE0,0x3F,
+0xF9,0xFF,0x00,0xFC,0xD9,0x00,0x00,0x3F,0xEA,0xFF,0x06,0xF8,0x00,0x00,0x01,0xFF,
+0xCF,0x9F,0xF9,0xFF,0x00,0xFC,0xD9,0x00,0x00,0x1F,0xEA,0xFF,0x03,0xF0,0x00,0x00,
+0x01,0xF6,0xFF,0x00,0xFC,0xD9,0x00,0x00,0x0F,0xEA,0xFF,0x0A,0xE0,0x00,0x00,0x01,
+0xFF,0xFD,0xFC,0x03,0xFF,0xFF,0xF3,0xFE,0xFF,0x01,0xFD,0xFC,0xD9,0x00,0x00,0x0F,
+0xEA,0xFF,0x0A,0xE0,0x00,0x00,0x01,0xFF,0xF8,0xF0,0x01,0xFF,0xFF,0xF1,0xFE,0xFF,
+0x01,0xFC,0xFC,0xD9,0x00,0x00,0x07,0xEA,0xFF,0x06,0xC0,0x00,0x00,0x01,0xFF,0xF0,
+0xE1,0xFE,0xFF,0x00,0xF1,0xFE,0xFF,0x01,0xFC,0xFC,0xD9,0x00,0x00,0x03,0xEA,0xFF,
+0x0A,0x80,0x00,0x00,0x01,0xFF,0xFE,0xC3,0xF1,0xFF,0xFF,0xF1,0xFE,0xFF,0x01,0xFC,
+0xFC,0xD9,0x00,0x00,0x01,0xEA,0xFF,0xFE,0x00,0x07,0x01,0xFF,0xFF,0xC7,0xF1,0xFF,
+0xFF,0xF1,0xFE,0xFF,0x01,0xFC,0xFC,0xD8,0x00,0xEB,0xFF,0x00,0xFE,0xFE,0x00,0x07,
+0x01,0xFF,0xF8,0xC7,0xF1,0xFF,0xFF,0xF1,0xFE,0xFF,0x01,0xFC,0xFC,0xD8,0x00,0xEB,
+0xFF,0x00,0xFE,0xFE,0x00,0x0C,0x01,0xFF,0xF8,0xC0,0x31,0xFE,0x01,0xF1,0x80,0xFF,
+0x80,0x7C,0xFC,0xD8,0x00,0x00,0x7F,0xEC,0xFF,0x00,0xFC,0xFE,0x00,0x0C,0x01,0xFF,
+0xF8,0xC0,0x11,0xFC,0x00,0x71,0x80,0x7E,0x00,0x3C,0xFC,0xD8,0x00,0x00,0x3F,0xEC,
+0xFF,0x00,0xF8,0xFE,0x00,0x0C,0x01,0xFF,0xF8,0xC3,0xF1,0xF8,0x7C,0x31,0xFE,0x3C,
+0x3E,0x1C,0xFC,0xD8,0x00,0x00,0x1F,0xEC,0xFF,0x00,0xF0,0xFE,0x00,0x0C,0x01,0xFF,
+0xF8,0xC7,0xF1,0xF1,0xFE,0x31,0xFF,0x1C,0x7E,0x0C,0xFC,0xD8,0x00,0x00,0x0F,0xEC,
+0xFF,0x00,0xE0,0xFE,0x00,0x0C,0x01,0xFF,0xF8,0xC7,0xF1,0xF1,0xFF,0x11,0xFF,0x88,
+0xF8,0x3C,0xFC,0xD8,0x00,0x00,0x07,0xEC,0xFF,0x00,0xC0,0xFE,0x00,0x0C,0x01,0xFF,
+0xF8,0xC7,0xF1,0xF1,0xFF,0x11,0xFF,0x88,0xE0,0xFC,0xFC,0xD8,0x00,0x00,0x03,0xEC,
+0xFF,0x00,0x80,0xFD,0x00,0x0B,0xFF,0xF8,0xC7,0xF1,0xF1,0xFF,0x11,0xFF,0x88,0xE3,
+0xFC,0xF8,0xD8,0x00,0x00,0x01,0xEC,0xFF,0xFC,0x00,0x0B,0xFF,0xF8,0xC7,0xF1,0xF1,
+0xFF,0x19,0xFF,0x88,0xFF,0x8C,0xF8,0xD7,0x00,0xED,0xFF,0x00,0xFE,0xFC,0x00,0x0B,
+0xFF,0xF8,0xC7,0xF1,0xF1,0xFF,0x18,0xFF,0x18,0x7F,0x8C,0xF8,0xFC,0x00,0x02,0x0F,
+0xFF,0x80,0xDF,0x00,0x00,0x7F,0xEE,0xFF,0x00,0xFC,0xFC,0x00,0x0B,0xFF,0xF8,0xC7,
+0xF8,0xF8,0xFF,0x18,0x7E,0x1C,0x3F,0x1C,0xF8,0xFC,0x00,0x02,0xFF,0xFF,0xF8,0xDF,
+0x00,0x00,0x1F,0xEE,0xFF,0x00,0xF0,0xFC,0x00,0x0B,0x7F,0xF8,0xC7,0xF8,0x0C,0x11,
+0x1C,0x18,0x3E,0x08,0x1C,0xF0,0xFD,0x00,0x00,0x07,0xFE,0xFF,0xDF,0x00,0x00,0x0F,
+0xEE,0xFF,0x00,0xE0,0xFC,0x00,0x0B,0x7F,0xF8,0xC7,0xFE,0x06,0x01,0x1E,0x00,0x7F,
+0x00,0x7C,0xF0,0xFD,0x00,0x00,0x1F,0xFE,0xFF,0x00,0xC0,0xE0,0x00,0x00,0x07,0xEE,
+0xFF,0x00,0xC0,0xFC,0x00,0x00,0x7F,0xFD,0xFF,0x06,0x87,0xFF,0xC3,0xFF,0xC1,0xFF,
+0xF0,0xFD,0x00,0x00,0x3F,0xFE,0xFF,0x00,0xE0,0xE0,0x00,0x00,0x03,0xEE,0xFF,0x00,
+0x80,0xFC,0x00,0x00,0x3F,0xF7,0xFF,0x00,0xE0,0xFD,0x00,0xFD,0xFF,0x00,0xF8,0xE0,
+0x00,0x00,0x01,0xEE,0xFF,0xFB,0x00,0x00,0x3F,0xF7,0xFF,0x00,0xE0,0xFE,0x00,0x00,
+0x01,0xFD,0xFF,0x00,0xFC,0xDF,0x00,0x00,0x7F,0xF0,0xFF,0x00,0xFC,0xFB,0x00,0x00,
+0x1F,0xF7,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x03,0xFD,0xFF,0x00,0xFE,0xDF,0x00,0x00,
+0x3F,0xF0,0xFF,0x00,0xF8,0xFB,0x00,0x00,0x1F,0xF7,0xFF,0x00,0xC0,0xFE,0x00,0x00,
+0x07,0xFC,0xFF,0xDF,0x00,0x00,0x1F,0xF0,0xFF,0x00,0xF0,0xFB,0x00,0x00,0x0F,0xF7,
+0xFF,0x00,0x80,0xFE,0x00,0x00,0x0F,0xFC,0xFF,0x00,0x80,0xE0,0x00,0x00,0x07,0xF0,
+0xFF,0x00,0xC0,0xFB,0x00,0x00,0x0F,0xF7,0xFF,0x00,0x80,0xFE,0x00,0x00,0x1F,0xFC,
+0xFF,0x00,0xC0,0xE0,0x00,0x00,0x03,0xF0,0xFF,0x00,0x80,0xFB,0x00,0x00,0x07,0xF7,
+0xFF,0xFD,0x00,0x00,0x1F,0xFC,0xFF,0x00,0xC0,0xDF,0x00,0xF1,0xFF,0x00,0xFE,0xFA,
+0x00,0x00,0x07,0xF7,0xFF,0xFD,0x00,0x00,0x3F,0xFC,0xFF,0x00,0xE0,0xDF,0x00,0x00,
+0x7F,0xF2,0xFF,0x00,0xFC,0xFA,0x00,0x00,0x03,0xF8,0xFF,0x00,0xFE,0xFD,0x00,0x00,
+0x3F,0xFC,0xFF,0x00,0xE0,0xDF,0x00,0x00,0x1F,0xF2,0xFF,0x00,0xF0,0xFA,0x00,0x00,
+0x01,0xF8,0xFF,0x00,0xFC,0xFD,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xF0,0xDF,0x00,0x00,
+0x07,0xF2,0xFF,0x00,0xC0,0xFA,0x00,0x00,0x01,0xF8,0xFF,0x00,0xFC,0xFD,0x00,0x00,
+0x7F,0xFC,0xFF,0x00,0xF0,0xDF,0x00,0x00,0x03,0xF2,0xFF,0x00,0x80,0xF9,0x00,0xF8,
+0xFF,0x00,0xF8,0xFD,0x00,0xFB,0xFF,0x00,0xF8,0xDE,0x00,0xF3,0xFF,0x00,0xFE,0xF8,
+0x00,0x00,0x7F,0xF9,0xFF,0x00,0xF0,0xFD,0x00,0xFB,0xFF,0x00,0xF8,0xDE,0x00,0x00,
+0x3F,0xF4,0xFF,0x00,0xF8,0xF8,0x00,0x00,0x3F,0xF9,0xFF,0x00,0xE0,0xFD,0x00,0xFB,
+0xFF,0x00,0xF8,0xDE,0x00,0x00,0x0F,0xF4,0xFF,0x00,0xE0,0xF8,0x00,0x00,0x1F,0xF9,
+0xFF,0x00,0xC0,0xFD,0x00,0xFB,0xFF,0x00,0xF8,0xDE,0x00,0x00,0x03,0xF4,0xFF,0x00,
+0x80,0xF8,0x00,0x00,0x0F,0xF9,0xFF,0x00,0x80,0xFD,0x00,0xFB,0xFF,0x00,0xF8,0xDD,
+0x00,0xF5,0xFF,0x00,0xFE,0xF7,0x00,0x00,0x07,0xF9,0xFF,0xFC,0x00,0xFB,0xFF,0x00,
+0xF8,0xDD,0x00,0x00,0x1F,0xF6,0xFF,0x00,0xF0,0xF7,0x00,0x00,0x03,0xFA,0xFF,0x00,
+0xFE,0xFC,0x00,0xFB,0xFF,0x00,0xF8,0xDD,0x00,0x00,0x07,0xF6,0xFF,0x00,0xC0,0xF7,
+0x00,0x00,0x01,0xFA,0xFF,0x00,0xFC,0xFC,0x00,0xFB,0xFF,0x00,0xF8,0xDC,0x00,0xF7,
+0xFF,0x00,0xFE,0xF5,0x00,0x00,0x7F,0xFB,0xFF,0x00,0xF0,0xFC,0x00,0xFB,0xFF,0x00,
+0xF8,0xDC,0x00,0x00,0x1F,0xF8,0xFF,0x00,0xF0,0xF5,0x00,0x00,0x3F,0xFB,0xFF,0x00,
+0xE0,0xFC,0x00,0xFB,0xFF,0x00,0xF8,0xDC,0x00,0x00,0x03,0xF8,0xFF,0x00,0x80,0xF5,
+0x00,0x00,0x1F,0xFB,0xFF,0x00,0xC0,0xFC,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xF0,0xDB,
+0x00,0x00,0x7F,0xFA,0xFF,0x00,0xFC,0xF4,0x00,0x00,0x07,0xFB,0xFF,0xFB,0x00,0x00,
+0x7F,0xFC,0xFF,0x00,0xF0,0xDB,0x00,0x00,0x07,0xFA,0xFF,0x00,0xC0,0xF4,0x00,0x00,
+0x01,0xFC,0xFF,0x00,0xFC,0xFB,0x00,0x00,0x3F,0xFC,0xFF,0x00,0xE0,0xDA,0x00,0x00,
+0x7F,0xFC,0xFF,0x00,0xFC,0xF2,0x00,0x00,0x7F,0xFD,0xFF,0x00,0xF0,0xFB,0x00,0x00,
+0x3F,0xFC,0xFF,0x00,0xE0,0xDA,0x00,0x00,0x01,0xFC,0xFF,0xF1,0x00,0x00,0x1F,0xFD,
+0xFF,0x00,0xC0,0xFB,0x00,0x00,0x1F,0xFC,0xFF,0x00,0xC0,0xD9,0x00,0x00,0x03,0xFE,
+0xFF,0x00,0x80,0xF1,0x00,0x00,0x03,0xFE,0xFF,0x00,0xFE,0xFA,0x00,0x00,0x1F,0xFC,
+0xFF,0x00,0xC0,0xC3,0x00,0x03,0x7F,0xFF,0xFF,0xF0,0xFA,0x00,0x00,0x0F,0xFC,0xFF,
+0x00,0x80,0xC3,0x00,0x02,0x03,0xFF,0xFE,0xF9,0x00,0x00,0x07,0xFC,0xFF,0xB7,0x00,
+0x00,0x03,0xFD,0xFF,0x00,0xFE,0xB7,0x00,0x00,0x01,0xFD,0xFF,0x00,0xFC,0xB6,0x00,
+0xFD,0xFF,0x00,0xF8,0xB6,0x00,0x00,0x3F,0xFE,0xFF,0x00,0xE0,0xB6,0x00,0x00,0x1F,
+0xFE,0xFF,0x00,0xC0,0xB6,0x00,0x00,0x07,0xFE,0xFF,0xB4,0x00,0x02,0xFF,0xFF,0xF8,
+0xB4,0x00,0x02,0x0F,0xFF,0x80,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0xC1,0x00,0x02,0x7F,0xFC,0xF0,0xF8,0x00,0x05,0x07,0x80,0x00,0x00,0x7F,
+0x8F,0xFE,0x00,0x06,0x1E,0x1F,0x80,0x70,0x00,0x00,0x0F,0xFE,0x00,0x00,0x1C,0xD1,
+0x00,0x02,0x7F,0xFC,0xF0,0xF8,0x00,0x05,0x07,0x80,0x00,0x00,0xFF,0x8F,0xFE,0x00,
+0x06,0x1E,0x3F,0xC0,0x70,0x00,0x00,0x0F,0xFE,0x00,0x00,0x1C,0xD1,0x00,0x02,0x7F,
+0xFC,0xF0,0xFE,0x00,0x00,0x1C,0xFC,0x00,0x05,0x07,0x80,0x00,0x01,0xFF,0x8F,0xFE,
+0x00,0x06,0x1E,0x3F,0xC0,0x70,0x00,0x00,0x0F,0xFE,0x00,0x00,0x1C,0xD1,0x00,0x02,
+0x70,0x00,0xF0,0xFE,0x00,0x00,0x3C,0xF9,0x00,0x02,0x03,0xE1,0x8F,0xFE,0x00,0x06,
+0x1E,0x38,0x00,0xF0,0x00,0x00,0x0F,0xFE,0x00,0x00,0x1C,0xD1,0x00,0x02,0x78,0x00,
+0xF0,0xFE,0x00,0x00,0x3C,0xF9,0x00,0x02,0x03,0xC0,0x0E,0xFE,0x00,0x06,0x1E,0x38,
+0x00,0xF0,0x00,0x00,0x0F,0xFE,0x00,0x00,0x1C,0xD1,0x00,0x1F,0x70,0x00,0xF0,0x7F,
+0x01,0xFF,0xFF,0xBF,0xE1,0xFE,0x0F,0x7F,0x07,0x83,0xFC,0x03,0xC0,0x0E,0xFF,0x01,
+0xFE,0x1E,0xFF,0x80,0xF0,0x03,0xFF,0x0F,0xFE,0x01,0xFE,0x1C,0xD1,0x00,0x1F,0xF0,
+0x00,0xF1,0xFF,0x83,0xFF,0xFF,0xBF,0xE7,0xFF,0x0F,0xFF,0x87,0x0F,0xFC,0x03,0xE0,
+0x0F,0xFF,0x83,0xFF,0x1E,0xFF,0x80,0xF0,0x03,0xFF,0x8F,0xFF,0x83,0xFF,0x1C,0xD1,
+0x00,0x1F,0xF0,0x00,0xE3,0xF7,0xC7,0xFF,0xFF,0xBF,0xE7,0xFF,0x8F,0xFF,0xC7,0x1F,
+0xFC,0x01,0xF0,0x0F,0xFF,0xC7,0xCF,0x9E,0xFF,0x80,0xF0,0x03,0xC7,0xCF,0xFF,0x87,
+0xCF,0x9C,0xD1,0x00,0x1F,0xFF,0xF8,0xE3,0xC1,0xEF,0x80,0x38,0x3E,0x0F,0x07,0xCF,
+0x83,0xC7,0x1E,0x00,0x00,0xF8,0x0F,0x83,0xCF,0x07,0x9E,0x78,0x00,0xF0,0x00,0x03,
+0xCF,0x03,0xCF,0x07,0x9C,0xD1,0x00,0x1F,0xFF,0xF8,0xE7,0x81,0xEF,0x00,0x38,0x3C,
+0x1E,0x03,0xCF,0x03,0xC7,0x3C,0x00,0x00,0x7C,0x0F,0x03,0xCE,0x03,0x9E,0x78,0x00,
+0xF0,0x00,0x03,0xCF,0x03,0xCE,0x03,0x9C,0xD1,0x00,0x1F,0xFF,0xF8,0xE7,0xFF,0xEF,
+0x00,0x38,0x3C,0x1E,0x03,0xCF,0x03,0xC7,0x3C,0x00,0x00,0x3E,0x0F,0x03,0xCF,0xFF,
+0x9C,0x78,0x00,0xF0,0x00,0x1F,0xCF,0x01,0xCF,0xFF,0x9C,0xD1,0x00,0x1F,0xF0,0x00,
+0xE7,0xFF,0xEE,0x00,0x38,0x3C,0x1E,0x03,0xCF,0x03,0xC7,0x3C,0x00,0x00,0x1F,0x0E,
+0x03,0xDF,0xFF,0x9C,0x78,0x00,0xF0,0x00,0xFF,0xCF,0x01,0xFF,0xFF,0x9C,0xD1,0x00,
+0x1F,0xF0,0x00,0xE7,0x80,0x0E,0x00,0x38,0x3C,0x1E,0x03,0xCE,0x03,0xCF,0x38,0x00,
+0x00,0x0F,0x8E,0x03,0xDE,0x00,0x1C,0x78,0x00,0xF0,0x03,0xFF,0xCF,0x01,0xFE,0x00,
+0x1C,0xD1,0x00,0x1F,0xF0,0x00,0xE7,0x80,0x0E,0x00,0x38,0x3C,0x1E,0x03,0xCE,0x03,
+0xCF,0x3C,0x00,0x00,0x07,0x8E,0x03,0xDE,0x00,0x1C,0x78,0x00,0xF0,0x07,0xE3,0x8F,
+0x01,0xDE,0x00,0x1C,0xD1,0x00,0x1F,0xF0,0x01,0xE7,0x80,0x0E,0x00,0x38,0x38,0x1E,
+0x03,0xCE,0x03,0xCF,0x3C,0x00,0x00,0x03,0xDE,0x03,0xCE,0x00,0x1C,0x78,0x00,0xF0,
+0x0F,0x03,0x8F,0x03,0xCE,0x00,0x1C,0xD1,0x00,0x1F,0xF0,0x01,0xE7,0x80,0x0F,0x00,
+0x38,0x38,0x1E,0x03,0xCE,0x03,0xCF,0x3C,0x00,0x00,0x03,0xDE,0x03,0xCF,0x00,0x1C,
+0x78,0x00,0xF0,0x0F,0x03,0x8F,0x03,0xCF,0x00,0x1C,0xD1,0x00,0x1F,0xF0,0x01,0xE3,
+0xC0,0x4F,0x80,0x38,0x38,0x0F,0x07,0x8E,0x03,0xCF,0x1E,0x04,0x07,0x07,0x9E,0x03,
+0xCF,0x81,0x1C,0x78,0x00,0xF0,0x0F,0x03,0x8F,0x87,0xCF,0x81,0x1C,0xD1,0x00,0x1F,
+0xFF,0xF9,0xE3,0xFF,0xC7,0xFE,0x3F,0xB8,0x0F,0xFF,0x1E,0x03,0xCF,0x1F,0xFC,0x07,
+0xFF,0x9E,0x03,0xC7,0xFF,0x3C,0x78,0x00,0xFF,0xFF,0x9F,0x8F,0xFF,0x87,0xFF,0x3C,
+0xD1,0x00,0x1F,0xFF,0xF9,0xE1,0xFF,0xC3,0xFE,0x3F,0xB8,0x07,0xFE,0x1E,0x03,0xCF,
+0x0F,0xF8,0x03,0xFF,0x1E,0x03,0xC3,0xFF,0x3C,0x78,0x00,0xFF,0xF7,0xFB,0x8F,0xFF,
+0x03,0xFF,0x3C,0xD1,0x00,0x1F,0xFF,0xF9,0xE0,0x7F,0x81,0xFE,0x1F,0xB8,0x01,0xFC,
+0x1E,0x03,0xCF,0x07,0xF8,0x03,0xFE,0x1E,0x03,0xC1,0xFF,0x3C,0x78,0x00,0xFF,0xF3,
+0xFB,0x8E,0xFE,0x01,0xFF,0x3C,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xD3,0x00,
+};
+
+#endif
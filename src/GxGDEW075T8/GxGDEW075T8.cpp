@@ -17,6 +17,7 @@
 // see http://www.ultrachip.com/en/news.php?id=47
 
 #include "GxGDEW075T8.h"
+#include "../GxIL0371.h"
 
 //#define DISABLE_DIAGNOSTIC_OUTPUT
 
@@ -31,47 +32,34 @@
 
 GxGDEW075T8::GxGDEW075T8(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW075T8_WIDTH, GxGDEW075T8_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#else
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer));
+#endif
 }
 
 void GxGDEW075T8::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW075T8_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW075T8_WIDTH - x - 1;
-      y = GxGDEW075T8_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW075T8_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW075T8_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW075T8_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW075T8_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW075T8_WIDTH / 8;
-  }
+void GxGDEW075T8::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEW075T8::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW075T8::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDEW075T8::init(uint32_t serial_diag_bitrate)
@@ -89,6 +77,7 @@ void GxGDEW075T8::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -96,28 +85,19 @@ void GxGDEW075T8::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW075T8::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW075T8::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t i = 0; i < GxGDEW075T8_BUFFER_SIZE; i++)
-  {
-#if defined(ESP8266)
-    // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
-    // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
-    // if ((i % 10000) == 0) yield(); // avoid watchdog reset
-#endif
-    _send8pixel(i < sizeof(_buffer) ? _buffer[i] : 0x00);
-  }
+  IO.startTransaction();
+  GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, GxGDEW075T8_BUFFER_SIZE);
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -132,6 +112,7 @@ void  GxGDEW075T8::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 void GxGDEW075T8::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true; // remember
@@ -139,20 +120,10 @@ void GxGDEW075T8::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075T8_WIDTH - 1, GxGDEW075T8_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075T8_BUFFER_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _send8pixel(data);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, 4 * GxGDEW075T8_BUFFER_SIZE, false, 0x33); // controller format
+    else GxIL0371::writeBitmap(IO, bitmap, size, GxGDEW075T8_BUFFER_SIZE, mode & bm_invert, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     IO.writeCommandTransaction(0x92); // partial out
@@ -162,25 +133,10 @@ void GxGDEW075T8::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075T8_BUFFER_SIZE; i++)
-    {
-#if defined(ESP8266)
-      // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
-      // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
-      // if ((i % 10000) == 0) yield(); // avoid watchdog reset
-#endif
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _send8pixel(data);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, 4 * GxGDEW075T8_BUFFER_SIZE, false, 0x33); // controller format
+    else GxIL0371::writeBitmap(IO, bitmap, size, GxGDEW075T8_BUFFER_SIZE, mode & bm_invert, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -190,6 +146,7 @@ void GxGDEW075T8::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 void GxGDEW075T8::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
@@ -197,10 +154,9 @@ void GxGDEW075T8::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075T8_WIDTH - 1, GxGDEW075T8_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075T8_BUFFER_SIZE; i++)
-    {
-      _send8pixel(0x00);
-    }
+    IO.startTransaction();
+    GxIL0371::writeWhite(IO, GxGDEW075T8_BUFFER_SIZE);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     IO.writeCommandTransaction(0x92); // partial out
@@ -210,10 +166,9 @@ void GxGDEW075T8::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075T8_BUFFER_SIZE; i++)
-    {
-      _send8pixel(0x00);
-    }
+    IO.startTransaction();
+    GxIL0371::writeWhite(IO, GxGDEW075T8_BUFFER_SIZE);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -222,6 +177,7 @@ void GxGDEW075T8::eraseDisplay(bool using_partial_update)
 
 void GxGDEW075T8::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -256,14 +212,12 @@ void GxGDEW075T8::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW075T8_WIDTH / 8) + x1;
-      _send8pixel((idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
-    }
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, y1 * (GxGDEW075T8_WIDTH / 8) + xs_bx, xe_bx - xs_bx);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("updateWindow");
   IO.writeCommandTransaction(0x92); // partial out
@@ -272,6 +226,7 @@ void GxGDEW075T8::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
 
 void GxGDEW075T8::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
@@ -321,19 +276,18 @@ void GxGDEW075T8::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW075T8_WIDTH / 8) + x1;
-      _send8pixel((idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
-    }
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, y1 * (GxGDEW075T8_WIDTH / 8) + xss_d8, xse_d8 - xss_d8);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
 }
 
 void GxGDEW075T8::powerDown()
 {
+  _finishAsync();
   _using_partial_mode = false; // force _wakeUp()
   _sleep();
 }
@@ -359,15 +313,9 @@ uint16_t GxGDEW075T8::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, ui
 void GxGDEW075T8::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
-  { //=0 BUSY
-    if (digitalRead(_busy) == 1) break;
-     delay(1);
-    if (micros() - start > 10000000)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+  if (!_waitBusy(_busy, LOW, 10000000)) //=0 BUSY
+  {
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -386,19 +334,18 @@ void GxGDEW075T8::_waitWhileBusy(const char* comment)
 
 void GxGDEW075T8::_send8pixel(uint8_t data)
 {
-  for (uint8_t j = 0; j < 8; j++)
-  {
-    uint8_t t = data & 0x80 ? 0x00 : 0x03;
-    t <<= 4;
-    data <<= 1;
-    j++;
-    t |= data & 0x80 ? 0x00 : 0x03;
-    data <<= 1;
-    IO.writeDataTransaction(t);
-  }
+  uint8_t out[4];
+  GxIL0371::expand(out, data);
+  IO.writeData(out, 4, false); // caller holds the transaction
 }
 
 void GxGDEW075T8::_wakeUp()
+{
+  _startWakeUp();
+  _waitWhileBusy();
+}
+
+void GxGDEW075T8::_startWakeUp()
 {
   if (_rst >= 0)
   {
@@ -455,10 +402,16 @@ void GxGDEW075T8::_wakeUp()
   IO.writeDataTransaction(0x03);
 
   IO.writeCommandTransaction(0x04);     //POWER ON
-  _waitWhileBusy();
 }
 
 void GxGDEW075T8::_sleep(void)
+{
+  _startPowerOff();
+  _waitWhileBusy();
+  _deepSleep();
+}
+
+void GxGDEW075T8::_startPowerOff()
 {
   /**********************************flash sleep**********************************/
   IO.writeCommandTransaction(0X65);     //FLASH CONTROL
@@ -471,8 +424,10 @@ void GxGDEW075T8::_sleep(void)
   /**********************************flash sleep**********************************/
 
   IO.writeCommandTransaction(0x02);     // POWER OFF
-  _waitWhileBusy();
+}
 
+void GxGDEW075T8::_deepSleep()
+{
   if (_rst >= 0)
   {
     IO.writeCommandTransaction(0x07);     // DEEP SLEEP
@@ -480,30 +435,71 @@ void GxGDEW075T8::_sleep(void)
   }
 }
 
+bool GxGDEW075T8::isBusy()
+{
+  return (_busy >= 0) && (digitalRead(_busy) == 0); //=0 BUSY, no BUSY pin: never
+}
+
+#if GxEPD_ASYNC_UPDATE
+bool GxGDEW075T8::_asyncPowerOn()
+{
+  if (_current_page != -1) return false;
+  _using_partial_mode = false;
+  _startWakeUp();
+  return true;
+}
+
+bool GxGDEW075T8::_asyncTransfer()
+{
+  if (_async_index == 0) IO.writeCommandTransaction(0x10);
+  uint32_t end = _async_index + GxEPD_ASYNC_CHUNK;
+  if (end > GxGDEW075T8_BUFFER_SIZE) end = GxGDEW075T8_BUFFER_SIZE;
+  IO.startTransaction();
+  GxIL0371::writePixels(IO, _fb_black, _fb_size, _async_index, end - _async_index);
+  _async_index = end;
+  IO.endTransaction();
+  return _async_index < GxGDEW075T8_BUFFER_SIZE;
+}
+
+void GxGDEW075T8::_asyncRefresh()
+{
+  IO.writeCommandTransaction(0x12); //display refresh
+}
+
+void GxGDEW075T8::_asyncPowerOff()
+{
+  _startPowerOff();
+}
+
+void GxGDEW075T8::_asyncSleep()
+{
+  _deepSleep();
+}
+#endif
+
 void GxGDEW075T8::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW075T8_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075T8_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW075T8_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback();
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -512,27 +508,26 @@ void GxGDEW075T8::drawPaged(void (*drawCallback)(void))
 void GxGDEW075T8::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW075T8_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075T8_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW075T8_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -541,27 +536,26 @@ void GxGDEW075T8::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW075T8::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW075T8_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075T8_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW075T8_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -570,27 +564,26 @@ void GxGDEW075T8::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW075T8::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW075T8_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075T8_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW075T8_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -620,6 +613,7 @@ void GxGDEW075T8::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -627,19 +621,23 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075T8_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075T8_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW075T8_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075T8_PU_DELAY); // don't stress this display
@@ -648,6 +646,7 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
 void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -655,19 +654,23 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075T8_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075T8_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW075T8_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075T8_PU_DELAY); // don't stress this display
@@ -676,6 +679,7 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
 void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -683,19 +687,23 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075T8_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075T8_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW075T8_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075T8_PU_DELAY); // don't stress this display
@@ -704,6 +712,7 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
 void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -711,19 +720,23 @@ void GxGDEW075T8::drawPagedToWindow(void (*drawCallback)(const void*, const void
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075T8_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075T8_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075T8_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW075T8_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075T8_PU_DELAY); // don't stress this display
@@ -733,6 +746,7 @@ void GxGDEW075T8::drawCornerTest(uint8_t em)
 {
   _wakeUp();
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW075T8_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW075T8_WIDTH / 8; x++)
@@ -745,6 +759,7 @@ void GxGDEW075T8::drawCornerTest(uint8_t em)
       _send8pixel(~data);
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
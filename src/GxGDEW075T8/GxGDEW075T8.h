@@ -21,7 +21,7 @@
 
 #define GxGDEW075T8_BUFFER_SIZE (uint32_t(GxGDEW075T8_WIDTH) * uint32_t(GxGDEW075T8_HEIGHT) / 8)
 
-// divisor for AVR, should be factor of GxGDEW075T8_HEIGHT
+// divisor of the buffer size for AVR; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW075T8_HEIGHT
 #define GxGDEW075T8_PAGES 24
 
 #define GxGDEW075T8_PAGE_HEIGHT (GxGDEW075T8_HEIGHT / GxGDEW075T8_PAGES)
@@ -38,6 +38,10 @@ class GxGDEW075T8 : public GxEPD
     GxGDEW075T8(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -53,7 +57,8 @@ class GxGDEW075T8 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW075T8_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW075T8_PAGES with the static frame buffer,
+    // once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -65,6 +70,8 @@ class GxGDEW075T8 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEW075T8";};
+    bool isBusy();
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -76,18 +83,30 @@ class GxGDEW075T8 : public GxEPD
     void _writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
+    void _startWakeUp();
     void _sleep();
+    void _startPowerOff();
+    void _deepSleep();
+#if GxEPD_ASYNC_UPDATE
+    bool _asyncPowerOn();
+    bool _asyncTransfer();
+    void _asyncRefresh();
+    void _asyncPowerOff();
+    void _asyncSleep();
+#endif
     void _waitWhileBusy(const char* comment = 0);
     void _send8pixel(uint8_t data);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
-#if defined(__AVR)
+    typedef GxFrameBuffer<GxGDEW075T8_WIDTH, GxGDEW075T8_HEIGHT, 1> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif defined(__AVR)
     uint8_t _buffer[GxGDEW075T8_PAGE_SIZE];
 #else
     uint8_t _buffer[GxGDEW075T8_BUFFER_SIZE];
 #endif
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -108,6 +127,7 @@ class GxGDEW075T8 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW075T8_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW075T8/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW075T8/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW075T8/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -12,6 +12,7 @@
 // Library: https://github.com/ZinggJM/GxEPD
 
 #include "GxGDEW075Z09.h"
+#include "../GxIL0371.h"
 
 //#define DISABLE_DIAGNOSTIC_OUTPUT
 
@@ -26,56 +27,36 @@
 
 GxGDEW075Z09::GxGDEW075Z09(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW075Z09_WIDTH, GxGDEW075Z09_HEIGHT), IO(io),
-    _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
+    _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
+#if GxEPD_HEAP_BUFFER
+  _initFrameBuffer<FrameBuffer>(0, 0, 0);
+#elif GxEPD_INTERLEAVED_3C
+  _initFrameBuffer<FrameBuffer>(_buffer, 0, sizeof(_buffer) / 2);
+#else
+  _initFrameBuffer<FrameBuffer>(_black_buffer, _red_buffer, sizeof(_black_buffer));
+#endif
 }
 
 void GxGDEW075Z09::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _drawPixelFB(x, y, color);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW075Z09_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW075Z09_WIDTH - x - 1;
-      y = GxGDEW075Z09_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW075Z09_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW075Z09_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW075Z09_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW075Z09_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW075Z09_WIDTH / 8;
-  }
+void GxGDEW075Z09::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
 
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+void GxGDEW075Z09::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void GxGDEW075Z09::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  _fillRectFB<FrameBuffer>(x, y, w, h, color);
 }
 
 void GxGDEW075Z09::init(uint32_t serial_diag_bitrate)
@@ -93,6 +74,7 @@ void GxGDEW075Z09::init(uint32_t serial_diag_bitrate)
     pinMode(_rst, OUTPUT);
   }
   pinMode(_busy, INPUT);
+  _allocFrameBuffer<FrameBuffer>();
   fillScreen(GxEPD_WHITE);
   _current_page = -1;
   _using_partial_mode = false;
@@ -100,31 +82,22 @@ void GxGDEW075Z09::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW075Z09::fillScreen(uint16_t color)
 {
-  uint8_t black = 0x00;
-  uint8_t red = 0x00;
-  if (color == GxEPD_WHITE);
-  else if (color == GxEPD_BLACK) black = 0xFF;
-  else if (color == GxEPD_RED) red = 0xFF;
-  else if ((color & 0xF100) > (0xF100 / 2))  red = 0xFF;
-  else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = 0xFF;
-  for (uint16_t x = 0; x < sizeof(_black_buffer); x++)
-  {
-    _black_buffer[x] = black;
-    _red_buffer[x] = red;
-  }
+  _fillScreenFB<FrameBuffer>(color);
 }
 
 void GxGDEW075Z09::update(void)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+  IO.startTransaction();
+  for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i += _fb_size)
   {
-    uint32_t idx = i % sizeof(_black_buffer);
-    _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, 0, gx_uint32_min(_fb_size, GxGDEW075Z09_BYTE_SIZE - i));
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("update");
   _sleep();
@@ -144,25 +117,17 @@ void GxGDEW075Z09::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t
 void GxGDEW075Z09::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_full_update);
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075Z09_WIDTH - 1, GxGDEW075Z09_HEIGHT - 1);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
-    {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      uint8_t black_data = (i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00;
-      uint8_t red_data = (i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00;
-#else
-      uint8_t black_data = (i < black_size) ? black_bitmap[i] : 0x00;
-      uint8_t red_data = (i < red_size) ? red_bitmap[i] : 0x00;
-#endif
-      if (mode & bm_invert) black_data = ~black_data;
-      if (mode & bm_invert_red) red_data = ~red_data;
-      _send8pixel(black_data, red_data);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, black_bitmap, black_size, 4 * GxGDEW075Z09_BYTE_SIZE, false, 0x33); // both colors
+    else GxIL0371::writeBitmap(IO, black_bitmap, black_size, red_bitmap, red_size, GxGDEW075Z09_BYTE_SIZE, mode & bm_invert, mode & bm_invert_red, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     IO.writeCommandTransaction(0x92); // partial out
@@ -172,19 +137,10 @@ void GxGDEW075Z09::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
-    {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      uint8_t black_data = (i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00;
-      uint8_t red_data = (i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00;
-#else
-      uint8_t black_data = (i < black_size) ? black_bitmap[i] : 0x00;
-      uint8_t red_data = (i < red_size) ? red_bitmap[i] : 0x00;
-#endif
-      if (mode & bm_invert) black_data = ~black_data;
-      if (mode & bm_invert_red) red_data = ~red_data;
-      _send8pixel(black_data, red_data);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, black_bitmap, black_size, 4 * GxGDEW075Z09_BYTE_SIZE, false, 0x33); // both colors
+    else GxIL0371::writeBitmap(IO, black_bitmap, black_size, red_bitmap, red_size, GxGDEW075Z09_BYTE_SIZE, mode & bm_invert, mode & bm_invert_red, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -209,11 +165,7 @@ void GxGDEW075Z09::drawExamplePicture_3C(const uint8_t* bitmap_3C, uint32_t size
   IO.writeCommandTransaction(0x10);
   for (i = 0; i < 2 * GxGDEW075Z09_BYTE_SIZE; i++)
   {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    temp1 = (i < size_3C) ? pgm_read_byte(&bitmap_3C[i]) : 0x00;
-#else
-    temp1 = (i < size_3C) ? bitmap_3C[i] : 0x00;
-#endif
+    temp1 = (i < size_3C) ? _readBitmap(bitmap_3C, i) : 0x00;
     for (j = 0; j < 4; j++)
     {
       temp2 = temp1 & 0xc0 ;
@@ -240,6 +192,7 @@ void GxGDEW075Z09::drawExamplePicture_3C(const uint8_t* bitmap_3C, uint32_t size
 void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, (mode & bm_partial_update) ? op_partial_update : op_full_update);
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true; // remember
@@ -247,20 +200,10 @@ void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075Z09_WIDTH - 1, GxGDEW075Z09_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _send8pixel(data, 0x00);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, 4 * GxGDEW075Z09_BYTE_SIZE, false, 0x33); // controller format
+    else GxIL0371::writeBitmap(IO, bitmap, size, GxGDEW075Z09_BYTE_SIZE, mode & bm_invert, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     IO.writeCommandTransaction(0x92); // partial out
@@ -270,20 +213,10 @@ void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
-    {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
-#else
-        data = bitmap[i];
-#endif
-        if (mode & bm_invert) data = ~data;
-      }
-      _send8pixel(data, 0x00);
-    }
+    IO.startTransaction();
+    if (_bitmap_reader && _bitmap_reader_as_sent) _writeBitmapData(IO, bitmap, size, 4 * GxGDEW075Z09_BYTE_SIZE, false, 0x33); // controller format
+    else GxIL0371::writeBitmap(IO, bitmap, size, GxGDEW075Z09_BYTE_SIZE, mode & bm_invert, _bitmap_reader, _bitmap_reader_arg);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("drawBitmap");
     _sleep();
@@ -293,6 +226,7 @@ void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
 void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_erase);
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
@@ -300,10 +234,9 @@ void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075Z09_WIDTH - 1, GxGDEW075Z09_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
-    {
-      _send8pixel(0x00, 0x00);
-    }
+    IO.startTransaction();
+    GxIL0371::writeWhite(IO, GxGDEW075Z09_BYTE_SIZE);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     IO.writeCommandTransaction(0x92); // partial out
@@ -313,10 +246,9 @@ void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
-    {
-      _send8pixel(0x00, 0x00);
-    }
+    IO.startTransaction();
+    GxIL0371::writeWhite(IO, GxGDEW075Z09_BYTE_SIZE);
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
     _waitWhileBusy("eraseDisplay");
     _sleep();
@@ -325,6 +257,7 @@ void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
 
 void GxGDEW075Z09::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (using_rotation)
   {
     switch (getRotation())
@@ -358,14 +291,13 @@ void GxGDEW075Z09::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-      _send8pixel(_black_buffer[idx], _red_buffer[idx]);
-    }
+    uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + xs_bx) % _fb_size; // a row does not wrap, the page size is a multiple of the row
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, idx, xe_bx - xs_bx);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("updateWindow");
   IO.writeCommandTransaction(0x92); // partial out
@@ -374,6 +306,7 @@ void GxGDEW075Z09::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW075Z09::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  op_scope op(this, IO, op_partial_update);
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
@@ -423,19 +356,19 @@ void GxGDEW075Z09::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-      _send8pixel(_black_buffer[idx], _red_buffer[idx]);
-    }
+    uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + xss_d8) % _fb_size; // a row does not wrap, the page size is a multiple of the row
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, idx, xse_d8 - xss_d8);
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
 }
 
 void GxGDEW075Z09::powerDown()
 {
+  _finishAsync();
   _using_partial_mode = false; // force _wakeUp()
   _sleep();
 }
@@ -461,15 +394,9 @@ uint16_t GxGDEW075Z09::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 void GxGDEW075Z09::_waitWhileBusy(const char* comment)
 {
   unsigned long start = micros();
-  while (1)
-  { //=0 BUSY
-    if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 40000000)
-    {
-      if (_diag_enabled) Serial.println("Busy Timeout!");
-      break;
-    }
+  if (!_waitBusy(_busy, LOW, 40000000)) //=0 BUSY
+  {
+    if (_diag_enabled) Serial.println("Busy Timeout!");
   }
   if (comment)
   {
@@ -488,26 +415,18 @@ void GxGDEW075Z09::_waitWhileBusy(const char* comment)
 
 void GxGDEW075Z09::_send8pixel(uint8_t black_data, uint8_t red_data)
 {
-  for (uint8_t j = 0; j < 8; j++)
-  {
-    uint8_t t = 0x00; // black
-    if (black_data & 0x80); // keep black
-    else if (red_data & 0x80) t = 0x04; //red
-    else t = 0x03; // white
-    t <<= 4;
-    black_data <<= 1;
-    red_data <<= 1;
-    j++;
-    if (black_data & 0x80); // keep black
-    else if (red_data & 0x80) t |= 0x04; //red
-    else t |= 0x03; // white
-    black_data <<= 1;
-    red_data <<= 1;
-    IO.writeDataTransaction(t);
-  }
+  uint8_t out[4];
+  GxIL0371::expand(out, black_data, red_data);
+  IO.writeData(out, 4, false); // caller holds the transaction
 }
 
 void GxGDEW075Z09::_wakeUp()
+{
+  _startWakeUp();
+  _waitWhileBusy();
+}
+
+void GxGDEW075Z09::_startWakeUp()
 {
   if (_rst >= 0)
   {
@@ -564,10 +483,16 @@ void GxGDEW075Z09::_wakeUp()
   IO.writeDataTransaction(0x03);
 
   IO.writeCommandTransaction(0x04);     //POWER ON
-  _waitWhileBusy();
 }
 
 void GxGDEW075Z09::_sleep(void)
+{
+  _startPowerOff();
+  _waitWhileBusy();
+  _deepSleep();
+}
+
+void GxGDEW075Z09::_startPowerOff()
 {
   /**********************************flash sleep**********************************/
   IO.writeCommandTransaction(0X65);     //FLASH CONTROL
@@ -580,8 +505,10 @@ void GxGDEW075Z09::_sleep(void)
   /**********************************flash sleep**********************************/
 
   IO.writeCommandTransaction(0x02);     // POWER OFF
-  _waitWhileBusy();
+}
 
+void GxGDEW075Z09::_deepSleep()
+{
   if (_rst >= 0)
   {
     IO.writeCommandTransaction(0x07);     // DEEP SLEEP
@@ -589,29 +516,76 @@ void GxGDEW075Z09::_sleep(void)
   }
 }
 
+bool GxGDEW075Z09::isBusy()
+{
+  return (_busy >= 0) && (digitalRead(_busy) == 0); //=0 BUSY, no BUSY pin: never
+}
+
+#if GxEPD_ASYNC_UPDATE
+bool GxGDEW075Z09::_asyncPowerOn()
+{
+  if (_current_page != -1) return false;
+  _using_partial_mode = false;
+  _startWakeUp();
+  return true;
+}
+
+bool GxGDEW075Z09::_asyncTransfer()
+{
+  if (_async_index == 0) IO.writeCommandTransaction(0x10);
+  uint32_t end = _async_index + GxEPD_ASYNC_CHUNK;
+  if (end > GxGDEW075Z09_BYTE_SIZE) end = GxGDEW075Z09_BYTE_SIZE;
+  IO.startTransaction();
+  while (_async_index < end)
+  {
+    uint32_t idx = _async_index % _fb_size;
+    uint32_t n = gx_uint32_min(end - _async_index, _fb_size - idx);
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, idx, n);
+    _async_index += n;
+  }
+  IO.endTransaction();
+  return _async_index < GxGDEW075Z09_BYTE_SIZE;
+}
+
+void GxGDEW075Z09::_asyncRefresh()
+{
+  IO.writeCommandTransaction(0x12); //display refresh
+}
+
+void GxGDEW075Z09::_asyncPowerOff()
+{
+  _startPowerOff();
+}
+
+void GxGDEW075Z09::_asyncSleep()
+{
+  _deepSleep();
+}
+#endif
+
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(void))
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
-      {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
-      }
+      drawCallback();
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -620,26 +594,26 @@ void GxGDEW075Z09::drawPaged(void (*drawCallback)(void))
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
-      {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -648,26 +622,26 @@ void GxGDEW075Z09::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
-      {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
-      }
+      drawCallback(p);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -676,26 +650,26 @@ void GxGDEW075Z09::drawPaged(void (*drawCallback)(const void*), const void* p)
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    if (!_replayPage())
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
-      {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
-      }
+      drawCallback(p1, p2);
+      _endRecording();
     }
+    IO.startTransaction();
+    GxIL0371::writePixels(IO, _fb_black, _fb_red, _fb_size, 0, _pageSize());
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPaged");
   _sleep();
@@ -725,6 +699,7 @@ void GxGDEW075Z09::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -732,19 +707,23 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback();
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
@@ -753,6 +732,7 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -760,19 +740,23 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
@@ -781,6 +765,7 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -788,19 +773,23 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
@@ -809,6 +798,7 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
   if (_current_page != -1) return;
+  op_scope op(this, IO, op_paged_draw);
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -816,19 +806,23 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < _pages; _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * _page_height);
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * _page_height);
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      if (!_replayPage())
+      {
+        drawCallback(p1, p2);
+        _endRecording();
+      }
+      uint16_t ys = yds % _page_height;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
-  _current_page = -1;
+  _endPaged();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawPagedToWindow");
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
@@ -838,6 +832,7 @@ void GxGDEW075Z09::drawCornerTest(uint8_t em)
 {
   _wakeUp();
   IO.writeCommandTransaction(0x10);
+  IO.startTransaction();
   for (uint32_t y = 0; y < GxGDEW075Z09_HEIGHT; y++)
   {
     for (uint32_t x = 0; x < GxGDEW075Z09_WIDTH / 8; x++)
@@ -850,6 +845,7 @@ void GxGDEW075Z09::drawCornerTest(uint8_t em)
       _send8pixel(~data, 0x00);
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
   _waitWhileBusy("drawCornerTest");
   _sleep();
@@ -22,7 +22,7 @@
 // pixel number expressed in bytes; this is neither the buffer size nor the size of the buffer in the controller
 #define GxGDEW075Z09_BYTE_SIZE (uint32_t(GxGDEW075Z09_WIDTH) * uint32_t(GxGDEW075Z09_HEIGHT) / 8)
 
-// divisor for AVR or limited RAM, should be factor of GxGDEW075Z09_HEIGHT
+// divisor of the buffer size for AVR or limited RAM; paged drawing uses the rows the buffer holds, need not be a factor of GxGDEW075Z09_HEIGHT
 // add conditional case if the compiler complains for your target
 #if defined(__AVR)
 //#define GxGDEW075Z09_PAGES 48
@@ -48,6 +48,10 @@ class GxGDEW075Z09 : public GxEPD
     GxGDEW075Z09(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // byte wise to buffer, rotation handled once per call
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -69,7 +73,8 @@ class GxGDEW075Z09 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW075Z09_PAGES times
+    // paged drawing, for limited RAM, drawCallback() is called pages() times, GxGDEW075Z09_PAGES with the static frame buffer,
+    // once with setDisplayList()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
@@ -81,6 +86,8 @@ class GxGDEW075Z09 : public GxEPD
     void drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*);
     void drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void*, const void*);
     void drawCornerTest(uint8_t em = 0x01);
+    const char* panelName() {return "GDEW075Z09";};
+    bool isBusy();
   private:
     template <typename T> static inline void
     swap(T& a, T& b)
@@ -92,15 +99,31 @@ class GxGDEW075Z09 : public GxEPD
     void _writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
+    void _startWakeUp();
     void _sleep();
+    void _startPowerOff();
+    void _deepSleep();
+#if GxEPD_ASYNC_UPDATE
+    bool _asyncPowerOn();
+    bool _asyncTransfer();
+    void _asyncRefresh();
+    void _asyncPowerOff();
+    void _asyncSleep();
+#endif
     void _waitWhileBusy(const char* comment = 0);
     void _send8pixel(uint8_t black_data, uint8_t red_data);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
+    typedef GxFrameBuffer<GxGDEW075Z09_WIDTH, GxGDEW075Z09_HEIGHT, 2, GxEPD_INTERLEAVED_3C ? GxFB_INTERLEAVED : 0> FrameBuffer;
+#if GxEPD_HEAP_BUFFER
+    // frame buffer on the heap, see GxEPD::setFrameBufferBudget()
+#elif GxEPD_INTERLEAVED_3C
+    uint8_t _buffer[2 * GxGDEW075Z09_BUFFER_SIZE]; // black and red interleaved
+#else
     uint8_t _black_buffer[GxGDEW075Z09_BUFFER_SIZE];
     uint8_t _red_buffer[GxGDEW075Z09_BUFFER_SIZE];
+#endif
     GxIO& IO;
-    int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
@@ -121,6 +144,7 @@ class GxGDEW075Z09 : public GxEPD
 #define GxEPD_HEIGHT GxGDEW075Z09_HEIGHT
 #define GxEPD_BitmapExamples <GxGDEW075Z09/BitmapExamples.h>
 #define GxEPD_BitmapExamplesQ "GxGDEW075Z09/BitmapExamples.h"
+#define GxEPD_BitmapExamplesPacked <GxGDEW075Z09/BitmapExamples_packed.h>
 #endif
 
 #endif
@@ -0,0 +1,256 @@
+// class GxIL0371 : 4 Bit per Pixel Transfer for Display Classes with Controller IL0371 (UC8159)
+//
+// expands 1 bit per pixel buffers and bitmaps to the 4 bit per pixel controller format, using precomputed tables
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxIL0371.h"
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// 8 pixels of one b/w byte, 1 is black, to 4 controller bytes, first in bits 31..24
+const uint32_t GxIL0371::_mono[256] PROGMEM =
+{
+  0x33333333, 0x33333330, 0x33333303, 0x33333300, 0x33333033, 0x33333030, 0x33333003, 0x33333000,
+  0x33330333, 0x33330330, 0x33330303, 0x33330300, 0x33330033, 0x33330030, 0x33330003, 0x33330000,
+  0x33303333, 0x33303330, 0x33303303, 0x33303300, 0x33303033, 0x33303030, 0x33303003, 0x33303000,
+  0x33300333, 0x33300330, 0x33300303, 0x33300300, 0x33300033, 0x33300030, 0x33300003, 0x33300000,
+  0x33033333, 0x33033330, 0x33033303, 0x33033300, 0x33033033, 0x33033030, 0x33033003, 0x33033000,
+  0x33030333, 0x33030330, 0x33030303, 0x33030300, 0x33030033, 0x33030030, 0x33030003, 0x33030000,
+  0x33003333, 0x33003330, 0x33003303, 0x33003300, 0x33003033, 0x33003030, 0x33003003, 0x33003000,
+  0x33000333, 0x33000330, 0x33000303, 0x33000300, 0x33000033, 0x33000030, 0x33000003, 0x33000000,
+  0x30333333, 0x30333330, 0x30333303, 0x30333300, 0x30333033, 0x30333030, 0x30333003, 0x30333000,
+  0x30330333, 0x30330330, 0x30330303, 0x30330300, 0x30330033, 0x30330030, 0x30330003, 0x30330000,
+  0x30303333, 0x30303330, 0x30303303, 0x30303300, 0x30303033, 0x30303030, 0x30303003, 0x30303000,
+  0x30300333, 0x30300330, 0x30300303, 0x30300300, 0x30300033, 0x30300030, 0x30300003, 0x30300000,
+  0x30033333, 0x30033330, 0x30033303, 0x30033300, 0x30033033, 0x30033030, 0x30033003, 0x30033000,
+  0x30030333, 0x30030330, 0x30030303, 0x30030300, 0x30030033, 0x30030030, 0x30030003, 0x30030000,
+  0x30003333, 0x30003330, 0x30003303, 0x30003300, 0x30003033, 0x30003030, 0x30003003, 0x30003000,
+  0x30000333, 0x30000330, 0x30000303, 0x30000300, 0x30000033, 0x30000030, 0x30000003, 0x30000000,
+  0x03333333, 0x03333330, 0x03333303, 0x03333300, 0x03333033, 0x03333030, 0x03333003, 0x03333000,
+  0x03330333, 0x03330330, 0x03330303, 0x03330300, 0x03330033, 0x03330030, 0x03330003, 0x03330000,
+  0x03303333, 0x03303330, 0x03303303, 0x03303300, 0x03303033, 0x03303030, 0x03303003, 0x03303000,
+  0x03300333, 0x03300330, 0x03300303, 0x03300300, 0x03300033, 0x03300030, 0x03300003, 0x03300000,
+  0x03033333, 0x03033330, 0x03033303, 0x03033300, 0x03033033, 0x03033030, 0x03033003, 0x03033000,
+  0x03030333, 0x03030330, 0x03030303, 0x03030300, 0x03030033, 0x03030030, 0x03030003, 0x03030000,
+  0x03003333, 0x03003330, 0x03003303, 0x03003300, 0x03003033, 0x03003030, 0x03003003, 0x03003000,
+  0x03000333, 0x03000330, 0x03000303, 0x03000300, 0x03000033, 0x03000030, 0x03000003, 0x03000000,
+  0x00333333, 0x00333330, 0x00333303, 0x00333300, 0x00333033, 0x00333030, 0x00333003, 0x00333000,
+  0x00330333, 0x00330330, 0x00330303, 0x00330300, 0x00330033, 0x00330030, 0x00330003, 0x00330000,
+  0x00303333, 0x00303330, 0x00303303, 0x00303300, 0x00303033, 0x00303030, 0x00303003, 0x00303000,
+  0x00300333, 0x00300330, 0x00300303, 0x00300300, 0x00300033, 0x00300030, 0x00300003, 0x00300000,
+  0x00033333, 0x00033330, 0x00033303, 0x00033300, 0x00033033, 0x00033030, 0x00033003, 0x00033000,
+  0x00030333, 0x00030330, 0x00030303, 0x00030300, 0x00030033, 0x00030030, 0x00030003, 0x00030000,
+  0x00003333, 0x00003330, 0x00003303, 0x00003300, 0x00003033, 0x00003030, 0x00003003, 0x00003000,
+  0x00000333, 0x00000330, 0x00000303, 0x00000300, 0x00000033, 0x00000030, 0x00000003, 0x00000000
+};
+
+// 4 pixels of black nibble (bits 7..4) and red nibble (bits 3..0) to 2 controller bytes, first in bits 15..8, black over red
+const uint16_t GxIL0371::_black_red[256] PROGMEM =
+{
+  0x3333, 0x3334, 0x3343, 0x3344, 0x3433, 0x3434, 0x3443, 0x3444, 0x4333, 0x4334, 0x4343, 0x4344,
+  0x4433, 0x4434, 0x4443, 0x4444, 0x3330, 0x3330, 0x3340, 0x3340, 0x3430, 0x3430, 0x3440, 0x3440,
+  0x4330, 0x4330, 0x4340, 0x4340, 0x4430, 0x4430, 0x4440, 0x4440, 0x3303, 0x3304, 0x3303, 0x3304,
+  0x3403, 0x3404, 0x3403, 0x3404, 0x4303, 0x4304, 0x4303, 0x4304, 0x4403, 0x4404, 0x4403, 0x4404,
+  0x3300, 0x3300, 0x3300, 0x3300, 0x3400, 0x3400, 0x3400, 0x3400, 0x4300, 0x4300, 0x4300, 0x4300,
+  0x4400, 0x4400, 0x4400, 0x4400, 0x3033, 0x3034, 0x3043, 0x3044, 0x3033, 0x3034, 0x3043, 0x3044,
+  0x4033, 0x4034, 0x4043, 0x4044, 0x4033, 0x4034, 0x4043, 0x4044, 0x3030, 0x3030, 0x3040, 0x3040,
+  0x3030, 0x3030, 0x3040, 0x3040, 0x4030, 0x4030, 0x4040, 0x4040, 0x4030, 0x4030, 0x4040, 0x4040,
+  0x3003, 0x3004, 0x3003, 0x3004, 0x3003, 0x3004, 0x3003, 0x3004, 0x4003, 0x4004, 0x4003, 0x4004,
+  0x4003, 0x4004, 0x4003, 0x4004, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0333, 0x0334, 0x0343, 0x0344,
+  0x0433, 0x0434, 0x0443, 0x0444, 0x0333, 0x0334, 0x0343, 0x0344, 0x0433, 0x0434, 0x0443, 0x0444,
+  0x0330, 0x0330, 0x0340, 0x0340, 0x0430, 0x0430, 0x0440, 0x0440, 0x0330, 0x0330, 0x0340, 0x0340,
+  0x0430, 0x0430, 0x0440, 0x0440, 0x0303, 0x0304, 0x0303, 0x0304, 0x0403, 0x0404, 0x0403, 0x0404,
+  0x0303, 0x0304, 0x0303, 0x0304, 0x0403, 0x0404, 0x0403, 0x0404, 0x0300, 0x0300, 0x0300, 0x0300,
+  0x0400, 0x0400, 0x0400, 0x0400, 0x0300, 0x0300, 0x0300, 0x0300, 0x0400, 0x0400, 0x0400, 0x0400,
+  0x0033, 0x0034, 0x0043, 0x0044, 0x0033, 0x0034, 0x0043, 0x0044, 0x0033, 0x0034, 0x0043, 0x0044,
+  0x0033, 0x0034, 0x0043, 0x0044, 0x0030, 0x0030, 0x0040, 0x0040, 0x0030, 0x0030, 0x0040, 0x0040,
+  0x0030, 0x0030, 0x0040, 0x0040, 0x0030, 0x0030, 0x0040, 0x0040, 0x0003, 0x0004, 0x0003, 0x0004,
+  0x0003, 0x0004, 0x0003, 0x0004, 0x0003, 0x0004, 0x0003, 0x0004, 0x0003, 0x0004, 0x0003, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// 4 pixels of black and red bit pairs (GxFB_INTERLEAVED) to 2 controller bytes, first in bits 15..8, black over red
+const uint16_t GxIL0371::_pairs[256] PROGMEM =
+{
+  0x3333, 0x3334, 0x3330, 0x3330, 0x3343, 0x3344, 0x3340, 0x3340, 0x3303, 0x3304, 0x3300, 0x3300,
+  0x3303, 0x3304, 0x3300, 0x3300, 0x3433, 0x3434, 0x3430, 0x3430, 0x3443, 0x3444, 0x3440, 0x3440,
+  0x3403, 0x3404, 0x3400, 0x3400, 0x3403, 0x3404, 0x3400, 0x3400, 0x3033, 0x3034, 0x3030, 0x3030,
+  0x3043, 0x3044, 0x3040, 0x3040, 0x3003, 0x3004, 0x3000, 0x3000, 0x3003, 0x3004, 0x3000, 0x3000,
+  0x3033, 0x3034, 0x3030, 0x3030, 0x3043, 0x3044, 0x3040, 0x3040, 0x3003, 0x3004, 0x3000, 0x3000,
+  0x3003, 0x3004, 0x3000, 0x3000, 0x4333, 0x4334, 0x4330, 0x4330, 0x4343, 0x4344, 0x4340, 0x4340,
+  0x4303, 0x4304, 0x4300, 0x4300, 0x4303, 0x4304, 0x4300, 0x4300, 0x4433, 0x4434, 0x4430, 0x4430,
+  0x4443, 0x4444, 0x4440, 0x4440, 0x4403, 0x4404, 0x4400, 0x4400, 0x4403, 0x4404, 0x4400, 0x4400,
+  0x4033, 0x4034, 0x4030, 0x4030, 0x4043, 0x4044, 0x4040, 0x4040, 0x4003, 0x4004, 0x4000, 0x4000,
+  0x4003, 0x4004, 0x4000, 0x4000, 0x4033, 0x4034, 0x4030, 0x4030, 0x4043, 0x4044, 0x4040, 0x4040,
+  0x4003, 0x4004, 0x4000, 0x4000, 0x4003, 0x4004, 0x4000, 0x4000, 0x0333, 0x0334, 0x0330, 0x0330,
+  0x0343, 0x0344, 0x0340, 0x0340, 0x0303, 0x0304, 0x0300, 0x0300, 0x0303, 0x0304, 0x0300, 0x0300,
+  0x0433, 0x0434, 0x0430, 0x0430, 0x0443, 0x0444, 0x0440, 0x0440, 0x0403, 0x0404, 0x0400, 0x0400,
+  0x0403, 0x0404, 0x0400, 0x0400, 0x0033, 0x0034, 0x0030, 0x0030, 0x0043, 0x0044, 0x0040, 0x0040,
+  0x0003, 0x0004, 0x0000, 0x0000, 0x0003, 0x0004, 0x0000, 0x0000, 0x0033, 0x0034, 0x0030, 0x0030,
+  0x0043, 0x0044, 0x0040, 0x0040, 0x0003, 0x0004, 0x0000, 0x0000, 0x0003, 0x0004, 0x0000, 0x0000,
+  0x0333, 0x0334, 0x0330, 0x0330, 0x0343, 0x0344, 0x0340, 0x0340, 0x0303, 0x0304, 0x0300, 0x0300,
+  0x0303, 0x0304, 0x0300, 0x0300, 0x0433, 0x0434, 0x0430, 0x0430, 0x0443, 0x0444, 0x0440, 0x0440,
+  0x0403, 0x0404, 0x0400, 0x0400, 0x0403, 0x0404, 0x0400, 0x0400, 0x0033, 0x0034, 0x0030, 0x0030,
+  0x0043, 0x0044, 0x0040, 0x0040, 0x0003, 0x0004, 0x0000, 0x0000, 0x0003, 0x0004, 0x0000, 0x0000,
+  0x0033, 0x0034, 0x0030, 0x0030, 0x0043, 0x0044, 0x0040, 0x0040, 0x0003, 0x0004, 0x0000, 0x0000,
+  0x0003, 0x0004, 0x0000, 0x0000
+};
+
+static inline uint8_t _readBitmapByte(const uint8_t* p)
+{
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  return pgm_read_byte(p);
+#else
+  return *p;
+#endif
+}
+
+void GxIL0371::expand(uint8_t* out, uint8_t data)
+{
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  uint32_t v = pgm_read_dword(&_mono[data]);
+#else
+  uint32_t v = _mono[data];
+#endif
+  out[0] = v >> 24;
+  out[1] = v >> 16;
+  out[2] = v >> 8;
+  out[3] = v;
+}
+
+void GxIL0371::expand(uint8_t* out, uint8_t black_data, uint8_t red_data)
+{
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  uint16_t h = pgm_read_word(&_black_red[(black_data & 0xF0) | (red_data >> 4)]);
+  uint16_t l = pgm_read_word(&_black_red[uint8_t(black_data << 4) | (red_data & 0x0F)]);
+#else
+  uint16_t h = _black_red[(black_data & 0xF0) | (red_data >> 4)];
+  uint16_t l = _black_red[uint8_t(black_data << 4) | (red_data & 0x0F)];
+#endif
+  out[0] = h >> 8;
+  out[1] = h;
+  out[2] = l >> 8;
+  out[3] = l;
+}
+
+void GxIL0371::writePixels(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, uint32_t num)
+{
+  uint8_t out[4 * GxIL0371_CHUNK];
+  while ((num > 0) && (idx < buffer_size))
+  {
+    uint16_t n = gx_uint32_min(gx_uint32_min(num, buffer_size - idx), GxIL0371_CHUNK);
+    for (uint16_t i = 0; i < n; i++) expand(out + 4 * i, buffer[idx + i]);
+    io.writeData(out, 4 * n, false);
+    idx += n;
+    num -= n;
+  }
+  writeWhite(io, num);
+}
+
+void GxIL0371::writePixels(GxIO& io, const uint8_t* black_buffer, const uint8_t* red_buffer, uint32_t buffer_size, uint32_t idx, uint32_t num)
+{
+  if (!red_buffer)
+  {
+    writePairs(io, black_buffer, buffer_size, idx, num);
+    return;
+  }
+  uint8_t out[4 * GxIL0371_CHUNK];
+  while ((num > 0) && (idx < buffer_size))
+  {
+    uint16_t n = gx_uint32_min(gx_uint32_min(num, buffer_size - idx), GxIL0371_CHUNK);
+    for (uint16_t i = 0; i < n; i++) expand(out + 4 * i, black_buffer[idx + i], red_buffer[idx + i]);
+    io.writeData(out, 4 * n, false);
+    idx += n;
+    num -= n;
+  }
+  writeWhite(io, num);
+}
+
+void GxIL0371::writePairs(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, uint32_t num)
+{
+  uint8_t out[4 * GxIL0371_CHUNK];
+  while ((num > 0) && (idx < buffer_size))
+  {
+    uint16_t n = gx_uint32_min(gx_uint32_min(num, buffer_size - idx), GxIL0371_CHUNK);
+    const uint8_t* p = buffer + 2 * idx;
+    for (uint16_t i = 0; i < 2 * n; i++)
+    {
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+      uint16_t v = pgm_read_word(&_pairs[p[i]]);
+#else
+      uint16_t v = _pairs[p[i]];
+#endif
+      out[2 * i] = v >> 8;
+      out[2 * i + 1] = v;
+    }
+    io.writeData(out, 4 * n, false);
+    idx += n;
+    num -= n;
+  }
+  writeWhite(io, num);
+}
+
+void GxIL0371::writeBitmap(GxIO& io, const uint8_t* bitmap, uint32_t size, uint32_t num, bool invert, bitmap_reader reader, void* arg)
+{
+  uint8_t mask = invert ? 0xFF : 0x00;
+  uint8_t in[GxIL0371_CHUNK];
+  uint8_t out[4 * GxIL0371_CHUNK];
+  uint32_t idx = 0;
+  while ((num > 0) && (idx < size))
+  {
+    uint16_t n = gx_uint32_min(gx_uint32_min(num, size - idx), GxIL0371_CHUNK);
+    _read(in, bitmap, idx, n, reader, arg);
+    for (uint16_t i = 0; i < n; i++) expand(out + 4 * i, in[i] ^ mask);
+    io.writeData(out, 4 * n, false);
+    idx += n;
+    num -= n;
+  }
+  writeWhite(io, num);
+}
+
+void GxIL0371::writeBitmap(GxIO& io, const uint8_t* black_bitmap, uint32_t black_size, const uint8_t* red_bitmap, uint32_t red_size,
+                           uint32_t num, bool invert, bool invert_red, bitmap_reader reader, void* arg)
+{
+  uint8_t black_mask = invert ? 0xFF : 0x00;
+  uint8_t red_mask = invert_red ? 0xFF : 0x00;
+  uint8_t black_in[GxIL0371_CHUNK], red_in[GxIL0371_CHUNK];
+  uint8_t out[4 * GxIL0371_CHUNK];
+  for (uint32_t idx = 0; idx < num; )
+  {
+    uint16_t n = gx_uint32_min(num - idx, GxIL0371_CHUNK);
+    memset(black_in, 0x00, n);
+    memset(red_in, 0x00, n);
+    if (idx < black_size) _read(black_in, black_bitmap, idx, gx_uint32_min(n, black_size - idx), reader, arg);
+    if (idx < red_size) _read(red_in, red_bitmap, idx, gx_uint32_min(n, red_size - idx), reader, arg);
+    for (uint16_t i = 0; i < n; i++) expand(out + 4 * i, black_in[i] ^ black_mask, red_in[i] ^ red_mask);
+    io.writeData(out, 4 * n, false);
+    idx += n;
+  }
+}
+
+void GxIL0371::_read(uint8_t* in, const uint8_t* bitmap, uint32_t idx, uint16_t n, bitmap_reader reader, void* arg)
+{
+  if (!reader)
+  {
+    for (uint16_t i = 0; i < n; i++) in[i] = _readBitmapByte(bitmap + idx + i);
+    return;
+  }
+  uint16_t got = reader(arg, bitmap, idx, in, n);
+  if (got < n) memset(in + got, 0x00, n - got);
+}
+
+void GxIL0371::writeWhite(GxIO& io, uint32_t num)
+{
+  if (num > 0) io.writeDataPattern(0x33, 4 * num);
+}
@@ -0,0 +1,56 @@
+// class GxIL0371 : 4 Bit per Pixel Transfer for Display Classes with Controller IL0371 (UC8159)
+//
+// expands 1 bit per pixel buffers and bitmaps to the 4 bit per pixel controller format, using precomputed tables
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxIL0371_H_
+#define _GxIL0371_H_
+
+#include <Arduino.h>
+#include "GxIO/GxIO.h"
+
+// buffer bytes expanded per block write, a row of the 640 pixel panels, less on AVR for the stack
+#if defined(__AVR)
+#define GxIL0371_CHUNK 16
+#else
+#define GxIL0371_CHUNK 80
+#endif
+
+// controller pixel values, 4 bit per pixel, 2 pixels per byte, leftmost pixel in the high nibble : 0x0 black, 0x3 white, 0x4 red
+// all write methods are called within a transaction, num counts buffer bytes, 4 controller bytes are sent per buffer byte
+class GxIL0371
+{
+  public:
+    // 8 pixels of data, 1 is black, to 4 controller bytes at out
+    static void expand(uint8_t* out, uint8_t data);
+    // 8 pixels of black and red data, 1 is black or red, black has priority
+    static void expand(uint8_t* out, uint8_t black_data, uint8_t red_data);
+    // num bytes from index idx of buffer; bytes beyond buffer_size (paged buffer) are sent white
+    static void writePixels(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, uint32_t num);
+    // red_buffer 0 : black_buffer holds both planes interleaved, see writePairs()
+    static void writePixels(GxIO& io, const uint8_t* black_buffer, const uint8_t* red_buffer, uint32_t buffer_size, uint32_t idx, uint32_t num);
+    // same for a buffer of black and red bit pairs (GxFB_INTERLEAVED), buffer_size, idx and num count bytes of one plane
+    static void writePairs(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, uint32_t num);
+    // source of bitmap bytes instead of program memory, as GxEPD::bitmap_reader; bytes not read are 0x00
+    typedef uint16_t (*bitmap_reader)(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n);
+    // num bytes of a bitmap in program memory, or from reader; bytes beyond size are sent white
+    static void writeBitmap(GxIO& io, const uint8_t* bitmap, uint32_t size, uint32_t num, bool invert, bitmap_reader reader = 0, void* arg = 0);
+    // black and red bitmaps in program memory, or from reader; bytes beyond size are 0x00 before inversion, as for drawPicture()
+    static void writeBitmap(GxIO& io, const uint8_t* black_bitmap, uint32_t black_size, const uint8_t* red_bitmap, uint32_t red_size,
+                            uint32_t num, bool invert, bool invert_red, bitmap_reader reader = 0, void* arg = 0);
+    static void writeWhite(GxIO& io, uint32_t num);
+  private:
+    static inline uint32_t gx_uint32_min(uint32_t a, uint32_t b) {return (a < b ? a : b);}; // narrowed by the caller after the min with GxIL0371_CHUNK
+    // n bytes from index idx of bitmap to in
+    static void _read(uint8_t* in, const uint8_t* bitmap, uint32_t idx, uint16_t n, bitmap_reader reader, void* arg);
+    static const uint32_t _mono[256];
+    static const uint16_t _black_red[256];
+    static const uint16_t _pairs[256];
+};
+
+#endif
@@ -41,5 +41,75 @@ uint32_t GxIO::readRawData32(uint8_t part)
   return 0;
 };
 
+void GxIO::writeData(const uint8_t* d, uint32_t num, bool invert)
+{
+  uint8_t mask = invert ? 0xFF : 0x00;
+  while (num > 0)
+  {
+    writeData(uint8_t(*d ^ mask));
+    d++;
+    num--;
+  }
+}
+
+void GxIO::writeDataPattern(uint8_t d, uint32_t num)
+{
+  while (num > 0)
+  {
+    writeData(d);
+    num--;
+  }
+}
+
+void GxIO::writeDataTransaction(const uint8_t* d, uint32_t num, bool invert)
+{
+  startTransaction();
+  writeData(d, num, invert);
+  endTransaction();
+}
 
+void GxIO::writeDataPatternTransaction(uint8_t d, uint32_t num)
+{
+  startTransaction();
+  writeDataPattern(d, num);
+  endTransaction();
+}
+
+bool GxIO::queueCommand(uint8_t c)
+{
+  writeCommandTransaction(c);
+  return true;
+}
+
+bool GxIO::queueData(const uint8_t* d, uint32_t num, bool invert)
+{
+  writeDataTransaction(d, num, invert);
+  return true;
+}
+
+bool GxIO::queueDataPattern(uint8_t d, uint32_t num)
+{
+  writeDataPatternTransaction(d, num);
+  return true;
+}
+
+void GxIO::startQueue(void (*callback)(void*), void* arg)
+{
+  if (callback) callback(arg);
+}
+
+bool GxIO::processQueue()
+{
+  return false;
+}
+
+bool GxIO::isQueueBusy()
+{
+  return false;
+}
+
+void GxIO::waitQueue()
+{
+  while (processQueue()) yield();
+}
 
@@ -10,8 +10,17 @@
 class GxIO
 {
   public:
-    GxIO() {};
+    GxIO() {resetIOStats();};
     const char* name = "GxIO";
+    // transfer counters, maintained by the io classes
+    struct io_stats
+    {
+      uint32_t commands; // command bytes
+      uint32_t data_bytes; // data bytes written or read
+      uint32_t transactions; // bus acquired, CS asserted and released
+    };
+    virtual const io_stats& ioStats() {return _io_stats;};
+    virtual void resetIOStats() {memset(&_io_stats, 0, sizeof(_io_stats));};
     virtual void reset();
     virtual void init();
     virtual void setFrequency(uint32_t freq){}; // for SPI
@@ -30,11 +39,30 @@ class GxIO
     virtual void writeData(uint8_t d);
     virtual void writeData(uint8_t* d, uint32_t num);
     virtual void writeData16(uint16_t d, uint32_t num = 1);
+    // block writes, used for frame data; invert sends each byte complemented
+    virtual void writeData(const uint8_t* d, uint32_t num, bool invert);
+    virtual void writeDataPattern(uint8_t d, uint32_t num);
+    // block writes in one transaction, CS stays asserted for the whole block
+    virtual void writeDataTransaction(const uint8_t* d, uint32_t num, bool invert = false);
+    virtual void writeDataPatternTransaction(uint8_t d, uint32_t num);
+    // transfer queue, entries are sent in order by processQueue(), callback is called when drained
+    // queued data must stay valid until the queue is idle; this base class sends synchronously, GxIO_SPI sends in the
+    // caller, a chunk per processQueue(); nothing overlaps with drawing but with GxIO_SPI_Task (ESP32) or, on the host,
+    // GxHostThreadSPI, which send the queue in the background
+    virtual bool queueCommand(uint8_t c);
+    virtual bool queueData(const uint8_t* d, uint32_t num, bool invert = false);
+    virtual bool queueDataPattern(uint8_t d, uint32_t num);
+    virtual void startQueue(void (*callback)(void*) = 0, void* arg = 0);
+    virtual bool processQueue(); // returns true while entries remain
+    virtual bool isQueueBusy();
+    void waitQueue();
     virtual void writeAddrMSBfirst(uint16_t d);
     virtual void startTransaction();
     virtual void endTransaction();
     virtual void selectRegister(bool rs_low) {}; // for generalized readData & writeData (RA8875)
     virtual void setBackLight(bool lit);
+  protected:
+    io_stats _io_stats;
 };
 
 #endif
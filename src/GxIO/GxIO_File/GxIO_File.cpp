@@ -0,0 +1,248 @@
+// GxIO_File : io class for the GxEPD library
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+
+#include "GxIO_File.h"
+
+GxIO_File::GxIO_File(Print& out) : _out(out), _run_count(0)
+{
+}
+
+void GxIO_File::reset()
+{
+  flush();
+  _out.write(uint8_t(trace_reset));
+}
+
+void GxIO_File::init()
+{
+  flush();
+  const uint8_t header[] = {trace_header, 'x', 'T', trace_version};
+  _out.write(header, sizeof(header));
+}
+
+void GxIO_File::writeCommandTransaction(uint8_t c)
+{
+  _io_stats.transactions++;
+  _io_stats.commands++;
+  flush();
+  const uint8_t record[] = {trace_command_transaction, c};
+  _out.write(record, sizeof(record));
+}
+
+void GxIO_File::writeDataTransaction(uint8_t d)
+{
+  _io_stats.transactions++;
+  _io_stats.data_bytes++;
+  flush();
+  const uint8_t record[] = {trace_data_transaction, d};
+  _out.write(record, sizeof(record));
+}
+
+void GxIO_File::writeData16Transaction(uint16_t d, uint32_t num)
+{
+  startTransaction();
+  writeData16(d, num);
+  endTransaction();
+}
+
+void GxIO_File::writeCommand(uint8_t c)
+{
+  _io_stats.commands++;
+  flush();
+  const uint8_t record[] = {trace_command, c};
+  _out.write(record, sizeof(record));
+}
+
+void GxIO_File::writeData(uint8_t d)
+{
+  _io_stats.data_bytes++;
+  _run[_run_count++] = d;
+  if (_run_count == sizeof(_run)) flush();
+}
+
+void GxIO_File::writeData(uint8_t* d, uint32_t num)
+{
+  writeData((const uint8_t*)d, num, false);
+}
+
+void GxIO_File::writeData16(uint16_t d, uint32_t num)
+{
+  if ((d >> 8) == (d & 0xFF)) writeDataPattern(d & 0xFF, 2 * num);
+  else
+  {
+    while (num > 0)
+    {
+      writeData(uint8_t(d >> 8));
+      writeData(uint8_t(d & 0xFF));
+      num--;
+    }
+  }
+}
+
+void GxIO_File::writeData(const uint8_t* d, uint32_t num, bool invert)
+{
+  if (num == 0) return;
+  flush();
+  _io_stats.data_bytes += num;
+  _out.write(uint8_t(trace_data));
+  _writeVarint(num);
+  if (!invert)
+  {
+    _out.write(d, num);
+    return;
+  }
+  while (num > 0)
+  {
+    uint8_t n = num < sizeof(_run) ? num : sizeof(_run);
+    for (uint8_t i = 0; i < n; i++) _run[i] = ~d[i];
+    _out.write(_run, n);
+    d += n;
+    num -= n;
+  }
+}
+
+void GxIO_File::writeDataPattern(uint8_t d, uint32_t num)
+{
+  if (num == 0) return;
+  flush();
+  _io_stats.data_bytes += num;
+  const uint8_t record[] = {trace_pattern, d};
+  _out.write(record, sizeof(record));
+  _writeVarint(num);
+}
+
+void GxIO_File::writeAddrMSBfirst(uint16_t d)
+{
+  writeData(uint8_t(d >> 8));
+  writeData(uint8_t(d & 0xFF));
+}
+
+void GxIO_File::startTransaction()
+{
+  _io_stats.transactions++;
+  flush();
+  _out.write(uint8_t(trace_start));
+}
+
+void GxIO_File::endTransaction()
+{
+  flush();
+  _out.write(uint8_t(trace_end));
+}
+
+void GxIO_File::flush()
+{
+  if (_run_count == 0) return;
+  _out.write(uint8_t(trace_data));
+  _writeVarint(_run_count);
+  _out.write(_run, _run_count);
+  _run_count = 0;
+}
+
+void GxIO_File::_writeVarint(uint32_t v)
+{
+  while (v >= 0x80)
+  {
+    _out.write(uint8_t(v | 0x80));
+    v >>= 7;
+  }
+  _out.write(uint8_t(v));
+}
+
+int GxIO_File::_readByte(Stream& trace)
+{
+  uint8_t b;
+  return (trace.readBytes(&b, 1) == 1) ? b : -1;
+}
+
+bool GxIO_File::_readVarint(Stream& trace, uint32_t& v)
+{
+  v = 0;
+  for (uint8_t shift = 0; shift < 32; shift += 7)
+  {
+    int b = _readByte(trace);
+    if (b < 0) return false;
+    v |= uint32_t(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+static bool _waitWhileBusy(int8_t busy, uint8_t busy_level, uint32_t busy_timeout)
+{
+  if (busy < 0) return true;
+  unsigned long start = millis();
+  while (digitalRead(busy) == busy_level)
+  {
+    if (millis() - start > busy_timeout) return false;
+    yield();
+  }
+  return true;
+}
+
+bool GxIO_File::replay(Stream& trace, GxIO& io, int8_t busy, uint8_t busy_level, uint32_t busy_timeout)
+{
+  uint8_t buf[GxIO_File_RUN];
+  int tag;
+  while ((tag = _readByte(trace)) >= 0)
+  {
+    switch (tag)
+    {
+      case trace_command_transaction:
+      case trace_command:
+        {
+          int c = _readByte(trace);
+          if (c < 0) return false;
+          _waitWhileBusy(busy, busy_level, busy_timeout);
+          if (tag == trace_command) io.writeCommand(c);
+          else io.writeCommandTransaction(c);
+        }
+        break;
+      case trace_data_transaction:
+        {
+          int d = _readByte(trace);
+          if (d < 0) return false;
+          io.writeDataTransaction(uint8_t(d));
+        }
+        break;
+      case trace_data:
+        {
+          uint32_t n;
+          if (!_readVarint(trace, n)) return false;
+          while (n > 0)
+          {
+            uint8_t k = n < sizeof(buf) ? n : sizeof(buf);
+            if (trace.readBytes(buf, k) != k) return false;
+            io.writeData(buf, k, false);
+            n -= k;
+          }
+        }
+        break;
+      case trace_pattern:
+        {
+          int d = _readByte(trace);
+          uint32_t n;
+          if ((d < 0) || !_readVarint(trace, n)) return false;
+          io.writeDataPattern(d, n);
+        }
+        break;
+      case trace_start:
+        io.startTransaction();
+        break;
+      case trace_end:
+        io.endTransaction();
+        break;
+      case trace_reset:
+        io.reset();
+        break;
+      case trace_header:
+        if ((_readByte(trace) != 'x') || (_readByte(trace) != 'T') || (_readByte(trace) != trace_version)) return false;
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,71 @@
+// GxIO_File : io class for the GxEPD library
+//
+// writes the command and data stream of a display class as compact binary trace to a Print, e.g. an SD file
+// replay() sends a trace to an io class, e.g. GxIO_SPI, without any drawing
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _GxIO_File_H_
+#define _GxIO_File_H_
+
+#include "../GxIO.h"
+
+// single data bytes written within a transaction are collected into one data record of up to this size
+#if defined(__AVR)
+#define GxIO_File_RUN 16
+#else
+#define GxIO_File_RUN 64
+#endif
+
+// BUSY timeout for replay(), ms
+#define GxIO_File_BUSY_TIMEOUT 20000
+
+class GxIO_File : public GxIO
+{
+  public:
+    // trace format: header "GxT" + version, then records of a tag byte and its arguments, counts as LEB128 varint
+    enum trace_record
+    {
+      trace_command_transaction = 0x01, // command byte, in its own transaction
+      trace_data_transaction = 0x02, // data byte, in its own transaction
+      trace_command = 0x03, // command byte, within a transaction
+      trace_data = 0x04, // count, data bytes, within a transaction
+      trace_pattern = 0x05, // data byte, count, within a transaction
+      trace_start = 0x06, // start of transaction, CS asserted
+      trace_end = 0x07, // end of transaction, CS released
+      trace_reset = 0x08, // reset pulse of the controller
+      trace_header = 'G' // followed by 'x', 'T', version
+    };
+    static const uint8_t trace_version = 1;
+    GxIO_File(Print& out);
+    const char* name = "GxIO_File";
+    void reset();
+    void init(); // writes the header
+    void writeCommandTransaction(uint8_t c);
+    void writeDataTransaction(uint8_t d);
+    void writeData16Transaction(uint16_t d, uint32_t num = 1);
+    void writeCommand(uint8_t c);
+    void writeData(uint8_t d);
+    void writeData(uint8_t* d, uint32_t num);
+    void writeData16(uint16_t d, uint32_t num = 1);
+    void writeData(const uint8_t* d, uint32_t num, bool invert);
+    void writeDataPattern(uint8_t d, uint32_t num);
+    void writeAddrMSBfirst(uint16_t d);
+    void startTransaction();
+    void endTransaction();
+    void setBackLight(bool lit) {};
+    // writes collected data bytes, done by any other record
+    void flush();
+    // sends trace to io at full speed, io must be initialized; before each command waits while busy is at busy_level
+    // returns false for an invalid or truncated trace
+    static bool replay(Stream& trace, GxIO& io, int8_t busy = -1, uint8_t busy_level = HIGH, uint32_t busy_timeout = GxIO_File_BUSY_TIMEOUT);
+  protected:
+    void _writeVarint(uint32_t v);
+    static bool _readVarint(Stream& trace, uint32_t& v);
+    static int _readByte(Stream& trace);
+    Print& _out;
+    uint8_t _run[GxIO_File_RUN];
+    uint8_t _run_count;
+};
+
+#endif
@@ -0,0 +1,196 @@
+// GxIO_Recorder : io class for the GxEPD library
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+
+#include "GxIO_Recorder.h"
+
+GxIO_Recorder::GxIO_Recorder(GxIO& io, GxIO& trace) : _io(io), _trace(trace)
+{
+}
+
+void GxIO_Recorder::reset()
+{
+  _trace.reset();
+  _io.reset();
+}
+
+void GxIO_Recorder::init()
+{
+  _trace.init();
+  _io.init();
+}
+
+void GxIO_Recorder::setFrequency(uint32_t freq)
+{
+  _io.setFrequency(freq);
+}
+
+void GxIO_Recorder::setClockDivider(uint32_t clockDiv)
+{
+  _io.setClockDivider(clockDiv);
+}
+
+uint8_t GxIO_Recorder::transferTransaction(uint8_t d)
+{
+  _trace.writeDataTransaction(d);
+  return _io.transferTransaction(d);
+}
+
+uint16_t GxIO_Recorder::transfer16Transaction(uint16_t d)
+{
+  _trace.writeData16Transaction(d);
+  return _io.transfer16Transaction(d);
+}
+
+uint8_t GxIO_Recorder::readDataTransaction()
+{
+  return _io.readDataTransaction();
+}
+
+uint16_t GxIO_Recorder::readData16Transaction()
+{
+  return _io.readData16Transaction();
+}
+
+uint8_t GxIO_Recorder::readData()
+{
+  return _io.readData();
+}
+
+uint16_t GxIO_Recorder::readData16()
+{
+  return _io.readData16();
+}
+
+uint32_t GxIO_Recorder::readRawData32(uint8_t part)
+{
+  return _io.readRawData32(part);
+}
+
+void GxIO_Recorder::writeCommandTransaction(uint8_t c)
+{
+  _trace.writeCommandTransaction(c);
+  _io.writeCommandTransaction(c);
+}
+
+void GxIO_Recorder::writeDataTransaction(uint8_t d)
+{
+  _trace.writeDataTransaction(d);
+  _io.writeDataTransaction(d);
+}
+
+void GxIO_Recorder::writeData16Transaction(uint16_t d, uint32_t num)
+{
+  _trace.writeData16Transaction(d, num);
+  _io.writeData16Transaction(d, num);
+}
+
+void GxIO_Recorder::writeCommand(uint8_t c)
+{
+  _trace.writeCommand(c);
+  _io.writeCommand(c);
+}
+
+void GxIO_Recorder::writeData(uint8_t d)
+{
+  _trace.writeData(d);
+  _io.writeData(d);
+}
+
+void GxIO_Recorder::writeData(uint8_t* d, uint32_t num)
+{
+  _trace.writeData(d, num);
+  _io.writeData(d, num);
+}
+
+void GxIO_Recorder::writeData16(uint16_t d, uint32_t num)
+{
+  _trace.writeData16(d, num);
+  _io.writeData16(d, num);
+}
+
+void GxIO_Recorder::writeData(const uint8_t* d, uint32_t num, bool invert)
+{
+  _trace.writeData(d, num, invert);
+  _io.writeData(d, num, invert);
+}
+
+void GxIO_Recorder::writeDataPattern(uint8_t d, uint32_t num)
+{
+  _trace.writeDataPattern(d, num);
+  _io.writeDataPattern(d, num);
+}
+
+void GxIO_Recorder::writeDataTransaction(const uint8_t* d, uint32_t num, bool invert)
+{
+  _trace.writeDataTransaction(d, num, invert);
+  _io.writeDataTransaction(d, num, invert);
+}
+
+void GxIO_Recorder::writeDataPatternTransaction(uint8_t d, uint32_t num)
+{
+  _trace.writeDataPatternTransaction(d, num);
+  _io.writeDataPatternTransaction(d, num);
+}
+
+bool GxIO_Recorder::queueCommand(uint8_t c)
+{
+  _trace.writeCommandTransaction(c);
+  return _io.queueCommand(c);
+}
+
+bool GxIO_Recorder::queueData(const uint8_t* d, uint32_t num, bool invert)
+{
+  _trace.writeDataTransaction(d, num, invert);
+  return _io.queueData(d, num, invert);
+}
+
+bool GxIO_Recorder::queueDataPattern(uint8_t d, uint32_t num)
+{
+  _trace.writeDataPatternTransaction(d, num);
+  return _io.queueDataPattern(d, num);
+}
+
+void GxIO_Recorder::startQueue(void (*callback)(void*), void* arg)
+{
+  _io.startQueue(callback, arg);
+}
+
+bool GxIO_Recorder::processQueue()
+{
+  return _io.processQueue();
+}
+
+bool GxIO_Recorder::isQueueBusy()
+{
+  return _io.isQueueBusy();
+}
+
+void GxIO_Recorder::writeAddrMSBfirst(uint16_t d)
+{
+  _trace.writeAddrMSBfirst(d);
+  _io.writeAddrMSBfirst(d);
+}
+
+void GxIO_Recorder::startTransaction()
+{
+  _trace.startTransaction();
+  _io.startTransaction();
+}
+
+void GxIO_Recorder::endTransaction()
+{
+  _trace.endTransaction();
+  _io.endTransaction();
+}
+
+void GxIO_Recorder::selectRegister(bool rs_low)
+{
+  _io.selectRegister(rs_low);
+}
+
+void GxIO_Recorder::setBackLight(bool lit)
+{
+  _io.setBackLight(lit);
+}
@@ -0,0 +1,60 @@
+// GxIO_Recorder : io class for the GxEPD library
+//
+// forwards everything to an io class, e.g. GxIO_SPI, and writes the same stream to a second one, e.g. GxIO_File
+// reads are done by io only, transfer counters are those of io
+// the display classes pulse their own rst pin on wake up, not through io; these resets are not in the trace
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _GxIO_Recorder_H_
+#define _GxIO_Recorder_H_
+
+#include "../GxIO.h"
+
+class GxIO_Recorder : public GxIO
+{
+  public:
+    GxIO_Recorder(GxIO& io, GxIO& trace);
+    const char* name = "GxIO_Recorder";
+    const io_stats& ioStats() {return _io.ioStats();};
+    void resetIOStats() {_io.resetIOStats();};
+    void reset();
+    void init();
+    void setFrequency(uint32_t freq);
+    void setClockDivider(uint32_t clockDiv);
+    uint8_t transferTransaction(uint8_t d);
+    uint16_t transfer16Transaction(uint16_t d);
+    uint8_t readDataTransaction();
+    uint16_t readData16Transaction();
+    uint8_t readData();
+    uint16_t readData16();
+    uint32_t readRawData32(uint8_t part);
+    void writeCommandTransaction(uint8_t c);
+    void writeDataTransaction(uint8_t d);
+    void writeData16Transaction(uint16_t d, uint32_t num = 1);
+    void writeCommand(uint8_t c);
+    void writeData(uint8_t d);
+    void writeData(uint8_t* d, uint32_t num);
+    void writeData16(uint16_t d, uint32_t num = 1);
+    void writeData(const uint8_t* d, uint32_t num, bool invert);
+    void writeDataPattern(uint8_t d, uint32_t num);
+    void writeDataTransaction(const uint8_t* d, uint32_t num, bool invert = false);
+    void writeDataPatternTransaction(uint8_t d, uint32_t num);
+    // queued transfers are written to trace when queued, the queue of io sends them
+    bool queueCommand(uint8_t c);
+    bool queueData(const uint8_t* d, uint32_t num, bool invert = false);
+    bool queueDataPattern(uint8_t d, uint32_t num);
+    void startQueue(void (*callback)(void*) = 0, void* arg = 0);
+    bool processQueue();
+    bool isQueueBusy();
+    void writeAddrMSBfirst(uint16_t d);
+    void startTransaction();
+    void endTransaction();
+    void selectRegister(bool rs_low);
+    void setBackLight(bool lit);
+  protected:
+    GxIO& _io;
+    GxIO& _trace;
+};
+
+#endif
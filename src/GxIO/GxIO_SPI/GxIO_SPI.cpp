@@ -7,7 +7,8 @@
 
 GxIO_SPI::GxIO_SPI(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst, int8_t bl) :
   _spi(spi), _spi_settings(4000000, MSBFIRST, SPI_MODE0),
-  _cs(cs), _dc(dc), _rst(rst), _bl(bl)
+  _cs(cs), _dc(dc), _rst(rst), _bl(bl),
+  _queue_head(0), _queue_count(0), _queue_started(false), _queue_callback(0), _queue_callback_arg(0)
 {
 }
 
@@ -56,6 +57,8 @@ void GxIO_SPI::setFrequency(uint32_t freq)
 
 uint8_t GxIO_SPI::transferTransaction(uint8_t d)
 {
+  _io_stats.transactions++;
+  _io_stats.data_bytes++;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   uint8_t rv = _spi.transfer(d);
@@ -66,6 +69,8 @@ uint8_t GxIO_SPI::transferTransaction(uint8_t d)
 
 uint16_t GxIO_SPI::transfer16Transaction(uint16_t d)
 {
+  _io_stats.transactions++;
+  _io_stats.data_bytes += 2;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   uint16_t rv = _spi.transfer16(d);
@@ -76,6 +81,8 @@ uint16_t GxIO_SPI::transfer16Transaction(uint16_t d)
 
 uint8_t GxIO_SPI::readDataTransaction()
 {
+  _io_stats.transactions++;
+  _io_stats.data_bytes++;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   uint8_t rv = _spi.transfer(0xFF);
@@ -86,6 +93,8 @@ uint8_t GxIO_SPI::readDataTransaction()
 
 uint16_t GxIO_SPI::readData16Transaction()
 {
+  _io_stats.transactions++;
+  _io_stats.data_bytes += 2;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   uint16_t rv = _spi.transfer16(0xFFFF);
@@ -96,18 +105,22 @@ uint16_t GxIO_SPI::readData16Transaction()
 
 uint8_t GxIO_SPI::readData()
 {
+  _io_stats.data_bytes++;
   uint8_t rv = _spi.transfer(0xFF);
   return rv;
 }
 
 uint16_t GxIO_SPI::readData16()
 {
+  _io_stats.data_bytes += 2;
   uint16_t rv = _spi.transfer16(0xFFFF);
   return rv;
 }
 
 void GxIO_SPI::writeCommandTransaction(uint8_t c)
 {
+  _io_stats.transactions++;
+  _io_stats.commands++;
   _spi.beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
@@ -119,6 +132,8 @@ void GxIO_SPI::writeCommandTransaction(uint8_t c)
 
 void GxIO_SPI::writeDataTransaction(uint8_t d)
 {
+  _io_stats.transactions++;
+  _io_stats.data_bytes++;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _spi.transfer(d);
@@ -128,6 +143,7 @@ void GxIO_SPI::writeDataTransaction(uint8_t d)
 
 void GxIO_SPI::writeData16Transaction(uint16_t d, uint32_t num)
 {
+  _io_stats.transactions++;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   writeData16(d, num);
@@ -137,6 +153,7 @@ void GxIO_SPI::writeData16Transaction(uint16_t d, uint32_t num)
 
 void GxIO_SPI::writeCommand(uint8_t c)
 {
+  _io_stats.commands++;
   if (_dc >= 0) digitalWrite(_dc, LOW);
   _spi.transfer(c);
   if (_dc >= 0) digitalWrite(_dc, HIGH);
@@ -144,11 +161,13 @@ void GxIO_SPI::writeCommand(uint8_t c)
 
 void GxIO_SPI::writeData(uint8_t d)
 {
+  _io_stats.data_bytes++;
   _spi.transfer(d);
 }
 
 void GxIO_SPI::writeData(uint8_t* d, uint32_t num)
 {
+  _io_stats.data_bytes += num;
 #if defined(ESP8266) || defined(ESP32)
   _spi.writeBytes(d, num);
 #else
@@ -163,6 +182,7 @@ void GxIO_SPI::writeData(uint8_t* d, uint32_t num)
 
 void GxIO_SPI::writeData16(uint16_t d, uint32_t num)
 {
+  _io_stats.data_bytes += 2 * num;
 #if defined(ESP8266) || defined(ESP32)
   uint8_t b[2] = {uint8_t(d >> 8), uint8_t(d)};
   _spi.writePattern(b, 2, num);
@@ -175,14 +195,174 @@ void GxIO_SPI::writeData16(uint16_t d, uint32_t num)
 #endif
 }
 
+void GxIO_SPI::writeData(const uint8_t* d, uint32_t num, bool invert)
+{
+  _io_stats.data_bytes += num;
+#if defined(ESP8266) || defined(ESP32)
+  if (num == 0) return;
+  if (!invert)
+  {
+    _spi.writeBytes(const_cast<uint8_t*>(d), num);
+    return;
+  }
+  uint8_t b[64]; // inverted chunks for writeBytes
+  while (num > 0)
+  {
+    uint32_t n = num < sizeof(b) ? num : sizeof(b);
+    for (uint32_t i = 0; i < n; i++) b[i] = ~d[i];
+    _spi.writeBytes(b, n);
+    d += n;
+    num -= n;
+  }
+#else
+  uint8_t mask = invert ? 0xFF : 0x00;
+  while (num > 0)
+  {
+    _spi.transfer(*d ^ mask);
+    d++;
+    num--;
+  }
+#endif
+}
+
+void GxIO_SPI::writeDataPattern(uint8_t d, uint32_t num)
+{
+  _io_stats.data_bytes += num;
+#if defined(ESP8266) || defined(ESP32)
+  if (num > 0) _spi.writePattern(&d, 1, num);
+#else
+  while (num > 0)
+  {
+    _spi.transfer(d);
+    num--;
+  }
+#endif
+}
+
+void GxIO_SPI::writeDataTransaction(const uint8_t* d, uint32_t num, bool invert)
+{
+  _io_stats.transactions++;
+  _spi.beginTransaction(_spi_settings);
+  if (_cs >= 0) digitalWrite(_cs, LOW);
+  writeData(d, num, invert);
+  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _spi.endTransaction();
+}
+
+void GxIO_SPI::writeDataPatternTransaction(uint8_t d, uint32_t num)
+{
+  _io_stats.transactions++;
+  _spi.beginTransaction(_spi_settings);
+  if (_cs >= 0) digitalWrite(_cs, LOW);
+  writeDataPattern(d, num);
+  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _spi.endTransaction();
+}
+
+bool GxIO_SPI::queueCommand(uint8_t c)
+{
+  return _queue(queue_command, c, 0, 1);
+}
+
+bool GxIO_SPI::queueData(const uint8_t* d, uint32_t num, bool invert)
+{
+  if (num == 0) return true;
+  return _queue(invert ? queue_data_inverted : queue_data, 0, d, num);
+}
+
+bool GxIO_SPI::queueDataPattern(uint8_t d, uint32_t num)
+{
+  if (num == 0) return true;
+  return _queue(queue_pattern, d, 0, num);
+}
+
+bool GxIO_SPI::_queue(uint8_t op, uint8_t value, const uint8_t* data, uint32_t num)
+{
+  while (_queue_count >= GxIO_SPI_QUEUE_SIZE)
+  {
+    // full, make room by sending
+    _queue_started = true;
+    processQueue();
+  }
+  QueueEntry& e = _queue_entries[(_queue_head + _queue_count) % GxIO_SPI_QUEUE_SIZE];
+  e.op = op;
+  e.value = value;
+  e.data = data;
+  e.num = num;
+  _queue_count++;
+  return true;
+}
+
+void GxIO_SPI::startQueue(void (*callback)(void*), void* arg)
+{
+  _queue_callback = callback;
+  _queue_callback_arg = arg;
+  _queue_started = true;
+  if (_queue_count == 0) processQueue(); // nothing queued, complete now
+}
+
+bool GxIO_SPI::processQueue()
+{
+  if (!_queue_started) return false;
+  uint32_t budget = GxIO_SPI_QUEUE_CHUNK;
+  if (_queue_count > 0)
+  {
+    _io_stats.transactions++;
+    _spi.beginTransaction(_spi_settings);
+    if (_cs >= 0) digitalWrite(_cs, LOW);
+    while ((_queue_count > 0) && (budget > 0))
+    {
+      QueueEntry& e = _queue_entries[_queue_head];
+      if (e.op == queue_command)
+      {
+        writeCommand(e.value);
+        e.num = 0;
+        budget--;
+      }
+      else
+      {
+        uint32_t n = e.num < budget ? e.num : budget;
+        if (e.op == queue_pattern) writeDataPattern(e.value, n);
+        else
+        {
+          writeData(e.data, n, e.op == queue_data_inverted);
+          e.data += n;
+        }
+        e.num -= n;
+        budget -= n;
+      }
+      if (e.num == 0)
+      {
+        _queue_head = (_queue_head + 1) % GxIO_SPI_QUEUE_SIZE;
+        _queue_count--;
+      }
+    }
+    if (_cs >= 0) digitalWrite(_cs, HIGH);
+    _spi.endTransaction();
+  }
+  if (_queue_count > 0) return true;
+  _queue_started = false;
+  void (*callback)(void*) = _queue_callback;
+  _queue_callback = 0;
+  if (callback) callback(_queue_callback_arg);
+  return false;
+}
+
+bool GxIO_SPI::isQueueBusy()
+{
+  return _queue_count > 0;
+}
+
 void GxIO_SPI::writeAddrMSBfirst(uint16_t d)
 {
+  _io_stats.data_bytes += 2;
   _spi.transfer(d >> 8);
   _spi.transfer(d & 0xFF);
 }
 
 void GxIO_SPI::startTransaction()
 {
+  _io_stats.transactions++;
   _spi.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
 }
@@ -8,6 +8,22 @@
 #include <SPI.h>
 #include "../GxIO.h"
 
+// number of entries of the transfer queue
+#if defined(__AVR)
+#define GxIO_SPI_QUEUE_SIZE 4
+#else
+#define GxIO_SPI_QUEUE_SIZE 16
+#endif
+
+// bytes sent per processQueue() call, the bus is released between chunks
+#if defined(__AVR)
+#define GxIO_SPI_QUEUE_CHUNK 64
+#else
+#define GxIO_SPI_QUEUE_CHUNK 1024
+#endif
+
+// the transfer queue is sent by the caller, GxIO_SPI_QUEUE_CHUNK bytes per processQueue(), in order, no DMA;
+// for transfers in the background see GxIO_SPI_Task
 class GxIO_SPI : public GxIO
 {
   public:
@@ -29,15 +45,39 @@ class GxIO_SPI : public GxIO
     void writeData(uint8_t d);
     void writeData(uint8_t* d, uint32_t num);
     void writeData16(uint16_t d, uint32_t num = 1);
+    void writeData(const uint8_t* d, uint32_t num, bool invert);
+    void writeDataPattern(uint8_t d, uint32_t num);
+    void writeDataTransaction(const uint8_t* d, uint32_t num, bool invert = false);
+    void writeDataPatternTransaction(uint8_t d, uint32_t num);
+    bool queueCommand(uint8_t c);
+    bool queueData(const uint8_t* d, uint32_t num, bool invert = false);
+    bool queueDataPattern(uint8_t d, uint32_t num);
+    void startQueue(void (*callback)(void*) = 0, void* arg = 0);
+    bool processQueue();
+    bool isQueueBusy();
     void writeAddrMSBfirst(uint16_t d);
     void startTransaction();
     void endTransaction();
     void selectRegister(bool rs_low); // for generalized readData & writeData (RA8875)
     void setBackLight(bool lit);
   protected:
+    enum QueueOp {queue_command, queue_data, queue_data_inverted, queue_pattern};
+    struct QueueEntry
+    {
+      uint8_t op;
+      uint8_t value; // command or pattern byte
+      const uint8_t* data;
+      uint32_t num;
+    };
+    bool _queue(uint8_t op, uint8_t value, const uint8_t* data, uint32_t num);
     SPIClass& _spi;
     SPISettings _spi_settings;
     int8_t _cs, _dc, _rst, _bl; // Control lines
+    QueueEntry _queue_entries[GxIO_SPI_QUEUE_SIZE];
+    uint8_t _queue_head, _queue_count;
+    bool _queue_started;
+    void (*_queue_callback)(void*);
+    void* _queue_callback_arg;
 };
 
 #define GxIO_Class GxIO_SPI
@@ -0,0 +1,55 @@
+// GxIO_SPI_Task : io class for the GxEPD library, ESP32 only
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include "GxIO_SPI_Task.h"
+
+#if defined(ESP32)
+
+GxIO_SPI_Task::GxIO_SPI_Task(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst, int8_t bl) :
+  GxIO_SPI(spi, cs, dc, rst, bl), _task(0), _done(0), _sending(false)
+{
+}
+
+void GxIO_SPI_Task::startQueue(void (*callback)(void*), void* arg)
+{
+  GxIO_SPI::startQueue(callback, arg); // an empty queue completes here
+  if (!GxIO_SPI::isQueueBusy()) return;
+  if (!_task) // on first use, not at static init
+  {
+    if (!_done) _done = xSemaphoreCreateBinary();
+    if (!_done) return; // sent by processQueue() in the caller
+    if (xTaskCreatePinnedToCore(_run, "GxIO_SPI queue", GxIO_SPI_TASK_STACK, this, uxTaskPriorityGet(NULL), &_task, 1 - xPortGetCoreID()) != pdPASS)
+    {
+      _task = 0;
+      return;
+    }
+  }
+  _sending = true;
+  xTaskNotifyGive(_task);
+}
+
+bool GxIO_SPI_Task::processQueue()
+{
+  while (_sending) xSemaphoreTake(_done, portMAX_DELAY); // a give left from a send not waited for returns at once
+  return GxIO_SPI::processQueue();
+}
+
+bool GxIO_SPI_Task::isQueueBusy()
+{
+  return _sending || GxIO_SPI::isQueueBusy();
+}
+
+void GxIO_SPI_Task::_run(void* p)
+{
+  GxIO_SPI_Task* io = (GxIO_SPI_Task*) p;
+  while (true)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (io->GxIO_SPI::processQueue());
+    io->_sending = false;
+    xSemaphoreGive(io->_done);
+  }
+}
+
+#endif
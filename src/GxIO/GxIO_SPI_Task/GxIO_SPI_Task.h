@@ -0,0 +1,40 @@
+// GxIO_SPI_Task : io class for the GxEPD library, ESP32 only
+//
+// GxIO_SPI with its transfer queue sent by a FreeRTOS task on the other core, for GxEPD::setPipelinedPaging():
+// the transfer of a page overlaps the drawing of the next; entries are queued while the queue is idle, as GxEPD does
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _GxIO_SPI_Task_H_
+#define _GxIO_SPI_Task_H_
+
+#if defined(ESP32)
+
+#include "../GxIO_SPI/GxIO_SPI.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+// stack of the queue task, bytes
+#define GxIO_SPI_TASK_STACK 2048
+
+class GxIO_SPI_Task : public GxIO_SPI
+{
+  public:
+    GxIO_SPI_Task(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst = -1, int8_t bl = -1);
+    const char* name = "GxIO_SPI_Task";
+    // hands the queue to the task, callback is called by the task; sends in the caller if no task can be created
+    void startQueue(void (*callback)(void*) = 0, void* arg = 0);
+    // waits for the task, then sends what is left in the caller
+    bool processQueue();
+    bool isQueueBusy();
+  private:
+    static void _run(void* p);
+    TaskHandle_t _task;
+    SemaphoreHandle_t _done;
+    volatile bool _sending;
+};
+
+#endif
+
+#endif
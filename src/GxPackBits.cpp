@@ -0,0 +1,78 @@
+// class GxPackBits : PackBits Run Length Coding of Bitmap and Image Data for GxEPD
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxPackBits.h"
+
+uint16_t GxPackBits::decode(const uint8_t* in, uint16_t in_size, uint16_t& in_used, uint8_t* out, uint16_t out_size)
+{
+  uint16_t i = 0, o = 0;
+  while (o < out_size)
+  {
+    if (_count == 0)
+    {
+      if (i >= in_size) break;
+      int8_t h = in[i++];
+      if (h == -128) continue;
+      _repeat = (h < 0);
+      _count = _repeat ? 1 - h : h + 1;
+      _have_value = false;
+    }
+    uint16_t k = (_count < out_size - o) ? _count : out_size - o;
+    if (_repeat)
+    {
+      if (!_have_value)
+      {
+        if (i >= in_size) break;
+        _value = in[i++];
+        _have_value = true;
+      }
+      memset(out + o, _value, k);
+    }
+    else
+    {
+      if (k > in_size - i) k = in_size - i;
+      if (k == 0) break;
+      memcpy(out + o, in + i, k);
+      i += k;
+    }
+    o += k;
+    _count -= k;
+  }
+  in_used = i;
+  return o;
+}
+
+uint32_t GxPackBits::encode(const uint8_t* in, uint32_t size, uint8_t* out)
+{
+  uint32_t i = 0, o = 0;
+  while (i < size)
+  {
+    // a repeat of 3 or more, up to 128
+    uint32_t r = 1;
+    while ((i + r < size) && (r < 128) && (in[i + r] == in[i])) r++;
+    if (r >= 3)
+    {
+      out[o++] = uint8_t(1 - int16_t(r));
+      out[o++] = in[i];
+      i += r;
+      continue;
+    }
+    // literals up to the next repeat of 3, up to 128
+    uint32_t n = 0;
+    while ((i + n < size) && (n < 128))
+    {
+      if ((i + n + 2 < size) && (in[i + n] == in[i + n + 1]) && (in[i + n] == in[i + n + 2])) break;
+      n++;
+    }
+    out[o++] = uint8_t(n - 1);
+    memcpy(out + o, in + i, n);
+    o += n;
+    i += n;
+  }
+  return o;
+}
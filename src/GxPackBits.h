@@ -0,0 +1,35 @@
+// class GxPackBits : PackBits Run Length Coding of Bitmap and Image Data for GxEPD
+//
+// a header byte h is followed by h + 1 literal bytes for h 0..127, or by one byte repeated 1 - h times for h -1..-127;
+// -128 is skipped; the decoder is incremental, runs may span the chunks of input and output
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxPackBits_H_
+#define _GxPackBits_H_
+
+#include <Arduino.h>
+
+class GxPackBits
+{
+  public:
+    GxPackBits() {reset();};
+    void reset() {_count = 0; _repeat = false; _have_value = false;};
+    // decodes from in_size bytes at in to up to out_size bytes at out, returns the bytes decoded; in_used : bytes consumed
+    // less than out_size if in is used up, call again with the following input
+    uint16_t decode(const uint8_t* in, uint16_t in_size, uint16_t& in_used, uint8_t* out, uint16_t out_size);
+    bool idle() {return _count == 0;}; // at a header byte, e.g. at the end of the packed data
+    // packs size bytes at in to out, returns the packed size, at most size + (size + 127) / 128 bytes; for generators
+    static uint32_t encode(const uint8_t* in, uint32_t size, uint8_t* out);
+  private:
+    uint8_t _count; // bytes left of the current literal or repeat
+    bool _repeat;
+    bool _have_value; // the byte of the repeat is read
+    uint8_t _value;
+};
+
+#endif
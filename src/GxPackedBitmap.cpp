@@ -0,0 +1,156 @@
+// class GxPackedBitmap : PackBits Packed Bitmaps in Program Memory for GxEPD Display Classes
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#include "GxPackedBitmap.h"
+
+const uint8_t GxPackedBitmap::_tokens[2] = {0, 1};
+
+static inline void _copyFromProgmem(uint8_t* buffer, const uint8_t* p, uint16_t n)
+{
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  memcpy_P(buffer, p, n);
+#else
+  memcpy(buffer, p, n);
+#endif
+}
+
+uint32_t GxPackedBitmap::unpackedSize(const uint8_t* packed)
+{
+  uint8_t header[GxPackedBitmap_HEADER_SIZE];
+  _copyFromProgmem(header, packed, sizeof(header));
+  return header[0] | (uint32_t(header[1]) << 8) | (uint32_t(header[2]) << 16) | (uint32_t(header[3]) << 24);
+}
+
+void GxPackedBitmap::drawBitmap(const uint8_t* packed, uint32_t packed_size, int16_t mode)
+{
+  attach(packed, packed_size);
+  _display.drawBitmap(bitmap(0), size(0), mode);
+  detach();
+}
+
+void GxPackedBitmap::drawExampleBitmap(const uint8_t* packed, uint32_t packed_size, int16_t mode)
+{
+  attach(packed, packed_size);
+  _display.drawExampleBitmap(bitmap(0), size(0), mode);
+  detach();
+}
+
+void GxPackedBitmap::drawPicture(const uint8_t* black_packed, const uint8_t* red_packed, uint32_t black_packed_size, uint32_t red_packed_size, int16_t mode)
+{
+  attach(black_packed, black_packed_size, red_packed, red_packed_size);
+  _display.drawPicture(bitmap(0), bitmap(1), size(0), size(1), mode);
+  detach();
+}
+
+void GxPackedBitmap::drawExamplePicture(const uint8_t* black_packed, const uint8_t* red_packed, uint32_t black_packed_size, uint32_t red_packed_size)
+{
+  attach(black_packed, black_packed_size, red_packed, red_packed_size);
+  _display.drawExamplePicture(bitmap(0), bitmap(1), size(0), size(1));
+  detach();
+}
+
+void GxPackedBitmap::drawBitmap(const uint8_t* packed, uint32_t packed_size, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
+{
+  attach(packed, packed_size);
+  _display.drawBitmap(bitmap(0), x, y, w, h, color, mode);
+  detach();
+}
+
+void GxPackedBitmap::drawExampleBitmap(const uint8_t* packed, uint32_t packed_size, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
+{
+  attach(packed, packed_size);
+  _display.drawExampleBitmap(bitmap(0), x, y, w, h, color, mode);
+  detach();
+}
+
+void GxPackedBitmap::attach(const uint8_t* packed, uint32_t packed_size, const uint8_t* red_packed, uint32_t red_packed_size)
+{
+  _open(_streams[0], packed, packed_size);
+  _open(_streams[1], red_packed, red_packed_size);
+  _display.setBitmapReader(_reader, this, false);
+}
+
+void GxPackedBitmap::detach()
+{
+  _display.setBitmapReader(0);
+}
+
+uint16_t GxPackedBitmap::read(uint8_t i, uint32_t idx, uint8_t* buffer, uint16_t n)
+{
+  stream& s = _streams[i & 1];
+  if (idx >= s.size) return 0;
+  if (n > s.size - idx) n = s.size - idx;
+  uint16_t got = 0;
+  if ((idx < s.idx) && (idx >= s.idx - s.window_len))
+  {
+    // unpacked last, e.g. a byte read for each of its pixels
+    got = (n < s.idx - idx) ? n : s.idx - idx;
+    memcpy(buffer, s.window + s.window_len - (s.idx - idx), got);
+  }
+  else if (idx < s.idx) _restart(s);
+  if (got == n) return got;
+  // skip to idx, through the window
+  while (s.idx < idx)
+  {
+    uint16_t k = (idx - s.idx < sizeof(s.window)) ? idx - s.idx : sizeof(s.window);
+    k = _unpack(s, s.window, k);
+    s.window_len = k;
+    if (k == 0) return got;
+  }
+  got += _unpack(s, buffer + got, n - got);
+  uint16_t keep = (got < sizeof(s.window)) ? got : sizeof(s.window);
+  memcpy(s.window, buffer + got - keep, keep);
+  s.window_len = keep;
+  return got;
+}
+
+uint16_t GxPackedBitmap::_reader(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n)
+{
+  GxPackedBitmap* packed = static_cast<GxPackedBitmap*>(arg);
+  if (bitmap == &_tokens[0]) return packed->read(0, idx, buffer, n);
+  if (bitmap == &_tokens[1]) return packed->read(1, idx, buffer, n);
+  return 0;
+}
+
+void GxPackedBitmap::_open(stream& s, const uint8_t* packed, uint32_t packed_size)
+{
+  s.packed = packed;
+  s.packed_size = packed_size;
+  s.size = (packed && (packed_size >= GxPackedBitmap_HEADER_SIZE)) ? unpackedSize(packed) : 0;
+  _restart(s);
+}
+
+void GxPackedBitmap::_restart(stream& s)
+{
+  s.in_pos = GxPackedBitmap_HEADER_SIZE;
+  s.in_at = s.in_len = 0;
+  s.idx = 0;
+  s.window_len = 0;
+  s.rle.reset();
+}
+
+uint16_t GxPackedBitmap::_unpack(stream& s, uint8_t* buffer, uint16_t n)
+{
+  uint16_t got = 0;
+  while (got < n)
+  {
+    uint16_t used;
+    uint16_t k = s.rle.decode(s.in + s.in_at, s.in_len - s.in_at, used, buffer + got, n - got);
+    got += k;
+    s.in_at += used;
+    if (k || used) continue;
+    // the decoder needs input
+    if (s.in_pos >= s.packed_size) break;
+    s.in_len = (s.packed_size - s.in_pos < sizeof(s.in)) ? s.packed_size - s.in_pos : sizeof(s.in);
+    _copyFromProgmem(s.in, s.packed + s.in_pos, s.in_len);
+    s.in_pos += s.in_len;
+    s.in_at = 0;
+  }
+  s.idx += got;
+  return got;
+}
@@ -0,0 +1,79 @@
+// class GxPackedBitmap : PackBits Packed Bitmaps in Program Memory for GxEPD Display Classes
+//
+// a packed bitmap is the size of the bitmap, 32 bit little endian, followed by the bitmap packed by GxPackBits;
+// packed bitmaps are made from bitmap headers, e.g. BitmapExamples.h, by extras/tools/gxpack, see extras/tools/README.md
+// they are unpacked while drawn, a chunk at a time, through the bitmap reader of GxEPD, to the controller or to the buffer,
+// with the methods and modes of the display class, without a copy of the bitmap; reads in order are unpacked once,
+// a read before the bytes unpacked last starts over from the start of the bitmap
+//
+// Version : see library.properties
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+// Library: https://github.com/ZinggJM/GxEPD
+
+#ifndef _GxPackedBitmap_H_
+#define _GxPackedBitmap_H_
+
+#include <Arduino.h>
+#include "GxEPD.h"
+#include "GxPackBits.h"
+
+#define GxPackedBitmap_HEADER_SIZE 4
+
+// packed bytes copied from program memory per chunk, and unpacked bytes kept for reads of the same bytes again
+#if defined(__AVR)
+#define GxPackedBitmap_CHUNK 32
+#define GxPackedBitmap_WINDOW 16
+#else
+#define GxPackedBitmap_CHUNK 128
+#define GxPackedBitmap_WINDOW 32
+#endif
+
+class GxPackedBitmap
+{
+  public:
+    GxPackedBitmap(GxEPD& display) : _display(display) {};
+    // size of the bitmap, from the header of packed in program memory
+    static uint32_t unpackedSize(const uint8_t* packed);
+    // as the methods of GxEPD with the bitmaps, packed_size is the size of the packed bitmap, e.g. sizeof(BitmapExample1_packed)
+    // to full screen, sent to the controller, no update needed
+    void drawBitmap(const uint8_t* packed, uint32_t packed_size, int16_t mode = GxEPD::bm_normal);
+    void drawExampleBitmap(const uint8_t* packed, uint32_t packed_size, int16_t mode = GxEPD::bm_default);
+    void drawPicture(const uint8_t* black_packed, const uint8_t* red_packed, uint32_t black_packed_size, uint32_t red_packed_size, int16_t mode = GxEPD::bm_normal);
+    void drawExamplePicture(const uint8_t* black_packed, const uint8_t* red_packed, uint32_t black_packed_size, uint32_t red_packed_size);
+    // to buffer, update needed
+    void drawBitmap(const uint8_t* packed, uint32_t packed_size, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode = GxEPD::bm_normal);
+    void drawExampleBitmap(const uint8_t* packed, uint32_t packed_size, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode = GxEPD::bm_default);
+    // sets the bitmap reader of the display to one or two packed bitmaps, for other methods of the display classes,
+    // e.g. drawExamplePicture_3C() of GxGDEW075Z09(bitmap(0), size(0)); detach() after use
+    void attach(const uint8_t* packed, uint32_t packed_size, const uint8_t* red_packed = 0, uint32_t red_packed_size = 0);
+    void detach();
+    const uint8_t* bitmap(uint8_t i) {return &_tokens[i & 1];}; // passed to the display class for the attached bitmap i
+    uint32_t size(uint8_t i) {return _streams[i & 1].size;}; // of the attached bitmap i
+    // n bytes from index idx of the attached bitmap i to buffer, returns the bytes unpacked
+    uint16_t read(uint8_t i, uint32_t idx, uint8_t* buffer, uint16_t n);
+  private:
+    struct stream
+    {
+      const uint8_t* packed; // in program memory
+      uint32_t packed_size;
+      uint32_t size; // unpacked
+      uint32_t in_pos; // of the next packed byte to copy to in
+      uint32_t idx; // of the next byte unpacked
+      uint16_t in_at, in_len;
+      uint16_t window_len; // bytes before idx in window
+      GxPackBits rle;
+      uint8_t in[GxPackedBitmap_CHUNK];
+      uint8_t window[GxPackedBitmap_WINDOW];
+    };
+    static uint16_t _reader(void* arg, const uint8_t* bitmap, uint32_t idx, uint8_t* buffer, uint16_t n);
+    void _open(stream& s, const uint8_t* packed, uint32_t packed_size);
+    void _restart(stream& s);
+    uint16_t _unpack(stream& s, uint8_t* buffer, uint16_t n);
+    GxEPD& _display;
+    stream _streams[2];
+    static const uint8_t _tokens[2];
+};
+
+#endif
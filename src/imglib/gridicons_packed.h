@@ -0,0 +1,1501 @@
+// gridicons_packed.h : packed bitmaps for GxPackedBitmap, made by extras/tools/gxpack from gridicons_add.h gridicons_add_image.h gridicons_add_outline.h gridicons_align_center.h gridicons_align_image_center.h gridicons_align_image_left.h gridicons_align_image_none.h gridicons_align_image_right.h gridicons_align_justify.h gridicons_align_left.h gridicons_align_right.h gridicons_arrow_down.h gridicons_arrow_left.h gridicons_arrow_right.h gridicons_arrow_up.h gridicons_aside.h gridicons_attachment.h gridicons_audio.h gridicons_bell.h gridicons_block.h gridicons_bold.h gridicons_book.h gridicons_bookmark.h gridicons_bookmark_outline.h gridicons_briefcase.h gridicons_bug.h gridicons_calendar.h gridicons_camera.h gridicons_caption.h gridicons_cart.h gridicons_chat.h gridicons_checkmark.h gridicons_checkmark_circle.h gridicons_chevron_down.h gridicons_chevron_left.h gridicons_chevron_right.h gridicons_chevron_up.h gridicons_clear_formatting.h gridicons_clipboard.h gridicons_cloud.h gridicons_cloud_download.h gridicons_cloud_upload.h gridicons_code.h gridicons_cog.h gridicons_comment.h gridicons_computer.h gridicons_create.h gridicons_credit_card.h gridicons_crop.h gridicons_cross.h gridicons_cross_circle.h gridicons_cross_small.h gridicons_custom_post_type.h gridicons_dropdown.h gridicons_ellipsis.h gridicons_ellipsis_circle.h gridicons_external.h gridicons_flag.h gridicons_flip_horizontal.h gridicons_flip_vertical.h gridicons_folder.h gridicons_folder_multiple.h gridicons_fullscreen.h gridicons_fullscreen_exit.h gridicons_globe.h gridicons_grid.h gridicons_heading.h gridicons_heading_h1.h gridicons_heading_h2.h gridicons_heading_h4.h gridicons_heart.h gridicons_heart_outline.h gridicons_help.h gridicons_help_outline.h gridicons_history.h gridicons_house.h gridicons_image.h gridicons_image_multiple.h gridicons_indent_left.h gridicons_indent_right.h gridicons_info.h gridicons_info_outline.h gridicons_ink.h gridicons_institution.h gridicons_italic.h gridicons_layout.h gridicons_layout_blocks.h gridicons_link.h gridicons_link_break.h gridicons_list_checkmark.h gridicons_list_unordered.h gridicons_location.h gridicons_lock.h gridicons_mail.h gridicons_mention.h gridicons_menu.h gridicons_menus.h gridicons_microphone.h gridicons_minus.h gridicons_minus_small.h gridicons_money.h gridicons_nametag.h gridicons_next_page.h gridicons_not_visible.h gridicons_notice.h gridicons_notice_outline.h gridicons_offline.h gridicons_pages.h gridicons_pause.h gridicons_pencil.h gridicons_phone.h gridicons_play.h gridicons_plugins.h gridicons_plus.h gridicons_plus_small.h gridicons_popout.h gridicons_posts.h gridicons_print.h gridicons_product.h gridicons_product_downloadable.h gridicons_product_external.h gridicons_product_virtual.h gridicons_read_more.h gridicons_reader.h gridicons_reader_follow.h gridicons_reader_following.h gridicons_reblog.h gridicons_redo.h gridicons_refresh.h gridicons_reply.h gridicons_resize.h gridicons_rotate.h gridicons_scheduled.h gridicons_search.h gridicons_share_computer.h gridicons_share_ios.h gridicons_shipping.h gridicons_sign_out.h gridicons_spam.h gridicons_speaker.h gridicons_star.h gridicons_star_outline.h gridicons_stats.h gridicons_stats_alt.h gridicons_status.h gridicons_sync.h gridicons_tablet.h gridicons_tag.h gridicons_text_color.h gridicons_themes.h gridicons_thumbs_up.h gridicons_time.h gridicons_trash.h gridicons_trophy.h gridicons_types.h gridicons_underline.h gridicons_undo.h gridicons_user.h gridicons_user_add.h gridicons_user_circle.h gridicons_video.h gridicons_video_camera.h gridicons_visible.h
+//
+// e.g. GxPackedBitmap(display).drawExampleBitmap(name_packed, sizeof(name_packed))
+
+#ifndef _gridicons_packed_H_
+#define _gridicons_packed_H_
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+// gridicons_add : 72 bytes, packed 67
+const unsigned char gridicons_add_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF0,
+0x00,0x1F,0xF0,0x00,0x0F,0xE0,0x18,0x07,0xE0,0x18,0x07,0xC0,0x18,0x03,0xC0,0x18,
+0x03,0xC1,0xFF,0x83,0xC1,0xFF,0x83,0xC0,0x18,0x03,0xC0,0x18,0x03,0xE0,0x18,0x07,
+0xE0,0x18,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_add_image : 72 bytes, packed 66
+const unsigned char gridicons_add_image_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFE,0xFF,0x38,0xF3,0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xFF,0xFF,
+0x80,0x60,0x1F,0x80,0x60,0x0F,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xBF,0xCF,0xFF,
+0x1D,0xCF,0xFF,0xBC,0xCF,0xF3,0xF8,0x4F,0xF3,0xF0,0x0F,0xF2,0x60,0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,
+0xF5,0xFF,
+};
+
+// gridicons_add_outline : 72 bytes, packed 64
+const unsigned char gridicons_add_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x10,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3E,0x1F,0xF1,
+0xFF,0x9F,0xF3,0xFF,0xCF,0xE3,0xE7,0xC7,0xFE,0xE7,0x11,0xCF,0xE7,0xF3,0xCF,0xE7,
+0xF3,0xCE,0x00,0x73,0xCE,0x00,0x73,0xCF,0xE7,0xF3,0xCF,0xE7,0xE3,0xFB,0xE7,0x0D,
+0xF3,0xFF,0xCF,0xF1,0xFF,0x0F,0xF8,0x7E,0x1F,0xFE,0x00,0x7F,0xFF,0x81,0xFA,0xFF,
+};
+
+// gridicons_align_center : 72 bytes, packed 42
+const unsigned char gridicons_align_center_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFB,0xFF,0x05,
+0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xFB,0xFF,0x05,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFB,
+0xFF,0x05,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF2,0xFF,
+};
+
+// gridicons_align_image_center : 72 bytes, packed 43
+const unsigned char gridicons_align_image_center_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xFA,0xFF,0x0F,
+0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
+0xFA,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xF2,0xFF,
+};
+
+// gridicons_align_image_left : 72 bytes, packed 45
+const unsigned char gridicons_align_image_left_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xFB,0xFF,0x11,
+0xE0,0x18,0x07,0xE0,0x18,0x07,0xFF,0xF8,0x07,0xFF,0xF8,0x07,0xE0,0x18,0x07,0xE0,
+0x18,0x07,0xFB,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xF2,0xFF,
+};
+
+// gridicons_align_image_none : 72 bytes, packed 44
+const unsigned char gridicons_align_image_none_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xFA,0xFF,0x10,
+0xF8,0x07,0xFF,0xF8,0x07,0xFF,0xF8,0x07,0xFF,0xF8,0x07,0xFF,0xF8,0x07,0xFF,0xF8,
+0x07,0xFB,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xF2,0xFF,
+};
+
+// gridicons_align_image_right : 72 bytes, packed 45
+const unsigned char gridicons_align_image_right_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xFB,0xFF,0x11,
+0xE0,0x18,0x07,0xE0,0x18,0x07,0xE0,0x1F,0xFF,0xE0,0x1F,0xFF,0xE0,0x18,0x07,0xE0,
+0x18,0x07,0xFB,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xF2,0xFF,
+};
+
+// gridicons_align_justify : 72 bytes, packed 42
+const unsigned char gridicons_align_justify_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xFB,0xFF,0x05,
+0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xFB,0xFF,0x05,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xFB,
+0xFF,0x05,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF2,0xFF,
+};
+
+// gridicons_align_left : 72 bytes, packed 40
+const unsigned char gridicons_align_left_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF1,0xFF,0x04,0xC0,0x0F,0xFF,0xC0,0x0F,0xFB,0xFF,0x05,0xF0,
+0x00,0x0F,0xF0,0x00,0x0F,0xFA,0xFF,0x04,0xC0,0x0F,0xFF,0xC0,0x0F,0xFB,0xFF,0x05,
+0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF2,0xFF,
+};
+
+// gridicons_align_right : 72 bytes, packed 40
+const unsigned char gridicons_align_right_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x04,0xF0,0x03,0xFF,0xF0,0x03,0xFA,0xFF,0x05,0xF0,
+0x00,0x0F,0xF0,0x00,0x0F,0xFB,0xFF,0x04,0xF0,0x03,0xFF,0xF0,0x03,0xFA,0xFF,0x05,
+0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF2,0xFF,
+};
+
+// gridicons_arrow_down : 72 bytes, packed 55
+const unsigned char gridicons_arrow_down_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,
+0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xF3,0xE7,0xCF,0xF1,0xE7,
+0x8F,0xF8,0xE7,0x1F,0xFC,0x66,0x3F,0xFE,0x24,0x7F,0xFF,0x00,0xFF,0xFF,0x81,0xFF,
+0xFF,0xC3,0xFF,0xFF,0xE7,0xF4,0xFF,
+};
+
+// gridicons_arrow_left : 72 bytes, packed 55
+const unsigned char gridicons_arrow_left_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0xE7,0xFF,0xFF,0xE3,0xFF,0xFF,0xF1,0xFF,0xFF,
+0xF8,0xFF,0xFF,0xFC,0x7F,0xFF,0xFE,0x3F,0xFF,0xFF,0x1F,0xF0,0x00,0x0F,0xF0,0x00,
+0x0F,0xFF,0xFF,0x1F,0xFF,0xFE,0x3F,0xFF,0xFC,0x7F,0xFF,0xF8,0xFF,0xFF,0xF1,0xFF,
+0xFF,0xE3,0xFF,0xFF,0xE7,0xF4,0xFF,
+};
+
+// gridicons_arrow_right : 72 bytes, packed 55
+const unsigned char gridicons_arrow_right_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0xE7,0xFF,0xFF,0xC7,0xFF,0xFF,0x8F,0xFF,0xFF,
+0x1F,0xFF,0xFE,0x3F,0xFF,0xFC,0x7F,0xFF,0xF8,0xFF,0xFF,0xF0,0x00,0x0F,0xF0,0x00,
+0x0F,0xF8,0xFF,0xFF,0xFC,0x7F,0xFF,0xFE,0x3F,0xFF,0xFF,0x1F,0xFF,0xFF,0x8F,0xFF,
+0xFF,0xC7,0xFF,0xFF,0xE7,0xF4,0xFF,
+};
+
+// gridicons_arrow_up : 72 bytes, packed 55
+const unsigned char gridicons_arrow_up_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0xE7,0xFF,0xFF,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,
+0x00,0xFF,0xFE,0x24,0x7F,0xFC,0x66,0x3F,0xF8,0xE7,0x1F,0xF1,0xE7,0x8F,0xF3,0xE7,
+0xCF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,
+0xFF,0xE7,0xFF,0xFF,0xE7,0xF4,0xFF,
+};
+
+// gridicons_aside : 72 bytes, packed 57
+const unsigned char gridicons_aside_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF3,0xFF,0xCF,
+0xF3,0xFF,0xCF,0xF3,0x00,0xCF,0xF3,0x00,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF0,
+0x1F,0xCF,0xF0,0x0F,0xCF,0xF0,0x0F,0xCF,0xFC,0x0F,0xCF,0xFC,0x0F,0xCF,0xFF,0x0F,
+0xCF,0xFF,0x00,0x0F,0xFF,0xC0,0x1F,0xF5,0xFF,
+};
+
+// gridicons_attachment : 72 bytes, packed 73
+const unsigned char gridicons_attachment_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFD,0xFF,0x3F,0x0F,0xFF,0xFC,0x03,0xFF,0xFC,0x73,0xFF,0xF9,
+0xF1,0xFF,0xF9,0xF9,0xFF,0xF9,0x99,0xFF,0xF9,0x99,0xFF,0xF9,0x99,0xFF,0xF9,0x99,
+0xFF,0xF9,0x99,0xFF,0xF9,0x99,0x9F,0xF9,0x99,0x9F,0xF9,0x99,0x9F,0xF9,0x99,0x9F,
+0xF9,0x99,0x9F,0xF9,0x99,0x9F,0xF9,0x81,0x9F,0xFC,0xE3,0x3F,0xFC,0xFE,0x3F,0xFE,
+0x3C,0x7F,0xFF,0x00,0xFF,0xFF,0x81,0xFD,0xFF,
+};
+
+// gridicons_audio : 72 bytes, packed 57
+const unsigned char gridicons_audio_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xF8,0x00,0xFF,0xF8,0x00,0xFF,0xF8,0x00,0xFF,
+0xF9,0xFC,0xFF,0xF9,0xFC,0xFF,0xF9,0xFC,0xFF,0xF9,0xFC,0xFF,0xF8,0x3C,0xFF,0xF8,
+0x1C,0xFF,0xF8,0x1C,0xFF,0xF8,0x1C,0x1F,0xF8,0x1C,0x1F,0xFC,0x3C,0x0F,0xFF,0xFC,
+0x0F,0xFF,0xFC,0x0F,0xFF,0xFE,0x1F,0xF5,0xFF,
+};
+
+// gridicons_bell : 72 bytes, packed 62
+const unsigned char gridicons_bell_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x34,0xFE,0x1F,0xFF,0xF8,0x07,0xFF,0xF0,0x03,0xFF,
+0xF0,0x01,0xFF,0xE0,0x00,0xFF,0xE0,0x00,0x7F,0xE0,0x00,0x07,0xE0,0x00,0x0F,0xF0,
+0x00,0x1F,0xF0,0x00,0x3F,0xF8,0x00,0x7F,0xFC,0x00,0xFF,0xFE,0x01,0xBF,0xFF,0x03,
+0x3F,0xFF,0x86,0x3F,0xFF,0x8F,0xFF,0xFF,0x9F,0xFF,0xFF,0xBF,0xF7,0xFF,
+};
+
+// gridicons_block : 72 bytes, packed 67
+const unsigned char gridicons_block_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3C,0x1F,0xF0,
+0xFF,0x0F,0xF0,0xFF,0xCF,0xE0,0x7F,0xC7,0xE6,0x3F,0xE7,0xCF,0x1F,0xF3,0xCF,0x8F,
+0xF3,0xCF,0xC7,0xF3,0xCF,0xE3,0xF3,0xCF,0xF1,0xF3,0xC7,0xF8,0xE3,0xE7,0xFC,0x67,
+0xE7,0xFE,0x07,0xF3,0xFF,0x0F,0xF1,0xFF,0x0F,0xF8,0x3E,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_bold : 72 bytes, packed 53
+const unsigned char gridicons_bold_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF1,0xFF,0x2B,0x80,0x7F,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFC,
+0x3C,0x7F,0xFC,0x3C,0x7F,0xFE,0x3C,0x7F,0xFE,0x00,0x7F,0xFF,0x00,0x7F,0xFE,0x00,
+0x7F,0xFC,0x7C,0x7F,0xFC,0x7C,0x7F,0xFC,0x7C,0x7F,0xFC,0x00,0x7F,0xFE,0x00,0x7F,
+0xFF,0x80,0x7F,0xF5,0xFF,
+};
+
+// gridicons_book : 72 bytes, packed 63
+const unsigned char gridicons_book_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xF8,0x00,0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,
+0xF0,0xFC,0x4F,0xF0,0x00,0x4F,0xF0,0xFC,0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,0xF0,
+0x00,0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,0xF0,0x00,
+0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,0xF0,0x00,0x4F,0xF8,0x00,0x4F,0xF8,0xFF,
+};
+
+// gridicons_bookmark : 72 bytes, packed 63
+const unsigned char gridicons_bookmark_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,
+0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,
+0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,
+0x1F,0xF8,0x18,0x1F,0xF8,0x7E,0x1F,0xF8,0xFF,0x1F,0xFB,0xFF,0xDF,0xF8,0xFF,
+};
+
+// gridicons_bookmark_outline : 72 bytes, packed 63
+const unsigned char gridicons_bookmark_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xF9,0xFF,0x9F,
+0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,
+0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF9,0xE7,0x9F,0xF9,0x81,
+0x9F,0xF8,0x18,0x1F,0xF8,0x7E,0x1F,0xF8,0xFF,0x1F,0xFB,0xFF,0xDF,0xF8,0xFF,
+};
+
+// gridicons_briefcase : 72 bytes, packed 66
+const unsigned char gridicons_briefcase_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x1D,0xFE,0x00,0x7F,0xFC,0x00,0x3F,0xFC,0xFF,0x3F,
+0xFC,0xFF,0x3F,0xE0,0x00,0x07,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,
+0x00,0x03,0xC0,0x00,0x03,0xFE,0xFF,0x17,0xC0,0x3C,0x03,0xC0,0x3C,0x03,0xC0,0x00,
+0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE0,0x00,0x07,
+0xF8,0xFF,
+};
+
+// gridicons_bug : 72 bytes, packed 64
+const unsigned char gridicons_bug_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x36,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x00,0xFF,0xFF,
+0x00,0xFF,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xFC,0x18,
+0x3F,0xFC,0x18,0x3F,0xC0,0x18,0x03,0xC0,0x18,0x03,0xFC,0x18,0x3F,0xFC,0x18,0x3F,
+0xF0,0x18,0x0F,0xE0,0x18,0x07,0xE6,0x18,0x67,0xE7,0x18,0xE7,0xFF,0xDB,0xF7,0xFF,
+};
+
+// gridicons_calendar : 72 bytes, packed 66
+const unsigned char gridicons_calendar_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x38,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xF0,0x00,0x0F,
+0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,
+0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,
+0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,
+0xF8,0xFF,
+};
+
+// gridicons_camera : 72 bytes, packed 60
+const unsigned char gridicons_camera_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x32,0xFE,0x07,0xFF,0xFC,0x03,0x0F,0xE0,0x00,0x07,
+0xC0,0x00,0x03,0xC0,0xF0,0x03,0xC1,0xF8,0x63,0xC3,0x0C,0x63,0xC6,0x06,0x03,0xC6,
+0x06,0x03,0xC6,0x06,0x03,0xC6,0x06,0x03,0xC3,0x8C,0x03,0xC1,0xF8,0x03,0xC0,0xF0,
+0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE0,0x00,0x07,0xF5,0xFF,
+};
+
+// gridicons_caption : 72 bytes, packed 57
+const unsigned char gridicons_caption_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xFE,0x00,0x07,0x8F,0x00,0x03,0x87,0xFF,0xF3,
+0x83,0xFF,0xF3,0xC1,0xFF,0xF3,0xC0,0xFF,0xF3,0xE0,0x7F,0xF3,0xF0,0x3F,0xF3,0xF8,
+0x1F,0xF3,0xDC,0x0F,0xF3,0xDE,0x0F,0xF3,0xCF,0x80,0x33,0xCF,0x80,0x33,0xCF,0xFF,
+0xF3,0xC0,0x00,0x03,0xE0,0x00,0x07,0xF5,0xFF,
+};
+
+// gridicons_cart : 72 bytes, packed 67
+const unsigned char gridicons_cart_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF9,0xFF,0x2A,0xC7,0xFF,0xFF,0x87,0xFF,0xFF,0x9F,0xE0,0x00,
+0x1F,0xE0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,
+0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xFF,0xFF,0x9F,0xFF,0xFF,0x9F,0xFC,0x00,0x1F,0xF8,
+0x00,0x3F,0xFE,0xFF,0x0B,0xFC,0xFF,0x3F,0xF8,0x7E,0x1F,0xF8,0x7E,0x1F,0xFC,0xFF,
+0x3F,0xFB,0xFF,
+};
+
+// gridicons_chat : 72 bytes, packed 60
+const unsigned char gridicons_chat_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x32,0xE0,0x07,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,
+0xC0,0x03,0xFF,0xC0,0x3F,0xFF,0xC0,0x20,0x07,0xC0,0x40,0x03,0xC0,0x40,0x03,0xC0,
+0x40,0x03,0xE1,0xC0,0x03,0xF1,0xC0,0x03,0xFD,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xE0,
+0x03,0xFF,0xFF,0x87,0xFF,0xFF,0x8F,0xFF,0xFF,0xBF,0xF8,0xFF,
+};
+
+// gridicons_checkmark : 72 bytes, packed 47
+const unsigned char gridicons_checkmark_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEF,0xFF,0x25,0xC7,0xFF,0xFF,0xE3,0xFF,0xFF,0xF1,0xFF,0xFF,
+0xF8,0xFF,0xFF,0xFC,0x7F,0xFF,0xFE,0x3F,0xFF,0xFF,0x1F,0xE3,0xFF,0x8F,0xC7,0xFF,
+0xC7,0x8F,0xFF,0xE3,0x1F,0xFF,0xF0,0x3F,0xFF,0xF8,0x7F,0xFF,0xFC,0xF1,0xFF,
+};
+
+// gridicons_checkmark_circle : 72 bytes, packed 67
+const unsigned char gridicons_checkmark_circle_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF8,
+0x00,0x0F,0xF8,0x00,0x0F,0xFC,0x00,0x07,0xEE,0x00,0x07,0xC7,0x00,0x03,0xC3,0x80,
+0x03,0xC1,0xC0,0x03,0xC0,0xE1,0x83,0xC0,0x73,0x83,0xC0,0x3F,0x03,0xE0,0x1E,0x07,
+0xE0,0x0C,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_chevron_down : 72 bytes, packed 35
+const unsigned char gridicons_chevron_down_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xE9,0xFF,0x19,0xF3,0xFF,0xCF,0xF1,0xFF,0x8F,0xF8,0xFF,0x1F,
+0xFC,0x7E,0x3F,0xFE,0x3C,0x7F,0xFF,0x18,0xFF,0xFF,0x81,0xFF,0xFF,0xC3,0xFF,0xFF,
+0xE7,0xEB,0xFF,
+};
+
+// gridicons_chevron_left : 72 bytes, packed 55
+const unsigned char gridicons_chevron_left_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0x9F,0xFF,0xFF,0x8F,0xFF,0xFF,0xC7,0xFF,0xFF,
+0xE3,0xFF,0xFF,0xF1,0xFF,0xFF,0xF8,0xFF,0xFF,0xFC,0x7F,0xFF,0xFE,0x3F,0xFF,0xFE,
+0x3F,0xFF,0xFC,0x7F,0xFF,0xF8,0xFF,0xFF,0xF1,0xFF,0xFF,0xE3,0xFF,0xFF,0xC7,0xFF,
+0xFF,0x8F,0xFF,0xFF,0x9F,0xF4,0xFF,
+};
+
+// gridicons_chevron_right : 72 bytes, packed 55
+const unsigned char gridicons_chevron_right_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0xF9,0xFF,0xFF,0xF1,0xFF,0xFF,0xE3,0xFF,0xFF,
+0xC7,0xFF,0xFF,0x8F,0xFF,0xFF,0x1F,0xFF,0xFE,0x3F,0xFF,0xFC,0x7F,0xFF,0xFC,0x7F,
+0xFF,0xFE,0x3F,0xFF,0xFF,0x1F,0xFF,0xFF,0x8F,0xFF,0xFF,0xC7,0xFF,0xFF,0xE3,0xFF,
+0xFF,0xF1,0xFF,0xFF,0xF9,0xF4,0xFF,
+};
+
+// gridicons_chevron_up : 72 bytes, packed 35
+const unsigned char gridicons_chevron_up_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEB,0xFF,0x19,0xE7,0xFF,0xFF,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,
+0x18,0xFF,0xFE,0x3C,0x7F,0xFC,0x7E,0x3F,0xF8,0xFF,0x1F,0xF1,0xFF,0x8F,0xF3,0xFF,
+0xCF,0xE9,0xFF,
+};
+
+// gridicons_clear_formatting : 72 bytes, packed 63
+const unsigned char gridicons_clear_formatting_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x35,0xC7,0xC3,0xFF,0xC3,0x81,0xFF,0xE1,0x81,0xFF,
+0xF0,0xC1,0xFF,0xF8,0x78,0xFF,0xFC,0x38,0xFF,0xFE,0x18,0xFF,0xFE,0x0C,0x7F,0xFE,
+0x06,0x7F,0xFE,0x03,0x7F,0xFC,0x01,0xFF,0xFC,0x00,0xFF,0xF8,0x78,0x7F,0xF8,0x7C,
+0x3F,0xF8,0xFE,0x1F,0xFF,0xFF,0x0F,0xFF,0xFF,0x8F,0xFF,0xFF,0xCF,0xFB,0xFF,
+};
+
+// gridicons_clipboard : 72 bytes, packed 68
+const unsigned char gridicons_clipboard_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x3A,0xE7,0xFF,0xF8,0xC3,0x1F,0xF0,0xC3,0x0F,0xF3,
+0x81,0xCF,0xF3,0x00,0xCF,0xF3,0x00,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,
+0xCF,0xF3,0xFF,0xCF,0xF3,0x00,0xCF,0xF3,0x00,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,
+0xF3,0x00,0xCF,0xF3,0x00,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF0,0x00,0x0F,0xF8,
+0x00,0x1F,0xFB,0xFF,
+};
+
+// gridicons_cloud : 72 bytes, packed 53
+const unsigned char gridicons_cloud_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x2B,0xC1,0xFF,0xFF,0x00,0x7F,0xFF,0x00,0x7F,0xFE,
+0x00,0x3F,0xFC,0x00,0x1F,0xFC,0x00,0x1F,0xF0,0x00,0x1F,0xE0,0x00,0x1F,0xC0,0x00,
+0x07,0x80,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xC0,0x00,0x01,
+0xE0,0x00,0x03,0xEF,0xFF,
+};
+
+// gridicons_cloud_download : 72 bytes, packed 53
+const unsigned char gridicons_cloud_download_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x2B,0xC1,0xFF,0xFF,0x00,0x7F,0xFF,0x00,0x7F,0xFE,
+0x00,0x3F,0xFC,0x00,0x1F,0xFC,0x18,0x1F,0xF0,0x18,0x1F,0xC0,0x18,0x1F,0xC1,0xFF,
+0x87,0x80,0xFF,0x03,0x80,0x7E,0x01,0x80,0x3C,0x01,0x80,0x18,0x01,0xC0,0x00,0x01,
+0xE0,0x00,0x03,0xEF,0xFF,
+};
+
+// gridicons_cloud_upload : 72 bytes, packed 53
+const unsigned char gridicons_cloud_upload_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x2B,0xC1,0xFF,0xFF,0x00,0x7F,0xFF,0x00,0x7F,0xFE,
+0x00,0x3F,0xFC,0x00,0x1F,0xFC,0x00,0x1F,0xF0,0x18,0x1F,0xC0,0x3C,0x1F,0xC0,0x7E,
+0x07,0x80,0xFF,0x03,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0xC0,0x00,0x01,
+0xE0,0x00,0x03,0xEF,0xFF,
+};
+
+// gridicons_code : 72 bytes, packed 67
+const unsigned char gridicons_code_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x15,0xBF,0xFF,0xFF,0x9F,0xFF,0xFF,0x9F,0xFF,0xFF,
+0x9F,0xFF,0xFC,0x8F,0x3F,0xF9,0xCF,0x9F,0xF1,0xCF,0x8F,0xE3,0xCF,0xFE,0xC7,0x07,
+0xE3,0x8F,0xE7,0xF1,0x8F,0xE7,0xF1,0xC7,0xFE,0xE3,0x15,0xF3,0xC7,0xF1,0xF3,0x8F,
+0xF9,0xF3,0x9F,0xFC,0xF1,0x3F,0xFF,0xF9,0xFF,0xFF,0xF9,0xFF,0xFF,0xF9,0xFF,0xFF,
+0xFD,0xFA,0xFF,
+};
+
+// gridicons_cog : 72 bytes, packed 67
+const unsigned char gridicons_cog_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0x81,0xFF,0xF6,
+0x00,0x6F,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x3C,0x07,0xE0,0x7E,0x07,0xF0,0xFF,
+0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xE0,0x7E,0x07,0xE0,0x3C,0x07,
+0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF6,0x00,0x6F,0xFF,0x81,0xFF,0xFF,0xC3,0xFF,0xFF,
+0xC3,0xFA,0xFF,
+};
+
+// gridicons_comment : 72 bytes, packed 62
+const unsigned char gridicons_comment_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x34,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x00,0x07,
+0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,
+0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x0F,0xF0,0x3F,
+0xFF,0xF8,0x3F,0xFF,0xFE,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0xBF,0xFA,0xFF,
+};
+
+// gridicons_computer : 72 bytes, packed 69
+const unsigned char gridicons_computer_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xE0,0x00,0x07,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,
+0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,
+0xF3,0xC0,0x00,0x03,0xE0,0x00,0x07,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xFE,0x00,0x7F,
+0xFE,0x00,0x7F,0xFB,0xFF,
+};
+
+// gridicons_create : 72 bytes, packed 62
+const unsigned char gridicons_create_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x34,0xE0,0x0F,0xF0,0xF0,0x07,0xF0,0xFF,0xE7,0xF0,
+0xFF,0xE7,0xF1,0x1F,0xE7,0xFF,0x1F,0xE7,0xFE,0x07,0xE7,0xFE,0x07,0xE7,0xEF,0x01,
+0xE7,0xEF,0x81,0xE7,0xE7,0xC0,0x67,0xE7,0xE0,0x67,0xE7,0xF0,0x67,0xE7,0xF8,0x67,
+0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF8,0xFF,
+};
+
+// gridicons_credit_card : 72 bytes, packed 57
+const unsigned char gridicons_credit_card_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xE0,0x00,0x07,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xCF,
+0xFF,0xF3,0xCF,0xFF,0xF3,0xCC,0x60,0x33,0xCC,0x60,0x33,0xCF,0xFF,0xF3,0xCF,0xFF,
+0xF3,0xC0,0x00,0x03,0xE0,0x00,0x07,0xF5,0xFF,
+};
+
+// gridicons_crop : 72 bytes, packed 65
+const unsigned char gridicons_crop_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF9,0xFF,0x37,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,
+0x3F,0xFE,0x00,0x03,0xFC,0x00,0x03,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,
+0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xC0,
+0x00,0x3F,0xC0,0x00,0x7F,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xFF,0xFF,0xFC,0xF9,
+0xFF,
+};
+
+// gridicons_cross : 72 bytes, packed 57
+const unsigned char gridicons_cross_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xFB,0xFF,0xDF,0xF1,0xFF,0x8F,0xF8,0xFF,0x1F,
+0xFC,0x7E,0x3F,0xFE,0x3C,0x7F,0xFF,0x18,0xFF,0xFF,0x81,0xFF,0xFF,0xC3,0xFF,0xFF,
+0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x18,0xFF,0xFE,0x3C,0x7F,0xFC,0x7E,0x3F,0xF8,0xFF,
+0x1F,0xF1,0xFF,0x8F,0xFB,0xFF,0xDF,0xF5,0xFF,
+};
+
+// gridicons_cross_circle : 72 bytes, packed 67
+const unsigned char gridicons_cross_circle_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF0,
+0x00,0x0F,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x42,0x07,0xC0,0xE7,0x03,0xC0,0x7E,
+0x03,0xC0,0x3C,0x03,0xC0,0x3C,0x03,0xC0,0x7E,0x03,0xC0,0xE7,0x03,0xE0,0x42,0x07,
+0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xFC,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_cross_small : 72 bytes, packed 39
+const unsigned char gridicons_cross_small_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEC,0xFF,0x1D,0xFC,0x7E,0x3F,0xFE,0x3C,0x7F,0xFF,0x18,0xFF,
+0xFF,0x81,0xFF,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x18,0xFF,0xFE,
+0x3C,0x7F,0xFC,0x7E,0x3F,0xEC,0xFF,
+};
+
+// gridicons_custom_post_type : 72 bytes, packed 63
+const unsigned char gridicons_custom_post_type_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x00,0x07,
+0xE0,0x07,0xC7,0xE0,0x07,0xC7,0xE1,0x07,0xC7,0xE1,0x07,0xC7,0xE3,0x87,0xC7,0xE7,
+0xC0,0x07,0xE7,0xC0,0x07,0xE0,0x00,0x07,0xE0,0x0E,0x07,0xE0,0x1F,0x07,0xE0,0x1F,
+0x07,0xE0,0x1F,0x07,0xE0,0x0E,0x07,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF8,0xFF,
+};
+
+// gridicons_dropdown : 72 bytes, packed 23
+const unsigned char gridicons_dropdown_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xE3,0xFF,0x0D,0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFF,0x81,0xFF,
+0xFF,0xC3,0xFF,0xFF,0xE7,0xE5,0xFF,
+};
+
+// gridicons_ellipsis : 72 bytes, packed 21
+const unsigned char gridicons_ellipsis_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xE3,0xFF,0x0B,0xF3,0xE7,0xCF,0xE1,0xC3,0x87,0xE1,0xC3,0x87,
+0xF3,0xE7,0xCF,0xE3,0xFF,
+};
+
+// gridicons_ellipsis_circle : 72 bytes, packed 67
+const unsigned char gridicons_ellipsis_circle_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF8,
+0x00,0x1F,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x00,0x07,0xC0,0x00,0x03,0xC0,0x00,
+0x03,0xC3,0x99,0xC3,0xC3,0x99,0xC3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE0,0x00,0x07,
+0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_external : 72 bytes, packed 63
+const unsigned char gridicons_external_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xE0,0x1F,0xFF,0xE0,0x1F,0xFF,0xE1,0xF8,0x0F,
+0xE0,0xF8,0x07,0xE4,0x7F,0xE7,0xE6,0x3F,0xE7,0xE7,0x1F,0xE7,0xE7,0x8F,0xE7,0xFF,
+0xC7,0xE7,0xFF,0xE3,0xE7,0xF9,0xF7,0xE7,0xF9,0xFF,0xE7,0xF9,0xFF,0xE7,0xF9,0xFF,
+0xE7,0xF9,0xFF,0xE7,0xF9,0xFF,0xE7,0xF8,0x00,0x07,0xFC,0x00,0x0F,0xF8,0xFF,
+};
+
+// gridicons_flag : 72 bytes, packed 59
+const unsigned char gridicons_flag_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x31,0xC0,0x1F,0xFF,0x80,0x1F,0xF0,0x00,0x1F,0xF0,
+0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x1F,0xF0,0x00,
+0x1F,0xF0,0x00,0x1F,0xF0,0x0F,0x9F,0xF0,0x1F,0x9F,0xFF,0xFF,0x9F,0xFF,0xFF,0x9F,
+0xFF,0xFF,0x9F,0xFF,0xFF,0x9F,0xFF,0xFF,0x9F,0xF8,0xFF,
+};
+
+// gridicons_flip_horizontal : 72 bytes, packed 57
+const unsigned char gridicons_flip_horizontal_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF3,0xFF,0xCF,
+0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0x80,0x00,0x01,0x80,
+0x00,0x01,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xF5,0xFF,
+};
+
+// gridicons_flip_vertical : 72 bytes, packed 73
+const unsigned char gridicons_flip_vertical_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFD,0xFF,0x3F,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xF8,
+0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x07,
+0xCF,0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x07,0xCF,
+0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x07,0xCF,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFF,
+0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFD,0xFF,
+};
+
+// gridicons_folder : 72 bytes, packed 50
+const unsigned char gridicons_folder_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF1,0xFF,0x28,0xFC,0x1F,0xFF,0xF8,0x0F,0xF8,0x00,0x0F,0xF0,
+0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,
+0xF2,0xFF,
+};
+
+// gridicons_folder_multiple : 72 bytes, packed 62
+const unsigned char gridicons_folder_multiple_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x34,0xF0,0x7F,0xFF,0xE0,0x3F,0xE0,0x00,0x3F,0xC0,
+0x00,0x3F,0xC0,0x00,0x37,0xC0,0x00,0x33,0xC0,0x00,0x33,0xC0,0x00,0x33,0xC0,0x00,
+0x33,0xC0,0x00,0x33,0xC0,0x00,0x33,0xC0,0x00,0x33,0xC0,0x00,0x33,0xE0,0x00,0x73,
+0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xF0,0x00,0x03,0xF8,0x00,0x07,0xFB,0xFF,
+};
+
+// gridicons_fullscreen : 72 bytes, packed 48
+const unsigned char gridicons_fullscreen_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x11,0xE0,0x7E,0x07,0xE0,0x7E,0x07,0xE1,0xFF,0x87,
+0xE0,0xFF,0x07,0xE4,0x7E,0x27,0xE6,0x7E,0x67,0xEF,0xFF,0x11,0xE6,0x7E,0x67,0xE4,
+0x7E,0x27,0xE0,0xFF,0x07,0xE1,0xFF,0x87,0xE0,0x7E,0x07,0xE0,0x7E,0x07,0xF8,0xFF,
+};
+
+// gridicons_fullscreen_exit : 72 bytes, packed 48
+const unsigned char gridicons_fullscreen_exit_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x11,0xF3,0x3C,0xCF,0xF1,0x3C,0x8F,0xF8,0x3C,0x1F,
+0xFC,0x3C,0x3F,0xF0,0x3C,0x0F,0xF0,0x3C,0x0F,0xF5,0xFF,0x11,0xF0,0x3C,0x0F,0xF0,
+0x3C,0x0F,0xFC,0x3C,0x3F,0xF8,0x3C,0x1F,0xF1,0x3C,0x8F,0xF3,0x3C,0xCF,0xF5,0xFF,
+};
+
+// gridicons_globe : 72 bytes, packed 67
+const unsigned char gridicons_globe_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3C,0x1F,0xF0,
+0x7E,0x0F,0xF0,0x30,0x0F,0xE4,0x30,0x07,0xE6,0x30,0x07,0xCF,0xB8,0x03,0xC1,0xFC,
+0x03,0xC1,0xFF,0x83,0xC0,0xFF,0x83,0xC0,0xE1,0xF3,0xC0,0xE1,0xE3,0xE7,0x81,0xE7,
+0xE3,0x81,0xC7,0xF3,0x83,0xCF,0xF1,0xC7,0x0F,0xF8,0x66,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_grid : 72 bytes, packed 51
+const unsigned char gridicons_grid_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x0B,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,
+0xF0,0xC3,0x0F,0xFB,0xFF,0x0B,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,
+0xC3,0x0F,0xFB,0xFF,0x0B,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,
+0x0F,0xF5,0xFF,
+};
+
+// gridicons_heading : 72 bytes, packed 54
+const unsigned char gridicons_heading_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x2C,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,
+0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xFC,
+0x00,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,
+0x3F,0xFC,0x7E,0x3F,0xF5,0xFF,
+};
+
+// gridicons_heading_h1 : 72 bytes, packed 39
+const unsigned char gridicons_heading_h1_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEC,0xFF,0x1D,0xF9,0xE7,0x9F,0xF8,0xE7,0x9F,0xF8,0x67,0x9F,
+0xF9,0xE7,0x9F,0xF9,0xE0,0x1F,0xF9,0xE0,0x1F,0xF9,0xE7,0x9F,0xF9,0xE7,0x9F,0xF9,
+0xE7,0x9F,0xF9,0xE7,0x9F,0xEC,0xFF,
+};
+
+// gridicons_heading_h2 : 72 bytes, packed 39
+const unsigned char gridicons_heading_h2_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEC,0xFF,0x1D,0xF8,0x39,0xE7,0xF0,0x19,0xE7,0xF3,0x99,0xE7,
+0xF3,0xF9,0xE7,0xF3,0xF8,0x07,0xF9,0xF8,0x07,0xF8,0xF9,0xE7,0xFE,0x39,0xE7,0xE0,
+0x19,0xE7,0xE0,0x19,0xE7,0xEC,0xFF,
+};
+
+// gridicons_heading_h4 : 72 bytes, packed 39
+const unsigned char gridicons_heading_h4_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEC,0xFF,0x1D,0xF1,0xF9,0xE7,0xF0,0xF9,0xE7,0xF0,0x79,0xE7,
+0xF2,0x39,0xE7,0xF3,0x18,0x07,0xF3,0x98,0x07,0xE0,0x19,0xE7,0xE0,0x19,0xE7,0xF3,
+0xF9,0xE7,0xF3,0xF9,0xE7,0xEC,0xFF,
+};
+
+// gridicons_heart : 72 bytes, packed 65
+const unsigned char gridicons_heart_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x37,0xF8,0x3C,0x1F,0xF0,0x18,0x0F,0xE0,0x00,0x07,
+0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE0,
+0x00,0x07,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFC,0x00,
+0x3F,0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFF,0x81,0xFF,0xFF,0xC3,0xFF,0xFF,0xE7,0xFA,
+0xFF,
+};
+
+// gridicons_heart_outline : 72 bytes, packed 65
+const unsigned char gridicons_heart_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x37,0xF8,0x3C,0x1F,0xF0,0x18,0x0F,0xE7,0xC3,0xE7,
+0xCF,0xE7,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xEF,
+0xFF,0xF7,0xE7,0xFF,0xE7,0xF7,0xFF,0xEF,0xF3,0xFF,0xCF,0xF9,0xFF,0x9F,0xFC,0xFF,
+0x3F,0xFE,0x7E,0x7F,0xFF,0x3C,0xFF,0xFF,0x99,0xFF,0xFF,0xC3,0xFF,0xFF,0xE7,0xFA,
+0xFF,
+};
+
+// gridicons_help : 72 bytes, packed 67
+const unsigned char gridicons_help_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF8,
+0x00,0x1F,0xF0,0x3C,0x0F,0xE0,0x7E,0x07,0xE0,0xE7,0x07,0xC0,0xC3,0x03,0xC0,0xC0,
+0x03,0xC0,0xE0,0x03,0xC0,0x78,0x03,0xC0,0x38,0x03,0xC0,0x18,0x03,0xE0,0x00,0x07,
+0xE0,0x18,0x07,0xF0,0x18,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_help_outline : 72 bytes, packed 66
+const unsigned char gridicons_help_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x27,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3C,0x1F,0xF1,
+0xFF,0x0F,0xF3,0xC3,0xCF,0xE3,0x81,0xC7,0xE7,0x18,0xE7,0xCF,0x3C,0xF3,0xCF,0x3F,
+0xF3,0xCF,0x1F,0xF3,0xCF,0x87,0xF3,0xCF,0xC7,0xF3,0xC7,0xE7,0xE3,0xE7,0xFF,0xFD,
+0xE7,0x0D,0xF3,0xE7,0xCF,0xF1,0xFF,0x0F,0xF8,0x7E,0x1F,0xFE,0x00,0x7F,0xFF,0x81,
+0xFA,0xFF,
+};
+
+// gridicons_history : 72 bytes, packed 67
+const unsigned char gridicons_history_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xF3,0xFE,0x00,0x73,0xF8,0x3C,0x13,0xF1,
+0xFF,0x03,0xF3,0xFF,0xC3,0xE3,0xE6,0x03,0xE7,0xE6,0x03,0xCF,0xE7,0xFF,0xCF,0xE7,
+0xFF,0xCF,0xE7,0xFF,0xCF,0xC7,0xFF,0xCF,0xCF,0xF7,0xC7,0x9F,0xE3,0xE7,0x1F,0xE7,
+0xE7,0xFF,0xC7,0xF3,0xFF,0xCF,0xF1,0xFF,0x0F,0xF8,0x3E,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_house : 72 bytes, packed 68
+const unsigned char gridicons_house_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFD,0xFF,0x3A,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x00,0xFF,0xFE,
+0x00,0x7F,0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xC0,0x00,
+0x03,0xC0,0x00,0x03,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x1C,0x0F,
+0xF0,0x7C,0x0F,0xF0,0x7E,0x0F,0xF0,0x7E,0x0F,0xF0,0x7E,0x0F,0xF0,0x7E,0x0F,0xF0,
+0x7E,0x0F,0xF8,0xFF,
+};
+
+// gridicons_image : 72 bytes, packed 57
+const unsigned char gridicons_image_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xE0,0x00,0x07,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xCF,0xBF,0xF3,0xCF,0x1E,0xF3,0xCF,0xBE,0x73,0xCF,0xFC,0x33,0xCF,
+0xF8,0x13,0xCC,0xF0,0x03,0xC8,0x60,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,
+0x03,0xC0,0x00,0x03,0xE0,0x00,0x07,0xF5,0xFF,
+};
+
+// gridicons_image_multiple : 72 bytes, packed 69
+const unsigned char gridicons_image_multiple_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xE0,0x00,0x7F,0xC0,0x00,0x3F,0xCF,0xFF,0x3F,
+0xCF,0xFF,0x3F,0xCE,0xFF,0x37,0xCC,0x77,0x33,0xCE,0xF3,0x33,0xCF,0xE1,0x33,0xCF,
+0xC0,0x33,0xC9,0x80,0x33,0xC0,0x00,0x33,0xC0,0x00,0x33,0xC0,0x00,0x33,0xC0,0x00,
+0x33,0xC0,0x00,0x33,0xE0,0x00,0x73,0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xFC,0x00,0x03,
+0xFE,0x00,0x07,0xFB,0xFF,
+};
+
+// gridicons_indent_left : 72 bytes, packed 55
+const unsigned char gridicons_indent_left_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2D,0xF3,0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xFF,0xFF,
+0xF3,0xFF,0xFF,0xF3,0xE3,0xFF,0xF3,0xC7,0xFF,0xF3,0x8F,0xFF,0xF3,0x00,0x03,0xF3,
+0x00,0x03,0xF3,0x8F,0xFF,0xF3,0xC7,0xFF,0xF3,0xE3,0xFF,0xF3,0xFF,0xFF,0xF3,0xFF,
+0xFF,0xF3,0xFF,0xFF,0xF3,0xF3,0xFF,
+};
+
+// gridicons_indent_right : 72 bytes, packed 55
+const unsigned char gridicons_indent_right_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF3,0xFF,0x2D,0xCF,0xFF,0xFF,0xCF,0xFF,0xFF,0xCF,0xFF,0xFF,
+0xCF,0xFF,0xC7,0xCF,0xFF,0xE3,0xCF,0xFF,0xF1,0xCF,0xC0,0x00,0xCF,0xC0,0x00,0xCF,
+0xFF,0xF1,0xCF,0xFF,0xE3,0xCF,0xFF,0xC7,0xCF,0xFF,0xFF,0xCF,0xFF,0xFF,0xCF,0xFF,
+0xFF,0xCF,0xFF,0xFF,0xCF,0xF5,0xFF,
+};
+
+// gridicons_info : 72 bytes, packed 67
+const unsigned char gridicons_info_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF8,
+0x00,0x1F,0xF0,0x00,0x0F,0xE0,0x18,0x07,0xE0,0x18,0x07,0xC0,0x00,0x03,0xC0,0x00,
+0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xE0,0x18,0x07,
+0xE0,0x18,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_info_outline : 72 bytes, packed 64
+const unsigned char gridicons_info_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x10,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3C,0x1F,0xF1,
+0xFF,0x0F,0xF3,0xFF,0xCF,0xE3,0xE7,0xC7,0xFE,0xE7,0x11,0xCF,0xFF,0xF3,0xCF,0xFF,
+0xF3,0xCF,0xE7,0xF3,0xCF,0xE7,0xF3,0xCF,0xE7,0xF3,0xC7,0xE7,0xE3,0xFB,0xE7,0x0D,
+0xF3,0xFF,0xCF,0xF1,0xFF,0x0F,0xF8,0x7E,0x1F,0xFE,0x00,0x7F,0xFF,0x81,0xFA,0xFF,
+};
+
+// gridicons_ink : 72 bytes, packed 64
+const unsigned char gridicons_ink_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x36,0xE7,0xFF,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,
+0x81,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFC,0x00,
+0x3F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,
+0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFF,0xC1,0xFA,0xFF,
+};
+
+// gridicons_institution : 72 bytes, packed 62
+const unsigned char gridicons_institution_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x10,0xE7,0xFF,0xFF,0x00,0xFF,0xFC,0x00,0x3F,0xE0,
+0x00,0x07,0xC0,0x00,0x03,0xC0,0x00,0x03,0xFB,0xFF,0x14,0xF1,0xC3,0x8F,0xF1,0xE7,
+0x8F,0xF1,0xC3,0x8F,0xF1,0xE7,0x8F,0xF1,0xC3,0x8F,0xF1,0xE7,0x8F,0xF1,0xC3,0x8F,
+0xFB,0xFF,0x08,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xFB,0xFF,
+};
+
+// gridicons_italic : 72 bytes, packed 54
+const unsigned char gridicons_italic_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x2C,0xFE,0x03,0xFF,0xFF,0x03,0xFF,0xFF,0x87,0xFF,
+0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC3,0xFF,0xFF,
+0xE3,0xFF,0xFF,0xE3,0xFF,0xFF,0xE3,0xFF,0xFF,0xE1,0xFF,0xFF,0xE1,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,0x7F,0xF5,0xFF,
+};
+
+// gridicons_layout : 72 bytes, packed 65
+const unsigned char gridicons_layout_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x37,0xE0,0x7F,0xFF,0xC0,0x3E,0x0F,0xC0,0x3C,0x07,
+0xC0,0x3C,0x07,0xC0,0x3C,0x07,0xC0,0x3C,0x07,0xE0,0x7C,0x07,0xFF,0xFC,0x07,0xFF,
+0xFC,0x07,0xF0,0x1C,0x07,0xE0,0x0C,0x07,0xE0,0x0C,0x07,0xE0,0x0C,0x07,0xE0,0x0C,
+0x07,0xE0,0x0C,0x07,0xE0,0x0C,0x07,0xE0,0x0E,0x0F,0xE0,0x0F,0xFF,0xF0,0x1F,0xFA,
+0xFF,
+};
+
+// gridicons_layout_blocks : 72 bytes, packed 66
+const unsigned char gridicons_layout_blocks_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFE,0xFF,0x23,0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xF9,0xFF,0x9F,
+0xF9,0xFF,0x9F,0xF9,0xFC,0x03,0xF9,0xF8,0x01,0xC0,0x38,0x01,0x80,0x18,0x01,0x9F,
+0x98,0x01,0x9F,0x98,0x01,0x9F,0x98,0x01,0x9F,0x9C,0x03,0xF5,0x9F,0x11,0x80,0x1F,
+0x9F,0xC0,0x3F,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF8,0x00,0x1F,0xFC,0x00,0x3F,
+0xFE,0xFF,
+};
+
+// gridicons_link : 72 bytes, packed 39
+const unsigned char gridicons_link_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEC,0xFF,0x1D,0xF0,0x7E,0x0F,0xE0,0x3C,0x07,0xC7,0xFF,0xE3,
+0xCF,0xFF,0xF3,0xCE,0x00,0x73,0xCE,0x00,0x73,0xCF,0xFF,0xF3,0xC7,0xFF,0xE3,0xE0,
+0x3C,0x07,0xF0,0x7E,0x0F,0xEC,0xFF,
+};
+
+// gridicons_link_break : 72 bytes, packed 63
+const unsigned char gridicons_link_break_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x35,0xC7,0xFF,0xFF,0xC3,0xFF,0xFF,0xE1,0xFF,0xFF,
+0xF0,0xFE,0x0F,0xE0,0x78,0x07,0xC4,0x3F,0xE3,0xCE,0x1F,0xF3,0xCE,0x0C,0x73,0xCE,
+0x06,0x73,0xCF,0xC3,0xF3,0xC7,0xE1,0xE3,0xE0,0x30,0xC7,0xF0,0x78,0x6F,0xFF,0xFC,
+0x3F,0xFF,0xFE,0x1F,0xFF,0xFF,0x0F,0xFF,0xFF,0x8F,0xFF,0xFF,0xCF,0xFB,0xFF,
+};
+
+// gridicons_list_checkmark : 72 bytes, packed 57
+const unsigned char gridicons_list_checkmark_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x0D,0xFE,0x7F,0xFF,0xFE,0x3F,0xE0,0x03,0x87,0xE0,
+0x03,0x87,0xFF,0xFF,0xEF,0xFD,0xFF,0x0D,0xFE,0x7F,0xFF,0xFE,0x3F,0xE0,0x03,0x07,
+0xE0,0x03,0xC7,0xFF,0xFF,0xEF,0xFD,0xFF,0x0D,0xFE,0x7F,0xFF,0xFE,0x3F,0xE0,0x03,
+0x07,0xE0,0x03,0xC7,0xFF,0xFF,0xEF,0xF5,0xFF,
+};
+
+// gridicons_list_unordered : 72 bytes, packed 33
+const unsigned char gridicons_list_unordered_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE0,0x01,0xCF,0xE0,0x01,0xCF,0xF5,0xFF,0x05,
+0xE0,0x01,0xCF,0xE0,0x01,0xCF,0xF5,0xFF,0x05,0xE0,0x01,0xCF,0xE0,0x01,0xCF,0xF2,
+0xFF,
+};
+
+// gridicons_location : 72 bytes, packed 64
+const unsigned char gridicons_location_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x36,0xC1,0xFF,0xFF,0x00,0xFF,0xFE,0x00,0x7F,0xFC,
+0x00,0x3F,0xF8,0x18,0x1F,0xF8,0x7E,0x1F,0xF8,0x7E,0x1F,0xF8,0x7E,0x1F,0xF8,0x3C,
+0x1F,0xFC,0x3C,0x3F,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xFE,0x00,0x7F,0xFF,0x00,0xFF,
+0xFF,0x00,0xFF,0xFF,0x81,0xFF,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0xE7,0xF7,0xFF,
+};
+
+// gridicons_lock : 72 bytes, packed 68
+const unsigned char gridicons_lock_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x3A,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x3C,0xFF,0xFE,
+0x3C,0x7F,0xFE,0x7E,0x7F,0xFE,0x7E,0x7F,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,0x0F,0xF0,0x18,0x0F,0xF0,0x3C,0x0F,0xF0,0x3C,0x0F,0xF0,0x18,0x0F,
+0xF0,0x18,0x0F,0xF0,0x18,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,
+0x00,0x1F,0xFB,0xFF,
+};
+
+// gridicons_mail : 72 bytes, packed 57
+const unsigned char gridicons_mail_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xE0,0x00,0x07,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xC3,0xFF,0xC3,0xC0,0xFF,0x03,0xC0,0x7E,0x03,0xC0,
+0x18,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,
+0x03,0xC0,0x00,0x03,0xE0,0x00,0x07,0xF5,0xFF,
+};
+
+// gridicons_mention : 72 bytes, packed 67
+const unsigned char gridicons_mention_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3E,0x1F,0xF1,
+0xFF,0x9F,0xF3,0xFF,0xCF,0xE2,0x43,0xC7,0xE6,0x01,0xE7,0xCE,0x18,0xF3,0xCE,0x7E,
+0x73,0xCE,0x7E,0x73,0xCE,0x7E,0x73,0xC4,0x3C,0x73,0xE0,0x3C,0xE3,0xF1,0x01,0xE7,
+0xFF,0xC3,0xE7,0xFF,0xFF,0xCF,0xFF,0xFF,0x0F,0xFF,0xFE,0x1F,0xFF,0xF0,0x7F,0xFF,
+0xF1,0xFA,0xFF,
+};
+
+// gridicons_menu : 72 bytes, packed 33
+const unsigned char gridicons_menu_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEF,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xF8,0xFF,0x05,
+0xE0,0x00,0x07,0xE0,0x00,0x07,0xF8,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xEF,
+0xFF,
+};
+
+// gridicons_menus : 72 bytes, packed 32
+const unsigned char gridicons_menus_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE0,0x01,0xCF,0xE0,0x01,0xCF,0xF4,0xFF,0x04,
+0x81,0xCF,0xFF,0x81,0xCF,0xF5,0xFF,0x05,0xF8,0x01,0xCF,0xF8,0x01,0xCF,0xF2,0xFF,
+};
+
+// gridicons_microphone : 72 bytes, packed 67
+const unsigned char gridicons_microphone_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x81,0xFF,0xFF,
+0x81,0xFF,0xFF,0x81,0xFF,0xFF,0x81,0xFF,0xFF,0x81,0xFF,0xF9,0x81,0x9F,0xF9,0x81,
+0x9F,0xF9,0x81,0x9F,0xF8,0xC3,0x1F,0xFC,0x7E,0x3F,0xFE,0x3C,0x7F,0xFF,0x00,0xFF,
+0xFF,0xC1,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0x00,0xFF,0xFF,
+0x00,0xFA,0xFF,
+};
+
+// gridicons_minus : 72 bytes, packed 15
+const unsigned char gridicons_minus_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xE0,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0xFF,
+};
+
+// gridicons_minus_small : 72 bytes, packed 15
+const unsigned char gridicons_minus_small_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xE0,0xFF,0x05,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xE0,0xFF,
+};
+
+// gridicons_money : 72 bytes, packed 51
+const unsigned char gridicons_money_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x29,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC1,0xFF,0x83,
+0xC1,0xFF,0x83,0xC3,0xE7,0xC3,0xCF,0xC3,0xF3,0xCF,0xC3,0xF3,0xCF,0xC3,0xF3,0xCF,
+0xC3,0xF3,0xC3,0xE7,0xC3,0xC1,0xFF,0x83,0xC1,0xFF,0x83,0xC0,0x00,0x03,0xC0,0x00,
+0x03,0xF2,0xFF,
+};
+
+// gridicons_nametag : 72 bytes, packed 62
+const unsigned char gridicons_nametag_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x34,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x3C,0xFF,0xE0,
+0x24,0x07,0xC0,0x24,0x03,0xC0,0x3C,0x03,0xC0,0x3C,0x03,0xCF,0x00,0xF3,0xCF,0x81,
+0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCC,0x00,0x33,0xCC,0x00,0x33,0xCC,0x00,0x33,
+0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xC0,0x00,0x03,0xE0,0x00,0x07,0xF8,0xFF,
+};
+
+// gridicons_next_page : 72 bytes, packed 69
+const unsigned char gridicons_next_page_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xE0,0x00,0x7F,0xC0,0x00,0x3F,0xCF,0xFF,0x3F,
+0xCF,0xFF,0x3F,0xCC,0x03,0x37,0xCC,0x03,0x33,0xCF,0xFF,0x33,0xCF,0xFF,0x33,0xC0,
+0x7F,0x33,0xC0,0x3F,0x33,0xC0,0x3F,0x33,0xF0,0x3F,0x33,0xF0,0x3F,0x33,0xFC,0x3F,
+0x33,0xFC,0x00,0x33,0xFF,0x00,0x73,0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xFC,0x00,0x03,
+0xFE,0x00,0x07,0xFB,0xFF,
+};
+
+// gridicons_not_visible : 72 bytes, packed 63
+const unsigned char gridicons_not_visible_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x35,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xE1,0xC1,0xFF,
+0xF0,0xC0,0x3F,0xF8,0xE0,0x1F,0xE0,0x30,0x87,0xC2,0x38,0xC3,0x8F,0x0C,0xF1,0x8F,
+0x0F,0xF1,0xC7,0x83,0xC3,0xE1,0xC1,0xC7,0xF0,0x30,0xDF,0xFC,0x00,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFE,0x3F,0xFF,0xFF,0x0F,0xFF,0xFF,0x8F,0xFF,0xFF,0xEF,0xFB,0xFF,
+};
+
+// gridicons_notice : 72 bytes, packed 67
+const unsigned char gridicons_notice_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF0,
+0x00,0x0F,0xF0,0x00,0x0F,0xE0,0x18,0x07,0xE0,0x18,0x07,0xC0,0x18,0x03,0xC0,0x18,
+0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE0,0x18,0x07,
+0xE0,0x18,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_notice_outline : 72 bytes, packed 61
+const unsigned char gridicons_notice_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x0D,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x7E,0x1F,0xF1,
+0xFF,0x8F,0xF3,0xFF,0xCF,0xFB,0xE7,0x11,0xCF,0xE7,0xF3,0xCF,0xE7,0xF3,0xCF,0xE7,
+0xF3,0xCF,0xE7,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xFB,0xE7,0x0D,0xF3,0xFF,0xCF,
+0xF1,0xFF,0x8F,0xF8,0x7E,0x1F,0xFE,0x00,0x7F,0xFF,0x81,0xFA,0xFF,
+};
+
+// gridicons_offline : 72 bytes, packed 60
+const unsigned char gridicons_offline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x32,0xFC,0x03,0xFF,0xFE,0x01,0xFF,0xFF,0x01,0xFF,
+0xFF,0x00,0xFF,0xFF,0x80,0xFF,0xFF,0xC0,0xFF,0xFC,0x00,0x7F,0xFE,0x00,0x7F,0xFF,
+0x00,0x3F,0xFF,0x83,0xFF,0xFF,0xC1,0xFF,0xFF,0xE1,0xFF,0xFF,0xF0,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFC,0xFF,0xFF,0xFE,0x7F,0xFF,0xFF,0x7F,0xF5,0xFF,
+};
+
+// gridicons_pages : 72 bytes, packed 69
+const unsigned char gridicons_pages_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF3,0xFF,0xCF,
+0xF3,0xFF,0xCF,0xF3,0x00,0xCF,0xF3,0x00,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,
+0x00,0xCF,0xF3,0x00,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF0,0x1F,0xCF,0xF0,0x0F,
+0xCF,0xF0,0x0F,0xCF,0xFC,0x0F,0xCF,0xFC,0x0F,0xCF,0xFF,0x0F,0xCF,0xFF,0x00,0x0F,
+0xFF,0xC0,0x1F,0xFB,0xFF,
+};
+
+// gridicons_pause : 72 bytes, packed 67
+const unsigned char gridicons_pause_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF0,
+0x00,0x0F,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x66,0x07,0xC0,0x66,0x03,0xC0,0x66,
+0x03,0xC0,0x66,0x03,0xC0,0x66,0x03,0xC0,0x66,0x03,0xC0,0x66,0x03,0xE0,0x66,0x07,
+0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_pencil : 72 bytes, packed 63
+const unsigned char gridicons_pencil_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xF8,0x7F,0xFF,0xF0,0x7F,0xFF,0xE0,0x3F,0xFF,
+0xE0,0x6F,0xFF,0xE0,0x8F,0xFF,0xE1,0x03,0xFF,0xFB,0x03,0xFF,0xFC,0x00,0xFF,0xFC,
+0x00,0xFF,0xFE,0x00,0x3F,0xFF,0x00,0x3F,0xFF,0x80,0x0F,0xFF,0xC0,0x0F,0xFF,0xE0,
+0x1F,0xFF,0xF0,0x3F,0xFF,0xF8,0x67,0xFF,0xFC,0xC7,0xFF,0xFF,0xC7,0xF8,0xFF,
+};
+
+// gridicons_phone : 72 bytes, packed 69
+const unsigned char gridicons_phone_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xFE,0x00,0x7F,0xFC,0x00,0x3F,0xFC,0x00,0x3F,
+0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,
+0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,
+0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0x00,0x3F,0xFC,0x18,0x3F,
+0xFE,0x00,0x7F,0xFB,0xFF,
+};
+
+// gridicons_play : 72 bytes, packed 67
+const unsigned char gridicons_play_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF0,
+0x00,0x1F,0xF0,0x04,0x0F,0xE0,0x0C,0x07,0xE0,0x1C,0x07,0xC0,0x3C,0x03,0xC0,0x7C,
+0x03,0xC0,0xFC,0x03,0xC0,0xFC,0x03,0xC0,0x7C,0x03,0xC0,0x3C,0x03,0xE0,0x1C,0x07,
+0xE0,0x0C,0x07,0xF0,0x04,0x0F,0xF0,0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_plugins : 72 bytes, packed 67
+const unsigned char gridicons_plugins_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x3C,0xFF,0xFF,0x3C,0xFF,0xFF,0x3C,0xFF,0xFF,
+0x3C,0xFF,0xFF,0x3C,0xFF,0xFF,0x3C,0xFF,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,
+0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xFC,0x00,0x3F,0xFC,0x00,0x3F,
+0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFF,0x81,0xFF,0xFF,0x81,0xFF,0xFF,0x81,0xFF,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_plus : 72 bytes, packed 61
+const unsigned char gridicons_plus_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x33,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,
+0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xE0,0x00,
+0x07,0xE0,0x00,0x07,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,
+0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xF7,0xFF,
+};
+
+// gridicons_plus_small : 72 bytes, packed 43
+const unsigned char gridicons_plus_small_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEE,0xFF,0x21,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,
+0xE7,0xFF,0xFF,0xE7,0xFF,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xFF,0xE7,0xFF,0xFF,0xE7,
+0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xEE,0xFF,
+};
+
+// gridicons_popout : 72 bytes, packed 63
+const unsigned char gridicons_popout_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x35,0xF0,0x00,0x7F,0xE0,0x00,0x3F,0xE7,0xFF,0x3F,
+0xE7,0xFF,0x3F,0xE7,0xE3,0xFF,0xE7,0xC7,0xFF,0xE7,0x8F,0xFF,0xE7,0x1F,0xFF,0xE6,
+0x00,0x07,0xE6,0x00,0x07,0xE7,0x1F,0xFF,0xE7,0x8F,0xFF,0xE7,0xC7,0xFF,0xE7,0xE3,
+0xFF,0xE7,0xFF,0x3F,0xE7,0xFF,0x3F,0xE0,0x00,0x3F,0xF0,0x00,0x7F,0xF8,0xFF,
+};
+
+// gridicons_posts : 72 bytes, packed 41
+const unsigned char gridicons_posts_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x05,0xE1,0xC0,0x07,0xE1,0xC0,0x07,0xFB,0xFF,0x05,
+0xE0,0x00,0x07,0xE0,0x00,0x07,0xFB,0xFF,0x05,0xE0,0x07,0x07,0xE0,0x07,0x07,0xFA,
+0xFF,0x04,0x00,0x07,0xFF,0x00,0x07,0xF2,0xFF,
+};
+
+// gridicons_print : 72 bytes, packed 66
+const unsigned char gridicons_print_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x38,0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xF9,0xFF,0x9F,
+0xF9,0xFF,0x9F,0xE0,0x00,0x07,0xC0,0x00,0x03,0xC4,0x00,0x03,0xCE,0x00,0x03,0xC4,
+0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC1,0xFF,0x83,0xC1,0xFF,0x83,0xC1,0x81,
+0x83,0xF9,0x81,0x9F,0xF9,0xFF,0x9F,0xF9,0xFF,0x9F,0xF8,0x00,0x1F,0xFC,0x00,0x3F,
+0xFB,0xFF,
+};
+
+// gridicons_product : 72 bytes, packed 66
+const unsigned char gridicons_product_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x38,0xC0,0x00,0x03,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,
+0x81,0xE7,0xE7,0xC3,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,
+0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,
+0xFB,0xFF,
+};
+
+// gridicons_product_downloadable : 72 bytes, packed 57
+const unsigned char gridicons_product_downloadable_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x13,0xC0,0x00,0x03,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE7,0xFF,0xF7,0xE7,0x0D,0xE6,0x66,
+0x67,0xE6,0x24,0x67,0xE7,0x00,0xE7,0xE7,0x81,0xE7,0xE7,0xC3,0xFC,0xE7,0x07,0xFF,
+0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xFB,0xFF,
+};
+
+// gridicons_product_external : 72 bytes, packed 66
+const unsigned char gridicons_product_external_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x38,0xC0,0x00,0x03,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE6,
+0x07,0xE7,0xE6,0x07,0xE7,0xE6,0x1F,0xE7,0xE6,0x0F,0xE7,0xE6,0x47,0xE7,0xE6,0x67,
+0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,
+0xFB,0xFF,
+};
+
+// gridicons_product_virtual : 72 bytes, packed 66
+const unsigned char gridicons_product_virtual_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x38,0xC0,0x00,0x03,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0xFF,0xF3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,
+0xE3,0xE7,0xE7,0xC1,0xE7,0xE7,0x81,0xE7,0xE7,0x01,0xE7,0xE6,0x00,0x67,0xE6,0x00,
+0x67,0xE7,0x00,0x67,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,
+0xFB,0xFF,
+};
+
+// gridicons_read_more : 72 bytes, packed 63
+const unsigned char gridicons_read_more_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x11,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF3,0xFF,0xCF,
+0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xFB,0xFF,0x05,0xC1,0x81,0x83,0xC1,
+0x81,0x83,0xFB,0xFF,0x17,0xF0,0x1F,0xCF,0xF0,0x0F,0xCF,0xF0,0x0F,0xCF,0xFC,0x0F,
+0xCF,0xFC,0x0F,0xCF,0xFF,0x0F,0xCF,0xFF,0x00,0x0F,0xFF,0xC0,0x1F,0xFB,0xFF,
+};
+
+// gridicons_reader : 72 bytes, packed 57
+const unsigned char gridicons_reader_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE7,0xFF,0xE7,
+0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE7,0xCF,0xE7,0xE7,0xC0,0x07,0xE7,
+0xCF,0xE7,0xE7,0xC0,0x07,0xE7,0xC3,0xE7,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,
+0x07,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF5,0xFF,
+};
+
+// gridicons_reader_follow : 72 bytes, packed 64
+const unsigned char gridicons_reader_follow_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x36,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF3,0xFF,0xF3,
+0xF3,0xFF,0xF3,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x07,0xF3,0xF0,0x00,0x03,0xF0,
+0x07,0xF3,0xFF,0x00,0x03,0xFF,0x00,0xF3,0xF3,0x00,0x03,0xF3,0xE0,0x03,0xF3,0xE0,
+0x03,0x80,0x60,0x03,0x80,0x60,0x07,0xF3,0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xF6,0xFF,
+};
+
+// gridicons_reader_following : 72 bytes, packed 65
+const unsigned char gridicons_reader_following_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x37,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF3,0xFF,0xF3,
+0xF3,0xFF,0xF3,0xF0,0x00,0x03,0xF0,0x00,0x03,0xF0,0x07,0xF3,0xF0,0x00,0x03,0xF0,
+0x07,0xF3,0xF8,0x00,0x03,0xDC,0x00,0xF3,0x8E,0x20,0x03,0xC7,0x70,0x03,0xE3,0xF8,
+0x03,0xF1,0xDC,0x03,0xF8,0x8E,0x07,0xFC,0x1F,0xFF,0xFE,0x3F,0xFF,0xFF,0x7F,0xF7,
+0xFF,
+};
+
+// gridicons_reblog : 72 bytes, packed 57
+const unsigned char gridicons_reblog_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xF3,0xE0,0x1F,0xE1,0xE0,0x0F,0xC0,0xFF,0xCF,
+0x80,0x7F,0xCF,0x92,0x7F,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,
+0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFE,0x49,0xF3,0xFE,0x01,0xF3,0xFF,
+0x03,0xF0,0x07,0x87,0xF8,0x07,0xCF,0xF5,0xFF,
+};
+
+// gridicons_redo : 72 bytes, packed 55
+const unsigned char gridicons_redo_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0xF0,0xFF,0xFF,0xC0,0x3F,0xF3,0x86,0x3F,0xF3,
+0x1F,0x9F,0xF2,0x3F,0x8F,0xF0,0x7F,0xCF,0xF0,0xFF,0xCF,0xF0,0x1F,0x8F,0xF0,0x1F,
+0x9F,0xFF,0xFF,0x1F,0xFF,0xFE,0x3F,0xFF,0xFC,0x7F,0xFF,0xF8,0xFF,0xFF,0xF1,0xFF,
+0xFF,0xF3,0xFF,0xFF,0xF7,0xF4,0xFF,
+};
+
+// gridicons_refresh : 72 bytes, packed 64
+const unsigned char gridicons_refresh_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x36,0x8F,0xFF,0xFF,0x1F,0xFF,0xFE,0x3F,0xFF,0xFC,
+0x01,0xFF,0xFC,0x00,0x7F,0xFE,0x3C,0x3F,0xFF,0x1F,0x1F,0xFF,0x8F,0x9F,0xFF,0xFF,
+0x8F,0xFF,0xFF,0xCF,0xFF,0xFF,0xCF,0xFF,0xFF,0xCF,0xF3,0xFF,0xCF,0xF1,0xFF,0x8F,
+0xF9,0xFF,0x9F,0xF8,0xFF,0x1F,0xFC,0x3C,0x3F,0xFE,0x00,0x7F,0xFF,0x81,0xF7,0xFF,
+};
+
+// gridicons_reply : 72 bytes, packed 54
+const unsigned char gridicons_reply_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF3,0xFF,0x2C,0x7F,0xFF,0xFE,0x3F,0xFF,0xFF,0x1F,0xFF,0xFF,
+0x8F,0xFF,0x00,0x07,0xFC,0x00,0x07,0xF8,0xFF,0x8F,0xF9,0xFF,0x1F,0xF3,0xFE,0x3F,
+0xF3,0xFF,0x7F,0xF3,0xFF,0xFF,0xF3,0xFF,0xFF,0xF9,0xFF,0xFF,0xF8,0xFF,0xFF,0xFC,
+0x0F,0xFF,0xFF,0x0F,0xF4,0xFF,
+};
+
+// gridicons_resize : 72 bytes, packed 57
+const unsigned char gridicons_resize_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xF0,0x1F,0xFF,0xF0,0x1F,0xFF,0xF0,0xFF,0xFF,
+0xF0,0x7F,0xFF,0xF2,0x3F,0xFF,0xF3,0x1F,0xFF,0xF3,0x8F,0xFF,0xFF,0xC7,0xFF,0xFF,
+0xE3,0xFF,0xFF,0xF1,0xCF,0xFF,0xF8,0xCF,0xFF,0xFC,0x4F,0xFF,0xFE,0x0F,0xFF,0xFF,
+0x0F,0xFF,0xF8,0x0F,0xFF,0xF8,0x0F,0xF5,0xFF,
+};
+
+// gridicons_rotate : 72 bytes, packed 68
+const unsigned char gridicons_rotate_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x3A,0xC7,0xFF,0xFF,0xE3,0xFF,0xFF,0xF1,0xFF,0xFE,
+0x00,0xFF,0xF8,0x00,0xFF,0xF0,0xF1,0xFF,0xE3,0xE3,0xFF,0xE7,0xC7,0xFF,0xC7,0xFF,
+0xFF,0xCF,0xFF,0xFF,0xCE,0x00,0x1F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,
+0xFC,0x00,0x0F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,0xFC,0x00,0x0F,0xFE,
+0x00,0x1F,0xFB,0xFF,
+};
+
+// gridicons_scheduled : 72 bytes, packed 66
+const unsigned char gridicons_scheduled_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x38,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xF0,0x00,0x0F,
+0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,
+0x7F,0xE7,0xE6,0x3F,0xE7,0xE7,0x1F,0xE7,0xE7,0x8E,0xE7,0xE7,0xC4,0x67,0xE7,0xE0,
+0xE7,0xE7,0xF1,0xE7,0xE7,0xFB,0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,
+0xF8,0xFF,
+};
+
+// gridicons_search : 72 bytes, packed 60
+const unsigned char gridicons_search_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x32,0xE0,0x7F,0xFF,0xC0,0x3F,0xFF,0x8F,0x1F,0xFF,
+0x1F,0x8F,0xFE,0x3F,0xC7,0xFE,0x7F,0xE7,0xFE,0x7F,0xE7,0xFE,0x7F,0xE7,0xFE,0x7F,
+0xE7,0xFE,0x3F,0xC7,0xFF,0x1F,0x8F,0xFE,0x0F,0x1F,0xFC,0x00,0x3F,0xF8,0x20,0x7F,
+0xF0,0x7F,0xFF,0xE0,0xFF,0xFF,0xE1,0xFF,0xFF,0xF3,0xF6,0xFF,
+};
+
+// gridicons_share_computer : 72 bytes, packed 69
+const unsigned char gridicons_share_computer_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xE0,0x00,0x07,0xC0,0x00,0x03,0xCF,0xFF,0xF3,
+0xCF,0x3F,0xF3,0xCE,0x1F,0xF3,0xCE,0x07,0xF3,0xCF,0x30,0xF3,0xCF,0xFC,0x73,0xCF,
+0xFC,0x73,0xCF,0x30,0xF3,0xCE,0x07,0xF3,0xCE,0x1F,0xF3,0xCF,0x3F,0xF3,0xCF,0xFF,
+0xF3,0xC0,0x00,0x03,0xE0,0x00,0x07,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xFE,0x00,0x7F,
+0xFE,0x00,0x7F,0xFB,0xFF,
+};
+
+// gridicons_share_ios : 72 bytes, packed 60
+const unsigned char gridicons_share_ios_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0x1D,0xFF,0xE7,0xFF,0xFF,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x00,
+0xFF,0xFE,0x24,0x7F,0xFE,0x66,0x7F,0xFE,0xE7,0x7F,0xFF,0xE7,0xFF,0xF1,0xE7,0x8F,
+0xE1,0xE7,0x87,0xF4,0xE7,0x13,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,0xE7,0xFF,
+0xE7,0xE7,0xFF,0xE7,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF8,0xFF,
+};
+
+// gridicons_shipping : 72 bytes, packed 53
+const unsigned char gridicons_shipping_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF1,0xFF,0x2B,0x80,0x07,0xFF,0x00,0x03,0xFF,0x3F,0xF3,0xF8,
+0x3F,0xF3,0xF0,0x3F,0xF3,0xF0,0x3F,0xF3,0xC0,0x3F,0xF3,0xC0,0x3F,0xF3,0xC0,0x3F,
+0xF3,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC3,0x00,0xC3,0xF3,0x3C,0xCF,0xF0,0x3C,0x0F,
+0xFC,0xFF,0x3F,0xF5,0xFF,
+};
+
+// gridicons_sign_out : 72 bytes, packed 62
+const unsigned char gridicons_sign_out_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x34,0x80,0x0F,0xFF,0x00,0x07,0xFF,0x3F,0xE7,0xFF,
+0x3F,0xE7,0xF1,0xFF,0xE7,0xE3,0xFF,0xE7,0xC7,0xFF,0xE7,0x8F,0xFF,0xE7,0x00,0x03,
+0xE7,0x00,0x03,0xE7,0x8F,0xFF,0xE7,0xC7,0xFF,0xE7,0xE3,0xFF,0xE7,0xF9,0xFF,0xE7,
+0xFF,0x3F,0xE7,0xFF,0x3F,0xE7,0xFF,0x00,0x07,0xFF,0x80,0x0F,0xF8,0xFF,
+};
+
+// gridicons_spam : 72 bytes, packed 69
+const unsigned char gridicons_spam_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xF0,0x00,0x0F,
+0xF0,0x00,0x0F,0xC0,0x00,0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xC0,
+0x18,0x03,0xC0,0x18,0x03,0xC0,0x18,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x18,
+0x03,0xC0,0x18,0x03,0xC0,0x00,0x03,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xFC,0x00,0x3F,
+0xFC,0x00,0x3F,0xFB,0xFF,
+};
+
+// gridicons_speaker : 72 bytes, packed 60
+const unsigned char gridicons_speaker_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x32,0xFE,0x3F,0xFF,0xFE,0x3F,0xFF,0xFE,0x0F,0xFF,
+0xFE,0x0F,0xFF,0xFE,0x00,0x07,0xE6,0x00,0x03,0xC6,0x00,0x03,0xC6,0x00,0x03,0xC6,
+0x00,0x03,0xC6,0x00,0x03,0xE6,0x00,0x03,0xFE,0x00,0x07,0xFE,0x06,0x1F,0xFE,0x1E,
+0x1F,0xFE,0x1E,0x1F,0xFE,0x7E,0x1F,0xFF,0xFE,0x3F,0xF5,0xFF,
+};
+
+// gridicons_star : 72 bytes, packed 59
+const unsigned char gridicons_star_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x31,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,
+0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF8,0x00,
+0x1F,0xFC,0x00,0x3F,0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFE,0x00,0x7F,0xFE,0x00,0x7F,
+0xFE,0x18,0x7F,0xFC,0x3C,0x3F,0xFC,0xFF,0x3F,0xF5,0xFF,
+};
+
+// gridicons_star_outline : 72 bytes, packed 59
+const unsigned char gridicons_star_outline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x31,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,
+0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0xDB,0xFF,0xE0,0x18,0x07,0xF0,0x3E,0x0F,0xF9,0xFF,
+0x9F,0xFC,0x7E,0x3F,0xFE,0x7E,0x7F,0xFF,0x7E,0xFF,0xFE,0x66,0x7F,0xFE,0x42,0x7F,
+0xFE,0x18,0x7F,0xFC,0x3C,0x3F,0xFC,0xFF,0x3F,0xF5,0xFF,
+};
+
+// gridicons_stats : 72 bytes, packed 56
+const unsigned char gridicons_stats_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x0A,0xF0,0x00,0x0F,0xE0,0x00,0x07,0xE7,0xFF,0xE7,
+0xE7,0xFF,0xF7,0xE7,0x20,0xE6,0x67,0xE7,0xE6,0x67,0xE7,0xE6,0x66,0x67,0xE6,0x66,
+0x67,0xE6,0x66,0x67,0xE6,0x66,0x67,0xE6,0x66,0x67,0xE7,0xFF,0xE7,0xE7,0xFF,0xE7,
+0xE0,0x00,0x07,0xF0,0x00,0x0F,0xF8,0xFF,
+};
+
+// gridicons_stats_alt : 72 bytes, packed 59
+const unsigned char gridicons_stats_alt_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x28,0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xF0,
+0xC3,0xFF,0xF0,0xC3,0xFF,0xF0,0xC3,0xFF,0xF0,0xC3,0xFF,0xF0,0xC3,0x0F,0xF0,0xC3,
+0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,0xF0,0xC3,0x0F,
+0xFB,0xFF,0x05,0xE0,0x00,0x07,0xE0,0x00,0x07,0xF8,0xFF,
+};
+
+// gridicons_status : 72 bytes, packed 67
+const unsigned char gridicons_status_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x7E,0x1F,0xF1,
+0xFF,0x9F,0xF3,0xFF,0xCF,0xE3,0x3C,0xC7,0xE7,0x3C,0xE7,0xCF,0x3C,0xF3,0xCF,0x3C,
+0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0x00,0xF3,0xC7,0x00,0xE3,0xE7,0x00,0xE7,
+0xE7,0x81,0xE7,0xF3,0xC3,0xCF,0xF0,0xFF,0x0F,0xF8,0x7E,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_sync : 72 bytes, packed 55
+const unsigned char gridicons_sync_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0x8F,0xFF,0xFE,0x0F,0xFF,0xFC,0x3F,0xCF,0xF8,
+0xFF,0x87,0xF9,0xFF,0x03,0xF1,0xFE,0x01,0xF3,0xFE,0x49,0xF3,0xFE,0xCD,0xB3,0x7F,
+0xCF,0x92,0x7F,0xCF,0x80,0x7F,0x8F,0xC0,0xFF,0x9F,0xE1,0xFF,0x1F,0xF3,0xFC,0x3F,
+0xFF,0xF0,0x7F,0xFF,0xF1,0xF4,0xFF,
+};
+
+// gridicons_tablet : 72 bytes, packed 69
+const unsigned char gridicons_tablet_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x00,0x0F,
+0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,
+0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,
+0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF3,0xFF,0xCF,0xF0,0x00,0x0F,0xF0,0x18,0x0F,
+0xF8,0x00,0x1F,0xFB,0xFF,
+};
+
+// gridicons_tag : 72 bytes, packed 68
+const unsigned char gridicons_tag_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3A,0xE0,0x0F,0xFF,0xC0,0x07,0xFF,0xC0,0x03,0xFF,
+0xC3,0x01,0xFF,0xC7,0x80,0xFF,0xC7,0x80,0x7F,0xC3,0x00,0x3F,0xC0,0x00,0x1F,0xC0,
+0x00,0x0F,0xC0,0x00,0x07,0xE0,0x00,0x03,0xF0,0x00,0x03,0xF8,0x00,0x07,0xFC,0x00,
+0x0F,0xFE,0x00,0x1F,0xFF,0x00,0x3F,0xFF,0x80,0x7F,0xFF,0xC0,0xFF,0xFF,0xE1,0xFF,
+0xFF,0xF3,0xFA,0xFF,
+};
+
+// gridicons_text_color : 72 bytes, packed 62
+const unsigned char gridicons_text_color_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF7,0xFF,0x28,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x81,0xFF,0xFF,
+0x81,0xFF,0xFF,0x18,0xFF,0xFF,0x18,0xFF,0xFE,0x18,0xFF,0xFE,0x3C,0x7F,0xFE,0x00,
+0x7F,0xFC,0x00,0x3F,0xFC,0x3C,0x3F,0xFC,0x7E,0x3F,0xF8,0x7E,0x1F,0xF8,0xFF,0x1F,
+0xFB,0xFF,0x08,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xFB,0xFF,
+};
+
+// gridicons_themes : 72 bytes, packed 69
+const unsigned char gridicons_themes_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFB,0xFF,0x3B,0xE0,0x00,0x7F,0xC0,0x00,0x3F,0xCF,0xFF,0x3F,
+0xCF,0xFF,0x3F,0xCF,0xFF,0x37,0xC0,0x00,0x33,0xC0,0x00,0x33,0xCE,0x7F,0x33,0xCE,
+0x7F,0x33,0xCE,0x7F,0x33,0xCE,0x7F,0x33,0xCE,0x7F,0x33,0xCE,0x7F,0x33,0xCE,0x7F,
+0x33,0xC0,0x00,0x33,0xE0,0x00,0x73,0xFF,0xFF,0xF3,0xFF,0xFF,0xF3,0xFC,0x00,0x03,
+0xFE,0x00,0x07,0xFB,0xFF,
+};
+
+// gridicons_thumbs_up : 72 bytes, packed 68
+const unsigned char gridicons_thumbs_up_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x3A,0xF3,0xFF,0xFF,0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,
+0xC3,0xFF,0xFF,0xC3,0xFF,0xFF,0xC1,0xFF,0xFF,0xC0,0xFF,0xE0,0x00,0x7F,0xC0,0x00,
+0x7F,0xC0,0x00,0x3F,0xC0,0x00,0x3F,0xE0,0x00,0x33,0xE0,0x00,0x23,0xE0,0x00,0x23,
+0xE0,0x00,0x63,0xF0,0x00,0x63,0xF0,0x00,0x43,0xF0,0x00,0xC3,0xFC,0x00,0xC3,0xFF,
+0xFF,0x83,0xFB,0xFF,
+};
+
+// gridicons_time : 72 bytes, packed 67
+const unsigned char gridicons_time_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x10,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x3C,0x1F,0xF1,
+0xFF,0x0F,0xF3,0xFF,0xCF,0xE3,0xE7,0xC7,0xFE,0xE7,0x25,0xCF,0xE7,0xF3,0xCF,0xE7,
+0xF3,0xCF,0xE7,0xF3,0xCF,0xE7,0xF3,0xCF,0xCF,0xF3,0xC7,0x9F,0xE3,0xE7,0x3F,0xE7,
+0xE7,0xFF,0xE7,0xF3,0xFF,0xCF,0xF1,0xFF,0x0F,0xF8,0x7E,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_trash : 72 bytes, packed 64
+const unsigned char gridicons_trash_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x0D,0x81,0xFF,0xFF,0x00,0xFF,0xFF,0x3C,0xFF,0xF8,
+0x00,0x1F,0xF8,0x00,0x1F,0xFE,0xFF,0x25,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xFC,0x00,
+0x3F,0xFE,0x00,0x7F,0xFC,0x00,0x3F,0xFE,0x00,0x7F,0xFC,0x00,0x3F,0xFE,0x00,0x7F,
+0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0x00,0xF7,0xFF,
+};
+
+// gridicons_trophy : 72 bytes, packed 65
+const unsigned char gridicons_trophy_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x37,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xC0,0x00,0x03,
+0xC0,0x00,0x03,0xCC,0x00,0x33,0xCC,0x00,0x33,0xCC,0x00,0x33,0xE0,0x00,0x07,0xF0,
+0x00,0x0F,0xF8,0x00,0x1F,0xFE,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFF,0xC3,
+0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xC3,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFA,
+0xFF,
+};
+
+// gridicons_types : 72 bytes, packed 66
+const unsigned char gridicons_types_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF9,0xFF,0x38,0x3F,0xFF,0xFE,0x1F,0xFF,0xFE,0x1F,0xFF,0xFC,
+0x0F,0xFF,0xFD,0x0F,0xFF,0xFF,0xC7,0xFF,0x00,0x83,0xFF,0x00,0xC3,0xFF,0x00,0x81,
+0xFF,0xC0,0xFF,0xF8,0x70,0xFF,0xE0,0x10,0xFF,0xE0,0x18,0xFF,0xC0,0x08,0xFF,0xC0,
+0x0F,0xFF,0xC0,0x0F,0xFF,0xC0,0x0F,0xFF,0xE0,0x1F,0xFF,0xE0,0x1F,0xFF,0xF8,0x7F,
+0xFA,0xFF,
+};
+
+// gridicons_underline : 72 bytes, packed 59
+const unsigned char gridicons_underline_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF8,0xFF,0x28,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,
+0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,0x7E,0x3F,0xFC,
+0x7E,0x3F,0xFC,0x7E,0x3F,0xFE,0x3C,0x7F,0xFE,0x00,0x7F,0xFF,0x00,0xFF,0xFF,0xC3,
+0xFA,0xFF,0x05,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,
+};
+
+// gridicons_undo : 72 bytes, packed 55
+const unsigned char gridicons_undo_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x2D,0x0F,0xFF,0xFC,0x03,0xFF,0xF8,0x61,0xCF,0xF9,
+0xF8,0xCF,0xF1,0xFC,0x4F,0xF3,0xFE,0x0F,0xF3,0xFF,0x0F,0xF3,0xF8,0x0F,0xF9,0xF8,
+0x0F,0xF8,0xFF,0xFF,0xFC,0x7F,0xFF,0xFE,0x3F,0xFF,0xFF,0x1F,0xFF,0xFF,0x8F,0xFF,
+0xFF,0xCF,0xFF,0xFF,0xEF,0xF4,0xFF,
+};
+
+// gridicons_user : 72 bytes, packed 54
+const unsigned char gridicons_user_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF4,0xFF,0x15,0xC3,0xFF,0xFF,0x81,0xFF,0xFF,0x00,0xFF,0xFF,
+0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x81,0xFF,0xFF,0xC3,0xFC,0xFF,0x13,
+0x81,0xFF,0xFE,0x00,0x7F,0xF8,0x00,0x1F,0xF8,0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x00,
+0x0F,0xFE,0x00,0x3F,0xF5,0xFF,
+};
+
+// gridicons_user_add : 72 bytes, packed 56
+const unsigned char gridicons_user_add_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2E,0xFE,0x1F,0xFF,0xFC,0x0F,0xFF,0xF8,0x07,0xFF,
+0xF8,0x07,0xCF,0xF8,0x07,0xCF,0xF8,0x07,0xCF,0xFC,0x0E,0x01,0xFE,0x1E,0x01,0xFF,
+0xFF,0xCF,0xFC,0x0F,0xCF,0xF0,0x03,0xCF,0xC0,0x00,0xFF,0xC0,0x00,0xFF,0x80,0x00,
+0x7F,0x80,0x00,0x7F,0xF0,0x01,0xF4,0xFF,
+};
+
+// gridicons_user_circle : 72 bytes, packed 67
+const unsigned char gridicons_user_circle_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xFA,0xFF,0x39,0x81,0xFF,0xFE,0x00,0x7F,0xF8,0xFF,0x1F,0xF1,
+0xFF,0x8F,0xF3,0xC3,0xCF,0xE7,0x81,0xE7,0xEF,0x81,0xF7,0xCF,0x81,0xF3,0xCF,0x81,
+0xF3,0xCF,0xC3,0xF3,0xCF,0xF7,0xF3,0xCF,0x00,0xF3,0xCE,0x00,0x73,0xEC,0x00,0x37,
+0xE4,0x00,0x27,0xF2,0x00,0x4F,0xF1,0x00,0x8F,0xF8,0xFF,0x1F,0xFE,0x00,0x7F,0xFF,
+0x81,0xFA,0xFF,
+};
+
+// gridicons_video : 72 bytes, packed 57
+const unsigned char gridicons_video_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF5,0xFF,0x2F,0xEC,0x00,0x37,0xCC,0x00,0x33,0xC0,0x00,0x03,
+0xC0,0x00,0x03,0xCC,0x00,0x33,0xCC,0x04,0x33,0xCC,0x0C,0x33,0xC0,0x3C,0x03,0xC0,
+0x3C,0x03,0xCC,0x0C,0x33,0xCC,0x04,0x33,0xCC,0x00,0x33,0xC0,0x00,0x03,0xC0,0x00,
+0x03,0xCC,0x00,0x33,0xEC,0x00,0x37,0xF5,0xFF,
+};
+
+// gridicons_video_camera : 72 bytes, packed 51
+const unsigned char gridicons_video_camera_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xF2,0xFF,0x29,0xDF,0x00,0x07,0xCE,0x00,0x03,0xC6,0x00,0x03,
+0xC2,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x03,0xC0,
+0x00,0x03,0xC0,0x00,0x03,0xC2,0x00,0x03,0xC6,0x00,0x03,0xCE,0x00,0x03,0xDF,0x00,
+0x07,0xF2,0xFF,
+};
+
+// gridicons_visible : 72 bytes, packed 43
+const unsigned char gridicons_visible_packed[] PROGMEM =
+{
+0x48,0x00,0x00,0x00,0xEE,0xFF,0x21,0x81,0xFF,0xFC,0x00,0x3F,0xF8,0x00,0x1F,0xE1,
+0x00,0x87,0xC7,0x00,0xE3,0x8F,0x00,0xF1,0x8F,0x00,0xF1,0xC7,0x81,0xC3,0xE1,0xC3,
+0x87,0xF8,0x7E,0x1F,0xFC,0x00,0x3F,0xFF,0x80,0xEE,0xFF,
+};
+
+#endif